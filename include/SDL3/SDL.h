@@ -32,6 +32,7 @@
 #define SDL_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_arena.h>
 #include <SDL3/SDL_assert.h>
 #include <SDL3/SDL_asyncio.h>
 #include <SDL3/SDL_atomic.h>
@@ -46,6 +47,7 @@
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_framepacer.h>
 #include <SDL3/SDL_gamepad.h>
 #include <SDL3/SDL_gpu.h>
 #include <SDL3/SDL_guid.h>
@@ -55,6 +57,7 @@
 #include <SDL3/SDL_init.h>
 #include <SDL3/SDL_iostream.h>
 #include <SDL3/SDL_joystick.h>
+#include <SDL3/SDL_jobs.h>
 #include <SDL3/SDL_keyboard.h>
 #include <SDL3/SDL_keycode.h>
 #include <SDL3/SDL_loadso.h>
@@ -0,0 +1,197 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Arena */
+
+/**
+ * # CategoryArena
+ *
+ * An arena is a fast allocator for memory that is all thrown away at once,
+ * like scratch data that only lives for one frame.
+ *
+ * Allocating from an arena just moves a pointer forward through a large
+ * chunk of memory, and there is no way to free a single allocation. Instead,
+ * SDL_ResetArena() releases everything at once, and the chunks are kept to
+ * be reused, so a program that resets its arena every frame stops touching
+ * the heap once the arena has grown to fit a frame.
+ *
+ * SDL_GetArenaMark() and SDL_ResetArenaToMark() release only what was
+ * allocated after a certain point, which is handy for temporary memory in
+ * the middle of a larger job.
+ */
+
+#ifndef SDL_arena_h_
+#define SDL_arena_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * An arena allocator.
+ *
+ * This is an opaque datatype.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateArena
+ */
+typedef struct SDL_Arena SDL_Arena;
+
+/**
+ * A position in an arena, used to release everything allocated after it.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetArenaMark
+ * \sa SDL_ResetArenaToMark
+ */
+typedef Uint64 SDL_ArenaMark;
+
+/**
+ * Create an arena allocator.
+ *
+ * The arena grabs memory from SDL_malloc() in chunks of `chunk_size` bytes.
+ * Allocations that don't fit in a chunk of that size get a chunk of their
+ * own.
+ *
+ * A thread-safe arena takes a lock on every call, so several threads can
+ * allocate from it at once. Otherwise the arena should only be used by one
+ * thread at a time.
+ *
+ * \param chunk_size the size of the chunks of memory the arena allocates
+ *                   from, or 0 for a reasonable default.
+ * \param threadsafe true if the arena can be used by several threads at
+ *                   once.
+ * \returns a new arena or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AllocateArenaMemory
+ * \sa SDL_DestroyArena
+ */
+extern SDL_DECLSPEC SDL_Arena * SDLCALL SDL_CreateArena(size_t chunk_size, bool threadsafe);
+
+/**
+ * Allocate memory from an arena.
+ *
+ * The memory is not initialized, and stays valid until the arena is reset
+ * past it or destroyed. It must not be passed to SDL_free().
+ *
+ * \param arena the arena to allocate from.
+ * \param size the number of bytes to allocate.
+ * \param alignment the alignment of the memory, which must be a power of
+ *                  two, or 0 for an alignment suitable for any built-in type.
+ * \returns a pointer to the memory or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread if the
+ *               arena is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetArena
+ */
+extern SDL_DECLSPEC SDL_MALLOC void * SDLCALL SDL_AllocateArenaMemory(SDL_Arena *arena, size_t size, size_t alignment);
+
+/**
+ * Get the current position in an arena.
+ *
+ * Passing the result to SDL_ResetArenaToMark() later releases everything
+ * allocated since this call.
+ *
+ * \param arena the arena to query.
+ * \returns the current position, or 0 if `arena` is NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread if the
+ *               arena is thread-safe, but the mark is only meaningful if
+ *               nobody else allocates from the arena until it is used.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetArenaToMark
+ */
+extern SDL_DECLSPEC SDL_ArenaMark SDLCALL SDL_GetArenaMark(SDL_Arena *arena);
+
+/**
+ * Release everything allocated from an arena since a mark was taken.
+ *
+ * The memory is kept by the arena to be handed out again. A mark is no
+ * longer valid once the arena has been reset to an earlier position.
+ *
+ * \param arena the arena to reset.
+ * \param mark a position returned by SDL_GetArenaMark().
+ *
+ * \threadsafety It is safe to call this function from any thread if the
+ *               arena is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetArenaMark
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetArenaToMark(SDL_Arena *arena, SDL_ArenaMark mark);
+
+/**
+ * Release everything allocated from an arena.
+ *
+ * The memory is kept by the arena to be handed out again, use
+ * SDL_DestroyArena() to give it back to the system.
+ *
+ * \param arena the arena to reset.
+ *
+ * \threadsafety It is safe to call this function from any thread if the
+ *               arena is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetArenaToMark
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetArena(SDL_Arena *arena);
+
+/**
+ * Destroy an arena and free all of its memory.
+ *
+ * \param arena the arena to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               nothing else is using the arena.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateArena
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyArena(SDL_Arena *arena);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_arena_h_ */
@@ -182,6 +182,22 @@ typedef struct SDL_AsyncIOOutcome
  */
 typedef struct SDL_AsyncIOQueue SDL_AsyncIOQueue;
 
+/**
+ * One piece of a batch of reads or writes.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadAsyncIOBatch
+ * \sa SDL_WriteAsyncIOBatch
+ */
+typedef struct SDL_AsyncIORequest
+{
+    void *buffer;    /**< buffer to read data into or write data from. */
+    Uint64 offset;   /**< position to start reading or writing in the SDL_AsyncIO. */
+    Uint64 size;     /**< number of bytes to read or write. */
+    void *userdata;  /**< an app-defined pointer that will be provided with the results of this request. */
+} SDL_AsyncIORequest;
+
 /**
  * Use this function to create a new SDL_AsyncIO object for reading from
  * and/or writing to a named file.
@@ -313,6 +329,68 @@ extern SDL_DECLSPEC bool SDLCALL SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * Start several async reads at once.
+ *
+ * This works like calling SDL_ReadAsyncIO() for each request, but the whole
+ * batch is handed to the system in one go, which is much cheaper when there
+ * are many small reads, like loading a page of streaming data.
+ *
+ * Each request completes on its own and is added to `queue` with its own
+ * userdata, in whatever order the reads finish.
+ *
+ * The buffers must remain available until each read is done, but the
+ * `requests` array itself can be thrown away when this function returns.
+ *
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param requests an array of reads to start.
+ * \param count the number of elements in `requests`.
+ * \param queue a queue to add the finished reads to.
+ * \returns the number of requests that were started, which is less than
+ *          `count` on failure; call SDL_GetError() for more information. The
+ *          requests that were started will complete normally, the rest were
+ *          never started.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadAsyncIO
+ * \sa SDL_WriteAsyncIOBatch
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadAsyncIOBatch(SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue);
+
+/**
+ * Start several async writes at once.
+ *
+ * This works like calling SDL_WriteAsyncIO() for each request, but the whole
+ * batch is handed to the system in one go.
+ *
+ * Each request completes on its own and is added to `queue` with its own
+ * userdata, in whatever order the writes finish. Writes to overlapping
+ * ranges in the same batch may happen in any order.
+ *
+ * The buffers must remain available until each write is done, but the
+ * `requests` array itself can be thrown away when this function returns.
+ *
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param requests an array of writes to start.
+ * \param count the number of elements in `requests`.
+ * \param queue a queue to add the finished writes to.
+ * \returns the number of requests that were started, which is less than
+ *          `count` on failure; call SDL_GetError() for more information. The
+ *          requests that were started will complete normally, the rest were
+ *          never started.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WriteAsyncIO
+ * \sa SDL_ReadAsyncIOBatch
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_WriteAsyncIOBatch(SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue);
+
 /**
  * Close and free any allocated resources for an async I/O object.
  *
@@ -537,6 +615,47 @@ extern SDL_DECLSPEC void SDLCALL SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * Save all the data into a file path, asynchronously and safely.
+ *
+ * This function returns as quickly as possible; it does not wait for the
+ * write to complete. On a successful return, this work will continue in the
+ * background. If the work begins, even failure is asynchronous: a failing
+ * return value from this function only means the work couldn't start at all.
+ *
+ * The data is copied, so the app may reuse or free it as soon as this
+ * function returns. It is written to a temporary file next to `file`, which
+ * is flushed to disk and then renamed over `file`. If the app crashes or is
+ * suspended partway through, `file` still has the contents of the last save
+ * that finished.
+ *
+ * Only one save of a given path is written at a time. If a save of `file` is
+ * already in progress, this save waits for it to finish. If another save of
+ * the same path arrives while this one is waiting, this one is never written
+ * and completes with SDL_ASYNCIO_CANCELED, so frequent saves don't pile up.
+ *
+ * An SDL_AsyncIOQueue must be specified. The result will be added to it when
+ * the file has been replaced, as an SDL_ASYNCIO_TASK_WRITE with a NULL
+ * `asyncio` and `buffer`.
+ *
+ * \param file the path to write all the data to.
+ * \param data the data to write.
+ * \param datasize the number of bytes to write.
+ * \param queue a queue to add the result to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_LoadFileAsync
+ * \sa SDL_SaveFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SaveFileAsync(const char *file, const void *data, size_t datasize, SDL_AsyncIOQueue *queue, void *userdata);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
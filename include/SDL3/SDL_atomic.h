@@ -511,6 +511,56 @@ extern SDL_DECLSPEC int SDLCALL SDL_AddAtomicInt(SDL_AtomicInt *a, int v);
 #define SDL_AtomicDecRef(a)    (SDL_AddAtomicInt(a, -1) == 1)
 #endif
 
+/**
+ * Wait for an atomic variable to change from an expected value.
+ *
+ * If `a` still holds `expected`, this puts the calling thread to sleep until
+ * another thread calls SDL_WakeAtomicInt() on the same variable, or until the
+ * timeout expires. If `a` holds something else, this returns right away.
+ *
+ * This is the building block for a lock or a queue that sleeps without
+ * needing a mutex or any other kernel object: change the variable, then call
+ * SDL_WakeAtomicInt() to wake the threads waiting on it. Where the system
+ * has a native facility for this (WaitOnAddress on Windows, futexes on Linux
+ * and Android) SDL uses it directly, otherwise it is emulated with a small
+ * table of mutexes and condition variables.
+ *
+ * This function can return even if nobody woke it up and the value hasn't
+ * changed, so it should always be called in a loop that checks the value.
+ *
+ * \param a a pointer to an SDL_AtomicInt to wait on.
+ * \param expected the value to sleep on.
+ * \param timeoutNS the timeout in nanoseconds, 0 to check without waiting,
+ *                  or -1 to wait indefinitely.
+ * eturns true if the thread was woken or the value didn't match, or false
+ *          if the timeout expired.
+ *
+ * 	hreadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WakeAtomicInt
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WaitAtomicInt(SDL_AtomicInt *a, int expected, Sint64 timeoutNS);
+
+/**
+ * Wake threads that are waiting on an atomic variable.
+ *
+ * This should be called after changing the value of `a`, so that the woken
+ * threads see the new value.
+ *
+ * \param a a pointer to an SDL_AtomicInt that threads are waiting on.
+ * \param wake_all true to wake every waiting thread, false to wake at least
+ *                 one of them.
+ *
+ * 	hreadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WaitAtomicInt
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WakeAtomicInt(SDL_AtomicInt *a, bool wake_all);
+
 /**
  * A type representing an atomic unsigned 32-bit value.
  *
@@ -450,6 +450,25 @@ typedef struct SDL_AudioSpec
  */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The filters an audio stream can use to convert between sample rates.
+ *
+ * Higher levels sound better and cost more CPU time. Nearest and linear
+ * interpolation alias noticeably, but are often fine for short sound
+ * effects.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_NEAREST,  /**< Repeat or drop the nearest input frame. */
+    SDL_AUDIO_RESAMPLE_LINEAR,   /**< Linear interpolation between neighbouring frames. */
+    SDL_AUDIO_RESAMPLE_CUBIC,    /**< Cubic interpolation over four frames. */
+    SDL_AUDIO_RESAMPLE_SINC      /**< Bandlimited windowed-sinc filter. This is the default. */
+} SDL_AudioResampleQuality;
+
 
 /* Function prototypes */
 
@@ -648,6 +667,79 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devi
  */
 extern SDL_DECLSPEC int * SDLCALL SDL_GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count);
 
+/**
+ * Runtime statistics for an audio device.
+ *
+ * These are collected by SDL's audio device thread and, where the backend
+ * can report them, by the platform audio driver. Fields the current driver
+ * can't report are zero.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceStatistics
+ */
+typedef struct SDL_AudioDeviceStatistics
+{
+    Uint64 underruns;            /**< Number of device iterations where a playing stream couldn't supply a full buffer. */
+    Uint64 silence_frames;       /**< Total sample frames of silence inserted to cover those underruns. */
+    Uint64 last_iteration_ns;    /**< SDL_GetTicksNS() value of the device thread's most recent iteration, or 0 if it hasn't run yet. */
+    Uint64 latency_ns;           /**< Latency the driver reports for the device stream, in nanoseconds, or 0 if unknown. */
+    Uint32 padding_frames;       /**< Sample frames queued in the driver's buffer but not yet played at the last iteration, or 0 if unknown. */
+    Uint64 frames_mixed;         /**< Total sample frames mixed for a playback device. The next buffer starts at this device frame. */
+} SDL_AudioDeviceStatistics;
+
+/**
+ * Get runtime statistics for an audio device.
+ *
+ * This does not lock the device, so it won't stall the audio thread and is
+ * cheap enough to call every frame, to drive a latency display or to notice
+ * that an app isn't feeding its audio streams fast enough.
+ *
+ * Logical devices report the statistics of the physical device they are
+ * opened on. You may also specify SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK or
+ * SDL_AUDIO_DEVICE_DEFAULT_RECORDING here. Underrun counts are only tracked
+ * for playback devices.
+ *
+ * \param devid the instance ID of the device to query.
+ * \param stats on return, filled in with the device's statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceFrameTicksNS
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetAudioDeviceStatistics(SDL_AudioDeviceID devid, SDL_AudioDeviceStatistics *stats);
+
+/**
+ * Estimate when a playback device frame will be heard.
+ *
+ * Playback devices count every sample frame they mix, starting at zero, and
+ * the current count is reported as `frames_mixed` by
+ * SDL_GetAudioDeviceStatistics(). This maps a position on that clock to an
+ * SDL_GetTicksNS() timestamp, based on when the device thread last handed a
+ * buffer to the driver and the latency the driver reports. Frames in the past
+ * are mapped too.
+ *
+ * The estimate is only as good as the driver's latency report; on drivers
+ * that can't report it, this is the time the frame reaches the driver.
+ *
+ * \param devid the instance ID of the playback device to query.
+ * \param frame the device frame to look up.
+ * \returns the estimated SDL_GetTicksNS() time, or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceStatistics
+ * \sa SDL_ScheduleAudioStream
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetAudioDeviceFrameTicksNS(SDL_AudioDeviceID devid, Uint64 frame);
+
 /**
  * Open a specific audio device.
  *
@@ -1061,6 +1153,52 @@ extern SDL_DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_Audio
  */
 extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * Create a new audio stream with the specified properties.
+ *
+ * This works like SDL_CreateAudioStream(), with extra options that can only
+ * be chosen when the stream is created.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BOOLEAN`: true if the app
+ *   promises that only one thread at a time will put data into the stream or
+ *   change its input format or input channel map. SDL_PutAudioStreamData()
+ *   then copies into a lock-free ring buffer instead of taking the stream's
+ *   lock, so it never waits on a thread that is reading from the stream,
+ *   like the audio device thread. The data moves into the stream the next
+ *   time any function that needs it holds the lock. If the data doesn't fit
+ *   in the ring buffer, or the stream has a put callback, putting data takes
+ *   the lock as usual. Defaults to false.
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BUFFER_SIZE_NUMBER`: the size
+ *   of that ring buffer in bytes, rounded up to a power of two. Defaults to
+ *   enough for about a quarter of a second of input audio.
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER`: an
+ *   SDL_AudioResampleQuality value picking the filter used when the stream
+ *   converts between sample rates. Lower levels are much cheaper, which suits
+ *   large numbers of voices that don't need high fidelity. Defaults to
+ *   SDL_AUDIO_RESAMPLE_SINC.
+ *
+ * \param src_spec the format details of the input audio.
+ * \param dst_spec the format details of the output audio.
+ * \param props the properties to use.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateAudioStream
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_DestroyAudioStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStreamWithProperties(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, SDL_PropertiesID props);
+
+#define SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BOOLEAN             "SDL.audiostream.create.single_producer"
+#define SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BUFFER_SIZE_NUMBER  "SDL.audiostream.create.single_producer.buffer_size"
+#define SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER             "SDL.audiostream.create.resample_quality"
+
 /**
  * Get the properties associated with an audio stream.
  *
@@ -1187,6 +1325,70 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetAudioStreamFrequencyRatio(SDL_AudioStre
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio);
 
+/**
+ * Let an audio stream adjust its own playback rate to hold a target latency.
+ *
+ * This is meant for streams that are fed at a rate tied to something other
+ * than the audio device, like an emulator or video player running in step
+ * with the display. Each time data is read from the stream, SDL compares the
+ * amount of input still queued to the target, and speeds up or slows down
+ * consumption by up to `max_deviation` so the queue neither drains nor grows
+ * without bound. The adjustment follows a smoothed measurement of the queue,
+ * so it changes gradually instead of jumping between reads.
+ *
+ * The adjustment is applied on top of the stream's frequency ratio, and is
+ * not reported by SDL_GetAudioStreamFrequencyRatio. Keeping `max_deviation`
+ * around 0.005 (half a percent) keeps the pitch change inaudible.
+ *
+ * \param stream the stream to adjust.
+ * \param target_ms the amount of queued input to aim for, in milliseconds, or
+ *                  0 to turn the adjustment off.
+ * \param max_deviation the largest change to the playback rate, as a
+ *                      fraction of normal speed. Must be between 0 and 0.5.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioStreamQueued
+ * \sa SDL_SetAudioStreamFrequencyRatio
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamTargetLatency(SDL_AudioStream *stream, int target_ms, float max_deviation);
+
+/**
+ * Schedule when a stream bound to a playback device starts and stops playing.
+ *
+ * Frames are on the device's clock, reported as `frames_mixed` by
+ * SDL_GetAudioDeviceStatistics(). Data from the stream is placed at exactly
+ * `start_frame` within the device buffer that contains it, instead of
+ * wherever the next buffer happens to begin, and nothing more is read from
+ * the stream from `stop_frame` on. Outside of that window the stream isn't
+ * read at all and its data stays queued.
+ *
+ * To schedule audio for a point in time, pick a frame relative to
+ * `frames_mixed`; SDL_GetAudioDeviceFrameTicksNS() tells when a frame will be
+ * heard. Frames that have already been mixed are ignored, so a start frame
+ * in the past starts the stream at the next buffer.
+ *
+ * \param stream the stream to schedule.
+ * \param start_frame the device frame to start at, or 0 to start right away.
+ * \param stop_frame the device frame to stop at, or 0 to keep playing.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceFrameTicksNS
+ * \sa SDL_GetAudioDeviceStatistics
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ScheduleAudioStream(SDL_AudioStream *stream, Uint64 start_frame, Uint64 stop_frame);
+
 /**
  * Get the gain of an audio stream.
  *
@@ -2319,6 +2521,77 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * Open a WAVE file as an audio stream that decodes it as it plays.
+ *
+ * Unlike SDL_LoadWAV_IO, this doesn't read and decode the whole data portion
+ * of the file up front. Instead, this reads the file's headers and returns an
+ * audio stream that pulls data from `src` and decodes it one block at a time,
+ * whenever the stream needs more data. Memory use stays small no matter how
+ * long the file is, and playback can start right away.
+ *
+ * The stream's input format is the format of the decoded WAVE data, which is
+ * also written to `spec` if it isn't NULL. Its output format starts out the
+ * same; bind the stream to an audio device, or change it with
+ * SDL_SetAudioStreamFormat. When the end of the data is reached, the stream
+ * is flushed.
+ *
+ * The same formats and hints as SDL_LoadWAV_IO are supported. Invalid,
+ * unsupported and truncated files that SDL_LoadWAV_IO would reject at load
+ * time cause this function to fail, as long as that can be detected from the
+ * headers and the size of `src`. Otherwise, the stream just ends early.
+ *
+ * The stream uses its get callback to decode data; don't replace it with
+ * SDL_SetAudioStreamGetCallback. `src` must support seeking, and it is used
+ * by whatever thread reads from the stream (usually the audio device thread)
+ * until the stream is destroyed, so the app shouldn't touch it in the
+ * meantime.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the stream is
+ *                destroyed, or before returning if this function fails.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return. Can be NULL.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information. Destroy it with
+ *          SDL_DestroyAudioStream when done.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_OpenWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec);
+
+/**
+ * Open a WAVE file from a file path as an audio stream that decodes it as it
+ * plays.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_OpenWAVStream_IO(SDL_IOFromFile(path, "rb"), true, spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return. Can be NULL.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information. Destroy it with
+ *          SDL_DestroyAudioStream when done.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_OpenWAVStream_IO
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec);
+
 /**
  * Mix audio data in a specified format.
  *
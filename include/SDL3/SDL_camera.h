@@ -388,6 +388,23 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
 /**
  * Get the properties associated with an opened camera.
  *
+ * The following read-only properties are provided by SDL:
+ *
+ * - `SDL_PROP_CAMERA_FRAMES_NUMBER`: the number of frames that have been made
+ *   available to the app since the camera was opened. (since SDL 3.4.0)
+ * - `SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER`: the number of frames the camera
+ *   produced that were thrown away because the app was holding every frame
+ *   SDL can buffer, or because conversion wasn't keeping up. (since SDL
+ *   3.4.0)
+ * - `SDL_PROP_CAMERA_ACQUIRE_TIME_NS_NUMBER`: the total time, in
+ *   nanoseconds, spent getting frames from the camera. (since SDL 3.4.0)
+ * - `SDL_PROP_CAMERA_CONVERT_TIME_NS_NUMBER`: the total time, in
+ *   nanoseconds, spent converting and scaling frames to the format the app
+ *   asked for. (since SDL 3.4.0)
+ *
+ * These are updated as frames arrive, and are unset until the first one
+ * does.
+ *
  * \param camera the SDL_Camera obtained from SDL_OpenCamera().
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -398,6 +415,11 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetCameraProperties(SDL_Camera *camera);
 
+#define SDL_PROP_CAMERA_FRAMES_NUMBER           "SDL.camera.frames"
+#define SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER   "SDL.camera.dropped_frames"
+#define SDL_PROP_CAMERA_ACQUIRE_TIME_NS_NUMBER  "SDL.camera.acquire_time_ns"
+#define SDL_PROP_CAMERA_CONVERT_TIME_NS_NUMBER  "SDL.camera.convert_time_ns"
+
 /**
  * Get the spec that a camera is using when generating images.
  *
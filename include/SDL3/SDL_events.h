@@ -118,6 +118,8 @@ typedef enum SDL_EventType
 
     SDL_EVENT_SYSTEM_THEME_CHANGED, /**< The system theme changed */
 
+    SDL_EVENT_POWER_STATE_CHANGED, /**< The power state or battery charge percentage changed, call SDL_GetPowerInfo() for the new state. Not sent on all platforms. */
+
     /* Display events */
     /* 0x150 was SDL_DISPLAYEVENT, reserve the number for sdl2-compat */
     SDL_EVENT_DISPLAY_ORIENTATION = 0x151,   /**< Display orientation has changed to data1 */
@@ -1358,6 +1360,33 @@ extern SDL_DECLSPEC bool SDLCALL SDL_WaitEventTimeout(SDL_Event *event, Sint32 t
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PushEvent(SDL_Event *event);
 
+/**
+ * Add several events to the event queue at once.
+ *
+ * This behaves like calling SDL_PushEvent() on each event in order, but the
+ * event filter and watchers are run over the whole array in a single pass
+ * and the event queue is only locked once, which is much cheaper when
+ * injecting many events, e.g. for input replay.
+ *
+ * Events rejected by the event filter are skipped and the rest are still
+ * added. The events are copied into the queue, so the caller may dispose of
+ * `events` after this function returns.
+ *
+ * \param events an array of events to be added to the queue.
+ * \param count the number of events in `events`.
+ * \returns the number of events added to the queue, which may be less than
+ *          `count` if some were filtered or the queue is full, or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_SetEventFilter
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PushEvents(const SDL_Event *events, int count);
+
 /**
  * A function pointer used for callbacks that watch the event queue.
  *
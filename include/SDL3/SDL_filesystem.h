@@ -427,6 +427,48 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenamePath(const char *oldpath, const char
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_CopyFile(const char *oldpath, const char *newpath);
 
+/**
+ * A callback that SDL_CopyFileWithProgress() calls as the copy proceeds.
+ *
+ * \param userdata an app-controlled pointer that is passed to the callback.
+ * \param copied the number of bytes copied so far.
+ * \param total the size of the file being copied.
+ * \returns true to continue copying, false to stop the copy.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_CopyFileWithProgress
+ */
+typedef bool (SDLCALL *SDL_CopyFileProgressCallback)(void *userdata, Uint64 copied, Uint64 total);
+
+/**
+ * Copy a file, reporting progress as it goes.
+ *
+ * This works like SDL_CopyFile(), but calls `callback` every so often with
+ * the number of bytes copied so far. If the callback returns false, the
+ * copy stops and this function fails, leaving `newpath` in an undefined
+ * state.
+ *
+ * Where the system can copy the file by itself, SDL lets it, so the data
+ * doesn't have to pass through the app's memory. Some filesystems can share
+ * the data between the two files instead of copying it at all.
+ *
+ * \param oldpath the old path.
+ * \param newpath the new path.
+ * \param callback a function that is called as the copy proceeds, may be
+ *                 NULL.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CopyFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_CopyFileWithProgress(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata);
+
 /**
  * Get information about a filesystem path.
  *
@@ -0,0 +1,230 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: FramePacer */
+
+/**
+ * # CategoryFramePacer
+ *
+ * A frame pacer keeps a loop running at a steady rate, like a game's main
+ * loop running at 60 frames per second.
+ *
+ * Create one with SDL_CreateFramePacer, giving it a rate in frames per
+ * second, then call SDL_WaitFramePacer once per frame. It sleeps until the
+ * next frame is due, using the most precise timer the platform has, and only
+ * spins the CPU for the last fraction of a millisecond.
+ *
+ * The rate is a fraction, so rates like 59.94 Hz (60000/1001) are kept
+ * exactly. Frame deadlines are calculated from the start of the timeline
+ * rather than from the previous frame, so small errors don't add up over
+ * time. A pacer can also follow the refresh rate of a display with
+ * SDL_SetFramePacerDisplay.
+ *
+ * When a frame takes too long, the pacer doesn't try to rush through the
+ * frames it missed. It drops them and carries on at the same rate, and
+ * SDL_GetFramePacerStats reports how often that happened.
+ */
+
+#ifndef SDL_framepacer_h_
+#define SDL_framepacer_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_video.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A frame pacer, which keeps a loop running at a steady rate.
+ *
+ * This is an opaque datatype.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateFramePacer
+ * \sa SDL_WaitFramePacer
+ */
+typedef struct SDL_FramePacer SDL_FramePacer;
+
+/**
+ * Statistics about how well a frame pacer has kept its rate.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetFramePacerStats
+ */
+typedef struct SDL_FramePacerStats
+{
+    Uint64 frames;      /**< the number of calls to SDL_WaitFramePacer() */
+    Uint64 missed;      /**< the number of frames whose deadline had already passed when SDL_WaitFramePacer() was called */
+    Uint64 dropped;     /**< the number of whole frame periods skipped to catch up after missed deadlines */
+    Uint64 late_ns;     /**< the total time SDL_WaitFramePacer() returned after its deadline, in nanoseconds */
+    Uint64 max_late_ns; /**< the latest SDL_WaitFramePacer() returned after its deadline, in nanoseconds */
+    Uint64 period_ns;   /**< the current frame period, rounded to the nearest nanosecond */
+} SDL_FramePacerStats;
+
+/**
+ * Create a frame pacer.
+ *
+ * The rate is given as a fraction, in frames per second, so 60 Hz would be
+ * 60/1 and 59.94 Hz would be 60000/1001.
+ *
+ * The timeline starts with the first call to SDL_WaitFramePacer().
+ *
+ * \param rate_numerator the numerator of the frame rate.
+ * \param rate_denominator the denominator of the frame rate.
+ * \returns a new frame pacer or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyFramePacer
+ * \sa SDL_WaitFramePacer
+ */
+extern SDL_DECLSPEC SDL_FramePacer * SDLCALL SDL_CreateFramePacer(int rate_numerator, int rate_denominator);
+
+/**
+ * Change the rate of a frame pacer.
+ *
+ * The new rate takes effect after the frame that is currently being waited
+ * for. This stops the pacer from following a display set with
+ * SDL_SetFramePacerDisplay().
+ *
+ * \param pacer the frame pacer to change.
+ * \param rate_numerator the numerator of the frame rate.
+ * \param rate_denominator the denominator of the frame rate.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should be called on the thread that waits on
+ *               the pacer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFramePacerRate(SDL_FramePacer *pacer, int rate_numerator, int rate_denominator);
+
+/**
+ * Make a frame pacer follow the refresh rate of a display.
+ *
+ * The pacer checks the current display mode each frame and switches to the
+ * new refresh rate when it changes. If the display doesn't report a refresh
+ * rate, the pacer keeps its current rate.
+ *
+ * This doesn't synchronize with the display's vertical blank, it only runs
+ * at the same rate. Use vsync on the renderer or GPU swapchain to line up
+ * with the display itself.
+ *
+ * \param pacer the frame pacer to change.
+ * \param displayID the display to follow, or 0 to stop following a display.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetFramePacerRate
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFramePacerDisplay(SDL_FramePacer *pacer, SDL_DisplayID displayID);
+
+/**
+ * Wait for the next frame.
+ *
+ * This sleeps until the next frame is due. If the deadline has already
+ * passed, it returns right away, and if more than a whole frame period has
+ * passed, the frames in between are dropped.
+ *
+ * \param pacer the frame pacer to wait on.
+ * \returns the time the frame was due, in the time base of SDL_GetTicksNS(),
+ *          or 0 if `pacer` is NULL.
+ *
+ * \threadsafety A frame pacer should only be waited on by one thread at a
+ *               time. If the pacer follows a display, that should be the
+ *               main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateFramePacer
+ * \sa SDL_GetFramePacerStats
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_WaitFramePacer(SDL_FramePacer *pacer);
+
+/**
+ * Restart the timeline of a frame pacer.
+ *
+ * The next call to SDL_WaitFramePacer() starts a new timeline, as if the
+ * pacer had just been created, and the statistics are cleared. This is
+ * useful after the loop has been paused, so the pacer doesn't count the
+ * pause as dropped frames.
+ *
+ * \param pacer the frame pacer to reset.
+ *
+ * \threadsafety This function should be called on the thread that waits on
+ *               the pacer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetFramePacer(SDL_FramePacer *pacer);
+
+/**
+ * Get statistics about how well a frame pacer has kept its rate.
+ *
+ * \param pacer the frame pacer to query.
+ * \param stats a pointer filled in with the statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should be called on the thread that waits on
+ *               the pacer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetFramePacer
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats);
+
+/**
+ * Destroy a frame pacer.
+ *
+ * \param pacer the frame pacer to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               nothing is waiting on the pacer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateFramePacer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyFramePacer(SDL_FramePacer *pacer);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_framepacer_h_ */
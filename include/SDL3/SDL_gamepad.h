@@ -1381,6 +1381,34 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetGamepadSensorDataRate(SDL_Gamepad *game
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *data, int num_values);
 
+/**
+ * Get the gamepad sensor readings received since the last call.
+ *
+ * This lets applications process every reading from high rate sensors in one
+ * call, instead of handling an SDL_EVENT_GAMEPAD_SENSOR_UPDATE event for each
+ * one. Applications that only use this can turn those events off with
+ * SDL_SetEventEnabled().
+ *
+ * Readings are collected while the sensor is enabled, starting from the first
+ * call to this function, so the first call always returns 0. They are
+ * returned oldest first, and any readings that don't fit in `samples` are
+ * kept for the next call. If readings aren't retrieved often enough, the
+ * oldest ones are discarded.
+ *
+ * \param gamepad the gamepad to query.
+ * \param type the type of sensor to query.
+ * \param samples an array filled with the sensor readings.
+ * \param num_samples the maximum number of readings to write to samples.
+ * \returns the number of readings written to samples, or -1 on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGamepadSensorData
+ * \sa SDL_SetGamepadSensorEnabled
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetGamepadSensorSamples(SDL_Gamepad *gamepad, SDL_SensorType type, SDL_SensorSample *samples, int num_samples);
+
 /**
  * Start a rumble effect on a gamepad.
  *
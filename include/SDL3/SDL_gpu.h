@@ -373,6 +373,7 @@
 #ifndef SDL_gpu_h_
 #define SDL_gpu_h_
 
+#include <SDL3/SDL_asyncio.h>
 #include <SDL3/SDL_pixels.h>
 #include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_rect.h>
@@ -581,6 +582,34 @@ typedef struct SDL_GPUCopyPass SDL_GPUCopyPass;
  */
 typedef struct SDL_GPUFence SDL_GPUFence;
 
+/**
+ * An opaque handle representing a set of GPU queries.
+ *
+ * Used for measuring GPU execution time.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUQueryPool
+ * \sa SDL_WriteGPUTimestamp
+ * \sa SDL_GetGPUQueryPoolResults
+ * \sa SDL_ReleaseGPUQueryPool
+ */
+typedef struct SDL_GPUQueryPool SDL_GPUQueryPool;
+
+/**
+ * An opaque handle representing a ring of staging memory for streaming
+ * uploads.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUUploadHeap
+ * \sa SDL_UploadGPUTextureData
+ * \sa SDL_UploadGPUBufferData
+ * \sa SDL_FlushGPUUploadHeap
+ * \sa SDL_DestroyGPUUploadHeap
+ */
+typedef struct SDL_GPUUploadHeap SDL_GPUUploadHeap;
+
 /**
  * Specifies the primitive topology of a graphics pipeline.
  *
@@ -881,6 +910,14 @@ typedef enum SDL_GPUTextureFormat
  * within a compute pass. Note that SIMULTANEOUS usage is only supported by a
  * limited number of texture formats.
  *
+ * TRANSIENT is for render targets whose contents are only needed within a
+ * single render pass, like an MSAA color buffer that is resolved right away
+ * or an intermediate depth buffer. On tile-based GPUs these textures can live
+ * entirely in tile memory without any backing allocation. A transient texture
+ * can only be used as a color or depth stencil target, must not be loaded or
+ * stored by a render pass, and can't be used in copy passes or blits. Drivers
+ * without memoryless textures allocate it like any other texture.
+ *
  * \since This datatype is available since SDL 3.2.0.
  *
  * \sa SDL_CreateGPUTexture
@@ -894,6 +931,7 @@ typedef Uint32 SDL_GPUTextureUsageFlags;
 #define SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ                    (1u << 4) /**< Texture supports storage reads in the compute stage. */
 #define SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE                   (1u << 5) /**< Texture supports storage writes in the compute stage. */
 #define SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE (1u << 6) /**< Texture supports reads and writes in the same compute shader. This is NOT equivalent to READ | WRITE. */
+#define SDL_GPU_TEXTUREUSAGE_TRANSIENT                               (1u << 7) /**< Texture contents only live for the length of a render pass. Available since SDL 3.4.0. */
 
 /**
  * Specifies the type of a texture.
@@ -1353,6 +1391,98 @@ typedef enum SDL_GPUSwapchainComposition
     SDL_GPU_SWAPCHAINCOMPOSITION_HDR10_ST2084
 } SDL_GPUSwapchainComposition;
 
+/**
+ * Specifies the compilation status of a pipeline created with
+ * SDL_CreateGPUGraphicsPipelineAsync().
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUGraphicsPipelineStatus
+ */
+typedef enum SDL_GPUPipelineStatus
+{
+    SDL_GPU_PIPELINESTATUS_PENDING,  /**< The pipeline is still being compiled. */
+    SDL_GPU_PIPELINESTATUS_READY,    /**< The pipeline can be bound. */
+    SDL_GPU_PIPELINESTATUS_FAILED    /**< The pipeline could not be created. */
+} SDL_GPUPipelineStatus;
+
+/**
+ * Specifies the kind of queries held by a query pool.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUQueryPool
+ */
+typedef enum SDL_GPUQueryType
+{
+    SDL_GPU_QUERYTYPE_TIMESTAMP  /**< The time at which the GPU finished all preceding work, in nanoseconds. */
+} SDL_GPUQueryType;
+
+/**
+ * Specifies the queue a command buffer is submitted to.
+ *
+ * Command buffers on different queues may execute at the same time on the
+ * GPU. Work that depends on the results of another queue must wait on a fence
+ * from that queue with SDL_AddGPUCommandBufferWaitFence().
+ *
+ * If the device has no separate queue for a type, command buffers of that
+ * type are submitted to the graphics queue instead. A copy queue may share a
+ * hardware queue with the compute queue.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireGPUCommandBufferForQueue
+ */
+typedef enum SDL_GPUQueueType
+{
+    SDL_GPU_QUEUETYPE_GRAPHICS,  /**< Supports render, compute and copy passes, and swapchain presentation. */
+    SDL_GPU_QUEUETYPE_COMPUTE,   /**< Supports compute and copy passes. */
+    SDL_GPU_QUEUETYPE_COPY       /**< Supports copy passes. */
+} SDL_GPUQueueType;
+
+/**
+ * Specifies a point in the lifetime of a frame recorded with
+ * SDL_SetGPULatencyMarker().
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetGPULatencyMarker
+ */
+typedef enum SDL_GPULatencyMarker
+{
+    SDL_GPU_LATENCYMARKER_INPUT_SAMPLE,         /**< The application sampled the input that the frame responds to. */
+    SDL_GPU_LATENCYMARKER_SIMULATION_START,     /**< The application started simulating the frame. */
+    SDL_GPU_LATENCYMARKER_SIMULATION_END,       /**< The application finished simulating the frame. */
+    SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_START,  /**< The application started recording GPU commands for the frame. */
+    SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_END,    /**< The application finished recording GPU commands for the frame. */
+    SDL_GPU_LATENCYMARKER_PRESENT_START,        /**< The application is about to submit the command buffer that presents the frame. */
+    SDL_GPU_LATENCYMARKER_PRESENT_END           /**< The command buffer that presents the frame was submitted. */
+} SDL_GPULatencyMarker;
+
+/**
+ * Specifies how many pixels share a single fragment shader invocation.
+ *
+ * The rates are written as width by height, so SDL_GPU_SHADINGRATE_2X1
+ * shades two horizontally adjacent pixels at once. The value of each rate is
+ * (log2(width) << 2) | log2(height), which is also how rates are stored in a
+ * shading rate image.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GPUSupportsShadingRate
+ * \sa SDL_SetGPUShadingRate
+ */
+typedef enum SDL_GPUShadingRate
+{
+    SDL_GPU_SHADINGRATE_1X1 = 0x0,  /**< Every pixel is shaded, the default. */
+    SDL_GPU_SHADINGRATE_1X2 = 0x1,  /**< One invocation per 1x2 pixel block. */
+    SDL_GPU_SHADINGRATE_2X1 = 0x4,  /**< One invocation per 2x1 pixel block. */
+    SDL_GPU_SHADINGRATE_2X2 = 0x5,  /**< One invocation per 2x2 pixel block. */
+    SDL_GPU_SHADINGRATE_2X4 = 0x6,  /**< One invocation per 2x4 pixel block. */
+    SDL_GPU_SHADINGRATE_4X2 = 0x9,  /**< One invocation per 4x2 pixel block. */
+    SDL_GPU_SHADINGRATE_4X4 = 0xA   /**< One invocation per 4x4 pixel block. */
+} SDL_GPUShadingRate;
+
 /* Structures */
 
 /**
@@ -1522,6 +1652,7 @@ typedef struct SDL_GPUBufferRegion
  * \since This struct is available since SDL 3.2.0.
  *
  * \sa SDL_DrawGPUPrimitivesIndirect
+ * \sa SDL_DrawGPUPrimitivesIndirectCount
  */
 typedef struct SDL_GPUIndirectDrawCommand
 {
@@ -1544,6 +1675,7 @@ typedef struct SDL_GPUIndirectDrawCommand
  * \since This struct is available since SDL 3.2.0.
  *
  * \sa SDL_DrawGPUIndexedPrimitivesIndirect
+ * \sa SDL_DrawGPUIndexedPrimitivesIndirectCount
  */
 typedef struct SDL_GPUIndexedIndirectDrawCommand
 {
@@ -1796,6 +1928,21 @@ typedef struct SDL_GPUTransferBufferCreateInfo
     SDL_PropertiesID props; /**< A properties ID for extensions. Should be 0 if no extensions are needed. */
 } SDL_GPUTransferBufferCreateInfo;
 
+/**
+ * A structure specifying the parameters of a query pool.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUQueryPool
+ */
+typedef struct SDL_GPUQueryPoolCreateInfo
+{
+    SDL_GPUQueryType type; /**< The kind of queries in the pool. */
+    Uint32 num_queries;    /**< The number of queries in the pool. */
+
+    SDL_PropertiesID props; /**< A properties ID for extensions. Should be 0 if no extensions are needed. */
+} SDL_GPUQueryPoolCreateInfo;
+
 /* Pipeline state structures */
 
 /**
@@ -2075,6 +2222,7 @@ typedef struct SDL_GPUDepthStencilTargetInfo
  * \since This struct is available since SDL 3.2.0.
  *
  * \sa SDL_BlitGPUTexture
+ * \sa SDL_BlitGPUTextures
  */
 typedef struct SDL_GPUBlitInfo
 {
@@ -2090,6 +2238,73 @@ typedef struct SDL_GPUBlitInfo
     Uint8 padding3;
 } SDL_GPUBlitInfo;
 
+/**
+ * A structure describing the size and usage of one GPU memory heap.
+ *
+ * Any value the driver cannot report is 0.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUMemoryInfo
+ */
+typedef struct SDL_GPUMemoryInfo
+{
+    Uint64 budget;     /**< The amount of memory in bytes the application can use from this heap before the system starts evicting or failing allocations. */
+    Uint64 usage;      /**< The amount of memory in bytes currently used from this heap by this process, as reported by the OS or driver. */
+    Uint64 allocated;  /**< The amount of memory in bytes SDL has allocated from this heap for this device. */
+    bool device_local; /**< true if this heap is local to the GPU (video memory), false if it is system memory visible to the GPU. */
+    Uint8 padding1;
+    Uint8 padding2;
+    Uint8 padding3;
+} SDL_GPUMemoryInfo;
+
+/**
+ * A structure describing the tile layout and residency of a sparse texture.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUSparseTextureInfo
+ */
+typedef struct SDL_GPUSparseTextureInfo
+{
+    Uint32 tile_width;          /**< The width of a tile in texels. */
+    Uint32 tile_height;         /**< The height of a tile in texels. */
+    Uint32 tile_size;           /**< The size in bytes of the memory backing one tile. */
+    Uint32 first_packed_level;  /**< The first mip level of the packed mip tail, or the texture's level count if it has none. Packed levels are always resident. */
+    Uint32 tile_budget;         /**< The maximum number of tiles that can be committed at once. */
+    Uint32 num_committed_tiles; /**< The number of tiles currently committed. */
+} SDL_GPUSparseTextureInfo;
+
+/**
+ * A structure describing the presentation timing of a window's swapchain.
+ *
+ * Frames are identified by the order they were presented in: the first frame
+ * presented to a window has the id 1, and the frame currently being prepared
+ * will have the id `present_count + 1`.
+ *
+ * All timestamps share the time base of SDL_GetTicksNS(). Any value that is
+ * unknown is 0, including the latency markers of a frame for which
+ * SDL_SetGPULatencyMarker() was not called.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUPresentStatistics
+ */
+typedef struct SDL_GPUPresentStatistics
+{
+    Uint64 present_count;           /**< The number of frames presented to the window so far. */
+    Uint64 displayed_frame_id;      /**< The id of the most recent frame known to have reached the display. */
+    Uint64 display_time_ns;         /**< The time at which the frame `displayed_frame_id` reached the display. */
+    Uint64 refresh_interval_ns;     /**< The refresh interval of the display showing the window. */
+    Uint64 input_sample_ns;         /**< The SDL_GPU_LATENCYMARKER_INPUT_SAMPLE time of the frame `displayed_frame_id`. */
+    Uint64 simulation_start_ns;     /**< The SDL_GPU_LATENCYMARKER_SIMULATION_START time of the frame `displayed_frame_id`. */
+    Uint64 simulation_end_ns;       /**< The SDL_GPU_LATENCYMARKER_SIMULATION_END time of the frame `displayed_frame_id`. */
+    Uint64 render_submit_start_ns;  /**< The SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_START time of the frame `displayed_frame_id`. */
+    Uint64 render_submit_end_ns;    /**< The SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_END time of the frame `displayed_frame_id`. */
+    Uint64 present_start_ns;        /**< The SDL_GPU_LATENCYMARKER_PRESENT_START time of the frame `displayed_frame_id`. */
+    Uint64 present_end_ns;          /**< The SDL_GPU_LATENCYMARKER_PRESENT_END time of the frame `displayed_frame_id`. */
+} SDL_GPUPresentStatistics;
+
 /* Binding structs */
 
 /**
@@ -2234,6 +2449,16 @@ extern SDL_DECLSPEC SDL_GPUDevice *SDLCALL SDL_CreateGPUDevice(
  *   useful debug information on device creation, defaults to true.
  * - `SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING`: the name of the GPU driver to
  *   use, if a specific one is desired.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_DATA_POINTER`: pipeline cache
+ *   data previously returned by SDL_GetGPUPipelineCacheData(), used to speed
+ *   up pipeline creation. The data is copied during device creation. Data
+ *   written by a different driver or GPU is ignored.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_SIZE_NUMBER`: the size in bytes
+ *   of the pipeline cache data.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN`: enable bindless resources
+ *   if the device supports them, defaults to false. Check
+ *   `SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN` after creation to see whether they
+ *   were enabled. See SDL_AddGPUBindlessTexture() for details.
  *
  * These are the current shader format properties:
  *
@@ -2292,6 +2517,9 @@ extern SDL_DECLSPEC SDL_GPUDevice *SDLCALL SDL_CreateGPUDeviceWithProperties(
 #define SDL_PROP_GPU_DEVICE_CREATE_PREFERLOWPOWER_BOOLEAN            "SDL.gpu.device.create.preferlowpower"
 #define SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN                   "SDL.gpu.device.create.verbose"
 #define SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING                       "SDL.gpu.device.create.name"
+#define SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_DATA_POINTER       "SDL.gpu.device.create.pipeline_cache.data"
+#define SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_SIZE_NUMBER        "SDL.gpu.device.create.pipeline_cache.size"
+#define SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN                  "SDL.gpu.device.create.bindless"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_PRIVATE_BOOLEAN           "SDL.gpu.device.create.shaders.private"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN             "SDL.gpu.device.create.shaders.spirv"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_DXBC_BOOLEAN              "SDL.gpu.device.create.shaders.dxbc"
@@ -2460,6 +2688,23 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  * Driver Branch: promo490_3_Google
  * ```
  *
+ * `SDL_PROP_GPU_DEVICE_ASYNC_COMPUTE_BOOLEAN`: true if command buffers
+ * acquired for SDL_GPU_QUEUETYPE_COMPUTE run on a hardware queue separate
+ * from the graphics queue, false if they share the graphics queue.
+ *
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN`: true if bindless resources were
+ * enabled with `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN`.
+ *
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_MAX_TEXTURES_NUMBER`,
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_MAX_SAMPLERS_NUMBER` and
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_MAX_BUFFERS_NUMBER`: the number of textures,
+ * samplers and storage buffers that can be in the bindless heap at once.
+ *
+ * `SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN`: true if
+ * SDL_DrawGPUPrimitivesIndirectCount() and
+ * SDL_DrawGPUIndexedPrimitivesIndirectCount() read the draw count on the
+ * GPU, false if they always issue `max_draw_count` draws.
+ *
  * \param device a GPU context to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -2470,10 +2715,68 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUDevice *device);
 
-#define SDL_PROP_GPU_DEVICE_NAME_STRING           "SDL.gpu.device.name"
-#define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING    "SDL.gpu.device.driver_name"
-#define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING "SDL.gpu.device.driver_version"
-#define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING    "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_NAME_STRING                  "SDL.gpu.device.name"
+#define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING           "SDL.gpu.device.driver_name"
+#define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING        "SDL.gpu.device.driver_version"
+#define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING           "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_ASYNC_COMPUTE_BOOLEAN        "SDL.gpu.device.async_compute"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN             "SDL.gpu.device.bindless"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_MAX_TEXTURES_NUMBER "SDL.gpu.device.bindless.max_textures"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_MAX_SAMPLERS_NUMBER "SDL.gpu.device.bindless.max_samplers"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_MAX_BUFFERS_NUMBER  "SDL.gpu.device.bindless.max_buffers"
+#define SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN  "SDL.gpu.device.indirect_draw_count"
+
+/**
+ * Get the contents of the driver's pipeline cache.
+ *
+ * The returned data contains the compiled state of every pipeline created on
+ * this device so far, and can be saved and passed back with
+ * `SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_DATA_POINTER` the next time a
+ * device is created, to avoid compiling the same pipelines again.
+ *
+ * This is supported by the Vulkan and D3D12 backends. The D3D11 and Metal
+ * drivers manage their own shader caches, so this function returns NULL on
+ * those backends.
+ *
+ * \param device a GPU context to query.
+ * \param size a pointer filled in with the size of the data in bytes, may
+ *             not be NULL.
+ * \returns the pipeline cache data, which should be freed with SDL_free(), or
+ *          NULL on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUDeviceWithProperties
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetGPUPipelineCacheData(SDL_GPUDevice *device, size_t *size);
+
+/**
+ * Get the memory budget and usage of each memory heap used by a GPU device.
+ *
+ * This can be polled periodically so an application can shrink its caches or
+ * stream in lower resolution assets before it runs out of GPU memory.
+ *
+ * The budget and usage values come from the OS or driver where available: the
+ * Vulkan backend uses VK_EXT_memory_budget, the D3D12 backend uses
+ * IDXGIAdapter3::QueryVideoMemoryInfo and the Metal backend uses the device's
+ * recommended working set size. The allocated value counts the memory SDL
+ * itself has allocated for this device and is only tracked by the Vulkan
+ * backend.
+ *
+ * \param device a GPU context to query.
+ * \param count a pointer filled in with the number of heaps returned, may be
+ *              NULL.
+ * \returns an array of memory heap information, which should be freed with
+ *          SDL_free(), or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC SDL_GPUMemoryInfo * SDLCALL SDL_GetGPUMemoryInfo(SDL_GPUDevice *device, int *count);
 
 /* State Creation */
 
@@ -2505,6 +2808,9 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUD
  * - [[texture]]: Sampled textures, followed by read-only storage textures,
  *   followed by read-write storage textures
  *
+ * If bindless resources are enabled, compute shaders can also index the
+ * bindless heap described in SDL_AddGPUBindlessTexture().
+ *
  * There are optional properties that can be provided through `props`. These
  * are the supported properties:
  *
@@ -2555,6 +2861,60 @@ extern SDL_DECLSPEC SDL_GPUGraphicsPipeline *SDLCALL SDL_CreateGPUGraphicsPipeli
 
 #define SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING "SDL.gpu.graphicspipeline.create.name"
 
+/**
+ * Creates a graphics pipeline object without waiting for it to be compiled.
+ *
+ * The pipeline is compiled on an internal pool of worker threads and the
+ * returned handle can be used right away. Until
+ * SDL_GetGPUGraphicsPipelineStatus() reports SDL_GPU_PIPELINESTATUS_READY,
+ * binding the pipeline fails without recording anything, so the previous
+ * pipeline can be kept in use in the meantime.
+ *
+ * The contents of `createinfo` are copied, but the shaders it refers to must
+ * not be released until the pipeline is no longer pending.
+ *
+ * The returned handle must be released with SDL_ReleaseGPUGraphicsPipeline(),
+ * which may be called while the pipeline is still pending.
+ *
+ * \param device a GPU Context.
+ * \param createinfo a struct describing the state of the graphics pipeline to
+ *                   create.
+ * \returns a graphics pipeline handle on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUGraphicsPipeline
+ * \sa SDL_GetGPUGraphicsPipelineStatus
+ * \sa SDL_ReleaseGPUGraphicsPipeline
+ */
+extern SDL_DECLSPEC SDL_GPUGraphicsPipeline *SDLCALL SDL_CreateGPUGraphicsPipelineAsync(
+    SDL_GPUDevice *device,
+    const SDL_GPUGraphicsPipelineCreateInfo *createinfo);
+
+/**
+ * Queries whether a graphics pipeline has finished compiling.
+ *
+ * Pipelines created with SDL_CreateGPUGraphicsPipeline() are always ready.
+ *
+ * \param device a GPU Context.
+ * \param graphics_pipeline the graphics pipeline to query.
+ * \returns the compilation status of the pipeline. If it is
+ *          SDL_GPU_PIPELINESTATUS_FAILED, call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUGraphicsPipelineAsync
+ */
+extern SDL_DECLSPEC SDL_GPUPipelineStatus SDLCALL SDL_GetGPUGraphicsPipelineStatus(
+    SDL_GPUDevice *device,
+    SDL_GPUGraphicsPipeline *graphics_pipeline);
+
 /**
  * Creates a sampler object to be used when binding textures in a graphics
  * workflow.
@@ -2630,6 +2990,9 @@ extern SDL_DECLSPEC SDL_GPUSampler *SDLCALL SDL_CreateGPUSampler(
  *   [[stage_in]] attribute which will automatically use the vertex input
  *   information from the SDL_GPUGraphicsPipeline.
  *
+ * If bindless resources are enabled, shaders can also index the bindless
+ * heap described in SDL_AddGPUBindlessTexture().
+ *
  * Shader semantics other than system-value semantics do not matter in D3D12
  * and for ease of use the SDL implementation assumes that non system-value
  * semantics will all be TEXCOORD. If you are using HLSL as the shader source
@@ -2697,6 +3060,15 @@ extern SDL_DECLSPEC SDL_GPUShader *SDLCALL SDL_CreateGPUShader(
  *   clear the texture to a stencil of this Uint8 value. Defaults to zero.
  * - `SDL_PROP_GPU_TEXTURE_CREATE_NAME_STRING`: a name that can be displayed
  *   in debugging tools.
+ * - `SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN`: true to create a sparse
+ *   texture, which reserves address space without any memory behind it.
+ *   Memory is committed one tile at a time with SDL_CommitGPUTextureTiles().
+ *   Check SDL_GPUTextureSupportsSparse() first. Sparse textures are never
+ *   cycled. Defaults to false.
+ * - `SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_TILE_BUDGET_NUMBER`: the maximum
+ *   number of tiles of a sparse texture that can be committed at once. Memory
+ *   for this many tiles is allocated along with the texture. Defaults to
+ *   every tile of the texture, so this should normally be set.
  *
  * \param device a GPU Context.
  * \param createinfo a struct describing the state of the texture to create.
@@ -2727,6 +3099,8 @@ extern SDL_DECLSPEC SDL_GPUTexture *SDLCALL SDL_CreateGPUTexture(
 #define SDL_PROP_GPU_TEXTURE_CREATE_D3D12_CLEAR_DEPTH_FLOAT    "SDL.gpu.texture.create.d3d12.clear.depth"
 #define SDL_PROP_GPU_TEXTURE_CREATE_D3D12_CLEAR_STENCIL_NUMBER "SDL.gpu.texture.create.d3d12.clear.stencil"
 #define SDL_PROP_GPU_TEXTURE_CREATE_NAME_STRING                "SDL.gpu.texture.create.name"
+#define SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN             "SDL.gpu.texture.create.sparse"
+#define SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_TILE_BUDGET_NUMBER  "SDL.gpu.texture.create.sparse.tile_budget"
 
 /**
  * Creates a buffer object to be used in graphics or compute workflows.
@@ -2811,6 +3185,194 @@ extern SDL_DECLSPEC SDL_GPUTransferBuffer *SDLCALL SDL_CreateGPUTransferBuffer(
 
 #define SDL_PROP_GPU_TRANSFERBUFFER_CREATE_NAME_STRING "SDL.gpu.transferbuffer.create.name"
 
+/**
+ * Creates a pool of queries for measuring GPU execution.
+ *
+ * Timestamp queries are supported by the Vulkan, D3D12 and D3D11 backends.
+ *
+ * \param device a GPU Context.
+ * \param createinfo a struct describing the query pool to create.
+ * \returns a query pool on success, or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WriteGPUTimestamp
+ * \sa SDL_GetGPUQueryPoolResults
+ * \sa SDL_ReleaseGPUQueryPool
+ */
+extern SDL_DECLSPEC SDL_GPUQueryPool *SDLCALL SDL_CreateGPUQueryPool(
+    SDL_GPUDevice *device,
+    const SDL_GPUQueryPoolCreateInfo *createinfo);
+
+/* Bindless Resources */
+
+/**
+ * Adds a texture to the bindless heap.
+ *
+ * Bindless resources let shaders index textures, samplers and storage
+ * buffers out of one large array instead of having them bound per draw.
+ * Resources are added once and keep a stable index, which the app passes to
+ * its shaders, typically with SDL_PushGPUVertexUniformData() or in a
+ * storage buffer. The heap is bound automatically for every graphics and
+ * compute pipeline.
+ *
+ * Bindless resources must be enabled with
+ * `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN` and are currently
+ * implemented by the Vulkan and D3D12 backends.
+ *
+ * For SPIR-V shaders the heap is descriptor set 4:
+ *
+ * - binding 0: an array of sampled images (e.g. `Texture2D textures[]`)
+ * - binding 1: an array of samplers
+ * - binding 2: an array of read-only storage buffers
+ *
+ * For DXIL shaders the heap uses the following registers:
+ *
+ * - (t0, space4): an unbounded array of textures
+ * - (s0, space4): an unbounded array of samplers
+ * - (t0, space5): an unbounded array of read-only storage buffers
+ *
+ * The heap refers to the resource as it is when it is added. Writing to a
+ * bindless texture or buffer with `cycle` set to true makes it refer to a
+ * different allocation, so bindless resources should be updated with
+ * cycling disabled.
+ *
+ * A resource added while a command buffer is being recorded is only
+ * guaranteed to be visible to command buffers acquired afterwards.
+ *
+ * The texture must have been created with SDL_GPU_TEXTUREUSAGE_SAMPLER, and
+ * must stay alive until it is removed with SDL_RemoveGPUBindlessTexture().
+ *
+ * \param device a GPU Context.
+ * \param texture the texture to add.
+ * \param index filled in with the index of the texture in the heap.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RemoveGPUBindlessTexture
+ * \sa SDL_AddGPUBindlessSampler
+ * \sa SDL_AddGPUBindlessBuffer
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_AddGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    Uint32 *index);
+
+/**
+ * Adds a sampler to the bindless heap.
+ *
+ * The sampler must stay alive until it is removed with
+ * SDL_RemoveGPUBindlessSampler().
+ *
+ * \param device a GPU Context.
+ * \param sampler the sampler to add.
+ * \param index filled in with the index of the sampler in the heap.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGPUBindlessTexture
+ * \sa SDL_RemoveGPUBindlessSampler
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_AddGPUBindlessSampler(
+    SDL_GPUDevice *device,
+    SDL_GPUSampler *sampler,
+    Uint32 *index);
+
+/**
+ * Adds a buffer to the bindless heap as a read-only storage buffer.
+ *
+ * The buffer must have been created with
+ * SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ or
+ * SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ, and must stay alive until it is
+ * removed with SDL_RemoveGPUBindlessBuffer().
+ *
+ * \param device a GPU Context.
+ * \param buffer the buffer to add.
+ * \param index filled in with the index of the buffer in the heap.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGPUBindlessTexture
+ * \sa SDL_RemoveGPUBindlessBuffer
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_AddGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index);
+
+/**
+ * Removes a texture from the bindless heap.
+ *
+ * The index may be handed out again by a later call to
+ * SDL_AddGPUBindlessTexture(), so it must not be used by any command buffer
+ * that is submitted or will be submitted.
+ *
+ * \param device a GPU Context.
+ * \param index the index returned by SDL_AddGPUBindlessTexture().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGPUBindlessTexture
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_RemoveGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    Uint32 index);
+
+/**
+ * Removes a sampler from the bindless heap.
+ *
+ * The index may be handed out again by a later call to
+ * SDL_AddGPUBindlessSampler(), so it must not be used by any command buffer
+ * that is submitted or will be submitted.
+ *
+ * \param device a GPU Context.
+ * \param index the index returned by SDL_AddGPUBindlessSampler().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGPUBindlessSampler
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_RemoveGPUBindlessSampler(
+    SDL_GPUDevice *device,
+    Uint32 index);
+
+/**
+ * Removes a buffer from the bindless heap.
+ *
+ * The index may be handed out again by a later call to
+ * SDL_AddGPUBindlessBuffer(), so it must not be used by any command buffer
+ * that is submitted or will be submitted.
+ *
+ * \param device a GPU Context.
+ * \param index the index returned by SDL_AddGPUBindlessBuffer().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGPUBindlessBuffer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_RemoveGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    Uint32 index);
+
 /* Debug Naming */
 
 /**
@@ -2909,29 +3471,94 @@ extern SDL_DECLSPEC void SDLCALL SDL_PushGPUDebugGroup(
 extern SDL_DECLSPEC void SDLCALL SDL_PopGPUDebugGroup(
     SDL_GPUCommandBuffer *command_buffer);
 
-/* Disposal */
-
 /**
- * Frees the given texture as soon as it is safe to do so.
+ * Starts capturing GPU work with an attached graphics debugging tool.
  *
- * You must not reference the texture after calling this function.
+ * Everything submitted to the device until SDL_EndGPUCapture() is recorded,
+ * so an application can capture an intermittent problem, like a slow frame,
+ * when it happens instead of waiting for someone to press a capture key.
+ *
+ * RenderDoc is used if it was injected into the process, on any backend.
+ * Otherwise the platform's own tool is used: PIX (through
+ * IDXGraphicsAnalysis) on Windows and PIX on Xbox for Direct3D 12, and the
+ * Metal capture manager for Metal.
  *
  * \param device a GPU context.
- * \param texture a texture to be destroyed.
+ * \param path where to save the capture, or NULL to let the tool decide.
+ *             RenderDoc uses this as a path prefix, Metal writes a
+ *             `.gputrace` document here instead of handing the capture to
+ *             Xcode, and Xbox writes a `.xpix` file here and requires it.
+ * \returns true on success or false if no capture tool is available or a
+ *          capture is already in progress; call SDL_GetError() for more
+ *          information.
  *
- * \since This function is available since SDL 3.2.0.
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EndGPUCapture
  */
-extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUTexture(
+extern SDL_DECLSPEC bool SDLCALL SDL_BeginGPUCapture(
     SDL_GPUDevice *device,
-    SDL_GPUTexture *texture);
+    const char *path);
 
 /**
- * Frees the given sampler as soon as it is safe to do so.
- *
- * You must not reference the sampler after calling this function.
+ * Finishes a capture started with SDL_BeginGPUCapture().
  *
  * \param device a GPU context.
- * \param sampler a sampler to be destroyed.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginGPUCapture
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EndGPUCapture(
+    SDL_GPUDevice *device);
+
+/**
+ * Records the time at which the GPU finishes all previously recorded work.
+ *
+ * This must be called outside of any pass. Writing timestamps before and
+ * after a pass measures the time the GPU spent on it.
+ *
+ * A query must not be written again until its result has been read with
+ * SDL_GetGPUQueryPoolResults().
+ *
+ * \param command_buffer a command buffer.
+ * \param query_pool a query pool of type SDL_GPU_QUERYTYPE_TIMESTAMP.
+ * \param index the query in the pool to write.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUQueryPoolResults
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WriteGPUTimestamp(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUQueryPool *query_pool,
+    Uint32 index);
+
+/* Disposal */
+
+/**
+ * Frees the given texture as soon as it is safe to do so.
+ *
+ * You must not reference the texture after calling this function.
+ *
+ * \param device a GPU context.
+ * \param texture a texture to be destroyed.
+ *
+ * \since This function is available since SDL 3.2.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture);
+
+/**
+ * Frees the given sampler as soon as it is safe to do so.
+ *
+ * You must not reference the sampler after calling this function.
+ *
+ * \param device a GPU context.
+ * \param sampler a sampler to be destroyed.
  *
  * \since This function is available since SDL 3.2.0.
  */
@@ -3009,6 +3636,23 @@ extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUGraphicsPipeline(
     SDL_GPUDevice *device,
     SDL_GPUGraphicsPipeline *graphics_pipeline);
 
+/**
+ * Frees the given query pool.
+ *
+ * If command buffers that write to the pool may still be executing, this
+ * waits for the GPU to become idle first.
+ *
+ * You must not reference the query pool after calling this function.
+ *
+ * \param device a GPU context.
+ * \param query_pool a query pool to be destroyed.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUQueryPool(
+    SDL_GPUDevice *device,
+    SDL_GPUQueryPool *query_pool);
+
 /**
  * Acquire a command buffer.
  *
@@ -3030,12 +3674,49 @@ extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUGraphicsPipeline(
  *
  * \since This function is available since SDL 3.2.0.
  *
+ * \sa SDL_AcquireGPUCommandBufferForQueue
  * \sa SDL_SubmitGPUCommandBuffer
  * \sa SDL_SubmitGPUCommandBufferAndAcquireFence
  */
 extern SDL_DECLSPEC SDL_GPUCommandBuffer *SDLCALL SDL_AcquireGPUCommandBuffer(
     SDL_GPUDevice *device);
 
+/**
+ * Acquire a command buffer for a specific queue.
+ *
+ * This behaves like SDL_AcquireGPUCommandBuffer(), which acquires a command
+ * buffer for SDL_GPU_QUEUETYPE_GRAPHICS, except that the command buffer is
+ * submitted to the given queue. Command buffers on a compute queue can not
+ * begin render passes, blit, generate mipmaps or acquire swapchain textures,
+ * and command buffers on a copy queue can additionally not begin compute
+ * passes.
+ *
+ * Submissions on different queues are not ordered with respect to each
+ * other. To consume results produced on another queue, submit the producing
+ * command buffer with SDL_SubmitGPUCommandBufferAndAcquireFence() and pass
+ * the fence to SDL_AddGPUCommandBufferWaitFence() on the consuming command
+ * buffer.
+ *
+ * On D3D12, resources used on a compute queue must not need graphics-only
+ * resource states, so textures with SDL_GPU_TEXTUREUSAGE_SAMPLER,
+ * SDL_GPU_TEXTUREUSAGE_COLOR_TARGET or SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET
+ * usage and vertex, index or indirect buffers should only be used on the
+ * graphics queue there.
+ *
+ * \param device a GPU context.
+ * \param queue the queue to submit the command buffer to.
+ * \returns a command buffer, or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireGPUCommandBuffer
+ * \sa SDL_AddGPUCommandBufferWaitFence
+ */
+extern SDL_DECLSPEC SDL_GPUCommandBuffer *SDLCALL SDL_AcquireGPUCommandBufferForQueue(
+    SDL_GPUDevice *device,
+    SDL_GPUQueueType queue);
+
 /* Uniform Data */
 
 /**
@@ -3109,6 +3790,31 @@ extern SDL_DECLSPEC void SDLCALL SDL_PushGPUComputeUniformData(
 
 /* Graphics State */
 
+/**
+ * Sets the shading rate image used by render passes begun afterwards on a
+ * command buffer.
+ *
+ * Each texel of the image holds an SDL_GPUShadingRate for a square of pixels
+ * in the render targets, SDL_GetGPUShadingRateImageTileSize() pixels wide.
+ * The image must be a 2D texture in SDL_GPU_TEXTUREFORMAT_R8_UINT; its first
+ * mip level and layer are used. The image stays bound until this is called
+ * again, and must not be written to by a render pass that uses it.
+ *
+ * This must not be called during a pass. If the device has no shading rate
+ * image support this function does nothing.
+ *
+ * \param command_buffer a command buffer.
+ * \param texture the shading rate image, or NULL to stop using one.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUShadingRateImageTileSize
+ * \sa SDL_SetGPUShadingRate
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_SetGPUShadingRateImage(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUTexture *texture);
+
 /**
  * Begins a render pass on a command buffer.
  *
@@ -3145,6 +3851,9 @@ extern SDL_DECLSPEC SDL_GPURenderPass *SDLCALL SDL_BeginGPURenderPass(
  *
  * A graphics pipeline must be bound before making any draw calls.
  *
+ * Binding a pipeline created with SDL_CreateGPUGraphicsPipelineAsync() that
+ * is not ready yet sets an error and leaves the current pipeline bound.
+ *
  * \param render_pass a render pass handle.
  * \param graphics_pipeline the graphics pipeline to bind.
  *
@@ -3205,6 +3914,25 @@ extern SDL_DECLSPEC void SDLCALL SDL_SetGPUStencilReference(
     SDL_GPURenderPass *render_pass,
     Uint8 reference);
 
+/**
+ * Sets the shading rate for subsequent draw calls in a render pass.
+ *
+ * The shading rate is reset to SDL_GPU_SHADINGRATE_1X1 at the start of every
+ * render pass. Rates that SDL_GPUSupportsShadingRate() rejects are ignored.
+ * When a shading rate image is bound, the coarser of the two rates is used.
+ *
+ * \param render_pass a render pass handle.
+ * \param rate the shading rate to use.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GPUSupportsShadingRate
+ * \sa SDL_SetGPUShadingRateImage
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_SetGPUShadingRate(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUShadingRate rate);
+
 /**
  * Binds vertex buffers on a command buffer for use with subsequent draw
  * calls.
@@ -3489,6 +4217,81 @@ extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUIndexedPrimitivesIndirect(
     Uint32 offset,
     Uint32 draw_count);
 
+/**
+ * Draws data using bound graphics state with draw parameters and the draw
+ * count both read from buffers.
+ *
+ * The draw buffer must consist of tightly-packed draw parameter sets that
+ * each match the layout of SDL_GPUIndirectDrawCommand. The count buffer
+ * holds a single Uint32 at `count_offset`, typically written by a compute
+ * pass, and the number of draws issued is the smaller of that value and
+ * `max_draw_count`. Both buffers must have been created with
+ * SDL_GPU_BUFFERUSAGE_INDIRECT. You must not call this function before
+ * binding a graphics pipeline.
+ *
+ * If `SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN` is false, the count
+ * buffer is ignored and all `max_draw_count` draws are issued. Portable
+ * apps should set `num_instances` to 0 in unused draw parameter sets so they
+ * draw nothing in that case.
+ *
+ * \param render_pass a render pass handle.
+ * \param buffer a buffer containing draw parameters.
+ * \param offset the offset to start reading from the draw buffer.
+ * \param count_buffer a buffer containing the draw count.
+ * \param count_offset the offset of the draw count in the count buffer, must
+ *                     be a multiple of 4.
+ * \param max_draw_count the maximum number of draw parameter sets that
+ *                       should be read from the draw buffer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUDeviceProperties
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count);
+
+/**
+ * Draws data using bound graphics state with an index buffer enabled and with
+ * draw parameters and the draw count both read from buffers.
+ *
+ * The draw buffer must consist of tightly-packed draw parameter sets that
+ * each match the layout of SDL_GPUIndexedIndirectDrawCommand. The count
+ * buffer holds a single Uint32 at `count_offset`, and the number of draws
+ * issued is the smaller of that value and `max_draw_count`. Both buffers
+ * must have been created with SDL_GPU_BUFFERUSAGE_INDIRECT. You must not
+ * call this function before binding a graphics pipeline.
+ *
+ * If `SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN` is false, the count
+ * buffer is ignored and all `max_draw_count` draws are issued. Portable
+ * apps should set `num_instances` to 0 in unused draw parameter sets so they
+ * draw nothing in that case.
+ *
+ * \param render_pass a render pass handle.
+ * \param buffer a buffer containing draw parameters.
+ * \param offset the offset to start reading from the draw buffer.
+ * \param count_buffer a buffer containing the draw count.
+ * \param count_offset the offset of the draw count in the count buffer, must
+ *                     be a multiple of 4.
+ * \param max_draw_count the maximum number of draw parameter sets that
+ *                       should be read from the draw buffer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUDeviceProperties
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUIndexedPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count);
+
 /**
  * Ends the given render pass.
  *
@@ -3729,6 +4532,61 @@ extern SDL_DECLSPEC void SDLCALL SDL_UnmapGPUTransferBuffer(
     SDL_GPUDevice *device,
     SDL_GPUTransferBuffer *transfer_buffer);
 
+/**
+ * Starts an asynchronous read from a file directly into a transfer buffer.
+ *
+ * This saves loading the file into memory with SDL_LoadFileAsync() and then
+ * copying it into a mapped transfer buffer: the transfer buffer is mapped
+ * here, the file data is read straight into it in the background, and the
+ * transfer buffer is unmapped again when the result is picked up from
+ * `queue` with SDL_GetAsyncIOResult() or SDL_WaitAsyncIOResult(). After
+ * that, the data is ready for SDL_UploadToGPUTexture() or
+ * SDL_UploadToGPUBuffer().
+ *
+ * The result arrives as an SDL_ASYNCIO_TASK_READ with a NULL `buffer`, since
+ * the mapping is gone by then. Check `bytes_transferred` to see if the whole
+ * range was read.
+ *
+ * The transfer buffer must not be mapped, or have another read started
+ * into it, until the result has been picked up. The device must not be
+ * destroyed before then either.
+ *
+ * \param asyncio a pointer to an SDL_AsyncIO structure opened for reading.
+ * \param offset the position in the file to start reading from.
+ * \param size the number of bytes to read.
+ * \param device a GPU context.
+ * \param transfer_buffer an upload transfer buffer.
+ * \param transfer_offset the starting byte in the transfer buffer. There
+ *                        must be at least `size` bytes after it.
+ * \param cycle if true, cycles the transfer buffer if it is already bound.
+ * \param queue a queue to add the new SDL_AsyncIO to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but the
+ *               result must be picked up on a thread where it is safe to
+ *               unmap the transfer buffer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadAsyncIO
+ * \sa SDL_GetAsyncIOResult
+ * \sa SDL_UploadToGPUTexture
+ * \sa SDL_UploadToGPUBuffer
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReadAsyncIOToGPUTransferBuffer(
+    SDL_AsyncIO *asyncio,
+    Uint64 offset,
+    Uint32 size,
+    SDL_GPUDevice *device,
+    SDL_GPUTransferBuffer *transfer_buffer,
+    Uint32 transfer_offset,
+    bool cycle,
+    SDL_AsyncIOQueue *queue,
+    void *userdata);
+
 /* Copy Pass */
 
 /**
@@ -3882,6 +4740,159 @@ extern SDL_DECLSPEC void SDLCALL SDL_DownloadFromGPUBuffer(
 extern SDL_DECLSPEC void SDLCALL SDL_EndGPUCopyPass(
     SDL_GPUCopyPass *copy_pass);
 
+/* Upload Heaps */
+
+/**
+ * Creates an upload heap for streaming data into buffers and textures.
+ *
+ * An upload heap owns a set of transfer buffers and suballocates staging
+ * memory from them, so that many small uploads can share a few large
+ * allocations. Staging memory is recycled once the GPU has finished the
+ * copies that read from it, which makes the heap suitable for uploading new
+ * data every frame.
+ *
+ * By default the copies are submitted on the copy queue, which lets them
+ * overlap with rendering on devices that expose a separate transfer or
+ * compute queue. Pass the command buffer that consumes the uploaded data to
+ * SDL_FlushGPUUploadHeap() so that it waits for the copies to finish. On
+ * devices with a single queue the copy queue is the graphics queue and no
+ * extra synchronization happens.
+ *
+ * There are optional properties that can be provided through `props`. These
+ * are the supported properties:
+ *
+ * - `SDL_PROP_GPU_UPLOADHEAP_CREATE_BLOCK_SIZE_NUMBER`: the size in bytes of
+ *   each transfer buffer the heap allocates. Uploads larger than this get a
+ *   transfer buffer of their own. Defaults to 4 MiB.
+ * - `SDL_PROP_GPU_UPLOADHEAP_CREATE_COPY_QUEUE_BOOLEAN`: true to submit
+ *   copies on the copy queue, false to submit them on the graphics queue.
+ *   Defaults to true.
+ *
+ * An upload heap is not thread safe, and must be used from the thread it was
+ * created on.
+ *
+ * \param device a GPU Context.
+ * \param props a properties object with optional parameters, may be 0.
+ * \returns an upload heap on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UploadGPUTextureData
+ * \sa SDL_UploadGPUBufferData
+ * \sa SDL_FlushGPUUploadHeap
+ * \sa SDL_DestroyGPUUploadHeap
+ */
+extern SDL_DECLSPEC SDL_GPUUploadHeap *SDLCALL SDL_CreateGPUUploadHeap(
+    SDL_GPUDevice *device,
+    SDL_PropertiesID props);
+
+#define SDL_PROP_GPU_UPLOADHEAP_CREATE_BLOCK_SIZE_NUMBER "SDL.gpu.uploadheap.create.block_size"
+#define SDL_PROP_GPU_UPLOADHEAP_CREATE_COPY_QUEUE_BOOLEAN "SDL.gpu.uploadheap.create.copy_queue"
+
+/**
+ * Queues an upload of data from memory to a texture.
+ *
+ * The data is copied into staging memory immediately, so the caller may
+ * reuse `data` as soon as this function returns. The copy to the texture
+ * happens on the GPU timeline after the next call to
+ * SDL_FlushGPUUploadHeap().
+ *
+ * \param heap an upload heap.
+ * \param data the texel data to upload.
+ * \param size the size of `data` in bytes.
+ * \param pixels_per_row the number of pixels from one row to the next in
+ *                       `data`, or 0 if the rows are tightly packed.
+ * \param rows_per_layer the number of rows from one layer or depth slice to
+ *                       the next in `data`, or 0 if the layers are tightly
+ *                       packed.
+ * \param destination the destination texture region.
+ * \param cycle if true, cycles the texture if the texture is bound,
+ *              otherwise overwrites the data.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FlushGPUUploadHeap
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_UploadGPUTextureData(
+    SDL_GPUUploadHeap *heap,
+    const void *data,
+    Uint32 size,
+    Uint32 pixels_per_row,
+    Uint32 rows_per_layer,
+    const SDL_GPUTextureRegion *destination,
+    bool cycle);
+
+/**
+ * Queues an upload of data from memory to a buffer.
+ *
+ * `destination->size` bytes are read from `data`. The data is copied into
+ * staging memory immediately, so the caller may reuse `data` as soon as this
+ * function returns. The copy to the buffer happens on the GPU timeline after
+ * the next call to SDL_FlushGPUUploadHeap().
+ *
+ * \param heap an upload heap.
+ * \param data the data to upload.
+ * \param destination the destination buffer with offset and size.
+ * \param cycle if true, cycles the buffer if it is already bound, otherwise
+ *              overwrites the data.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FlushGPUUploadHeap
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_UploadGPUBufferData(
+    SDL_GPUUploadHeap *heap,
+    const void *data,
+    const SDL_GPUBufferRegion *destination,
+    bool cycle);
+
+/**
+ * Submits all queued uploads of an upload heap.
+ *
+ * The copies are recorded into a command buffer of their own and submitted
+ * immediately. If `wait_command_buffer` is not NULL, it is made to wait for
+ * the copies before it executes, so that it can safely use the uploaded
+ * data. The staging memory used by the copies is recycled once they have
+ * finished on the GPU.
+ *
+ * Does nothing if no uploads are queued.
+ *
+ * \param heap an upload heap.
+ * \param wait_command_buffer a command buffer that uses the uploaded data, may
+ *                            be NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UploadGPUTextureData
+ * \sa SDL_UploadGPUBufferData
+ * \sa SDL_AddGPUCommandBufferWaitFence
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_FlushGPUUploadHeap(
+    SDL_GPUUploadHeap *heap,
+    SDL_GPUCommandBuffer *wait_command_buffer);
+
+/**
+ * Destroys an upload heap.
+ *
+ * Waits for all submitted copies to finish before releasing the staging
+ * memory. Uploads that were queued but not flushed are discarded.
+ *
+ * \param heap an upload heap.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUUploadHeap
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyGPUUploadHeap(
+    SDL_GPUUploadHeap *heap);
+
 /**
  * Generates mipmaps for the given texture.
  *
@@ -3910,6 +4921,31 @@ extern SDL_DECLSPEC void SDLCALL SDL_BlitGPUTexture(
     SDL_GPUCommandBuffer *command_buffer,
     const SDL_GPUBlitInfo *info);
 
+/**
+ * Blits several source texture regions to destination texture regions.
+ *
+ * This behaves like calling SDL_BlitGPUTexture() once per element of
+ * `infos`, in order, but lets the backend batch the work. Consecutive blits
+ * into the same destination mip level and layer are recorded together as
+ * long as the later ones use SDL_GPU_LOADOP_LOAD (or
+ * SDL_GPU_LOADOP_DONT_CARE on Vulkan) and don't cycle, so packing many
+ * regions into an atlas costs one pass instead of one per region.
+ *
+ * This function must not be called inside of any pass.
+ *
+ * \param command_buffer a command buffer.
+ * \param infos an array of blit info structs containing the blit parameters.
+ * \param num_blits the number of elements in `infos`.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BlitGPUTexture
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_BlitGPUTextures(
+    SDL_GPUCommandBuffer *command_buffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 num_blits);
+
 /* Submission/Presentation */
 
 /**
@@ -4193,6 +5229,65 @@ extern SDL_DECLSPEC bool SDLCALL SDL_WaitAndAcquireGPUSwapchainTexture(
     Uint32 *swapchain_texture_width,
     Uint32 *swapchain_texture_height);
 
+/**
+ * Records the current time as a latency marker of a frame.
+ *
+ * Markers are reported back by SDL_GetGPUPresentStatistics() once the frame
+ * reaches the display, so the time from input sampling to display can be
+ * measured. The most recent 16 frames are kept for each window.
+ *
+ * The frame currently being prepared has the id `present_count + 1`, where
+ * `present_count` is reported by SDL_GetGPUPresentStatistics().
+ *
+ * \param device a GPU context.
+ * \param window a window that has been claimed.
+ * \param marker the point in the frame that was reached.
+ * \param frame_id the id of the frame, starting at 1.
+ * \returns true on success, false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that
+ *               created the window.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUPresentStatistics
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetGPULatencyMarker(
+    SDL_GPUDevice *device,
+    SDL_Window *window,
+    SDL_GPULatencyMarker marker,
+    Uint64 frame_id);
+
+/**
+ * Queries the presentation timing of a window's swapchain.
+ *
+ * This reports when the most recent frame actually reached the display,
+ * which can be used to schedule frames against the display refresh.
+ *
+ * The display time is only known on some drivers: Vulkan needs
+ * VK_GOOGLE_display_timing, Direct3D needs a flip model swapchain in a state
+ * where DXGI can report frame statistics, and Metal needs macOS 10.15.4 or
+ * iOS 10.3. Otherwise `displayed_frame_id` and `display_time_ns` are 0.
+ *
+ * \param device a GPU context.
+ * \param window a window that has been claimed.
+ * \param statistics a pointer filled in with the presentation timing.
+ * \returns true on success, false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that
+ *               created the window.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetGPULatencyMarker
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetGPUPresentStatistics(
+    SDL_GPUDevice *device,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics);
+
 /**
  * Submits a command buffer so its commands can be processed on the GPU.
  *
@@ -4244,6 +5339,33 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SubmitGPUCommandBuffer(
 extern SDL_DECLSPEC SDL_GPUFence *SDLCALL SDL_SubmitGPUCommandBufferAndAcquireFence(
     SDL_GPUCommandBuffer *command_buffer);
 
+/**
+ * Makes a command buffer wait on the GPU for a fence before it executes.
+ *
+ * This is used to synchronize work across queues: a command buffer that
+ * consumes resources written by a command buffer on another queue must wait
+ * on the fence acquired when that command buffer was submitted. The CPU does
+ * not block unless the backend has no way to wait on the GPU, in which case
+ * this waits for the fence before returning.
+ *
+ * Waiting on a fence from the same queue is unnecessary, as submissions on a
+ * single queue are already ordered, and does nothing. The fence must still be
+ * released with SDL_ReleaseGPUFence() when it is no longer needed.
+ *
+ * \param command_buffer a command buffer.
+ * \param fence a fence acquired from SDL_SubmitGPUCommandBufferAndAcquireFence().
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireGPUCommandBufferForQueue
+ * \sa SDL_SubmitGPUCommandBufferAndAcquireFence
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_AddGPUCommandBufferWaitFence(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUFence *fence);
+
 /**
  * Cancels a command buffer.
  *
@@ -4336,6 +5458,148 @@ extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUFence(
     SDL_GPUDevice *device,
     SDL_GPUFence *fence);
 
+/**
+ * Reads back the results of queries in a pool.
+ *
+ * Results become available once the command buffer that wrote them has
+ * finished executing, for example when SDL_QueryGPUFence() returns true for
+ * the fence acquired when it was submitted. Timestamps are in nanoseconds
+ * from an arbitrary starting point, so only differences between them are
+ * meaningful.
+ *
+ * \param device a GPU context.
+ * \param query_pool the query pool to read from.
+ * \param first_query the first query to read.
+ * \param num_queries the number of queries to read.
+ * \param results an array of `num_queries` values to fill in.
+ * \returns true on success or false if the results are not available yet or
+ *          on failure; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WriteGPUTimestamp
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetGPUQueryPoolResults(
+    SDL_GPUDevice *device,
+    SDL_GPUQueryPool *query_pool,
+    Uint32 first_query,
+    Uint32 num_queries,
+    Uint64 *results);
+
+/* Sparse Textures */
+
+/**
+ * Get the tile layout and residency of a sparse texture.
+ *
+ * \param device a GPU context.
+ * \param texture a texture created with
+ *                `SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN`.
+ * \param info a pointer filled in with the texture's tile information.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CommitGPUTextureTiles
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetGPUSparseTextureInfo(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    SDL_GPUSparseTextureInfo *info);
+
+/**
+ * Commits memory to the tiles of a sparse texture.
+ *
+ * Every tile that the region touches is committed, so the region does not
+ * need to be aligned to the tile size. Tiles that are already committed are
+ * left alone. The contents of newly committed tiles are undefined until they
+ * are written, for example with SDL_UploadToGPUTexture(). Levels in the
+ * packed mip tail are always committed, so regions in them are ignored.
+ *
+ * The new tiles can be used by any command buffer submitted after this
+ * function returns. This function blocks until the GPU has updated its page
+ * tables, so it is best called outside of the frame's critical path.
+ *
+ * The Direct3D 12 backend maps tiles with UpdateTileMappings(), the Vulkan
+ * backend with sparse residency binds and the Metal backend with a
+ * resource state encoder.
+ *
+ * \param device a GPU context.
+ * \param region the texture, mip level, layer and texels to commit. `z` must
+ *               be 0 and `d` must be 1.
+ * \returns true on success or false on failure, for example if the texture's
+ *          tile budget would be exceeded; call SDL_GetError() for more
+ *          information. Nothing is committed on failure.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DecommitGPUTextureTiles
+ * \sa SDL_IsGPUTextureTileCommitted
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_CommitGPUTextureTiles(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureRegion *region);
+
+/**
+ * Releases the memory of the tiles of a sparse texture.
+ *
+ * Every tile that the region touches is decommitted and its memory goes back
+ * to the texture's tile budget. Levels in the packed mip tail stay committed.
+ *
+ * The caller must make sure that no command buffer that is still executing
+ * uses the decommitted tiles, for example by waiting on the fences of the
+ * command buffers that sampled them. Sampling a decommitted tile afterwards
+ * returns undefined values on some hardware, so shaders should not rely on
+ * its contents.
+ *
+ * \param device a GPU context.
+ * \param region the texture, mip level, layer and texels to decommit. `z`
+ *               must be 0 and `d` must be 1.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CommitGPUTextureTiles
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_DecommitGPUTextureTiles(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureRegion *region);
+
+/**
+ * Checks whether the tile containing a texel of a sparse texture is
+ * committed.
+ *
+ * \param device a GPU context.
+ * \param texture a texture created with
+ *                `SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN`.
+ * \param mip_level the mip level of the texel.
+ * \param layer the layer of the texel.
+ * \param x the x coordinate of the texel within the mip level.
+ * \param y the y coordinate of the texel within the mip level.
+ * \returns true if the tile is committed, false if it isn't or on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CommitGPUTextureTiles
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_IsGPUTextureTileCommitted(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    Uint32 mip_level,
+    Uint32 layer,
+    Uint32 x,
+    Uint32 y);
+
 /* Format Info */
 
 /**
@@ -4384,6 +5648,70 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GPUTextureSupportsSampleCount(
     SDL_GPUTextureFormat format,
     SDL_GPUSampleCount sample_count);
 
+/**
+ * Determines whether sparse textures can be created with a format, type and
+ * usage.
+ *
+ * Sparse textures must be 2D or 2D array textures with one sample per texel,
+ * and cannot be depth, stencil or transient textures. The Direct3D 11 backend
+ * does not support them.
+ *
+ * \param device a GPU context.
+ * \param format the texture format to check.
+ * \param type the type of texture.
+ * \param usage a bitmask of all usage scenarios to check.
+ * \returns whether sparse textures are supported for this format, type and
+ *          usage.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUTexture
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GPUTextureSupportsSparse(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureFormat format,
+    SDL_GPUTextureType type,
+    SDL_GPUTextureUsageFlags usage);
+
+/**
+ * Determines whether a shading rate can be set with SDL_SetGPUShadingRate().
+ *
+ * SDL_GPU_SHADINGRATE_1X1 is always supported. Other rates need variable rate
+ * shading, which is available on the Direct3D 12 and Vulkan backends when
+ * the hardware supports it.
+ *
+ * \param device a GPU context.
+ * \param rate the shading rate to check.
+ * 
+eturns whether the shading rate is supported.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetGPUShadingRate
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GPUSupportsShadingRate(
+    SDL_GPUDevice *device,
+    SDL_GPUShadingRate rate);
+
+/**
+ * Gets the size of the pixel squares covered by each texel of a shading rate
+ * image.
+ *
+ * Shading rate images are currently only supported by the Direct3D 12
+ * backend.
+ *
+ * \param device a GPU context.
+ * 
+eturns the tile size in pixels, or 0 if shading rate images are not
+ *          supported.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetGPUShadingRateImage
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GetGPUShadingRateImageTileSize(
+    SDL_GPUDevice *device);
+
 /**
  * Calculate the size in bytes of a texture format with dimensions.
  *
@@ -299,6 +299,28 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_CHANNELS "SDL_AUDIO_CHANNELS"
 
+/**
+ * A variable setting how many bytes of audio stream buffers SDL keeps for
+ * reuse.
+ *
+ * Every audio stream keeps its queued data in fixed size chunks, and normally
+ * each stream holds on to a few free chunks of its own, which go back to the
+ * heap when the stream is destroyed. Apps that create and destroy many short
+ * lived streams, like one per sound effect, can set this hint to an integer >
+ * 0 to have SDL keep up to that many bytes of chunks in a pool shared by all
+ * streams, so that new streams don't need to allocate memory in steady state.
+ *
+ * The pooled memory is reported under SDL_MEMORY_TAG_AUDIO_POOL by
+ * SDL_GetMemoryTagStats(), and is freed when the audio subsystem is quit.
+ *
+ * The default is 0, which doesn't keep a shared pool.
+ *
+ * This hint should be set before the audio subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_CHUNK_POOL_SIZE "SDL_AUDIO_CHUNK_POOL_SIZE"
+
 /**
  * Specify an application icon name for an audio device.
  *
@@ -322,6 +344,30 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_APP_ICON_NAME "SDL_AUDIO_DEVICE_APP_ICON_NAME"
 
+/**
+ * A variable controlling how many worker threads help a playback device mix.
+ *
+ * Normally each playback device's thread pulls data from every bound audio
+ * stream itself, one after another. If an app binds many streams that need
+ * conversion or resampling, this can be more work than one core can do in a
+ * device period. Setting this hint to an integer > 0 gives each playback
+ * device that many extra threads, and each device period the streams are
+ * converted in parallel, with the device thread doing the final mix. The
+ * device thread also takes any streams that no worker has started, so workers
+ * that are late never make the device miss its deadline.
+ *
+ * With this enabled, audio stream get callbacks may run on the worker threads,
+ * several at once, and the iteration start callbacks of every logical device
+ * run before any of its streams are read.
+ *
+ * The default is 0, which does everything on the device thread.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIX_THREADS "SDL_AUDIO_DEVICE_MIX_THREADS"
+
 /**
  * A variable controlling device buffer size.
  *
@@ -522,6 +568,49 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_INCLUDE_MONITORS "SDL_AUDIO_INCLUDE_MONITORS"
 
+/**
+ * A variable controlling the Multimedia Class Scheduler Service (MMCSS) task
+ * that WASAPI audio device threads register with.
+ *
+ * MMCSS raises the priority of device threads so they keep up with the audio
+ * hardware while the rest of the system is busy. The value is the name of a
+ * task under the MMCSS registry key, such as "Audio", "Games" or "Pro Audio".
+ * If the value is empty, or the task can't be set, device threads use
+ * SDL_SetCurrentThreadPriority() instead.
+ *
+ * The default value is "Pro Audio".
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_WASAPI_TASK_CLASS "SDL_AUDIO_WASAPI_TASK_CLASS"
+
+/**
+ * A variable controlling whether WASAPI playback devices are opened in
+ * exclusive mode.
+ *
+ * An exclusive mode stream bypasses the Windows audio engine, so SDL writes
+ * directly into the endpoint buffer without the engine's mixing, resampling
+ * and extra latency. While it is open, no other application can play sound
+ * on the device.
+ *
+ * SDL negotiates the closest format the device accepts, trying the
+ * requested sample rate before the device's mix rate. If the device can't be
+ * opened exclusively, for example because another application is using it,
+ * SDL opens it in shared mode instead.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Open playback devices in shared mode. (default)
+ * - "1": Try to open playback devices in exclusive mode.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_WASAPI_EXCLUSIVE "SDL_AUDIO_WASAPI_EXCLUSIVE"
+
 /**
  * A variable controlling whether SDL updates joystick state when getting
  * input events.
@@ -575,6 +664,32 @@ extern "C" {
  */
 #define SDL_HINT_BMP_SAVE_LEGACY_FORMAT "SDL_BMP_SAVE_LEGACY_FORMAT"
 
+/**
+ * A variable controlling whether SDL_LoadBMP() and SDL_LoadBMP_IO() may use
+ * the pixels of the BMP file in place instead of copying them.
+ *
+ * This only applies to uncompressed top-down images whose rows can be used
+ * as is. SDL_LoadBMP() maps the file into memory, copy-on-write, and the
+ * returned surface points into the mapping. SDL_LoadBMP_IO() does the same
+ * for memory streams, such as the ones created by SDL_IOFromMem() and
+ * SDL_IOFromConstMem(). The mapping, or the stream if `closeio` is true, is
+ * kept open until the surface is destroyed.
+ *
+ * The memory passed to SDL_IOFromMem() or SDL_IOFromConstMem() has to stay
+ * valid until the surface is destroyed, and the surface pixels must not be
+ * modified if that memory is read-only. Other images are copied as usual.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": The pixels are always copied into a new surface. (default)
+ * - "1": The pixels are used in place when possible.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_BMP_LOAD_IN_PLACE "SDL_BMP_LOAD_IN_PLACE"
+
 /**
  * A variable that decides what camera backend to use.
  *
@@ -591,6 +706,26 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable controlling whether camera frames are converted on their own
+ * thread.
+ *
+ * When a camera is opened with a format or size that the hardware doesn't
+ * provide, each frame has to be converted or scaled before the app gets it.
+ * Doing that on a separate thread lets the next frame be acquired while the
+ * previous one is still being converted, at the cost of another thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Frames are converted on the thread that acquires them. (default)
+ * - "1": Frames that need conversion are converted on a separate thread.
+ *
+ * This hint should be set before a camera is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_CAMERA_CONVERSION_THREAD "SDL_CAMERA_CONVERSION_THREAD"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -796,6 +931,53 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING "SDL_EVENT_LOGGING"
 
+/**
+ * A variable controlling whether pushing events avoids the event queue lock.
+ *
+ * When enabled, SDL_PushEvent() places events in a fixed-size lock-free ring
+ * that any number of threads can push into at once. The events are moved to
+ * the regular queue the next time it is examined, so ordering and the
+ * behavior of the other event functions are unchanged. If the ring fills up,
+ * pushing falls back to taking the lock.
+ *
+ * This can reduce contention when many threads push events.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Events are always added with the queue locked. (default)
+ * - "1": Events are pushed through the lock-free ring.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE "SDL_EVENT_QUEUE_LOCKFREE"
+
+/**
+ * A variable controlling which clock is used to timestamp events.
+ *
+ * Events and joystick, gamepad and sensor updates are stamped as they arrive,
+ * which can be thousands of times per second. Reading the system's high
+ * resolution counter for each of them adds up on some platforms.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "precise": Timestamps come from SDL_GetTicksNS(). (default)
+ * - "tsc": Timestamps come from the CPU time stamp counter, calibrated
+ *   against SDL_GetTicksNS() each time events are pumped. This is only used
+ *   on x86 CPUs with an invariant time stamp counter, otherwise timestamps are
+ *   precise. Until the counter has been calibrated, which takes a few
+ *   milliseconds of pumping events, timestamps are precise.
+ * - "coarse": Timestamps are the time events were last pumped, so events that
+ *   arrive between pumps share a timestamp. This is the cheapest option, for
+ *   applications that don't need better than frame precision.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_EVENT_TIMESTAMPS "SDL_EVENT_TIMESTAMPS"
+
 /**
  * A variable controlling whether raising the window should be done more
  * forcefully.
@@ -1159,6 +1341,21 @@ extern "C" {
  */
 #define SDL_HINT_IOS_HIDE_HOME_INDICATOR "SDL_IOS_HIDE_HOME_INDICATOR"
 
+/**
+ * A variable controlling how many worker threads the SDL job pool starts.
+ *
+ * The pool runs jobs submitted with SDL_SubmitJob() and SDL_RunJobs(), and
+ * SDL's own parallel work. The default is one less than the number of
+ * logical CPU cores, and at least one, since the thread that waits for jobs
+ * to finish also runs them. If this is set to "0", jobs run on the thread
+ * that submits them.
+ *
+ * This hint should be set before the first job is submitted.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOB_THREADS "SDL_JOB_THREADS"
+
 /**
  * A variable that lets you enable joystick (and gamecontroller) events even
  * when your app is in the background.
@@ -1335,7 +1532,9 @@ extern "C" {
  * - "0": GameInput is not used.
  * - "1": GameInput is used.
  *
- * The default is "1" on GDK platforms, and "0" otherwise.
+ * The default is "1" on GDK platforms and on WinRT builds with GameInput
+ * support, and "0" otherwise. If GameInput isn't available at runtime,
+ * the other joystick drivers are used instead.
  *
  * This hint should be set before SDL is initialized.
  *
@@ -1454,6 +1653,24 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_HIDAPI_GAMECUBE_RUMBLE_BRAKE "SDL_JOYSTICK_HIDAPI_GAMECUBE_RUMBLE_BRAKE"
 
+/**
+ * A variable controlling whether HIDAPI input reports are read on a dedicated
+ * thread.
+ *
+ * When enabled, a single thread waits on all open HIDAPI devices and queues
+ * their input reports, so joystick updates don't block reading the devices.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Input reports are read directly when joysticks are updated.
+ * - "1": Input reports are read on a dedicated thread. (default)
+ *
+ * This hint should be set before initializing joysticks and gamepads.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOYSTICK_HIDAPI_INPUT_THREAD "SDL_JOYSTICK_HIDAPI_INPUT_THREAD"
+
 /**
  * A variable controlling whether the HIDAPI driver for Nintendo Switch
  * Joy-Cons should be used.
@@ -2205,6 +2422,29 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_WGI "SDL_JOYSTICK_WGI"
 
+/**
+ * A variable controlling the rate, in Hz, at which Windows.Gaming.Input
+ * controllers are polled on a dedicated thread.
+ *
+ * By default WGI controllers are read when joysticks are updated, usually
+ * from SDL_PumpEvents(), so input latency depends on how often the
+ * application pumps events. When this is set to a positive value, e.g.
+ * "1000", SDL reads the controllers on a separate thread at about that rate
+ * instead, and each input event is stamped with the time the controller
+ * reported it, rather than the time the application asked for it.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Controllers are polled when joysticks are updated. (default)
+ * - A positive number: Controllers are polled on a separate thread at this
+ *   rate, up to 8000.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOYSTICK_WGI_POLLING_RATE "SDL_JOYSTICK_WGI_POLLING_RATE"
+
 /**
  * A variable containing a list of wheel style controllers.
  *
@@ -2385,6 +2625,47 @@ extern "C" {
  */
 #define SDL_HINT_LOGGING "SDL_LOGGING"
 
+/**
+ * A variable controlling whether log messages are written on a background
+ * thread.
+ *
+ * By default the log output function is called on the thread that logged
+ * the message, which can be slow when the output goes to a debugger. When
+ * this is enabled, messages are formatted on the calling thread and queued,
+ * and a background thread passes them to the log output function in order.
+ * Any queued messages are written out when SDL_Quit() is called.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Log messages are written on the thread that logged them. (default)
+ * - "1": Log messages are written on a background thread.
+ *
+ * This hint should be set before the first log message or SDL_Init(),
+ * whichever comes first.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_LOGGING_ASYNC "SDL_LOGGING_ASYNC"
+
+/**
+ * A variable controlling what happens when the background log queue is full.
+ *
+ * This is only used when SDL_HINT_LOGGING_ASYNC is enabled.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "drop": New messages are dropped until there is room in the queue, and a
+ *   warning with the number of dropped messages is logged afterwards.
+ *   (default)
+ * - "block": The logging thread waits until there is room in the queue.
+ *
+ * This hint should be set before the first log message or SDL_Init(),
+ * whichever comes first.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_LOGGING_ASYNC_OVERFLOW "SDL_LOGGING_ASYNC_OVERFLOW"
+
 /**
  * A variable controlling whether to force the application to become the
  * foreground process when launched on macOS.
@@ -2493,6 +2774,11 @@ extern "C" {
  * processed by SDL_AppEvent). This can be useful for apps that are completely
  * idle except in response to input.
  *
+ * If set to "vblank", SDL_AppIterate will be called once per vertical blank
+ * of the display, which paces the app precisely to the display's refresh
+ * rate without any timing of its own. This is currently only supported on
+ * WinRT, other platforms treat it like "0".
+ *
  * On some platforms, or if you are using SDL_main instead of SDL_AppIterate,
  * this hint is ignored. When the hint can be used, it is allowed to be
  * changed at any time.
@@ -2703,6 +2989,32 @@ extern "C" {
  */
 #define SDL_HINT_MOUSE_RELATIVE_CURSOR_VISIBLE "SDL_MOUSE_RELATIVE_CURSOR_VISIBLE"
 
+/**
+ * A variable controlling whether relative mouse motion events are merged
+ * while they wait in the event queue.
+ *
+ * High polling rate mice can report thousands of motions per second, which
+ * can fill the event queue during a long frame. When this is enabled, a
+ * relative motion event that would be queued right behind another motion
+ * event from the same mouse, window and button state is merged into it
+ * instead: the relative motion is added up, and the position and timestamp
+ * are taken from the newest motion.
+ *
+ * Event watchers added with SDL_AddEventWatch() are still called for every
+ * motion before it's merged, so they can be used to record the full rate
+ * motion history.
+ *
+ * This variable can be set to the following values:
+ *
+ * - "0": Every relative motion is queued as a separate event. (default)
+ * - "1": Consecutive relative motion events are merged.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_MOUSE_RELATIVE_COALESCE_MOTION "SDL_MOUSE_RELATIVE_COALESCE_MOTION"
+
 /**
  * A variable controlling whether mouse events should generate synthetic touch
  * events.
@@ -2841,6 +3153,34 @@ extern "C" {
  */
 #define SDL_HINT_ORIENTATIONS "SDL_ORIENTATIONS"
 
+/**
+ * A variable controlling whether SDL_InitSubSystem() initializes independent
+ * subsystems in parallel.
+ *
+ * When this is enabled and more than one subsystem is being initialized,
+ * audio, joystick and gamepad, sensor and camera initialization run on the
+ * job pool while video initializes on the calling thread. Gamepad
+ * initialization, which loads the gamepad mapping database, starts as soon as
+ * joystick initialization finishes. SDL_InitSubSystem() still returns only
+ * after every requested subsystem is ready, and reports errors the same way,
+ * so this only shortens the time spent in the call when device enumeration
+ * is slow.
+ *
+ * Some platform backends expect to be initialized on the main thread, so
+ * this is off by default, and it's ignored on Apple platforms and
+ * Emscripten.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Initialize subsystems one after another. (default)
+ * - "1": Initialize independent subsystems in parallel.
+ *
+ * This hint should be set before calling SDL_Init() or SDL_InitSubSystem().
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_PARALLEL_INIT "SDL_PARALLEL_INIT"
+
 /**
  * A variable controlling the use of a sentinel event when polling the event
  * queue.
@@ -2933,6 +3273,29 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_DIRECT3D11_DEBUG "SDL_RENDER_DIRECT3D11_DEBUG"
 
+/**
+ * A variable controlling whether the Direct3D 11 renderer defers swap chain
+ * resizes while the window is being resized.
+ *
+ * When enabled, the renderer keeps drawing at the previous size and lets the
+ * compositor stretch it to the window until the window size has stopped
+ * changing for a short time, then resizes the swap chain buffers once. This
+ * avoids a resize on every frame of an interactive resize, at the cost of a
+ * blurry image until the resize settles. It has no effect on swap chains that
+ * the compositor can't stretch.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Resize the swap chain on the first frame after each size change.
+ *   (default)
+ * - "1": Defer swap chain resizes until the window size settles.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_RENDER_DIRECT3D11_LIVE_RESIZE "SDL_RENDER_DIRECT3D11_LIVE_RESIZE"
+
 /**
  * A variable controlling whether to enable Vulkan Validation Layers.
  *
@@ -3042,6 +3405,51 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling whether the software renderer splits the target
+ * into tiles and draws them on the job threads.
+ *
+ * Fills, points, clears, unscaled copies and geometry are drawn in 64x64
+ * tiles in parallel, keeping their order within each tile. Lines, scaled
+ * copies and rotated copies are drawn on the rendering thread between the
+ * tiled runs. The output is the same either way.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Draw everything on the rendering thread. (default)
+ * - "1": Draw tiles on the job threads.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_JOB_THREADS
+ */
+#define SDL_HINT_RENDER_SOFTWARE_TILES "SDL_RENDER_SOFTWARE_TILES"
+
+/**
+ * A variable controlling whether SDL_RenderPresent() throttles while the
+ * window can't be seen.
+ *
+ * When this is enabled and the window is hidden, minimized or occluded, or
+ * the swap chain reports that it is occluded, SDL_RenderPresent() skips the
+ * present and waits until the next display refresh instead. Full rate
+ * presentation resumes as soon as the window is visible again. Skipped frames
+ * are reported in SDL_RenderStats.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Always present. (default)
+ * - "1": Skip presents and throttle while the window can't be seen.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetRenderStats
+ */
+#define SDL_HINT_RENDER_THROTTLE_OCCLUDED "SDL_RENDER_THROTTLE_OCCLUDED"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -3196,6 +3604,81 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling whether surfaces created by the app share SDL's
+ * pool of surface pixels.
+ *
+ * SDL keeps the pixels of its own temporary surfaces, like the intermediate
+ * surfaces of scaled blits and the results of SDL_ConvertSurface(), in a pool
+ * when they're destroyed, so that creating another surface of about the same
+ * size doesn't have to allocate and fault in new memory. Apps that create
+ * and destroy same sized surfaces every frame can set this hint to have
+ * SDL_CreateSurface() use the pool too. See SDL_HINT_SURFACE_POOL_SIZE for how
+ * much memory the pool keeps.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": SDL_CreateSurface() always allocates new pixels. (default)
+ * - "1": SDL_CreateSurface() reuses pixels from the pool, and gives them back
+ *   when the surface is destroyed.
+ *
+ * This hint can be set anytime, and affects surfaces created after it's set.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_POOL_APP_SURFACES "SDL_SURFACE_POOL_APP_SURFACES"
+
+/**
+ * A variable setting how many bytes of surface pixels SDL keeps for reuse.
+ *
+ * Pixels of large pooled surfaces (see SDL_HINT_SURFACE_POOL_APP_SURFACES)
+ * are kept when the surface is destroyed, up to this many bytes in total,
+ * and handed to the next surface that needs a buffer of the same size. Set
+ * this hint to 0 to always free them.
+ *
+ * The pooled memory is reported under SDL_MEMORY_TAG_SURFACE_POOL by
+ * SDL_GetMemoryTagStats(). It's freed when SDL_Quit() is called, and on
+ * Windows Store apps also when the app is suspended.
+ *
+ * The default is 16777216 (16 MB).
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_POOL_SIZE "SDL_SURFACE_POOL_SIZE"
+
+/**
+ * A variable controlling how many threads run large software surface
+ * operations.
+ *
+ * When this hint is set to an integer > 1, SDL_BlitSurface(),
+ * SDL_ConvertPixels(), SDL_StretchSurface() and the other software blit and
+ * scale functions split large operations into bands of rows and run up to
+ * that many bands at once, on the calling thread and the worker threads of
+ * the SDL job pool (see SDL_HINT_JOB_THREADS). Small operations always run
+ * on the calling thread, so they don't pay the cost of waking up the
+ * workers.
+ *
+ * Converting large SDL_PIXELFORMAT_MJPG frames also uses these threads to
+ * decode the restart intervals of the image at the same time, if the image
+ * has them.
+ *
+ * Blits that change the size of the image with SDL_SCALEMODE_NEAREST, and
+ * blits between overlapping areas of the same pixels, are never split.
+ *
+ * Large surfaces with RLE acceleration enabled (see SDL_SetSurfaceRLE()) are
+ * encoded on the worker threads the first time they're blit, and use the
+ * regular blitters until the encoding is done.
+ *
+ * The default is 0, which does all the work on the calling thread.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_THREADS "SDL_SURFACE_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -3268,6 +3751,31 @@ extern "C" {
  */
 #define SDL_HINT_TIMER_RESOLUTION "SDL_TIMER_RESOLUTION"
 
+/**
+ * A variable controlling whether finger motion events are merged while they
+ * wait in the event queue.
+ *
+ * When this is enabled, a finger motion is merged into an earlier motion
+ * event for the same finger if only other finger motion events from the
+ * same touch device have been queued since then. The motion is added up,
+ * and the position, pressure and timestamp come from the newest motion. On
+ * large multitouch displays this leaves roughly one motion event per finger
+ * for each frame, instead of one per hardware report.
+ *
+ * Because a merged event keeps its place in the queue, finger motion events
+ * for different fingers may not be in timestamp order.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Every finger motion is queued as a separate event. (default)
+ * - "1": Finger motion events are merged.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_TOUCH_COALESCE_MOTION "SDL_TOUCH_COALESCE_MOTION"
+
 /**
  * A variable controlling whether touch events should generate synthetic mouse
  * events.
@@ -3808,6 +4316,29 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_X11_XRANDR "SDL_VIDEO_X11_XRANDR"
 
+/**
+ * A variable controlling how many threads convert large frames between RGB
+ * and YUV.
+ *
+ * When this hint is set to an integer > 1, SDL_ConvertPixels() splits
+ * conversions from RGB to the 4:2:0 formats (YV12, IYUV, NV12, NV21 and P010)
+ * into bands of rows and converts up to that many bands at once, on the
+ * calling thread and the worker threads used for SDL_HINT_SURFACE_THREADS.
+ * Frames are only split when each band would have enough pixels to be worth
+ * the cost of waking up a worker.
+ *
+ * Conversions from YUV to the RGB formats SDL has direct conversions for are
+ * split the same way, and so are updates of YUV textures on renderers that
+ * don't support YUV natively, like the software renderer.
+ *
+ * The default is 0, which does the whole conversion on the calling thread.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_VIDEO_YUV_CONVERSION_THREADS "SDL_VIDEO_YUV_CONVERSION_THREADS"
+
 /**
  * A variable controlling whether touch should be enabled on the back panel of
  * the PlayStation Vita.
@@ -4362,6 +4893,115 @@ extern "C" {
  */
 #define SDL_HINT_WINRT_PRIVACY_POLICY_URL "SDL_WINRT_PRIVACY_POLICY_URL"
 
+/**
+ * A variable controlling whether a WinRT app's main function runs on a
+ * dedicated game thread.
+ *
+ * By default, SDL runs the app's main function on the CoreWindow's UI thread,
+ * and SDL_PumpEvents() dispatches CoreWindow events inline. When the UI
+ * thread stalls, for example while the game bar or other system UI is up,
+ * the app stalls with it.
+ *
+ * With this hint enabled, the UI thread only dispatches CoreWindow events,
+ * which get posted to SDL's event queue as they arrive, and the app's main
+ * function runs on a separate, high priority thread. SDL_PumpEvents() then
+ * never waits on the UI thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": The app's main function runs on the UI thread. (default)
+ * - "1": The app's main function runs on a dedicated game thread.
+ *
+ * This hint must be set before SDL_RunApp() is called, either as an
+ * environment variable or by an app using SDL_MAIN_HANDLED.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_WINRT_GAME_THREAD "SDL_WINRT_GAME_THREAD"
+
+/**
+ * A variable controlling whether WinRT pointer motion reports every
+ * intermediate point.
+ *
+ * Pen, touch and mouse hardware can sample faster than CoreWindow delivers
+ * pointer events, in which case several samples get coalesced into one
+ * event. With this hint enabled, SDL sends a motion event for each of those
+ * samples, timestamped using the sample's hardware timestamp, instead of
+ * only the most recent one.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Only the most recent pointer sample is reported. (default)
+ * - "1": Every pointer sample is reported.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_WINRT_POINTER_HISTORY "SDL_WINRT_POINTER_HISTORY"
+
+/**
+ * A variable controlling whether a WinRT app records a startup timeline.
+ *
+ * When enabled, SDL timestamps the app's launch as it goes, from the
+ * IFrameworkView callbacks through video initialization, graphics device
+ * creation and the first frame presented. Each stage is logged under
+ * SDL_LOG_CATEGORY_SYSTEM and stored as a global property, see
+ * SDL_PROP_GLOBAL_WINRT_STARTUP_INITIALIZE_NUMBER and friends.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": No startup timeline is recorded. (default)
+ * - "1": The startup timeline is logged and stored in the global properties.
+ *
+ * This hint should be set as an environment variable or before SDL_RunApp()
+ * is called, so the earliest stages are recorded.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_WINRT_STARTUP_TIMELINE "SDL_WINRT_STARTUP_TIMELINE"
+
+/**
+ * A variable controlling the maximum frame latency of OpenGL ES windows on
+ * WinRT.
+ *
+ * OpenGL ES on WinRT goes through ANGLE, which presents with a Direct3D 11
+ * swap chain. This sets how many frames the swap chain may queue before
+ * SDL_GL_SwapWindow() blocks. Lower values reduce input latency, at the cost
+ * of throughput when frame times vary.
+ *
+ * The variable can be set to a number of frames between 1 and 16. By
+ * default, the driver's value is used, which is usually 3.
+ *
+ * This hint should be set before the OpenGL library is loaded.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_WINRT_GLES_FRAME_LATENCY "SDL_WINRT_GLES_FRAME_LATENCY"
+
+/**
+ * A variable controlling whether OpenGL ES windows on WinRT are rendered
+ * upside down.
+ *
+ * ANGLE can present straight from the app's back buffer when it's stored
+ * with an inverted Y axis, using the EGL_ANGLE_surface_orientation and
+ * EGL_ANGLE_experimental_present_path extensions, which saves a copy of the
+ * whole frame on each swap. The app then has to flip its rendering
+ * vertically, for example in its projection matrix and when reading pixels
+ * back.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Windows are rendered the right way up, and ANGLE copies each frame
+ *   to present it. (default)
+ * - "1": Windows are rendered upside down and presented without a copy.
+ *
+ * This hint should be set before the OpenGL library is loaded.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_WINRT_GLES_INVERT_Y "SDL_WINRT_GLES_INVERT_Y"
+
 
 /**
  * A variable controlling whether X11 windows are marked as override-redirect.
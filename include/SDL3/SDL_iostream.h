@@ -223,7 +223,9 @@ typedef struct SDL_IOStream SDL_IOStream;
  * letter and the "+" sign for the mixed modes ("rb+", "wb+", "ab+").
  * Additional characters may follow the sequence, although they should have no
  * effect. For example, "t" is sometimes appended to make explicit the file is
- * a text file.
+ * a text file. On Windows, an "S" hints that the file will mostly be read
+ * from start to end, as with the C runtime's fopen(), so the system can read
+ * further ahead.
  *
  * This function supports Unicode filenames, but they must be encoded in UTF-8
  * format, regardless of the underlying operating system.
@@ -254,6 +256,14 @@ typedef struct SDL_IOStream SDL_IOStream;
  *   the filesystem. If SDL used some other method to access the filesystem,
  *   this property will not be set.
  *
+ * The following properties may be changed by the app at any time:
+ *
+ * - `SDL_PROP_IOSTREAM_WINDOWS_READAHEAD_SIZE_NUMBER`: the largest number of
+ *   bytes SDL will read ahead and buffer when the app makes small reads from
+ *   a Windows file. The buffer starts small and grows while the file is read
+ *   from start to end, up to this size. Set it to 0 to turn off buffering.
+ *   Defaults to 65536.
+ *
  * \param file a UTF-8 string representing the filename to open.
  * \param mode an ASCII string representing the mode to be used for opening
  *             the file.
@@ -274,6 +284,7 @@ typedef struct SDL_IOStream SDL_IOStream;
 extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromFile(const char *file, const char *mode);
 
 #define SDL_PROP_IOSTREAM_WINDOWS_HANDLE_POINTER    "SDL.iostream.windows.handle"
+#define SDL_PROP_IOSTREAM_WINDOWS_READAHEAD_SIZE_NUMBER "SDL.iostream.windows.readahead_size"
 #define SDL_PROP_IOSTREAM_STDIO_FILE_POINTER        "SDL.iostream.stdio.file"
 #define SDL_PROP_IOSTREAM_FILE_DESCRIPTOR_NUMBER    "SDL.iostream.file_descriptor"
 #define SDL_PROP_IOSTREAM_ANDROID_AASSET_POINTER    "SDL.iostream.android.aasset"
@@ -396,6 +407,42 @@ extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromDynamicMem(void);
 #define SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER    "SDL.iostream.dynamic.memory"
 #define SDL_PROP_IOSTREAM_DYNAMIC_CHUNKSIZE_NUMBER  "SDL.iostream.dynamic.chunksize"
 
+/**
+ * Use this function to map a file into memory for reading.
+ *
+ * The whole file is mapped into the address space, so reads are just memory
+ * copies and seeking never touches the file system. Only the parts of the
+ * file that are actually read get loaded from disk. This is a good fit for
+ * large files that are read in many small pieces at random offsets, like
+ * asset packs.
+ *
+ * The mapping is copy-on-write: memory returned by SDL_GetIOPointer() can be
+ * modified without changing the file. The stream itself is read-only, and
+ * attempting to write to it will report an error.
+ *
+ * The file must be a regular, non-empty file that fits in the address space.
+ *
+ * The following properties will be set at creation time by SDL:
+ *
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: a pointer to the mapped file data.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: the size of the file, in bytes.
+ *
+ * \param file a UTF-8 string representing the filename to open.
+ * \returns a pointer to the SDL_IOStream structure that is created or NULL on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CloseIO
+ * \sa SDL_GetIOPointer
+ * \sa SDL_IOFromFile
+ * \sa SDL_ReadIO
+ * \sa SDL_SeekIO
+ */
+extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromMappedFile(const char *file);
+
 /* @} *//* IOFrom functions */
 
 
@@ -556,6 +603,35 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_SeekIO(SDL_IOStream *context, Sint64 offs
  */
 extern SDL_DECLSPEC Sint64 SDLCALL SDL_TellIO(SDL_IOStream *context);
 
+/**
+ * Get a pointer to a range of data in a memory-backed stream.
+ *
+ * This lets parsers read data in place instead of copying it out with
+ * SDL_ReadIO(). It works on streams created with SDL_IOFromMem(),
+ * SDL_IOFromConstMem() and SDL_IOFromMappedFile(), and fails for any other
+ * kind of stream.
+ *
+ * This doesn't change the current read/write position of the stream. The
+ * pointer stays valid until the stream is closed.
+ *
+ * \param context a memory-backed SDL_IOStream structure.
+ * \param offset the offset of the range from the start of the stream, in
+ *               bytes.
+ * \param size the size of the range, in bytes.
+ * \returns a pointer to the data at `offset` or NULL on failure; call
+ *          SDL_GetError() for more information. It fails if the range goes
+ *          past the end of the stream.
+ *
+ * \threadsafety This function is not thread safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_IOFromConstMem
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_IOFromMem
+ */
+extern SDL_DECLSPEC const void * SDLCALL SDL_GetIOPointer(SDL_IOStream *context, Sint64 offset, size_t size);
+
 /**
  * Read from a data source.
  *
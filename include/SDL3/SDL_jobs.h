@@ -0,0 +1,274 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Jobs */
+
+/**
+ * # CategoryJobs
+ *
+ * SDL keeps a pool of worker threads that run small pieces of work, called
+ * jobs, in the background. SDL uses the same pool for its own parallel work,
+ * like large software blits and the generic async I/O backend, so an app
+ * that puts its work here too doesn't end up with more busy threads than the
+ * machine has CPU cores.
+ *
+ * The general usage pattern is:
+ *
+ * - Create an SDL_JobCounter with SDL_CreateJobCounter.
+ * - Submit jobs with SDL_SubmitJob, passing the counter. The counter goes up
+ *   by one for each job and back down when the job finishes.
+ * - Call SDL_WaitJobCounter to wait for all of them to finish. The waiting
+ *   thread runs queued jobs itself until then, instead of going to sleep.
+ *
+ * A job can also wait for other jobs to finish before it starts: submit it
+ * with SDL_SubmitJobAfter and it will be queued when the counter it depends
+ * on drops to zero. This makes it possible to build chains of work without
+ * blocking any thread.
+ *
+ * For the common case of running the same function on many independent
+ * pieces of data, SDL_RunJobs splits the work across the pool and returns
+ * when it's all done.
+ *
+ * Each worker thread has its own queue of jobs. Jobs submitted from a worker
+ * go on its own queue, and a worker that runs out of work takes jobs from
+ * the other queues, so work spreads out across the pool without a single
+ * point of contention.
+ *
+ * Jobs should be short and shouldn't block for long periods of time, since a
+ * blocked job keeps one of a limited number of threads from doing any other
+ * work.
+ */
+
+#ifndef SDL_jobs_h_
+#define SDL_jobs_h_
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A counter that tracks how many jobs in a group haven't finished yet.
+ *
+ * This is an opaque datatype.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobCounter
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobCounter
+ */
+typedef struct SDL_JobCounter SDL_JobCounter;
+
+/**
+ * The function that a job runs.
+ *
+ * \param userdata the pointer that was passed to SDL_SubmitJob().
+ *
+ * \threadsafety This function runs on a worker thread, or on a thread that is
+ *               waiting in SDL_WaitJobCounter().
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobFunction)(void *userdata);
+
+/**
+ * The function that SDL_RunJobs() calls for each piece of work.
+ *
+ * \param userdata the pointer that was passed to SDL_RunJobs().
+ * \param index the piece of work to do, from 0 to count - 1.
+ *
+ * \threadsafety This function may be called on several threads at once, with
+ *               different values of `index`.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_RunJobs
+ */
+typedef void (SDLCALL *SDL_JobRangeFunction)(void *userdata, int index);
+
+/**
+ * Create a job counter.
+ *
+ * The counter starts at zero.
+ *
+ * \returns a new job counter or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyJobCounter
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC SDL_JobCounter * SDLCALL SDL_CreateJobCounter(void);
+
+/**
+ * Destroy a job counter.
+ *
+ * The counter must be at zero, with no jobs waiting on it, before it is
+ * destroyed.
+ *
+ * \param counter the job counter to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobCounter
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Get the number of jobs on a counter that haven't finished yet.
+ *
+ * This includes jobs that are waiting for a dependency before they start.
+ *
+ * \param counter the job counter to query.
+ * \returns the number of unfinished jobs, or 0 if `counter` is NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetJobCounterValue(SDL_JobCounter *counter);
+
+/**
+ * Submit a job to the SDL job pool.
+ *
+ * The job will run on one of the worker threads, or on a thread that is
+ * waiting on a job counter with SDL_WaitJobCounter().
+ *
+ * If `counter` isn't NULL, it is increased by one now, and decreased by one
+ * when the job finishes.
+ *
+ * The pool is started the first time a job is submitted.
+ *
+ * \param func the function for the job to run.
+ * \param userdata a pointer that is passed to `func`.
+ * \param counter an optional job counter to track the job with, may be NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJobAfter
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJob(SDL_JobFunction func, void *userdata, SDL_JobCounter *counter);
+
+/**
+ * Submit a job that starts after other jobs have finished.
+ *
+ * The job is held back until `dependency` drops to zero, and is then queued
+ * like any other job. If `dependency` is already zero, or NULL, the job is
+ * queued right away.
+ *
+ * If `counter` isn't NULL, it is increased by one now, and decreased by one
+ * when the job finishes, so waiting on `counter` also waits for the jobs
+ * that `dependency` is tracking.
+ *
+ * \param dependency the job counter to wait for, may be NULL.
+ * \param func the function for the job to run.
+ * \param userdata a pointer that is passed to `func`.
+ * \param counter an optional job counter to track the job with, may be NULL.
+ *                This can't be the same as `dependency`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJobAfter(SDL_JobCounter *dependency, SDL_JobFunction func, void *userdata, SDL_JobCounter *counter);
+
+/**
+ * Wait for all the jobs on a counter to finish.
+ *
+ * While it waits, the calling thread runs queued jobs itself, so it is safe
+ * to call this from inside a job, and a thread that waits on its own jobs
+ * helps them finish sooner.
+ *
+ * \param counter the job counter to wait for.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WaitJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Run a function for each index from 0 to `count` - 1, in parallel.
+ *
+ * The calling thread and any idle worker threads split the indices between
+ * them. This function returns once every index has been handled.
+ *
+ * \param func the function to call for each index.
+ * \param userdata a pointer that is passed to `func`.
+ * \param count the number of indices.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_RunJobs(SDL_JobRangeFunction func, void *userdata, int count);
+
+/**
+ * Get the number of worker threads in the SDL job pool.
+ *
+ * This starts the pool if it isn't running yet. The number of threads is
+ * controlled by SDL_HINT_JOB_THREADS.
+ *
+ * \returns the number of worker threads, which may be 0 if threads aren't
+ *          available, in which case jobs run on the thread that submits
+ *          them.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_JOB_THREADS
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetNumJobThreads(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_jobs_h_ */
@@ -1070,6 +1070,56 @@ extern SDL_DECLSPEC Uint8 SDLCALL SDL_GetJoystickHat(SDL_Joystick *joystick, int
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetJoystickButton(SDL_Joystick *joystick, int button);
 
+/**
+ * A copy of the axis, button and hat state of a joystick.
+ *
+ * The application provides the arrays and their sizes, and
+ * SDL_GetJoystickSnapshot() fills them in.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetJoystickSnapshot
+ */
+typedef struct SDL_JoystickSnapshot
+{
+    Uint64 timestamp;   /**< [out] The time of the most recent axis, button or hat change, in nanoseconds, or 0 if there hasn't been one */
+    int num_axes;       /**< [in] The number of elements in `axes` */
+    Sint16 *axes;       /**< [in] Storage for the axis values, may be NULL if `num_axes` is 0 */
+    int num_buttons;    /**< [in] The number of elements in `buttons` */
+    bool *buttons;      /**< [in] Storage for the button states, may be NULL if `num_buttons` is 0 */
+    int num_hats;       /**< [in] The number of elements in `hats` */
+    Uint8 *hats;        /**< [in] Storage for the hat positions, may be NULL if `num_hats` is 0 */
+} SDL_JoystickSnapshot;
+
+/**
+ * Get a consistent copy of the current state of a joystick without blocking.
+ *
+ * Unlike SDL_GetJoystickAxis() and friends, this doesn't take the lock that
+ * is held while joysticks are updated, so a thread that samples input at a
+ * precise time, like an emulator at the start of a frame, isn't stalled by
+ * SDL_UpdateJoysticks() on another thread. The values are all from the same
+ * point in time; if the state changes while it's being copied, the copy is
+ * retried.
+ *
+ * Elements past the number of axes, buttons or hats the joystick has are set
+ * to zero.
+ *
+ * \param joystick the joystick to query.
+ * \param snapshot the arrays to fill in, and where to store the timestamp.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               the joystick isn't closed while it's running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetNumJoystickAxes
+ * \sa SDL_GetNumJoystickButtons
+ * \sa SDL_GetNumJoystickHats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetJoystickSnapshot(SDL_Joystick *joystick, SDL_JoystickSnapshot *snapshot);
+
 /**
  * Start a rumble effect.
  *
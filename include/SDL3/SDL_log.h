@@ -531,6 +531,65 @@ extern SDL_DECLSPEC void SDLCALL SDL_GetLogOutputFunction(SDL_LogOutputFunction
  */
 extern SDL_DECLSPEC void SDLCALL SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata);
 
+/**
+ * The type of a tracing event passed to an SDL_TraceCallback.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetTraceCallback
+ */
+typedef enum SDL_TraceEventType
+{
+    SDL_TRACE_EVENT_BEGIN,  /**< SDL started working on a zone */
+    SDL_TRACE_EVENT_END     /**< SDL finished working on the most recently started zone on this thread */
+} SDL_TraceEventType;
+
+/**
+ * The prototype for the tracing callback function.
+ *
+ * This function is called when SDL starts and finishes a piece of work that
+ * is worth seeing in a profiler, like pumping events, presenting a frame or
+ * mixing audio. Zones nest, and each end event closes the most recent zone
+ * begun on the same thread.
+ *
+ * \param userdata what was passed as `userdata` to SDL_SetTraceCallback().
+ * \param type whether the zone is starting or finishing.
+ * \param name the name of the zone, a string constant that stays valid for
+ *             the life of the program.
+ * \param timestamp the time of the event, in nanoseconds, from
+ *                  SDL_GetTicksNS().
+ *
+ * \threadsafety This function may be called from any thread, including
+ *               several at once. It should return quickly.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetTraceCallback
+ */
+typedef void (SDLCALL *SDL_TraceCallback)(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp);
+
+/**
+ * Set a function to receive SDL's tracing events.
+ *
+ * This lets SDL's own work show up on the application's profiling timeline.
+ * Builds with tracing also send the same zones to the platform profiler:
+ * ETW TraceLogging on Windows, PIX events on Xbox and Tracy when SDL is built
+ * with the `SDL_TRACING_TRACY` CMake option.
+ *
+ * This requires SDL to be built with the `SDL_TRACING` CMake option.
+ *
+ * \param callback the function to call for each event, or NULL to stop
+ *                 receiving them.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -164,7 +164,8 @@
            otherwise empty .cpp file that only contains `#include <SDL3/SDL_main.h>`
            and build that with /ZW (still include SDL_main.h in your other file with main()!).
            In XAML apps, instead the function SDL_RunApp() must be called with a pointer
-           to the Direct3D-hosted XAML control passed in as the "reserved" argument.
+           to the Direct3D-hosted XAML control passed in as the "reserved" argument,
+           either a SwapChainPanel or a SwapChainBackgroundPanel.
         */
         #define SDL_MAIN_NEEDED
 
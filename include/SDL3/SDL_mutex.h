@@ -398,6 +398,87 @@ extern SDL_DECLSPEC void SDLCALL SDL_UnlockMutex(SDL_Mutex *mutex) SDL_RELEASE(m
  */
 extern SDL_DECLSPEC void SDLCALL SDL_DestroyMutex(SDL_Mutex *mutex);
 
+/**
+ * Lock contention statistics for a mutex.
+ *
+ * These are only recorded when SDL is built with the `SDL_MUTEX_STATS` CMake
+ * option, which adds a little overhead to every lock.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMutexStats
+ */
+typedef struct SDL_MutexStats
+{
+    const char *name;   /**< the name set with SDL_SetMutexName(), or NULL */
+    bool destroyed;     /**< true if these are the combined totals of mutexes with this name that were destroyed */
+    Uint64 acquires;    /**< the number of times the mutex was locked */
+    Uint64 contended;   /**< the number of times a lock had to wait for another thread */
+    Uint64 wait_ns;     /**< the total time spent waiting, in nanoseconds */
+    Uint64 max_wait_ns; /**< the longest single wait, in nanoseconds */
+} SDL_MutexStats;
+
+/**
+ * Set a name for a mutex to identify it in lock statistics.
+ *
+ * SDL names its own frequently used mutexes, like the event queue lock.
+ *
+ * If SDL wasn't built with lock statistics, this does nothing.
+ *
+ * \param mutex the mutex to name.
+ * \param name the name of the mutex, which is copied.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMutexStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetMutexName(SDL_Mutex *mutex, const char *name);
+
+/**
+ * Get lock contention statistics for all mutexes that have been locked.
+ *
+ * Mutexes that haven't been locked since the last call to
+ * SDL_ResetMutexStats() are left out.
+ *
+ * There is one entry for each live mutex, and one for each name of mutexes
+ * that have since been destroyed, so statistics for short lived locks, like
+ * the ones in audio streams, add up under their name.
+ *
+ * This requires SDL to be built with the `SDL_MUTEX_STATS` CMake option.
+ *
+ * \param count a pointer filled in with the number of entries returned, may
+ *              be NULL.
+ * \returns an array of statistics, followed by an entry with 0 `acquires`,
+ *          or NULL on failure; call SDL_GetError() for more information.
+ *          This is a single allocation that should be freed with SDL_free()
+ *          when it is no longer needed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetMutexStats
+ * \sa SDL_SetMutexName
+ */
+extern SDL_DECLSPEC SDL_MutexStats * SDLCALL SDL_GetMutexStats(int *count);
+
+/**
+ * Clear all recorded lock contention statistics.
+ *
+ * Mutex names are kept.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMutexStats
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetMutexStats(void);
+
 /* @} *//* Mutex functions */
 
 
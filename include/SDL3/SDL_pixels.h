@@ -537,6 +537,10 @@ typedef enum SDL_PackedLayout
  *   bits of the byte; in MSB formats, it's stored in the most-significant
  *   bits. INDEX8 does not need LSB/MSB variants, because each pixel exactly
  *   fills one byte.
+ * - Block compressed formats such as BC1 and BC7 encode each 4x4 block of
+ *   pixels into a fixed number of bytes. They can only be used for textures
+ *   on renderers that list them in SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER,
+ *   and the pitch of their data is the number of bytes in a row of blocks.
  *
  * The 32-bit byte-array encodings such as RGBA32 are aliases for the
  * appropriate 8888 encoding for the current platform. For example, RGBA32 is
@@ -679,6 +683,15 @@ typedef enum SDL_PixelFormat
     SDL_PIXELFORMAT_MJPG = 0x47504a4du,     /**< Motion JPEG */
         /* SDL_DEFINE_PIXELFOURCC('M', 'J', 'P', 'G') */
 
+    SDL_PIXELFORMAT_BC1 = 0x20314342u,      /**< Block compressed: 4x4 texels in 8 bytes, RGB with 1 bit alpha (DXT1) */
+        /* SDL_DEFINE_PIXELFOURCC('B', 'C', '1', ' ') */
+    SDL_PIXELFORMAT_BC2 = 0x20324342u,      /**< Block compressed: 4x4 texels in 16 bytes, RGB with 4 bit alpha (DXT3) */
+        /* SDL_DEFINE_PIXELFOURCC('B', 'C', '2', ' ') */
+    SDL_PIXELFORMAT_BC3 = 0x20334342u,      /**< Block compressed: 4x4 texels in 16 bytes, RGB with interpolated alpha (DXT5) */
+        /* SDL_DEFINE_PIXELFOURCC('B', 'C', '3', ' ') */
+    SDL_PIXELFORMAT_BC7 = 0x20374342u,      /**< Block compressed: 4x4 texels in 16 bytes, RGBA (BPTC) */
+        /* SDL_DEFINE_PIXELFOURCC('B', 'C', '7', ' ') */
+
     /* Aliases for RGBA byte arrays of color data, for the current platform */
     #if SDL_BYTEORDER == SDL_BIG_ENDIAN
     SDL_PIXELFORMAT_RGBA32 = SDL_PIXELFORMAT_RGBA8888,
@@ -80,6 +80,22 @@ typedef enum SDL_PropertyType
     SDL_PROPERTY_TYPE_BOOLEAN
 } SDL_PropertyType;
 
+/**
+ * A property name that has been looked up ahead of time.
+ *
+ * Getting and setting properties with a key skips hashing and comparing the
+ * name string, which helps code that accesses the same properties many times
+ * per frame. Keys are shared by every group of properties, so a key can be
+ * used with any SDL_PropertiesID.
+ *
+ * This is an opaque handle; get one with SDL_GetPropertyKey().
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ */
+typedef struct SDL_PropertyKey SDL_PropertyKey;
+
 /**
  * Get the global SDL properties.
  *
@@ -162,6 +178,25 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LockProperties(SDL_PropertiesID props);
  */
 extern SDL_DECLSPEC void SDLCALL SDL_UnlockProperties(SDL_PropertiesID props);
 
+/**
+ * Get the key for a property name.
+ *
+ * The same name always gives the same key. Keys stay valid until SDL_Quit()
+ * is called, so it's fine to look one up once and keep it.
+ *
+ * \param name the name of the property.
+ * \returns the key for the name, or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetNumberPropertyByKey
+ * \sa SDL_SetNumberPropertyByKey
+ */
+extern SDL_DECLSPEC SDL_PropertyKey * SDLCALL SDL_GetPropertyKey(const char *name);
+
 /**
  * A callback used to free resources when a property is deleted.
  *
@@ -240,6 +275,27 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerPropertyWithCleanup(SDL_Propertie
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value);
 
+/**
+ * Set a pointer property in a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_SetPointerProperty(). The property has no
+ * cleanup function.
+ *
+ * \param props the properties to modify.
+ * \param key the key for the name of the property to modify.
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetPointerProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, void *value);
+
 /**
  * Set a string property in a group of properties.
  *
@@ -260,6 +316,26 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerProperty(SDL_PropertiesID props,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value);
 
+/**
+ * Set a string property in a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_SetStringProperty(). The string is copied.
+ *
+ * \param props the properties to modify.
+ * \param key the key for the name of the property to modify.
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetStringProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, const char *value);
+
 /**
  * Set an integer property in a group of properties.
  *
@@ -277,6 +353,26 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetStringProperty(SDL_PropertiesID props, c
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value);
 
+/**
+ * Set an integer property in a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_SetNumberProperty().
+ *
+ * \param props the properties to modify.
+ * \param key the key for the name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetNumberProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, Sint64 value);
+
 /**
  * Set a floating point property in a group of properties.
  *
@@ -294,6 +390,26 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetNumberProperty(SDL_PropertiesID props, c
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value);
 
+/**
+ * Set a floating point property in a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_SetFloatProperty().
+ *
+ * \param props the properties to modify.
+ * \param key the key for the name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetFloatProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, float value);
+
 /**
  * Set a boolean property in a group of properties.
  *
@@ -311,6 +427,26 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetFloatProperty(SDL_PropertiesID props, co
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value);
 
+/**
+ * Set a boolean property in a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_SetBooleanProperty().
+ *
+ * \param props the properties to modify.
+ * \param key the key for the name of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetBooleanProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, bool value);
+
 /**
  * Return whether a property exists in a group of properties.
  *
@@ -375,6 +511,26 @@ extern SDL_DECLSPEC SDL_PropertyType SDLCALL SDL_GetPropertyType(SDL_PropertiesI
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value);
 
+/**
+ * Get a pointer property from a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_GetPointerProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key for the name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a pointer property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_GetPointerProperty
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, void *default_value);
+
 /**
  * Get a string property from a group of properties.
  *
@@ -399,6 +555,26 @@ extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerProperty(SDL_PropertiesID props
  */
 extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value);
 
+/**
+ * Get a string property from a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_GetStringProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key for the name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a string property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_GetStringProperty
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, const char *default_value);
+
 /**
  * Get a number property from a group of properties.
  *
@@ -421,6 +597,26 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringProperty(SDL_PropertiesID
  */
 extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value);
 
+/**
+ * Get a number property from a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_GetNumberProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key for the name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a number property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_GetNumberProperty
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, Sint64 default_value);
+
 /**
  * Get a floating point property from a group of properties.
  *
@@ -443,6 +639,26 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberProperty(SDL_PropertiesID props,
  */
 extern SDL_DECLSPEC float SDLCALL SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value);
 
+/**
+ * Get a floating point property from a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_GetFloatProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key for the name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a floating point property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_GetFloatProperty
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, float default_value);
+
 /**
  * Get a boolean property from a group of properties.
  *
@@ -465,6 +681,26 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetFloatProperty(SDL_PropertiesID props, c
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value);
 
+/**
+ * Get a boolean property from a group of properties, using a key for the name.
+ *
+ * This works the same as SDL_GetBooleanProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key for the name of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a boolean property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_GetBooleanProperty
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, bool default_value);
+
 /**
  * Clear a property from a group of properties.
  *
@@ -282,6 +282,16 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRenderer(SDL_Window *window
  * - `SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER`: non-zero if you want
  *   present synchronized with the refresh rate. This property can take any
  *   value that is supported by SDL_SetRenderVSync() for the renderer.
+ * - `SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN`: true if SDL may reorder
+ *   queued geometry draws that don't overlap so draws using the same texture
+ *   and blend state are submitted together, defaults to false. Draws that
+ *   overlap are never reordered relative to each other, so the result is
+ *   the same, but the order in which pixels are written may change.
+ * - `SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN`: true if the renderer
+ *   should measure the CPU and GPU time spent on each frame, reported by
+ *   SDL_GetRenderStats(), defaults to false. GPU time is only measured by
+ *   the direct3d11 renderer and by the opengl renderer when timer queries
+ *   are available.
  *
  * With the SDL GPU renderer:
  *
@@ -291,6 +301,34 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRenderer(SDL_Window *window
  *   provide DXIL shaders to SDL_GPURenderState, optional.
  * - `SDL_PROP_RENDERER_CREATE_GPU_SHADERS_MSL_BOOLEAN`: the app is able to
  *   provide MSL shaders to SDL_GPURenderState, optional.
+ * - `SDL_PROP_RENDERER_CREATE_GPU_PIPELINE_CACHE_STORAGE_POINTER`: an
+ *   SDL_Storage, usually opened with SDL_OpenUserStorage(), where the
+ *   renderer saves the set of graphics pipelines it created when it is
+ *   destroyed, and recreates them from when it is created, so they don't have
+ *   to be built the first time they're used, optional. The saved pipelines
+ *   are only used by the same version of SDL on the same GPU and driver. The
+ *   storage must stay open until the renderer is destroyed.
+ *
+ * With the direct3d11 renderer:
+ *
+ * - `SDL_PROP_RENDERER_CREATE_D3D11_FRAME_LATENCY_WAITABLE_BOOLEAN`: true if
+ *   the swap chain should be created with a frame latency waitable object,
+ *   which lets SDL_WaitForRenderPresent() block until the next frame can be
+ *   queued without adding latency, defaults to false.
+ * - `SDL_PROP_RENDERER_CREATE_D3D11_MAXIMUM_FRAME_LATENCY_NUMBER`: the
+ *   maximum number of frames that can be queued for presentation, between 1
+ *   and 16, defaults to 1.
+ *
+ * With the opengl and opengles2 renderers:
+ *
+ * - `SDL_PROP_RENDERER_CREATE_OPENGL_PROGRAM_CACHE_STORAGE_POINTER`: an
+ *   SDL_Storage, usually opened with SDL_OpenUserStorage(), where the
+ *   renderer saves the binaries of the shader programs it linked when it is
+ *   destroyed, and loads them from when it is created, so shaders don't have
+ *   to be compiled again, optional. This needs a driver that can save
+ *   program binaries, and they're only used by the same version of SDL with
+ *   the same driver. The storage must stay open until the renderer is
+ *   destroyed.
  *
  * With the vulkan renderer:
  *
@@ -328,9 +366,15 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRendererWithProperties(SDL_
 #define SDL_PROP_RENDERER_CREATE_SURFACE_POINTER                            "SDL.renderer.create.surface"
 #define SDL_PROP_RENDERER_CREATE_OUTPUT_COLORSPACE_NUMBER                   "SDL.renderer.create.output_colorspace"
 #define SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER                       "SDL.renderer.create.present_vsync"
+#define SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN                      "SDL.renderer.create.reorder_draws"
+#define SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN                         "SDL.renderer.create.gpu_timing"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_SPIRV_BOOLEAN                  "SDL.renderer.create.gpu.shaders_spirv"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_DXIL_BOOLEAN                   "SDL.renderer.create.gpu.shaders_dxil"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_MSL_BOOLEAN                    "SDL.renderer.create.gpu.shaders_msl"
+#define SDL_PROP_RENDERER_CREATE_GPU_PIPELINE_CACHE_STORAGE_POINTER        "SDL.renderer.create.gpu.pipeline_cache_storage"
+#define SDL_PROP_RENDERER_CREATE_D3D11_FRAME_LATENCY_WAITABLE_BOOLEAN       "SDL.renderer.create.d3d11.frame_latency_waitable"
+#define SDL_PROP_RENDERER_CREATE_D3D11_MAXIMUM_FRAME_LATENCY_NUMBER         "SDL.renderer.create.d3d11.maximum_frame_latency"
+#define SDL_PROP_RENDERER_CREATE_OPENGL_PROGRAM_CACHE_STORAGE_POINTER       "SDL.renderer.create.opengl.program_cache_storage"
 #define SDL_PROP_RENDERER_CREATE_VULKAN_INSTANCE_POINTER                    "SDL.renderer.create.vulkan.instance"
 #define SDL_PROP_RENDERER_CREATE_VULKAN_SURFACE_NUMBER                      "SDL.renderer.create.vulkan.surface"
 #define SDL_PROP_RENDERER_CREATE_VULKAN_PHYSICAL_DEVICE_POINTER             "SDL.renderer.create.vulkan.physical_device"
@@ -475,6 +519,11 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   with the renderer
  * - `SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER`: the IDXGISwapChain1
  *   associated with the renderer. This may change when the window is resized.
+ * - `SDL_PROP_RENDERER_D3D11_FRAME_LATENCY_WAITABLE_OBJECT_POINTER`: the
+ *   HANDLE returned by IDXGISwapChain2::GetFrameLatencyWaitableObject(), if
+ *   the renderer was created with
+ *   `SDL_PROP_RENDERER_CREATE_D3D11_FRAME_LATENCY_WAITABLE_BOOLEAN`. This may
+ *   change when the swap chain is recreated.
  *
  * With the direct3d12 renderer:
  *
@@ -531,6 +580,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
+#define SDL_PROP_RENDERER_D3D11_FRAME_LATENCY_WAITABLE_OBJECT_POINTER "SDL.renderer.d3d11.frame_latency_waitable_object"
 #define SDL_PROP_RENDERER_D3D12_DEVICE_POINTER                      "SDL.renderer.d3d12.device"
 #define SDL_PROP_RENDERER_D3D12_SWAPCHAIN_POINTER                   "SDL.renderer.d3d12.swap_chain"
 #define SDL_PROP_RENDERER_D3D12_COMMAND_QUEUE_POINTER               "SDL.renderer.d3d12.command_queue"
@@ -589,11 +639,120 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderOutputSize(SDL_Renderer *renderer,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetCurrentRenderOutputSize(SDL_Renderer *renderer, int *w, int *h);
 
+/**
+ * Set the size of the region of the window's back buffer that is rendered
+ * and presented.
+ *
+ * This lets an application render at a lower resolution than the window and
+ * have the system compositor scale the result up to fill the window, without
+ * recreating any buffers. It can be changed every frame, for dynamic
+ * resolution scaling.
+ *
+ * After this call SDL_GetRenderOutputSize() returns the new size, and the
+ * logical presentation, if any, is updated to fit it. Applications that
+ * change the source size will usually want to use
+ * SDL_SetRenderLogicalPresentation() so their drawing code doesn't need to
+ * know the current size.
+ *
+ * The size is clamped to the size of the window's back buffer. This is only
+ * supported by the direct3d11 renderer with a flip model swap chain that
+ * stretches to fit the window, as used by WinRT XAML apps.
+ *
+ * This function should be called between frames, before any rendering for
+ * the next frame.
+ *
+ * \param renderer the rendering context.
+ * \param w the width in pixels of the region to present, or 0 to present the
+ *          whole back buffer.
+ * \param h the height in pixels of the region to present, or 0 to present the
+ *          whole back buffer.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetRenderOutputSize
+ * \sa SDL_SetRenderLogicalPresentation
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderOutputSourceSize(SDL_Renderer *renderer, int w, int h);
+
+/**
+ * Set up dynamic resolution rendering for a window renderer.
+ *
+ * When this is enabled, drawing to the window is redirected to an internal
+ * target whose size is a fraction of the output size, and the result is
+ * upscaled to the full output with linear filtering when
+ * SDL_RenderDynamicResolutionUpscale() or SDL_RenderPresent() is called.
+ * SDL_GetCurrentRenderOutputSize() returns the reduced size while the scene
+ * is being drawn. Applications will usually want to use
+ * SDL_SetRenderLogicalPresentation() so their drawing code doesn't need to
+ * know the current size.
+ *
+ * If `gpu_budget_ns` is nonzero, the scale is adjusted after each frame so
+ * that the GPU time for a frame stays close to the budget, never going below
+ * `min_scale`. This requires a renderer created with
+ * `SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN` set to true. If it is zero,
+ * the scene is always rendered at `min_scale`, and applications can call
+ * this function every frame to control the scale themselves.
+ *
+ * The scale of each frame is reported in SDL_RenderStats.
+ *
+ * This function should be called between frames, before any rendering for
+ * the next frame.
+ *
+ * \param renderer the rendering context.
+ * \param min_scale the smallest fraction of the output size to render at,
+ *                  greater than 0.0 and at most 1.0. 1.0 disables dynamic
+ *                  resolution.
+ * \param gpu_budget_ns the GPU time in nanoseconds to aim for each frame, or
+ *                      0 to always render at `min_scale`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetRenderStats
+ * \sa SDL_RenderDynamicResolutionUpscale
+ * \sa SDL_SetRenderLogicalPresentation
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderDynamicResolution(SDL_Renderer *renderer, float min_scale, Uint64 gpu_budget_ns);
+
+/**
+ * Upscale the dynamic resolution scene drawn so far to the full output.
+ *
+ * Anything drawn to the window after this, until the next call to
+ * SDL_RenderPresent(), is drawn at the full output resolution. This is
+ * useful for text and user interface overlays that should stay sharp.
+ *
+ * If this isn't called, the scene is upscaled by SDL_RenderPresent(). This
+ * does nothing if dynamic resolution isn't enabled or the scene has already
+ * been upscaled this frame.
+ *
+ * \param renderer the rendering context.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetRenderDynamicResolution
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RenderDynamicResolutionUpscale(SDL_Renderer *renderer);
+
 /**
  * Create a texture for a rendering context.
  *
  * The contents of a texture when first created are not defined.
  *
+ * Block compressed formats like SDL_PIXELFORMAT_BC1 are only available if
+ * the renderer lists them in SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER. They
+ * must be static textures with a width and height that are multiples of 4.
+ *
  * \param renderer the rendering context.
  * \param format one of the enumerated values in SDL_PixelFormat.
  * \param access one of the enumerated values in SDL_TextureAccess.
@@ -642,6 +801,30 @@ extern SDL_DECLSPEC SDL_Texture * SDLCALL SDL_CreateTexture(SDL_Renderer *render
  */
 extern SDL_DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureFromSurface(SDL_Renderer *renderer, SDL_Surface *surface);
 
+/**
+ * A callback that refills an evicted texture with its pixels.
+ *
+ * Textures created with this callback may be evicted when the renderer is
+ * over its texture memory budget. When an evicted texture is drawn again,
+ * SDL recreates it and calls this callback, which should upload the texture
+ * contents with SDL_UpdateTexture(). The callback must not draw or destroy
+ * any textures.
+ *
+ * \param userdata an opaque pointer provided by the app for their personal
+ *                 use.
+ * \param texture the texture to refill.
+ * \returns true on success or false on failure; call SDL_SetError() with the
+ *          reason on failure, the draw that needed the texture fails as well.
+ *
+ * \threadsafety This callback runs on the thread that draws with the texture.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateTextureWithProperties
+ * \sa SDL_SetRenderTextureMemoryBudget
+ */
+typedef bool (SDLCALL *SDL_TextureRestoreCallback)(void *userdata, SDL_Texture *texture);
+
 /**
  * Create a texture for a rendering context with the specified properties.
  *
@@ -671,6 +854,31 @@ extern SDL_DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureFromSurface(SDL_Rende
  *   If this is defined, any values outside the range supported by the display
  *   will be scaled into the available HDR headroom, otherwise they are
  *   clipped.
+ * - `SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN`: true if the texture may be packed
+ *   into a larger texture shared with other small textures, so that drawing
+ *   many of them in a row doesn't need to switch textures. This only applies
+ *   to small static sRGB textures on renderers that draw with geometry, and
+ *   is silently ignored otherwise. A texture in an atlas always clamps its
+ *   texture coordinates, so it can't be drawn with SDL_TEXTURE_ADDRESS_WRAP,
+ *   and it can't be shared with OpenGL. Defaults to false.
+ * - `SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER`: an SDL_Surface with
+ *   the contents of the texture. The texture is filled from it when it's
+ *   created, and refilled from it if it's evicted to stay within the texture
+ *   memory budget. SDL keeps a reference to the surface until the texture is
+ *   destroyed, so its pixels shouldn't be changed. The width and height
+ *   default to the size of the surface and must match it.
+ * - `SDL_PROP_TEXTURE_CREATE_RESTORE_CALLBACK_POINTER`: an
+ *   SDL_TextureRestoreCallback that refills the texture if it's evicted to
+ *   stay within the texture memory budget.
+ * - `SDL_PROP_TEXTURE_CREATE_RESTORE_USERDATA_POINTER`: a pointer that is
+ *   passed to the restore callback.
+ *
+ * Textures with a backing surface or a restore callback can be evicted by
+ * SDL_SetRenderTextureMemoryBudget(). This only applies to static textures
+ * in a format the renderer supports directly, that aren't packed into an
+ * atlas. When a texture is evicted, the renderer's copy of it is freed, and
+ * any renderer specific properties of the texture are out of date until it's
+ * drawn or updated again.
  *
  * With the direct3d11 renderer:
  *
@@ -682,6 +890,12 @@ extern SDL_DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureFromSurface(SDL_Rende
  * - `SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_V_POINTER`: the ID3D11Texture2D
  *   associated with the V plane of a YUV texture, if you want to wrap an
  *   existing texture.
+ * - `SDL_PROP_TEXTURE_CREATE_D3D11_RESTORABLE_BOOLEAN`: true if the renderer
+ *   should keep a CPU copy of the texture contents, so the texture survives
+ *   the Direct3D device being reset instead of having to be recreated by the
+ *   application. The texture is recreated from that copy the first time it's
+ *   used after the reset. This is ignored for render targets, YUV textures
+ *   and wrapped textures, defaults to false.
  *
  * With the direct3d12 renderer:
  *
@@ -761,9 +975,14 @@ extern SDL_DECLSPEC SDL_Texture * SDLCALL SDL_CreateTextureWithProperties(SDL_Re
 #define SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER               "SDL.texture.create.height"
 #define SDL_PROP_TEXTURE_CREATE_SDR_WHITE_POINT_FLOAT       "SDL.texture.create.SDR_white_point"
 #define SDL_PROP_TEXTURE_CREATE_HDR_HEADROOM_FLOAT          "SDL.texture.create.HDR_headroom"
+#define SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN               "SDL.texture.create.atlas"
+#define SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER     "SDL.texture.create.backing_surface"
+#define SDL_PROP_TEXTURE_CREATE_RESTORE_CALLBACK_POINTER    "SDL.texture.create.restore_callback"
+#define SDL_PROP_TEXTURE_CREATE_RESTORE_USERDATA_POINTER    "SDL.texture.create.restore_userdata"
 #define SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_POINTER       "SDL.texture.create.d3d11.texture"
 #define SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_U_POINTER     "SDL.texture.create.d3d11.texture_u"
 #define SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_V_POINTER     "SDL.texture.create.d3d11.texture_v"
+#define SDL_PROP_TEXTURE_CREATE_D3D11_RESTORABLE_BOOLEAN    "SDL.texture.create.d3d11.restorable"
 #define SDL_PROP_TEXTURE_CREATE_D3D12_TEXTURE_POINTER       "SDL.texture.create.d3d12.texture"
 #define SDL_PROP_TEXTURE_CREATE_D3D12_TEXTURE_U_POINTER     "SDL.texture.create.d3d12.texture_u"
 #define SDL_PROP_TEXTURE_CREATE_D3D12_TEXTURE_V_POINTER     "SDL.texture.create.d3d12.texture_v"
@@ -1196,6 +1415,10 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetTextureScaleMode(SDL_Texture *texture, S
  * While this function will work with streaming textures, for optimization
  * reasons you may not get the pixels back if you lock the texture afterward.
  *
+ * For block compressed formats like SDL_PIXELFORMAT_BC1, the rectangle must
+ * be aligned to 4x4 blocks and the pitch is the number of bytes in a row of
+ * blocks.
+ *
  * \param texture the texture to update.
  * \param rect an SDL_Rect structure representing the area to update, or NULL
  *             to update the entire texture.
@@ -1216,6 +1439,65 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetTextureScaleMode(SDL_Texture *texture, S
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch);
 
+/**
+ * A callback that fires when an asynchronous texture update is finished with
+ * its pixel data.
+ *
+ * This callback fires once when the renderer no longer needs the pixels,
+ * allowing the app to easily free or reuse them.
+ *
+ * \param userdata an opaque pointer provided by the app for their personal
+ *                 use.
+ * \param texture the texture that was updated.
+ * \param pixels the pointer provided to SDL_UpdateTextureAsync().
+ * \param success true if the texture was updated, false if the update failed
+ *                or was cancelled because the texture was destroyed.
+ *
+ * \threadsafety This callback runs on the thread that flushes the renderer,
+ *               which is normally the main thread.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_UpdateTextureAsync
+ */
+typedef void (SDLCALL *SDL_TextureUpdateCompleteCallback)(void *userdata, SDL_Texture *texture, const void *pixels, bool success);
+
+/**
+ * Schedule an update of the given texture rectangle with new pixel data.
+ *
+ * This works like SDL_UpdateTexture(), but it doesn't upload anything right
+ * away, and it can be called from any thread. The pixels are not copied;
+ * they are uploaded the next time the renderer flushes its command queue
+ * (for example in SDL_RenderPresent() or SDL_FlushRenderer()), after any
+ * drawing that was already queued, so the pixel data must stay valid until
+ * `callback` is called.
+ *
+ * Updates of the same texture are applied in the order they were scheduled.
+ * If the texture is destroyed before the update is applied, the update is
+ * cancelled and the callback is called with `success` set to false.
+ *
+ * \param texture the texture to update.
+ * \param rect an SDL_Rect structure representing the area to update, or NULL
+ *             to update the entire texture.
+ * \param pixels the raw pixel data in the format of the texture.
+ * \param pitch the number of bytes in a row of pixel data, including padding
+ *              between lines.
+ * \param callback the function to call when the pixel data is no longer
+ *                 needed, may be NULL.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               the texture isn't being destroyed at the same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FlushRenderer
+ * \sa SDL_UpdateTexture
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_UpdateTextureAsync(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch, SDL_TextureUpdateCompleteCallback callback, void *userdata);
+
 /**
  * Update a rectangle within a planar YV12 or IYUV texture with new pixel
  * data.
@@ -2232,6 +2514,46 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenderTextureAffine(SDL_Renderer *renderer,
                                                      const SDL_FRect *srcrect, const SDL_FPoint *origin,
                                                      const SDL_FPoint *right, const SDL_FPoint *down);
 
+/**
+ * Copy many portions of a texture to the current rendering target in one
+ * call, at subpixel precision.
+ *
+ * This is equivalent to calling SDL_RenderTextureRotated() once per sprite,
+ * rotating each one around the center of its destination rectangle, but it
+ * queues all of them as a single draw. Renderers that support hardware
+ * instancing upload one small record per sprite instead of generating
+ * vertices for each of them, which makes drawing large numbers of sprites
+ * much cheaper on the CPU.
+ *
+ * Each sprite's color is multiplied with the texture color and alpha
+ * modulation, like the vertex colors in SDL_RenderGeometry().
+ *
+ * \param renderer the renderer which should copy parts of a texture.
+ * \param texture the source texture.
+ * \param srcrects an array of `count` source rectangles, or NULL to use the
+ *                 entire texture for every sprite. The rectangles are not
+ *                 clipped to the texture.
+ * \param dstrects an array of `count` destination rectangles.
+ * \param angles an array of `count` angles in degrees that indicate the
+ *               clockwise rotation applied to each destination rectangle, or
+ *               NULL to draw the sprites without rotation.
+ * \param colors an array of `count` colors for the sprites, or NULL to draw
+ *               them with the texture color and alpha modulation only.
+ * \param count the number of sprites to draw.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderTexture
+ * \sa SDL_RenderTextureRotated
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RenderTextureBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                                                    const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                                                    const double *angles, const SDL_FColor *colors, int count);
+
 /**
  * Tile a portion of the texture to the current rendering target at subpixel
  * precision.
@@ -2432,6 +2754,114 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderTextureAddressMode(SDL_Renderer *r
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderTextureAddressMode(SDL_Renderer *renderer, SDL_TextureAddressMode *u_mode, SDL_TextureAddressMode *v_mode);
 
+/**
+ * An opaque handle to a recorded sequence of draws.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderList
+ */
+typedef struct SDL_RenderList SDL_RenderList;
+
+/**
+ * Create a list that draws can be recorded into and replayed from.
+ *
+ * Drawing that doesn't change from frame to frame, like HUD frames and menus,
+ * can be recorded once and replayed every frame with SDL_ReplayRenderList(),
+ * which skips the per-draw work of queuing commands and transforming
+ * vertices.
+ *
+ * Render lists are freed with the renderer, after which they can't be
+ * replayed, but they must still be passed to SDL_DestroyRenderList().
+ *
+ * \param renderer the rendering context.
+ * \returns a new, empty render list on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginRenderList
+ * \sa SDL_DestroyRenderList
+ */
+extern SDL_DECLSPEC SDL_RenderList * SDLCALL SDL_CreateRenderList(SDL_Renderer *renderer);
+
+/**
+ * Start recording draws into a render list.
+ *
+ * Any previous contents of the list are discarded. Until
+ * SDL_EndRenderList() is called, the renderer's drawing functions record
+ * into the list instead of drawing. Drawing queued before this call is
+ * flushed to the current render target first.
+ *
+ * The list captures the draw color, blend modes, viewport, clip rectangle
+ * and scale in effect as each draw is recorded. The draws are replayed
+ * exactly as recorded, so a list should be recorded again if the output size
+ * changes. Destroying a texture used by the list empties it.
+ *
+ * Clearing and presenting shouldn't be done while recording.
+ *
+ * \param list the render list to record into.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EndRenderList
+ * \sa SDL_ReplayRenderList
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BeginRenderList(SDL_RenderList *list);
+
+/**
+ * Stop recording draws into a render list.
+ *
+ * \param list the render list being recorded.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginRenderList
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EndRenderList(SDL_RenderList *list);
+
+/**
+ * Draw the contents of a render list to the current render target.
+ *
+ * The recorded draws are queued in one step, offset by the given amount.
+ *
+ * \param list the render list to draw.
+ * \param x the horizontal offset to draw the list at, in render coordinates.
+ * \param y the vertical offset to draw the list at, in render coordinates.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginRenderList
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReplayRenderList(SDL_RenderList *list, float x, float y);
+
+/**
+ * Free a render list.
+ *
+ * \param list the render list to free, may be NULL.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderList
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyRenderList(SDL_RenderList *list);
+
 /**
  * Read pixels from the current rendering target.
  *
@@ -2459,6 +2889,108 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderTextureAddressMode(SDL_Renderer *r
  */
 extern SDL_DECLSPEC SDL_Surface * SDLCALL SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect);
 
+/**
+ * An opaque handle to a pending read of rendered pixels.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderReadPixelsAsync
+ */
+typedef struct SDL_RenderReadback SDL_RenderReadback;
+
+/**
+ * Start reading pixels from the current rendering target without waiting for
+ * them.
+ *
+ * This works like SDL_RenderReadPixels(), but instead of stalling until the
+ * GPU has finished drawing, it queues a copy of the pixels and returns right
+ * away. Call SDL_IsRenderReadbackReady() to check whether the copy has
+ * finished, and SDL_CollectRenderReadback() to get the pixels. Collecting the
+ * pixels a frame or two later usually avoids waiting on the GPU entirely,
+ * which makes this suitable for capturing every frame.
+ *
+ * The pixels are read at this point in the command stream, so later drawing
+ * doesn't affect them. If you're using this on the main rendering target, it
+ * should be called after rendering and before SDL_RenderPresent().
+ *
+ * Renderers that can't read asynchronously read the pixels right away, in
+ * which case the readback is ready immediately.
+ *
+ * Every readback must be passed to either SDL_CollectRenderReadback() or
+ * SDL_CancelRenderReadback(), even after the renderer is destroyed.
+ *
+ * \param renderer the rendering context.
+ * \param rect an SDL_Rect structure representing the area to read, which will
+ *             be clipped to the current viewport, or NULL for the entire
+ *             viewport.
+ * \returns a new readback handle on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CancelRenderReadback
+ * \sa SDL_CollectRenderReadback
+ * \sa SDL_IsRenderReadbackReady
+ * \sa SDL_RenderReadPixels
+ */
+extern SDL_DECLSPEC SDL_RenderReadback * SDLCALL SDL_RenderReadPixelsAsync(SDL_Renderer *renderer, const SDL_Rect *rect);
+
+/**
+ * Check whether the pixels of a readback are available.
+ *
+ * This never waits on the GPU.
+ *
+ * \param readback the readback to check.
+ * \returns true if SDL_CollectRenderReadback() will return without waiting,
+ *          false otherwise.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CollectRenderReadback
+ * \sa SDL_RenderReadPixelsAsync
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_IsRenderReadbackReady(SDL_RenderReadback *readback);
+
+/**
+ * Get the pixels of a readback and free it.
+ *
+ * If the readback isn't ready yet, this waits for the GPU to finish the copy.
+ *
+ * The readback is freed whether or not this succeeds, and must not be used
+ * afterwards. If the renderer was destroyed before the pixels were collected,
+ * this fails.
+ *
+ * \param readback the readback to collect.
+ * \returns a new SDL_Surface on success or NULL on failure; call
+ *          SDL_GetError() for more information. The surface should be freed
+ *          with SDL_DestroySurface().
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_IsRenderReadbackReady
+ * \sa SDL_RenderReadPixelsAsync
+ */
+extern SDL_DECLSPEC SDL_Surface * SDLCALL SDL_CollectRenderReadback(SDL_RenderReadback *readback);
+
+/**
+ * Free a readback without reading its pixels.
+ *
+ * \param readback the readback to free, may be NULL.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderReadPixelsAsync
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_CancelRenderReadback(SDL_RenderReadback *readback);
+
 /**
  * Update the screen with any rendering performed since the previous call.
  *
@@ -2508,6 +3040,70 @@ extern SDL_DECLSPEC SDL_Surface * SDLCALL SDL_RenderReadPixels(SDL_Renderer *ren
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_RenderPresent(SDL_Renderer *renderer);
 
+/**
+ * Set the regions of the backbuffer that changed for the next present.
+ *
+ * If your application only updates a small part of the screen each frame,
+ * you can tell SDL which areas changed, and renderers that support it will
+ * only ask the system compositor to update those areas, saving GPU time and
+ * power. The direct3d11 renderer passes these to IDXGISwapChain1::Present1()
+ * when using a flip model swap chain.
+ *
+ * When a renderer uses the dirty rectangles, the contents of the backbuffer
+ * outside of them are kept from the previous frame, so you must not clear
+ * the whole backbuffer, and every pixel you changed must be inside one of
+ * the rectangles. Renderers that don't support partial presentation ignore
+ * this and present the whole backbuffer, so this is purely an optimization.
+ *
+ * The rectangles are in pixels relative to the output size of the renderer,
+ * see SDL_GetRenderOutputSize(), and are reset after the next call to
+ * SDL_RenderPresent().
+ *
+ * \param renderer the rendering context.
+ * \param rects an array of SDL_Rect structures representing the changed
+ *              regions, may be NULL if `count` is 0.
+ * \param count the number of rectangles, or 0 to present the whole
+ *              backbuffer.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderPresent
+ * \sa SDL_SetRenderScrollRect
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderDirtyRects(SDL_Renderer *renderer, const SDL_Rect *rects, int count);
+
+/**
+ * Set a region of the backbuffer that was scrolled for the next present.
+ *
+ * This tells renderers that support it that the contents of `rect` were
+ * produced by moving the contents of the previous frame by `offset`, so the
+ * system compositor can reuse them. The newly exposed part of the region
+ * should be covered by the dirty rectangles set with
+ * SDL_SetRenderDirtyRects().
+ *
+ * The scroll rectangle is in pixels relative to the output size of the
+ * renderer and is reset after the next call to SDL_RenderPresent().
+ *
+ * \param renderer the rendering context.
+ * \param rect the destination rectangle of the scrolled region, or NULL to
+ *             clear it.
+ * \param offset the distance the region moved from the previous frame.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderPresent
+ * \sa SDL_SetRenderDirtyRects
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderScrollRect(SDL_Renderer *renderer, const SDL_Rect *rect, const SDL_Point *offset);
+
 /**
  * Destroy the specified texture.
  *
@@ -2574,6 +3170,91 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer *renderer);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_FlushRenderer(SDL_Renderer *renderer);
 
+/**
+ * Statistics about the work a renderer did for a frame.
+ *
+ * The draw call and state change counts are filled in by the render backend
+ * while it runs the command queue. Backends that don't cache GPU state, like
+ * the software renderer, only report draw calls.
+ *
+ * The timings are only measured if the renderer was created with
+ * `SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN` set. GPU timing results are
+ * read back a few frames after they're issued so the CPU never waits on the
+ * GPU, so `gpu_time_ns` is the GPU time of a recent frame rather than the
+ * last one.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetRenderStats
+ */
+typedef struct SDL_RenderStats
+{
+    int commands;               /**< The number of render commands queued, including state changes */
+    int draw_calls;             /**< The number of draw calls the backend issued */
+    int state_changes;          /**< The number of render state changes (blend mode, shader, texture, viewport, clipping and so on) the backend applied */
+    int state_changes_skipped;  /**< The number of render state changes the backend skipped because the state was already set */
+    Uint64 vertex_bytes;        /**< The number of bytes of vertex data queued */
+    Uint64 texture_upload_bytes; /**< The number of bytes of pixel data uploaded to textures */
+    Uint64 cpu_time_ns;         /**< The CPU time in nanoseconds spent running the command queue and presenting, or 0 if timing is disabled */
+    Uint64 gpu_time_ns;         /**< The GPU time in nanoseconds spent on the most recent frame whose timing results were available, or 0 if GPU timing isn't available */
+    bool throttled;             /**< true if the frame wasn't presented because the window couldn't be seen, see SDL_HINT_RENDER_THROTTLE_OCCLUDED */
+    float resolution_scale;     /**< The fraction of the output size the scene was drawn at, 1.0 unless dynamic resolution is enabled, see SDL_SetRenderDynamicResolution() */
+    Uint64 texture_memory;      /**< The estimated number of bytes used by the renderer's textures when the frame was presented */
+    int textures_evicted;       /**< The number of textures evicted to stay within the texture memory budget, see SDL_SetRenderTextureMemoryBudget() */
+    int textures_restored;      /**< The number of evicted textures that were recreated because they were used again */
+} SDL_RenderStats;
+
+/**
+ * Get statistics about the last frame that was presented.
+ *
+ * The statistics are collected from one call to SDL_RenderPresent() to the
+ * next, so this returns the work that went into the frame most recently
+ * presented. They are all zero before the first frame is presented.
+ *
+ * \param renderer the rendering context.
+ * \param stats a pointer filled in with the statistics of the last frame.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderPresent
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderStats(SDL_Renderer *renderer, SDL_RenderStats *stats);
+
+/**
+ * Limit the estimated memory used by a renderer's textures.
+ *
+ * When the textures of the renderer use more than `bytes`, the ones that
+ * were drawn least recently are evicted until they fit again. Only textures
+ * created with `SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER` or
+ * `SDL_PROP_TEXTURE_CREATE_RESTORE_CALLBACK_POINTER` can be evicted, and
+ * textures used by drawing that hasn't been flushed yet are kept. An evicted
+ * texture is recreated and refilled the next time it's drawn or updated.
+ *
+ * With a budget set, SDL also evicts textures and tries again when the
+ * renderer fails to create a texture, which usually means it ran out of
+ * memory.
+ *
+ * The memory use of each texture is estimated from its size and format, and
+ * the current total is reported in SDL_RenderStats.
+ *
+ * \param renderer the rendering context.
+ * \param bytes the number of bytes textures may use, or 0 for no limit.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateTextureWithProperties
+ * \sa SDL_GetRenderStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderTextureMemoryBudget(SDL_Renderer *renderer, Uint64 bytes);
+
 /**
  * Get the CAMetalLayer associated with the given Metal renderer.
  *
@@ -2646,6 +3327,96 @@ extern SDL_DECLSPEC void * SDLCALL SDL_GetRenderMetalCommandEncoder(SDL_Renderer
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_AddVulkanRenderSemaphores(SDL_Renderer *renderer, Uint32 wait_stage_mask, Sint64 wait_semaphore, Sint64 signal_semaphore);
 
+/**
+ * Share a texture with the current OpenGL context.
+ *
+ * This makes the texture's contents available to OpenGL without copying
+ * them through system memory, so an app can render into a texture with
+ * OpenGL and then draw it with the renderer, or the other way around. This
+ * is currently supported by the direct3d11 renderer, when the OpenGL driver
+ * supports WGL_NV_DX_interop2.
+ *
+ * OpenGL may only use the texture between calls to SDL_AcquireTextureForGL()
+ * and SDL_ReleaseTextureForGL(), and the renderer can't draw with it or into
+ * it during that time.
+ *
+ * Sharing the same texture again returns the same OpenGL texture name. The
+ * texture stops being shared when SDL_UnshareTextureWithGL() is called, when
+ * the texture is destroyed, or when the render device is reset.
+ *
+ * YUV textures can't be shared.
+ *
+ * \param texture the texture to share.
+ * \param gl_texture a pointer filled in with the name of the GL_TEXTURE_2D
+ *                   texture that aliases the texture.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread,
+ *               with the OpenGL context that will use the texture current.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireTextureForGL
+ * \sa SDL_ReleaseTextureForGL
+ * \sa SDL_UnshareTextureWithGL
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ShareTextureWithGL(SDL_Texture *texture, Uint32 *gl_texture);
+
+/**
+ * Hand a shared texture over to OpenGL.
+ *
+ * Any rendering already queued with the texture is submitted before OpenGL
+ * gets access to it, so OpenGL sees the results.
+ *
+ * \param texture the texture to acquire, shared with SDL_ShareTextureWithGL().
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReleaseTextureForGL
+ * \sa SDL_ShareTextureWithGL
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_AcquireTextureForGL(SDL_Texture *texture);
+
+/**
+ * Hand a shared texture back to the renderer.
+ *
+ * Any OpenGL commands using the texture are complete before the renderer uses
+ * it again.
+ *
+ * \param texture the texture to release, acquired with
+ *                SDL_AcquireTextureForGL().
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireTextureForGL
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReleaseTextureForGL(SDL_Texture *texture);
+
+/**
+ * Stop sharing a texture with OpenGL.
+ *
+ * The OpenGL texture name returned by SDL_ShareTextureWithGL() is deleted.
+ * If the texture is acquired by OpenGL, it is released first.
+ *
+ * \param texture the texture to stop sharing.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ShareTextureWithGL
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnshareTextureWithGL(SDL_Texture *texture);
+
 /**
  * Toggle VSync of the given renderer.
  *
@@ -2691,6 +3462,36 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderVSync(SDL_Renderer *renderer, int
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderVSync(SDL_Renderer *renderer, int *vsync);
 
+/**
+ * Wait until the renderer is ready to accept a new frame.
+ *
+ * For the lowest input latency, call this at the top of your frame, before
+ * you process input and build the frame, so the frame is rendered with the
+ * freshest input possible and presented without being queued behind older
+ * frames.
+ *
+ * This only blocks if the renderer was created with a frame latency
+ * waitable swap chain, e.g. with
+ * `SDL_PROP_RENDERER_CREATE_D3D11_FRAME_LATENCY_WAITABLE_BOOLEAN` on the
+ * direct3d11 renderer. Other renderers return true immediately and throttle
+ * inside SDL_RenderPresent() as before.
+ *
+ * \param renderer the rendering context.
+ * \param timeoutMS the maximum number of milliseconds to wait, or -1 to wait
+ *                  indefinitely.
+ * \returns true if the renderer is ready for a new frame or false if the
+ *          timeout elapsed or there was an error; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRendererWithProperties
+ * \sa SDL_RenderPresent
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WaitForRenderPresent(SDL_Renderer *renderer, Sint32 timeoutMS);
+
 /**
  * The size, in pixels, of a single SDL_RenderDebugText() character.
  *
@@ -141,6 +141,22 @@ typedef enum SDL_SensorType
     SDL_SENSOR_GYRO_R           /**< Gyroscope for right Joy-Con controller */
 } SDL_SensorType;
 
+/**
+ * A single sensor reading, as returned by SDL_GetSensorSamples() and
+ * SDL_GetGamepadSensorSamples().
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetSensorSamples
+ * \sa SDL_GetGamepadSensorSamples
+ */
+typedef struct SDL_SensorSample
+{
+    Uint64 timestamp;        /**< In nanoseconds, populated using SDL_GetTicksNS() */
+    Uint64 sensor_timestamp; /**< The timestamp of the sensor reading in nanoseconds, not necessarily synchronized with the system clock */
+    float data[6];           /**< Up to 6 values from the sensor, unused values are 0 */
+} SDL_SensorSample;
+
 
 /* Function prototypes */
 
@@ -286,6 +302,31 @@ extern SDL_DECLSPEC SDL_SensorID SDLCALL SDL_GetSensorID(SDL_Sensor *sensor);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetSensorData(SDL_Sensor *sensor, float *data, int num_values);
 
+/**
+ * Get the sensor readings received since the last call.
+ *
+ * This lets applications process every reading from high rate sensors in one
+ * call, instead of handling an SDL_EVENT_SENSOR_UPDATE event for each one.
+ * Applications that only use this can turn those events off with
+ * SDL_SetEventEnabled().
+ *
+ * Readings are collected starting from the first call to this function, so
+ * the first call always returns 0. They are returned oldest first, and any
+ * readings that don't fit in `samples` are kept for the next call. If
+ * readings aren't retrieved often enough, the oldest ones are discarded.
+ *
+ * \param sensor the SDL_Sensor object to query.
+ * \param samples an array filled with the sensor readings.
+ * \param num_samples the maximum number of readings to write to samples.
+ * \returns the number of readings written to samples, or -1 on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetSensorData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetSensorSamples(SDL_Sensor *sensor, SDL_SensorSample *samples, int num_samples);
+
 /**
  * Close a sensor previously opened with SDL_OpenSensor().
  *
@@ -1612,6 +1612,120 @@ extern SDL_DECLSPEC void SDLCALL SDL_aligned_free(void *mem);
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * Statistics about SDL's per-thread cache of small allocations.
+ *
+ * When SDL uses its own allocator instead of the C runtime's, small
+ * allocations are served from a cache kept by each thread, which is refilled
+ * from and returned to the shared heap in batches.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryCacheStats
+ */
+typedef struct SDL_MemoryCacheStats
+{
+    Uint64 hits;    /**< the number of small allocations served straight from a thread's cache */
+    Uint64 refills; /**< the number of batches of blocks taken from the shared heap */
+    Uint64 flushes; /**< the number of times a thread returned blocks to the shared heap */
+    Uint64 large;   /**< the number of allocations too big for the cache */
+} SDL_MemoryCacheStats;
+
+/**
+ * Get statistics about SDL's per-thread cache of small allocations.
+ *
+ * Each thread counts cache hits locally and adds them to the totals when it
+ * next refills or flushes its cache, so numbers from other threads may lag
+ * behind a little. The calling thread's numbers are always up to date.
+ *
+ * The cache only counts allocations made through SDL's original memory
+ * functions, see SDL_GetOriginalMemoryFunctions().
+ *
+ * \param stats a pointer filled in with the statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. This fails if SDL was built to use the C runtime's
+ *          allocator, or on platforms without the cache.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetMemoryCacheStats(SDL_MemoryCacheStats *stats);
+
+/**
+ * The subsystems that SDL's internal memory use is counted under.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryTagStats
+ */
+typedef enum SDL_MemoryTag
+{
+    SDL_MEMORY_TAG_AUDIO,       /**< audio stream queues and conversion buffers */
+    SDL_MEMORY_TAG_RENDER,      /**< render command and vertex buffers */
+    SDL_MEMORY_TAG_SURFACE,     /**< surface pixels */
+    SDL_MEMORY_TAG_EVENTS,      /**< event queue entries */
+    SDL_MEMORY_TAG_PROPERTIES,  /**< property groups, values and names */
+    SDL_MEMORY_TAG_AUDIO_POOL,  /**< idle audio blocks kept for reuse, see SDL_HINT_AUDIO_CHUNK_POOL_SIZE */
+    SDL_MEMORY_TAG_SURFACE_POOL, /**< idle surface pixels kept for reuse, see SDL_HINT_SURFACE_POOL_SIZE */
+    SDL_MEMORY_TAG_COUNT        /**< the number of tags, not a valid tag */
+} SDL_MemoryTag;
+
+/**
+ * Memory use counted under one SDL_MemoryTag.
+ *
+ * These are only recorded when SDL is built with the `SDL_MEMORY_STATS` CMake
+ * option. Only the bytes SDL asked for are counted, not allocator overhead.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryTagStats
+ */
+typedef struct SDL_MemoryTagStats
+{
+    Uint64 bytes;             /**< the number of bytes currently allocated */
+    Uint64 peak_bytes;        /**< the most bytes allocated at once since the last reset */
+    Uint64 allocations;       /**< the number of blocks currently allocated */
+    Uint64 total_allocations; /**< the number of blocks allocated since the last reset */
+} SDL_MemoryTagStats;
+
+/**
+ * Get how much memory SDL is using for one of its subsystems.
+ *
+ * This requires SDL to be built with the `SDL_MEMORY_STATS` CMake option,
+ * which keeps a count next to SDL's larger internal allocations, like audio
+ * queue chunks, render buffers and surface pixels. Memory that an application
+ * hands to SDL, like surfaces created with SDL_CreateSurfaceFrom(), isn't
+ * counted.
+ *
+ * \param tag the subsystem to query.
+ * \param stats a pointer filled in with the statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. This fails if SDL was built without memory
+ *          statistics.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ResetMemoryTagStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetMemoryTagStats(SDL_MemoryTag tag, SDL_MemoryTagStats *stats);
+
+/**
+ * Reset the peak and total counts of memory statistics for all tags.
+ *
+ * Each peak is set to the number of bytes currently allocated, and the totals
+ * are set to 0. The current counts are kept.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryTagStats
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetMemoryTagStats(void);
+
 /**
  * A thread-safe set of environment variables
  *
@@ -2079,6 +2193,66 @@ extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t si
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
+/**
+ * The type of the key used by SDL_SortByKey().
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SortByKey
+ */
+typedef enum SDL_SortKeyType
+{
+    SDL_SORTKEY_UINT32,     /**< Uint32 */
+    SDL_SORTKEY_SINT32,     /**< Sint32 */
+    SDL_SORTKEY_UINT64,     /**< Uint64 */
+    SDL_SORTKEY_SINT64,     /**< Sint64 */
+    SDL_SORTKEY_FLOAT,      /**< float */
+    SDL_SORTKEY_DOUBLE      /**< double */
+} SDL_SortKeyType;
+
+/**
+ * Sort an array in increasing order of a numeric key in each element.
+ *
+ * This doesn't call a compare function, and uses a radix sort for larger
+ * arrays, so it is much faster than SDL_qsort() for the common case of
+ * sorting by a single number.
+ *
+ * The sort is stable: elements with equal keys keep their original order.
+ * Negative floating point keys sort before positive ones, and -0.0 sorts
+ * before 0.0. NaN keys sort after infinity, or before negative infinity if
+ * the sign bit is set.
+ *
+ * For example:
+ *
+ * ```c
+ * typedef struct {
+ *     SDL_Texture *texture;
+ *     float depth;
+ * } sprite;
+ *
+ * sprite sprites[1000];
+ *
+ * SDL_SortByKey(sprites, SDL_arraysize(sprites), sizeof(sprites[0]), offsetof(sprite, depth), SDL_SORTKEY_FLOAT);
+ * ```
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param key_offset the offset of the key from the start of each element,
+ *                   the key doesn't need to be aligned.
+ * \param key_type the type of the key.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. If a temporary buffer can't be allocated the array is
+ *          left unchanged.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_qsort
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SortByKey(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type);
+
 /**
  * Compute the absolute value of `x`.
  *
@@ -4439,6 +4613,66 @@ extern SDL_DECLSPEC float SDLCALL SDL_randf_r(Uint64 *state);
  */
 extern SDL_DECLSPEC Uint32 SDLCALL SDL_rand_bits_r(Uint64 *state);
 
+/**
+ * Fill a buffer with pseudo-random bits.
+ *
+ * This is much faster than calling SDL_rand_bits_r() for each value. The
+ * values come from a counter-based generator (Philox4x32-10) keyed by the
+ * state, so they are not the same values that SDL_rand_bits_r() would
+ * return, but they depend only on the state and count and are the same on
+ * every platform. The state is advanced by one step, as if
+ * SDL_rand_bits_r() had been called once.
+ *
+ * There are no guarantees as to the quality of the random sequence produced,
+ * and this should not be used for security (cryptography, passwords) or where
+ * money is on the line (loot-boxes, casinos). There are many random number
+ * libraries available with different characteristics and you should pick one
+ * of those to meet any serious needs.
+ *
+ * \param state a pointer to the current random number state, this may not be
+ *              NULL.
+ * \param values a pointer to the buffer to fill.
+ * \param count the number of values to generate.
+ *
+ * \threadsafety This function is thread-safe, as long as the state pointer
+ *               isn't shared between threads.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_rand_bits_r
+ * \sa SDL_randf_fill_r
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_rand_fill_r(Uint64 *state, Uint32 *values, size_t count);
+
+/**
+ * Fill a buffer with uniform pseudo-random floating point numbers less than
+ * 1.0.
+ *
+ * This generates the same bits as SDL_rand_fill_r() with the same state, and
+ * converts them the same way SDL_randf_r() does.
+ *
+ * There are no guarantees as to the quality of the random sequence produced,
+ * and this should not be used for security (cryptography, passwords) or where
+ * money is on the line (loot-boxes, casinos). There are many random number
+ * libraries available with different characteristics and you should pick one
+ * of those to meet any serious needs.
+ *
+ * \param state a pointer to the current random number state, this may not be
+ *              NULL.
+ * \param values a pointer to the buffer to fill with values in the range of
+ *               [0.0, 1.0).
+ * \param count the number of values to generate.
+ *
+ * \threadsafety This function is thread-safe, as long as the state pointer
+ *               isn't shared between threads.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_rand_fill_r
+ * \sa SDL_randf_r
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_randf_fill_r(Uint64 *state, float *values, size_t count);
+
 #ifndef SDL_PI_D
 
 /**
@@ -338,6 +338,9 @@ typedef struct SDL_Storage SDL_Storage;
  * When the path override is not provided, the generic implementation will use
  * the output of SDL_GetBasePath as the base path.
  *
+ * If the path override names a file rather than a directory, it is opened as
+ * a pack file with SDL_OpenPackStorage().
+ *
  * \param override a path to override the backend's default title root.
  * \param props a property list that may contain backend-specific information.
  * \returns a title storage container on success or NULL on failure; call
@@ -347,6 +350,7 @@ typedef struct SDL_Storage SDL_Storage;
  *
  * \sa SDL_CloseStorage
  * \sa SDL_GetStorageFileSize
+ * \sa SDL_OpenPackStorage
  * \sa SDL_OpenUserStorage
  * \sa SDL_ReadStorageFile
  */
@@ -402,6 +406,50 @@ extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenUserStorage(const char *org, c
  */
 extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenFileStorage(const char *path);
 
+/**
+ * Opens up a read-only container for a pack file.
+ *
+ * A pack file holds a whole tree of files in one archive, with an index that
+ * is loaded into memory when the pack is opened. Enumerating directories,
+ * globbing and getting path information are answered from the index without
+ * touching the filesystem, which makes scanning large asset trees fast on
+ * platforms with slow file access. The pack is memory mapped when possible,
+ * so reading a file is a copy out of the mapping.
+ *
+ * A pack file is laid out as follows, with all numbers in little-endian byte
+ * order:
+ *
+ * - The 32 byte header: the 8 bytes "SDL_PACK", a Uint32 version which must
+ *   be 1, a Uint32 entry count, a Uint64 offset of the index from the start
+ *   of the file, and a Uint64 size of the name table.
+ * - The index: one 32 byte entry per file, holding a Uint64 offset of the
+ *   file data from the start of the pack, a Uint64 size of the stored data, a
+ *   Uint64 size of the file, a Uint32 offset of the file's name in the name
+ *   table, and a Uint32 compression method.
+ * - The name table, right after the index: the null-terminated paths of the
+ *   files, using '/' separators and no leading '/'.
+ *
+ * The index must be sorted by path, comparing bytes as unsigned values, and
+ * each path may only appear once. Directories are implied by the paths of the
+ * files in them. The compression method is 0 for data that is stored as-is,
+ * or 1 for data compressed as a single LZ4 block.
+ *
+ * \param file the path of the pack file.
+ * \returns a pack storage container on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CloseStorage
+ * \sa SDL_EnumerateStorageDirectory
+ * \sa SDL_GlobStorageDirectory
+ * \sa SDL_OpenTitleStorage
+ * \sa SDL_ReadStorageFile
+ */
+extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenPackStorage(const char *file);
+
 /**
  * Opens up a container using a client-provided storage interface.
  *
@@ -596,6 +644,10 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenameStoragePath(SDL_Storage *storage, con
 /**
  * Copy a file in a writable storage container.
  *
+ * Storage containers in the filesystem let the system copy the file. Those
+ * that can't copy files themselves have the whole file read into memory and
+ * written back out.
+ *
  * \param storage a storage container.
  * \param oldpath the old path.
  * \param newpath the new path.
@@ -674,9 +726,42 @@ extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetStorageSpaceRemaining(SDL_Storage *sto
  *               the `storage` object is thread-safe.
  *
  * \since This function is available since SDL 3.2.0.
+ *
+ * \sa SDL_SetStorageDirectoryCaching
  */
 extern SDL_DECLSPEC char ** SDLCALL SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count);
 
+/**
+ * Set whether a storage container keeps an index of the directories it has
+ * globbed.
+ *
+ * Globbing a large tree lists every directory the pattern could reach, which
+ * can be slow when it happens often. With caching enabled, the first
+ * SDL_GlobStorageDirectory() call on a directory keeps its listing in memory
+ * and later globs are answered from it.
+ *
+ * Changes made through this storage container throw the cached listings
+ * away. Storage containers that live in the filesystem also watch their
+ * directories for changes made by anything else, on platforms that support
+ * it. Elsewhere, those changes are not seen until caching is turned off and
+ * on again.
+ *
+ * Disabling caching frees the cached listings. Caching is off by default.
+ *
+ * \param storage a storage container.
+ * \param enabled true to cache directory listings, false to stop.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, assuming
+ *               the `storage` object is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GlobStorageDirectory
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetStorageDirectoryCaching(SDL_Storage *storage, bool enabled);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
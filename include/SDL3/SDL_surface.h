@@ -237,6 +237,12 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroySurface(SDL_Surface *surface);
  *   left edge of the image, if this surface is being used as a cursor.
  * - `SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER`: the hotspot pixel offset from the
  *   top edge of the image, if this surface is being used as a cursor.
+ * - `SDL_PROP_SURFACE_D3D11_TEXTURE_POINTER`: the ID3D11Texture2D holding the
+ *   image, if this surface is a camera frame that was delivered in GPU
+ *   memory. It can be passed to SDL_CreateTextureWithProperties() as
+ *   `SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_POINTER` and is only valid until
+ *   the frame is released with SDL_ReleaseCameraFrame(). The surface's pixels
+ *   may be NULL in this case. (since SDL 3.4.0)
  *
  * \param surface the SDL_Surface structure to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -253,6 +259,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSurfaceProperties(SDL_Surfac
 #define SDL_PROP_SURFACE_TONEMAP_OPERATOR_STRING "SDL.surface.tonemap"
 #define SDL_PROP_SURFACE_HOTSPOT_X_NUMBER        "SDL.surface.hotspot.x"
 #define SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER        "SDL.surface.hotspot.y"
+#define SDL_PROP_SURFACE_D3D11_TEXTURE_POINTER   "SDL.surface.d3d11.texture"
 
 /**
  * Set the colorspace used by a surface.
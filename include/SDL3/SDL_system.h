@@ -680,6 +680,60 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetWinRTFSPath(SDL_WinRT_Path pathT
  */
 extern SDL_DECLSPEC SDL_WinRT_DeviceFamily SDLCALL SDL_GetWinRTDeviceFamily();
 
+/**
+ * Global properties recording a WinRT app's startup timeline.
+ *
+ * These are only set when SDL_HINT_WINRT_STARTUP_TIMELINE is enabled. Each
+ * one holds the SDL_GetTicksNS() value at which a stage was first reached,
+ * and is unset if the stage hasn't been reached yet.
+ *
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_INITIALIZE_NUMBER`: the app's
+ *   IFrameworkView::Initialize() was called.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_SET_WINDOW_NUMBER`: the app's
+ *   IFrameworkView::SetWindow() was called.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_LOAD_NUMBER`: the app's
+ *   IFrameworkView::Load() was called.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_RUN_NUMBER`: the app's
+ *   IFrameworkView::Run() was called, just before the app's main function
+ *   starts.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_VIDEO_INIT_NUMBER`: the WinRT video driver
+ *   started initializing.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_INIT_MODES_NUMBER`: the WinRT video driver
+ *   started enumerating displays.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_ADAPTERS_ENUMERATED_NUMBER`: all DXGI
+ *   adapters and their outputs have been enumerated.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_DEVICE_CREATED_NUMBER`: a Direct3D device
+ *   or OpenGL context was created.
+ * - `SDL_PROP_GLOBAL_WINRT_STARTUP_FIRST_PRESENT_NUMBER`: a frame was
+ *   presented successfully.
+ *
+ * \since These properties are available since SDL 3.4.0.
+ */
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_INITIALIZE_NUMBER             "SDL.winrt.startup.initialize"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_SET_WINDOW_NUMBER             "SDL.winrt.startup.set_window"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_LOAD_NUMBER                   "SDL.winrt.startup.load"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_RUN_NUMBER                    "SDL.winrt.startup.run"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_VIDEO_INIT_NUMBER             "SDL.winrt.startup.video_init"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_INIT_MODES_NUMBER             "SDL.winrt.startup.init_modes"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_ADAPTERS_ENUMERATED_NUMBER    "SDL.winrt.startup.adapters_enumerated"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_DEVICE_CREATED_NUMBER         "SDL.winrt.startup.device_created"
+#define SDL_PROP_GLOBAL_WINRT_STARTUP_FIRST_PRESENT_NUMBER          "SDL.winrt.startup.first_present"
+
+/**
+ * A global property that lets WinRT camera frames stay in GPU memory.
+ *
+ * - `SDL_PROP_GLOBAL_WINRT_CAMERA_D3D11_DEVICE_POINTER`: an ID3D11Device that
+ *   cameras opened afterwards should deliver their frames on, usually the
+ *   renderer's `SDL_PROP_RENDERER_D3D11_DEVICE_POINTER`. When this is set and
+ *   a camera is opened with one of its native formats, frames carry
+ *   `SDL_PROP_SURFACE_D3D11_TEXTURE_POINTER` and can be wrapped in an
+ *   SDL_Texture without being copied through system memory. SDL enables
+ *   multithread protection on the device.
+ *
+ * \since This property is available since SDL 3.4.0.
+ */
+#define SDL_PROP_GLOBAL_WINRT_CAMERA_D3D11_DEVICE_POINTER           "SDL.winrt.camera.d3d11.device"
+
 #endif /* SDL_PLATFORM_WINRT */
 
 /**
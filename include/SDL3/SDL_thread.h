@@ -114,6 +114,27 @@ typedef enum SDL_ThreadPriority {
     SDL_THREAD_PRIORITY_TIME_CRITICAL
 } SDL_ThreadPriority;
 
+/**
+ * The kind of CPU core that a thread would prefer to run on.
+ *
+ * Some CPUs mix fast "performance" cores with slower, more power efficient
+ * "efficiency" cores. A thread can ask to be kept on one kind or the other
+ * with SDL_SetCurrentThreadCoreClass() or
+ * `SDL_PROP_THREAD_CREATE_CORE_CLASS_NUMBER`.
+ *
+ * On CPUs where all the cores are the same, every core is in both classes.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetCurrentThreadCoreClass
+ */
+typedef enum SDL_ThreadCoreClass
+{
+    SDL_THREAD_CORE_CLASS_ANY,          /**< Let the system decide where the thread runs */
+    SDL_THREAD_CORE_CLASS_PERFORMANCE,  /**< Prefer the fastest cores */
+    SDL_THREAD_CORE_CLASS_EFFICIENCY    /**< Prefer the most power efficient cores */
+} SDL_ThreadCoreClass;
+
 /**
  * The SDL thread state.
  *
@@ -229,6 +250,13 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThread(SDL_ThreadFunction fn,
  *   only parameter. Optional, defaults to NULL.
  * - `SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER`: the size, in bytes, of the new
  *   thread's stack. Optional, defaults to 0 (system-defined default).
+ * - `SDL_PROP_THREAD_CREATE_AFFINITY_NUMBER`: a mask of the logical CPUs
+ *   that the new thread may run on, as used by
+ *   SDL_SetCurrentThreadAffinity(). Optional, defaults to 0 (any CPU).
+ * - `SDL_PROP_THREAD_CREATE_CORE_CLASS_NUMBER`: an SDL_ThreadCoreClass value
+ *   for the kind of core the new thread prefers, as used by
+ *   SDL_SetCurrentThreadCoreClass(). Optional, defaults to
+ *   `SDL_THREAD_CORE_CLASS_ANY`.
  *
  * SDL makes an attempt to report `SDL_PROP_THREAD_CREATE_NAME_STRING` to the
  * system, so that debuggers can display it. Not all platforms support this.
@@ -255,6 +283,10 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThread(SDL_ThreadFunction fn,
  * of the system's page size (in many cases, this is 4 kilobytes, but check
  * your system documentation).
  *
+ * The affinity and core class are applied by the new thread before it calls
+ * the entry function. If the platform can't apply them, the thread is still
+ * created and runs wherever the system puts it.
+ *
  * Note that this "function" is actually a macro that calls an internal
  * function with two extra parameters not listed here; they are hidden through
  * preprocessor macros and are needed to support various C runtimes at the
@@ -284,6 +316,8 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThreadWithProperties(SDL_Prop
 #define SDL_PROP_THREAD_CREATE_NAME_STRING                             "SDL.thread.create.name"
 #define SDL_PROP_THREAD_CREATE_USERDATA_POINTER                        "SDL.thread.create.userdata"
 #define SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER                        "SDL.thread.create.stacksize"
+#define SDL_PROP_THREAD_CREATE_AFFINITY_NUMBER                         "SDL.thread.create.affinity"
+#define SDL_PROP_THREAD_CREATE_CORE_CLASS_NUMBER                       "SDL.thread.create.core_class"
 
 /* end wiki documentation for macros that are meant to look like functions. */
 #endif
@@ -352,6 +386,8 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThreadWithPropertiesRuntime(S
 #define SDL_PROP_THREAD_CREATE_NAME_STRING                             "SDL.thread.create.name"
 #define SDL_PROP_THREAD_CREATE_USERDATA_POINTER                        "SDL.thread.create.userdata"
 #define SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER                        "SDL.thread.create.stacksize"
+#define SDL_PROP_THREAD_CREATE_AFFINITY_NUMBER                         "SDL.thread.create.affinity"
+#define SDL_PROP_THREAD_CREATE_CORE_CLASS_NUMBER                       "SDL.thread.create.core_class"
 #endif
 
 
@@ -416,6 +452,55 @@ extern SDL_DECLSPEC SDL_ThreadID SDLCALL SDL_GetThreadID(SDL_Thread *thread);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetCurrentThreadPriority(SDL_ThreadPriority priority);
 
+/**
+ * Set the logical CPUs that the current thread may run on.
+ *
+ * Bit N of `mask` stands for logical CPU N, in the same order the system
+ * numbers them. Only the first 64 CPUs can be selected this way. A `mask` of
+ * 0 lets the thread run on any CPU again.
+ *
+ * Pinning a thread keeps it from migrating between cores, but also keeps the
+ * system from moving it off a busy core, so this is best used sparingly, for
+ * threads with strict timing needs.
+ *
+ * On platforms where SDL_SetCurrentThreadCoreClass() is implemented by
+ * restricting the thread to some CPUs, the most recent of the two calls
+ * decides where the thread runs.
+ *
+ * This is not supported on Apple platforms, which don't allow threads to be
+ * pinned; use SDL_SetCurrentThreadCoreClass() there instead.
+ *
+ * \param mask a bitmask of logical CPUs, or 0 for any CPU.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetCurrentThreadCoreClass
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetCurrentThreadAffinity(Uint64 mask);
+
+/**
+ * Set the kind of CPU core that the current thread prefers to run on.
+ *
+ * This is a hint to the system scheduler; on Windows it selects CPU sets of
+ * the requested efficiency class, on Apple platforms it sets the thread's
+ * quality of service class, and on Linux and Android it restricts the thread
+ * to the matching cores, as reported by the kernel.
+ *
+ * If the CPU doesn't have more than one kind of core, this succeeds without
+ * changing anything.
+ *
+ * \param core_class the SDL_ThreadCoreClass to prefer.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetCurrentThreadAffinity
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetCurrentThreadCoreClass(SDL_ThreadCoreClass core_class);
+
 /**
  * Wait for a thread to finish.
  *
@@ -179,6 +179,7 @@
 #cmakedefine HAVE_FSEEKO64 1
 #cmakedefine HAVE_MEMFD_CREATE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
 #cmakedefine HAVE_SIGACTION 1
 #cmakedefine HAVE_SA_SIGACTION 1
 #cmakedefine HAVE_ST_MTIM 1
@@ -532,6 +533,7 @@
 #cmakedefine SDL_CAMERA_DRIVER_ANDROID 1
 #cmakedefine SDL_CAMERA_DRIVER_EMSCRIPTEN 1
 #cmakedefine SDL_CAMERA_DRIVER_MEDIAFOUNDATION 1
+#cmakedefine SDL_CAMERA_DRIVER_WINRT 1
 #cmakedefine SDL_CAMERA_DRIVER_PIPEWIRE 1
 #cmakedefine SDL_CAMERA_DRIVER_PIPEWIRE_DYNAMIC @SDL_CAMERA_DRIVER_PIPEWIRE_DYNAMIC@
 #cmakedefine SDL_CAMERA_DRIVER_VITA 1
@@ -151,6 +151,13 @@
 
 //#define HAVE_ROAPI_H  1
 
+/* GameInput ships with the GDK and the Microsoft.GameInput package, not the Windows SDK */
+#if !SDL_WINAPI_FAMILY_PHONE && defined(__has_include)
+#if __has_include(<gameinput.h>)
+#define HAVE_GAMEINPUT_H 1
+#endif
+#endif
+
 /* Enable various audio drivers */
 #define SDL_AUDIO_DRIVER_WASAPI 1
 #define SDL_AUDIO_DRIVER_DISK   1
@@ -163,6 +170,9 @@
 #else
 //#define SDL_JOYSTICK_VIRTUAL    1
 #if (NTDDI_VERSION >= NTDDI_WIN10)
+#ifdef HAVE_GAMEINPUT_H
+#define SDL_JOYSTICK_GAMEINPUT 1
+#endif
 #define SDL_JOYSTICK_WGI    1
 #define SDL_HAPTIC_DISABLED 1
 #else
@@ -199,15 +209,16 @@
 #define SDL_VIDEO_DRIVER_WINRT  1
 //#define SDL_VIDEO_DRIVER_DUMMY  1
 
-/* Enable OpenGL ES 2.0 (via a modified ANGLE library) */
-//#define SDL_VIDEO_OPENGL_ES2 1
-//#define SDL_VIDEO_OPENGL_EGL 1
+/* Enable OpenGL ES 2.0 (via ANGLE), OpenGL ES contexts use it instead of the WGL layer */
+#define SDL_VIDEO_OPENGL_ES2 1
+#define SDL_VIDEO_OPENGL_EGL 1
 
 /* Enable appropriate renderer(s) */
 //#define SDL_VIDEO_RENDER_D3D11  1
+#define SDL_VIDEO_RENDER_D3D12  1
 
-/* Disable D3D12 as it's not implemented for WinRT */
-/* #undef SDL_VIDEO_RENDER_D3D12 */
+/* Enable GPU support */
+#define SDL_GPU_D3D12 1
 
 #define SDL_VIDEO_OPENGL     1
 #define SDL_VIDEO_RENDER_OGL 1
@@ -228,7 +239,8 @@
 #define SDL_FILESYSTEM_WINDOWS  1
 #define SDL_FSOPS_WINDOWS 1
 
-/* Enable the camera driver (src/camera/dummy/\*.c) */  /* !!! FIXME */
+/* Enable the camera drivers */
+#define SDL_CAMERA_DRIVER_WINRT  1
 #define SDL_CAMERA_DRIVER_DUMMY  1
 
 #endif /* SDL_build_config_winrt_h_ */
@@ -249,6 +249,214 @@ static bool SDL_InitOrIncrementSubsystem(Uint32 subsystem)
     return SDL_InitSubSystem(subsystem);
 }
 
+// Subsystems that SDL_HINT_PARALLEL_INIT lets initialize on the job pool, each one tracked by its bit index
+typedef struct SDL_InitTask
+{
+    bool (*init)(void);
+    void (*quit)(void);
+    const struct SDL_InitTask *dependency;
+    SDL_JobCounter *counter;
+    bool result;
+    char *error;
+} SDL_InitTask;
+
+static SDL_InitTask SDL_InitTasks[32];
+static bool SDL_InitTasksStarted = false;
+
+#ifndef SDL_AUDIO_DISABLED
+static bool SDL_InitAudioSubsystem(void)
+{
+    return SDL_InitAudio(NULL);
+}
+#endif
+
+#ifndef SDL_CAMERA_DISABLED
+static bool SDL_InitCameraSubsystem(void)
+{
+    return SDL_CameraInit(NULL);
+}
+#endif
+
+static void SDLCALL SDL_RunInitTask(void *userdata)
+{
+    SDL_InitTask *task = (SDL_InitTask *)userdata;
+
+    // The dependency only finishes with an error if its own step in SDL_InitSubSystem() fails first
+    if (task->dependency && !task->dependency->result) {
+        task->result = false;
+        return;
+    }
+
+    task->result = task->init();
+    if (!task->result) {
+        task->error = SDL_strdup(SDL_GetError());
+    }
+}
+
+static void SDL_StartInitTask(SDL_InitFlags subsystem, bool (*init)(void), void (*quit)(void), SDL_InitFlags dependency)
+{
+    SDL_InitTask *task = &SDL_InitTasks[SDL_MostSignificantBitIndex32(subsystem)];
+
+    SDL_zerop(task);
+    task->init = init;
+    task->quit = quit;
+    if (dependency) {
+        task->dependency = &SDL_InitTasks[SDL_MostSignificantBitIndex32(dependency)];
+    }
+
+    // If anything goes wrong here, the subsystem is just initialized by SDL_InitSubSystem() as usual
+    task->counter = SDL_CreateJobCounter();
+    if (task->counter) {
+        SDL_JobCounter *after = task->dependency ? task->dependency->counter : NULL;
+        if (!SDL_SubmitJobAfter(after, SDL_RunInitTask, task, task->counter)) {
+            SDL_DestroyJobCounter(task->counter);
+            task->counter = NULL;
+        }
+    }
+}
+
+// Starts the independent subsystems in flags on the job pool, returns true if this call owns the tasks
+static bool SDL_StartInitTasks(SDL_InitFlags flags)
+{
+#if defined(SDL_PLATFORM_APPLE) || defined(SDL_PLATFORM_EMSCRIPTEN) || defined(SDL_THREADS_DISABLED)
+    return false;
+#else
+    SDL_InitFlags parallel = 0;
+    int count = 0;
+
+    if (SDL_InitTasksStarted || !SDL_GetHintBoolean(SDL_HINT_PARALLEL_INIT, false)) {
+        return false;
+    }
+
+    if (flags & SDL_INIT_GAMEPAD) {
+        flags |= SDL_INIT_JOYSTICK;
+    }
+    if ((flags & SDL_INIT_VIDEO) && SDL_ShouldInitSubsystem(SDL_INIT_VIDEO)) {
+        ++count;
+    }
+#ifndef SDL_AUDIO_DISABLED
+    if ((flags & SDL_INIT_AUDIO) && SDL_ShouldInitSubsystem(SDL_INIT_AUDIO)) {
+        parallel |= SDL_INIT_AUDIO;
+        ++count;
+    }
+#endif
+#ifndef SDL_JOYSTICK_DISABLED
+    if ((flags & SDL_INIT_JOYSTICK) && SDL_ShouldInitSubsystem(SDL_INIT_JOYSTICK)) {
+        parallel |= SDL_INIT_JOYSTICK;
+        ++count;
+    }
+    if ((flags & SDL_INIT_GAMEPAD) && SDL_ShouldInitSubsystem(SDL_INIT_GAMEPAD)) {
+        parallel |= SDL_INIT_GAMEPAD;
+        if (!(parallel & SDL_INIT_JOYSTICK)) {
+            ++count;
+        }
+    }
+#endif
+#ifndef SDL_SENSOR_DISABLED
+    if ((flags & SDL_INIT_SENSOR) && SDL_ShouldInitSubsystem(SDL_INIT_SENSOR)) {
+        parallel |= SDL_INIT_SENSOR;
+        ++count;
+    }
+#endif
+#ifndef SDL_CAMERA_DISABLED
+    if ((flags & SDL_INIT_CAMERA) && SDL_ShouldInitSubsystem(SDL_INIT_CAMERA)) {
+        parallel |= SDL_INIT_CAMERA;
+        ++count;
+    }
+#endif
+
+    if (!parallel || count < 2) {
+        return false;
+    }
+
+    // Hold a reference on the event subsystem while the tasks run, they all post events
+    if (!SDL_InitOrIncrementSubsystem(SDL_INIT_EVENTS)) {
+        return false;
+    }
+
+    // Background threads shouldn't mistake themselves for the main thread
+    if (SDL_MainThreadID == 0) {
+        SDL_MainThreadID = SDL_GetCurrentThreadID();
+    }
+
+#ifndef SDL_AUDIO_DISABLED
+    if (parallel & SDL_INIT_AUDIO) {
+        SDL_StartInitTask(SDL_INIT_AUDIO, SDL_InitAudioSubsystem, SDL_QuitAudio, 0);
+    }
+#endif
+#ifndef SDL_JOYSTICK_DISABLED
+    if (parallel & SDL_INIT_JOYSTICK) {
+        SDL_StartInitTask(SDL_INIT_JOYSTICK, SDL_InitJoysticks, SDL_QuitJoysticks, 0);
+    }
+    if (parallel & SDL_INIT_GAMEPAD) {
+        SDL_StartInitTask(SDL_INIT_GAMEPAD, SDL_InitGamepads, SDL_QuitGamepads, (parallel & SDL_INIT_JOYSTICK));
+    }
+#endif
+#ifndef SDL_SENSOR_DISABLED
+    if (parallel & SDL_INIT_SENSOR) {
+        SDL_StartInitTask(SDL_INIT_SENSOR, SDL_InitSensors, SDL_QuitSensors, 0);
+    }
+#endif
+#ifndef SDL_CAMERA_DISABLED
+    if (parallel & SDL_INIT_CAMERA) {
+        SDL_StartInitTask(SDL_INIT_CAMERA, SDL_InitCameraSubsystem, SDL_QuitCamera, 0);
+    }
+#endif
+
+    SDL_InitTasksStarted = true;
+    return true;
+#endif
+}
+
+// Calls a subsystem's init function, or waits for it if it was started on the job pool
+static bool SDL_FinishInitTask(SDL_InitFlags subsystem, bool (*init)(void))
+{
+    SDL_InitTask *task = &SDL_InitTasks[SDL_MostSignificantBitIndex32(subsystem)];
+    bool result;
+
+    if (!task->counter) {
+        return init();
+    }
+
+    SDL_WaitJobCounter(task->counter);
+    SDL_DestroyJobCounter(task->counter);
+    task->counter = NULL;
+
+    result = task->result;
+    if (!result) {
+        SDL_SetError("%s", task->error ? task->error : "Couldn't initialize subsystem");
+    }
+    SDL_free(task->error);
+    task->error = NULL;
+    return result;
+}
+
+// Waits for the tasks that SDL_InitSubSystem() didn't get to, quits the subsystems they initialized, and drops the event reference
+static void SDL_EndInitTasks(void)
+{
+    static const SDL_InitFlags quit_order[] = {
+        SDL_INIT_CAMERA, SDL_INIT_SENSOR, SDL_INIT_GAMEPAD, SDL_INIT_JOYSTICK, SDL_INIT_AUDIO
+    };
+    int i;
+
+    for (i = 0; i < SDL_arraysize(quit_order); ++i) {
+        SDL_InitTask *task = &SDL_InitTasks[SDL_MostSignificantBitIndex32(quit_order[i])];
+        if (task->counter) {
+            SDL_WaitJobCounter(task->counter);
+            SDL_DestroyJobCounter(task->counter);
+            task->counter = NULL;
+            if (task->result) {
+                task->quit();
+            }
+            SDL_free(task->error);
+            task->error = NULL;
+        }
+    }
+
+    SDL_QuitSubSystem(SDL_INIT_EVENTS);
+    SDL_InitTasksStarted = false;
+}
+
 void SDL_SetMainReady(void)
 {
     SDL_MainIsReady = true;
@@ -279,6 +487,7 @@ void SDL_InitMainThread(void)
     SDL_InitEnvironment();
     SDL_InitTicks();
     SDL_InitFilesystem();
+    SDL_InitTracing();
 
     if (!done_info) {
         const char *value;
@@ -297,6 +506,7 @@ void SDL_InitMainThread(void)
 
 static void SDL_QuitMainThread(void)
 {
+    SDL_QuitTracing();
     SDL_QuitFilesystem();
     SDL_QuitTicks();
     SDL_QuitEnvironment();
@@ -306,6 +516,7 @@ static void SDL_QuitMainThread(void)
 bool SDL_InitSubSystem(SDL_InitFlags flags)
 {
     Uint32 flags_initialized = 0;
+    bool started_tasks = false;
 
     if (!SDL_MainIsReady) {
         return SDL_SetError("Application didn't initialize properly, did you include SDL_main.h in the file containing your main() function?");
@@ -325,6 +536,8 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
     }
 #endif
 
+    started_tasks = SDL_StartInitTasks(flags);
+
     // Initialize the event subsystem
     if (flags & SDL_INIT_EVENTS) {
         if (SDL_ShouldInitSubsystem(SDL_INIT_EVENTS)) {
@@ -381,7 +594,7 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_AUDIO);
-            if (!SDL_InitAudio(NULL)) {
+            if (!SDL_FinishInitTask(SDL_INIT_AUDIO, SDL_InitAudioSubsystem)) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_AUDIO);
                 SDL_PushError();
                 SDL_QuitSubSystem(SDL_INIT_EVENTS);
@@ -408,7 +621,7 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_JOYSTICK);
-            if (!SDL_InitJoysticks()) {
+            if (!SDL_FinishInitTask(SDL_INIT_JOYSTICK, SDL_InitJoysticks)) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_JOYSTICK);
                 SDL_PushError();
                 SDL_QuitSubSystem(SDL_INIT_EVENTS);
@@ -434,7 +647,7 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_GAMEPAD);
-            if (!SDL_InitGamepads()) {
+            if (!SDL_FinishInitTask(SDL_INIT_GAMEPAD, SDL_InitGamepads)) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_GAMEPAD);
                 SDL_PushError();
                 SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
@@ -475,7 +688,7 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
 #ifndef SDL_SENSOR_DISABLED
         if (SDL_ShouldInitSubsystem(SDL_INIT_SENSOR)) {
             SDL_IncrementSubsystemRefCount(SDL_INIT_SENSOR);
-            if (!SDL_InitSensors()) {
+            if (!SDL_FinishInitTask(SDL_INIT_SENSOR, SDL_InitSensors)) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_SENSOR);
                 goto quit_and_error;
             }
@@ -499,7 +712,7 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_CAMERA);
-            if (!SDL_CameraInit(NULL)) {
+            if (!SDL_FinishInitTask(SDL_INIT_CAMERA, SDL_InitCameraSubsystem)) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_CAMERA);
                 SDL_PushError();
                 SDL_QuitSubSystem(SDL_INIT_EVENTS);
@@ -518,11 +731,18 @@ bool SDL_InitSubSystem(SDL_InitFlags flags)
 
     (void)flags_initialized; // make static analysis happy, since this only gets used in error cases.
 
+    if (started_tasks) {
+        SDL_EndInitTasks();
+    }
     return SDL_ClearError();
 
 quit_and_error:
     {
         SDL_PushError();
+        if (started_tasks) {
+            // Subsystems that finished in the background but weren't counted yet have to quit before their dependencies
+            SDL_EndInitTasks();
+        }
         SDL_QuitSubSystem(flags_initialized);
         SDL_PopError();
     }
@@ -665,11 +885,18 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitJobs();
+    SDL_QuitAtomicWait();
+
+    // The log thread has to finish before leaked objects are reported
+    SDL_FlushLog();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
 
     SDL_QuitPixelFormatDetails();
+    SDL_QuitPaletteLUTs();
+    SDL_TrimSurfacePool();
 
     SDL_QuitCPUInfo();
 
@@ -683,6 +910,8 @@ void SDL_Quit(void)
     SDL_QuitProperties();
 
     SDL_QuitMainThread();
+    SDL_QuitMutexStats();
+    SDL_FlushMemoryCache();
 
     SDL_bInMainQuit = false;
 }
@@ -20,14 +20,18 @@
 */
 #include "SDL_internal.h"
 
+/* This is an open addressing table in the style of SwissTable. Each slot has
+   a control byte, kept in a separate array, that says whether the slot is
+   empty, deleted, or full, and if full, holds 7 bits of the key's hash. A
+   lookup checks a whole group of control bytes at once, with SIMD where it's
+   available, and only looks at the slots whose bits match. Most misses never
+   touch a slot at all, and most hits touch just the one they're after. */
+
 typedef struct SDL_HashItem
 {
-    // TODO: Splitting off values into a separate array might be more cache-friendly
     const void *key;
     const void *value;
     Uint32 hash;
-    Uint32 probe_len : 31;
-    Uint32 live : 1;
 } SDL_HashItem;
 
 // Must be a power of 2 >= sizeof(SDL_HashItem)
@@ -37,19 +41,64 @@ SDL_COMPILE_TIME_ASSERT(sizeof_SDL_HashItem, sizeof(SDL_HashItem) <= MAX_HASHITE
 // Anything larger than this will cause integer overflows
 #define MAX_HASHTABLE_SIZE (0x80000000u / (MAX_HASHITEM_SIZEOF))
 
+#define HASH_GROUP_SIZE 16
+
+// Control bytes for slots that aren't full. Full slots have the high bit clear.
+#define CTRL_EMPTY    0x80
+#define CTRL_DELETED  0xFE
+#define CTRL_SENTINEL 0xFF  // pads tables smaller than a group, never matches anything
+
 struct SDL_HashTable
 {
     SDL_RWLock *lock;  // NULL if not created threadsafe
     SDL_HashItem *table;
+    Uint8 *ctrl;  // one byte per slot, allocated right after the slots
     SDL_HashCallback hash;
     SDL_HashKeyMatchCallback keymatch;
     SDL_HashDestroyCallback destroy;
     void *userdata;
     Uint32 hash_mask;
-    Uint32 max_probe_len;
+    Uint32 group_mask;
     Uint32 num_occupied_slots;
+    Uint32 growth_left;  // empty slots that can be filled before the table has to be rebuilt
 };
 
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define HASHTABLE_SSE2
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define HASHTABLE_NEON
+#endif
+
+// Returns a bit for each control byte in the group that is equal to value
+static SDL_INLINE Uint32 match_group(const Uint8 *group, Uint8 value)
+{
+#if defined(HASHTABLE_SSE2)
+    const __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)));
+#elif defined(HASHTABLE_NEON)
+    static const Uint8 bits[HASH_GROUP_SIZE] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t matches = vandq_u8(vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)), vld1q_u8(bits));
+    return (Uint32)vaddv_u8(vget_low_u8(matches)) | ((Uint32)vaddv_u8(vget_high_u8(matches)) << 8);
+#else
+    Uint32 mask = 0;
+    for (int i = 0; i < HASH_GROUP_SIZE; ++i) {
+        if (group[i] == value) {
+            mask |= (1u << i);
+        }
+    }
+    return mask;
+#endif
+}
+
+static SDL_INLINE int lowest_bit_index(Uint32 mask)
+{
+    return SDL_MostSignificantBitIndex32(mask & (~mask + 1));
+}
+
+static SDL_INLINE Uint8 hash_ctrl(Uint32 hash)
+{
+    return (Uint8)(hash >> 25);
+}
 
 static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
 {
@@ -66,6 +115,34 @@ static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
     return SDL_min(buckets, MAX_HASHTABLE_SIZE);
 }
 
+static void reset_slots(SDL_HashTable *ht)
+{
+    const Uint32 num_buckets = ht->hash_mask + 1;
+    const Uint32 num_ctrl = SDL_max(num_buckets, HASH_GROUP_SIZE);
+
+    SDL_memset(ht->ctrl, CTRL_EMPTY, num_buckets);
+    SDL_memset(ht->ctrl + num_buckets, CTRL_SENTINEL, num_ctrl - num_buckets);
+    ht->num_occupied_slots = 0;
+    // keep the load under 7/8, and always leave an empty slot so lookups stop
+    ht->growth_left = num_buckets - SDL_max(num_buckets / 8, 1);
+}
+
+static bool allocate_slots(SDL_HashTable *ht, Uint32 num_buckets)
+{
+    const size_t num_ctrl = SDL_max(num_buckets, HASH_GROUP_SIZE);
+    SDL_HashItem *table = (SDL_HashItem *)SDL_malloc(num_buckets * sizeof(SDL_HashItem) + num_ctrl);
+    if (!table) {
+        return false;
+    }
+
+    ht->table = table;
+    ht->ctrl = (Uint8 *)(table + num_buckets);
+    ht->hash_mask = num_buckets - 1;
+    ht->group_mask = (num_buckets > HASH_GROUP_SIZE) ? (num_buckets / HASH_GROUP_SIZE) - 1 : 0;
+    reset_slots(ht);
+    return true;
+}
+
 SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_HashCallback hash,
                                    SDL_HashKeyMatchCallback keymatch,
                                    SDL_HashDestroyCallback destroy, void *userdata)
@@ -84,13 +161,11 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
         }
     }
 
-    table->table = (SDL_HashItem *)SDL_calloc(num_buckets, sizeof(SDL_HashItem));
-    if (!table->table) {
+    if (!allocate_slots(table, num_buckets)) {
         SDL_DestroyHashTable(table);
         return NULL;
     }
 
-    table->hash_mask = num_buckets - 1;
     table->userdata = userdata;
     table->hash = hash;
     table->keymatch = keymatch;
@@ -104,121 +179,70 @@ static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
     return table->hash(table->userdata, key) * BitMixer;
 }
 
-static SDL_INLINE Uint32 get_probe_length(Uint32 zero_idx, Uint32 actual_idx, Uint32 num_buckets)
-{
-    // returns the probe sequence length from zero_idx to actual_idx
-    if (actual_idx < zero_idx) {
-        return num_buckets - zero_idx + actual_idx;
-    }
-
-    return actual_idx - zero_idx;
-}
-
-static SDL_HashItem *find_item(const SDL_HashTable *ht, const void *key, Uint32 hash, Uint32 *i, Uint32 *probe_len)
+/* Groups are probed in triangular steps (1, 2, 3, ...), which visits every
+   group when the number of groups is a power of two. A lookup can stop at the
+   first group with an empty slot, since an insert would have used it. */
+static SDL_HashItem *find_first_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
 {
-    Uint32 hash_mask = ht->hash_mask;
-    Uint32 max_probe_len = ht->max_probe_len;
-
-    SDL_HashItem *table = ht->table;
-
-    while (true) {
-        SDL_HashItem *item = table + *i;
-        Uint32 item_hash = item->hash;
-
-        if (!item->live) {
-            return NULL;
-        }
-
-        if (item_hash == hash && ht->keymatch(ht->userdata, item->key, key)) {
-            return item;
-        }
+    const Uint8 ctrl = hash_ctrl(hash);
+    Uint32 group = hash & ht->group_mask;
 
-        Uint32 item_probe_len = item->probe_len;
-        SDL_assert(item_probe_len == get_probe_length(item_hash & hash_mask, (Uint32)(item - table), hash_mask + 1));
+    for (Uint32 step = 0; step <= ht->group_mask;) {
+        const Uint8 *group_ctrl = ht->ctrl + group * HASH_GROUP_SIZE;
+        Uint32 matches = match_group(group_ctrl, ctrl);
 
-        if (*probe_len > item_probe_len) {
-            return NULL;
+        while (matches) {
+            SDL_HashItem *item = ht->table + group * HASH_GROUP_SIZE + lowest_bit_index(matches);
+            if (item->hash == hash && ht->keymatch(ht->userdata, item->key, key)) {
+                return item;
+            }
+            matches &= matches - 1;
         }
 
-        if (++*probe_len > max_probe_len) {
+        if (match_group(group_ctrl, CTRL_EMPTY)) {
             return NULL;
         }
 
-        *i = (*i + 1) & hash_mask;
+        ++step;
+        group = (group + step) & ht->group_mask;
     }
+    return NULL;
 }
 
-static SDL_HashItem *find_first_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
+static void insert_item(SDL_HashTable *ht, const void *key, const void *value, Uint32 hash)
 {
-    Uint32 i = hash & ht->hash_mask;
-    Uint32 probe_len = 0;
-    return find_item(ht, key, hash, &i, &probe_len);
-}
+    Uint32 group = hash & ht->group_mask;
+    Uint32 step = 0;
+    Uint32 free_slots;
 
-static SDL_HashItem *insert_item(SDL_HashItem *item_to_insert, SDL_HashItem *table, Uint32 hash_mask, Uint32 *max_probe_len_ptr)
-{
-    const Uint32 num_buckets = hash_mask + 1;
-    Uint32 idx = item_to_insert->hash & hash_mask;
-    SDL_HashItem *target = NULL;
-    SDL_HashItem temp_item;
+    SDL_assert(ht->growth_left > 0);
 
     while (true) {
-        SDL_HashItem *candidate = table + idx;
-
-        if (!candidate->live) {
-            // Found an empty slot. Put it here and we're done.
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
-
-            const Uint32 probe_len = get_probe_length(candidate->hash & hash_mask, idx, num_buckets);
-            candidate->probe_len = probe_len;
-
-            if (*max_probe_len_ptr < probe_len) {
-                *max_probe_len_ptr = probe_len;
-            }
-
+        const Uint8 *group_ctrl = ht->ctrl + group * HASH_GROUP_SIZE;
+        free_slots = match_group(group_ctrl, CTRL_EMPTY) | match_group(group_ctrl, CTRL_DELETED);
+        if (free_slots) {
             break;
         }
+        ++step;
+        group = (group + step) & ht->group_mask;
+    }
 
-        const Uint32 candidate_probe_len = candidate->probe_len;
-        SDL_assert(candidate_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-        const Uint32 new_probe_len = get_probe_length(item_to_insert->hash & hash_mask, idx, num_buckets);
-
-        if (candidate_probe_len < new_probe_len) {
-            // Robin Hood hashing: the item at idx has a better probe length than our item would at this position.
-            // Evict it and put our item in its place, then continue looking for a new spot for the displaced item.
-            // This algorithm significantly reduces clustering in the table, making lookups take very few probes.
-
-            temp_item = *candidate;
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
-
-            *item_to_insert = temp_item;
-
-            SDL_assert(new_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-            candidate->probe_len = new_probe_len;
-
-            if (*max_probe_len_ptr < new_probe_len) {
-                *max_probe_len_ptr = new_probe_len;
-            }
-        }
-
-        idx = (idx + 1) & hash_mask;
+    const Uint32 idx = group * HASH_GROUP_SIZE + lowest_bit_index(free_slots);
+    if (ht->ctrl[idx] == CTRL_EMPTY) {
+        ht->growth_left--;
     }
+    ht->ctrl[idx] = hash_ctrl(hash);
 
-    return target;
+    SDL_HashItem *item = ht->table + idx;
+    item->key = key;
+    item->value = value;
+    item->hash = hash;
+    ht->num_occupied_slots++;
 }
 
 static void delete_item(SDL_HashTable *ht, SDL_HashItem *item)
 {
-    const Uint32 hash_mask = ht->hash_mask;
-    SDL_HashItem *table = ht->table;
+    const Uint32 idx = (Uint32)(item - ht->table);
 
     if (ht->destroy) {
         ht->destroy(ht->userdata, item->key, item->value);
@@ -227,44 +251,35 @@ static void delete_item(SDL_HashTable *ht, SDL_HashItem *item)
     SDL_assert(ht->num_occupied_slots > 0);
     ht->num_occupied_slots--;
 
-    Uint32 idx = (Uint32)(item - ht->table);
-
-    while (true) {
-        idx = (idx + 1) & hash_mask;
-        SDL_HashItem *next_item = table + idx;
-
-        if (next_item->probe_len < 1) {
-            SDL_zerop(item);
-            return;
-        }
-
-        *item = *next_item;
-        item->probe_len -= 1;
-        SDL_assert(item->probe_len < ht->max_probe_len);
-        item = next_item;
+    // If the group still has an empty slot, no lookup ever probed past it, so this slot can be empty again too
+    if (match_group(ht->ctrl + (idx & ~(Uint32)(HASH_GROUP_SIZE - 1)), CTRL_EMPTY)) {
+        ht->ctrl[idx] = CTRL_EMPTY;
+        ht->growth_left++;
+    } else {
+        ht->ctrl[idx] = CTRL_DELETED;
     }
+    SDL_zerop(item);
 }
 
 static bool resize(SDL_HashTable *ht, Uint32 new_size)
 {
-    const Uint32 new_hash_mask = new_size - 1;
-    SDL_HashItem *new_table = SDL_calloc(new_size, sizeof(*new_table));
-
-    if (!new_table) {
-        return false;
-    }
-
     SDL_HashItem *old_table = ht->table;
+    Uint8 *old_ctrl = ht->ctrl;
     const Uint32 old_size = ht->hash_mask + 1;
+    const Uint32 old_group_mask = ht->group_mask;
 
-    ht->max_probe_len = 0;
-    ht->hash_mask = new_hash_mask;
-    ht->table = new_table;
+    if (!allocate_slots(ht, new_size)) {
+        ht->table = old_table;
+        ht->ctrl = old_ctrl;
+        ht->hash_mask = old_size - 1;
+        ht->group_mask = old_group_mask;
+        return false;
+    }
 
     for (Uint32 i = 0; i < old_size; ++i) {
-        SDL_HashItem *item = old_table + i;
-        if (item->live) {
-            insert_item(item, new_table, new_hash_mask, &ht->max_probe_len);
+        if (!(old_ctrl[i] & 0x80)) {
+            SDL_HashItem *item = old_table + i;
+            insert_item(ht, item->key, item->value, item->hash);
         }
     }
 
@@ -274,20 +289,21 @@ static bool resize(SDL_HashTable *ht, Uint32 new_size)
 
 static bool maybe_resize(SDL_HashTable *ht)
 {
-    const Uint32 capacity = ht->hash_mask + 1;
-
-    if (capacity >= MAX_HASHTABLE_SIZE) {
-        return false;
+    if (ht->growth_left > 0) {
+        return true;
     }
 
-    const Uint32 max_load_factor = 217; // range: 0-255; 217 is roughly 85%
-    const Uint32 resize_threshold = (Uint32)((max_load_factor * (Uint64)capacity) >> 8);
+    const Uint32 capacity = ht->hash_mask + 1;
 
-    if (ht->num_occupied_slots > resize_threshold) {
-        return resize(ht, capacity * 2);
+    // If deleted slots are what's using up the space, rebuilding at the same size clears them out
+    if (ht->num_occupied_slots < capacity / 2) {
+        return resize(ht, capacity);
     }
 
-    return true;
+    if (capacity >= MAX_HASHTABLE_SIZE) {
+        return false;
+    }
+    return resize(ht, capacity * 2);
 }
 
 bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *value, bool replace)
@@ -313,23 +329,9 @@ bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *
         }
     }
 
-    if (do_insert) {
-        SDL_HashItem new_item;
-        new_item.key = key;
-        new_item.value = value;
-        new_item.hash = hash;
-        new_item.live = true;
-        new_item.probe_len = 0;
-
-        table->num_occupied_slots++;
-
-        if (!maybe_resize(table)) {
-            table->num_occupied_slots--;
-        } else {
-            // This never returns NULL
-            insert_item(&new_item, table->table, table->hash_mask, &table->max_probe_len);
-            result = true;
-        }
+    if (do_insert && maybe_resize(table)) {
+        insert_item(table, key, value, hash);
+        result = true;
     }
 
     SDL_UnlockRWLock(table->lock);
@@ -391,16 +393,16 @@ bool SDL_IterateHashTable(const SDL_HashTable *table, SDL_HashTableIterateCallba
     }
 
     SDL_LockRWLockForReading(table->lock);
-    SDL_HashItem *end = table->table + (table->hash_mask + 1);
+    const Uint32 num_buckets = table->hash_mask + 1;
     Uint32 num_iterated = 0;
 
-    for (SDL_HashItem *item = table->table; item < end; item++) {
-        if (item->live) {
+    for (Uint32 i = 0; i < num_buckets && num_iterated < table->num_occupied_slots; ++i) {
+        if (!(table->ctrl[i] & 0x80)) {
+            const SDL_HashItem *item = table->table + i;
             if (!callback(userdata, table, item->key, item->value)) {
                 break;  // callback requested iteration stop.
-            } else if (++num_iterated >= table->num_occupied_slots) {
-                break;  // we can drop out early because we've seen all the live items.
             }
+            ++num_iterated;  // we can drop out early once we've seen all the live items.
         }
     }
 
@@ -424,13 +426,13 @@ bool SDL_HashTableEmpty(SDL_HashTable *table)
 static void destroy_all(SDL_HashTable *table)
 {
     SDL_HashDestroyCallback destroy = table->destroy;
-    if (destroy) {
+    if (destroy && table->ctrl) {
         void *userdata = table->userdata;
-        SDL_HashItem *end = table->table + (table->hash_mask + 1);
-        for (SDL_HashItem *i = table->table; i < end; ++i) {
-            if (i->live) {
-                i->live = false;
-                destroy(userdata, i->key, i->value);
+        const Uint32 num_buckets = table->hash_mask + 1;
+        for (Uint32 i = 0; i < num_buckets; ++i) {
+            if (!(table->ctrl[i] & 0x80)) {
+                table->ctrl[i] = CTRL_DELETED;
+                destroy(userdata, table->table[i].key, table->table[i].value);
             }
         }
     }
@@ -442,8 +444,7 @@ void SDL_ClearHashTable(SDL_HashTable *table)
         SDL_LockRWLockForWriting(table->lock);
         {
             destroy_all(table);
-            SDL_memset(table->table, 0, sizeof(*table->table) * (table->hash_mask + 1));
-            table->num_occupied_slots = 0;
+            reset_slots(table);
         }
         SDL_UnlockRWLock(table->lock);
     }
@@ -461,14 +462,86 @@ void SDL_DestroyHashTable(SDL_HashTable *table)
     }
 }
 
-// this is djb's xor hashing function.
-static SDL_INLINE Uint32 hash_string_djbxor(const char *str, size_t len)
+/* This is a string hash in the style of wyhash, which reads the string 8 or
+   16 bytes at a time and mixes with a 64x64->128 bit multiply. Property and
+   hint names hash much faster this way than a byte at a time, and the hash
+   is still well distributed. */
+#define HASH_SECRET0 SDL_UINT64_C(0xa0761d6478bd642f)
+#define HASH_SECRET1 SDL_UINT64_C(0xe7037ed1a0b428db)
+
+static SDL_INLINE void hash_mum(Uint64 *a, Uint64 *b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)*a * *b;
+    *a = (Uint64)r;
+    *b = (Uint64)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(_M_ARM64EC)
+    *a = _umul128(*a, *b, b);
+#else
+    const Uint64 ha = *a >> 32, hb = *b >> 32, la = (Uint32)*a, lb = (Uint32)*b;
+    const Uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const Uint64 t = rl + (rm0 << 32);
+    const Uint64 lo = t + (rm1 << 32);
+    Uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+    *a = lo;
+    *b = hi;
+#endif
+}
+
+static SDL_INLINE Uint64 hash_mix(Uint64 a, Uint64 b)
 {
-    Uint32 hash = 5381;
-    while (len--) {
-        hash = ((hash << 5) + hash) ^ *(str++);
+    hash_mum(&a, &b);
+    return a ^ b;
+}
+
+static SDL_INLINE Uint64 hash_read64(const Uint8 *p)
+{
+    Uint64 v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_Swap64LE(v);
+}
+
+static SDL_INLINE Uint64 hash_read32(const Uint8 *p)
+{
+    Uint32 v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_Swap32LE(v);
+}
+
+static Uint32 hash_string_wy(const char *str, size_t len)
+{
+    const Uint8 *p = (const Uint8 *)str;
+    Uint64 seed = HASH_SECRET0;
+    Uint64 a, b;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t mid = (len >> 3) << 2;
+            a = (hash_read32(p) << 32) | hash_read32(p + mid);
+            b = (hash_read32(p + len - 4) << 32) | hash_read32(p + len - 4 - mid);
+        } else if (len > 0) {
+            a = ((Uint64)p[0] << 16) | ((Uint64)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        while (i > 16) {
+            seed = hash_mix(hash_read64(p) ^ HASH_SECRET1, hash_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // The last 16 bytes, which may overlap what was already mixed in
+        a = hash_read64(p + i - 16);
+        b = hash_read64(p + i - 8);
     }
-    return hash;
+
+    a ^= HASH_SECRET1;
+    b ^= seed;
+    hash_mum(&a, &b);
+    a = hash_mix(a ^ HASH_SECRET0 ^ len, b ^ HASH_SECRET1);
+    return (Uint32)(a ^ (a >> 32));
 }
 
 Uint32 SDL_HashPointer(void *unused, const void *key)
@@ -487,7 +560,7 @@ Uint32 SDL_HashString(void *unused, const void *key)
 {
     (void)unused;
     const char *str = (const char *)key;
-    return hash_string_djbxor(str, SDL_strlen(str));
+    return hash_string_wy(str, SDL_strlen(str));
 }
 
 bool SDL_KeyMatchString(void *unused, const void *a, const void *b)
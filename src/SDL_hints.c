@@ -41,6 +41,13 @@ typedef struct SDL_Hint
 } SDL_Hint;
 
 static SDL_AtomicU32 SDL_hint_props;
+static SDL_AtomicInt SDL_hint_serial;  // bumped whenever a hint might have changed
+
+// The cached state is the change serial it was looked up at, shifted past the value bits. 0 is never a valid state.
+#define HINT_CACHE_UNSET  1
+#define HINT_CACHE_FALSE  2
+#define HINT_CACHE_TRUE   3
+#define HINT_CACHE_TAG(serial) ((((serial) & 0x1FFFFFFF) + 1) << 2)
 
 
 void SDL_InitHints(void)
@@ -57,6 +64,12 @@ void SDL_QuitHints(void)
     if (props) {
         SDL_DestroyProperties(props);
     }
+    SDL_InvalidateHintCaches();
+}
+
+void SDL_InvalidateHintCaches(void)
+{
+    SDL_AddAtomicInt(&SDL_hint_serial, 1);
 }
 
 static SDL_PropertiesID GetHintProperties(bool create)
@@ -150,6 +163,9 @@ bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPriori
             result = SDL_SetPointerPropertyWithCleanup(hints, name, hint, CleanupHintProperty, NULL);
         }
     }
+    if (result) {
+        SDL_InvalidateHintCaches();
+    }
 
 #ifdef SDL_PLATFORM_ANDROID
     if (SDL_strcmp(name, SDL_HINT_ANDROID_ALLOW_RECREATE_ACTIVITY) == 0) {
@@ -194,6 +210,7 @@ bool SDL_ResetHint(const char *name)
         hint->value = NULL;
         hint->priority = SDL_HINT_DEFAULT;
         result = true;
+        SDL_InvalidateHintCaches();
     }
 
 #ifdef SDL_PLATFORM_ANDROID
@@ -232,6 +249,7 @@ static void SDLCALL ResetHintsCallback(void *userdata, SDL_PropertiesID hints, c
     SDL_free(hint->value);
     hint->value = NULL;
     hint->priority = SDL_HINT_DEFAULT;
+    SDL_InvalidateHintCaches();
 
 #ifdef SDL_PLATFORM_ANDROID
     if (SDL_strcmp(name, SDL_HINT_ANDROID_ALLOW_RECREATE_ACTIVITY) == 0) {
@@ -314,6 +332,32 @@ bool SDL_GetHintBoolean(const char *name, bool default_value)
     return SDL_GetStringBoolean(hint, default_value);
 }
 
+bool SDL_GetCachedHintBoolean(SDL_HintCache *cache, bool default_value)
+{
+    const int tag = HINT_CACHE_TAG(SDL_GetAtomicInt(&SDL_hint_serial));
+    int state = SDL_GetAtomicInt(&cache->state);
+
+    if ((state & ~3) != tag) {
+        // Tag it with the serial from before the lookup, so a change that races with it gets picked up next time
+        const char *hint = SDL_GetHint(cache->name);
+        if (!hint || !*hint) {
+            state = tag | HINT_CACHE_UNSET;
+        } else {
+            state = tag | (SDL_GetStringBoolean(hint, false) ? HINT_CACHE_TRUE : HINT_CACHE_FALSE);
+        }
+        SDL_SetAtomicInt(&cache->state, state);
+    }
+
+    switch (state & 3) {
+    case HINT_CACHE_FALSE:
+        return false;
+    case HINT_CACHE_TRUE:
+        return true;
+    default:
+        return default_value;
+    }
+}
+
 bool SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
     if (!name || !*name) {
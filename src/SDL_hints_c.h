@@ -30,4 +30,28 @@ extern bool SDL_GetStringBoolean(const char *value, bool default_value);
 extern int SDL_GetStringInteger(const char *value, int default_value);
 extern void SDL_QuitHints(void);
 
+/* A boolean hint that is looked up once and then cached, for code that checks
+   a hint on every frame or event. The cached value is thrown away whenever any
+   hint or SDL's copy of the environment changes, so reading it is usually
+   just two atomic loads.
+
+   Declare one per hint, with static storage:
+
+       static SDL_HintCache allow_topmost = SDL_HINT_CACHE_INIT(SDL_HINT_WINDOW_ALLOW_TOPMOST);
+       ...
+       if (SDL_GetCachedHintBoolean(&allow_topmost, true)) { ... }
+*/
+typedef struct SDL_HintCache
+{
+    const char *name;
+    SDL_AtomicInt state;  // the change serial it was looked up at, and what it was
+} SDL_HintCache;
+
+#define SDL_HINT_CACHE_INIT(name) { name, { 0 } }
+
+extern bool SDL_GetCachedHintBoolean(SDL_HintCache *cache, bool default_value);
+
+// Throws away cached hint values, call this when the environment SDL_getenv() reads from changes.
+extern void SDL_InvalidateHintCaches(void);
+
 #endif // SDL_hints_c_h_
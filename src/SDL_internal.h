@@ -274,6 +274,65 @@ extern "C" {
 // Do any initialization that needs to happen before threads are started
 extern void SDL_InitMainThread(void);
 
+// Return the calling thread's cached small allocations to the shared heap
+extern void SDL_FlushMemoryCache(void);
+
+/* Count memory under a subsystem for SDL_GetMemoryTagStats(). Every add must
+   be matched by a remove of the same size, these don't allocate anything. */
+#ifdef SDL_MEMORY_STATS
+extern void SDL_AddTaggedMemory(SDL_MemoryTag tag, size_t size);
+extern void SDL_RemoveTaggedMemory(SDL_MemoryTag tag, size_t size);
+extern void SDL_MoveTaggedMemory(SDL_MemoryTag from, SDL_MemoryTag to, size_t size);
+extern void SDL_SetArenaMemoryTag(SDL_Arena *arena, SDL_MemoryTag tag);
+#else
+#define SDL_AddTaggedMemory(tag, size)
+#define SDL_RemoveTaggedMemory(tag, size)
+#define SDL_MoveTaggedMemory(from, to, size)
+#define SDL_SetArenaMemoryTag(arena, tag)
+#endif
+
+/* Mark a zone of work for SDL_SetTraceCallback() and the platform profilers.
+   Every SDL_TRACE_ZONE_BEGIN() needs an SDL_TRACE_ZONE_END() with the same
+   zone before the enclosing block is left. These compile to nothing unless SDL
+   is built with SDL_TRACING. */
+#ifdef SDL_TRACING
+typedef struct SDL_TraceLocation
+{
+    // This matches the layout of Tracy's ___tracy_source_location_data
+    const char *name;
+    const char *function;
+    const char *file;
+    Uint32 line;
+    Uint32 color;
+} SDL_TraceLocation;
+
+extern void SDL_InitTracing(void);
+extern void SDL_QuitTracing(void);
+extern Uint64 SDL_BeginTraceZone(const SDL_TraceLocation *location);
+extern void SDL_EndTraceZone(const SDL_TraceLocation *location, Uint64 context);
+
+#define SDL_TRACE_ZONE_BEGIN(zone, zonename)                                                    \
+    static const SDL_TraceLocation zone##_location = { zonename, SDL_FUNCTION, SDL_FILE, SDL_LINE, 0 }; \
+    const Uint64 zone = SDL_BeginTraceZone(&zone##_location)
+#define SDL_TRACE_ZONE_END(zone) SDL_EndTraceZone(&zone##_location, zone)
+#else
+#define SDL_InitTracing()
+#define SDL_QuitTracing()
+#define SDL_TRACE_ZONE_BEGIN(zone, zonename)
+#define SDL_TRACE_ZONE_END(zone)
+#endif
+
+/* Copy memory that won't be read again soon, like pixels on their way to the
+   GPU, using non-temporal stores when the copy is bigger than the CPU cache */
+extern void *SDL_memcpy_large(void *dst, const void *src, size_t len);
+extern void SDL_memcpy_rows(void *dst, size_t dst_pitch, const void *src, size_t src_pitch, size_t len, size_t rows);
+
+/* Timestamp for events and input reports, this is SDL_GetTicksNS() unless
+   SDL_HINT_EVENT_TIMESTAMPS picks a cheaper clock. SDL_UpdateEventTicks() is
+   called once per event pump to keep the cheaper clocks in step. */
+extern Uint64 SDL_GetEventTicksNS(void);
+extern void SDL_UpdateEventTicks(void);
+
 /* The internal implementations of these functions have up to nanosecond precision.
    We can expose these functions as part of the API if we want to later.
 */
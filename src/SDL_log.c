@@ -66,6 +66,37 @@ static SDL_LogPriority SDL_log_default_priority SDL_GUARDED_BY(SDL_log_lock);
 static SDL_LogOutputFunction SDL_log_function SDL_GUARDED_BY(SDL_log_function_lock) = SDL_LogOutput;
 static void *SDL_log_userdata SDL_GUARDED_BY(SDL_log_function_lock) = NULL;
 
+// The number of messages that can be waiting for the log thread, must be a power of two
+#define SDL_LOG_QUEUE_SIZE 512
+
+typedef struct SDL_LogQueueEntry
+{
+    SDL_AtomicInt sequence;
+    int category;
+    SDL_LogPriority priority;
+    char *message;  // either text, or allocated for long messages
+    char text[SDL_MAX_LOG_MESSAGE_STACK];
+} SDL_LogQueueEntry;
+
+/* This is a bounded multi-producer queue, where each entry's sequence number
+   says whether it's ready to be written by a logging thread (== position) or
+   read by the log thread (== position + 1). */
+typedef struct SDL_LogQueue
+{
+    SDL_LogQueueEntry entries[SDL_LOG_QUEUE_SIZE];
+    SDL_AtomicInt enqueue_pos;
+    Uint32 dequeue_pos;
+    SDL_AtomicInt dropped;
+    SDL_AtomicInt sleeping;
+    SDL_AtomicInt quit;
+    SDL_Semaphore *wakeup;
+    SDL_Thread *thread;
+    SDL_ThreadID thread_id;
+    bool block;
+} SDL_LogQueue;
+
+static SDL_LogQueue *SDL_log_queue;
+
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
@@ -125,6 +156,162 @@ static void SDLCALL SDL_LoggingChanged(void *userdata, const char *name, const c
     SDL_ResetLogPriorities();
 }
 
+static void WakeLogThread(SDL_LogQueue *queue)
+{
+    if (SDL_CompareAndSwapAtomicInt(&queue->sleeping, 1, 0)) {
+        SDL_SignalSemaphore(queue->wakeup);
+    }
+}
+
+static bool LogQueueHasEntries(SDL_LogQueue *queue)
+{
+    const SDL_LogQueueEntry *entry = &queue->entries[queue->dequeue_pos & (SDL_LOG_QUEUE_SIZE - 1)];
+    return (Uint32)SDL_GetAtomicInt((SDL_AtomicInt *)&entry->sequence) == queue->dequeue_pos + 1;
+}
+
+static bool DrainLogQueue(SDL_LogQueue *queue)
+{
+    if (!LogQueueHasEntries(queue)) {
+        return false;
+    }
+
+    SDL_LockMutex(SDL_log_function_lock);
+    {
+        while (LogQueueHasEntries(queue)) {
+            SDL_LogQueueEntry *entry = &queue->entries[queue->dequeue_pos & (SDL_LOG_QUEUE_SIZE - 1)];
+            SDL_MemoryBarrierAcquire();
+
+            if (SDL_log_function) {
+                SDL_log_function(SDL_log_userdata, entry->category, entry->priority, entry->message);
+            }
+            if (entry->message != entry->text) {
+                SDL_free(entry->message);
+            }
+
+            SDL_MemoryBarrierRelease();
+            SDL_SetAtomicInt(&entry->sequence, (int)(queue->dequeue_pos + SDL_LOG_QUEUE_SIZE));
+            ++queue->dequeue_pos;
+        }
+
+        const int dropped = SDL_SetAtomicInt(&queue->dropped, 0);
+        if (dropped > 0 && SDL_log_function) {
+            char message[64];
+            (void)SDL_snprintf(message, sizeof(message), "%d log messages were dropped", dropped);
+            SDL_log_function(SDL_log_userdata, SDL_LOG_CATEGORY_SYSTEM, SDL_LOG_PRIORITY_WARN, message);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_function_lock);
+
+    return true;
+}
+
+static int SDLCALL SDL_LogThread(void *data)
+{
+    SDL_LogQueue *queue = (SDL_LogQueue *)data;
+
+    while (true) {
+        const bool quit = (SDL_GetAtomicInt(&queue->quit) != 0);
+        if (DrainLogQueue(queue)) {
+            continue;
+        }
+        if (quit) {
+            break;
+        }
+
+        // Check again after saying we're asleep, so a message queued in between isn't missed
+        SDL_SetAtomicInt(&queue->sleeping, 1);
+        if (!LogQueueHasEntries(queue) && !SDL_GetAtomicInt(&queue->quit)) {
+            SDL_WaitSemaphore(queue->wakeup);
+        } else {
+            SDL_CompareAndSwapAtomicInt(&queue->sleeping, 1, 0);
+        }
+    }
+    return 0;
+}
+
+static SDL_LogQueue *CreateLogQueue(void)
+{
+    SDL_LogQueue *queue = (SDL_LogQueue *)SDL_calloc(1, sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    for (int i = 0; i < SDL_LOG_QUEUE_SIZE; ++i) {
+        SDL_SetAtomicInt(&queue->entries[i].sequence, i);
+    }
+    const char *overflow = SDL_GetHint(SDL_HINT_LOGGING_ASYNC_OVERFLOW);
+    if (overflow && SDL_strcasecmp(overflow, "block") == 0) {
+        queue->block = true;
+    }
+
+    queue->wakeup = SDL_CreateSemaphore(0);
+    if (queue->wakeup) {
+        queue->thread = SDL_CreateThread(SDL_LogThread, "SDLLog", queue);
+    }
+    if (!queue->thread) {
+        if (queue->wakeup) {
+            SDL_DestroySemaphore(queue->wakeup);
+        }
+        SDL_free(queue);
+        return NULL;
+    }
+    queue->thread_id = SDL_GetThreadID(queue->thread);
+    return queue;
+}
+
+static void DestroyLogQueue(SDL_LogQueue *queue)
+{
+    // The log thread writes out everything that's queued before it exits
+    SDL_SetAtomicInt(&queue->quit, 1);
+    SDL_SignalSemaphore(queue->wakeup);
+    SDL_WaitThread(queue->thread, NULL);
+    SDL_DestroySemaphore(queue->wakeup);
+    SDL_free(queue);
+}
+
+static void EnqueueLogMessage(SDL_LogQueue *queue, int category, SDL_LogPriority priority, const char *message, size_t len)
+{
+    SDL_LogQueueEntry *entry;
+    Uint32 pos = (Uint32)SDL_GetAtomicInt(&queue->enqueue_pos);
+
+    while (true) {
+        entry = &queue->entries[pos & (SDL_LOG_QUEUE_SIZE - 1)];
+        const int diff = (int)((Uint32)SDL_GetAtomicInt(&entry->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicInt(&queue->enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The queue is full. The log thread can't wait on itself, so messages it logs are always dropped.
+            if (!queue->block || SDL_GetCurrentThreadID() == queue->thread_id) {
+                SDL_AddAtomicInt(&queue->dropped, 1);
+                return;
+            }
+            WakeLogThread(queue);
+            SDL_Delay(0);
+        }
+        pos = (Uint32)SDL_GetAtomicInt(&queue->enqueue_pos);
+    }
+
+    entry->category = category;
+    entry->priority = priority;
+    if (len < sizeof(entry->text)) {
+        SDL_memcpy(entry->text, message, len + 1);
+        entry->message = entry->text;
+    } else {
+        entry->message = SDL_strdup(message);
+        if (!entry->message) {
+            entry->text[0] = '\0';
+            entry->message = entry->text;
+        }
+    }
+
+    SDL_MemoryBarrierRelease();
+    SDL_SetAtomicInt(&entry->sequence, (int)(pos + 1));
+
+    WakeLogThread(queue);
+}
+
 void SDL_InitLog(void)
 {
     if (!SDL_ShouldInit(&SDL_log_init)) {
@@ -137,6 +324,10 @@ void SDL_InitLog(void)
 
     SDL_AddHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
+    if (SDL_GetHintBoolean(SDL_HINT_LOGGING_ASYNC, false)) {
+        SDL_log_queue = CreateLogQueue();
+    }
+
     SDL_SetInitialized(&SDL_log_init, true);
 }
 
@@ -146,6 +337,8 @@ void SDL_QuitLog(void)
         return;
     }
 
+    SDL_FlushLog();
+
     SDL_RemoveHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
     CleanupLogPriorities();
@@ -163,6 +356,16 @@ void SDL_QuitLog(void)
     SDL_SetInitialized(&SDL_log_init, false);
 }
 
+void SDL_FlushLog(void)
+{
+    if (SDL_log_queue) {
+        // Anything logged from here on is written synchronously
+        SDL_LogQueue *queue = SDL_log_queue;
+        SDL_log_queue = NULL;
+        DestroyLogQueue(queue);
+    }
+}
+
 static void SDL_CheckInitLog(void)
 {
     int status = SDL_GetAtomicInt(&SDL_log_init.status);
@@ -637,11 +840,15 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         }
     }
 
-    SDL_LockMutex(SDL_log_function_lock);
-    {
-        SDL_log_function(SDL_log_userdata, category, priority, message);
+    if (SDL_log_queue) {
+        EnqueueLogMessage(SDL_log_queue, category, priority, message, (size_t)len);
+    } else {
+        SDL_LockMutex(SDL_log_function_lock);
+        {
+            SDL_log_function(SDL_log_userdata, category, priority, message);
+        }
+        SDL_UnlockMutex(SDL_log_function_lock);
     }
-    SDL_UnlockMutex(SDL_log_function_lock);
 
     // Free only if dynamically allocated
     if (message != stack_buf) {
@@ -28,4 +28,7 @@
 extern void SDL_InitLog(void);
 extern void SDL_QuitLog(void);
 
+// Write out any queued log messages and stop the background log thread, if there is one
+extern void SDL_FlushLog(void);
+
 #endif // SDL_log_c_h_
@@ -42,14 +42,21 @@ typedef struct
     void *userdata;
 } SDL_Property;
 
+/* Readers share the rwlock. Writers, and apps calling SDL_LockProperties(),
+   take the recursive mutex and then hold the rwlock for writing, so a thread
+   that owns the properties can still read them without deadlocking. */
 typedef struct
 {
     SDL_HashTable *props;
     SDL_Mutex *lock;
+    SDL_RWLock *rwlock;
+    SDL_ThreadID owner;  // the thread holding the rwlock for writing, or 0
+    int lock_depth;
 } SDL_Properties;
 
 static SDL_InitState SDL_properties_init;
 static SDL_HashTable *SDL_properties;
+static SDL_HashTable *SDL_property_names;  // every property name in use, so properties can be keyed by pointer
 static SDL_AtomicU32 SDL_last_properties_id;
 static SDL_AtomicU32 SDL_global_properties;
 
@@ -65,17 +72,48 @@ static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void
             }
             break;
         case SDL_PROPERTY_TYPE_STRING:
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, SDL_strlen(property->value.string_value) + 1);
             SDL_free(property->value.string_value);
             break;
         default:
             break;
         }
-        SDL_free(property->string_storage);
+        if (property->string_storage) {
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, SDL_strlen(property->string_storage) + 1);
+            SDL_free(property->string_storage);
+        }
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, sizeof(*property));
     }
-    SDL_free((void *)key);
     SDL_free((void *)value);
 }
 
+// Properties are created here so they're counted in the memory statistics
+static SDL_Property *SDL_CreateProperty(SDL_PropertyType type)
+{
+    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    if (property) {
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, sizeof(*property));
+        property->type = type;
+    }
+    return property;
+}
+
+// Strings owned by properties, for the same reason
+static char *SDL_CreatePropertyString(const char *value)
+{
+    char *copy = SDL_strdup(value);
+    if (copy) {
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, SDL_strlen(copy) + 1);
+    }
+    return copy;
+}
+
+static void SDLCALL SDL_FreePropertyName(void *unused, const void *key, const void *value)
+{
+    SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, SDL_strlen((const char *)key) + 1);
+    SDL_DestroyHashKey(unused, key, value);
+}
+
 static void SDLCALL SDL_FreeProperty(void *data, const void *key, const void *value)
 {
     SDL_FreePropertyWithCleanup(key, value, data, true);
@@ -85,11 +123,48 @@ static void SDL_FreeProperties(SDL_Properties *properties)
 {
     if (properties) {
         SDL_DestroyHashTable(properties->props);
+        SDL_DestroyRWLock(properties->rwlock);
         SDL_DestroyMutex(properties->lock);
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, sizeof(*properties));
         SDL_free(properties);
     }
 }
 
+static void SDL_LockPropertiesForWriting(SDL_Properties *properties)
+{
+    SDL_LockMutex(properties->lock);
+    if (properties->lock_depth++ == 0) {
+        SDL_LockRWLockForWriting(properties->rwlock);
+        properties->owner = SDL_GetCurrentThreadID();
+    }
+}
+
+static void SDL_UnlockPropertiesForWriting(SDL_Properties *properties)
+{
+    if (--properties->lock_depth == 0) {
+        properties->owner = 0;
+        SDL_UnlockRWLock(properties->rwlock);
+    }
+    SDL_UnlockMutex(properties->lock);
+}
+
+// Returns false if this thread already holds the properties for writing, and no lock was needed
+static bool SDL_LockPropertiesForReading(SDL_Properties *properties)
+{
+    if (properties->owner == SDL_GetCurrentThreadID()) {
+        return false;
+    }
+    SDL_LockRWLockForReading(properties->rwlock);
+    return true;
+}
+
+static void SDL_UnlockPropertiesForReading(SDL_Properties *properties, bool locked)
+{
+    if (locked) {
+        SDL_UnlockRWLock(properties->rwlock);
+    }
+}
+
 bool SDL_InitProperties(void)
 {
     if (!SDL_ShouldInit(&SDL_properties_init)) {
@@ -97,7 +172,14 @@ bool SDL_InitProperties(void)
     }
 
     SDL_properties = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
-    const bool initialized = (SDL_properties != NULL);
+    SDL_property_names = SDL_CreateHashTable(0, true, SDL_HashString, SDL_KeyMatchString, SDL_FreePropertyName, NULL);
+    const bool initialized = (SDL_properties != NULL && SDL_property_names != NULL);
+    if (!initialized) {
+        SDL_DestroyHashTable(SDL_properties);
+        SDL_properties = NULL;
+        SDL_DestroyHashTable(SDL_property_names);
+        SDL_property_names = NULL;
+    }
     SDL_SetInitialized(&SDL_properties_init, initialized);
     return initialized;
 }
@@ -131,6 +213,9 @@ void SDL_QuitProperties(void)
     SDL_IterateHashTable(properties, FreeOneProperties, NULL);
     SDL_DestroyHashTable(properties);
 
+    SDL_DestroyHashTable(SDL_property_names);
+    SDL_property_names = NULL;
+
     SDL_SetInitialized(&SDL_properties_init, false);
 }
 
@@ -139,6 +224,48 @@ static bool SDL_CheckInitProperties(void)
     return SDL_InitProperties();
 }
 
+// Returns NULL if no property has ever had this name, so it can't be set anywhere.
+static SDL_PropertyKey *SDL_FindPropertyKey(const char *name)
+{
+    const void *key = NULL;
+
+    if (name && *name && SDL_property_names) {
+        SDL_FindInHashTable(SDL_property_names, name, &key);
+    }
+    return (SDL_PropertyKey *)key;
+}
+
+static SDL_PropertyKey *SDL_InternPropertyKey(const char *name)
+{
+    SDL_PropertyKey *key = SDL_FindPropertyKey(name);
+    if (!key) {
+        char *copy = SDL_CreatePropertyString(name);
+        if (!copy) {
+            return NULL;
+        }
+        if (SDL_InsertIntoHashTable(SDL_property_names, copy, copy, false)) {
+            key = (SDL_PropertyKey *)copy;
+        } else {
+            // Somebody else added it first, use theirs
+            SDL_FreePropertyName(NULL, copy, copy);
+            key = SDL_FindPropertyKey(name);
+        }
+    }
+    return key;
+}
+
+SDL_PropertyKey *SDL_GetPropertyKey(const char *name)
+{
+    if (!name || !*name) {
+        SDL_InvalidParamError("name");
+        return NULL;
+    }
+    if (!SDL_CheckInitProperties()) {
+        return NULL;
+    }
+    return SDL_InternPropertyKey(name);
+}
+
 SDL_PropertiesID SDL_GetGlobalProperties(void)
 {
     SDL_PropertiesID props = SDL_GetAtomicU32(&SDL_global_properties);
@@ -169,13 +296,23 @@ SDL_PropertiesID SDL_CreateProperties(void)
         SDL_free(properties);
         return 0;
     }
+    SDL_SetMutexName(properties->lock, "SDL_Properties");
 
-    properties->props = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_FreeProperty, NULL);
+    properties->rwlock = SDL_CreateRWLock();
+    if (!properties->rwlock) {
+        SDL_DestroyMutex(properties->lock);
+        SDL_free(properties);
+        return 0;
+    }
+
+    properties->props = SDL_CreateHashTable(0, false, SDL_HashPointer, SDL_KeyMatchPointer, SDL_FreeProperty, NULL);
     if (!properties->props) {
+        SDL_DestroyRWLock(properties->rwlock);
         SDL_DestroyMutex(properties->lock);
         SDL_free(properties);
         return 0;
     }
+    SDL_AddTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, sizeof(*properties));
 
     SDL_PropertiesID props = 0;
     while (true) {
@@ -213,35 +350,29 @@ static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table,
 
     CopyOnePropertyData *data = (CopyOnePropertyData *) userdata;
     SDL_Properties *dst_properties = data->dst_properties;
-    const char *src_name = (const char *)key;
     SDL_Property *dst_property;
 
-    char *dst_name = SDL_strdup(src_name);
-    if (!dst_name) {
-        data->result = false;
-        return true; // keep iterating (I guess...?)
-    }
-
-    dst_property = (SDL_Property *)SDL_malloc(sizeof(*dst_property));
+    dst_property = SDL_CreateProperty(src_property->type);
     if (!dst_property) {
-        SDL_free(dst_name);
         data->result = false;
         return true; // keep iterating (I guess...?)
     }
 
     SDL_copyp(dst_property, src_property);
+    dst_property->string_storage = NULL;
     if (src_property->type == SDL_PROPERTY_TYPE_STRING) {
-        dst_property->value.string_value = SDL_strdup(src_property->value.string_value);
+        dst_property->value.string_value = SDL_CreatePropertyString(src_property->value.string_value);
         if (!dst_property->value.string_value) {
-            SDL_free(dst_name);
-            SDL_free(dst_property);
+            dst_property->type = SDL_PROPERTY_TYPE_INVALID;
+            SDL_FreePropertyWithCleanup(key, dst_property, NULL, false);
             data->result = false;
             return true; // keep iterating (I guess...?)
         }
     }
 
-    if (!SDL_InsertIntoHashTable(dst_properties->props, dst_name, dst_property, true)) {
-        SDL_FreePropertyWithCleanup(dst_name, dst_property, NULL, false);
+    // The names are interned, so the copy can share the key
+    if (!SDL_InsertIntoHashTable(dst_properties->props, key, dst_property, true)) {
+        SDL_FreePropertyWithCleanup(key, dst_property, NULL, false);
         data->result = false;
     }
 
@@ -270,15 +401,15 @@ bool SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
     }
 
     bool result = true;
-    SDL_LockMutex(src_properties->lock);
-    SDL_LockMutex(dst_properties->lock);
+    SDL_LockPropertiesForWriting(src_properties);
+    SDL_LockPropertiesForWriting(dst_properties);
     {
         CopyOnePropertyData data = { dst_properties, true };
         SDL_IterateHashTable(src_properties->props, CopyOneProperty, &data);
         result = data.result;
     }
-    SDL_UnlockMutex(dst_properties->lock);
-    SDL_UnlockMutex(src_properties->lock);
+    SDL_UnlockPropertiesForWriting(dst_properties);
+    SDL_UnlockPropertiesForWriting(src_properties);
 
     return result;
 }
@@ -296,7 +427,7 @@ bool SDL_LockProperties(SDL_PropertiesID props)
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockPropertiesForWriting(properties);
     return true;
 }
 
@@ -313,10 +444,10 @@ void SDL_UnlockProperties(SDL_PropertiesID props)
         return;
     }
 
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForWriting(properties);
 }
 
-static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
+static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, SDL_Property *property)
 {
     SDL_Properties *properties = NULL;
     bool result = true;
@@ -325,7 +456,7 @@ static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL
         SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
         return SDL_InvalidParamError("props");
     }
-    if (!name || !*name) {
+    if (!key && (!name || !*name)) {
         SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
         return SDL_InvalidParamError("name");
     }
@@ -336,23 +467,37 @@ static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    if (!key) {
+        if (!property) {
+            key = SDL_FindPropertyKey(name);
+            if (!key) {
+                return true;  // no property anywhere has this name, so there's nothing to clear
+            }
+        } else {
+            key = SDL_InternPropertyKey(name);
+            if (!key) {
+                SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+                return false;
+            }
+        }
+    }
+
+    SDL_LockPropertiesForWriting(properties);
     {
-        SDL_RemoveFromHashTable(properties->props, name);
+        SDL_RemoveFromHashTable(properties->props, key);
         if (property) {
-            char *key = SDL_strdup(name);
-            if (!key || !SDL_InsertIntoHashTable(properties->props, key, property, false)) {
-                SDL_FreePropertyWithCleanup(key, property, NULL, true);
+            if (!SDL_InsertIntoHashTable(properties->props, key, property, false)) {
+                SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
                 result = false;
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForWriting(properties);
 
     return result;
 }
 
-bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
+static bool SDL_PrivateSetPointerProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
     SDL_Property *property;
 
@@ -360,39 +505,38 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
         if (cleanup) {
             cleanup(userdata, value);
         }
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, name, key, NULL);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    property = SDL_CreateProperty(SDL_PROPERTY_TYPE_POINTER);
     if (!property) {
         if (cleanup) {
             cleanup(userdata, value);
         }
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, false);
         return false;
     }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
     property->value.pointer_value = value;
     property->cleanup = cleanup;
     property->userdata = userdata;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, key, property);
 }
 
-bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
-    SDL_Property *property;
+    return SDL_PrivateSetPointerProperty(props, name, NULL, value, cleanup, userdata);
+}
 
-    if (!value) {
-        return SDL_ClearProperty(props, name);
-    }
+bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+{
+    return SDL_PrivateSetPointerProperty(props, name, NULL, value, NULL, NULL);
+}
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
+bool SDL_SetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, void *value)
+{
+    if (!key) {
+        return SDL_InvalidParamError("key");
     }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
-    property->value.pointer_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetPointerProperty(props, NULL, key, value, NULL, NULL);
 }
 
 static void SDLCALL CleanupFreeableProperty(void *userdata, void *value)
@@ -417,58 +561,107 @@ bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surfac
     return SDL_SetPointerPropertyWithCleanup(props, name, surface, CleanupSurface, NULL);
 }
 
-bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
+static bool SDL_PrivateSetStringProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, const char *value)
 {
     SDL_Property *property;
 
     if (!value) {
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, name, key, NULL);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    property = SDL_CreateProperty(SDL_PROPERTY_TYPE_STRING);
     if (!property) {
         return false;
     }
-    property->type = SDL_PROPERTY_TYPE_STRING;
-    property->value.string_value = SDL_strdup(value);
+    property->value.string_value = SDL_CreatePropertyString(value);
     if (!property->value.string_value) {
-        SDL_free(property);
+        property->type = SDL_PROPERTY_TYPE_INVALID;
+        SDL_FreePropertyWithCleanup(NULL, property, NULL, false);
         return false;
     }
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, key, property);
 }
 
-bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    return SDL_PrivateSetStringProperty(props, name, NULL, value);
+}
+
+bool SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, const char *value)
+{
+    if (!key) {
+        return SDL_InvalidParamError("key");
+    }
+    return SDL_PrivateSetStringProperty(props, NULL, key, value);
+}
+
+static bool SDL_PrivateSetNumberProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, Sint64 value)
+{
+    SDL_Property *property = SDL_CreateProperty(SDL_PROPERTY_TYPE_NUMBER);
     if (!property) {
         return false;
     }
-    property->type = SDL_PROPERTY_TYPE_NUMBER;
     property->value.number_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, key, property);
 }
 
-bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    return SDL_PrivateSetNumberProperty(props, name, NULL, value);
+}
+
+bool SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, Sint64 value)
+{
+    if (!key) {
+        return SDL_InvalidParamError("key");
+    }
+    return SDL_PrivateSetNumberProperty(props, NULL, key, value);
+}
+
+static bool SDL_PrivateSetFloatProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, float value)
+{
+    SDL_Property *property = SDL_CreateProperty(SDL_PROPERTY_TYPE_FLOAT);
     if (!property) {
         return false;
     }
-    property->type = SDL_PROPERTY_TYPE_FLOAT;
     property->value.float_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, key, property);
 }
 
-bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    return SDL_PrivateSetFloatProperty(props, name, NULL, value);
+}
+
+bool SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, float value)
+{
+    if (!key) {
+        return SDL_InvalidParamError("key");
+    }
+    return SDL_PrivateSetFloatProperty(props, NULL, key, value);
+}
+
+static bool SDL_PrivateSetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key, bool value)
+{
+    SDL_Property *property = SDL_CreateProperty(SDL_PROPERTY_TYPE_BOOLEAN);
     if (!property) {
         return false;
     }
-    property->type = SDL_PROPERTY_TYPE_BOOLEAN;
     property->value.boolean_value = value ? true : false;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, key, property);
+}
+
+bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+{
+    return SDL_PrivateSetBooleanProperty(props, name, NULL, value);
+}
+
+bool SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, bool value)
+{
+    if (!key) {
+        return SDL_InvalidParamError("key");
+    }
+    return SDL_PrivateSetBooleanProperty(props, NULL, key, value);
 }
 
 bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
@@ -481,10 +674,8 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
     SDL_Properties *properties = NULL;
     SDL_PropertyType type = SDL_PROPERTY_TYPE_INVALID;
 
-    if (!props) {
-        return SDL_PROPERTY_TYPE_INVALID;
-    }
-    if (!name || !*name) {
+    SDL_PropertyKey *key = SDL_FindPropertyKey(name);
+    if (!props || !key) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
@@ -493,27 +684,24 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             type = property->type;
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return type;
 }
 
-void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+void *SDL_GetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, void *default_value)
 {
     SDL_Properties *properties = NULL;
     void *value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || !key) {
         return value;
     }
 
@@ -522,32 +710,54 @@ void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *def
         return value;
     }
 
-    // Note that taking the lock here only guarantees that we won't read the
+    // Note that taking the read lock here only guarantees that we won't read the
     // hashtable while it's being modified. The value itself can easily be
     // freed from another thread after it is returned here.
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             if (property->type == SDL_PROPERTY_TYPE_POINTER) {
                 value = property->value.pointer_value;
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+// Other readers may be formatting the same property at the same time, the first one to finish wins
+static const char *SDL_GetPropertyStringStorage(SDL_Property *property, const char *default_value, SDL_PRINTF_FORMAT_STRING const char *fmt, ...) SDL_PRINTF_VARARG_FUNC(3);
+static const char *SDL_GetPropertyStringStorage(SDL_Property *property, const char *default_value, SDL_PRINTF_FORMAT_STRING const char *fmt, ...)
+{
+    char *storage = (char *)SDL_GetAtomicPointer((void **)&property->string_storage);
+    if (!storage) {
+        va_list ap;
+        int rc;
+
+        va_start(ap, fmt);
+        rc = SDL_vasprintf(&storage, fmt, ap);
+        va_end(ap);
+        if (rc < 0) {
+            return default_value;
+        }
+        if (SDL_CompareAndSwapAtomicPointer((void **)&property->string_storage, NULL, storage)) {
+            SDL_AddTaggedMemory(SDL_MEMORY_TAG_PROPERTIES, (size_t)rc + 1);
+        } else {
+            SDL_free(storage);
+            storage = (char *)SDL_GetAtomicPointer((void **)&property->string_storage);
+        }
+    }
+    return storage;
+}
+
+const char *SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, const char *default_value)
 {
     SDL_Properties *properties = NULL;
     const char *value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || !key) {
         return value;
     }
 
@@ -556,33 +766,19 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = property->value.string_value;
                 break;
             case SDL_PROPERTY_TYPE_NUMBER:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%" SDL_PRIs64, property->value.number_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
-                }
+                value = SDL_GetPropertyStringStorage(property, value, "%" SDL_PRIs64, property->value.number_value);
                 break;
             case SDL_PROPERTY_TYPE_FLOAT:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%f", property->value.float_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
-                }
+                value = SDL_GetPropertyStringStorage(property, value, "%f", property->value.float_value);
                 break;
             case SDL_PROPERTY_TYPE_BOOLEAN:
                 value = property->value.boolean_value ? "true" : "false";
@@ -592,20 +788,17 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+Sint64 SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, Sint64 default_value)
 {
     SDL_Properties *properties = NULL;
     Sint64 value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || !key) {
         return value;
     }
 
@@ -614,10 +807,10 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (Sint64)SDL_strtoll(property->value.string_value, NULL, 0);
@@ -636,20 +829,17 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+float SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, float default_value)
 {
     SDL_Properties *properties = NULL;
     float value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || !key) {
         return value;
     }
 
@@ -658,10 +848,10 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (float)SDL_atof(property->value.string_value);
@@ -680,20 +870,17 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+bool SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey *key, bool default_value)
 {
     SDL_Properties *properties = NULL;
     bool value = default_value ? true : false;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || !key) {
         return value;
     }
 
@@ -702,10 +889,10 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = SDL_LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = SDL_GetStringBoolean(property->value.string_value, default_value);
@@ -724,14 +911,39 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
+void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+{
+    return SDL_GetPointerPropertyByKey(props, SDL_FindPropertyKey(name), default_value);
+}
+
+const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+{
+    return SDL_GetStringPropertyByKey(props, SDL_FindPropertyKey(name), default_value);
+}
+
+Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+{
+    return SDL_GetNumberPropertyByKey(props, SDL_FindPropertyKey(name), default_value);
+}
+
+float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+{
+    return SDL_GetFloatPropertyByKey(props, SDL_FindPropertyKey(name), default_value);
+}
+
+bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+{
+    return SDL_GetBooleanPropertyByKey(props, SDL_FindPropertyKey(name), default_value);
+}
+
 bool SDL_ClearProperty(SDL_PropertiesID props, const char *name)
 {
-    return SDL_PrivateSetProperty(props, name, NULL);
+    return SDL_PrivateSetProperty(props, name, NULL, NULL);
 }
 
 typedef struct EnumerateOnePropertyData
@@ -767,12 +979,12 @@ bool SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCall
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockPropertiesForWriting(properties);
     {
         EnumerateOnePropertyData data = { callback, userdata, props };
         SDL_IterateHashTable(properties->props, EnumerateOneProperty, &data);
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForWriting(properties);
 
     return true;
 }
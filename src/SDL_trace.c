@@ -0,0 +1,149 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Tracing zones, only recorded in builds with SDL_TRACING
+
+#ifdef SDL_TRACING
+
+#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#include "core/gdk/SDL_gdk.h"
+#define SDL_TRACE_PIX
+#elif defined(SDL_PLATFORM_WINDOWS) && defined(_MSC_VER)
+#include "core/windows/SDL_windows.h"
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+#define SDL_TRACE_ETW
+#endif
+
+#ifdef SDL_TRACING_TRACY
+#include <tracy/TracyC.h>
+SDL_COMPILE_TIME_ASSERT(tracy_location_size, sizeof(SDL_TraceLocation) == sizeof(struct ___tracy_source_location_data));
+#endif
+
+#ifdef SDL_TRACE_ETW
+// {ba33b103-f84f-4396-b036-c6520f611021}
+TRACELOGGING_DEFINE_PROVIDER(SDL_trace_provider, "SDL",
+    (0xba33b103, 0xf84f, 0x4396, 0xb0, 0x36, 0xc6, 0x52, 0x0f, 0x61, 0x10, 0x21));
+static bool SDL_trace_provider_registered;
+#endif
+
+static SDL_SpinLock trace_lock;
+static SDL_TraceCallback trace_callback;
+static void *trace_userdata;
+
+void SDL_InitTracing(void)
+{
+#ifdef SDL_TRACE_ETW
+    if (!SDL_trace_provider_registered) {
+        SDL_trace_provider_registered = SUCCEEDED(TraceLoggingRegister(SDL_trace_provider));
+    }
+#endif
+}
+
+void SDL_QuitTracing(void)
+{
+#ifdef SDL_TRACE_ETW
+    if (SDL_trace_provider_registered) {
+        TraceLoggingUnregister(SDL_trace_provider);
+        SDL_trace_provider_registered = false;
+    }
+#endif
+}
+
+static void SendTraceEvent(SDL_TraceEventType type, const char *name)
+{
+    SDL_TraceCallback callback;
+    void *userdata;
+
+    SDL_LockSpinlock(&trace_lock);
+    callback = trace_callback;
+    userdata = trace_userdata;
+    SDL_UnlockSpinlock(&trace_lock);
+
+    if (callback) {
+        callback(userdata, type, name, SDL_GetTicksNS());
+    }
+}
+
+Uint64 SDL_BeginTraceZone(const SDL_TraceLocation *location)
+{
+    Uint64 context = 0;
+
+#ifdef SDL_TRACE_ETW
+    TraceLoggingWrite(SDL_trace_provider, "Zone",
+                      TraceLoggingOpcode(WINEVENT_OPCODE_START),
+                      TraceLoggingString(location->name, "Name"));
+#endif
+#ifdef SDL_TRACE_PIX
+    GDK_BeginTraceEvent(location->name);
+#endif
+#ifdef SDL_TRACING_TRACY
+    {
+        const TracyCZoneCtx ctx = ___tracy_emit_zone_begin((const struct ___tracy_source_location_data *)location, 1);
+        context = (Uint64)ctx.id | ((Uint64)(Uint32)ctx.active << 32);
+    }
+#endif
+
+    SendTraceEvent(SDL_TRACE_EVENT_BEGIN, location->name);
+
+    return context;
+}
+
+void SDL_EndTraceZone(const SDL_TraceLocation *location, Uint64 context)
+{
+    SendTraceEvent(SDL_TRACE_EVENT_END, location->name);
+
+#ifdef SDL_TRACING_TRACY
+    {
+        TracyCZoneCtx ctx;
+        ctx.id = (Uint32)context;
+        ctx.active = (int)(Uint32)(context >> 32);
+        ___tracy_emit_zone_end(ctx);
+    }
+#endif
+#ifdef SDL_TRACE_PIX
+    GDK_EndTraceEvent();
+#endif
+#ifdef SDL_TRACE_ETW
+    TraceLoggingWrite(SDL_trace_provider, "Zone",
+                      TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+                      TraceLoggingString(location->name, "Name"));
+#endif
+}
+
+bool SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+    SDL_LockSpinlock(&trace_lock);
+    trace_callback = callback;
+    trace_userdata = userdata;
+    SDL_UnlockSpinlock(&trace_lock);
+    return true;
+}
+
+#else
+
+bool SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+    return SDL_Unsupported();
+}
+
+#endif // SDL_TRACING
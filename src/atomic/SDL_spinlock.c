@@ -161,14 +161,27 @@ bool SDL_TryLockSpinlock(SDL_SpinLock *lock)
 #endif
 }
 
+// How many pause instructions to spin for, in total and at most between attempts, before yielding
+#define SDL_SPINLOCK_SPIN_LIMIT    1024
+#define SDL_SPINLOCK_BACKOFF_LIMIT 64
+
 void SDL_LockSpinlock(SDL_SpinLock *lock)
 {
-    int iterations = 0;
+    int spins = 0;
+    int backoff = 1;
     // FIXME: Should we have an eventual timeout?
     while (!SDL_TryLockSpinlock(lock)) {
-        if (iterations < 32) {
-            iterations++;
-            SDL_CPUPauseInstruction();
+        if (spins < SDL_SPINLOCK_SPIN_LIMIT) {
+            /* Back off exponentially, so threads fighting over the lock don't
+               keep bouncing its cache line between them */
+            int i;
+            for (i = 0; i < backoff; ++i) {
+                SDL_CPUPauseInstruction();
+            }
+            spins += backoff;
+            if (backoff < SDL_SPINLOCK_BACKOFF_LIMIT) {
+                backoff *= 2;
+            }
         } else {
             // !!! FIXME: this doesn't definitely give up the current timeslice, it does different things on various platforms.
             SDL_Delay(0);
@@ -22,6 +22,7 @@
 
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
+#include "SDL_audioqueue.h"
 #include "../thread/SDL_systhread.h"
 
 // Available audio drivers
@@ -328,6 +329,17 @@ static int ZombieRecordDevice(SDL_AudioDevice *device, void *buffer, int buflen)
     return buflen;
 }
 
+static const Uint8 *ZombieGetRecordingBuf(SDL_AudioDevice *device, int *buffer_size)
+{
+    *buffer_size = ZombieRecordDevice(device, device->work_buffer, device->buffer_size);
+    return device->work_buffer;
+}
+
+static void ZombieReleaseRecordingBuf(SDL_AudioDevice *device, const Uint8 *buffer, int buflen)
+{
+    // no-op, this is our own buffer.
+}
+
 static void ZombieFlushRecording(SDL_AudioDevice *device)
 {
     // no-op, this is all imaginary.
@@ -524,6 +536,47 @@ static SDL_AudioDevice *ObtainPhysicalAudioDeviceDefaultAllowed(SDL_AudioDeviceI
     return NULL;
 }
 
+/* this finds the physical device associated with `devid` (defaults allowed) and references it, but does _not_ lock it.
+   Only use this for things that are safe to read while the device thread is running. Unref the result when done. */
+static SDL_AudioDevice *RefPhysicalAudioDeviceUnlocked(SDL_AudioDeviceID devid)
+{
+    if (!SDL_GetCurrentAudioDriver()) {
+        SDL_SetError("Audio subsystem is not initialized");
+        return NULL;
+    }
+
+    SDL_AudioDevice *device = NULL;
+
+    SDL_LockRWLockForReading(current_audio.device_hash_lock);
+    if (devid == SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK) {
+        devid = current_audio.default_playback_device_id;
+    } else if (devid == SDL_AUDIO_DEVICE_DEFAULT_RECORDING) {
+        devid = current_audio.default_recording_device_id;
+    }
+
+    // bit #1 of devid is set for physical devices and unset for logical.
+    const bool islogical = !(devid & (1<<1));
+    if (islogical) {
+        SDL_LogicalAudioDevice *logdev = NULL;
+        if (SDL_FindInHashTable(current_audio.device_hash, (const void *) (uintptr_t) devid, (const void **) &logdev)) {
+            device = (SDL_AudioDevice *) SDL_GetAtomicPointer((void **) &logdev->physical_device);
+        }
+    } else {
+        SDL_FindInHashTable(current_audio.device_hash, (const void *) (uintptr_t) devid, (const void **) &device);
+    }
+
+    if (device) {
+        RefPhysicalAudioDevice(device);
+    }
+    SDL_UnlockRWLock(current_audio.device_hash_lock);
+
+    if (!device) {
+        SDL_SetError("Invalid audio device instance ID");
+    }
+
+    return device;
+}
+
 // this assumes you hold the _physical_ device lock for this logical device! This will not unlock the lock or close the physical device!
 //  It also will not unref the physical device, since we might be shutting down; SDL_CloseAudioDevice handles the unref.
 static void DestroyLogicalAudioDevice(SDL_LogicalAudioDevice *logdev)
@@ -635,6 +688,7 @@ static SDL_AudioDevice *CreatePhysicalAudioDevice(const char *name, bool recordi
         SDL_free(device);
         return NULL;
     }
+    SDL_SetMutexName(device->lock, "SDL_AudioDevice");
 
     device->close_cond = SDL_CreateCondition();
     if (!device->close_cond) {
@@ -758,6 +812,8 @@ void SDL_AudioDeviceDisconnected(SDL_AudioDevice *device)
         device->PlayDevice = ZombiePlayDevice;
         device->WaitRecordingDevice = ZombieWaitDevice;
         device->RecordDevice = ZombieRecordDevice;
+        device->GetRecordingBuf = ZombieGetRecordingBuf;
+        device->ReleaseRecordingBuf = ZombieReleaseRecordingBuf;
         device->FlushRecording = ZombieFlushRecording;
 
         // on default devices, dump any logical devices that explicitly opened this device. Things that opened the system default can stay.
@@ -809,6 +865,7 @@ static void SDL_AudioThreadDeinit_Default(SDL_AudioDevice *device) { /* no-op. *
 static bool SDL_AudioWaitDevice_Default(SDL_AudioDevice *device) { return true; /* no-op. */ }
 static bool SDL_AudioPlayDevice_Default(SDL_AudioDevice *device, const Uint8 *buffer, int buffer_size) { return true; /* no-op. */ }
 static bool SDL_AudioWaitRecordingDevice_Default(SDL_AudioDevice *device) { return true; /* no-op. */ }
+static void SDL_AudioReleaseRecordingBuf_Default(SDL_AudioDevice *device, const Uint8 *buffer, int buflen) { /* no-op. */ }
 static void SDL_AudioFlushRecording_Default(SDL_AudioDevice *device) { /* no-op. */ }
 static void SDL_AudioCloseDevice_Default(SDL_AudioDevice *device) { /* no-op. */ }
 static void SDL_AudioDeinitializeStart_Default(void) { /* no-op. */ }
@@ -844,6 +901,13 @@ static int SDL_AudioRecordDevice_Default(SDL_AudioDevice *device, void *buffer,
     return -1;
 }
 
+// backends that don't hand out their own buffers copy into work_buffer.
+static const Uint8 *SDL_AudioGetRecordingBuf_Default(SDL_AudioDevice *device, int *buffer_size)
+{
+    *buffer_size = device->RecordDevice(device, device->work_buffer, device->buffer_size);
+    return device->work_buffer;
+}
+
 static bool SDL_AudioOpenDevice_Default(SDL_AudioDevice *device)
 {
     return SDL_Unsupported();
@@ -862,6 +926,8 @@ static void CompleteAudioEntryPoints(void)
     FILL_STUB(GetDeviceBuf);
     FILL_STUB(WaitRecordingDevice);
     FILL_STUB(RecordDevice);
+    FILL_STUB(GetRecordingBuf);
+    FILL_STUB(ReleaseRecordingBuf);
     FILL_STUB(FlushRecording);
     FILL_STUB(CloseDevice);
     FILL_STUB(FreeDeviceHandle);
@@ -924,6 +990,7 @@ bool SDL_InitAudio(const char *driver_name)
 
     SDL_ChooseAudioConverters();
     SDL_SetupAudioResampler();
+    SDL_InitAudioChunkPool();
 
     SDL_RWLock *device_hash_lock = SDL_CreateRWLock();  // create this early, so if it fails we don't have to tear down the whole audio subsystem.
     if (!device_hash_lock) {
@@ -1109,6 +1176,8 @@ void SDL_QuitAudio(void)
     SDL_DestroyRWLock(current_audio.device_hash_lock);
     SDL_DestroyHashTable(device_hash);
 
+    SDL_QuitAudioChunkPool();
+
     SDL_zero(current_audio);
 }
 
@@ -1125,8 +1194,344 @@ static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
 }
 
 
+/* Playback mix pool. When SDL_HINT_AUDIO_DEVICE_MIX_THREADS is set, each bound stream becomes a job that pulls its
+   data into a private buffer, and worker threads claim jobs from a shared counter. The device thread claims jobs
+   from the same counter, so anything the workers haven't started by the time it gets there is just done serially;
+   it only ever waits on jobs that are already running. Streams and bindings can't change while the device lock is
+   held, and the device thread holds it for the whole period, so the workers don't lock the device. */
+
+#define AUDIO_MIX_POOL_MAX_THREADS 16
+#define AUDIO_MIX_POOL_IDLE (SDL_MAX_SINT32 / 2)  // next_job between periods: every claim comes back out of range.
+
+typedef struct SDL_AudioMixJob
+{
+    SDL_AudioStream *stream;
+    float gain;
+    float *buffer;
+    int buffer_size;
+    int result;  // bytes the stream produced, or -1 on failure.
+} SDL_AudioMixJob;
+
+typedef struct SDL_AudioMixPool
+{
+    SDL_AudioDevice *device;
+    SDL_Thread *threads[AUDIO_MIX_POOL_MAX_THREADS];
+    int num_threads;
+    SDL_Semaphore *wake;
+    SDL_AtomicInt shutdown;
+    SDL_AtomicInt next_job;
+    SDL_AtomicInt finished_jobs;
+    SDL_AtomicInt active_workers;
+    SDL_AudioMixJob *jobs;
+    int num_jobs;
+    int jobs_allocation;
+    int work_buffer_size;  // bytes each job asks its stream for this period.
+} SDL_AudioMixPool;
+
+/* Get a bound stream's part of the device buffer that starts at device frame `stats_frames_mixed`. If the stream
+   is scheduled, it's only read within its window and the rest is silence, which doesn't count as coming up short. */
+static int GetBoundAudioStreamData(const SDL_AudioDevice *device, SDL_AudioStream *stream, Uint8 *buf, int len, float gain, Uint8 silence_value)
+{
+    SDL_LockMutex(stream->lock);  // this is recursive, it's held again while getting data.
+
+    const Uint64 start_frame = stream->scheduled_start_frame;
+    const Uint64 stop_frame = stream->scheduled_stop_frame;
+    if (!start_frame && !stop_frame) {
+        const int br = SDL_GetAudioStreamDataAdjustGain(stream, buf, len, gain);
+        SDL_UnlockMutex(stream->lock);
+        return br;
+    }
+
+    const int frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
+    const Uint64 first_frame = device->stats_frames_mixed;
+    const int frames = len / frame_size;
+    int begin = 0;
+    int end = frames;
+
+    if (start_frame > first_frame) {
+        begin = (int) SDL_min(start_frame - first_frame, (Uint64) frames);
+    }
+    if (stop_frame) {
+        end = (stop_frame > first_frame) ? (int) SDL_min(stop_frame - first_frame, (Uint64) frames) : 0;
+    }
+
+    if (begin >= end) {
+        SDL_UnlockMutex(stream->lock);
+        SDL_memset(buf, silence_value, len);
+        return len;
+    }
+
+    SDL_memset(buf, silence_value, begin * frame_size);
+    int br = SDL_GetAudioStreamDataAdjustGain(stream, buf + (begin * frame_size), (end - begin) * frame_size, gain);
+    SDL_UnlockMutex(stream->lock);
+
+    if (br < 0) {
+        return br;
+    } else if (br == (end - begin) * frame_size) {
+        SDL_memset(buf + (end * frame_size), silence_value, len - (end * frame_size));
+        return len;
+    }
+    return (begin * frame_size) + br;
+}
+
+static void RunAudioMixJob(SDL_AudioMixPool *pool, SDL_AudioMixJob *job)
+{
+    const SDL_AudioDevice *device = pool->device;
+    const int br = GetBoundAudioStreamData(device, job->stream, (Uint8 *) job->buffer, pool->work_buffer_size, job->gain, 0);
+    // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
+    if ((br > 0) && !SDL_AudioChannelMapsEqual(device->spec.channels, job->stream->dst_chmap, device->chmap)) {
+        ConvertAudio(br / (int) (sizeof (float) * device->spec.channels), job->buffer, SDL_AUDIO_F32, device->spec.channels, NULL,
+                     job->buffer, SDL_AUDIO_F32, device->spec.channels, device->chmap, NULL, 1.0f);
+    }
+    job->result = br;
+}
+
+static void RunAudioMixJobs(SDL_AudioMixPool *pool)
+{
+    while (true) {
+        const int i = SDL_AddAtomicInt(&pool->next_job, 1);
+        if (i >= pool->num_jobs) {
+            break;  // nothing left to claim (or we're between periods).
+        }
+        SDL_MemoryBarrierAcquire();
+        RunAudioMixJob(pool, &pool->jobs[i]);
+        SDL_MemoryBarrierRelease();
+        SDL_AddAtomicInt(&pool->finished_jobs, 1);
+    }
+}
+
+static int SDLCALL AudioMixPoolThread(void *data)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) data;
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);  // we're on the device thread's deadline.
+    while (true) {
+        SDL_WaitSemaphore(pool->wake);
+        if (SDL_GetAtomicInt(&pool->shutdown)) {
+            break;
+        }
+        SDL_AddAtomicInt(&pool->active_workers, 1);
+        RunAudioMixJobs(pool);
+        SDL_AddAtomicInt(&pool->active_workers, -1);
+    }
+    return 0;
+}
+
+static void DestroyAudioMixPool(SDL_AudioMixPool *pool)
+{
+    if (pool) {
+        SDL_SetAtomicInt(&pool->shutdown, 1);
+        for (int i = 0; i < pool->num_threads; i++) {
+            SDL_SignalSemaphore(pool->wake);
+        }
+        for (int i = 0; i < pool->num_threads; i++) {
+            SDL_WaitThread(pool->threads[i], NULL);
+        }
+        for (int i = 0; i < pool->jobs_allocation; i++) {
+            SDL_aligned_free(pool->jobs[i].buffer);
+        }
+        SDL_free(pool->jobs);
+        SDL_DestroySemaphore(pool->wake);
+        SDL_free(pool);
+    }
+}
+
+// Returns NULL if the hint isn't set or something fails; the device just mixes serially then.
+static SDL_AudioMixPool *CreateAudioMixPool(SDL_AudioDevice *device)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    const int hint_threads = hint ? SDL_atoi(hint) : 0;
+    const int num_threads = SDL_min(hint_threads, AUDIO_MIX_POOL_MAX_THREADS);
+    if (device->recording || (num_threads <= 0)) {
+        return NULL;
+    }
+
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) SDL_calloc(1, sizeof (*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->device = device;
+    SDL_SetAtomicInt(&pool->next_job, AUDIO_MIX_POOL_IDLE);
+    pool->wake = SDL_CreateSemaphore(0);
+    if (!pool->wake) {
+        SDL_free(pool);
+        return NULL;
+    }
+
+    char devname[32];
+    SDL_GetAudioThreadName(device, devname, sizeof (devname));
+    for (int i = 0; i < num_threads; i++) {
+        char threadname[64];
+        (void)SDL_snprintf(threadname, sizeof (threadname), "%sm%d", devname, i);
+        pool->threads[i] = SDL_CreateThread(AudioMixPoolThread, threadname, pool);
+        if (!pool->threads[i]) {
+            break;  // keep however many we got.
+        }
+        pool->num_threads++;
+    }
+
+    if (pool->num_threads == 0) {
+        DestroyAudioMixPool(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+// Makes sure there are enough jobs, with big enough buffers, for this period.
+static bool PrepareAudioMixJobs(SDL_AudioMixPool *pool, int num_jobs, int work_buffer_size)
+{
+    if (num_jobs > pool->jobs_allocation) {
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(pool->jobs, num_jobs * sizeof (*jobs));
+        if (!jobs) {
+            return false;
+        }
+        SDL_memset(jobs + pool->jobs_allocation, '\0', (num_jobs - pool->jobs_allocation) * sizeof (*jobs));
+        pool->jobs = jobs;
+        pool->jobs_allocation = num_jobs;
+    }
+
+    for (int i = 0; i < num_jobs; i++) {
+        SDL_AudioMixJob *job = &pool->jobs[i];
+        if (job->buffer_size < work_buffer_size) {
+            SDL_aligned_free(job->buffer);
+            job->buffer = (float *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), work_buffer_size);
+            job->buffer_size = job->buffer ? work_buffer_size : 0;
+            if (!job->buffer) {
+                return false;
+            }
+        }
+    }
+
+    pool->num_jobs = num_jobs;
+    pool->work_buffer_size = work_buffer_size;
+    return true;
+}
+
+// Pulls every unpaused bound stream through the pool and mixes the results. Returns false if nothing was mixed, so the caller should mix serially instead.
+static bool MixPlaybackAudioWithPool(SDL_AudioDevice *device, float *final_mix_buffer, int work_buffer_size, const SDL_AudioSpec *outspec, int *underrun_frames, bool *failed)
+{
+    SDL_AudioMixPool *pool = device->mix_pool;
+    int num_jobs = 0;
+
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (!SDL_GetAtomicInt(&logdev->paused)) {
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                num_jobs++;
+            }
+        }
+    }
+
+    if ((num_jobs < 2) || !PrepareAudioMixJobs(pool, num_jobs, work_buffer_size)) {
+        return false;  // nothing to split up, or out of memory; the serial path works fine either way.
+    }
+
+    SDL_AudioMixJob *job = pool->jobs;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (SDL_GetAtomicInt(&logdev->paused)) {
+            continue;
+        }
+
+        // streams can't be read until the app's iteration callback has run, so do all of these up front.
+        if (logdev->iteration_start) {
+            logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
+        }
+
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            // We should have updated this elsewhere if the format changed!
+            SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, outspec, NULL, NULL));
+            job->stream = stream;
+            job->gain = logdev->gain;
+            job->result = 0;
+            job++;
+        }
+    }
+
+    // start the period: publish the jobs, wake the workers, and pitch in ourselves.
+    SDL_SetAtomicInt(&pool->finished_jobs, 0);
+    SDL_MemoryBarrierRelease();
+    SDL_SetAtomicInt(&pool->next_job, 0);
+    const int wakeups = SDL_min(pool->num_threads, num_jobs - 1);
+    for (int i = 0; i < wakeups; i++) {
+        SDL_SignalSemaphore(pool->wake);
+    }
+
+    RunAudioMixJobs(pool);
+
+    // everything is claimed now; only wait for jobs a worker is in the middle of.
+    while (SDL_GetAtomicInt(&pool->finished_jobs) < num_jobs) {
+        SDL_CPUPauseInstruction();
+    }
+    SDL_MemoryBarrierAcquire();
+
+    // end the period. Wait out any worker still looking at this period's job count before we change it.
+    SDL_SetAtomicInt(&pool->next_job, AUDIO_MIX_POOL_IDLE);
+    while (SDL_GetAtomicInt(&pool->active_workers) > 0) {
+        SDL_CPUPauseInstruction();
+    }
+
+    job = pool->jobs;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (SDL_GetAtomicInt(&logdev->paused)) {
+            continue;
+        }
+
+        const SDL_AudioPostmixCallback postmix = logdev->postmix;
+        float *mix_buffer = final_mix_buffer;
+        if (postmix) {
+            mix_buffer = device->postmix_buffer;
+            SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
+        }
+
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding, job++) {
+            const int br = job->result;
+            if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                *failed = true;
+                continue;
+            }
+
+            if (br < work_buffer_size) {  // the stream came up short, so this part of the buffer stays silent.
+                *underrun_frames = SDL_max(*underrun_frames, (work_buffer_size - br) / (int) (sizeof (float) * device->spec.channels));
+            }
+
+            if (br > 0) {
+                MixFloat32Audio(mix_buffer, job->buffer, br);
+            }
+        }
+
+        if (logdev->iteration_end) {
+            logdev->iteration_end(logdev->iteration_userdata, logdev->instance_id, false);
+        }
+
+        if (postmix) {
+            SDL_assert(mix_buffer == device->postmix_buffer);
+            postmix(logdev->postmix_userdata, outspec, mix_buffer, work_buffer_size);
+            MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size);
+        }
+    }
+
+    return true;
+}
+
+
 // Playback device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
+// Called on the device thread with the device lock held. Readers don't take the lock, so this uses a sequence counter instead.
+static void UpdateAudioDeviceStatistics(SDL_AudioDevice *device, int silence_frames, int mixed_frames)
+{
+    SDL_AddAtomicInt(&device->stats_sequence, 1);  // odd: an update is in progress.
+    SDL_MemoryBarrierRelease();
+    if (silence_frames > 0) {
+        device->stats_underruns++;
+        device->stats_silence_frames += silence_frames;
+    }
+    device->stats_frames_mixed += mixed_frames;
+    device->stats_last_buffer_frames = mixed_frames;
+    device->stats_last_iteration_ns = SDL_GetTicksNS();
+    SDL_MemoryBarrierRelease();
+    SDL_AddAtomicInt(&device->stats_sequence, 1);  // even: done.
+}
+
 void SDL_PlaybackAudioThreadSetup(SDL_AudioDevice *device)
 {
     SDL_assert(!device->recording);
@@ -1144,7 +1549,10 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         return false;  // we're done, shut it down.
     }
 
+    SDL_TRACE_ZONE_BEGIN(zone, "SDL_PlaybackAudioThreadIterate");
+
     bool failed = false;
+    int underrun_frames = 0;
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
     if (buffer_size == 0) {
@@ -1170,7 +1578,7 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                     logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
                 }
 
-                br = SDL_GetAudioStreamDataAdjustGain(stream, device_buffer, buffer_size, logdev->gain);
+                br = GetBoundAudioStreamData(device, stream, device_buffer, buffer_size, logdev->gain, device->silence_value);
 
                 if (logdev->iteration_end) {
                     logdev->iteration_end(logdev->iteration_userdata, logdev->instance_id, false);
@@ -1182,6 +1590,9 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
             } else if (br < buffer_size) {
                 SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
+                if (!SDL_GetAtomicInt(&logdev->paused)) {
+                    underrun_frames = (buffer_size - br) / SDL_AUDIO_FRAMESIZE(device->spec);
+                }
             }
 
             // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
@@ -1202,7 +1613,9 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
-            for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+            const bool pooled = device->mix_pool && MixPlaybackAudioWithPool(device, final_mix_buffer, work_buffer_size, &outspec, &underrun_frames, &failed);
+
+            for (SDL_LogicalAudioDevice *logdev = pooled ? NULL : device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_GetAtomicInt(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
                 }
@@ -1226,11 +1639,17 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
+                    const int br = GetBoundAudioStreamData(device, stream, device->work_buffer, work_buffer_size, logdev->gain, 0);
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = true;
                         break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
+                    }
+
+                    if (br < work_buffer_size) {  // the stream came up short, so this part of the buffer stays silent.
+                        underrun_frames = SDL_max(underrun_frames, (work_buffer_size - br) / (int) (sizeof (float) * device->spec.channels));
+                    }
+
+                    if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
                         // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
                         if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
                             ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
@@ -1263,10 +1682,14 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         if (!device->PlayDevice(device, device_buffer, buffer_size)) {
             failed = true;
         }
+
+        UpdateAudioDeviceStatistics(device, underrun_frames, buffer_size / SDL_AUDIO_FRAMESIZE(device->spec));
     }
 
     SDL_UnlockMutex(device->lock);
 
+    SDL_TRACE_ZONE_END(zone);
+
     if (failed) {
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
@@ -1330,7 +1753,11 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
         device->FlushRecording(device); // nothing wants data, dump anything pending.
     } else {
         // this SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitRecordingDevice!
-        int br = device->RecordDevice(device, device->work_buffer, device->buffer_size);
+        // This might be the backend's own buffer, so it's read straight into each stream without another copy.
+        int buffer_size = 0;
+        const Uint8 *record_buffer = device->GetRecordingBuf(device, &buffer_size);
+        int br = buffer_size;
+        SDL_assert(record_buffer || (br <= 0));
         if (br < 0) {  // uhoh, device failed for some reason!
             failed = true;
         } else if (br > 0) {  // queue the new data to each bound stream.
@@ -1339,7 +1766,7 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                     continue;  // paused? Skip this logical device.
                 }
 
-                void *output_buffer = device->work_buffer;
+                const void *output_buffer = record_buffer;
 
                 // I don't know why someone would want a postmix on a recording device, but we offer it for API consistency.
                 if (logdev->postmix || (logdev->gain != 1.0f)) {
@@ -1350,7 +1777,7 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                     output_buffer = device->postmix_buffer;
                     const int frames = br / SDL_AUDIO_FRAMESIZE(device->spec);
                     br = frames * SDL_AUDIO_FRAMESIZE(outspec);
-                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, NULL, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL, NULL, logdev->gain);
+                    ConvertAudio(frames, record_buffer, device->spec.format, outspec.channels, NULL, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL, NULL, logdev->gain);
                     if (logdev->postmix) {
                         logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, br);
                     }
@@ -1362,13 +1789,13 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                     SDL_assert(stream->src_spec.channels == device->spec.channels);
                     SDL_assert(stream->src_spec.freq == device->spec.freq);
 
-                    void *final_buf = output_buffer;
+                    const void *final_buf = output_buffer;
 
                     // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to stream layout.
                     if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->src_chmap, device->chmap)) {
                         final_buf = device->mix_buffer;  // this is otherwise unused on recording devices, so it makes convenient scratch space here.
                         ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), output_buffer, device->spec.format, device->spec.channels, NULL,
-                                     final_buf, device->spec.format, device->spec.channels, stream->src_chmap, NULL, 1.0f);
+                                     device->mix_buffer, device->spec.format, device->spec.channels, stream->src_chmap, NULL, 1.0f);
                     }
 
                     /* this will hold a lock on `stream` while putting. We don't explicitly lock the streams
@@ -1383,8 +1810,14 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                 }
             }
         }
+
+        if (record_buffer) {
+            device->ReleaseRecordingBuf(device, record_buffer, buffer_size);
+        }
     }
 
+    UpdateAudioDeviceStatistics(device, 0, 0);
+
     SDL_UnlockMutex(device->lock);
 
     if (failed) {
@@ -1619,6 +2052,75 @@ int *SDL_GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count)
     return result;
 }
 
+bool SDL_GetAudioDeviceStatistics(SDL_AudioDeviceID devid, SDL_AudioDeviceStatistics *stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_AudioDevice *device = RefPhysicalAudioDeviceUnlocked(devid);
+    if (!device) {
+        return false;
+    }
+
+    // the device thread bumps the sequence to odd before updating and back to even after, so retry if we raced it.
+    int sequence;
+    do {
+        sequence = SDL_GetAtomicInt(&device->stats_sequence);
+        SDL_MemoryBarrierAcquire();
+        stats->underruns = device->stats_underruns;
+        stats->silence_frames = device->stats_silence_frames;
+        stats->last_iteration_ns = device->stats_last_iteration_ns;
+        stats->frames_mixed = device->stats_frames_mixed;
+        SDL_MemoryBarrierAcquire();
+    } while ((sequence & 1) || (sequence != SDL_GetAtomicInt(&device->stats_sequence)));
+
+    stats->latency_ns = SDL_GetAtomicU32(&device->stats_latency_ns);
+    stats->padding_frames = SDL_GetAtomicU32(&device->stats_padding_frames);
+
+    UnrefPhysicalAudioDevice(device);
+    return true;
+}
+
+Uint64 SDL_GetAudioDeviceFrameTicksNS(SDL_AudioDeviceID devid, Uint64 frame)
+{
+    SDL_AudioDevice *device = RefPhysicalAudioDeviceUnlocked(devid);
+    if (!device) {
+        return 0;
+    } else if (device->recording) {
+        UnrefPhysicalAudioDevice(device);
+        SDL_SetError("Frame times are only available for playback devices");
+        return 0;
+    }
+
+    int sequence;
+    Uint64 buffer_frame, buffer_ns;
+    do {
+        sequence = SDL_GetAtomicInt(&device->stats_sequence);
+        SDL_MemoryBarrierAcquire();
+        buffer_frame = device->stats_frames_mixed - device->stats_last_buffer_frames;
+        buffer_ns = device->stats_last_iteration_ns;
+        SDL_MemoryBarrierAcquire();
+    } while ((sequence & 1) || (sequence != SDL_GetAtomicInt(&device->stats_sequence)));
+
+    const Sint64 freq = device->spec.freq;
+    buffer_ns += SDL_GetAtomicU32(&device->stats_latency_ns);
+    UnrefPhysicalAudioDevice(device);
+
+    if (buffer_ns == 0 || freq <= 0) {
+        SDL_SetError("Device hasn't started playing yet");
+        return 0;
+    }
+
+    // split the conversion so large frame distances don't overflow.
+    const Sint64 distance = (Sint64)(frame - buffer_frame);
+    const Sint64 offset_ns = ((distance / freq) * (Sint64)SDL_NS_PER_SECOND) + (((distance % freq) * (Sint64)SDL_NS_PER_SECOND) / freq);
+    if (offset_ns < 0 && (Uint64)-offset_ns >= buffer_ns) {
+        return 1;  // long before the clock started, just keep this nonzero.
+    }
+    return buffer_ns + offset_ns;
+}
+
 
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
@@ -1654,6 +2156,9 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
         device->hidden = NULL;  // just in case.
     }
 
+    DestroyAudioMixPool(device->mix_pool);  // nothing is iterating the device anymore, so the workers are idle.
+    device->mix_pool = NULL;
+
     SDL_LockMutex(device->lock);
     SDL_SetAtomicInt(&device->shutdown, 0);  // ready to go again.
     SDL_BroadcastCondition(device->close_cond);  // release anyone waiting in SerializePhysicalDeviceClose; they'll still block until we release device->lock, though.
@@ -1670,6 +2175,10 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
+
+    // the driver-reported values are stale once the backend lets go of the device. The counters are kept for the device's lifetime.
+    SDL_SetAtomicU32(&device->stats_padding_frames, 0);
+    SDL_SetAtomicU32(&device->stats_latency_ns, 0);
 }
 
 void SDL_CloseAudioDevice(SDL_AudioDeviceID devid)
@@ -1778,6 +2287,8 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     device->GetDeviceBuf = current_audio.impl.GetDeviceBuf;
     device->WaitRecordingDevice = current_audio.impl.WaitRecordingDevice;
     device->RecordDevice = current_audio.impl.RecordDevice;
+    device->GetRecordingBuf = current_audio.impl.GetRecordingBuf;
+    device->ReleaseRecordingBuf = current_audio.impl.ReleaseRecordingBuf;
     device->FlushRecording = current_audio.impl.FlushRecording;
 
     SDL_AudioSpec spec;
@@ -1822,6 +2333,8 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    device->mix_pool = CreateAudioMixPool(device);  // optional; if this fails, we just mix on the device thread.
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         char threadname[64];
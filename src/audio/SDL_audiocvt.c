@@ -29,6 +29,9 @@
 #define SDL_INT_MAX ((int)(~0u>>1))
 #endif
 
+// Multi-stage conversions are done this many frames at a time, so a block of 8 channel float data fits comfortably in L1 cache.
+#define AUDIO_CONVERT_BLOCK_FRAMES 256
+
 #ifdef SDL_SSE3_INTRINSICS
 // Convert from stereo to mono. Average left and right.
 static void SDL_TARGETING("sse3") SDL_ConvertStereoToMono_SSE3(float *dst, const float *src, int num_frames)
@@ -234,26 +237,11 @@ static void SwizzleAudio(const int num_frames, void *dst, const void *src, int c
 // Since this is a convenient point that audio goes through even if it doesn't need format conversion,
 // we also handle gain adjustment here, so we don't have to make another pass over the data later.
 // Strictly speaking, this is also a "conversion".  :)
-void ConvertAudio(int num_frames,
-                  const void *src, SDL_AudioFormat src_format, int src_channels, const int *src_map,
-                  void *dst, SDL_AudioFormat dst_format, int dst_channels, const int *dst_map,
-                  void *scratch, float gain)
+static void ConvertAudioBlock(int num_frames,
+                              const void *src, SDL_AudioFormat src_format, int src_channels, const int *src_map,
+                              void *dst, SDL_AudioFormat dst_format, int dst_channels, const int *dst_map,
+                              void *scratch, float gain)
 {
-    SDL_assert(src != NULL);
-    SDL_assert(dst != NULL);
-    SDL_assert(SDL_IsSupportedAudioFormat(src_format));
-    SDL_assert(SDL_IsSupportedAudioFormat(dst_format));
-    SDL_assert(SDL_IsSupportedChannelCount(src_channels));
-    SDL_assert(SDL_IsSupportedChannelCount(dst_channels));
-
-    if (!num_frames) {
-        return;  // no data to convert, quit.
-    }
-
-#if DEBUG_AUDIO_CONVERT
-    SDL_Log("SDL_AUDIO_CONVERT: Convert format %04x->%04x, channels %u->%u", src_format, dst_format, src_channels, dst_channels);
-#endif
-
     const int dst_bitsize = (int) SDL_AUDIO_BITSIZE(dst_format);
     const int dst_sample_frame_size = (dst_bitsize / 8) * dst_channels;
 
@@ -388,6 +376,64 @@ void ConvertAudio(int num_frames,
     }
 }
 
+static bool AudioBuffersOverlap(const void *a, size_t alen, const void *b, size_t blen)
+{
+    const Uint8 *a8 = (const Uint8 *) a;
+    const Uint8 *b8 = (const Uint8 *) b;
+    return (a8 < (b8 + blen)) && (b8 < (a8 + alen));
+}
+
+void ConvertAudio(int num_frames,
+                  const void *src, SDL_AudioFormat src_format, int src_channels, const int *src_map,
+                  void *dst, SDL_AudioFormat dst_format, int dst_channels, const int *dst_map,
+                  void *scratch, float gain)
+{
+    SDL_assert(src != NULL);
+    SDL_assert(dst != NULL);
+    SDL_assert(SDL_IsSupportedAudioFormat(src_format));
+    SDL_assert(SDL_IsSupportedAudioFormat(dst_format));
+    SDL_assert(SDL_IsSupportedChannelCount(src_channels));
+    SDL_assert(SDL_IsSupportedChannelCount(dst_channels));
+
+    if (!num_frames) {
+        return;  // no data to convert, quit.
+    }
+
+#if DEBUG_AUDIO_CONVERT
+    SDL_Log("SDL_AUDIO_CONVERT: Convert format %04x->%04x, channels %u->%u", src_format, dst_format, src_channels, dst_channels);
+#endif
+
+    /* A multi-stage conversion (say, S16 stereo to F32 5.1) makes a pass over the data for each stage.
+       If src, dst and scratch are separate buffers, run all the stages on one small block at a time
+       instead, so the intermediate float data stays in cache and each input and output byte only
+       goes through memory once. In-place conversions have to go in one shot, since a stage that
+       grows the data would overwrite source frames we haven't read yet. */
+    if (scratch && (num_frames > AUDIO_CONVERT_BLOCK_FRAMES)) {
+        const size_t src_frame_size = (size_t) SDL_AUDIO_BYTESIZE(src_format) * src_channels;
+        const size_t dst_frame_size = (size_t) SDL_AUDIO_BYTESIZE(dst_format) * dst_channels;
+        const size_t max_format_size = SDL_max(SDL_max(SDL_AUDIO_BYTESIZE(src_format), SDL_AUDIO_BYTESIZE(dst_format)), sizeof (float));
+        const size_t scratch_frame_size = max_format_size * SDL_max(src_channels, dst_channels);
+        const size_t total_frames = (size_t) num_frames;
+
+        if (!AudioBuffersOverlap(src, total_frames * src_frame_size, dst, total_frames * dst_frame_size) &&
+            !AudioBuffersOverlap(src, total_frames * src_frame_size, scratch, total_frames * scratch_frame_size) &&
+            !AudioBuffersOverlap(dst, total_frames * dst_frame_size, scratch, total_frames * scratch_frame_size)) {
+            const Uint8 *src8 = (const Uint8 *) src;
+            Uint8 *dst8 = (Uint8 *) dst;
+            while (num_frames > 0) {
+                const int frames = SDL_min(num_frames, AUDIO_CONVERT_BLOCK_FRAMES);
+                ConvertAudioBlock(frames, src8, src_format, src_channels, src_map, dst8, dst_format, dst_channels, dst_map, scratch, gain);
+                src8 += frames * src_frame_size;
+                dst8 += frames * dst_frame_size;
+                num_frames -= frames;
+            }
+            return;
+        }
+    }
+
+    ConvertAudioBlock(num_frames, src, src_format, src_channels, src_map, dst, dst_format, dst_channels, dst_map, scratch, gain);
+}
+
 // Calculate the largest frame size needed to convert between the two formats.
 static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, SDL_AudioFormat dst_format, int dst_channels)
 {
@@ -405,6 +451,11 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq,
 
     Sint64 resample_rate = SDL_GetResampleRate(src_freq, stream->dst_spec.freq);
 
+    // Scale the fixed point step directly, rate control makes changes far smaller than 1Hz
+    if (stream->rate_adjustment != 1.0f) {
+        resample_rate = (Sint64)((double)resample_rate * (double)stream->rate_adjustment);
+    }
+
     // If src_freq == dst_freq, and we aren't between frames, don't resample
     if ((resample_rate == 0x100000000) && (resample_offset == 0)) {
         resample_rate = 0;
@@ -436,7 +487,50 @@ static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioS
     return true;
 }
 
+// you MUST hold `stream->lock` when calling this! Moves anything a single-producer stream's producer has written into the queue.
+static bool DrainAudioStreamProducerRing(SDL_AudioStream *stream)
+{
+    if (!stream->producer_ring) {
+        return true;
+    }
+
+    const Uint32 write_pos = SDL_GetAtomicU32(&stream->producer_write_pos);
+    SDL_MemoryBarrierAcquire();  // make sure we see the data the producer wrote before it moved write_pos.
+    const Uint32 read_pos = SDL_GetAtomicU32(&stream->producer_read_pos);
+    const Uint32 avail = write_pos - read_pos;
+
+    if (avail == 0) {
+        return true;
+    }
+
+    // This might split a sample frame across the end of the ring, but the queue just appends bytes, so that's fine.
+    const Uint32 offset = read_pos & (stream->producer_ring_size - 1);
+    const Uint32 first = SDL_min(avail, stream->producer_ring_size - offset);
+    bool result = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, stream->producer_ring + offset, first);
+    if (result && (first < avail)) {
+        result = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, stream->producer_ring, avail - first);
+    }
+
+    SDL_MemoryBarrierRelease();  // we're done reading this space before the producer can reuse it.
+    SDL_SetAtomicU32(&stream->producer_read_pos, write_pos);  // if we ran out of memory, this data is lost, like it would be in a normal put.
+
+    return result;
+}
+
+// you MUST hold `stream->lock` when calling this! Throws away anything a single-producer stream's producer has written.
+static void ClearAudioStreamProducerRing(SDL_AudioStream *stream)
+{
+    if (stream->producer_ring) {
+        SDL_SetAtomicU32(&stream->producer_read_pos, SDL_GetAtomicU32(&stream->producer_write_pos));
+    }
+}
+
 SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+{
+    return SDL_CreateAudioStreamWithProperties(src_spec, dst_spec, 0);
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamWithProperties(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, SDL_PropertiesID props)
 {
     SDL_ChooseAudioConverters();
     SDL_SetupAudioResampler();
@@ -448,6 +542,8 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
+    result->smoothed_latency_ms = -1.0f;
+    result->rate_adjustment = 1.0f;
     result->queue = SDL_CreateAudioQueue(8192);
 
     if (!result->queue) {
@@ -461,6 +557,33 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
         SDL_free(result);
         return NULL;
     }
+    SDL_SetMutexName(result->lock, "SDL_AudioStream");
+
+    const Sint64 quality = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER, SDL_AUDIO_RESAMPLE_SINC);
+    result->resample_quality = (SDL_AudioResampleQuality) SDL_clamp(quality, SDL_AUDIO_RESAMPLE_NEAREST, SDL_AUDIO_RESAMPLE_SINC);
+
+    if (SDL_GetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BOOLEAN, false)) {
+        Sint64 ring_size = 64 * 1024;
+        if (src_spec && SDL_IsSupportedAudioFormat(src_spec->format) && SDL_IsSupportedChannelCount(src_spec->channels) && (src_spec->freq > 0)) {
+            ring_size = ((Sint64) SDL_AUDIO_FRAMESIZE(*src_spec) * src_spec->freq) / 4;  // about a quarter second.
+        }
+        ring_size = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BUFFER_SIZE_NUMBER, ring_size);
+        ring_size = SDL_clamp(ring_size, 4096, 1 << 30);
+
+        result->producer_ring_size = 4096;
+        while (result->producer_ring_size < (Uint32) ring_size) {
+            result->producer_ring_size <<= 1;
+        }
+
+        result->producer_ring = (Uint8 *) SDL_malloc(result->producer_ring_size);
+        if (!result->producer_ring) {
+            SDL_DestroyMutex(result->lock);
+            SDL_DestroyAudioQueue(result->queue);
+            SDL_free(result);
+            return NULL;
+        }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_AUDIO, result->producer_ring_size);
+    }
 
     OnAudioStreamCreated(result);
 
@@ -594,6 +717,7 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
     }
 
     if (src_spec) {
+        DrainAudioStreamProducerRing(stream);  // anything still in the ring is in the old input format.
         if (src_spec->channels != stream->src_spec.channels) {
             SDL_free(stream->src_chmap);
             stream->src_chmap = NULL;
@@ -624,6 +748,10 @@ bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec
 
     SDL_LockMutex(stream->lock);
 
+    if (isinput) {
+        DrainAudioStreamProducerRing(stream);  // anything still in the ring uses the old input channel map.
+    }
+
     if (channels != spec->channels) {
         result = SDL_SetError("Wrong number of channels");
     } else if (!*stream_chmap && !chmap) {
@@ -737,6 +865,65 @@ bool SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
     return true;
 }
 
+bool SDL_SetAudioStreamTargetLatency(SDL_AudioStream *stream, int target_ms, float max_deviation)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (target_ms < 0) {
+        return SDL_InvalidParamError("target_ms");
+    } else if (target_ms > 0 && !(max_deviation >= 0.0f && max_deviation <= 0.5f)) {
+        return SDL_InvalidParamError("max_deviation");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->target_latency_ms = target_ms;
+    stream->max_rate_deviation = max_deviation;
+    stream->smoothed_latency_ms = -1.0f;
+    stream->rate_adjustment = 1.0f;
+    SDL_UnlockMutex(stream->lock);
+
+    return true;
+}
+
+bool SDL_ScheduleAudioStream(SDL_AudioStream *stream, Uint64 start_frame, Uint64 stop_frame)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (stop_frame && stop_frame <= start_frame) {
+        return SDL_InvalidParamError("stop_frame");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->scheduled_start_frame = start_frame;
+    stream->scheduled_stop_frame = stop_frame;
+    SDL_UnlockMutex(stream->lock);
+
+    return true;
+}
+
+// Nudge the playback rate toward the target latency. The queue fill is smoothed, since apps usually put data in bursts.
+static void UpdateAudioStreamRateControl(SDL_AudioStream *stream)
+{
+    const float smoothing = 0.1f;
+
+    if (stream->target_latency_ms == 0) {
+        return;
+    }
+
+    const size_t queued = SDL_GetAudioQueueQueued(stream->queue);
+    const float latency_ms = (float)queued * 1000.0f / (float)(SDL_AUDIO_FRAMESIZE(stream->src_spec) * stream->src_spec.freq);
+
+    if (stream->smoothed_latency_ms < 0.0f) {
+        stream->smoothed_latency_ms = latency_ms;
+    } else {
+        stream->smoothed_latency_ms += (latency_ms - stream->smoothed_latency_ms) * smoothing;
+    }
+
+    const float target_ms = (float)stream->target_latency_ms;
+    const float error = SDL_clamp((stream->smoothed_latency_ms - target_ms) / target_ms, -1.0f, 1.0f);
+    stream->rate_adjustment = 1.0f + error * stream->max_rate_deviation;
+}
+
 float SDL_GetAudioStreamGain(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -827,6 +1014,12 @@ static bool PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int l
         return SDL_SetError("Can't add partial sample frames");
     }
 
+    // keep things in order: anything the producer already put in the ring goes first.
+    if (!DrainAudioStreamProducerRing(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return false;
+    }
+
     const bool retval = PutAudioStreamBufferInternal(stream, &stream->src_spec, stream->src_chmap, buf, len, callback, userdata);
 
     SDL_UnlockMutex(stream->lock);
@@ -839,6 +1032,33 @@ static void SDLCALL FreeAllocatedAudioBuffer(void *userdata, const void *buf, in
     SDL_free((void *)buf);
 }
 
+// This runs without `stream->lock`! Only the single producer thread calls this, and it's the only thread that changes the input format.
+static bool PutAudioStreamDataWithoutLocking(SDL_AudioStream *stream, const void *buf, int len)
+{
+    if ((stream->src_spec.format == SDL_AUDIO_UNKNOWN) || ((len % SDL_AUDIO_FRAMESIZE(stream->src_spec)) != 0) || stream->put_callback) {
+        return false;  // let the locked path sort out errors and callbacks.
+    }
+
+    const Uint32 size = stream->producer_ring_size;
+    const Uint32 write_pos = SDL_GetAtomicU32(&stream->producer_write_pos);
+    const Uint32 read_pos = SDL_GetAtomicU32(&stream->producer_read_pos);
+    SDL_MemoryBarrierAcquire();  // don't overwrite space before the consumer is done reading it.
+
+    if ((Uint32) len > (size - (write_pos - read_pos))) {
+        return false;  // doesn't fit, so take the lock and put it in the queue directly.
+    }
+
+    const Uint32 offset = write_pos & (size - 1);
+    const Uint32 first = SDL_min((Uint32) len, size - offset);
+    SDL_memcpy(stream->producer_ring + offset, buf, first);
+    SDL_memcpy(stream->producer_ring, ((const Uint8 *) buf) + first, len - first);
+
+    SDL_MemoryBarrierRelease();  // the data has to be visible before the new write_pos is.
+    SDL_SetAtomicU32(&stream->producer_write_pos, write_pos + (Uint32) len);
+
+    return true;
+}
+
 bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
 {
     if (!stream) {
@@ -851,6 +1071,10 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return true; // nothing to do.
     }
 
+    if (stream->producer_ring && PutAudioStreamDataWithoutLocking(stream, buf, len)) {
+        return true;
+    }
+
     // When copying in large amounts of data, try and do as much work as possible
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
@@ -1056,6 +1280,7 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    DrainAudioStreamProducerRing(stream);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
@@ -1075,7 +1300,11 @@ static Uint8 *EnsureAudioStreamWorkBufferSize(SDL_AudioStream *stream, size_t ne
         return NULL;  // previous work buffer is still valid!
     }
 
-    SDL_aligned_free(stream->work_buffer);
+    if (stream->work_buffer) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, stream->work_buffer_allocation);
+        SDL_aligned_free(stream->work_buffer);
+    }
+    SDL_AddTaggedMemory(SDL_MEMORY_TAG_AUDIO, newlen);
     stream->work_buffer = ptr;
     stream->work_buffer_allocation = newlen;
     return ptr;
@@ -1253,20 +1482,23 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // Check if we can resample directly into the output buffer.
     // Note, this is just to avoid extra copies.
     // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
+    int convert_scratch_offset = -1;
+    const int block_frames = SDL_min(output_frames, AUDIO_CONVERT_BLOCK_FRAMES);
     if ((dst_format != resample_format) || (dst_channels != resample_channels)) {
-        // Allocate space for converting the resampled output to the destination format
-        int resample_convert_bytes = output_frames * max_frame_size;
-        work_buffer_capacity = SDL_max(work_buffer_capacity, resample_convert_bytes);
-
+        // We resample and convert a block at a time, so the resampled data is still in cache when it's converted.
         // SIMD-align the buffer
         int simd_alignment = (int) SDL_GetSIMDAlignment();
         work_buffer_capacity += simd_alignment - 1;
         work_buffer_capacity -= work_buffer_capacity % simd_alignment;
 
-        // Allocate space for the resampled output
-        int resample_bytes = output_frames * resample_frame_size;
+        // Allocate space for a block of resampled output
+        int resample_bytes = block_frames * resample_frame_size;
         resample_buffer_offset = work_buffer_capacity;
         work_buffer_capacity += resample_bytes;
+
+        // Allocate scratch space for converting a block of resampled output to the destination format
+        convert_scratch_offset = work_buffer_capacity;
+        work_buffer_capacity += block_frames * max_frame_size;
     }
 
     Uint8 *work_buffer = EnsureAudioStreamWorkBufferSize(stream, work_buffer_capacity);
@@ -1291,16 +1523,44 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 
     input_buffer += padding_frames * resample_frame_size;
 
-    // Decide where the resampled output goes
-    void *resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
+    // Resampled data is already in the final format? Resample straight into the output.
+    if (resample_buffer_offset == -1) {
+        SDL_ResampleAudio(resample_channels,
+                      (const float *)input_buffer, input_frames,
+                      (float *)buf, output_frames,
+                      resample_rate, &stream->resample_offset, stream->resample_quality);
+
+        // Still do gain and the final swizzle, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
+        ConvertAudio(output_frames, buf, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
+        return true;
+    }
+
+    float *resample_buffer = (float *)(work_buffer + resample_buffer_offset);
+    Uint8 *convert_scratch = work_buffer + convert_scratch_offset;
+    Uint8 *dst = (Uint8 *)buf;
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(*dst_spec);
+
+    // SDL_ResampleAudio leaves the offset relative to the end of the input it was given, but we keep feeding it the same input.
+    const Sint64 input_offset = (Sint64)input_frames << 32;
+    Sint64 resample_offset = stream->resample_offset;
 
-    SDL_ResampleAudio(resample_channels,
-                  (const float *)input_buffer, input_frames,
-                  (float *)resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+    for (int frames_done = 0; frames_done < output_frames;) {
+        const int frames = SDL_min(output_frames - frames_done, block_frames);
 
-    // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
-    ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
+        SDL_ResampleAudio(resample_channels,
+                      (const float *)input_buffer, input_frames,
+                      resample_buffer, frames,
+                      resample_rate, &resample_offset, stream->resample_quality);
+        resample_offset += input_offset;
+
+        // Convert to the final format (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
+        ConvertAudio(frames, resample_buffer, resample_format, resample_channels, NULL, dst, dst_format, dst_channels, dst_map, convert_scratch, postresample_gain);
+
+        dst += frames * dst_frame_size;
+        frames_done += frames;
+    }
+
+    stream->resample_offset = resample_offset - input_offset;
 
     return true;
 }
@@ -1334,6 +1594,9 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
+    DrainAudioStreamProducerRing(stream);
+    UpdateAudioStreamRateControl(stream);
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
@@ -1359,6 +1622,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+        DrainAudioStreamProducerRing(stream);  // in case the callback put data without taking the lock.
     }
 
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
@@ -1433,6 +1697,8 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    DrainAudioStreamProducerRing(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1454,6 +1720,8 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamProducerRing(stream);
+
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1470,10 +1738,13 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    ClearAudioStreamProducerRing(stream);
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
     stream->resample_offset = 0;
+    stream->smoothed_latency_ms = -1.0f;
+    stream->rate_adjustment = 1.0f;
 
     SDL_UnlockMutex(stream->lock);
     return true;
@@ -1499,7 +1770,14 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
         SDL_UnbindAudioStream(stream);
     }
 
-    SDL_aligned_free(stream->work_buffer);
+    if (stream->work_buffer) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, stream->work_buffer_allocation);
+        SDL_aligned_free(stream->work_buffer);
+    }
+    if (stream->producer_ring) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, stream->producer_ring_size);
+        SDL_free(stream->producer_ring);
+    }
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
 
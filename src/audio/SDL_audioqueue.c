@@ -24,6 +24,7 @@
 #include "SDL_sysaudio.h"
 
 typedef struct SDL_MemoryPool SDL_MemoryPool;
+typedef struct SDL_SharedPoolClass SDL_SharedPoolClass;
 
 struct SDL_MemoryPool
 {
@@ -31,8 +32,32 @@ struct SDL_MemoryPool
     size_t block_size;
     size_t num_free;
     size_t max_free;
+    SDL_SharedPoolClass *shared;  // where blocks go when this pool is full, or NULL
 };
 
+/* Blocks released by any queue can be picked up by any other, so streams that
+   come and go don't each warm up their own pools. Each size class is a fixed
+   array of slots that blocks are swapped in and out of, which is lock-free and
+   doesn't have the ABA problem of a linked free list. The number of bytes held
+   is capped by SDL_HINT_AUDIO_CHUNK_POOL_SIZE, and the pool is off when it's 0. */
+#define SDL_SHARED_POOL_SLOTS   128
+#define SDL_SHARED_POOL_CLASSES 8   // tracks, then chunks of 1KB to 64KB
+
+struct SDL_SharedPoolClass
+{
+    size_t block_size;
+    SDL_AtomicInt count;  // roughly how many slots are in use, to skip empty classes
+    SDL_AtomicInt next;   // where the next search starts, to spread threads across the slots
+    void *slots[SDL_SHARED_POOL_SLOTS];
+};
+
+static struct
+{
+    SDL_AtomicInt capacity;  // in bytes
+    SDL_AtomicInt held;      // bytes currently in the slots
+    SDL_SharedPoolClass classes[SDL_SHARED_POOL_CLASSES];
+} SDL_shared_pool;
+
 struct SDL_AudioTrack
 {
     SDL_AudioSpec spec;
@@ -64,10 +89,118 @@ struct SDL_AudioQueue
     SDL_MemoryPool chunk_pool;
 };
 
+static void *PopSharedPoolBlock(SDL_SharedPoolClass *shared)
+{
+    if (SDL_GetAtomicInt(&shared->count) <= 0) {
+        return NULL;
+    }
+
+    // Start at the slot that was filled last
+    const Uint32 start = (Uint32)SDL_GetAtomicInt(&shared->next) - 1;
+    for (Uint32 i = 0; i < SDL_SHARED_POOL_SLOTS; ++i) {
+        void **slot = &shared->slots[(start - i) % SDL_SHARED_POOL_SLOTS];
+        void *block = SDL_GetAtomicPointer(slot);
+        if (block && SDL_CompareAndSwapAtomicPointer(slot, block, NULL)) {
+            SDL_AddAtomicInt(&shared->count, -1);
+            SDL_AddAtomicInt(&SDL_shared_pool.held, -(int)shared->block_size);
+            SDL_MoveTaggedMemory(SDL_MEMORY_TAG_AUDIO_POOL, SDL_MEMORY_TAG_AUDIO, shared->block_size);
+            return block;
+        }
+    }
+    return NULL;
+}
+
+static bool PushSharedPoolBlock(SDL_SharedPoolClass *shared, void *block)
+{
+    const int size = (int)shared->block_size;
+
+    if (SDL_AddAtomicInt(&SDL_shared_pool.held, size) + size > SDL_GetAtomicInt(&SDL_shared_pool.capacity)) {
+        SDL_AddAtomicInt(&SDL_shared_pool.held, -size);
+        return false;
+    }
+
+    const Uint32 start = (Uint32)SDL_AddAtomicInt(&shared->next, 1);
+    for (Uint32 i = 0; i < SDL_SHARED_POOL_SLOTS; ++i) {
+        void **slot = &shared->slots[(start + i) % SDL_SHARED_POOL_SLOTS];
+        if (SDL_CompareAndSwapAtomicPointer(slot, NULL, block)) {
+            SDL_AddAtomicInt(&shared->count, 1);
+            SDL_MoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, SDL_MEMORY_TAG_AUDIO_POOL, shared->block_size);
+            return true;
+        }
+    }
+    SDL_AddAtomicInt(&SDL_shared_pool.held, -size);
+    return false;
+}
+
+static SDL_SharedPoolClass *GetSharedPoolClass(size_t block_size)
+{
+    if (SDL_GetAtomicInt(&SDL_shared_pool.capacity) <= 0) {
+        return NULL;
+    }
+
+    for (int i = 0; i < SDL_SHARED_POOL_CLASSES; ++i) {
+        if (SDL_shared_pool.classes[i].block_size == block_size) {
+            return &SDL_shared_pool.classes[i];
+        }
+    }
+    return NULL;
+}
+
+void SDL_InitAudioChunkPool(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_CHUNK_POOL_SIZE);
+    const int capacity = hint ? SDL_clamp(SDL_atoi(hint), 0, 1 << 30) : 0;
+
+    SDL_shared_pool.classes[0].block_size = sizeof(SDL_AudioTrack);
+    for (int i = 1; i < SDL_SHARED_POOL_CLASSES; ++i) {
+        SDL_shared_pool.classes[i].block_size = (size_t)1024 << (i - 1);
+    }
+    SDL_SetAtomicInt(&SDL_shared_pool.capacity, capacity);
+}
+
+void SDL_QuitAudioChunkPool(void)
+{
+    SDL_SetAtomicInt(&SDL_shared_pool.capacity, 0);
+
+    for (int i = 0; i < SDL_SHARED_POOL_CLASSES; ++i) {
+        SDL_SharedPoolClass *shared = &SDL_shared_pool.classes[i];
+        void *block;
+
+        while ((block = PopSharedPoolBlock(shared)) != NULL) {
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, shared->block_size);
+            SDL_free(block);
+        }
+    }
+}
+
 // Allocate a new block, avoiding checking for ones already in the pool
 static void *AllocNewMemoryPoolBlock(const SDL_MemoryPool *pool)
 {
-    return SDL_malloc(pool->block_size);
+    void *block = NULL;
+
+    if (pool->shared) {
+        block = PopSharedPoolBlock(pool->shared);
+        if (block) {
+            return block;
+        }
+    }
+
+    block = SDL_malloc(pool->block_size);
+    if (block) {
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_AUDIO, pool->block_size);
+    }
+    return block;
+}
+
+// Free a block, or pass it on to the shared pool if there's room
+static void FreeMemoryPoolBlockNow(const SDL_MemoryPool *pool, void *block)
+{
+    if (pool->shared && PushSharedPoolBlock(pool->shared, block)) {
+        return;
+    }
+
+    SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, pool->block_size);
+    SDL_free(block);
 }
 
 // Allocate a new block, first checking if there are any in the pool
@@ -91,7 +224,7 @@ static void FreeMemoryPoolBlock(SDL_MemoryPool *pool, void *block)
         pool->free_blocks = block;
         ++pool->num_free;
     } else {
-        SDL_free(block);
+        FreeMemoryPoolBlockNow(pool, block);
     }
 }
 
@@ -104,7 +237,7 @@ static void DestroyMemoryPool(SDL_MemoryPool *pool)
 
     while (block) {
         void *next = *(void **)block;
-        SDL_free(block);
+        FreeMemoryPoolBlockNow(pool, block);
         block = next;
     }
 }
@@ -118,6 +251,7 @@ static void InitMemoryPool(SDL_MemoryPool *pool, size_t block_size, size_t max_f
     SDL_assert(block_size >= sizeof(void *));
     pool->block_size = block_size;
     pool->max_free = max_free;
+    pool->shared = GetSharedPoolClass(block_size);
 }
 
 // Allocates a number of blocks and adds them to the pool
@@ -144,7 +278,10 @@ void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 
     DestroyMemoryPool(&queue->track_pool);
     DestroyMemoryPool(&queue->chunk_pool);
-    SDL_aligned_free(queue->history_buffer);
+    if (queue->history_buffer) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, queue->history_capacity);
+        SDL_aligned_free(queue->history_buffer);
+    }
 
     SDL_free(queue);
 }
@@ -640,7 +777,11 @@ bool SDL_ResetAudioQueueHistory(SDL_AudioQueue *queue, int num_frames)
         if (!history_buffer) {
             return false;
         }
-        SDL_aligned_free(queue->history_buffer);
+        if (queue->history_buffer) {
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_AUDIO, queue->history_capacity);
+            SDL_aligned_free(queue->history_buffer);
+        }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_AUDIO, length);
         queue->history_buffer = history_buffer;
         queue->history_capacity = length;
     }
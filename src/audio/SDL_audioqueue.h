@@ -30,6 +30,10 @@ typedef SDL_AudioStreamDataCompleteCallback SDL_ReleaseAudioBufferCallback;
 typedef struct SDL_AudioQueue SDL_AudioQueue;
 typedef struct SDL_AudioTrack SDL_AudioTrack;
 
+// Set up and tear down the chunk pool shared by all queues, see SDL_HINT_AUDIO_CHUNK_POOL_SIZE
+extern void SDL_InitAudioChunkPool(void);
+extern void SDL_QuitAudioChunkPool(void);
+
 // Create a new audio queue
 extern SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size);
 
@@ -141,7 +141,12 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
 
     __m128 f0, f1, f2;
 
-    {
+    if (frac == 0.0f) {
+        // We landed exactly on a filter table entry (this is always the case for 2x and 4x rate changes), so there's nothing to interpolate.
+        f0 = _mm_load_ps(filter[0].v);
+        f1 = _mm_load_ps(filter[4].v);
+        f2 = _mm_load_ps(filter[8].v);
+    } else {
         const __m128 frac1 = _mm_set1_ps(frac);
         const __m128 frac2 = _mm_mul_ps(frac1, frac1);
         const __m128 frac3 = _mm_mul_ps(frac1, frac2);
@@ -229,8 +234,38 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
         _mm_storeu_ps(&dst[chan], out);
     }
 
-    // Process the remaining channels one at a time.
-    // Channel counts 1,2,4,8 are already handled above, leaving 3,5,6,7 to deal with (looping 3,1,2,3 times).
+    // Process 2 channels at once, to finish off 3/6/7 channel frames (5.1 is 4+2).
+    if (chan + 2 <= chans) {
+        const float *in = &src[chan];
+        __m128 out0 = _mm_setzero_ps();
+        __m128 out1 = _mm_setzero_ps();
+
+#define X(a, b, out)                                                                                                          \
+    out = sdl_madd_ps(out, _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)in), _mm_shuffle_ps(a, a, _MM_SHUFFLE(b, b, b, b))); \
+    in += chans
+
+#define Y(a)       \
+    X(a, 0, out0); \
+    X(a, 1, out1); \
+    X(a, 2, out0); \
+    X(a, 3, out1)
+
+        Y(f0);
+        Y(f1);
+        Y(f2);
+
+#undef X
+#undef Y
+
+        // Add the accumulators together
+        __m128 out = _mm_add_ps(out0, out1);
+
+        _mm_storel_pi((__m64 *)&dst[chan], out);
+        chan += 2;
+    }
+
+    // Process the remaining channel, if any.
+    // Channel counts 1,2,4,6,8 are already handled above, leaving 3,5,7 with one channel each to deal with.
     // Without vgatherdps (AVX2), this gets quite messy.
     for (; chan < chans; ++chan) {
         const float *in = &src[chan];
@@ -261,6 +296,66 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 }
 
+#ifdef SDL_AVX2_INTRINSICS
+// 5 to 8 channels fit in a single AVX register, so every tap of a whole frame is one load and one multiply-add.
+static void SDL_TARGETING("avx2") ResampleFrame_Generic_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    SDL_assert(chans > 4 && chans <= 8);
+
+    __m128 f0, f1, f2;
+
+    if (frac == 0.0f) {
+        f0 = _mm_load_ps(filter[0].v);
+        f1 = _mm_load_ps(filter[4].v);
+        f2 = _mm_load_ps(filter[8].v);
+    } else {
+        const __m128 frac1 = _mm_set1_ps(frac);
+        const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+        const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+
+// Transposed in SetupAudioResampler
+#define X(out)                                               \
+    out = _mm_load_ps(filter[0].v);                          \
+    out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v)); \
+    out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v)); \
+    out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v)); \
+    filter += 4
+
+        X(f0);
+        X(f1);
+        X(f2);
+
+#undef X
+    }
+
+    // Only touch the channels that are actually in the frame.
+    const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(chans), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    const float *in = src;
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+
+#define X(a, b, out)                                                                                                                             \
+    out = _mm256_add_ps(out, _mm256_mul_ps(_mm256_maskload_ps(in, mask), _mm256_broadcastss_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(b, b, b, b))))); \
+    in += chans
+
+#define Y(a)       \
+    X(a, 0, out0); \
+    X(a, 1, out1); \
+    X(a, 2, out0); \
+    X(a, 3, out1)
+
+    Y(f0);
+    Y(f1);
+    Y(f2);
+
+#undef X
+#undef Y
+
+    // Add the accumulators together
+    _mm256_maskstore_ps(dst, mask, _mm256_add_ps(out0, out1));
+}
+#endif
+
 #undef sdl_madd_ps
 #endif
 
@@ -273,7 +368,12 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
 
     float32x4_t f0, f1, f2;
 
-    {
+    if (frac == 0.0f) {
+        // We landed exactly on a filter table entry (this is always the case for 2x and 4x rate changes), so there's nothing to interpolate.
+        f0 = filter[0].v128;
+        f1 = filter[4].v128;
+        f2 = filter[8].v128;
+    } else {
         const float32x4_t frac1 = vdupq_n_f32(frac);
         const float32x4_t frac2 = vmulq_f32(frac1, frac1);
         const float32x4_t frac3 = vmulq_f32(frac1, frac2);
@@ -360,8 +460,36 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
         vst1q_f32(&dst[chan], out);
     }
 
-    // Process the remaining channels one at a time.
-    // Channel counts 1,2,4,8 are already handled above, leaving 3,5,6,7 to deal with (looping 3,1,2,3 times).
+    // Process 2 channels at once, to finish off 3/6/7 channel frames (5.1 is 4+2).
+    if (chan + 2 <= chans) {
+        const float *in = &src[chan];
+        float32x2_t out0 = vdup_n_f32(0);
+        float32x2_t out1 = vdup_n_f32(0);
+
+#define X(a, b, out)                                        \
+    out = vmla_f32(out, vld1_f32(in), vdup_lane_f32(a, b)); \
+    in += chans
+
+#define Y(a)                      \
+    X(vget_low_f32(a), 0, out0);  \
+    X(vget_low_f32(a), 1, out1);  \
+    X(vget_high_f32(a), 0, out0); \
+    X(vget_high_f32(a), 1, out1)
+
+        Y(f0);
+        Y(f1);
+        Y(f2);
+
+#undef X
+#undef Y
+
+        // Add the accumulators together
+        vst1_f32(&dst[chan], vadd_f32(out0, out1));
+        chan += 2;
+    }
+
+    // Process the remaining channel, if any.
+    // Channel counts 1,2,4,6,8 are already handled above, leaving 3,5,7 with one channel each to deal with.
     for (; chan < chans; ++chan) {
         const float *in = &src[chan];
         float32x4_t v0, v1, v2;
@@ -542,6 +670,13 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
         }
+#ifdef SDL_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            for (i = 4; i < 8; ++i) {
+                ResampleFrame[i] = ResampleFrame_Generic_AVX2;
+            }
+        }
+#endif
         transpose = true;
     } else
 #endif
@@ -675,8 +810,83 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
+// The cheaper quality levels interpolate straight from the neighbouring input frames, with no filter table.
+// These are a few multiply-adds per sample, in plain loops the compiler can vectorize across channels.
+static Sint64 ResampleAudio_Nearest(int chans, const float *src, int inframes, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, c;
+
+    for (i = 0; i < outframes; ++i) {
+        // round to the closest frame, `srcindex + 1` is always available since srcindex < inframes.
+        const int srcindex = (int)(Sint32)((srcpos + 0x80000000) >> 32);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex <= inframes);
+
+        const float *frame = &src[srcindex * chans];
+        for (c = 0; c < chans; ++c) {
+            dst[c] = frame[c];
+        }
+        dst += chans;
+    }
+
+    return srcpos;
+}
+
+static Sint64 ResampleAudio_Linear(int chans, const float *src, int inframes, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, c;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[srcindex * chans];
+        for (c = 0; c < chans; ++c) {
+            const float a = frame[c];
+            const float b = frame[c + chans];
+            dst[c] = a + ((b - a) * frac);
+        }
+        dst += chans;
+    }
+
+    return srcpos;
+}
+
+static Sint64 ResampleAudio_Cubic(int chans, const float *src, int inframes, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, c;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        // Catmull-Rom spline through the two frames on either side of srcpos.
+        const float *frame = &src[srcindex * chans];
+        for (c = 0; c < chans; ++c) {
+            const float y0 = frame[c - chans];
+            const float y1 = frame[c];
+            const float y2 = frame[c + chans];
+            const float y3 = frame[c + (chans * 2)];
+            const float c1 = 0.5f * (y2 - y0);
+            const float c2 = y0 - (2.5f * y1) + (2.0f * y2) - (0.5f * y3);
+            const float c3 = (0.5f * (y3 - y0)) + (1.5f * (y1 - y2));
+            dst[c] = ((((c3 * frac) + c2) * frac) + c1) * frac + y1;
+        }
+        dst += chans;
+    }
+
+    return srcpos;
+}
+
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality)
 {
     int i;
     Sint64 srcpos = *inout_resample_offset;
@@ -684,6 +894,20 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
 
     SDL_assert(resample_rate > 0);
 
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_NEAREST:
+        *inout_resample_offset = ResampleAudio_Nearest(chans, src, inframes, dst, outframes, srcpos, resample_rate) - ((Sint64)inframes << 32);
+        return;
+    case SDL_AUDIO_RESAMPLE_LINEAR:
+        *inout_resample_offset = ResampleAudio_Linear(chans, src, inframes, dst, outframes, srcpos, resample_rate) - ((Sint64)inframes << 32);
+        return;
+    case SDL_AUDIO_RESAMPLE_CUBIC:
+        *inout_resample_offset = ResampleAudio_Cubic(chans, src, inframes, dst, outframes, srcpos, resample_rate) - ((Sint64)inframes << 32);
+        return;
+    default:
+        break;  // the full windowed-sinc filter.
+    }
+
     src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
 
     for (i = 0; i < outframes; ++i) {
@@ -82,8 +82,109 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / MIX_MAXVOLUME) + 128))
 
-// !!! FIXME: This needs some SIMD magic.
-// !!! FIXME: Add fast-path for volume = 1
+// Native-endian float is what the audio device thread mixes in, so it gets SIMD versions.
+static void SDL_MixAudio_F32_Scalar(float *dst, const float *src, int num_samples, float volume)
+{
+    for (int i = 0; i < num_samples; i++) {
+        float dst_sample = (src[i] * volume) + dst[i];
+        if (dst_sample > 1.0f) {
+            dst_sample = 1.0f;
+        } else if (dst_sample < -1.0f) {
+            dst_sample = -1.0f;
+        }
+        dst[i] = dst_sample;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") SDL_MixAudio_F32_SSE2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m128 vol = _mm_set1_ps(volume);
+    const __m128 max_audioval = _mm_set1_ps(1.0f);
+    const __m128 min_audioval = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; i + 8 <= num_samples; i += 8) {
+        __m128 mixed0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), vol), _mm_loadu_ps(&dst[i]));
+        __m128 mixed1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vol), _mm_loadu_ps(&dst[i + 4]));
+        mixed0 = _mm_min_ps(_mm_max_ps(mixed0, min_audioval), max_audioval);
+        mixed1 = _mm_min_ps(_mm_max_ps(mixed1, min_audioval), max_audioval);
+        _mm_storeu_ps(&dst[i], mixed0);
+        _mm_storeu_ps(&dst[i + 4], mixed1);
+    }
+
+    SDL_MixAudio_F32_Scalar(dst + i, src + i, num_samples - i, volume);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") SDL_MixAudio_F32_AVX2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m256 vol = _mm256_set1_ps(volume);
+    const __m256 max_audioval = _mm256_set1_ps(1.0f);
+    const __m256 min_audioval = _mm256_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; i + 16 <= num_samples; i += 16) {
+        __m256 mixed0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), vol), _mm256_loadu_ps(&dst[i]));
+        __m256 mixed1 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vol), _mm256_loadu_ps(&dst[i + 8]));
+        mixed0 = _mm256_min_ps(_mm256_max_ps(mixed0, min_audioval), max_audioval);
+        mixed1 = _mm256_min_ps(_mm256_max_ps(mixed1, min_audioval), max_audioval);
+        _mm256_storeu_ps(&dst[i], mixed0);
+        _mm256_storeu_ps(&dst[i + 8], mixed1);
+    }
+
+    SDL_MixAudio_F32_Scalar(dst + i, src + i, num_samples - i, volume);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_MixAudio_F32_NEON(float *dst, const float *src, int num_samples, float volume)
+{
+    const float32x4_t max_audioval = vdupq_n_f32(1.0f);
+    const float32x4_t min_audioval = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    for (; i + 8 <= num_samples; i += 8) {
+        // multiply and add separately (not vmlaq/vfmaq), so results match the scalar path exactly.
+        float32x4_t mixed0 = vaddq_f32(vmulq_n_f32(vld1q_f32(&src[i]), volume), vld1q_f32(&dst[i]));
+        float32x4_t mixed1 = vaddq_f32(vmulq_n_f32(vld1q_f32(&src[i + 4]), volume), vld1q_f32(&dst[i + 4]));
+        mixed0 = vminq_f32(vmaxq_f32(mixed0, min_audioval), max_audioval);
+        mixed1 = vminq_f32(vmaxq_f32(mixed1, min_audioval), max_audioval);
+        vst1q_f32(&dst[i], mixed0);
+        vst1q_f32(&dst[i + 4], mixed1);
+    }
+
+    SDL_MixAudio_F32_Scalar(dst + i, src + i, num_samples - i, volume);
+}
+#endif
+
+// Function pointer set to a CPU-specific implementation, on first use.
+static void (*SDL_MixAudio_F32)(float *dst, const float *src, int num_samples, float volume) = NULL;
+
+static void SDL_ChooseMixAudioFuncs(void)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_AVX2;
+        return;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_SSE2;
+        return;
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_NEON;
+        return;
+    }
+#endif
+    SDL_MixAudio_F32 = SDL_MixAudio_F32_Scalar;
+}
+
 // !!! FIXME: Use larger scales for 16-bit/32-bit integers
 
 bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, float fvolume)
@@ -94,6 +195,14 @@ bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 l
         return true;
     }
 
+    if (format == SDL_AUDIO_F32) {
+        if (!SDL_MixAudio_F32) {
+            SDL_ChooseMixAudioFuncs();  // every thread picks the same thing, so racing here is harmless.
+        }
+        SDL_MixAudio_F32((float *)dst, (const float *)src, (int)(len / sizeof(float)), fvolume);
+        return true;
+    }
+
     switch (format) {
 
     case SDL_AUDIO_U8:
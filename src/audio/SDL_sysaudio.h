@@ -157,6 +157,8 @@ typedef struct SDL_AudioDriverImpl
     Uint8 *(*GetDeviceBuf)(SDL_AudioDevice *device, int *buffer_size);
     bool (*WaitRecordingDevice)(SDL_AudioDevice *device);
     int (*RecordDevice)(SDL_AudioDevice *device, void *buffer, int buflen);
+    const Uint8 *(*GetRecordingBuf)(SDL_AudioDevice *device, int *buffer_size);  // optional: hand over the backend's own buffer of recorded data instead of copying it. Defaults to RecordDevice into work_buffer.
+    void (*ReleaseRecordingBuf)(SDL_AudioDevice *device, const Uint8 *buffer, int buflen);  // called when SDL is done with a buffer from GetRecordingBuf, with the device lock still held.
     void (*FlushRecording)(SDL_AudioDevice *device);
     void (*CloseDevice)(SDL_AudioDevice *device);
     void (*FreeDeviceHandle)(SDL_AudioDevice *device); // SDL is done with this device; free the handle from SDL_AddAudioDevice()
@@ -217,16 +219,33 @@ struct SDL_AudioStream
     float freq_ratio;
     float gain;
 
+    // Closed-loop rate control, see SDL_SetAudioStreamTargetLatency
+    int target_latency_ms;  // 0 if disabled
+    float max_rate_deviation;
+    float smoothed_latency_ms;  // negative until the first measurement
+    float rate_adjustment;  // applied on top of freq_ratio, 1.0f if disabled
+
+    // Device frames to start and stop playback at, see SDL_ScheduleAudioStream. Zero if not scheduled.
+    Uint64 scheduled_start_frame;
+    Uint64 scheduled_stop_frame;
+
     struct SDL_AudioQueue *queue;
 
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
     Sint64 resample_offset;
+    SDL_AudioResampleQuality resample_quality;  // set at creation, see SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER.
 
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
+    // Single-producer streams: SDL_PutAudioStreamData copies into this ring without taking `lock`, and whoever holds `lock` moves it into `queue`.
+    Uint8 *producer_ring;
+    Uint32 producer_ring_size;  // a power of two, in bytes.
+    SDL_AtomicU32 producer_write_pos;  // free-running byte counts. Only the producer advances this...
+    SDL_AtomicU32 producer_read_pos;   // ...and only a thread holding `lock` advances this.
+
     bool simplified;  // true if created via SDL_OpenAudioDeviceStream
 
     SDL_LogicalAudioDevice *bound_device;
@@ -299,6 +318,8 @@ struct SDL_AudioDevice
     Uint8 *(*GetDeviceBuf)(SDL_AudioDevice *device, int *buffer_size);
     bool (*WaitRecordingDevice)(SDL_AudioDevice *device);
     int (*RecordDevice)(SDL_AudioDevice *device, void *buffer, int buflen);
+    const Uint8 *(*GetRecordingBuf)(SDL_AudioDevice *device, int *buffer_size);
+    void (*ReleaseRecordingBuf)(SDL_AudioDevice *device, const Uint8 *buffer, int buflen);
     void (*FlushRecording)(SDL_AudioDevice *device);
 
     // human-readable name of the device. ("SoundBlaster Pro 16")
@@ -351,9 +372,24 @@ struct SDL_AudioDevice
     // A thread to feed the audio device
     SDL_Thread *thread;
 
+    // Worker threads that pull bound streams in parallel while mixing, or NULL. See SDL_HINT_AUDIO_DEVICE_MIX_THREADS.
+    struct SDL_AudioMixPool *mix_pool;
+
     // true if this physical device is currently opened by the backend.
     bool currently_opened;
 
+    // Statistics written by the device thread, guarded by a sequence counter (odd while being written) so readers never take `lock`.
+    SDL_AtomicInt stats_sequence;
+    Uint64 stats_underruns;
+    Uint64 stats_silence_frames;
+    Uint64 stats_last_iteration_ns;
+    Uint64 stats_frames_mixed;  // the device frame clock for scheduled streams.
+    int stats_last_buffer_frames;
+
+    // Statistics the backend may report, if it knows them. Zero if unknown.
+    SDL_AtomicU32 stats_padding_frames;
+    SDL_AtomicU32 stats_latency_ns;
+
     // Data private to this driver
     struct SDL_PrivateAudioData *hidden;
 
@@ -853,71 +853,214 @@ static bool IMA_ADPCM_Init(WaveFile *file, size_t datalength)
 
 static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 nybble)
 {
-    const Sint32 max_audioval = 32767;
-    const Sint32 min_audioval = -32768;
-    const Sint8 index_table_4b[16] = {
-        -1, -1, -1, -1,
-        2, 4, 6, 8,
-        -1, -1, -1, -1,
-        2, 4, 6, 8
-    };
-    const Uint16 step_table[89] = {
-        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
-        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
-        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
-        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
-        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
-        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
-        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
-        22385, 24623, 27086, 29794, 32767
+    /* The delta magnitude for each step index and the lower 3 bits of the
+     * nybble. The original algorithm computes this with shifts and additions
+     * because multiplications were much slower back then. Sadly, this can't
+     * just be replaced with an actual multiplication now as the old algorithm
+     * drops some bits, so these are its exact results:
+     *
+     * delta = step >> 3;
+     * if (nybble & 0x04) delta += step;
+     * if (nybble & 0x02) delta += step >> 1;
+     * if (nybble & 0x01) delta += step >> 2;
+     *
+     * Looking them up takes all the unpredictable branches out of decoding.
+     */
+    static const Uint16 delta_table[89][8] = {
+        { 0, 1, 3, 4, 7, 8, 10, 11 },
+        { 1, 3, 5, 7, 9, 11, 13, 15 },
+        { 1, 3, 5, 7, 10, 12, 14, 16 },
+        { 1, 3, 6, 8, 11, 13, 16, 18 },
+        { 1, 3, 6, 8, 12, 14, 17, 19 },
+        { 1, 4, 7, 10, 13, 16, 19, 22 },
+        { 1, 4, 7, 10, 14, 17, 20, 23 },
+        { 1, 4, 8, 11, 15, 18, 22, 25 },
+        { 2, 6, 10, 14, 18, 22, 26, 30 },
+        { 2, 6, 10, 14, 19, 23, 27, 31 },
+        { 2, 6, 11, 15, 21, 25, 30, 34 },
+        { 2, 7, 12, 17, 23, 28, 33, 38 },
+        { 2, 7, 13, 18, 25, 30, 36, 41 },
+        { 3, 9, 15, 21, 28, 34, 40, 46 },
+        { 3, 10, 17, 24, 31, 38, 45, 52 },
+        { 3, 10, 18, 25, 34, 41, 49, 56 },
+        { 4, 12, 21, 29, 38, 46, 55, 63 },
+        { 4, 13, 22, 31, 41, 50, 59, 68 },
+        { 5, 15, 25, 35, 46, 56, 66, 76 },
+        { 5, 16, 27, 38, 50, 61, 72, 83 },
+        { 6, 18, 31, 43, 56, 68, 81, 93 },
+        { 6, 19, 33, 46, 61, 74, 88, 101 },
+        { 7, 22, 37, 52, 67, 82, 97, 112 },
+        { 8, 24, 41, 57, 74, 90, 107, 123 },
+        { 9, 27, 45, 63, 82, 100, 118, 136 },
+        { 10, 30, 50, 70, 90, 110, 130, 150 },
+        { 11, 33, 55, 77, 99, 121, 143, 165 },
+        { 12, 36, 60, 84, 109, 133, 157, 181 },
+        { 13, 39, 66, 92, 120, 146, 173, 199 },
+        { 14, 43, 73, 102, 132, 161, 191, 220 },
+        { 16, 48, 81, 113, 146, 178, 211, 243 },
+        { 17, 52, 88, 123, 160, 195, 231, 266 },
+        { 19, 58, 97, 136, 176, 215, 254, 293 },
+        { 21, 64, 107, 150, 194, 237, 280, 323 },
+        { 23, 70, 118, 165, 213, 260, 308, 355 },
+        { 26, 78, 130, 182, 235, 287, 339, 391 },
+        { 28, 85, 143, 200, 258, 315, 373, 430 },
+        { 31, 94, 157, 220, 284, 347, 410, 473 },
+        { 34, 103, 173, 242, 313, 382, 452, 521 },
+        { 38, 114, 191, 267, 345, 421, 498, 574 },
+        { 42, 126, 210, 294, 379, 463, 547, 631 },
+        { 46, 138, 231, 323, 417, 509, 602, 694 },
+        { 51, 153, 255, 357, 459, 561, 663, 765 },
+        { 56, 168, 280, 392, 505, 617, 729, 841 },
+        { 61, 184, 308, 431, 555, 678, 802, 925 },
+        { 68, 204, 340, 476, 612, 748, 884, 1020 },
+        { 74, 223, 373, 522, 672, 821, 971, 1120 },
+        { 82, 246, 411, 575, 740, 904, 1069, 1233 },
+        { 90, 271, 452, 633, 814, 995, 1176, 1357 },
+        { 99, 298, 497, 696, 895, 1094, 1293, 1492 },
+        { 109, 328, 547, 766, 985, 1204, 1423, 1642 },
+        { 120, 360, 601, 841, 1083, 1323, 1564, 1804 },
+        { 132, 397, 662, 927, 1192, 1457, 1722, 1987 },
+        { 145, 436, 728, 1019, 1311, 1602, 1894, 2185 },
+        { 160, 480, 801, 1121, 1442, 1762, 2083, 2403 },
+        { 176, 528, 881, 1233, 1587, 1939, 2292, 2644 },
+        { 194, 582, 970, 1358, 1746, 2134, 2522, 2910 },
+        { 213, 639, 1066, 1492, 1920, 2346, 2773, 3199 },
+        { 234, 703, 1173, 1642, 2112, 2581, 3051, 3520 },
+        { 258, 774, 1291, 1807, 2324, 2840, 3357, 3873 },
+        { 284, 852, 1420, 1988, 2556, 3124, 3692, 4260 },
+        { 312, 936, 1561, 2185, 2811, 3435, 4060, 4684 },
+        { 343, 1030, 1717, 2404, 3092, 3779, 4466, 5153 },
+        { 378, 1134, 1890, 2646, 3402, 4158, 4914, 5670 },
+        { 415, 1246, 2078, 2909, 3742, 4573, 5405, 6236 },
+        { 457, 1372, 2287, 3202, 4117, 5032, 5947, 6862 },
+        { 503, 1509, 2516, 3522, 4529, 5535, 6542, 7548 },
+        { 553, 1660, 2767, 3874, 4981, 6088, 7195, 8302 },
+        { 608, 1825, 3043, 4260, 5479, 6696, 7914, 9131 },
+        { 669, 2008, 3348, 4687, 6027, 7366, 8706, 10045 },
+        { 736, 2209, 3683, 5156, 6630, 8103, 9577, 11050 },
+        { 810, 2431, 4052, 5673, 7294, 8915, 10536, 12157 },
+        { 891, 2674, 4457, 6240, 8023, 9806, 11589, 13372 },
+        { 980, 2941, 4902, 6863, 8825, 10786, 12747, 14708 },
+        { 1078, 3235, 5393, 7550, 9708, 11865, 14023, 16180 },
+        { 1186, 3559, 5932, 8305, 10679, 13052, 15425, 17798 },
+        { 1305, 3915, 6526, 9136, 11747, 14357, 16968, 19578 },
+        { 1435, 4306, 7178, 10049, 12922, 15793, 18665, 21536 },
+        { 1579, 4737, 7896, 11054, 14214, 17372, 20531, 23689 },
+        { 1737, 5211, 8686, 12160, 15636, 19110, 22585, 26059 },
+        { 1911, 5733, 9555, 13377, 17200, 21022, 24844, 28666 },
+        { 2102, 6306, 10511, 14715, 18920, 23124, 27329, 31533 },
+        { 2312, 6937, 11562, 16187, 20812, 25437, 30062, 34687 },
+        { 2543, 7630, 12718, 17805, 22893, 27980, 33068, 38155 },
+        { 2798, 8394, 13990, 19586, 25183, 30779, 36375, 41971 },
+        { 3077, 9232, 15388, 21543, 27700, 33855, 40011, 46166 },
+        { 3385, 10156, 16928, 23699, 30471, 37242, 44014, 50785 },
+        { 3724, 11172, 18621, 26069, 33518, 40966, 48415, 55863 },
+        { 4095, 12286, 20478, 28669, 36862, 45053, 53245, 61436 }
     };
-    Uint32 step;
-    Sint32 sample, delta;
-    Sint8 index = *cindex;
-
-    // Clamp index into valid range.
-    if (index > 88) {
-        index = 88;
-    } else if (index < 0) {
-        index = 0;
-    }
-
-    // explicit cast to avoid gcc warning about using 'char' as array index
-    step = step_table[(size_t)index];
-
-    // Update index value
-    *cindex = index + index_table_4b[nybble];
-
-    /* This calculation uses shifts and additions because multiplications were
-     * much slower back then. Sadly, this can't just be replaced with an actual
-     * multiplication now as the old algorithm drops some bits. The closest
-     * approximation I could find is something like this:
-     * (nybble & 0x8 ? -1 : 1) * ((nybble & 0x7) * step / 4 + step / 8)
+    /* The step index for the next nybble, already clamped into the valid
+     * range: index + { -1, -1, -1, -1, 2, 4, 6, 8 }[nybble & 0x07].
      */
-    delta = step >> 3;
-    if (nybble & 0x04) {
-        delta += step;
-    }
-    if (nybble & 0x02) {
-        delta += step >> 1;
-    }
-    if (nybble & 0x01) {
-        delta += step >> 2;
-    }
-    if (nybble & 0x08) {
-        delta = -delta;
-    }
+    static const Uint8 next_index_table[89][8] = {
+        { 0, 0, 0, 0, 2, 4, 6, 8 },
+        { 0, 0, 0, 0, 3, 5, 7, 9 },
+        { 1, 1, 1, 1, 4, 6, 8, 10 },
+        { 2, 2, 2, 2, 5, 7, 9, 11 },
+        { 3, 3, 3, 3, 6, 8, 10, 12 },
+        { 4, 4, 4, 4, 7, 9, 11, 13 },
+        { 5, 5, 5, 5, 8, 10, 12, 14 },
+        { 6, 6, 6, 6, 9, 11, 13, 15 },
+        { 7, 7, 7, 7, 10, 12, 14, 16 },
+        { 8, 8, 8, 8, 11, 13, 15, 17 },
+        { 9, 9, 9, 9, 12, 14, 16, 18 },
+        { 10, 10, 10, 10, 13, 15, 17, 19 },
+        { 11, 11, 11, 11, 14, 16, 18, 20 },
+        { 12, 12, 12, 12, 15, 17, 19, 21 },
+        { 13, 13, 13, 13, 16, 18, 20, 22 },
+        { 14, 14, 14, 14, 17, 19, 21, 23 },
+        { 15, 15, 15, 15, 18, 20, 22, 24 },
+        { 16, 16, 16, 16, 19, 21, 23, 25 },
+        { 17, 17, 17, 17, 20, 22, 24, 26 },
+        { 18, 18, 18, 18, 21, 23, 25, 27 },
+        { 19, 19, 19, 19, 22, 24, 26, 28 },
+        { 20, 20, 20, 20, 23, 25, 27, 29 },
+        { 21, 21, 21, 21, 24, 26, 28, 30 },
+        { 22, 22, 22, 22, 25, 27, 29, 31 },
+        { 23, 23, 23, 23, 26, 28, 30, 32 },
+        { 24, 24, 24, 24, 27, 29, 31, 33 },
+        { 25, 25, 25, 25, 28, 30, 32, 34 },
+        { 26, 26, 26, 26, 29, 31, 33, 35 },
+        { 27, 27, 27, 27, 30, 32, 34, 36 },
+        { 28, 28, 28, 28, 31, 33, 35, 37 },
+        { 29, 29, 29, 29, 32, 34, 36, 38 },
+        { 30, 30, 30, 30, 33, 35, 37, 39 },
+        { 31, 31, 31, 31, 34, 36, 38, 40 },
+        { 32, 32, 32, 32, 35, 37, 39, 41 },
+        { 33, 33, 33, 33, 36, 38, 40, 42 },
+        { 34, 34, 34, 34, 37, 39, 41, 43 },
+        { 35, 35, 35, 35, 38, 40, 42, 44 },
+        { 36, 36, 36, 36, 39, 41, 43, 45 },
+        { 37, 37, 37, 37, 40, 42, 44, 46 },
+        { 38, 38, 38, 38, 41, 43, 45, 47 },
+        { 39, 39, 39, 39, 42, 44, 46, 48 },
+        { 40, 40, 40, 40, 43, 45, 47, 49 },
+        { 41, 41, 41, 41, 44, 46, 48, 50 },
+        { 42, 42, 42, 42, 45, 47, 49, 51 },
+        { 43, 43, 43, 43, 46, 48, 50, 52 },
+        { 44, 44, 44, 44, 47, 49, 51, 53 },
+        { 45, 45, 45, 45, 48, 50, 52, 54 },
+        { 46, 46, 46, 46, 49, 51, 53, 55 },
+        { 47, 47, 47, 47, 50, 52, 54, 56 },
+        { 48, 48, 48, 48, 51, 53, 55, 57 },
+        { 49, 49, 49, 49, 52, 54, 56, 58 },
+        { 50, 50, 50, 50, 53, 55, 57, 59 },
+        { 51, 51, 51, 51, 54, 56, 58, 60 },
+        { 52, 52, 52, 52, 55, 57, 59, 61 },
+        { 53, 53, 53, 53, 56, 58, 60, 62 },
+        { 54, 54, 54, 54, 57, 59, 61, 63 },
+        { 55, 55, 55, 55, 58, 60, 62, 64 },
+        { 56, 56, 56, 56, 59, 61, 63, 65 },
+        { 57, 57, 57, 57, 60, 62, 64, 66 },
+        { 58, 58, 58, 58, 61, 63, 65, 67 },
+        { 59, 59, 59, 59, 62, 64, 66, 68 },
+        { 60, 60, 60, 60, 63, 65, 67, 69 },
+        { 61, 61, 61, 61, 64, 66, 68, 70 },
+        { 62, 62, 62, 62, 65, 67, 69, 71 },
+        { 63, 63, 63, 63, 66, 68, 70, 72 },
+        { 64, 64, 64, 64, 67, 69, 71, 73 },
+        { 65, 65, 65, 65, 68, 70, 72, 74 },
+        { 66, 66, 66, 66, 69, 71, 73, 75 },
+        { 67, 67, 67, 67, 70, 72, 74, 76 },
+        { 68, 68, 68, 68, 71, 73, 75, 77 },
+        { 69, 69, 69, 69, 72, 74, 76, 78 },
+        { 70, 70, 70, 70, 73, 75, 77, 79 },
+        { 71, 71, 71, 71, 74, 76, 78, 80 },
+        { 72, 72, 72, 72, 75, 77, 79, 81 },
+        { 73, 73, 73, 73, 76, 78, 80, 82 },
+        { 74, 74, 74, 74, 77, 79, 81, 83 },
+        { 75, 75, 75, 75, 78, 80, 82, 84 },
+        { 76, 76, 76, 76, 79, 81, 83, 85 },
+        { 77, 77, 77, 77, 80, 82, 84, 86 },
+        { 78, 78, 78, 78, 81, 83, 85, 87 },
+        { 79, 79, 79, 79, 82, 84, 86, 88 },
+        { 80, 80, 80, 80, 83, 85, 87, 88 },
+        { 81, 81, 81, 81, 84, 86, 88, 88 },
+        { 82, 82, 82, 82, 85, 87, 88, 88 },
+        { 83, 83, 83, 83, 86, 88, 88, 88 },
+        { 84, 84, 84, 84, 87, 88, 88, 88 },
+        { 85, 85, 85, 85, 88, 88, 88, 88 },
+        { 86, 86, 86, 86, 88, 88, 88, 88 },
+        { 87, 87, 87, 87, 88, 88, 88, 88 }
+    };
+    // Clamp index into valid range. The block header can set anything.
+    const Sint32 index = SDL_clamp(*cindex, 0, 88);
+    const Sint32 sign = -(Sint32)(nybble >> 3); // all bits set for negative deltas.
+    const Sint32 delta = ((Sint32)delta_table[index][nybble & 0x07] ^ sign) - sign;
+    const Sint32 sample = lastsample + delta;
 
-    sample = lastsample + delta;
+    *cindex = (Sint8)next_index_table[index][nybble & 0x07];
 
     // Clamp output sample
-    if (sample > max_audioval) {
-        sample = max_audioval;
-    } else if (sample < min_audioval) {
-        sample = min_audioval;
-    }
-
-    return (Sint16)sample;
+    return (Sint16)SDL_clamp(sample, -32768, 32767);
 }
 
 static bool IMA_ADPCM_DecodeBlockHeader(ADPCM_DecoderState *state)
@@ -1159,7 +1302,141 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* The SIMD companding decoders below process the samples from the end in
+ * blocks of 16, just like the scalar loops, so they're safe to use in-place.
+ * They return how many samples at the start of the buffer are left for the
+ * scalar code and produce exactly the same values as it does.
+ */
+
+// FIXME: SDL doesn't have SSSE3 detection, so use the next one up
+#ifdef SDL_SSE4_1_INTRINSICS
+static size_t SDL_TARGETING("ssse3") LAW_DecodeSamples_SSSE3(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t i)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+
+    if (encoding == ALAW_CODE) {
+        // mantissa bit 4 and the shift for each exponent.
+        const __m128i implicit_bit = _mm_setr_epi8(0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i multiplier = _mm_setr_epi8(1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i toggle = _mm_set1_epi8(0x55);
+        const __m128i magnitude = _mm_set1_epi8(0x7f);
+        const __m128i rounding = _mm_set1_epi16(0x8);
+
+        while (i >= 16) {
+            i -= 16;
+            const __m128i bytes = _mm_loadu_si128((const __m128i *)&src[i]);
+            const __m128i bits = _mm_xor_si128(_mm_and_si128(bytes, magnitude), toggle);
+            const __m128i exponent = _mm_and_si128(_mm_srli_epi16(bits, 4), low_nibble);
+            const __m128i mantissa = _mm_or_si128(_mm_and_si128(bits, low_nibble), _mm_shuffle_epi8(implicit_bit, exponent));
+            const __m128i shift = _mm_shuffle_epi8(multiplier, exponent);
+            // A-law samples are negative when the top bit is clear.
+            const __m128i negative = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-1));
+
+            __m128i lo = _mm_or_si128(_mm_slli_epi16(_mm_unpacklo_epi8(mantissa, zero), 4), rounding);
+            __m128i hi = _mm_or_si128(_mm_slli_epi16(_mm_unpackhi_epi8(mantissa, zero), 4), rounding);
+            lo = _mm_mullo_epi16(lo, _mm_unpacklo_epi8(shift, zero));
+            hi = _mm_mullo_epi16(hi, _mm_unpackhi_epi8(shift, zero));
+
+            const __m128i lo_sign = _mm_unpacklo_epi8(negative, negative);
+            const __m128i hi_sign = _mm_unpackhi_epi8(negative, negative);
+            _mm_storeu_si128((__m128i *)&dst[i], _mm_sub_epi16(_mm_xor_si128(lo, lo_sign), lo_sign));
+            _mm_storeu_si128((__m128i *)&dst[i + 8], _mm_sub_epi16(_mm_xor_si128(hi, hi_sign), hi_sign));
+        }
+    } else if (encoding == MULAW_CODE) {
+        const __m128i multiplier = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i bias = _mm_set1_epi16(0x84);
+        const __m128i offset = _mm_set1_epi16(132);
+        const __m128i mask = _mm_set1_epi8(0x07);
+
+        while (i >= 16) {
+            i -= 16;
+            const __m128i bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), _mm_set1_epi8(-1));
+            const __m128i exponent = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            const __m128i mantissa = _mm_and_si128(bytes, low_nibble);
+            const __m128i shift = _mm_shuffle_epi8(multiplier, exponent);
+            // mu-law samples are negative when the top bit of the inverted byte is set.
+            const __m128i negative = _mm_cmplt_epi8(bytes, zero);
+
+            __m128i lo = _mm_add_epi16(_mm_slli_epi16(_mm_unpacklo_epi8(mantissa, zero), 3), bias);
+            __m128i hi = _mm_add_epi16(_mm_slli_epi16(_mm_unpackhi_epi8(mantissa, zero), 3), bias);
+            lo = _mm_sub_epi16(_mm_mullo_epi16(lo, _mm_unpacklo_epi8(shift, zero)), offset);
+            hi = _mm_sub_epi16(_mm_mullo_epi16(hi, _mm_unpackhi_epi8(shift, zero)), offset);
+
+            const __m128i lo_sign = _mm_unpacklo_epi8(negative, negative);
+            const __m128i hi_sign = _mm_unpackhi_epi8(negative, negative);
+            _mm_storeu_si128((__m128i *)&dst[i], _mm_sub_epi16(_mm_xor_si128(lo, lo_sign), lo_sign));
+            _mm_storeu_si128((__m128i *)&dst[i + 8], _mm_sub_epi16(_mm_xor_si128(hi, hi_sign), hi_sign));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static size_t LAW_DecodeSamples_NEON(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t i)
+{
+    static const Uint8 alaw_implicit_bit[8] = { 0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 };
+    static const Uint8 alaw_multiplier[8] = { 1, 1, 2, 4, 8, 16, 32, 64 };
+    static const Uint8 mulaw_multiplier[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t low_nibble = vdupq_n_u8(0x0f);
+
+    if (encoding == ALAW_CODE) {
+        const uint8x8_t implicit_bit = vld1_u8(alaw_implicit_bit);
+        const uint8x8_t multiplier = vld1_u8(alaw_multiplier);
+
+        while (i >= 16) {
+            i -= 16;
+            const uint8x16_t bytes = vld1q_u8(&src[i]);
+            const uint8x16_t bits = veorq_u8(vandq_u8(bytes, vdupq_n_u8(0x7f)), vdupq_n_u8(0x55));
+            const uint8x16_t exponent = vshrq_n_u8(bits, 4);
+            const uint8x8_t exp_lo = vget_low_u8(exponent);
+            const uint8x8_t exp_hi = vget_high_u8(exponent);
+            uint8x16_t mantissa = vorrq_u8(vandq_u8(bits, low_nibble), vcombine_u8(vtbl1_u8(implicit_bit, exp_lo), vtbl1_u8(implicit_bit, exp_hi)));
+            // ((mantissa << 4) | 8) == ((mantissa << 1) | 1) << 3, which still fits in a byte.
+            mantissa = vorrq_u8(vshlq_n_u8(mantissa, 1), vdupq_n_u8(1));
+
+            int16x8_t lo = vreinterpretq_s16_u16(vshlq_n_u16(vmull_u8(vget_low_u8(mantissa), vtbl1_u8(multiplier, exp_lo)), 3));
+            int16x8_t hi = vreinterpretq_s16_u16(vshlq_n_u16(vmull_u8(vget_high_u8(mantissa), vtbl1_u8(multiplier, exp_hi)), 3));
+            // A-law samples are negative when the top bit is clear.
+            const int16x8_t bytes_lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bytes)));
+            const int16x8_t bytes_hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bytes)));
+            lo = vbslq_s16(vtstq_s16(bytes_lo, vdupq_n_s16(0x80)), lo, vnegq_s16(lo));
+            hi = vbslq_s16(vtstq_s16(bytes_hi, vdupq_n_s16(0x80)), hi, vnegq_s16(hi));
+
+            vst1q_s16(&dst[i], lo);
+            vst1q_s16(&dst[i + 8], hi);
+        }
+    } else if (encoding == MULAW_CODE) {
+        const uint8x8_t multiplier = vld1_u8(mulaw_multiplier);
+
+        while (i >= 16) {
+            i -= 16;
+            const uint8x16_t bytes = vmvnq_u8(vld1q_u8(&src[i]));
+            const uint8x16_t exponent = vandq_u8(vshrq_n_u8(bytes, 4), vdupq_n_u8(0x07));
+            // (mantissa << 3) + 0x84 is at most 0xfc, so it still fits in a byte.
+            const uint8x16_t mantissa = vaddq_u8(vshlq_n_u8(vandq_u8(bytes, low_nibble), 3), vdupq_n_u8(0x84));
+
+            int16x8_t lo = vsubq_s16(vreinterpretq_s16_u16(vmull_u8(vget_low_u8(mantissa), vtbl1_u8(multiplier, vget_low_u8(exponent)))), vdupq_n_s16(132));
+            int16x8_t hi = vsubq_s16(vreinterpretq_s16_u16(vmull_u8(vget_high_u8(mantissa), vtbl1_u8(multiplier, vget_high_u8(exponent)))), vdupq_n_s16(132));
+            // mu-law samples are negative when the top bit of the inverted byte is set.
+            const int16x8_t bytes_lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bytes)));
+            const int16x8_t bytes_hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bytes)));
+            lo = vbslq_s16(vtstq_s16(bytes_lo, vdupq_n_s16(0x80)), vnegq_s16(lo), lo);
+            hi = vbslq_s16(vtstq_s16(bytes_hi, vdupq_n_s16(0x80)), vnegq_s16(hi), hi);
+
+            vst1q_s16(&dst[i], lo);
+            vst1q_s16(&dst[i + 8], hi);
+        }
+    }
+
+    return i;
+}
+#endif
+
+// Expands `sample_count` companded samples in `src` to 16-bit PCM in `dst`. They can be the same buffer.
+static bool LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1200,53 +1477,22 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
+    size_t i;
 
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
+    // Work backwards, so this can expand in-place.
+    i = sample_count;
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        i = LAW_DecodeSamples_SSSE3(encoding, src, dst, i);
     }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        i = LAW_DecodeSamples_NEON(encoding, src, dst, i);
     }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+#endif
 
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1537,65 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+    Sint16 *dst;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    dst = (Sint16 *)src;
+
+    /* Expanding in-place. `format` will inform the caller about the byte
+     * order.
+     */
+    if (!LAW_DecodeSamples(file->format.encoding, src, dst, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1645,32 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    // work from end to start, since we're expanding in-place.
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1698,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1770,7 +2078,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads and checks everything up to the data chunk, and fills in `spec`.
+ * Afterwards, file->chunk describes the data chunk, but none of its data is
+ * read yet. `endposition` gets the position just past the WAVE data.
+ */
+static bool WaveLoadHeader(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1981,9 +2293,68 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
-    // Process data chunk.
     *chunk = datachunk;
 
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Will be shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (!WaveLoadHeader(src, file, spec, &endposition)) {
+        return false;
+    }
+
+    // Process data chunk.
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result < 0) {
@@ -2027,51 +2398,8 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
-    }
-
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return true;
 }
@@ -2116,6 +2444,7 @@ bool SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8
         SDL_free(*audio_buf);
         audio_buf = NULL;
         audio_len = 0;
+        SDL_zerop(spec);
     }
 
     // Cleanup
@@ -2149,3 +2478,310 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+/* Streaming decoder for SDL_OpenWAVStream_IO. The data chunk is read and
+ * decoded one block at a time, from the audio stream's get callback, so
+ * only a block of input and a block of output are ever held in memory.
+ */
+
+#define WAVE_STREAM_PROPERTY "SDL.internal.audiostream.wave"
+
+// Sample frames read at once for the formats that don't have blocks (PCM and companded).
+#define WAVE_STREAM_FRAMES 1024
+
+typedef struct WaveStream
+{
+    SDL_IOStream *src;
+    bool closeio;
+    WaveFile file;
+    ADPCM_DecoderState state; // Only used for the ADPCM encodings.
+    Uint8 *block;             // Input data. PCM and companded data are decoded in-place here.
+    size_t blocksize;         // Bytes of input to read at once.
+    Sint16 *output;           // Decoded ADPCM data.
+    Sint64 dataleft;          // Bytes of the data chunk that haven't been read yet.
+    Sint64 framesleft;        // Sample frames that still may be decoded.
+    bool finished;
+} WaveStream;
+
+static void WaveStreamFree(WaveStream *ws)
+{
+    if (ws) {
+        WaveFreeChunkData(&ws->file.chunk);
+        SDL_free(ws->file.decoderdata);
+        SDL_free(ws->state.cstate);
+        SDL_free(ws->block);
+        SDL_free(ws->output);
+        SDL_free(ws);
+    }
+}
+
+static void SDLCALL WaveStreamCleanup(void *userdata, void *value)
+{
+    WaveStream *ws = (WaveStream *)value;
+    if (ws->closeio) {
+        SDL_CloseIO(ws->src);
+    }
+    WaveStreamFree(ws);
+}
+
+// Like the decoders do for the whole file, recalculates the sample frames if the data chunk is truncated.
+static bool WaveStreamInit(WaveStream *ws, SDL_IOStream *src, const SDL_AudioSpec *spec)
+{
+    WaveFile *file = &ws->file;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    const Sint64 size = SDL_GetIOSize(src);
+    Sint64 datalength = chunk->length;
+
+    if (size >= 0 && chunk->position + datalength > size) {
+        // I/O issues or corrupt file.
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+        datalength = size > chunk->position ? size - chunk->position : 0;
+
+        switch (format->encoding) {
+        case MS_ADPCM_CODE:
+            if (!MS_ADPCM_CalculateSampleFrames(file, (size_t)datalength)) {
+                return false;
+            }
+            break;
+        case IMA_ADPCM_CODE:
+            if (!IMA_ADPCM_CalculateSampleFrames(file, (size_t)datalength)) {
+                return false;
+            }
+            break;
+        default:
+            file->sampleframes = WaveAdjustToFactValue(file, datalength / format->blockalign);
+            if (file->sampleframes < 0) {
+                return false;
+            }
+            break;
+        }
+    }
+
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        const bool ms = (format->encoding == MS_ADPCM_CODE);
+        ADPCM_DecoderState *state = &ws->state;
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->blockheadersize = (size_t)state->channels * (ms ? 7 : 4);
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = state->channels * sizeof(Sint16);
+        state->ddata = file->decoderdata;
+        state->framestotal = file->sampleframes;
+        state->output.size = state->samplesperblock * state->channels;
+        state->cstate = SDL_calloc(state->channels, ms ? sizeof(MS_ADPCM_ChannelState) : sizeof(Sint8));
+        ws->output = (Sint16 *)SDL_calloc(state->output.size, sizeof(Sint16));
+        ws->blocksize = state->blocksize;
+        ws->block = (Uint8 *)SDL_malloc(ws->blocksize);
+        if (!state->cstate || !ws->output || !ws->block) {
+            return false;
+        }
+    } else {
+        const size_t framesize = SDL_max(format->blockalign, SDL_AUDIO_FRAMESIZE(*spec));
+        ws->blocksize = (size_t)format->blockalign * WAVE_STREAM_FRAMES;
+        ws->block = (Uint8 *)SDL_malloc(framesize * WAVE_STREAM_FRAMES);
+        if (!ws->block) {
+            return false;
+        }
+    }
+
+    if (SDL_SeekIO(src, chunk->position, SDL_IO_SEEK_SET) != chunk->position) {
+        return SDL_SetError("Could not seek data of WAVE data chunk");
+    }
+
+    ws->src = src;
+    ws->dataleft = datalength;
+    ws->framesleft = file->sampleframes;
+    return true;
+}
+
+static int WaveStreamDecodeADPCMBlock(WaveStream *ws, size_t length)
+{
+    WaveFile *file = &ws->file;
+    ADPCM_DecoderState *state = &ws->state;
+    bool result;
+
+    if (length < state->blockheadersize) {
+        return 0; // A truncated block header ends the decoding, like it does for the whole file.
+    }
+
+    state->framesleft = ws->framesleft;
+    state->block.data = ws->block;
+    state->block.size = length;
+    state->block.pos = 0;
+    state->output.data = ws->output;
+    state->output.pos = 0;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        if (!MS_ADPCM_DecodeBlockHeader(state)) {
+            return -1;
+        }
+        result = MS_ADPCM_DecodeBlockData(state);
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(state);
+        if (result) {
+            result = IMA_ADPCM_DecodeBlockData(state);
+        }
+    }
+
+    if (!result) {
+        // Unexpected end. Stop decoding and return partial data if necessary.
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            SDL_SetError("Truncated data chunk");
+            return -1;
+        } else if (file->trunchint != TruncDropFrame) {
+            state->output.pos -= state->output.pos % (state->samplesperblock * state->channels);
+        }
+        ws->dataleft = 0;
+    }
+
+    ws->framesleft = state->framesleft;
+    return (int)(state->output.pos * sizeof(Sint16));
+}
+
+/* Reads and decodes the next block, and points `data` at the result. Returns
+ * the number of bytes decoded, 0 at the end of the data, or -1 on error.
+ */
+static int WaveStreamDecodeBlock(WaveStream *ws, const Uint8 **data)
+{
+    WaveFormat *format = &ws->file.format;
+    size_t length = ws->blocksize;
+    size_t frames;
+
+    if (ws->framesleft <= 0 || ws->dataleft <= 0) {
+        return 0;
+    } else if ((Sint64)length > ws->dataleft) {
+        length = (size_t)ws->dataleft;
+    }
+
+    length = SDL_ReadIO(ws->src, ws->block, length);
+    ws->dataleft = (length > 0) ? (ws->dataleft - (Sint64)length) : 0;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        *data = (const Uint8 *)ws->output;
+        return WaveStreamDecodeADPCMBlock(ws, length);
+    default:
+        break;
+    }
+
+    // Incomplete sample frames are dropped.
+    frames = length / format->blockalign;
+    if ((Sint64)frames > ws->framesleft) {
+        frames = (size_t)ws->framesleft;
+    }
+    ws->framesleft -= frames;
+    *data = ws->block;
+
+    switch (format->encoding) {
+    case ALAW_CODE:
+    case MULAW_CODE:
+        if (!LAW_DecodeSamples(format->encoding, ws->block, (Sint16 *)ws->block, frames * format->channels)) {
+            return -1;
+        }
+        return (int)(frames * format->channels * sizeof(Sint16));
+    case PCM_CODE:
+        if (format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(ws->block, frames * format->channels);
+            return (int)(frames * format->channels * sizeof(Sint32));
+        }
+        break;
+    default:
+        break;
+    }
+    return (int)(frames * format->blockalign);
+}
+
+static void SDLCALL WaveStreamGetCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *ws = (WaveStream *)userdata;
+
+    while (additional_amount > 0 && !ws->finished) {
+        const Uint8 *data = NULL;
+        const int length = WaveStreamDecodeBlock(ws, &data);
+        if (length <= 0) {
+            // End of the data, or an error. Either way, let the last of it through the resampler.
+            ws->finished = true;
+            SDL_FlushAudioStream(stream);
+        } else if (!SDL_PutAudioStreamData(stream, data, length)) {
+            break;
+        } else {
+            additional_amount -= length;
+        }
+    }
+}
+
+SDL_AudioStream *SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec)
+{
+    SDL_AudioStream *stream = NULL;
+    WaveStream *ws = NULL;
+    SDL_AudioSpec wavespec;
+    Sint64 endposition;
+
+    if (spec) {
+        SDL_zerop(spec);
+    }
+
+    // Make sure we are passed a valid data source
+    if (!src) {
+        SDL_InvalidParamError("src");
+        goto failed;
+    }
+
+    ws = (WaveStream *)SDL_calloc(1, sizeof(*ws));
+    if (!ws) {
+        goto failed;
+    }
+
+    SDL_zero(wavespec);
+    ws->file.riffhint = WaveGetRiffSizeHint();
+    ws->file.trunchint = WaveGetTruncationHint();
+    ws->file.facthint = WaveGetFactChunkHint();
+    ws->closeio = closeio;
+
+    if (!WaveLoadHeader(src, &ws->file, &wavespec, &endposition) || !WaveStreamInit(ws, src, &wavespec)) {
+        goto failed;
+    }
+
+    stream = SDL_CreateAudioStream(&wavespec, &wavespec);
+    if (!stream) {
+        goto failed;
+    }
+
+    // From here on, destroying the stream cleans everything up, including src if closeio is set.
+    if (!SDL_SetPointerPropertyWithCleanup(SDL_GetAudioStreamProperties(stream), WAVE_STREAM_PROPERTY, ws, WaveStreamCleanup, NULL)) {
+        SDL_DestroyAudioStream(stream); // the cleanup already ran.
+        return NULL;
+    } else if (!SDL_SetAudioStreamGetCallback(stream, WaveStreamGetCallback, ws)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    if (spec) {
+        SDL_copyp(spec, &wavespec);
+    }
+    return stream;
+
+failed:
+    SDL_DestroyAudioStream(stream);
+    WaveStreamFree(ws);
+    if (closeio && src) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+SDL_AudioStream *SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(path, "rb");
+    if (!stream) {
+        if (spec) {
+            SDL_zerop(spec);
+        }
+        return NULL;
+    }
+    return SDL_OpenWAVStream_IO(stream, true, spec);
+}
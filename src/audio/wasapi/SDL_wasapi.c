@@ -364,6 +364,7 @@ static void ResetWasapiDevice(SDL_AudioDevice *device)
     if (device->hidden->capture) {
         IAudioCaptureClient *capture = device->hidden->capture;
         device->hidden->capture = NULL;
+        device->hidden->recorded_frames = 0;  // any held packet goes away with the client.
         WASAPI_ProxyToManagementThread(mgmtthrtask_ReleaseCaptureClient, capture, NULL);
     }
 
@@ -466,7 +467,7 @@ static bool WASAPI_PlayDevice(SDL_AudioDevice *device, const Uint8 *buffer, int
     return true;
 }
 
-static bool WASAPI_WaitDevice(SDL_AudioDevice *device)
+static bool WaitWasapiDevice(SDL_AudioDevice *device)
 {
     // WaitDevice does not hold the device lock, so check for recovery/disconnect details here.
     while (RecoverWasapiIfLost(device) && device->hidden->client && device->hidden->event) {
@@ -475,6 +476,7 @@ static bool WASAPI_WaitDevice(SDL_AudioDevice *device)
             UINT32 padding = 0;
             if (!WasapiFailed(device, IAudioClient_GetCurrentPadding(device->hidden->client, &padding))) {
                 //SDL_Log("WASAPI EVENT! padding=%u maxpadding=%u", (unsigned int)padding, (unsigned int)maxpadding);
+                SDL_SetAtomicU32(&device->stats_padding_frames, padding);
                 if (padding > 0) {
                     break;
                 }
@@ -496,6 +498,7 @@ static bool WASAPI_WaitDevice(SDL_AudioDevice *device)
                 UINT32 padding = 0;
                 if (!WasapiFailed(device, IAudioClient_GetCurrentPadding(device->hidden->client, &padding))) {
                     //SDL_Log("WASAPI EVENT! padding=%u maxpadding=%u", (unsigned int)padding, (unsigned int)maxpadding);
+                    SDL_SetAtomicU32(&device->stats_padding_frames, padding);
                     if (padding <= (UINT32)device->sample_frames) {
                         break;
                     }
@@ -511,41 +514,59 @@ static bool WASAPI_WaitDevice(SDL_AudioDevice *device)
     return true;
 }
 
-static int WASAPI_RecordDevice(SDL_AudioDevice *device, void *buffer, int buflen)
+static bool WASAPI_WaitDevice(SDL_AudioDevice *device)
+{
+    SDL_TRACE_ZONE_BEGIN(zone, "WASAPI_WaitDevice");
+    const bool result = WaitWasapiDevice(device);
+    SDL_TRACE_ZONE_END(zone);
+    return result;
+}
+
+// Recorded packets are handed to SDL as-is and only released once every bound stream has read them.
+static const Uint8 *WASAPI_GetRecordingBuf(SDL_AudioDevice *device, int *buffer_size)
 {
     BYTE *ptr = NULL;
     UINT32 frames = 0;
     DWORD flags = 0;
 
+    SDL_assert(device->hidden->recorded_frames == 0);
+
     while (device->hidden->capture) {
         const HRESULT ret = IAudioCaptureClient_GetBuffer(device->hidden->capture, &ptr, &frames, &flags, NULL, NULL);
         if (ret == AUDCLNT_S_BUFFER_EMPTY) {
-            return 0;  // in theory we should have waited until there was data, but oh well, we'll go back to waiting. Returning 0 is safe in SDL3.
+            *buffer_size = 0;  // in theory we should have waited until there was data, but oh well, we'll go back to waiting. Returning 0 is safe in SDL3.
+            return NULL;
         }
 
         WasapiFailed(device, ret); // mark device lost/failed if necessary.
 
         if (ret == S_OK) {
             const int total = ((int)frames) * device->hidden->framesize;
-            const int cpy = SDL_min(buflen, total);
-            const int leftover = total - cpy;
-            const bool silent = (flags & AUDCLNT_BUFFERFLAGS_SILENT) ? true : false;
-
-            SDL_assert(leftover == 0);  // according to MSDN, this isn't everything available, just one "packet" of data per-GetBuffer call.
+            const int cpy = SDL_min(device->buffer_size, total);
 
-            if (silent) {
-                SDL_memset(buffer, device->silence_value, cpy);
-            } else {
-                SDL_memcpy(buffer, ptr, cpy);
-            }
+            SDL_assert(cpy == total);  // according to MSDN, this isn't everything available, just one "packet" of data per-GetBuffer call.
 
-            WasapiFailed(device, IAudioCaptureClient_ReleaseBuffer(device->hidden->capture, frames));
+            device->hidden->recorded_frames = frames;
+            *buffer_size = cpy;
 
-            return cpy;
+            if (flags & AUDCLNT_BUFFERFLAGS_SILENT) {
+                SDL_memset(device->work_buffer, device->silence_value, cpy);  // the packet's contents are undefined.
+                return device->work_buffer;
+            }
+            return (const Uint8 *)ptr;
         }
     }
 
-    return -1; // unrecoverable error.
+    *buffer_size = -1; // unrecoverable error.
+    return NULL;
+}
+
+static void WASAPI_ReleaseRecordingBuf(SDL_AudioDevice *device, const Uint8 *buffer, int buflen)
+{
+    if (device->hidden->capture && device->hidden->recorded_frames) {
+        WasapiFailed(device, IAudioCaptureClient_ReleaseBuffer(device->hidden->capture, device->hidden->recorded_frames));
+    }
+    device->hidden->recorded_frames = 0;
 }
 
 static void WASAPI_FlushRecording(SDL_AudioDevice *device)
@@ -577,22 +598,92 @@ static void WASAPI_CloseDevice(SDL_AudioDevice *device)
     }
 }
 
+// Replaces the mix format in device->hidden->waveformat with the exclusive format on success.
+static bool WASAPI_InitializeExclusive(SDL_AudioDevice *device, IAudioClient *client)
+{
+    const WAVEFORMATEX *mixformat = device->hidden->waveformat;
+    const DWORD channel_mask = (mixformat->wFormatTag == WAVE_FORMAT_EXTENSIBLE) ? ((const WAVEFORMATEXTENSIBLE *)mixformat)->dwChannelMask : 0;
+    const int rates[2] = { device->spec.freq, (int)mixformat->nSamplesPerSec };
+    WAVEFORMATEXTENSIBLE format;
+    bool found = false;
+    HRESULT ret;
+
+    // Exclusive mode has no closest match, so try the formats we can convert to one by one.
+    for (int i = 0; (i < (int)SDL_arraysize(rates)) && !found; i += 1) {
+        if ((i > 0) && (rates[i] == rates[0])) {
+            break;
+        }
+
+        SDL_AudioFormat test_format;
+        const SDL_AudioFormat *closefmts = SDL_ClosestAudioFormats(device->spec.format);
+        while (!found && ((test_format = *(closefmts++)) != 0)) {
+            if ((test_format != SDL_AUDIO_F32) && (test_format != SDL_AUDIO_S32) && (test_format != SDL_AUDIO_S16)) {
+                continue;  // not something SDL_WaveFormatExToSDLFormat understands.
+            }
+            SDL_SDLFormatToWaveFormatExtensible(test_format, mixformat->nChannels, rates[i], channel_mask, &format);
+            found = (IAudioClient_IsFormatSupported(client, AUDCLNT_SHAREMODE_EXCLUSIVE, (const WAVEFORMATEX *)&format, NULL) == S_OK);
+        }
+    }
+
+    if (!found) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "WASAPI: no exclusive mode format found, using shared mode");
+        return false;
+    }
+
+    REFERENCE_TIME default_period = 0;
+    REFERENCE_TIME min_period = 0;
+    ret = IAudioClient_GetDevicePeriod(client, &default_period, &min_period);
+    if (FAILED(ret)) {
+        return false;
+    }
+
+    // Use a shorter period if the app asked for fewer sample frames than the default period holds.
+    REFERENCE_TIME period = default_period;
+    const REFERENCE_TIME requested_period = (REFERENCE_TIME)(((double)device->sample_frames * 10000000.0) / device->spec.freq);
+    if (requested_period < default_period) {
+        period = SDL_max(min_period, requested_period);
+    }
+
+    /* Event driven exclusive streams need an aligned buffer, which the driver would otherwise
+       refuse with AUDCLNT_E_BUFFER_SIZE_NOT_ALIGNED, leaving the client unusable. HD Audio
+       needs 128 bytes, so align to that up front. */
+    UINT32 period_frames = (UINT32)SDL_ceil(((double)period * format.Format.nSamplesPerSec) / 10000000.0);
+    while (((period_frames * format.Format.nBlockAlign) % 128) != 0) {
+        period_frames++;
+    }
+    period = (REFERENCE_TIME)SDL_ceil(((double)period_frames * 10000000.0) / format.Format.nSamplesPerSec);
+
+    WAVEFORMATEX *waveformat = (WAVEFORMATEX *)CoTaskMemAlloc(sizeof(format));
+    if (!waveformat) {
+        return false;
+    }
+    SDL_memcpy(waveformat, &format, sizeof(format));
+
+    // Event driven exclusive mode requires the buffer duration to equal the period.
+    ret = IAudioClient_Initialize(client, AUDCLNT_SHAREMODE_EXCLUSIVE, AUDCLNT_STREAMFLAGS_EVENTCALLBACK, period, period, waveformat, NULL);
+    if (FAILED(ret)) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "WASAPI: exclusive mode refused (0x%lx), using shared mode", (unsigned long)ret);
+        CoTaskMemFree(waveformat);
+        return false;
+    }
+
+    CoTaskMemFree(device->hidden->waveformat);
+    device->hidden->waveformat = waveformat;
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "WASAPI: using exclusive mode, %u Hz, %u bits, %u frame period",
+                 (unsigned int)format.Format.nSamplesPerSec, (unsigned int)format.Format.wBitsPerSample, (unsigned int)period_frames);
+    return true;
+}
+
 static bool mgmtthrtask_PrepDevice(void *userdata)
 {
     SDL_AudioDevice *device = (SDL_AudioDevice *)userdata;
 
-    /* !!! FIXME: we could request an exclusive mode stream, which is lower latency;
-       !!!  it will write into the kernel's audio buffer directly instead of
-       !!!  shared memory that a user-mode mixer then writes to the kernel with
-       !!!  everything else. Doing this means any other sound using this device will
-       !!!  stop playing, including the user's MP3 player and system notification
-       !!!  sounds. You'd probably need to release the device when the app isn't in
-       !!!  the foreground, to be a good citizen of the system. It's doable, but it's
-       !!!  more work and causes some annoyances, and I don't know what the latency
-       !!!  wins actually look like. Maybe add a hint to force exclusive mode at
-       !!!  some point. To be sure, defaulting to shared mode is the right thing to
-       !!!  do in any case. */
-    const AUDCLNT_SHAREMODE sharemode = AUDCLNT_SHAREMODE_SHARED;
+    /* Defaulting to shared mode is the right thing to do: an exclusive mode stream writes
+       into the kernel's audio buffer directly, but any other sound using this device will
+       stop playing, including the user's MP3 player and system notification sounds.
+       SDL_HINT_AUDIO_WASAPI_EXCLUSIVE opts in to it for playback. */
+    AUDCLNT_SHAREMODE sharemode = AUDCLNT_SHAREMODE_SHARED;
 
     IAudioClient *client = device->hidden->client;
     SDL_assert(client != NULL);
@@ -612,6 +703,13 @@ static bool mgmtthrtask_PrepDevice(void *userdata)
     SDL_assert(waveformat != NULL);
     device->hidden->waveformat = waveformat;
 
+    if (!device->recording && SDL_GetHintBoolean(SDL_HINT_AUDIO_WASAPI_EXCLUSIVE, false)) {
+        if (WASAPI_InitializeExclusive(device, client)) {
+            sharemode = AUDCLNT_SHAREMODE_EXCLUSIVE;
+            waveformat = device->hidden->waveformat;
+        }
+    }
+
     SDL_AudioSpec newspec;
     newspec.channels = (Uint8)waveformat->nChannels;
 
@@ -639,12 +737,23 @@ static bool mgmtthrtask_PrepDevice(void *userdata)
 
     DWORD streamflags = 0;
 
+    /* Shared mode periods smaller than the engine default need IAudioClient3, which only
+       accepts the engine's mix format. If the app asked for fewer sample frames than the
+       default period holds, keep the mix rate and let SDL resample instead of WASAPI. */
+    bool want_small_period = false;
+#ifdef __IAudioClient3_INTERFACE_DEFINED__
+    if (sharemode == AUDCLNT_SHAREMODE_SHARED) {
+        const float default_period_frames = (default_period / 10000.0f) * device->spec.freq / 1000.0f;
+        want_small_period = ((float)device->sample_frames < default_period_frames);
+    }
+#endif
+
     /* we've gotten reports that WASAPI's resampler introduces distortions, but in the short term
        it fixes some other WASAPI-specific quirks we haven't quite tracked down.
        Refer to bug #6326 for the immediate concern. */
 #if 1
     // favor WASAPI's resampler over our own
-    if ((DWORD)device->spec.freq != waveformat->nSamplesPerSec) {
+    if (sharemode == AUDCLNT_SHAREMODE_SHARED && !want_small_period && (DWORD)device->spec.freq != waveformat->nSamplesPerSec) {
         streamflags |= (AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY);
         waveformat->nSamplesPerSec = device->spec.freq;
         waveformat->nAvgBytesPerSec = waveformat->nSamplesPerSec * waveformat->nChannels * (waveformat->wBitsPerSample / 8);
@@ -670,15 +779,24 @@ static bool mgmtthrtask_PrepDevice(void *userdata)
             UINT32 max_period_in_frames = 0;
             ret = IAudioClient3_GetSharedModeEnginePeriod(client3, waveformat,
                                                           &default_period_in_frames, &fundamental_period_in_frames, &min_period_in_frames, &max_period_in_frames);
-            if (SUCCEEDED(ret)) {
+            if (SUCCEEDED(ret) && fundamental_period_in_frames > 0) {
+                // sample_frames is at the app's rate, but the engine period is at the stream's rate.
+                const double requested_frames = (double)device->sample_frames * waveformat->nSamplesPerSec / device->spec.freq;
+
                 // IAudioClient3_InitializeSharedAudioStream only accepts the integral multiple of fundamental_period_in_frames
-                UINT32 period_in_frames = fundamental_period_in_frames * (UINT32)SDL_round((double)device->sample_frames / fundamental_period_in_frames);
+                UINT32 period_in_frames = fundamental_period_in_frames * (UINT32)SDL_round(requested_frames / fundamental_period_in_frames);
                 period_in_frames = SDL_clamp(period_in_frames, min_period_in_frames, max_period_in_frames);
 
                 ret = IAudioClient3_InitializeSharedAudioStream(client3, streamflags, period_in_frames, waveformat, NULL);
                 if (SUCCEEDED(ret)) {
+                    // Report the period we actually got through the device's sample frames.
                     new_sample_frames = (int)period_in_frames;
                     iaudioclient3_initialized = true;
+                    SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "WASAPI: using a %u frame shared mode period (engine minimum %u, default %u)",
+                                 (unsigned int)period_in_frames, (unsigned int)min_period_in_frames, (unsigned int)default_period_in_frames);
+                } else {
+                    // The driver refused the period; fall back to a regular shared mode stream below.
+                    SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "WASAPI: low latency shared mode period refused (0x%lx)", (unsigned long)ret);
                 }
             }
 
@@ -687,8 +805,11 @@ static bool mgmtthrtask_PrepDevice(void *userdata)
     }
 #endif
 
-    if (!iaudioclient3_initialized)
+    if (sharemode == AUDCLNT_SHAREMODE_EXCLUSIVE) {
+        ret = S_OK;  // already initialized by WASAPI_InitializeExclusive.
+    } else if (!iaudioclient3_initialized) {
         ret = IAudioClient_Initialize(client, sharemode, streamflags, 0, 0, waveformat, NULL);
+    }
 
     if (FAILED(ret)) {
         return WIN_SetErrorFromHRESULT("WASAPI can't initialize audio client", ret);
@@ -705,6 +826,17 @@ static bool mgmtthrtask_PrepDevice(void *userdata)
         return WIN_SetErrorFromHRESULT("WASAPI can't determine buffer size", ret);
     }
 
+    // this is in 100-nanosecond units. It's only informational, so don't fail if the driver won't tell us.
+    REFERENCE_TIME stream_latency = 0;
+    if (SUCCEEDED(IAudioClient_GetStreamLatency(client, &stream_latency)) && (stream_latency > 0)) {
+        SDL_SetAtomicU32(&device->stats_latency_ns, (Uint32) SDL_min(stream_latency * 100, (REFERENCE_TIME) SDL_MAX_UINT32));
+    }
+
+    // Exclusive mode hands over the whole endpoint buffer every period.
+    if (sharemode == AUDCLNT_SHAREMODE_EXCLUSIVE) {
+        new_sample_frames = (int) bufsize;
+    }
+
     // Match the callback size to the period size to cut down on the number of
     // interrupts waited for in each call to WaitDevice
     if (new_sample_frames <= 0) {
@@ -783,6 +915,17 @@ static bool WASAPI_OpenDevice(SDL_AudioDevice *device)
     return true;
 }
 
+WCHAR *WASAPI_GetThreadTaskClass(void)
+{
+    const char *task = SDL_GetHint(SDL_HINT_AUDIO_WASAPI_TASK_CLASS);
+    if (!task) {
+        task = "Pro Audio";
+    } else if (!*task) {
+        return NULL;
+    }
+    return WIN_UTF8ToStringW(task);
+}
+
 static void WASAPI_ThreadInit(SDL_AudioDevice *device)
 {
     WASAPI_PlatformThreadInit(device);
@@ -836,7 +979,8 @@ static bool WASAPI_Init(SDL_AudioDriverImpl *impl)
     impl->WaitDevice = WASAPI_WaitDevice;
     impl->GetDeviceBuf = WASAPI_GetDeviceBuf;
     impl->WaitRecordingDevice = WASAPI_WaitDevice;
-    impl->RecordDevice = WASAPI_RecordDevice;
+    impl->GetRecordingBuf = WASAPI_GetRecordingBuf;
+    impl->ReleaseRecordingBuf = WASAPI_ReleaseRecordingBuf;
     impl->FlushRecording = WASAPI_FlushRecording;
     impl->CloseDevice = WASAPI_CloseDevice;
     impl->DeinitializeStart = WASAPI_DeinitializeStart;
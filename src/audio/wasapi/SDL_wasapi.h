@@ -40,6 +40,7 @@ struct SDL_PrivateAudioData
     HANDLE task;
     bool coinitialized;
     int framesize;
+    UINT32 recorded_frames;  // frames in the capture packet SDL is still reading, see WASAPI_GetRecordingBuf.
     SDL_AtomicInt device_disconnecting;
     bool device_lost;
     bool device_dead;
@@ -49,6 +50,7 @@ struct SDL_PrivateAudioData
 // win32 and winrt implementations call into these.
 bool WASAPI_PrepDevice(SDL_AudioDevice *device);
 void WASAPI_DisconnectDevice(SDL_AudioDevice *device);  // don't hold the device lock when calling this!
+WCHAR *WASAPI_GetThreadTaskClass(void);  // MMCSS task for device threads from SDL_HINT_AUDIO_WASAPI_TASK_CLASS, or NULL if disabled. SDL_free() it.
 
 
 // BE CAREFUL: if you are holding the device lock and proxy to the management thread with wait_until_complete, and grab the lock again, you will deadlock.
@@ -137,14 +137,19 @@ void WASAPI_PlatformThreadInit(SDL_AudioDevice *device)
         device->hidden->coinitialized = true;
     }
 
-    // Set this thread to very high "Pro Audio" priority.
+    // Set this thread to very high "Pro Audio" priority, or whatever MMCSS task the app asked for.
     if (pAvSetMmThreadCharacteristicsW) {
-        DWORD idx = 0;
-        device->hidden->task = pAvSetMmThreadCharacteristicsW(L"Pro Audio", &idx);
-    } else {
-        SDL_SetCurrentThreadPriority(device->recording ? SDL_THREAD_PRIORITY_HIGH : SDL_THREAD_PRIORITY_TIME_CRITICAL);
+        WCHAR *task = WASAPI_GetThreadTaskClass();
+        if (task) {
+            DWORD idx = 0;
+            device->hidden->task = pAvSetMmThreadCharacteristicsW(task, &idx);
+            SDL_free(task);
+        }
     }
 
+    if (!device->hidden->task) {
+        SDL_SetCurrentThreadPriority(device->recording ? SDL_THREAD_PRIORITY_HIGH : SDL_THREAD_PRIORITY_TIME_CRITICAL);
+    }
 }
 
 void WASAPI_PlatformThreadDeinit(SDL_AudioDevice *device)
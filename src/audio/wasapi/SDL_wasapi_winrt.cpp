@@ -30,6 +30,7 @@
 #include <windows.media.devices.h>
 #include <wrl/implements.h>
 #include <collection.h>
+#include <avrt.h>
 
 extern "C" {
 #include "../../core/windows/SDL_windows.h"
@@ -60,6 +61,169 @@ static SDL_AudioDevice *FindWinRTAudioDevice(LPCWSTR devid)
     return SDL_FindPhysicalAudioDeviceByCallback(FindWinRTAudioDeviceCallback, (void *) devid);
 }
 
+class SDL_WasapiActivationHandler : public RuntimeClass<RuntimeClassFlags<ClassicCom>, FtmBase, IActivateAudioInterfaceCompletionHandler>
+{
+public:
+    SDL_WasapiActivationHandler() : completion_semaphore(SDL_CreateSemaphore(0)) { SDL_assert(completion_semaphore != NULL); }
+    ~SDL_WasapiActivationHandler() { if (completion_semaphore) { SDL_DestroySemaphore(completion_semaphore); } }
+    STDMETHOD(ActivateCompleted)(IActivateAudioInterfaceAsyncOperation *operation);
+    void WaitForCompletion();
+private:
+    SDL_Semaphore *completion_semaphore;
+};
+
+void SDL_WasapiActivationHandler::WaitForCompletion()
+{
+    if (completion_semaphore) {
+        SDL_WaitSemaphore(completion_semaphore);
+        SDL_DestroySemaphore(completion_semaphore);
+        completion_semaphore = NULL;
+    }
+}
+
+HRESULT
+SDL_WasapiActivationHandler::ActivateCompleted(IActivateAudioInterfaceAsyncOperation *async)
+{
+    // Just set a flag, since we're probably in a different thread. We'll pick it up and init everything on our own thread to prevent races.
+    SDL_SignalSemaphore(completion_semaphore);
+    return S_OK;
+}
+
+static bool BeginEndpointActivation(LPCWSTR devid, ComPtr<SDL_WasapiActivationHandler> &handler, IActivateAudioInterfaceAsyncOperation **async)
+{
+    handler = Make<SDL_WasapiActivationHandler>();
+    if (handler == nullptr) {
+        return SDL_SetError("Failed to allocate WASAPI activation handler");
+    }
+
+    *async = nullptr;
+    const HRESULT ret = ActivateAudioInterfaceAsync(devid, __uuidof(IAudioClient), nullptr, handler.Get(), async);
+    if (FAILED(ret) || *async == nullptr) {
+        if (*async != nullptr) {
+            (*async)->Release();
+            *async = nullptr;
+        }
+        handler = nullptr;
+        return WIN_SetErrorFromHRESULT("WASAPI can't activate requested audio endpoint", ret);
+    }
+    return true;
+}
+
+/* ActivateAudioInterfaceAsync can take a while, so we start it ahead of time for endpoints that become the default, and
+   opening one (at startup, or when migrating after a default change) just takes the result. An activated IAudioClient
+   that hasn't been initialized yet is cheap to hold on to. Every endpoint that has been a default keeps an entry, so
+   switching back and forth between, say, speakers and a headset is fast both ways. This is only done for playback:
+   activating a recording endpoint can put up a microphone permission prompt, which shouldn't happen before the app
+   actually asks to record. */
+struct SDL_WasapiPreactivation
+{
+    LPWSTR devid;
+    ComPtr<SDL_WasapiActivationHandler> handler;
+    IActivateAudioInterfaceAsyncOperation *async;  // nullptr if the last one was handed out and another couldn't be started.
+    SDL_WasapiPreactivation *next;
+};
+
+static SDL_Mutex *preactivation_lock;
+static SDL_WasapiPreactivation *preactivations;
+
+static void ReleasePreactivation(SDL_WasapiPreactivation *item)
+{
+    if (item->async) {
+        item->async->Release();  // if this is still in flight, the operation holds its own reference to the handler.
+    }
+    SDL_free(item->devid);
+    delete item;
+}
+
+static void PreactivateEndpoint(LPCWSTR devid)
+{
+    if (!devid || !preactivation_lock) {
+        return;
+    }
+
+    SDL_LockMutex(preactivation_lock);
+    SDL_WasapiPreactivation *item = preactivations;
+    while (item && (SDL_wcscmp(item->devid, devid) != 0)) {
+        item = item->next;
+    }
+
+    if (!item) {
+        item = new SDL_WasapiPreactivation();
+        item->devid = SDL_wcsdup(devid);
+        if (!item->devid) {
+            delete item;
+            item = nullptr;
+        } else {
+            item->next = preactivations;
+            preactivations = item;
+        }
+    }
+
+    if (item && !item->async) {
+        BeginEndpointActivation(devid, item->handler, &item->async);  // if this fails, opening will just try again the slow way.
+    }
+    SDL_UnlockMutex(preactivation_lock);
+}
+
+// Hands over a pending or finished activation for `devid`, if there is one, and starts another for next time.
+static bool TakePreactivatedEndpoint(LPCWSTR devid, ComPtr<SDL_WasapiActivationHandler> &handler, IActivateAudioInterfaceAsyncOperation **async)
+{
+    bool found = false;
+    if (preactivation_lock) {
+        SDL_LockMutex(preactivation_lock);
+        for (SDL_WasapiPreactivation *item = preactivations; item; item = item->next) {
+            if (item->async && (SDL_wcscmp(item->devid, devid) == 0)) {
+                handler = item->handler;
+                *async = item->async;
+                item->handler = nullptr;
+                item->async = nullptr;
+                found = true;
+                break;
+            }
+        }
+        SDL_UnlockMutex(preactivation_lock);
+    }
+
+    if (found) {
+        PreactivateEndpoint(devid);
+    }
+    return found;
+}
+
+static void DiscardPreactivatedEndpoint(LPCWSTR devid)
+{
+    if (preactivation_lock) {
+        SDL_LockMutex(preactivation_lock);
+        SDL_WasapiPreactivation *prev = nullptr;
+        for (SDL_WasapiPreactivation *item = preactivations; item; prev = item, item = item->next) {
+            if (SDL_wcscmp(item->devid, devid) == 0) {
+                if (prev) {
+                    prev->next = item->next;
+                } else {
+                    preactivations = item->next;
+                }
+                ReleasePreactivation(item);
+                break;
+            }
+        }
+        SDL_UnlockMutex(preactivation_lock);
+    }
+}
+
+static void DiscardAllPreactivatedEndpoints(void)
+{
+    if (preactivation_lock) {
+        SDL_LockMutex(preactivation_lock);
+        SDL_WasapiPreactivation *next = nullptr;
+        for (SDL_WasapiPreactivation *item = preactivations; item; item = next) {
+            next = item->next;
+            ReleasePreactivation(item);
+        }
+        preactivations = nullptr;
+        SDL_UnlockMutex(preactivation_lock);
+    }
+}
+
 class SDL_WasapiDeviceEventHandler
 {
   public:
@@ -71,10 +235,8 @@ class SDL_WasapiDeviceEventHandler
     void OnEnumerationCompleted(DeviceWatcher ^ sender, Platform::Object ^ args);
     void OnDefaultRenderDeviceChanged(Platform::Object ^ sender, DefaultAudioRenderDeviceChangedEventArgs ^ args);
     void OnDefaultCaptureDeviceChanged(Platform::Object ^ sender, DefaultAudioCaptureDeviceChangedEventArgs ^ args);
-    void WaitForCompletion();
 
   private:
-    SDL_Semaphore *completed_semaphore;
     const bool recording;
     DeviceWatcher ^ watcher;
     Windows::Foundation::EventRegistrationToken added_handler;
@@ -85,12 +247,8 @@ class SDL_WasapiDeviceEventHandler
 };
 
 SDL_WasapiDeviceEventHandler::SDL_WasapiDeviceEventHandler(const bool _recording)
-    : recording(_recording), completed_semaphore(SDL_CreateSemaphore(0))
+    : recording(_recording)
 {
-    if (!completed_semaphore) {
-        return; // uhoh.
-    }
-
     Platform::String ^ selector = _recording ? MediaDevice::GetAudioCaptureSelector() : MediaDevice::GetAudioRenderSelector();
     Platform::Collections::Vector<Platform::String ^> properties;
     properties.Append(SDL_PKEY_AudioEngine_DeviceFormat);
@@ -122,11 +280,6 @@ SDL_WasapiDeviceEventHandler::~SDL_WasapiDeviceEventHandler()
         watcher = nullptr;
     }
 
-    if (completed_semaphore) {
-        SDL_DestroySemaphore(completed_semaphore);
-        completed_semaphore = nullptr;
-    }
-
     if (recording) {
         MediaDevice::DefaultAudioCaptureDeviceChanged -= default_changed_handler;
     } else {
@@ -142,6 +295,10 @@ void SDL_WasapiDeviceEventHandler::OnDeviceAdded(DeviceWatcher ^ sender, DeviceI
        available and switch automatically. (!!! FIXME...?) */
 
     SDL_assert(sender == this->watcher);
+    if (FindWinRTAudioDevice(info->Id->Data())) {
+        return;  // the default endpoint, which we added at startup before the watcher got to it.
+    }
+
     char *utf8dev = WIN_StringToUTF8W(info->Name->Data());
     if (utf8dev) {
         SDL_AudioSpec spec;
@@ -171,6 +328,7 @@ void SDL_WasapiDeviceEventHandler::OnDeviceAdded(DeviceWatcher ^ sender, DeviceI
 void SDL_WasapiDeviceEventHandler::OnDeviceRemoved(DeviceWatcher ^ sender, DeviceInformationUpdate ^ info)
 {
     SDL_assert(sender == this->watcher);
+    DiscardPreactivatedEndpoint(info->Id->Data());
     WASAPI_DisconnectDevice(FindWinRTAudioDevice(info->Id->Data()));
 }
 
@@ -182,14 +340,12 @@ void SDL_WasapiDeviceEventHandler::OnDeviceUpdated(DeviceWatcher ^ sender, Devic
 void SDL_WasapiDeviceEventHandler::OnEnumerationCompleted(DeviceWatcher ^ sender, Platform::Object ^ args)
 {
     SDL_assert(sender == this->watcher);
-    if (this->completed_semaphore) {
-        SDL_SignalSemaphore(this->completed_semaphore);
-    }
 }
 
 void SDL_WasapiDeviceEventHandler::OnDefaultRenderDeviceChanged(Platform::Object ^ sender, DefaultAudioRenderDeviceChangedEventArgs ^ args)
 {
     SDL_assert(!this->recording);
+    PreactivateEndpoint(args->Id->Data());  // the migration below will pick this up, and so will the next migration back to it.
     SDL_DefaultAudioDeviceChanged(FindWinRTAudioDevice(args->Id->Data()));
 }
 
@@ -199,20 +355,12 @@ void SDL_WasapiDeviceEventHandler::OnDefaultCaptureDeviceChanged(Platform::Objec
     SDL_DefaultAudioDeviceChanged(FindWinRTAudioDevice(args->Id->Data()));
 }
 
-void SDL_WasapiDeviceEventHandler::WaitForCompletion()
-{
-    if (this->completed_semaphore) {
-        SDL_WaitSemaphore(this->completed_semaphore);
-        SDL_DestroySemaphore(this->completed_semaphore);
-        this->completed_semaphore = nullptr;
-    }
-}
-
 static SDL_WasapiDeviceEventHandler *playback_device_event_handler;
 static SDL_WasapiDeviceEventHandler *recording_device_event_handler;
 
 bool WASAPI_PlatformInit(void)
 {
+    preactivation_lock = SDL_CreateMutex();  // if this fails, we just don't activate anything ahead of time.
     return true;
 }
 
@@ -227,6 +375,9 @@ static void StopWasapiHotplug(void)
 void WASAPI_PlatformDeinit(void)
 {
     StopWasapiHotplug();
+    DiscardAllPreactivatedEndpoints();
+    SDL_DestroyMutex(preactivation_lock);
+    preactivation_lock = nullptr;
 }
 
 void WASAPI_PlatformDeinitializeStart(void)
@@ -235,53 +386,34 @@ void WASAPI_PlatformDeinitializeStart(void)
 }
 
 
-void WASAPI_EnumerateEndpoints(SDL_AudioDevice **default_playback, SDL_AudioDevice **default_recording)
+// The default endpoint's ID is available right away, but its name and format come from the DeviceWatcher, so it gets a generic name.
+static SDL_AudioDevice *AddDefaultEndpoint(bool recording, Platform::String ^ defdevid)
 {
-    Platform::String ^ defdevid;
-
-    // DeviceWatchers will fire an Added event for each existing device at
-    //  startup, so we don't need to enumerate them separately before
-    //  listening for updates.
-    playback_device_event_handler = new SDL_WasapiDeviceEventHandler(false);
-    playback_device_event_handler->WaitForCompletion();
-    defdevid = MediaDevice::GetDefaultAudioRenderId(AudioDeviceRole::Default);
-    if (defdevid) {
-        *default_playback = FindWinRTAudioDevice(defdevid->Data());
+    if (!defdevid) {
+        return NULL;
     }
 
-    recording_device_event_handler = new SDL_WasapiDeviceEventHandler(true);
-    recording_device_event_handler->WaitForCompletion();
-    defdevid = MediaDevice::GetDefaultAudioCaptureId(AudioDeviceRole::Default);
-    if (defdevid) {
-        *default_recording = FindWinRTAudioDevice(defdevid->Data());
+    if (!recording) {
+        PreactivateEndpoint(defdevid->Data());
     }
-}
 
-class SDL_WasapiActivationHandler : public RuntimeClass<RuntimeClassFlags<ClassicCom>, FtmBase, IActivateAudioInterfaceCompletionHandler>
-{
-public:
-    SDL_WasapiActivationHandler() : completion_semaphore(SDL_CreateSemaphore(0)) { SDL_assert(completion_semaphore != NULL); }
-    STDMETHOD(ActivateCompleted)(IActivateAudioInterfaceAsyncOperation *operation);
-    void WaitForCompletion();
-private:
-    SDL_Semaphore *completion_semaphore;
-};
-
-void SDL_WasapiActivationHandler::WaitForCompletion()
-{
-    if (completion_semaphore) {
-        SDL_WaitSemaphore(completion_semaphore);
-        SDL_DestroySemaphore(completion_semaphore);
-        completion_semaphore = NULL;
+    LPWSTR devid = SDL_wcsdup(defdevid->Data());
+    if (!devid) {
+        return NULL;
     }
+    return SDL_AddAudioDevice(recording, recording ? DEFAULT_RECORDING_DEVNAME : DEFAULT_PLAYBACK_DEVNAME, NULL, devid);
 }
 
-HRESULT
-SDL_WasapiActivationHandler::ActivateCompleted(IActivateAudioInterfaceAsyncOperation *async)
+void WASAPI_EnumerateEndpoints(SDL_AudioDevice **default_playback, SDL_AudioDevice **default_recording)
 {
-    // Just set a flag, since we're probably in a different thread. We'll pick it up and init everything on our own thread to prevent races.
-    SDL_SignalSemaphore(completion_semaphore);
-    return S_OK;
+    /* Waiting for the DeviceWatchers to finish their first pass makes audio init slow, so don't. Just add the default
+       endpoints now, so they can be opened (or migrated to) right away, and let the rest arrive as hotplug events.
+       The watchers fire an Added event for each existing device at startup, so we don't need to enumerate them separately. */
+    *default_playback = AddDefaultEndpoint(false, MediaDevice::GetDefaultAudioRenderId(AudioDeviceRole::Default));
+    *default_recording = AddDefaultEndpoint(true, MediaDevice::GetDefaultAudioCaptureId(AudioDeviceRole::Default));
+
+    playback_device_event_handler = new SDL_WasapiDeviceEventHandler(false);
+    recording_device_event_handler = new SDL_WasapiDeviceEventHandler(true);
 }
 
 void WASAPI_PlatformDeleteActivationHandler(void *handler)
@@ -294,32 +426,36 @@ bool WASAPI_ActivateDevice(SDL_AudioDevice *device)
     LPCWSTR devid = (LPCWSTR) device->handle;
     SDL_assert(devid != NULL);
 
-    ComPtr<SDL_WasapiActivationHandler> handler = Make<SDL_WasapiActivationHandler>();
-    if (handler == nullptr) {
-        return SDL_SetError("Failed to allocate WASAPI activation handler");
-    }
-
-    handler.Get()->AddRef(); // we hold a reference after ComPtr destructs on return, causing a Release, and Release ourselves in WASAPI_PlatformDeleteActivationHandler(), etc.
-    device->hidden->activation_handler = handler.Get();
-
+    ComPtr<SDL_WasapiActivationHandler> handler;
     IActivateAudioInterfaceAsyncOperation *async = nullptr;
-    const HRESULT ret = ActivateAudioInterfaceAsync(devid, __uuidof(IAudioClient), nullptr, handler.Get(), &async);
+    HRESULT activateRes = S_OK;
+    HRESULT getActivateRes = S_OK;
+    IUnknown *iunknown = nullptr;
 
-    if (FAILED(ret) || async == nullptr) {
-        if (async != nullptr) {
+    if (TakePreactivatedEndpoint(devid, handler, &async)) {
+        handler.Get()->WaitForCompletion();  // this has usually finished long ago.
+        getActivateRes = async->GetActivateResult(&activateRes, &iunknown);
+        if (FAILED(getActivateRes) || FAILED(activateRes)) {  // something changed since we activated it ahead of time? Try again the slow way.
             async->Release();
+            async = nullptr;
+            handler = nullptr;
+            activateRes = S_OK;
         }
-        handler.Get()->Release();
-        return WIN_SetErrorFromHRESULT("WASAPI can't activate requested audio endpoint", ret);
     }
 
-    // !!! FIXME: the problems in SDL2 that needed this to be synchronous are _probably_ solved by SDL3, and this can block indefinitely if a user prompt is shown to get permission to use a microphone.
-    handler.Get()->WaitForCompletion();  // block here until we have an answer, so this is synchronous to us after all.
+    if (!async) {
+        if (!BeginEndpointActivation(devid, handler, &async)) {
+            return false;
+        }
+        // !!! FIXME: the problems in SDL2 that needed this to be synchronous are _probably_ solved by SDL3, and this can block indefinitely if a user prompt is shown to get permission to use a microphone.
+        handler.Get()->WaitForCompletion();  // block here until we have an answer, so this is synchronous to us after all.
+        getActivateRes = async->GetActivateResult(&activateRes, &iunknown);
+    }
 
-    HRESULT activateRes = S_OK;
-    IUnknown *iunknown = nullptr;
-    const HRESULT getActivateRes = async->GetActivateResult(&activateRes, &iunknown);
     async->Release();
+    handler.Get()->AddRef(); // we hold a reference after ComPtr destructs on return, causing a Release, and Release ourselves in WASAPI_PlatformDeleteActivationHandler(), etc.
+    device->hidden->activation_handler = handler.Get();
+
     if (FAILED(getActivateRes)) {
         return WIN_SetErrorFromHRESULT("Failed to get WASAPI activate result", getActivateRes);
     } else if (FAILED(activateRes)) {
@@ -340,13 +476,26 @@ bool WASAPI_ActivateDevice(SDL_AudioDevice *device)
 
 void WASAPI_PlatformThreadInit(SDL_AudioDevice *device)
 {
-    // !!! FIXME: set this thread to "Pro Audio" priority.
-    SDL_SetCurrentThreadPriority(device->recording ? SDL_THREAD_PRIORITY_HIGH : SDL_THREAD_PRIORITY_TIME_CRITICAL);
+    // Set this thread to very high "Pro Audio" priority, or whatever MMCSS task the app asked for.
+    WCHAR *task = WASAPI_GetThreadTaskClass();
+    if (task) {
+        DWORD idx = 0;
+        device->hidden->task = AvSetMmThreadCharacteristicsW(task, &idx);
+        SDL_free(task);
+    }
+
+    if (!device->hidden->task) {
+        SDL_SetCurrentThreadPriority(device->recording ? SDL_THREAD_PRIORITY_HIGH : SDL_THREAD_PRIORITY_TIME_CRITICAL);
+    }
 }
 
 void WASAPI_PlatformThreadDeinit(SDL_AudioDevice *device)
 {
-    // !!! FIXME: set this thread to "Pro Audio" priority.
+    // Set this thread back to normal priority.
+    if (device->hidden->task) {
+        AvRevertMmThreadCharacteristics(device->hidden->task);
+        device->hidden->task = NULL;
+    }
 }
 
 void WASAPI_PlatformFreeDeviceHandle(SDL_AudioDevice *device)
@@ -50,6 +50,9 @@ static const CameraBootStrap *const bootstrap[] = {
 #ifdef SDL_CAMERA_DRIVER_MEDIAFOUNDATION
     &MEDIAFOUNDATION_bootstrap,
 #endif
+#ifdef SDL_CAMERA_DRIVER_WINRT
+    &WINRTCAMERA_bootstrap,
+#endif
 #ifdef SDL_CAMERA_DRIVER_VITA
     &VITACAMERA_bootstrap,
 #endif
@@ -244,6 +247,29 @@ static void ClosePhysicalCamera(SDL_Camera *device)
         device->thread = NULL;
     }
 
+    if (device->conversion_thread != NULL) {
+        SDL_LockMutex(device->lock);
+        SDL_BroadcastCondition(device->conversion_cond);
+        SDL_UnlockMutex(device->lock);
+        SDL_WaitThread(device->conversion_thread, NULL);
+        device->conversion_thread = NULL;
+    }
+
+    // frames still waiting for conversion hold the backend's pixels.
+    for (int i = 0; i < device->num_pending; i++) {
+        const int idx = (device->pending_head + i) % SDL_arraysize(device->pending_surfaces);
+        device->ReleaseFrame(device, device->pending_surfaces[idx]);
+    }
+    for (int i = 0; i < SDL_arraysize(device->pending_surfaces); i++) {
+        SDL_DestroySurface(device->pending_surfaces[i]);
+        device->pending_surfaces[i] = NULL;
+        device->pending_slists[i] = NULL;
+    }
+    device->pending_head = 0;
+    device->num_pending = 0;
+    SDL_DestroyCondition(device->conversion_cond);
+    device->conversion_cond = NULL;
+
     // release frames that are queued up somewhere...
     if (!device->needs_conversion && !device->needs_scaling) {
         for (SurfaceList *i = device->filled_output_surfaces.next; i != NULL; i = i->next) {
@@ -257,6 +283,7 @@ static void ClosePhysicalCamera(SDL_Camera *device)
     camera_driver.impl.CloseDevice(device);
 
     SDL_DestroyProperties(device->props);
+    device->props = 0;
 
     SDL_DestroySurface(device->acquire_surface);
     device->acquire_surface = NULL;
@@ -278,6 +305,10 @@ static void ClosePhysicalCamera(SDL_Camera *device)
 
     device->base_timestamp = 0;
     device->adjust_timestamp = 0;
+    device->num_frames = 0;
+    device->dropped_frames = 0;
+    device->acquire_time_ns = 0;
+    device->convert_time_ns = 0;
 
     SDL_zero(device->spec);
 }
@@ -798,6 +829,93 @@ void SDL_CameraThreadSetup(SDL_Camera *device)
 #endif
 }
 
+// Publish the frame statistics through the camera properties. Call with the device lock held.
+static void UpdateCameraStats(SDL_Camera *device)
+{
+    if (device->props == 0) {
+        device->props = SDL_CreateProperties();
+    }
+    if (device->props) {
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_FRAMES_NUMBER, (Sint64) device->num_frames);
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER, (Sint64) device->dropped_frames);
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_ACQUIRE_TIME_NS_NUMBER, (Sint64) device->acquire_time_ns);
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_CONVERT_TIME_NS_NUMBER, (Sint64) device->convert_time_ns);
+    }
+}
+
+// Scale and/or convert an acquired frame into an output surface. This doesn't need the device lock.
+static void ConvertCameraFrame(SDL_Camera *device, SDL_Surface *acquired, SDL_Surface *output_surface)
+{
+    SDL_Surface *srcsurf = acquired;
+    if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
+        SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
+        SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+        srcsurf = dstsurf;
+    }
+    if (device->needs_conversion) {
+        SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
+        SDL_ConvertPixels(srcsurf->w, srcsurf->h,
+                          srcsurf->format, srcsurf->pixels, srcsurf->pitch,
+                          dstsurf->format, dstsurf->pixels, dstsurf->pitch);
+        srcsurf = dstsurf;
+    }
+    if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
+        SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+    }
+}
+
+// Make a filled output surface available to the app. Call with the device lock held.
+static void QueueCameraFrame(SDL_Camera *device, SurfaceList *slist)
+{
+    slist->next = device->filled_output_surfaces.next;
+    device->filled_output_surfaces.next = slist;
+    device->num_frames++;
+    UpdateCameraStats(device);
+}
+
+static int SDLCALL CameraConversionThread(void *devicep)
+{
+    SDL_Camera *device = (SDL_Camera *) devicep;
+
+    SDL_LockMutex(device->lock);
+    while (!SDL_GetAtomicInt(&device->shutdown)) {
+        if (device->num_pending == 0) {
+            SDL_WaitCondition(device->conversion_cond, device->lock);
+            continue;
+        }
+
+        SDL_Surface *acquired = device->pending_surfaces[device->pending_head];
+        SurfaceList *slist = device->pending_slists[device->pending_head];
+
+        // the frame stays in the pending queue while we convert it, so the device thread can't queue more than we can hold.
+        SDL_UnlockMutex(device->lock);
+        const Uint64 convert_start = SDL_GetTicksNS();
+        ConvertCameraFrame(device, acquired, slist->surface);
+        const Uint64 convert_time = SDL_GetTicksNS() - convert_start;
+        device->ReleaseFrame(device, acquired);
+        acquired->pixels = NULL;
+        acquired->pitch = 0;
+        SDL_LockMutex(device->lock);
+
+        device->pending_slists[device->pending_head] = NULL;
+        device->pending_head = (device->pending_head + 1) % SDL_arraysize(device->pending_surfaces);
+        device->num_pending--;
+        device->convert_time_ns += convert_time;
+        QueueCameraFrame(device, slist);
+    }
+    SDL_UnlockMutex(device->lock);
+
+    return 0;
+}
+
+// Drop an acquired frame on the floor. Call with the device lock held.
+static void DropCameraFrame(SDL_Camera *device)
+{
+    device->ReleaseFrame(device, device->acquire_surface);
+    device->acquire_surface->pixels = NULL;
+    device->acquire_surface->pitch = 0;
+}
+
 bool SDL_CameraThreadIterate(SDL_Camera *device)
 {
     SDL_LockMutex(device->lock);
@@ -820,6 +938,7 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
     Uint64 timestampNS = 0;
 
     // AcquireFrame SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitDevice instead!
+    const Uint64 acquire_start = SDL_GetTicksNS();
     const SDL_CameraFrameResult rc = device->AcquireFrame(device, device->acquire_surface, &timestampNS);
 
     if (rc == SDL_CAMERA_FRAME_READY) {  // new frame acquired!
@@ -827,22 +946,32 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
         SDL_Log("CAMERA: New frame available! pixels=%p pitch=%d", device->acquire_surface->pixels, device->acquire_surface->pitch);
         #endif
 
+        device->acquire_time_ns += SDL_GetTicksNS() - acquire_start;
+
+        const bool converting_on_thread = (device->conversion_thread && (device->needs_conversion || device->needs_scaling));
+
         if (device->drop_frames > 0) {
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: Dropping an initial frame");
             #endif
             device->drop_frames--;
-            device->ReleaseFrame(device, device->acquire_surface);
-            device->acquire_surface->pixels = NULL;
-            device->acquire_surface->pitch = 0;
+            DropCameraFrame(device);
         } else if (device->empty_output_surfaces.next == NULL) {
             // uhoh, no output frames available! Either the app is slow, or it forgot to release frames when done with them. Drop this new frame.
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: No empty output surfaces! Dropping frame!");
             #endif
-            device->ReleaseFrame(device, device->acquire_surface);
-            device->acquire_surface->pixels = NULL;
-            device->acquire_surface->pitch = 0;
+            DropCameraFrame(device);
+            device->dropped_frames++;
+            UpdateCameraStats(device);
+        } else if (converting_on_thread && (device->num_pending == SDL_arraysize(device->pending_surfaces))) {
+            // the conversion thread is still busy with earlier frames. Drop this new frame.
+            #if DEBUG_CAMERA
+            SDL_Log("CAMERA: Conversion thread is behind! Dropping frame!");
+            #endif
+            DropCameraFrame(device);
+            device->dropped_frames++;
+            UpdateCameraStats(device);
         } else {
             if (!device->adjust_timestamp) {
                 device->adjust_timestamp = SDL_GetTicksNS();
@@ -853,8 +982,25 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             slist = device->empty_output_surfaces.next;
             output_surface = slist->surface;
             device->empty_output_surfaces.next = slist->next;
-            acquired = device->acquire_surface;
             slist->timestampNS = timestampNS;
+
+            if (converting_on_thread) {  // hand the backend's pixels to the conversion thread, and go right back to acquiring.
+                const int tail = (device->pending_head + device->num_pending) % SDL_arraysize(device->pending_surfaces);
+                SDL_Surface *pending = device->pending_surfaces[tail];
+                pending->pixels = device->acquire_surface->pixels;
+                pending->pitch = device->acquire_surface->pitch;
+                if (device->acquire_surface->props) {
+                    SDL_CopyProperties(device->acquire_surface->props, SDL_GetSurfaceProperties(pending));
+                }
+                device->acquire_surface->pixels = NULL;
+                device->acquire_surface->pitch = 0;
+                device->pending_slists[tail] = slist;
+                device->num_pending++;
+                SDL_SignalCondition(device->conversion_cond);
+                slist = NULL;
+            } else {
+                acquired = device->acquire_surface;
+            }
         }
     } else if (rc == SDL_CAMERA_FRAME_SKIP) {  // no frame available yet; not an error.
         #if 0 //DEBUG_CAMERA
@@ -877,6 +1023,7 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
         SDL_CameraDisconnected(device);  // doh.
     } else if (acquired) {  // we have a new frame, scale/convert if necessary and queue it for the app!
         SDL_assert(slist != NULL);
+        Uint64 convert_time = 0;
         if (!device->needs_scaling && !device->needs_conversion) {  // no conversion needed? Just move the pointer/pitch into the output surface.
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: Frame is going through without conversion!");
@@ -885,26 +1032,16 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             output_surface->h = acquired->h;
             output_surface->pixels = acquired->pixels;
             output_surface->pitch = acquired->pitch;
+            if (acquired->props) {  // the backend attached something to this frame (like the GPU texture holding it), pass that along, too.
+                SDL_CopyProperties(acquired->props, SDL_GetSurfaceProperties(output_surface));
+            }
         } else {  // convert/scale into a different surface.
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: Frame is getting converted!");
             #endif
-            SDL_Surface *srcsurf = acquired;
-            if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
-                SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-                srcsurf = dstsurf;
-            }
-            if (device->needs_conversion) {
-                SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
-                SDL_ConvertPixels(srcsurf->w, srcsurf->h,
-                                  srcsurf->format, srcsurf->pixels, srcsurf->pitch,
-                                  dstsurf->format, dstsurf->pixels, dstsurf->pitch);
-                srcsurf = dstsurf;
-            }
-            if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-            }
+            const Uint64 convert_start = SDL_GetTicksNS();
+            ConvertCameraFrame(device, acquired, output_surface);
+            convert_time = SDL_GetTicksNS() - convert_start;
 
             // we made a copy, so we can give the driver back its resources.
             device->ReleaseFrame(device, acquired);
@@ -916,8 +1053,8 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
 
         // make the filled output surface available to the app.
         SDL_LockMutex(device->lock);
-        slist->next = device->filled_output_surfaces.next;
-        device->filled_output_surfaces.next = slist;
+        device->convert_time_ns += convert_time;
+        QueueCameraFrame(device, slist);
         SDL_UnlockMutex(device->lock);
     }
 
@@ -931,6 +1068,41 @@ void SDL_CameraThreadShutdown(SDL_Camera *device)
     //SDL_CameraThreadFinalize(device);
 }
 
+// Call with the device lock held, after the output surfaces are prepared.
+static void StartCameraConversionThread(SDL_Camera *device)
+{
+    const SDL_CameraSpec *devspec = &device->actual_spec;
+
+    for (int i = 0; i < SDL_arraysize(device->pending_surfaces); i++) {
+        SDL_Surface *surf = SDL_CreateSurfaceFrom(devspec->width, devspec->height, devspec->format, NULL, 0);
+        if (!surf) {
+            goto failed;
+        }
+        SDL_SetSurfaceColorspace(surf, devspec->colorspace);
+        device->pending_surfaces[i] = surf;
+    }
+
+    device->conversion_cond = SDL_CreateCondition();
+    if (!device->conversion_cond) {
+        goto failed;
+    }
+
+    char threadname[64];
+    (void)SDL_snprintf(threadname, sizeof (threadname), "SDLCameraConv%d", (int) device->instance_id);
+    device->conversion_thread = SDL_CreateThread(CameraConversionThread, threadname, device);
+    if (device->conversion_thread) {
+        return;
+    }
+
+failed:
+    SDL_DestroyCondition(device->conversion_cond);
+    device->conversion_cond = NULL;
+    for (int i = 0; i < SDL_arraysize(device->pending_surfaces); i++) {
+        SDL_DestroySurface(device->pending_surfaces[i]);
+        device->pending_surfaces[i] = NULL;
+    }
+}
+
 // Actual thread entry point, if driver didn't handle this itself.
 static int SDLCALL CameraThread(void *devicep)
 {
@@ -1202,6 +1374,9 @@ SDL_Camera *SDL_OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec)
     SDL_CameraSpec closest;
     ChooseBestCameraSpec(device, spec, &closest);
 
+    // backends can compare this to `closest` in OpenDevice to know if frames will need conversion.
+    SDL_copyp(&device->spec, spec ? spec : &closest);
+
     #if DEBUG_CAMERA
     SDL_Log("CAMERA: App wanted [(%dx%d) fmt=%s framerate=%d/%d], chose [(%dx%d) fmt=%s framerate=%d/%d]",
             spec ? spec->width : -1, spec ? spec->height : -1, spec ? SDL_GetPixelFormatName(spec->format) : "(null)", spec ? spec->framerate_numerator : -1, spec ? spec->framerate_denominator : -1,
@@ -1214,7 +1389,6 @@ SDL_Camera *SDL_OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec)
         return NULL;
     }
 
-    SDL_copyp(&device->spec, spec ? spec : &closest);
     SDL_copyp(&device->actual_spec, &closest);
 
     // SDL_PIXELFORMAT_UNKNOWN here is taken as a signal that the backend
@@ -1244,6 +1418,11 @@ SDL_Camera *SDL_OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec)
         }
     }
 
+    // Optionally move conversion and scaling off the device thread. If this fails, frames just get converted there.
+    if ((device->needs_conversion || device->needs_scaling) && SDL_GetHintBoolean(SDL_HINT_CAMERA_CONVERSION_THREAD, false)) {
+        StartCameraConversionThread(device);
+    }
+
     ReleaseCamera(device);  // unlock, we're good to go!
 
     return device;  // currently there's no separation between physical and logical device.
@@ -157,6 +157,22 @@ struct SDL_Camera
     // A thread to feed the camera device
     SDL_Thread *thread;
 
+    // Converts and scales frames if SDL_HINT_CAMERA_CONVERSION_THREAD is enabled, so the device thread can keep acquiring.
+    SDL_Thread *conversion_thread;
+    SDL_Condition *conversion_cond;  // signaled, with `lock` held, when frames are queued for conversion or on shutdown.
+
+    // Acquired frames waiting for the conversion thread, each holding the backend's pixels until converted.
+    SDL_Surface *pending_surfaces[2];
+    SurfaceList *pending_slists[2];  // the output surface each pending frame will be converted into.
+    int pending_head;
+    int num_pending;
+
+    // Statistics, published through the camera properties.
+    Uint64 num_frames;
+    Uint64 dropped_frames;
+    Uint64 acquire_time_ns;
+    Uint64 convert_time_ns;
+
     // Optional properties.
     SDL_PropertiesID props;
 
@@ -219,6 +235,7 @@ extern CameraBootStrap COREMEDIA_bootstrap;
 extern CameraBootStrap ANDROIDCAMERA_bootstrap;
 extern CameraBootStrap EMSCRIPTENCAMERA_bootstrap;
 extern CameraBootStrap MEDIAFOUNDATION_bootstrap;
+extern CameraBootStrap WINRTCAMERA_bootstrap;
 extern CameraBootStrap VITACAMERA_bootstrap;
 
 #endif // SDL_syscamera_h_
@@ -0,0 +1,680 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// the WinRT MediaCapture / MediaFrameReader API
+
+#ifdef SDL_CAMERA_DRIVER_WINRT
+
+extern "C" {
+#include "../../core/windows/SDL_windows.h"
+#include "../SDL_syscamera.h"
+#include "../SDL_camera_c.h"
+}
+
+#include <d3d11_4.h>
+#include <mfapi.h>
+#include <mfmediacapture.h>
+#include <MemoryBuffer.h>
+#include <windows.graphics.directx.direct3d11.interop.h>
+#include <collection.h>
+#include <new>
+
+#pragma comment(lib, "mfplat.lib")
+
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+using namespace Windows::Graphics::Imaging;
+using namespace Windows::Media::Capture;
+using namespace Windows::Media::Capture::Frames;
+
+// a pooled frame lives in the surface properties while SDL or the app holds it.
+#define PROP_SURFACE_WINRT_FRAME_POINTER "SDL.camera.winrt.frame"
+
+// enough for every output surface SDL keeps, plus the one being acquired.
+#define WINRT_CAMERA_FRAME_POOL_SIZE 10
+
+static const struct
+{
+    const wchar_t *subtype;
+    SDL_PixelFormat format;
+    SDL_Colorspace colorspace;
+} fmtmappings[] = {
+    // These are the formats the frame reader can hand us uncompressed; anything else gets converted to NV12 by the reader.
+    { L"NV12", SDL_PIXELFORMAT_NV12, SDL_COLORSPACE_BT709_LIMITED },
+    { L"YUY2", SDL_PIXELFORMAT_YUY2, SDL_COLORSPACE_BT709_LIMITED },
+    { L"RGB32", SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB },
+    { L"ARGB32", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB }
+};
+
+typedef struct WINRT_CameraFrame
+{
+    Uint8 *pixels;  // system memory copy of the frame, allocated once and reused.
+    size_t allocated;
+    MediaFrameReference ^ reference;  // keeps a GPU frame alive while it's held.
+    ID3D11Texture2D *texture;
+    bool in_use;
+} WINRT_CameraFrame;
+
+typedef struct WINRT_CameraHandle
+{
+    WCHAR *group_id;
+    WCHAR *source_id;
+} WINRT_CameraHandle;
+
+struct SDL_PrivateCameraData
+{
+    MediaCapture ^ capture;
+    MediaFrameReader ^ reader;
+    EventRegistrationToken frame_arrived_token;
+    EventRegistrationToken failed_token;
+    IMFDXGIDeviceManager *device_manager;
+    SDL_Semaphore *frame_ready;
+    SDL_AtomicInt failed;
+    bool gpu_frames;
+    SDL_SpinLock pool_lock;
+    WINRT_CameraFrame pool[WINRT_CAMERA_FRAME_POOL_SIZE];
+};
+
+// Camera setup happens synchronously; if that's on the UI thread, keep it
+// responsive so the camera consent prompt can show up.
+template <typename T>
+static bool WINRT_WaitForAsync(T ^ operation)
+{
+    Windows::UI::Core::CoreWindow ^ window = Windows::UI::Core::CoreWindow::GetForCurrentThread();
+    while (operation->Status == AsyncStatus::Started) {
+        if (window) {
+            window->Dispatcher->ProcessEvents(Windows::UI::Core::CoreProcessEventsOption::ProcessAllIfPresent);
+        }
+        SDL_Delay(1);
+    }
+    return (operation->Status == AsyncStatus::Completed);
+}
+
+static void SubtypeToSDLFmt(Platform::String ^ subtype, SDL_PixelFormat *format, SDL_Colorspace *colorspace)
+{
+    for (size_t i = 0; i < SDL_arraysize(fmtmappings); i++) {
+        if (subtype && _wcsicmp(subtype->Data(), fmtmappings[i].subtype) == 0) {
+            *format = fmtmappings[i].format;
+            *colorspace = fmtmappings[i].colorspace;
+            return;
+        }
+    }
+    *format = SDL_PIXELFORMAT_NV12;
+    *colorspace = SDL_COLORSPACE_BT709_LIMITED;
+}
+
+static Platform::String ^ SDLFmtToSubtype(SDL_PixelFormat format)
+{
+    for (size_t i = 0; i < SDL_arraysize(fmtmappings); i++) {
+        if (fmtmappings[i].format == format) {
+            return ref new Platform::String(fmtmappings[i].subtype);
+        }
+    }
+    return Windows::Media::MediaProperties::MediaEncodingSubtypes::Nv12;
+}
+
+static void FramerateToFraction(double framerate, int *numerator, int *denominator)
+{
+    const double rounded = SDL_round(framerate);
+    if (SDL_fabs(framerate - rounded) < 0.01) {
+        *numerator = (int)rounded;
+        *denominator = 1;
+    } else if (SDL_fabs(framerate * 1001.0 - SDL_round(rounded * 1000.0)) < 1.0) {  // NTSC rates, like 29.97.
+        *numerator = (int)(rounded * 1000.0);
+        *denominator = 1001;
+    } else {
+        *numerator = (int)SDL_round(framerate * 1000.0);
+        *denominator = 1000;
+    }
+}
+
+static bool WINRT_WaitDevice(SDL_Camera *device)
+{
+    SDL_PrivateCameraData *hidden = device->hidden;
+
+    while (!SDL_GetAtomicInt(&device->shutdown)) {
+        if (SDL_GetAtomicInt(&hidden->failed)) {
+            return false;  // apparently this camera has gone down.  :/
+        } else if (SDL_WaitSemaphoreTimeout(hidden->frame_ready, 100)) {
+            break;
+        }
+    }
+    return true;
+}
+
+static WINRT_CameraFrame *GetPoolFrame(SDL_PrivateCameraData *hidden)
+{
+    WINRT_CameraFrame *result = NULL;
+
+    SDL_LockSpinlock(&hidden->pool_lock);
+    for (int i = 0; i < WINRT_CAMERA_FRAME_POOL_SIZE; i++) {
+        if (!hidden->pool[i].in_use) {
+            result = &hidden->pool[i];
+            result->in_use = true;
+            break;
+        }
+    }
+    SDL_UnlockSpinlock(&hidden->pool_lock);
+
+    return result;
+}
+
+static void PutPoolFrame(SDL_PrivateCameraData *hidden, WINRT_CameraFrame *poolframe)
+{
+    MediaFrameReference ^ reference = poolframe->reference;
+    ID3D11Texture2D *texture = poolframe->texture;
+
+    SDL_LockSpinlock(&hidden->pool_lock);
+    poolframe->reference = nullptr;
+    poolframe->texture = NULL;
+    poolframe->in_use = false;
+    SDL_UnlockSpinlock(&hidden->pool_lock);
+
+    if (texture) {
+        texture->Release();
+    }
+    if (reference) {
+        delete reference;  // hands the frame back to the frame reader.
+    }
+}
+
+static ID3D11Texture2D *GetFrameTexture(Windows::Graphics::DirectX::Direct3D11::IDirect3DSurface ^ surface)
+{
+    Windows::Graphics::DirectX::Direct3D11::IDirect3DDxgiInterfaceAccess *access = NULL;
+    ID3D11Texture2D *texture = NULL;
+
+    if (SUCCEEDED(reinterpret_cast<IUnknown *>(surface)->QueryInterface(IID_PPV_ARGS(&access)))) {
+        access->GetInterface(IID_PPV_ARGS(&texture));
+        access->Release();
+    }
+    return texture;
+}
+
+static bool CopyFrameBitmap(WINRT_CameraFrame *poolframe, SoftwareBitmap ^ bitmap, SDL_Surface *frame)
+{
+    BitmapBuffer ^ buffer = bitmap->LockBuffer(BitmapBufferAccessMode::Read);
+    IMemoryBufferReference ^ reference = buffer->CreateReference();
+    IMemoryBufferByteAccess *access = NULL;
+    BYTE *data = NULL;
+    UINT32 capacity = 0;
+    bool result = false;
+
+    if (SUCCEEDED(reinterpret_cast<IUnknown *>(reference)->QueryInterface(IID_PPV_ARGS(&access))) &&
+        SUCCEEDED(access->GetBuffer(&data, &capacity)) && data) {
+        // SDL wants the planes back to back, which is usually, but not necessarily, how they arrive.
+        const BitmapPlaneDescription plane0 = buffer->GetPlaneDescription(0);
+        const size_t size0 = (size_t)plane0.Stride * plane0.Height;
+        BitmapPlaneDescription plane1 = {};
+        size_t size1 = 0;
+        if (buffer->GetPlaneCount() > 1) {
+            plane1 = buffer->GetPlaneDescription(1);
+            size1 = (size_t)plane1.Stride * plane1.Height;
+        }
+
+        if (plane0.Stride > 0 && plane0.StartIndex + size0 <= capacity && plane1.StartIndex + size1 <= capacity) {
+            const size_t needed = size0 + size1;
+            if (poolframe->allocated < needed) {  // only happens the first time a pooled frame is used.
+                SDL_aligned_free(poolframe->pixels);
+                poolframe->pixels = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), needed);
+                poolframe->allocated = poolframe->pixels ? needed : 0;
+            }
+            if (poolframe->pixels) {
+                SDL_memcpy(poolframe->pixels, data + plane0.StartIndex, size0);
+                if (size1) {
+                    SDL_memcpy(poolframe->pixels + size0, data + plane1.StartIndex, size1);
+                }
+                frame->pixels = poolframe->pixels;
+                frame->pitch = plane0.Stride;
+                result = true;
+            }
+        }
+    }
+
+    if (access) {
+        access->Release();
+    }
+    delete reference;
+    delete buffer;
+    return result;
+}
+
+static SDL_CameraFrameResult WINRT_AcquireFrame(SDL_Camera *device, SDL_Surface *frame, Uint64 *timestampNS)
+{
+    SDL_PrivateCameraData *hidden = device->hidden;
+
+    const SDL_PropertiesID surfprops = SDL_GetSurfaceProperties(frame);
+    if (!surfprops) {
+        return SDL_CAMERA_FRAME_ERROR;
+    }
+
+    WINRT_CameraFrame *poolframe = NULL;
+    SDL_CameraFrameResult result = SDL_CAMERA_FRAME_SKIP;
+    try {
+        MediaFrameReference ^ reference = hidden->reader->TryAcquireLatestFrame();
+        if (!reference) {
+            return SDL_CAMERA_FRAME_SKIP;
+        }
+
+        VideoMediaFrame ^ videoframe = reference->VideoMediaFrame;
+        poolframe = videoframe ? GetPoolFrame(hidden) : NULL;
+        if (!poolframe) {
+            delete reference;  // nothing we can use, or every pooled frame is still held; drop this one.
+            return SDL_CAMERA_FRAME_SKIP;
+        }
+
+        frame->pixels = NULL;
+        frame->pitch = 0;
+
+        if (hidden->gpu_frames && videoframe->Direct3DSurface) {
+            poolframe->texture = GetFrameTexture(videoframe->Direct3DSurface);
+        }
+
+        SoftwareBitmap ^ bitmap = videoframe->SoftwareBitmap;
+        if (bitmap && !CopyFrameBitmap(poolframe, bitmap, frame)) {
+            result = SDL_CAMERA_FRAME_ERROR;
+        } else if (frame->pixels || poolframe->texture) {
+            result = SDL_CAMERA_FRAME_READY;
+        }
+
+        Platform::IBox<TimeSpan> ^ systime = reference->SystemRelativeTime;
+        *timestampNS = systime ? ((Uint64)systime->Value.Duration * 100) : SDL_GetTicksNS();  // the timestamps are in 100-nanosecond increments.
+
+        if (poolframe->texture) {
+            poolframe->reference = reference;  // the texture belongs to the frame reader until we let go of this.
+        } else {
+            delete reference;
+        }
+    } catch (Platform::Exception ^ e) {
+        WIN_SetErrorFromHRESULT(__FUNCTION__, e->HResult);
+        result = SDL_CAMERA_FRAME_ERROR;
+    }
+
+    if (result != SDL_CAMERA_FRAME_READY) {
+        if (poolframe) {
+            PutPoolFrame(hidden, poolframe);
+        }
+        frame->pixels = NULL;
+        frame->pitch = 0;
+        *timestampNS = 0;
+        return result;
+    }
+
+    SDL_SetPointerProperty(surfprops, PROP_SURFACE_WINRT_FRAME_POINTER, poolframe);
+    SDL_SetPointerProperty(surfprops, SDL_PROP_SURFACE_D3D11_TEXTURE_POINTER, poolframe->texture);
+    return SDL_CAMERA_FRAME_READY;
+}
+
+static void WINRT_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
+{
+    const SDL_PropertiesID surfprops = SDL_GetSurfaceProperties(frame);
+    WINRT_CameraFrame *poolframe = (WINRT_CameraFrame *)SDL_GetPointerProperty(surfprops, PROP_SURFACE_WINRT_FRAME_POINTER, NULL);
+    if (poolframe) {
+        PutPoolFrame(device->hidden, poolframe);
+        SDL_ClearProperty(surfprops, PROP_SURFACE_WINRT_FRAME_POINTER);
+        SDL_ClearProperty(surfprops, SDL_PROP_SURFACE_D3D11_TEXTURE_POINTER);
+    }
+}
+
+static void WINRT_CloseDevice(SDL_Camera *device)
+{
+    if (device && device->hidden) {
+        SDL_PrivateCameraData *hidden = device->hidden;
+        try {
+            if (hidden->reader) {
+                hidden->reader->FrameArrived -= hidden->frame_arrived_token;
+                WINRT_WaitForAsync(hidden->reader->StopAsync());
+                delete hidden->reader;
+            }
+            if (hidden->capture) {
+                hidden->capture->Failed -= hidden->failed_token;
+                delete hidden->capture;
+            }
+        } catch (Platform::Exception ^) {
+            // we're shutting down anyhow.
+        }
+        hidden->reader = nullptr;
+        hidden->capture = nullptr;
+
+        for (int i = 0; i < WINRT_CAMERA_FRAME_POOL_SIZE; i++) {
+            WINRT_CameraFrame *poolframe = &hidden->pool[i];
+            if (poolframe->texture) {
+                poolframe->texture->Release();
+            }
+            poolframe->reference = nullptr;
+            SDL_aligned_free(poolframe->pixels);
+        }
+
+        if (hidden->device_manager) {
+            hidden->device_manager->Release();
+        }
+        SDL_DestroySemaphore(hidden->frame_ready);
+        delete hidden;
+        device->hidden = NULL;
+    }
+}
+
+// Have MediaCapture put frames on the app's Direct3D device, so they can be used as textures there without a copy.
+static bool SetCaptureDevice(SDL_PrivateCameraData *hidden, ID3D11Device *d3ddevice)
+{
+    IAdvancedMediaCapture *advanced = NULL;
+    IAdvancedMediaCaptureSettings *settings = NULL;
+    UINT token = 0;
+    HRESULT hr;
+
+    ID3D11Multithread *multithread = NULL;
+    if (SUCCEEDED(d3ddevice->QueryInterface(IID_PPV_ARGS(&multithread)))) {
+        multithread->SetMultithreadProtected(TRUE);  // the capture pipeline uses the device from its own threads.
+        multithread->Release();
+    }
+
+    hr = MFCreateDXGIDeviceManager(&token, &hidden->device_manager);
+    if (SUCCEEDED(hr)) {
+        hr = hidden->device_manager->ResetDevice(d3ddevice, token);
+    }
+    if (SUCCEEDED(hr)) {
+        hr = reinterpret_cast<IUnknown *>(hidden->capture)->QueryInterface(IID_PPV_ARGS(&advanced));
+    }
+    if (SUCCEEDED(hr)) {
+        hr = advanced->GetAdvancedMediaCaptureSettings(&settings);
+    }
+    if (SUCCEEDED(hr)) {
+        hr = settings->SetDirectxDeviceManager(hidden->device_manager);
+    }
+
+    if (settings) {
+        settings->Release();
+    }
+    if (advanced) {
+        advanced->Release();
+    }
+    return SUCCEEDED(hr);
+}
+
+static MediaFrameFormat ^ FindSourceFormat(MediaFrameSource ^ source, const SDL_CameraSpec *spec)
+{
+    MediaFrameFormat ^ result = nullptr;
+    const double framerate = spec->framerate_denominator ? ((double)spec->framerate_numerator / spec->framerate_denominator) : 0.0;
+
+    for (MediaFrameFormat ^ format : source->SupportedFormats) {
+        VideoMediaFrameFormat ^ video = format->VideoFormat;
+        if (!video || (int)video->Width != spec->width || (int)video->Height != spec->height) {
+            continue;
+        }
+        const double rate = format->FrameRate->Denominator ? ((double)format->FrameRate->Numerator / format->FrameRate->Denominator) : 0.0;
+        if (framerate > 0.0 && SDL_fabs(rate - framerate) > 0.01) {
+            continue;
+        }
+
+        SDL_PixelFormat sdlfmt = SDL_PIXELFORMAT_UNKNOWN;
+        SDL_Colorspace colorspace = SDL_COLORSPACE_UNKNOWN;
+        SubtypeToSDLFmt(format->Subtype, &sdlfmt, &colorspace);
+        if (sdlfmt == spec->format) {
+            return format;  // exact match, the reader won't have to convert anything.
+        } else if (!result) {
+            result = format;
+        }
+    }
+    return result;
+}
+
+static bool WINRT_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
+{
+    const WINRT_CameraHandle *handle = (const WINRT_CameraHandle *)device->handle;
+
+    SDL_PrivateCameraData *hidden = new (std::nothrow) SDL_PrivateCameraData();
+    if (!hidden) {
+        return false;
+    }
+    device->hidden = hidden;
+
+    hidden->frame_ready = SDL_CreateSemaphore(0);
+    if (!hidden->frame_ready) {
+        return false;
+    }
+
+    // Frames only stay on the GPU if the app gave us a device and they won't need converting or scaling on the CPU.
+    ID3D11Device *d3ddevice = (ID3D11Device *)SDL_GetPointerProperty(SDL_GetGlobalProperties(), SDL_PROP_GLOBAL_WINRT_CAMERA_D3D11_DEVICE_POINTER, NULL);
+    hidden->gpu_frames = (d3ddevice && device->spec.format == spec->format &&
+                          device->spec.width == spec->width && device->spec.height == spec->height);
+
+    try {
+        auto groupop = MediaFrameSourceGroup::FromIdAsync(ref new Platform::String(handle->group_id));
+        if (!WINRT_WaitForAsync(groupop) || !groupop->GetResults()) {
+            return SDL_SetError("Camera is no longer available");
+        }
+
+        MediaCaptureInitializationSettings ^ settings = ref new MediaCaptureInitializationSettings();
+        settings->SourceGroup = groupop->GetResults();
+        settings->SharingMode = MediaCaptureSharingMode::ExclusiveControl;
+        settings->StreamingCaptureMode = StreamingCaptureMode::Video;
+        settings->MemoryPreference = hidden->gpu_frames ? MediaCaptureMemoryPreference::Auto : MediaCaptureMemoryPreference::Cpu;
+
+        hidden->capture = ref new MediaCapture();
+        if (hidden->gpu_frames && !SetCaptureDevice(hidden, d3ddevice)) {
+            hidden->gpu_frames = false;
+            settings->MemoryPreference = MediaCaptureMemoryPreference::Cpu;
+        }
+
+        try {
+            auto initop = hidden->capture->InitializeAsync(settings);
+            WINRT_WaitForAsync(initop);
+            initop->GetResults();  // throws if initialization failed.
+        } catch (Platform::AccessDeniedException ^) {
+            // The user (or a privacy setting) said no; the device is "open" but will never produce frames.
+            SDL_CameraPermissionOutcome(device, false);
+            return true;
+        }
+
+        SDL_PrivateCameraData *data = hidden;  // the handlers are removed before this is freed.
+        hidden->failed_token = hidden->capture->Failed += ref new MediaCaptureFailedEventHandler(
+            [data](MediaCapture ^, MediaCaptureFailedEventArgs ^) {
+                SDL_SetAtomicInt(&data->failed, 1);
+                SDL_SignalSemaphore(data->frame_ready);
+            });
+
+        MediaFrameSource ^ source = nullptr;
+        Platform::String ^ source_id = ref new Platform::String(handle->source_id);
+        if (hidden->capture->FrameSources->HasKey(source_id)) {
+            source = hidden->capture->FrameSources->Lookup(source_id);
+        }
+        if (!source) {
+            return SDL_SetError("Camera is no longer available");
+        }
+
+        MediaFrameFormat ^ format = FindSourceFormat(source, spec);
+        if (format) {
+            WINRT_WaitForAsync(source->SetFormatAsync(format));
+        }
+
+        // The reader converts and scales to what we ask for, if the source can't provide it directly.
+        BitmapSize size;
+        size.Width = (unsigned int)spec->width;
+        size.Height = (unsigned int)spec->height;
+        auto readerop = hidden->capture->CreateFrameReaderAsync(source, SDLFmtToSubtype(spec->format), size);
+        WINRT_WaitForAsync(readerop);
+        hidden->reader = readerop->GetResults();
+        hidden->reader->AcquisitionMode = MediaFrameReaderAcquisitionMode::Realtime;
+        hidden->frame_arrived_token = hidden->reader->FrameArrived += ref new TypedEventHandler<MediaFrameReader ^, MediaFrameArrivedEventArgs ^>(
+            [data](MediaFrameReader ^, MediaFrameArrivedEventArgs ^) {
+                SDL_SignalSemaphore(data->frame_ready);
+            });
+
+        auto startop = hidden->reader->StartAsync();
+        WINRT_WaitForAsync(startop);
+        if (startop->GetResults() != MediaFrameReaderStartStatus::Success) {
+            return SDL_SetError("Couldn't start the camera's frame reader");
+        }
+    } catch (Platform::AccessDeniedException ^) {
+        SDL_CameraPermissionOutcome(device, false);
+        return true;
+    } catch (Platform::Exception ^ e) {
+        return WIN_SetErrorFromHRESULT("WinRT camera open", e->HResult);
+    }
+
+    SDL_CameraPermissionOutcome(device, true);
+    return true;
+}
+
+static void WINRT_FreeDeviceHandle(SDL_Camera *device)
+{
+    if (device && device->handle) {
+        WINRT_CameraHandle *handle = (WINRT_CameraHandle *)device->handle;
+        SDL_free(handle->group_id);
+        SDL_free(handle->source_id);
+        SDL_free(handle);
+    }
+}
+
+static void GatherCameraSpecs(MediaFrameSourceInfo ^ info, CameraFormatAddData *add_data)
+{
+    IVectorView<MediaCaptureVideoProfileMediaDescription ^> ^ descriptions = info->VideoProfileMediaDescription;
+
+    SDL_zerop(add_data);
+
+    if (!descriptions || descriptions->Size == 0) {
+        // not every camera fills this in, so check its profiles, too.
+        if (info->DeviceInformation && MediaCapture::IsVideoProfileSupported(info->DeviceInformation->Id)) {
+            for (MediaCaptureVideoProfile ^ profile : MediaCapture::FindAllVideoProfiles(info->DeviceInformation->Id)) {
+                for (MediaCaptureVideoProfileMediaDescription ^ description : profile->SupportedRecordMediaDescription) {
+                    SDL_PixelFormat sdlfmt = SDL_PIXELFORMAT_UNKNOWN;
+                    SDL_Colorspace colorspace = SDL_COLORSPACE_UNKNOWN;
+                    int numerator = 0, denominator = 0;
+                    SubtypeToSDLFmt(description->Subtype, &sdlfmt, &colorspace);
+                    FramerateToFraction(description->FrameRate, &numerator, &denominator);
+                    if (description->Width && description->Height && numerator) {
+                        SDL_AddCameraFormat(add_data, sdlfmt, colorspace, (int)description->Width, (int)description->Height, numerator, denominator);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    for (MediaCaptureVideoProfileMediaDescription ^ description : descriptions) {
+        SDL_PixelFormat sdlfmt = SDL_PIXELFORMAT_UNKNOWN;
+        SDL_Colorspace colorspace = SDL_COLORSPACE_UNKNOWN;
+        int numerator = 0, denominator = 0;
+        SubtypeToSDLFmt(description->Subtype, &sdlfmt, &colorspace);
+        FramerateToFraction(description->FrameRate, &numerator, &denominator);
+        if (description->Width && description->Height && numerator) {
+            SDL_AddCameraFormat(add_data, sdlfmt, colorspace, (int)description->Width, (int)description->Height, numerator, denominator);
+        }
+    }
+}
+
+static bool FindWinRTCameraBySourceId(SDL_Camera *device, void *userdata)
+{
+    const WINRT_CameraHandle *handle = (const WINRT_CameraHandle *)device->handle;
+    return (SDL_wcscmp(handle->source_id, (const WCHAR *)userdata) == 0);
+}
+
+static void MaybeAddDevice(MediaFrameSourceGroup ^ group, MediaFrameSourceInfo ^ info)
+{
+    if (SDL_FindPhysicalCameraByCallback(FindWinRTCameraBySourceId, (void *)info->Id->Data())) {
+        return;  // already have this one.
+    }
+
+    SDL_CameraPosition position = SDL_CAMERA_POSITION_UNKNOWN;
+    if (info->DeviceInformation && info->DeviceInformation->EnclosureLocation) {
+        switch (info->DeviceInformation->EnclosureLocation->Panel) {
+        case Windows::Devices::Enumeration::Panel::Front:
+            position = SDL_CAMERA_POSITION_FRONT_FACING;
+            break;
+        case Windows::Devices::Enumeration::Panel::Back:
+            position = SDL_CAMERA_POSITION_BACK_FACING;
+            break;
+        default:
+            break;
+        }
+    }
+
+    CameraFormatAddData add_data;
+    GatherCameraSpecs(info, &add_data);
+
+    char *name = WIN_StringToUTF8W(group->DisplayName->Data());
+    WINRT_CameraHandle *handle = (WINRT_CameraHandle *)SDL_calloc(1, sizeof(*handle));
+    if (handle) {
+        handle->group_id = SDL_wcsdup(group->Id->Data());
+        handle->source_id = SDL_wcsdup(info->Id->Data());
+    }
+
+    if (name && handle && handle->group_id && handle->source_id && add_data.num_specs > 0 &&
+        SDL_AddCamera(name, position, add_data.num_specs, add_data.specs, handle)) {
+        handle = NULL;  // the camera owns it now.
+    }
+
+    if (handle) {
+        SDL_free(handle->group_id);
+        SDL_free(handle->source_id);
+        SDL_free(handle);
+    }
+    SDL_free(add_data.specs);
+    SDL_free(name);
+}
+
+static void WINRT_DetectDevices(void)
+{
+    // !!! FIXME: use a DeviceWatcher to get device notifications.
+    try {
+        auto operation = MediaFrameSourceGroup::FindAllAsync();
+        if (!WINRT_WaitForAsync(operation)) {
+            return;  // oh well, no cameras for you.
+        }
+
+        for (MediaFrameSourceGroup ^ group : operation->GetResults()) {
+            for (MediaFrameSourceInfo ^ info : group->SourceInfos) {
+                if (info->SourceKind == MediaFrameSourceKind::Color &&
+                    (info->MediaStreamType == MediaStreamType::VideoRecord || info->MediaStreamType == MediaStreamType::VideoPreview)) {
+                    MaybeAddDevice(group, info);
+                    break;  // one color stream per camera is plenty.
+                }
+            }
+        }
+    } catch (Platform::Exception ^) {
+        // oh well, no cameras for you.
+    }
+}
+
+static void WINRT_Deinitialize(void)
+{
+    // nothing to do.
+}
+
+static bool WINRT_Init(SDL_CameraDriverImpl *impl)
+{
+    impl->DetectDevices = WINRT_DetectDevices;
+    impl->OpenDevice = WINRT_OpenDevice;
+    impl->CloseDevice = WINRT_CloseDevice;
+    impl->WaitDevice = WINRT_WaitDevice;
+    impl->AcquireFrame = WINRT_AcquireFrame;
+    impl->ReleaseFrame = WINRT_ReleaseFrame;
+    impl->FreeDeviceHandle = WINRT_FreeDeviceHandle;
+    impl->Deinitialize = WINRT_Deinitialize;
+
+    return true;
+}
+
+CameraBootStrap WINRTCAMERA_bootstrap = {
+    "winrt", "SDL WinRT MediaCapture camera driver", WINRT_Init, false
+};
+
+#endif // SDL_CAMERA_DRIVER_WINRT
@@ -27,6 +27,10 @@ extern "C" {
 #include <XGameRuntime.h>
 #include <xsapi-c/services_c.h>
 #include <appnotify.h>
+#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#define USE_PIX
+#include <pix3.h>
+#endif
 
 static XTaskQueueHandle GDK_GlobalTaskQueue;
 
@@ -157,3 +161,56 @@ bool SDL_GetGDKDefaultUser(XUserHandle *outUserHandle)
 
     return true;
 }
+
+#if defined(SDL_TRACING) && (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+extern "C"
+void GDK_BeginTraceEvent(const char *name)
+{
+    PIXBeginEvent(PIX_COLOR_DEFAULT, "%s", name);
+}
+
+extern "C"
+void GDK_EndTraceEvent(void)
+{
+    PIXEndEvent();
+}
+#endif
+
+#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+static WCHAR *GDK_GPUCapturePath;
+
+extern "C"
+bool GDK_BeginGPUCapture(const char *path)
+{
+    PIXCaptureParameters params = {};
+    HRESULT result;
+
+    GDK_GPUCapturePath = WIN_UTF8ToStringW(path);
+    if (!GDK_GPUCapturePath) {
+        return false;
+    }
+    params.GpuCaptureParameters.FileName = GDK_GPUCapturePath;
+
+    result = PIXBeginCapture(PIX_CAPTURE_GPU, &params);
+    if (FAILED(result)) {
+        SDL_free(GDK_GPUCapturePath);
+        GDK_GPUCapturePath = NULL;
+        return WIN_SetErrorFromHRESULT("PIXBeginCapture", result);
+    }
+    return true;
+}
+
+extern "C"
+bool GDK_EndGPUCapture(void)
+{
+    HRESULT result = PIXEndCapture(FALSE);
+
+    SDL_free(GDK_GPUCapturePath);
+    GDK_GPUCapturePath = NULL;
+
+    if (FAILED(result)) {
+        return WIN_SetErrorFromHRESULT("PIXEndCapture", result);
+    }
+    return true;
+}
+#endif
@@ -25,3 +25,13 @@ extern void GDK_DispatchTaskQueue(void);
 
 extern bool GDK_RegisterChangeNotifications(void);
 extern void GDK_UnregisterChangeNotifications(void);
+
+// PIX programmatic GPU captures for SDL_BeginGPUCapture() on Xbox
+extern bool GDK_BeginGPUCapture(const char *path);
+extern bool GDK_EndGPUCapture(void);
+
+#ifdef SDL_TRACING
+// PIX event markers for SDL's tracing zones
+extern void GDK_BeginTraceEvent(const char *name);
+extern void GDK_EndTraceEvent(void);
+#endif
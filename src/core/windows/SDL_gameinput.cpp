@@ -29,10 +29,46 @@ static SDL_SharedObject *g_hGameInputDLL;
 static IGameInput *g_pGameInput;
 static int g_nGameInputRefCount;
 
+#ifdef SDL_PLATFORM_WINRT
+/* Packaged apps can only load DLLs from their own package, so gameinput.dll
+ * is linked directly and delay-loaded instead (see the /DELAYLOAD option in
+ * the UWP project). If it isn't installed the delay-load helper raises an
+ * exception, and we fall back to other joystick drivers.
+ */
+#pragma comment(lib, "gameinput.lib")
+#pragma comment(lib, "delayimp.lib")
+
+static HRESULT WINRT_GameInputCreate(IGameInput **ppGameInput)
+{
+    __try {
+        return GameInputCreate(ppGameInput);
+    } __except (EXCEPTION_EXECUTE_HANDLER) {
+        return HRESULT_FROM_WIN32(ERROR_MOD_NOT_FOUND);
+    }
+}
+#endif
+
 
 bool SDL_InitGameInput(IGameInput **ppGameInput)
 {
     if (g_nGameInputRefCount == 0) {
+#ifdef SDL_PLATFORM_WINRT
+        IGameInput *pGameInput = NULL;
+        HRESULT hr = WINRT_GameInputCreate(&pGameInput);
+        if (FAILED(hr)) {
+            return WIN_SetErrorFromHRESULT("GameInputCreate failed", hr);
+        }
+
+#if GAMEINPUT_API_VERSION >= 1
+        hr = pGameInput->QueryInterface(IID_IGameInput, (void **)&g_pGameInput);
+        pGameInput->Release();
+        if (FAILED(hr)) {
+            return WIN_SetErrorFromHRESULT("GameInput QueryInterface failed", hr);
+        }
+#else
+        g_pGameInput = pGameInput;
+#endif
+#else
         g_hGameInputDLL = SDL_LoadObject("gameinput.dll");
         if (!g_hGameInputDLL) {
             return false;
@@ -68,6 +104,7 @@ bool SDL_InitGameInput(IGameInput **ppGameInput)
         // Assume that the version we get is compatible with the current SDK
         g_pGameInput = pGameInput;
 #endif
+#endif // SDL_PLATFORM_WINRT
     }
     ++g_nGameInputRefCount;
 
@@ -358,6 +358,23 @@ SDL_AudioFormat SDL_WaveFormatExToSDLFormat(WAVEFORMATEX *waveformat)
     return SDL_AUDIO_UNKNOWN;
 }
 
+void SDL_SDLFormatToWaveFormatExtensible(SDL_AudioFormat format, int channels, int freq, DWORD channel_mask, WAVEFORMATEXTENSIBLE *waveformat)
+{
+    const WORD bits = (WORD)SDL_AUDIO_BITSIZE(format);
+
+    SDL_zerop(waveformat);
+    waveformat->Format.wFormatTag = WAVE_FORMAT_EXTENSIBLE;
+    waveformat->Format.nChannels = (WORD)channels;
+    waveformat->Format.nSamplesPerSec = (DWORD)freq;
+    waveformat->Format.wBitsPerSample = bits;
+    waveformat->Format.nBlockAlign = (WORD)(channels * (bits / 8));
+    waveformat->Format.nAvgBytesPerSec = waveformat->Format.nSamplesPerSec * waveformat->Format.nBlockAlign;
+    waveformat->Format.cbSize = sizeof(WAVEFORMATEXTENSIBLE) - sizeof(WAVEFORMATEX);
+    waveformat->Samples.wValidBitsPerSample = bits;
+    waveformat->dwChannelMask = channel_mask;
+    waveformat->SubFormat = SDL_AUDIO_ISFLOAT(format) ? SDL_KSDATAFORMAT_SUBTYPE_IEEE_FLOAT : SDL_KSDATAFORMAT_SUBTYPE_PCM;
+}
+
 int WIN_WideCharToMultiByte(UINT CodePage, DWORD dwFlags, LPCWCH lpWideCharStr, int cchWideChar, LPSTR lpMultiByteStr, int cbMultiByte, LPCCH lpDefaultChar, LPBOOL lpUsedDefaultChar)
 {
     if (WIN_IsWindowsXP()) {
@@ -93,9 +93,11 @@
 #include <basetyps.h> // for REFIID with broken mingw.org headers
 #include <mmreg.h>
 
+#include "../../stdlib/SDL_iconv_c.h"
+
 // Routines to convert from UTF8 to native Windows text
-#define WIN_StringToUTF8W(S) SDL_iconv_string("UTF-8", "UTF-16LE", (const char *)(S), (SDL_wcslen(S) + 1) * sizeof(WCHAR))
-#define WIN_UTF8ToStringW(S) (WCHAR *)SDL_iconv_string("UTF-16LE", "UTF-8", (const char *)(S), SDL_strlen(S) + 1)
+#define WIN_StringToUTF8W(S) SDL_ConvertUTF16LEToUTF8((const char *)(S), (SDL_wcslen(S) + 1) * sizeof(WCHAR))
+#define WIN_UTF8ToStringW(S) (WCHAR *)SDL_ConvertUTF8ToUTF16LE((const char *)(S), SDL_strlen(S) + 1)
 // !!! FIXME: UTF8ToString() can just be a SDL_strdup() here.
 #define WIN_StringToUTF8A(S) SDL_iconv_string("UTF-8", "ASCII", (const char *)(S), (SDL_strlen(S) + 1))
 #define WIN_UTF8ToStringA(S) SDL_iconv_string("ASCII", "UTF-8", (const char *)(S), SDL_strlen(S) + 1)
@@ -161,6 +163,9 @@ bool WIN_WindowRectValid(const RECT *rect);
 
 extern SDL_AudioFormat SDL_WaveFormatExToSDLFormat(WAVEFORMATEX *waveformat);
 
+// Fills in a WAVEFORMATEXTENSIBLE for SDL_AUDIO_F32, SDL_AUDIO_S32 or SDL_AUDIO_S16 samples.
+extern void SDL_SDLFormatToWaveFormatExtensible(SDL_AudioFormat format, int channels, int freq, DWORD channel_mask, WAVEFORMATEXTENSIBLE *waveformat);
+
 // WideCharToMultiByte, but with some WinXP management.
 extern int WIN_WideCharToMultiByte(UINT CodePage, DWORD dwFlags, LPCWCH lpWideCharStr, int cchWideChar, LPSTR lpMultiByteStr, int cbMultiByte, LPCCH lpDefaultChar, LPBOOL lpUsedDefaultChar);
 
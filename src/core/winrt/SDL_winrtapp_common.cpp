@@ -21,9 +21,54 @@
 #include "SDL_internal.h"
 
 #include <wrl.h>
+#include <dxgi.h>
+
+#include "SDL_winrtapp_common.h"
+#include "SDL_winrtapp_xaml.h"
 
 int (*WINRT_SDLAppEntryPoint)(int, char **) = NULL;
 
+static Uint64 WINRT_StartupTimeline[WINRT_STARTUP_STAGE_COUNT];
+
+extern "C"
+void WINRT_RecordStartupStage(WINRT_StartupStage stage)
+{
+    static const struct
+    {
+        const char *property;
+        const char *description;
+    } stages[] = {
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_INITIALIZE_NUMBER, "IFrameworkView::Initialize" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_SET_WINDOW_NUMBER, "IFrameworkView::SetWindow" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_LOAD_NUMBER, "IFrameworkView::Load" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_RUN_NUMBER, "IFrameworkView::Run" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_VIDEO_INIT_NUMBER, "video init" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_INIT_MODES_NUMBER, "display mode init" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_ADAPTERS_ENUMERATED_NUMBER, "DXGI adapters enumerated" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_DEVICE_CREATED_NUMBER, "graphics device created" },
+        { SDL_PROP_GLOBAL_WINRT_STARTUP_FIRST_PRESENT_NUMBER, "first present" },
+    };
+    SDL_COMPILE_TIME_ASSERT(winrt_startup_stages, SDL_arraysize(stages) == WINRT_STARTUP_STAGE_COUNT);
+
+    Uint64 now;
+
+    if ((int)stage < 0 || stage >= WINRT_STARTUP_STAGE_COUNT || WINRT_StartupTimeline[stage]) {
+        return;
+    }
+
+    // Always remember the stage, so checking the hint doesn't happen every frame
+    now = SDL_GetTicksNS();
+    WINRT_StartupTimeline[stage] = now;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_WINRT_STARTUP_TIMELINE, false)) {
+        return;
+    }
+
+    SDL_SetNumberProperty(SDL_GetGlobalProperties(), stages[stage].property, (Sint64)now);
+    SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "WinRT startup: %s at %" SDL_PRIu64 ".%06" SDL_PRIu64 " ms",
+                stages[stage].description, now / SDL_NS_PER_MS, now % SDL_NS_PER_MS);
+}
+
 extern "C"
 SDL_WinRT_DeviceFamily SDL_GetWinRTDeviceFamily()
 {
@@ -41,3 +86,53 @@ SDL_WinRT_DeviceFamily SDL_GetWinRTDeviceFamily()
 
     return SDL_WINRT_DEVICEFAMILY_UNKNOWN;
 }
+
+/* The output that SDL_AppIterate() is paced against, opened on first use.
+   Only touched from the SDL thread.
+ */
+static IDXGIOutput *WINRT_VBlankOutput = NULL;
+static bool WINRT_VBlankUnavailable = false;
+
+extern "C"
+bool WINRT_WaitForVBlank(void)
+{
+    if (WINRT_XAMLWasEnabled) {
+        /* The SDL thread already yields to XAML in SDL_PumpEvents() until the
+           next CompositionTarget::Rendering callback, which fires once per
+           frame, so there's nothing more to wait for here.
+         */
+        return true;
+    }
+
+    if (!WINRT_VBlankOutput && !WINRT_VBlankUnavailable) {
+        IDXGIFactory1 *factory = NULL;
+        IDXGIAdapter1 *adapter = NULL;
+
+        // UWP apps only ever have a single display, it's the first output of the default adapter
+        if (SUCCEEDED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void **)&factory))) {
+            if (SUCCEEDED(factory->EnumAdapters1(0, &adapter))) {
+                adapter->EnumOutputs(0, &WINRT_VBlankOutput);
+                adapter->Release();
+            }
+            factory->Release();
+        }
+        if (!WINRT_VBlankOutput) {
+            WINRT_VBlankUnavailable = true;
+        }
+    }
+
+    if (!WINRT_VBlankOutput || FAILED(WINRT_VBlankOutput->WaitForVBlank())) {
+        return false;
+    }
+    return true;
+}
+
+extern "C"
+void WINRT_QuitVBlank(void)
+{
+    if (WINRT_VBlankOutput) {
+        WINRT_VBlankOutput->Release();
+        WINRT_VBlankOutput = NULL;
+    }
+    WINRT_VBlankUnavailable = false;
+}
@@ -23,9 +23,53 @@
 #ifndef SDL_winrtapp_common_h_
 #define SDL_winrtapp_common_h_
 
+#ifdef __cplusplus
 /* A pointer to the app's C-style main() function (which is a different
    function than the WinRT app's actual entry point).
  */
 extern int (*WINRT_SDLAppEntryPoint)(int, char **);
+#endif
+
+/* Points in the app's startup that get timestamped when
+   SDL_HINT_WINRT_STARTUP_TIMELINE is enabled.
+ */
+typedef enum WINRT_StartupStage
+{
+    WINRT_STARTUP_INITIALIZE,
+    WINRT_STARTUP_SET_WINDOW,
+    WINRT_STARTUP_LOAD,
+    WINRT_STARTUP_RUN,
+    WINRT_STARTUP_VIDEO_INIT,
+    WINRT_STARTUP_INIT_MODES,
+    WINRT_STARTUP_ADAPTERS_ENUMERATED,
+    WINRT_STARTUP_DEVICE_CREATED,
+    WINRT_STARTUP_FIRST_PRESENT,
+    WINRT_STARTUP_STAGE_COUNT
+} WINRT_StartupStage;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Records the first time a startup stage is reached. Later calls for the
+   same stage are ignored, so this is cheap enough to call every frame.
+ */
+extern void WINRT_RecordStartupStage(WINRT_StartupStage stage);
+
+/* Queues a run of SDL_RunOnMainThread() callbacks on the UI thread's
+   dispatcher. Returns false if the main thread isn't the UI thread, in which
+   case the callbacks run from SDL_PumpEvents() as usual.
+ */
+extern bool WINRT_DispatchMainThreadCallbacks(void);
+
+/* Blocks until the next vertical blank of the display, for pacing
+   SDL_AppIterate() when SDL_HINT_MAIN_CALLBACK_RATE is "vblank". Returns
+   false if there's no vblank source, and WINRT_QuitVBlank() releases it.
+ */
+extern bool WINRT_WaitForVBlank(void);
+extern void WINRT_QuitVBlank(void);
+
+#ifdef __cplusplus
+}
 
 #endif // SDL_winrtapp_common_h_
@@ -44,6 +44,7 @@ extern "C" {
 #include "../../events/SDL_keyboard_c.h"
 #include "../../events/SDL_mouse_c.h"
 #include "../../events/SDL_windowevents_c.h"
+#include "../../io/SDL_asyncio_c.h"
 #include "../../render/SDL_sysrender.h"
 #include "../windows/SDL_windows.h"
 }
@@ -60,6 +61,8 @@ extern "C" {
 extern "C" void D3D11_Trim(SDL_Renderer *);
 #endif
 
+extern "C" void SDL_TrimSurfacePool(void);
+
 // Compile-time debugging options:
 // To enable, uncomment; to disable, comment them out.
 // #define LOG_POINTER_EVENTS 1
@@ -75,6 +78,69 @@ extern "C" void D3D11_Trim(SDL_Renderer *);
 // SDL_CreateWindow().
 SDL_WinRTApp ^ SDL_WinRTGlobalApp = nullptr;
 
+// The app's per-view objects, recorded on the UI thread for use by the game thread.
+static Platform::Agile<CoreWindow> WINRT_UICoreWindow;
+static Platform::Agile<Windows::UI::ViewManagement::ApplicationView> WINRT_UIApplicationView;
+static Platform::Agile<Windows::UI::ViewManagement::InputPane> WINRT_UIInputPane;
+#if NTDDI_VERSION > NTDDI_WIN8
+static Platform::Agile<DisplayInformation> WINRT_UIDisplayInformation;
+#endif
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+static Platform::Agile<Windows::Graphics::Display::Core::HdmiDisplayInformation> WINRT_UIHdmiDisplayInformation;
+#endif
+
+// Game thread state, see SDL_HINT_WINRT_GAME_THREAD
+static bool WINRT_UseGameThread = false;
+static SDL_AtomicInt WINRT_GameThreadDone;
+static CoreDispatcher ^ WINRT_GameThreadDispatcher = nullptr;
+
+CoreWindow ^ WINRT_GetCoreWindow()
+{
+    CoreWindow ^ coreWindow = CoreWindow::GetForCurrentThread();
+    if (coreWindow) {
+        return coreWindow;
+    }
+    return WINRT_UICoreWindow.Get();
+}
+
+#if SDL_WINRT_USE_APPLICATIONVIEW
+Windows::UI::ViewManagement::ApplicationView ^ WINRT_GetApplicationView()
+{
+    if (CoreWindow::GetForCurrentThread()) {
+        return Windows::UI::ViewManagement::ApplicationView::GetForCurrentView();
+    }
+    return WINRT_UIApplicationView.Get();
+}
+#endif
+
+Windows::UI::ViewManagement::InputPane ^ WINRT_GetInputPane()
+{
+    if (CoreWindow::GetForCurrentThread()) {
+        return Windows::UI::ViewManagement::InputPane::GetForCurrentView();
+    }
+    return WINRT_UIInputPane.Get();
+}
+
+#if NTDDI_VERSION > NTDDI_WIN8
+DisplayInformation ^ WINRT_GetDisplayInformation()
+{
+    if (CoreWindow::GetForCurrentThread()) {
+        return DisplayInformation::GetForCurrentView();
+    }
+    return WINRT_UIDisplayInformation.Get();
+}
+#endif
+
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+Windows::Graphics::Display::Core::HdmiDisplayInformation ^ WINRT_GetHdmiDisplayInformation()
+{
+    if (CoreWindow::GetForCurrentThread()) {
+        return Windows::Graphics::Display::Core::HdmiDisplayInformation::GetForCurrentView();
+    }
+    return WINRT_UIHdmiDisplayInformation.Get();
+}
+#endif
+
 ref class SDLApplicationSource sealed : Windows::ApplicationModel::Core::IFrameworkViewSource
 {
   public:
@@ -162,6 +228,8 @@ SDL_WinRTApp::SDL_WinRTApp() : m_windowClosed(false),
 
 void SDL_WinRTApp::Initialize(CoreApplicationView ^ applicationView)
 {
+    WINRT_RecordStartupStage(WINRT_STARTUP_INITIALIZE);
+
     applicationView->Activated +=
         ref new TypedEventHandler<CoreApplicationView ^, IActivatedEventArgs ^>(this, &SDL_WinRTApp::OnAppActivated);
 
@@ -186,6 +254,14 @@ void SDL_WinRTApp::Initialize(CoreApplicationView ^ applicationView)
 #endif
 }
 
+#if NTDDI_VERSION > NTDDI_WIN8
+void SDL_WinRTApp::OnDisplayContentsInvalidated(DisplayInformation ^ sender, Object ^ args)
+{
+    // A display was added, removed or reconfigured, so the cached modes may be out of date
+    WINRT_InvalidateDisplayCache();
+}
+#endif
+
 #if NTDDI_VERSION > NTDDI_WIN8
 void SDL_WinRTApp::OnOrientationChanged(DisplayInformation ^ sender, Object ^ args)
 #else
@@ -239,6 +315,8 @@ void SDL_WinRTApp::OnOrientationChanged(Object ^ sender)
 
 void SDL_WinRTApp::SetWindow(CoreWindow ^ window)
 {
+    WINRT_RecordStartupStage(WINRT_STARTUP_SET_WINDOW);
+
 #if LOG_WINDOW_EVENTS == 1
     SDL_Log("%s, current orientation=%d, native orientation=%d, auto rot. pref=%d, window bounds={%f, %f, %f,%f}\n",
             __FUNCTION__,
@@ -251,6 +329,18 @@ void SDL_WinRTApp::SetWindow(CoreWindow ^ window)
             window->Bounds.Height);
 #endif
 
+    WINRT_UICoreWindow = window;
+#if SDL_WINRT_USE_APPLICATIONVIEW
+    WINRT_UIApplicationView = Windows::UI::ViewManagement::ApplicationView::GetForCurrentView();
+#endif
+    WINRT_UIInputPane = Windows::UI::ViewManagement::InputPane::GetForCurrentView();
+#if NTDDI_VERSION > NTDDI_WIN8
+    WINRT_UIDisplayInformation = DisplayInformation::GetForCurrentView();
+#endif
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+    WINRT_UIHdmiDisplayInformation = Windows::Graphics::Display::Core::HdmiDisplayInformation::GetForCurrentView();
+#endif
+
     window->SizeChanged +=
         ref new TypedEventHandler<CoreWindow ^, WindowSizeChangedEventArgs ^>(this, &SDL_WinRTApp::OnWindowSizeChanged);
 
@@ -308,6 +398,9 @@ void SDL_WinRTApp::SetWindow(CoreWindow ^ window)
 #if NTDDI_VERSION > NTDDI_WIN8
     DisplayInformation::GetForCurrentView()->OrientationChanged +=
         ref new TypedEventHandler<Windows::Graphics::Display::DisplayInformation ^, Object ^>(this, &SDL_WinRTApp::OnOrientationChanged);
+
+    DisplayInformation::DisplayContentsInvalidated +=
+        ref new TypedEventHandler<Windows::Graphics::Display::DisplayInformation ^, Object ^>(this, &SDL_WinRTApp::OnDisplayContentsInvalidated);
 #else
     DisplayProperties::OrientationChanged +=
         ref new DisplayPropertiesEventHandler(this, &SDL_WinRTApp::OnOrientationChanged);
@@ -325,6 +418,7 @@ void SDL_WinRTApp::SetWindow(CoreWindow ^ window)
 
 void SDL_WinRTApp::Load(Platform::String ^ entryPoint)
 {
+    WINRT_RecordStartupStage(WINRT_STARTUP_LOAD);
 }
 
 void SDL_WinRTApp::App_BackRequested(
@@ -334,8 +428,64 @@ void SDL_WinRTApp::App_BackRequested(
     e->Handled = true;
 }
 
+static int WINRT_CallAppEntryPoint()
+{
+    // TODO, WinRT: pass the C-style main() a reasonably realistic
+    // representation of command line arguments.
+    int argc = 1;
+    char **argv = (char **)SDL_malloc(2 * sizeof(*argv));
+    if (!argv) {
+        return -1;
+    }
+    argv[0] = SDL_strdup("WinRTApp");
+    argv[1] = NULL;
+    int result = WINRT_SDLAppEntryPoint(argc, argv);
+    SDL_free(argv[0]);
+    SDL_free(argv);
+    return result;
+}
+
+static int SDLCALL WINRT_GameThreadMain(void *userdata)
+{
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    int result = WINRT_CallAppEntryPoint();
+
+    // Wake up the UI thread, which is likely waiting for CoreWindow events.
+    SDL_SetAtomicInt(&WINRT_GameThreadDone, 1);
+    WINRT_GameThreadDispatcher->RunAsync(CoreDispatcherPriority::Normal, ref new DispatchedHandler([]() {}));
+    return result;
+}
+
+void SDL_WinRTApp::RunGameThread()
+{
+    WINRT_GameThreadDispatcher = CoreWindow::GetForCurrentThread()->Dispatcher;
+    SDL_SetAtomicInt(&WINRT_GameThreadDone, 0);
+    WINRT_UseGameThread = true;
+
+    SDL_Thread *thread = SDL_CreateThread(WINRT_GameThreadMain, "SDLGameThread", NULL);
+    if (!thread) {
+        WINRT_UseGameThread = false;
+        WINRT_CallAppEntryPoint();
+        return;
+    }
+
+    /* The UI thread keeps the dispatcher to itself from here on.  Event
+     * handlers post straight into SDL's event queue, so however long a
+     * ProcessEvents() call takes, the game thread never waits on it.
+     */
+    while (!SDL_GetAtomicInt(&WINRT_GameThreadDone) && !m_windowClosed) {
+        WINRT_GameThreadDispatcher->ProcessEvents(CoreProcessEventsOption::ProcessOneAndAllPending);
+    }
+
+    SDL_WaitThread(thread, NULL);
+    WINRT_UseGameThread = false;
+}
+
 void SDL_WinRTApp::Run()
 {
+    WINRT_RecordStartupStage(WINRT_STARTUP_RUN);
+
     auto navigation = Windows::UI::Core::SystemNavigationManager::GetForCurrentView();
     // UWP on Xbox One triggers a back request whenever the B button is
     // pressed which can result in the app being suspended if unhandled
@@ -346,18 +496,11 @@ void SDL_WinRTApp::Run()
     SDL_SetMainReady();
 
     if (WINRT_SDLAppEntryPoint) {
-        // TODO, WinRT: pass the C-style main() a reasonably realistic
-        // representation of command line arguments.
-        int argc = 1;
-        char **argv = (char **)SDL_malloc(2 * sizeof(*argv));
-        if (!argv) {
-            return;
+        if (SDL_GetHintBoolean(SDL_HINT_WINRT_GAME_THREAD, false)) {
+            RunGameThread();
+        } else {
+            WINRT_CallAppEntryPoint();
         }
-        argv[0] = SDL_strdup("WinRTApp");
-        argv[1] = NULL;
-        WINRT_SDLAppEntryPoint(argc, argv);
-        SDL_free(argv[0]);
-        SDL_free(argv);
     }
 
     //Retropass handler
@@ -377,9 +520,7 @@ void SDL_WinRTApp::Run()
 
 static bool IsSDLWindowEventPending(SDL_EventType windowEventID)
 {
-    SDL_Event events[128];
-    const int count = SDL_PeepEvents(events, sizeof(events) / sizeof(SDL_Event), SDL_PEEKEVENT, windowEventID, windowEventID);
-    return (count > 0);
+    return SDL_HasEvent(windowEventID);
 }
 
 bool SDL_WinRTApp::ShouldWaitForAppResumeEvents()
@@ -411,7 +552,13 @@ bool SDL_WinRTApp::ShouldWaitForAppResumeEvents()
 
 void SDL_WinRTApp::PumpEvents()
 {
+    if (WINRT_UseGameThread) {
+        // The UI thread dispatches CoreWindow events on its own.
+        return;
+    }
+
     if (!m_windowClosed) {
+        SDL_TRACE_ZONE_BEGIN(zone, "SDL_WinRTApp::PumpEvents");
         if (!ShouldWaitForAppResumeEvents()) {
             /* This is the normal way in which events should be pumped.
              * 'ProcessAllIfPresent' will make ProcessEvents() process anywhere
@@ -428,9 +575,81 @@ void SDL_WinRTApp::PumpEvents()
              */
             CoreWindow::GetForCurrentThread()->Dispatcher->ProcessEvents(CoreProcessEventsOption::ProcessOneAndAllPending);
         }
+        SDL_TRACE_ZONE_END(zone);
     }
 }
 
+int SDL_WinRTApp::WaitEvents(Sint64 timeoutNS)
+{
+    CoreWindow ^ window = CoreWindow::GetForCurrentThread();
+    Windows::System::Threading::ThreadPoolTimer ^ timer = nullptr;
+    Uint64 start = SDL_GetTicksNS();
+
+    if (WINRT_UseGameThread || m_windowClosed || !window) {
+        // Only the UI thread can wait on the dispatcher, fall back to polling
+        return -1;
+    }
+
+    CoreDispatcher ^ dispatcher = window->Dispatcher;
+    if (timeoutNS == 0) {
+        dispatcher->ProcessEvents(CoreProcessEventsOption::ProcessAllIfPresent);
+        return 0;
+    }
+
+    if (timeoutNS > 0) {
+        // Wake the dispatcher up with an empty task once the timeout elapses
+        TimeSpan delay;
+        delay.Duration = (timeoutNS + 99) / 100; // 100ns units
+        timer = Windows::System::Threading::ThreadPoolTimer::CreateTimer(
+            ref new Windows::System::Threading::TimerElapsedHandler([dispatcher](Windows::System::Threading::ThreadPoolTimer ^) {
+                dispatcher->RunAsync(CoreDispatcherPriority::Normal, ref new DispatchedHandler([]() {}));
+            }),
+            delay);
+    }
+
+    /* 'ProcessOneAndAllPending' blocks until at least one event, which may be
+     * our timer or a wakeup from SendWakeup(), gets dispatched.
+     */
+    dispatcher->ProcessEvents(CoreProcessEventsOption::ProcessOneAndAllPending);
+
+    if (timer) {
+        timer->Cancel();
+        if ((Sint64)(SDL_GetTicksNS() - start) >= timeoutNS) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void SDL_WinRTApp::SendWakeup()
+{
+    CoreWindow ^ window = WINRT_GetCoreWindow();
+    if (window) {
+        window->Dispatcher->RunAsync(CoreDispatcherPriority::Normal, ref new DispatchedHandler([]() {}));
+    }
+}
+
+extern "C"
+bool WINRT_DispatchMainThreadCallbacks(void)
+{
+    CoreWindow ^ window;
+
+    if (!SDL_WinRTGlobalApp || WINRT_UseGameThread) {
+        // SDL's main thread isn't the UI thread
+        return false;
+    }
+
+    window = WINRT_UICoreWindow.Get();
+    if (!window) {
+        return false;
+    }
+
+    window->Dispatcher->RunAsync(CoreDispatcherPriority::Normal, ref new DispatchedHandler([]() {
+        SDL_RunMainThreadCallbacks();
+    }));
+    return true;
+}
+
 void SDL_WinRTApp::Uninitialize()
 {
 }
@@ -668,6 +887,11 @@ void SDL_WinRTApp::OnSuspending(Platform::Object ^ sender, SuspendingEventArgs ^
         // WinRT.
         SDL_SendAppEvent(SDL_EVENT_DID_ENTER_BACKGROUND);
 
+        // Let any SDL_SaveFileAsync() calls, including ones made by the event
+        // handlers above, reach the disk before we're suspended. We get about
+        // five seconds in total, so leave some room for the rest of this.
+        SDL_WaitForAsyncSaves(3000);
+
         // Let the Direct3D 11 renderer prepare for the app to be backgrounded.
         // This is necessary for Windows 8.1, possibly elsewhere in the future.
         // More details at: http://msdn.microsoft.com/en-us/library/windows/apps/Hh994929.aspx
@@ -680,6 +904,10 @@ void SDL_WinRTApp::OnSuspending(Platform::Object ^ sender, SuspendingEventArgs ^
         }
 #endif
 
+        // Give back the memory kept for reusing surface pixels, since the
+        // system is more likely to terminate apps that use a lot of it.
+        SDL_TrimSurfacePool();
+
         deferral->Complete();
     });
 }
@@ -729,7 +957,11 @@ void SDL_WinRTApp::OnPointerMoved(CoreWindow ^ sender, PointerEventArgs ^ args)
     WINRT_LogPointerEvent("pointer moved", args, WINRT_TransformCursorPosition(WINRT_GlobalSDLWindow, args->CurrentPoint->Position, TransformToSDLWindowSize));
 #endif
 
-    WINRT_ProcessPointerMovedEvent(WINRT_GlobalSDLWindow, args->CurrentPoint);
+    if (SDL_GetHintBoolean(SDL_HINT_WINRT_POINTER_HISTORY, false)) {
+        WINRT_ProcessPointerMovedEvents(WINRT_GlobalSDLWindow, args->CurrentPoint, args->GetIntermediatePoints());
+    } else {
+        WINRT_ProcessPointerMovedEvent(WINRT_GlobalSDLWindow, args->CurrentPoint);
+    }
 }
 
 void SDL_WinRTApp::OnPointerReleased(CoreWindow ^ sender, PointerEventArgs ^ args)
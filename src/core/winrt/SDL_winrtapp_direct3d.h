@@ -42,9 +42,12 @@ ref class SDL_WinRTApp sealed : public Windows::ApplicationModel::Core::IFramewo
         // SDL-specific methods
         void
         PumpEvents();
+    int WaitEvents(Sint64 timeoutNS);
+    void SendWakeup();
 
   protected:
     bool ShouldWaitForAppResumeEvents();
+    void RunGameThread();
 
     // Event Handlers.
 
@@ -56,6 +59,7 @@ ref class SDL_WinRTApp sealed : public Windows::ApplicationModel::Core::IFramewo
 
 #if NTDDI_VERSION > NTDDI_WIN8
     void OnOrientationChanged(Windows::Graphics::Display::DisplayInformation ^ sender, Platform::Object ^ args);
+    void OnDisplayContentsInvalidated(Windows::Graphics::Display::DisplayInformation ^ sender, Platform::Object ^ args);
 #else
     void OnOrientationChanged(Platform::Object ^ sender);
 #endif
@@ -25,6 +25,7 @@
 #include <Windows.h>
 
 #if WINAPI_FAMILY == WINAPI_FAMILY_APP
+#include <dxgi1_3.h>
 #include <windows.ui.xaml.media.dxinterop.h>
 #endif
 
@@ -38,8 +39,17 @@
 bool WINRT_XAMLWasEnabled = false;
 
 #if WINAPI_FAMILY == WINAPI_FAMILY_APP
-extern "C" ISwapChainBackgroundPanelNative *WINRT_GlobalSwapChainBackgroundPanelNative = NULL;
+static ISwapChainBackgroundPanelNative *WINRT_XAMLSwapChainBackgroundPanelNative = NULL;
+static ISwapChainPanelNative *WINRT_XAMLSwapChainPanelNative = NULL;
 static Windows::Foundation::EventRegistrationToken WINRT_XAMLAppEventToken;
+
+/* The swap chain attached to a SwapChainPanel, and the panel's composition scale.
+   The scale is only readable on the UI thread, while the swap chain is created on
+   the SDL thread, so both are kept here under a lock. */
+static SDL_SpinLock WINRT_XAMLSwapChainLock;
+static IDXGISwapChain1 *WINRT_XAMLSwapChain = NULL;
+static float WINRT_XAMLCompositionScaleX = 1.0f;
+static float WINRT_XAMLCompositionScaleY = 1.0f;
 #endif
 
 /*
@@ -54,7 +64,11 @@ static void WINRT_OnPointerPressedViaXAML(Platform::Object ^ sender, Windows::UI
 
 static void WINRT_OnPointerMovedViaXAML(Platform::Object ^ sender, Windows::UI::Xaml::Input::PointerRoutedEventArgs ^ args)
 {
-    WINRT_ProcessPointerMovedEvent(WINRT_GlobalSDLWindow, args->GetCurrentPoint(nullptr));
+    if (SDL_GetHintBoolean(SDL_HINT_WINRT_POINTER_HISTORY, false)) {
+        WINRT_ProcessPointerMovedEvents(WINRT_GlobalSDLWindow, args->GetCurrentPoint(nullptr), args->GetIntermediatePoints(nullptr));
+    } else {
+        WINRT_ProcessPointerMovedEvent(WINRT_GlobalSDLWindow, args->GetCurrentPoint(nullptr));
+    }
 }
 
 static void WINRT_OnPointerReleasedViaXAML(Platform::Object ^ sender, Windows::UI::Xaml::Input::PointerRoutedEventArgs ^ args)
@@ -69,6 +83,74 @@ static void WINRT_OnPointerWheelChangedViaXAML(Platform::Object ^ sender, Window
 
 #endif // WINAPI_FAMILY == WINAPI_FAMILY_APP
 
+/*
+ * XAML Swap Chain Management
+ */
+#if WINAPI_FAMILY == WINAPI_FAMILY_APP
+
+// Call with WINRT_XAMLSwapChainLock held
+static void WINRT_ApplyXAMLCompositionScale()
+{
+    IDXGISwapChain2 *swapChain2 = NULL;
+
+    if (!WINRT_XAMLSwapChain) {
+        return;
+    }
+
+    /* SwapChainPanel scales its content by the composition scale (the display
+       DPI scale, plus any render transforms). The swap chain is sized in physical
+       pixels, so apply the inverse to map it 1:1 onto the screen. Any source size
+       set on the swap chain is then stretched to fill the panel by the compositor. */
+    if (SUCCEEDED(WINRT_XAMLSwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void **)&swapChain2))) {
+        DXGI_MATRIX_3X2_F inverseScale = { 0 };
+        inverseScale._11 = 1.0f / WINRT_XAMLCompositionScaleX;
+        inverseScale._22 = 1.0f / WINRT_XAMLCompositionScaleY;
+        swapChain2->SetMatrixTransform(&inverseScale);
+        swapChain2->Release();
+    }
+}
+
+static void WINRT_OnCompositionScaleChangedViaXAML(Windows::UI::Xaml::Controls::SwapChainPanel ^ sender, Platform::Object ^ args)
+{
+    SDL_LockSpinlock(&WINRT_XAMLSwapChainLock);
+    WINRT_XAMLCompositionScaleX = sender->CompositionScaleX;
+    WINRT_XAMLCompositionScaleY = sender->CompositionScaleY;
+    WINRT_ApplyXAMLCompositionScale();
+    SDL_UnlockSpinlock(&WINRT_XAMLSwapChainLock);
+}
+
+HRESULT WINRT_SetXAMLSwapChain(IDXGISwapChain1 *swapChain)
+{
+    HRESULT result;
+
+    if (WINRT_XAMLSwapChainPanelNative) {
+        result = WINRT_XAMLSwapChainPanelNative->SetSwapChain(swapChain);
+        if (FAILED(result)) {
+            return result;
+        }
+
+        SDL_LockSpinlock(&WINRT_XAMLSwapChainLock);
+        if (WINRT_XAMLSwapChain) {
+            WINRT_XAMLSwapChain->Release();
+        }
+        WINRT_XAMLSwapChain = swapChain;
+        if (WINRT_XAMLSwapChain) {
+            WINRT_XAMLSwapChain->AddRef();
+        }
+        WINRT_ApplyXAMLCompositionScale();
+        SDL_UnlockSpinlock(&WINRT_XAMLSwapChainLock);
+        return S_OK;
+    }
+
+    if (WINRT_XAMLSwapChainBackgroundPanelNative) {
+        return WINRT_XAMLSwapChainBackgroundPanelNative->SetSwapChain(swapChain);
+    }
+
+    return E_FAIL;
+}
+
+#endif // WINAPI_FAMILY == WINAPI_FAMILY_APP
+
 /*
  * XAML-to-SDL Rendering Callback
  */
@@ -105,20 +187,32 @@ bool SDL_WinRTInitXAMLApp(int (*mainFunction)(int, char **), void *backgroundPan
     }
 
     Platform::Object ^ backgroundPanel = reinterpret_cast<Object ^>((IInspectable *)backgroundPanelAsIInspectable);
-    SwapChainBackgroundPanel ^ swapChainBackgroundPanel = dynamic_cast<SwapChainBackgroundPanel ^>(backgroundPanel);
-    if (!swapChainBackgroundPanel) {
+    IInspectable *panelInspectable = (IInspectable *)backgroundPanelAsIInspectable;
+    UIElement ^ panel = nullptr;
+    if (SwapChainPanel ^ swapChainPanel = dynamic_cast<SwapChainPanel ^>(backgroundPanel)) {
+        if (FAILED(panelInspectable->QueryInterface(__uuidof(ISwapChainPanelNative), (void **)&WINRT_XAMLSwapChainPanelNative))) {
+            return SDL_SetError("Couldn't get ISwapChainPanelNative from the XAML control.");
+        }
+        WINRT_XAMLCompositionScaleX = swapChainPanel->CompositionScaleX;
+        WINRT_XAMLCompositionScaleY = swapChainPanel->CompositionScaleY;
+        swapChainPanel->CompositionScaleChanged += ref new TypedEventHandler<SwapChainPanel ^, Object ^>(WINRT_OnCompositionScaleChangedViaXAML);
+        panel = swapChainPanel;
+    } else if (SwapChainBackgroundPanel ^ swapChainBackgroundPanel = dynamic_cast<SwapChainBackgroundPanel ^>(backgroundPanel)) {
+        if (FAILED(panelInspectable->QueryInterface(__uuidof(ISwapChainBackgroundPanelNative), (void **)&WINRT_XAMLSwapChainBackgroundPanelNative))) {
+            return SDL_SetError("Couldn't get ISwapChainBackgroundPanelNative from the XAML control.");
+        }
+        panel = swapChainBackgroundPanel;
+    } else {
         return SDL_SetError("An unknown or unsupported type of XAML control was specified.");
     }
 
     // Setup event handlers:
-    swapChainBackgroundPanel->PointerPressed += ref new PointerEventHandler(WINRT_OnPointerPressedViaXAML);
-    swapChainBackgroundPanel->PointerReleased += ref new PointerEventHandler(WINRT_OnPointerReleasedViaXAML);
-    swapChainBackgroundPanel->PointerWheelChanged += ref new PointerEventHandler(WINRT_OnPointerWheelChangedViaXAML);
-    swapChainBackgroundPanel->PointerMoved += ref new PointerEventHandler(WINRT_OnPointerMovedViaXAML);
+    panel->PointerPressed += ref new PointerEventHandler(WINRT_OnPointerPressedViaXAML);
+    panel->PointerReleased += ref new PointerEventHandler(WINRT_OnPointerReleasedViaXAML);
+    panel->PointerWheelChanged += ref new PointerEventHandler(WINRT_OnPointerWheelChangedViaXAML);
+    panel->PointerMoved += ref new PointerEventHandler(WINRT_OnPointerMovedViaXAML);
 
     // Setup for rendering:
-    IInspectable *panelInspectable = (IInspectable *)reinterpret_cast<IInspectable *>(swapChainBackgroundPanel);
-    panelInspectable->QueryInterface(__uuidof(ISwapChainBackgroundPanelNative), (void **)&WINRT_GlobalSwapChainBackgroundPanelNative);
 
     WINRT_XAMLAppEventToken = CompositionTarget::Rendering::add(ref new EventHandler<Object ^>(WINRT_OnRenderViaXAML));
 
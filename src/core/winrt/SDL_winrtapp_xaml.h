@@ -26,6 +26,9 @@
 #ifdef __cplusplus
 extern bool WINRT_XAMLWasEnabled;
 extern bool SDL_WinRTInitXAMLApp(int (*mainFunction)(int, char **), void *backgroundPanelAsIInspectable);
+#if WINAPI_FAMILY == WINAPI_FAMILY_APP
+extern HRESULT WINRT_SetXAMLSwapChain(IDXGISwapChain1 *swapChain);
+#endif
 #endif // ifdef __cplusplus
 
 #endif // SDL_winrtapp_xaml_h_
@@ -908,6 +908,44 @@ int SDL_GetCPUCacheLineSize(void)
     return cacheline_size;
 }
 
+int SDL_GetCPUCacheSize(void)
+{
+    static int cache_size = 0;
+
+    if (!cache_size) {
+        int size = 0;
+        int a, b, c, d;
+        (void)a;
+        (void)b;
+        (void)c;
+        (void)d;
+
+#if defined(HAVE_SYSCONF) && defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+        size = (int)sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (size <= 0) {
+            size = (int)sysconf(_SC_LEVEL2_CACHE_SIZE);
+        }
+#endif
+        if (size <= 0) {
+            CPU_calcCPUIDFeatures();
+            if (CPU_CPUIDMaxFunction > 0) {
+                cpuid(0x80000000, a, b, c, d);
+                if ((Uint32)a >= 0x80000006) {
+                    // Intel and AMD both report the L2 size here, AMD also reports the L3 size
+                    cpuid(0x80000006, a, b, c, d);
+                    size = (int)(((Uint32)c >> 16) * 1024);
+                    size = SDL_max(size, (int)((((Uint32)d >> 18) & 0x3fff) * 512 * 1024));
+                }
+            }
+        }
+        if (size <= 0) {
+            size = 1024 * 1024; // a reasonable guess
+        }
+        cache_size = size;
+    }
+    return cache_size;
+}
+
 #define SDL_CPUFEATURES_RESET_VALUE 0xFFFFFFFF
 
 static Uint32 SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
@@ -1130,6 +1168,53 @@ bool SDL_HasLASX(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_LASX);
 }
 
+bool SDL_HasCLMUL(void)
+{
+    // This is only used along with SSE4.1, so it follows that in the feature mask hint
+    return SDL_HasSSE41() && (CPU_CPUIDFeatures[2] & 0x00000002);
+}
+
+bool SDL_HasInvariantTSC(void)
+{
+    static int has_invariant_tsc = -1;
+
+    if (has_invariant_tsc < 0) {
+        has_invariant_tsc = 0;
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+        if (CPU_haveCPUID()) {
+            int a, b, c, d;
+            cpuid(0x80000000, a, b, c, d);
+            if ((unsigned int)a >= 0x80000007) {
+                cpuid(0x80000007, a, b, c, d);
+                has_invariant_tsc = (d & 0x00000100) ? 1 : 0;
+            }
+        }
+#endif
+    }
+    return (has_invariant_tsc > 0);
+}
+
+bool SDL_HasARMCRC32(void)
+{
+    static int has_crc32 = -1;
+
+    if (has_crc32 < 0) {
+#if defined(__ARM_FEATURE_CRC32)
+        has_crc32 = 1;
+#elif defined(SDL_PLATFORM_WINDOWS) && defined(_M_ARM64)
+#ifndef PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE
+#define PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE 31
+#endif
+        has_crc32 = IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) ? 1 : 0;
+#elif defined(__aarch64__) && (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)) && defined(HAVE_GETAUXVAL)
+        has_crc32 = (getauxval(AT_HWCAP) & (1 << 7)) ? 1 : 0;  // HWCAP_CRC32
+#else
+        has_crc32 = 0;
+#endif
+    }
+    return (has_crc32 > 0);
+}
+
 static int SDL_SystemRAM = 0;
 
 int SDL_GetSystemRAM(void)
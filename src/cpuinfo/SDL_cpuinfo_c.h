@@ -24,4 +24,16 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// Get the size of the largest CPU cache, in bytes, or a reasonable guess
+extern int SDL_GetCPUCacheSize(void);
+
+// Whether the CPU has the x86 carry-less multiply instruction, and SSE4.1 to go with it
+extern bool SDL_HasCLMUL(void);
+
+// Whether the x86 time stamp counter runs at a constant rate in all power states
+extern bool SDL_HasInvariantTSC(void);
+
+// Whether the CPU has the ARMv8 CRC32 instructions
+extern bool SDL_HasARMCRC32(void);
+
 #endif // SDL_cpuinfo_c_h_
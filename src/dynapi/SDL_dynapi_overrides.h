@@ -1281,3 +1281,129 @@
 #define SDL_SetAudioIterationCallbacks SDL_SetAudioIterationCallbacks_REAL
 #define SDL_GetEventDescription SDL_GetEventDescription_REAL
 #define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_WaitForRenderPresent SDL_WaitForRenderPresent_REAL
+#define SDL_SetRenderDirtyRects SDL_SetRenderDirtyRects_REAL
+#define SDL_SetRenderScrollRect SDL_SetRenderScrollRect_REAL
+#define SDL_PushEvents SDL_PushEvents_REAL
+#define SDL_ShareTextureWithGL SDL_ShareTextureWithGL_REAL
+#define SDL_AcquireTextureForGL SDL_AcquireTextureForGL_REAL
+#define SDL_ReleaseTextureForGL SDL_ReleaseTextureForGL_REAL
+#define SDL_UnshareTextureWithGL SDL_UnshareTextureWithGL_REAL
+#define SDL_RenderTextureBatch SDL_RenderTextureBatch_REAL
+#define SDL_UpdateTextureAsync SDL_UpdateTextureAsync_REAL
+#define SDL_GetRenderStats SDL_GetRenderStats_REAL
+#define SDL_GetGPUPipelineCacheData SDL_GetGPUPipelineCacheData_REAL
+#define SDL_CreateGPUGraphicsPipelineAsync SDL_CreateGPUGraphicsPipelineAsync_REAL
+#define SDL_GetGPUGraphicsPipelineStatus SDL_GetGPUGraphicsPipelineStatus_REAL
+#define SDL_CreateGPUQueryPool SDL_CreateGPUQueryPool_REAL
+#define SDL_WriteGPUTimestamp SDL_WriteGPUTimestamp_REAL
+#define SDL_ReleaseGPUQueryPool SDL_ReleaseGPUQueryPool_REAL
+#define SDL_GetGPUQueryPoolResults SDL_GetGPUQueryPoolResults_REAL
+#define SDL_GetGPUMemoryInfo SDL_GetGPUMemoryInfo_REAL
+#define SDL_AcquireGPUCommandBufferForQueue SDL_AcquireGPUCommandBufferForQueue_REAL
+#define SDL_AddGPUCommandBufferWaitFence SDL_AddGPUCommandBufferWaitFence_REAL
+#define SDL_CreateGPUUploadHeap SDL_CreateGPUUploadHeap_REAL
+#define SDL_UploadGPUTextureData SDL_UploadGPUTextureData_REAL
+#define SDL_UploadGPUBufferData SDL_UploadGPUBufferData_REAL
+#define SDL_FlushGPUUploadHeap SDL_FlushGPUUploadHeap_REAL
+#define SDL_DestroyGPUUploadHeap SDL_DestroyGPUUploadHeap_REAL
+#define SDL_AddGPUBindlessTexture SDL_AddGPUBindlessTexture_REAL
+#define SDL_AddGPUBindlessSampler SDL_AddGPUBindlessSampler_REAL
+#define SDL_AddGPUBindlessBuffer SDL_AddGPUBindlessBuffer_REAL
+#define SDL_RemoveGPUBindlessTexture SDL_RemoveGPUBindlessTexture_REAL
+#define SDL_RemoveGPUBindlessSampler SDL_RemoveGPUBindlessSampler_REAL
+#define SDL_RemoveGPUBindlessBuffer SDL_RemoveGPUBindlessBuffer_REAL
+#define SDL_DrawGPUPrimitivesIndirectCount SDL_DrawGPUPrimitivesIndirectCount_REAL
+#define SDL_DrawGPUIndexedPrimitivesIndirectCount SDL_DrawGPUIndexedPrimitivesIndirectCount_REAL
+#define SDL_BlitGPUTextures SDL_BlitGPUTextures_REAL
+#define SDL_SetGPULatencyMarker SDL_SetGPULatencyMarker_REAL
+#define SDL_GetGPUPresentStatistics SDL_GetGPUPresentStatistics_REAL
+#define SDL_GetAudioDeviceStatistics SDL_GetAudioDeviceStatistics_REAL
+#define SDL_CreateAudioStreamWithProperties SDL_CreateAudioStreamWithProperties_REAL
+#define SDL_OpenWAVStream_IO SDL_OpenWAVStream_IO_REAL
+#define SDL_OpenWAVStream SDL_OpenWAVStream_REAL
+#define SDL_GetJoystickSnapshot SDL_GetJoystickSnapshot_REAL
+#define SDL_CreateJobCounter SDL_CreateJobCounter_REAL
+#define SDL_DestroyJobCounter SDL_DestroyJobCounter_REAL
+#define SDL_GetJobCounterValue SDL_GetJobCounterValue_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_SubmitJobAfter SDL_SubmitJobAfter_REAL
+#define SDL_WaitJobCounter SDL_WaitJobCounter_REAL
+#define SDL_RunJobs SDL_RunJobs_REAL
+#define SDL_GetNumJobThreads SDL_GetNumJobThreads_REAL
+#define SDL_SetCurrentThreadAffinity SDL_SetCurrentThreadAffinity_REAL
+#define SDL_SetCurrentThreadCoreClass SDL_SetCurrentThreadCoreClass_REAL
+#define SDL_WaitAtomicInt SDL_WaitAtomicInt_REAL
+#define SDL_WakeAtomicInt SDL_WakeAtomicInt_REAL
+#define SDL_SetMutexName SDL_SetMutexName_REAL
+#define SDL_GetMutexStats SDL_GetMutexStats_REAL
+#define SDL_ResetMutexStats SDL_ResetMutexStats_REAL
+#define SDL_CreateFramePacer SDL_CreateFramePacer_REAL
+#define SDL_SetFramePacerRate SDL_SetFramePacerRate_REAL
+#define SDL_SetFramePacerDisplay SDL_SetFramePacerDisplay_REAL
+#define SDL_WaitFramePacer SDL_WaitFramePacer_REAL
+#define SDL_ResetFramePacer SDL_ResetFramePacer_REAL
+#define SDL_GetFramePacerStats SDL_GetFramePacerStats_REAL
+#define SDL_DestroyFramePacer SDL_DestroyFramePacer_REAL
+#define SDL_GetMemoryCacheStats SDL_GetMemoryCacheStats_REAL
+#define SDL_CreateArena SDL_CreateArena_REAL
+#define SDL_AllocateArenaMemory SDL_AllocateArenaMemory_REAL
+#define SDL_GetArenaMark SDL_GetArenaMark_REAL
+#define SDL_ResetArenaToMark SDL_ResetArenaToMark_REAL
+#define SDL_ResetArena SDL_ResetArena_REAL
+#define SDL_DestroyArena SDL_DestroyArena_REAL
+#define SDL_IOFromMappedFile SDL_IOFromMappedFile_REAL
+#define SDL_GetIOPointer SDL_GetIOPointer_REAL
+#define SDL_ReadAsyncIOBatch SDL_ReadAsyncIOBatch_REAL
+#define SDL_WriteAsyncIOBatch SDL_WriteAsyncIOBatch_REAL
+#define SDL_OpenPackStorage SDL_OpenPackStorage_REAL
+#define SDL_SetStorageDirectoryCaching SDL_SetStorageDirectoryCaching_REAL
+#define SDL_SaveFileAsync SDL_SaveFileAsync_REAL
+#define SDL_CopyFileWithProgress SDL_CopyFileWithProgress_REAL
+#define SDL_ReadAsyncIOToGPUTransferBuffer SDL_ReadAsyncIOToGPUTransferBuffer_REAL
+#define SDL_GetPropertyKey SDL_GetPropertyKey_REAL
+#define SDL_SetPointerPropertyByKey SDL_SetPointerPropertyByKey_REAL
+#define SDL_SetStringPropertyByKey SDL_SetStringPropertyByKey_REAL
+#define SDL_SetNumberPropertyByKey SDL_SetNumberPropertyByKey_REAL
+#define SDL_SetFloatPropertyByKey SDL_SetFloatPropertyByKey_REAL
+#define SDL_SetBooleanPropertyByKey SDL_SetBooleanPropertyByKey_REAL
+#define SDL_GetPointerPropertyByKey SDL_GetPointerPropertyByKey_REAL
+#define SDL_GetStringPropertyByKey SDL_GetStringPropertyByKey_REAL
+#define SDL_GetNumberPropertyByKey SDL_GetNumberPropertyByKey_REAL
+#define SDL_GetFloatPropertyByKey SDL_GetFloatPropertyByKey_REAL
+#define SDL_GetBooleanPropertyByKey SDL_GetBooleanPropertyByKey_REAL
+#define SDL_SortByKey SDL_SortByKey_REAL
+#define SDL_rand_fill_r SDL_rand_fill_r_REAL
+#define SDL_randf_fill_r SDL_randf_fill_r_REAL
+#define SDL_GetMemoryTagStats SDL_GetMemoryTagStats_REAL
+#define SDL_ResetMemoryTagStats SDL_ResetMemoryTagStats_REAL
+#define SDL_SetTraceCallback SDL_SetTraceCallback_REAL
+#define SDL_BeginGPUCapture SDL_BeginGPUCapture_REAL
+#define SDL_EndGPUCapture SDL_EndGPUCapture_REAL
+#define SDL_SetRenderOutputSourceSize SDL_SetRenderOutputSourceSize_REAL
+#define SDL_SetRenderDynamicResolution SDL_SetRenderDynamicResolution_REAL
+#define SDL_RenderDynamicResolutionUpscale SDL_RenderDynamicResolutionUpscale_REAL
+#define SDL_RenderReadPixelsAsync SDL_RenderReadPixelsAsync_REAL
+#define SDL_IsRenderReadbackReady SDL_IsRenderReadbackReady_REAL
+#define SDL_CollectRenderReadback SDL_CollectRenderReadback_REAL
+#define SDL_CancelRenderReadback SDL_CancelRenderReadback_REAL
+#define SDL_SetRenderTextureMemoryBudget SDL_SetRenderTextureMemoryBudget_REAL
+#define SDL_GetSensorSamples SDL_GetSensorSamples_REAL
+#define SDL_GetGamepadSensorSamples SDL_GetGamepadSensorSamples_REAL
+#define SDL_CreateRenderList SDL_CreateRenderList_REAL
+#define SDL_BeginRenderList SDL_BeginRenderList_REAL
+#define SDL_EndRenderList SDL_EndRenderList_REAL
+#define SDL_ReplayRenderList SDL_ReplayRenderList_REAL
+#define SDL_DestroyRenderList SDL_DestroyRenderList_REAL
+#define SDL_SetAudioStreamTargetLatency SDL_SetAudioStreamTargetLatency_REAL
+#define SDL_GetAudioDeviceFrameTicksNS SDL_GetAudioDeviceFrameTicksNS_REAL
+#define SDL_ScheduleAudioStream SDL_ScheduleAudioStream_REAL
+#define SDL_GetGPUSparseTextureInfo SDL_GetGPUSparseTextureInfo_REAL
+#define SDL_CommitGPUTextureTiles SDL_CommitGPUTextureTiles_REAL
+#define SDL_DecommitGPUTextureTiles SDL_DecommitGPUTextureTiles_REAL
+#define SDL_IsGPUTextureTileCommitted SDL_IsGPUTextureTileCommitted_REAL
+#define SDL_GPUTextureSupportsSparse SDL_GPUTextureSupportsSparse_REAL
+#define SDL_SetGPUShadingRate SDL_SetGPUShadingRate_REAL
+#define SDL_SetGPUShadingRateImage SDL_SetGPUShadingRateImage_REAL
+#define SDL_GPUSupportsShadingRate SDL_GPUSupportsShadingRate_REAL
+#define SDL_GetGPUShadingRateImageTileSize SDL_GetGPUShadingRateImageTileSize_REAL
@@ -1289,3 +1289,129 @@ SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamPlanarData,(SDL_AudioStream *a,const void
 SDL_DYNAPI_PROC(bool,SDL_SetAudioIterationCallbacks,(SDL_AudioDeviceID a,SDL_AudioIterationCallback b,SDL_AudioIterationCallback c,void *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_GetEventDescription,(const SDL_Event *a,char *b,int c),(a,b,c),return)
 SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a,const void *b,int c,SDL_AudioStreamDataCompleteCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_WaitForRenderPresent,(SDL_Renderer *a,Sint32 b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderDirtyRects,(SDL_Renderer *a,const SDL_Rect *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderScrollRect,(SDL_Renderer *a,const SDL_Rect *b,const SDL_Point *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_PushEvents,(const SDL_Event *a,int b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_ShareTextureWithGL,(SDL_Texture *a,Uint32 *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_AcquireTextureForGL,(SDL_Texture *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_ReleaseTextureForGL,(SDL_Texture *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_UnshareTextureWithGL,(SDL_Texture *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_RenderTextureBatch,(SDL_Renderer *a,SDL_Texture *b,const SDL_FRect *c,const SDL_FRect *d,const double *e,const SDL_FColor *f,int g),(a,b,c,d,e,f,g),return)
+SDL_DYNAPI_PROC(bool,SDL_UpdateTextureAsync,(SDL_Texture *a,const SDL_Rect *b,const void *c,int d,SDL_TextureUpdateCompleteCallback e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_GetRenderStats,(SDL_Renderer *a,SDL_RenderStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_GetGPUPipelineCacheData,(SDL_GPUDevice *a,size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUGraphicsPipeline*,SDL_CreateGPUGraphicsPipelineAsync,(SDL_GPUDevice *a,const SDL_GPUGraphicsPipelineCreateInfo *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUPipelineStatus,SDL_GetGPUGraphicsPipelineStatus,(SDL_GPUDevice *a,SDL_GPUGraphicsPipeline *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUQueryPool*,SDL_CreateGPUQueryPool,(SDL_GPUDevice *a,const SDL_GPUQueryPoolCreateInfo *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_WriteGPUTimestamp,(SDL_GPUCommandBuffer *a,SDL_GPUQueryPool *b,Uint32 c),(a,b,c),)
+SDL_DYNAPI_PROC(void,SDL_ReleaseGPUQueryPool,(SDL_GPUDevice *a,SDL_GPUQueryPool *b),(a,b),)
+SDL_DYNAPI_PROC(bool,SDL_GetGPUQueryPoolResults,(SDL_GPUDevice *a,SDL_GPUQueryPool *b,Uint32 c,Uint32 d,Uint64 *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_GPUMemoryInfo*,SDL_GetGPUMemoryInfo,(SDL_GPUDevice *a,int *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUCommandBuffer*,SDL_AcquireGPUCommandBufferForQueue,(SDL_GPUDevice *a,SDL_GPUQueueType b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_AddGPUCommandBufferWaitFence,(SDL_GPUCommandBuffer *a,SDL_GPUFence *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUUploadHeap*,SDL_CreateGPUUploadHeap,(SDL_GPUDevice *a,SDL_PropertiesID b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_UploadGPUTextureData,(SDL_GPUUploadHeap *a,const void *b,Uint32 c,Uint32 d,Uint32 e,const SDL_GPUTextureRegion *f,bool g),(a,b,c,d,e,f,g),return)
+SDL_DYNAPI_PROC(bool,SDL_UploadGPUBufferData,(SDL_GPUUploadHeap *a,const void *b,const SDL_GPUBufferRegion *c,bool d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_FlushGPUUploadHeap,(SDL_GPUUploadHeap *a,SDL_GPUCommandBuffer *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyGPUUploadHeap,(SDL_GPUUploadHeap *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_AddGPUBindlessTexture,(SDL_GPUDevice *a,SDL_GPUTexture *b,Uint32 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_AddGPUBindlessSampler,(SDL_GPUDevice *a,SDL_GPUSampler *b,Uint32 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_AddGPUBindlessBuffer,(SDL_GPUDevice *a,SDL_GPUBuffer *b,Uint32 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_RemoveGPUBindlessTexture,(SDL_GPUDevice *a,Uint32 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_RemoveGPUBindlessSampler,(SDL_GPUDevice *a,Uint32 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_RemoveGPUBindlessBuffer,(SDL_GPUDevice *a,Uint32 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_DrawGPUPrimitivesIndirectCount,(SDL_GPURenderPass *a,SDL_GPUBuffer *b,Uint32 c,SDL_GPUBuffer *d,Uint32 e,Uint32 f),(a,b,c,d,e,f),)
+SDL_DYNAPI_PROC(void,SDL_DrawGPUIndexedPrimitivesIndirectCount,(SDL_GPURenderPass *a,SDL_GPUBuffer *b,Uint32 c,SDL_GPUBuffer *d,Uint32 e,Uint32 f),(a,b,c,d,e,f),)
+SDL_DYNAPI_PROC(void,SDL_BlitGPUTextures,(SDL_GPUCommandBuffer *a,const SDL_GPUBlitInfo *b,Uint32 c),(a,b,c),)
+SDL_DYNAPI_PROC(bool,SDL_SetGPULatencyMarker,(SDL_GPUDevice *a,SDL_Window *b,SDL_GPULatencyMarker c,Uint64 d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_GetGPUPresentStatistics,(SDL_GPUDevice *a,SDL_Window *b,SDL_GPUPresentStatistics *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetAudioDeviceStatistics,(SDL_AudioDeviceID a,SDL_AudioDeviceStatistics *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamWithProperties,(const SDL_AudioSpec *a,const SDL_AudioSpec *b,SDL_PropertiesID c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream_IO,(SDL_IOStream *a,bool b,SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream,(const char *a,SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetJoystickSnapshot,(SDL_Joystick *a,SDL_JoystickSnapshot *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_JobCounter*,SDL_CreateJobCounter,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetJobCounterValue,(SDL_JobCounter *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJob,(SDL_JobFunction a,void *b,SDL_JobCounter *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJobAfter,(SDL_JobCounter *a,SDL_JobFunction b,void *c,SDL_JobCounter *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_RunJobs,(SDL_JobRangeFunction a,void *b,int c),(a,b,c),)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobThreads,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_SetCurrentThreadAffinity,(Uint64 a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetCurrentThreadCoreClass,(SDL_ThreadCoreClass a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_WaitAtomicInt,(SDL_AtomicInt *a,int b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_WakeAtomicInt,(SDL_AtomicInt *a,bool b),(a,b),)
+SDL_DYNAPI_PROC(bool,SDL_SetMutexName,(SDL_Mutex *a,const char *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_MutexStats*,SDL_GetMutexStats,(int *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_ResetMutexStats,(void),(),)
+SDL_DYNAPI_PROC(SDL_FramePacer*,SDL_CreateFramePacer,(int a,int b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFramePacerRate,(SDL_FramePacer *a,int b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFramePacerDisplay,(SDL_FramePacer *a,SDL_DisplayID b),(a,b),return)
+SDL_DYNAPI_PROC(Uint64,SDL_WaitFramePacer,(SDL_FramePacer *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_ResetFramePacer,(SDL_FramePacer *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_GetFramePacerStats,(SDL_FramePacer *a,SDL_FramePacerStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyFramePacer,(SDL_FramePacer *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_GetMemoryCacheStats,(SDL_MemoryCacheStats *a),(a),return)
+SDL_DYNAPI_PROC(SDL_Arena*,SDL_CreateArena,(size_t a, bool b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_AllocateArenaMemory,(SDL_Arena *a, size_t b, size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_ArenaMark,SDL_GetArenaMark,(SDL_Arena *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_ResetArenaToMark,(SDL_Arena *a, SDL_ArenaMark b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_ResetArena,(SDL_Arena *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyArena,(SDL_Arena *a),(a),)
+SDL_DYNAPI_PROC(SDL_IOStream*,SDL_IOFromMappedFile,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const void*,SDL_GetIOPointer,(SDL_IOStream *a, Sint64 b, size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_ReadAsyncIOBatch,(SDL_AsyncIO *a, const SDL_AsyncIORequest *b, int c, SDL_AsyncIOQueue *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_WriteAsyncIOBatch,(SDL_AsyncIO *a, const SDL_AsyncIORequest *b, int c, SDL_AsyncIOQueue *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_Storage*,SDL_OpenPackStorage,(const char *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetStorageDirectoryCaching,(SDL_Storage *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SaveFileAsync,(const char *a,const void *b,size_t c,SDL_AsyncIOQueue *d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_CopyFileWithProgress,(const char *a,const char *b,SDL_CopyFileProgressCallback c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_ReadAsyncIOToGPUTransferBuffer,(SDL_AsyncIO *a,Uint64 b,Uint32 c,SDL_GPUDevice *d,SDL_GPUTransferBuffer *e,Uint32 f,bool g,SDL_AsyncIOQueue *h,void *i),(a,b,c,d,e,f,g,h,i),return)
+SDL_DYNAPI_PROC(SDL_PropertyKey*,SDL_GetPropertyKey,(const char *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetPointerPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetStringPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetNumberPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFloatPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetBooleanPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(void*,SDL_GetPointerPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetStringPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetNumberPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetFloatPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetBooleanPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey *b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SortByKey,(void *a,size_t b,size_t c,size_t d,SDL_SortKeyType e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(void,SDL_rand_fill_r,(Uint64 *a,Uint32 *b,size_t c),(a,b,c),)
+SDL_DYNAPI_PROC(void,SDL_randf_fill_r,(Uint64 *a,float *b,size_t c),(a,b,c),)
+SDL_DYNAPI_PROC(bool,SDL_GetMemoryTagStats,(SDL_MemoryTag a,SDL_MemoryTagStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetMemoryTagStats,(void),(),)
+SDL_DYNAPI_PROC(bool,SDL_SetTraceCallback,(SDL_TraceCallback a, void *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_BeginGPUCapture,(SDL_GPUDevice *a, const char *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_EndGPUCapture,(SDL_GPUDevice *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderOutputSourceSize,(SDL_Renderer *a, int b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderDynamicResolution,(SDL_Renderer *a, float b, Uint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_RenderDynamicResolutionUpscale,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RenderReadback*,SDL_RenderReadPixelsAsync,(SDL_Renderer *a, const SDL_Rect *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_IsRenderReadbackReady,(SDL_RenderReadback *a),(a),return)
+SDL_DYNAPI_PROC(SDL_Surface*,SDL_CollectRenderReadback,(SDL_RenderReadback *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CancelRenderReadback,(SDL_RenderReadback *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderTextureMemoryBudget,(SDL_Renderer *a, Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetSensorSamples,(SDL_Sensor *a, SDL_SensorSample *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetGamepadSensorSamples,(SDL_Gamepad *a, SDL_SensorType b, SDL_SensorSample *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_RenderList*,SDL_CreateRenderList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_BeginRenderList,(SDL_RenderList *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_EndRenderList,(SDL_RenderList *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_ReplayRenderList,(SDL_RenderList *a,float b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRenderList,(SDL_RenderList *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamTargetLatency,(SDL_AudioStream *a,int b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(Uint64,SDL_GetAudioDeviceFrameTicksNS,(SDL_AudioDeviceID a,Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_ScheduleAudioStream,(SDL_AudioStream *a,Uint64 b,Uint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetGPUSparseTextureInfo,(SDL_GPUDevice *a,SDL_GPUTexture *b,SDL_GPUSparseTextureInfo *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_CommitGPUTextureTiles,(SDL_GPUDevice *a,const SDL_GPUTextureRegion *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_DecommitGPUTextureTiles,(SDL_GPUDevice *a,const SDL_GPUTextureRegion *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_IsGPUTextureTileCommitted,(SDL_GPUDevice *a,SDL_GPUTexture *b,Uint32 c,Uint32 d,Uint32 e,Uint32 f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_GPUTextureSupportsSparse,(SDL_GPUDevice *a,SDL_GPUTextureFormat b,SDL_GPUTextureType c,SDL_GPUTextureUsageFlags d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_SetGPUShadingRate,(SDL_GPURenderPass *a,SDL_GPUShadingRate b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_SetGPUShadingRateImage,(SDL_GPUCommandBuffer *a,SDL_GPUTexture *b),(a,b),)
+SDL_DYNAPI_PROC(bool,SDL_GPUSupportsShadingRate,(SDL_GPUDevice *a,SDL_GPUShadingRate b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_GetGPUShadingRateImageTileSize,(SDL_GPUDevice *a),(a),return)
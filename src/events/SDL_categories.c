@@ -50,6 +50,7 @@ SDL_EventCategory SDL_GetEventCategory(Uint32 type)
     case SDL_EVENT_DID_ENTER_FOREGROUND:
     case SDL_EVENT_LOCALE_CHANGED:
     case SDL_EVENT_SYSTEM_THEME_CHANGED:
+    case SDL_EVENT_POWER_STATE_CHANGED:
         return SDL_EVENTCATEGORY_SYSTEM;
 
     case SDL_EVENT_RENDER_TARGETS_RESET:
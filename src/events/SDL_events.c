@@ -64,6 +64,10 @@ SDL_COMPILE_TIME_ASSERT(SDL_Event_type, sizeof(Uint32) == sizeof(SDL_EventType))
 #include <X11/Xlib.h>
 #endif
 
+#ifdef SDL_PLATFORM_WINRT
+#include "../core/winrt/SDL_winrtapp_common.h"
+#endif
+
 typedef struct SDL2_version
 {
     Uint8 major;
@@ -112,27 +116,71 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
+/* Number of queued events of each type, indexed the same way as the disabled
+ * event blocks.  These are only modified with the queue locked, but can be
+ * read without it, which makes presence checks cheap.  Events with types
+ * outside of the 16-bit range aren't tracked here.
+ */
+typedef struct
+{
+    SDL_AtomicInt count;
+    SDL_AtomicInt types[256];
+} SDL_PendingEventBlock;
+
+static SDL_PendingEventBlock *SDL_pending_events[256];
+
+/* Temporary memory is carved out of per-thread arena blocks, with the
+ * tracking node stored right in front of each allocation.  The memory can
+ * travel to another thread along with its event, so each block counts its
+ * live allocations, and is reused by its thread or freed once they're gone.
+ */
+#define SDL_TEMPORARY_MEMORY_BLOCK_SIZE (16 * 1024)
+#define SDL_TEMPORARY_MEMORY_ALIGNMENT  16
+#define SDL_TEMPORARY_MEMORY_ALIGN(x)   (((x) + (SDL_TEMPORARY_MEMORY_ALIGNMENT - 1)) & ~(size_t)(SDL_TEMPORARY_MEMORY_ALIGNMENT - 1))
+
+typedef struct SDL_TemporaryMemoryBlock
+{
+    SDL_AtomicInt refcount; // live allocations, plus one while this is the current block of its thread
+    size_t used;            // only touched by the thread that owns the block
+} SDL_TemporaryMemoryBlock;
+
 typedef struct SDL_TemporaryMemory
 {
     void *memory;
+    size_t size;
+    SDL_TemporaryMemoryBlock *block; // NULL if the allocation didn't fit in a block
     struct SDL_TemporaryMemory *prev;
     struct SDL_TemporaryMemory *next;
 } SDL_TemporaryMemory;
 
+#define SDL_TEMPORARY_MEMORY_BLOCK_HEADER SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemoryBlock))
+#define SDL_TEMPORARY_MEMORY_HEADER       SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemory))
+
 typedef struct SDL_TemporaryMemoryState
 {
     SDL_TemporaryMemory *head;
     SDL_TemporaryMemory *tail;
+    SDL_TemporaryMemoryBlock *block;
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
 
+/* Queued events are also linked into a list for their block of 256 event
+ * types, in the same order as the queue, so looking for a range of types
+ * within one block only visits the matching events.  Events with types
+ * outside of the 16-bit range share a list of their own.
+ */
+#define SDL_EVENT_TYPE_BLOCK_UNTRACKED 256
+#define SDL_EVENT_TYPE_BLOCK_COUNT     257
+
 typedef struct SDL_EventEntry
 {
     SDL_Event event;
     SDL_TemporaryMemory *memory;
     struct SDL_EventEntry *prev;
     struct SDL_EventEntry *next;
+    struct SDL_EventEntry *block_prev;
+    struct SDL_EventEntry *block_next;
 } SDL_EventEntry;
 
 static struct
@@ -144,14 +192,53 @@ static struct
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+    SDL_EventEntry *block_head[SDL_EVENT_TYPE_BLOCK_COUNT];
+    SDL_EventEntry *block_tail[SDL_EVENT_TYPE_BLOCK_COUNT];
+} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL, { NULL }, { NULL } };
+
+/* An optional bounded ring that SDL_PushEvent() can use without taking the
+ * queue lock, see SDL_HINT_EVENT_QUEUE_LOCKFREE.  Any number of threads can
+ * push, and whoever holds the queue lock moves the events into the queue
+ * before looking at it, so everything else keeps working on the list.
+ */
+#define SDL_EVENT_RING_SIZE 1024 // must be a power of two
+
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicInt sequence;
+    SDL_EventEntry entry;
+} SDL_EventRingSlot;
 
+static struct
+{
+    SDL_AtomicInt enqueue_pos;
+    Uint8 padding[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+    SDL_AtomicInt dequeue_pos; // only modified with the queue locked
+    SDL_EventRingSlot *slots;
+} SDL_EventRing;
+
+static void SDL_InitEventRing(void);
+static void SDL_DrainEventRing(void);
+static void SDL_QuitEventRing(void);
+
+
+static void SDL_ReleaseTemporaryMemoryBlock(SDL_TemporaryMemoryBlock *block)
+{
+    if (SDL_AtomicDecRef(&block->refcount)) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_TEMPORARY_MEMORY_BLOCK_HEADER + SDL_TEMPORARY_MEMORY_BLOCK_SIZE);
+        SDL_free(block);
+    }
+}
 
 static void SDL_CleanupTemporaryMemory(void *data)
 {
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    if (state->block) {
+        // Events still in flight may be holding on to it
+        SDL_ReleaseTemporaryMemoryBlock(state->block);
+    }
     SDL_free(state);
 }
 
@@ -178,6 +265,59 @@ static SDL_TemporaryMemoryState *SDL_GetTemporaryMemoryState(bool create)
     return state;
 }
 
+static SDL_TemporaryMemory *SDL_CreateTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, size_t size)
+{
+    SDL_TemporaryMemoryBlock *block = state->block;
+    SDL_TemporaryMemory *entry;
+    size_t needed;
+
+    if (size > SDL_SIZE_MAX - SDL_TEMPORARY_MEMORY_HEADER - SDL_TEMPORARY_MEMORY_ALIGNMENT) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    needed = SDL_TEMPORARY_MEMORY_ALIGN(SDL_TEMPORARY_MEMORY_HEADER + size);
+
+    if (needed > SDL_TEMPORARY_MEMORY_BLOCK_SIZE / 4) {
+        // Large allocations get their own memory so they don't waste a block
+        entry = (SDL_TemporaryMemory *)SDL_malloc(SDL_TEMPORARY_MEMORY_HEADER + size);
+        if (!entry) {
+            return NULL;
+        }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_TEMPORARY_MEMORY_HEADER + size);
+        entry->block = NULL;
+    } else {
+        if (block && SDL_GetAtomicInt(&block->refcount) == 1) {
+            // Everything handed out from this block has been released, start over
+            block->used = 0;
+        }
+        if (!block || block->used + needed > SDL_TEMPORARY_MEMORY_BLOCK_SIZE) {
+            block = (SDL_TemporaryMemoryBlock *)SDL_malloc(SDL_TEMPORARY_MEMORY_BLOCK_HEADER + SDL_TEMPORARY_MEMORY_BLOCK_SIZE);
+            if (!block) {
+                return NULL;
+            }
+            SDL_AddTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_TEMPORARY_MEMORY_BLOCK_HEADER + SDL_TEMPORARY_MEMORY_BLOCK_SIZE);
+            SDL_SetAtomicInt(&block->refcount, 1);
+            block->used = 0;
+
+            if (state->block) {
+                SDL_ReleaseTemporaryMemoryBlock(state->block);
+            }
+            state->block = block;
+        }
+
+        entry = (SDL_TemporaryMemory *)((Uint8 *)block + SDL_TEMPORARY_MEMORY_BLOCK_HEADER + block->used);
+        block->used += needed;
+        SDL_AtomicIncRef(&block->refcount);
+        entry->block = block;
+    }
+
+    entry->memory = (Uint8 *)entry + SDL_TEMPORARY_MEMORY_HEADER;
+    entry->size = size;
+    entry->prev = NULL;
+    entry->next = NULL;
+    return entry;
+}
+
 static SDL_TemporaryMemory *SDL_GetTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, const void *mem)
 {
     SDL_TemporaryMemory *entry;
@@ -224,12 +364,14 @@ static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_
     entry->next = NULL;
 }
 
-static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
+static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemory *entry)
 {
-    if (free_data) {
-        SDL_free(entry->memory);
+    if (entry->block) {
+        SDL_ReleaseTemporaryMemoryBlock(entry->block);
+    } else {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_TEMPORARY_MEMORY_HEADER + entry->size);
+        SDL_free(entry);
     }
-    SDL_free(entry);
 }
 
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
@@ -316,43 +458,35 @@ static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
     event->memory = NULL;
 }
 
-static void *SDL_FreeLater(void *memory)
+void *SDL_AllocateTemporaryMemory(size_t size)
 {
     SDL_TemporaryMemoryState *state;
-
-    if (memory == NULL) {
-        return NULL;
-    }
-
-    // Make sure we're not adding this to the list twice
-    //SDL_assert(!SDL_ClaimTemporaryMemory(memory));
+    SDL_TemporaryMemory *entry;
 
     state = SDL_GetTemporaryMemoryState(true);
     if (!state) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed.
+        return NULL;
     }
 
-    SDL_TemporaryMemory *entry = (SDL_TemporaryMemory *)SDL_malloc(sizeof(*entry));
+    entry = SDL_CreateTemporaryMemoryEntry(state, size);
     if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
+        return NULL;
     }
 
-    entry->memory = memory;
-
     SDL_LinkTemporaryMemoryEntry(state, entry);
 
-    return memory;
-}
-
-void *SDL_AllocateTemporaryMemory(size_t size)
-{
-    return SDL_FreeLater(SDL_malloc(size));
+    return entry->memory;
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
+        size_t len = SDL_strlen(string) + 1;
+        char *mem = (char *)SDL_AllocateTemporaryMemory(len);
+        if (mem) {
+            SDL_memcpy(mem, string, len);
+        }
+        return mem;
     }
     return NULL;
 }
@@ -365,9 +499,14 @@ void *SDL_ClaimTemporaryMemory(const void *mem)
     if (state && mem) {
         SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
         if (entry) {
-            SDL_UnlinkTemporaryMemoryEntry(state, entry);
-            SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
+            // The memory lives in an arena block, so the caller gets a copy it can free
+            void *claimed = SDL_malloc(entry->size);
+            if (claimed) {
+                SDL_memcpy(claimed, mem, entry->size);
+                SDL_UnlinkTemporaryMemoryEntry(state, entry);
+                SDL_FreeTemporaryMemoryEntry(entry);
+            }
+            return claimed;
         }
     }
     return NULL;
@@ -386,7 +525,7 @@ void SDL_FreeTemporaryMemory(void)
         SDL_TemporaryMemory *entry = state->head;
 
         SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        SDL_FreeTemporaryMemoryEntry(state, entry, true);
+        SDL_FreeTemporaryMemoryEntry(entry);
     }
 }
 
@@ -489,6 +628,8 @@ int SDL_GetEventDescription(const SDL_Event *event, char *buf, int buflen)
         break;
         SDL_EVENT_CASE(SDL_EVENT_SYSTEM_THEME_CHANGED)
         break;
+        SDL_EVENT_CASE(SDL_EVENT_POWER_STATE_CHANGED)
+        break;
         SDL_EVENT_CASE(SDL_EVENT_KEYMAP_CHANGED)
         break;
         SDL_EVENT_CASE(SDL_EVENT_CLIPBOARD_UPDATE)
@@ -923,6 +1064,9 @@ void SDL_StopEventLoop(void)
 
     SDL_EventQ.active = false;
 
+    SDL_DrainEventRing();
+    SDL_QuitEventRing();
+
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
                 SDL_EventQ.max_events_seen);
@@ -932,11 +1076,13 @@ void SDL_StopEventLoop(void)
     for (entry = SDL_EventQ.head; entry;) {
         SDL_EventEntry *next = entry->next;
         SDL_TransferTemporaryMemoryFromEvent(entry);
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_EVENTS, sizeof(*entry));
         SDL_free(entry);
         entry = next;
     }
     for (entry = SDL_EventQ.free; entry;) {
         SDL_EventEntry *next = entry->next;
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_EVENTS, sizeof(*entry));
         SDL_free(entry);
         entry = next;
     }
@@ -946,6 +1092,8 @@ void SDL_StopEventLoop(void)
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
+    SDL_zeroa(SDL_EventQ.block_head);
+    SDL_zeroa(SDL_EventQ.block_tail);
     SDL_SetAtomicInt(&SDL_sentinel_pending, 0);
 
     // Clear disabled event state
@@ -954,6 +1102,12 @@ void SDL_StopEventLoop(void)
         SDL_disabled_events[i] = NULL;
     }
 
+    // Clear pending event state
+    for (i = 0; i < SDL_arraysize(SDL_pending_events); ++i) {
+        SDL_free(SDL_pending_events[i]);
+        SDL_pending_events[i] = NULL;
+    }
+
     SDL_QuitEventWatchList(&SDL_event_watchers);
     SDL_QuitWindowEventWatch();
 
@@ -986,6 +1140,7 @@ bool SDL_StartEventLoop(void)
         if (SDL_EventQ.lock == NULL) {
             return false;
         }
+        SDL_SetMutexName(SDL_EventQ.lock, "SDL_EventQ.lock");
     }
     SDL_LockMutex(SDL_EventQ.lock);
 
@@ -997,6 +1152,8 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
+    SDL_InitEventRing();
+
     SDL_EventQ.active = true;
 
 #ifndef SDL_THREADS_DISABLED
@@ -1005,10 +1162,42 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
+static int SDL_GetEventTypeBlock(Uint32 type)
+{
+    if (type > SDL_EVENT_LAST) {
+        return SDL_EVENT_TYPE_BLOCK_UNTRACKED;
+    }
+    return (int)(type >> 8);
+}
+
+/* Get the first queued event to look at for a range of types -- called with the queue locked
+ * If only one type block in the range has events, the walk follows that block's list,
+ * otherwise it follows the whole queue so events stay in order.
+ */
+static SDL_EventEntry *SDL_GetFirstEventInRange(Uint32 minType, Uint32 maxType, bool *by_block)
+{
+    const int first = SDL_GetEventTypeBlock(minType);
+    const int last = SDL_GetEventTypeBlock(maxType);
+    SDL_EventEntry *found = NULL;
+
+    *by_block = true;
+    for (int block = first; block <= last; ++block) {
+        if (SDL_EventQ.block_head[block]) {
+            if (found) {
+                *by_block = false;
+                return SDL_EventQ.head;
+            }
+            found = SDL_EventQ.block_head[block];
+        }
+    }
+    return found;
+}
+
 // Add an event to the event queue -- called with the queue locked
-static int SDL_AddEvent(SDL_Event *event)
+static int SDL_AddEventInternal(SDL_Event *event, SDL_TemporaryMemory *memory, bool from_ring)
 {
     SDL_EventEntry *entry;
+    SDL_PendingEventBlock *pending = NULL;
     const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
     int final_count;
 
@@ -1017,11 +1206,25 @@ static int SDL_AddEvent(SDL_Event *event)
         return 0;
     }
 
+    if (event->type <= SDL_EVENT_LAST) {
+        const Uint8 hi = ((event->type >> 8) & 0xff);
+
+        pending = SDL_pending_events[hi];
+        if (pending == NULL) {
+            pending = (SDL_PendingEventBlock *)SDL_calloc(1, sizeof(*pending));
+            if (pending == NULL) {
+                return 0;
+            }
+            SDL_pending_events[hi] = pending;
+        }
+    }
+
     if (SDL_EventQ.free == NULL) {
         entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
         if (entry == NULL) {
             return 0;
         }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_EVENTS, sizeof(*entry));
     } else {
         entry = SDL_EventQ.free;
         SDL_EventQ.free = entry->next;
@@ -1032,11 +1235,16 @@ static int SDL_AddEvent(SDL_Event *event)
     }
 
     SDL_copyp(&entry->event, event);
-    if (event->type == SDL_EVENT_POLL_SENTINEL) {
-        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+    if (from_ring) {
+        // The sentinel was counted when it was pushed, and the memory was transferred then too
+        entry->memory = memory;
+    } else {
+        if (event->type == SDL_EVENT_POLL_SENTINEL) {
+            SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+        }
+        entry->memory = NULL;
+        SDL_TransferTemporaryMemoryToEvent(entry);
     }
-    entry->memory = NULL;
-    SDL_TransferTemporaryMemoryToEvent(entry);
 
     if (SDL_EventQ.tail) {
         SDL_EventQ.tail->next = entry;
@@ -1051,6 +1259,24 @@ static int SDL_AddEvent(SDL_Event *event)
         entry->next = NULL;
     }
 
+    {
+        const int block = SDL_GetEventTypeBlock(event->type);
+
+        entry->block_prev = SDL_EventQ.block_tail[block];
+        entry->block_next = NULL;
+        if (entry->block_prev) {
+            entry->block_prev->block_next = entry;
+        } else {
+            SDL_EventQ.block_head[block] = entry;
+        }
+        SDL_EventQ.block_tail[block] = entry;
+    }
+
+    if (pending) {
+        SDL_AddAtomicInt(&pending->types[event->type & 0xff], 1);
+        SDL_AddAtomicInt(&pending->count, 1);
+    }
+
     final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
     if (final_count > SDL_EventQ.max_events_seen) {
         SDL_EventQ.max_events_seen = final_count;
@@ -1061,6 +1287,116 @@ static int SDL_AddEvent(SDL_Event *event)
     return 1;
 }
 
+static int SDL_AddEvent(SDL_Event *event)
+{
+    return SDL_AddEventInternal(event, NULL, false);
+}
+
+// Add an event to the lock-free ring, returns false if it's full
+static bool SDL_PushEventRing(SDL_Event *event)
+{
+    SDL_EventRingSlot *slot;
+    const Uint32 mask = SDL_EVENT_RING_SIZE - 1;
+    Uint32 pos = (Uint32)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+
+    for (;;) {
+        slot = &SDL_EventRing.slots[pos & mask];
+        const Sint32 diff = (Sint32)((Uint32)SDL_GetAtomicInt(&slot->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicInt(&SDL_EventRing.enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+            pos = (Uint32)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = (Uint32)SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+        }
+    }
+
+    // The slot is ours until the sequence number is published
+    SDL_copyp(&slot->entry.event, event);
+    if (event->type == SDL_EVENT_POLL_SENTINEL) {
+        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+    }
+    slot->entry.memory = NULL;
+    SDL_TransferTemporaryMemoryToEvent(&slot->entry);
+
+    SDL_SetAtomicInt(&slot->sequence, (int)(pos + 1));
+    return true;
+}
+
+static bool SDL_EventRingPending(void)
+{
+    return SDL_EventRing.slots &&
+           SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos) != SDL_GetAtomicInt(&SDL_EventRing.dequeue_pos);
+}
+
+// Move events from the lock-free ring to the event queue -- called with the queue locked
+static void SDL_DrainEventRing(void)
+{
+    const Uint32 mask = SDL_EVENT_RING_SIZE - 1;
+
+    if (!SDL_EventRing.slots) {
+        return;
+    }
+
+    for (;;) {
+        const Uint32 pos = (Uint32)SDL_GetAtomicInt(&SDL_EventRing.dequeue_pos);
+        SDL_EventRingSlot *slot = &SDL_EventRing.slots[pos & mask];
+        const Sint32 diff = (Sint32)((Uint32)SDL_GetAtomicInt(&slot->sequence) - (pos + 1));
+        if (diff < 0) {
+            break; // empty, or the next event hasn't been published yet
+        }
+
+        if (!SDL_AddEventInternal(&slot->entry.event, slot->entry.memory, true)) {
+            // The event was dropped, release anything it was holding on to
+            if (slot->entry.event.type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            }
+            SDL_TransferTemporaryMemoryFromEvent(&slot->entry);
+        }
+        slot->entry.memory = NULL;
+
+        SDL_SetAtomicInt(&SDL_EventRing.dequeue_pos, (int)(pos + 1));
+        SDL_SetAtomicInt(&slot->sequence, (int)(pos + mask + 1));
+    }
+}
+
+static void SDL_InitEventRing(void)
+{
+    if (SDL_EventRing.slots || !SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, false)) {
+        return;
+    }
+
+    SDL_EventRingSlot *slots = (SDL_EventRingSlot *)SDL_aligned_alloc(SDL_CACHELINE_SIZE, SDL_EVENT_RING_SIZE * sizeof(*slots));
+    if (!slots) {
+        return; // we'll just use the locked queue
+    }
+    SDL_AddTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_EVENT_RING_SIZE * sizeof(*slots));
+    for (int i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_SetAtomicInt(&slots[i].sequence, i);
+        slots[i].entry.memory = NULL;
+    }
+    SDL_SetAtomicInt(&SDL_EventRing.enqueue_pos, 0);
+    SDL_SetAtomicInt(&SDL_EventRing.dequeue_pos, 0);
+    SDL_EventRing.slots = slots;
+}
+
+static void SDL_QuitEventRing(void)
+{
+    SDL_EventRingSlot *slots = SDL_EventRing.slots;
+
+    if (!slots) {
+        return;
+    }
+
+    // Anything still in the ring was already moved to the queue and cleaned up with it
+    SDL_EventRing.slots = NULL;
+    SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_EVENTS, SDL_EVENT_RING_SIZE * sizeof(*slots));
+    SDL_aligned_free(slots);
+}
+
 // Remove an event from the queue -- called with the queue locked
 static void SDL_CutEvent(SDL_EventEntry *entry)
 {
@@ -1082,10 +1418,34 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
         SDL_EventQ.tail = entry->prev;
     }
 
+    {
+        const int block = SDL_GetEventTypeBlock(entry->event.type);
+
+        if (entry->block_prev) {
+            entry->block_prev->block_next = entry->block_next;
+        } else {
+            SDL_assert(entry == SDL_EventQ.block_head[block]);
+            SDL_EventQ.block_head[block] = entry->block_next;
+        }
+        if (entry->block_next) {
+            entry->block_next->block_prev = entry->block_prev;
+        } else {
+            SDL_assert(entry == SDL_EventQ.block_tail[block]);
+            SDL_EventQ.block_tail[block] = entry->block_prev;
+        }
+    }
+
     if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
     }
 
+    if (entry->event.type <= SDL_EVENT_LAST) {
+        SDL_PendingEventBlock *pending = SDL_pending_events[(entry->event.type >> 8) & 0xff];
+        SDL_assert(pending != NULL);
+        SDL_AddAtomicInt(&pending->types[entry->event.type & 0xff], -1);
+        SDL_AddAtomicInt(&pending->count, -1);
+    }
+
     entry->next = SDL_EventQ.free;
     SDL_EventQ.free = entry;
     SDL_assert(SDL_GetAtomicInt(&SDL_EventQ.count) > 0);
@@ -1119,6 +1479,19 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
     // Lock the event queue
     used = 0;
 
+    // Adding events doesn't need the lock, unless the ring is full
+    if (action == SDL_ADDEVENT && events && SDL_EventRing.slots && SDL_EventQ.active) {
+        while (used < numevents && SDL_PushEventRing(&events[used])) {
+            ++used;
+        }
+        if (used == numevents) {
+            if (used > 0) {
+                SDL_SendWakeupEvent();
+            }
+            return used;
+        }
+    }
+
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
@@ -1130,20 +1503,25 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
+
+        // Keep the ring's events ahead of anything we do here
+        SDL_DrainEventRing();
+
         if (action == SDL_ADDEVENT) {
             if (!events) {
                 SDL_UnlockMutex(SDL_EventQ.lock);
                 return SDL_InvalidParamError("events");
             }
-            for (i = 0; i < numevents; ++i) {
+            for (i = used; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
         } else {
             SDL_EventEntry *entry, *next;
             Uint32 type;
+            bool by_block;
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
+            for (entry = SDL_GetFirstEventInRange(minType, maxType, &by_block); entry && (events == NULL || used < numevents); entry = next) {
+                next = by_block ? entry->block_next : entry->next;
                 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
                     if (events) {
@@ -1191,14 +1569,15 @@ bool SDL_HasEvent(Uint32 type)
     return SDL_HasEvents(type, type);
 }
 
-bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
+static bool SDL_HasUntrackedEvents(Uint32 minType, Uint32 maxType)
 {
     bool found = false;
 
     SDL_LockMutex(SDL_EventQ.lock);
     {
         if (SDL_EventQ.active) {
-            for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
+            SDL_DrainEventRing();
+            for (SDL_EventEntry *entry = SDL_EventQ.block_head[SDL_EVENT_TYPE_BLOCK_UNTRACKED]; entry; entry = entry->block_next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
                     found = true;
@@ -1212,6 +1591,52 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
     return found;
 }
 
+bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
+{
+    Uint32 hi, lo, first, last;
+
+    if (!SDL_EventQ.active || minType > maxType) {
+        return false;
+    }
+
+    // Events in the lock-free ring aren't counted until they reach the queue
+    if (SDL_EventRingPending()) {
+        SDL_LockMutex(SDL_EventQ.lock);
+        SDL_DrainEventRing();
+        SDL_UnlockMutex(SDL_EventQ.lock);
+    }
+
+    // Types outside of the 16-bit range aren't counted, walk the queue for those
+    if (maxType > SDL_EVENT_LAST) {
+        if (SDL_HasUntrackedEvents(SDL_max(minType, (Uint32)SDL_EVENT_LAST + 1), maxType)) {
+            return true;
+        }
+        if (minType > SDL_EVENT_LAST) {
+            return false;
+        }
+        maxType = SDL_EVENT_LAST;
+    }
+
+    for (hi = (minType >> 8); hi <= (maxType >> 8); ++hi) {
+        SDL_PendingEventBlock *pending = SDL_pending_events[hi];
+        if (!pending || SDL_GetAtomicInt(&pending->count) == 0) {
+            continue;
+        }
+
+        first = (hi == (minType >> 8)) ? (minType & 0xff) : 0;
+        last = (hi == (maxType >> 8)) ? (maxType & 0xff) : 0xff;
+        if (first == 0 && last == 0xff) {
+            return true;
+        }
+        for (lo = first; lo <= last; ++lo) {
+            if (SDL_GetAtomicInt(&pending->types[lo]) > 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void SDL_FlushEvent(Uint32 type)
 {
     SDL_FlushEvents(type, type);
@@ -1221,6 +1646,7 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 {
     SDL_EventEntry *entry, *next;
     Uint32 type;
+    bool by_block;
 
     // Make sure the events are current
 #if 0
@@ -1238,8 +1664,9 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
+        SDL_DrainEventRing();
+        for (entry = SDL_GetFirstEventInRange(minType, maxType, &by_block); entry; entry = next) {
+            next = by_block ? entry->block_next : entry->next;
             type = entry->event.type;
             if (minType <= type && type <= maxType) {
                 SDL_CutEvent(entry);
@@ -1338,7 +1765,7 @@ static void SDL_QuitMainThreadCallbacks(void)
     SDL_main_callbacks_lock = NULL;
 }
 
-static void SDL_RunMainThreadCallbacks(void)
+void SDL_RunMainThreadCallbacks(void)
 {
     SDL_MainThreadCallbackEntry *entry;
 
@@ -1392,8 +1819,15 @@ bool SDL_RunOnMainThread(SDL_MainThreadCallback callback, void *userdata, bool w
     }
     SDL_UnlockMutex(SDL_main_callbacks_lock);
 
+#ifdef SDL_PLATFORM_WINRT
+    // Run the callbacks as soon as the UI thread gets to its dispatcher, which also wakes it up
+    if (!WINRT_DispatchMainThreadCallbacks()) {
+        SDL_SendWakeupEvent();
+    }
+#else
     // If the main thread is waiting for events, wake it up
     SDL_SendWakeupEvent();
+#endif
 
     if (!wait_complete) {
         // Queued for execution, wait not requested
@@ -1453,6 +1887,8 @@ void SDL_PumpEventMaintenance(void)
 // Run the system dependent event loops
 static void SDL_PumpEventsInternal(bool push_sentinel)
 {
+    SDL_TRACE_ZONE_BEGIN(zone, "SDL_PumpEvents");
+
     // Free any temporary memory from old events
     SDL_FreeTemporaryMemory();
 
@@ -1462,6 +1898,9 @@ static void SDL_PumpEventsInternal(bool push_sentinel)
     // Run any pending main thread callbacks
     SDL_RunMainThreadCallbacks();
 
+    // Move the event clock forward before anything is stamped
+    SDL_UpdateEventTicks();
+
 #ifdef SDL_PLATFORM_ANDROID
     // Android event processing is independent of the video subsystem
     Android_PumpEvents(0);
@@ -1487,6 +1926,8 @@ static void SDL_PumpEventsInternal(bool push_sentinel)
         sentinel.common.timestamp = 0;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_ZONE_END(zone);
 }
 
 void SDL_PumpEvents(void)
@@ -1738,7 +2179,7 @@ static bool SDL_CallEventWatchers(SDL_Event *event)
 bool SDL_PushEvent(SDL_Event *event)
 {
     if (!event->common.timestamp) {
-        event->common.timestamp = SDL_GetTicksNS();
+        event->common.timestamp = SDL_GetEventTicksNS();
     }
 
     if (!SDL_CallEventWatchers(event)) {
@@ -1753,18 +2194,162 @@ bool SDL_PushEvent(SDL_Event *event)
     return true;
 }
 
+// Merge a mouse motion event into a matching one at the tail of the queue, or push it normally
+bool SDL_PushCoalescedMouseMotionEvent(SDL_Event *event)
+{
+    bool coalesced = false;
+
+    if (!event->common.timestamp) {
+        event->common.timestamp = SDL_GetEventTicksNS();
+    }
+
+    // Watchers see every motion, so they can keep the full rate history
+    if (!SDL_CallEventWatchers(event)) {
+        SDL_ClearError();
+        return false;
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (SDL_EventQ.active) {
+            SDL_EventEntry *tail;
+
+            SDL_DrainEventRing();
+
+            tail = SDL_EventQ.tail;
+            if (tail && tail->event.type == SDL_EVENT_MOUSE_MOTION &&
+                tail->event.motion.which == event->motion.which &&
+                tail->event.motion.windowID == event->motion.windowID &&
+                tail->event.motion.state == event->motion.state) {
+                SDL_MouseMotionEvent *motion = &tail->event.motion;
+
+                motion->timestamp = event->motion.timestamp;
+                motion->x = event->motion.x;
+                motion->y = event->motion.y;
+                motion->xrel += event->motion.xrel;
+                motion->yrel += event->motion.yrel;
+                coalesced = true;
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    if (!coalesced) {
+        return SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) > 0;
+    }
+
+    SDL_SendWakeupEvent();
+    return true;
+}
+
+// Merge a finger motion event into an earlier one for the same finger, or push it normally
+bool SDL_PushCoalescedFingerMotionEvent(SDL_Event *event)
+{
+    bool coalesced = false;
+
+    if (!event->common.timestamp) {
+        event->common.timestamp = SDL_GetEventTicksNS();
+    }
+
+    if (!SDL_CallEventWatchers(event)) {
+        SDL_ClearError();
+        return false;
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (SDL_EventQ.active) {
+            SDL_EventEntry *entry;
+
+            SDL_DrainEventRing();
+
+            // Only look back through the motion of other fingers on the same device
+            for (entry = SDL_EventQ.tail; entry; entry = entry->prev) {
+                SDL_TouchFingerEvent *tfinger = &entry->event.tfinger;
+
+                if (entry->event.type != SDL_EVENT_FINGER_MOTION ||
+                    tfinger->touchID != event->tfinger.touchID) {
+                    break;
+                }
+                if (tfinger->fingerID == event->tfinger.fingerID) {
+                    if (tfinger->windowID == event->tfinger.windowID) {
+                        tfinger->timestamp = event->tfinger.timestamp;
+                        tfinger->x = event->tfinger.x;
+                        tfinger->y = event->tfinger.y;
+                        tfinger->dx += event->tfinger.dx;
+                        tfinger->dy += event->tfinger.dy;
+                        tfinger->pressure = event->tfinger.pressure;
+                        coalesced = true;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    if (!coalesced) {
+        return SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) > 0;
+    }
+
+    SDL_SendWakeupEvent();
+    return true;
+}
+
+int SDL_PushEvents(const SDL_Event *events, int count)
+{
+    SDL_Event *copy;
+    bool isstack;
+    int i, used;
+
+    if (!events) {
+        SDL_InvalidParamError("events");
+        return -1;
+    }
+    if (count < 0) {
+        SDL_InvalidParamError("count");
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    copy = SDL_small_alloc(SDL_Event, count, &isstack);
+    if (!copy) {
+        return -1;
+    }
+
+    const Uint64 now = SDL_GetEventTicksNS();
+    for (i = 0; i < count; ++i) {
+        SDL_copyp(&copy[i], &events[i]);
+        if (!copy[i].common.timestamp) {
+            copy[i].common.timestamp = now;
+        }
+    }
+
+    // Filtered events are dropped and the rest are added with the queue locked once
+    used = SDL_DispatchEventWatchListEvents(&SDL_event_watchers, copy, count);
+    if (used > 0) {
+        used = SDL_PeepEvents(copy, used, SDL_ADDEVENT, 0, 0);
+    }
+
+    SDL_small_free(copy, isstack);
+
+    return used;
+}
+
 void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
 {
     SDL_EventEntry *event, *next;
     SDL_LockMutex(SDL_event_watchers.lock);
     {
         // Set filter and discard pending events
-        SDL_event_watchers.filter.callback = filter;
-        SDL_event_watchers.filter.userdata = userdata;
+        SDL_SetEventWatchListFilter(&SDL_event_watchers, filter, userdata);
         if (filter) {
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing();
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1812,6 +2397,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1950,6 +2536,11 @@ void SDL_SendSystemThemeChangedEvent(void)
     SDL_SendAppEvent(SDL_EVENT_SYSTEM_THEME_CHANGED);
 }
 
+void SDL_SendPowerStateChangedEvent(void)
+{
+    SDL_SendAppEvent(SDL_EVENT_POWER_STATE_CHANGED);
+}
+
 bool SDL_InitEvents(void)
 {
 #ifdef SDL_PLATFORM_ANDROID
@@ -45,6 +45,7 @@ extern void SDL_SendAppEvent(SDL_EventType eventType);
 extern void SDL_SendKeymapChangedEvent(void);
 extern void SDL_SendLocaleChangedEvent(void);
 extern void SDL_SendSystemThemeChangedEvent(void);
+extern void SDL_SendPowerStateChangedEvent(void);
 
 extern void *SDL_AllocateTemporaryMemory(size_t size);
 extern const char *SDL_CreateTemporaryString(const char *string);
@@ -52,8 +53,11 @@ extern void *SDL_ClaimTemporaryMemory(const void *mem);
 extern void SDL_FreeTemporaryMemory(void);
 
 extern void SDL_PumpEventMaintenance(void);
+extern void SDL_RunMainThreadCallbacks(void);
 
 extern void SDL_SendQuit(void);
+extern bool SDL_PushCoalescedMouseMotionEvent(SDL_Event *event);
+extern bool SDL_PushCoalescedFingerMotionEvent(SDL_Event *event);
 
 extern bool SDL_InitEvents(void);
 extern void SDL_QuitEvents(void);
@@ -23,6 +23,13 @@
 #include "SDL_eventwatch_c.h"
 
 
+/* Dispatching doesn't take the lock: the current array is picked up with an
+ * atomic load, and arrays replaced while a dispatch may still be using them
+ * are only freed once no dispatch is in progress.  Removing a watcher also
+ * flags it in the array it came from, so it isn't called once removed, even
+ * from one of its own callbacks.
+ */
+
 bool SDL_InitEventWatchList(SDL_EventWatchList *list)
 {
     if (list->lock == NULL) {
@@ -34,84 +41,210 @@ bool SDL_InitEventWatchList(SDL_EventWatchList *list)
     return true;
 }
 
+static void SDL_FreeEventWatchArrays(SDL_EventWatchArray *array)
+{
+    while (array) {
+        SDL_EventWatchArray *next = array->next_retired;
+        SDL_free(array);
+        array = next;
+    }
+}
+
 void SDL_QuitEventWatchList(SDL_EventWatchList *list)
 {
     if (list->lock) {
         SDL_DestroyMutex(list->lock);
         list->lock = NULL;
     }
-    if (list->watchers) {
-        SDL_free(list->watchers);
-        list->watchers = NULL;
-        list->count = 0;
-    }
+    SDL_FreeEventWatchArrays((SDL_EventWatchArray *)SDL_SetAtomicPointer(&list->current, NULL));
+    SDL_FreeEventWatchArrays((SDL_EventWatchArray *)SDL_SetAtomicPointer(&list->retired, NULL));
     SDL_zero(list->filter);
 }
 
+// Called with the list locked
+static void SDL_ReclaimEventWatchArrays(SDL_EventWatchList *list)
+{
+    // Any dispatch starting after this point will see the current array
+    if (SDL_GetAtomicInt(&list->dispatching) == 0) {
+        SDL_FreeEventWatchArrays((SDL_EventWatchArray *)SDL_SetAtomicPointer(&list->retired, NULL));
+    }
+}
+
+// Called with the list locked
+static bool SDL_PublishEventWatchArray(SDL_EventWatchList *list, const SDL_EventWatcher *added)
+{
+    SDL_EventWatchArray *old = (SDL_EventWatchArray *)SDL_GetAtomicPointer(&list->current);
+    SDL_EventWatchArray *array = NULL;
+    int i, count = 0;
+
+    if (old) {
+        for (i = 0; i < old->count; ++i) {
+            if (!SDL_GetAtomicInt(&old->watchers[i].removed)) {
+                ++count;
+            }
+        }
+    }
+    if (added) {
+        ++count;
+    }
+
+    if (list->filter.callback || count > 0) {
+        array = (SDL_EventWatchArray *)SDL_malloc(sizeof(*array) + count * sizeof(array->watchers[0]));
+        if (!array) {
+            return false;
+        }
+        array->filter = list->filter;
+        array->next_retired = NULL;
+        array->count = 0;
+
+        if (old) {
+            for (i = 0; i < old->count; ++i) {
+                if (!SDL_GetAtomicInt(&old->watchers[i].removed)) {
+                    SDL_EventWatcher *watcher = &array->watchers[array->count++];
+                    watcher->callback = old->watchers[i].callback;
+                    watcher->userdata = old->watchers[i].userdata;
+                    SDL_SetAtomicInt(&watcher->removed, 0);
+                }
+            }
+        }
+        if (added) {
+            SDL_EventWatcher *watcher = &array->watchers[array->count++];
+            watcher->callback = added->callback;
+            watcher->userdata = added->userdata;
+            SDL_SetAtomicInt(&watcher->removed, 0);
+        }
+    }
+
+    SDL_SetAtomicPointer(&list->current, array);
+
+    if (old) {
+        old->next_retired = (SDL_EventWatchArray *)SDL_GetAtomicPointer(&list->retired);
+        SDL_SetAtomicPointer(&list->retired, old);
+    }
+    SDL_ReclaimEventWatchArrays(list);
+
+    return true;
+}
+
+static SDL_EventWatchArray *SDL_BeginEventWatchDispatch(SDL_EventWatchList *list)
+{
+    SDL_EventWatchArray *array;
+
+    SDL_AddAtomicInt(&list->dispatching, 1);
+    array = (SDL_EventWatchArray *)SDL_GetAtomicPointer(&list->current);
+    return array;
+}
+
+static void SDL_EndEventWatchDispatch(SDL_EventWatchList *list)
+{
+    if (SDL_AtomicDecRef(&list->dispatching) && SDL_GetAtomicPointer(&list->retired)) {
+        // Don't wait for the lock, whoever holds it will clean up
+        if (SDL_TryLockMutex(list->lock)) {
+            SDL_ReclaimEventWatchArrays(list);
+            SDL_UnlockMutex(list->lock);
+        }
+    }
+}
+
+static void SDL_CallEventWatchArray(SDL_EventWatchArray *array, SDL_Event *event)
+{
+    int i;
+
+    for (i = 0; i < array->count; ++i) {
+        SDL_EventWatcher *watcher = &array->watchers[i];
+        if (!SDL_GetAtomicInt(&watcher->removed)) {
+            watcher->callback(watcher->userdata, event);
+        }
+    }
+}
+
 bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event)
 {
-    SDL_EventWatcher *filter = &list->filter;
+    SDL_EventWatchArray *array;
+    bool result = true;
 
-    if (!filter->callback && list->count == 0) {
+    if (!SDL_GetAtomicPointer(&list->current)) {
         return true;
     }
 
-    SDL_LockMutex(list->lock);
-    {
-        // Make sure we only dispatch the current watcher list
-        int i, count = list->count;
+    array = SDL_BeginEventWatchDispatch(list);
+    if (array) {
+        SDL_EventWatcher *filter = &array->filter;
 
         if (filter->callback && !filter->callback(filter->userdata, event)) {
-            SDL_UnlockMutex(list->lock);
-            return false;
+            result = false;
+        } else {
+            SDL_CallEventWatchArray(array, event);
         }
+    }
+    SDL_EndEventWatchDispatch(list);
+
+    return result;
+}
+
+int SDL_DispatchEventWatchListEvents(SDL_EventWatchList *list, SDL_Event *events, int numevents)
+{
+    SDL_EventWatchArray *array;
+    int i, used = 0;
+
+    if (!SDL_GetAtomicPointer(&list->current)) {
+        return numevents;
+    }
+
+    array = SDL_BeginEventWatchDispatch(list);
+    if (!array) {
+        SDL_EndEventWatchDispatch(list);
+        return numevents;
+    }
 
-        list->dispatching = true;
-        for (i = 0; i < count; ++i) {
-            if (!list->watchers[i].removed) {
-                list->watchers[i].callback(list->watchers[i].userdata, event);
+    // The whole batch is dispatched to the same watcher array
+    for (i = 0; i < numevents; ++i) {
+        SDL_Event *event = &events[i];
+
+        // Sentinels are never filtered or watched
+        if (event->type != SDL_EVENT_POLL_SENTINEL) {
+            SDL_EventWatcher *filter = &array->filter;
+
+            if (filter->callback && !filter->callback(filter->userdata, event)) {
+                continue;
             }
+
+            SDL_CallEventWatchArray(array, event);
         }
-        list->dispatching = false;
-
-        if (list->removed) {
-            for (i = list->count; i--;) {
-                if (list->watchers[i].removed) {
-                    --list->count;
-                    if (i < list->count) {
-                        SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
-                    }
-                }
-            }
-            list->removed = false;
+
+        if (used < i) {
+            SDL_copyp(&events[used], event);
         }
+        ++used;
     }
-    SDL_UnlockMutex(list->lock);
+    SDL_EndEventWatchDispatch(list);
 
-    return true;
+    return used;
+}
+
+void SDL_SetEventWatchListFilter(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
+{
+    SDL_LockMutex(list->lock);
+    {
+        list->filter.callback = filter;
+        list->filter.userdata = userdata;
+        SDL_PublishEventWatchArray(list, NULL);
+    }
+    SDL_UnlockMutex(list->lock);
 }
 
 bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
 {
-    bool result = true;
+    bool result;
 
     SDL_LockMutex(list->lock);
     {
-        SDL_EventWatcher *watchers;
-
-        watchers = (SDL_EventWatcher *)SDL_realloc(list->watchers, (list->count + 1) * sizeof(*watchers));
-        if (watchers) {
-            SDL_EventWatcher *watcher;
-
-            list->watchers = watchers;
-            watcher = &list->watchers[list->count];
-            watcher->callback = filter;
-            watcher->userdata = userdata;
-            watcher->removed = false;
-            ++list->count;
-        } else {
-            result = false;
-        }
+        SDL_EventWatcher watcher;
+
+        watcher.callback = filter;
+        watcher.userdata = userdata;
+        SDL_SetAtomicInt(&watcher.removed, 0);
+        result = SDL_PublishEventWatchArray(list, &watcher);
     }
     SDL_UnlockMutex(list->lock);
 
@@ -122,19 +255,15 @@ void SDL_RemoveEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter,
 {
     SDL_LockMutex(list->lock);
     {
+        SDL_EventWatchArray *array = (SDL_EventWatchArray *)SDL_GetAtomicPointer(&list->current);
         int i;
 
-        for (i = 0; i < list->count; ++i) {
-            if (list->watchers[i].callback == filter && list->watchers[i].userdata == userdata) {
-                if (list->dispatching) {
-                    list->watchers[i].removed = true;
-                    list->removed = true;
-                } else {
-                    --list->count;
-                    if (i < list->count) {
-                        SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
-                    }
-                }
+        for (i = 0; array && i < array->count; ++i) {
+            SDL_EventWatcher *watcher = &array->watchers[i];
+            if (watcher->callback == filter && watcher->userdata == userdata && !SDL_GetAtomicInt(&watcher->removed)) {
+                // Dispatches already using this array will skip it from now on
+                SDL_SetAtomicInt(&watcher->removed, 1);
+                SDL_PublishEventWatchArray(list, NULL);
                 break;
             }
         }
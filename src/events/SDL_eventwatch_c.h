@@ -24,22 +24,32 @@ typedef struct SDL_EventWatcher
 {
     SDL_EventFilter callback;
     void *userdata;
-    bool removed;
+    SDL_AtomicInt removed;
 } SDL_EventWatcher;
 
-typedef struct SDL_EventWatchList
+// A snapshot of the filter and watchers, replaced as a whole whenever they change
+typedef struct SDL_EventWatchArray
 {
-    SDL_Mutex *lock;
     SDL_EventWatcher filter;
-    SDL_EventWatcher *watchers;
+    struct SDL_EventWatchArray *next_retired;
     int count;
-    bool dispatching;
-    bool removed;
+    SDL_EventWatcher watchers[1];
+} SDL_EventWatchArray;
+
+typedef struct SDL_EventWatchList
+{
+    SDL_Mutex *lock;
+    SDL_EventWatcher filter;     // protected by lock
+    void *current;               // the SDL_EventWatchArray being dispatched, NULL if there's nothing to call
+    SDL_AtomicInt dispatching;   // number of dispatches in progress
+    void *retired;               // replaced arrays waiting to be freed, modified with the lock held
 } SDL_EventWatchList;
 
 
 extern bool SDL_InitEventWatchList(SDL_EventWatchList *list);
 extern void SDL_QuitEventWatchList(SDL_EventWatchList *list);
 extern bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event);
+extern int SDL_DispatchEventWatchListEvents(SDL_EventWatchList *list, SDL_Event *events, int numevents); // returns the number of events kept, compacted to the front of the array
+extern void SDL_SetEventWatchListFilter(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
 extern bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
 extern void SDL_RemoveEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
@@ -24,6 +24,7 @@
 
 #include "SDL_events_c.h"
 #include "SDL_keymap_c.h"
+#include "../SDL_hints_c.h"
 #include "../video/SDL_sysvideo.h"
 
 #if 0
@@ -526,6 +527,7 @@ SDL_Scancode SDL_GetScancodeFromKey(SDL_Keycode key, SDL_Keymod *modstate)
 
 static bool SDL_SendKeyboardKeyInternal(Uint64 timestamp, Uint32 flags, SDL_KeyboardID keyboardID, int rawcode, SDL_Scancode scancode, bool down)
 {
+    static SDL_HintCache allow_alt_tab = SDL_HINT_CACHE_INIT(SDL_HINT_ALLOW_ALT_TAB_WHILE_GRABBED);
     SDL_Keyboard *keyboard = &SDL_keyboard;
     bool posted = false;
     SDL_Keycode keycode = SDLK_UNKNOWN;
@@ -658,7 +660,7 @@ static bool SDL_SendKeyboardKeyInternal(Uint64 timestamp, Uint32 flags, SDL_Keyb
         keyboard->focus &&
         (keyboard->focus->flags & SDL_WINDOW_KEYBOARD_GRABBED) &&
         (keyboard->focus->flags & SDL_WINDOW_FULLSCREEN) &&
-        SDL_GetHintBoolean(SDL_HINT_ALLOW_ALT_TAB_WHILE_GRABBED, true)) {
+        SDL_GetCachedHintBoolean(&allow_alt_tab, true)) {
         /* We will temporarily forfeit our grab by minimizing our window,
            allowing the user to escape the application */
         SDL_MinimizeWindow(keyboard->focus);
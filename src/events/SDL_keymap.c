@@ -34,9 +34,8 @@ SDL_Keymap *SDL_CreateKeymap(bool auto_release)
     }
 
     keymap->auto_release = auto_release;
-    keymap->scancode_to_keycode = SDL_CreateHashTable(256, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
     keymap->keycode_to_scancode = SDL_CreateHashTable(256, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
-    if (!keymap->scancode_to_keycode || !keymap->keycode_to_scancode) {
+    if (!keymap->keycode_to_scancode) {
         SDL_DestroyKeymap(keymap);
         return NULL;
     }
@@ -61,25 +60,66 @@ static SDL_Keymod NormalizeModifierStateForKeymap(SDL_Keymod modstate)
     return modstate;
 }
 
+// Marks scancodes that have no entry for a group, since SDLK_UNKNOWN is a valid mapping.
+#define KEYMAP_NO_ENTRY ((SDL_Keycode)~0u)
+
+// Call with a normalized modifier state.
+static int GetKeymapModifierGroup(SDL_Keymod modstate)
+{
+    int group = 0;
+    if (modstate & SDL_KMOD_SHIFT) {
+        group |= 0x01;
+    }
+    if (modstate & SDL_KMOD_CAPS) {
+        group |= 0x02;
+    }
+    if (modstate & SDL_KMOD_ALT) {
+        group |= 0x04;
+    }
+    if (modstate & SDL_KMOD_MODE) {
+        group |= 0x08;
+    }
+    if (modstate & SDL_KMOD_LEVEL5) {
+        group |= 0x10;
+    }
+    return group;
+}
+
+// Call with a normalized modifier state.
+static bool FindKeymapEntry(SDL_Keymap *keymap, SDL_Scancode scancode, SDL_Keymod modstate, SDL_Keycode *keycode)
+{
+    const SDL_Keycode *keycodes = keymap->scancode_to_keycode[GetKeymapModifierGroup(modstate)];
+    if (keycodes && keycodes[scancode] != KEYMAP_NO_ENTRY) {
+        *keycode = keycodes[scancode];
+        return true;
+    }
+    return false;
+}
+
 void SDL_SetKeymapEntry(SDL_Keymap *keymap, SDL_Scancode scancode, SDL_Keymod modstate, SDL_Keycode keycode)
 {
-    if (!keymap) {
+    if (!keymap || (unsigned int)scancode >= SDL_SCANCODE_COUNT) {
         return;
     }
 
     modstate = NormalizeModifierStateForKeymap(modstate);
-    Uint32 key = ((Uint32)modstate << 16) | scancode;
-    const void *value;
-    if (SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-        const SDL_Keycode existing_keycode = (SDL_Keycode)(uintptr_t)value;
-        if (existing_keycode == keycode) {
-            // We already have this mapping
+    const int group = GetKeymapModifierGroup(modstate);
+    SDL_Keycode *keycodes = keymap->scancode_to_keycode[group];
+    if (!keycodes) {
+        keycodes = (SDL_Keycode *)SDL_malloc(SDL_SCANCODE_COUNT * sizeof(*keycodes));
+        if (!keycodes) {
             return;
         }
-        // InsertIntoHashTable will replace the existing entry in the keymap atomically.
+        SDL_memset(keycodes, 0xFF, SDL_SCANCODE_COUNT * sizeof(*keycodes));  // KEYMAP_NO_ENTRY
+        keymap->scancode_to_keycode[group] = keycodes;
+    } else if (keycodes[scancode] == keycode) {
+        // We already have this mapping
+        return;
     }
-    SDL_InsertIntoHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, (void *)(uintptr_t)keycode, true);
+    keycodes[scancode] = keycode;
 
+    const Uint32 key = ((Uint32)modstate << 16) | scancode;
+    const void *value;
     bool update_keycode = true;
     if (SDL_FindInHashTable(keymap->keycode_to_scancode, (void *)(uintptr_t)keycode, &value)) {
         const Uint32 existing_value = (Uint32)(uintptr_t)value;
@@ -97,14 +137,13 @@ void SDL_SetKeymapEntry(SDL_Keymap *keymap, SDL_Scancode scancode, SDL_Keymod mo
 
 SDL_Keycode SDL_GetKeymapKeycode(SDL_Keymap *keymap, SDL_Scancode scancode, SDL_Keymod modstate)
 {
-    if (keymap) {
-        const void *value;
+    if (keymap && (unsigned int)scancode < SDL_SCANCODE_COUNT) {
+        SDL_Keycode keycode;
         const SDL_Keymod normalized_modstate = NormalizeModifierStateForKeymap(modstate);
-        Uint32 key = ((Uint32)normalized_modstate << 16) | scancode;
 
         // First, try the requested set of modifiers.
-        if (SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-            return (SDL_Keycode)(uintptr_t)value;
+        if (FindKeymapEntry(keymap, scancode, normalized_modstate, &keycode)) {
+            return keycode;
         }
 
         // If the requested set of modifiers was not found, search for the key from the highest to lowest modifier levels.
@@ -115,47 +154,42 @@ SDL_Keycode SDL_GetKeymapKeycode(SDL_Keymap *keymap, SDL_Scancode scancode, SDL_
                 // Shift level 5
                 if (normalized_modstate & SDL_KMOD_LEVEL5) {
                     const SDL_Keymod shifted_modstate = SDL_KMOD_LEVEL5 | caps_mask;
-                    key = ((Uint32)shifted_modstate << 16) | scancode;
 
-                    if (shifted_modstate != normalized_modstate && SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-                        return (SDL_Keycode)(uintptr_t)value;
+                    if (shifted_modstate != normalized_modstate && FindKeymapEntry(keymap, scancode, shifted_modstate, &keycode)) {
+                        return keycode;
                     }
                 }
 
                 // Shift level 4 (Level 3 + Shift)
                 if ((normalized_modstate & (SDL_KMOD_MODE | SDL_KMOD_SHIFT)) == (SDL_KMOD_MODE | SDL_KMOD_SHIFT)) {
                     const SDL_Keymod shifted_modstate = SDL_KMOD_MODE | SDL_KMOD_SHIFT | caps_mask;
-                    key = ((Uint32)shifted_modstate << 16) | scancode;
 
-                    if (shifted_modstate != normalized_modstate && SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-                        return (SDL_Keycode)(uintptr_t)value;
+                    if (shifted_modstate != normalized_modstate && FindKeymapEntry(keymap, scancode, shifted_modstate, &keycode)) {
+                        return keycode;
                     }
                 }
 
                 // Shift level 3
                 if (normalized_modstate & SDL_KMOD_MODE) {
                     const SDL_Keymod shifted_modstate = SDL_KMOD_MODE | caps_mask;
-                    key = ((Uint32)shifted_modstate << 16) | scancode;
 
-                    if (shifted_modstate != normalized_modstate && SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-                        return (SDL_Keycode)(uintptr_t)value;
+                    if (shifted_modstate != normalized_modstate && FindKeymapEntry(keymap, scancode, shifted_modstate, &keycode)) {
+                        return keycode;
                     }
                 }
 
                 // Shift level 2
                 if (normalized_modstate & SDL_KMOD_SHIFT) {
                     const SDL_Keymod shifted_modstate = SDL_KMOD_SHIFT | caps_mask;
-                    key = ((Uint32)shifted_modstate << 16) | scancode;
 
-                    if (shifted_modstate != normalized_modstate && SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-                        return (SDL_Keycode)(uintptr_t)value;
+                    if (shifted_modstate != normalized_modstate && FindKeymapEntry(keymap, scancode, shifted_modstate, &keycode)) {
+                        return keycode;
                     }
                 }
 
                 // Shift Level 1 (unmodified)
-                key = ((Uint32)caps_mask << 16) | scancode;
-                if (SDL_FindInHashTable(keymap->scancode_to_keycode, (void *)(uintptr_t)key, &value)) {
-                    return (SDL_Keycode)(uintptr_t)value;
+                if (FindKeymapEntry(keymap, scancode, caps_mask, &keycode)) {
+                    return keycode;
                 }
 
                 // Clear the capslock mask, if set.
@@ -189,7 +223,9 @@ void SDL_DestroyKeymap(SDL_Keymap *keymap)
         return;
     }
 
-    SDL_DestroyHashTable(keymap->scancode_to_keycode);
+    for (int i = 0; i < SDL_arraysize(keymap->scancode_to_keycode); i++) {
+        SDL_free(keymap->scancode_to_keycode[i]);
+    }
     SDL_DestroyHashTable(keymap->keycode_to_scancode);
     SDL_free(keymap);
 }
@@ -23,9 +23,12 @@
 #ifndef SDL_keymap_c_h_
 #define SDL_keymap_c_h_
 
+// One for each combination of Shift, Caps Lock, Alt, Mode and Level 5, the modifiers that affect the keymap.
+#define SDL_KEYMAP_MODIFIER_GROUPS 32
+
 typedef struct SDL_Keymap
 {
-  SDL_HashTable *scancode_to_keycode;
+  SDL_Keycode *scancode_to_keycode[SDL_KEYMAP_MODIFIER_GROUPS];  // indexed by scancode, NULL until the group has an entry.
   SDL_HashTable *keycode_to_scancode;
   bool auto_release;
   bool layout_determined;
@@ -22,20 +22,32 @@
 
 // General touch handling code for SDL
 
+#include "../SDL_hints_c.h"
 #include "SDL_events_c.h"
 #include "../video/SDL_sysvideo.h"
 
+// Enough for both hands without any allocations while touching
+#define SDL_TOUCH_PREALLOCATED_FINGERS 10
+
 static int SDL_num_touch = 0;
 static SDL_Touch **SDL_touchDevices = NULL;
+static int SDL_last_touch_index = 0;
+static bool SDL_touch_coalesce_motion = false;
 
 // for mapping touch events to mice
 static bool finger_touching = false;
 static SDL_FingerID track_fingerid;
 static SDL_TouchID track_touchid;
 
+static void SDLCALL SDL_TouchCoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_touch_coalesce_motion = SDL_GetStringBoolean(hint, false);
+}
+
 // Public functions
 bool SDL_InitTouch(void)
 {
+    SDL_AddHintCallback(SDL_HINT_TOUCH_COALESCE_MOTION, SDL_TouchCoalesceMotionChanged, NULL);
     return true;
 }
 
@@ -70,9 +82,15 @@ static int SDL_GetTouchIndex(SDL_TouchID id)
     int index;
     SDL_Touch *touch;
 
+    // Events usually come in bursts from the same device
+    if (SDL_last_touch_index < SDL_num_touch && SDL_touchDevices[SDL_last_touch_index]->id == id) {
+        return SDL_last_touch_index;
+    }
+
     for (index = 0; index < SDL_num_touch; ++index) {
         touch = SDL_touchDevices[index];
         if (touch->id == id) {
+            SDL_last_touch_index = index;
             return index;
         }
     }
@@ -111,6 +129,65 @@ SDL_TouchDeviceType SDL_GetTouchDeviceType(SDL_TouchID id)
     return touch ? touch->type : SDL_TOUCH_DEVICE_INVALID;
 }
 
+static Uint32 SDL_HashFingerID(const SDL_Touch *touch, SDL_FingerID id)
+{
+    return (Uint32)((id * SDL_UINT64_C(0x9E3779B97F4A7C15)) >> 32) & (touch->finger_table_size - 1);
+}
+
+// Returns the table slot holding the finger, or the empty slot where it would go
+static int SDL_GetFingerSlot(const SDL_Touch *touch, SDL_FingerID id)
+{
+    const Uint32 mask = (Uint32)(touch->finger_table_size - 1);
+    Uint32 slot = SDL_HashFingerID(touch, id);
+
+    while (touch->finger_table[slot] && touch->finger_table[slot]->id != id) {
+        slot = (slot + 1) & mask;
+    }
+    return (int)slot;
+}
+
+static bool SDL_ResizeFingerTable(SDL_Touch *touch, int size)
+{
+    SDL_Finger **table;
+    int i;
+
+    table = (SDL_Finger **)SDL_calloc(size, sizeof(*table));
+    if (!table) {
+        return false;
+    }
+    SDL_free(touch->finger_table);
+    touch->finger_table = table;
+    touch->finger_table_size = size;
+
+    for (i = 0; i < touch->num_fingers; ++i) {
+        SDL_Finger *finger = touch->fingers[i];
+        touch->finger_table[SDL_GetFingerSlot(touch, finger->id)] = finger;
+    }
+    return true;
+}
+
+static void SDL_RemoveFingerFromTable(SDL_Touch *touch, SDL_FingerID id)
+{
+    const Uint32 mask = (Uint32)(touch->finger_table_size - 1);
+    Uint32 slot = (Uint32)SDL_GetFingerSlot(touch, id);
+    Uint32 next;
+
+    if (!touch->finger_table[slot]) {
+        return;
+    }
+    touch->finger_table[slot] = NULL;
+
+    // Move back any entries that would no longer be found past the hole
+    for (next = (slot + 1) & mask; touch->finger_table[next]; next = (next + 1) & mask) {
+        const Uint32 home = SDL_HashFingerID(touch, touch->finger_table[next]->id);
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            touch->finger_table[slot] = touch->finger_table[next];
+            touch->finger_table[next] = NULL;
+            slot = next;
+        }
+    }
+}
+
 static int SDL_GetFingerIndex(const SDL_Touch *touch, SDL_FingerID fingerid)
 {
     int index;
@@ -124,11 +201,10 @@ static int SDL_GetFingerIndex(const SDL_Touch *touch, SDL_FingerID fingerid)
 
 static SDL_Finger *SDL_GetFinger(const SDL_Touch *touch, SDL_FingerID id)
 {
-    int index = SDL_GetFingerIndex(touch, id);
-    if (index < 0 || index >= touch->num_fingers) {
+    if (touch->num_fingers == 0) {
         return NULL;
     }
-    return touch->fingers[index];
+    return touch->finger_table[SDL_GetFingerSlot(touch, id)];
 }
 
 SDL_Finger **SDL_GetTouchFingers(SDL_TouchID touchID, int *count)
@@ -167,6 +243,7 @@ SDL_Finger **SDL_GetTouchFingers(SDL_TouchID touchID, int *count)
 int SDL_AddTouch(SDL_TouchID touchID, SDL_TouchDeviceType type, const char *name)
 {
     SDL_Touch **touchDevices;
+    SDL_Touch *touch;
     int index;
 
     SDL_assert(touchID != 0);
@@ -186,21 +263,35 @@ int SDL_AddTouch(SDL_TouchID touchID, SDL_TouchDeviceType type, const char *name
     SDL_touchDevices = touchDevices;
     index = SDL_num_touch;
 
-    SDL_touchDevices[index] = (SDL_Touch *)SDL_malloc(sizeof(*SDL_touchDevices[index]));
+    SDL_touchDevices[index] = (SDL_Touch *)SDL_calloc(1, sizeof(*SDL_touchDevices[index]));
     if (!SDL_touchDevices[index]) {
         return -1;
     }
+    touch = SDL_touchDevices[index];
+
+    // Set up room for the first fingers, so touching doesn't allocate
+    touch->fingers = (SDL_Finger **)SDL_malloc(SDL_TOUCH_PREALLOCATED_FINGERS * sizeof(*touch->fingers));
+    touch->finger_storage = (SDL_Finger *)SDL_malloc(SDL_TOUCH_PREALLOCATED_FINGERS * sizeof(*touch->finger_storage));
+    if (!touch->fingers || !touch->finger_storage || !SDL_ResizeFingerTable(touch, 32)) {
+        SDL_free(touch->fingers);
+        SDL_free(touch->finger_storage);
+        SDL_free(touch);
+        return -1;
+    }
+    for (int i = 0; i < SDL_TOUCH_PREALLOCATED_FINGERS; ++i) {
+        touch->fingers[i] = &touch->finger_storage[i];
+    }
+    touch->fingers_capacity = SDL_TOUCH_PREALLOCATED_FINGERS;
+    touch->max_fingers = SDL_TOUCH_PREALLOCATED_FINGERS;
 
     // Added touch to list
     ++SDL_num_touch;
 
     // we're setting the touch properties
-    SDL_touchDevices[index]->id = touchID;
-    SDL_touchDevices[index]->type = type;
-    SDL_touchDevices[index]->num_fingers = 0;
-    SDL_touchDevices[index]->max_fingers = 0;
-    SDL_touchDevices[index]->fingers = NULL;
-    SDL_touchDevices[index]->name = SDL_strdup(name ? name : "");
+    touch->id = touchID;
+    touch->type = type;
+    touch->num_fingers = 0;
+    touch->name = SDL_strdup(name ? name : "");
 
     return index;
 }
@@ -221,13 +312,23 @@ static bool SDL_AddFinger(SDL_Touch *touch, SDL_FingerID fingerid, float x, floa
 
     SDL_assert(fingerid != 0);
 
-    if (touch->num_fingers == touch->max_fingers) {
-        SDL_Finger **new_fingers;
-        new_fingers = (SDL_Finger **)SDL_realloc(touch->fingers, (touch->max_fingers + 1) * sizeof(*touch->fingers));
-        if (!new_fingers) {
+    if ((touch->num_fingers + 1) * 2 >= touch->finger_table_size) {
+        if (!SDL_ResizeFingerTable(touch, touch->finger_table_size * 2)) {
             return false;
         }
-        touch->fingers = new_fingers;
+    }
+
+    if (touch->num_fingers == touch->max_fingers) {
+        if (touch->max_fingers == touch->fingers_capacity) {
+            SDL_Finger **new_fingers;
+            int new_capacity = touch->fingers_capacity * 2;
+            new_fingers = (SDL_Finger **)SDL_realloc(touch->fingers, new_capacity * sizeof(*touch->fingers));
+            if (!new_fingers) {
+                return false;
+            }
+            touch->fingers = new_fingers;
+            touch->fingers_capacity = new_capacity;
+        }
         touch->fingers[touch->max_fingers] = (SDL_Finger *)SDL_malloc(sizeof(*finger));
         if (!touch->fingers[touch->max_fingers]) {
             return false;
@@ -240,6 +341,7 @@ static bool SDL_AddFinger(SDL_Touch *touch, SDL_FingerID fingerid, float x, floa
     finger->x = x;
     finger->y = y;
     finger->pressure = pressure;
+    touch->finger_table[SDL_GetFingerSlot(touch, fingerid)] = finger;
     return true;
 }
 
@@ -250,6 +352,8 @@ static void SDL_DelFinger(SDL_Touch *touch, SDL_FingerID fingerid)
         return;
     }
 
+    SDL_RemoveFingerFromTable(touch, fingerid);
+
     --touch->num_fingers;
     if (index < (touch->num_fingers)) {
         // Move the deleted finger to just past the end of the active fingers array and shift the active fingers by one.
@@ -467,7 +571,11 @@ void SDL_SendTouchMotion(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid
         event.tfinger.dy = yrel;
         event.tfinger.pressure = pressure;
         event.tfinger.windowID = window ? SDL_GetWindowID(window) : 0;
-        SDL_PushEvent(&event);
+        if (SDL_touch_coalesce_motion) {
+            SDL_PushCoalescedFingerMotionEvent(&event);
+        } else {
+            SDL_PushEvent(&event);
+        }
     }
 }
 
@@ -488,9 +596,16 @@ void SDL_DelTouch(SDL_TouchID id)
     }
 
     for (i = 0; i < touch->max_fingers; ++i) {
-        SDL_free(touch->fingers[i]);
+        // Deleting fingers shuffles the descriptors, so check where each one came from
+        const uintptr_t finger = (uintptr_t)touch->fingers[i];
+        const uintptr_t storage = (uintptr_t)touch->finger_storage;
+        if (finger < storage || finger >= storage + SDL_TOUCH_PREALLOCATED_FINGERS * sizeof(*touch->finger_storage)) {
+            SDL_free(touch->fingers[i]);
+        }
     }
     SDL_free(touch->fingers);
+    SDL_free(touch->finger_storage);
+    SDL_free(touch->finger_table);
     SDL_free(touch->name);
     SDL_free(touch);
 
@@ -509,4 +624,6 @@ void SDL_QuitTouch(void)
 
     SDL_free(SDL_touchDevices);
     SDL_touchDevices = NULL;
+
+    SDL_RemoveHintCallback(SDL_HINT_TOUCH_COALESCE_MOTION, SDL_TouchCoalesceMotionChanged, NULL);
 }
@@ -29,7 +29,11 @@ typedef struct SDL_Touch
     SDL_TouchDeviceType type;
     int num_fingers;
     int max_fingers;
+    int fingers_capacity;
     SDL_Finger **fingers;
+    SDL_Finger *finger_storage; // the first fingers, allocated with the touch
+    SDL_Finger **finger_table;  // active fingers, open addressed by finger id
+    int finger_table_size;      // always a power of two, and more than twice num_fingers
     char *name;
 } SDL_Touch;
 
@@ -44,13 +44,18 @@ bool SDL_RenamePath(const char *oldpath, const char *newpath)
 }
 
 bool SDL_CopyFile(const char *oldpath, const char *newpath)
+{
+    return SDL_CopyFileWithProgress(oldpath, newpath, NULL, NULL);
+}
+
+bool SDL_CopyFileWithProgress(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
     if (!oldpath) {
         return SDL_InvalidParamError("oldpath");
     } else if (!newpath) {
         return SDL_InvalidParamError("newpath");
     }
-    return SDL_SYS_CopyFile(oldpath, newpath);
+    return SDL_SYS_CopyFile(oldpath, newpath, callback, userdata);
 }
 
 bool SDL_CreateDirectory(const char *path)
@@ -526,5 +531,8 @@ void SDL_QuitFilesystem(void)
             CachedUserFolders[i] = NULL;
         }
     }
+#ifdef SDL_PLATFORM_WINRT
+    WINRT_QuitFilesystem();
+#endif
 }
 
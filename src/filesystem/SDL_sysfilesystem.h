@@ -31,13 +31,27 @@ extern char *SDL_SYS_GetCurrentDirectory(void);
 extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata);
 extern bool SDL_SYS_RemovePath(const char *path);
 extern bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath);
-extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath);
+extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata);
 extern bool SDL_SYS_CreateDirectory(const char *path);
 extern bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info);
 
+// Watches a directory tree for files and directories being added, removed or renamed.
+// Some platforms watch the whole tree, others need each directory under it added.
+// DirectoryWatchChanged doesn't block, and reports whether anything changed since the last call.
+typedef struct SDL_DirectoryWatch SDL_DirectoryWatch;
+extern SDL_DirectoryWatch *SDL_SYS_CreateDirectoryWatch(const char *path);
+extern bool SDL_SYS_AddDirectoryWatch(SDL_DirectoryWatch *watch, const char *path);
+extern bool SDL_SYS_DirectoryWatchChanged(SDL_DirectoryWatch *watch);
+extern void SDL_SYS_DestroyDirectoryWatch(SDL_DirectoryWatch *watch);
+
 typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
 typedef bool (*SDL_GlobGetPathInfoFunc)(const char *path, SDL_PathInfo *info, void *userdata);
 extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata);
 
+#ifdef SDL_PLATFORM_WINRT
+// Frees the known folder and pref paths the WinRT code has looked up.
+extern void WINRT_QuitFilesystem(void);
+#endif
+
 #endif
 
@@ -43,7 +43,7 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return SDL_Unsupported();
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
     return SDL_Unsupported();
 }
@@ -58,5 +58,25 @@ bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info)
     return SDL_Unsupported();
 }
 
+SDL_DirectoryWatch *SDL_SYS_CreateDirectoryWatch(const char *path)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
+bool SDL_SYS_AddDirectoryWatch(SDL_DirectoryWatch *watch, const char *path)
+{
+    return SDL_Unsupported();
+}
+
+bool SDL_SYS_DirectoryWatchChanged(SDL_DirectoryWatch *watch)
+{
+    return true;
+}
+
+void SDL_SYS_DestroyDirectoryWatch(SDL_DirectoryWatch *watch)
+{
+}
+
 #endif // SDL_FSOPS_DUMMY
 
@@ -34,6 +34,13 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <fcntl.h>
+#ifdef HAVE_INOTIFY
+#include <sys/inotify.h>
+#endif
+#ifdef SDL_PLATFORM_APPLE
+#include <copyfile.h>
+#endif
 
 bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
 {
@@ -97,57 +104,127 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+// Copies the rest of the file through a buffer, for when the system can't do it for us.
+static bool CopyFileDataThroughBuffer(int input, int output, Uint64 copied, Uint64 total, SDL_CopyFileProgressCallback callback, void *userdata)
+{
+    const size_t maxlen = 1024 * 1024;
+    char *buffer = (char *)SDL_malloc(maxlen);
+    if (!buffer) {
+        return false;
+    }
+
+    bool result = true;
+    while (result) {
+        const ssize_t len = read(input, buffer, maxlen);
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = SDL_SetError("Can't read file: %s", strerror(errno));
+            break;
+        } else if (len == 0) {
+            break;  // EOF, we're done.
+        }
+
+        ssize_t written = 0;
+        while (written < len) {
+            const ssize_t rc = write(output, buffer + written, len - written);
+            if (rc < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result = SDL_SetError("Can't write file: %s", strerror(errno));
+                break;
+            }
+            written += rc;
+        }
+
+        copied += len;
+        if (result && callback && !callback(userdata, copied, SDL_max(copied, total))) {
+            result = SDL_SetError("Copy canceled");
+        }
+    }
+
+    SDL_free(buffer);
+    return result;
+}
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
-    char *buffer = NULL;
-    SDL_IOStream *input = NULL;
-    SDL_IOStream *output = NULL;
-    const size_t maxlen = 4096;
-    size_t len;
+    struct stat statbuf;
+    int output = -1;
     bool result = false;
 
-    input = SDL_IOFromFile(oldpath, "rb");
-    if (!input) {
-        goto done;
+    const int input = open(oldpath, O_RDONLY | O_CLOEXEC);
+    if (input < 0) {
+        return SDL_SetError("Can't open %s: %s", oldpath, strerror(errno));
     }
 
-    output = SDL_IOFromFile(newpath, "wb");
-    if (!output) {
+    if (fstat(input, &statbuf) < 0) {
+        SDL_SetError("Can't stat %s: %s", oldpath, strerror(errno));
         goto done;
     }
 
-    buffer = (char *)SDL_malloc(maxlen);
-    if (!buffer) {
+    output = open(newpath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (output < 0) {
+        SDL_SetError("Can't open %s: %s", newpath, strerror(errno));
         goto done;
     }
 
-    while ((len = SDL_ReadIO(input, buffer, maxlen)) > 0) {
-        if (SDL_WriteIO(output, buffer, len) < len) {
+    const Uint64 total = (Uint64)statbuf.st_size;
+    Uint64 copied = 0;
+    bool finished = false;
+
+#if defined(SDL_PLATFORM_APPLE)
+    // fcopyfile lets the filesystem copy the data itself, but can't report progress the way we want.
+    if (!callback && (fcopyfile(input, output, NULL, COPYFILE_DATA) == 0)) {
+        finished = true;
+    }
+#elif defined(HAVE_COPY_FILE_RANGE)
+    // The data never comes up to user space, and filesystems that can share blocks between files will do that instead.
+    while (copied < total) {
+        const size_t chunk = (size_t)SDL_min(total - copied, 64 * 1024 * 1024);
+        const ssize_t len = copy_file_range(input, NULL, output, NULL, chunk, 0);
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if ((copied == 0) && ((errno == EXDEV) || (errno == ENOSYS) || (errno == EINVAL) || (errno == EOPNOTSUPP))) {
+                break;  // not supported for these files, do it the slow way.
+            }
+            SDL_SetError("Can't copy file: %s", strerror(errno));
+            goto done;
+        } else if (len == 0) {
+            break;  // the file got shorter? Let the fallback read to the real end.
+        }
+        copied += len;
+        if (callback && !callback(userdata, copied, total)) {
+            SDL_SetError("Copy canceled");
             goto done;
         }
     }
-    if (SDL_GetIOStatus(input) != SDL_IO_STATUS_EOF) {
+#endif
+
+    if (!finished && !CopyFileDataThroughBuffer(input, output, copied, total, callback, userdata)) {
         goto done;
     }
 
-    SDL_CloseIO(input);
-    input = NULL;
+#if defined(SDL_PLATFORM_APPLE)
+    fcntl(output, F_FULLFSYNC);
+#else
+    fsync(output);
+#endif
 
-    if (!SDL_FlushIO(output)) {
-        goto done;
+    result = (close(output) == 0);
+    output = -1;  // it's gone, even if it failed.
+    if (!result) {
+        SDL_SetError("Can't close %s: %s", newpath, strerror(errno));
     }
 
-    result = SDL_CloseIO(output);
-    output = NULL;  // it's gone, even if it failed.
-
 done:
-    if (output) {
-        SDL_CloseIO(output);
-    }
-    if (input) {
-        SDL_CloseIO(input);
+    if (output >= 0) {
+        close(output);
     }
-    SDL_free(buffer);
+    close(input);
 
     return result;
 }
@@ -242,5 +319,101 @@ char *SDL_SYS_GetCurrentDirectory(void)
     return buf;
 }
 
+#ifdef HAVE_INOTIFY
+
+#define SDL_DIRECTORY_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF)
+
+struct SDL_DirectoryWatch
+{
+    int fd;
+};
+
+SDL_DirectoryWatch *SDL_SYS_CreateDirectoryWatch(const char *path)
+{
+#ifdef HAVE_INOTIFY_INIT1
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#else
+    const int fd = inotify_init();
+    if (fd >= 0) {
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+#endif
+    if (fd < 0) {
+        SDL_SetError("Can't initialize inotify: %s", strerror(errno));
+        return NULL;
+    }
+
+    SDL_DirectoryWatch *watch = (SDL_DirectoryWatch *)SDL_malloc(sizeof(*watch));
+    if (!watch) {
+        close(fd);
+        return NULL;
+    }
+    watch->fd = fd;
+
+    if (!SDL_SYS_AddDirectoryWatch(watch, path)) {
+        SDL_SYS_DestroyDirectoryWatch(watch);
+        return NULL;
+    }
+    return watch;
+}
+
+bool SDL_SYS_AddDirectoryWatch(SDL_DirectoryWatch *watch, const char *path)
+{
+    // inotify isn't recursive, so every directory has its own watch. Adding one twice just updates it.
+    if (inotify_add_watch(watch->fd, path, SDL_DIRECTORY_WATCH_MASK) < 0) {
+        return SDL_SetError("Can't watch directory: %s", strerror(errno));
+    }
+    return true;
+}
+
+bool SDL_SYS_DirectoryWatchChanged(SDL_DirectoryWatch *watch)
+{
+    // we don't care what happened, just drain the events so the next call only sees new ones.
+    char buf[1024];
+    bool changed = false;
+    ssize_t len;
+
+    while ((len = read(watch->fd, buf, sizeof(buf))) > 0) {
+        changed = true;
+    }
+    if ((len < 0) && (errno != EAGAIN) && (errno != EINTR)) {
+        changed = true;  // if we can't tell, assume the worst.
+    }
+    return changed;
+}
+
+void SDL_SYS_DestroyDirectoryWatch(SDL_DirectoryWatch *watch)
+{
+    if (watch) {
+        close(watch->fd);
+        SDL_free(watch);
+    }
+}
+
+#else
+
+SDL_DirectoryWatch *SDL_SYS_CreateDirectoryWatch(const char *path)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
+bool SDL_SYS_AddDirectoryWatch(SDL_DirectoryWatch *watch, const char *path)
+{
+    return SDL_Unsupported();
+}
+
+bool SDL_SYS_DirectoryWatchChanged(SDL_DirectoryWatch *watch)
+{
+    return true;
+}
+
+void SDL_SYS_DestroyDirectoryWatch(SDL_DirectoryWatch *watch)
+{
+}
+
+#endif // HAVE_INOTIFY
+
 #endif // SDL_FSOPS_POSIX
 
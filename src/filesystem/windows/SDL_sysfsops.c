@@ -68,8 +68,9 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
 
         pattern[--patternlen] = '\0';  // chop off the '*' so we just have the dirname with a path separator.
 
+        // We don't need the 8.3 names, and a large fetch gets the whole directory in as few trips to the kernel as possible.
         WIN32_FIND_DATAW entw;
-        HANDLE dir = FindFirstFileExW(wpattern, FindExInfoStandard, &entw, FindExSearchNameMatch, NULL, 0);
+        HANDLE dir = FindFirstFileExW(wpattern, FindExInfoBasic, &entw, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
         SDL_free(wpattern);
         if (dir == INVALID_HANDLE_VALUE) {
             SDL_free(pattern);
@@ -149,7 +150,36 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+typedef struct WindowsCopyProgress
+{
+    SDL_CopyFileProgressCallback callback;
+    void *userdata;
+} WindowsCopyProgress;
+
+#if _WIN32_WINNT >= 0x0602  // CopyFile2 is new to Windows 8, and the only one available to UWP apps.
+static COPYFILE2_MESSAGE_ACTION CALLBACK CopyFileProgressRoutine(const COPYFILE2_MESSAGE *message, PVOID context)
+{
+    const WindowsCopyProgress *progress = (const WindowsCopyProgress *)context;
+    if (message->Type == COPYFILE2_CALLBACK_CHUNK_FINISHED) {
+        if (!progress->callback(progress->userdata, message->Info.ChunkFinished.uliTotalBytesTransferred.QuadPart, message->Info.ChunkFinished.uliTotalFileSize.QuadPart)) {
+            return COPYFILE2_PROGRESS_CANCEL;
+        }
+    }
+    return COPYFILE2_PROGRESS_CONTINUE;
+}
+#else
+static DWORD CALLBACK CopyFileProgressRoutine(LARGE_INTEGER TotalFileSize, LARGE_INTEGER TotalBytesTransferred, LARGE_INTEGER StreamSize, LARGE_INTEGER StreamBytesTransferred,
+                                              DWORD dwStreamNumber, DWORD dwCallbackReason, HANDLE hSourceFile, HANDLE hDestinationFile, LPVOID lpData)
+{
+    const WindowsCopyProgress *progress = (const WindowsCopyProgress *)lpData;
+    if (!progress->callback(progress->userdata, TotalBytesTransferred.QuadPart, TotalFileSize.QuadPart)) {
+        return PROGRESS_CANCEL;
+    }
+    return PROGRESS_CONTINUE;
+}
+#endif
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
     WCHAR *woldpath = WIN_UTF8ToStringW(oldpath);
     if (!woldpath) {
@@ -162,12 +192,39 @@ bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
         return false;
     }
 
-    const BOOL rc = CopyFileExW(woldpath, wnewpath, NULL, NULL, NULL, COPY_FILE_ALLOW_DECRYPTED_DESTINATION|COPY_FILE_NO_BUFFERING);
+    WindowsCopyProgress progress;
+    progress.callback = callback;
+    progress.userdata = userdata;
+
+    // The system copies the file itself, without the data coming through our memory, and can do it on the server for network shares.
+#if _WIN32_WINNT >= 0x0602
+    COPYFILE2_EXTENDED_PARAMETERS params;
+    SDL_zero(params);
+    params.dwSize = sizeof(params);
+    params.dwCopyFlags = COPY_FILE_ALLOW_DECRYPTED_DESTINATION | COPY_FILE_NO_BUFFERING;
+    if (callback) {
+        params.pProgressRoutine = CopyFileProgressRoutine;
+        params.pvCallbackContext = &progress;
+    }
+    const HRESULT hr = CopyFile2(woldpath, wnewpath, &params);
+    SDL_free(wnewpath);
+    SDL_free(woldpath);
+    if (hr == HRESULT_FROM_WIN32(ERROR_REQUEST_ABORTED)) {
+        return SDL_SetError("Copy canceled");
+    } else if (FAILED(hr)) {
+        return WIN_SetErrorFromHRESULT("Couldn't copy path", hr);
+    }
+#else
+    const BOOL rc = CopyFileExW(woldpath, wnewpath, callback ? CopyFileProgressRoutine : NULL, &progress, NULL, COPY_FILE_ALLOW_DECRYPTED_DESTINATION|COPY_FILE_NO_BUFFERING);
     SDL_free(wnewpath);
     SDL_free(woldpath);
     if (!rc) {
+        if (GetLastError() == ERROR_REQUEST_ABORTED) {
+            return SDL_SetError("Copy canceled");
+        }
         return WIN_SetError("Couldn't copy path");
     }
+#endif
     return true;
 }
 
@@ -227,5 +284,56 @@ bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info)
     return true;
 }
 
+struct SDL_DirectoryWatch
+{
+    HANDLE handle;
+};
+
+SDL_DirectoryWatch *SDL_SYS_CreateDirectoryWatch(const char *path)
+{
+    WCHAR *wpath = WIN_UTF8ToStringW(path);
+    if (!wpath) {
+        return NULL;
+    }
+
+    // We only need to know that something changed, not what, so a change notification is enough.
+    const HANDLE handle = FindFirstChangeNotificationW(wpath, TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME);
+    SDL_free(wpath);
+    if (handle == INVALID_HANDLE_VALUE) {
+        WIN_SetError("Couldn't watch directory");
+        return NULL;
+    }
+
+    SDL_DirectoryWatch *watch = (SDL_DirectoryWatch *)SDL_malloc(sizeof(*watch));
+    if (!watch) {
+        FindCloseChangeNotification(handle);
+        return NULL;
+    }
+    watch->handle = handle;
+    return watch;
+}
+
+bool SDL_SYS_AddDirectoryWatch(SDL_DirectoryWatch *watch, const char *path)
+{
+    return true;  // the whole tree is already being watched.
+}
+
+bool SDL_SYS_DirectoryWatchChanged(SDL_DirectoryWatch *watch)
+{
+    if (WaitForSingleObject(watch->handle, 0) != WAIT_OBJECT_0) {
+        return false;
+    }
+    FindNextChangeNotification(watch->handle);  // rearm it for the next change.
+    return true;
+}
+
+void SDL_SYS_DestroyDirectoryWatch(SDL_DirectoryWatch *watch)
+{
+    if (watch) {
+        FindCloseChangeNotification(watch->handle);
+        SDL_free(watch);
+    }
+}
+
 #endif // SDL_FSOPS_WINDOWS
 
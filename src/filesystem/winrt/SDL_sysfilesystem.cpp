@@ -36,83 +36,98 @@ extern "C" {
 using namespace std;
 using namespace Windows::Storage;
 
-static const wchar_t *SDL_GetWinRTFSPathUNICODE(SDL_WinRT_Path pathType)
+// Asking WinRT for these paths goes through several COM calls, so they're looked up once and kept until SDL_Quit().
+#define WINRT_NUM_PATHS (SDL_WINRT_PATH_TEMP_FOLDER + 1)
+static SRWLOCK WINRT_PathLock = SRWLOCK_INIT;
+static wstring WINRT_WidePaths[WINRT_NUM_PATHS];
+static char *WINRT_UTF8Paths[WINRT_NUM_PATHS];
+static unordered_map<string, string> WINRT_PrefPaths;  // "org\0app" -> UTF-8 pref path
+
+static wstring SDL_LookupWinRTFSPathUNICODE(SDL_WinRT_Path pathType)
 {
     switch (pathType) {
     case SDL_WINRT_PATH_INSTALLED_LOCATION:
-    {
-        static wstring path;
-        if (path.empty()) {
 #if defined(NTDDI_WIN10_19H1) && (NTDDI_VERSION >= NTDDI_WIN10_19H1) && (WINAPI_FAMILY == WINAPI_FAMILY_PC_APP) // Only PC supports mods
-            // Windows 1903 supports mods, via the EffectiveLocation API
-            if (Windows::Foundation::Metadata::ApiInformation::IsApiContractPresent("Windows.Foundation.UniversalApiContract", 8, 0)) {
-                path = Windows::ApplicationModel::Package::Current->EffectiveLocation->Path->Data();
-            } else {
-                path = Windows::ApplicationModel::Package::Current->InstalledLocation->Path->Data();
-            }
-#else
-            path = Windows::ApplicationModel::Package::Current->InstalledLocation->Path->Data();
-#endif
+        // Windows 1903 supports mods, via the EffectiveLocation API
+        if (Windows::Foundation::Metadata::ApiInformation::IsApiContractPresent("Windows.Foundation.UniversalApiContract", 8, 0)) {
+            return Windows::ApplicationModel::Package::Current->EffectiveLocation->Path->Data();
         }
-        return path.c_str();
-    }
+#endif
+        return Windows::ApplicationModel::Package::Current->InstalledLocation->Path->Data();
 
     case SDL_WINRT_PATH_LOCAL_FOLDER:
-    {
-        static wstring path;
-        if (path.empty()) {
-            path = ApplicationData::Current->LocalFolder->Path->Data();
-        }
-        return path.c_str();
-    }
+        return ApplicationData::Current->LocalFolder->Path->Data();
 
 #if !SDL_WINAPI_FAMILY_PHONE || NTDDI_VERSION > NTDDI_WIN8
     case SDL_WINRT_PATH_ROAMING_FOLDER:
-    {
-        static wstring path;
-        if (path.empty()) {
-            path = ApplicationData::Current->RoamingFolder->Path->Data();
-        }
-        return path.c_str();
-    }
+        return ApplicationData::Current->RoamingFolder->Path->Data();
 
     case SDL_WINRT_PATH_TEMP_FOLDER:
-    {
-        static wstring path;
-        if (path.empty()) {
-            path = ApplicationData::Current->TemporaryFolder->Path->Data();
-        }
-        return path.c_str();
-    }
+        return ApplicationData::Current->TemporaryFolder->Path->Data();
 #endif
 
     default:
         break;
     }
 
-    SDL_Unsupported();
-    return NULL;
+    return wstring();
 }
 
-extern "C" const char *SDL_GetWinRTFSPath(SDL_WinRT_Path pathType)
+// Call with WINRT_PathLock held exclusively.
+static const wchar_t *SDL_GetWinRTFSPathUNICODE(SDL_WinRT_Path pathType)
 {
-    typedef unordered_map<SDL_WinRT_Path, string> UTF8PathMap;
-    static UTF8PathMap utf8Paths;
+    if (((int)pathType < 0) || ((int)pathType >= WINRT_NUM_PATHS)) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    wstring &path = WINRT_WidePaths[pathType];
+    if (path.empty()) {
+        path = SDL_LookupWinRTFSPathUNICODE(pathType);
+        if (path.empty()) {
+            SDL_Unsupported();
+            return NULL;
+        }
+    }
+    return path.c_str();
+}
 
-    UTF8PathMap::iterator searchResult = utf8Paths.find(pathType);
-    if (searchResult != utf8Paths.end()) {
-        return searchResult->second.c_str();
+extern "C" const char *SDL_GetWinRTFSPath(SDL_WinRT_Path pathType)
+{
+    const char *result = NULL;
+
+    if (((int)pathType >= 0) && ((int)pathType < WINRT_NUM_PATHS)) {
+        AcquireSRWLockShared(&WINRT_PathLock);
+        result = WINRT_UTF8Paths[pathType];
+        ReleaseSRWLockShared(&WINRT_PathLock);
+        if (result) {
+            return result;
+        }
     }
 
+    AcquireSRWLockExclusive(&WINRT_PathLock);
     const wchar_t *ucs2Path = SDL_GetWinRTFSPathUNICODE(pathType);
-    if (!ucs2Path) {
-        return NULL;
+    if (ucs2Path) {
+        if (!WINRT_UTF8Paths[pathType]) {
+            WINRT_UTF8Paths[pathType] = WIN_StringToUTF8W(ucs2Path);
+        }
+        result = WINRT_UTF8Paths[pathType];
     }
+    ReleaseSRWLockExclusive(&WINRT_PathLock);
+    return result;
+}
 
-    char *utf8Path = WIN_StringToUTF8W(ucs2Path);
-    utf8Paths[pathType] = utf8Path;
-    SDL_free(utf8Path);
-    return SDL_GetPersistentString(utf8Paths[pathType].c_str());
+extern "C" void WINRT_QuitFilesystem(void)
+{
+    AcquireSRWLockExclusive(&WINRT_PathLock);
+    for (int i = 0; i < WINRT_NUM_PATHS; i++) {
+        WINRT_WidePaths[i].clear();
+        WINRT_WidePaths[i].shrink_to_fit();
+        SDL_free(WINRT_UTF8Paths[i]);
+        WINRT_UTF8Paths[i] = NULL;
+    }
+    unordered_map<string, string>().swap(WINRT_PrefPaths);
+    ReleaseSRWLockExclusive(&WINRT_PathLock);
 }
 
 extern "C" char *SDL_SYS_GetBasePath(void)
@@ -136,7 +151,8 @@ extern "C" char *SDL_SYS_GetBasePath(void)
     return destPath;
 }
 
-extern "C" char *SDL_SYS_GetPrefPath(const char *org, const char *app)
+// Call with WINRT_PathLock held exclusively.
+static char *SDL_CreateWinRTPrefPath(const char *org, const char *app)
 {
     /* WinRT note: The 'SHGetFolderPath' API that is used in Windows 7 and
      * earlier is not available on WinRT or Windows Phone.  WinRT provides
@@ -152,14 +168,6 @@ extern "C" char *SDL_SYS_GetPrefPath(const char *org, const char *app)
     size_t new_wpath_len = 0;
     BOOL api_result = FALSE;
 
-    if (!app) {
-        SDL_InvalidParamError("app");
-        return NULL;
-    }
-    if (!org) {
-        org = "";
-    }
-
     srcPath = SDL_GetWinRTFSPathUNICODE(SDL_WINRT_PATH_LOCAL_FOLDER);
     if (!srcPath) {
         SDL_SetError("Unable to find a source path");
@@ -195,8 +203,8 @@ extern "C" char *SDL_SYS_GetPrefPath(const char *org, const char *app)
     if (*worg) {
         SDL_wcslcat(path, L"\\", new_wpath_len + 1);
         SDL_wcslcat(path, worg, new_wpath_len + 1);
-        SDL_free(worg);
     }
+    SDL_free(worg);
 
     api_result = CreateDirectoryW(path, NULL);
     if (api_result == FALSE) {
@@ -226,6 +234,41 @@ extern "C" char *SDL_SYS_GetPrefPath(const char *org, const char *app)
     return result;
 }
 
+extern "C" char *SDL_SYS_GetPrefPath(const char *org, const char *app)
+{
+    if (!app) {
+        SDL_InvalidParamError("app");
+        return NULL;
+    }
+    if (!org) {
+        org = "";
+    }
+
+    // Once the directories exist, there's no need to convert the names or create them again.
+    string key(org);
+    key += '\0';
+    key += app;
+
+    char *result = NULL;
+    AcquireSRWLockShared(&WINRT_PathLock);
+    unordered_map<string, string>::const_iterator cached = WINRT_PrefPaths.find(key);
+    if (cached != WINRT_PrefPaths.end()) {
+        result = SDL_strdup(cached->second.c_str());
+    }
+    ReleaseSRWLockShared(&WINRT_PathLock);
+    if (result) {
+        return result;
+    }
+
+    AcquireSRWLockExclusive(&WINRT_PathLock);
+    result = SDL_CreateWinRTPrefPath(org, app);
+    if (result) {
+        WINRT_PrefPaths[key] = result;
+    }
+    ReleaseSRWLockExclusive(&WINRT_PathLock);
+    return result;
+}
+
 char *SDL_SYS_GetUserFolder(SDL_Folder folder)
 {
     wstring wpath;
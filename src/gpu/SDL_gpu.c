@@ -20,6 +20,21 @@
 */
 #include "SDL_internal.h"
 #include "SDL_sysgpu.h"
+#include "../io/SDL_asyncio_c.h"
+
+#if defined(SDL_PLATFORM_WINDOWS) && !defined(SDL_PLATFORM_WINRT) && !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#include "../core/windows/SDL_windows.h"
+#define HAVE_RENDERDOC
+#define RENDERDOC_MODULE "renderdoc.dll"
+#elif defined(HAVE_DLOPEN) && (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID))
+#include <dlfcn.h>
+#define HAVE_RENDERDOC
+#ifdef SDL_PLATFORM_ANDROID
+#define RENDERDOC_MODULE "libVkLayer_GLES_RenderDoc.so"
+#else
+#define RENDERDOC_MODULE "librenderdoc.so"
+#endif
+#endif
 
 // FIXME: This could probably use SDL_ObjectValid
 #define CHECK_DEVICE_MAGIC(device, retval)  \
@@ -55,6 +70,12 @@
         return retval;                                                             \
     }
 
+#define CHECK_GRAPHICS_QUEUE(msg, retval)                                                                  \
+    if (((CommandBufferCommonHeader *)command_buffer)->queue_type != SDL_GPU_QUEUETYPE_GRAPHICS) { \
+        SDL_SetError(msg);                                                                         \
+        return retval;                                                                             \
+    }
+
 #define CHECK_RENDERPASS                                     \
     if (!((RenderPass *)render_pass)->in_progress) {         \
         SDL_assert_release(!"Render pass not in progress!"); \
@@ -409,9 +430,32 @@ SDL_GPUGraphicsPipeline *SDL_GPU_FetchBlitPipeline(
     return pipeline;
 }
 
-void SDL_GPU_BlitCommon(
+// Later blits can't clear or cycle without disturbing the ones already in the pass
+static bool SDL_GPU_BlitCanJoinRenderPass(
+    const SDL_GPUBlitInfo *first,
+    const SDL_GPUBlitInfo *info)
+{
+    if (info->load_op != SDL_GPU_LOADOP_LOAD || info->cycle) {
+        return false;
+    }
+    if (info->destination.texture != first->destination.texture ||
+        info->destination.mip_level != first->destination.mip_level ||
+        info->destination.layer_or_depth_plane != first->destination.layer_or_depth_plane) {
+        return false;
+    }
+    // The render target can't also be sampled
+    if (info->source.texture == first->destination.texture &&
+        info->source.mip_level == first->destination.mip_level &&
+        info->source.layer_or_depth_plane == first->destination.layer_or_depth_plane) {
+        return false;
+    }
+    return true;
+}
+
+void SDL_GPU_BlitBatchCommon(
     SDL_GPUCommandBuffer *command_buffer,
-    const SDL_GPUBlitInfo *info,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 num_blits,
     SDL_GPUSampler *blit_linear_sampler,
     SDL_GPUSampler *blit_nearest_sampler,
     SDL_GPUShader *blit_vertex_shader,
@@ -426,98 +470,147 @@ void SDL_GPU_BlitCommon(
 {
     CommandBufferCommonHeader *cmdbufHeader = (CommandBufferCommonHeader *)command_buffer;
     SDL_GPURenderPass *render_pass;
-    TextureCommonHeader *src_header = (TextureCommonHeader *)info->source.texture;
-    TextureCommonHeader *dst_header = (TextureCommonHeader *)info->destination.texture;
     SDL_GPUGraphicsPipeline *blit_pipeline;
+    SDL_GPUGraphicsPipeline *bound_pipeline;
     SDL_GPUColorTargetInfo color_target_info;
     SDL_GPUViewport viewport;
     SDL_GPUTextureSamplerBinding texture_sampler_binding;
     BlitFragmentUniforms blit_fragment_uniforms;
     Uint32 layer_divisor;
+    Uint32 i = 0;
+
+    while (i < num_blits) {
+        const SDL_GPUBlitInfo *first = &infos[i];
+
+        color_target_info.load_op = first->load_op;
+        color_target_info.clear_color = first->clear_color;
+        color_target_info.store_op = SDL_GPU_STOREOP_STORE;
+
+        color_target_info.texture = first->destination.texture;
+        color_target_info.mip_level = first->destination.mip_level;
+        color_target_info.layer_or_depth_plane = first->destination.layer_or_depth_plane;
+        color_target_info.cycle = first->cycle;
+
+        render_pass = SDL_BeginGPURenderPass(
+            command_buffer,
+            &color_target_info,
+            1,
+            NULL);
+
+        bound_pipeline = NULL;
+
+        do {
+            const SDL_GPUBlitInfo *info = &infos[i];
+            TextureCommonHeader *src_header = (TextureCommonHeader *)info->source.texture;
+            TextureCommonHeader *dst_header = (TextureCommonHeader *)info->destination.texture;
+
+            blit_pipeline = SDL_GPU_FetchBlitPipeline(
+                cmdbufHeader->device,
+                src_header->info.type,
+                dst_header->info.format,
+                blit_vertex_shader,
+                blit_from_2d_shader,
+                blit_from_2d_array_shader,
+                blit_from_3d_shader,
+                blit_from_cube_shader,
+                blit_from_cube_array_shader,
+                blit_pipelines,
+                blit_pipeline_count,
+                blit_pipeline_capacity);
+
+            SDL_assert(blit_pipeline != NULL);
+
+            viewport.x = (float)info->destination.x;
+            viewport.y = (float)info->destination.y;
+            viewport.w = (float)info->destination.w;
+            viewport.h = (float)info->destination.h;
+            viewport.min_depth = 0;
+            viewport.max_depth = 1;
+
+            SDL_SetGPUViewport(
+                render_pass,
+                &viewport);
+
+            if (blit_pipeline != bound_pipeline) {
+                SDL_BindGPUGraphicsPipeline(
+                    render_pass,
+                    blit_pipeline);
+                bound_pipeline = blit_pipeline;
+            }
 
-    blit_pipeline = SDL_GPU_FetchBlitPipeline(
-        cmdbufHeader->device,
-        src_header->info.type,
-        dst_header->info.format,
-        blit_vertex_shader,
-        blit_from_2d_shader,
-        blit_from_2d_array_shader,
-        blit_from_3d_shader,
-        blit_from_cube_shader,
-        blit_from_cube_array_shader,
-        blit_pipelines,
-        blit_pipeline_count,
-        blit_pipeline_capacity);
-
-    SDL_assert(blit_pipeline != NULL);
-
-    color_target_info.load_op = info->load_op;
-    color_target_info.clear_color = info->clear_color;
-    color_target_info.store_op = SDL_GPU_STOREOP_STORE;
-
-    color_target_info.texture = info->destination.texture;
-    color_target_info.mip_level = info->destination.mip_level;
-    color_target_info.layer_or_depth_plane = info->destination.layer_or_depth_plane;
-    color_target_info.cycle = info->cycle;
-
-    render_pass = SDL_BeginGPURenderPass(
-        command_buffer,
-        &color_target_info,
-        1,
-        NULL);
-
-    viewport.x = (float)info->destination.x;
-    viewport.y = (float)info->destination.y;
-    viewport.w = (float)info->destination.w;
-    viewport.h = (float)info->destination.h;
-    viewport.min_depth = 0;
-    viewport.max_depth = 1;
+            texture_sampler_binding.texture = info->source.texture;
+            texture_sampler_binding.sampler =
+                info->filter == SDL_GPU_FILTER_NEAREST ? blit_nearest_sampler : blit_linear_sampler;
 
-    SDL_SetGPUViewport(
-        render_pass,
-        &viewport);
+            SDL_BindGPUFragmentSamplers(
+                render_pass,
+                0,
+                &texture_sampler_binding,
+                1);
 
-    SDL_BindGPUGraphicsPipeline(
-        render_pass,
-        blit_pipeline);
+            blit_fragment_uniforms.left = (float)info->source.x / (src_header->info.width >> info->source.mip_level);
+            blit_fragment_uniforms.top = (float)info->source.y / (src_header->info.height >> info->source.mip_level);
+            blit_fragment_uniforms.width = (float)info->source.w / (src_header->info.width >> info->source.mip_level);
+            blit_fragment_uniforms.height = (float)info->source.h / (src_header->info.height >> info->source.mip_level);
+            blit_fragment_uniforms.mip_level = info->source.mip_level;
 
-    texture_sampler_binding.texture = info->source.texture;
-    texture_sampler_binding.sampler =
-        info->filter == SDL_GPU_FILTER_NEAREST ? blit_nearest_sampler : blit_linear_sampler;
+            layer_divisor = (src_header->info.type == SDL_GPU_TEXTURETYPE_3D) ? src_header->info.layer_count_or_depth : 1;
+            blit_fragment_uniforms.layer_or_depth = (float)info->source.layer_or_depth_plane / layer_divisor;
 
-    SDL_BindGPUFragmentSamplers(
-        render_pass,
-        0,
-        &texture_sampler_binding,
-        1);
+            if (info->flip_mode & SDL_FLIP_HORIZONTAL) {
+                blit_fragment_uniforms.left += blit_fragment_uniforms.width;
+                blit_fragment_uniforms.width *= -1;
+            }
 
-    blit_fragment_uniforms.left = (float)info->source.x / (src_header->info.width >> info->source.mip_level);
-    blit_fragment_uniforms.top = (float)info->source.y / (src_header->info.height >> info->source.mip_level);
-    blit_fragment_uniforms.width = (float)info->source.w / (src_header->info.width >> info->source.mip_level);
-    blit_fragment_uniforms.height = (float)info->source.h / (src_header->info.height >> info->source.mip_level);
-    blit_fragment_uniforms.mip_level = info->source.mip_level;
+            if (info->flip_mode & SDL_FLIP_VERTICAL) {
+                blit_fragment_uniforms.top += blit_fragment_uniforms.height;
+                blit_fragment_uniforms.height *= -1;
+            }
 
-    layer_divisor = (src_header->info.type == SDL_GPU_TEXTURETYPE_3D) ? src_header->info.layer_count_or_depth : 1;
-    blit_fragment_uniforms.layer_or_depth = (float)info->source.layer_or_depth_plane / layer_divisor;
+            SDL_PushGPUFragmentUniformData(
+                command_buffer,
+                0,
+                &blit_fragment_uniforms,
+                sizeof(blit_fragment_uniforms));
 
-    if (info->flip_mode & SDL_FLIP_HORIZONTAL) {
-        blit_fragment_uniforms.left += blit_fragment_uniforms.width;
-        blit_fragment_uniforms.width *= -1;
-    }
+            SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+            i += 1;
+        } while (i < num_blits && SDL_GPU_BlitCanJoinRenderPass(first, &infos[i]));
 
-    if (info->flip_mode & SDL_FLIP_VERTICAL) {
-        blit_fragment_uniforms.top += blit_fragment_uniforms.height;
-        blit_fragment_uniforms.height *= -1;
+        SDL_EndGPURenderPass(render_pass);
     }
+}
 
-    SDL_PushGPUFragmentUniformData(
+void SDL_GPU_BlitCommon(
+    SDL_GPUCommandBuffer *command_buffer,
+    const SDL_GPUBlitInfo *info,
+    SDL_GPUSampler *blit_linear_sampler,
+    SDL_GPUSampler *blit_nearest_sampler,
+    SDL_GPUShader *blit_vertex_shader,
+    SDL_GPUShader *blit_from_2d_shader,
+    SDL_GPUShader *blit_from_2d_array_shader,
+    SDL_GPUShader *blit_from_3d_shader,
+    SDL_GPUShader *blit_from_cube_shader,
+    SDL_GPUShader *blit_from_cube_array_shader,
+    BlitPipelineCacheEntry **blit_pipelines,
+    Uint32 *blit_pipeline_count,
+    Uint32 *blit_pipeline_capacity)
+{
+    SDL_GPU_BlitBatchCommon(
         command_buffer,
-        0,
-        &blit_fragment_uniforms,
-        sizeof(blit_fragment_uniforms));
-
-    SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
-    SDL_EndGPURenderPass(render_pass);
+        info,
+        1,
+        blit_linear_sampler,
+        blit_nearest_sampler,
+        blit_vertex_shader,
+        blit_from_2d_shader,
+        blit_from_2d_array_shader,
+        blit_from_3d_shader,
+        blit_from_cube_shader,
+        blit_from_cube_array_shader,
+        blit_pipelines,
+        blit_pipeline_count,
+        blit_pipeline_capacity);
 }
 
 static void SDL_GPU_CheckGraphicsBindings(SDL_GPURenderPass *render_pass)
@@ -587,6 +680,147 @@ static void SDL_GPU_CheckComputeBindings(SDL_GPUComputePass *compute_pass)
     }
 }
 
+Uint64 SDL_GPU_ConvertPresentTime(
+    Uint64 timestamp,
+    Uint64 now,
+    Uint64 frequency)
+{
+    Uint64 ticks = SDL_GetTicksNS();
+    Uint64 elapsed;
+
+    if (timestamp == 0 || now == 0 || frequency == 0) {
+        return 0;
+    }
+
+    if (timestamp >= now) {
+        return ticks;
+    }
+
+    elapsed = now - timestamp;
+    if (frequency != SDL_NS_PER_SECOND) {
+        elapsed = (Uint64)((double)elapsed * SDL_NS_PER_SECOND / frequency);
+    }
+
+    return (elapsed < ticks) ? (ticks - elapsed) : 0;
+}
+
+GPU_SparseTileMap *SDL_GPU_CreateSparseTileMap(
+    const SDL_GPUTextureCreateInfo *createinfo,
+    Uint32 tileWidth,
+    Uint32 tileHeight,
+    Uint32 tileSize,
+    Uint32 firstPackedLevel)
+{
+    GPU_SparseTileMap *map;
+    Uint32 numLevels = SDL_min(firstPackedLevel, createinfo->num_levels);
+    Uint64 numTiles = 0;
+    Sint64 budget;
+
+    if (tileWidth == 0 || tileHeight == 0) {
+        SDL_SetError("Sparse texture has no tile size");
+        return NULL;
+    }
+
+    map = (GPU_SparseTileMap *)SDL_calloc(1, sizeof(GPU_SparseTileMap));
+    if (!map) {
+        return NULL;
+    }
+    map->tileWidth = tileWidth;
+    map->tileHeight = tileHeight;
+    map->tileSize = tileSize;
+    map->firstPackedLevel = numLevels;
+    map->numLayers = createinfo->layer_count_or_depth;
+
+    map->levelTileOffsets = (Uint32 *)SDL_calloc(numLevels + 1, sizeof(Uint32));
+    if (!map->levelTileOffsets) {
+        SDL_GPU_DestroySparseTileMap(map);
+        return NULL;
+    }
+    for (Uint32 level = 0; level < numLevels; level += 1) {
+        Uint32 levelWidth = SDL_max(createinfo->width >> level, 1);
+        Uint32 levelHeight = SDL_max(createinfo->height >> level, 1);
+        map->levelTileOffsets[level] = (Uint32)numTiles;
+        numTiles += (Uint64)((levelWidth + tileWidth - 1) / tileWidth) * ((levelHeight + tileHeight - 1) / tileHeight);
+    }
+    map->tilesPerLayer = (Uint32)numTiles;
+    numTiles *= map->numLayers;
+    if (numTiles >= SDL_MAX_UINT32) {
+        SDL_SetError("Sparse texture has too many tiles");
+        SDL_GPU_DestroySparseTileMap(map);
+        return NULL;
+    }
+
+    budget = SDL_GetNumberProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_TILE_BUDGET_NUMBER, (Sint64)numTiles);
+    map->numSlots = (Uint32)SDL_clamp(budget, 0, (Sint64)numTiles);
+
+    map->tileSlots = (Uint32 *)SDL_malloc((size_t)numTiles * sizeof(Uint32));
+    map->freeSlots = (Uint32 *)SDL_malloc(map->numSlots * sizeof(Uint32));
+    map->lock = SDL_CreateMutex();
+    if (!map->tileSlots || !map->freeSlots || !map->lock) {
+        SDL_GPU_DestroySparseTileMap(map);
+        return NULL;
+    }
+    SDL_memset(map->tileSlots, 0xFF, (size_t)numTiles * sizeof(Uint32));
+
+    // Hand out the lowest slots first
+    for (Uint32 i = 0; i < map->numSlots; i += 1) {
+        map->freeSlots[i] = map->numSlots - 1 - i;
+    }
+    map->numFreeSlots = map->numSlots;
+
+    return map;
+}
+
+void SDL_GPU_DestroySparseTileMap(
+    GPU_SparseTileMap *map)
+{
+    if (!map) {
+        return;
+    }
+    SDL_DestroyMutex(map->lock);
+    SDL_free(map->levelTileOffsets);
+    SDL_free(map->tileSlots);
+    SDL_free(map->freeSlots);
+    SDL_free(map);
+}
+
+// Latency markers are kept on the window so they don't depend on which driver claimed it
+
+#define GPU_LATENCY_FRAME_COUNT    16
+#define GPU_LATENCY_MARKER_COUNT   (SDL_GPU_LATENCYMARKER_PRESENT_END + 1)
+#define GPU_WINDOW_PROPERTY_LATENCY "SDL_GPULatencyMarkerData"
+
+typedef struct GPU_LatencyFrame
+{
+    Uint64 frame_id;
+    Uint64 times[GPU_LATENCY_MARKER_COUNT];
+} GPU_LatencyFrame;
+
+static void SDLCALL SDL_GPU_CleanupLatencyFrames(void *userdata, void *value)
+{
+    SDL_free(value);
+}
+
+static GPU_LatencyFrame *SDL_GPU_FetchLatencyFrames(
+    SDL_Window *window,
+    bool create)
+{
+    SDL_PropertiesID properties = SDL_GetWindowProperties(window);
+    GPU_LatencyFrame *frames = (GPU_LatencyFrame *)SDL_GetPointerProperty(properties, GPU_WINDOW_PROPERTY_LATENCY, NULL);
+
+    if (frames == NULL && create) {
+        frames = (GPU_LatencyFrame *)SDL_calloc(GPU_LATENCY_FRAME_COUNT, sizeof(GPU_LatencyFrame));
+        if (frames == NULL) {
+            return NULL;
+        }
+        if (!SDL_SetPointerPropertyWithCleanup(properties, GPU_WINDOW_PROPERTY_LATENCY, frames, SDL_GPU_CleanupLatencyFrames, NULL)) {
+            return NULL;
+        }
+    }
+
+    return frames;
+}
+
 // Driver Functions
 
 #ifndef SDL_GPU_DISABLED
@@ -721,6 +955,8 @@ SDL_GPUDevice *SDL_CreateGPUDeviceWithProperties(SDL_PropertiesID props)
         if (result != NULL) {
             result->backend = selectedBackend->name;
             result->debug_mode = debug_mode;
+            result->async_pipelines = NULL;
+            result->bindless = NULL;
         }
     }
     return result;
@@ -730,10 +966,243 @@ SDL_GPUDevice *SDL_CreateGPUDeviceWithProperties(SDL_PropertiesID props)
 #endif // SDL_GPU_DISABLED
 }
 
+// Asynchronous pipeline compilation
+
+#define GPU_ASYNC_PIPELINE_MAX_THREADS 4
+
+typedef struct GPU_AsyncGraphicsPipeline
+{
+    SDL_GPUGraphicsPipeline *pipeline;
+    SDL_AtomicInt status;
+    bool released;
+    char *error;
+
+    // Deep copy of what the app passed in
+    SDL_GPUGraphicsPipelineCreateInfo createinfo;
+    SDL_GPUVertexBufferDescription vertex_buffer_descriptions[MAX_VERTEX_BUFFERS];
+    SDL_GPUVertexAttribute vertex_attributes[MAX_VERTEX_ATTRIBUTES];
+    SDL_GPUColorTargetDescription color_target_descriptions[MAX_COLOR_TARGET_BINDINGS];
+
+    struct GPU_AsyncGraphicsPipeline *next;
+} GPU_AsyncGraphicsPipeline;
+
+typedef struct GPU_AsyncPipelineCompiler
+{
+    SDL_GPUDevice *device;
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+    SDL_Thread *threads[GPU_ASYNC_PIPELINE_MAX_THREADS];
+    int num_threads;
+    bool shutdown;
+
+    // Jobs waiting for a worker, in submission order
+    GPU_AsyncGraphicsPipeline *queue_head;
+    GPU_AsyncGraphicsPipeline *queue_tail;
+
+    // Every handle that hasn't been released, so binds can tell them apart
+    SDL_HashTable *pipelines;
+} GPU_AsyncPipelineCompiler;
+
+static void GPU_FreeAsyncGraphicsPipeline(SDL_GPUDevice *device, GPU_AsyncGraphicsPipeline *async)
+{
+    if (async->pipeline) {
+        device->ReleaseGraphicsPipeline(device->driverData, async->pipeline);
+    }
+    SDL_DestroyProperties(async->createinfo.props);
+    SDL_free(async->error);
+    SDL_free(async);
+}
+
+static int SDLCALL GPU_AsyncPipelineThread(void *data)
+{
+    GPU_AsyncPipelineCompiler *compiler = (GPU_AsyncPipelineCompiler *)data;
+
+    SDL_LockMutex(compiler->lock);
+    for (;;) {
+        GPU_AsyncGraphicsPipeline *async;
+        SDL_GPUGraphicsPipeline *pipeline;
+        char *error = NULL;
+
+        while (!compiler->queue_head && !compiler->shutdown) {
+            SDL_WaitCondition(compiler->cond, compiler->lock);
+        }
+        if (compiler->shutdown) {
+            break;
+        }
+
+        async = compiler->queue_head;
+        compiler->queue_head = async->next;
+        if (!compiler->queue_head) {
+            compiler->queue_tail = NULL;
+        }
+        async->next = NULL;
+
+        if (async->released) {
+            GPU_FreeAsyncGraphicsPipeline(compiler->device, async);
+            continue;
+        }
+
+        SDL_UnlockMutex(compiler->lock);
+        pipeline = SDL_CreateGPUGraphicsPipeline(compiler->device, &async->createinfo);
+        if (!pipeline) {
+            error = SDL_strdup(SDL_GetError());
+        }
+        SDL_LockMutex(compiler->lock);
+
+        async->pipeline = pipeline;
+        async->error = error;
+        if (async->released) {
+            GPU_FreeAsyncGraphicsPipeline(compiler->device, async);
+        } else {
+            SDL_SetAtomicInt(&async->status, pipeline ? SDL_GPU_PIPELINESTATUS_READY : SDL_GPU_PIPELINESTATUS_FAILED);
+        }
+    }
+    SDL_UnlockMutex(compiler->lock);
+
+    return 0;
+}
+
+static GPU_AsyncPipelineCompiler *GPU_GetAsyncPipelineCompiler(SDL_GPUDevice *device)
+{
+    GPU_AsyncPipelineCompiler *compiler = (GPU_AsyncPipelineCompiler *)SDL_GetAtomicPointer((void **)&device->async_pipelines);
+    bool raced = false;
+    int num_threads;
+
+    if (compiler) {
+        return compiler;
+    }
+
+    compiler = (GPU_AsyncPipelineCompiler *)SDL_calloc(1, sizeof(*compiler));
+    if (!compiler) {
+        return NULL;
+    }
+    compiler->device = device;
+    compiler->lock = SDL_CreateMutex();
+    compiler->cond = SDL_CreateCondition();
+    compiler->pipelines = SDL_CreateHashTable(0, true, SDL_HashPointer, SDL_KeyMatchPointer, NULL, NULL);
+    if (!compiler->lock || !compiler->cond || !compiler->pipelines) {
+        goto error;
+    }
+
+    num_threads = SDL_clamp(SDL_GetNumLogicalCPUCores() / 2, 1, GPU_ASYNC_PIPELINE_MAX_THREADS);
+    for (int i = 0; i < num_threads; i += 1) {
+        compiler->threads[i] = SDL_CreateThread(GPU_AsyncPipelineThread, "SDLGPUPipeline", compiler);
+        if (!compiler->threads[i]) {
+            break;
+        }
+        compiler->num_threads += 1;
+    }
+    if (compiler->num_threads == 0) {
+        goto error;
+    }
+
+    // Another thread may have gotten here first
+    if (!SDL_CompareAndSwapAtomicPointer((void **)&device->async_pipelines, NULL, compiler)) {
+        raced = true;
+        goto error;
+    }
+    return compiler;
+
+error:
+    SDL_LockMutex(compiler->lock);
+    compiler->shutdown = true;
+    SDL_BroadcastCondition(compiler->cond);
+    SDL_UnlockMutex(compiler->lock);
+    for (int i = 0; i < compiler->num_threads; i += 1) {
+        SDL_WaitThread(compiler->threads[i], NULL);
+    }
+    SDL_DestroyHashTable(compiler->pipelines);
+    SDL_DestroyCondition(compiler->cond);
+    SDL_DestroyMutex(compiler->lock);
+    SDL_free(compiler);
+    return raced ? (GPU_AsyncPipelineCompiler *)SDL_GetAtomicPointer((void **)&device->async_pipelines) : NULL;
+}
+
+static GPU_AsyncGraphicsPipeline *GPU_FindAsyncGraphicsPipeline(SDL_GPUDevice *device, SDL_GPUGraphicsPipeline *graphics_pipeline)
+{
+    const void *async = NULL;
+
+    if (device->async_pipelines) {
+        SDL_FindInHashTable(device->async_pipelines->pipelines, graphics_pipeline, &async);
+    }
+    return (GPU_AsyncGraphicsPipeline *)async;
+}
+
+static bool SDLCALL GPU_DestroyAsyncGraphicsPipelineCallback(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    GPU_FreeAsyncGraphicsPipeline((SDL_GPUDevice *)userdata, (GPU_AsyncGraphicsPipeline *)value);
+    return true;
+}
+
+static void GPU_DestroyAsyncPipelineCompiler(SDL_GPUDevice *device)
+{
+    GPU_AsyncPipelineCompiler *compiler = device->async_pipelines;
+
+    if (!compiler) {
+        return;
+    }
+
+    // Whatever hasn't started compiling yet is dropped
+    SDL_LockMutex(compiler->lock);
+    compiler->shutdown = true;
+    SDL_BroadcastCondition(compiler->cond);
+    SDL_UnlockMutex(compiler->lock);
+    for (int i = 0; i < compiler->num_threads; i += 1) {
+        SDL_WaitThread(compiler->threads[i], NULL);
+    }
+
+    // Released jobs are only in the queue, live handles are in the table
+    while (compiler->queue_head) {
+        GPU_AsyncGraphicsPipeline *async = compiler->queue_head;
+        compiler->queue_head = async->next;
+        if (async->released) {
+            GPU_FreeAsyncGraphicsPipeline(device, async);
+        }
+    }
+    SDL_IterateHashTable(compiler->pipelines, GPU_DestroyAsyncGraphicsPipelineCallback, device);
+
+    SDL_DestroyHashTable(compiler->pipelines);
+    SDL_DestroyCondition(compiler->cond);
+    SDL_DestroyMutex(compiler->lock);
+    SDL_free(compiler);
+    device->async_pipelines = NULL;
+}
+
+typedef struct GPU_BindlessTable
+{
+    SDL_Mutex *lock;
+    Uint32 capacity[GPU_BINDLESS_TYPE_COUNT];
+    Uint32 next_index[GPU_BINDLESS_TYPE_COUNT];
+
+    // Removed indices, handed out again before next_index grows
+    Uint32 *free_indices[GPU_BINDLESS_TYPE_COUNT];
+    Uint32 free_count[GPU_BINDLESS_TYPE_COUNT];
+    Uint32 free_capacity[GPU_BINDLESS_TYPE_COUNT];
+} GPU_BindlessTable;
+
+static void GPU_DestroyBindlessTable(SDL_GPUDevice *device)
+{
+    GPU_BindlessTable *table = device->bindless;
+
+    if (!table) {
+        return;
+    }
+
+    for (int i = 0; i < GPU_BINDLESS_TYPE_COUNT; i += 1) {
+        SDL_free(table->free_indices[i]);
+    }
+    SDL_DestroyMutex(table->lock);
+    SDL_free(table);
+    device->bindless = NULL;
+}
+
 void SDL_DestroyGPUDevice(SDL_GPUDevice *device)
 {
     CHECK_DEVICE_MAGIC(device, );
 
+    GPU_DestroyAsyncPipelineCompiler(device);
+    GPU_DestroyBindlessTable(device);
+
     device->DestroyDevice(device);
 }
 
@@ -780,6 +1249,36 @@ SDL_PropertiesID SDL_GetGPUDeviceProperties(SDL_GPUDevice *device)
     return device->GetDeviceProperties(device);
 }
 
+void *SDL_GetGPUPipelineCacheData(SDL_GPUDevice *device, size_t *size)
+{
+    if (size) {
+        *size = 0;
+    }
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+    if (!size) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+
+    return device->GetPipelineCacheData(device, size);
+}
+
+SDL_GPUMemoryInfo *SDL_GetGPUMemoryInfo(SDL_GPUDevice *device, int *count)
+{
+    int dummy;
+
+    if (!count) {
+        count = &dummy;
+    }
+    *count = 0;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+    return device->GetMemoryInfo(device, count);
+}
+
 Uint32 SDL_GPUTextureFormatTexelBlockSize(
     SDL_GPUTextureFormat format)
 {
@@ -946,45 +1445,108 @@ bool SDL_GPUTextureSupportsSampleCount(
         sample_count);
 }
 
-// State Creation
-
-SDL_GPUComputePipeline *SDL_CreateGPUComputePipeline(
+bool SDL_GPUTextureSupportsSparse(
     SDL_GPUDevice *device,
-    const SDL_GPUComputePipelineCreateInfo *createinfo)
+    SDL_GPUTextureFormat format,
+    SDL_GPUTextureType type,
+    SDL_GPUTextureUsageFlags usage)
 {
-    CHECK_DEVICE_MAGIC(device, NULL);
-    if (createinfo == NULL) {
-        SDL_InvalidParamError("createinfo");
-        return NULL;
-    }
+    CHECK_DEVICE_MAGIC(device, false);
 
     if (device->debug_mode) {
-        if (createinfo->format == SDL_GPU_SHADERFORMAT_INVALID) {
-            SDL_assert_release(!"Shader format cannot be INVALID!");
-            return NULL;
-        }
-        if (!(createinfo->format & device->shader_formats)) {
-            SDL_assert_release(!"Incompatible shader format for GPU backend");
-            return NULL;
-        }
-        if (createinfo->num_readwrite_storage_textures > MAX_COMPUTE_WRITE_TEXTURES) {
-            SDL_assert_release(!"Compute pipeline write-only texture count cannot be higher than 8!");
-            return NULL;
-        }
-        if (createinfo->num_readwrite_storage_buffers > MAX_COMPUTE_WRITE_BUFFERS) {
-            SDL_assert_release(!"Compute pipeline write-only buffer count cannot be higher than 8!");
-            return NULL;
-        }
-        if (createinfo->threadcount_x == 0 ||
-            createinfo->threadcount_y == 0 ||
-            createinfo->threadcount_z == 0) {
-            SDL_assert_release(!"Compute pipeline threadCount dimensions must be at least 1!");
-            return NULL;
-        }
+        CHECK_TEXTUREFORMAT_ENUM_INVALID(format, false)
     }
 
-    return device->CreateComputePipeline(
-        device->driverData,
+    if (!device->SupportsSparseTexture) {
+        return false;
+    }
+    if (type != SDL_GPU_TEXTURETYPE_2D && type != SDL_GPU_TEXTURETYPE_2D_ARRAY) {
+        return false;
+    }
+    if (IsDepthFormat(format) || (usage & (SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET | SDL_GPU_TEXTUREUSAGE_TRANSIENT))) {
+        return false;
+    }
+    if (!SDL_GPUTextureSupportsFormat(device, format, type, usage)) {
+        return false;
+    }
+
+    return device->SupportsSparseTexture(
+        device->driverData,
+        format,
+        type,
+        usage);
+}
+
+bool SDL_GPUSupportsShadingRate(
+    SDL_GPUDevice *device,
+    SDL_GPUShadingRate rate)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+
+    if (rate == SDL_GPU_SHADINGRATE_1X1) {
+        return true;
+    }
+    if (!device->SupportsShadingRate) {
+        return false;
+    }
+
+    return device->SupportsShadingRate(
+        device->driverData,
+        rate);
+}
+
+Uint32 SDL_GetGPUShadingRateImageTileSize(
+    SDL_GPUDevice *device)
+{
+    CHECK_DEVICE_MAGIC(device, 0);
+
+    if (!device->GetShadingRateImageTileSize) {
+        return 0;
+    }
+
+    return device->GetShadingRateImageTileSize(
+        device->driverData);
+}
+
+// State Creation
+
+SDL_GPUComputePipeline *SDL_CreateGPUComputePipeline(
+    SDL_GPUDevice *device,
+    const SDL_GPUComputePipelineCreateInfo *createinfo)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+
+    if (device->debug_mode) {
+        if (createinfo->format == SDL_GPU_SHADERFORMAT_INVALID) {
+            SDL_assert_release(!"Shader format cannot be INVALID!");
+            return NULL;
+        }
+        if (!(createinfo->format & device->shader_formats)) {
+            SDL_assert_release(!"Incompatible shader format for GPU backend");
+            return NULL;
+        }
+        if (createinfo->num_readwrite_storage_textures > MAX_COMPUTE_WRITE_TEXTURES) {
+            SDL_assert_release(!"Compute pipeline write-only texture count cannot be higher than 8!");
+            return NULL;
+        }
+        if (createinfo->num_readwrite_storage_buffers > MAX_COMPUTE_WRITE_BUFFERS) {
+            SDL_assert_release(!"Compute pipeline write-only buffer count cannot be higher than 8!");
+            return NULL;
+        }
+        if (createinfo->threadcount_x == 0 ||
+            createinfo->threadcount_y == 0 ||
+            createinfo->threadcount_z == 0) {
+            SDL_assert_release(!"Compute pipeline threadCount dimensions must be at least 1!");
+            return NULL;
+        }
+    }
+
+    return device->CreateComputePipeline(
+        device->driverData,
         createinfo);
 }
 
@@ -1115,6 +1677,108 @@ SDL_GPUGraphicsPipeline *SDL_CreateGPUGraphicsPipeline(
         graphicsPipelineCreateInfo);
 }
 
+SDL_GPUGraphicsPipeline *SDL_CreateGPUGraphicsPipelineAsync(
+    SDL_GPUDevice *device,
+    const SDL_GPUGraphicsPipelineCreateInfo *createinfo)
+{
+    GPU_AsyncPipelineCompiler *compiler;
+    GPU_AsyncGraphicsPipeline *async;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+
+    // The rest is validated by SDL_CreateGPUGraphicsPipeline() on the worker
+    if (createinfo->vertex_input_state.num_vertex_buffers > MAX_VERTEX_BUFFERS ||
+        (createinfo->vertex_input_state.num_vertex_buffers > 0 && !createinfo->vertex_input_state.vertex_buffer_descriptions)) {
+        SDL_InvalidParamError("createinfo->vertex_input_state.vertex_buffer_descriptions");
+        return NULL;
+    }
+    if (createinfo->vertex_input_state.num_vertex_attributes > MAX_VERTEX_ATTRIBUTES ||
+        (createinfo->vertex_input_state.num_vertex_attributes > 0 && !createinfo->vertex_input_state.vertex_attributes)) {
+        SDL_InvalidParamError("createinfo->vertex_input_state.vertex_attributes");
+        return NULL;
+    }
+    if (createinfo->target_info.num_color_targets > MAX_COLOR_TARGET_BINDINGS ||
+        (createinfo->target_info.num_color_targets > 0 && !createinfo->target_info.color_target_descriptions)) {
+        SDL_InvalidParamError("createinfo->target_info.color_target_descriptions");
+        return NULL;
+    }
+
+    compiler = GPU_GetAsyncPipelineCompiler(device);
+    if (!compiler) {
+        return NULL;
+    }
+
+    async = (GPU_AsyncGraphicsPipeline *)SDL_calloc(1, sizeof(*async));
+    if (!async) {
+        return NULL;
+    }
+
+    async->createinfo = *createinfo;
+    SDL_memcpy(async->vertex_buffer_descriptions, createinfo->vertex_input_state.vertex_buffer_descriptions, createinfo->vertex_input_state.num_vertex_buffers * sizeof(SDL_GPUVertexBufferDescription));
+    SDL_memcpy(async->vertex_attributes, createinfo->vertex_input_state.vertex_attributes, createinfo->vertex_input_state.num_vertex_attributes * sizeof(SDL_GPUVertexAttribute));
+    SDL_memcpy(async->color_target_descriptions, createinfo->target_info.color_target_descriptions, createinfo->target_info.num_color_targets * sizeof(SDL_GPUColorTargetDescription));
+    async->createinfo.vertex_input_state.vertex_buffer_descriptions = async->vertex_buffer_descriptions;
+    async->createinfo.vertex_input_state.vertex_attributes = async->vertex_attributes;
+    async->createinfo.target_info.color_target_descriptions = async->color_target_descriptions;
+    async->createinfo.props = 0;
+    if (createinfo->props) {
+        async->createinfo.props = SDL_CreateProperties();
+        if (!async->createinfo.props || !SDL_CopyProperties(createinfo->props, async->createinfo.props)) {
+            SDL_DestroyProperties(async->createinfo.props);
+            SDL_free(async);
+            return NULL;
+        }
+    }
+    SDL_SetAtomicInt(&async->status, SDL_GPU_PIPELINESTATUS_PENDING);
+
+    SDL_LockMutex(compiler->lock);
+    if (!SDL_InsertIntoHashTable(compiler->pipelines, async, async, false)) {
+        SDL_UnlockMutex(compiler->lock);
+        SDL_DestroyProperties(async->createinfo.props);
+        SDL_free(async);
+        return NULL;
+    }
+    if (compiler->queue_tail) {
+        compiler->queue_tail->next = async;
+    } else {
+        compiler->queue_head = async;
+    }
+    compiler->queue_tail = async;
+    SDL_SignalCondition(compiler->cond);
+    SDL_UnlockMutex(compiler->lock);
+
+    return (SDL_GPUGraphicsPipeline *)async;
+}
+
+SDL_GPUPipelineStatus SDL_GetGPUGraphicsPipelineStatus(
+    SDL_GPUDevice *device,
+    SDL_GPUGraphicsPipeline *graphics_pipeline)
+{
+    GPU_AsyncGraphicsPipeline *async;
+    SDL_GPUPipelineStatus status;
+
+    CHECK_DEVICE_MAGIC(device, SDL_GPU_PIPELINESTATUS_FAILED);
+    if (graphics_pipeline == NULL) {
+        SDL_InvalidParamError("graphics_pipeline");
+        return SDL_GPU_PIPELINESTATUS_FAILED;
+    }
+
+    async = GPU_FindAsyncGraphicsPipeline(device, graphics_pipeline);
+    if (!async) {
+        return SDL_GPU_PIPELINESTATUS_READY;
+    }
+
+    status = (SDL_GPUPipelineStatus)SDL_GetAtomicInt(&async->status);
+    if (status == SDL_GPU_PIPELINESTATUS_FAILED) {
+        SDL_SetError("%s", async->error ? async->error : "Couldn't create graphics pipeline");
+    }
+    return status;
+}
+
 SDL_GPUSampler *SDL_CreateGPUSampler(
     SDL_GPUDevice *device,
     const SDL_GPUSamplerCreateInfo *createinfo)
@@ -1195,8 +1859,14 @@ SDL_GPUTexture *SDL_CreateGPUTexture(
             SDL_assert_release(!"For multisample textures: usage cannot contain SAMPLER or STORAGE flags");
             failed = true;
         }
-        if (IsDepthFormat(createinfo->format) && (createinfo->usage & ~(SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER))) {
-            SDL_assert_release(!"For depth textures: usage cannot contain any flags except for DEPTH_STENCIL_TARGET and SAMPLER");
+        if (IsDepthFormat(createinfo->format) && (createinfo->usage & ~(SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_TRANSIENT))) {
+            SDL_assert_release(!"For depth textures: usage cannot contain any flags except for DEPTH_STENCIL_TARGET, SAMPLER and TRANSIENT");
+            failed = true;
+        }
+        if ((createinfo->usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) &&
+            (!(createinfo->usage & (SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET)) ||
+             (createinfo->usage & ~(SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET | SDL_GPU_TEXTUREUSAGE_TRANSIENT)))) {
+            SDL_assert_release(!"For transient textures: usage must contain COLOR_TARGET or DEPTH_STENCIL_TARGET, and no other flags");
             failed = true;
         }
         if (IsIntegerFormat(createinfo->format) && (createinfo->usage & SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
@@ -1293,6 +1963,14 @@ SDL_GPUTexture *SDL_CreateGPUTexture(
         }
     }
 
+    if (SDL_GetBooleanProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN, false)) {
+        if (createinfo->sample_count > SDL_GPU_SAMPLECOUNT_1 ||
+            !SDL_GPUTextureSupportsSparse(device, createinfo->format, createinfo->type, createinfo->usage)) {
+            SDL_SetError("Sparse textures are not supported with this format, type and usage");
+            return NULL;
+        }
+    }
+
     return device->CreateTexture(
         device->driverData,
         createinfo);
@@ -1336,6 +2014,240 @@ SDL_GPUTransferBuffer *SDL_CreateGPUTransferBuffer(
         debugName);
 }
 
+SDL_GPUQueryPool *SDL_CreateGPUQueryPool(
+    SDL_GPUDevice *device,
+    const SDL_GPUQueryPoolCreateInfo *createinfo)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+    if (createinfo->type != SDL_GPU_QUERYTYPE_TIMESTAMP) {
+        SDL_InvalidParamError("createinfo->type");
+        return NULL;
+    }
+    if (createinfo->num_queries == 0) {
+        SDL_InvalidParamError("createinfo->num_queries");
+        return NULL;
+    }
+
+    return device->CreateQueryPool(
+        device->driverData,
+        createinfo);
+}
+
+// Bindless Resources
+
+static const char *GPU_BindlessTypeName(GPU_BindlessType type)
+{
+    switch (type) {
+    case GPU_BINDLESS_TEXTURE:
+        return "texture";
+    case GPU_BINDLESS_SAMPLER:
+        return "sampler";
+    case GPU_BINDLESS_BUFFER:
+        return "buffer";
+    default:
+        return "unknown";
+    }
+}
+
+static GPU_BindlessTable *GPU_GetBindlessTable(SDL_GPUDevice *device)
+{
+    GPU_BindlessTable *table = (GPU_BindlessTable *)SDL_GetAtomicPointer((void **)&device->bindless);
+    SDL_PropertiesID props;
+
+    if (table) {
+        return table;
+    }
+
+    props = device->GetDeviceProperties(device);
+    if (!SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN, false)) {
+        SDL_SetError("Bindless resources are not enabled on this device");
+        return NULL;
+    }
+
+    table = (GPU_BindlessTable *)SDL_calloc(1, sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+    table->lock = SDL_CreateMutex();
+    if (!table->lock) {
+        SDL_free(table);
+        return NULL;
+    }
+    table->capacity[GPU_BINDLESS_TEXTURE] = (Uint32)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_TEXTURES_NUMBER, 0);
+    table->capacity[GPU_BINDLESS_SAMPLER] = (Uint32)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_SAMPLERS_NUMBER, 0);
+    table->capacity[GPU_BINDLESS_BUFFER] = (Uint32)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_BUFFERS_NUMBER, 0);
+
+    // Another thread may have gotten here first
+    if (!SDL_CompareAndSwapAtomicPointer((void **)&device->bindless, NULL, table)) {
+        SDL_DestroyMutex(table->lock);
+        SDL_free(table);
+        return (GPU_BindlessTable *)SDL_GetAtomicPointer((void **)&device->bindless);
+    }
+    return table;
+}
+
+static bool GPU_AddBindlessResource(
+    SDL_GPUDevice *device,
+    GPU_BindlessType type,
+    void *resource,
+    Uint32 *index)
+{
+    GPU_BindlessTable *table;
+    Uint32 slot;
+    bool reused = false;
+    bool result;
+
+    table = GPU_GetBindlessTable(device);
+    if (!table) {
+        return false;
+    }
+
+    SDL_LockMutex(table->lock);
+
+    if (table->free_count[type] > 0) {
+        table->free_count[type] -= 1;
+        slot = table->free_indices[type][table->free_count[type]];
+        reused = true;
+    } else if (table->next_index[type] < table->capacity[type]) {
+        slot = table->next_index[type];
+        table->next_index[type] += 1;
+    } else {
+        SDL_UnlockMutex(table->lock);
+        return SDL_SetError("The bindless %s heap is full (%" SDL_PRIu32 " entries)", GPU_BindlessTypeName(type), table->capacity[type]);
+    }
+
+    result = device->WriteBindlessDescriptor(device->driverData, type, slot, resource);
+    if (result) {
+        *index = slot;
+    } else if (reused) {
+        table->free_count[type] += 1;
+    } else {
+        table->next_index[type] -= 1;
+    }
+
+    SDL_UnlockMutex(table->lock);
+    return result;
+}
+
+static void GPU_RemoveBindlessResource(
+    SDL_GPUDevice *device,
+    GPU_BindlessType type,
+    Uint32 index)
+{
+    GPU_BindlessTable *table = (GPU_BindlessTable *)SDL_GetAtomicPointer((void **)&device->bindless);
+
+    if (!table) {
+        return;
+    }
+
+    SDL_LockMutex(table->lock);
+
+    if (index >= table->next_index[type]) {
+        SDL_UnlockMutex(table->lock);
+        if (device->debug_mode) {
+            SDL_assert_release(!"Bindless index was never added!");
+        }
+        return;
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        table->free_indices[type],
+        Uint32,
+        table->free_count[type] + 1,
+        table->free_capacity[type],
+        table->next_index[type]);
+    table->free_indices[type][table->free_count[type]] = index;
+    table->free_count[type] += 1;
+
+    SDL_UnlockMutex(table->lock);
+}
+
+bool SDL_AddGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    Uint32 *index)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (texture == NULL) {
+        return SDL_InvalidParamError("texture");
+    }
+    if (index == NULL) {
+        return SDL_InvalidParamError("index");
+    }
+
+    if (device->debug_mode) {
+        if (!(((TextureCommonHeader *)texture)->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
+            SDL_assert_release(!"Bindless textures must have the SAMPLER usage flag!");
+            return false;
+        }
+    }
+
+    return GPU_AddBindlessResource(device, GPU_BINDLESS_TEXTURE, texture, index);
+}
+
+bool SDL_AddGPUBindlessSampler(
+    SDL_GPUDevice *device,
+    SDL_GPUSampler *sampler,
+    Uint32 *index)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (sampler == NULL) {
+        return SDL_InvalidParamError("sampler");
+    }
+    if (index == NULL) {
+        return SDL_InvalidParamError("index");
+    }
+
+    return GPU_AddBindlessResource(device, GPU_BINDLESS_SAMPLER, sampler, index);
+}
+
+bool SDL_AddGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (buffer == NULL) {
+        return SDL_InvalidParamError("buffer");
+    }
+    if (index == NULL) {
+        return SDL_InvalidParamError("index");
+    }
+
+    return GPU_AddBindlessResource(device, GPU_BINDLESS_BUFFER, buffer, index);
+}
+
+void SDL_RemoveGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    Uint32 index)
+{
+    CHECK_DEVICE_MAGIC(device, );
+
+    GPU_RemoveBindlessResource(device, GPU_BINDLESS_TEXTURE, index);
+}
+
+void SDL_RemoveGPUBindlessSampler(
+    SDL_GPUDevice *device,
+    Uint32 index)
+{
+    CHECK_DEVICE_MAGIC(device, );
+
+    GPU_RemoveBindlessResource(device, GPU_BINDLESS_SAMPLER, index);
+}
+
+void SDL_RemoveGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    Uint32 index)
+{
+    CHECK_DEVICE_MAGIC(device, );
+
+    GPU_RemoveBindlessResource(device, GPU_BINDLESS_BUFFER, index);
+}
+
 // Debug Naming
 
 void SDL_SetGPUBufferName(
@@ -1438,16 +2350,169 @@ void SDL_PopGPUDebugGroup(
         command_buffer);
 }
 
-// Disposal
+#ifdef HAVE_RENDERDOC
 
-void SDL_ReleaseGPUTexture(
-    SDL_GPUDevice *device,
-    SDL_GPUTexture *texture)
+// The start of RENDERDOC_API_1_1_2 from renderdoc_app.h, up to the functions we use
+typedef struct RenderDocAPI
 {
-    CHECK_DEVICE_MAGIC(device, );
-    if (texture == NULL) {
-        return;
-    }
+    void *GetAPIVersion;
+    void *SetCaptureOptionU32;
+    void *SetCaptureOptionF32;
+    void *GetCaptureOptionU32;
+    void *GetCaptureOptionF32;
+    void *SetFocusToggleKeys;
+    void *SetCaptureKeys;
+    void *GetOverlayBits;
+    void *MaskOverlayBits;
+    void *RemoveHooks;
+    void *UnloadCrashHandler;
+    void (SDLCALL *SetCaptureFilePathTemplate)(const char *pathtemplate);
+    void *GetCaptureFilePathTemplate;
+    void *GetNumCaptures;
+    void *GetCapture;
+    void *TriggerCapture;
+    void *IsTargetControlConnected;
+    void *LaunchReplayUI;
+    void *SetActiveWindow;
+    void (SDLCALL *StartFrameCapture)(void *device, void *window);
+    Uint32 (SDLCALL *IsFrameCapturing)(void);
+    Uint32 (SDLCALL *EndFrameCapture)(void *device, void *window);
+} RenderDocAPI;
+
+#define RENDERDOC_API_VERSION_1_1_2 10102
+
+typedef int (SDLCALL *RenderDocGetAPIFunc)(int version, void **api);
+
+// RenderDoc has to be injected when the process starts, so only look for it if it's already loaded
+static RenderDocAPI *GPU_GetRenderDoc(void)
+{
+    RenderDocGetAPIFunc get_api = NULL;
+    void *api = NULL;
+
+#ifdef SDL_PLATFORM_WINDOWS
+    HMODULE module = GetModuleHandleA(RENDERDOC_MODULE);
+    if (module) {
+        get_api = (RenderDocGetAPIFunc)GetProcAddress(module, "RENDERDOC_GetAPI");
+    }
+#else
+    void *module = dlopen(RENDERDOC_MODULE, RTLD_NOW | RTLD_NOLOAD);
+    if (module) {
+        get_api = (RenderDocGetAPIFunc)dlsym(module, "RENDERDOC_GetAPI");
+        dlclose(module);
+    }
+#endif
+
+    if (!get_api || !get_api(RENDERDOC_API_VERSION_1_1_2, &api)) {
+        return NULL;
+    }
+    return (RenderDocAPI *)api;
+}
+
+#endif // HAVE_RENDERDOC
+
+bool SDL_BeginGPUCapture(
+    SDL_GPUDevice *device,
+    const char *path)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+
+    if (device->capture_tool != GPU_CAPTURE_NONE) {
+        return SDL_SetError("A GPU capture is already in progress");
+    }
+
+#ifdef HAVE_RENDERDOC
+    RenderDocAPI *renderdoc = GPU_GetRenderDoc();
+    if (renderdoc) {
+        if (path) {
+            renderdoc->SetCaptureFilePathTemplate(path);
+        }
+        renderdoc->StartFrameCapture(NULL, NULL);
+        device->capture_tool = GPU_CAPTURE_RENDERDOC;
+        return true;
+    }
+#endif
+
+    if (!device->BeginCapture) {
+        return SDL_SetError("No GPU capture tool is attached");
+    }
+    if (!device->BeginCapture(device->driverData, path)) {
+        return false;
+    }
+    device->capture_tool = GPU_CAPTURE_BACKEND;
+    return true;
+}
+
+bool SDL_EndGPUCapture(
+    SDL_GPUDevice *device)
+{
+    GPU_CaptureTool tool;
+
+    CHECK_DEVICE_MAGIC(device, false);
+
+    tool = device->capture_tool;
+    device->capture_tool = GPU_CAPTURE_NONE;
+
+    switch (tool) {
+#ifdef HAVE_RENDERDOC
+    case GPU_CAPTURE_RENDERDOC:
+    {
+        RenderDocAPI *renderdoc = GPU_GetRenderDoc();
+        if (!renderdoc || !renderdoc->EndFrameCapture(NULL, NULL)) {
+            return SDL_SetError("RenderDoc couldn't finish the capture");
+        }
+        return true;
+    }
+#endif
+    case GPU_CAPTURE_BACKEND:
+        return device->EndCapture(device->driverData);
+    default:
+        return SDL_SetError("No GPU capture is in progress");
+    }
+}
+
+void SDL_WriteGPUTimestamp(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUQueryPool *query_pool,
+    Uint32 index)
+{
+    if (command_buffer == NULL) {
+        SDL_InvalidParamError("command_buffer");
+        return;
+    }
+    if (query_pool == NULL) {
+        SDL_InvalidParamError("query_pool");
+        return;
+    }
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER
+        CHECK_ANY_PASS_IN_PROGRESS("Cannot write a timestamp during a pass!", )
+        if (((QueryPoolCommonHeader *)query_pool)->type != SDL_GPU_QUERYTYPE_TIMESTAMP) {
+            SDL_assert_release(!"Query pool does not hold timestamp queries!");
+            return;
+        }
+        if (index >= ((QueryPoolCommonHeader *)query_pool)->numQueries) {
+            SDL_assert_release(!"Query index is out of range!");
+            return;
+        }
+    }
+
+    COMMAND_BUFFER_DEVICE->WriteTimestamp(
+        command_buffer,
+        query_pool,
+        index);
+}
+
+// Disposal
+
+void SDL_ReleaseGPUTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture)
+{
+    CHECK_DEVICE_MAGIC(device, );
+    if (texture == NULL) {
+        return;
+    }
 
     device->ReleaseTexture(
         device->driverData,
@@ -1524,6 +2589,20 @@ void SDL_ReleaseGPUComputePipeline(
         compute_pipeline);
 }
 
+void SDL_ReleaseGPUQueryPool(
+    SDL_GPUDevice *device,
+    SDL_GPUQueryPool *query_pool)
+{
+    CHECK_DEVICE_MAGIC(device, );
+    if (query_pool == NULL) {
+        return;
+    }
+
+    device->ReleaseQueryPool(
+        device->driverData,
+        query_pool);
+}
+
 void SDL_ReleaseGPUGraphicsPipeline(
     SDL_GPUDevice *device,
     SDL_GPUGraphicsPipeline *graphics_pipeline)
@@ -1533,6 +2612,22 @@ void SDL_ReleaseGPUGraphicsPipeline(
         return;
     }
 
+    GPU_AsyncGraphicsPipeline *async = GPU_FindAsyncGraphicsPipeline(device, graphics_pipeline);
+    if (async) {
+        GPU_AsyncPipelineCompiler *compiler = device->async_pipelines;
+
+        // A pending job is freed by whoever finishes with it last
+        SDL_LockMutex(compiler->lock);
+        SDL_RemoveFromHashTable(compiler->pipelines, async);
+        if (SDL_GetAtomicInt(&async->status) == SDL_GPU_PIPELINESTATUS_PENDING) {
+            async->released = true;
+        } else {
+            GPU_FreeAsyncGraphicsPipeline(device, async);
+        }
+        SDL_UnlockMutex(compiler->lock);
+        return;
+    }
+
     device->ReleaseGraphicsPipeline(
         device->driverData,
         graphics_pipeline);
@@ -1542,14 +2637,27 @@ void SDL_ReleaseGPUGraphicsPipeline(
 
 SDL_GPUCommandBuffer *SDL_AcquireGPUCommandBuffer(
     SDL_GPUDevice *device)
+{
+    return SDL_AcquireGPUCommandBufferForQueue(device, SDL_GPU_QUEUETYPE_GRAPHICS);
+}
+
+SDL_GPUCommandBuffer *SDL_AcquireGPUCommandBufferForQueue(
+    SDL_GPUDevice *device,
+    SDL_GPUQueueType queue)
 {
     SDL_GPUCommandBuffer *command_buffer;
     CommandBufferCommonHeader *commandBufferHeader;
 
     CHECK_DEVICE_MAGIC(device, NULL);
 
+    if (queue < SDL_GPU_QUEUETYPE_GRAPHICS || queue > SDL_GPU_QUEUETYPE_COPY) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    }
+
     command_buffer = device->AcquireCommandBuffer(
-        device->driverData);
+        device->driverData,
+        queue);
 
     if (command_buffer == NULL) {
         return NULL;
@@ -1557,6 +2665,7 @@ SDL_GPUCommandBuffer *SDL_AcquireGPUCommandBuffer(
 
     commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
     commandBufferHeader->device = device;
+    commandBufferHeader->queue_type = queue;
     commandBufferHeader->render_pass.command_buffer = command_buffer;
     commandBufferHeader->compute_pass.command_buffer = command_buffer;
     commandBufferHeader->copy_pass.command_buffer = command_buffer;
@@ -1667,6 +2776,37 @@ void SDL_PushGPUComputeUniformData(
 
 // Render Pass
 
+void SDL_SetGPUShadingRateImage(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUTexture *texture)
+{
+    if (command_buffer == NULL) {
+        SDL_InvalidParamError("command_buffer");
+        return;
+    }
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER
+        CHECK_ANY_PASS_IN_PROGRESS("Cannot set the shading rate image during a pass!", )
+
+        if (texture != NULL) {
+            TextureCommonHeader *textureHeader = (TextureCommonHeader *)texture;
+            if (textureHeader->info.format != SDL_GPU_TEXTUREFORMAT_R8_UINT || textureHeader->info.type != SDL_GPU_TEXTURETYPE_2D) {
+                SDL_assert_release(!"Shading rate image must be a 2D R8_UINT texture!");
+                return;
+            }
+        }
+    }
+
+    if (COMMAND_BUFFER_DEVICE->SetShadingRateImage == NULL) {
+        return;
+    }
+
+    COMMAND_BUFFER_DEVICE->SetShadingRateImage(
+        command_buffer,
+        texture);
+}
+
 SDL_GPURenderPass *SDL_BeginGPURenderPass(
     SDL_GPUCommandBuffer *command_buffer,
     const SDL_GPUColorTargetInfo *color_target_infos,
@@ -1689,6 +2829,8 @@ SDL_GPURenderPass *SDL_BeginGPURenderPass(
         return NULL;
     }
 
+    CHECK_GRAPHICS_QUEUE("Render passes require a graphics queue command buffer", NULL)
+
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER_RETURN_NULL
         CHECK_ANY_PASS_IN_PROGRESS("Cannot begin render pass during another pass!", NULL)
@@ -1701,6 +2843,17 @@ SDL_GPURenderPass *SDL_BeginGPURenderPass(
                 return NULL;
             }
 
+            if (textureHeader->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+                if (color_target_infos[i].load_op == SDL_GPU_LOADOP_LOAD) {
+                    SDL_assert_release(!"Cannot load the contents of a transient color target!");
+                    return NULL;
+                }
+                if (color_target_infos[i].store_op == SDL_GPU_STOREOP_STORE || color_target_infos[i].store_op == SDL_GPU_STOREOP_RESOLVE_AND_STORE) {
+                    SDL_assert_release(!"Cannot store the contents of a transient color target!");
+                    return NULL;
+                }
+            }
+
             if (color_target_infos[i].store_op == SDL_GPU_STOREOP_RESOLVE || color_target_infos[i].store_op == SDL_GPU_STOREOP_RESOLVE_AND_STORE) {
                 if (color_target_infos[i].resolve_texture == NULL) {
                     SDL_assert_release(!"Store op is RESOLVE or RESOLVE_AND_STORE but resolve_texture is NULL!");
@@ -1727,6 +2880,10 @@ SDL_GPURenderPass *SDL_BeginGPURenderPass(
                         SDL_assert_release(!"Resolve texture usage must include COLOR_TARGET!");
                         return NULL;
                     }
+                    if (resolveTextureHeader->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+                        SDL_assert_release(!"Resolve texture must not be transient!");
+                        return NULL;
+                    }
                 }
             }
 
@@ -1749,6 +2906,17 @@ SDL_GPURenderPass *SDL_BeginGPURenderPass(
                 return NULL;
             }
 
+            if (textureHeader->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+                if (depth_stencil_target_info->load_op == SDL_GPU_LOADOP_LOAD || depth_stencil_target_info->stencil_load_op == SDL_GPU_LOADOP_LOAD) {
+                    SDL_assert_release(!"Cannot load the contents of a transient depth target!");
+                    return NULL;
+                }
+                if (depth_stencil_target_info->store_op == SDL_GPU_STOREOP_STORE || depth_stencil_target_info->stencil_store_op == SDL_GPU_STOREOP_STORE) {
+                    SDL_assert_release(!"Cannot store the contents of a transient depth target!");
+                    return NULL;
+                }
+            }
+
             if (depth_stencil_target_info->cycle && (depth_stencil_target_info->load_op == SDL_GPU_LOADOP_LOAD || depth_stencil_target_info->stencil_load_op == SDL_GPU_LOADOP_LOAD)) {
                 SDL_assert_release(!"Cannot cycle depth target when load op or stencil load op is LOAD!");
                 return NULL;
@@ -1799,6 +2967,15 @@ void SDL_BindGPUGraphicsPipeline(
         return;
     }
 
+    GPU_AsyncGraphicsPipeline *async = GPU_FindAsyncGraphicsPipeline(RENDERPASS_DEVICE, graphics_pipeline);
+    if (async) {
+        if (SDL_GetAtomicInt(&async->status) != SDL_GPU_PIPELINESTATUS_READY) {
+            SDL_SetError("Graphics pipeline is not ready");
+            return;
+        }
+        graphics_pipeline = async->pipeline;
+    }
+
     RENDERPASS_DEVICE->BindGraphicsPipeline(
         RENDERPASS_COMMAND_BUFFER,
         graphics_pipeline);
@@ -1888,6 +3065,29 @@ void SDL_SetGPUStencilReference(
         reference);
 }
 
+void SDL_SetGPUShadingRate(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUShadingRate rate)
+{
+    if (render_pass == NULL) {
+        SDL_InvalidParamError("render_pass");
+        return;
+    }
+
+    if (RENDERPASS_DEVICE->debug_mode) {
+        CHECK_RENDERPASS
+    }
+
+    if (RENDERPASS_DEVICE->SetShadingRate == NULL ||
+        !RENDERPASS_DEVICE->SupportsShadingRate(RENDERPASS_DEVICE->driverData, rate)) {
+        return;
+    }
+
+    RENDERPASS_DEVICE->SetShadingRate(
+        RENDERPASS_COMMAND_BUFFER,
+        rate);
+}
+
 void SDL_BindGPUVertexBuffers(
     SDL_GPURenderPass *render_pass,
     Uint32 first_binding,
@@ -2238,6 +3438,86 @@ void SDL_DrawGPUIndexedPrimitivesIndirect(
         draw_count);
 }
 
+void SDL_DrawGPUPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count)
+{
+    if (render_pass == NULL) {
+        SDL_InvalidParamError("render_pass");
+        return;
+    }
+    if (buffer == NULL) {
+        SDL_InvalidParamError("buffer");
+        return;
+    }
+    if (count_buffer == NULL) {
+        SDL_InvalidParamError("count_buffer");
+        return;
+    }
+
+    if (RENDERPASS_DEVICE->debug_mode) {
+        CHECK_RENDERPASS
+        CHECK_GRAPHICS_PIPELINE_BOUND
+        SDL_GPU_CheckGraphicsBindings(render_pass);
+        if (count_offset % 4 != 0) {
+            SDL_assert_release(!"count_offset must be a multiple of 4");
+            return;
+        }
+    }
+
+    RENDERPASS_DEVICE->DrawPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offset,
+        count_buffer,
+        count_offset,
+        max_draw_count);
+}
+
+void SDL_DrawGPUIndexedPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count)
+{
+    if (render_pass == NULL) {
+        SDL_InvalidParamError("render_pass");
+        return;
+    }
+    if (buffer == NULL) {
+        SDL_InvalidParamError("buffer");
+        return;
+    }
+    if (count_buffer == NULL) {
+        SDL_InvalidParamError("count_buffer");
+        return;
+    }
+
+    if (RENDERPASS_DEVICE->debug_mode) {
+        CHECK_RENDERPASS
+        CHECK_GRAPHICS_PIPELINE_BOUND
+        SDL_GPU_CheckGraphicsBindings(render_pass);
+        if (count_offset % 4 != 0) {
+            SDL_assert_release(!"count_offset must be a multiple of 4");
+            return;
+        }
+    }
+
+    RENDERPASS_DEVICE->DrawIndexedPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offset,
+        count_buffer,
+        count_offset,
+        max_draw_count);
+}
+
 void SDL_EndGPURenderPass(
     SDL_GPURenderPass *render_pass)
 {
@@ -2304,6 +3584,11 @@ SDL_GPUComputePass *SDL_BeginGPUComputePass(
         SDL_InvalidParamError("num_storage_buffer_bindings");
         return NULL;
     }
+
+    if (((CommandBufferCommonHeader *)command_buffer)->queue_type == SDL_GPU_QUEUETYPE_COPY) {
+        SDL_SetError("Compute passes require a graphics or compute queue command buffer");
+        return NULL;
+    }
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER_RETURN_NULL
         CHECK_ANY_PASS_IN_PROGRESS("Cannot begin compute pass during another pass!", NULL)
@@ -2578,6 +3863,67 @@ void SDL_UnmapGPUTransferBuffer(
         transfer_buffer);
 }
 
+typedef struct GPU_TransferBufferRead
+{
+    SDL_GPUDevice *device;
+    SDL_GPUTransferBuffer *transfer_buffer;
+} GPU_TransferBufferRead;
+
+static void GPU_FinishTransferBufferRead(void *userdata, SDL_AsyncIOOutcome *outcome)
+{
+    GPU_TransferBufferRead *read = (GPU_TransferBufferRead *)userdata;
+
+    SDL_UnmapGPUTransferBuffer(read->device, read->transfer_buffer);
+    outcome->buffer = NULL;  // the mapping is gone
+    SDL_free(read);
+}
+
+bool SDL_ReadAsyncIOToGPUTransferBuffer(
+    SDL_AsyncIO *asyncio,
+    Uint64 offset,
+    Uint32 size,
+    SDL_GPUDevice *device,
+    SDL_GPUTransferBuffer *transfer_buffer,
+    Uint32 transfer_offset,
+    bool cycle,
+    SDL_AsyncIOQueue *queue,
+    void *userdata)
+{
+    GPU_TransferBufferRead *read;
+    Uint8 *mapped;
+
+    CHECK_DEVICE_MAGIC(device, false);
+    if (asyncio == NULL) {
+        return SDL_InvalidParamError("asyncio");
+    }
+    if (transfer_buffer == NULL) {
+        return SDL_InvalidParamError("transfer_buffer");
+    }
+    if (queue == NULL) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    read = (GPU_TransferBufferRead *)SDL_malloc(sizeof(*read));
+    if (read == NULL) {
+        return false;
+    }
+    read->device = device;
+    read->transfer_buffer = transfer_buffer;
+
+    mapped = (Uint8 *)SDL_MapGPUTransferBuffer(device, transfer_buffer, cycle);
+    if (mapped == NULL) {
+        SDL_free(read);
+        return false;
+    }
+
+    if (!SDL_ReadAsyncIOWithFinish(asyncio, mapped + transfer_offset, offset, size, queue, userdata, GPU_FinishTransferBufferRead, read)) {
+        SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
+        SDL_free(read);
+        return false;
+    }
+    return true;
+}
+
 // Copy Pass
 
 SDL_GPUCopyPass *SDL_BeginGPUCopyPass(
@@ -2636,6 +3982,10 @@ void SDL_UploadToGPUTexture(
             SDL_assert_release(!"Destination texture cannot be NULL!");
             return;
         }
+        if (((TextureCommonHeader *)destination->texture)->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+            SDL_assert_release(!"Destination texture cannot be transient!");
+            return;
+        }
     }
 
     COPYPASS_DEVICE->UploadToTexture(
@@ -2722,6 +4072,10 @@ void SDL_CopyGPUTextureToTexture(
             SDL_assert_release(!"Source and destination textures must have the same format!");
             return;
         }
+        if ((srcHeader->info.usage | dstHeader->info.usage) & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+            SDL_assert_release(!"Source and destination textures cannot be transient!");
+            return;
+        }
     }
 
     COPYPASS_DEVICE->CopyTextureToTexture(
@@ -2802,6 +4156,10 @@ void SDL_DownloadFromGPUTexture(
             SDL_assert_release(!"Destination transfer buffer cannot be NULL!");
             return;
         }
+        if (((TextureCommonHeader *)source->texture)->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+            SDL_assert_release(!"Source texture cannot be transient!");
+            return;
+        }
     }
 
     COPYPASS_DEVICE->DownloadFromTexture(
@@ -2866,20 +4224,411 @@ void SDL_EndGPUCopyPass(
     }
 }
 
-void SDL_GenerateMipmapsForGPUTexture(
-    SDL_GPUCommandBuffer *command_buffer,
-    SDL_GPUTexture *texture)
-{
-    if (command_buffer == NULL) {
-        SDL_InvalidParamError("command_buffer");
-        return;
-    }
-    if (texture == NULL) {
-        SDL_InvalidParamError("texture");
-        return;
-    }
+// Upload Heaps
 
-    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+#define GPU_UPLOAD_HEAP_DEFAULT_BLOCK_SIZE (4 * 1024 * 1024)
+
+// D3D12 wants texture data placed on 512 byte boundaries, which also covers every texel block size
+#define GPU_UPLOAD_HEAP_TEXTURE_ALIGNMENT 512
+#define GPU_UPLOAD_HEAP_BUFFER_ALIGNMENT  16
+
+typedef struct GPU_UploadSubmission
+{
+    SDL_GPUFence *fence;
+    int num_blocks; // blocks still waiting on the fence
+} GPU_UploadSubmission;
+
+typedef struct GPU_UploadBlock
+{
+    SDL_GPUTransferBuffer *transfer_buffer;
+    Uint32 size;
+    Uint32 offset;  // write cursor within the current batch
+    Uint8 *mapped;  // non-NULL while the block is part of the current batch
+    GPU_UploadSubmission *submission; // non-NULL while the GPU may still read the block
+} GPU_UploadBlock;
+
+typedef struct GPU_PendingUpload
+{
+    bool is_texture;
+    bool cycle;
+    SDL_GPUTextureTransferInfo texture_source;
+    SDL_GPUTextureRegion texture_destination;
+    SDL_GPUTransferBufferLocation buffer_source;
+    SDL_GPUBufferRegion buffer_destination;
+} GPU_PendingUpload;
+
+struct SDL_GPUUploadHeap
+{
+    SDL_GPUDevice *device;
+    Uint32 block_size;
+    SDL_GPUQueueType queue_type;
+
+    GPU_UploadBlock **blocks;
+    int num_blocks;
+    int blocks_capacity;
+    GPU_UploadBlock *current_block;
+
+    GPU_PendingUpload *pending;
+    int num_pending;
+    int pending_capacity;
+};
+
+static void GPU_RetireUploadSubmission(SDL_GPUUploadHeap *heap, GPU_UploadBlock *block)
+{
+    GPU_UploadSubmission *submission = block->submission;
+
+    block->submission = NULL;
+    submission->num_blocks -= 1;
+    if (submission->num_blocks == 0) {
+        SDL_ReleaseGPUFence(heap->device, submission->fence);
+        SDL_free(submission);
+    }
+}
+
+static bool GPU_IsUploadBlockIdle(SDL_GPUUploadHeap *heap, GPU_UploadBlock *block)
+{
+    if (block->mapped) {
+        return false;
+    }
+    if (block->submission) {
+        if (!SDL_QueryGPUFence(heap->device, block->submission->fence)) {
+            return false;
+        }
+        GPU_RetireUploadSubmission(heap, block);
+    }
+    return true;
+}
+
+static GPU_UploadBlock *GPU_AcquireUploadBlock(SDL_GPUUploadHeap *heap, Uint32 size)
+{
+    SDL_GPUTransferBufferCreateInfo createinfo;
+    GPU_UploadBlock *block = NULL;
+    int i;
+
+    for (i = 0; i < heap->num_blocks; i += 1) {
+        if (heap->blocks[i]->size >= size && GPU_IsUploadBlockIdle(heap, heap->blocks[i])) {
+            block = heap->blocks[i];
+            break;
+        }
+    }
+
+    if (block == NULL) {
+        if (heap->num_blocks == heap->blocks_capacity) {
+            int new_capacity = heap->blocks_capacity ? heap->blocks_capacity * 2 : 4;
+            GPU_UploadBlock **new_blocks = (GPU_UploadBlock **)SDL_realloc(heap->blocks, new_capacity * sizeof(GPU_UploadBlock *));
+            if (!new_blocks) {
+                return NULL;
+            }
+            heap->blocks = new_blocks;
+            heap->blocks_capacity = new_capacity;
+        }
+
+        block = (GPU_UploadBlock *)SDL_calloc(1, sizeof(GPU_UploadBlock));
+        if (!block) {
+            return NULL;
+        }
+
+        SDL_zero(createinfo);
+        createinfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        createinfo.size = SDL_max(size, heap->block_size);
+        block->transfer_buffer = SDL_CreateGPUTransferBuffer(heap->device, &createinfo);
+        if (block->transfer_buffer == NULL) {
+            SDL_free(block);
+            return NULL;
+        }
+        block->size = createinfo.size;
+        heap->blocks[heap->num_blocks] = block;
+        heap->num_blocks += 1;
+    }
+
+    block->mapped = (Uint8 *)SDL_MapGPUTransferBuffer(heap->device, block->transfer_buffer, false);
+    if (block->mapped == NULL) {
+        return NULL;
+    }
+    block->offset = 0;
+    return block;
+}
+
+static GPU_PendingUpload *GPU_AllocateUpload(
+    SDL_GPUUploadHeap *heap,
+    const void *data,
+    Uint32 size,
+    Uint32 alignment,
+    SDL_GPUTransferBuffer **transfer_buffer,
+    Uint32 *offset)
+{
+    GPU_UploadBlock *block = heap->current_block;
+    GPU_PendingUpload *pending;
+    Uint32 aligned_offset = 0;
+
+    if (heap->num_pending == heap->pending_capacity) {
+        int new_capacity = heap->pending_capacity ? heap->pending_capacity * 2 : 16;
+        GPU_PendingUpload *new_pending = (GPU_PendingUpload *)SDL_realloc(heap->pending, new_capacity * sizeof(GPU_PendingUpload));
+        if (!new_pending) {
+            return NULL;
+        }
+        heap->pending = new_pending;
+        heap->pending_capacity = new_capacity;
+    }
+
+    if (block) {
+        aligned_offset = (block->offset + alignment - 1) & ~(alignment - 1);
+        if (aligned_offset < block->offset || aligned_offset > block->size || size > block->size - aligned_offset) {
+            block = NULL;
+        }
+    }
+
+    if (block == NULL) {
+        block = GPU_AcquireUploadBlock(heap, size);
+        if (block == NULL) {
+            return NULL;
+        }
+        aligned_offset = 0;
+
+        // Keep filling whichever block has more room left
+        if (heap->current_block == NULL ||
+            block->size - size > heap->current_block->size - heap->current_block->offset) {
+            heap->current_block = block;
+        }
+    }
+
+    SDL_memcpy(block->mapped + aligned_offset, data, size);
+    block->offset = aligned_offset + size;
+
+    *transfer_buffer = block->transfer_buffer;
+    *offset = aligned_offset;
+
+    pending = &heap->pending[heap->num_pending];
+    SDL_zerop(pending);
+    heap->num_pending += 1;
+    return pending;
+}
+
+SDL_GPUUploadHeap *SDL_CreateGPUUploadHeap(
+    SDL_GPUDevice *device,
+    SDL_PropertiesID props)
+{
+    SDL_GPUUploadHeap *heap;
+    Sint64 block_size;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+    block_size = SDL_GetNumberProperty(props, SDL_PROP_GPU_UPLOADHEAP_CREATE_BLOCK_SIZE_NUMBER, GPU_UPLOAD_HEAP_DEFAULT_BLOCK_SIZE);
+    if (block_size <= 0 || block_size > SDL_MAX_UINT32) {
+        SDL_SetError("Upload heap block size must be between 1 and %" SDL_PRIu32, SDL_MAX_UINT32);
+        return NULL;
+    }
+
+    heap = (SDL_GPUUploadHeap *)SDL_calloc(1, sizeof(SDL_GPUUploadHeap));
+    if (!heap) {
+        return NULL;
+    }
+
+    heap->device = device;
+    heap->block_size = (Uint32)block_size;
+    heap->queue_type = SDL_GetBooleanProperty(props, SDL_PROP_GPU_UPLOADHEAP_CREATE_COPY_QUEUE_BOOLEAN, true) ?
+        SDL_GPU_QUEUETYPE_COPY :
+        SDL_GPU_QUEUETYPE_GRAPHICS;
+    return heap;
+}
+
+bool SDL_UploadGPUTextureData(
+    SDL_GPUUploadHeap *heap,
+    const void *data,
+    Uint32 size,
+    Uint32 pixels_per_row,
+    Uint32 rows_per_layer,
+    const SDL_GPUTextureRegion *destination,
+    bool cycle)
+{
+    GPU_PendingUpload *pending;
+    SDL_GPUTransferBuffer *transfer_buffer;
+    Uint32 offset;
+
+    if (heap == NULL) {
+        return SDL_InvalidParamError("heap");
+    }
+    if (data == NULL) {
+        return SDL_InvalidParamError("data");
+    }
+    if (destination == NULL) {
+        return SDL_InvalidParamError("destination");
+    }
+    if (destination->texture == NULL) {
+        return SDL_SetError("Destination texture cannot be NULL");
+    }
+
+    pending = GPU_AllocateUpload(heap, data, size, GPU_UPLOAD_HEAP_TEXTURE_ALIGNMENT, &transfer_buffer, &offset);
+    if (pending == NULL) {
+        return false;
+    }
+
+    pending->is_texture = true;
+    pending->cycle = cycle;
+    pending->texture_source.transfer_buffer = transfer_buffer;
+    pending->texture_source.offset = offset;
+    pending->texture_source.pixels_per_row = pixels_per_row;
+    pending->texture_source.rows_per_layer = rows_per_layer;
+    pending->texture_destination = *destination;
+    return true;
+}
+
+bool SDL_UploadGPUBufferData(
+    SDL_GPUUploadHeap *heap,
+    const void *data,
+    const SDL_GPUBufferRegion *destination,
+    bool cycle)
+{
+    GPU_PendingUpload *pending;
+    SDL_GPUTransferBuffer *transfer_buffer;
+    Uint32 offset;
+
+    if (heap == NULL) {
+        return SDL_InvalidParamError("heap");
+    }
+    if (data == NULL) {
+        return SDL_InvalidParamError("data");
+    }
+    if (destination == NULL) {
+        return SDL_InvalidParamError("destination");
+    }
+    if (destination->buffer == NULL) {
+        return SDL_SetError("Destination buffer cannot be NULL");
+    }
+
+    pending = GPU_AllocateUpload(heap, data, destination->size, GPU_UPLOAD_HEAP_BUFFER_ALIGNMENT, &transfer_buffer, &offset);
+    if (pending == NULL) {
+        return false;
+    }
+
+    pending->is_texture = false;
+    pending->cycle = cycle;
+    pending->buffer_source.transfer_buffer = transfer_buffer;
+    pending->buffer_source.offset = offset;
+    pending->buffer_destination = *destination;
+    return true;
+}
+
+bool SDL_FlushGPUUploadHeap(
+    SDL_GPUUploadHeap *heap,
+    SDL_GPUCommandBuffer *wait_command_buffer)
+{
+    SDL_GPUCommandBuffer *command_buffer;
+    SDL_GPUCopyPass *copy_pass;
+    GPU_UploadSubmission *submission;
+    SDL_GPUFence *fence;
+    bool result = true;
+    int i;
+
+    if (heap == NULL) {
+        return SDL_InvalidParamError("heap");
+    }
+
+    if (heap->num_pending == 0) {
+        return true;
+    }
+
+    submission = (GPU_UploadSubmission *)SDL_calloc(1, sizeof(GPU_UploadSubmission));
+    if (!submission) {
+        return false;
+    }
+
+    command_buffer = SDL_AcquireGPUCommandBufferForQueue(heap->device, heap->queue_type);
+    if (command_buffer == NULL) {
+        SDL_free(submission);
+        return false;
+    }
+
+    // The copies may only read the transfer buffers once they are unmapped
+    for (i = 0; i < heap->num_blocks; i += 1) {
+        if (heap->blocks[i]->mapped) {
+            SDL_UnmapGPUTransferBuffer(heap->device, heap->blocks[i]->transfer_buffer);
+        }
+    }
+
+    copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    for (i = 0; i < heap->num_pending; i += 1) {
+        const GPU_PendingUpload *pending = &heap->pending[i];
+        if (pending->is_texture) {
+            SDL_UploadToGPUTexture(copy_pass, &pending->texture_source, &pending->texture_destination, pending->cycle);
+        } else {
+            SDL_UploadToGPUBuffer(copy_pass, &pending->buffer_source, &pending->buffer_destination, pending->cycle);
+        }
+    }
+    SDL_EndGPUCopyPass(copy_pass);
+    heap->num_pending = 0;
+
+    fence = SDL_SubmitGPUCommandBufferAndAcquireFence(command_buffer);
+    if (fence == NULL) {
+        // Nothing will read the staging memory, so it is free again right away
+        SDL_free(submission);
+        submission = NULL;
+        result = false;
+    } else {
+        submission->fence = fence;
+        if (wait_command_buffer) {
+            result = SDL_AddGPUCommandBufferWaitFence(wait_command_buffer, fence);
+        }
+    }
+
+    for (i = 0; i < heap->num_blocks; i += 1) {
+        GPU_UploadBlock *block = heap->blocks[i];
+        if (block->mapped) {
+            block->mapped = NULL;
+            if (submission) {
+                block->submission = submission;
+                submission->num_blocks += 1;
+            }
+        }
+    }
+    heap->current_block = NULL;
+
+    return result;
+}
+
+void SDL_DestroyGPUUploadHeap(
+    SDL_GPUUploadHeap *heap)
+{
+    int i;
+
+    if (heap == NULL) {
+        return;
+    }
+
+    for (i = 0; i < heap->num_blocks; i += 1) {
+        GPU_UploadBlock *block = heap->blocks[i];
+        if (block->mapped) {
+            SDL_UnmapGPUTransferBuffer(heap->device, block->transfer_buffer);
+        }
+        if (block->submission) {
+            SDL_WaitForGPUFences(heap->device, true, &block->submission->fence, 1);
+            GPU_RetireUploadSubmission(heap, block);
+        }
+        SDL_ReleaseGPUTransferBuffer(heap->device, block->transfer_buffer);
+        SDL_free(block);
+    }
+
+    SDL_free(heap->blocks);
+    SDL_free(heap->pending);
+    SDL_free(heap);
+}
+
+void SDL_GenerateMipmapsForGPUTexture(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUTexture *texture)
+{
+    if (command_buffer == NULL) {
+        SDL_InvalidParamError("command_buffer");
+        return;
+    }
+    if (texture == NULL) {
+        SDL_InvalidParamError("texture");
+        return;
+    }
+
+    CHECK_GRAPHICS_QUEUE("Generating mipmaps requires a graphics queue command buffer", )
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER
         CHECK_ANY_PASS_IN_PROGRESS("Cannot generate mipmaps during a pass!", )
 
@@ -2908,6 +4657,48 @@ void SDL_GenerateMipmapsForGPUTexture(
     }
 }
 
+static bool SDL_GPU_CheckBlit(const SDL_GPUBlitInfo *info)
+{
+    bool failed = false;
+    TextureCommonHeader *srcHeader = (TextureCommonHeader *)info->source.texture;
+    TextureCommonHeader *dstHeader = (TextureCommonHeader *)info->destination.texture;
+
+    if (srcHeader == NULL) {
+        SDL_assert_release(!"Blit source texture must be non-NULL");
+        return false; // attempting to proceed will crash
+    }
+    if (dstHeader == NULL) {
+        SDL_assert_release(!"Blit destination texture must be non-NULL");
+        return false; // attempting to proceed will crash
+    }
+    if (srcHeader->info.sample_count != SDL_GPU_SAMPLECOUNT_1) {
+        SDL_assert_release(!"Blit source texture must have a sample count of 1");
+        failed = true;
+    }
+    if ((srcHeader->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) == 0) {
+        SDL_assert_release(!"Blit source texture must be created with the SAMPLER usage flag");
+        failed = true;
+    }
+    if ((dstHeader->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) == 0) {
+        SDL_assert_release(!"Blit destination texture must be created with the COLOR_TARGET usage flag");
+        failed = true;
+    }
+    if (dstHeader->info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+        SDL_assert_release(!"Blit destination texture cannot be transient");
+        failed = true;
+    }
+    if (IsDepthFormat(srcHeader->info.format)) {
+        SDL_assert_release(!"Blit source texture cannot have a depth format");
+        failed = true;
+    }
+    if (info->source.w == 0 || info->source.h == 0 || info->destination.w == 0 || info->destination.h == 0) {
+        SDL_assert_release(!"Blit source/destination regions must have non-zero width, height, and depth");
+        failed = true;
+    }
+
+    return !failed;
+}
+
 void SDL_BlitGPUTexture(
     SDL_GPUCommandBuffer *command_buffer,
     const SDL_GPUBlitInfo *info)
@@ -2921,45 +4712,13 @@ void SDL_BlitGPUTexture(
         return;
     }
 
+    CHECK_GRAPHICS_QUEUE("Blitting requires a graphics queue command buffer", )
+
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER
         CHECK_ANY_PASS_IN_PROGRESS("Cannot blit during a pass!", )
 
-        // Validation
-        bool failed = false;
-        TextureCommonHeader *srcHeader = (TextureCommonHeader *)info->source.texture;
-        TextureCommonHeader *dstHeader = (TextureCommonHeader *)info->destination.texture;
-
-        if (srcHeader == NULL) {
-            SDL_assert_release(!"Blit source texture must be non-NULL");
-            return; // attempting to proceed will crash
-        }
-        if (dstHeader == NULL) {
-            SDL_assert_release(!"Blit destination texture must be non-NULL");
-            return; // attempting to proceed will crash
-        }
-        if (srcHeader->info.sample_count != SDL_GPU_SAMPLECOUNT_1) {
-            SDL_assert_release(!"Blit source texture must have a sample count of 1");
-            failed = true;
-        }
-        if ((srcHeader->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) == 0) {
-            SDL_assert_release(!"Blit source texture must be created with the SAMPLER usage flag");
-            failed = true;
-        }
-        if ((dstHeader->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) == 0) {
-            SDL_assert_release(!"Blit destination texture must be created with the COLOR_TARGET usage flag");
-            failed = true;
-        }
-        if (IsDepthFormat(srcHeader->info.format)) {
-            SDL_assert_release(!"Blit source texture cannot have a depth format");
-            failed = true;
-        }
-        if (info->source.w == 0 || info->source.h == 0 || info->destination.w == 0 || info->destination.h == 0) {
-            SDL_assert_release(!"Blit source/destination regions must have non-zero width, height, and depth");
-            failed = true;
-        }
-
-        if (failed) {
+        if (!SDL_GPU_CheckBlit(info)) {
             return;
         }
     }
@@ -2969,6 +4728,42 @@ void SDL_BlitGPUTexture(
         info);
 }
 
+void SDL_BlitGPUTextures(
+    SDL_GPUCommandBuffer *command_buffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 num_blits)
+{
+    if (command_buffer == NULL) {
+        SDL_InvalidParamError("command_buffer");
+        return;
+    }
+    if (infos == NULL && num_blits > 0) {
+        SDL_InvalidParamError("infos");
+        return;
+    }
+    if (num_blits == 0) {
+        return;
+    }
+
+    CHECK_GRAPHICS_QUEUE("Blitting requires a graphics queue command buffer", )
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER
+        CHECK_ANY_PASS_IN_PROGRESS("Cannot blit during a pass!", )
+
+        for (Uint32 i = 0; i < num_blits; i += 1) {
+            if (!SDL_GPU_CheckBlit(&infos[i])) {
+                return;
+            }
+        }
+    }
+
+    COMMAND_BUFFER_DEVICE->BlitTextures(
+        command_buffer,
+        infos,
+        num_blits);
+}
+
 // Submission/Presentation
 
 bool SDL_WindowSupportsGPUSwapchainComposition(
@@ -3044,6 +4839,8 @@ void SDL_ReleaseWindowFromGPUDevice(
     device->ReleaseWindow(
         device->driverData,
         window);
+
+    SDL_ClearProperty(SDL_GetWindowProperties(window), GPU_WINDOW_PROPERTY_LATENCY);
 }
 
 bool SDL_SetGPUSwapchainParameters(
@@ -3111,6 +4908,8 @@ bool SDL_AcquireGPUSwapchainTexture(
         return SDL_InvalidParamError("swapchain_texture");
     }
 
+    CHECK_GRAPHICS_QUEUE("Swapchain textures require a graphics queue command buffer", false)
+
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER_RETURN_FALSE
         CHECK_ANY_PASS_IN_PROGRESS("Cannot acquire a swapchain texture during a pass!", false)
@@ -3164,6 +4963,8 @@ bool SDL_WaitAndAcquireGPUSwapchainTexture(
         return SDL_InvalidParamError("swapchain_texture");
     }
 
+    CHECK_GRAPHICS_QUEUE("Swapchain textures require a graphics queue command buffer", false)
+
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CHECK_COMMAND_BUFFER_RETURN_FALSE
         CHECK_ANY_PASS_IN_PROGRESS("Cannot acquire a swapchain texture during a pass!", false)
@@ -3183,6 +4984,93 @@ bool SDL_WaitAndAcquireGPUSwapchainTexture(
     return result;
 }
 
+bool SDL_SetGPULatencyMarker(
+    SDL_GPUDevice *device,
+    SDL_Window *window,
+    SDL_GPULatencyMarker marker,
+    Uint64 frame_id)
+{
+    GPU_LatencyFrame *frames;
+    GPU_LatencyFrame *frame;
+    Uint64 now = SDL_GetTicksNS();
+
+    CHECK_DEVICE_MAGIC(device, false);
+
+    if (window == NULL) {
+        return SDL_InvalidParamError("window");
+    }
+    if ((int)marker < 0 || (int)marker >= GPU_LATENCY_MARKER_COUNT) {
+        return SDL_InvalidParamError("marker");
+    }
+    if (frame_id == 0) {
+        return SDL_InvalidParamError("frame_id");
+    }
+
+    frames = SDL_GPU_FetchLatencyFrames(window, true);
+    if (frames == NULL) {
+        return false;
+    }
+
+    frame = &frames[frame_id % GPU_LATENCY_FRAME_COUNT];
+    if (frame->frame_id != frame_id) {
+        SDL_zerop(frame);
+        frame->frame_id = frame_id;
+    }
+    frame->times[marker] = now;
+
+    return true;
+}
+
+bool SDL_GetGPUPresentStatistics(
+    SDL_GPUDevice *device,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics)
+{
+    GPU_LatencyFrame *frames;
+
+    CHECK_DEVICE_MAGIC(device, false);
+
+    if (window == NULL) {
+        return SDL_InvalidParamError("window");
+    }
+    if (statistics == NULL) {
+        return SDL_InvalidParamError("statistics");
+    }
+
+    SDL_zerop(statistics);
+
+    if (!device->GetPresentStatistics(
+            device->driverData,
+            window,
+            statistics)) {
+        return false;
+    }
+
+    // Not every driver can query the refresh cycle, so fall back to the display mode
+    if (statistics->refresh_interval_ns == 0) {
+        const SDL_DisplayMode *mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window));
+        if (mode != NULL && mode->refresh_rate_numerator > 0) {
+            statistics->refresh_interval_ns = SDL_NS_PER_SECOND * (Uint64)mode->refresh_rate_denominator / (Uint64)mode->refresh_rate_numerator;
+        }
+    }
+
+    frames = SDL_GPU_FetchLatencyFrames(window, false);
+    if (frames != NULL && statistics->displayed_frame_id != 0) {
+        const GPU_LatencyFrame *frame = &frames[statistics->displayed_frame_id % GPU_LATENCY_FRAME_COUNT];
+        if (frame->frame_id == statistics->displayed_frame_id) {
+            statistics->input_sample_ns = frame->times[SDL_GPU_LATENCYMARKER_INPUT_SAMPLE];
+            statistics->simulation_start_ns = frame->times[SDL_GPU_LATENCYMARKER_SIMULATION_START];
+            statistics->simulation_end_ns = frame->times[SDL_GPU_LATENCYMARKER_SIMULATION_END];
+            statistics->render_submit_start_ns = frame->times[SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_START];
+            statistics->render_submit_end_ns = frame->times[SDL_GPU_LATENCYMARKER_RENDER_SUBMIT_END];
+            statistics->present_start_ns = frame->times[SDL_GPU_LATENCYMARKER_PRESENT_START];
+            statistics->present_end_ns = frame->times[SDL_GPU_LATENCYMARKER_PRESENT_END];
+        }
+    }
+
+    return true;
+}
+
 bool SDL_SubmitGPUCommandBuffer(
     SDL_GPUCommandBuffer *command_buffer)
 {
@@ -3237,6 +5125,26 @@ SDL_GPUFence *SDL_SubmitGPUCommandBufferAndAcquireFence(
         command_buffer);
 }
 
+bool SDL_AddGPUCommandBufferWaitFence(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUFence *fence)
+{
+    if (command_buffer == NULL) {
+        return SDL_InvalidParamError("command_buffer");
+    }
+    if (fence == NULL) {
+        return SDL_InvalidParamError("fence");
+    }
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER_RETURN_FALSE
+    }
+
+    return COMMAND_BUFFER_DEVICE->AddWaitFence(
+        command_buffer,
+        fence);
+}
+
 bool SDL_CancelGPUCommandBuffer(
     SDL_GPUCommandBuffer *command_buffer)
 {
@@ -3315,6 +5223,247 @@ void SDL_ReleaseGPUFence(
         fence);
 }
 
+bool SDL_GetGPUQueryPoolResults(
+    SDL_GPUDevice *device,
+    SDL_GPUQueryPool *query_pool,
+    Uint32 first_query,
+    Uint32 num_queries,
+    Uint64 *results)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (query_pool == NULL) {
+        return SDL_InvalidParamError("query_pool");
+    }
+    if (results == NULL) {
+        return SDL_InvalidParamError("results");
+    }
+    if (num_queries == 0) {
+        return true;
+    }
+    if (first_query >= ((QueryPoolCommonHeader *)query_pool)->numQueries ||
+        num_queries > ((QueryPoolCommonHeader *)query_pool)->numQueries - first_query) {
+        return SDL_SetError("Query range is out of bounds");
+    }
+
+    return device->GetQueryPoolResults(
+        device->driverData,
+        query_pool,
+        first_query,
+        num_queries,
+        results);
+}
+
+// Sparse Textures
+
+static GPU_SparseTileMap *GPU_GetSparseTileMap(
+    SDL_GPUTexture *texture)
+{
+    GPU_SparseTileMap *map;
+
+    if (texture == NULL) {
+        SDL_InvalidParamError("texture");
+        return NULL;
+    }
+
+    map = ((TextureCommonHeader *)texture)->sparse;
+    if (map == NULL) {
+        SDL_SetError("Texture was not created sparse");
+    }
+    return map;
+}
+
+static bool GPU_UpdateSparseTiles(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureRegion *region,
+    bool commit)
+{
+    TextureCommonHeader *header;
+    GPU_SparseTileMap *map;
+    GPU_SparseTileUpdate *updates;
+    Uint32 levelWidth, levelHeight, tilesPerRow, firstTile;
+    Uint32 firstX, firstY, lastX, lastY;
+    Uint32 numUpdates = 0;
+    bool result = true;
+
+    CHECK_DEVICE_MAGIC(device, false);
+    if (region == NULL) {
+        return SDL_InvalidParamError("region");
+    }
+    map = GPU_GetSparseTileMap(region->texture);
+    if (map == NULL) {
+        return false;
+    }
+    header = (TextureCommonHeader *)region->texture;
+
+    if (region->mip_level >= header->info.num_levels ||
+        region->layer >= map->numLayers ||
+        region->z != 0 || region->d > 1) {
+        return SDL_SetError("Tile region is outside of the texture");
+    }
+    if (region->mip_level >= map->firstPackedLevel || region->w == 0 || region->h == 0) {
+        // The packed mip tail stays committed for the lifetime of the texture
+        return true;
+    }
+
+    levelWidth = SDL_max(header->info.width >> region->mip_level, 1);
+    levelHeight = SDL_max(header->info.height >> region->mip_level, 1);
+    if (region->x >= levelWidth || region->w > levelWidth - region->x ||
+        region->y >= levelHeight || region->h > levelHeight - region->y) {
+        return SDL_SetError("Tile region is outside of the texture");
+    }
+
+    firstX = region->x / map->tileWidth;
+    firstY = region->y / map->tileHeight;
+    lastX = (region->x + region->w - 1) / map->tileWidth;
+    lastY = (region->y + region->h - 1) / map->tileHeight;
+    tilesPerRow = (levelWidth + map->tileWidth - 1) / map->tileWidth;
+    firstTile = region->layer * map->tilesPerLayer + map->levelTileOffsets[region->mip_level];
+
+    updates = (GPU_SparseTileUpdate *)SDL_malloc((lastX - firstX + 1) * (lastY - firstY + 1) * sizeof(GPU_SparseTileUpdate));
+    if (updates == NULL) {
+        return false;
+    }
+
+    SDL_LockMutex(map->lock);
+
+    for (Uint32 y = firstY; y <= lastY; y += 1) {
+        for (Uint32 x = firstX; x <= lastX; x += 1) {
+            bool mapped = map->tileSlots[firstTile + y * tilesPerRow + x] != GPU_SPARSE_TILE_UNMAPPED;
+            if (mapped != commit) {
+                updates[numUpdates].level = region->mip_level;
+                updates[numUpdates].layer = region->layer;
+                updates[numUpdates].x = x;
+                updates[numUpdates].y = y;
+                updates[numUpdates].slot = GPU_SPARSE_TILE_UNMAPPED;
+                numUpdates += 1;
+            }
+        }
+    }
+
+    if (commit && numUpdates > map->numFreeSlots) {
+        result = SDL_SetError("Sparse texture tile budget exceeded, %" SDL_PRIu32 " tiles requested and %" SDL_PRIu32 " free", numUpdates, map->numFreeSlots);
+    } else if (numUpdates > 0) {
+        // Only touch the bookkeeping once the backend has remapped the tiles
+        if (commit) {
+            for (Uint32 i = 0; i < numUpdates; i += 1) {
+                updates[i].slot = map->freeSlots[map->numFreeSlots - 1 - i];
+            }
+        }
+
+        result = device->UpdateSparseTileMappings(
+            device->driverData,
+            region->texture,
+            updates,
+            numUpdates);
+
+        if (result) {
+            for (Uint32 i = 0; i < numUpdates; i += 1) {
+                Uint32 *slot = &map->tileSlots[firstTile + updates[i].y * tilesPerRow + updates[i].x];
+                if (commit) {
+                    *slot = updates[i].slot;
+                } else {
+                    map->freeSlots[map->numFreeSlots + i] = *slot;
+                    *slot = GPU_SPARSE_TILE_UNMAPPED;
+                }
+            }
+            if (commit) {
+                map->numFreeSlots -= numUpdates;
+            } else {
+                map->numFreeSlots += numUpdates;
+            }
+        }
+    }
+
+    SDL_UnlockMutex(map->lock);
+    SDL_free(updates);
+
+    return result;
+}
+
+bool SDL_GetGPUSparseTextureInfo(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    SDL_GPUSparseTextureInfo *info)
+{
+    GPU_SparseTileMap *map;
+
+    CHECK_DEVICE_MAGIC(device, false);
+    if (info == NULL) {
+        return SDL_InvalidParamError("info");
+    }
+    map = GPU_GetSparseTileMap(texture);
+    if (map == NULL) {
+        return false;
+    }
+
+    SDL_LockMutex(map->lock);
+    info->tile_width = map->tileWidth;
+    info->tile_height = map->tileHeight;
+    info->tile_size = map->tileSize;
+    info->first_packed_level = map->firstPackedLevel;
+    info->tile_budget = map->numSlots;
+    info->num_committed_tiles = map->numSlots - map->numFreeSlots;
+    SDL_UnlockMutex(map->lock);
+
+    return true;
+}
+
+bool SDL_CommitGPUTextureTiles(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureRegion *region)
+{
+    return GPU_UpdateSparseTiles(device, region, true);
+}
+
+bool SDL_DecommitGPUTextureTiles(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureRegion *region)
+{
+    return GPU_UpdateSparseTiles(device, region, false);
+}
+
+bool SDL_IsGPUTextureTileCommitted(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    Uint32 mip_level,
+    Uint32 layer,
+    Uint32 x,
+    Uint32 y)
+{
+    TextureCommonHeader *header;
+    GPU_SparseTileMap *map;
+    Uint32 levelWidth, levelHeight, tilesPerRow, tile;
+    bool committed;
+
+    CHECK_DEVICE_MAGIC(device, false);
+    map = GPU_GetSparseTileMap(texture);
+    if (map == NULL) {
+        return false;
+    }
+    header = (TextureCommonHeader *)texture;
+
+    if (mip_level >= header->info.num_levels || layer >= map->numLayers) {
+        return SDL_SetError("Texel is outside of the texture");
+    }
+    levelWidth = SDL_max(header->info.width >> mip_level, 1);
+    levelHeight = SDL_max(header->info.height >> mip_level, 1);
+    if (x >= levelWidth || y >= levelHeight) {
+        return SDL_SetError("Texel is outside of the texture");
+    }
+    if (mip_level >= map->firstPackedLevel) {
+        return true;
+    }
+
+    tilesPerRow = (levelWidth + map->tileWidth - 1) / map->tileWidth;
+    tile = layer * map->tilesPerLayer + map->levelTileOffsets[mip_level] + (y / map->tileHeight) * tilesPerRow + x / map->tileWidth;
+
+    SDL_LockMutex(map->lock);
+    committed = map->tileSlots[tile] != GPU_SPARSE_TILE_UNMAPPED;
+    SDL_UnlockMutex(map->lock);
+
+    return committed;
+}
+
 Uint32 SDL_CalculateGPUTextureFormatSize(
     SDL_GPUTextureFormat format,
     Uint32 width,
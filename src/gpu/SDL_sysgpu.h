@@ -33,6 +33,7 @@
 #define MAX_COMPUTE_WRITE_TEXTURES     8
 #define MAX_COMPUTE_WRITE_BUFFERS      8
 #define UNIFORM_BUFFER_SIZE            32768
+#define UNIFORM_BUFFER_CACHE_COUNT     16 // kept by each command buffer between submissions
 #define MAX_VERTEX_BUFFERS             16
 #define MAX_VERTEX_ATTRIBUTES          16
 #define MAX_COLOR_TARGET_BINDINGS      4
@@ -83,6 +84,7 @@ typedef struct RenderPass
 typedef struct CommandBufferCommonHeader
 {
     SDL_GPUDevice *device;
+    SDL_GPUQueueType queue_type;
 
     RenderPass render_pass;
     ComputePass compute_pass;
@@ -94,9 +96,42 @@ typedef struct CommandBufferCommonHeader
     bool ignore_render_pass_texture_validation;
 } CommandBufferCommonHeader;
 
+#define GPU_SPARSE_TILE_UNMAPPED SDL_MAX_UINT32
+
+/* Residency of a sparse texture's tiles, shared by the backends.
+ * Each committed tile of the standard mip levels owns a slot in the texture's
+ * backing memory, slot * tileSize bytes in. The packed mip tail is mapped by
+ * the backend when the texture is created and never changes.
+ */
+typedef struct GPU_SparseTileMap
+{
+    Uint32 tileWidth;
+    Uint32 tileHeight;
+    Uint32 tileSize;
+    Uint32 firstPackedLevel;
+    Uint32 numLayers;
+    Uint32 tilesPerLayer;
+    Uint32 *levelTileOffsets; // first tile of each standard level within a layer
+    Uint32 *tileSlots;        // slot of each tile, or GPU_SPARSE_TILE_UNMAPPED
+    Uint32 *freeSlots;
+    Uint32 numFreeSlots;
+    Uint32 numSlots;
+    SDL_Mutex *lock;
+} GPU_SparseTileMap;
+
+typedef struct GPU_SparseTileUpdate
+{
+    Uint32 level;
+    Uint32 layer;
+    Uint32 x;    // in tiles
+    Uint32 y;    // in tiles
+    Uint32 slot; // GPU_SPARSE_TILE_UNMAPPED to decommit
+} GPU_SparseTileUpdate;
+
 typedef struct TextureCommonHeader
 {
     SDL_GPUTextureCreateInfo info;
+    GPU_SparseTileMap *sparse; // NULL unless the texture is sparse
 } TextureCommonHeader;
 
 typedef struct GraphicsPipelineCommonHeader
@@ -122,6 +157,27 @@ typedef struct ComputePipelineCommonHeader
     Uint32 numUniformBuffers;
 } ComputePipelineCommonHeader;
 
+typedef struct QueryPoolCommonHeader
+{
+    SDL_GPUQueryType type;
+    Uint32 numQueries;
+} QueryPoolCommonHeader;
+
+typedef enum GPU_BindlessType
+{
+    GPU_BINDLESS_TEXTURE,
+    GPU_BINDLESS_SAMPLER,
+    GPU_BINDLESS_BUFFER,
+    GPU_BINDLESS_TYPE_COUNT
+} GPU_BindlessType;
+
+typedef enum GPU_CaptureTool
+{
+    GPU_CAPTURE_NONE,
+    GPU_CAPTURE_RENDERDOC,
+    GPU_CAPTURE_BACKEND
+} GPU_CaptureTool;
+
 typedef struct BlitFragmentUniforms
 {
     // texcoord space
@@ -657,6 +713,40 @@ void SDL_GPU_BlitCommon(
     Uint32 *blitPipelineCount,
     Uint32 *blitPipelineCapacity);
 
+// Sets up the residency bookkeeping for a sparse texture, reading the tile budget from createinfo's props
+GPU_SparseTileMap *SDL_GPU_CreateSparseTileMap(
+    const SDL_GPUTextureCreateInfo *createinfo,
+    Uint32 tileWidth,
+    Uint32 tileHeight,
+    Uint32 tileSize,
+    Uint32 firstPackedLevel);
+
+void SDL_GPU_DestroySparseTileMap(
+    GPU_SparseTileMap *map);
+
+// Converts a presentation timestamp from a driver clock to the SDL_GetTicksNS() time base
+Uint64 SDL_GPU_ConvertPresentTime(
+    Uint64 timestamp,
+    Uint64 now,
+    Uint64 frequency);
+
+// Records runs of blits that share a destination subresource into one render pass
+void SDL_GPU_BlitBatchCommon(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits,
+    SDL_GPUSampler *blitLinearSampler,
+    SDL_GPUSampler *blitNearestSampler,
+    SDL_GPUShader *blitVertexShader,
+    SDL_GPUShader *blitFrom2DShader,
+    SDL_GPUShader *blitFrom2DArrayShader,
+    SDL_GPUShader *blitFrom3DShader,
+    SDL_GPUShader *blitFromCubeShader,
+    SDL_GPUShader *blitFromCubeArrayShader,
+    BlitPipelineCacheEntry **blitPipelines,
+    Uint32 *blitPipelineCount,
+    Uint32 *blitPipelineCapacity);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -673,6 +763,10 @@ struct SDL_GPUDevice
 
     SDL_PropertiesID (*GetDeviceProperties)(SDL_GPUDevice *device);
 
+    void *(*GetPipelineCacheData)(SDL_GPUDevice *device, size_t *size);
+
+    SDL_GPUMemoryInfo *(*GetMemoryInfo)(SDL_GPUDevice *device, int *count);
+
     // State Creation
 
     SDL_GPUComputePipeline *(*CreateComputePipeline)(
@@ -707,6 +801,10 @@ struct SDL_GPUDevice
         Uint32 size,
         const char *debugName);
 
+    SDL_GPUQueryPool *(*CreateQueryPool)(
+        SDL_GPURenderer *driverData,
+        const SDL_GPUQueryPoolCreateInfo *createinfo);
+
     // Debug Naming
 
     void (*SetBufferName)(
@@ -730,6 +828,11 @@ struct SDL_GPUDevice
     void (*PopDebugGroup)(
         SDL_GPUCommandBuffer *commandBuffer);
 
+    void (*WriteTimestamp)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUQueryPool *queryPool,
+        Uint32 index);
+
     // Disposal
 
     void (*ReleaseTexture)(
@@ -760,6 +863,21 @@ struct SDL_GPUDevice
         SDL_GPURenderer *driverData,
         SDL_GPUGraphicsPipeline *graphicsPipeline);
 
+    void (*ReleaseQueryPool)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUQueryPool *queryPool);
+
+    // Bindless Resources
+
+    /* Called with the bindless table lock held, so calls never overlap.
+     * `resource` is an SDL_GPUTexture, SDL_GPUSampler or SDL_GPUBuffer.
+     */
+    bool (*WriteBindlessDescriptor)(
+        SDL_GPURenderer *driverData,
+        GPU_BindlessType type,
+        Uint32 index,
+        void *resource);
+
     // Render Pass
 
     void (*BeginRenderPass)(
@@ -874,6 +992,22 @@ struct SDL_GPUDevice
         Uint32 offset,
         Uint32 drawCount);
 
+    void (*DrawPrimitivesIndirectCount)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUBuffer *buffer,
+        Uint32 offset,
+        SDL_GPUBuffer *countBuffer,
+        Uint32 countOffset,
+        Uint32 maxDrawCount);
+
+    void (*DrawIndexedPrimitivesIndirectCount)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUBuffer *buffer,
+        Uint32 offset,
+        SDL_GPUBuffer *countBuffer,
+        Uint32 countOffset,
+        Uint32 maxDrawCount);
+
     void (*EndRenderPass)(
         SDL_GPUCommandBuffer *commandBuffer);
 
@@ -993,6 +1127,11 @@ struct SDL_GPUDevice
         SDL_GPUCommandBuffer *commandBuffer,
         const SDL_GPUBlitInfo *info);
 
+    void (*BlitTextures)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        const SDL_GPUBlitInfo *infos,
+        Uint32 numBlits);
+
     // Submission/Presentation
 
     bool (*SupportsSwapchainComposition)(
@@ -1028,7 +1167,8 @@ struct SDL_GPUDevice
         SDL_Window *window);
 
     SDL_GPUCommandBuffer *(*AcquireCommandBuffer)(
-        SDL_GPURenderer *driverData);
+        SDL_GPURenderer *driverData,
+        SDL_GPUQueueType queueType);
 
     bool (*AcquireSwapchainTexture)(
         SDL_GPUCommandBuffer *commandBuffer,
@@ -1048,12 +1188,22 @@ struct SDL_GPUDevice
         Uint32 *swapchainTextureWidth,
         Uint32 *swapchainTextureHeight);
 
+    // Fills in present_count, displayed_frame_id, display_time_ns and refresh_interval_ns
+    bool (*GetPresentStatistics)(
+        SDL_GPURenderer *driverData,
+        SDL_Window *window,
+        SDL_GPUPresentStatistics *statistics);
+
     bool (*Submit)(
         SDL_GPUCommandBuffer *commandBuffer);
 
     SDL_GPUFence *(*SubmitAndAcquireFence)(
         SDL_GPUCommandBuffer *commandBuffer);
 
+    bool (*AddWaitFence)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUFence *fence);
+
     bool (*Cancel)(
         SDL_GPUCommandBuffer *commandBuffer);
 
@@ -1074,6 +1224,13 @@ struct SDL_GPUDevice
         SDL_GPURenderer *driverData,
         SDL_GPUFence *fence);
 
+    bool (*GetQueryPoolResults)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUQueryPool *queryPool,
+        Uint32 firstQuery,
+        Uint32 numQueries,
+        Uint64 *results);
+
     // Feature Queries
 
     bool (*SupportsTextureFormat)(
@@ -1087,6 +1244,45 @@ struct SDL_GPUDevice
         SDL_GPUTextureFormat format,
         SDL_GPUSampleCount desiredSampleCount);
 
+    // Programmatic capture with the platform's own tool, NULL if the backend has none
+    bool (*BeginCapture)(
+        SDL_GPURenderer *driverData,
+        const char *path);
+
+    bool (*EndCapture)(
+        SDL_GPURenderer *driverData);
+
+    // Sparse textures, NULL if the backend has none
+    bool (*SupportsSparseTexture)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUTextureFormat format,
+        SDL_GPUTextureType type,
+        SDL_GPUTextureUsageFlags usage);
+
+    // Must not return until the GPU uses the new mappings
+    bool (*UpdateSparseTileMappings)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUTexture *texture,
+        const GPU_SparseTileUpdate *updates,
+        Uint32 numUpdates);
+
+    // Variable rate shading, NULL if the backend has none. Render passes start at 1x1.
+    bool (*SupportsShadingRate)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUShadingRate rate);
+
+    void (*SetShadingRate)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUShadingRate rate);
+
+    // Shading rate images, NULL if the backend has none. The image is applied by BeginRenderPass.
+    Uint32 (*GetShadingRateImageTileSize)(
+        SDL_GPURenderer *driverData);
+
+    void (*SetShadingRateImage)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUTexture *texture);
+
     // Opaque pointer for the Driver
     SDL_GPURenderer *driverData;
 
@@ -1098,6 +1294,15 @@ struct SDL_GPUDevice
 
     // Store this for SDL_gpu.c's debug layer
     bool debug_mode;
+
+    // Created on first use by SDL_CreateGPUGraphicsPipelineAsync()
+    struct GPU_AsyncPipelineCompiler *async_pipelines;
+
+    // Created on first use by SDL_AddGPUBindless*()
+    struct GPU_BindlessTable *bindless;
+
+    // Which tool SDL_BeginGPUCapture() started, if any
+    GPU_CaptureTool capture_tool;
 };
 
 #define ASSIGN_DRIVER_FUNC(func, name) \
@@ -1105,6 +1310,8 @@ struct SDL_GPUDevice
 #define ASSIGN_DRIVER(name)                                  \
     ASSIGN_DRIVER_FUNC(DestroyDevice, name)                  \
     ASSIGN_DRIVER_FUNC(GetDeviceProperties, name)            \
+    ASSIGN_DRIVER_FUNC(GetPipelineCacheData, name)           \
+    ASSIGN_DRIVER_FUNC(GetMemoryInfo, name)                  \
     ASSIGN_DRIVER_FUNC(CreateComputePipeline, name)          \
     ASSIGN_DRIVER_FUNC(CreateGraphicsPipeline, name)         \
     ASSIGN_DRIVER_FUNC(CreateSampler, name)                  \
@@ -1112,11 +1319,13 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(CreateTexture, name)                  \
     ASSIGN_DRIVER_FUNC(CreateBuffer, name)                   \
     ASSIGN_DRIVER_FUNC(CreateTransferBuffer, name)           \
+    ASSIGN_DRIVER_FUNC(CreateQueryPool, name)                \
     ASSIGN_DRIVER_FUNC(SetBufferName, name)                  \
     ASSIGN_DRIVER_FUNC(SetTextureName, name)                 \
     ASSIGN_DRIVER_FUNC(InsertDebugLabel, name)               \
     ASSIGN_DRIVER_FUNC(PushDebugGroup, name)                 \
     ASSIGN_DRIVER_FUNC(PopDebugGroup, name)                  \
+    ASSIGN_DRIVER_FUNC(WriteTimestamp, name)                 \
     ASSIGN_DRIVER_FUNC(ReleaseTexture, name)                 \
     ASSIGN_DRIVER_FUNC(ReleaseSampler, name)                 \
     ASSIGN_DRIVER_FUNC(ReleaseBuffer, name)                  \
@@ -1124,6 +1333,8 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(ReleaseShader, name)                  \
     ASSIGN_DRIVER_FUNC(ReleaseComputePipeline, name)         \
     ASSIGN_DRIVER_FUNC(ReleaseGraphicsPipeline, name)        \
+    ASSIGN_DRIVER_FUNC(ReleaseQueryPool, name)               \
+    ASSIGN_DRIVER_FUNC(WriteBindlessDescriptor, name)        \
     ASSIGN_DRIVER_FUNC(BeginRenderPass, name)                \
     ASSIGN_DRIVER_FUNC(BindGraphicsPipeline, name)           \
     ASSIGN_DRIVER_FUNC(SetViewport, name)                    \
@@ -1144,6 +1355,8 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(DrawPrimitives, name)                 \
     ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirect, name)         \
     ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirect, name)  \
+    ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirectCount, name)    \
+    ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirectCount, name) \
     ASSIGN_DRIVER_FUNC(EndRenderPass, name)                  \
     ASSIGN_DRIVER_FUNC(BeginComputePass, name)               \
     ASSIGN_DRIVER_FUNC(BindComputePipeline, name)            \
@@ -1166,6 +1379,7 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(GenerateMipmaps, name)                \
     ASSIGN_DRIVER_FUNC(EndCopyPass, name)                    \
     ASSIGN_DRIVER_FUNC(Blit, name)                           \
+    ASSIGN_DRIVER_FUNC(BlitTextures, name)                   \
     ASSIGN_DRIVER_FUNC(SupportsSwapchainComposition, name)   \
     ASSIGN_DRIVER_FUNC(SupportsPresentMode, name)            \
     ASSIGN_DRIVER_FUNC(ClaimWindow, name)                    \
@@ -1177,13 +1391,16 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(AcquireSwapchainTexture, name)        \
     ASSIGN_DRIVER_FUNC(WaitForSwapchain, name)               \
     ASSIGN_DRIVER_FUNC(WaitAndAcquireSwapchainTexture, name) \
+    ASSIGN_DRIVER_FUNC(GetPresentStatistics, name)           \
     ASSIGN_DRIVER_FUNC(Submit, name)                         \
     ASSIGN_DRIVER_FUNC(SubmitAndAcquireFence, name)          \
+    ASSIGN_DRIVER_FUNC(AddWaitFence, name)                   \
     ASSIGN_DRIVER_FUNC(Cancel, name)                         \
     ASSIGN_DRIVER_FUNC(Wait, name)                           \
     ASSIGN_DRIVER_FUNC(WaitForFences, name)                  \
     ASSIGN_DRIVER_FUNC(QueryFence, name)                     \
     ASSIGN_DRIVER_FUNC(ReleaseFence, name)                   \
+    ASSIGN_DRIVER_FUNC(GetQueryPoolResults, name)            \
     ASSIGN_DRIVER_FUNC(SupportsTextureFormat, name)          \
     ASSIGN_DRIVER_FUNC(SupportsSampleCount, name)
 
@@ -50,6 +50,7 @@ static const IID D3D_IID_IDXGIFactory4 = { 0x1bc6ea02, 0xef36, 0x464f, { 0xbf, 0
 static const IID D3D_IID_IDXGIFactory5 = { 0x7632e1f5, 0xee65, 0x4dca, { 0x87, 0xfd, 0x84, 0xcd, 0x75, 0xf8, 0x83, 0x8d } };
 static const IID D3D_IID_IDXGIFactory6 = { 0xc1b6694f, 0xff09, 0x44a9, { 0xb0, 0x3c, 0x77, 0x90, 0x0a, 0x0a, 0x1d, 0x17 } };
 static const IID D3D_IID_IDXGIAdapter2 = { 0x0aa1ae0a, 0xfa0e, 0x4b84, { 0x86, 0x44, 0xe0, 0x5f, 0xf8, 0xe5, 0xac, 0xb5 } };
+static const IID D3D_IID_IDXGIAdapter3 = { 0x645967a4, 0x1392, 0x4310, { 0xa7, 0x98, 0x80, 0x53, 0xce, 0x3e, 0x93, 0xfd } };
 static const IID D3D_IID_IDXGISwapChain1 = { 0x790a45f7, 0x0d42, 0x4876, { 0x98, 0x3a, 0x0a, 0x55, 0xcf, 0xe6, 0xf4, 0xaa } };
 static const IID D3D_IID_IDXGISwapChain3 = { 0x94d99bdb, 0xf1f8, 0x4ab0, { 0xb2, 0x36, 0x7d, 0xa0, 0x17, 0x0e, 0xda, 0xb1 } };
 static const IID D3D_IID_IDXGIDevice = { 0x54ec77fa, 0x1377, 0x44e6, { 0x8c, 0x32, 0x88, 0xfd, 0x5f, 0x44, 0xc8, 0x4c } };
@@ -513,6 +514,7 @@ typedef struct D3D11WindowData
     Uint32 height;
     SDL_GPUFence *inFlightFences[MAX_FRAMES_IN_FLIGHT];
     Uint32 frameCounter;
+    Uint64 presentCount;
     bool needsSwapchainRecreate;
 } D3D11WindowData;
 
@@ -560,6 +562,15 @@ typedef struct D3D11ComputePipeline
     ID3D11ComputeShader *computeShader;
 } D3D11ComputePipeline;
 
+typedef struct D3D11QueryPool
+{
+    QueryPoolCommonHeader header;
+
+    // Each timestamp gets its own disjoint query for the tick frequency
+    ID3D11Query **timestamps;
+    ID3D11Query **disjoints;
+} D3D11QueryPool;
+
 typedef struct D3D11Buffer
 {
     ID3D11Buffer *handle;
@@ -756,6 +767,7 @@ struct D3D11Renderer
     Uint8 debugMode;
     BOOL supportsTearing;
     Uint8 supportsFlipDiscard;
+    BOOL driverCommandLists;
 
     SDL_iconv_t iconv;
 
@@ -886,6 +898,59 @@ static SDL_PropertiesID D3D11_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static void *D3D11_GetPipelineCacheData(SDL_GPUDevice *device, size_t *size)
+{
+    // The D3D11 driver caches compiled shaders on its own
+    SDL_Unsupported();
+    return NULL;
+}
+
+static SDL_GPUMemoryInfo *D3D11_GetMemoryInfo(SDL_GPUDevice *device, int *count)
+{
+    D3D11Renderer *renderer = (D3D11Renderer *)device->driverData;
+    IDXGIAdapter3 *adapter3;
+    DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo;
+    SDL_GPUMemoryInfo *result;
+    HRESULT res;
+
+    // IDXGIAdapter3 requires Windows 10
+    res = IDXGIAdapter2_QueryInterface(
+        renderer->adapter,
+        &D3D_IID_IDXGIAdapter3,
+        (void **)&adapter3);
+    CHECK_D3D11_ERROR_AND_RETURN("Could not get IDXGIAdapter3 interface", NULL);
+
+    // One entry for the local (video memory) segment group and one for the non-local one
+    result = (SDL_GPUMemoryInfo *)SDL_calloc(2, sizeof(SDL_GPUMemoryInfo));
+    if (!result) {
+        IDXGIAdapter3_Release(adapter3);
+        return NULL;
+    }
+
+    res = IDXGIAdapter3_QueryVideoMemoryInfo(adapter3, 0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &videoMemoryInfo);
+    if (FAILED(res)) {
+        IDXGIAdapter3_Release(adapter3);
+        SDL_free(result);
+        CHECK_D3D11_ERROR_AND_RETURN("Could not query video memory info", NULL);
+    }
+    result[0].budget = videoMemoryInfo.Budget;
+    result[0].usage = videoMemoryInfo.CurrentUsage;
+    result[0].device_local = true;
+
+    res = IDXGIAdapter3_QueryVideoMemoryInfo(adapter3, 0, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &videoMemoryInfo);
+    IDXGIAdapter3_Release(adapter3);
+    if (FAILED(res)) {
+        SDL_free(result);
+        CHECK_D3D11_ERROR_AND_RETURN("Could not query video memory info", NULL);
+    }
+    result[1].budget = videoMemoryInfo.Budget;
+    result[1].usage = videoMemoryInfo.CurrentUsage;
+    result[1].device_local = false;
+
+    *count = 2;
+    return result;
+}
+
 // Helper Functions
 
 static inline Uint32 D3D11_INTERNAL_CalcSubresource(
@@ -1268,6 +1333,26 @@ static void D3D11_ReleaseComputePipeline(
     SDL_free(d3d11ComputePipeline);
 }
 
+static void D3D11_ReleaseQueryPool(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool)
+{
+    // Query pools aren't tracked by command buffers, so make sure none are using it
+    D3D11_Wait(driverData);
+
+    D3D11_INTERNAL_DestroyQueryPool((D3D11QueryPool *)queryPool);
+}
+
+static bool D3D11_WriteBindlessDescriptor(
+    SDL_GPURenderer *driverData,
+    GPU_BindlessType type,
+    Uint32 index,
+    void *resource)
+{
+    // D3D11 has no descriptor heaps
+    return SDL_Unsupported();
+}
+
 static void D3D11_ReleaseGraphicsPipeline(
     SDL_GPURenderer *driverData,
     SDL_GPUGraphicsPipeline *graphicsPipeline)
@@ -1825,6 +1910,25 @@ static void D3D11_PopDebugGroup(
     ID3DUserDefinedAnnotation_EndEvent(d3d11CommandBuffer->annotation);
 }
 
+static void D3D11_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 index)
+{
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer *)commandBuffer;
+    D3D11QueryPool *d3d11QueryPool = (D3D11QueryPool *)queryPool;
+
+    ID3D11DeviceContext_Begin(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous *)d3d11QueryPool->disjoints[index]);
+    ID3D11DeviceContext_End(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous *)d3d11QueryPool->timestamps[index]);
+    ID3D11DeviceContext_End(
+        d3d11CommandBuffer->context,
+        (ID3D11Asynchronous *)d3d11QueryPool->disjoints[index]);
+}
+
 // Resource Creation
 
 static SDL_GPUSampler *D3D11_CreateSampler(
@@ -2213,6 +2317,7 @@ static SDL_GPUTexture *D3D11_CreateTexture(
 
     container = SDL_malloc(sizeof(D3D11TextureContainer));
     container->header.info = *createinfo;
+    container->header.sparse = NULL;
     container->canBeCycled = 1;
     container->activeTexture = texture;
     container->textureCapacity = 1;
@@ -2555,6 +2660,69 @@ static D3D11TransferBuffer *D3D11_INTERNAL_CreateTransferBuffer(
 }
 
 // This actually returns a container handle so we can rotate buffers on Cycle.
+static void D3D11_INTERNAL_DestroyQueryPool(D3D11QueryPool *queryPool)
+{
+    for (Uint32 i = 0; i < queryPool->header.numQueries; i += 1) {
+        if (queryPool->timestamps && queryPool->timestamps[i]) {
+            ID3D11Query_Release(queryPool->timestamps[i]);
+        }
+        if (queryPool->disjoints && queryPool->disjoints[i]) {
+            ID3D11Query_Release(queryPool->disjoints[i]);
+        }
+    }
+    SDL_free(queryPool->timestamps);
+    SDL_free(queryPool->disjoints);
+    SDL_free(queryPool);
+}
+
+static SDL_GPUQueryPool *D3D11_CreateQueryPool(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUQueryPoolCreateInfo *createinfo)
+{
+    D3D11Renderer *renderer = (D3D11Renderer *)driverData;
+    D3D11_QUERY_DESC timestampDesc;
+    D3D11_QUERY_DESC disjointDesc;
+    D3D11QueryPool *queryPool;
+    HRESULT res;
+
+    queryPool = (D3D11QueryPool *)SDL_calloc(1, sizeof(D3D11QueryPool));
+    if (!queryPool) {
+        return NULL;
+    }
+    queryPool->header.type = createinfo->type;
+    queryPool->header.numQueries = createinfo->num_queries;
+    queryPool->timestamps = (ID3D11Query **)SDL_calloc(createinfo->num_queries, sizeof(ID3D11Query *));
+    queryPool->disjoints = (ID3D11Query **)SDL_calloc(createinfo->num_queries, sizeof(ID3D11Query *));
+    if (!queryPool->timestamps || !queryPool->disjoints) {
+        D3D11_INTERNAL_DestroyQueryPool(queryPool);
+        return NULL;
+    }
+
+    timestampDesc.Query = D3D11_QUERY_TIMESTAMP;
+    timestampDesc.MiscFlags = 0;
+    disjointDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+    disjointDesc.MiscFlags = 0;
+
+    for (Uint32 i = 0; i < createinfo->num_queries; i += 1) {
+        res = ID3D11Device_CreateQuery(
+            renderer->device,
+            &timestampDesc,
+            &queryPool->timestamps[i]);
+        if (SUCCEEDED(res)) {
+            res = ID3D11Device_CreateQuery(
+                renderer->device,
+                &disjointDesc,
+                &queryPool->disjoints[i]);
+        }
+        if (FAILED(res)) {
+            D3D11_INTERNAL_DestroyQueryPool(queryPool);
+            CHECK_D3D11_ERROR_AND_RETURN("Could not create timestamp query", NULL);
+        }
+    }
+
+    return (SDL_GPUQueryPool *)queryPool;
+}
+
 static SDL_GPUTransferBuffer *D3D11_CreateTransferBuffer(
     SDL_GPURenderer *driverData,
     SDL_GPUTransferBufferUsage usage, // ignored on D3D11
@@ -3201,7 +3369,8 @@ static bool D3D11_INTERNAL_AcquireFence(
 }
 
 static SDL_GPUCommandBuffer *D3D11_AcquireCommandBuffer(
-    SDL_GPURenderer *driverData)
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueueType queueType)
 {
     D3D11Renderer *renderer = (D3D11Renderer *)driverData;
     D3D11CommandBuffer *commandBuffer;
@@ -3889,8 +4058,9 @@ static void D3D11_INTERNAL_BindGraphicsResources(
 {
     D3D11GraphicsPipeline *graphicsPipeline = commandBuffer->graphicsPipeline;
 
-    ID3D11Buffer *nullBuf = NULL;
-    Uint32 offsetInConstants, blockSizeInConstants;
+    ID3D11Buffer *nullBufs[MAX_UNIFORM_BUFFERS_PER_STAGE] = { NULL };
+    Uint32 offsetsInConstants[MAX_UNIFORM_BUFFERS_PER_STAGE];
+    Uint32 blockSizesInConstants[MAX_UNIFORM_BUFFERS_PER_STAGE];
 
     if (commandBuffer->needVertexBufferBind) {
         ID3D11DeviceContext_IASetVertexBuffers(
@@ -3965,26 +4135,36 @@ static void D3D11_INTERNAL_BindGraphicsResources(
     }
 
     if (commandBuffer->needVertexUniformBufferBind) {
-        for (Uint32 i = 0; i < graphicsPipeline->header.num_vertex_uniform_buffers; i += 1) {
+        Uint32 numUniformBuffers = graphicsPipeline->header.num_vertex_uniform_buffers;
+
+        if (numUniformBuffers > 0) {
+            ID3D11Buffer *uniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+
+            for (Uint32 i = 0; i < numUniformBuffers; i += 1) {
+                uniformBuffers[i] = commandBuffer->vertexUniformBuffers[i]->buffer;
+                offsetsInConstants[i] = commandBuffer->vertexUniformBuffers[i]->drawOffset / 16;
+                blockSizesInConstants[i] = commandBuffer->vertexUniformBuffers[i]->currentBlockSize / 16;
+            }
+
             /* stupid workaround for god awful D3D11 drivers
              * see: https://learn.microsoft.com/en-us/windows/win32/api/d3d11_1/nf-d3d11_1-id3d11devicecontext1-vssetconstantbuffers1#calling-vssetconstantbuffers1-with-command-list-emulation
+             * Drivers with native command lists handle a new offset into the same buffer correctly.
              */
-            ID3D11DeviceContext1_VSSetConstantBuffers(
-                commandBuffer->context,
-                i,
-                1,
-                &nullBuf);
-
-            offsetInConstants = commandBuffer->vertexUniformBuffers[i]->drawOffset / 16;
-            blockSizeInConstants = commandBuffer->vertexUniformBuffers[i]->currentBlockSize / 16;
+            if (!commandBuffer->renderer->driverCommandLists) {
+                ID3D11DeviceContext1_VSSetConstantBuffers(
+                    commandBuffer->context,
+                    0,
+                    numUniformBuffers,
+                    nullBufs);
+            }
 
             ID3D11DeviceContext1_VSSetConstantBuffers1(
                 commandBuffer->context,
-                i,
-                1,
-                &commandBuffer->vertexUniformBuffers[i]->buffer,
-                &offsetInConstants,
-                &blockSizeInConstants);
+                0,
+                numUniformBuffers,
+                uniformBuffers,
+                offsetsInConstants,
+                blockSizesInConstants);
         }
 
         commandBuffer->needVertexUniformBufferBind = false;
@@ -4053,26 +4233,36 @@ static void D3D11_INTERNAL_BindGraphicsResources(
     }
 
     if (commandBuffer->needFragmentUniformBufferBind) {
-        for (Uint32 i = 0; i < graphicsPipeline->header.num_fragment_uniform_buffers; i += 1) {
+        Uint32 numUniformBuffers = graphicsPipeline->header.num_fragment_uniform_buffers;
+
+        if (numUniformBuffers > 0) {
+            ID3D11Buffer *uniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+
+            for (Uint32 i = 0; i < numUniformBuffers; i += 1) {
+                uniformBuffers[i] = commandBuffer->fragmentUniformBuffers[i]->buffer;
+                offsetsInConstants[i] = commandBuffer->fragmentUniformBuffers[i]->drawOffset / 16;
+                blockSizesInConstants[i] = commandBuffer->fragmentUniformBuffers[i]->currentBlockSize / 16;
+            }
+
             /* stupid workaround for god awful D3D11 drivers
              * see: https://learn.microsoft.com/en-us/windows/win32/api/d3d11_1/nf-d3d11_1-id3d11devicecontext1-pssetconstantbuffers1#calling-pssetconstantbuffers1-with-command-list-emulation
+             * Drivers with native command lists handle a new offset into the same buffer correctly.
              */
-            ID3D11DeviceContext1_PSSetConstantBuffers(
-                commandBuffer->context,
-                i,
-                1,
-                &nullBuf);
-
-            offsetInConstants = commandBuffer->fragmentUniformBuffers[i]->drawOffset / 16;
-            blockSizeInConstants = commandBuffer->fragmentUniformBuffers[i]->currentBlockSize / 16;
+            if (!commandBuffer->renderer->driverCommandLists) {
+                ID3D11DeviceContext1_PSSetConstantBuffers(
+                    commandBuffer->context,
+                    0,
+                    numUniformBuffers,
+                    nullBufs);
+            }
 
             ID3D11DeviceContext1_PSSetConstantBuffers1(
                 commandBuffer->context,
-                i,
-                1,
-                &commandBuffer->fragmentUniformBuffers[i]->buffer,
-                &offsetInConstants,
-                &blockSizeInConstants);
+                0,
+                numUniformBuffers,
+                uniformBuffers,
+                offsetsInConstants,
+                blockSizesInConstants);
         }
 
         commandBuffer->needFragmentUniformBufferBind = false;
@@ -4182,6 +4372,30 @@ static void D3D11_DrawIndexedPrimitivesIndirect(
     D3D11_INTERNAL_TrackBuffer(d3d11CommandBuffer, d3d11Buffer);
 }
 
+static void D3D11_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    // D3D11 can't read the draw count on the GPU, so every slot is drawn
+    D3D11_DrawPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+}
+
+static void D3D11_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    // D3D11 can't read the draw count on the GPU, so every slot is drawn
+    D3D11_DrawIndexedPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+}
+
 static void D3D11_EndRenderPass(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -4304,6 +4518,32 @@ static void D3D11_Blit(
         NULL);
 }
 
+static void D3D11_BlitTextures(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits)
+{
+    D3D11CommandBuffer *d3d11CommandBuffer = (D3D11CommandBuffer *)commandBuffer;
+    D3D11Renderer *renderer = (D3D11Renderer *)d3d11CommandBuffer->renderer;
+    BlitPipelineCacheEntry *blitPipelines = &renderer->blitPipelines[0];
+
+    SDL_GPU_BlitBatchCommon(
+        commandBuffer,
+        infos,
+        numBlits,
+        renderer->blitLinearSampler,
+        renderer->blitNearestSampler,
+        NULL,
+        NULL,
+        NULL,
+        NULL,
+        NULL,
+        NULL,
+        &blitPipelines,
+        NULL,
+        NULL);
+}
+
 // Compute State
 
 static void D3D11_BeginComputePass(
@@ -4487,8 +4727,9 @@ static void D3D11_INTERNAL_BindComputeResources(
 {
     D3D11ComputePipeline *computePipeline = commandBuffer->computePipeline;
 
-    ID3D11Buffer *nullBuf = NULL;
-    Uint32 offsetInConstants, blockSizeInConstants;
+    ID3D11Buffer *nullBufs[MAX_UNIFORM_BUFFERS_PER_STAGE] = { NULL };
+    Uint32 offsetsInConstants[MAX_UNIFORM_BUFFERS_PER_STAGE];
+    Uint32 blockSizesInConstants[MAX_UNIFORM_BUFFERS_PER_STAGE];
 
     if (commandBuffer->needComputeSamplerBind) {
         if (computePipeline->header.numSamplers > 0) {
@@ -4553,26 +4794,36 @@ static void D3D11_INTERNAL_BindComputeResources(
     }
 
     if (commandBuffer->needComputeUniformBufferBind) {
-        for (Uint32 i = 0; i < computePipeline->header.numUniformBuffers; i += 1) {
+        Uint32 numUniformBuffers = computePipeline->header.numUniformBuffers;
+
+        if (numUniformBuffers > 0) {
+            ID3D11Buffer *uniformBuffers[MAX_UNIFORM_BUFFERS_PER_STAGE];
+
+            for (Uint32 i = 0; i < numUniformBuffers; i += 1) {
+                uniformBuffers[i] = commandBuffer->computeUniformBuffers[i]->buffer;
+                offsetsInConstants[i] = commandBuffer->computeUniformBuffers[i]->drawOffset / 16;
+                blockSizesInConstants[i] = commandBuffer->computeUniformBuffers[i]->currentBlockSize / 16;
+            }
+
             /* stupid workaround for god awful D3D11 drivers
              * see: https://learn.microsoft.com/en-us/windows/win32/api/d3d11_1/nf-d3d11_1-id3d11devicecontext1-vssetconstantbuffers1#calling-vssetconstantbuffers1-with-command-list-emulation
+             * Drivers with native command lists handle a new offset into the same buffer correctly.
              */
-            ID3D11DeviceContext1_CSSetConstantBuffers(
-                commandBuffer->context,
-                i,
-                1,
-                &nullBuf);
-
-            offsetInConstants = commandBuffer->computeUniformBuffers[i]->drawOffset / 16;
-            blockSizeInConstants = commandBuffer->computeUniformBuffers[i]->currentBlockSize / 16;
+            if (!commandBuffer->renderer->driverCommandLists) {
+                ID3D11DeviceContext1_CSSetConstantBuffers(
+                    commandBuffer->context,
+                    0,
+                    numUniformBuffers,
+                    nullBufs);
+            }
 
             ID3D11DeviceContext1_CSSetConstantBuffers1(
                 commandBuffer->context,
-                i,
-                1,
-                &commandBuffer->computeUniformBuffers[i]->buffer,
-                &offsetInConstants,
-                &blockSizeInConstants);
+                0,
+                numUniformBuffers,
+                uniformBuffers,
+                offsetsInConstants,
+                blockSizesInConstants);
         }
         commandBuffer->needComputeUniformBufferBind = false;
     }
@@ -4683,6 +4934,57 @@ static void D3D11_ReleaseFence(
     }
 }
 
+static bool D3D11_GetQueryPoolResults(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 firstQuery,
+    Uint32 numQueries,
+    Uint64 *results)
+{
+    D3D11Renderer *renderer = (D3D11Renderer *)driverData;
+    D3D11QueryPool *d3d11QueryPool = (D3D11QueryPool *)queryPool;
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+    UINT64 timestamp;
+    HRESULT res = S_OK;
+
+    SDL_LockMutex(renderer->contextLock);
+    for (Uint32 i = 0; i < numQueries; i += 1) {
+        res = ID3D11DeviceContext_GetData(
+            renderer->immediateContext,
+            (ID3D11Asynchronous *)d3d11QueryPool->disjoints[firstQuery + i],
+            &disjoint,
+            sizeof(disjoint),
+            D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (res != S_OK) {
+            break;
+        }
+        res = ID3D11DeviceContext_GetData(
+            renderer->immediateContext,
+            (ID3D11Asynchronous *)d3d11QueryPool->timestamps[firstQuery + i],
+            &timestamp,
+            sizeof(timestamp),
+            D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (res != S_OK) {
+            break;
+        }
+
+        // A disjoint range means the clock changed mid-frame, so the value is meaningless
+        if (disjoint.Disjoint || disjoint.Frequency == 0) {
+            results[i] = 0;
+        } else {
+            results[i] = (Uint64)((double)timestamp * (double)SDL_NS_PER_SECOND / (double)disjoint.Frequency);
+        }
+    }
+    SDL_UnlockMutex(renderer->contextLock);
+
+    if (res == S_FALSE) {
+        SET_STRING_ERROR_AND_RETURN("Query results are not available yet", false);
+    }
+    CHECK_D3D11_ERROR_AND_RETURN("Could not get query results", false);
+
+    return true;
+}
+
 // Cleanup
 
 /* D3D11 does not provide a deferred texture-to-buffer copy operation,
@@ -5723,26 +6025,22 @@ static bool D3D11_Submit(
         }
     }
 
-    SDL_LockMutex(renderer->contextLock);
-
-    if (!D3D11_INTERNAL_AcquireFence(d3d11CommandBuffer)) {
-        SDL_UnlockMutex(renderer->contextLock);
-        return false;
-    }
-
-    // Notify the command buffer completion query that we have completed recording
-    ID3D11DeviceContext_End(
-        renderer->immediateContext,
-        (ID3D11Asynchronous *)d3d11CommandBuffer->fence->handle);
-
-    // Serialize the commands into the command list
+    /* Serialize the commands into the command list.
+     * The deferred context belongs to this command buffer, so this doesn't need the context lock
+     * and threads submitting at the same time only serialize on ExecuteCommandList.
+     */
     res = ID3D11DeviceContext_FinishCommandList(
         d3d11CommandBuffer->context,
         0,
         &commandList);
-    if (FAILED(res)) {
+    CHECK_D3D11_ERROR_AND_RETURN("Could not finish command list recording!", false)
+
+    SDL_LockMutex(renderer->contextLock);
+
+    if (!D3D11_INTERNAL_AcquireFence(d3d11CommandBuffer)) {
         SDL_UnlockMutex(renderer->contextLock);
-        CHECK_D3D11_ERROR_AND_RETURN("Could not finish command list recording!", false)
+        ID3D11CommandList_Release(commandList);
+        return false;
     }
 
     // Submit the command list to the immediate context
@@ -5752,6 +6050,11 @@ static bool D3D11_Submit(
         0);
     ID3D11CommandList_Release(commandList);
 
+    // Notify the command buffer completion query once the command list has been issued
+    ID3D11DeviceContext_End(
+        renderer->immediateContext,
+        (ID3D11Asynchronous *)d3d11CommandBuffer->fence->handle);
+
     // Mark the command buffer as submitted
     if (renderer->submittedCommandBufferCount >= renderer->submittedCommandBufferCapacity) {
         renderer->submittedCommandBufferCapacity = renderer->submittedCommandBufferCount + 1;
@@ -5789,6 +6092,8 @@ static bool D3D11_Submit(
 
         if (FAILED(res)) {
             result = false;
+        } else {
+            windowData->presentCount += 1;
         }
 
         ID3D11Texture2D_Release(windowData->texture.handle);
@@ -5835,6 +6140,14 @@ static SDL_GPUFence *D3D11_SubmitAndAcquireFence(
     return (SDL_GPUFence *)d3d11CommandBuffer->fence;
 }
 
+static bool D3D11_AddWaitFence(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUFence *fence)
+{
+    // There is only one queue, so submissions are already ordered
+    return true;
+}
+
 static bool D3D11_Cancel(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -6274,6 +6587,44 @@ static bool D3D11_WaitForSwapchain(
     return true;
 }
 
+static bool D3D11_GetPresentStatistics(
+    SDL_GPURenderer *driverData,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics)
+{
+    D3D11WindowData *windowData = D3D11_INTERNAL_FetchWindowData(window);
+    DXGI_FRAME_STATISTICS frameStatistics;
+    UINT lastPresentCount;
+    HRESULT res;
+
+    if (windowData == NULL) {
+        SET_STRING_ERROR_AND_RETURN("Cannot query present statistics from an unclaimed window!", false);
+    }
+
+    statistics->present_count = windowData->presentCount;
+
+    /* DXGI only keeps frame statistics while it can track the swapchain's presentation,
+     * so failing to get them just means the display time is unknown.
+     */
+    res = IDXGISwapChain1_GetLastPresentCount(windowData->swapchain, &lastPresentCount);
+    if (SUCCEEDED(res)) {
+        res = IDXGISwapChain1_GetFrameStatistics(windowData->swapchain, &frameStatistics);
+    }
+    if (SUCCEEDED(res) && frameStatistics.PresentCount <= lastPresentCount) {
+        // DXGI counts presents per swapchain, so map its counts back onto the window's present count
+        Uint64 behind = lastPresentCount - frameStatistics.PresentCount;
+        if (behind < windowData->presentCount) {
+            statistics->displayed_frame_id = windowData->presentCount - behind;
+            statistics->display_time_ns = SDL_GPU_ConvertPresentTime(
+                (Uint64)frameStatistics.SyncQPCTime.QuadPart,
+                SDL_GetPerformanceCounter(),
+                SDL_GetPerformanceFrequency());
+        }
+    }
+
+    return true;
+}
+
 static SDL_GPUDevice *D3D11_CreateDevice(bool debugMode, bool preferLowPower, SDL_PropertiesID props)
 {
     D3D11Renderer *renderer;
@@ -6481,9 +6832,25 @@ tryCreateDevice:
     }
 #endif
 
+    /* Command buffers are always recorded on deferred contexts.
+     * Without driver command lists the runtime emulates them, which still records in parallel
+     * but replays more slowly, so report it to help explain performance.
+     */
+    D3D11_FEATURE_DATA_THREADING threading;
+    res = ID3D11Device1_CheckFeatureSupport(
+        renderer->device,
+        D3D11_FEATURE_THREADING,
+        &threading,
+        sizeof(D3D11_FEATURE_DATA_THREADING));
+    if (FAILED(res)) {
+        threading.DriverCommandLists = FALSE;
+    }
+    renderer->driverCommandLists = threading.DriverCommandLists;
+
     // Print driver info
     SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "SDL GPU Driver: D3D11");
     SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "D3D11 Adapter: %S", adapterDesc.Description);
+    SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "D3D11 Driver Command Lists: %s", threading.DriverCommandLists ? "yes" : "no");
 
     // Create mutexes
     renderer->contextLock = SDL_CreateMutex();
@@ -6549,7 +6916,7 @@ tryCreateDevice:
     D3D11_INTERNAL_InitBlitPipelines(renderer);
 
     // Create the SDL_GPU Device
-    result = (SDL_GPUDevice *)SDL_malloc(sizeof(SDL_GPUDevice));
+    result = (SDL_GPUDevice *)SDL_calloc(1, sizeof(SDL_GPUDevice));
     ASSIGN_DRIVER(D3D11)
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = SDL_GPU_SHADERFORMAT_DXBC;
@@ -26,6 +26,9 @@
 #include "../../core/windows/SDL_windows.h"
 #include "../../video/directx/SDL_d3d12.h"
 #include "../SDL_sysgpu.h"
+#ifdef SDL_D3D12_XBOX
+#include "../../core/gdk/SDL_gdk.h"
+#endif
 
 #ifdef __IDXGIInfoQueue_INTERFACE_DEFINED__
 #define HAVE_IDXGIINFOQUEUE
@@ -39,9 +42,9 @@
 #define g_BlitFrom3D        D3D12_BlitFrom3D
 #define g_BlitFromCube      D3D12_BlitFromCube
 #define g_BlitFromCubeArray D3D12_BlitFromCubeArray
-#if defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX) && defined(SDL_PLATFORM_XBOXSERIES)
 #include "D3D12_Blit_Series.h"
-#elif defined(SDL_PLATFORM_XBOXONE)
+#elif defined(SDL_D3D12_XBOX) && defined(SDL_PLATFORM_XBOXONE)
 #include "D3D12_Blit_One.h"
 #else
 #include "D3D12_Blit.h"
@@ -84,9 +87,9 @@
 
 // Defines
 #if defined(_WIN32)
-#if defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX) && defined(SDL_PLATFORM_XBOXSERIES)
 #define D3D12_DLL "d3d12_xs.dll"
-#elif defined(SDL_PLATFORM_XBOXONE)
+#elif defined(SDL_D3D12_XBOX) && defined(SDL_PLATFORM_XBOXONE)
 #define D3D12_DLL "d3d12_x.dll"
 #else
 #define D3D12_DLL "d3d12.dll"
@@ -107,6 +110,7 @@
 #define D3D12_SERIALIZE_ROOT_SIGNATURE_FUNC "D3D12SerializeRootSignature"
 #define CREATE_DXGI_FACTORY1_FUNC           "CreateDXGIFactory1"
 #define DXGI_GET_DEBUG_INTERFACE_FUNC       "DXGIGetDebugInterface"
+#define DXGI_GET_DEBUG_INTERFACE1_FUNC      "DXGIGetDebugInterface1"
 #define D3D12_GET_DEBUG_INTERFACE_FUNC      "D3D12GetDebugInterface"
 #define WINDOW_PROPERTY_DATA                "SDL_GPUD3D12WindowPropertyData"
 #define D3D_FEATURE_LEVEL_CHOICE            D3D_FEATURE_LEVEL_11_1
@@ -118,6 +122,10 @@
 #define VIEW_GPU_DESCRIPTOR_COUNT             65536
 #define SAMPLER_GPU_DESCRIPTOR_COUNT          2048
 #define STAGING_HEAP_DESCRIPTOR_COUNT         1024
+// Carved out of the front of every GPU descriptor heap when bindless is enabled
+#define BINDLESS_MAX_TEXTURES                 16384
+#define BINDLESS_MAX_BUFFERS                  8192
+#define BINDLESS_MAX_SAMPLERS                 1024
 
 #define SDL_GPU_SHADERSTAGE_COMPUTE (SDL_GPUShaderStage)2
 
@@ -130,6 +138,7 @@
 // Function Pointer Signatures
 typedef HRESULT(WINAPI *PFN_CREATE_DXGI_FACTORY1)(const GUID *riid, void **ppFactory);
 typedef HRESULT(WINAPI *PFN_DXGI_GET_DEBUG_INTERFACE)(const GUID *riid, void **ppDebug);
+typedef HRESULT(WINAPI *PFN_DXGI_GET_DEBUG_INTERFACE1)(UINT Flags, const GUID *riid, void **pDebug);
 
 // IIDs (from https://www.magnumdb.com/)
 static const IID D3D_IID_IDXGIFactory1 = { 0x770aae78, 0xf26f, 0x4dba, { 0xa8, 0x29, 0x25, 0x3c, 0x83, 0xd1, 0xb3, 0x87 } };
@@ -137,7 +146,10 @@ static const IID D3D_IID_IDXGIFactory4 = { 0x1bc6ea02, 0xef36, 0x464f, { 0xbf, 0
 static const IID D3D_IID_IDXGIFactory5 = { 0x7632e1f5, 0xee65, 0x4dca, { 0x87, 0xfd, 0x84, 0xcd, 0x75, 0xf8, 0x83, 0x8d } };
 static const IID D3D_IID_IDXGIFactory6 = { 0xc1b6694f, 0xff09, 0x44a9, { 0xb0, 0x3c, 0x77, 0x90, 0x0a, 0x0a, 0x1d, 0x17 } };
 static const IID D3D_IID_IDXGIAdapter1 = { 0x29038f61, 0x3839, 0x4626, { 0x91, 0xfd, 0x08, 0x68, 0x79, 0x01, 0x1a, 0x05 } };
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if !defined(SDL_D3D12_XBOX)
+static const IID D3D_IID_IDXGIAdapter3 = { 0x645967a4, 0x1392, 0x4310, { 0xa7, 0x98, 0x80, 0x53, 0xce, 0x3e, 0x93, 0xfd } };
+#endif
+#if defined(SDL_D3D12_XBOX)
 static const IID D3D_IID_IDXGIDevice1 = { 0x77db970f, 0x6276, 0x48ba, { 0xba, 0x28, 0x07, 0x01, 0x43, 0xb4, 0x39, 0x2c } };
 #else
 static const IID D3D_IID_IDXGIDevice = { 0x54ec77fa, 0x1377, 0x44e6, { 0x8c, 0x32, 0x88, 0xfd, 0x5f, 0x44, 0xc8, 0x4c } };
@@ -147,19 +159,27 @@ static const IID D3D_IID_IDXGISwapChain3 = { 0x94d99bdb, 0xf1f8, 0x4ab0, { 0xb2,
 static const IID D3D_IID_IDXGIDebug = { 0x119e7452, 0xde9e, 0x40fe, { 0x88, 0x06, 0x88, 0xf9, 0x0c, 0x12, 0xb4, 0x41 } };
 static const IID D3D_IID_IDXGIInfoQueue = { 0xd67441c7, 0x672a, 0x476f, { 0x9e, 0x82, 0xcd, 0x55, 0xb4, 0x49, 0x49, 0xce } };
 #endif
+#if !defined(SDL_D3D12_XBOX)
+static const IID D3D_IID_IDXGraphicsAnalysis = { 0x9f251514, 0x9d4d, 0x4902, { 0x9d, 0x60, 0x18, 0x98, 0x8a, 0xb7, 0xd4, 0xb5 } };
+#endif
 static const GUID D3D_IID_DXGI_DEBUG_ALL = { 0xe48ae283, 0xda80, 0x490b, { 0x87, 0xe6, 0x43, 0xe9, 0xa9, 0xcf, 0xda, 0x08 } };
 
 static const IID D3D_IID_ID3D12Device = { 0x189819f1, 0x1db6, 0x4b57, { 0xbe, 0x54, 0x18, 0x21, 0x33, 0x9b, 0x85, 0xf7 } };
+static const IID D3D_IID_ID3D12Device1 = { 0x77acce80, 0x638e, 0x4e65, { 0x88, 0x95, 0xc1, 0xf2, 0x33, 0x86, 0x86, 0x3e } };
 static const IID D3D_IID_ID3D12CommandQueue = { 0x0ec870a6, 0x5d7e, 0x4c22, { 0x8c, 0xfc, 0x5b, 0xaa, 0xe0, 0x76, 0x16, 0xed } };
 static const IID D3D_IID_ID3D12DescriptorHeap = { 0x8efb471d, 0x616c, 0x4f49, { 0x90, 0xf7, 0x12, 0x7b, 0xb7, 0x63, 0xfa, 0x51 } };
 static const IID D3D_IID_ID3D12Resource = { 0x696442be, 0xa72e, 0x4059, { 0xbc, 0x79, 0x5b, 0x5c, 0x98, 0x04, 0x0f, 0xad } };
 static const IID D3D_IID_ID3D12CommandAllocator = { 0x6102dee4, 0xaf59, 0x4b09, { 0xb9, 0x99, 0xb4, 0x4d, 0x73, 0xf0, 0x9b, 0x24 } };
 static const IID D3D_IID_ID3D12CommandList = { 0x7116d91c, 0xe7e4, 0x47ce, { 0xb8, 0xc6, 0xec, 0x81, 0x68, 0xf4, 0x37, 0xe5 } };
 static const IID D3D_IID_ID3D12GraphicsCommandList = { 0x5b160d0f, 0xac1b, 0x4185, { 0x8b, 0xa8, 0xb3, 0xae, 0x42, 0xa5, 0xa4, 0x55 } };
+static const IID D3D_IID_ID3D12GraphicsCommandList5 = { 0x55050859, 0x4024, 0x474c, { 0x87, 0xf5, 0x64, 0x72, 0xea, 0xee, 0x44, 0xea } };
 static const IID D3D_IID_ID3D12Fence = { 0x0a753dcf, 0xc4d8, 0x4b91, { 0xad, 0xf6, 0xbe, 0x5a, 0x60, 0xd9, 0x5a, 0x76 } };
+static const IID D3D_IID_ID3D12Heap = { 0x6b3b2502, 0x6e51, 0x45b3, { 0x90, 0xee, 0x98, 0x84, 0x26, 0x5e, 0x8d, 0xf3 } };
 static const IID D3D_IID_ID3D12RootSignature = { 0xc54a6b66, 0x72df, 0x4ee8, { 0x8b, 0xe5, 0xa9, 0x46, 0xa1, 0x42, 0x92, 0x14 } };
 static const IID D3D_IID_ID3D12CommandSignature = { 0xc36a797c, 0xec80, 0x4f0a, { 0x89, 0x85, 0xa7, 0xb2, 0x47, 0x50, 0x82, 0xd1 } };
 static const IID D3D_IID_ID3D12PipelineState = { 0x765a30f3, 0xf624, 0x4c6f, { 0xa8, 0x28, 0xac, 0xe9, 0x48, 0x62, 0x24, 0x45 } };
+static const IID D3D_IID_ID3D12QueryHeap = { 0x0d9658ae, 0xed45, 0x469e, { 0xa6, 0x1d, 0x97, 0x0e, 0xc5, 0x83, 0xca, 0xb4 } };
+static const IID D3D_IID_ID3D12PipelineLibrary = { 0xc64226a8, 0x9201, 0x46af, { 0xb4, 0xcc, 0x53, 0xfb, 0x9f, 0xf7, 0x41, 0x4f } };
 static const IID D3D_IID_ID3D12Debug = { 0x344488b7, 0x6846, 0x474b, { 0xb9, 0x89, 0xf0, 0x27, 0x44, 0x82, 0x45, 0xe0 } };
 static const IID D3D_IID_ID3D12InfoQueue = { 0x0742a90b, 0xc387, 0x483f, { 0xb9, 0x46, 0x30, 0xa7, 0xe4, 0xe6, 0x14, 0x58 } };
 static const IID D3D_IID_ID3D12InfoQueue1 = { 0x2852dd88, 0xb484, 0x4c0c, { 0xb6, 0xb1, 0x67, 0x16, 0x85, 0x00, 0xe6, 0x00 } };
@@ -699,6 +719,23 @@ static D3D12_FILTER SDLToD3D12_Filter(
 }
 
 // Structures
+#if !defined(SDL_D3D12_XBOX)
+// From DXProgrammableCapture.h, which isn't in every SDK
+typedef struct IDXGraphicsAnalysis IDXGraphicsAnalysis;
+typedef struct IDXGraphicsAnalysisVtbl
+{
+    HRESULT(STDMETHODCALLTYPE *QueryInterface)(IDXGraphicsAnalysis *This, REFIID riid, void **ppvObject);
+    ULONG(STDMETHODCALLTYPE *AddRef)(IDXGraphicsAnalysis *This);
+    ULONG(STDMETHODCALLTYPE *Release)(IDXGraphicsAnalysis *This);
+    void(STDMETHODCALLTYPE *BeginCapture)(IDXGraphicsAnalysis *This);
+    void(STDMETHODCALLTYPE *EndCapture)(IDXGraphicsAnalysis *This);
+} IDXGraphicsAnalysisVtbl;
+struct IDXGraphicsAnalysis
+{
+    const IDXGraphicsAnalysisVtbl *lpVtbl;
+};
+#endif
+
 typedef struct D3D12Renderer D3D12Renderer;
 typedef struct D3D12CommandBufferPool D3D12CommandBufferPool;
 typedef struct D3D12CommandBuffer D3D12CommandBuffer;
@@ -718,6 +755,7 @@ typedef struct D3D12Fence
     ID3D12Fence *handle;
     HANDLE event; // used for blocking
     SDL_AtomicInt referenceCount;
+    ID3D12CommandQueue *queue; // the queue the fence is signaled on
 } D3D12Fence;
 
 struct D3D12DescriptorHeap
@@ -731,6 +769,7 @@ struct D3D12DescriptorHeap
     bool staging;
 
     Uint32 currentDescriptorIndex; // only used by GPU heaps
+    Uint32 bindlessVersion;        // only used by GPU heaps
 };
 
 typedef struct D3D12GPUDescriptorHeapPool
@@ -804,6 +843,7 @@ struct D3D12Texture
     Uint32 subresourceCount; /* layerCount * num_levels */
 
     ID3D12Resource *resource;
+    ID3D12Heap *tileHeap; // backs the tiles of a reserved resource, NULL otherwise
     D3D12StagingDescriptor srvHandle;
 
     SDL_AtomicInt referenceCount;
@@ -819,7 +859,7 @@ typedef struct D3D12Sampler
 typedef struct D3D12WindowData
 {
     SDL_Window *window;
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     D3D12XBOX_FRAME_PIPELINE_TOKEN frameToken;
 #else
     IDXGISwapChain3 *swapchain;
@@ -828,6 +868,7 @@ typedef struct D3D12WindowData
     SDL_GPUSwapchainComposition swapchainComposition;
     DXGI_COLOR_SPACE_TYPE swapchainColorSpace;
     Uint32 frameCounter;
+    Uint64 presentCount;
 
     D3D12TextureContainer textureContainers[MAX_FRAMES_IN_FLIGHT];
     Uint32 swapchainTextureCount;
@@ -849,7 +890,7 @@ struct D3D12Renderer
     // Reference to the parent device
     SDL_GPUDevice *sdlGPUDevice;
 
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if !defined(SDL_D3D12_XBOX)
     IDXGIDebug *dxgiDebug;
     IDXGIFactory4 *factory;
 #ifdef HAVE_IDXGIINFOQUEUE
@@ -858,6 +899,7 @@ struct D3D12Renderer
     IDXGIAdapter1 *adapter;
     SDL_SharedObject *dxgi_dll;
     SDL_SharedObject *dxgidebug_dll;
+    IDXGraphicsAnalysis *graphicsAnalysis; // only while SDL_BeginGPUCapture() is capturing
 #endif
     ID3D12Debug *d3d12Debug;
     BOOL supportsTearing;
@@ -868,9 +910,20 @@ struct D3D12Renderer
     SDL_iconv_t iconv;
 
     ID3D12CommandQueue *commandQueue;
+    // Async compute queue, NULL if command buffers for other queues go to the direct queue
+    ID3D12CommandQueue *computeQueue;
+
+    // Pipeline library, NULL if the device doesn't support it
+    ID3D12PipelineLibrary *pipelineLibrary;
+    void *pipelineLibraryBlob;
+    SDL_Mutex *pipelineLibraryLock;
 
     bool debug_mode;
     bool GPUUploadHeapSupported;
+    bool tiledResourcesSupported; // Tier 2, so unmapped tiles read as zero
+    D3D12_VARIABLE_SHADING_RATE_TIER shadingRateTier;
+    Uint32 shadingRateImageTileSize;
+    bool additionalShadingRatesSupported; // 2x4, 4x2 and 4x4
     // FIXME: these might not be necessary since we're not using custom heaps
     bool UMA;
     bool UMACacheCoherent;
@@ -922,6 +975,13 @@ struct D3D12Renderer
     D3D12StagingDescriptorPool *stagingDescriptorPools[D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES];
     D3D12GPUDescriptorHeapPool gpuDescriptorHeapPools[2];
 
+    // Bindless descriptors are written here and copied into GPU heaps on acquire
+    D3D12DescriptorHeap *bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1];
+    Uint32 bindlessCapacity[GPU_BINDLESS_TYPE_COUNT];
+    Uint32 bindlessUsed[GPU_BINDLESS_TYPE_COUNT];
+    Uint32 bindlessVersion;
+    SDL_Mutex *bindlessLock;
+
     // Deferred resource releasing
 
     D3D12Buffer **buffersToDestroy;
@@ -963,9 +1023,17 @@ struct D3D12CommandBuffer
 
     ID3D12CommandAllocator *commandAllocator;
     ID3D12GraphicsCommandList *graphicsCommandList;
+    ID3D12GraphicsCommandList5 *shadingRateCommandList; // NULL without variable rate shading
+    D3D12_COMMAND_LIST_TYPE commandListType;
+    ID3D12CommandQueue *commandQueue;
     D3D12Fence *inFlightFence;
     bool autoReleaseFence;
 
+    // Fences from other queues to wait on before executing
+    D3D12Fence **waitFences;
+    Uint32 waitFenceCount;
+    Uint32 waitFenceCapacity;
+
     // Presentation data
     D3D12PresentData *presentDatas;
     Uint32 presentDataCount;
@@ -974,16 +1042,30 @@ struct D3D12CommandBuffer
     D3D12TextureSubresource *colorTargetSubresources[MAX_COLOR_TARGET_BINDINGS];
     D3D12TextureSubresource *colorResolveSubresources[MAX_COLOR_TARGET_BINDINGS];
     D3D12TextureSubresource *depthStencilTextureSubresource;
+    D3D12TextureContainer *shadingRateImage; // applied by the next render pass
+    D3D12TextureSubresource *shadingRateImageSubresource; // bound by the current render pass
     D3D12GraphicsPipeline *currentGraphicsPipeline;
     D3D12ComputePipeline *currentComputePipeline;
 
     // Set at acquire time
     D3D12DescriptorHeap *gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1];
 
+    // Heaps that filled up during recording, returned to the pool on cleanup
+    D3D12DescriptorHeap **retiredGPUDescriptorHeaps;
+    Uint32 retiredGPUDescriptorHeapCount;
+    Uint32 retiredGPUDescriptorHeapCapacity;
+
     D3D12UniformBuffer **usedUniformBuffers;
     Uint32 usedUniformBufferCount;
     Uint32 usedUniformBufferCapacity;
 
+    /* Kept from the previous submission of this command buffer, so recording
+     * threads only touch the renderer-wide pools when they need more.
+     */
+    D3D12DescriptorHeap *availableGPUDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER + 1];
+    D3D12UniformBuffer **availableUniformBuffers; // up to UNIFORM_BUFFER_CACHE_COUNT
+    Uint32 availableUniformBufferCount;
+
     // Resource slot state
     bool needVertexBufferBind;
     bool needVertexSamplerBind;
@@ -1000,6 +1082,8 @@ struct D3D12CommandBuffer
     bool needComputeReadOnlyStorageBufferBind;
     bool needComputeUniformBufferBind[MAX_UNIFORM_BUFFERS_PER_STAGE];
 
+    bool needBindlessBind;
+
     D3D12Buffer *vertexBuffers[MAX_VERTEX_BUFFERS];
     Uint32 vertexBufferOffsets[MAX_VERTEX_BUFFERS];
     Uint32 vertexBufferCount;
@@ -1095,6 +1179,9 @@ typedef struct D3D12GraphicsRootSignature
     Sint32 fragmentStorageBufferRootIndex;
 
     Sint32 fragmentUniformBufferRootIndex[MAX_UNIFORM_BUFFERS_PER_STAGE];
+
+    Sint32 bindlessViewRootIndex;
+    Sint32 bindlessSamplerRootIndex;
 } D3D12GraphicsRootSignature;
 
 struct D3D12GraphicsPipeline
@@ -1121,6 +1208,9 @@ typedef struct D3D12ComputeRootSignature
     Sint32 readWriteStorageTextureRootIndex;
     Sint32 readWriteStorageBufferRootIndex;
     Sint32 uniformBufferRootIndex[MAX_UNIFORM_BUFFERS_PER_STAGE];
+
+    Sint32 bindlessViewRootIndex;
+    Sint32 bindlessSamplerRootIndex;
 } D3D12ComputeRootSignature;
 
 struct D3D12ComputePipeline
@@ -1133,6 +1223,15 @@ struct D3D12ComputePipeline
     SDL_AtomicInt referenceCount;
 };
 
+typedef struct D3D12QueryPool
+{
+    QueryPoolCommonHeader header;
+
+    ID3D12QueryHeap *queryHeap;
+    ID3D12Resource *readbackBuffer; // One Uint64 per query, resolved as each one is written
+    UINT64 frequency;
+} D3D12QueryPool;
+
 struct D3D12TextureDownload
 {
     D3D12Buffer *destinationBuffer;
@@ -1192,6 +1291,7 @@ static void D3D12_ReleaseWindow(SDL_GPURenderer *driverData, SDL_Window *window)
 static bool D3D12_Wait(SDL_GPURenderer *driverData);
 static bool D3D12_WaitForFences(SDL_GPURenderer *driverData, bool waitAll, SDL_GPUFence *const *fences, Uint32 numFences);
 static void D3D12_INTERNAL_ReleaseBlitPipelines(SDL_GPURenderer *driverData);
+static D3D12Fence *D3D12_INTERNAL_AcquireFence(D3D12Renderer *renderer);
 
 // Helpers
 
@@ -1202,13 +1302,13 @@ static Uint32 D3D12_INTERNAL_Align(Uint32 location, Uint32 alignment)
 
 // Xbox Hack
 
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
 // FIXME: This is purely to work around a presentation bug when recreating the device/command queue.
 static ID3D12Device *s_Device;
 static ID3D12CommandQueue *s_CommandQueue;
 #endif
 
-#if defined(SDL_PLATFORM_XBOXONE)
+#if defined(SDL_D3D12_XBOX) && defined(SDL_PLATFORM_XBOXONE)
 // These are not defined in d3d12_x.h.
 typedef HRESULT (D3DAPI* PFN_D3D12_XBOX_CREATE_DEVICE)(_In_opt_ IGraphicsUnknown *, _In_ const D3D12XBOX_CREATE_DEVICE_PARAMETERS*, _In_ REFIID, _Outptr_opt_ void **);
 #define D3D12_STANDARD_MULTISAMPLE_PATTERN DXGI_STANDARD_MULTISAMPLE_QUALITY_PATTERN
@@ -1386,6 +1486,10 @@ static void D3D12_INTERNAL_DestroyTexture(
         ID3D12Resource_Release(texture->resource);
     }
 
+    if (texture->tileHeap) {
+        ID3D12Heap_Release(texture->tileHeap);
+    }
+
     SDL_free(texture);
 }
 
@@ -1424,6 +1528,7 @@ static void D3D12_INTERNAL_ReleaseTextureContainer(
     if (container->debugName) {
         SDL_free(container->debugName);
     }
+    SDL_GPU_DestroySparseTileMap(container->header.sparse);
     SDL_free(container->textures);
     SDL_free(container);
 
@@ -1515,6 +1620,46 @@ static void D3D12_ReleaseFence(
     }
 }
 
+static bool D3D12_GetQueryPoolResults(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 firstQuery,
+    Uint32 numQueries,
+    Uint64 *results)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12QueryPool *d3d12QueryPool = (D3D12QueryPool *)queryPool;
+    D3D12_RANGE readRange;
+    D3D12_RANGE writeRange;
+    Uint8 *data;
+    HRESULT res;
+
+    readRange.Begin = (SIZE_T)firstQuery * sizeof(Uint64);
+    readRange.End = readRange.Begin + (SIZE_T)numQueries * sizeof(Uint64);
+    writeRange.Begin = 0;
+    writeRange.End = 0;
+
+    res = ID3D12Resource_Map(
+        d3d12QueryPool->readbackBuffer,
+        0,
+        &readRange,
+        (void **)&data);
+    CHECK_D3D12_ERROR_AND_RETURN("Could not map query readback buffer", false);
+
+    SDL_memcpy(results, data + readRange.Begin, (size_t)numQueries * sizeof(Uint64));
+
+    ID3D12Resource_Unmap(
+        d3d12QueryPool->readbackBuffer,
+        0,
+        &writeRange);
+
+    for (Uint32 i = 0; i < numQueries; i += 1) {
+        results[i] = (Uint64)((double)results[i] * (double)SDL_NS_PER_SECOND / (double)d3d12QueryPool->frequency);
+    }
+
+    return true;
+}
+
 static bool D3D12_QueryFence(
     SDL_GPURenderer *driverData,
     SDL_GPUFence *fence)
@@ -1552,12 +1697,24 @@ static void D3D12_INTERNAL_DestroyCommandBuffer(D3D12CommandBuffer *commandBuffe
     if (!commandBuffer) {
         return;
     }
+    if (commandBuffer->shadingRateCommandList) {
+        ID3D12GraphicsCommandList5_Release(commandBuffer->shadingRateCommandList);
+    }
     if (commandBuffer->graphicsCommandList) {
         ID3D12GraphicsCommandList_Release(commandBuffer->graphicsCommandList);
     }
     if (commandBuffer->commandAllocator) {
         ID3D12CommandAllocator_Release(commandBuffer->commandAllocator);
     }
+    for (Uint32 i = 0; i < commandBuffer->availableUniformBufferCount; i += 1) {
+        D3D12_INTERNAL_DestroyBuffer(commandBuffer->availableUniformBuffers[i]->buffer);
+        SDL_free(commandBuffer->availableUniformBuffers[i]);
+    }
+    for (Uint32 i = 0; i < SDL_arraysize(commandBuffer->availableGPUDescriptorHeaps); i += 1) {
+        D3D12_INTERNAL_DestroyDescriptorHeap(commandBuffer->availableGPUDescriptorHeaps[i]);
+    }
+    SDL_free(commandBuffer->availableUniformBuffers);
+    SDL_free(commandBuffer->retiredGPUDescriptorHeaps);
     SDL_free(commandBuffer->presentDatas);
     SDL_free(commandBuffer->usedTextures);
     SDL_free(commandBuffer->usedBuffers);
@@ -1566,6 +1723,7 @@ static void D3D12_INTERNAL_DestroyCommandBuffer(D3D12CommandBuffer *commandBuffe
     SDL_free(commandBuffer->usedComputePipelines);
     SDL_free(commandBuffer->usedUniformBuffers);
     SDL_free(commandBuffer->textureDownloads);
+    SDL_free(commandBuffer->waitFences);
     SDL_free(commandBuffer);
 }
 
@@ -1616,6 +1774,17 @@ static void D3D12_INTERNAL_DestroyRenderer(D3D12Renderer *renderer)
         }
     }
 
+    for (Uint32 i = 0; i < SDL_arraysize(renderer->bindlessStagingHeaps); i += 1) {
+        if (renderer->bindlessStagingHeaps[i]) {
+            D3D12_INTERNAL_DestroyDescriptorHeap(renderer->bindlessStagingHeaps[i]);
+            renderer->bindlessStagingHeaps[i] = NULL;
+        }
+    }
+    if (renderer->bindlessLock) {
+        SDL_DestroyMutex(renderer->bindlessLock);
+        renderer->bindlessLock = NULL;
+    }
+
     // Release command buffers
     for (Uint32 i = 0; i < renderer->availableCommandBufferCount; i += 1) {
         if (renderer->availableCommandBuffers[i]) {
@@ -1659,7 +1828,22 @@ static void D3D12_INTERNAL_DestroyRenderer(D3D12Renderer *renderer)
         ID3D12CommandSignature_Release(renderer->indirectDispatchCommandSignature);
         renderer->indirectDispatchCommandSignature = NULL;
     }
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+    if (renderer->pipelineLibrary) {
+        ID3D12PipelineLibrary_Release(renderer->pipelineLibrary);
+        renderer->pipelineLibrary = NULL;
+    }
+    SDL_free(renderer->pipelineLibraryBlob);
+    renderer->pipelineLibraryBlob = NULL;
+#if !defined(SDL_D3D12_XBOX)
+    if (renderer->graphicsAnalysis) {
+        renderer->graphicsAnalysis->lpVtbl->EndCapture(renderer->graphicsAnalysis);
+        renderer->graphicsAnalysis->lpVtbl->Release(renderer->graphicsAnalysis);
+        renderer->graphicsAnalysis = NULL;
+    }
+    if (renderer->computeQueue) {
+        ID3D12CommandQueue_Release(renderer->computeQueue);
+        renderer->computeQueue = NULL;
+    }
     if (renderer->commandQueue) {
         ID3D12CommandQueue_Release(renderer->commandQueue);
         renderer->commandQueue = NULL;
@@ -1689,7 +1873,7 @@ static void D3D12_INTERNAL_DestroyRenderer(D3D12Renderer *renderer)
         SDL_UnloadObject(renderer->d3d12_dll);
         renderer->d3d12_dll = NULL;
     }
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if !defined(SDL_D3D12_XBOX)
     if (renderer->dxgi_dll) {
         SDL_UnloadObject(renderer->dxgi_dll);
         renderer->dxgi_dll = NULL;
@@ -1711,6 +1895,7 @@ static void D3D12_INTERNAL_DestroyRenderer(D3D12Renderer *renderer)
     SDL_DestroyMutex(renderer->windowLock);
     SDL_DestroyMutex(renderer->fenceLock);
     SDL_DestroyMutex(renderer->disposeLock);
+    SDL_DestroyMutex(renderer->pipelineLibraryLock);
     SDL_free(renderer);
 }
 
@@ -1739,6 +1924,83 @@ static SDL_PropertiesID D3D12_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static void *D3D12_GetPipelineCacheData(SDL_GPUDevice *device, size_t *size)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)device->driverData;
+    size_t dataSize;
+    void *data;
+    HRESULT res;
+
+    if (!renderer->pipelineLibrary) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline library is not available", NULL);
+    }
+
+    dataSize = ID3D12PipelineLibrary_GetSerializedSize(renderer->pipelineLibrary);
+    data = SDL_malloc(dataSize);
+    if (!data) {
+        return NULL;
+    }
+
+    res = ID3D12PipelineLibrary_Serialize(renderer->pipelineLibrary, data, dataSize);
+    if (FAILED(res)) {
+        SDL_free(data);
+        CHECK_D3D12_ERROR_AND_RETURN("Could not serialize pipeline library", NULL);
+    }
+
+    *size = dataSize;
+    return data;
+}
+
+static SDL_GPUMemoryInfo *D3D12_GetMemoryInfo(SDL_GPUDevice *device, int *count)
+{
+#if defined(SDL_D3D12_XBOX)
+    SDL_Unsupported();
+    return NULL;
+#else
+    D3D12Renderer *renderer = (D3D12Renderer *)device->driverData;
+    IDXGIAdapter3 *adapter3;
+    DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo;
+    SDL_GPUMemoryInfo *result;
+    HRESULT res;
+
+    res = IDXGIAdapter1_QueryInterface(
+        renderer->adapter,
+        D3D_GUID(D3D_IID_IDXGIAdapter3),
+        (void **)&adapter3);
+    CHECK_D3D12_ERROR_AND_RETURN("Could not get IDXGIAdapter3 interface", NULL);
+
+    // One entry for the local (video memory) segment group and one for the non-local one
+    result = (SDL_GPUMemoryInfo *)SDL_calloc(2, sizeof(SDL_GPUMemoryInfo));
+    if (!result) {
+        IDXGIAdapter3_Release(adapter3);
+        return NULL;
+    }
+
+    res = IDXGIAdapter3_QueryVideoMemoryInfo(adapter3, 0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &videoMemoryInfo);
+    if (FAILED(res)) {
+        IDXGIAdapter3_Release(adapter3);
+        SDL_free(result);
+        CHECK_D3D12_ERROR_AND_RETURN("Could not query video memory info", NULL);
+    }
+    result[0].budget = videoMemoryInfo.Budget;
+    result[0].usage = videoMemoryInfo.CurrentUsage;
+    result[0].device_local = true;
+
+    res = IDXGIAdapter3_QueryVideoMemoryInfo(adapter3, 0, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &videoMemoryInfo);
+    IDXGIAdapter3_Release(adapter3);
+    if (FAILED(res)) {
+        SDL_free(result);
+        CHECK_D3D12_ERROR_AND_RETURN("Could not query video memory info", NULL);
+    }
+    result[1].budget = videoMemoryInfo.Budget;
+    result[1].usage = videoMemoryInfo.CurrentUsage;
+    result[1].device_local = false;
+
+    *count = 2;
+    return result;
+#endif
+}
+
 // Barriers
 
 static inline Uint32 D3D12_INTERNAL_CalcSubresource(
@@ -2107,22 +2369,24 @@ static void D3D12_SetTextureName(
 
 /* These debug functions are all marked as "for internal usage only"
  * on D3D12... works on renderdoc!
+ *
+ * The metadata is PIX's event encoding, the same thing PIXBeginEvent() and
+ * PIXSetMarker() write into a command list for an ANSI string, so PIX shows
+ * the groups and times them. It also saves converting the string to UTF-16.
  */
+#define D3D12_PIX_EVENT_ANSI_VERSION 1
 
 static void D3D12_InsertDebugLabel(
     SDL_GPUCommandBuffer *commandBuffer,
     const char *text)
 {
     D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
-    WCHAR *wchar_text = WIN_UTF8ToStringW(text);
 
     ID3D12GraphicsCommandList_SetMarker(
         d3d12CommandBuffer->graphicsCommandList,
-        0,
-        wchar_text,
-        (UINT)SDL_wcslen(wchar_text) * sizeof(WCHAR));
-
-    SDL_free(wchar_text);
+        D3D12_PIX_EVENT_ANSI_VERSION,
+        text,
+        (UINT)SDL_strlen(text) + 1);
 }
 
 static void D3D12_PushDebugGroup(
@@ -2130,15 +2394,12 @@ static void D3D12_PushDebugGroup(
     const char *name)
 {
     D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
-    WCHAR *wchar_text = WIN_UTF8ToStringW(name);
 
     ID3D12GraphicsCommandList_BeginEvent(
         d3d12CommandBuffer->graphicsCommandList,
-        0,
-        wchar_text,
-        (UINT)SDL_wcslen(wchar_text) * sizeof(WCHAR));
-
-    SDL_free(wchar_text);
+        D3D12_PIX_EVENT_ANSI_VERSION,
+        name,
+        (UINT)SDL_strlen(name) + 1);
 }
 
 static void D3D12_PopDebugGroup(
@@ -2148,6 +2409,86 @@ static void D3D12_PopDebugGroup(
     ID3D12GraphicsCommandList_EndEvent(d3d12CommandBuffer->graphicsCommandList);
 }
 
+static bool D3D12_BeginCapture(
+    SDL_GPURenderer *driverData,
+    const char *path)
+{
+#if defined(SDL_D3D12_XBOX)
+    if (!path) {
+        return SDL_InvalidParamError("path");
+    }
+    return GDK_BeginGPUCapture(path);
+#else
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    HRESULT res;
+
+    // PIX decides where the capture goes
+    (void)path;
+
+#ifdef SDL_PLATFORM_WINRT
+    res = DXGIGetDebugInterface1(0, &D3D_IID_IDXGraphicsAnalysis, (void **)&renderer->graphicsAnalysis);
+#else
+    PFN_DXGI_GET_DEBUG_INTERFACE1 DXGIGetDebugInterface1Func = (PFN_DXGI_GET_DEBUG_INTERFACE1)SDL_LoadFunction(
+        renderer->dxgi_dll,
+        DXGI_GET_DEBUG_INTERFACE1_FUNC);
+    if (DXGIGetDebugInterface1Func == NULL) {
+        return SDL_SetError("Could not load function: " DXGI_GET_DEBUG_INTERFACE1_FUNC);
+    }
+    res = DXGIGetDebugInterface1Func(0, &D3D_IID_IDXGraphicsAnalysis, (void **)&renderer->graphicsAnalysis);
+#endif
+    if (FAILED(res)) {
+        // This is what happens when PIX isn't attached
+        renderer->graphicsAnalysis = NULL;
+        return SDL_SetError("No GPU capture tool is attached");
+    }
+
+    renderer->graphicsAnalysis->lpVtbl->BeginCapture(renderer->graphicsAnalysis);
+    return true;
+#endif
+}
+
+static bool D3D12_EndCapture(
+    SDL_GPURenderer *driverData)
+{
+#if defined(SDL_D3D12_XBOX)
+    return GDK_EndGPUCapture();
+#else
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+
+    if (!renderer->graphicsAnalysis) {
+        return SDL_SetError("No GPU capture is in progress");
+    }
+    renderer->graphicsAnalysis->lpVtbl->EndCapture(renderer->graphicsAnalysis);
+    renderer->graphicsAnalysis->lpVtbl->Release(renderer->graphicsAnalysis);
+    renderer->graphicsAnalysis = NULL;
+    return true;
+#endif
+}
+
+static void D3D12_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 index)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12QueryPool *d3d12QueryPool = (D3D12QueryPool *)queryPool;
+
+    ID3D12GraphicsCommandList_EndQuery(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12QueryPool->queryHeap,
+        D3D12_QUERY_TYPE_TIMESTAMP,
+        index);
+
+    ID3D12GraphicsCommandList_ResolveQueryData(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12QueryPool->queryHeap,
+        D3D12_QUERY_TYPE_TIMESTAMP,
+        index,
+        1,
+        d3d12QueryPool->readbackBuffer,
+        (UINT64)index * sizeof(Uint64));
+}
+
 // State Creation
 
 static D3D12DescriptorHeap *D3D12_INTERNAL_CreateDescriptorHeap(
@@ -2316,6 +2657,65 @@ static void D3D12_INTERNAL_ReturnGPUDescriptorHeapToPool(
     SDL_UnlockMutex(pool->lock);
 }
 
+/*
+ * Bindless resources are two extra descriptor tables pointing at the reserved front of the GPU heaps.
+ * Textures are (t0, space4) and buffers are (t0, space5), sharing the view table at fixed offsets.
+ * Samplers are (s0, space4).
+ */
+static void D3D12_INTERNAL_AddBindlessRootParameters(
+    D3D12Renderer *renderer,
+    D3D12_ROOT_PARAMETER *rootParameters,
+    D3D12_DESCRIPTOR_RANGE *descriptorRanges,
+    Uint32 *parameterCount,
+    Uint32 *rangeCount,
+    Sint32 *viewRootIndex,
+    Sint32 *samplerRootIndex)
+{
+    D3D12_DESCRIPTOR_RANGE descriptorRange;
+    D3D12_ROOT_PARAMETER rootParameter;
+
+    *viewRootIndex = -1;
+    *samplerRootIndex = -1;
+
+    if (renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] == NULL) {
+        return;
+    }
+
+    SDL_zero(rootParameter);
+
+    descriptorRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+    descriptorRange.NumDescriptors = SDL_MAX_UINT32; // unbounded
+    descriptorRange.BaseShaderRegister = 0;
+    descriptorRange.RegisterSpace = 4;
+    descriptorRange.OffsetInDescriptorsFromTableStart = 0;
+    descriptorRanges[*rangeCount] = descriptorRange;
+
+    descriptorRange.RegisterSpace = 5;
+    descriptorRange.OffsetInDescriptorsFromTableStart = renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE];
+    descriptorRanges[*rangeCount + 1] = descriptorRange;
+
+    rootParameter.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    rootParameter.DescriptorTable.NumDescriptorRanges = 2;
+    rootParameter.DescriptorTable.pDescriptorRanges = &descriptorRanges[*rangeCount];
+    rootParameter.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+    rootParameters[*parameterCount] = rootParameter;
+    *viewRootIndex = *parameterCount;
+    *rangeCount += 2;
+    *parameterCount += 1;
+
+    descriptorRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
+    descriptorRange.RegisterSpace = 4;
+    descriptorRange.OffsetInDescriptorsFromTableStart = 0;
+    descriptorRanges[*rangeCount] = descriptorRange;
+
+    rootParameter.DescriptorTable.NumDescriptorRanges = 1;
+    rootParameter.DescriptorTable.pDescriptorRanges = &descriptorRanges[*rangeCount];
+    rootParameters[*parameterCount] = rootParameter;
+    *samplerRootIndex = *parameterCount;
+    *rangeCount += 1;
+    *parameterCount += 1;
+}
+
 /*
  * The root signature lets us define "root parameters" which are essentially bind points for resources.
  * These let us define the register ranges as well as the register "space".
@@ -2540,6 +2940,16 @@ static D3D12GraphicsRootSignature *D3D12_INTERNAL_CreateGraphicsRootSignature(
         parameterCount += 1;
     }
 
+    // Bindless
+    D3D12_INTERNAL_AddBindlessRootParameters(
+        renderer,
+        rootParameters,
+        descriptorRanges,
+        &parameterCount,
+        &rangeCount,
+        &d3d12GraphicsRootSignature->bindlessViewRootIndex,
+        &d3d12GraphicsRootSignature->bindlessSamplerRootIndex);
+
     // FIXME: shouldn't have to assert here
     SDL_assert(parameterCount <= MAX_ROOT_SIGNATURE_PARAMETERS);
     SDL_assert(rangeCount <= MAX_ROOT_SIGNATURE_PARAMETERS);
@@ -2776,6 +3186,15 @@ static D3D12ComputeRootSignature *D3D12_INTERNAL_CreateComputeRootSignature(
         parameterCount += 1;
     }
 
+    D3D12_INTERNAL_AddBindlessRootParameters(
+        renderer,
+        rootParameters,
+        descriptorRanges,
+        &parameterCount,
+        &rangeCount,
+        &d3d12ComputeRootSignature->bindlessViewRootIndex,
+        &d3d12ComputeRootSignature->bindlessSamplerRootIndex);
+
     D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc;
     rootSignatureDesc.NumParameters = parameterCount;
     rootSignatureDesc.pParameters = rootParameters;
@@ -2823,6 +3242,196 @@ static D3D12ComputeRootSignature *D3D12_INTERNAL_CreateComputeRootSignature(
     return d3d12ComputeRootSignature;
 }
 
+static void D3D12_INTERNAL_CreatePipelineLibrary(
+    D3D12Renderer *renderer,
+    SDL_PropertiesID props)
+{
+#if !defined(SDL_D3D12_XBOX)
+    const void *initialData = SDL_GetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_DATA_POINTER, NULL);
+    size_t initialDataSize = (size_t)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_SIZE_NUMBER, 0);
+    ID3D12Device1 *device1;
+    HRESULT res;
+
+    // Pipeline libraries need ID3D12Device1, without one pipelines are simply not cached
+    res = ID3D12Device_QueryInterface(
+        renderer->device,
+        D3D_GUID(D3D_IID_ID3D12Device1),
+        (void **)&device1);
+    if (FAILED(res)) {
+        return;
+    }
+
+    // The library reads from the blob for as long as it exists, so it needs its own copy
+    if (initialData && initialDataSize > 0) {
+        renderer->pipelineLibraryBlob = SDL_malloc(initialDataSize);
+        if (renderer->pipelineLibraryBlob) {
+            SDL_memcpy(renderer->pipelineLibraryBlob, initialData, initialDataSize);
+            res = ID3D12Device1_CreatePipelineLibrary(
+                device1,
+                renderer->pipelineLibraryBlob,
+                initialDataSize,
+                D3D_GUID(D3D_IID_ID3D12PipelineLibrary),
+                (void **)&renderer->pipelineLibrary);
+            if (FAILED(res)) {
+                // Written by a different adapter or driver version, start over with an empty library
+                renderer->pipelineLibrary = NULL;
+                SDL_free(renderer->pipelineLibraryBlob);
+                renderer->pipelineLibraryBlob = NULL;
+            }
+        }
+    }
+
+    if (!renderer->pipelineLibrary) {
+        res = ID3D12Device1_CreatePipelineLibrary(
+            device1,
+            NULL,
+            0,
+            D3D_GUID(D3D_IID_ID3D12PipelineLibrary),
+            (void **)&renderer->pipelineLibrary);
+        if (FAILED(res)) {
+            renderer->pipelineLibrary = NULL;
+        }
+    }
+
+    ID3D12Device1_Release(device1);
+
+    if (renderer->pipelineLibrary) {
+        renderer->pipelineLibraryLock = SDL_CreateMutex();
+    }
+#endif
+}
+
+static void D3D12_INTERNAL_HashPipelineData(
+    Uint32 hash[2],
+    const void *data,
+    size_t size)
+{
+    hash[0] = SDL_murmur3_32(data, size, hash[0]);
+    hash[1] = SDL_murmur3_32(data, size, hash[1]);
+}
+
+static void D3D12_INTERNAL_GetPipelineName(
+    const Uint32 hash[2],
+    WCHAR name[17])
+{
+    (void)SDL_swprintf(name, 17, L"%08x%08x", hash[0], hash[1]);
+}
+
+/* Loads a pipeline state from the pipeline library, or compiles it and stores
+ * it there. Names are hashes of everything that goes into the description, so
+ * a collision only costs a compile: LoadPipeline rejects mismatched descriptions
+ * and StorePipeline refuses to overwrite an existing name.
+ */
+static HRESULT D3D12_INTERNAL_CreateGraphicsPipelineState(
+    D3D12Renderer *renderer,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC *psoDesc,
+    const Uint32 *rootSignatureKey,
+    size_t rootSignatureKeySize,
+    ID3D12PipelineState **pipelineState)
+{
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC keyDesc;
+    Uint32 hash[2] = { 0, 0x9E3779B9 };
+    WCHAR name[17];
+    HRESULT res;
+
+    if (!renderer->pipelineLibrary) {
+        return ID3D12Device_CreateGraphicsPipelineState(
+            renderer->device,
+            psoDesc,
+            D3D_GUID(D3D_IID_ID3D12PipelineState),
+            (void **)pipelineState);
+    }
+
+    // Pointers differ between runs, hash what they point to instead
+    keyDesc = *psoDesc;
+    keyDesc.pRootSignature = NULL;
+    keyDesc.VS.pShaderBytecode = NULL;
+    keyDesc.PS.pShaderBytecode = NULL;
+    keyDesc.InputLayout.pInputElementDescs = NULL;
+    D3D12_INTERNAL_HashPipelineData(hash, &keyDesc, sizeof(keyDesc));
+    D3D12_INTERNAL_HashPipelineData(hash, psoDesc->VS.pShaderBytecode, psoDesc->VS.BytecodeLength);
+    D3D12_INTERNAL_HashPipelineData(hash, psoDesc->PS.pShaderBytecode, psoDesc->PS.BytecodeLength);
+    for (Uint32 i = 0; i < psoDesc->InputLayout.NumElements; i += 1) {
+        D3D12_INPUT_ELEMENT_DESC element = psoDesc->InputLayout.pInputElementDescs[i];
+        D3D12_INTERNAL_HashPipelineData(hash, element.SemanticName, SDL_strlen(element.SemanticName));
+        element.SemanticName = NULL;
+        D3D12_INTERNAL_HashPipelineData(hash, &element, sizeof(element));
+    }
+    D3D12_INTERNAL_HashPipelineData(hash, rootSignatureKey, rootSignatureKeySize);
+    D3D12_INTERNAL_GetPipelineName(hash, name);
+
+    // Loading the same pipeline from several threads at once needs to be synchronized
+    SDL_LockMutex(renderer->pipelineLibraryLock);
+    res = ID3D12PipelineLibrary_LoadGraphicsPipeline(
+        renderer->pipelineLibrary,
+        name,
+        psoDesc,
+        D3D_GUID(D3D_IID_ID3D12PipelineState),
+        (void **)pipelineState);
+    SDL_UnlockMutex(renderer->pipelineLibraryLock);
+
+    if (SUCCEEDED(res)) {
+        return res;
+    }
+
+    res = ID3D12Device_CreateGraphicsPipelineState(
+        renderer->device,
+        psoDesc,
+        D3D_GUID(D3D_IID_ID3D12PipelineState),
+        (void **)pipelineState);
+    if (SUCCEEDED(res)) {
+        (void)ID3D12PipelineLibrary_StorePipeline(renderer->pipelineLibrary, name, *pipelineState);
+    }
+    return res;
+}
+
+static HRESULT D3D12_INTERNAL_CreateComputePipelineState(
+    D3D12Renderer *renderer,
+    const D3D12_COMPUTE_PIPELINE_STATE_DESC *pipelineDesc,
+    const Uint32 *rootSignatureKey,
+    size_t rootSignatureKeySize,
+    ID3D12PipelineState **pipelineState)
+{
+    Uint32 hash[2] = { 0, 0x9E3779B9 };
+    WCHAR name[17];
+    HRESULT res;
+
+    if (!renderer->pipelineLibrary) {
+        return ID3D12Device_CreateComputePipelineState(
+            renderer->device,
+            pipelineDesc,
+            D3D_GUID(D3D_IID_ID3D12PipelineState),
+            (void **)pipelineState);
+    }
+
+    D3D12_INTERNAL_HashPipelineData(hash, pipelineDesc->CS.pShaderBytecode, pipelineDesc->CS.BytecodeLength);
+    D3D12_INTERNAL_HashPipelineData(hash, rootSignatureKey, rootSignatureKeySize);
+    D3D12_INTERNAL_GetPipelineName(hash, name);
+
+    SDL_LockMutex(renderer->pipelineLibraryLock);
+    res = ID3D12PipelineLibrary_LoadComputePipeline(
+        renderer->pipelineLibrary,
+        name,
+        pipelineDesc,
+        D3D_GUID(D3D_IID_ID3D12PipelineState),
+        (void **)pipelineState);
+    SDL_UnlockMutex(renderer->pipelineLibraryLock);
+
+    if (SUCCEEDED(res)) {
+        return res;
+    }
+
+    res = ID3D12Device_CreateComputePipelineState(
+        renderer->device,
+        pipelineDesc,
+        D3D_GUID(D3D_IID_ID3D12PipelineState),
+        (void **)pipelineState);
+    if (SUCCEEDED(res)) {
+        (void)ID3D12PipelineLibrary_StorePipeline(renderer->pipelineLibrary, name, *pipelineState);
+    }
+    return res;
+}
+
 static SDL_GPUComputePipeline *D3D12_CreateComputePipeline(
     SDL_GPURenderer *driverData,
     const SDL_GPUComputePipelineCreateInfo *createinfo)
@@ -2860,11 +3469,22 @@ static SDL_GPUComputePipeline *D3D12_CreateComputePipeline(
     pipelineDesc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
     pipelineDesc.NodeMask = 0;
 
-    HRESULT res = ID3D12Device_CreateComputePipelineState(
-        renderer->device,
+    // The root signature is built from these counts rather than from the bytecode
+    const Uint32 rootSignatureKey[] = {
+        createinfo->num_samplers,
+        createinfo->num_readonly_storage_textures,
+        createinfo->num_readonly_storage_buffers,
+        createinfo->num_readwrite_storage_textures,
+        createinfo->num_readwrite_storage_buffers,
+        createinfo->num_uniform_buffers
+    };
+
+    HRESULT res = D3D12_INTERNAL_CreateComputePipelineState(
+        renderer,
         &pipelineDesc,
-        D3D_GUID(D3D_IID_ID3D12PipelineState),
-        (void **)&pipelineState);
+        rootSignatureKey,
+        sizeof(rootSignatureKey),
+        &pipelineState);
 
     if (FAILED(res)) {
         D3D12_INTERNAL_SetError(renderer, "Could not create compute pipeline state", res);
@@ -3149,11 +3769,24 @@ static SDL_GPUGraphicsPipeline *D3D12_CreateGraphicsPipeline(
     psoDesc.pRootSignature = rootSignature->handle;
     ID3D12PipelineState *pipelineState;
 
-    HRESULT res = ID3D12Device_CreateGraphicsPipelineState(
-        renderer->device,
+    // The root signature is built from these counts rather than from the bytecode
+    const Uint32 rootSignatureKey[] = {
+        vertShader->num_samplers,
+        vertShader->numStorageTextures,
+        vertShader->numStorageBuffers,
+        vertShader->numUniformBuffers,
+        fragShader->num_samplers,
+        fragShader->numStorageTextures,
+        fragShader->numStorageBuffers,
+        fragShader->numUniformBuffers
+    };
+
+    HRESULT res = D3D12_INTERNAL_CreateGraphicsPipelineState(
+        renderer,
         &psoDesc,
-        D3D_GUID(D3D_IID_ID3D12PipelineState),
-        (void **)&pipelineState);
+        rootSignatureKey,
+        sizeof(rootSignatureKey),
+        &pipelineState);
     if (FAILED(res)) {
         D3D12_INTERNAL_SetError(renderer, "Could not create graphics pipeline state", res);
         D3D12_INTERNAL_DestroyGraphicsPipeline(pipeline);
@@ -3276,41 +3909,224 @@ static SDL_GPUShader *D3D12_CreateShader(
     return (SDL_GPUShader *)shader;
 }
 
-static D3D12Texture *D3D12_INTERNAL_CreateTexture(
+// Updates tile mappings on the direct queue and blocks until the GPU has them
+static bool D3D12_INTERNAL_UpdateTileMappings(
     D3D12Renderer *renderer,
-    const SDL_GPUTextureCreateInfo *createinfo,
-    bool isSwapchainTexture,
-    const char *debugName)
+    ID3D12Resource *resource,
+    UINT numRegions,
+    const D3D12_TILED_RESOURCE_COORDINATE *regionCoordinates,
+    const D3D12_TILE_REGION_SIZE *regionSizes,
+    ID3D12Heap *heap,
+    UINT numRanges,
+    const D3D12_TILE_RANGE_FLAGS *rangeFlags,
+    const UINT *heapRangeOffsets,
+    const UINT *rangeTileCounts)
 {
-    D3D12Texture *texture;
-    ID3D12Resource *handle;
-    D3D12_HEAP_PROPERTIES heapProperties;
-    D3D12_HEAP_FLAGS heapFlags = (D3D12_HEAP_FLAGS)0;
-    D3D12_RESOURCE_DESC desc;
-    D3D12_RESOURCE_FLAGS resourceFlags = (D3D12_RESOURCE_FLAGS)0;
-    D3D12_RESOURCE_STATES initialState = (D3D12_RESOURCE_STATES)0;
-    D3D12_CLEAR_VALUE clearValue;
-    DXGI_FORMAT format;
-    bool useClearValue = false;
-    bool needsSRV =
-        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) ||
-        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ) ||
-        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ);
-    bool needsUAV =
-        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE) ||
-        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE);
+    D3D12Fence *fence = D3D12_INTERNAL_AcquireFence(renderer);
+    bool result = true;
     HRESULT res;
 
-    texture = (D3D12Texture *)SDL_calloc(1, sizeof(D3D12Texture));
-    if (!texture) {
-        return NULL;
+    if (!fence) {
+        return false;
     }
 
-    Uint32 layerCount = createinfo->type == SDL_GPU_TEXTURETYPE_3D ? 1 : createinfo->layer_count_or_depth;
-    Uint32 depth = createinfo->type == SDL_GPU_TEXTURETYPE_3D ? createinfo->layer_count_or_depth : 1;
-    bool isMultisample = createinfo->sample_count > SDL_GPU_SAMPLECOUNT_1;
+    SDL_LockMutex(renderer->submitLock);
 
-    format = SDLToD3D12_TextureFormat[createinfo->format];
+    ID3D12CommandQueue_UpdateTileMappings(
+        renderer->commandQueue,
+        resource,
+        numRegions,
+        regionCoordinates,
+        regionSizes,
+        heap,
+        numRanges,
+        rangeFlags,
+        heapRangeOffsets,
+        rangeTileCounts,
+        D3D12_TILE_MAPPING_FLAG_NONE);
+
+    ID3D12CommandQueue_Signal(
+        renderer->commandQueue,
+        fence->handle,
+        D3D12_FENCE_SIGNAL_VALUE);
+
+    if (ID3D12Fence_GetCompletedValue(fence->handle) != D3D12_FENCE_SIGNAL_VALUE) {
+        res = ID3D12Fence_SetEventOnCompletion(
+            fence->handle,
+            D3D12_FENCE_SIGNAL_VALUE,
+            fence->event);
+        if (FAILED(res)) {
+            D3D12_INTERNAL_SetError(renderer, "Setting fence event failed", res);
+            result = false;
+        } else if (WaitForSingleObject(fence->event, INFINITE) == WAIT_FAILED) {
+            SDL_SetError("Wait failed");
+            result = false;
+        }
+    }
+
+    SDL_UnlockMutex(renderer->submitLock);
+
+    D3D12_ReleaseFence(
+        (SDL_GPURenderer *)renderer,
+        (SDL_GPUFence *)fence);
+
+    return result;
+}
+
+// Creates a reserved resource with its own tile heap, the packed mips of each layer stay mapped
+static ID3D12Resource *D3D12_INTERNAL_CreateReservedTexture(
+    D3D12Renderer *renderer,
+    D3D12Texture *texture,
+    const SDL_GPUTextureCreateInfo *createinfo,
+    D3D12_RESOURCE_DESC *desc,
+    D3D12_RESOURCE_STATES initialState,
+    const D3D12_CLEAR_VALUE *clearValue,
+    GPU_SparseTileMap **sparseMap)
+{
+    ID3D12Resource *handle;
+    D3D12_PACKED_MIP_INFO packedMipInfo;
+    D3D12_TILE_SHAPE tileShape;
+    UINT numTiles = 0;
+    UINT numSubresourceTilings = 0;
+    D3D12_HEAP_DESC heapDesc;
+    GPU_SparseTileMap *map;
+    Uint32 numLayers = createinfo->layer_count_or_depth;
+    HRESULT res;
+
+    desc->Alignment = 0;
+    desc->Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+    res = ID3D12Device_CreateReservedResource(
+        renderer->device,
+        desc,
+        initialState,
+        clearValue,
+        D3D_GUID(D3D_IID_ID3D12Resource),
+        (void **)&handle);
+    if (FAILED(res)) {
+        D3D12_INTERNAL_SetError(renderer, "Failed to create reserved texture!", res);
+        return NULL;
+    }
+
+    ID3D12Device_GetResourceTiling(
+        renderer->device,
+        handle,
+        &numTiles,
+        &packedMipInfo,
+        &tileShape,
+        &numSubresourceTilings,
+        0,
+        NULL);
+
+    map = SDL_GPU_CreateSparseTileMap(
+        createinfo,
+        tileShape.WidthInTexels,
+        tileShape.HeightInTexels,
+        D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES,
+        packedMipInfo.NumStandardMips);
+    if (!map) {
+        ID3D12Resource_Release(handle);
+        return NULL;
+    }
+
+    // The tile pool comes first, followed by the packed mips of each layer
+    heapDesc.SizeInBytes = (UINT64)SDL_max(map->numSlots + packedMipInfo.NumTilesForPackedMips * numLayers, 1) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+    heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapDesc.Properties.CreationNodeMask = 0;
+    heapDesc.Properties.VisibleNodeMask = 0;
+    heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.Flags = (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+
+    res = ID3D12Device_CreateHeap(
+        renderer->device,
+        &heapDesc,
+        D3D_GUID(D3D_IID_ID3D12Heap),
+        (void **)&texture->tileHeap);
+    if (FAILED(res)) {
+        D3D12_INTERNAL_SetError(renderer, "Failed to create tile heap!", res);
+        SDL_GPU_DestroySparseTileMap(map);
+        ID3D12Resource_Release(handle);
+        return NULL;
+    }
+
+    for (Uint32 layer = 0; layer < numLayers && packedMipInfo.NumPackedMips > 0; layer += 1) {
+        D3D12_TILED_RESOURCE_COORDINATE coordinate;
+        D3D12_TILE_REGION_SIZE regionSize;
+        UINT heapOffset = map->numSlots + layer * packedMipInfo.NumTilesForPackedMips;
+
+        coordinate.X = 0;
+        coordinate.Y = 0;
+        coordinate.Z = 0;
+        coordinate.Subresource = D3D12_INTERNAL_CalcSubresource(
+            packedMipInfo.NumStandardMips,
+            layer,
+            createinfo->num_levels);
+        regionSize.NumTiles = packedMipInfo.NumTilesForPackedMips;
+        regionSize.UseBox = FALSE;
+        regionSize.Width = 0;
+        regionSize.Height = 0;
+        regionSize.Depth = 0;
+
+        if (!D3D12_INTERNAL_UpdateTileMappings(
+                renderer,
+                handle,
+                1,
+                &coordinate,
+                &regionSize,
+                texture->tileHeap,
+                1,
+                NULL,
+                &heapOffset,
+                &packedMipInfo.NumTilesForPackedMips)) {
+            SDL_GPU_DestroySparseTileMap(map);
+            ID3D12Resource_Release(handle);
+            return NULL;
+        }
+    }
+
+    *sparseMap = map;
+    return handle;
+}
+
+static D3D12Texture *D3D12_INTERNAL_CreateTexture(
+    D3D12Renderer *renderer,
+    const SDL_GPUTextureCreateInfo *createinfo,
+    bool isSwapchainTexture,
+    const char *debugName,
+    GPU_SparseTileMap **sparseMap) // non-NULL to honor SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN
+{
+    D3D12Texture *texture;
+    ID3D12Resource *handle;
+    D3D12_HEAP_PROPERTIES heapProperties;
+    D3D12_HEAP_FLAGS heapFlags = (D3D12_HEAP_FLAGS)0;
+    D3D12_RESOURCE_DESC desc;
+    D3D12_RESOURCE_FLAGS resourceFlags = (D3D12_RESOURCE_FLAGS)0;
+    D3D12_RESOURCE_STATES initialState = (D3D12_RESOURCE_STATES)0;
+    D3D12_CLEAR_VALUE clearValue;
+    DXGI_FORMAT format;
+    bool useClearValue = false;
+    bool needsSRV =
+        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) ||
+        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ) ||
+        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ);
+    bool needsUAV =
+        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE) ||
+        (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE);
+    bool sparse = sparseMap != NULL && SDL_GetBooleanProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN, false);
+    HRESULT res;
+
+    texture = (D3D12Texture *)SDL_calloc(1, sizeof(D3D12Texture));
+    if (!texture) {
+        return NULL;
+    }
+
+    Uint32 layerCount = createinfo->type == SDL_GPU_TEXTURETYPE_3D ? 1 : createinfo->layer_count_or_depth;
+    Uint32 depth = createinfo->type == SDL_GPU_TEXTURETYPE_3D ? createinfo->layer_count_or_depth : 1;
+    bool isMultisample = createinfo->sample_count > SDL_GPU_SAMPLECOUNT_1;
+
+    format = SDLToD3D12_TextureFormat[createinfo->format];
 
     if (createinfo->usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) {
         resourceFlags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
@@ -3371,19 +4187,34 @@ static D3D12Texture *D3D12_INTERNAL_CreateTexture(
 
     initialState = isSwapchainTexture ? D3D12_RESOURCE_STATE_PRESENT : D3D12_INTERNAL_DefaultTextureResourceState(createinfo->usage);
 
-    res = ID3D12Device_CreateCommittedResource(
-        renderer->device,
-        &heapProperties,
-        heapFlags,
-        &desc,
-        initialState,
-        useClearValue ? &clearValue : NULL,
-        D3D_GUID(D3D_IID_ID3D12Resource),
-        (void **)&handle);
-    if (FAILED(res)) {
-        D3D12_INTERNAL_SetError(renderer, "Failed to create texture!", res);
-        D3D12_INTERNAL_DestroyTexture(texture);
-        return NULL;
+    if (sparse) {
+        handle = D3D12_INTERNAL_CreateReservedTexture(
+            renderer,
+            texture,
+            createinfo,
+            &desc,
+            initialState,
+            useClearValue ? &clearValue : NULL,
+            sparseMap);
+        if (!handle) {
+            D3D12_INTERNAL_DestroyTexture(texture);
+            return NULL;
+        }
+    } else {
+        res = ID3D12Device_CreateCommittedResource(
+            renderer->device,
+            &heapProperties,
+            heapFlags,
+            &desc,
+            initialState,
+            useClearValue ? &clearValue : NULL,
+            D3D_GUID(D3D_IID_ID3D12Resource),
+            (void **)&handle);
+        if (FAILED(res)) {
+            D3D12_INTERNAL_SetError(renderer, "Failed to create texture!", res);
+            D3D12_INTERNAL_DestroyTexture(texture);
+            return NULL;
+        }
     }
 
     texture->resource = handle;
@@ -3609,13 +4440,13 @@ static SDL_GPUTexture *D3D12_CreateTexture(
         container->debugName = SDL_strdup(SDL_GetStringProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_NAME_STRING, NULL));
     }
 
-    container->canBeCycled = true;
-
+    GPU_SparseTileMap *sparseMap = NULL;
     D3D12Texture *texture = D3D12_INTERNAL_CreateTexture(
         (D3D12Renderer *)driverData,
         createinfo,
         false,
-        container->debugName);
+        container->debugName,
+        &sparseMap);
 
     if (!texture) {
         SDL_free(container->textures);
@@ -3623,6 +4454,9 @@ static SDL_GPUTexture *D3D12_CreateTexture(
         return NULL;
     }
 
+    container->header.sparse = sparseMap;
+    container->canBeCycled = sparseMap == NULL; // tile mappings belong to a single resource
+
     container->textures[0] = texture;
     container->activeTexture = texture;
 
@@ -3660,7 +4494,7 @@ static D3D12Buffer *D3D12_INTERNAL_CreateBuffer(
     if (usageFlags & SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE) {
         resourceFlags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
     }
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     if (usageFlags & SDL_GPU_BUFFERUSAGE_INDIRECT) {
         resourceFlags |= D3D12XBOX_RESOURCE_FLAG_ALLOW_INDIRECT_BUFFER;
     }
@@ -3917,6 +4751,92 @@ static SDL_GPUTransferBuffer *D3D12_CreateTransferBuffer(
         debugName);
 }
 
+static void D3D12_INTERNAL_DestroyQueryPool(D3D12QueryPool *queryPool)
+{
+    if (queryPool->readbackBuffer) {
+        ID3D12Resource_Release(queryPool->readbackBuffer);
+    }
+    if (queryPool->queryHeap) {
+        ID3D12QueryHeap_Release(queryPool->queryHeap);
+    }
+    SDL_free(queryPool);
+}
+
+static SDL_GPUQueryPool *D3D12_CreateQueryPool(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUQueryPoolCreateInfo *createinfo)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12_QUERY_HEAP_DESC queryHeapDesc;
+    D3D12_HEAP_PROPERTIES heapProperties;
+    D3D12_RESOURCE_DESC desc;
+    D3D12QueryPool *queryPool;
+    HRESULT res;
+
+    queryPool = (D3D12QueryPool *)SDL_calloc(1, sizeof(D3D12QueryPool));
+    if (!queryPool) {
+        return NULL;
+    }
+    queryPool->header.type = createinfo->type;
+    queryPool->header.numQueries = createinfo->num_queries;
+
+    res = ID3D12CommandQueue_GetTimestampFrequency(
+        renderer->commandQueue,
+        &queryPool->frequency);
+    if (FAILED(res) || queryPool->frequency == 0) {
+        D3D12_INTERNAL_DestroyQueryPool(queryPool);
+        SET_STRING_ERROR_AND_RETURN("Timestamp queries are not supported by this device", NULL);
+    }
+
+    queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    queryHeapDesc.Count = createinfo->num_queries;
+    queryHeapDesc.NodeMask = 0;
+
+    res = ID3D12Device_CreateQueryHeap(
+        renderer->device,
+        &queryHeapDesc,
+        D3D_GUID(D3D_IID_ID3D12QueryHeap),
+        (void **)&queryPool->queryHeap);
+    if (FAILED(res)) {
+        D3D12_INTERNAL_DestroyQueryPool(queryPool);
+        CHECK_D3D12_ERROR_AND_RETURN("Could not create query heap", NULL);
+    }
+
+    heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+    heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapProperties.CreationNodeMask = 0;
+    heapProperties.VisibleNodeMask = 0;
+
+    desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    desc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    desc.Width = (UINT64)createinfo->num_queries * sizeof(Uint64);
+    desc.Height = 1;
+    desc.DepthOrArraySize = 1;
+    desc.MipLevels = 1;
+    desc.Format = DXGI_FORMAT_UNKNOWN;
+    desc.SampleDesc.Count = 1;
+    desc.SampleDesc.Quality = 0;
+    desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    res = ID3D12Device_CreateCommittedResource(
+        renderer->device,
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &desc,
+        D3D12_RESOURCE_STATE_COPY_DEST,
+        NULL,
+        D3D_GUID(D3D_IID_ID3D12Resource),
+        (void **)&queryPool->readbackBuffer);
+    if (FAILED(res)) {
+        D3D12_INTERNAL_DestroyQueryPool(queryPool);
+        CHECK_D3D12_ERROR_AND_RETURN("Could not create query readback buffer", NULL);
+    }
+
+    return (SDL_GPUQueryPool *)queryPool;
+}
+
 // Disposal
 
 static void D3D12_ReleaseTexture(
@@ -4013,6 +4933,66 @@ static void D3D12_ReleaseComputePipeline(
     SDL_UnlockMutex(renderer->disposeLock);
 }
 
+static void D3D12_ReleaseQueryPool(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool)
+{
+    // Query pools aren't tracked by command buffers, so make sure none are using it
+    D3D12_Wait(driverData);
+
+    D3D12_INTERNAL_DestroyQueryPool((D3D12QueryPool *)queryPool);
+}
+
+static bool D3D12_WriteBindlessDescriptor(
+    SDL_GPURenderer *driverData,
+    GPU_BindlessType type,
+    Uint32 index,
+    void *resource)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12DescriptorHeap *heap;
+    D3D12_CPU_DESCRIPTOR_HANDLE srcHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE dstHandle;
+    Uint32 slot = index;
+
+    switch (type) {
+    case GPU_BINDLESS_TEXTURE:
+        heap = renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+        srcHandle = ((D3D12TextureContainer *)resource)->activeTexture->srvHandle.cpuHandle;
+        break;
+    case GPU_BINDLESS_BUFFER:
+        heap = renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+        srcHandle = ((D3D12BufferContainer *)resource)->activeBuffer->srvDescriptor.cpuHandle;
+        slot += renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE];
+        break;
+    case GPU_BINDLESS_SAMPLER:
+        heap = renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER];
+        srcHandle = ((D3D12Sampler *)resource)->handle.cpuHandle;
+        break;
+    default:
+        return SDL_InvalidParamError("type");
+    }
+
+    if (srcHandle.ptr == 0) {
+        return SDL_SetError("Resource has no shader resource view, check its usage flags");
+    }
+
+    dstHandle.ptr = heap->descriptorHeapCPUStart.ptr + (slot * heap->descriptorSize);
+
+    SDL_LockMutex(renderer->bindlessLock);
+    ID3D12Device_CopyDescriptorsSimple(
+        renderer->device,
+        1,
+        dstHandle,
+        srcHandle,
+        heap->heapType);
+    renderer->bindlessUsed[type] = SDL_max(renderer->bindlessUsed[type], index + 1);
+    renderer->bindlessVersion += 1;
+    SDL_UnlockMutex(renderer->bindlessLock);
+
+    return true;
+}
+
 static void D3D12_ReleaseGraphicsPipeline(
     SDL_GPURenderer *driverData,
     SDL_GPUGraphicsPipeline *graphicsPipeline)
@@ -4100,6 +5080,73 @@ static void D3D12_SetStencilReference(
     ID3D12GraphicsCommandList_OMSetStencilRef(d3d12CommandBuffer->graphicsCommandList, reference);
 }
 
+static bool D3D12_SupportsShadingRate(
+    SDL_GPURenderer *driverData,
+    SDL_GPUShadingRate rate)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+
+    if (renderer->shadingRateTier == D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED) {
+        return false;
+    }
+
+    switch (rate) {
+    case SDL_GPU_SHADINGRATE_1X1:
+    case SDL_GPU_SHADINGRATE_1X2:
+    case SDL_GPU_SHADINGRATE_2X1:
+    case SDL_GPU_SHADINGRATE_2X2:
+        return true;
+    case SDL_GPU_SHADINGRATE_2X4:
+    case SDL_GPU_SHADINGRATE_4X2:
+    case SDL_GPU_SHADINGRATE_4X4:
+        return renderer->additionalShadingRatesSupported;
+    default:
+        return false;
+    }
+}
+
+static void D3D12_SetShadingRate(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUShadingRate rate)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    // Keep the coarser of the per-draw rate and the shading rate image
+    static const D3D12_SHADING_RATE_COMBINER combiners[D3D12_RS_SET_SHADING_RATE_COMBINER_COUNT] = {
+        D3D12_SHADING_RATE_COMBINER_PASSTHROUGH,
+        D3D12_SHADING_RATE_COMBINER_MAX
+    };
+
+    if (d3d12CommandBuffer->shadingRateCommandList == NULL) {
+        return;
+    }
+
+    // SDL_GPUShadingRate uses the same encoding as D3D12_SHADING_RATE
+    ID3D12GraphicsCommandList5_RSSetShadingRate(
+        d3d12CommandBuffer->shadingRateCommandList,
+        (D3D12_SHADING_RATE)rate,
+        d3d12CommandBuffer->renderer->shadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2 ? combiners : NULL);
+}
+
+static Uint32 D3D12_GetShadingRateImageTileSize(
+    SDL_GPURenderer *driverData)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+
+    if (renderer->shadingRateTier < D3D12_VARIABLE_SHADING_RATE_TIER_2) {
+        return 0;
+    }
+    return renderer->shadingRateImageTileSize;
+}
+
+static void D3D12_SetShadingRateImage(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUTexture *texture)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+
+    d3d12CommandBuffer->shadingRateImage = (D3D12TextureContainer *)texture;
+}
+
 static D3D12TextureSubresource *D3D12_INTERNAL_FetchTextureSubresource(
     D3D12TextureContainer *container,
     Uint32 layer,
@@ -4133,7 +5180,8 @@ static void D3D12_INTERNAL_CycleActiveTexture(
         renderer,
         &container->header.info,
         false,
-        container->debugName);
+        container->debugName,
+        NULL);
 
     if (!texture) {
         return;
@@ -4432,6 +5480,31 @@ static void D3D12_BeginRenderPass(
     D3D12_SetBlendConstants(
         commandBuffer,
         blendConstants);
+
+    if (d3d12CommandBuffer->shadingRateCommandList != NULL) {
+        D3D12_SetShadingRate(
+            commandBuffer,
+            SDL_GPU_SHADINGRATE_1X1);
+
+        if (d3d12CommandBuffer->shadingRateImage != NULL) {
+            D3D12TextureSubresource *subresource = D3D12_INTERNAL_FetchTextureSubresource(
+                d3d12CommandBuffer->shadingRateImage,
+                0,
+                0);
+
+            D3D12_INTERNAL_TextureSubresourceTransitionFromDefaultUsage(
+                d3d12CommandBuffer,
+                D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE,
+                subresource);
+
+            ID3D12GraphicsCommandList5_RSSetShadingRateImage(
+                d3d12CommandBuffer->shadingRateCommandList,
+                subresource->parent->resource);
+
+            d3d12CommandBuffer->shadingRateImageSubresource = subresource;
+            D3D12_INTERNAL_TrackTexture(d3d12CommandBuffer, subresource->parent);
+        }
+    }
 }
 
 static void D3D12_INTERNAL_TrackUniformBuffer(
@@ -4466,31 +5539,36 @@ static D3D12UniformBuffer *D3D12_INTERNAL_AcquireUniformBufferFromPool(
     D3D12Renderer *renderer = commandBuffer->renderer;
     D3D12UniformBuffer *uniformBuffer;
 
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
-
-    if (renderer->uniformBufferPoolCount > 0) {
-        uniformBuffer = renderer->uniformBufferPool[renderer->uniformBufferPoolCount - 1];
-        renderer->uniformBufferPoolCount -= 1;
+    if (commandBuffer->availableUniformBufferCount > 0) {
+        uniformBuffer = commandBuffer->availableUniformBuffers[commandBuffer->availableUniformBufferCount - 1];
+        commandBuffer->availableUniformBufferCount -= 1;
     } else {
-        uniformBuffer = (D3D12UniformBuffer *)SDL_calloc(1, sizeof(D3D12UniformBuffer));
-        if (!uniformBuffer) {
-            SDL_UnlockMutex(renderer->acquireUniformBufferLock);
-            return NULL;
-        }
+        SDL_LockMutex(renderer->acquireUniformBufferLock);
 
-        uniformBuffer->buffer = D3D12_INTERNAL_CreateBuffer(
-            renderer,
-            0,
-            UNIFORM_BUFFER_SIZE,
-            D3D12_BUFFER_TYPE_UNIFORM,
-            NULL);
-        if (!uniformBuffer->buffer) {
-            SDL_UnlockMutex(renderer->acquireUniformBufferLock);
-            return NULL;
+        if (renderer->uniformBufferPoolCount > 0) {
+            uniformBuffer = renderer->uniformBufferPool[renderer->uniformBufferPoolCount - 1];
+            renderer->uniformBufferPoolCount -= 1;
+        } else {
+            uniformBuffer = (D3D12UniformBuffer *)SDL_calloc(1, sizeof(D3D12UniformBuffer));
+            if (!uniformBuffer) {
+                SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+                return NULL;
+            }
+
+            uniformBuffer->buffer = D3D12_INTERNAL_CreateBuffer(
+                renderer,
+                0,
+                UNIFORM_BUFFER_SIZE,
+                D3D12_BUFFER_TYPE_UNIFORM,
+                NULL);
+            if (!uniformBuffer->buffer) {
+                SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+                return NULL;
+            }
         }
-    }
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+        SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+    }
 
     uniformBuffer->currentBlockSize = 0;
     uniformBuffer->drawOffset = 0;
@@ -4624,6 +5702,7 @@ static void D3D12_BindGraphicsPipeline(
     d3d12CommandBuffer->needVertexStorageTextureBind = true;
     d3d12CommandBuffer->needVertexStorageBufferBind = true;
     d3d12CommandBuffer->needFragmentSamplerBind = true;
+    d3d12CommandBuffer->needBindlessBind = true;
     d3d12CommandBuffer->needFragmentStorageTextureBind = true;
     d3d12CommandBuffer->needFragmentStorageBufferBind = true;
 
@@ -4875,17 +5954,116 @@ static void D3D12_PushFragmentUniformData(
         length);
 }
 
+static void D3D12_INTERNAL_CopyBindlessDescriptorRange(
+    D3D12Renderer *renderer,
+    D3D12DescriptorHeap *heap,
+    D3D12DescriptorHeap *stagingHeap,
+    Uint32 offset,
+    Uint32 count)
+{
+    D3D12_CPU_DESCRIPTOR_HANDLE dstHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE srcHandle;
+
+    if (count == 0) {
+        return;
+    }
+
+    dstHandle.ptr = heap->descriptorHeapCPUStart.ptr + (offset * heap->descriptorSize);
+    srcHandle.ptr = stagingHeap->descriptorHeapCPUStart.ptr + (offset * stagingHeap->descriptorSize);
+
+    ID3D12Device_CopyDescriptorsSimple(
+        renderer->device,
+        count,
+        dstHandle,
+        srcHandle,
+        heap->heapType);
+}
+
+// Refreshes the reserved bindless range of a freshly acquired GPU heap if it is stale
+static void D3D12_INTERNAL_PrepareBindlessDescriptors(
+    D3D12Renderer *renderer,
+    D3D12DescriptorHeap *heap)
+{
+    D3D12DescriptorHeap *stagingHeap = renderer->bindlessStagingHeaps[heap->heapType];
+
+    if (stagingHeap == NULL) {
+        return;
+    }
+
+    SDL_LockMutex(renderer->bindlessLock);
+    if (heap->bindlessVersion != renderer->bindlessVersion) {
+        if (heap->heapType == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV) {
+            D3D12_INTERNAL_CopyBindlessDescriptorRange(
+                renderer,
+                heap,
+                stagingHeap,
+                0,
+                renderer->bindlessUsed[GPU_BINDLESS_TEXTURE]);
+            D3D12_INTERNAL_CopyBindlessDescriptorRange(
+                renderer,
+                heap,
+                stagingHeap,
+                renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE],
+                renderer->bindlessUsed[GPU_BINDLESS_BUFFER]);
+        } else {
+            D3D12_INTERNAL_CopyBindlessDescriptorRange(
+                renderer,
+                heap,
+                stagingHeap,
+                0,
+                renderer->bindlessUsed[GPU_BINDLESS_SAMPLER]);
+        }
+        heap->bindlessVersion = renderer->bindlessVersion;
+    }
+    SDL_UnlockMutex(renderer->bindlessLock);
+
+    // Per-draw descriptors are written after the reserved range
+    heap->currentDescriptorIndex = stagingHeap->maxDescriptors;
+}
+
+static D3D12DescriptorHeap *D3D12_INTERNAL_AcquireGPUDescriptorHeap(
+    D3D12CommandBuffer *commandBuffer,
+    D3D12_DESCRIPTOR_HEAP_TYPE heapType)
+{
+    D3D12DescriptorHeap *heap = commandBuffer->gpuDescriptorHeaps[heapType];
+
+    // The heap being replaced may still be referenced by recorded commands
+    if (heap != NULL) {
+        EXPAND_ARRAY_IF_NEEDED(
+            commandBuffer->retiredGPUDescriptorHeaps,
+            D3D12DescriptorHeap *,
+            commandBuffer->retiredGPUDescriptorHeapCount + 1,
+            commandBuffer->retiredGPUDescriptorHeapCapacity,
+            commandBuffer->retiredGPUDescriptorHeapCapacity * 2 + 2);
+
+        commandBuffer->retiredGPUDescriptorHeaps[commandBuffer->retiredGPUDescriptorHeapCount] = heap;
+        commandBuffer->retiredGPUDescriptorHeapCount += 1;
+    }
+
+    heap = commandBuffer->availableGPUDescriptorHeaps[heapType];
+    if (heap != NULL) {
+        commandBuffer->availableGPUDescriptorHeaps[heapType] = NULL;
+        return heap;
+    }
+
+    return D3D12_INTERNAL_AcquireGPUDescriptorHeapFromPool(commandBuffer, heapType);
+}
+
 static void D3D12_INTERNAL_SetGPUDescriptorHeaps(D3D12CommandBuffer *commandBuffer)
 {
     ID3D12DescriptorHeap *heaps[2];
     D3D12DescriptorHeap *viewHeap;
     D3D12DescriptorHeap *samplerHeap;
 
-    viewHeap = D3D12_INTERNAL_AcquireGPUDescriptorHeapFromPool(commandBuffer, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    samplerHeap = D3D12_INTERNAL_AcquireGPUDescriptorHeapFromPool(commandBuffer, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+    viewHeap = D3D12_INTERNAL_AcquireGPUDescriptorHeap(commandBuffer, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    samplerHeap = D3D12_INTERNAL_AcquireGPUDescriptorHeap(commandBuffer, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+
+    D3D12_INTERNAL_PrepareBindlessDescriptors(commandBuffer->renderer, viewHeap);
+    D3D12_INTERNAL_PrepareBindlessDescriptors(commandBuffer->renderer, samplerHeap);
 
     commandBuffer->gpuDescriptorHeaps[0] = viewHeap;
     commandBuffer->gpuDescriptorHeaps[1] = samplerHeap;
+    commandBuffer->needBindlessBind = true;
 
     heaps[0] = viewHeap->handle;
     heaps[1] = samplerHeap->handle;
@@ -5145,6 +6323,20 @@ static void D3D12_INTERNAL_BindGraphicsResources(
             commandBuffer->needFragmentUniformBufferBind[i] = false;
         }
     }
+
+    if (commandBuffer->needBindlessBind) {
+        if (graphicsPipeline->rootSignature->bindlessViewRootIndex >= 0) {
+            ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTable(
+                commandBuffer->graphicsCommandList,
+                graphicsPipeline->rootSignature->bindlessViewRootIndex,
+                commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]->descriptorHeapGPUStart);
+            ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTable(
+                commandBuffer->graphicsCommandList,
+                graphicsPipeline->rootSignature->bindlessSamplerRootIndex,
+                commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER]->descriptorHeapGPUStart);
+        }
+        commandBuffer->needBindlessBind = false;
+    }
 }
 
 static void D3D12_DrawIndexedPrimitives(
@@ -5189,46 +6381,100 @@ static void D3D12_DrawPrimitivesIndirect(
     SDL_GPUCommandBuffer *commandBuffer,
     SDL_GPUBuffer *buffer,
     Uint32 offset,
-    Uint32 drawCount)
+    Uint32 drawCount)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+
+    D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
+
+    ID3D12GraphicsCommandList_ExecuteIndirect(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12CommandBuffer->renderer->indirectDrawCommandSignature,
+        drawCount,
+        d3d12Buffer->handle,
+        offset,
+        NULL,
+        0);
+
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+}
+
+static void D3D12_DrawIndexedPrimitivesIndirect(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    Uint32 drawCount)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+
+    D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
+
+    ID3D12GraphicsCommandList_ExecuteIndirect(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12CommandBuffer->renderer->indirectIndexedDrawCommandSignature,
+        drawCount,
+        d3d12Buffer->handle,
+        offset,
+        NULL,
+        0);
+
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+}
+
+static void D3D12_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
 {
     D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
     D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+    D3D12Buffer *d3d12CountBuffer = ((D3D12BufferContainer *)countBuffer)->activeBuffer;
 
     D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
 
     ID3D12GraphicsCommandList_ExecuteIndirect(
         d3d12CommandBuffer->graphicsCommandList,
         d3d12CommandBuffer->renderer->indirectDrawCommandSignature,
-        drawCount,
+        maxDrawCount,
         d3d12Buffer->handle,
         offset,
-        NULL,
-        0);
+        d3d12CountBuffer->handle,
+        countOffset);
 
     D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12CountBuffer);
 }
 
-static void D3D12_DrawIndexedPrimitivesIndirect(
+static void D3D12_DrawIndexedPrimitivesIndirectCount(
     SDL_GPUCommandBuffer *commandBuffer,
     SDL_GPUBuffer *buffer,
     Uint32 offset,
-    Uint32 drawCount)
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
 {
     D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
     D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+    D3D12Buffer *d3d12CountBuffer = ((D3D12BufferContainer *)countBuffer)->activeBuffer;
 
     D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
 
     ID3D12GraphicsCommandList_ExecuteIndirect(
         d3d12CommandBuffer->graphicsCommandList,
         d3d12CommandBuffer->renderer->indirectIndexedDrawCommandSignature,
-        drawCount,
+        maxDrawCount,
         d3d12Buffer->handle,
         offset,
-        NULL,
-        0);
+        d3d12CountBuffer->handle,
+        countOffset);
 
     D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12CountBuffer);
 }
 
 static void D3D12_EndRenderPass(
@@ -5283,6 +6529,19 @@ static void D3D12_EndRenderPass(
         d3d12CommandBuffer->depthStencilTextureSubresource = NULL;
     }
 
+    if (d3d12CommandBuffer->shadingRateImageSubresource != NULL) {
+        ID3D12GraphicsCommandList5_RSSetShadingRateImage(
+            d3d12CommandBuffer->shadingRateCommandList,
+            NULL);
+
+        D3D12_INTERNAL_TextureSubresourceTransitionToDefaultUsage(
+            d3d12CommandBuffer,
+            D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE,
+            d3d12CommandBuffer->shadingRateImageSubresource);
+
+        d3d12CommandBuffer->shadingRateImageSubresource = NULL;
+    }
+
     d3d12CommandBuffer->currentGraphicsPipeline = NULL;
 
     ID3D12GraphicsCommandList_OMSetRenderTargets(
@@ -5399,6 +6658,7 @@ static void D3D12_BindComputePipeline(
     d3d12CommandBuffer->needComputeSamplerBind = true;
     d3d12CommandBuffer->needComputeReadOnlyStorageTextureBind = true;
     d3d12CommandBuffer->needComputeReadOnlyStorageBufferBind = true;
+    d3d12CommandBuffer->needBindlessBind = true;
 
     for (Uint32 i = 0; i < MAX_UNIFORM_BUFFERS_PER_STAGE; i += 1) {
         d3d12CommandBuffer->needComputeUniformBufferBind[i] = true;
@@ -5677,6 +6937,20 @@ static void D3D12_INTERNAL_BindComputeResources(
         }
         commandBuffer->needComputeUniformBufferBind[i] = false;
     }
+
+    if (commandBuffer->needBindlessBind) {
+        if (computePipeline->rootSignature->bindlessViewRootIndex >= 0) {
+            ID3D12GraphicsCommandList_SetComputeRootDescriptorTable(
+                commandBuffer->graphicsCommandList,
+                computePipeline->rootSignature->bindlessViewRootIndex,
+                commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]->descriptorHeapGPUStart);
+            ID3D12GraphicsCommandList_SetComputeRootDescriptorTable(
+                commandBuffer->graphicsCommandList,
+                computePipeline->rootSignature->bindlessSamplerRootIndex,
+                commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER]->descriptorHeapGPUStart);
+        }
+        commandBuffer->needBindlessBind = false;
+    }
 }
 
 static void D3D12_DispatchCompute(
@@ -6433,6 +7707,31 @@ static void D3D12_Blit(
         &renderer->blitPipelineCapacity);
 }
 
+static void D3D12_BlitTextures(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Renderer *renderer = (D3D12Renderer *)d3d12CommandBuffer->renderer;
+
+    SDL_GPU_BlitBatchCommon(
+        commandBuffer,
+        infos,
+        numBlits,
+        renderer->blitLinearSampler,
+        renderer->blitNearestSampler,
+        renderer->blitVertexShader,
+        renderer->blitFrom2DShader,
+        renderer->blitFrom2DArrayShader,
+        renderer->blitFrom3DShader,
+        renderer->blitFromCubeShader,
+        renderer->blitFromCubeArrayShader,
+        &renderer->blitPipelines,
+        &renderer->blitPipelineCount,
+        &renderer->blitPipelineCapacity);
+}
+
 // Submission/Presentation
 
 static D3D12WindowData *D3D12_INTERNAL_FetchWindowData(
@@ -6459,7 +7758,7 @@ static bool D3D12_SupportsSwapchainComposition(
     SDL_Window *window,
     SDL_GPUSwapchainComposition swapchainComposition)
 {
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX)
     // FIXME: HDR support would be nice to add, but it seems complicated...
     return swapchainComposition == SDL_GPU_SWAPCHAINCOMPOSITION_SDR ||
            swapchainComposition == SDL_GPU_SWAPCHAINCOMPOSITION_SDR_LINEAR;
@@ -6521,7 +7820,7 @@ static bool D3D12_SupportsPresentMode(
     case SDL_GPU_PRESENTMODE_VSYNC:
         return true;
     case SDL_GPU_PRESENTMODE_MAILBOX:
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
         return false;
 #else
         return true;
@@ -6532,7 +7831,7 @@ static bool D3D12_SupportsPresentMode(
     }
 }
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX)
 static bool D3D12_INTERNAL_CreateSwapchain(
     D3D12Renderer *renderer,
     D3D12WindowData *windowData,
@@ -6561,7 +7860,7 @@ static bool D3D12_INTERNAL_CreateSwapchain(
     createInfo.num_levels = 1;
 
     for (Uint32 i = 0; i < windowData->swapchainTextureCount; i += 1) {
-        texture = D3D12_INTERNAL_CreateTexture(renderer, &createInfo, true, "Swapchain");
+        texture = D3D12_INTERNAL_CreateTexture(renderer, &createInfo, true, "Swapchain", NULL);
         texture->container = &windowData->textureContainers[i];
         windowData->textureContainers[i].activeTexture = texture;
         windowData->textureContainers[i].canBeCycled = false;
@@ -6635,6 +7934,16 @@ static bool D3D12_INTERNAL_ResizeSwapchain(
     return true;
 }
 #else
+static IUnknown *D3D12_INTERNAL_GetCoreWindow(SDL_Window *window)
+{
+#ifdef SDL_PLATFORM_WINRT
+    // DXGI queries the ICoreWindow interface from this itself
+    return (IUnknown *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_WINRT_WINDOW_POINTER, NULL);
+#else
+    return NULL;
+#endif
+}
+
 static bool D3D12_INTERNAL_InitializeSwapchainTexture(
     D3D12Renderer *renderer,
     IDXGISwapChain3 *swapchain,
@@ -6770,12 +8079,18 @@ static bool D3D12_INTERNAL_ResizeSwapchain(
         SDL_free(windowData->textureContainers[i].textures);
     }
 
+    // CoreWindow swapchains don't pick up the window size on their own
+    int w = 0, h = 0;
+    if (D3D12_INTERNAL_GetCoreWindow(windowData->window)) {
+        SDL_GetWindowSizeInPixels(windowData->window, &w, &h);
+    }
+
     // Resize the swapchain
     HRESULT res = IDXGISwapChain_ResizeBuffers(
         windowData->swapchain,
         0, // Keep buffer count the same
-        0, // use client window width
-        0, // use client window height
+        w, // 0 uses client window width
+        h, // 0 uses client window height
         DXGI_FORMAT_UNKNOWN, // Keep the old format
         renderer->supportsTearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
     CHECK_D3D12_ERROR_AND_RETURN("Could not resize swapchain buffers", false);
@@ -6830,6 +8145,7 @@ static bool D3D12_INTERNAL_CreateSwapchain(
     SDL_GPUPresentMode presentMode)
 {
     HWND dxgiHandle;
+    IUnknown *coreWindow;
     DXGI_SWAP_CHAIN_DESC1 swapchainDesc;
     DXGI_SWAP_CHAIN_FULLSCREEN_DESC fullscreenDesc;
     DXGI_FORMAT swapchainFormat;
@@ -6844,6 +8160,7 @@ static bool D3D12_INTERNAL_CreateSwapchain(
 #else
     dxgiHandle = (HWND)windowData->window;
 #endif
+    coreWindow = D3D12_INTERNAL_GetCoreWindow(windowData->window);
 
     swapchainFormat = SwapchainCompositionToTextureFormat[swapchainComposition];
 
@@ -6877,21 +8194,37 @@ static bool D3D12_INTERNAL_CreateSwapchain(
         swapchainDesc.Flags = 0;
     }
 
+    // Create the swapchain!
+    if (coreWindow) {
+        // CoreWindow swapchains don't pick up the window size on their own
+        int w, h;
+        SDL_GetWindowSizeInPixels(windowData->window, &w, &h);
+        swapchainDesc.Width = w;
+        swapchainDesc.Height = h;
+
+        res = IDXGIFactory4_CreateSwapChainForCoreWindow(
+            renderer->factory,
+            (IUnknown *)renderer->commandQueue,
+            coreWindow,
+            &swapchainDesc,
+            NULL,
+            &swapchain);
+    } else {
 #ifndef SDL_PLATFORM_WINRT
-    if (!IsWindow(dxgiHandle)) {
-        return false;
-    }
+        if (!IsWindow(dxgiHandle)) {
+            return false;
+        }
 #endif
 
-    // Create the swapchain!
-    res = IDXGIFactory4_CreateSwapChainForHwnd(
-        renderer->factory,
-        (IUnknown *)renderer->commandQueue,
-        dxgiHandle,
-        &swapchainDesc,
-        &fullscreenDesc,
-        NULL,
-        &swapchain);
+        res = IDXGIFactory4_CreateSwapChainForHwnd(
+            renderer->factory,
+            (IUnknown *)renderer->commandQueue,
+            dxgiHandle,
+            &swapchainDesc,
+            &fullscreenDesc,
+            NULL,
+            &swapchain);
+    }
     CHECK_D3D12_ERROR_AND_RETURN("Could not create swapchain", false);
 
     res = IDXGISwapChain1_QueryInterface(
@@ -6914,31 +8247,35 @@ static bool D3D12_INTERNAL_CreateSwapchain(
      * set the window association. Trying to set an association on our factory
      * will silently fail and doesn't even verify arguments or return errors.
      * See https://gamedev.net/forums/topic/634235-dxgidisabling-altenter/4999955/
+     *
+     * CoreWindow swapchains have no HWND to associate with.
      */
-    res = IDXGISwapChain3_GetParent(
-        swapchain3,
-        D3D_GUID(D3D_IID_IDXGIFactory1),
-        (void **)&pParent);
-    if (FAILED(res)) {
-        SDL_LogWarn(
-            SDL_LOG_CATEGORY_GPU,
-            "Could not get swapchain parent! Error Code: " HRESULT_FMT,
-            res);
-    } else {
-        // Disable DXGI window crap
-        res = IDXGIFactory1_MakeWindowAssociation(
-            pParent,
-            dxgiHandle,
-            DXGI_MWA_NO_WINDOW_CHANGES);
+    if (!coreWindow) {
+        res = IDXGISwapChain3_GetParent(
+            swapchain3,
+            D3D_GUID(D3D_IID_IDXGIFactory1),
+            (void **)&pParent);
         if (FAILED(res)) {
             SDL_LogWarn(
                 SDL_LOG_CATEGORY_GPU,
-                "MakeWindowAssociation failed! Error Code: " HRESULT_FMT,
+                "Could not get swapchain parent! Error Code: " HRESULT_FMT,
                 res);
-        }
+        } else {
+            // Disable DXGI window crap
+            res = IDXGIFactory1_MakeWindowAssociation(
+                pParent,
+                dxgiHandle,
+                DXGI_MWA_NO_WINDOW_CHANGES);
+            if (FAILED(res)) {
+                SDL_LogWarn(
+                    SDL_LOG_CATEGORY_GPU,
+                    "MakeWindowAssociation failed! Error Code: " HRESULT_FMT,
+                    res);
+            }
 
-        // We're done with the parent now
-        IDXGIFactory1_Release(pParent);
+            // We're done with the parent now
+            IDXGIFactory1_Release(pParent);
+        }
     }
 
     IDXGISwapChain3_GetDesc1(swapchain3, &swapchainDesc);
@@ -7203,7 +8540,8 @@ static D3D12Fence *D3D12_INTERNAL_AcquireFence(
 }
 
 static bool D3D12_INTERNAL_AllocateCommandBuffer(
-    D3D12Renderer *renderer)
+    D3D12Renderer *renderer,
+    D3D12_COMMAND_LIST_TYPE commandListType)
 {
     D3D12CommandBuffer *commandBuffer;
     HRESULT res;
@@ -7217,7 +8555,7 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
 
     res = ID3D12Device_CreateCommandAllocator(
         renderer->device,
-        D3D12_COMMAND_LIST_TYPE_DIRECT,
+        commandListType,
         D3D_GUID(D3D_IID_ID3D12CommandAllocator),
         (void **)&commandAllocator);
     if (FAILED(res)) {
@@ -7230,7 +8568,7 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
     res = ID3D12Device_CreateCommandList(
         renderer->device,
         0,
-        D3D12_COMMAND_LIST_TYPE_DIRECT,
+        commandListType,
         commandAllocator,
         NULL,
         D3D_GUID(D3D_IID_ID3D12GraphicsCommandList),
@@ -7242,6 +8580,19 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
         return false;
     }
     commandBuffer->graphicsCommandList = commandList;
+    commandBuffer->commandListType = commandListType;
+
+    if (renderer->shadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED &&
+        commandListType == D3D12_COMMAND_LIST_TYPE_DIRECT) {
+        res = ID3D12GraphicsCommandList_QueryInterface(
+            commandList,
+            D3D_GUID(D3D_IID_ID3D12GraphicsCommandList5),
+            (void **)&commandBuffer->shadingRateCommandList);
+        if (FAILED(res)) {
+            commandBuffer->shadingRateCommandList = NULL;
+        }
+    }
+    commandBuffer->commandQueue = commandListType == D3D12_COMMAND_LIST_TYPE_DIRECT ? renderer->commandQueue : renderer->computeQueue;
 
     commandBuffer->renderer = renderer;
     commandBuffer->inFlightFence = NULL;
@@ -7283,6 +8634,10 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
     commandBuffer->usedUniformBuffers = (D3D12UniformBuffer **)SDL_calloc(
         commandBuffer->usedUniformBufferCapacity, sizeof(D3D12UniformBuffer *));
 
+    commandBuffer->availableUniformBufferCount = 0;
+    commandBuffer->availableUniformBuffers = (D3D12UniformBuffer **)SDL_calloc(
+        UNIFORM_BUFFER_CACHE_COUNT, sizeof(D3D12UniformBuffer *));
+
     commandBuffer->textureDownloadCapacity = 4;
     commandBuffer->textureDownloadCount = 0;
     commandBuffer->textureDownloads = (D3D12TextureDownload **)SDL_calloc(
@@ -7296,6 +8651,7 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
         (!commandBuffer->usedGraphicsPipelines) ||
         (!commandBuffer->usedComputePipelines) ||
         (!commandBuffer->usedUniformBuffers) ||
+        (!commandBuffer->availableUniformBuffers) ||
         (!commandBuffer->textureDownloads)) {
         D3D12_INTERNAL_DestroyCommandBuffer(commandBuffer);
         SET_STRING_ERROR_AND_RETURN("Failed to create ID3D12CommandList. Out of Memory", false);
@@ -7320,32 +8676,53 @@ static bool D3D12_INTERNAL_AllocateCommandBuffer(
 }
 
 static D3D12CommandBuffer *D3D12_INTERNAL_AcquireCommandBufferFromPool(
-    D3D12Renderer *renderer)
+    D3D12Renderer *renderer,
+    D3D12_COMMAND_LIST_TYPE commandListType)
 {
     D3D12CommandBuffer *commandBuffer;
+    Sint32 i;
+
+    // Command lists can only be submitted to a queue of their own type
+    for (i = renderer->availableCommandBufferCount - 1; i >= 0; i -= 1) {
+        if (renderer->availableCommandBuffers[i]->commandListType == commandListType) {
+            break;
+        }
+    }
 
-    if (renderer->availableCommandBufferCount == 0) {
-        if (!D3D12_INTERNAL_AllocateCommandBuffer(renderer)) {
+    if (i < 0) {
+        if (!D3D12_INTERNAL_AllocateCommandBuffer(renderer, commandListType)) {
             return NULL;
         }
+        i = renderer->availableCommandBufferCount - 1;
     }
 
-    commandBuffer = renderer->availableCommandBuffers[renderer->availableCommandBufferCount - 1];
+    commandBuffer = renderer->availableCommandBuffers[i];
+    renderer->availableCommandBuffers[i] = renderer->availableCommandBuffers[renderer->availableCommandBufferCount - 1];
     renderer->availableCommandBufferCount -= 1;
 
     return commandBuffer;
 }
 
 static SDL_GPUCommandBuffer *D3D12_AcquireCommandBuffer(
-    SDL_GPURenderer *driverData)
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueueType queueType)
 {
     D3D12Renderer *renderer = (D3D12Renderer *)driverData;
     D3D12CommandBuffer *commandBuffer;
+    D3D12_COMMAND_LIST_TYPE commandListType = D3D12_COMMAND_LIST_TYPE_DIRECT;
     ID3D12DescriptorHeap *heaps[2];
     SDL_zeroa(heaps);
 
+    /* Copy work goes to the compute queue too. Copy queues only allow the
+     * COMMON and COPY resource states, which doesn't fit the default states
+     * resources are transitioned back to.
+     */
+    if (queueType != SDL_GPU_QUEUETYPE_GRAPHICS && renderer->computeQueue) {
+        commandListType = D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    }
+
     SDL_LockMutex(renderer->acquireCommandBufferLock);
-    commandBuffer = D3D12_INTERNAL_AcquireCommandBufferFromPool(renderer);
+    commandBuffer = D3D12_INTERNAL_AcquireCommandBufferFromPool(renderer, commandListType);
     SDL_UnlockMutex(renderer->acquireCommandBufferLock);
 
     if (commandBuffer == NULL) {
@@ -7358,6 +8735,8 @@ static SDL_GPUCommandBuffer *D3D12_AcquireCommandBuffer(
     SDL_zeroa(commandBuffer->colorTargetSubresources);
     SDL_zeroa(commandBuffer->colorResolveSubresources);
     commandBuffer->depthStencilTextureSubresource = NULL;
+    commandBuffer->shadingRateImage = NULL;
+    commandBuffer->shadingRateImageSubresource = NULL;
 
     SDL_zeroa(commandBuffer->vertexBuffers);
     SDL_zeroa(commandBuffer->vertexBufferOffsets);
@@ -7414,6 +8793,48 @@ static bool D3D12_WaitForSwapchain(
     return true;
 }
 
+static bool D3D12_GetPresentStatistics(
+    SDL_GPURenderer *driverData,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics)
+{
+    D3D12WindowData *windowData = D3D12_INTERNAL_FetchWindowData(window);
+#if !defined(SDL_D3D12_XBOX)
+    DXGI_FRAME_STATISTICS frameStatistics;
+    UINT lastPresentCount;
+    HRESULT res;
+#endif
+
+    if (windowData == NULL) {
+        SET_STRING_ERROR_AND_RETURN("Cannot query present statistics from an unclaimed window!", false);
+    }
+
+    statistics->present_count = windowData->presentCount;
+
+#if !defined(SDL_D3D12_XBOX)
+    /* DXGI only keeps frame statistics while it can track the swapchain's presentation,
+     * so failing to get them just means the display time is unknown.
+     */
+    res = IDXGISwapChain_GetLastPresentCount(windowData->swapchain, &lastPresentCount);
+    if (SUCCEEDED(res)) {
+        res = IDXGISwapChain_GetFrameStatistics(windowData->swapchain, &frameStatistics);
+    }
+    if (SUCCEEDED(res) && frameStatistics.PresentCount <= lastPresentCount) {
+        // DXGI counts presents per swapchain, so map its counts back onto the window's present count
+        Uint64 behind = lastPresentCount - frameStatistics.PresentCount;
+        if (behind < windowData->presentCount) {
+            statistics->displayed_frame_id = windowData->presentCount - behind;
+            statistics->display_time_ns = SDL_GPU_ConvertPresentTime(
+                (Uint64)frameStatistics.SyncQPCTime.QuadPart,
+                SDL_GetPerformanceCounter(),
+                SDL_GetPerformanceFrequency());
+        }
+    }
+#endif
+
+    return true;
+}
+
 static bool D3D12_INTERNAL_AcquireSwapchainTexture(
     bool block,
     SDL_GPUCommandBuffer *commandBuffer,
@@ -7481,7 +8902,7 @@ static bool D3D12_INTERNAL_AcquireSwapchainTexture(
         windowData->inFlightFences[windowData->frameCounter] = NULL;
     }
 
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     // FIXME: Should this happen before the inFlightFences stuff above?
     windowData->frameToken = D3D12XBOX_FRAME_PIPELINE_TOKEN_NULL;
     renderer->device->WaitFrameEventX(D3D12XBOX_FRAME_EVENT_ORIGIN, INFINITE, NULL, D3D12XBOX_WAIT_FRAME_EVENT_FLAG_NONE, &windowData->frameToken);
@@ -7696,29 +9117,46 @@ static bool D3D12_INTERNAL_CleanCommandBuffer(
         NULL);
     CHECK_D3D12_ERROR_AND_RETURN("Could not reset command list", false);
 
-    // Return descriptor heaps to pool
-    D3D12_INTERNAL_ReturnGPUDescriptorHeapToPool(
-        renderer,
-        commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV]);
-    D3D12_INTERNAL_ReturnGPUDescriptorHeapToPool(
-        renderer,
-        commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER]);
+    // Keep the last descriptor heaps for the next recording, the ones it outgrew go back to the pool
+    for (i = 0; i < SDL_arraysize(commandBuffer->gpuDescriptorHeaps); i += 1) {
+        D3D12DescriptorHeap *heap = commandBuffer->gpuDescriptorHeaps[i];
+        if (heap != NULL) {
+            if (commandBuffer->availableGPUDescriptorHeaps[i] == NULL) {
+                heap->currentDescriptorIndex = 0;
+                commandBuffer->availableGPUDescriptorHeaps[i] = heap;
+            } else {
+                D3D12_INTERNAL_ReturnGPUDescriptorHeapToPool(renderer, heap);
+            }
+            commandBuffer->gpuDescriptorHeaps[i] = NULL;
+        }
+    }
+
+    for (i = 0; i < commandBuffer->retiredGPUDescriptorHeapCount; i += 1) {
+        D3D12_INTERNAL_ReturnGPUDescriptorHeapToPool(
+            renderer,
+            commandBuffer->retiredGPUDescriptorHeaps[i]);
+    }
+    commandBuffer->retiredGPUDescriptorHeapCount = 0;
 
-    commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] = NULL;
-    commandBuffer->gpuDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER] = NULL;
+    // Uniform buffers are now available, this command buffer keeps a few and the rest go back to the pool
+    for (i = 0; i < commandBuffer->usedUniformBufferCount && commandBuffer->availableUniformBufferCount < UNIFORM_BUFFER_CACHE_COUNT; i += 1) {
+        commandBuffer->availableUniformBuffers[commandBuffer->availableUniformBufferCount] = commandBuffer->usedUniformBuffers[i];
+        commandBuffer->availableUniformBufferCount += 1;
+    }
 
-    // Uniform buffers are now available
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
+    if (i < commandBuffer->usedUniformBufferCount) {
+        SDL_LockMutex(renderer->acquireUniformBufferLock);
 
-    for (i = 0; i < commandBuffer->usedUniformBufferCount; i += 1) {
-        D3D12_INTERNAL_ReturnUniformBufferToPool(
-            renderer,
-            commandBuffer->usedUniformBuffers[i]);
+        for (; i < commandBuffer->usedUniformBufferCount; i += 1) {
+            D3D12_INTERNAL_ReturnUniformBufferToPool(
+                renderer,
+                commandBuffer->usedUniformBuffers[i]);
+        }
+
+        SDL_UnlockMutex(renderer->acquireUniformBufferLock);
     }
     commandBuffer->usedUniformBufferCount = 0;
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
-
     // TODO: More reference counting
 
     for (i = 0; i < commandBuffer->usedTextureCount; i += 1) {
@@ -7749,6 +9187,14 @@ static bool D3D12_INTERNAL_CleanCommandBuffer(
     // Reset presentation
     commandBuffer->presentDataCount = 0;
 
+    // Release the fences this command buffer waited on
+    for (i = 0; i < commandBuffer->waitFenceCount; i += 1) {
+        D3D12_ReleaseFence(
+            (SDL_GPURenderer *)renderer,
+            (SDL_GPUFence *)commandBuffer->waitFences[i]);
+    }
+    commandBuffer->waitFenceCount = 0;
+
     // The fence is now available (unless SubmitAndAcquireFence was called)
     if (commandBuffer->autoReleaseFence) {
         D3D12_ReleaseFence(
@@ -7850,9 +9296,22 @@ static bool D3D12_Submit(
         CHECK_D3D12_ERROR_AND_RETURN("Failed to convert command list!", false);
     }
 
+    // Wait on the other queues' fences first
+    for (Uint32 i = 0; i < d3d12CommandBuffer->waitFenceCount; i += 1) {
+        res = ID3D12CommandQueue_Wait(
+            d3d12CommandBuffer->commandQueue,
+            d3d12CommandBuffer->waitFences[i]->handle,
+            D3D12_FENCE_SIGNAL_VALUE);
+        if (FAILED(res)) {
+            ID3D12CommandList_Release(commandLists[0]);
+            SDL_UnlockMutex(renderer->submitLock);
+            CHECK_D3D12_ERROR_AND_RETURN("Failed to enqueue fence wait!", false);
+        }
+    }
+
     // Submit the command list to the queue
     ID3D12CommandQueue_ExecuteCommandLists(
-        renderer->commandQueue,
+        d3d12CommandBuffer->commandQueue,
         1,
         commandLists);
 
@@ -7866,8 +9325,9 @@ static bool D3D12_Submit(
     }
 
     // Mark that a fence should be signaled after command list execution
+    d3d12CommandBuffer->inFlightFence->queue = d3d12CommandBuffer->commandQueue;
     res = ID3D12CommandQueue_Signal(
-        renderer->commandQueue,
+        d3d12CommandBuffer->commandQueue,
         d3d12CommandBuffer->inFlightFence->handle,
         D3D12_FENCE_SIGNAL_VALUE);
     if (FAILED(res)) {
@@ -7894,7 +9354,7 @@ static bool D3D12_Submit(
         D3D12PresentData *presentData = &d3d12CommandBuffer->presentDatas[i];
         D3D12WindowData *windowData = presentData->windowData;
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX)
         D3D12XBOX_PRESENT_PLANE_PARAMETERS planeParams;
         SDL_zero(planeParams);
         planeParams.Token = windowData->frameToken;
@@ -7909,6 +9369,8 @@ static bool D3D12_Submit(
         renderer->commandQueue->PresentX(1, &planeParams, &presentParams);
         if (FAILED(res)) {
             result = false;
+        } else {
+            windowData->presentCount += 1;
         }
 #else
         // NOTE: flip discard always supported since DXGI 1.4 is required
@@ -7930,6 +9392,8 @@ static bool D3D12_Submit(
             presentFlags);
         if (FAILED(res)) {
             result = false;
+        } else {
+            windowData->presentCount += 1;
         }
 
         ID3D12Resource_Release(windowData->textureContainers[presentData->swapchainImageIndex].activeTexture->resource);
@@ -7971,6 +9435,33 @@ static SDL_GPUFence *D3D12_SubmitAndAcquireFence(
     return (SDL_GPUFence *)d3d12CommandBuffer->inFlightFence;
 }
 
+static bool D3D12_AddWaitFence(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUFence *fence)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Fence *d3d12Fence = (D3D12Fence *)fence;
+
+    if (d3d12Fence->queue == d3d12CommandBuffer->commandQueue) {
+        // Submissions on the same queue are already ordered
+        return true;
+    }
+
+    // Hold a reference so the fence isn't reset before the wait is enqueued
+    EXPAND_ARRAY_IF_NEEDED(
+        d3d12CommandBuffer->waitFences,
+        D3D12Fence *,
+        d3d12CommandBuffer->waitFenceCount + 1,
+        d3d12CommandBuffer->waitFenceCapacity,
+        d3d12CommandBuffer->waitFenceCapacity + 1);
+
+    (void)SDL_AtomicIncRef(&d3d12Fence->referenceCount);
+    d3d12CommandBuffer->waitFences[d3d12CommandBuffer->waitFenceCount] = d3d12Fence;
+    d3d12CommandBuffer->waitFenceCount += 1;
+
+    return true;
+}
+
 static bool D3D12_Cancel(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -7996,6 +9487,7 @@ static bool D3D12_Wait(
 {
     D3D12Renderer *renderer = (D3D12Renderer *)driverData;
     D3D12Fence *fence = D3D12_INTERNAL_AcquireFence(renderer);
+    D3D12Fence *computeFence = NULL;
     if (!fence) {
         return false;
     }
@@ -8003,6 +9495,21 @@ static bool D3D12_Wait(
 
     SDL_LockMutex(renderer->submitLock);
 
+    // Make the direct queue wait for the compute queue so that one fence covers both
+    if (renderer->computeQueue && renderer->commandQueue) {
+        computeFence = D3D12_INTERNAL_AcquireFence(renderer);
+        if (computeFence) {
+            ID3D12CommandQueue_Signal(
+                renderer->computeQueue,
+                computeFence->handle,
+                D3D12_FENCE_SIGNAL_VALUE);
+            ID3D12CommandQueue_Wait(
+                renderer->commandQueue,
+                computeFence->handle,
+                D3D12_FENCE_SIGNAL_VALUE);
+        }
+    }
+
     if (renderer->commandQueue) {
         // Insert a signal into the end of the command queue...
         ID3D12CommandQueue_Signal(
@@ -8029,6 +9536,11 @@ static bool D3D12_Wait(
     D3D12_ReleaseFence(
         (SDL_GPURenderer *)renderer,
         (SDL_GPUFence *)fence);
+    if (computeFence) {
+        D3D12_ReleaseFence(
+            (SDL_GPURenderer *)renderer,
+            (SDL_GPUFence *)computeFence);
+    }
 
     bool result = true;
 
@@ -8183,6 +9695,100 @@ static bool D3D12_SupportsTextureFormat(
     return true;
 }
 
+static bool D3D12_SupportsSparseTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTextureFormat format,
+    SDL_GPUTextureType type,
+    SDL_GPUTextureUsageFlags usage)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12_FEATURE_DATA_FORMAT_SUPPORT formatSupport = { SDLToD3D12_TextureFormat[format], D3D12_FORMAT_SUPPORT1_NONE, D3D12_FORMAT_SUPPORT2_NONE };
+    HRESULT res;
+
+    (void)type;
+    (void)usage;
+
+    if (!renderer->tiledResourcesSupported) {
+        return false;
+    }
+
+    res = ID3D12Device_CheckFeatureSupport(
+        renderer->device,
+        D3D12_FEATURE_FORMAT_SUPPORT,
+        &formatSupport,
+        sizeof(formatSupport));
+
+    return SUCCEEDED(res) && (formatSupport.Support2 & D3D12_FORMAT_SUPPORT2_TILED);
+}
+
+static bool D3D12_UpdateSparseTileMappings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    const GPU_SparseTileUpdate *updates,
+    Uint32 numUpdates)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12TextureContainer *container = (D3D12TextureContainer *)texture;
+    D3D12Texture *d3d12Texture = container->activeTexture;
+    D3D12_TILED_RESOURCE_COORDINATE *coordinates;
+    D3D12_TILE_REGION_SIZE *regionSizes;
+    D3D12_TILE_RANGE_FLAGS *rangeFlags;
+    UINT *heapOffsets;
+    UINT *tileCounts;
+    bool result = false;
+
+    coordinates = (D3D12_TILED_RESOURCE_COORDINATE *)SDL_malloc(numUpdates * sizeof(D3D12_TILED_RESOURCE_COORDINATE));
+    regionSizes = (D3D12_TILE_REGION_SIZE *)SDL_malloc(numUpdates * sizeof(D3D12_TILE_REGION_SIZE));
+    rangeFlags = (D3D12_TILE_RANGE_FLAGS *)SDL_malloc(numUpdates * sizeof(D3D12_TILE_RANGE_FLAGS));
+    heapOffsets = (UINT *)SDL_malloc(numUpdates * sizeof(UINT));
+    tileCounts = (UINT *)SDL_malloc(numUpdates * sizeof(UINT));
+
+    if (coordinates && regionSizes && rangeFlags && heapOffsets && tileCounts) {
+        // One region and one single-tile range per update
+        for (Uint32 i = 0; i < numUpdates; i += 1) {
+            coordinates[i].X = updates[i].x;
+            coordinates[i].Y = updates[i].y;
+            coordinates[i].Z = 0;
+            coordinates[i].Subresource = D3D12_INTERNAL_CalcSubresource(
+                updates[i].level,
+                updates[i].layer,
+                container->header.info.num_levels);
+            regionSizes[i].NumTiles = 1;
+            regionSizes[i].UseBox = FALSE;
+            regionSizes[i].Width = 0;
+            regionSizes[i].Height = 0;
+            regionSizes[i].Depth = 0;
+            if (updates[i].slot == GPU_SPARSE_TILE_UNMAPPED) {
+                rangeFlags[i] = D3D12_TILE_RANGE_FLAG_NULL;
+                heapOffsets[i] = 0;
+            } else {
+                rangeFlags[i] = D3D12_TILE_RANGE_FLAG_NONE;
+                heapOffsets[i] = updates[i].slot;
+            }
+            tileCounts[i] = 1;
+        }
+
+        result = D3D12_INTERNAL_UpdateTileMappings(
+            renderer,
+            d3d12Texture->resource,
+            numUpdates,
+            coordinates,
+            regionSizes,
+            d3d12Texture->tileHeap,
+            numUpdates,
+            rangeFlags,
+            heapOffsets,
+            tileCounts);
+    }
+
+    SDL_free(coordinates);
+    SDL_free(regionSizes);
+    SDL_free(rangeFlags);
+    SDL_free(heapOffsets);
+    SDL_free(tileCounts);
+    return result;
+}
+
 static bool D3D12_SupportsSampleCount(
     SDL_GPURenderer *driverData,
     SDL_GPUTextureFormat format,
@@ -8192,7 +9798,7 @@ static bool D3D12_SupportsSampleCount(
     D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS featureData;
     HRESULT res;
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX)
     featureData.Flags = (D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG)0;
 #else
     featureData.Flags = (D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS)0;
@@ -8335,7 +9941,7 @@ static void D3D12_INTERNAL_InitBlitResources(
 
 static bool D3D12_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
 {
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#if defined(SDL_D3D12_XBOX)
     return true;
 #else
     SDL_SharedObject *d3d12Dll;
@@ -8360,6 +9966,13 @@ static bool D3D12_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
         return false;
     }
 
+#ifdef SDL_PLATFORM_WINRT
+    // UWP apps can't load system DLLs at runtime, D3D12 and DXGI are linked directly
+    d3d12Dll = NULL;
+    dxgiDll = NULL;
+    D3D12CreateDeviceFunc = D3D12CreateDevice;
+    CreateDXGIFactoryFunc = CreateDXGIFactory1;
+#else
     // Can we load D3D12?
 
     d3d12Dll = SDL_LoadObject(D3D12_DLL);
@@ -8393,6 +10006,7 @@ static bool D3D12_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
         SDL_UnloadObject(dxgiDll);
         return false;
     }
+#endif // SDL_PLATFORM_WINRT
 
     // Can we create a device?
 
@@ -8488,7 +10102,7 @@ static bool D3D12_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
 #endif
 }
 
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)) && defined(HAVE_IDXGIINFOQUEUE)
+#if !defined(SDL_D3D12_XBOX) && !defined(SDL_PLATFORM_WINRT) && defined(HAVE_IDXGIINFOQUEUE)
 static bool D3D12_INTERNAL_TryInitializeDXGIDebug(D3D12Renderer *renderer)
 {
     PFN_DXGI_GET_DEBUG_INTERFACE DXGIGetDebugInterfaceFunc;
@@ -8525,9 +10139,13 @@ static bool D3D12_INTERNAL_TryInitializeD3D12Debug(D3D12Renderer *renderer)
     PFN_D3D12_GET_DEBUG_INTERFACE D3D12GetDebugInterfaceFunc;
     HRESULT res;
 
+#ifdef SDL_PLATFORM_WINRT
+    D3D12GetDebugInterfaceFunc = D3D12GetDebugInterface;
+#else
     D3D12GetDebugInterfaceFunc = (PFN_D3D12_GET_DEBUG_INTERFACE)SDL_LoadFunction(
         renderer->d3d12_dll,
         D3D12_GET_DEBUG_INTERFACE_FUNC);
+#endif
     if (D3D12GetDebugInterfaceFunc == NULL) {
         return false;
     }
@@ -8541,7 +10159,7 @@ static bool D3D12_INTERNAL_TryInitializeD3D12Debug(D3D12Renderer *renderer)
     return true;
 }
 
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if !defined(SDL_D3D12_XBOX)
 static void D3D12_INTERNAL_TryInitializeD3D12DebugInfoQueue(D3D12Renderer *renderer)
 {
     ID3D12InfoQueue *infoQueue = NULL;
@@ -8685,13 +10303,71 @@ static void D3D12_INTERNAL_TryInitializeD3D12DebugInfoLogger(D3D12Renderer *rend
 }
 #endif
 
+static void D3D12_INTERNAL_CreateBindlessHeaps(D3D12Renderer *renderer)
+{
+#if defined(SDL_D3D12_XBOX)
+    (void)renderer;
+#else
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options;
+    HRESULT res;
+
+    res = ID3D12Device_CheckFeatureSupport(
+        renderer->device,
+        D3D12_FEATURE_D3D12_OPTIONS,
+        &options,
+        sizeof(options));
+    if (FAILED(res) || options.ResourceBindingTier < D3D12_RESOURCE_BINDING_TIER_2) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "D3D12: Bindless resources require resource binding tier 2");
+        return;
+    }
+
+    renderer->bindlessLock = SDL_CreateMutex();
+    renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] = D3D12_INTERNAL_CreateDescriptorHeap(
+        renderer,
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+        BINDLESS_MAX_TEXTURES + BINDLESS_MAX_BUFFERS,
+        true);
+    renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER] = D3D12_INTERNAL_CreateDescriptorHeap(
+        renderer,
+        D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
+        BINDLESS_MAX_SAMPLERS,
+        true);
+
+    if (renderer->bindlessLock == NULL ||
+        renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] == NULL ||
+        renderer->bindlessStagingHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER] == NULL) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "D3D12: Failed to create bindless heaps: %s", SDL_GetError());
+        for (Uint32 i = 0; i < SDL_arraysize(renderer->bindlessStagingHeaps); i += 1) {
+            if (renderer->bindlessStagingHeaps[i]) {
+                D3D12_INTERNAL_DestroyDescriptorHeap(renderer->bindlessStagingHeaps[i]);
+                renderer->bindlessStagingHeaps[i] = NULL;
+            }
+        }
+        if (renderer->bindlessLock) {
+            SDL_DestroyMutex(renderer->bindlessLock);
+            renderer->bindlessLock = NULL;
+        }
+        return;
+    }
+
+    renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE] = BINDLESS_MAX_TEXTURES;
+    renderer->bindlessCapacity[GPU_BINDLESS_SAMPLER] = BINDLESS_MAX_SAMPLERS;
+    renderer->bindlessCapacity[GPU_BINDLESS_BUFFER] = BINDLESS_MAX_BUFFERS;
+
+    SDL_SetBooleanProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN, true);
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_TEXTURES_NUMBER, BINDLESS_MAX_TEXTURES);
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_SAMPLERS_NUMBER, BINDLESS_MAX_SAMPLERS);
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_BUFFERS_NUMBER, BINDLESS_MAX_BUFFERS);
+#endif
+}
+
 static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SDL_PropertiesID props)
 {
     SDL_GPUDevice *result;
     D3D12Renderer *renderer;
     HRESULT res;
 
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     PFN_D3D12_XBOX_CREATE_DEVICE D3D12XboxCreateDeviceFunc;
     D3D12XBOX_CREATE_DEVICE_PARAMETERS createDeviceParams;
 #else
@@ -8714,7 +10390,14 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     renderer = (D3D12Renderer *)SDL_calloc(1, sizeof(D3D12Renderer));
 
     bool hasDxgiDebug = false;
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if !defined(SDL_D3D12_XBOX)
+#ifdef SDL_PLATFORM_WINRT
+    /* UWP apps can't load system DLLs at runtime, DXGI is linked directly.
+     * The DXGI debug interfaces live in dxgidebug.dll, so they're unavailable.
+     */
+    CreateDXGIFactoryFunc = CreateDXGIFactory1;
+    hasDxgiDebug = true;
+#else
     // Load the DXGI library
     renderer->dxgi_dll = SDL_LoadObject(DXGI_DLL);
     if (renderer->dxgi_dll == NULL) {
@@ -8739,6 +10422,7 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
         D3D12_INTERNAL_DestroyRenderer(renderer);
         SET_STRING_ERROR_AND_RETURN("Could not load function: " CREATE_DXGI_FACTORY1_FUNC, NULL);
     }
+#endif // SDL_PLATFORM_WINRT
 
     // Create the DXGI factory
     res = CreateDXGIFactoryFunc(
@@ -8849,6 +10533,11 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 #endif
 
+#ifdef SDL_PLATFORM_WINRT
+    // UWP apps can't load system DLLs at runtime, D3D12 is linked directly
+    D3D12CreateDeviceFunc = D3D12CreateDevice;
+    renderer->D3D12SerializeRootSignature_func = D3D12SerializeRootSignature;
+#else
     // Load the D3D library
     renderer->d3d12_dll = SDL_LoadObject(D3D12_DLL);
     if (renderer->d3d12_dll == NULL) {
@@ -8857,7 +10546,7 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 
     // Load the CreateDevice function
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     D3D12XboxCreateDeviceFunc = (PFN_D3D12_XBOX_CREATE_DEVICE)SDL_LoadFunction(
         renderer->d3d12_dll,
         "D3D12XboxCreateDevice");
@@ -8882,11 +10571,12 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
         D3D12_INTERNAL_DestroyRenderer(renderer);
         SET_STRING_ERROR_AND_RETURN("Could not load function: " D3D12_SERIALIZE_ROOT_SIGNATURE_FUNC, NULL);
     }
+#endif // SDL_PLATFORM_WINRT
 
     // Initialize the D3D12 debug layer, if applicable
     if (debugMode) {
         bool hasD3d12Debug = D3D12_INTERNAL_TryInitializeD3D12Debug(renderer);
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
         if (hasD3d12Debug) {
             SDL_LogInfo(
                 SDL_LOG_CATEGORY_GPU,
@@ -8909,7 +10599,7 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 
     // Create the D3D12Device
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     if (s_Device != NULL) {
         renderer->device = s_Device;
     } else {
@@ -8972,7 +10662,7 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     renderer->UMA = (bool)architecture.UMA;
     renderer->UMACacheCoherent = (bool)architecture.CacheCoherentUMA;
 
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     renderer->GPUUploadHeapSupported = false;
 #else
     // Check "GPU Upload Heap" support (for fast uniform buffers)
@@ -8989,8 +10679,36 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 #endif
 
+    // Check tiled resource support (for sparse textures)
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options;
+    renderer->tiledResourcesSupported = false;
+    res = ID3D12Device_CheckFeatureSupport(
+        renderer->device,
+        D3D12_FEATURE_D3D12_OPTIONS,
+        &options,
+        sizeof(options));
+
+    if (SUCCEEDED(res)) {
+        renderer->tiledResourcesSupported = options.TiledResourcesTier >= D3D12_TILED_RESOURCES_TIER_2;
+    }
+
+    // Check variable rate shading support
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6;
+    renderer->shadingRateTier = D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+    res = ID3D12Device_CheckFeatureSupport(
+        renderer->device,
+        D3D12_FEATURE_D3D12_OPTIONS6,
+        &options6,
+        sizeof(options6));
+
+    if (SUCCEEDED(res)) {
+        renderer->shadingRateTier = options6.VariableShadingRateTier;
+        renderer->shadingRateImageTileSize = options6.ShadingRateImageTileSize;
+        renderer->additionalShadingRatesSupported = options6.AdditionalShadingRatesSupported;
+    }
+
     // Create command queue
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     if (s_CommandQueue != NULL) {
         renderer->commandQueue = s_CommandQueue;
     } else {
@@ -9010,11 +10728,38 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
             D3D12_INTERNAL_DestroyRenderer(renderer);
             CHECK_D3D12_ERROR_AND_RETURN("Could not create D3D12CommandQueue", NULL);
         }
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
         s_CommandQueue = renderer->commandQueue;
     }
 #endif
 
+#if !defined(SDL_D3D12_XBOX)
+    // Create async compute queue, not fatal if it fails since everything can run on the direct queue
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    queueDesc.NodeMask = 0;
+    queueDesc.Priority = 0;
+
+    res = ID3D12Device_CreateCommandQueue(
+        renderer->device,
+        &queueDesc,
+        D3D_GUID(D3D_IID_ID3D12CommandQueue),
+        (void **)&renderer->computeQueue);
+
+    if (FAILED(res)) {
+        renderer->computeQueue = NULL;
+    }
+#endif
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_ASYNC_COMPUTE_BOOLEAN,
+        renderer->computeQueue != NULL);
+    // ExecuteIndirect always accepts a count buffer
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN,
+        true);
+
     // Create indirect command signatures
 
     D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc;
@@ -9140,6 +10885,11 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
         }
     }
 
+    // Initialize bindless heaps, doesn't fail device creation if unsupported
+    if (SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN, false)) {
+        D3D12_INTERNAL_CreateBindlessHeaps(renderer);
+    }
+
     // Deferred resource releasing
 
     renderer->buffersToDestroyCapacity = 4;
@@ -9196,6 +10946,8 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     renderer->disposeLock = SDL_CreateMutex();
 
     renderer->debug_mode = debugMode;
+
+    D3D12_INTERNAL_CreatePipelineLibrary(renderer, props);
     renderer->allowedFramesInFlight = 2;
 
     renderer->semantic = SDL_GetStringProperty(props, SDL_PROP_GPU_DEVICE_CREATE_D3D12_SEMANTIC_NAME_STRING, "TEXCOORD");
@@ -9203,7 +10955,7 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     // Blit resources
     D3D12_INTERNAL_InitBlitResources(renderer);
 
-#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_D3D12_XBOX)
     res = renderer->device->SetFrameIntervalX(
         NULL,
         D3D12XBOX_FRAME_INTERVAL_60_HZ,
@@ -9248,6 +11000,18 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 
     ASSIGN_DRIVER(D3D12)
+    result->BeginCapture = D3D12_BeginCapture;
+    result->EndCapture = D3D12_EndCapture;
+    result->SupportsSparseTexture = D3D12_SupportsSparseTexture;
+    result->UpdateSparseTileMappings = D3D12_UpdateSparseTileMappings;
+    if (renderer->shadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED) {
+        result->SupportsShadingRate = D3D12_SupportsShadingRate;
+        result->SetShadingRate = D3D12_SetShadingRate;
+    }
+    if (renderer->shadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2) {
+        result->GetShadingRateImageTileSize = D3D12_GetShadingRateImageTileSize;
+        result->SetShadingRateImage = D3D12_SetShadingRateImage;
+    }
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = shaderFormats;
     result->debug_mode = debugMode;
@@ -9270,7 +11034,7 @@ SDL_GPUBootstrap D3D12Driver = {
 
 void SDL_GDKSuspendGPU(SDL_GPUDevice *device)
 {
-#if defined(SDL_GPU_D3D12) && (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_GPU_D3D12) && defined(SDL_D3D12_XBOX)
     D3D12Renderer *renderer = (D3D12Renderer *)device->driverData;
     HRESULT res;
     if (device == NULL) {
@@ -9288,7 +11052,7 @@ void SDL_GDKSuspendGPU(SDL_GPUDevice *device)
 
 void SDL_GDKResumeGPU(SDL_GPUDevice *device)
 {
-#if defined(SDL_GPU_D3D12) && (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#if defined(SDL_GPU_D3D12) && defined(SDL_D3D12_XBOX)
     D3D12Renderer *renderer = (D3D12Renderer *)device->driverData;
     HRESULT res;
     if (device == NULL) {
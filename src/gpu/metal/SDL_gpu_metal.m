@@ -426,6 +426,7 @@ static MTLDepthClipMode SDLToMetal_DepthClipMode(
 typedef struct MetalTexture
 {
     id<MTLTexture> handle;
+    id<MTLHeap> sparseHeap; // backs the tiles of a sparse texture, nil otherwise
     SDL_AtomicInt referenceCount;
 } MetalTexture;
 
@@ -449,6 +450,15 @@ typedef struct MetalFence
     SDL_AtomicInt referenceCount;
 } MetalFence;
 
+// Shared with presented handlers, which can run after the window is released
+typedef struct MetalPresentTiming
+{
+    SDL_AtomicInt referenceCount;
+    SDL_SpinLock lock;
+    Uint64 displayedFrameID;
+    Uint64 displayTimeNS;
+} MetalPresentTiming;
+
 typedef struct MetalWindowData
 {
     SDL_Window *window;
@@ -460,6 +470,8 @@ typedef struct MetalWindowData
     MetalTextureContainer textureContainer;
     SDL_GPUFence *inFlightFences[MAX_FRAMES_IN_FLIGHT];
     Uint32 frameCounter;
+    Uint64 presentCount;
+    MetalPresentTiming *presentTiming;
 } MetalWindowData;
 
 typedef struct MetalShader
@@ -768,6 +780,42 @@ static SDL_PropertiesID METAL_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static void *METAL_GetPipelineCacheData(SDL_GPUDevice *device, size_t *size)
+{
+    // The Metal driver caches compiled shaders on its own
+    SDL_Unsupported();
+    return NULL;
+}
+
+static SDL_GPUMemoryInfo *METAL_GetMemoryInfo(SDL_GPUDevice *device, int *count)
+{
+    @autoreleasepool {
+        MetalRenderer *renderer = (MetalRenderer *)device->driverData;
+        SDL_GPUMemoryInfo *result;
+
+        // Metal exposes a single working set for the device
+        result = (SDL_GPUMemoryInfo *)SDL_calloc(1, sizeof(SDL_GPUMemoryInfo));
+        if (!result) {
+            return NULL;
+        }
+
+        if (@available(macOS 10.12, iOS 16.0, tvOS 16.0, *)) {
+            result[0].budget = renderer->device.recommendedMaxWorkingSetSize;
+        }
+        if (@available(macOS 10.13, iOS 11.0, tvOS 11.0, *)) {
+            result[0].usage = renderer->device.currentAllocatedSize;
+        }
+        if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *)) {
+            result[0].device_local = !renderer->device.hasUnifiedMemory;
+        } else {
+            result[0].device_local = true;
+        }
+
+        *count = 1;
+        return result;
+    }
+}
+
 // Resource tracking
 
 static void METAL_INTERNAL_TrackBuffer(
@@ -912,11 +960,13 @@ static void METAL_INTERNAL_DestroyTextureContainer(
 {
     for (Uint32 i = 0; i < container->textureCount; i += 1) {
         container->textures[i]->handle = nil;
+        container->textures[i]->sparseHeap = nil;
         SDL_free(container->textures[i]);
     }
     if (container->debugName != NULL) {
         SDL_free(container->debugName);
     }
+    SDL_GPU_DestroySparseTileMap(container->header.sparse);
     SDL_free(container->textures);
     SDL_free(container);
 }
@@ -1342,6 +1392,93 @@ static void METAL_PopDebugGroup(
     }
 }
 
+static bool METAL_BeginCapture(
+    SDL_GPURenderer *driverData,
+    const char *path)
+{
+    @autoreleasepool {
+        MetalRenderer *renderer = (MetalRenderer *)driverData;
+
+        if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, *)) {
+            MTLCaptureManager *manager = [MTLCaptureManager sharedCaptureManager];
+            MTLCaptureDescriptor *descriptor = [[MTLCaptureDescriptor alloc] init];
+            NSError *error = nil;
+
+            descriptor.captureObject = renderer->device;
+            if (path) {
+                // Works outside of Xcode too, when the app has MTL_CAPTURE_ENABLED=1 in its environment
+                descriptor.destination = MTLCaptureDestinationGPUTraceDocument;
+                descriptor.outputURL = [NSURL fileURLWithPath:@(path)];
+            } else {
+                descriptor.destination = MTLCaptureDestinationDeveloperTools;
+            }
+            if (![manager supportsDestination:descriptor.destination]) {
+                return SDL_SetError("No GPU capture tool is attached");
+            }
+            if (![manager startCaptureWithDescriptor:descriptor error:&error]) {
+                return SDL_SetError("Couldn't start GPU capture: %s", error.localizedDescription.UTF8String);
+            }
+            return true;
+        } else {
+            return SDL_Unsupported();
+        }
+    }
+}
+
+static bool METAL_EndCapture(
+    SDL_GPURenderer *driverData)
+{
+    @autoreleasepool {
+        [[MTLCaptureManager sharedCaptureManager] stopCapture];
+        return true;
+    }
+}
+
+/* Timestamp queries are not implemented here. MTLCounterSampleBuffer can only
+ * sample at the sampling points a given GPU family supports, and its
+ * timestamps need to be calibrated against the CPU clock.
+ */
+
+static SDL_GPUQueryPool *METAL_CreateQueryPool(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUQueryPoolCreateInfo *createinfo)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
+static void METAL_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 index)
+{
+}
+
+static void METAL_ReleaseQueryPool(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool)
+{
+}
+
+static bool METAL_GetQueryPoolResults(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 firstQuery,
+    Uint32 numQueries,
+    Uint64 *results)
+{
+    return SDL_Unsupported();
+}
+
+static bool METAL_WriteBindlessDescriptor(
+    SDL_GPURenderer *driverData,
+    GPU_BindlessType type,
+    Uint32 index,
+    void *resource)
+{
+    return SDL_Unsupported();
+}
+
 // Resource Creation
 
 static SDL_GPUSampler *METAL_CreateSampler(
@@ -1412,14 +1549,126 @@ static SDL_GPUShader *METAL_CreateShader(
     }
 }
 
+// Maps or unmaps sparse tiles and waits until the GPU has the new mappings
+static bool METAL_INTERNAL_UpdateTextureMappings(
+    MetalRenderer *renderer,
+    id<MTLTexture> texture,
+    const GPU_SparseTileUpdate *updates,
+    Uint32 numUpdates)
+{
+    if (@available(macOS 13.0, iOS 16.0, tvOS 16.0, *)) {
+        id<MTLCommandBuffer> commandBuffer = [renderer->queue commandBuffer];
+        id<MTLResourceStateCommandEncoder> encoder = [commandBuffer resourceStateCommandEncoder];
+
+        // The heap picks the physical tiles itself, so only mapped vs unmapped matters here
+        for (Uint32 i = 0; i < numUpdates; i += 1) {
+            [encoder updateTextureMapping:texture
+                                     mode:(updates[i].slot == GPU_SPARSE_TILE_UNMAPPED) ? MTLSparseTextureMappingModeUnmap : MTLSparseTextureMappingModeMap
+                                   region:MTLRegionMake2D(updates[i].x, updates[i].y, 1, 1)
+                                 mipLevel:updates[i].level
+                                    slice:updates[i].layer];
+        }
+        [encoder endEncoding];
+        [commandBuffer commit];
+        [commandBuffer waitUntilCompleted];
+
+        if (commandBuffer.status == MTLCommandBufferStatusError) {
+            SET_STRING_ERROR_AND_RETURN("Failed to update sparse texture mappings", false);
+        }
+        return true;
+    } else {
+        SET_STRING_ERROR_AND_RETURN("Sparse textures are not supported", false);
+    }
+}
+
+// Creates a sparse texture on its own heap, with the mip tail of each slice mapped up front
+static id<MTLTexture> METAL_INTERNAL_CreateSparseTexture(
+    MetalRenderer *renderer,
+    MetalTexture *metalTexture,
+    MTLTextureDescriptor *textureDescriptor,
+    const SDL_GPUTextureCreateInfo *createinfo,
+    GPU_SparseTileMap **sparseMap)
+{
+    if (@available(macOS 13.0, iOS 16.0, tvOS 16.0, *)) {
+        MTLHeapDescriptor *heapDescriptor = [MTLHeapDescriptor new];
+        MTLSize tileSize = [renderer->device sparseTileSizeWithTextureType:textureDescriptor.textureType
+                                                               pixelFormat:textureDescriptor.pixelFormat
+                                                               sampleCount:textureDescriptor.sampleCount];
+        NSUInteger tileBytes = renderer->device.sparseTileSizeInBytes;
+        Uint32 numLayers = createinfo->layer_count_or_depth;
+        Uint32 numTailTiles;
+        id<MTLHeap> heap;
+        id<MTLTexture> texture;
+        GPU_SparseTileMap *map;
+
+        heapDescriptor.type = MTLHeapTypeSparse;
+        heapDescriptor.storageMode = MTLStorageModePrivate;
+        heapDescriptor.size = tileBytes;
+
+        // The mip tail is only known once a texture exists, and sparse textures take no heap memory until mapped
+        heap = [renderer->device newHeapWithDescriptor:heapDescriptor];
+        texture = [heap newTextureWithDescriptor:textureDescriptor];
+        if (texture == nil) {
+            SET_STRING_ERROR_AND_RETURN("Failed to create sparse MTLTexture!", nil);
+        }
+
+        map = SDL_GPU_CreateSparseTileMap(
+            createinfo,
+            (Uint32)tileSize.width,
+            (Uint32)tileSize.height,
+            (Uint32)tileBytes,
+            (Uint32)texture.firstMipmapInTail);
+        if (map == NULL) {
+            return nil;
+        }
+
+        numTailTiles = (map->firstPackedLevel < createinfo->num_levels) ? (Uint32)((texture.tailSizeInBytes + tileBytes - 1) / tileBytes) : 0;
+        heapDescriptor.size = SDL_max(map->numSlots + numTailTiles * numLayers, 1) * tileBytes;
+        heap = [renderer->device newHeapWithDescriptor:heapDescriptor];
+        texture = [heap newTextureWithDescriptor:textureDescriptor];
+        if (texture == nil) {
+            SDL_GPU_DestroySparseTileMap(map);
+            SET_STRING_ERROR_AND_RETURN("Failed to create sparse MTLTexture!", nil);
+        }
+
+        if (numTailTiles > 0) {
+            GPU_SparseTileUpdate *tailUpdates = SDL_calloc(numLayers, sizeof(GPU_SparseTileUpdate));
+            bool result = tailUpdates != NULL;
+
+            for (Uint32 layer = 0; result && layer < numLayers; layer += 1) {
+                tailUpdates[layer].level = map->firstPackedLevel;
+                tailUpdates[layer].layer = layer;
+                tailUpdates[layer].slot = 0;
+            }
+            if (result) {
+                result = METAL_INTERNAL_UpdateTextureMappings(renderer, texture, tailUpdates, numLayers);
+            }
+            SDL_free(tailUpdates);
+
+            if (!result) {
+                SDL_GPU_DestroySparseTileMap(map);
+                return nil;
+            }
+        }
+
+        metalTexture->sparseHeap = heap;
+        *sparseMap = map;
+        return texture;
+    } else {
+        SET_STRING_ERROR_AND_RETURN("Sparse textures are not supported", nil);
+    }
+}
+
 // This function assumes that it's called from within an autorelease pool
 static MetalTexture *METAL_INTERNAL_CreateTexture(
     MetalRenderer *renderer,
-    const SDL_GPUTextureCreateInfo *createinfo)
+    const SDL_GPUTextureCreateInfo *createinfo,
+    GPU_SparseTileMap **sparseMap) // non-NULL to honor SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN
 {
     MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor new];
     id<MTLTexture> texture;
     MetalTexture *metalTexture;
+    bool sparse = sparseMap != NULL && SDL_GetBooleanProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN, false);
 
     textureDescriptor.textureType = SDLToMetal_TextureType(createinfo->type, createinfo->sample_count > SDL_GPU_SAMPLECOUNT_1);
     textureDescriptor.pixelFormat = SDLToMetal_TextureFormat(createinfo->format);
@@ -1445,6 +1694,14 @@ static MetalTexture *METAL_INTERNAL_CreateTexture(
             ? createinfo->layer_count_or_depth
             : 1;
     textureDescriptor.storageMode = MTLStorageModePrivate;
+    if (createinfo->usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+        // Keep transient targets in tile memory on Apple GPUs
+        if (@available(macOS 11.0, iOS 13.0, tvOS 13.0, *)) {
+            if (createinfo->type != SDL_GPU_TEXTURETYPE_3D && [renderer->device supportsFamily:MTLGPUFamilyApple1]) {
+                textureDescriptor.storageMode = MTLStorageModeMemoryless;
+            }
+        }
+    }
 
     textureDescriptor.usage = 0;
     if (createinfo->usage & (SDL_GPU_TEXTUREUSAGE_COLOR_TARGET |
@@ -1461,13 +1718,23 @@ static MetalTexture *METAL_INTERNAL_CreateTexture(
         textureDescriptor.usage |= MTLTextureUsageShaderWrite;
     }
 
-    texture = [renderer->device newTextureWithDescriptor:textureDescriptor];
+    metalTexture = (MetalTexture *)SDL_calloc(1, sizeof(MetalTexture));
+    if (sparse) {
+        texture = METAL_INTERNAL_CreateSparseTexture(
+            renderer,
+            metalTexture,
+            textureDescriptor,
+            createinfo,
+            sparseMap);
+    } else {
+        texture = [renderer->device newTextureWithDescriptor:textureDescriptor];
+    }
     if (texture == NULL) {
         SDL_LogError(SDL_LOG_CATEGORY_GPU, "Failed to create MTLTexture!");
+        SDL_free(metalTexture);
         return NULL;
     }
 
-    metalTexture = (MetalTexture *)SDL_calloc(1, sizeof(MetalTexture));
     metalTexture->handle = texture;
     SDL_SetAtomicInt(&metalTexture->referenceCount, 0);
 
@@ -1498,17 +1765,20 @@ static SDL_GPUTexture *METAL_CreateTexture(
         MetalRenderer *renderer = (MetalRenderer *)driverData;
         MetalTextureContainer *container;
         MetalTexture *texture;
+        GPU_SparseTileMap *sparseMap = NULL;
 
         texture = METAL_INTERNAL_CreateTexture(
             renderer,
-            createinfo);
+            createinfo,
+            &sparseMap);
 
         if (texture == NULL) {
             SET_STRING_ERROR_AND_RETURN("Failed to create texture", NULL);
         }
 
         container = SDL_calloc(1, sizeof(MetalTextureContainer));
-        container->canBeCycled = 1;
+        container->header.sparse = sparseMap;
+        container->canBeCycled = sparseMap == NULL; // tile mappings belong to a single texture
 
         // Copy properties so we don't lose information when the client destroys them
         container->header.info = *createinfo;
@@ -1559,7 +1829,8 @@ static MetalTexture *METAL_INTERNAL_PrepareTextureForWrite(
 
         container->textures[container->textureCount] = METAL_INTERNAL_CreateTexture(
             renderer,
-            &container->header.info);
+            &container->header.info,
+            NULL);
         container->textureCount += 1;
 
         container->activeTexture = container->textures[container->textureCount - 1];
@@ -2126,7 +2397,8 @@ static bool METAL_INTERNAL_AcquireFence(
 }
 
 static SDL_GPUCommandBuffer *METAL_AcquireCommandBuffer(
-    SDL_GPURenderer *driverData)
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueueType queueType)
 {
     @autoreleasepool {
         MetalRenderer *renderer = (MetalRenderer *)driverData;
@@ -2914,6 +3186,30 @@ static void METAL_DrawIndexedPrimitivesIndirect(
     }
 }
 
+static void METAL_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    // Metal can't read the draw count on the GPU without indirect command buffers, so every slot is drawn
+    METAL_DrawPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+}
+
+static void METAL_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    // Metal can't read the draw count on the GPU without indirect command buffers, so every slot is drawn
+    METAL_DrawIndexedPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+}
+
 static void METAL_EndRenderPass(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -3078,6 +3374,31 @@ static void METAL_Blit(
         &renderer->blitPipelineCapacity);
 }
 
+static void METAL_BlitTextures(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits)
+{
+    MetalCommandBuffer *metalCommandBuffer = (MetalCommandBuffer *)commandBuffer;
+    MetalRenderer *renderer = (MetalRenderer *)metalCommandBuffer->renderer;
+
+    SDL_GPU_BlitBatchCommon(
+        commandBuffer,
+        infos,
+        numBlits,
+        renderer->blitLinearSampler,
+        renderer->blitNearestSampler,
+        renderer->blitVertexShader,
+        renderer->blitFrom2DShader,
+        renderer->blitFrom2DArrayShader,
+        renderer->blitFrom3DShader,
+        renderer->blitFromCubeShader,
+        renderer->blitFromCubeArrayShader,
+        &renderer->blitPipelines,
+        &renderer->blitPipelineCount,
+        &renderer->blitPipelineCapacity);
+}
+
 // Compute State
 
 static void METAL_BeginComputePass(
@@ -3711,6 +4032,49 @@ static bool METAL_SupportsPresentMode(
     }
 }
 
+static void METAL_INTERNAL_ReleasePresentTiming(MetalPresentTiming *presentTiming)
+{
+    if (SDL_AtomicDecRef(&presentTiming->referenceCount)) {
+        SDL_free(presentTiming);
+    }
+}
+
+static void METAL_INTERNAL_TrackPresentTiming(MetalWindowData *windowData)
+{
+    if (@available(macOS 10.15.4, iOS 10.3, tvOS 10.3, *)) {
+        MetalPresentTiming *presentTiming = windowData->presentTiming;
+        Uint64 frameID = windowData->presentCount + 1;
+
+        if (presentTiming == NULL) {
+            presentTiming = (MetalPresentTiming *)SDL_calloc(1, sizeof(MetalPresentTiming));
+            if (presentTiming == NULL) {
+                return;
+            }
+            SDL_SetAtomicInt(&presentTiming->referenceCount, 1);
+            windowData->presentTiming = presentTiming;
+        }
+
+        (void)SDL_AtomicIncRef(&presentTiming->referenceCount);
+        [windowData->drawable addPresentedHandler:^(id<MTLDrawable> drawable) {
+          // presentedTime is 0 if the drawable was dropped
+          CFTimeInterval presentedTime = drawable.presentedTime;
+          if (presentedTime > 0.0) {
+              Uint64 displayTimeNS = SDL_GPU_ConvertPresentTime(
+                  (Uint64)(presentedTime * SDL_NS_PER_SECOND),
+                  (Uint64)(CACurrentMediaTime() * SDL_NS_PER_SECOND),
+                  SDL_NS_PER_SECOND);
+              SDL_LockSpinlock(&presentTiming->lock);
+              if (frameID > presentTiming->displayedFrameID) {
+                  presentTiming->displayedFrameID = frameID;
+                  presentTiming->displayTimeNS = displayTimeNS;
+              }
+              SDL_UnlockSpinlock(&presentTiming->lock);
+          }
+          METAL_INTERNAL_ReleasePresentTiming(presentTiming);
+        }];
+    }
+}
+
 static bool METAL_ClaimWindow(
     SDL_GPURenderer *driverData,
     SDL_Window *window)
@@ -3782,12 +4146,39 @@ static void METAL_ReleaseWindow(
         }
         SDL_UnlockMutex(renderer->windowLock);
 
+        if (windowData->presentTiming != NULL) {
+            METAL_INTERNAL_ReleasePresentTiming(windowData->presentTiming);
+        }
+
         SDL_free(windowData);
 
         SDL_ClearProperty(SDL_GetWindowProperties(window), WINDOW_PROPERTY_DATA);
     }
 }
 
+static bool METAL_GetPresentStatistics(
+    SDL_GPURenderer *driverData,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics)
+{
+    MetalWindowData *windowData = METAL_INTERNAL_FetchWindowData(window);
+
+    if (windowData == NULL) {
+        SET_STRING_ERROR_AND_RETURN("Cannot query present statistics from an unclaimed window!", false);
+    }
+
+    statistics->present_count = windowData->presentCount;
+
+    if (windowData->presentTiming != NULL) {
+        SDL_LockSpinlock(&windowData->presentTiming->lock);
+        statistics->displayed_frame_id = windowData->presentTiming->displayedFrameID;
+        statistics->display_time_ns = windowData->presentTiming->displayTimeNS;
+        SDL_UnlockSpinlock(&windowData->presentTiming->lock);
+    }
+
+    return true;
+}
+
 static bool METAL_WaitForSwapchain(
     SDL_GPURenderer *driverData,
     SDL_Window *window)
@@ -4030,8 +4421,10 @@ static bool METAL_Submit(
         // Enqueue present requests, if applicable
         for (Uint32 i = 0; i < metalCommandBuffer->windowDataCount; i += 1) {
             MetalWindowData *windowData = metalCommandBuffer->windowDatas[i];
+            METAL_INTERNAL_TrackPresentTiming(windowData);
             [metalCommandBuffer->handle presentDrawable:windowData->drawable];
             windowData->drawable = nil;
+            windowData->presentCount += 1;
 
             windowData->inFlightFences[windowData->frameCounter] = (SDL_GPUFence *)metalCommandBuffer->fence;
 
@@ -4089,6 +4482,14 @@ static SDL_GPUFence *METAL_SubmitAndAcquireFence(
     return (SDL_GPUFence *)metalCommandBuffer->fence;
 }
 
+static bool METAL_AddWaitFence(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUFence *fence)
+{
+    // There is only one queue, so submissions are already ordered
+    return true;
+}
+
 static bool METAL_Cancel(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -4293,6 +4694,44 @@ static bool METAL_SupportsTextureFormat(
     }
 }
 
+static bool METAL_SupportsSparseTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTextureFormat format,
+    SDL_GPUTextureType type,
+    SDL_GPUTextureUsageFlags usage)
+{
+    @autoreleasepool {
+        MetalRenderer *renderer = (MetalRenderer *)driverData;
+
+        (void)format;
+        (void)type;
+        (void)usage;
+
+        if (@available(macOS 13.0, iOS 16.0, tvOS 16.0, *)) {
+            return [renderer->device supportsFamily:MTLGPUFamilyApple6];
+        }
+        return false;
+    }
+}
+
+static bool METAL_UpdateSparseTileMappings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    const GPU_SparseTileUpdate *updates,
+    Uint32 numUpdates)
+{
+    @autoreleasepool {
+        MetalRenderer *renderer = (MetalRenderer *)driverData;
+        MetalTextureContainer *container = (MetalTextureContainer *)texture;
+
+        return METAL_INTERNAL_UpdateTextureMappings(
+            renderer,
+            container->activeTexture->handle,
+            updates,
+            numUpdates);
+    }
+}
+
 // Device Creation
 
 static bool METAL_PrepareDriver(SDL_VideoDevice *this, SDL_PropertiesID props)
@@ -4602,6 +5041,10 @@ static SDL_GPUDevice *METAL_CreateDevice(bool debugMode, bool preferLowPower, SD
 
         SDL_GPUDevice *result = SDL_calloc(1, sizeof(SDL_GPUDevice));
         ASSIGN_DRIVER(METAL)
+        result->BeginCapture = METAL_BeginCapture;
+        result->EndCapture = METAL_EndCapture;
+        result->SupportsSparseTexture = METAL_SupportsSparseTexture;
+        result->UpdateSparseTileMappings = METAL_UpdateSparseTileMappings;
         result->driverData = (SDL_GPURenderer *)renderer;
         result->shader_formats = SDL_GPU_SHADERFORMAT_MSL | SDL_GPU_SHADERFORMAT_METALLIB;
         renderer->sdlGPUDevice = result;
@@ -33,6 +33,10 @@
 
 #include "../SDL_sysgpu.h"
 
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+#include <time.h>
+#endif
+
 // Global Vulkan Loader Entry Points
 
 static PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = NULL;
@@ -58,6 +62,20 @@ typedef struct VulkanExtensions
     Uint8 KHR_portability_subset;
     // Only required for decoding HDR ASTC textures
     Uint8 EXT_texture_compression_astc_hdr;
+    // Only used for reporting heap budgets in SDL_GetGPUMemoryInfo
+    Uint8 EXT_memory_budget;
+    // Core since 1.2, only used for SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN
+    Uint8 KHR_maintenance3;
+    Uint8 EXT_descriptor_indexing;
+    // Core since 1.2, only used for SDL_DrawGPUPrimitivesIndirectCount
+    Uint8 KHR_draw_indirect_count;
+    // Only used for reporting display times in SDL_GetGPUPresentStatistics
+    Uint8 GOOGLE_display_timing;
+    // Only used for SDL_SetGPUShadingRate, the others are its dependencies (core since 1.1 and 1.2)
+    Uint8 KHR_fragment_shading_rate;
+    Uint8 KHR_create_renderpass2;
+    Uint8 KHR_multiview;
+    Uint8 KHR_maintenance2;
 } VulkanExtensions;
 
 // Defines
@@ -67,6 +85,10 @@ typedef struct VulkanExtensions
 #define LARGE_ALLOCATION_INCREMENT    67108864 // 64  MiB
 #define MAX_UBO_SECTION_SIZE          4096     // 4   KiB
 #define DESCRIPTOR_POOL_SIZE          128
+#define BINDLESS_DESCRIPTOR_SET       4
+#define BINDLESS_MAX_TEXTURES         16384
+#define BINDLESS_MAX_SAMPLERS         2048
+#define BINDLESS_MAX_BUFFERS          16384
 #define WINDOW_PROPERTY_DATA          "SDL_GPUVulkanWindowPropertyData"
 
 #define IDENTITY_SWIZZLE               \
@@ -456,6 +478,8 @@ typedef struct VulkanFenceHandle
 {
     VkFence fence;
     SDL_AtomicInt referenceCount;
+    VkQueue queue;         // the queue the fenced submission went to
+    VkSemaphore semaphore; // signaled alongside the fence for cross-queue waits, or VK_NULL_HANDLE
 } VulkanFenceHandle;
 
 // Memory Allocation
@@ -606,6 +630,7 @@ struct VulkanTexture
     Uint32 containerIndex;
 
     VulkanMemoryUsedRegion *usedRegion;
+    VkDeviceMemory sparseMemory; // tile pool and mip tails, only for sparse textures
 
     VkImage image;
     VkImageView fullView; // used for samplers and storage reads
@@ -707,6 +732,11 @@ typedef struct WindowData
     SDL_GPUFence *inFlightFences[MAX_FRAMES_IN_FLIGHT];
 
     Uint32 frameCounter;
+
+    // Present timing, used as VK_GOOGLE_display_timing present IDs
+    Uint64 presentCount;
+    Uint64 displayedFrameID;
+    Uint64 displayTimeNS;
 } WindowData;
 
 typedef struct SwapchainSupportDetails
@@ -882,6 +912,13 @@ typedef struct VulkanComputePipeline
     SDL_AtomicInt referenceCount;
 } VulkanComputePipeline;
 
+typedef struct VulkanQueryPool
+{
+    QueryPoolCommonHeader header;
+
+    VkQueryPool queryPool;
+} VulkanQueryPool;
+
 typedef struct RenderPassColorTargetDescription
 {
     VkFormat format;
@@ -901,6 +938,7 @@ typedef struct RenderPassDepthStencilTargetDescription
 typedef struct CommandPoolHashTableKey
 {
     SDL_ThreadID threadID;
+    Uint32 queueFamilyIndex;
 } CommandPoolHashTableKey;
 
 typedef struct RenderPassHashTableKey
@@ -957,9 +995,15 @@ typedef struct VulkanCommandBuffer
     Uint32 presentDataCapacity;
 
     VkSemaphore *waitSemaphores;
+    VkPipelineStageFlags *waitStages;
     Uint32 waitSemaphoreCount;
     Uint32 waitSemaphoreCapacity;
 
+    // Fence semaphores taken over from other queues, destroyed when this command buffer completes
+    VkSemaphore *fenceSemaphores;
+    Uint32 fenceSemaphoreCount;
+    Uint32 fenceSemaphoreCapacity;
+
     VkSemaphore *signalSemaphores;
     Uint32 signalSemaphoreCount;
     Uint32 signalSemaphoreCapacity;
@@ -976,6 +1020,19 @@ typedef struct VulkanCommandBuffer
 
     VulkanTextureSubresource *depthStencilAttachmentSubresource; // may be NULL
 
+    // Barriers are batched and recorded right before the next command that needs them
+
+    VkBufferMemoryBarrier *pendingBufferBarriers;
+    Uint32 pendingBufferBarrierCount;
+    Uint32 pendingBufferBarrierCapacity;
+
+    VkImageMemoryBarrier *pendingImageBarriers;
+    Uint32 pendingImageBarrierCount;
+    Uint32 pendingImageBarrierCapacity;
+
+    VkPipelineStageFlags pendingBarrierSrcStages;
+    VkPipelineStageFlags pendingBarrierDstStages;
+
     // Dynamic state
 
     VkViewport currentViewport;
@@ -985,7 +1042,7 @@ typedef struct VulkanCommandBuffer
 
     // Resource bind state
 
-    DescriptorSetCache *descriptorSetCache; // acquired when command buffer is acquired
+    DescriptorSetCache *descriptorSetCache; // acquired the first time the command buffer is acquired
 
     bool needNewVertexResourceDescriptorSet;
     bool needNewVertexUniformDescriptorSet;
@@ -1076,6 +1133,10 @@ typedef struct VulkanCommandBuffer
     Sint32 usedUniformBufferCount;
     Sint32 usedUniformBufferCapacity;
 
+    // Kept between submissions, so recording threads only touch the shared pool when they need more
+    VulkanUniformBuffer **availableUniformBuffers; // up to UNIFORM_BUFFER_CACHE_COUNT
+    Sint32 availableUniformBufferCount;
+
     VulkanFenceHandle *inFlightFence;
     bool autoReleaseFence;
 
@@ -1085,6 +1146,8 @@ typedef struct VulkanCommandBuffer
 struct VulkanCommandPool
 {
     SDL_ThreadID threadID;
+    Uint32 queueFamilyIndex;
+    VkQueue queue;
     VkCommandPool commandPool;
 
     VulkanCommandBuffer **inactiveCommandBuffers;
@@ -1102,6 +1165,7 @@ struct VulkanRenderer
     VkPhysicalDeviceDriverPropertiesKHR physicalDeviceDriverProperties;
     VkPhysicalDeviceFeatures desiredDeviceFeatures;
     VkDevice logicalDevice;
+    VkPipelineCache pipelineCache;
     Uint8 integratedMemoryNotification;
     Uint8 outOfDeviceLocalMemoryWarning;
     Uint8 outofBARMemoryWarning;
@@ -1117,6 +1181,17 @@ struct VulkanRenderer
     bool supportsColorspace;
     bool supportsFillModeNonSolid;
     bool supportsMultiDrawIndirect;
+    bool supportsDrawIndirectCount;
+    bool supportsDisplayTiming;
+    bool supportsSparseResidency;
+    Uint32 supportedShadingRates; // bitmask of 1 << SDL_GPUShadingRate
+
+    // Bindless heap, only created with SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN
+    bool bindlessRequested;
+    Uint32 bindlessCapacity[GPU_BINDLESS_TYPE_COUNT];
+    VkDescriptorSetLayout bindlessDescriptorSetLayout;
+    VkDescriptorPool bindlessDescriptorPool;
+    VkDescriptorSet bindlessDescriptorSet;
 
     VulkanMemoryAllocator *memoryAllocator;
     VkPhysicalDeviceMemoryProperties memoryProperties;
@@ -1129,6 +1204,10 @@ struct VulkanRenderer
     Uint32 queueFamilyIndex;
     VkQueue unifiedQueue;
 
+    // Same as the unified queue if the device has no compute-only queue family
+    Uint32 computeQueueFamilyIndex;
+    VkQueue computeQueue;
+
     VulkanCommandBuffer **submittedCommandBuffers;
     Uint32 submittedCommandBufferCount;
     Uint32 submittedCommandBufferCapacity;
@@ -1146,9 +1225,6 @@ struct VulkanRenderer
     Uint32 uniformBufferPoolCount;
     Uint32 uniformBufferPoolCapacity;
 
-    DescriptorSetCache **descriptorSetCachePool;
-    Uint32 descriptorSetCachePoolCount;
-    Uint32 descriptorSetCachePoolCapacity;
 
     SDL_AtomicInt layoutResourceID;
 
@@ -1217,7 +1293,7 @@ static void VULKAN_ReleaseWindow(SDL_GPURenderer *driverData, SDL_Window *window
 static bool VULKAN_Wait(SDL_GPURenderer *driverData);
 static bool VULKAN_WaitForFences(SDL_GPURenderer *driverData, bool waitAll, SDL_GPUFence *const *fences, Uint32 numFences);
 static bool VULKAN_Submit(SDL_GPUCommandBuffer *commandBuffer);
-static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(SDL_GPURenderer *driverData);
+static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(SDL_GPURenderer *driverData, SDL_GPUQueueType queueType);
 
 // Error Handling
 
@@ -1345,6 +1421,12 @@ static void VULKAN_INTERNAL_MarkAllocationsForDefrag(
     for (memoryType = 0; memoryType < VK_MAX_MEMORY_TYPES; memoryType += 1) {
         currentAllocator = &renderer->memoryAllocator->subAllocators[memoryType];
 
+        // Lazily allocated memory only backs transient targets, there is nothing to compact
+        if (memoryType < renderer->memoryProperties.memoryTypeCount &&
+            (renderer->memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)) {
+            continue;
+        }
+
         for (allocationIndex = 0; allocationIndex < currentAllocator->allocationCount; allocationIndex += 1) {
             if (currentAllocator->allocations[allocationIndex]->availableForAllocation == 1) {
                 if (currentAllocator->allocations[allocationIndex]->freeRegionCount > 1) {
@@ -2134,13 +2216,15 @@ static Uint8 VULKAN_INTERNAL_BindResourceMemory(
 static Uint8 VULKAN_INTERNAL_BindMemoryForImage(
     VulkanRenderer *renderer,
     VkImage image,
+    bool transient,
     VulkanMemoryUsedRegion **usedRegion)
 {
     Uint8 bindResult = 0;
     Uint32 memoryTypeCount = 0;
     Uint32 *memoryTypesToTry = NULL;
     Uint32 selectedMemoryTypeIndex = 0;
-    Uint32 i;
+    Uint32 lazyCount = 0;
+    Uint32 i, j;
     VkMemoryPropertyFlags preferredMemoryPropertyFlags;
     VkMemoryRequirements memoryRequirements;
 
@@ -2161,6 +2245,23 @@ static Uint8 VULKAN_INTERNAL_BindMemoryForImage(
         &memoryRequirements,
         &memoryTypeCount);
 
+    /* Transient attachments should land in lazily allocated memory when the
+     * device has it, so tilers never commit backing storage for them.
+     * Move those types to the front and keep the rest as a fallback.
+     */
+    if (transient) {
+        for (i = 0; i < memoryTypeCount; i += 1) {
+            if (renderer->memoryProperties.memoryTypes[memoryTypesToTry[i]].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) {
+                Uint32 lazyType = memoryTypesToTry[i];
+                for (j = i; j > lazyCount; j -= 1) {
+                    memoryTypesToTry[j] = memoryTypesToTry[j - 1];
+                }
+                memoryTypesToTry[lazyCount] = lazyType;
+                lazyCount += 1;
+            }
+        }
+    }
+
     for (i = 0; i < memoryTypeCount; i += 1) {
         bindResult = VULKAN_INTERNAL_BindResourceMemory(
             renderer,
@@ -2505,9 +2606,132 @@ static void VULKAN_INTERNAL_TrackUniformBuffer(
  * For example, a texture cannot have both the SAMPLER and GRAPHICS_STORAGE usage flags,
  * because then it is impossible for the backend to infer which default usage mode the texture should use.
  *
+ * Barriers are not recorded immediately. They are queued on the command buffer and flushed as a single
+ * vkCmdPipelineBarrier right before the next command that touches resources, so the transitions done
+ * at pass boundaries and bind time collapse into one barrier. A second transition of a resource that
+ * already has one pending flushes first, because barriers in one batch are not ordered.
+ *
  * Sync hazards can be detected by setting VK_KHRONOS_VALIDATION_VALIDATE_SYNC=1 when using validation layers.
  */
 
+static void VULKAN_INTERNAL_FlushBarriers(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer)
+{
+    if (commandBuffer->pendingBufferBarrierCount == 0 && commandBuffer->pendingImageBarrierCount == 0) {
+        return;
+    }
+
+    renderer->vkCmdPipelineBarrier(
+        commandBuffer->commandBuffer,
+        commandBuffer->pendingBarrierSrcStages,
+        commandBuffer->pendingBarrierDstStages,
+        0,
+        0,
+        NULL,
+        commandBuffer->pendingBufferBarrierCount,
+        commandBuffer->pendingBufferBarriers,
+        commandBuffer->pendingImageBarrierCount,
+        commandBuffer->pendingImageBarriers);
+
+    commandBuffer->pendingBufferBarrierCount = 0;
+    commandBuffer->pendingImageBarrierCount = 0;
+    commandBuffer->pendingBarrierSrcStages = 0;
+    commandBuffer->pendingBarrierDstStages = 0;
+}
+
+static void VULKAN_INTERNAL_QueueBufferBarrier(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VkPipelineStageFlags srcStages,
+    VkPipelineStageFlags dstStages,
+    const VkBufferMemoryBarrier *memoryBarrier)
+{
+    for (Uint32 i = 0; i < commandBuffer->pendingBufferBarrierCount; i += 1) {
+        if (commandBuffer->pendingBufferBarriers[i].buffer == memoryBarrier->buffer) {
+            VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+            break;
+        }
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        commandBuffer->pendingBufferBarriers,
+        VkBufferMemoryBarrier,
+        commandBuffer->pendingBufferBarrierCount + 1,
+        commandBuffer->pendingBufferBarrierCapacity,
+        commandBuffer->pendingBufferBarrierCapacity * 2);
+
+    commandBuffer->pendingBufferBarriers[commandBuffer->pendingBufferBarrierCount] = *memoryBarrier;
+    commandBuffer->pendingBufferBarrierCount += 1;
+    commandBuffer->pendingBarrierSrcStages |= srcStages;
+    commandBuffer->pendingBarrierDstStages |= dstStages;
+}
+
+static void VULKAN_INTERNAL_QueueImageBarrier(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VkPipelineStageFlags srcStages,
+    VkPipelineStageFlags dstStages,
+    const VkImageMemoryBarrier *memoryBarrier)
+{
+    for (Uint32 i = 0; i < commandBuffer->pendingImageBarrierCount; i += 1) {
+        const VkImageMemoryBarrier *pending = &commandBuffer->pendingImageBarriers[i];
+        if (pending->image == memoryBarrier->image &&
+            pending->subresourceRange.baseArrayLayer == memoryBarrier->subresourceRange.baseArrayLayer &&
+            pending->subresourceRange.baseMipLevel == memoryBarrier->subresourceRange.baseMipLevel) {
+            VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+            break;
+        }
+    }
+
+    EXPAND_ARRAY_IF_NEEDED(
+        commandBuffer->pendingImageBarriers,
+        VkImageMemoryBarrier,
+        commandBuffer->pendingImageBarrierCount + 1,
+        commandBuffer->pendingImageBarrierCapacity,
+        commandBuffer->pendingImageBarrierCapacity * 2);
+
+    commandBuffer->pendingImageBarriers[commandBuffer->pendingImageBarrierCount] = *memoryBarrier;
+    commandBuffer->pendingImageBarrierCount += 1;
+    commandBuffer->pendingBarrierSrcStages |= srcStages;
+    commandBuffer->pendingBarrierDstStages |= dstStages;
+}
+
+static void VULKAN_INTERNAL_RestrictBarrierToQueue(
+    VulkanRenderer *renderer,
+    VulkanCommandBuffer *commandBuffer,
+    VkPipelineStageFlags *stages,
+    VkAccessFlags *accessMask)
+{
+    const VkPipelineStageFlags graphicsStages =
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+        VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    const VkAccessFlags graphicsAccess =
+        VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+        VK_ACCESS_INDEX_READ_BIT |
+        VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+        VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    if (commandBuffer->commandPool->queueFamilyIndex == renderer->queueFamilyIndex) {
+        return;
+    }
+
+    /* Compute queues can't name graphics stages. The graphics work itself
+     * happened on another queue and is ordered by the fence semaphore, so
+     * all that is left to wait on here is this queue's own work.
+     */
+    if (*stages & graphicsStages) {
+        *stages = (*stages & ~graphicsStages) | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    }
+    *accessMask &= ~graphicsAccess;
+}
+
 static void VULKAN_INTERNAL_BufferMemoryBarrier(
     VulkanRenderer *renderer,
     VulkanCommandBuffer *commandBuffer,
@@ -2587,17 +2811,15 @@ static void VULKAN_INTERNAL_BufferMemoryBarrier(
         return;
     }
 
-    renderer->vkCmdPipelineBarrier(
-        commandBuffer->commandBuffer,
+    VULKAN_INTERNAL_RestrictBarrierToQueue(renderer, commandBuffer, &srcStages, &memoryBarrier.srcAccessMask);
+    VULKAN_INTERNAL_RestrictBarrierToQueue(renderer, commandBuffer, &dstStages, &memoryBarrier.dstAccessMask);
+
+    VULKAN_INTERNAL_QueueBufferBarrier(
+        renderer,
+        commandBuffer,
         srcStages,
         dstStages,
-        0,
-        0,
-        NULL,
-        1,
-        &memoryBarrier,
-        0,
-        NULL);
+        &memoryBarrier);
 
     buffer->transitioned = true;
 }
@@ -2710,16 +2932,14 @@ static void VULKAN_INTERNAL_TextureSubresourceMemoryBarrier(
         return;
     }
 
-    renderer->vkCmdPipelineBarrier(
-        commandBuffer->commandBuffer,
+    VULKAN_INTERNAL_RestrictBarrierToQueue(renderer, commandBuffer, &srcStages, &memoryBarrier.srcAccessMask);
+    VULKAN_INTERNAL_RestrictBarrierToQueue(renderer, commandBuffer, &dstStages, &memoryBarrier.dstAccessMask);
+
+    VULKAN_INTERNAL_QueueImageBarrier(
+        renderer,
+        commandBuffer,
         srcStages,
         dstStages,
-        0,
-        0,
-        NULL,
-        0,
-        NULL,
-        1,
         &memoryBarrier);
 }
 
@@ -3024,6 +3244,13 @@ static void VULKAN_INTERNAL_DestroyTexture(
             texture->usedRegion);
     }
 
+    if (texture->sparseMemory) {
+        renderer->vkFreeMemory(
+            renderer->logicalDevice,
+            texture->sparseMemory,
+            NULL);
+    }
+
     SDL_free(texture);
 }
 
@@ -3043,6 +3270,24 @@ static void VULKAN_INTERNAL_DestroyBuffer(
     SDL_free(buffer);
 }
 
+static void VULKAN_INTERNAL_DestroyDescriptorSetCache(
+    VulkanRenderer *renderer,
+    DescriptorSetCache *descriptorSetCache)
+{
+    for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
+        for (Uint32 j = 0; j < descriptorSetCache->pools[i].poolCount; j += 1) {
+            renderer->vkDestroyDescriptorPool(
+                renderer->logicalDevice,
+                descriptorSetCache->pools[i].descriptorPools[j],
+                NULL);
+        }
+        SDL_free(descriptorSetCache->pools[i].descriptorSets);
+        SDL_free(descriptorSetCache->pools[i].descriptorPools);
+    }
+    SDL_free(descriptorSetCache->pools);
+    SDL_free(descriptorSetCache);
+}
+
 static void VULKAN_INTERNAL_DestroyCommandPool(
     VulkanRenderer *renderer,
     VulkanCommandPool *commandPool)
@@ -3058,8 +3303,24 @@ static void VULKAN_INTERNAL_DestroyCommandPool(
     for (i = 0; i < commandPool->inactiveCommandBufferCount; i += 1) {
         commandBuffer = commandPool->inactiveCommandBuffers[i];
 
+        for (Sint32 j = 0; j < commandBuffer->availableUniformBufferCount; j += 1) {
+            VULKAN_INTERNAL_DestroyBuffer(
+                renderer,
+                commandBuffer->availableUniformBuffers[j]->buffer);
+            SDL_free(commandBuffer->availableUniformBuffers[j]);
+        }
+        SDL_free(commandBuffer->availableUniformBuffers);
+
+        if (commandBuffer->descriptorSetCache != NULL) {
+            VULKAN_INTERNAL_DestroyDescriptorSetCache(
+                renderer,
+                commandBuffer->descriptorSetCache);
+        }
+
         SDL_free(commandBuffer->presentDatas);
         SDL_free(commandBuffer->waitSemaphores);
+        SDL_free(commandBuffer->waitStages);
+        SDL_free(commandBuffer->fenceSemaphores);
         SDL_free(commandBuffer->signalSemaphores);
         SDL_free(commandBuffer->usedBuffers);
         SDL_free(commandBuffer->usedTextures);
@@ -3068,6 +3329,8 @@ static void VULKAN_INTERNAL_DestroyCommandPool(
         SDL_free(commandBuffer->usedComputePipelines);
         SDL_free(commandBuffer->usedFramebuffers);
         SDL_free(commandBuffer->usedUniformBuffers);
+        SDL_free(commandBuffer->pendingBufferBarriers);
+        SDL_free(commandBuffer->pendingImageBarriers);
 
         SDL_free(commandBuffer);
     }
@@ -3249,24 +3512,6 @@ static void VULKAN_INTERNAL_DestroyComputePipelineResourceLayout(
     SDL_free(resourceLayout);
 }
 
-static void VULKAN_INTERNAL_DestroyDescriptorSetCache(
-    VulkanRenderer *renderer,
-    DescriptorSetCache *descriptorSetCache)
-{
-    for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
-        for (Uint32 j = 0; j < descriptorSetCache->pools[i].poolCount; j += 1) {
-            renderer->vkDestroyDescriptorPool(
-                renderer->logicalDevice,
-                descriptorSetCache->pools[i].descriptorPools[j],
-                NULL);
-        }
-        SDL_free(descriptorSetCache->pools[i].descriptorSets);
-        SDL_free(descriptorSetCache->pools[i].descriptorPools);
-    }
-    SDL_free(descriptorSetCache->pools);
-    SDL_free(descriptorSetCache);
-}
-
 // Hashtable functions
 
 static Uint32 SDLCALL VULKAN_INTERNAL_GraphicsPipelineResourceLayoutHashFunction(void *userdata, const void *key)
@@ -3366,14 +3611,15 @@ static void SDLCALL VULKAN_INTERNAL_DescriptorSetLayoutHashDestroy(void *userdat
 
 static Uint32 SDLCALL VULKAN_INTERNAL_CommandPoolHashFunction(void *userdata, const void *key)
 {
-    return (Uint32)((CommandPoolHashTableKey *)key)->threadID;
+    CommandPoolHashTableKey *poolKey = (CommandPoolHashTableKey *)key;
+    return (Uint32)poolKey->threadID ^ (poolKey->queueFamilyIndex * 31);
 }
 
 static bool SDLCALL VULKAN_INTERNAL_CommandPoolHashKeyMatch(void *userdata, const void *aKey, const void *bKey)
 {
     CommandPoolHashTableKey *a = (CommandPoolHashTableKey *)aKey;
     CommandPoolHashTableKey *b = (CommandPoolHashTableKey *)bKey;
-    return a->threadID == b->threadID;
+    return a->threadID == b->threadID && a->queueFamilyIndex == b->queueFamilyIndex;
 }
 
 static void SDLCALL VULKAN_INTERNAL_CommandPoolHashDestroy(void *userdata, const void *key, const void *value)
@@ -3865,7 +4111,7 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     }
 
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
-    VkDescriptorSetLayout descriptorSetLayouts[4];
+    VkDescriptorSetLayout descriptorSetLayouts[5];
     VkResult vulkanResult;
 
     pipelineResourceLayout = SDL_calloc(1, sizeof(VulkanGraphicsPipelineResourceLayout));
@@ -3914,6 +4160,7 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     descriptorSetLayouts[1] = pipelineResourceLayout->descriptorSetLayouts[1]->descriptorSetLayout;
     descriptorSetLayouts[2] = pipelineResourceLayout->descriptorSetLayouts[2]->descriptorSetLayout;
     descriptorSetLayouts[3] = pipelineResourceLayout->descriptorSetLayouts[3]->descriptorSetLayout;
+    descriptorSetLayouts[BINDLESS_DESCRIPTOR_SET] = renderer->bindlessDescriptorSetLayout;
 
     pipelineResourceLayout->vertexSamplerCount = vertexShader->numSamplers;
     pipelineResourceLayout->vertexStorageTextureCount = vertexShader->numStorageTextures;
@@ -3930,7 +4177,7 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 4;
+    pipelineLayoutCreateInfo.setLayoutCount = renderer->bindlessDescriptorSet != VK_NULL_HANDLE ? 5 : 4;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -3984,7 +4231,7 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
         return pipelineResourceLayout;
     }
 
-    VkDescriptorSetLayout descriptorSetLayouts[3];
+    VkDescriptorSetLayout descriptorSetLayouts[5];
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
     VkResult vulkanResult;
 
@@ -4024,6 +4271,20 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
     descriptorSetLayouts[1] = pipelineResourceLayout->descriptorSetLayouts[1]->descriptorSetLayout;
     descriptorSetLayouts[2] = pipelineResourceLayout->descriptorSetLayouts[2]->descriptorSetLayout;
 
+    // Pad with an empty set so that the bindless heap is at the same set index as for graphics
+    if (renderer->bindlessDescriptorSet != VK_NULL_HANDLE) {
+        descriptorSetLayouts[3] = VULKAN_INTERNAL_FetchDescriptorSetLayout(
+            renderer,
+            VK_SHADER_STAGE_COMPUTE_BIT,
+            0,
+            0,
+            0,
+            0,
+            0,
+            0)->descriptorSetLayout;
+        descriptorSetLayouts[BINDLESS_DESCRIPTOR_SET] = renderer->bindlessDescriptorSetLayout;
+    }
+
     pipelineResourceLayout->numSamplers = createinfo->num_samplers;
     pipelineResourceLayout->numReadonlyStorageTextures = createinfo->num_readonly_storage_textures;
     pipelineResourceLayout->numReadonlyStorageBuffers = createinfo->num_readonly_storage_buffers;
@@ -4036,7 +4297,7 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 3;
+    pipelineLayoutCreateInfo.setLayoutCount = renderer->bindlessDescriptorSet != VK_NULL_HANDLE ? 5 : 3;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -4079,6 +4340,7 @@ static VulkanBuffer *VULKAN_INTERNAL_CreateBuffer(
     VkResult vulkanResult;
     VkBufferCreateInfo createinfo;
     VkBufferUsageFlags vulkanUsageFlags = 0;
+    Uint32 queueFamilyIndices[2];
     Uint8 bindResult;
 
     if (usageFlags & SDL_GPU_BUFFERUSAGE_VERTEX) {
@@ -4119,9 +4381,18 @@ static VulkanBuffer *VULKAN_INTERNAL_CreateBuffer(
     createinfo.flags = 0;
     createinfo.size = size;
     createinfo.usage = vulkanUsageFlags;
-    createinfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    createinfo.queueFamilyIndexCount = 1;
-    createinfo.pQueueFamilyIndices = &renderer->queueFamilyIndex;
+    if (renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex) {
+        // Lets the async compute queue use the buffer without ownership transfers
+        queueFamilyIndices[0] = renderer->queueFamilyIndex;
+        queueFamilyIndices[1] = renderer->computeQueueFamilyIndex;
+        createinfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        createinfo.queueFamilyIndexCount = 2;
+        createinfo.pQueueFamilyIndices = queueFamilyIndices;
+    } else {
+        createinfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        createinfo.queueFamilyIndexCount = 1;
+        createinfo.pQueueFamilyIndices = &renderer->queueFamilyIndex;
+    }
 
     // Set transfer bits so we can defrag
     createinfo.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
@@ -4855,6 +5126,8 @@ static bool VULKAN_INTERNAL_EndCommandBuffer(
     VulkanRenderer *renderer,
     VulkanCommandBuffer *commandBuffer)
 {
+    VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
+
     VkResult result = renderer->vkEndCommandBuffer(
         commandBuffer->commandBuffer);
 
@@ -4889,13 +5162,6 @@ static void VULKAN_DestroyDevice(
     }
     SDL_free(renderer->uniformBufferPool);
 
-    for (Uint32 i = 0; i < renderer->descriptorSetCachePoolCount; i += 1) {
-        VULKAN_INTERNAL_DestroyDescriptorSetCache(
-            renderer,
-            renderer->descriptorSetCachePool[i]);
-    }
-    SDL_free(renderer->descriptorSetCachePool);
-
     for (Uint32 i = 0; i < renderer->fencePool.availableFenceCount; i += 1) {
         renderer->vkDestroyFence(
             renderer->logicalDevice,
@@ -4915,6 +5181,19 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyHashTable(renderer->computePipelineResourceLayoutHashTable);
     SDL_DestroyHashTable(renderer->descriptorSetLayoutHashTable);
 
+    if (renderer->bindlessDescriptorPool != VK_NULL_HANDLE) {
+        renderer->vkDestroyDescriptorPool(
+            renderer->logicalDevice,
+            renderer->bindlessDescriptorPool,
+            NULL);
+    }
+    if (renderer->bindlessDescriptorSetLayout != VK_NULL_HANDLE) {
+        renderer->vkDestroyDescriptorSetLayout(
+            renderer->logicalDevice,
+            renderer->bindlessDescriptorSetLayout,
+            NULL);
+    }
+
     for (Uint32 i = 0; i < VK_MAX_MEMORY_TYPES; i += 1) {
         allocator = &renderer->memoryAllocator->subAllocators[i];
 
@@ -4961,6 +5240,10 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->descriptorSetLayoutFetchLock);
     SDL_DestroyMutex(renderer->windowLock);
 
+    if (renderer->pipelineCache != VK_NULL_HANDLE) {
+        renderer->vkDestroyPipelineCache(renderer->logicalDevice, renderer->pipelineCache, NULL);
+    }
+
     renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
     renderer->vkDestroyInstance(renderer->instance, NULL);
 
@@ -4978,37 +5261,117 @@ static SDL_PropertiesID VULKAN_GetDeviceProperties(
     return renderer->props;
 }
 
-static DescriptorSetCache *VULKAN_INTERNAL_AcquireDescriptorSetCache(
-    VulkanRenderer *renderer)
+static void *VULKAN_GetPipelineCacheData(
+    SDL_GPUDevice *device,
+    size_t *size)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)device->driverData;
+    VkResult vulkanResult;
+    size_t dataSize = 0;
+    void *data;
+
+    if (renderer->pipelineCache == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache is not available", NULL);
+    }
+
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &dataSize,
+        NULL);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+
+    data = SDL_malloc(dataSize);
+    if (!data) {
+        return NULL;
+    }
+
+    // VK_INCOMPLETE only means the cache grew in between, the data up to dataSize is still valid
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &dataSize,
+        data);
+    if (vulkanResult != VK_SUCCESS && vulkanResult != VK_INCOMPLETE) {
+        SDL_free(data);
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+    }
+
+    *size = dataSize;
+    return data;
+}
+
+static SDL_GPUMemoryInfo *VULKAN_GetMemoryInfo(
+    SDL_GPUDevice *device,
+    int *count)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)device->driverData;
+    VkPhysicalDeviceMemoryProperties2KHR memoryProperties;
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties;
+    SDL_GPUMemoryInfo *result;
+    Uint32 heapCount = renderer->memoryProperties.memoryHeapCount;
+    Uint32 i, j;
+
+    result = (SDL_GPUMemoryInfo *)SDL_calloc(heapCount, sizeof(SDL_GPUMemoryInfo));
+    if (!result) {
+        return NULL;
+    }
+
+    if (renderer->supports.EXT_memory_budget) {
+        SDL_zero(budgetProperties);
+        budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        memoryProperties.pNext = &budgetProperties;
+
+        renderer->vkGetPhysicalDeviceMemoryProperties2KHR(
+            renderer->physicalDevice,
+            &memoryProperties);
+    }
+
+    for (i = 0; i < heapCount; i += 1) {
+        const VkMemoryHeap *heap = &renderer->memoryProperties.memoryHeaps[i];
+
+        result[i].device_local = (heap->flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+        if (renderer->supports.EXT_memory_budget) {
+            result[i].budget = budgetProperties.heapBudget[i];
+            result[i].usage = budgetProperties.heapUsage[i];
+        } else {
+            // Without the extension the best estimate of the budget is the whole heap
+            result[i].budget = heap->size;
+        }
+    }
+
+    SDL_LockMutex(renderer->allocatorLock);
+    for (i = 0; i < renderer->memoryProperties.memoryTypeCount; i += 1) {
+        VulkanMemorySubAllocator *allocator = &renderer->memoryAllocator->subAllocators[i];
+        Uint32 heapIndex = renderer->memoryProperties.memoryTypes[i].heapIndex;
+
+        for (j = 0; j < allocator->allocationCount; j += 1) {
+            result[heapIndex].allocated += allocator->allocations[j]->size;
+        }
+    }
+    SDL_UnlockMutex(renderer->allocatorLock);
+
+    *count = (int)heapCount;
+    return result;
+}
+
+static DescriptorSetCache *VULKAN_INTERNAL_CreateDescriptorSetCache(void)
 {
-    DescriptorSetCache *cache;
+    DescriptorSetCache *cache = SDL_malloc(sizeof(DescriptorSetCache));
 
-    if (renderer->descriptorSetCachePoolCount == 0) {
-        cache = SDL_malloc(sizeof(DescriptorSetCache));
+    if (cache != NULL) {
         cache->poolCount = 0;
         cache->pools = NULL;
-    } else {
-        cache = renderer->descriptorSetCachePool[renderer->descriptorSetCachePoolCount - 1];
-        renderer->descriptorSetCachePoolCount -= 1;
     }
 
     return cache;
 }
 
-static void VULKAN_INTERNAL_ReturnDescriptorSetCacheToPool(
-    VulkanRenderer *renderer,
+static void VULKAN_INTERNAL_ResetDescriptorSetCache(
     DescriptorSetCache *descriptorSetCache)
 {
-    EXPAND_ARRAY_IF_NEEDED(
-        renderer->descriptorSetCachePool,
-        DescriptorSetCache *,
-        renderer->descriptorSetCachePoolCount + 1,
-        renderer->descriptorSetCachePoolCapacity,
-        renderer->descriptorSetCachePoolCapacity * 2);
-
-    renderer->descriptorSetCachePool[renderer->descriptorSetCachePoolCount] = descriptorSetCache;
-    renderer->descriptorSetCachePoolCount += 1;
-
     for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
         descriptorSetCache->pools[i].descriptorSetIndex = 0;
     }
@@ -5475,6 +5838,74 @@ static void VULKAN_DrawIndexedPrimitivesIndirect(
     VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
 }
 
+static void VULKAN_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer *)buffer)->activeBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer *)countBuffer)->activeBuffer;
+
+    if (!renderer->supportsDrawIndirectCount) {
+        // Without the extension every slot is drawn, unused ones should have zero instances
+        VULKAN_DrawPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+        return;
+    }
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offset,
+        vulkanCountBuffer->buffer,
+        countOffset,
+        maxDrawCount,
+        sizeof(SDL_GPUIndirectDrawCommand));
+
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanCountBuffer);
+}
+
+static void VULKAN_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer *)buffer)->activeBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer *)countBuffer)->activeBuffer;
+
+    if (!renderer->supportsDrawIndirectCount) {
+        // Without the extension every slot is drawn, unused ones should have zero instances
+        VULKAN_DrawIndexedPrimitivesIndirect(commandBuffer, buffer, offset, maxDrawCount);
+        return;
+    }
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndexedIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offset,
+        vulkanCountBuffer->buffer,
+        countOffset,
+        maxDrawCount,
+        sizeof(SDL_GPUIndexedIndirectDrawCommand));
+
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanCountBuffer);
+}
+
 // Debug Naming
 
 static void VULKAN_INTERNAL_SetBufferName(
@@ -5586,6 +6017,7 @@ static void VULKAN_InsertDebugLabel(
         labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
         labelInfo.pLabelName = text;
 
+        VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
         renderer->vkCmdInsertDebugUtilsLabelEXT(
             vulkanCommandBuffer->commandBuffer,
             &labelInfo);
@@ -5605,6 +6037,7 @@ static void VULKAN_PushDebugGroup(
         labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
         labelInfo.pLabelName = name;
 
+        VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
         renderer->vkCmdBeginDebugUtilsLabelEXT(
             vulkanCommandBuffer->commandBuffer,
             &labelInfo);
@@ -5618,23 +6051,242 @@ static void VULKAN_PopDebugGroup(
     VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
 
     if (renderer->supportsDebugUtils) {
+        VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
         renderer->vkCmdEndDebugUtilsLabelEXT(vulkanCommandBuffer->commandBuffer);
     }
 }
 
-static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
-    VulkanRenderer *renderer,
-    bool transitionToDefaultLayout,
-    const SDL_GPUTextureCreateInfo *createinfo)
+static void VULKAN_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 index)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanQueryPool *vulkanQueryPool = (VulkanQueryPool *)queryPool;
+
+    // Queries have to be reset before every write, and this is always outside of a render pass
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+    renderer->vkCmdResetQueryPool(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanQueryPool->queryPool,
+        index,
+        1);
+
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+    renderer->vkCmdWriteTimestamp(
+        vulkanCommandBuffer->commandBuffer,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        vulkanQueryPool->queryPool,
+        index);
+}
+
+static bool VULKAN_INTERNAL_BindSparse(
+    VulkanRenderer *renderer,
+    const VkBindSparseInfo *bindInfo)
+{
+    VkFenceCreateInfo fenceCreateInfo;
+    VkFence fence;
+    VkResult vulkanResult;
+
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fenceCreateInfo.pNext = NULL;
+    fenceCreateInfo.flags = 0;
+
+    vulkanResult = renderer->vkCreateFence(
+        renderer->logicalDevice,
+        &fenceCreateInfo,
+        NULL,
+        &fence);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateFence, false);
+
+    SDL_LockMutex(renderer->submitLock);
+    vulkanResult = renderer->vkQueueBindSparse(
+        renderer->unifiedQueue,
+        1,
+        bindInfo,
+        fence);
+    SDL_UnlockMutex(renderer->submitLock);
+
+    if (vulkanResult == VK_SUCCESS) {
+        // Work submitted after this returns has to see the new bindings
+        vulkanResult = renderer->vkWaitForFences(
+            renderer->logicalDevice,
+            1,
+            &fence,
+            VK_TRUE,
+            SDL_MAX_UINT64);
+    }
+
+    renderer->vkDestroyFence(
+        renderer->logicalDevice,
+        fence,
+        NULL);
+
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkQueueBindSparse, false);
+    return true;
+}
+
+// Allocates the tile pool and binds the mip tails, which stay resident for the life of the texture
+static bool VULKAN_INTERNAL_AllocateSparseTexture(
+    VulkanRenderer *renderer,
+    VulkanTexture *texture,
+    const SDL_GPUTextureCreateInfo *createinfo,
+    GPU_SparseTileMap **sparseMap)
+{
+    VkMemoryRequirements memoryRequirements;
+    VkSparseImageMemoryRequirements *sparseRequirements;
+    VkSparseImageMemoryRequirements *colorRequirements = NULL;
+    VkSparseMemoryBind *tailBinds;
+    Uint32 numTailBinds = 0;
+    Uint32 sparseRequirementCount = 0;
+    VkDeviceSize tileSize;
+    VkDeviceSize memorySize;
+    VkMemoryAllocateInfo allocateInfo;
+    Uint32 *memoryTypesToTry;
+    Uint32 memoryTypeCount = 0;
+    VkResult vulkanResult = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    GPU_SparseTileMap *map;
+    bool result = false;
+
+    renderer->vkGetImageMemoryRequirements(
+        renderer->logicalDevice,
+        texture->image,
+        &memoryRequirements);
+    tileSize = memoryRequirements.alignment;
+
+    renderer->vkGetImageSparseMemoryRequirements(
+        renderer->logicalDevice,
+        texture->image,
+        &sparseRequirementCount,
+        NULL);
+    sparseRequirements = SDL_stack_alloc(VkSparseImageMemoryRequirements, SDL_max(sparseRequirementCount, 1));
+    renderer->vkGetImageSparseMemoryRequirements(
+        renderer->logicalDevice,
+        texture->image,
+        &sparseRequirementCount,
+        sparseRequirements);
+
+    for (Uint32 i = 0; i < sparseRequirementCount; i += 1) {
+        if (sparseRequirements[i].formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) {
+            colorRequirements = &sparseRequirements[i];
+        }
+    }
+    if (colorRequirements == NULL) {
+        SDL_stack_free(sparseRequirements);
+        SET_STRING_ERROR_AND_RETURN("Texture has no sparse color aspect!", false);
+    }
+
+    map = SDL_GPU_CreateSparseTileMap(
+        createinfo,
+        colorRequirements->formatProperties.imageGranularity.width,
+        colorRequirements->formatProperties.imageGranularity.height,
+        (Uint32)tileSize,
+        colorRequirements->imageMipTailFirstLod);
+    if (map == NULL) {
+        SDL_stack_free(sparseRequirements);
+        return false;
+    }
+
+    // The tile pool comes first, followed by one mip tail per layer (or a single one) for each aspect
+    tailBinds = SDL_stack_alloc(VkSparseMemoryBind, sparseRequirementCount * createinfo->layer_count_or_depth + 1);
+    memorySize = (VkDeviceSize)map->numSlots * tileSize;
+    for (Uint32 i = 0; i < sparseRequirementCount; i += 1) {
+        const VkSparseImageMemoryRequirements *requirements = &sparseRequirements[i];
+        bool singleTail = (requirements->formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        Uint32 numTails = singleTail ? 1 : createinfo->layer_count_or_depth;
+
+        if (requirements->imageMipTailFirstLod >= createinfo->num_levels && !(requirements->formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT)) {
+            continue;
+        }
+
+        for (Uint32 tail = 0; tail < numTails; tail += 1) {
+            VkSparseMemoryBind *bind = &tailBinds[numTailBinds++];
+            bind->resourceOffset = requirements->imageMipTailOffset + tail * requirements->imageMipTailStride;
+            bind->size = requirements->imageMipTailSize;
+            bind->memory = VK_NULL_HANDLE;
+            bind->memoryOffset = memorySize;
+            bind->flags = (requirements->formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) ? VK_SPARSE_MEMORY_BIND_METADATA_BIT : 0;
+            memorySize += (requirements->imageMipTailSize + tileSize - 1) / tileSize * tileSize;
+        }
+    }
+    SDL_stack_free(sparseRequirements);
+
+    memoryTypesToTry = VULKAN_INTERNAL_FindBestMemoryTypes(
+        renderer,
+        memoryRequirements.memoryTypeBits,
+        0,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        0,
+        &memoryTypeCount);
+
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.pNext = NULL;
+    allocateInfo.allocationSize = SDL_max(memorySize, tileSize);
+    for (Uint32 i = 0; i < memoryTypeCount; i += 1) {
+        allocateInfo.memoryTypeIndex = memoryTypesToTry[i];
+        vulkanResult = renderer->vkAllocateMemory(
+            renderer->logicalDevice,
+            &allocateInfo,
+            NULL,
+            &texture->sparseMemory);
+        if (vulkanResult == VK_SUCCESS) {
+            break;
+        }
+    }
+    SDL_free(memoryTypesToTry);
+
+    if (vulkanResult != VK_SUCCESS) {
+        texture->sparseMemory = VK_NULL_HANDLE;
+        SDL_SetError("Unable to allocate memory for sparse texture!");
+    } else if (numTailBinds > 0) {
+        VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+        VkBindSparseInfo bindInfo;
+
+        for (Uint32 i = 0; i < numTailBinds; i += 1) {
+            tailBinds[i].memory = texture->sparseMemory;
+        }
+
+        opaqueBindInfo.image = texture->image;
+        opaqueBindInfo.bindCount = numTailBinds;
+        opaqueBindInfo.pBinds = tailBinds;
+
+        SDL_zero(bindInfo);
+        bindInfo.sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindInfo.imageOpaqueBindCount = 1;
+        bindInfo.pImageOpaqueBinds = &opaqueBindInfo;
+
+        result = VULKAN_INTERNAL_BindSparse(renderer, &bindInfo);
+    } else {
+        result = true;
+    }
+    SDL_stack_free(tailBinds);
+
+    if (!result) {
+        SDL_GPU_DestroySparseTileMap(map);
+        return false;
+    }
+
+    *sparseMap = map;
+    return true;
+}
+
+static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
+    VulkanRenderer *renderer,
+    bool transitionToDefaultLayout,
+    const SDL_GPUTextureCreateInfo *createinfo,
+    GPU_SparseTileMap **sparseMap) // non-NULL to honor SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN
 {
     VkResult vulkanResult;
     VkImageCreateInfo imageCreateInfo;
     VkImageCreateFlags imageCreateFlags = 0;
     VkImageViewCreateInfo imageViewCreateInfo;
+    Uint32 queueFamilyIndices[2];
     Uint8 bindResult;
     VkImageUsageFlags vkUsageFlags = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
     Uint32 layerCount = (createinfo->type == SDL_GPU_TEXTURETYPE_3D) ? 1 : createinfo->layer_count_or_depth;
     Uint32 depth = (createinfo->type == SDL_GPU_TEXTURETYPE_3D) ? createinfo->layer_count_or_depth : 1;
+    bool sparse = sparseMap != NULL && SDL_GetBooleanProperty(createinfo->props, SDL_PROP_GPU_TEXTURE_CREATE_SPARSE_BOOLEAN, false);
 
     VulkanTexture *texture = SDL_calloc(1, sizeof(VulkanTexture));
     texture->swizzle = SwizzleForSDLFormat(createinfo->format);
@@ -5658,6 +6310,10 @@ static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
         imageCreateFlags |= VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT;
     }
 
+    if (sparse) {
+        imageCreateFlags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    }
+
     if (createinfo->usage & (SDL_GPU_TEXTUREUSAGE_SAMPLER |
                              SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ |
                              SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ)) {
@@ -5673,6 +6329,11 @@ static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
                              SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE)) {
         vkUsageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
     }
+    if (createinfo->usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+        // Transient attachments may not have any usage outside of render passes
+        vkUsageFlags &= ~(VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+        vkUsageFlags |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    }
 
     imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     imageCreateInfo.pNext = NULL;
@@ -5687,9 +6348,18 @@ static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
     imageCreateInfo.samples = SDLToVK_SampleCount[createinfo->sample_count];
     imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
     imageCreateInfo.usage = vkUsageFlags;
-    imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    imageCreateInfo.queueFamilyIndexCount = 0;
-    imageCreateInfo.pQueueFamilyIndices = NULL;
+    if (renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex) {
+        // Lets the async compute queue use the image without ownership transfers
+        queueFamilyIndices[0] = renderer->queueFamilyIndex;
+        queueFamilyIndices[1] = renderer->computeQueueFamilyIndex;
+        imageCreateInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        imageCreateInfo.queueFamilyIndexCount = 2;
+        imageCreateInfo.pQueueFamilyIndices = queueFamilyIndices;
+    } else {
+        imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageCreateInfo.queueFamilyIndexCount = 0;
+        imageCreateInfo.pQueueFamilyIndices = NULL;
+    }
     imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
     vulkanResult = renderer->vkCreateImage(
@@ -5703,22 +6373,31 @@ static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
         CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateImage, NULL);
     }
 
-    bindResult = VULKAN_INTERNAL_BindMemoryForImage(
-        renderer,
-        texture->image,
-        &texture->usedRegion);
-
-    if (bindResult != 1) {
-        renderer->vkDestroyImage(
-            renderer->logicalDevice,
+    if (sparse) {
+        // Sparse images stay out of the allocator, so defrag never moves them
+        if (!VULKAN_INTERNAL_AllocateSparseTexture(renderer, texture, createinfo, sparseMap)) {
+            VULKAN_INTERNAL_DestroyTexture(renderer, texture);
+            return NULL;
+        }
+    } else {
+        bindResult = VULKAN_INTERNAL_BindMemoryForImage(
+            renderer,
             texture->image,
-            NULL);
+            (createinfo->usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) != 0,
+            &texture->usedRegion);
 
-        VULKAN_INTERNAL_DestroyTexture(renderer, texture);
-        SET_STRING_ERROR_AND_RETURN("Unable to bind memory for texture!", NULL);
-    }
+        if (bindResult != 1) {
+            renderer->vkDestroyImage(
+                renderer->logicalDevice,
+                texture->image,
+                NULL);
+
+            VULKAN_INTERNAL_DestroyTexture(renderer, texture);
+            SET_STRING_ERROR_AND_RETURN("Unable to bind memory for texture!", NULL);
+        }
 
-    texture->usedRegion->vulkanTexture = texture; // lol
+        texture->usedRegion->vulkanTexture = texture; // lol
+    }
 
     if (createinfo->usage & (SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ)) {
 
@@ -5854,7 +6533,7 @@ static VulkanTexture *VULKAN_INTERNAL_CreateTexture(
 
     if (transitionToDefaultLayout) {
         // Let's transition to the default barrier state, because for some reason Vulkan doesn't let us do that with initialLayout.
-        VulkanCommandBuffer *barrierCommandBuffer = (VulkanCommandBuffer *)VULKAN_AcquireCommandBuffer((SDL_GPURenderer *)renderer);
+        VulkanCommandBuffer *barrierCommandBuffer = (VulkanCommandBuffer *)VULKAN_AcquireCommandBuffer((SDL_GPURenderer *)renderer, SDL_GPU_QUEUETYPE_GRAPHICS);
         VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
             renderer,
             barrierCommandBuffer,
@@ -5931,7 +6610,8 @@ static void VULKAN_INTERNAL_CycleActiveTexture(
     texture = VULKAN_INTERNAL_CreateTexture(
         renderer,
         false,
-        &container->header.info);
+        &container->header.info,
+        NULL);
 
     VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
         renderer,
@@ -6268,7 +6948,8 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
         VK_DYNAMIC_STATE_VIEWPORT,
         VK_DYNAMIC_STATE_SCISSOR,
         VK_DYNAMIC_STATE_BLEND_CONSTANTS,
-        VK_DYNAMIC_STATE_STENCIL_REFERENCE
+        VK_DYNAMIC_STATE_STENCIL_REFERENCE,
+        VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR
     };
     VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
 
@@ -6286,7 +6967,8 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     dynamicStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     dynamicStateCreateInfo.pNext = NULL;
     dynamicStateCreateInfo.flags = 0;
-    dynamicStateCreateInfo.dynamicStateCount = SDL_arraysize(dynamicStates);
+    // The shading rate is only dynamic state when the device enabled the feature
+    dynamicStateCreateInfo.dynamicStateCount = SDL_arraysize(dynamicStates) - (renderer->supportedShadingRates != 0 ? 0 : 1);
     dynamicStateCreateInfo.pDynamicStates = dynamicStates;
 
     // Shader stages
@@ -6515,10 +7197,9 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     vkPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     vkPipelineCreateInfo.basePipelineIndex = 0;
 
-    // TODO: enable pipeline caching
     vulkanResult = renderer->vkCreateGraphicsPipelines(
         renderer->logicalDevice,
-        VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkPipelineCreateInfo,
         NULL,
@@ -6653,7 +7334,7 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
 
     vulkanResult = renderer->vkCreateComputePipelines(
         renderer->logicalDevice,
-        (VkPipelineCache)VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkShaderCreateInfo,
         NULL,
@@ -6826,11 +7507,13 @@ static SDL_GPUTexture *VULKAN_CreateTexture(
     VulkanRenderer *renderer = (VulkanRenderer *)driverData;
     VulkanTexture *texture;
     VulkanTextureContainer *container;
+    GPU_SparseTileMap *sparseMap = NULL;
 
     texture = VULKAN_INTERNAL_CreateTexture(
         renderer,
         true,
-        createinfo);
+        createinfo,
+        &sparseMap);
 
     if (texture == NULL) {
         return NULL;
@@ -6845,7 +7528,8 @@ static SDL_GPUTexture *VULKAN_CreateTexture(
         SDL_CopyProperties(createinfo->props, container->header.info.props);
     }
 
-    container->canBeCycled = true;
+    container->header.sparse = sparseMap;
+    container->canBeCycled = sparseMap == NULL; // tile mappings belong to a single image
     container->activeTexture = texture;
     container->textureCapacity = 1;
     container->textureCount = 1;
@@ -6915,6 +7599,47 @@ static SDL_GPUTransferBuffer *VULKAN_CreateTransferBuffer(
         debugName);
 }
 
+static SDL_GPUQueryPool *VULKAN_CreateQueryPool(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUQueryPoolCreateInfo *createinfo)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VkQueryPoolCreateInfo queryPoolCreateInfo;
+    VulkanQueryPool *vulkanQueryPool;
+    VkResult vulkanResult;
+
+    // timestampComputeAndGraphics guarantees support on the queue we render with
+    if (!renderer->physicalDeviceProperties.properties.limits.timestampComputeAndGraphics) {
+        SET_STRING_ERROR_AND_RETURN("Timestamp queries are not supported by this device", NULL);
+    }
+
+    vulkanQueryPool = SDL_calloc(1, sizeof(VulkanQueryPool));
+    if (!vulkanQueryPool) {
+        return NULL;
+    }
+    vulkanQueryPool->header.type = createinfo->type;
+    vulkanQueryPool->header.numQueries = createinfo->num_queries;
+
+    queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolCreateInfo.pNext = NULL;
+    queryPoolCreateInfo.flags = 0;
+    queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolCreateInfo.queryCount = createinfo->num_queries;
+    queryPoolCreateInfo.pipelineStatistics = 0;
+
+    vulkanResult = renderer->vkCreateQueryPool(
+        renderer->logicalDevice,
+        &queryPoolCreateInfo,
+        NULL,
+        &vulkanQueryPool->queryPool);
+    if (vulkanResult != VK_SUCCESS) {
+        SDL_free(vulkanQueryPool);
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateQueryPool, NULL);
+    }
+
+    return (SDL_GPUQueryPool *)vulkanQueryPool;
+}
+
 static void VULKAN_INTERNAL_ReleaseTexture(
     VulkanRenderer *renderer,
     VulkanTexture *vulkanTexture)
@@ -6958,6 +7683,7 @@ static void VULKAN_ReleaseTexture(
     if (vulkanTextureContainer->debugName != NULL) {
         SDL_free(vulkanTextureContainer->debugName);
     }
+    SDL_GPU_DestroySparseTileMap(vulkanTextureContainer->header.sparse);
     SDL_free(vulkanTextureContainer->textures);
     SDL_free(vulkanTextureContainer);
 
@@ -7103,6 +7829,79 @@ static void VULKAN_ReleaseComputePipeline(
     SDL_UnlockMutex(renderer->disposeLock);
 }
 
+static void VULKAN_ReleaseQueryPool(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanQueryPool *vulkanQueryPool = (VulkanQueryPool *)queryPool;
+
+    // Query pools aren't tracked by command buffers, so make sure none are using it
+    VULKAN_Wait(driverData);
+
+    renderer->vkDestroyQueryPool(
+        renderer->logicalDevice,
+        vulkanQueryPool->queryPool,
+        NULL);
+    SDL_free(vulkanQueryPool);
+}
+
+static bool VULKAN_WriteBindlessDescriptor(
+    SDL_GPURenderer *driverData,
+    GPU_BindlessType type,
+    Uint32 index,
+    void *resource)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VkWriteDescriptorSet writeDescriptorSet;
+    VkDescriptorImageInfo imageInfo;
+    VkDescriptorBufferInfo bufferInfo;
+
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.pNext = NULL;
+    writeDescriptorSet.dstSet = renderer->bindlessDescriptorSet;
+    writeDescriptorSet.dstBinding = (Uint32)type;
+    writeDescriptorSet.dstArrayElement = index;
+    writeDescriptorSet.descriptorCount = 1;
+    writeDescriptorSet.pImageInfo = NULL;
+    writeDescriptorSet.pBufferInfo = NULL;
+    writeDescriptorSet.pTexelBufferView = NULL;
+
+    switch (type) {
+    case GPU_BINDLESS_TEXTURE:
+        imageInfo.sampler = VK_NULL_HANDLE;
+        imageInfo.imageView = ((VulkanTextureContainer *)resource)->activeTexture->fullView;
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        writeDescriptorSet.pImageInfo = &imageInfo;
+        break;
+    case GPU_BINDLESS_SAMPLER:
+        imageInfo.sampler = ((VulkanSampler *)resource)->sampler;
+        imageInfo.imageView = VK_NULL_HANDLE;
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+        writeDescriptorSet.pImageInfo = &imageInfo;
+        break;
+    case GPU_BINDLESS_BUFFER:
+        bufferInfo.buffer = ((VulkanBufferContainer *)resource)->activeBuffer->buffer;
+        bufferInfo.offset = 0;
+        bufferInfo.range = VK_WHOLE_SIZE;
+        writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writeDescriptorSet.pBufferInfo = &bufferInfo;
+        break;
+    default:
+        return SDL_InvalidParamError("type");
+    }
+
+    renderer->vkUpdateDescriptorSets(
+        renderer->logicalDevice,
+        1,
+        &writeDescriptorSet,
+        0,
+        NULL);
+    return true;
+}
+
 static void VULKAN_ReleaseGraphicsPipeline(
     SDL_GPURenderer *driverData,
     SDL_GPUGraphicsPipeline *graphicsPipeline)
@@ -7476,6 +8275,37 @@ static void VULKAN_SetStencilReference(
         reference);
 }
 
+static bool VULKAN_SupportsShadingRate(
+    SDL_GPURenderer *driverData,
+    SDL_GPUShadingRate rate)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+
+    return (renderer->supportedShadingRates & (1u << rate)) != 0;
+}
+
+static void VULKAN_SetShadingRate(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUShadingRate rate)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VkExtent2D fragmentSize;
+    VkFragmentShadingRateCombinerOpKHR combinerOps[2] = {
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR
+    };
+
+    // The enum packs log2 of the width and height into two bits each
+    fragmentSize.width = 1u << (rate >> 2);
+    fragmentSize.height = 1u << (rate & 0x3);
+
+    renderer->vkCmdSetFragmentShadingRateKHR(
+        vulkanCommandBuffer->commandBuffer,
+        &fragmentSize,
+        combinerOps);
+}
+
 static void VULKAN_BindVertexSamplers(
     SDL_GPUCommandBuffer *commandBuffer,
     Uint32 firstSlot,
@@ -7636,18 +8466,23 @@ static VulkanUniformBuffer *VULKAN_INTERNAL_AcquireUniformBufferFromPool(
     VulkanRenderer *renderer = commandBuffer->renderer;
     VulkanUniformBuffer *uniformBuffer;
 
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
-
-    if (renderer->uniformBufferPoolCount > 0) {
-        uniformBuffer = renderer->uniformBufferPool[renderer->uniformBufferPoolCount - 1];
-        renderer->uniformBufferPoolCount -= 1;
+    if (commandBuffer->availableUniformBufferCount > 0) {
+        uniformBuffer = commandBuffer->availableUniformBuffers[commandBuffer->availableUniformBufferCount - 1];
+        commandBuffer->availableUniformBufferCount -= 1;
     } else {
-        uniformBuffer = VULKAN_INTERNAL_CreateUniformBuffer(
-            renderer,
-            UNIFORM_BUFFER_SIZE);
-    }
+        SDL_LockMutex(renderer->acquireUniformBufferLock);
+
+        if (renderer->uniformBufferPoolCount > 0) {
+            uniformBuffer = renderer->uniformBufferPool[renderer->uniformBufferPoolCount - 1];
+            renderer->uniformBufferPoolCount -= 1;
+        } else {
+            uniformBuffer = VULKAN_INTERNAL_CreateUniformBuffer(
+                renderer,
+                UNIFORM_BUFFER_SIZE);
+        }
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+        SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+    }
 
     VULKAN_INTERNAL_TrackUniformBuffer(commandBuffer, uniformBuffer);
 
@@ -7927,6 +8762,7 @@ static void VULKAN_BeginRenderPass(
     renderPassBeginInfo.renderArea.offset.x = 0;
     renderPassBeginInfo.renderArea.offset.y = 0;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdBeginRenderPass(
         vulkanCommandBuffer->commandBuffer,
         &renderPassBeginInfo,
@@ -7968,6 +8804,12 @@ static void VULKAN_BeginRenderPass(
     VULKAN_INTERNAL_SetCurrentStencilReference(
         vulkanCommandBuffer,
         0);
+
+    if (renderer->supportedShadingRates != 0) {
+        VULKAN_SetShadingRate(
+            commandBuffer,
+            SDL_GPU_SHADINGRATE_1X1);
+    }
 }
 
 static void VULKAN_BindGraphicsPipeline(
@@ -7987,6 +8829,19 @@ static void VULKAN_BindGraphicsPipeline(
 
     VULKAN_INTERNAL_TrackGraphicsPipeline(vulkanCommandBuffer, pipeline);
 
+    // The bindless set is never rebound by draws, so this stays valid for the whole pipeline
+    if (renderer->bindlessDescriptorSet != VK_NULL_HANDLE) {
+        renderer->vkCmdBindDescriptorSets(
+            vulkanCommandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            pipeline->resourceLayout->pipelineLayout,
+            BINDLESS_DESCRIPTOR_SET,
+            1,
+            &renderer->bindlessDescriptorSet,
+            0,
+            NULL);
+    }
+
     // Acquire uniform buffers if necessary
     for (Uint32 i = 0; i < pipeline->resourceLayout->vertexUniformBufferCount; i += 1) {
         if (vulkanCommandBuffer->vertexUniformBuffers[i] == NULL) {
@@ -8217,6 +9072,18 @@ static void VULKAN_BindComputePipeline(
 
     VULKAN_INTERNAL_TrackComputePipeline(vulkanCommandBuffer, vulkanComputePipeline);
 
+    if (renderer->bindlessDescriptorSet != VK_NULL_HANDLE) {
+        renderer->vkCmdBindDescriptorSets(
+            vulkanCommandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_COMPUTE,
+            vulkanComputePipeline->resourceLayout->pipelineLayout,
+            BINDLESS_DESCRIPTOR_SET,
+            1,
+            &renderer->bindlessDescriptorSet,
+            0,
+            NULL);
+    }
+
     // Acquire uniform buffers if necessary
     for (Uint32 i = 0; i < vulkanComputePipeline->resourceLayout->numUniformBuffers; i += 1) {
         if (vulkanCommandBuffer->computeUniformBuffers[i] == NULL) {
@@ -8606,6 +9473,7 @@ static void VULKAN_DispatchCompute(
 
     VULKAN_INTERNAL_BindComputeDescriptorSets(renderer, vulkanCommandBuffer);
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdDispatch(
         vulkanCommandBuffer->commandBuffer,
         groupcountX,
@@ -8624,6 +9492,7 @@ static void VULKAN_DispatchComputeIndirect(
 
     VULKAN_INTERNAL_BindComputeDescriptorSets(renderer, vulkanCommandBuffer);
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdDispatchIndirect(
         vulkanCommandBuffer->commandBuffer,
         vulkanBuffer->buffer,
@@ -8775,6 +9644,7 @@ static void VULKAN_UploadToTexture(
     imageCopy.bufferRowLength = source->pixels_per_row;
     imageCopy.bufferImageHeight = source->rows_per_layer;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyBufferToImage(
         vulkanCommandBuffer->commandBuffer,
         transferBufferContainer->activeBuffer->buffer,
@@ -8818,6 +9688,7 @@ static void VULKAN_UploadToBuffer(
     bufferCopy.dstOffset = destination->offset;
     bufferCopy.size = destination->size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         transferBufferContainer->activeBuffer->buffer,
@@ -8875,6 +9746,7 @@ static void VULKAN_DownloadFromTexture(
     imageCopy.bufferRowLength = destination->pixels_per_row;
     imageCopy.bufferImageHeight = destination->rows_per_layer;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyImageToBuffer(
         vulkanCommandBuffer->commandBuffer,
         vulkanTextureSubresource->parent->image,
@@ -8916,6 +9788,7 @@ static void VULKAN_DownloadFromBuffer(
     bufferCopy.dstOffset = destination->offset;
     bufferCopy.size = source->size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         bufferContainer->activeBuffer->buffer,
@@ -8986,6 +9859,7 @@ static void VULKAN_CopyTextureToTexture(
     imageCopy.extent.height = h;
     imageCopy.extent.depth = d;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyImage(
         vulkanCommandBuffer->commandBuffer,
         srcSubresource->parent->image,
@@ -9041,6 +9915,7 @@ static void VULKAN_CopyBufferToBuffer(
     bufferCopy.dstOffset = destination->offset;
     bufferCopy.size = size;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdCopyBuffer(
         vulkanCommandBuffer->commandBuffer,
         srcContainer->activeBuffer->buffer,
@@ -9131,6 +10006,7 @@ static void VULKAN_GenerateMipmaps(
             blit.dstSubresource.layerCount = 1;
             blit.dstSubresource.mipLevel = level;
 
+            VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
             renderer->vkCmdBlitImage(
                 vulkanCommandBuffer->commandBuffer,
                 container->activeTexture->image,
@@ -9165,32 +10041,51 @@ static void VULKAN_EndCopyPass(
     (void)commandBuffer;
 }
 
-static void VULKAN_Blit(
-    SDL_GPUCommandBuffer *commandBuffer,
+// Blits between the same two subresources with the same filter share one vkCmdBlitImage
+static bool VULKAN_INTERNAL_BlitCanJoinRun(
+    const SDL_GPUBlitInfo *first,
     const SDL_GPUBlitInfo *info)
+{
+    return info->load_op != SDL_GPU_LOADOP_CLEAR &&
+           !info->cycle &&
+           info->filter == first->filter &&
+           info->source.texture == first->source.texture &&
+           info->source.mip_level == first->source.mip_level &&
+           info->source.layer_or_depth_plane == first->source.layer_or_depth_plane &&
+           info->destination.texture == first->destination.texture &&
+           info->destination.mip_level == first->destination.mip_level &&
+           info->destination.layer_or_depth_plane == first->destination.layer_or_depth_plane;
+}
+
+static void VULKAN_INTERNAL_BlitRun(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits)
 {
     VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
     VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
-    TextureCommonHeader *srcHeader = (TextureCommonHeader *)info->source.texture;
-    TextureCommonHeader *dstHeader = (TextureCommonHeader *)info->destination.texture;
-    VkImageBlit region;
-    Uint32 srcLayer = srcHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? 0 : info->source.layer_or_depth_plane;
-    Uint32 srcDepth = srcHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? info->source.layer_or_depth_plane : 0;
-    Uint32 dstLayer = dstHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? 0 : info->destination.layer_or_depth_plane;
-    Uint32 dstDepth = dstHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? info->destination.layer_or_depth_plane : 0;
+    const SDL_GPUBlitInfo *first = &infos[0];
+    TextureCommonHeader *srcHeader = (TextureCommonHeader *)first->source.texture;
+    TextureCommonHeader *dstHeader = (TextureCommonHeader *)first->destination.texture;
+    VkImageBlit regions[16];
+    Uint32 regionCount = 0;
+    Uint32 srcLayer = srcHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? 0 : first->source.layer_or_depth_plane;
+    Uint32 srcDepth = srcHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? first->source.layer_or_depth_plane : 0;
+    Uint32 dstLayer = dstHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? 0 : first->destination.layer_or_depth_plane;
+    Uint32 dstDepth = dstHeader->info.type == SDL_GPU_TEXTURETYPE_3D ? first->destination.layer_or_depth_plane : 0;
     int32_t swap;
 
     // Using BeginRenderPass to clear because vkCmdClearColorImage requires barriers anyway
-    if (info->load_op == SDL_GPU_LOADOP_CLEAR) {
+    if (first->load_op == SDL_GPU_LOADOP_CLEAR) {
         SDL_GPUColorTargetInfo targetInfo;
         SDL_zero(targetInfo);
-        targetInfo.texture = info->destination.texture;
-        targetInfo.mip_level = info->destination.mip_level;
-        targetInfo.layer_or_depth_plane = info->destination.layer_or_depth_plane;
+        targetInfo.texture = first->destination.texture;
+        targetInfo.mip_level = first->destination.mip_level;
+        targetInfo.layer_or_depth_plane = first->destination.layer_or_depth_plane;
         targetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
         targetInfo.store_op = SDL_GPU_STOREOP_STORE;
-        targetInfo.clear_color = info->clear_color;
-        targetInfo.cycle = info->cycle;
+        targetInfo.clear_color = first->clear_color;
+        targetInfo.cycle = first->cycle;
         VULKAN_BeginRenderPass(
             commandBuffer,
             &targetInfo,
@@ -9200,17 +10095,17 @@ static void VULKAN_Blit(
     }
 
     VulkanTextureSubresource *srcSubresource = VULKAN_INTERNAL_FetchTextureSubresource(
-        (VulkanTextureContainer *)info->source.texture,
+        (VulkanTextureContainer *)first->source.texture,
         srcLayer,
-        info->source.mip_level);
+        first->source.mip_level);
 
     VulkanTextureSubresource *dstSubresource = VULKAN_INTERNAL_PrepareTextureSubresourceForWrite(
         renderer,
         vulkanCommandBuffer,
-        (VulkanTextureContainer *)info->destination.texture,
+        (VulkanTextureContainer *)first->destination.texture,
         dstLayer,
-        info->destination.mip_level,
-        info->cycle,
+        first->destination.mip_level,
+        first->cycle,
         VULKAN_TEXTURE_USAGE_MODE_COPY_DESTINATION);
 
     VULKAN_INTERNAL_TextureSubresourceTransitionFromDefaultUsage(
@@ -9219,51 +10114,61 @@ static void VULKAN_Blit(
         VULKAN_TEXTURE_USAGE_MODE_COPY_SOURCE,
         srcSubresource);
 
-    region.srcSubresource.aspectMask = srcSubresource->parent->aspectFlags;
-    region.srcSubresource.baseArrayLayer = srcSubresource->layer;
-    region.srcSubresource.layerCount = 1;
-    region.srcSubresource.mipLevel = srcSubresource->level;
-    region.srcOffsets[0].x = info->source.x;
-    region.srcOffsets[0].y = info->source.y;
-    region.srcOffsets[0].z = srcDepth;
-    region.srcOffsets[1].x = info->source.x + info->source.w;
-    region.srcOffsets[1].y = info->source.y + info->source.h;
-    region.srcOffsets[1].z = srcDepth + 1;
-
-    if (info->flip_mode & SDL_FLIP_HORIZONTAL) {
-        // flip the x positions
-        swap = region.srcOffsets[0].x;
-        region.srcOffsets[0].x = region.srcOffsets[1].x;
-        region.srcOffsets[1].x = swap;
-    }
-
-    if (info->flip_mode & SDL_FLIP_VERTICAL) {
-        // flip the y positions
-        swap = region.srcOffsets[0].y;
-        region.srcOffsets[0].y = region.srcOffsets[1].y;
-        region.srcOffsets[1].y = swap;
-    }
-
-    region.dstSubresource.aspectMask = dstSubresource->parent->aspectFlags;
-    region.dstSubresource.baseArrayLayer = dstSubresource->layer;
-    region.dstSubresource.layerCount = 1;
-    region.dstSubresource.mipLevel = dstSubresource->level;
-    region.dstOffsets[0].x = info->destination.x;
-    region.dstOffsets[0].y = info->destination.y;
-    region.dstOffsets[0].z = dstDepth;
-    region.dstOffsets[1].x = info->destination.x + info->destination.w;
-    region.dstOffsets[1].y = info->destination.y + info->destination.h;
-    region.dstOffsets[1].z = dstDepth + 1;
-
-    renderer->vkCmdBlitImage(
-        vulkanCommandBuffer->commandBuffer,
-        srcSubresource->parent->image,
-        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-        dstSubresource->parent->image,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &region,
-        SDLToVK_Filter[info->filter]);
+    for (Uint32 i = 0; i < numBlits; i += 1) {
+        const SDL_GPUBlitInfo *info = &infos[i];
+        VkImageBlit *region = &regions[regionCount];
+
+        region->srcSubresource.aspectMask = srcSubresource->parent->aspectFlags;
+        region->srcSubresource.baseArrayLayer = srcSubresource->layer;
+        region->srcSubresource.layerCount = 1;
+        region->srcSubresource.mipLevel = srcSubresource->level;
+        region->srcOffsets[0].x = info->source.x;
+        region->srcOffsets[0].y = info->source.y;
+        region->srcOffsets[0].z = srcDepth;
+        region->srcOffsets[1].x = info->source.x + info->source.w;
+        region->srcOffsets[1].y = info->source.y + info->source.h;
+        region->srcOffsets[1].z = srcDepth + 1;
+
+        if (info->flip_mode & SDL_FLIP_HORIZONTAL) {
+            // flip the x positions
+            swap = region->srcOffsets[0].x;
+            region->srcOffsets[0].x = region->srcOffsets[1].x;
+            region->srcOffsets[1].x = swap;
+        }
+
+        if (info->flip_mode & SDL_FLIP_VERTICAL) {
+            // flip the y positions
+            swap = region->srcOffsets[0].y;
+            region->srcOffsets[0].y = region->srcOffsets[1].y;
+            region->srcOffsets[1].y = swap;
+        }
+
+        region->dstSubresource.aspectMask = dstSubresource->parent->aspectFlags;
+        region->dstSubresource.baseArrayLayer = dstSubresource->layer;
+        region->dstSubresource.layerCount = 1;
+        region->dstSubresource.mipLevel = dstSubresource->level;
+        region->dstOffsets[0].x = info->destination.x;
+        region->dstOffsets[0].y = info->destination.y;
+        region->dstOffsets[0].z = dstDepth;
+        region->dstOffsets[1].x = info->destination.x + info->destination.w;
+        region->dstOffsets[1].y = info->destination.y + info->destination.h;
+        region->dstOffsets[1].z = dstDepth + 1;
+
+        regionCount += 1;
+        if (regionCount == SDL_arraysize(regions) || i == numBlits - 1) {
+            VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
+            renderer->vkCmdBlitImage(
+                vulkanCommandBuffer->commandBuffer,
+                srcSubresource->parent->image,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                dstSubresource->parent->image,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                regionCount,
+                regions,
+                SDLToVK_Filter[first->filter]);
+            regionCount = 0;
+        }
+    }
 
     VULKAN_INTERNAL_TextureSubresourceTransitionToDefaultUsage(
         renderer,
@@ -9281,6 +10186,30 @@ static void VULKAN_Blit(
     VULKAN_INTERNAL_TrackTexture(vulkanCommandBuffer, dstSubresource->parent);
 }
 
+static void VULKAN_Blit(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *info)
+{
+    VULKAN_INTERNAL_BlitRun(commandBuffer, info, 1);
+}
+
+static void VULKAN_BlitTextures(
+    SDL_GPUCommandBuffer *commandBuffer,
+    const SDL_GPUBlitInfo *infos,
+    Uint32 numBlits)
+{
+    Uint32 i = 0;
+
+    while (i < numBlits) {
+        Uint32 runLength = 1;
+        while (i + runLength < numBlits && VULKAN_INTERNAL_BlitCanJoinRun(&infos[i], &infos[i + runLength])) {
+            runLength += 1;
+        }
+        VULKAN_INTERNAL_BlitRun(commandBuffer, &infos[i], runLength);
+        i += runLength;
+    }
+}
+
 static bool VULKAN_INTERNAL_AllocateCommandBuffer(
     VulkanRenderer *renderer,
     VulkanCommandPool *vulkanCommandPool)
@@ -9328,6 +10257,12 @@ static bool VULKAN_INTERNAL_AllocateCommandBuffer(
     commandBuffer->waitSemaphoreCount = 0;
     commandBuffer->waitSemaphores = SDL_malloc(
         commandBuffer->waitSemaphoreCapacity * sizeof(VkSemaphore));
+    commandBuffer->waitStages = SDL_malloc(
+        commandBuffer->waitSemaphoreCapacity * sizeof(VkPipelineStageFlags));
+
+    commandBuffer->fenceSemaphoreCapacity = 0;
+    commandBuffer->fenceSemaphoreCount = 0;
+    commandBuffer->fenceSemaphores = NULL;
 
     commandBuffer->signalSemaphoreCapacity = 1;
     commandBuffer->signalSemaphoreCount = 0;
@@ -9395,6 +10330,27 @@ static bool VULKAN_INTERNAL_AllocateCommandBuffer(
     commandBuffer->usedUniformBuffers = SDL_malloc(
         commandBuffer->usedUniformBufferCapacity * sizeof(VulkanUniformBuffer *));
 
+    commandBuffer->availableUniformBufferCount = 0;
+    commandBuffer->availableUniformBuffers = SDL_malloc(
+        UNIFORM_BUFFER_CACHE_COUNT * sizeof(VulkanUniformBuffer *));
+
+    commandBuffer->descriptorSetCache = NULL;
+
+    // Pending barriers
+
+    commandBuffer->pendingBufferBarrierCapacity = 16;
+    commandBuffer->pendingBufferBarrierCount = 0;
+    commandBuffer->pendingBufferBarriers = SDL_malloc(
+        commandBuffer->pendingBufferBarrierCapacity * sizeof(VkBufferMemoryBarrier));
+
+    commandBuffer->pendingImageBarrierCapacity = 16;
+    commandBuffer->pendingImageBarrierCount = 0;
+    commandBuffer->pendingImageBarriers = SDL_malloc(
+        commandBuffer->pendingImageBarrierCapacity * sizeof(VkImageMemoryBarrier));
+
+    commandBuffer->pendingBarrierSrcStages = 0;
+    commandBuffer->pendingBarrierDstStages = 0;
+
     // Pool it!
 
     vulkanCommandPool->inactiveCommandBuffers[vulkanCommandPool->inactiveCommandBufferCount] = commandBuffer;
@@ -9405,13 +10361,15 @@ static bool VULKAN_INTERNAL_AllocateCommandBuffer(
 
 static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
     VulkanRenderer *renderer,
-    SDL_ThreadID threadID)
+    SDL_ThreadID threadID,
+    Uint32 queueFamilyIndex)
 {
     VulkanCommandPool *vulkanCommandPool = NULL;
     VkCommandPoolCreateInfo commandPoolCreateInfo;
     VkResult vulkanResult;
     CommandPoolHashTableKey key;
     key.threadID = threadID;
+    key.queueFamilyIndex = queueFamilyIndex;
 
     bool result = SDL_FindInHashTable(
         renderer->commandPoolHashTable,
@@ -9427,7 +10385,7 @@ static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
     commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
     commandPoolCreateInfo.pNext = NULL;
     commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    commandPoolCreateInfo.queueFamilyIndex = renderer->queueFamilyIndex;
+    commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
 
     vulkanResult = renderer->vkCreateCommandPool(
         renderer->logicalDevice,
@@ -9442,6 +10400,8 @@ static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
     }
 
     vulkanCommandPool->threadID = threadID;
+    vulkanCommandPool->queueFamilyIndex = queueFamilyIndex;
+    vulkanCommandPool->queue = queueFamilyIndex == renderer->queueFamilyIndex ? renderer->unifiedQueue : renderer->computeQueue;
 
     vulkanCommandPool->inactiveCommandBufferCapacity = 0;
     vulkanCommandPool->inactiveCommandBufferCount = 0;
@@ -9456,6 +10416,7 @@ static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
 
     CommandPoolHashTableKey *allocedKey = SDL_malloc(sizeof(CommandPoolHashTableKey));
     allocedKey->threadID = threadID;
+    allocedKey->queueFamilyIndex = queueFamilyIndex;
 
     SDL_InsertIntoHashTable(
         renderer->commandPoolHashTable,
@@ -9467,10 +10428,11 @@ static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
 
 static VulkanCommandBuffer *VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
     VulkanRenderer *renderer,
-    SDL_ThreadID threadID)
+    SDL_ThreadID threadID,
+    Uint32 queueFamilyIndex)
 {
     VulkanCommandPool *commandPool =
-        VULKAN_INTERNAL_FetchCommandPool(renderer, threadID);
+        VULKAN_INTERNAL_FetchCommandPool(renderer, threadID, queueFamilyIndex);
     VulkanCommandBuffer *commandBuffer;
 
     if (commandPool == NULL) {
@@ -9492,7 +10454,8 @@ static VulkanCommandBuffer *VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
 }
 
 static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(
-    SDL_GPURenderer *driverData)
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueueType queueType)
 {
     VulkanRenderer *renderer = (VulkanRenderer *)driverData;
     VkResult result;
@@ -9500,12 +10463,13 @@ static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(
 
     SDL_ThreadID threadID = SDL_GetCurrentThreadID();
 
+    // Copy work goes to the compute queue too, it supports transfers and avoids a third queue to synchronize
+    Uint32 queueFamilyIndex = queueType == SDL_GPU_QUEUETYPE_GRAPHICS ? renderer->queueFamilyIndex : renderer->computeQueueFamilyIndex;
+
     SDL_LockMutex(renderer->acquireCommandBufferLock);
 
     VulkanCommandBuffer *commandBuffer =
-        VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(renderer, threadID);
-
-    commandBuffer->descriptorSetCache = VULKAN_INTERNAL_AcquireDescriptorSetCache(renderer);
+        VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(renderer, threadID, queueFamilyIndex);
 
     SDL_UnlockMutex(renderer->acquireCommandBufferLock);
 
@@ -9513,6 +10477,11 @@ static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(
         return NULL;
     }
 
+    // The descriptor set cache stays with the command buffer, which belongs to this thread's pool
+    if (commandBuffer->descriptorSetCache == NULL) {
+        commandBuffer->descriptorSetCache = VULKAN_INTERNAL_CreateDescriptorSetCache();
+    }
+
     // Reset state
 
     commandBuffer->currentComputePipeline = NULL;
@@ -9619,7 +10588,16 @@ static void VULKAN_INTERNAL_ReturnFenceToPool(
     VulkanRenderer *renderer,
     VulkanFenceHandle *fenceHandle)
 {
-    SDL_LockMutex(renderer->fencePool.lock);
+    // Nobody waited on the semaphore, but the fence has signaled so it is no longer in use
+    if (fenceHandle->semaphore != VK_NULL_HANDLE) {
+        renderer->vkDestroySemaphore(
+            renderer->logicalDevice,
+            fenceHandle->semaphore,
+            NULL);
+        fenceHandle->semaphore = VK_NULL_HANDLE;
+    }
+
+    SDL_LockMutex(renderer->fencePool.lock);
 
     EXPAND_ARRAY_IF_NEEDED(
         renderer->fencePool.availableFences,
@@ -9645,6 +10623,40 @@ static void VULKAN_ReleaseFence(
     }
 }
 
+static bool VULKAN_GetQueryPoolResults(
+    SDL_GPURenderer *driverData,
+    SDL_GPUQueryPool *queryPool,
+    Uint32 firstQuery,
+    Uint32 numQueries,
+    Uint64 *results)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanQueryPool *vulkanQueryPool = (VulkanQueryPool *)queryPool;
+    double timestampPeriod = (double)renderer->physicalDeviceProperties.properties.limits.timestampPeriod;
+    VkResult vulkanResult;
+
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        vulkanQueryPool->queryPool,
+        firstQuery,
+        numQueries,
+        numQueries * sizeof(Uint64),
+        results,
+        sizeof(Uint64),
+        VK_QUERY_RESULT_64_BIT);
+    if (vulkanResult == VK_NOT_READY) {
+        SET_STRING_ERROR_AND_RETURN("Query results are not available yet", false);
+    }
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetQueryPoolResults, false);
+
+    // Timestamps are in ticks of timestampPeriod nanoseconds
+    for (Uint32 i = 0; i < numQueries; i += 1) {
+        results[i] = (Uint64)((double)results[i] * timestampPeriod);
+    }
+
+    return true;
+}
+
 static WindowData *VULKAN_INTERNAL_FetchWindowData(
     SDL_Window *window)
 {
@@ -9896,6 +10908,98 @@ static bool VULKAN_WaitForSwapchain(
     return true;
 }
 
+static Uint64 VULKAN_INTERNAL_GetPresentClockNS(void)
+{
+    // VK_GOOGLE_display_timing reports times in the CLOCK_MONOTONIC domain where it is implemented
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+    struct timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0) {
+        return ((Uint64)now.tv_sec * SDL_NS_PER_SECOND) + (Uint64)now.tv_nsec;
+    }
+#endif
+    return 0;
+}
+
+static bool VULKAN_GetPresentStatistics(
+    SDL_GPURenderer *driverData,
+    SDL_Window *window,
+    SDL_GPUPresentStatistics *statistics)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    WindowData *windowData = VULKAN_INTERNAL_FetchWindowData(window);
+    VkPastPresentationTimingGOOGLE timings[8];
+    VkRefreshCycleDurationGOOGLE refreshCycle;
+    Uint32 timingCount;
+    VkResult vulkanResult;
+
+    if (windowData == NULL) {
+        SET_STRING_ERROR_AND_RETURN("Cannot query present statistics from an unclaimed window!", false);
+    }
+
+    if (renderer->supportsDisplayTiming && windowData->swapchain != VK_NULL_HANDLE) {
+        Uint64 now = VULKAN_INTERNAL_GetPresentClockNS();
+
+        // Drain every timing record that became available since the last query
+        do {
+            timingCount = SDL_arraysize(timings);
+            vulkanResult = renderer->vkGetPastPresentationTimingGOOGLE(
+                renderer->logicalDevice,
+                windowData->swapchain,
+                &timingCount,
+                timings);
+            if (vulkanResult != VK_SUCCESS && vulkanResult != VK_INCOMPLETE) {
+                break;
+            }
+
+            for (Uint32 i = 0; i < timingCount; i += 1) {
+                // Present IDs are the low 32 bits of the present count
+                Uint64 frameID = windowData->presentCount - (Uint32)((Uint32)windowData->presentCount - timings[i].presentID);
+                if (frameID > windowData->displayedFrameID) {
+                    windowData->displayedFrameID = frameID;
+                    windowData->displayTimeNS = SDL_GPU_ConvertPresentTime(
+                        timings[i].actualPresentTime,
+                        now,
+                        SDL_NS_PER_SECOND);
+                }
+            }
+        } while (vulkanResult == VK_INCOMPLETE);
+
+        vulkanResult = renderer->vkGetRefreshCycleDurationGOOGLE(
+            renderer->logicalDevice,
+            windowData->swapchain,
+            &refreshCycle);
+        if (vulkanResult == VK_SUCCESS) {
+            statistics->refresh_interval_ns = refreshCycle.refreshDuration;
+        }
+    }
+
+    statistics->present_count = windowData->presentCount;
+    statistics->displayed_frame_id = windowData->displayedFrameID;
+    statistics->display_time_ns = windowData->displayTimeNS;
+
+    return true;
+}
+
+static void VULKAN_INTERNAL_AddWaitSemaphore(
+    VulkanCommandBuffer *commandBuffer,
+    VkSemaphore semaphore,
+    VkPipelineStageFlags waitStage)
+{
+    if (commandBuffer->waitSemaphoreCount == commandBuffer->waitSemaphoreCapacity) {
+        commandBuffer->waitSemaphoreCapacity += 1;
+        commandBuffer->waitSemaphores = SDL_realloc(
+            commandBuffer->waitSemaphores,
+            commandBuffer->waitSemaphoreCapacity * sizeof(VkSemaphore));
+        commandBuffer->waitStages = SDL_realloc(
+            commandBuffer->waitStages,
+            commandBuffer->waitSemaphoreCapacity * sizeof(VkPipelineStageFlags));
+    }
+
+    commandBuffer->waitSemaphores[commandBuffer->waitSemaphoreCount] = semaphore;
+    commandBuffer->waitStages[commandBuffer->waitSemaphoreCount] = waitStage;
+    commandBuffer->waitSemaphoreCount += 1;
+}
+
 static bool VULKAN_INTERNAL_AcquireSwapchainTexture(
     bool block,
     SDL_GPUCommandBuffer *commandBuffer,
@@ -10020,6 +11124,7 @@ static bool VULKAN_INTERNAL_AcquireSwapchainTexture(
     imageBarrier.subresourceRange.baseArrayLayer = 0;
     imageBarrier.subresourceRange.layerCount = 1;
 
+    VULKAN_INTERNAL_FlushBarriers(renderer, vulkanCommandBuffer);
     renderer->vkCmdPipelineBarrier(
         vulkanCommandBuffer->commandBuffer,
         VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
@@ -10049,16 +11154,10 @@ static bool VULKAN_INTERNAL_AcquireSwapchainTexture(
 
     // Set up present semaphores
 
-    if (vulkanCommandBuffer->waitSemaphoreCount == vulkanCommandBuffer->waitSemaphoreCapacity) {
-        vulkanCommandBuffer->waitSemaphoreCapacity += 1;
-        vulkanCommandBuffer->waitSemaphores = SDL_realloc(
-            vulkanCommandBuffer->waitSemaphores,
-            vulkanCommandBuffer->waitSemaphoreCapacity * sizeof(VkSemaphore));
-    }
-
-    vulkanCommandBuffer->waitSemaphores[vulkanCommandBuffer->waitSemaphoreCount] =
-        windowData->imageAvailableSemaphore[windowData->frameCounter];
-    vulkanCommandBuffer->waitSemaphoreCount += 1;
+    VULKAN_INTERNAL_AddWaitSemaphore(
+        vulkanCommandBuffer,
+        windowData->imageAvailableSemaphore[windowData->frameCounter],
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
 
     if (vulkanCommandBuffer->signalSemaphoreCount == vulkanCommandBuffer->signalSemaphoreCapacity) {
         vulkanCommandBuffer->signalSemaphoreCapacity += 1;
@@ -10209,6 +11308,8 @@ static VulkanFenceHandle *VULKAN_INTERNAL_AcquireFenceFromPool(
         handle = SDL_malloc(sizeof(VulkanFenceHandle));
         handle->fence = fence;
         SDL_SetAtomicInt(&handle->referenceCount, 0);
+        handle->queue = VK_NULL_HANDLE;
+        handle->semaphore = VK_NULL_HANDLE;
         return handle;
     }
 
@@ -10327,19 +11428,30 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
         commandBuffer->inFlightFence = NULL;
     }
 
-    // Uniform buffers are now available
+    // Uniform buffers are now available, this command buffer keeps a few and the rest go back to the pool
 
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
+    Sint32 uniformBufferIndex;
+    for (uniformBufferIndex = 0; uniformBufferIndex < commandBuffer->usedUniformBufferCount && commandBuffer->availableUniformBufferCount < UNIFORM_BUFFER_CACHE_COUNT; uniformBufferIndex += 1) {
+        VulkanUniformBuffer *uniformBuffer = commandBuffer->usedUniformBuffers[uniformBufferIndex];
+        uniformBuffer->writeOffset = 0;
+        uniformBuffer->drawOffset = 0;
+        commandBuffer->availableUniformBuffers[commandBuffer->availableUniformBufferCount] = uniformBuffer;
+        commandBuffer->availableUniformBufferCount += 1;
+    }
 
-    for (Sint32 i = 0; i < commandBuffer->usedUniformBufferCount; i += 1) {
-        VULKAN_INTERNAL_ReturnUniformBufferToPool(
-            renderer,
-            commandBuffer->usedUniformBuffers[i]);
+    if (uniformBufferIndex < commandBuffer->usedUniformBufferCount) {
+        SDL_LockMutex(renderer->acquireUniformBufferLock);
+
+        for (; uniformBufferIndex < commandBuffer->usedUniformBufferCount; uniformBufferIndex += 1) {
+            VULKAN_INTERNAL_ReturnUniformBufferToPool(
+                renderer,
+                commandBuffer->usedUniformBuffers[uniformBufferIndex]);
+        }
+
+        SDL_UnlockMutex(renderer->acquireUniformBufferLock);
     }
     commandBuffer->usedUniformBufferCount = 0;
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
-
     // Decrement reference counts
 
     for (Sint32 i = 0; i < commandBuffer->usedBufferCount; i += 1) {
@@ -10378,12 +11490,34 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     commandBuffer->waitSemaphoreCount = 0;
     commandBuffer->signalSemaphoreCount = 0;
 
+    // Cancelled command buffers may still have barriers queued
+    commandBuffer->pendingBufferBarrierCount = 0;
+    commandBuffer->pendingImageBarrierCount = 0;
+    commandBuffer->pendingBarrierSrcStages = 0;
+    commandBuffer->pendingBarrierDstStages = 0;
+
+    // Destroy the fence semaphores this command buffer waited on
+
+    for (Uint32 i = 0; i < commandBuffer->fenceSemaphoreCount; i += 1) {
+        renderer->vkDestroySemaphore(
+            renderer->logicalDevice,
+            commandBuffer->fenceSemaphores[i],
+            NULL);
+    }
+    commandBuffer->fenceSemaphoreCount = 0;
+
     // Reset defrag state
 
     if (commandBuffer->isDefrag) {
         renderer->defragInProgress = 0;
     }
 
+    // Descriptor sets can be rewritten now that the GPU is done with them
+
+    if (commandBuffer->descriptorSetCache != NULL) {
+        VULKAN_INTERNAL_ResetDescriptorSetCache(commandBuffer->descriptorSetCache);
+    }
+
     // Return command buffer to pool
 
     SDL_LockMutex(renderer->acquireCommandBufferLock);
@@ -10398,14 +11532,6 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     commandBuffer->commandPool->inactiveCommandBuffers[commandBuffer->commandPool->inactiveCommandBufferCount] = commandBuffer;
     commandBuffer->commandPool->inactiveCommandBufferCount += 1;
 
-    // Release descriptor set cache
-
-    VULKAN_INTERNAL_ReturnDescriptorSetCacheToPool(
-        renderer,
-        commandBuffer->descriptorSetCache);
-
-    commandBuffer->descriptorSetCache = NULL;
-
     SDL_UnlockMutex(renderer->acquireCommandBufferLock);
 
     // Remove this command buffer from the submitted list
@@ -10503,6 +11629,52 @@ static SDL_GPUFence *VULKAN_SubmitAndAcquireFence(
     return (SDL_GPUFence *)vulkanCommandBuffer->inFlightFence;
 }
 
+static bool VULKAN_AddWaitFence(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUFence *fence)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanFenceHandle *fenceHandle = (VulkanFenceHandle *)fence;
+    VkSemaphore semaphore;
+
+    if (fenceHandle->queue == vulkanCommandBuffer->commandPool->queue) {
+        // Submissions on the same queue are already ordered
+        return true;
+    }
+
+    // A binary semaphore can only be waited on once, so the first waiter takes it over
+    SDL_LockMutex(renderer->submitLock);
+    semaphore = fenceHandle->semaphore;
+    fenceHandle->semaphore = VK_NULL_HANDLE;
+    SDL_UnlockMutex(renderer->submitLock);
+
+    if (semaphore == VK_NULL_HANDLE) {
+        return VULKAN_WaitForFences(
+            (SDL_GPURenderer *)renderer,
+            true,
+            &fence,
+            1);
+    }
+
+    VULKAN_INTERNAL_AddWaitSemaphore(
+        vulkanCommandBuffer,
+        semaphore,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    EXPAND_ARRAY_IF_NEEDED(
+        vulkanCommandBuffer->fenceSemaphores,
+        VkSemaphore,
+        vulkanCommandBuffer->fenceSemaphoreCount + 1,
+        vulkanCommandBuffer->fenceSemaphoreCapacity,
+        vulkanCommandBuffer->fenceSemaphoreCapacity + 1);
+
+    vulkanCommandBuffer->fenceSemaphores[vulkanCommandBuffer->fenceSemaphoreCount] = semaphore;
+    vulkanCommandBuffer->fenceSemaphoreCount += 1;
+
+    return true;
+}
+
 static void VULKAN_INTERNAL_ReleaseCommandBuffer(VulkanCommandBuffer *vulkanCommandBuffer)
 {
     VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
@@ -10526,9 +11698,11 @@ static bool VULKAN_Submit(
     VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
     VkSubmitInfo submitInfo;
     VkPresentInfoKHR presentInfo;
+    VkPresentTimesInfoGOOGLE presentTimesInfo;
+    VkPresentTimeGOOGLE presentTime;
     VulkanPresentData *presentData;
     VkResult vulkanResult, presentResult = VK_SUCCESS;
-    VkPipelineStageFlags waitStages[MAX_PRESENT_COUNT];
+    VkSemaphoreCreateInfo semaphoreCreateInfo;
     Uint32 swapchainImageIndex;
     VulkanTextureSubresource *swapchainTextureSubresource;
     VulkanMemorySubAllocator *allocator;
@@ -10538,11 +11712,6 @@ static bool VULKAN_Submit(
 
     SDL_LockMutex(renderer->submitLock);
 
-    // FIXME: Can this just be permanent?
-    for (Uint32 i = 0; i < MAX_PRESENT_COUNT; i += 1) {
-        waitStages[i] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    }
-
     for (Uint32 j = 0; j < vulkanCommandBuffer->presentDataCount; j += 1) {
         swapchainImageIndex = vulkanCommandBuffer->presentDatas[j].swapchainImageIndex;
         swapchainTextureSubresource = VULKAN_INTERNAL_FetchTextureSubresource(
@@ -10557,7 +11726,9 @@ static bool VULKAN_Submit(
             swapchainTextureSubresource);
     }
 
+    // Defrag copies depth textures too, which only the graphics queue can do
     if (performCleanups &&
+        vulkanCommandBuffer->commandPool->queue == renderer->unifiedQueue &&
         renderer->allocationsToDefragCount > 0 &&
         !renderer->defragInProgress) {
         if (!VULKAN_INTERNAL_DefragmentMemory(renderer, vulkanCommandBuffer))
@@ -10580,19 +11751,51 @@ static bool VULKAN_Submit(
     // Command buffer has a reference to the in-flight fence
     (void)SDL_AtomicIncRef(&vulkanCommandBuffer->inFlightFence->referenceCount);
 
+    vulkanCommandBuffer->inFlightFence->queue = vulkanCommandBuffer->commandPool->queue;
+
+    // A fence the application holds onto may be waited on by another queue, see VULKAN_AddWaitFence
+    if (!vulkanCommandBuffer->autoReleaseFence &&
+        renderer->computeQueue != renderer->unifiedQueue) {
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreCreateInfo.pNext = NULL;
+        semaphoreCreateInfo.flags = 0;
+
+        vulkanResult = renderer->vkCreateSemaphore(
+            renderer->logicalDevice,
+            &semaphoreCreateInfo,
+            NULL,
+            &vulkanCommandBuffer->inFlightFence->semaphore);
+
+        if (vulkanResult == VK_SUCCESS) {
+            if (vulkanCommandBuffer->signalSemaphoreCount == vulkanCommandBuffer->signalSemaphoreCapacity) {
+                vulkanCommandBuffer->signalSemaphoreCapacity += 1;
+                vulkanCommandBuffer->signalSemaphores = SDL_realloc(
+                    vulkanCommandBuffer->signalSemaphores,
+                    vulkanCommandBuffer->signalSemaphoreCapacity * sizeof(VkSemaphore));
+            }
+
+            vulkanCommandBuffer->signalSemaphores[vulkanCommandBuffer->signalSemaphoreCount] =
+                vulkanCommandBuffer->inFlightFence->semaphore;
+            vulkanCommandBuffer->signalSemaphoreCount += 1;
+        } else {
+            // Cross-queue waits on this fence will fall back to waiting on the CPU
+            vulkanCommandBuffer->inFlightFence->semaphore = VK_NULL_HANDLE;
+        }
+    }
+
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     submitInfo.pNext = NULL;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &vulkanCommandBuffer->commandBuffer;
 
-    submitInfo.pWaitDstStageMask = waitStages;
+    submitInfo.pWaitDstStageMask = vulkanCommandBuffer->waitStages;
     submitInfo.pWaitSemaphores = vulkanCommandBuffer->waitSemaphores;
     submitInfo.waitSemaphoreCount = vulkanCommandBuffer->waitSemaphoreCount;
     submitInfo.pSignalSemaphores = vulkanCommandBuffer->signalSemaphores;
     submitInfo.signalSemaphoreCount = vulkanCommandBuffer->signalSemaphoreCount;
 
     vulkanResult = renderer->vkQueueSubmit(
-        renderer->unifiedQueue,
+        vulkanCommandBuffer->commandPool->queue,
         1,
         &submitInfo,
         vulkanCommandBuffer->inFlightFence->fence);
@@ -10616,11 +11819,24 @@ static bool VULKAN_Submit(
         presentInfo.pImageIndices = &presentData->swapchainImageIndex;
         presentInfo.pResults = NULL;
 
+        if (renderer->supportsDisplayTiming) {
+            presentTime.presentID = (Uint32)(presentData->windowData->presentCount + 1);
+            presentTime.desiredPresentTime = 0;
+
+            presentTimesInfo.sType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
+            presentTimesInfo.pNext = NULL;
+            presentTimesInfo.swapchainCount = 1;
+            presentTimesInfo.pTimes = &presentTime;
+            presentInfo.pNext = &presentTimesInfo;
+        }
+
         presentResult = renderer->vkQueuePresentKHR(
             renderer->unifiedQueue,
             &presentInfo);
 
         if (presentResult == VK_SUCCESS || presentResult == VK_SUBOPTIMAL_KHR || presentResult == VK_ERROR_OUT_OF_DATE_KHR) {
+            presentData->windowData->presentCount += 1;
+
             // If presenting, the swapchain is using the in-flight fence
             presentData->windowData->inFlightFences[presentData->windowData->frameCounter] = (SDL_GPUFence *)vulkanCommandBuffer->inFlightFence;
             (void)SDL_AtomicIncRef(&vulkanCommandBuffer->inFlightFence->referenceCount);
@@ -10766,6 +11982,7 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
                 bufferCopy.dstOffset = 0;
                 bufferCopy.size = currentRegion->resourceSize;
 
+                VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
                 renderer->vkCmdCopyBuffer(
                     commandBuffer->commandBuffer,
                     currentRegion->vulkanBuffer->buffer,
@@ -10804,7 +12021,8 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
             VulkanTexture *newTexture = VULKAN_INTERNAL_CreateTexture(
                 renderer,
                 false,
-                &currentRegion->vulkanTexture->container->header.info);
+                &currentRegion->vulkanTexture->container->header.info,
+                NULL);
 
             if (newTexture == NULL) {
                 SDL_UnlockMutex(renderer->allocatorLock);
@@ -10818,6 +12036,18 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
                 VulkanTextureSubresource *srcSubresource = &currentRegion->vulkanTexture->subresources[subresourceIndex];
                 VulkanTextureSubresource *dstSubresource = &newTexture->subresources[subresourceIndex];
 
+                // Transient contents don't outlive a render pass, so there is nothing to copy
+                if (info.usage & SDL_GPU_TEXTUREUSAGE_TRANSIENT) {
+                    VULKAN_INTERNAL_TextureSubresourceTransitionToDefaultUsage(
+                        renderer,
+                        commandBuffer,
+                        VULKAN_TEXTURE_USAGE_MODE_UNINITIALIZED,
+                        dstSubresource);
+
+                    VULKAN_INTERNAL_TrackTexture(commandBuffer, dstSubresource->parent);
+                    continue;
+                }
+
                 VULKAN_INTERNAL_TextureSubresourceTransitionFromDefaultUsage(
                     renderer,
                     commandBuffer,
@@ -10850,6 +12080,7 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
                 imageCopy.dstSubresource.layerCount = 1;
                 imageCopy.dstSubresource.mipLevel = dstSubresource->level;
 
+                VULKAN_INTERNAL_FlushBarriers(renderer, commandBuffer);
                 renderer->vkCmdCopyImage(
                     commandBuffer->commandBuffer,
                     currentRegion->vulkanTexture->image,
@@ -10933,6 +12164,110 @@ static bool VULKAN_SupportsTextureFormat(
     return vulkanResult == VK_SUCCESS;
 }
 
+static bool VULKAN_SupportsSparseTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTextureFormat format,
+    SDL_GPUTextureType type,
+    SDL_GPUTextureUsageFlags usage)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VkImageUsageFlags vulkanUsage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    Uint32 propertyCount = 0;
+
+    (void)type; // 2D and 2D arrays share the same image type
+
+    if (!renderer->supportsSparseResidency) {
+        return false;
+    }
+
+    if (usage & (SDL_GPU_TEXTUREUSAGE_SAMPLER |
+                 SDL_GPU_TEXTUREUSAGE_GRAPHICS_STORAGE_READ |
+                 SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ)) {
+        vulkanUsage |= VK_IMAGE_USAGE_SAMPLED_BIT;
+    }
+    if (usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) {
+        vulkanUsage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+    if (usage & (SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE |
+                 SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE)) {
+        vulkanUsage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    }
+
+    // An empty list means the format can't be sparse with this usage
+    renderer->vkGetPhysicalDeviceSparseImageFormatProperties(
+        renderer->physicalDevice,
+        SDLToVK_TextureFormat[format],
+        VK_IMAGE_TYPE_2D,
+        VK_SAMPLE_COUNT_1_BIT,
+        vulkanUsage,
+        VK_IMAGE_TILING_OPTIMAL,
+        &propertyCount,
+        NULL);
+
+    return propertyCount > 0;
+}
+
+static bool VULKAN_UpdateSparseTileMappings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    const GPU_SparseTileUpdate *updates,
+    Uint32 numUpdates)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanTextureContainer *container = (VulkanTextureContainer *)texture;
+    VulkanTexture *vulkanTexture = container->activeTexture;
+    const GPU_SparseTileMap *map = container->header.sparse;
+    VkSparseImageMemoryBind *binds;
+    VkSparseImageMemoryBindInfo imageBindInfo;
+    VkBindSparseInfo bindInfo;
+    bool result;
+
+    binds = SDL_malloc(numUpdates * sizeof(VkSparseImageMemoryBind));
+    if (!binds) {
+        return false;
+    }
+
+    for (Uint32 i = 0; i < numUpdates; i += 1) {
+        const GPU_SparseTileUpdate *update = &updates[i];
+        Uint32 levelWidth = SDL_max(container->header.info.width >> update->level, 1);
+        Uint32 levelHeight = SDL_max(container->header.info.height >> update->level, 1);
+        Uint32 x = update->x * map->tileWidth;
+        Uint32 y = update->y * map->tileHeight;
+
+        binds[i].subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        binds[i].subresource.mipLevel = update->level;
+        binds[i].subresource.arrayLayer = update->layer;
+        binds[i].offset.x = (Sint32)x;
+        binds[i].offset.y = (Sint32)y;
+        binds[i].offset.z = 0;
+        // Edge tiles have to be clipped to the level
+        binds[i].extent.width = SDL_min(map->tileWidth, levelWidth - x);
+        binds[i].extent.height = SDL_min(map->tileHeight, levelHeight - y);
+        binds[i].extent.depth = 1;
+        if (update->slot == GPU_SPARSE_TILE_UNMAPPED) {
+            binds[i].memory = VK_NULL_HANDLE;
+            binds[i].memoryOffset = 0;
+        } else {
+            binds[i].memory = vulkanTexture->sparseMemory;
+            binds[i].memoryOffset = (VkDeviceSize)update->slot * map->tileSize;
+        }
+        binds[i].flags = 0;
+    }
+
+    imageBindInfo.image = vulkanTexture->image;
+    imageBindInfo.bindCount = numUpdates;
+    imageBindInfo.pBinds = binds;
+
+    SDL_zero(bindInfo);
+    bindInfo.sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+    bindInfo.imageBindCount = 1;
+    bindInfo.pImageBinds = &imageBindInfo;
+
+    result = VULKAN_INTERNAL_BindSparse(renderer, &bindInfo);
+    SDL_free(binds);
+    return result;
+}
+
 // Device instantiation
 
 static inline Uint8 CheckDeviceExtensions(
@@ -10950,10 +12285,21 @@ static inline Uint8 CheckDeviceExtensions(
         supports->ext = 1;                   \
     }
         CHECK(KHR_swapchain)
-        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr)
+        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr) else CHECK(EXT_memory_budget) else CHECK(KHR_maintenance3) else CHECK(EXT_descriptor_indexing) else CHECK(KHR_draw_indirect_count) else CHECK(GOOGLE_display_timing) else CHECK(KHR_fragment_shading_rate) else CHECK(KHR_create_renderpass2) else CHECK(KHR_multiview) else CHECK(KHR_maintenance2)
 #undef CHECK
     }
 
+    // Don't enable the shading rate dependencies unless all of them are there
+    if (!(supports->KHR_fragment_shading_rate &&
+          supports->KHR_create_renderpass2 &&
+          supports->KHR_multiview &&
+          supports->KHR_maintenance2)) {
+        supports->KHR_fragment_shading_rate = 0;
+        supports->KHR_create_renderpass2 = 0;
+        supports->KHR_multiview = 0;
+        supports->KHR_maintenance2 = 0;
+    }
+
     return (supports->KHR_swapchain &&
             supports->KHR_maintenance1);
 }
@@ -10965,7 +12311,16 @@ static inline Uint32 GetDeviceExtensionCount(VulkanExtensions *supports)
         supports->KHR_maintenance1 +
         supports->KHR_driver_properties +
         supports->KHR_portability_subset +
-        supports->EXT_texture_compression_astc_hdr);
+        supports->EXT_texture_compression_astc_hdr +
+        supports->EXT_memory_budget +
+        supports->KHR_maintenance3 +
+        supports->EXT_descriptor_indexing +
+        supports->KHR_draw_indirect_count +
+        supports->GOOGLE_display_timing +
+        supports->KHR_fragment_shading_rate +
+        supports->KHR_create_renderpass2 +
+        supports->KHR_multiview +
+        supports->KHR_maintenance2);
 }
 
 static inline void CreateDeviceExtensionArray(
@@ -10982,6 +12337,15 @@ static inline void CreateDeviceExtensionArray(
     CHECK(KHR_driver_properties)
     CHECK(KHR_portability_subset)
     CHECK(EXT_texture_compression_astc_hdr)
+    CHECK(EXT_memory_budget)
+    CHECK(KHR_maintenance3)
+    CHECK(EXT_descriptor_indexing)
+    CHECK(KHR_draw_indirect_count)
+    CHECK(GOOGLE_display_timing)
+    CHECK(KHR_fragment_shading_rate)
+    CHECK(KHR_create_renderpass2)
+    CHECK(KHR_multiview)
+    CHECK(KHR_maintenance2)
 #undef CHECK
 }
 
@@ -11478,6 +12842,244 @@ static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(VulkanRenderer *renderer)
     return 1;
 }
 
+static void VULKAN_INTERNAL_FindComputeQueueFamily(
+    VulkanRenderer *renderer)
+{
+    VkQueueFamilyProperties *queueProps;
+    Uint32 queueFamilyCount, i;
+
+    renderer->computeQueueFamilyIndex = renderer->queueFamilyIndex;
+
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        NULL);
+
+    queueProps = SDL_stack_alloc(
+        VkQueueFamilyProperties,
+        queueFamilyCount);
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        queueProps);
+
+    // A compute family without graphics is the one that actually runs alongside the graphics queue
+    for (i = 0; i < queueFamilyCount; i += 1) {
+        if ((queueProps[i].queueFlags & VK_QUEUE_COMPUTE_BIT) &&
+            !(queueProps[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) &&
+            queueProps[i].queueCount > 0) {
+            renderer->computeQueueFamilyIndex = i;
+            break;
+        }
+    }
+
+    SDL_stack_free(queueProps);
+}
+
+static void VULKAN_INTERNAL_CheckBindlessSupport(
+    VulkanRenderer *renderer,
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT *enableFeatures)
+{
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT haveFeatures;
+    VkPhysicalDeviceFeatures2KHR features2;
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexingProperties;
+    VkPhysicalDeviceProperties2KHR properties2;
+    Uint32 textureLimit, samplerLimit, bufferLimit;
+
+    if (!renderer->supports.EXT_descriptor_indexing ||
+        !renderer->supports.KHR_maintenance3 ||
+        renderer->physicalDeviceProperties.properties.limits.maxBoundDescriptorSets <= BINDLESS_DESCRIPTOR_SET) {
+        return;
+    }
+
+    SDL_zero(haveFeatures);
+    haveFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+    features2.pNext = &haveFeatures;
+    renderer->vkGetPhysicalDeviceFeatures2KHR(renderer->physicalDevice, &features2);
+
+    if (!haveFeatures.runtimeDescriptorArray ||
+        !haveFeatures.descriptorBindingPartiallyBound ||
+        !haveFeatures.descriptorBindingUpdateUnusedWhilePending ||
+        !haveFeatures.descriptorBindingSampledImageUpdateAfterBind ||
+        !haveFeatures.descriptorBindingStorageBufferUpdateAfterBind ||
+        !haveFeatures.shaderSampledImageArrayNonUniformIndexing ||
+        !haveFeatures.shaderStorageBufferArrayNonUniformIndexing) {
+        return;
+    }
+
+    SDL_zero(indexingProperties);
+    indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+    properties2.pNext = &indexingProperties;
+    renderer->vkGetPhysicalDeviceProperties2KHR(renderer->physicalDevice, &properties2);
+
+    // Pipeline layouts that include the heap are held to the update-after-bind limits for every set
+    if (indexingProperties.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic < 2 * MAX_UNIFORM_BUFFERS_PER_STAGE) {
+        return;
+    }
+
+    // Leave room for the per-draw bindings of both graphics stages
+    textureLimit = SDL_min(indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages, indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages);
+    samplerLimit = SDL_min(indexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers, indexingProperties.maxDescriptorSetUpdateAfterBindSamplers);
+    bufferLimit = SDL_min(indexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers, indexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers);
+    if (textureLimit <= 2 * MAX_TEXTURE_SAMPLERS_PER_STAGE ||
+        samplerLimit <= 2 * MAX_TEXTURE_SAMPLERS_PER_STAGE ||
+        bufferLimit <= 2 * MAX_STORAGE_BUFFERS_PER_STAGE) {
+        return;
+    }
+
+    renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE] = SDL_min(BINDLESS_MAX_TEXTURES, textureLimit - 2 * MAX_TEXTURE_SAMPLERS_PER_STAGE);
+    renderer->bindlessCapacity[GPU_BINDLESS_SAMPLER] = SDL_min(BINDLESS_MAX_SAMPLERS, samplerLimit - 2 * MAX_TEXTURE_SAMPLERS_PER_STAGE);
+    renderer->bindlessCapacity[GPU_BINDLESS_BUFFER] = SDL_min(BINDLESS_MAX_BUFFERS, bufferLimit - 2 * MAX_STORAGE_BUFFERS_PER_STAGE);
+
+    enableFeatures->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    enableFeatures->runtimeDescriptorArray = VK_TRUE;
+    enableFeatures->descriptorBindingPartiallyBound = VK_TRUE;
+    enableFeatures->descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    enableFeatures->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    enableFeatures->descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+    enableFeatures->shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    enableFeatures->shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+}
+
+static void VULKAN_INTERNAL_CheckShadingRateSupport(
+    VulkanRenderer *renderer,
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR *enableFeatures)
+{
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR haveFeatures;
+    VkPhysicalDeviceFeatures2KHR features2;
+    VkPhysicalDeviceFragmentShadingRateKHR *rates;
+    Uint32 rateCount = 0;
+
+    if (!renderer->supports.KHR_fragment_shading_rate) {
+        return;
+    }
+
+    SDL_zero(haveFeatures);
+    haveFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+    features2.pNext = &haveFeatures;
+    renderer->vkGetPhysicalDeviceFeatures2KHR(renderer->physicalDevice, &features2);
+
+    if (!haveFeatures.pipelineFragmentShadingRate) {
+        return;
+    }
+
+    if (renderer->vkGetPhysicalDeviceFragmentShadingRatesKHR(renderer->physicalDevice, &rateCount, NULL) != VK_SUCCESS || rateCount == 0) {
+        return;
+    }
+    rates = SDL_stack_alloc(VkPhysicalDeviceFragmentShadingRateKHR, rateCount);
+    for (Uint32 i = 0; i < rateCount; i += 1) {
+        SDL_zero(rates[i]);
+        rates[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR;
+    }
+    if (renderer->vkGetPhysicalDeviceFragmentShadingRatesKHR(renderer->physicalDevice, &rateCount, rates) == VK_SUCCESS) {
+        for (Uint32 i = 0; i < rateCount; i += 1) {
+            Uint32 width = rates[i].fragmentSize.width;
+            Uint32 height = rates[i].fragmentSize.height;
+
+            // Render targets are single-sampled as often as not, so only count rates that work there
+            if (!(rates[i].sampleCounts & VK_SAMPLE_COUNT_1_BIT) ||
+                width > 4 || height > 4 || (width & (width - 1)) || (height & (height - 1))) {
+                continue;
+            }
+            renderer->supportedShadingRates |= 1u << ((SDL_MostSignificantBitIndex32(width) << 2) | SDL_MostSignificantBitIndex32(height));
+        }
+    }
+    SDL_stack_free(rates);
+
+    // Anything coarser than 1x1 is needed for the feature to be worth enabling
+    if ((renderer->supportedShadingRates & ~(1u << SDL_GPU_SHADINGRATE_1X1)) == 0) {
+        renderer->supportedShadingRates = 0;
+        return;
+    }
+    renderer->supportedShadingRates |= 1u << SDL_GPU_SHADINGRATE_1X1;
+
+    enableFeatures->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+    enableFeatures->pipelineFragmentShadingRate = VK_TRUE;
+}
+
+static bool VULKAN_INTERNAL_CreateBindlessDescriptorSet(
+    VulkanRenderer *renderer)
+{
+    static const VkDescriptorType descriptorTypes[GPU_BINDLESS_TYPE_COUNT] = {
+        VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+        VK_DESCRIPTOR_TYPE_SAMPLER,
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+    };
+    VkDescriptorSetLayoutBinding bindings[GPU_BINDLESS_TYPE_COUNT];
+    VkDescriptorBindingFlagsEXT bindingFlags[GPU_BINDLESS_TYPE_COUNT];
+    VkDescriptorPoolSize poolSizes[GPU_BINDLESS_TYPE_COUNT];
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo;
+    VkDescriptorSetLayoutCreateInfo layoutCreateInfo;
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    VkDescriptorSetAllocateInfo allocateInfo;
+    VkResult vulkanResult;
+
+    for (Uint32 i = 0; i < GPU_BINDLESS_TYPE_COUNT; i += 1) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = descriptorTypes[i];
+        bindings[i].descriptorCount = renderer->bindlessCapacity[i];
+        bindings[i].stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[i].pImmutableSamplers = NULL;
+
+        bindingFlags[i] =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+
+        poolSizes[i].type = descriptorTypes[i];
+        poolSizes[i].descriptorCount = renderer->bindlessCapacity[i];
+    }
+
+    bindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+    bindingFlagsCreateInfo.pNext = NULL;
+    bindingFlagsCreateInfo.bindingCount = GPU_BINDLESS_TYPE_COUNT;
+    bindingFlagsCreateInfo.pBindingFlags = bindingFlags;
+
+    layoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutCreateInfo.pNext = &bindingFlagsCreateInfo;
+    layoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+    layoutCreateInfo.bindingCount = GPU_BINDLESS_TYPE_COUNT;
+    layoutCreateInfo.pBindings = bindings;
+
+    vulkanResult = renderer->vkCreateDescriptorSetLayout(
+        renderer->logicalDevice,
+        &layoutCreateInfo,
+        NULL,
+        &renderer->bindlessDescriptorSetLayout);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateDescriptorSetLayout, false);
+
+    poolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolCreateInfo.pNext = NULL;
+    poolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+    poolCreateInfo.maxSets = 1;
+    poolCreateInfo.poolSizeCount = GPU_BINDLESS_TYPE_COUNT;
+    poolCreateInfo.pPoolSizes = poolSizes;
+
+    vulkanResult = renderer->vkCreateDescriptorPool(
+        renderer->logicalDevice,
+        &poolCreateInfo,
+        NULL,
+        &renderer->bindlessDescriptorPool);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateDescriptorPool, false);
+
+    allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocateInfo.pNext = NULL;
+    allocateInfo.descriptorPool = renderer->bindlessDescriptorPool;
+    allocateInfo.descriptorSetCount = 1;
+    allocateInfo.pSetLayouts = &renderer->bindlessDescriptorSetLayout;
+
+    vulkanResult = renderer->vkAllocateDescriptorSets(
+        renderer->logicalDevice,
+        &allocateInfo,
+        &renderer->bindlessDescriptorSet);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkAllocateDescriptorSets, false);
+
+    return true;
+}
+
 static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     VulkanRenderer *renderer)
 {
@@ -11485,18 +13087,25 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     VkDeviceCreateInfo deviceCreateInfo;
     VkPhysicalDeviceFeatures haveDeviceFeatures;
     VkPhysicalDevicePortabilitySubsetFeaturesKHR portabilityFeatures;
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR shadingRateFeatures;
     const char **deviceExtensions;
 
-    VkDeviceQueueCreateInfo queueCreateInfo;
+    VkDeviceQueueCreateInfo queueCreateInfos[2];
     float queuePriority = 1.0f;
 
-    queueCreateInfo.sType =
+    VULKAN_INTERNAL_FindComputeQueueFamily(renderer);
+
+    queueCreateInfos[0].sType =
         VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queueCreateInfo.pNext = NULL;
-    queueCreateInfo.flags = 0;
-    queueCreateInfo.queueFamilyIndex = renderer->queueFamilyIndex;
-    queueCreateInfo.queueCount = 1;
-    queueCreateInfo.pQueuePriorities = &queuePriority;
+    queueCreateInfos[0].pNext = NULL;
+    queueCreateInfos[0].flags = 0;
+    queueCreateInfos[0].queueFamilyIndex = renderer->queueFamilyIndex;
+    queueCreateInfos[0].queueCount = 1;
+    queueCreateInfos[0].pQueuePriorities = &queuePriority;
+
+    queueCreateInfos[1] = queueCreateInfos[0];
+    queueCreateInfos[1].queueFamilyIndex = renderer->computeQueueFamilyIndex;
 
     // check feature support
 
@@ -11516,6 +13125,40 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
         renderer->supportsMultiDrawIndirect = true;
     }
 
+    if (haveDeviceFeatures.sparseBinding && haveDeviceFeatures.sparseResidencyImage2D) {
+        // Sparse binds go through the unified queue, so its family has to support them
+        VkQueueFamilyProperties *queueProps;
+        Uint32 queueFamilyCount;
+
+        renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+            renderer->physicalDevice,
+            &queueFamilyCount,
+            NULL);
+        queueProps = SDL_stack_alloc(
+            VkQueueFamilyProperties,
+            queueFamilyCount);
+        renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+            renderer->physicalDevice,
+            &queueFamilyCount,
+            queueProps);
+
+        if (queueProps[renderer->queueFamilyIndex].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) {
+            renderer->desiredDeviceFeatures.sparseBinding = VK_TRUE;
+            renderer->desiredDeviceFeatures.sparseResidencyImage2D = VK_TRUE;
+            renderer->supportsSparseResidency = true;
+        }
+
+        SDL_stack_free(queueProps);
+    }
+
+    SDL_zero(descriptorIndexingFeatures);
+    if (renderer->bindlessRequested) {
+        VULKAN_INTERNAL_CheckBindlessSupport(renderer, &descriptorIndexingFeatures);
+    }
+
+    SDL_zero(shadingRateFeatures);
+    VULKAN_INTERNAL_CheckShadingRateSupport(renderer, &shadingRateFeatures);
+
     // creating the logical device
 
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -11541,9 +13184,17 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     } else {
         deviceCreateInfo.pNext = NULL;
     }
+    if (renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE] > 0) {
+        descriptorIndexingFeatures.pNext = (void *)deviceCreateInfo.pNext;
+        deviceCreateInfo.pNext = &descriptorIndexingFeatures;
+    }
+    if (renderer->supportedShadingRates != 0) {
+        shadingRateFeatures.pNext = (void *)deviceCreateInfo.pNext;
+        deviceCreateInfo.pNext = &shadingRateFeatures;
+    }
     deviceCreateInfo.flags = 0;
-    deviceCreateInfo.queueCreateInfoCount = 1;
-    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.queueCreateInfoCount = renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex ? 2 : 1;
+    deviceCreateInfo.pQueueCreateInfos = queueCreateInfos;
     deviceCreateInfo.enabledLayerCount = 0;
     deviceCreateInfo.ppEnabledLayerNames = NULL;
     deviceCreateInfo.enabledExtensionCount = GetDeviceExtensionCount(
@@ -11578,9 +13229,71 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
         0,
         &renderer->unifiedQueue);
 
+    if (renderer->computeQueueFamilyIndex != renderer->queueFamilyIndex) {
+        renderer->vkGetDeviceQueue(
+            renderer->logicalDevice,
+            renderer->computeQueueFamilyIndex,
+            0,
+            &renderer->computeQueue);
+    } else {
+        renderer->computeQueue = renderer->unifiedQueue;
+    }
+
     return 1;
 }
 
+static void VULKAN_INTERNAL_CreatePipelineCache(
+    VulkanRenderer *renderer,
+    SDL_PropertiesID props)
+{
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo;
+    VkPipelineCacheHeaderVersionOne header;
+    const void *initialData = SDL_GetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_DATA_POINTER, NULL);
+    size_t initialDataSize = (size_t)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_CACHE_SIZE_NUMBER, 0);
+    VkResult vulkanResult;
+
+    // Drivers are expected to reject foreign data, but don't trust them to
+    if (!initialData || initialDataSize < sizeof(header)) {
+        initialData = NULL;
+    } else {
+        SDL_memcpy(&header, initialData, sizeof(header));
+        if (header.headerSize < sizeof(header) ||
+            header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+            header.vendorID != renderer->physicalDeviceProperties.properties.vendorID ||
+            header.deviceID != renderer->physicalDeviceProperties.properties.deviceID ||
+            SDL_memcmp(header.pipelineCacheUUID, renderer->physicalDeviceProperties.properties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+            initialData = NULL;
+        }
+    }
+
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.pNext = NULL;
+    pipelineCacheCreateInfo.flags = 0;
+    pipelineCacheCreateInfo.initialDataSize = initialData ? initialDataSize : 0;
+    pipelineCacheCreateInfo.pInitialData = initialData;
+
+    vulkanResult = renderer->vkCreatePipelineCache(
+        renderer->logicalDevice,
+        &pipelineCacheCreateInfo,
+        NULL,
+        &renderer->pipelineCache);
+
+    if (vulkanResult != VK_SUCCESS && initialData) {
+        pipelineCacheCreateInfo.initialDataSize = 0;
+        pipelineCacheCreateInfo.pInitialData = NULL;
+        vulkanResult = renderer->vkCreatePipelineCache(
+            renderer->logicalDevice,
+            &pipelineCacheCreateInfo,
+            NULL,
+            &renderer->pipelineCache);
+    }
+
+    if (vulkanResult != VK_SUCCESS) {
+        // Not fatal, pipelines just get compiled without a cache
+        renderer->pipelineCache = VK_NULL_HANDLE;
+    }
+}
+
 static void VULKAN_INTERNAL_LoadEntryPoints(void)
 {
     // Required for MoltenVK support
@@ -11706,6 +13419,7 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
     renderer->debugMode = debugMode;
     renderer->preferLowPower = preferLowPower;
     renderer->allowedFramesInFlight = 2;
+    renderer->bindlessRequested = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN, false);
 
     // Opt out device features (higher compatibility in exchange for reduced functionality)
     renderer->desiredDeviceFeatures.samplerAnisotropy = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN, true) ? VK_TRUE : VK_FALSE;
@@ -11831,9 +13545,49 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         SET_STRING_ERROR_AND_RETURN("Failed to create logical device!", NULL);
     }
 
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_ASYNC_COMPUTE_BOOLEAN,
+        renderer->computeQueue != renderer->unifiedQueue);
+
+    renderer->supportsDrawIndirectCount =
+        renderer->supports.KHR_draw_indirect_count &&
+        renderer->vkCmdDrawIndirectCountKHR != NULL &&
+        renderer->vkCmdDrawIndexedIndirectCountKHR != NULL;
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN,
+        renderer->supportsDrawIndirectCount);
+
+    renderer->supportsDisplayTiming =
+        renderer->supports.GOOGLE_display_timing &&
+        renderer->vkGetPastPresentationTimingGOOGLE != NULL &&
+        renderer->vkGetRefreshCycleDurationGOOGLE != NULL;
+
+    if (renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE] > 0) {
+        if (VULKAN_INTERNAL_CreateBindlessDescriptorSet(renderer)) {
+            SDL_SetBooleanProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_BOOLEAN, true);
+            SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_TEXTURES_NUMBER, renderer->bindlessCapacity[GPU_BINDLESS_TEXTURE]);
+            SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_SAMPLERS_NUMBER, renderer->bindlessCapacity[GPU_BINDLESS_SAMPLER]);
+            SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_BINDLESS_MAX_BUFFERS_NUMBER, renderer->bindlessCapacity[GPU_BINDLESS_BUFFER]);
+        } else {
+            // Not fatal, the device just runs without the heap
+            SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Failed to create bindless heap: %s", SDL_GetError());
+            renderer->bindlessDescriptorSet = VK_NULL_HANDLE;
+        }
+    } else if (renderer->bindlessRequested && verboseLogs) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Bindless resources are not supported by this device");
+    }
+
     // FIXME: just move this into this function
-    result = (SDL_GPUDevice *)SDL_malloc(sizeof(SDL_GPUDevice));
+    result = (SDL_GPUDevice *)SDL_calloc(1, sizeof(SDL_GPUDevice));
     ASSIGN_DRIVER(VULKAN)
+    result->SupportsSparseTexture = VULKAN_SupportsSparseTexture;
+    result->UpdateSparseTileMappings = VULKAN_UpdateSparseTileMappings;
+    if (renderer->supportedShadingRates != 0) {
+        result->SupportsShadingRate = VULKAN_SupportsShadingRate;
+        result->SetShadingRate = VULKAN_SetShadingRate;
+    }
 
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = SDL_GPU_SHADERFORMAT_SPIRV;
@@ -11897,10 +13651,6 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
             UNIFORM_BUFFER_SIZE);
     }
 
-    renderer->descriptorSetCachePoolCapacity = 8;
-    renderer->descriptorSetCachePoolCount = 0;
-    renderer->descriptorSetCachePool = SDL_calloc(renderer->descriptorSetCachePoolCapacity, sizeof(DescriptorSetCache *));
-
     SDL_SetAtomicInt(&renderer->layoutResourceID, 0);
 
     // Device limits
@@ -11909,6 +13659,8 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
 
     // Initialize caches
 
+    VULKAN_INTERNAL_CreatePipelineCache(renderer, props);
+
     renderer->commandPoolHashTable = SDL_CreateHashTable(
         0,  // !!! FIXME: a real guess here, for a _minimum_ if not a maximum, could be useful.
         false,  // manually synchronized due to submission timing
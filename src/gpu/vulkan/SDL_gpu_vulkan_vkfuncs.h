@@ -50,8 +50,11 @@ VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFormatProperties)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceImageFormatProperties)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSparseImageFormatProperties)
 
-// VK_KHR_get_physical_device_properties2, needed for KHR_driver_properties
+// VK_KHR_get_physical_device_properties2, needed for KHR_driver_properties, EXT_memory_budget and EXT_descriptor_indexing
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFeatures2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties2KHR)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties2KHR)
 
 // VK_KHR_surface
@@ -67,6 +70,9 @@ VULKAN_INSTANCE_FUNCTION(vkSetDebugUtilsObjectNameEXT)
 VULKAN_INSTANCE_FUNCTION(vkCmdEndDebugUtilsLabelEXT)
 VULKAN_INSTANCE_FUNCTION(vkCmdInsertDebugUtilsLabelEXT)
 
+// VK_KHR_fragment_shading_rate
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFragmentShadingRatesKHR)
+
 /*
  * vkDevice, created by a vkInstance
  */
@@ -103,12 +109,14 @@ VULKAN_DEVICE_FUNCTION(vkCmdDrawIndexedIndirect)
 VULKAN_DEVICE_FUNCTION(vkCmdDrawIndirect)
 VULKAN_DEVICE_FUNCTION(vkCmdEndRenderPass)
 VULKAN_DEVICE_FUNCTION(vkCmdPipelineBarrier)
+VULKAN_DEVICE_FUNCTION(vkCmdResetQueryPool)
 VULKAN_DEVICE_FUNCTION(vkCmdResolveImage)
 VULKAN_DEVICE_FUNCTION(vkCmdSetBlendConstants)
 VULKAN_DEVICE_FUNCTION(vkCmdSetDepthBias)
 VULKAN_DEVICE_FUNCTION(vkCmdSetScissor)
 VULKAN_DEVICE_FUNCTION(vkCmdSetStencilReference)
 VULKAN_DEVICE_FUNCTION(vkCmdSetViewport)
+VULKAN_DEVICE_FUNCTION(vkCmdWriteTimestamp)
 VULKAN_DEVICE_FUNCTION(vkCreateBuffer)
 VULKAN_DEVICE_FUNCTION(vkCreateCommandPool)
 VULKAN_DEVICE_FUNCTION(vkCreateDescriptorPool)
@@ -121,6 +129,7 @@ VULKAN_DEVICE_FUNCTION(vkCreateImage)
 VULKAN_DEVICE_FUNCTION(vkCreateImageView)
 VULKAN_DEVICE_FUNCTION(vkCreatePipelineCache)
 VULKAN_DEVICE_FUNCTION(vkCreatePipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkCreateQueryPool)
 VULKAN_DEVICE_FUNCTION(vkCreateRenderPass)
 VULKAN_DEVICE_FUNCTION(vkCreateSampler)
 VULKAN_DEVICE_FUNCTION(vkCreateSemaphore)
@@ -137,6 +146,7 @@ VULKAN_DEVICE_FUNCTION(vkDestroyImageView)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipeline)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipelineCache)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkDestroyQueryPool)
 VULKAN_DEVICE_FUNCTION(vkDestroyRenderPass)
 VULKAN_DEVICE_FUNCTION(vkDestroySampler)
 VULKAN_DEVICE_FUNCTION(vkDestroySemaphore)
@@ -147,10 +157,13 @@ VULKAN_DEVICE_FUNCTION(vkFreeCommandBuffers)
 VULKAN_DEVICE_FUNCTION(vkFreeMemory)
 VULKAN_DEVICE_FUNCTION(vkGetDeviceQueue)
 VULKAN_DEVICE_FUNCTION(vkGetPipelineCacheData)
+VULKAN_DEVICE_FUNCTION(vkGetQueryPoolResults)
 VULKAN_DEVICE_FUNCTION(vkGetFenceStatus)
 VULKAN_DEVICE_FUNCTION(vkGetBufferMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
+VULKAN_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkMapMemory)
+VULKAN_DEVICE_FUNCTION(vkQueueBindSparse)
 VULKAN_DEVICE_FUNCTION(vkQueueSubmit)
 VULKAN_DEVICE_FUNCTION(vkQueueWaitIdle)
 VULKAN_DEVICE_FUNCTION(vkResetCommandBuffer)
@@ -168,6 +181,17 @@ VULKAN_DEVICE_FUNCTION(vkDestroySwapchainKHR)
 VULKAN_DEVICE_FUNCTION(vkQueuePresentKHR)
 VULKAN_DEVICE_FUNCTION(vkGetSwapchainImagesKHR)
 
+// VK_KHR_draw_indirect_count
+VULKAN_DEVICE_FUNCTION(vkCmdDrawIndirectCountKHR)
+VULKAN_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCountKHR)
+
+// VK_GOOGLE_display_timing
+VULKAN_DEVICE_FUNCTION(vkGetPastPresentationTimingGOOGLE)
+VULKAN_DEVICE_FUNCTION(vkGetRefreshCycleDurationGOOGLE)
+
+// VK_KHR_fragment_shading_rate
+VULKAN_DEVICE_FUNCTION(vkCmdSetFragmentShadingRateKHR)
+
 /*
  * Redefine these every time you include this header!
  */
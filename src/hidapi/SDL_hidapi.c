@@ -1604,6 +1604,34 @@ int SDL_hid_read(SDL_hid_device *device, unsigned char *data, size_t length)
     return device->backend->hid_read(device->device, data, length);
 }
 
+#ifdef SDL_JOYSTICK_HIDAPI
+#ifdef SDL_PLATFORM_LINUX
+int SDL_hid_get_read_fd(SDL_hid_device *device)
+{
+    CHECK_DEVICE_MAGIC(device, -1);
+
+#ifdef HAVE_PLATFORM_BACKEND
+    if (device->backend == &PLATFORM_Backend) {
+        return ((PLATFORM_hid_device *)device->device)->device_handle;
+    }
+#endif
+    return -1;
+}
+#elif defined(SDL_PLATFORM_WIN32) || defined(SDL_PLATFORM_WINGDK)
+void *SDL_hid_get_read_event(SDL_hid_device *device)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+#ifdef HAVE_PLATFORM_BACKEND
+    if (device->backend == &PLATFORM_Backend) {
+        return ((PLATFORM_hid_device *)device->device)->ol.hEvent;
+    }
+#endif
+    return NULL;
+}
+#endif
+#endif // SDL_JOYSTICK_HIDAPI
+
 int SDL_hid_set_nonblocking(SDL_hid_device *device, int nonblock)
 {
     CHECK_DEVICE_MAGIC(device, -1);
@@ -32,4 +32,20 @@ extern bool SDL_HIDAPI_ShouldIgnoreDevice(int bus_type, Uint16 vendor_id, Uint16
 #ifdef HAVE_ENABLE_GAMECUBE_ADAPTORS
 extern void SDL_EnableGameCubeAdaptors(void);
 #endif
+
+/* Return something that can be waited on until an input report may be ready,
+   so many devices can be read from one thread. On Linux this is the hidraw
+   file descriptor, which polls readable. On Windows it's the auto-reset event
+   of the overlapped read, which is only armed after SDL_hid_read_timeout()
+   has returned 0, and whose signal has to be handed back with SetEvent() for
+   the next read to see it. Devices opened through other backends return -1
+   or NULL.
+ */
+#ifdef SDL_PLATFORM_LINUX
+#define HAVE_HIDAPI_READ_WAIT
+extern int SDL_hid_get_read_fd(SDL_hid_device *device);
+#elif defined(SDL_PLATFORM_WIN32) || defined(SDL_PLATFORM_WINGDK)
+#define HAVE_HIDAPI_READ_WAIT
+extern void *SDL_hid_get_read_event(SDL_hid_device *device);
+#endif
 #endif /* SDL_JOYSTICK_HIDAPI */
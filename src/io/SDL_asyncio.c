@@ -85,60 +85,225 @@ Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return asyncio->iface.size(asyncio->userdata);
 }
 
-static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+// Finished tasks are kept to be reused, so busy apps don't go to the allocator for every request.
+#define SDL_ASYNCIO_TASK_POOL_MAX 256
+
+// The most tasks handed to the backend in one go; bigger batches are split up.
+#define SDL_ASYNCIO_MAX_BATCH 64
+
+static SDL_SpinLock task_pool_lock;
+static SDL_AsyncIOTask *task_pool;  // linked through asyncionext, which isn't used while a task is pooled.
+static int task_pool_count;
+
+static SDL_AsyncIOTask *AllocateAsyncIOTask(void)
 {
-    if (!asyncio) {
-        return SDL_InvalidParamError("asyncio");
-    } else if (!ptr) {
-        return SDL_InvalidParamError("ptr");
-    } else if (!queue) {
-        return SDL_InvalidParamError("queue");
+    SDL_LockSpinlock(&task_pool_lock);
+    SDL_AsyncIOTask *task = task_pool;
+    if (task) {
+        task_pool = task->asyncionext;
+        task_pool_count--;
     }
+    SDL_UnlockSpinlock(&task_pool_lock);
 
-    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
-    if (!task) {
-        return false;
+    if (task) {
+        SDL_zerop(task);
+    } else {
+        task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+    }
+    return task;
+}
+
+static void FreeAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_LockSpinlock(&task_pool_lock);
+    if (task_pool_count < SDL_ASYNCIO_TASK_POOL_MAX) {
+        task->asyncionext = task_pool;
+        task_pool = task;
+        task_pool_count++;
+        task = NULL;
+    }
+    SDL_UnlockSpinlock(&task_pool_lock);
+
+    SDL_free(task);  // pool is full, or NULL if it was pooled.
+}
+
+static void FreeAsyncIOTaskPool(void)
+{
+    SDL_LockSpinlock(&task_pool_lock);
+    SDL_AsyncIOTask *task = task_pool;
+    task_pool = NULL;
+    task_pool_count = 0;
+    SDL_UnlockSpinlock(&task_pool_lock);
+
+    while (task) {
+        SDL_AsyncIOTask *next = task->asyncionext;
+        SDL_free(task);
+        task = next;
+    }
+}
+
+// you must hold asyncio->lock when calling this! Queues the close task if a close was requested and nothing else is pending.
+static void QueuePendingClose(SDL_AsyncIO *asyncio)
+{
+    SDL_AsyncIOTask *closing = asyncio->closing;
+    if (closing && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) {
+        LINKED_LIST_PREPEND(closing, asyncio->tasks, asyncio);
+        SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1);
+        const bool async_close_task_was_queued = asyncio->iface.close(asyncio->userdata, closing);
+        SDL_assert(async_close_task_was_queued);  // !!! FIXME: if this fails to queue the task, we're leaking resources!
+        if (!async_close_task_was_queued) {
+            SDL_AddAtomicInt(&closing->queue->tasks_inflight, -1);
+        }
     }
+}
+
+// Starts up to SDL_ASYNCIO_MAX_BATCH requests, returns how many started.
+static int StartAsyncIOTasks(bool reading, SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue, SDL_AsyncIOFinishCallback finish, void *finish_userdata)
+{
+    SDL_AsyncIOTask *tasks[SDL_ASYNCIO_MAX_BATCH];
+    SDL_AsyncIOTask *task;
+    int i, started;
+
+    SDL_assert(count <= SDL_arraysize(tasks));
 
-    task->asyncio = asyncio;
-    task->type = reading ? SDL_ASYNCIO_TASK_READ : SDL_ASYNCIO_TASK_WRITE;
-    task->offset = offset;
-    task->buffer = ptr;
-    task->requested_size = size;
-    task->app_userdata = userdata;
-    task->queue = queue;
+    for (i = 0; i < count; i++) {
+        task = AllocateAsyncIOTask();
+        if (!task) {
+            while (i--) {
+                FreeAsyncIOTask(tasks[i]);
+            }
+            return 0;
+        }
+        task->asyncio = asyncio;
+        task->type = reading ? SDL_ASYNCIO_TASK_READ : SDL_ASYNCIO_TASK_WRITE;
+        task->offset = requests[i].offset;
+        task->buffer = requests[i].buffer;
+        task->requested_size = requests[i].size;
+        task->app_userdata = requests[i].userdata;
+        task->finish = finish;
+        task->finish_userdata = finish_userdata;
+        task->queue = queue;
+        tasks[i] = task;
+    }
 
+    // Do all the bookkeeping up front, so the asyncio lock is never taken while the backend is holding its submission lock.
     SDL_LockMutex(asyncio->lock);
     if (asyncio->closing) {
-        SDL_free(task);
         SDL_UnlockMutex(asyncio->lock);
-        return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+        for (i = 0; i < count; i++) {
+            FreeAsyncIOTask(tasks[i]);
+        }
+        SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+        return 0;
     }
-    LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
-    SDL_AddAtomicInt(&queue->tasks_inflight, 1);
+    for (i = 0; i < count; i++) {
+        task = tasks[i];
+        LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
+    }
+    SDL_AddAtomicInt(&queue->tasks_inflight, count);
     SDL_UnlockMutex(asyncio->lock);
 
-    const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
-    if (!queued) {
-        SDL_AddAtomicInt(&queue->tasks_inflight, -1);
+    // Once a task is handed to the backend it might complete and be freed at any moment, so don't touch it after that.
+    if (queue->iface.begin_batch) {
+        queue->iface.begin_batch(queue->userdata);
+    }
+    for (started = 0; started < count; started++) {
+        task = tasks[started];
+        const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
+        if (!queued) {
+            break;
+        }
+    }
+    if (queue->iface.end_batch) {
+        queue->iface.end_batch(queue->userdata);
+    }
+
+    if (started < count) {
+        SDL_AddAtomicInt(&queue->tasks_inflight, -(count - started));
         SDL_LockMutex(asyncio->lock);
-        LINKED_LIST_UNLINK(task, asyncio);
+        for (i = started; i < count; i++) {
+            task = tasks[i];
+            LINKED_LIST_UNLINK(task, asyncio);
+        }
+        QueuePendingClose(asyncio);  // in case a close came in while these were being started.
         SDL_UnlockMutex(asyncio->lock);
-        SDL_free(task);
-        task = NULL;
+        for (i = started; i < count; i++) {
+            FreeAsyncIOTask(tasks[i]);
+        }
     }
 
-    return (task != NULL);
+    return started;
+}
+
+static int RequestAsyncIOBatch(bool reading, SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue, SDL_AsyncIOFinishCallback finish, void *finish_userdata)
+{
+    if (!asyncio) {
+        SDL_InvalidParamError("asyncio");
+        return 0;
+    } else if (count < 0 || (count > 0 && !requests)) {
+        SDL_InvalidParamError("requests");
+        return 0;
+    } else if (!queue) {
+        SDL_InvalidParamError("queue");
+        return 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (!requests[i].buffer) {
+            SDL_InvalidParamError("requests");
+            return 0;
+        }
+    }
+
+    int started = 0;
+    while (started < count) {
+        const int batch = SDL_min(count - started, SDL_ASYNCIO_MAX_BATCH);
+        const int rc = StartAsyncIOTasks(reading, asyncio, requests + started, batch, queue, finish, finish_userdata);
+        started += rc;
+        if (rc < batch) {
+            break;
+        }
+    }
+    return started;
+}
+
+static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, SDL_AsyncIOFinishCallback finish, void *finish_userdata)
+{
+    if (!ptr) {
+        return SDL_InvalidParamError("ptr");
+    }
+
+    SDL_AsyncIORequest request;
+    request.buffer = ptr;
+    request.offset = offset;
+    request.size = size;
+    request.userdata = userdata;
+    return (RequestAsyncIOBatch(reading, asyncio, &request, 1, queue, finish, finish_userdata) == 1);
 }
 
 bool SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
-    return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata);
+    return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata, NULL, NULL);
+}
+
+bool SDL_ReadAsyncIOWithFinish(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, SDL_AsyncIOFinishCallback finish, void *finish_userdata)
+{
+    return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata, finish, finish_userdata);
 }
 
 bool SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
-    return RequestAsyncIO(false, asyncio, ptr, offset, size, queue, userdata);
+    return RequestAsyncIO(false, asyncio, ptr, offset, size, queue, userdata, NULL, NULL);
+}
+
+int SDL_ReadAsyncIOBatch(SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue)
+{
+    return RequestAsyncIOBatch(true, asyncio, requests, count, queue, NULL, NULL);
+}
+
+int SDL_WriteAsyncIOBatch(SDL_AsyncIO *asyncio, const SDL_AsyncIORequest *requests, int count, SDL_AsyncIOQueue *queue)
+{
+    return RequestAsyncIOBatch(false, asyncio, requests, count, queue, NULL, NULL);
 }
 
 bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue, void *userdata)
@@ -155,7 +320,7 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
         return SDL_SetError("Already closing");
     }
 
-    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+    SDL_AsyncIOTask *task = AllocateAsyncIOTask();
     if (task) {
         task->asyncio = asyncio;
         task->type = SDL_ASYNCIO_TASK_CLOSE;
@@ -172,7 +337,7 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
                 // uhoh, maybe they can try again later...?
                 SDL_AddAtomicInt(&queue->tasks_inflight, -1);
                 LINKED_LIST_UNLINK(task, asyncio);
-                SDL_free(task);
+                FreeAsyncIOTask(task);
                 task = asyncio->closing = NULL;
             }
         }
@@ -183,11 +348,237 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
     return (task != NULL);
 }
 
+// SDL_SaveFileAsync writes to a temporary file on a private queue. A thread
+// waits on that queue, renames the temporary file over the real one once it
+// has been flushed and closed, and then hands the result to the app's queue.
+struct SDL_AsyncIOSave
+{
+    char *file;
+    char *tmpfile;
+    void *data;
+    Uint64 size;
+    SDL_AsyncIOQueue *queue;
+    void *userdata;
+    SDL_AsyncIOResult result;
+    Uint64 bytes_transferred;
+    bool unclosed;             // the close couldn't be started, so the write result is all we'll get.
+    SDL_AsyncIOSave *pending;  // the next save of the same file, waiting for this one to finish.
+    SDL_AsyncIOSave *next;     // the next save in flight, or the next finished save on the app's queue.
+};
+
+static SDL_InitState save_init;
+static SDL_Mutex *save_lock;
+static SDL_Condition *save_cond;  // broadcast whenever a save finishes.
+static SDL_AsyncIOQueue *save_queue;
+static SDL_Thread *save_thread;
+static SDL_AsyncIOSave *saves_inflight;
+static bool save_quit;
+
+static void FreeAsyncIOSave(SDL_AsyncIOSave *save)
+{
+    SDL_free(save->file);
+    SDL_free(save->tmpfile);
+    SDL_free(save->data);
+    SDL_free(save);
+}
+
+// Hands the result of a save to the app. Call with the save lock held.
+static void ReportAsyncIOSave(SDL_AsyncIOSave *save)
+{
+    SDL_AsyncIOSave **tail = &save->queue->finished_saves;
+
+    SDL_free(save->data);  // the data isn't needed anymore, don't hold onto it until the app asks.
+    save->data = NULL;
+    save->next = NULL;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = save;
+    SDL_AddAtomicInt(&save->queue->saves_inflight, -1);
+}
+
+// Starts writing a save to its temporary file. Call with the save lock held.
+static bool StartAsyncIOSave(SDL_AsyncIOSave *save)
+{
+    SDL_AsyncIO *asyncio = SDL_AsyncIOFromFile(save->tmpfile, "w");
+    if (!asyncio) {
+        return false;
+    }
+
+    if (!SDL_WriteAsyncIO(asyncio, save->data, 0, save->size, save_queue, save)) {
+        SDL_CloseAsyncIO(asyncio, false, save_queue, NULL);  // if this fails, we'll have a resource leak, but this would already be a dramatic system failure.
+        return false;
+    }
+
+    // The close flushes the data to disk, so it's safe to rename the file once the close completes.
+    if (!SDL_CloseAsyncIO(asyncio, true, save_queue, save)) {
+        // the write is already on its way and will report back, so fail the save when it does.
+        save->unclosed = true;
+    }
+
+    save->next = saves_inflight;
+    saves_inflight = save;
+    return true;
+}
+
+static int SDLCALL AsyncIOSaveThread(void *unused)
+{
+    SDL_AsyncIOOutcome outcome;
+
+    while (true) {
+        if (!SDL_WaitAsyncIOResult(save_queue, &outcome, -1)) {
+            SDL_LockMutex(save_lock);
+            const bool done = (save_quit && !saves_inflight);
+            SDL_UnlockMutex(save_lock);
+            if (done) {
+                break;
+            }
+            continue;
+        }
+
+        SDL_AsyncIOSave *save = (SDL_AsyncIOSave *)outcome.userdata;
+        if (!save) {
+            continue;  // the close after a failed start.
+        } else if (outcome.type == SDL_ASYNCIO_TASK_WRITE) {
+            save->result = save->unclosed ? SDL_ASYNCIO_FAILURE : outcome.result;
+            save->bytes_transferred = outcome.bytes_transferred;
+            if (!save->unclosed) {
+                continue;  // wait for the close.
+            }
+        } else if ((save->result == SDL_ASYNCIO_COMPLETE) && (outcome.result != SDL_ASYNCIO_COMPLETE)) {
+            save->result = outcome.result;
+        }
+
+        // The close is done, so the data is on disk. Now replace the real file.
+        if ((save->result == SDL_ASYNCIO_COMPLETE) && !SDL_RenamePath(save->tmpfile, save->file)) {
+            save->result = SDL_ASYNCIO_FAILURE;
+        }
+        if (save->result != SDL_ASYNCIO_COMPLETE) {
+            SDL_RemovePath(save->tmpfile);
+        }
+
+        SDL_LockMutex(save_lock);
+        SDL_AsyncIOSave **prev = &saves_inflight;
+        while (*prev != save) {
+            prev = &(*prev)->next;
+        }
+        *prev = save->next;
+
+        SDL_AsyncIOSave *pending = save->pending;
+        ReportAsyncIOSave(save);
+        if (pending && !StartAsyncIOSave(pending)) {
+            pending->result = SDL_ASYNCIO_FAILURE;
+            ReportAsyncIOSave(pending);
+        }
+        SDL_BroadcastCondition(save_cond);
+        SDL_UnlockMutex(save_lock);
+    }
+    return 0;
+}
+
+static bool InitAsyncIOSaves(void)
+{
+    if (SDL_ShouldInit(&save_init)) {
+        save_quit = false;
+        save_lock = SDL_CreateMutex();
+        save_cond = SDL_CreateCondition();
+        save_queue = SDL_CreateAsyncIOQueue();
+        if (save_lock && save_cond && save_queue) {
+            save_thread = SDL_CreateThread(AsyncIOSaveThread, "SDLAsyncSave", NULL);
+        }
+        const bool initialized = (save_thread != NULL);
+        if (!initialized) {
+            SDL_DestroyAsyncIOQueue(save_queue);
+            save_queue = NULL;
+            SDL_DestroyCondition(save_cond);
+            save_cond = NULL;
+            SDL_DestroyMutex(save_lock);
+            save_lock = NULL;
+        }
+        SDL_SetInitialized(&save_init, initialized);
+        if (!initialized) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void QuitAsyncIOSaves(void)
+{
+    if (!SDL_ShouldQuit(&save_init)) {
+        return;
+    }
+
+    // the thread finishes any saves still in progress before it stops.
+    SDL_LockMutex(save_lock);
+    save_quit = true;
+    SDL_UnlockMutex(save_lock);
+    SDL_SignalAsyncIOQueue(save_queue);
+    SDL_WaitThread(save_thread, NULL);
+    save_thread = NULL;
+
+    SDL_DestroyAsyncIOQueue(save_queue);
+    save_queue = NULL;
+    SDL_DestroyCondition(save_cond);
+    save_cond = NULL;
+    SDL_DestroyMutex(save_lock);
+    save_lock = NULL;
+
+    SDL_SetInitialized(&save_init, false);
+}
+
+static bool GetFinishedAsyncIOSave(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_AsyncIOSave *save;
+
+    SDL_LockMutex(save_lock);
+    save = queue->finished_saves;
+    if (save) {
+        queue->finished_saves = save->next;
+    }
+    SDL_UnlockMutex(save_lock);
+
+    if (!save) {
+        return false;
+    }
+
+    SDL_zerop(outcome);
+    outcome->type = SDL_ASYNCIO_TASK_WRITE;
+    outcome->result = save->result;
+    outcome->bytes_requested = save->size;
+    outcome->bytes_transferred = save->bytes_transferred;
+    outcome->userdata = save->userdata;
+    FreeAsyncIOSave(save);
+    return true;
+}
+
+bool SDL_WaitForAsyncSaves(Sint32 timeoutMS)
+{
+    const Uint64 end = (timeoutMS < 0) ? 0 : (SDL_GetTicks() + (Uint64)timeoutMS);
+    bool done;
+
+    SDL_LockMutex(save_lock);
+    while (!(done = (saves_inflight == NULL))) {
+        if (timeoutMS < 0) {
+            SDL_WaitCondition(save_cond, save_lock);
+        } else {
+            const Uint64 now = SDL_GetTicks();
+            if (now >= end) {
+                break;
+            }
+            SDL_WaitConditionTimeout(save_cond, save_lock, (Sint32)(end - now));
+        }
+    }
+    SDL_UnlockMutex(save_lock);
+    return done;
+}
+
 SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
 {
     SDL_AsyncIOQueue *queue = SDL_calloc(1, sizeof (*queue));
     if (queue) {
         SDL_SetAtomicInt(&queue->tasks_inflight, 0);
+        SDL_SetAtomicInt(&queue->saves_inflight, 0);
         if (!SDL_SYS_CreateAsyncIOQueue(queue)) {
             SDL_free(queue);
             return NULL;
@@ -202,6 +593,8 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
         return false;
     }
 
+    SDL_TRACE_ZONE_BEGIN(zone, "SDL_AsyncIO completion");
+
     SDL_AsyncIO *asyncio = task->asyncio;
 
     SDL_zerop(outcome);
@@ -213,20 +606,17 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     outcome->bytes_requested = task->requested_size;
     outcome->bytes_transferred = task->result_size;
     outcome->userdata = task->app_userdata;
+    if (task->finish) {
+        task->finish(task->finish_userdata, outcome);
+    }
 
     // Take the completed task out of the SDL_AsyncIO that created it.
     SDL_LockMutex(asyncio->lock);
     LINKED_LIST_UNLINK(task, asyncio);
     // see if it's time to queue a pending close request (close requested and no other pending tasks)
     SDL_AsyncIOTask *closing = asyncio->closing;
-    if (closing && (task != closing) && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) {
-        LINKED_LIST_PREPEND(closing, asyncio->tasks, asyncio);
-        SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1);
-        const bool async_close_task_was_queued = asyncio->iface.close(asyncio->userdata, closing);
-        SDL_assert(async_close_task_was_queued);  // !!! FIXME: if this fails to queue the task, we're leaking resources!
-        if (!async_close_task_was_queued) {
-            SDL_AddAtomicInt(&closing->queue->tasks_inflight, -1);
-        }
+    if (task != closing) {
+        QueuePendingClose(asyncio);
     }
     SDL_UnlockMutex(task->asyncio->lock);
 
@@ -242,7 +632,9 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     }
 
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
-    SDL_free(task);
+    FreeAsyncIOTask(task);
+
+    SDL_TRACE_ZONE_END(zone);
 
     return retval;
 }
@@ -251,6 +643,8 @@ bool SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
 {
     if (!queue || !outcome) {
         return false;
+    } else if (GetFinishedAsyncIOSave(queue, outcome)) {
+        return true;
     }
     return GetAsyncIOTaskOutcome(queue->iface.get_results(queue->userdata), outcome);
 }
@@ -259,8 +653,32 @@ bool SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome,
 {
     if (!queue || !outcome) {
         return false;
+    } else if (GetFinishedAsyncIOSave(queue, outcome)) {
+        return true;
+    } else if (SDL_GetAtomicInt(&queue->saves_inflight) == 0) {
+        return GetAsyncIOTaskOutcome(queue->iface.wait_results(queue->userdata, timeoutMS), outcome);
+    }
+
+    // Saves finish on another queue, so nothing wakes this one when they do. Wait a little at a time and check for them in between.
+    const Uint64 end = (timeoutMS < 0) ? 0 : (SDL_GetTicks() + (Uint64)timeoutMS);
+    while (true) {
+        Sint32 wait = 10;
+        if (timeoutMS >= 0) {
+            const Uint64 now = SDL_GetTicks();
+            if (now >= end) {
+                return false;
+            }
+            wait = (Sint32)SDL_min(end - now, 10);
+        }
+        SDL_AsyncIOTask *task = queue->iface.wait_results(queue->userdata, wait);
+        if (task) {
+            return GetAsyncIOTaskOutcome(task, outcome);
+        } else if (GetFinishedAsyncIOSave(queue, outcome)) {
+            return true;
+        } else if (SDL_GetAtomicInt(&queue->saves_inflight) == 0) {
+            return false;
+        }
     }
-    return GetAsyncIOTaskOutcome(queue->iface.wait_results(queue->userdata, timeoutMS), outcome);
 }
 
 void SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
@@ -286,6 +704,16 @@ void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
             }
         }
 
+        // saves still in progress would report to this queue, so let them finish, then throw away their results.
+        SDL_LockMutex(save_lock);
+        while (SDL_GetAtomicInt(&queue->saves_inflight) > 0) {
+            SDL_WaitCondition(save_cond, save_lock);
+        }
+        SDL_UnlockMutex(save_lock);
+        SDL_AsyncIOOutcome outcome;
+        while (GetFinishedAsyncIOSave(queue, &outcome)) {
+        }
+
         queue->iface.destroy(queue->userdata);
         SDL_free(queue);
     }
@@ -293,7 +721,9 @@ void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
 
 void SDL_QuitAsyncIO(void)
 {
+    QuitAsyncIOSaves();
     SDL_SYS_QuitAsyncIO();
+    FreeAsyncIOTaskPool();
 }
 
 bool SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata)
@@ -329,3 +759,59 @@ bool SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata
     return retval;
 }
 
+bool SDL_SaveFileAsync(const char *file, const void *data, size_t datasize, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    if (!file) {
+        return SDL_InvalidParamError("file");
+    } else if (!data && datasize > 0) {
+        return SDL_InvalidParamError("data");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (!InitAsyncIOSaves()) {
+        return false;
+    }
+
+    SDL_AsyncIOSave *save = (SDL_AsyncIOSave *)SDL_calloc(1, sizeof(*save));
+    if (!save) {
+        return false;
+    }
+    save->file = SDL_strdup(file);
+    save->data = SDL_malloc(datasize);
+    if (!save->file || !save->data || SDL_asprintf(&save->tmpfile, "%s.tmp", file) < 0) {
+        FreeAsyncIOSave(save);
+        return false;
+    }
+    if (datasize > 0) {
+        SDL_memcpy(save->data, data, datasize);
+    }
+    save->size = datasize;
+    save->queue = queue;
+    save->userdata = userdata;
+    save->result = SDL_ASYNCIO_COMPLETE;
+
+    bool retval = true;
+    SDL_LockMutex(save_lock);
+    SDL_AddAtomicInt(&queue->saves_inflight, 1);
+
+    // If this file is already being saved, wait for that to finish. Anything else that was waiting is out of date now.
+    SDL_AsyncIOSave *inflight;
+    for (inflight = saves_inflight; inflight; inflight = inflight->next) {
+        if (SDL_strcmp(inflight->file, file) == 0) {
+            break;
+        }
+    }
+    if (inflight) {
+        if (inflight->pending) {
+            inflight->pending->result = SDL_ASYNCIO_CANCELED;
+            ReportAsyncIOSave(inflight->pending);
+        }
+        inflight->pending = save;
+    } else if (!StartAsyncIOSave(save)) {
+        SDL_AddAtomicInt(&queue->saves_inflight, -1);
+        FreeAsyncIOSave(save);
+        retval = false;
+    }
+    SDL_UnlockMutex(save_lock);
+
+    return retval;
+}
@@ -26,5 +26,14 @@
 // Shutdown any still-existing Async I/O. Note that there is no Init function, as it inits on-demand!
 extern void SDL_QuitAsyncIO(void);
 
+// Block until every SDL_SaveFileAsync in progress has landed on disk, or the timeout passes. Returns false on timeout.
+extern bool SDL_WaitForAsyncSaves(Sint32 timeoutMS);
+
+// Called when the app picks up the result of a task, or when its queue is destroyed. It may adjust the outcome the app sees.
+typedef void (*SDL_AsyncIOFinishCallback)(void *userdata, SDL_AsyncIOOutcome *outcome);
+
+// SDL_ReadAsyncIO, but `finish` runs on the thread that collects the result, before the app sees it.
+extern bool SDL_ReadAsyncIOWithFinish(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, SDL_AsyncIOFinishCallback finish, void *finish_userdata);
+
 #endif // SDL_asyncio_c_h_
 
@@ -26,6 +26,13 @@
 #include <unistd.h>
 #endif
 
+#if defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #ifdef HAVE_STDIO_H
 #include <stdio.h>
 #include <errno.h>
@@ -67,11 +74,16 @@ struct SDL_IOStream
 typedef struct IOStreamWindowsData
 {
     HANDLE h;
+    SDL_PropertiesID props;
     void *data;
-    size_t size;
-    size_t left;
+    size_t capacity;
+    size_t size;       // bytes in the buffer, which end at the file pointer
+    size_t left;       // bytes in the buffer that haven't been read yet
+    size_t readahead;  // how much the next refill will read, grows while reading sequentially
+    Sint64 position;   // the handle's file pointer, or -1 if it isn't seekable
     bool append;
     bool autoclose;
+    bool sequential;
 } IOStreamWindowsData;
 
 
@@ -80,7 +92,9 @@ typedef struct IOStreamWindowsData
 #define INVALID_SET_FILE_POINTER 0xFFFFFFFF
 #endif
 
-#define READAHEAD_BUFFER_SIZE 1024
+#define READAHEAD_INITIAL_SIZE  4096
+#define READAHEAD_DEFAULT_LIMIT (64 * 1024)
+#define READAHEAD_MAXIMUM_LIMIT (16 * 1024 * 1024)
 
 static HANDLE SDLCALL windows_file_open(const char *filename, const char *mode)
 {
@@ -90,6 +104,7 @@ static HANDLE SDLCALL windows_file_open(const char *filename, const char *mode)
     HANDLE h;
     DWORD r_right, w_right;
     DWORD must_exist, truncate;
+    DWORD flags;
     int a_mode;
 
     // "r" = reading, file must exist
@@ -99,11 +114,14 @@ static HANDLE SDLCALL windows_file_open(const char *filename, const char *mode)
     // "a+"= append + read, file may not exist
     // "w+" = read, write, truncate. file may not exist
 
+    // "S" = the file will be read sequentially, as with the C runtime's fopen()
+
     must_exist = (SDL_strchr(mode, 'r') != NULL) ? OPEN_EXISTING : 0;
     truncate = (SDL_strchr(mode, 'w') != NULL) ? CREATE_ALWAYS : 0;
     r_right = (SDL_strchr(mode, '+') != NULL || must_exist) ? GENERIC_READ : 0;
     a_mode = (SDL_strchr(mode, 'a') != NULL) ? OPEN_ALWAYS : 0;
     w_right = (a_mode || SDL_strchr(mode, '+') || truncate) ? GENERIC_WRITE : 0;
+    flags = (SDL_strchr(mode, 'S') != NULL) ? FILE_FLAG_SEQUENTIAL_SCAN : 0;
 
     if (!r_right && !w_right) {
         return INVALID_HANDLE_VALUE; // inconsistent mode
@@ -122,6 +140,7 @@ static HANDLE SDLCALL windows_file_open(const char *filename, const char *mode)
         SDL_zero(extparams);
         extparams.dwSize = sizeof(extparams);
         extparams.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
+        extparams.dwFileFlags = flags;
         h = CreateFile2(str,
                         (w_right | r_right),
                         (w_right) ? 0 : FILE_SHARE_READ,
@@ -133,7 +152,7 @@ static HANDLE SDLCALL windows_file_open(const char *filename, const char *mode)
                        (w_right) ? 0 : FILE_SHARE_READ,
                        NULL,
                        (must_exist | truncate | a_mode),
-                       FILE_ATTRIBUTE_NORMAL,
+                       FILE_ATTRIBUTE_NORMAL | flags,
                        NULL);
 #endif
         SDL_free(str);
@@ -168,17 +187,49 @@ static Sint64 SDLCALL windows_file_size(void *userdata)
     return size.QuadPart;
 }
 
+static size_t windows_file_readahead_limit(IOStreamWindowsData *iodata)
+{
+    Sint64 limit = SDL_GetNumberProperty(iodata->props, SDL_PROP_IOSTREAM_WINDOWS_READAHEAD_SIZE_NUMBER, READAHEAD_DEFAULT_LIMIT);
+    return (size_t)SDL_clamp(limit, 0, READAHEAD_MAXIMUM_LIMIT);
+}
+
+static void windows_file_reset_readahead(IOStreamWindowsData *iodata)
+{
+    const size_t limit = windows_file_readahead_limit(iodata);
+
+    iodata->size = 0;
+    iodata->left = 0;
+    iodata->readahead = iodata->sequential ? limit : SDL_min(READAHEAD_INITIAL_SIZE, limit);
+}
+
 static Sint64 SDLCALL windows_file_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
 {
     IOStreamWindowsData *iodata = (IOStreamWindowsData *) userdata;
     DWORD windowswhence;
     LARGE_INTEGER windowsoffset;
 
-    // FIXME: We may be able to satisfy the seek within buffered data
+    // Seeks that land inside the buffer, including SDL_TellIO(), don't need the OS
+    if (iodata->position >= 0 && whence != SDL_IO_SEEK_END) {
+        const Sint64 buffer_start = iodata->position - (Sint64)iodata->size;
+        const Sint64 current = iodata->position - (Sint64)iodata->left;
+        Sint64 target;
+
+        if (whence == SDL_IO_SEEK_SET) {
+            target = offset;
+        } else if (offset <= SDL_MAX_SINT64 - current) {
+            target = current + offset;
+        } else {
+            target = -1;
+        }
+        if (target >= buffer_start && target <= iodata->position) {
+            iodata->left = (size_t)(iodata->position - target);
+            return target;
+        }
+    }
+
     if ((whence == SDL_IO_SEEK_CUR) && (iodata->left)) {
         offset -= iodata->left;
     }
-    iodata->left = 0;
 
     switch (whence) {
     case SDL_IO_SEEK_SET:
@@ -199,15 +250,41 @@ static Sint64 SDLCALL windows_file_seek(void *userdata, Sint64 offset, SDL_IOWhe
     if (!SetFilePointerEx(iodata->h, windowsoffset, &windowsoffset, windowswhence)) {
         return WIN_SetError("Error seeking in datastream");
     }
+    iodata->position = windowsoffset.QuadPart;
+    windows_file_reset_readahead(iodata);
     return windowsoffset.QuadPart;
 }
 
+static bool windows_file_readfile(IOStreamWindowsData *iodata, void *ptr, size_t size, DWORD *bytes, SDL_IOStatus *status)
+{
+    if (!ReadFile(iodata->h, ptr, (DWORD)SDL_min(size, 0xFFFFFFFF), bytes, NULL)) {
+        DWORD error = GetLastError();
+        switch (error) {
+        case ERROR_BROKEN_PIPE:
+        case ERROR_HANDLE_EOF:
+            break;
+        case ERROR_NO_DATA:
+            *status = SDL_IO_STATUS_NOT_READY;
+            break;
+        default:
+            WIN_SetError("Error reading from datastream");
+            break;
+        }
+        return false;
+    }
+    if (iodata->position >= 0) {
+        iodata->position += *bytes;
+    }
+    return true;
+}
+
 static size_t SDLCALL windows_file_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
 {
     IOStreamWindowsData *iodata = (IOStreamWindowsData *) userdata;
     size_t total_need = size;
     size_t total_read = 0;
     size_t read_ahead;
+    size_t limit;
     DWORD bytes;
 
     if (iodata->left > 0) {
@@ -226,42 +303,39 @@ static size_t SDLCALL windows_file_read(void *userdata, void *ptr, size_t size,
         total_read += read_ahead;
     }
 
-    if (total_need < READAHEAD_BUFFER_SIZE) {
-        if (!ReadFile(iodata->h, iodata->data, READAHEAD_BUFFER_SIZE, &bytes, NULL)) {
-            DWORD error = GetLastError();
-            switch (error) {
-            case ERROR_BROKEN_PIPE:
-            case ERROR_HANDLE_EOF:
-                break;
-            case ERROR_NO_DATA:
-                *status = SDL_IO_STATUS_NOT_READY;
-                break;
-            default:
-                WIN_SetError("Error reading from datastream");
-                break;
+    /* The buffer is used up, so this is a sequential read. Grow the read-ahead
+       a step at a time, and let reads that wouldn't fit go straight through. */
+    limit = windows_file_readahead_limit(iodata);
+    if (iodata->readahead > limit) {
+        iodata->readahead = limit;
+    }
+
+    if (total_need < iodata->readahead) {
+        if (iodata->capacity < iodata->readahead) {
+            void *data = SDL_realloc(iodata->data, iodata->readahead);
+            if (!data) {
+                return total_read;
             }
-            return 0;
+            iodata->data = data;
+            iodata->capacity = iodata->readahead;
+        }
+        iodata->size = 0;
+        if (!windows_file_readfile(iodata, iodata->data, iodata->readahead, &bytes, status)) {
+            return total_read;
         }
         read_ahead = SDL_min(total_need, bytes);
         SDL_memcpy(ptr, iodata->data, read_ahead);
         iodata->size = bytes;
         iodata->left = bytes - read_ahead;
         total_read += read_ahead;
+
+        if (bytes == iodata->readahead && iodata->readahead < limit) {
+            iodata->readahead = SDL_min(iodata->readahead * 2, limit);
+        }
     } else {
-        if (!ReadFile(iodata->h, ptr, (DWORD)total_need, &bytes, NULL)) {
-            DWORD error = GetLastError();
-            switch (error) {
-            case ERROR_BROKEN_PIPE:
-            case ERROR_HANDLE_EOF:
-                break;
-            case ERROR_NO_DATA:
-                *status = SDL_IO_STATUS_NOT_READY;
-                break;
-            default:
-                WIN_SetError("Error reading from datastream");
-                break;
-            }
-            return 0;
+        iodata->size = 0;
+        if (!windows_file_readfile(iodata, ptr, total_need, &bytes, status)) {
+            return total_read;
         }
         total_read += bytes;
     }
@@ -271,30 +345,42 @@ static size_t SDLCALL windows_file_read(void *userdata, void *ptr, size_t size,
 static size_t SDLCALL windows_file_write(void *userdata, const void *ptr, size_t size, SDL_IOStatus *status)
 {
     IOStreamWindowsData *iodata = (IOStreamWindowsData *) userdata;
+    LARGE_INTEGER windowsoffset;
     DWORD bytes;
 
     if (iodata->left) {
-        if (!SetFilePointer(iodata->h, -(LONG)iodata->left, NULL, FILE_CURRENT)) {
+        windowsoffset.QuadPart = -(LONGLONG)iodata->left;
+        if (!SetFilePointerEx(iodata->h, windowsoffset, &windowsoffset, FILE_CURRENT)) {
             WIN_SetError("Error seeking in datastream");
             return 0;
         }
-        iodata->left = 0;
+        if (iodata->position >= 0) {
+            iodata->position = windowsoffset.QuadPart;
+        }
     }
+    // the write would make the buffered data stale
+    iodata->size = 0;
+    iodata->left = 0;
 
     // if in append mode, we must go to the EOF before write
     if (iodata->append) {
-        LARGE_INTEGER windowsoffset;
         windowsoffset.QuadPart = 0;
         if (!SetFilePointerEx(iodata->h, windowsoffset, &windowsoffset, FILE_END)) {
             WIN_SetError("Error seeking in datastream");
             return 0;
         }
+        if (iodata->position >= 0) {
+            iodata->position = windowsoffset.QuadPart;
+        }
     }
 
     if (!WriteFile(iodata->h, ptr, (DWORD)size, &bytes, NULL)) {
         WIN_SetError("Error writing to datastream");
         return 0;
     }
+    if (iodata->position >= 0) {
+        iodata->position += bytes;
+    }
     if (bytes == 0 && size > 0) {
         *status = SDL_IO_STATUS_NOT_READY;
     }
@@ -336,7 +422,13 @@ SDL_IOStream *SDL_IOFromHandle(HANDLE handle, const char *mode, bool autoclose)
 
     SDL_IOStreamInterface iface;
     SDL_INIT_INTERFACE(&iface);
+    iodata->position = -1;
     if (GetFileType(handle) == FILE_TYPE_DISK) {
+        LARGE_INTEGER windowsoffset;
+        windowsoffset.QuadPart = 0;
+        if (SetFilePointerEx(handle, windowsoffset, &windowsoffset, FILE_CURRENT)) {
+            iodata->position = windowsoffset.QuadPart;
+        }
         iface.size = windows_file_size;
         iface.seek = windows_file_seek;
     }
@@ -348,12 +440,7 @@ SDL_IOStream *SDL_IOFromHandle(HANDLE handle, const char *mode, bool autoclose)
     iodata->h = handle;
     iodata->append = (SDL_strchr(mode, 'a') != NULL);
     iodata->autoclose = autoclose;
-
-    iodata->data = (char *)SDL_malloc(READAHEAD_BUFFER_SIZE);
-    if (!iodata->data) {
-        iface.close(iodata);
-        return NULL;
-    }
+    iodata->sequential = (SDL_strchr(mode, 'S') != NULL);
 
     SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
     if (!iostr) {
@@ -363,6 +450,9 @@ SDL_IOStream *SDL_IOFromHandle(HANDLE handle, const char *mode, bool autoclose)
         if (props) {
             SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_WINDOWS_HANDLE_POINTER, iodata->h);
         }
+        // the buffer is allocated on the first small read, once the read-ahead size is known
+        iodata->props = props;
+        windows_file_reset_readahead(iodata);
     }
 
     return iostr;
@@ -1018,6 +1108,145 @@ SDL_IOStream *SDL_IOFromConstMem(const void *mem, size_t size)
     return iostr;
 }
 
+// Functions to map a whole file into memory for reading
+
+typedef struct IOStreamMappedData
+{
+    IOStreamMemData data; // must be first, this is used by the mem_* functions
+#if defined(SDL_PLATFORM_WINDOWS)
+    HANDLE section;
+#endif
+} IOStreamMappedData;
+
+static bool SDLCALL mapped_close(void *userdata)
+{
+    IOStreamMappedData *iodata = (IOStreamMappedData *) userdata;
+
+#if defined(SDL_PLATFORM_WINDOWS)
+    UnmapViewOfFile(iodata->data.base);
+    CloseHandle(iodata->section);
+#else
+    munmap(iodata->data.base, (size_t)(iodata->data.stop - iodata->data.base));
+#endif
+    SDL_free(iodata);
+    return true;
+}
+
+SDL_IOStream *SDL_IOFromMappedFile(const char *file)
+{
+    IOStreamMappedData *iodata;
+    void *mem = NULL;
+    size_t size = 0;
+
+    if (!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+    iodata = (IOStreamMappedData *) SDL_calloc(1, sizeof (*iodata));
+    if (!iodata) {
+        return NULL;
+    }
+
+#if defined(SDL_PLATFORM_WINDOWS)
+    {
+        LARGE_INTEGER filesize;
+        HANDLE h = windows_file_open(file, "rb");
+        if (h == INVALID_HANDLE_VALUE) {
+            SDL_free(iodata);
+            return NULL;
+        }
+        if (!GetFileSizeEx(h, &filesize) || filesize.QuadPart == 0 || (Uint64)filesize.QuadPart > SDL_SIZE_MAX) {
+            SDL_SetError("Couldn't map %s", file);
+            CloseHandle(h);
+            SDL_free(iodata);
+            return NULL;
+        }
+        size = (size_t)filesize.QuadPart;
+
+        // Copy-on-write, so the mapped data can be modified without touching the file
+#if defined(SDL_PLATFORM_WINRT)
+        iodata->section = CreateFileMappingFromApp(h, NULL, PAGE_WRITECOPY, 0, NULL);
+        if (iodata->section) {
+            mem = MapViewOfFileFromApp(iodata->section, FILE_MAP_COPY, 0, 0);
+        }
+#else
+        iodata->section = CreateFileMappingW(h, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (iodata->section) {
+            mem = MapViewOfFile(iodata->section, FILE_MAP_COPY, 0, 0, 0);
+        }
+#endif
+        // The mapping keeps its own reference to the file
+        CloseHandle(h);
+
+        if (!mem) {
+            WIN_SetError("Couldn't map file");
+            if (iodata->section) {
+                CloseHandle(iodata->section);
+            }
+            SDL_free(iodata);
+            return NULL;
+        }
+    }
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+    {
+        struct stat st;
+        int fd = open(file, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            SDL_SetError("Couldn't open %s: %s", file, strerror(errno));
+            SDL_free(iodata);
+            return NULL;
+        }
+        if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0 || (Uint64)st.st_size > SDL_SIZE_MAX) {
+            SDL_SetError("Couldn't map %s", file);
+            close(fd);
+            SDL_free(iodata);
+            return NULL;
+        }
+        size = (size_t)st.st_size;
+
+        // Copy-on-write, so the mapped data can be modified without touching the file
+        mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        close(fd);
+
+        if (mem == MAP_FAILED) {
+            SDL_SetError("Couldn't map %s: %s", file, strerror(errno));
+            SDL_free(iodata);
+            return NULL;
+        }
+    }
+#else
+    SDL_free(iodata);
+    SDL_Unsupported();
+    return NULL;
+#endif
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = mem_size;
+    iface.seek = mem_seek;
+    iface.read = mem_read;
+    // leave iface.write as NULL, the file is opened for reading.
+    iface.close = mapped_close;
+
+    iodata->data.base = (Uint8 *)mem;
+    iodata->data.here = iodata->data.base;
+    iodata->data.stop = iodata->data.base + size;
+
+    SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        mapped_close(iodata);
+    } else {
+        const SDL_PropertiesID props = SDL_GetIOProperties(iostr);
+        if (props) {
+            SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, mem);
+            SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, size);
+        }
+    }
+    return iostr;
+}
+
 typedef struct IOStreamDynamicMemData
 {
     SDL_IOStream *stream;
@@ -1344,6 +1573,31 @@ Sint64 SDL_TellIO(SDL_IOStream *context)
     return SDL_SeekIO(context, 0, SDL_IO_SEEK_CUR);
 }
 
+const void *SDL_GetIOPointer(SDL_IOStream *context, Sint64 offset, size_t size)
+{
+    const IOStreamMemData *iodata;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    } else if (context->iface.read != mem_read) {
+        // Memory, const memory and mapped file streams all share mem_read and IOStreamMemData
+        SDL_SetError("Stream isn't backed by memory");
+        return NULL;
+    } else if (offset < 0) {
+        SDL_InvalidParamError("offset");
+        return NULL;
+    }
+
+    iodata = (const IOStreamMemData *)context->userdata;
+    if ((Uint64)offset > (Uint64)(iodata->stop - iodata->base) ||
+        size > (size_t)(iodata->stop - iodata->base) - (size_t)offset) {
+        SDL_SetError("Range is past the end of the stream");
+        return NULL;
+    }
+    return iodata->base + offset;
+}
+
 size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
 {
     size_t bytes;
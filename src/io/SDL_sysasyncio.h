@@ -24,17 +24,24 @@
 #ifndef SDL_sysasyncio_h_
 #define SDL_sysasyncio_h_
 
+#include "SDL_asyncio_c.h"
+
 #if defined(SDL_PLATFORM_WINDOWS) && defined(NTDDI_WIN10_NI)
 #if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_APP) && NTDDI_VERSION >= NTDDI_WIN10_NI
 #define HAVE_IORINGAPI_H
 #endif
 #endif
 
+// Overlapped i/o with a completion port works everywhere on Windows, including UWP and Xbox.
+#ifdef SDL_PLATFORM_WINDOWS
+#define HAVE_WINDOWS_IOCP
+#endif
+
 // If your platform has an option other than the "generic" code, make sure this
 // is #defined to 0 instead and implement the SDL_SYS_* functions below in your
 // backend (having them maybe call into the SDL_SYS_*_Generic versions as a
 // fallback if the platform has functionality that isn't always available).
-#if defined(HAVE_LIBURING_H) || defined(HAVE_IORINGAPI_H)
+#if defined(HAVE_LIBURING_H) || defined(HAVE_IORINGAPI_H) || defined(HAVE_WINDOWS_IOCP)
 #define SDL_ASYNCIO_ONLY_HAVE_GENERIC 0
 #else
 #define SDL_ASYNCIO_ONLY_HAVE_GENERIC 1
@@ -81,6 +88,8 @@ struct SDL_AsyncIOTask
     Uint64 requested_size;
     Uint64 result_size;
     void *app_userdata;
+    SDL_AsyncIOFinishCallback finish;
+    void *finish_userdata;
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, threadpool); // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -94,13 +103,20 @@ typedef struct SDL_AsyncIOQueueInterface
     SDL_AsyncIOTask * (*wait_results)(void *userdata, Sint32 timeoutMS);
     void (*signal)(void *userdata);
     void (*destroy)(void *userdata);
+    // Optional: tasks queued between these calls may be held back and handed to the system all at once by end_batch.
+    void (*begin_batch)(void *userdata);
+    void (*end_batch)(void *userdata);
 } SDL_AsyncIOQueueInterface;
 
+typedef struct SDL_AsyncIOSave SDL_AsyncIOSave;
+
 struct SDL_AsyncIOQueue
 {
     SDL_AsyncIOQueueInterface iface;
     void *userdata;
     SDL_AtomicInt tasks_inflight;
+    SDL_AtomicInt saves_inflight;    // SDL_SaveFileAsync calls that will report to this queue but haven't yet.
+    SDL_AsyncIOSave *finished_saves; // SDL_SaveFileAsync results waiting to be picked up, protected by the save lock.
 };
 
 // this interface is kept per-object, even though generally it's going to decide
@@ -140,5 +156,14 @@ extern bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode,
 extern bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue);
 extern void SDL_SYS_QuitAsyncIO_Generic(void);
 
+// Backends can pair their own files with the "generic" queues by handing finished tasks to this.
+extern void SDL_SYS_CompleteAsyncIOTask_Generic(SDL_AsyncIOTask *task);
+
+#ifdef HAVE_WINDOWS_IOCP
+// Files using overlapped i/o and a completion port, with results on "generic" queues. This also quits the generic backend.
+extern bool SDL_SYS_AsyncIOFromFile_IOCP(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+extern void SDL_SYS_QuitAsyncIO_IOCP(void);
+#endif
+
 #endif
 
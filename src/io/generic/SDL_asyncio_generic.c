@@ -106,75 +106,48 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
 }
 
 #if SDL_ASYNCIO_USE_THREADPOOL
+// The i/o runs on the SDL job pool. Each queued task gets a job, and each job
+// runs whatever task is next in line, so tasks can still be canceled until a
+// job picks them up.
 static SDL_InitState threadpool_init;
 static SDL_Mutex *threadpool_lock = NULL;
 static bool stop_threadpool = false;
 static SDL_AsyncIOTask threadpool_tasks;
-static SDL_Condition *threadpool_condition = NULL;
-static int max_threadpool_threads = 0;
-static int running_threadpool_threads = 0;
-static int idle_threadpool_threads = 0;
-static int threadpool_threads_spun = 0;
+static SDL_JobCounter *threadpool_jobs = NULL;
+static int threadpool_batching = 0;      // protected by threadpool_lock, which is held for the whole batch.
+static int threadpool_batched_tasks = 0;  // tasks queued during the current batch, which don't have jobs yet.
 
-static int SDLCALL AsyncIOThreadpoolWorker(void *data)
+static void SDLCALL AsyncIOThreadpoolJob(void *data)
 {
     SDL_LockMutex(threadpool_lock);
-
-    while (!stop_threadpool) {
-        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
-        if (!task) {
-            // if we go 30 seconds without a new task, terminate unless we're the only thread left.
-            idle_threadpool_threads++;
-            const bool rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, 30000);
-            idle_threadpool_threads--;
-
-            if (!rc) {
-                // decide if we have too many idle threads, and if so, quit to let thread pool shrink when not busy.
-                if (idle_threadpool_threads) {
-                    break;
-                }
-            }
-
-            continue;
-        }
-
+    SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
+    if (task) {
         LINKED_LIST_UNLINK(task, threadpool);
-
-        SDL_UnlockMutex(threadpool_lock);
-
-        // bookkeeping is done, so we drop the mutex and fire the work.
-        SynchronousIO(task);
-
-        SDL_LockMutex(threadpool_lock);  // take the lock again and see if there's another task (if not, we'll wait on the Condition).
     }
-
-    running_threadpool_threads--;
-
-    // this is kind of a hack, but this lets us reuse threadpool_condition to block on shutdown until all threads have exited.
-    if (stop_threadpool) {
-        SDL_BroadcastCondition(threadpool_condition);
-    }
-
     SDL_UnlockMutex(threadpool_lock);
 
-    return 0;
+    // bookkeeping is done, so we drop the mutex and fire the work.
+    if (task) {
+        SynchronousIO(task);
+    }
 }
 
-static bool MaybeSpinNewWorkerThread(void)
+// A batch gets a few jobs that each keep running tasks until there are none left, instead of a job per task.
+static void SDLCALL AsyncIOThreadpoolBatchJob(void *data)
 {
-    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
-    if ((idle_threadpool_threads == 0) && (running_threadpool_threads < max_threadpool_threads)) {
-        char threadname[32];
-        SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
-        SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, NULL);
-        if (thread == NULL) {
-            return false;
+    for (;;) {
+        SDL_LockMutex(threadpool_lock);
+        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
+        if (task) {
+            LINKED_LIST_UNLINK(task, threadpool);
+        }
+        SDL_UnlockMutex(threadpool_lock);
+
+        if (!task) {
+            break;
         }
-        SDL_DetachThread(thread);  // these terminate themselves when idle too long, so we never WaitThread.
-        running_threadpool_threads++;
-        threadpool_threads_spun++;
+        SynchronousIO(task);
     }
-    return true;
 }
 
 static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
@@ -186,20 +159,53 @@ static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
     if (stop_threadpool) {  // just in case.
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
+    } else if (threadpool_batching) {
+        LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
+        threadpool_batched_tasks++;  // jobs get submitted when the batch ends.
     } else {
         LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
-        MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
-
-        // tell idle threads to get to work.
-        // This is a broadcast because we want someone from the thread pool to wake up, but
-        // also shutdown might also be blocking on this. One of the threads will grab
-        // it, the others will go back to sleep.
-        SDL_BroadcastCondition(threadpool_condition);
+        if (!SDL_SubmitJob(AsyncIOThreadpoolJob, NULL, threadpool_jobs)) {
+            // couldn't get a job to run it, so fail the task.
+            LINKED_LIST_UNLINK(task, threadpool);
+            task->result = SDL_ASYNCIO_FAILURE;
+            AsyncIOTaskComplete(task);
+        }
     }
 
     SDL_UnlockMutex(threadpool_lock);
 }
 
+static void BeginThreadpoolBatch(void)
+{
+    SDL_LockMutex(threadpool_lock);  // held until EndThreadpoolBatch, so jobs can't start on half a batch.
+    threadpool_batching++;
+}
+
+static void EndThreadpoolBatch(void)
+{
+    if (--threadpool_batching == 0 && threadpool_batched_tasks > 0) {
+        const int num_jobs = SDL_max(SDL_min(threadpool_batched_tasks, SDL_GetNumJobThreads()), 1);
+        int submitted = 0;
+        for (int i = 0; i < num_jobs; i++) {
+            if (SDL_SubmitJob(AsyncIOThreadpoolBatchJob, NULL, threadpool_jobs)) {
+                submitted++;
+            }
+        }
+
+        if (!submitted) {
+            // couldn't get any jobs to run them, so fail the batch. They were prepended, so they're at the front of the list.
+            for (int i = 0; i < threadpool_batched_tasks; i++) {
+                SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
+                LINKED_LIST_UNLINK(task, threadpool);
+                task->result = SDL_ASYNCIO_FAILURE;
+                AsyncIOTaskComplete(task);
+            }
+        }
+        threadpool_batched_tasks = 0;
+    }
+    SDL_UnlockMutex(threadpool_lock);
+}
+
 // We don't initialize async i/o at all until it's used, so
 //  JUST IN CASE two things try to start at the same time,
 //  this will make sure everything gets the same mutex.
@@ -207,17 +213,13 @@ static bool PrepareThreadpool(void)
 {
     bool okay = true;
     if (SDL_ShouldInit(&threadpool_init)) {
-        max_threadpool_threads = (SDL_GetNumLogicalCPUCores() * 2) + 1;  // !!! FIXME: this should probably have a hint to override.
-        max_threadpool_threads = SDL_clamp(max_threadpool_threads, 1, 8);  // 8 is probably more than enough.
-
         okay = (okay && ((threadpool_lock = SDL_CreateMutex()) != NULL));
-        okay = (okay && ((threadpool_condition = SDL_CreateCondition()) != NULL));
-        okay = (okay && MaybeSpinNewWorkerThread());  // make sure at least one thread is going, since we'll need it.
+        okay = (okay && ((threadpool_jobs = SDL_CreateJobCounter()) != NULL));
 
         if (!okay) {
-            if (threadpool_condition) {
-                SDL_DestroyCondition(threadpool_condition);
-                threadpool_condition = NULL;
+            if (threadpool_jobs) {
+                SDL_DestroyJobCounter(threadpool_jobs);
+                threadpool_jobs = NULL;
             }
             if (threadpool_lock) {
                 SDL_DestroyMutex(threadpool_lock);
@@ -244,22 +246,16 @@ static void ShutdownThreadpool(void)
         }
 
         stop_threadpool = true;
-        SDL_BroadcastCondition(threadpool_condition);  // tell the whole threadpool to wake up and quit.
-
-        while (running_threadpool_threads > 0) {
-            // each threadpool thread will broadcast this condition before it terminates if stop_threadpool is set.
-            // we can't just join the threads because they are detached, so the thread pool can automatically shrink as necessary.
-            SDL_WaitCondition(threadpool_condition, threadpool_lock);
-        }
 
         SDL_UnlockMutex(threadpool_lock);
 
+        // wait for any i/o in flight to finish. The jobs that don't have a task anymore return right away.
+        SDL_WaitJobCounter(threadpool_jobs);
+
+        SDL_DestroyJobCounter(threadpool_jobs);
+        threadpool_jobs = NULL;
         SDL_DestroyMutex(threadpool_lock);
         threadpool_lock = NULL;
-        SDL_DestroyCondition(threadpool_condition);
-        threadpool_condition = NULL;
-
-        max_threadpool_threads = running_threadpool_threads = idle_threadpool_threads = threadpool_threads_spun = 0;
 
         stop_threadpool = false;
         SDL_SetInitialized(&threadpool_init, false);
@@ -314,6 +310,20 @@ static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *ta
     #endif
 }
 
+static void generic_asyncioqueue_begin_batch(void *userdata)
+{
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    BeginThreadpoolBatch();
+    #endif
+}
+
+static void generic_asyncioqueue_end_batch(void *userdata)
+{
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    EndThreadpoolBatch();
+    #endif
+}
+
 static SDL_AsyncIOTask *generic_asyncioqueue_get_results(void *userdata)
 {
     GenericAsyncIOQueueData *data = (GenericAsyncIOQueueData *) userdata;
@@ -390,7 +400,9 @@ bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
         generic_asyncioqueue_get_results,
         generic_asyncioqueue_wait_results,
         generic_asyncioqueue_signal,
-        generic_asyncioqueue_destroy
+        generic_asyncioqueue_destroy,
+        generic_asyncioqueue_begin_batch,
+        generic_asyncioqueue_end_batch
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_Generic);
@@ -438,6 +450,11 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
     return true;
 }
 
+void SDL_SYS_CompleteAsyncIOTask_Generic(SDL_AsyncIOTask *task)
+{
+    AsyncIOTaskComplete(task);
+}
+
 void SDL_SYS_QuitAsyncIO_Generic(void)
 {
     #if SDL_ASYNCIO_USE_THREADPOOL
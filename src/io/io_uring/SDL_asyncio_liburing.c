@@ -90,6 +90,7 @@ typedef struct LibUringAsyncIOQueueData
     SDL_Mutex *cqe_lock;
     struct io_uring ring;
     SDL_AtomicInt num_waiting;
+    int batching;  // protected by sqe_lock; while nonzero, SQEs pile up and are submitted together.
 } LibUringAsyncIOQueueData;
 
 
@@ -183,10 +184,42 @@ static Sint64 liburing_asyncio_size(void *userdata)
 static bool liburing_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    if (queuedata->batching) {
+        return true;  // end_batch will submit everything at once.
+    }
     const int rc = liburing.io_uring_submit(&queuedata->ring);
     return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;
 }
 
+// you must hold sqe_lock when calling this! If a batch filled the submission queue, hand what we have to the kernel to make room.
+static struct io_uring_sqe *GetSQE(LibUringAsyncIOQueueData *queuedata)
+{
+    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    if (!sqe && queuedata->batching) {
+        if (liburing.io_uring_submit(&queuedata->ring) >= 0) {
+            sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+        }
+    }
+    return sqe;
+}
+
+static void liburing_asyncioqueue_begin_batch(void *userdata)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    SDL_LockMutex(queuedata->sqe_lock);  // held until end_batch, so nothing else submits half of our batch.
+    queuedata->batching++;
+}
+
+static void liburing_asyncioqueue_end_batch(void *userdata)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    if (--queuedata->batching == 0) {
+        // if this fails, the SQEs stay in the ring and go out with the next submit.
+        liburing.io_uring_submit(&queuedata->ring);
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+}
+
 static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     SDL_AsyncIOTask *cancel_task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*cancel_task));
@@ -361,7 +394,9 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         liburing_asyncioqueue_get_results,
         liburing_asyncioqueue_wait_results,
         liburing_asyncioqueue_signal,
-        liburing_asyncioqueue_destroy
+        liburing_asyncioqueue_destroy,
+        liburing_asyncioqueue_begin_batch,
+        liburing_asyncioqueue_end_batch
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_liburing);
@@ -384,7 +419,7 @@ static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
@@ -410,7 +445,7 @@ static bool liburing_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
@@ -0,0 +1,356 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+// This Windows backend uses overlapped file i/o and an I/O completion port.
+// It works on every version of Windows that SDL supports, including UWP and
+// Xbox, so it's used wherever IoRing isn't available. Any number of reads and
+// writes can be in flight at once, instead of one per threadpool thread.
+//
+// A file handle can only be associated with one completion port, but a file
+// can have tasks on any number of queues, so all files share one port and a
+// single thread waits on it, handing finished tasks to their queues. The
+// queues themselves are the "generic" ones.
+
+#include "SDL_internal.h"
+#include "../SDL_sysasyncio.h"
+
+#ifdef HAVE_WINDOWS_IOCP
+
+#include "../../core/windows/SDL_windows.h"
+
+// ReadFile() and WriteFile() take a DWORD, so larger tasks are done in pieces.
+#define IOCP_MAX_CHUNK (1024 * 1024 * 1024)
+
+// Completion keys, telling the i/o thread what each packet is.
+#define IOCP_KEY_FILE  1  // a read or write finished, the OVERLAPPED is an IOCPRequest
+#define IOCP_KEY_CLOSE 2  // a file should be closed, the OVERLAPPED is really an SDL_AsyncIOTask
+#define IOCP_KEY_QUIT  3  // time for the i/o thread to go away
+
+typedef struct IOCPRequest
+{
+    OVERLAPPED overlapped;  // must be first, completions are cast back to this.
+    SDL_AsyncIOTask *task;
+    HANDLE handle;
+    Uint64 done;   // bytes transferred by the pieces that have finished
+    DWORD chunk;   // bytes asked for by the piece in flight
+} IOCPRequest;
+
+static SDL_InitState iocp_init;
+static HANDLE iocp_port = NULL;
+static SDL_Thread *iocp_thread = NULL;
+
+// Returns 0 if the piece was started, or the Windows error code if it wasn't.
+static DWORD StartIOCPRequest(IOCPRequest *request)
+{
+    SDL_AsyncIOTask *task = request->task;
+    const Uint64 offset = task->offset + request->done;
+    Uint8 *ptr = (Uint8 *)task->buffer + request->done;
+    BOOL okay;
+
+    request->chunk = (DWORD)SDL_min(task->requested_size - request->done, IOCP_MAX_CHUNK);
+
+    SDL_zero(request->overlapped);
+    request->overlapped.Offset = (DWORD)offset;
+    request->overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+    if (task->type == SDL_ASYNCIO_TASK_READ) {
+        okay = ReadFile(request->handle, ptr, request->chunk, NULL, &request->overlapped);
+    } else {
+        okay = WriteFile(request->handle, ptr, request->chunk, NULL, &request->overlapped);
+    }
+
+    // Even if it finished right away, the completion still goes through the port.
+    if (!okay) {
+        const DWORD error = GetLastError();
+        if (error != ERROR_IO_PENDING) {
+            return error;
+        }
+    }
+    return 0;
+}
+
+static void FinishIOCPRequest(IOCPRequest *request, DWORD error)
+{
+    SDL_AsyncIOTask *task = request->task;
+
+    if (error == ERROR_HANDLE_EOF && task->type == SDL_ASYNCIO_TASK_READ) {
+        error = 0;  // a short read isn't a failure.
+    }
+
+    task->result_size = request->done;
+    if (error == ERROR_OPERATION_ABORTED) {
+        task->result = SDL_ASYNCIO_CANCELED;
+    } else if (error) {
+        task->result = SDL_ASYNCIO_FAILURE;
+    } else if (task->type == SDL_ASYNCIO_TASK_WRITE && request->done < task->requested_size) {
+        task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+    } else {
+        task->result = SDL_ASYNCIO_COMPLETE;
+    }
+
+    SDL_free(request);
+    SDL_SYS_CompleteAsyncIOTask_Generic(task);
+}
+
+static void ProcessIOCPRequest(IOCPRequest *request)
+{
+    SDL_AsyncIOTask *task = request->task;
+    DWORD transferred = 0;
+    DWORD error = 0;
+
+    if (!GetOverlappedResult(request->handle, &request->overlapped, &transferred, FALSE)) {
+        error = GetLastError();
+    }
+
+    if (!error) {
+        request->done += transferred;
+        if (transferred == request->chunk && request->done < task->requested_size) {
+            // keep going with the next piece of a large task.
+            error = StartIOCPRequest(request);
+            if (!error) {
+                return;
+            }
+        }
+    }
+    FinishIOCPRequest(request, error);
+}
+
+static void CloseIOCPFile(SDL_AsyncIOTask *task)
+{
+    HANDLE handle = (HANDLE)task->asyncio->userdata;
+    bool okay = true;
+
+    // Nothing else is in flight for this file by now, SDL_CloseAsyncIO waits for that.
+    if (task->flush && !FlushFileBuffers(handle)) {
+        okay = false;
+    }
+    if (!CloseHandle(handle)) {
+        okay = false;
+    }
+    task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+    SDL_SYS_CompleteAsyncIOTask_Generic(task);
+}
+
+static int SDLCALL IOCPThread(void *unused)
+{
+    OVERLAPPED_ENTRY entries[64];
+    ULONG count, i;
+
+    for (;;) {
+        if (!GetQueuedCompletionStatusEx(iocp_port, entries, (ULONG)SDL_arraysize(entries), &count, INFINITE, FALSE)) {
+            continue;
+        }
+
+        for (i = 0; i < count; ++i) {
+            switch (entries[i].lpCompletionKey) {
+            case IOCP_KEY_FILE:
+                ProcessIOCPRequest((IOCPRequest *)entries[i].lpOverlapped);
+                break;
+            case IOCP_KEY_CLOSE:
+                CloseIOCPFile((SDL_AsyncIOTask *)entries[i].lpOverlapped);
+                break;
+            case IOCP_KEY_QUIT:
+                return 0;
+            default:
+                SDL_assert(!"Unexpected completion key");
+                break;
+            }
+        }
+    }
+}
+
+static bool PrepareIOCP(void)
+{
+    bool okay = true;
+
+    if (SDL_ShouldInit(&iocp_init)) {
+        iocp_port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+        if (!iocp_port) {
+            okay = WIN_SetError("CreateIoCompletionPort");
+        } else {
+            iocp_thread = SDL_CreateThread(IOCPThread, "SDLAsyncIO", NULL);
+            if (!iocp_thread) {
+                CloseHandle(iocp_port);
+                iocp_port = NULL;
+                okay = false;
+            }
+        }
+        SDL_SetInitialized(&iocp_init, okay);
+    }
+    return okay;
+}
+
+static Sint64 iocp_asyncio_size(void *userdata)
+{
+    HANDLE handle = (HANDLE)userdata;
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(handle, &size)) {
+        WIN_SetError("GetFileSizeEx");
+        return -1;
+    }
+    return (Sint64)size.QuadPart;
+}
+
+static bool iocp_asyncio_io(void *userdata, SDL_AsyncIOTask *task)
+{
+    IOCPRequest *request = (IOCPRequest *)SDL_calloc(1, sizeof(*request));
+    DWORD error;
+
+    if (!request) {
+        return false;
+    }
+    request->task = task;
+    request->handle = (HANDLE)userdata;
+
+    error = StartIOCPRequest(request);
+    if (error) {
+        // There won't be a completion for this, so finish it here.
+        FinishIOCPRequest(request, error);
+    }
+    return true;
+}
+
+static bool iocp_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
+{
+    // Flushing can take a while, so let the i/o thread do it.
+    if (!PostQueuedCompletionStatus(iocp_port, 0, IOCP_KEY_CLOSE, (LPOVERLAPPED)task)) {
+        return WIN_SetError("PostQueuedCompletionStatus");
+    }
+    return true;
+}
+
+static void iocp_asyncio_destroy(void *userdata)
+{
+    // this is only a Win32 file HANDLE, should have been closed elsewhere.
+}
+
+static bool Win32OpenModeFromString(const char *mode, DWORD *access_mode, DWORD *create_mode)
+{
+    // this is exactly the set of strings that SDL_AsyncIOFromFile promises will work.
+    static const struct { const char *str; DWORD amode; DWORD cmode; } mappings[] = {
+        { "rb", GENERIC_READ, OPEN_EXISTING },
+        { "wb", GENERIC_WRITE, CREATE_ALWAYS },
+        { "r+b", GENERIC_READ | GENERIC_WRITE, OPEN_EXISTING },
+        { "w+b", GENERIC_READ | GENERIC_WRITE, CREATE_ALWAYS }
+    };
+
+    for (int i = 0; i < SDL_arraysize(mappings); i++) {
+        if (SDL_strcmp(mappings[i].str, mode) == 0) {
+            *access_mode = mappings[i].amode;
+            *create_mode = mappings[i].cmode;
+            return true;
+        }
+    }
+
+    SDL_assert(!"Shouldn't have reached this code");
+    return SDL_SetError("Invalid file open mode");
+}
+
+bool SDL_SYS_AsyncIOFromFile_IOCP(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+{
+    DWORD access_mode, create_mode;
+    HANDLE handle;
+    LPWSTR wstr;
+
+    if (!PrepareIOCP()) {
+        // can't use a completion port? Use the "generic" threadpool implementation for this file instead.
+        return SDL_SYS_AsyncIOFromFile_Generic(file, mode, asyncio);
+    }
+
+    if (!Win32OpenModeFromString(mode, &access_mode, &create_mode)) {
+        return false;
+    }
+
+    wstr = WIN_UTF8ToStringW(file);
+    if (!wstr) {
+        return false;
+    }
+
+#ifdef SDL_PLATFORM_WINRT
+    {
+        CREATEFILE2_EXTENDED_PARAMETERS extparams;
+        SDL_zero(extparams);
+        extparams.dwSize = sizeof(extparams);
+        extparams.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
+        extparams.dwFileFlags = FILE_FLAG_OVERLAPPED;
+        handle = CreateFile2(wstr, access_mode, FILE_SHARE_READ, create_mode, &extparams);
+    }
+#else
+    handle = CreateFileW(wstr, access_mode, FILE_SHARE_READ, NULL, create_mode, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
+#endif
+    SDL_free(wstr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return WIN_SetError("Couldn't open file");
+    }
+
+    if (!CreateIoCompletionPort(handle, iocp_port, IOCP_KEY_FILE, 0)) {
+        WIN_SetError("CreateIoCompletionPort");
+        CloseHandle(handle);
+        return false;
+    }
+
+    static const SDL_AsyncIOInterface SDL_AsyncIOFile_IOCP = {
+        iocp_asyncio_size,
+        iocp_asyncio_io,
+        iocp_asyncio_io,
+        iocp_asyncio_close,
+        iocp_asyncio_destroy
+    };
+
+    SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_IOCP);
+    asyncio->userdata = (void *)handle;
+    return true;
+}
+
+void SDL_SYS_QuitAsyncIO_IOCP(void)
+{
+    if (SDL_ShouldQuit(&iocp_init)) {
+        // Everything has finished by now, so the quit packet is the last thing in the port.
+        PostQueuedCompletionStatus(iocp_port, 0, IOCP_KEY_QUIT, NULL);
+        SDL_WaitThread(iocp_thread, NULL);
+        iocp_thread = NULL;
+        CloseHandle(iocp_port);
+        iocp_port = NULL;
+        SDL_SetInitialized(&iocp_init, false);
+    }
+    SDL_SYS_QuitAsyncIO_Generic();
+}
+
+#ifndef HAVE_IORINGAPI_H
+// Without IoRing, this is the whole Windows backend, with "generic" queues for the results.
+bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+{
+    return SDL_SYS_AsyncIOFromFile_IOCP(file, mode, asyncio);
+}
+
+bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue)
+{
+    return SDL_SYS_CreateAsyncIOQueue_Generic(queue);
+}
+
+void SDL_SYS_QuitAsyncIO(void)
+{
+    SDL_SYS_QuitAsyncIO_IOCP();
+}
+#endif
+
+#endif // HAVE_WINDOWS_IOCP
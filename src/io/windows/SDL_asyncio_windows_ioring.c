@@ -20,8 +20,9 @@
 */
 
 // The Windows backend uses IoRing for asynchronous i/o, and falls back to
-// the "generic" threadpool implementation if it isn't available or
-// fails for some other reason. IoRing was introduced in Windows 11.
+// overlapped i/o with a completion port (SDL_asyncio_windows_iocp.c) if it
+// isn't available or fails for some other reason. IoRing was introduced in
+// Windows 11.
 
 #include "SDL_internal.h"
 #include "../SDL_sysasyncio.h"
@@ -34,6 +35,10 @@
 // Don't know what the lowest usable version is, but this seems safe.
 #define SDL_REQUIRED_IORING_VERSION IORING_VERSION_3
 
+#ifndef IORING_E_SUBMISSION_QUEUE_FULL
+#define IORING_E_SUBMISSION_QUEUE_FULL ((HRESULT)0x80460001L)
+#endif
+
 static SDL_InitState ioring_init;
 
 // We could add a whole bootstrap thing like the audio/video/etc subsystems use, but let's keep this simple for now.
@@ -80,6 +85,7 @@ typedef struct WinIoRingAsyncIOQueueData
     HANDLE event;
     HIORING ring;
     SDL_AtomicInt num_waiting;
+    int batching;  // protected by sqe_lock; while nonzero, requests pile up and are submitted together.
 } WinIoRingAsyncIOQueueData;
 
 
@@ -149,10 +155,36 @@ static Sint64 ioring_asyncio_size(void *userdata)
 static bool ioring_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
     WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
+    if (queuedata->batching) {
+        return true;  // end_batch will submit everything at once.
+    }
     const HRESULT hr = ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL);
     return (FAILED(hr) ? WIN_SetErrorFromHRESULT("SubmitIoRing", hr) : true);
 }
 
+// you must hold sqe_lock when calling this! If a batch filled the submission queue, hand what we have to the kernel to make room.
+static bool MakeRoomForBatch(WinIoRingAsyncIOQueueData *queuedata, HRESULT hr)
+{
+    return (hr == IORING_E_SUBMISSION_QUEUE_FULL) && queuedata->batching && SUCCEEDED(ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL));
+}
+
+static void ioring_asyncioqueue_begin_batch(void *userdata)
+{
+    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
+    SDL_LockMutex(queuedata->sqe_lock);  // held until end_batch, so nothing else submits half of our batch.
+    queuedata->batching++;
+}
+
+static void ioring_asyncioqueue_end_batch(void *userdata)
+{
+    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
+    if (--queuedata->batching == 0) {
+        // if this fails, the requests stay in the ring and go out with the next submit.
+        ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL);
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+}
+
 static void ioring_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     if (!task->asyncio || !task->asyncio->userdata) {
@@ -347,7 +379,9 @@ static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
         ioring_asyncioqueue_get_results,
         ioring_asyncioqueue_wait_results,
         ioring_asyncioqueue_signal,
-        ioring_asyncioqueue_destroy
+        ioring_asyncioqueue_destroy,
+        ioring_asyncioqueue_begin_batch,
+        ioring_asyncioqueue_end_batch
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_ioring);
@@ -387,7 +421,10 @@ static bool ioring_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    const HRESULT hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    HRESULT hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    if (FAILED(hr) && MakeRoomForBatch(queuedata, hr)) {
+        hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    }
     if (FAILED(hr)) {
         retval = WIN_SetErrorFromHRESULT("BuildIoRingReadFile", hr);
     } else {
@@ -413,7 +450,10 @@ static bool ioring_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    const HRESULT hr = ioring.BuildIoRingWriteFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, 0 /*FILE_WRITE_FLAGS_NONE*/, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    HRESULT hr = ioring.BuildIoRingWriteFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, 0 /*FILE_WRITE_FLAGS_NONE*/, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    if (FAILED(hr) && MakeRoomForBatch(queuedata, hr)) {
+        hr = ioring.BuildIoRingWriteFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, 0 /*FILE_WRITE_FLAGS_NONE*/, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+    }
     if (FAILED(hr)) {
         retval = WIN_SetErrorFromHRESULT("BuildIoRingWriteFile", hr);
     } else {
@@ -514,10 +554,10 @@ static void MaybeInitializeWinIoRing(void)
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_ioring;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_ioring;
             AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_ioring;
-        } else {  // can't use ioring? Use the "generic" threadpool implementation instead.
+        } else {  // can't use ioring? Use overlapped i/o with a completion port, and the "generic" queues, instead.
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_Generic;
-            QuitAsyncIO = SDL_SYS_QuitAsyncIO_Generic;
-            AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_Generic;
+            QuitAsyncIO = SDL_SYS_QuitAsyncIO_IOCP;
+            AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_IOCP;
         }
         SDL_SetInitialized(&ioring_init, true);
     }
@@ -31,6 +31,7 @@
 #include "usb_ids.h"
 #include "hidapi/SDL_hidapi_nintendo.h"
 #include "../events/SDL_events_c.h"
+#include "../sensor/SDL_sensor_c.h"
 
 
 #ifdef SDL_PLATFORM_ANDROID
@@ -84,6 +85,11 @@ typedef struct GamepadMapping_t
     char *mapping _guarded;
     SDL_GamepadMappingPriority priority _guarded;
     struct GamepadMapping_t *next _guarded;
+
+    // The mapping index, see SDL_IndexGamepadMapping()
+    SDL_GUID guid_noversion _guarded;
+    struct GamepadMapping_t *next_same_guid _guarded;
+    struct GamepadMapping_t *next_same_guid_noversion _guarded;
 } GamepadMapping_t;
 
 typedef struct
@@ -101,6 +107,9 @@ typedef struct
 
 static SDL_GUID s_zeroGUID;
 static GamepadMapping_t *s_pSupportedGamepads SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static GamepadMapping_t *s_pSupportedGamepadsTail SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static SDL_HashTable *s_gamepadMappingsByGUID SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static SDL_HashTable *s_gamepadMappingsByGUIDNoVersion SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static MappingChangeTracker *s_mappingChangeTracker SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
@@ -291,7 +300,7 @@ static void HandleJoystickHat(Uint64 timestamp, SDL_Gamepad *gamepad, int hat, U
 static void RecenterGamepad(SDL_Gamepad *gamepad)
 {
     int i;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     for (i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; ++i) {
         SDL_GamepadButton button = (SDL_GamepadButton)i;
@@ -916,12 +925,90 @@ static GamepadMapping_t *SDL_CreateMappingForWGIGamepad(SDL_GUID guid)
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT);
 }
 
+static Uint32 SDLCALL SDL_HashGUID(void *unused, const void *key)
+{
+    return SDL_murmur3_32(key, sizeof(SDL_GUID), 0);
+}
+
+static bool SDLCALL SDL_KeyMatchGUID(void *unused, const void *a, const void *b)
+{
+    return SDL_memcmp(a, b, sizeof(SDL_GUID)) == 0;
+}
+
+/*
+ * Helper function to add a mapping to the GUID index
+ *
+ * Mappings are hashed on their GUID, and again on their GUID without the
+ * version for the fallback matches. Each table entry is the first mapping
+ * with that key, and mappings sharing a key are chained in database order,
+ * so lookups see them in the same order a walk of the whole list would.
+ */
+static bool SDL_IndexGamepadMapping(GamepadMapping_t *mapping)
+{
+    GamepadMapping_t *first;
+
+    SDL_AssertJoysticksLocked();
+
+    mapping->guid_noversion = mapping->guid;
+    SDL_SetJoystickGUIDVersion(&mapping->guid_noversion, 0);
+    mapping->next_same_guid = NULL;
+    mapping->next_same_guid_noversion = NULL;
+
+    if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
+        // The default and xinput mappings are never matched by GUID
+        return true;
+    }
+
+    if (!s_gamepadMappingsByGUID) {
+        s_gamepadMappingsByGUID = SDL_CreateHashTable(0, false, SDL_HashGUID, SDL_KeyMatchGUID, NULL, NULL);
+        if (!s_gamepadMappingsByGUID) {
+            return false;
+        }
+    }
+    if (!s_gamepadMappingsByGUIDNoVersion) {
+        s_gamepadMappingsByGUIDNoVersion = SDL_CreateHashTable(0, false, SDL_HashGUID, SDL_KeyMatchGUID, NULL, NULL);
+        if (!s_gamepadMappingsByGUIDNoVersion) {
+            return false;
+        }
+    }
+
+    // Insert both keys before linking anything, so a failure leaves the index unchanged
+    if (SDL_FindInHashTable(s_gamepadMappingsByGUID, &mapping->guid, (const void **)&first)) {
+        while (first->next_same_guid) {
+            first = first->next_same_guid;
+        }
+        first->next_same_guid = mapping;
+    } else if (!SDL_InsertIntoHashTable(s_gamepadMappingsByGUID, &mapping->guid, mapping, false)) {
+        return false;
+    }
+
+    if (SDL_FindInHashTable(s_gamepadMappingsByGUIDNoVersion, &mapping->guid_noversion, (const void **)&first)) {
+        while (first->next_same_guid_noversion) {
+            first = first->next_same_guid_noversion;
+        }
+        first->next_same_guid_noversion = mapping;
+    } else if (!SDL_InsertIntoHashTable(s_gamepadMappingsByGUIDNoVersion, &mapping->guid_noversion, mapping, false)) {
+        // Take the mapping back out of the first table
+        if (SDL_FindInHashTable(s_gamepadMappingsByGUID, &mapping->guid, (const void **)&first) && first == mapping) {
+            SDL_RemoveFromHashTable(s_gamepadMappingsByGUID, &mapping->guid);
+        } else {
+            while (first->next_same_guid != mapping) {
+                first = first->next_same_guid;
+            }
+            first->next_same_guid = NULL;
+        }
+        return false;
+    }
+    return true;
+}
+
 /*
  * Helper function to scan the mappings database for a gamepad with the specified GUID
  */
 static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bool match_version, bool exact_match_crc)
 {
     GamepadMapping_t *mapping, *best_match = NULL;
+    SDL_HashTable *index;
     Uint16 crc = 0;
 
     SDL_AssertJoysticksLocked();
@@ -931,40 +1018,34 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
     // Clear the CRC from the GUID for matching, the mappings never include it in the GUID
     SDL_SetJoystickGUIDCRC(&guid, 0);
 
-    if (!match_version) {
+    if (match_version) {
+        index = s_gamepadMappingsByGUID;
+    } else {
         SDL_SetJoystickGUIDVersion(&guid, 0);
+        index = s_gamepadMappingsByGUIDNoVersion;
     }
 
-    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
-        SDL_GUID mapping_guid;
-
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
-            continue;
-        }
-
-        SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
-        if (!match_version) {
-            SDL_SetJoystickGUIDVersion(&mapping_guid, 0);
-        }
-
-        if (SDL_memcmp(&guid, &mapping_guid, sizeof(guid)) == 0) {
-            const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
-            if (crc_string) {
-                Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
-                if (mapping_crc != crc) {
-                    // This mapping specified a CRC and they don't match
-                    continue;
-                }
+    if (!index || !SDL_FindInHashTable(index, &guid, (const void **)&mapping)) {
+        return NULL;
+    }
 
-                // An exact match, including CRC
-                return mapping;
-            } else if (crc && exact_match_crc) {
+    for (; mapping; mapping = match_version ? mapping->next_same_guid : mapping->next_same_guid_noversion) {
+        const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
+        if (crc_string) {
+            Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
+            if (mapping_crc != crc) {
+                // This mapping specified a CRC and they don't match
                 continue;
             }
 
-            if (!best_match) {
-                best_match = mapping;
-            }
+            // An exact match, including CRC
+            return mapping;
+        } else if (crc && exact_match_crc) {
+            continue;
+        }
+
+        if (!best_match) {
+            best_match = mapping;
         }
     }
     return best_match;
@@ -1768,19 +1849,21 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         pGamepadMapping->next = NULL;
         pGamepadMapping->priority = priority;
 
-        if (s_pSupportedGamepads) {
-            // Add the mapping to the end of the list
-            GamepadMapping_t *pCurrMapping, *pPrevMapping;
+        if (!SDL_IndexGamepadMapping(pGamepadMapping)) {
+            PopMappingChangeTracking();
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+            SDL_free(pGamepadMapping);
+            return NULL;
+        }
 
-            for (pPrevMapping = s_pSupportedGamepads, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                // continue;
-            }
-            pPrevMapping->next = pGamepadMapping;
+        // Add the mapping to the end of the list
+        if (s_pSupportedGamepadsTail) {
+            s_pSupportedGamepadsTail->next = pGamepadMapping;
         } else {
             s_pSupportedGamepads = pGamepadMapping;
         }
+        s_pSupportedGamepadsTail = pGamepadMapping;
         if (existing) {
             *existing = false;
         }
@@ -3471,6 +3554,35 @@ bool SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *
     return SDL_Unsupported();
 }
 
+int SDL_GetGamepadSensorSamples(SDL_Gamepad *gamepad, SDL_SensorType type, SDL_SensorSample *samples, int num_samples)
+{
+    if (!samples && num_samples > 0) {
+        SDL_InvalidParamError("samples");
+        return -1;
+    }
+
+    SDL_LockJoysticks();
+    {
+        SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
+        if (joystick) {
+            int i;
+            for (i = 0; i < joystick->nsensors; ++i) {
+                SDL_JoystickSensorInfo *sensor = &joystick->sensors[i];
+
+                if (sensor->type == type) {
+                    int result = SDL_PopSensorSamples(&sensor->samples, samples, num_samples);
+                    SDL_UnlockJoysticks();
+                    return result;
+                }
+            }
+        }
+    }
+    SDL_UnlockJoysticks();
+
+    SDL_Unsupported();
+    return -1;
+}
+
 SDL_JoystickID SDL_GetGamepadID(SDL_Gamepad *gamepad)
 {
     SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
@@ -3900,6 +4012,16 @@ void SDL_QuitGamepadMappings(void)
         SDL_free(pGamepadMap->mapping);
         SDL_free(pGamepadMap);
     }
+    s_pSupportedGamepadsTail = NULL;
+
+    if (s_gamepadMappingsByGUID) {
+        SDL_DestroyHashTable(s_gamepadMappingsByGUID);
+        s_gamepadMappingsByGUID = NULL;
+    }
+    if (s_gamepadMappingsByGUIDNoVersion) {
+        SDL_DestroyHashTable(s_gamepadMappingsByGUIDNoVersion);
+        s_gamepadMappingsByGUIDNoVersion = NULL;
+    }
 
     SDL_FreeVIDPIDList(&SDL_allowed_gamepads);
     SDL_FreeVIDPIDList(&SDL_ignored_gamepads);
@@ -818,6 +818,9 @@ bool SDL_InitJoysticks(void)
     // Create the joystick list lock
     if (SDL_joystick_lock == NULL) {
         SDL_joystick_lock = SDL_CreateMutex();
+        if (SDL_joystick_lock) {
+            SDL_SetMutexName(SDL_joystick_lock, "SDL_joystick_lock");
+        }
     }
 
     if (!SDL_InitSubSystem(SDL_INIT_EVENTS)) {
@@ -1805,6 +1808,65 @@ bool SDL_GetJoystickButton(SDL_Joystick *joystick, int button)
     return down;
 }
 
+bool SDL_GetJoystickSnapshot(SDL_Joystick *joystick, SDL_JoystickSnapshot *snapshot) SDL_NO_THREAD_SAFETY_ANALYSIS // This is lock-free on purpose
+{
+    int naxes, nbuttons, nhats;
+    int i, sequence;
+
+    if (!SDL_ObjectValid(joystick, SDL_OBJECT_TYPE_JOYSTICK)) {
+        return SDL_InvalidParamError("joystick");
+    }
+    if (!snapshot) {
+        return SDL_InvalidParamError("snapshot");
+    }
+    if ((snapshot->num_axes > 0 && !snapshot->axes) ||
+        (snapshot->num_buttons > 0 && !snapshot->buttons) ||
+        (snapshot->num_hats > 0 && !snapshot->hats)) {
+        return SDL_InvalidParamError("snapshot");
+    }
+
+    // The number of controls doesn't change while the joystick is open
+    naxes = SDL_max(SDL_min(snapshot->num_axes, joystick->naxes), 0);
+    nbuttons = SDL_max(SDL_min(snapshot->num_buttons, joystick->nbuttons), 0);
+    nhats = SDL_max(SDL_min(snapshot->num_hats, joystick->nhats), 0);
+
+    for (i = naxes; i < snapshot->num_axes; ++i) {
+        snapshot->axes[i] = 0;
+    }
+    for (i = nbuttons; i < snapshot->num_buttons; ++i) {
+        snapshot->buttons[i] = false;
+    }
+    for (i = nhats; i < snapshot->num_hats; ++i) {
+        snapshot->hats[i] = SDL_HAT_CENTERED;
+    }
+
+    // This is the reader side of a sequence lock, see SDL_BeginJoystickStateChange()
+    for (;;) {
+        sequence = SDL_GetAtomicInt(&joystick->state_sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+
+        for (i = 0; i < naxes; ++i) {
+            snapshot->axes[i] = joystick->axes[i].value;
+        }
+        if (nbuttons > 0) {
+            SDL_memcpy(snapshot->buttons, joystick->buttons, nbuttons * sizeof(*snapshot->buttons));
+        }
+        if (nhats > 0) {
+            SDL_memcpy(snapshot->hats, joystick->hats, nhats * sizeof(*snapshot->hats));
+        }
+        snapshot->timestamp = joystick->state_timestamp;
+
+        SDL_MemoryBarrierAcquire();
+        if (SDL_GetAtomicInt(&joystick->state_sequence) == sequence) {
+            break;
+        }
+    }
+    return true;
+}
+
 /*
  * Return if the joystick in question is currently attached to the system,
  *  \return false if not plugged in, true if still present.
@@ -2175,6 +2237,9 @@ void SDL_CloseJoystick(SDL_Joystick *joystick)
             SDL_free(touchpad->fingers);
         }
         SDL_free(joystick->touchpads);
+        for (i = 0; i < joystick->nsensors; i++) {
+            SDL_free(joystick->sensors[i].samples);
+        }
         SDL_free(joystick->sensors);
         SDL_free(joystick);
     }
@@ -2368,7 +2433,7 @@ bool SDL_IsJoystickBeingAdded(void)
 void SDL_PrivateJoystickForceRecentering(SDL_Joystick *joystick)
 {
     Uint8 i, j;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     SDL_AssertJoysticksLocked();
 
@@ -2431,6 +2496,22 @@ void SDL_PrivateJoystickRemoved(SDL_JoystickID instance_id)
     }
 }
 
+/* The axis, button and hat state is written under the joystick lock, but
+ * SDL_GetJoystickSnapshot() reads it without, so writers bump a sequence
+ * number around each change. It is odd while a change is in progress, and
+ * readers retry if it moved while they were copying.
+ */
+static void SDL_BeginJoystickStateChange(SDL_Joystick *joystick)
+{
+    SDL_AddAtomicInt(&joystick->state_sequence, 1);
+}
+
+static void SDL_EndJoystickStateChange(SDL_Joystick *joystick)
+{
+    SDL_MemoryBarrierRelease();
+    SDL_AddAtomicInt(&joystick->state_sequence, 1);
+}
+
 void SDL_SendJoystickAxis(Uint64 timestamp, SDL_Joystick *joystick, Uint8 axis, Sint16 value)
 {
     SDL_JoystickAxisInfo *info;
@@ -2445,10 +2526,12 @@ void SDL_SendJoystickAxis(Uint64 timestamp, SDL_Joystick *joystick, Uint8 axis,
     info = &joystick->axes[axis];
     if (!info->has_initial_value ||
         (!info->has_second_value && (info->initial_value <= -32767 || info->initial_value == 32767) && SDL_abs(value) < (SDL_JOYSTICK_AXIS_MAX / 4))) {
+        SDL_BeginJoystickStateChange(joystick);
         info->initial_value = value;
         info->value = value;
         info->zero = value;
         info->has_initial_value = true;
+        SDL_EndJoystickStateChange(joystick);
     } else if (value == info->value && !info->sending_initial_value) {
         return;
     } else {
@@ -2480,7 +2563,10 @@ void SDL_SendJoystickAxis(Uint64 timestamp, SDL_Joystick *joystick, Uint8 axis,
 
     // Update internal joystick state
     SDL_assert(timestamp != 0);
+    SDL_BeginJoystickStateChange(joystick);
     info->value = value;
+    joystick->state_timestamp = timestamp;
+    SDL_EndJoystickStateChange(joystick);
     joystick->update_complete = timestamp;
 
     // Post the event, if desired
@@ -2549,7 +2635,10 @@ void SDL_SendJoystickHat(Uint64 timestamp, SDL_Joystick *joystick, Uint8 hat, Ui
 
     // Update internal joystick state
     SDL_assert(timestamp != 0);
+    SDL_BeginJoystickStateChange(joystick);
     joystick->hats[hat] = value;
+    joystick->state_timestamp = timestamp;
+    SDL_EndJoystickStateChange(joystick);
     joystick->update_complete = timestamp;
 
     // Post the event, if desired
@@ -2613,7 +2702,10 @@ void SDL_SendJoystickButton(Uint64 timestamp, SDL_Joystick *joystick, Uint8 butt
 
     // Update internal joystick state
     SDL_assert(timestamp != 0);
+    SDL_BeginJoystickStateChange(joystick);
     joystick->buttons[button] = down;
+    joystick->state_timestamp = timestamp;
+    SDL_EndJoystickStateChange(joystick);
     joystick->update_complete = timestamp;
 
     // Post the event, if desired
@@ -2675,6 +2767,8 @@ void SDL_UpdateJoysticks(void)
         return;
     }
 
+    SDL_TRACE_ZONE_BEGIN(zone, "SDL_UpdateJoysticks");
+
     SDL_LockJoysticks();
 
     if (SDL_UpdateSteamVirtualGamepadInfo()) {
@@ -2748,6 +2842,8 @@ void SDL_UpdateJoysticks(void)
     }
 
     SDL_UnlockJoysticks();
+
+    SDL_TRACE_ZONE_END(zone);
 }
 
 static const Uint32 SDL_joystick_event_list[] = {
@@ -3722,6 +3818,8 @@ void SDL_SendJoystickSensor(Uint64 timestamp, SDL_Joystick *joystick, SDL_Sensor
                 SDL_memcpy(sensor->data, data, num_values * sizeof(*data));
                 joystick->update_complete = timestamp;
 
+                SDL_PushSensorSample(sensor->samples, timestamp, sensor_timestamp, data, num_values);
+
                 // Post the event, if desired
                 if (SDL_EventEnabled(SDL_EVENT_GAMEPAD_SENSOR_UPDATE)) {
                     SDL_Event event;
@@ -70,6 +70,7 @@ typedef struct SDL_JoystickSensorInfo
     bool enabled;
     float rate;
     float data[3]; // If this needs to expand, update SDL_GamepadSensorEvent
+    struct SDL_SensorSampleRing *samples; // Readings since the last SDL_GetGamepadSensorSamples()
 } SDL_JoystickSensorInfo;
 
 #define _guarded SDL_GUARDED_BY(SDL_joystick_lock)
@@ -98,6 +99,9 @@ struct SDL_Joystick
     int nbuttons _guarded;   // Number of buttons on the joystick
     bool *buttons _guarded; // Current button states
 
+    SDL_AtomicInt state_sequence;     // Odd while the axis, button or hat state is changing, see SDL_GetJoystickSnapshot()
+    Uint64 state_timestamp _guarded;  // Time of the last axis, button or hat change
+
     int ntouchpads _guarded;                      // Number of touchpads on the joystick
     SDL_JoystickTouchpadInfo *touchpads _guarded; // Current touchpad states
 
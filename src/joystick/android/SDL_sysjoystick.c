@@ -196,7 +196,7 @@ static SDL_Scancode button_to_scancode(int button)
 
 bool Android_OnPadDown(int device_id, int keycode)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     SDL_joylist_item *item;
     int button = keycode_to_SDL(keycode);
     if (button >= 0) {
@@ -216,7 +216,7 @@ bool Android_OnPadDown(int device_id, int keycode)
 
 bool Android_OnPadUp(int device_id, int keycode)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     SDL_joylist_item *item;
     int button = keycode_to_SDL(keycode);
     if (button >= 0) {
@@ -236,7 +236,7 @@ bool Android_OnPadUp(int device_id, int keycode)
 
 bool Android_OnJoy(int device_id, int axis, float value)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     // Android gives joy info normalized as [-1.0, 1.0] or [0.0, 1.0]
     SDL_joylist_item *item;
 
@@ -252,7 +252,7 @@ bool Android_OnJoy(int device_id, int axis, float value)
 
 bool Android_OnHat(int device_id, int hat_id, int x, int y)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     const int DPAD_UP_MASK = (1 << SDL_GAMEPAD_BUTTON_DPAD_UP);
     const int DPAD_DOWN_MASK = (1 << SDL_GAMEPAD_BUTTON_DPAD_DOWN);
     const int DPAD_LEFT_MASK = (1 << SDL_GAMEPAD_BUTTON_DPAD_LEFT);
@@ -612,7 +612,7 @@ static void BSD_JoystickUpdate(SDL_Joystick *joy)
 #ifdef SDL_PLATFORM_OPENBSD
     Sint32 dpad[4] = { 0, 0, 0, 0 };
 #endif
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
 #ifdef SUPPORT_JOY_GAMEPORT
     struct joystick gameport;
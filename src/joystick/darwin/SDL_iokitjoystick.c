@@ -969,7 +969,7 @@ static void DARWIN_JoystickUpdate(SDL_Joystick *joystick)
     recElement *element;
     SInt32 value, range;
     int i, goodRead = false;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (!device) {
         return;
@@ -28,7 +28,7 @@
 #include "../../core/windows/SDL_gameinput.h"
 
 // Default value for SDL_HINT_JOYSTICK_GAMEINPUT
-#if defined(SDL_PLATFORM_GDK)
+#if defined(SDL_PLATFORM_GDK) || defined(SDL_PLATFORM_WINRT)
 #define SDL_GAMEINPUT_DEFAULT true
 #else
 #define SDL_GAMEINPUT_DEFAULT false
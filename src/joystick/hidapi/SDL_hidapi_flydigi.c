@@ -24,6 +24,7 @@
 
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_FLYDIGI
@@ -106,7 +107,7 @@ static void UpdateDeviceIdentity(SDL_HIDAPI_Device *device)
             SDL_Delay(1);
 
             Uint8 data[USB_PACKET_LENGTH];
-            int size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 0);
+            int size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0);
             if (size < 0) {
                 break;
             }
@@ -323,7 +324,7 @@ static bool HIDAPI_DriverFlydigi_SetJoystickSensorsEnabled(SDL_HIDAPI_Device *de
 static void HIDAPI_DriverFlydigi_HandleStatePacket(SDL_Joystick *joystick, SDL_DriverFlydigi_Context *ctx, Uint8 *data, int size)
 {
     Sint16 axis;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     if (data[0] != 0x04 && data[0] != 0xFE) {
         // We don't know how to handle this report
         return;
@@ -465,7 +466,7 @@ static bool HIDAPI_DriverFlydigi_UpdateDevice(SDL_HIDAPI_Device *device)
         return false;
     }
 
-    while ((size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 0)) > 0) {
+    while ((size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0)) > 0) {
 #ifdef DEBUG_FLYDIGI_PROTOCOL
         HIDAPI_DumpPacket("Flydigi packet: size = %d", data, size);
 #endif
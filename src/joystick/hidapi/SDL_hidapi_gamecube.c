@@ -25,6 +25,7 @@
 #include "../../SDL_hints_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 #include "../../hidapi/SDL_hidapi_c.h"
 
@@ -143,7 +144,7 @@ static bool HIDAPI_DriverGameCube_InitDevice(SDL_HIDAPI_Device *device)
         SDL_Delay(10);
 
         // Add all the applicable joysticks
-        while ((size = SDL_hid_read_timeout(device->dev, packet, sizeof(packet), 0)) > 0) {
+        while ((size = SDL_HIDAPI_ReadDevice(device, packet, sizeof(packet), 0)) > 0) {
 #ifdef DEBUG_GAMECUBE_PROTOCOL
             HIDAPI_DumpPacket("Nintendo GameCube packet: size = %d", packet, size);
 #endif
@@ -206,7 +207,7 @@ static void HIDAPI_DriverGameCube_HandleJoystickPacket(SDL_HIDAPI_Device *device
     const Uint8 i = 0;  // We have a separate context for each connected controller in PC mode, just use the first index
     Uint8 v;
     Sint16 axis_value;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     joystick = SDL_GetJoystickFromID(ctx->joysticks[i]);
     if (!joystick) {
@@ -264,7 +265,7 @@ static void HIDAPI_DriverGameCube_HandleNintendoPacket(SDL_HIDAPI_Device *device
     Uint8 *curSlot;
     Uint8 i;
     Sint16 axis_value;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (size < 37 || packet[0] != 0x21) {
         return; // Nothing to do right now...?
@@ -348,7 +349,7 @@ static bool HIDAPI_DriverGameCube_UpdateDevice(SDL_HIDAPI_Device *device)
     int size;
 
     // Read input packet
-    while ((size = SDL_hid_read_timeout(device->dev, packet, sizeof(packet), 0)) > 0) {
+    while ((size = SDL_HIDAPI_ReadDevice(device, packet, sizeof(packet), 0)) > 0) {
 #ifdef DEBUG_GAMECUBE_PROTOCOL
         HIDAPI_DumpPacket("Nintendo GameCube packet: size = %d", packet, size);
 #endif
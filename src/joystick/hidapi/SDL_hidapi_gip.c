@@ -25,6 +25,7 @@
 #include "../../events/SDL_keyboard_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_GIP
@@ -1683,7 +1684,7 @@ static bool GIP_HandleCommandGuideButtonStatus(
     const Uint8 *bytes,
     int num_bytes)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     SDL_Joystick *joystick = NULL;
 
     if (attachment->device->device->num_joysticks < 1) {
@@ -1762,7 +1763,7 @@ static bool GIP_HandleCommandRawReport(
     const Uint8 *bytes,
     int num_bytes)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     SDL_Joystick *joystick = NULL;
 
     if (attachment->device->device->num_joysticks < 1) {
@@ -1825,7 +1826,7 @@ static bool GIP_HandleCommandHidReport(
     const Uint8 *bytes,
     int num_bytes)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     // SDL doesn't have HID descriptor parsing, so we have to hardcode for the Chatpad descriptor instead.
     // I don't know of any other devices that emit HID reports, so this should be safe.
     if (attachment->attachment_type != GIP_TYPE_CHATPAD || !attachment->keyboard || num_bytes != 8) {
@@ -2138,7 +2139,7 @@ static bool GIP_HandleLLInputReport(
     const Uint8 *bytes,
     int num_bytes)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
     SDL_Joystick *joystick = NULL;
 
     if (attachment->device->device->num_joysticks < 1) {
@@ -2856,7 +2857,7 @@ static bool HIDAPI_DriverGIP_UpdateDevice(SDL_HIDAPI_Device *device)
     bool perform_reset = false;
     Uint64 timestamp;
 
-    while ((num_bytes = SDL_hid_read_timeout(device->dev, bytes, sizeof(bytes), ctx->timeout)) > 0) {
+    while ((num_bytes = SDL_HIDAPI_ReadDevice(device, bytes, sizeof(bytes), ctx->timeout)) > 0) {
         ctx->timeout = 0;
         GIP_ReceivePacket(ctx, bytes, num_bytes);
     }
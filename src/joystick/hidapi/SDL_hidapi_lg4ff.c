@@ -28,6 +28,7 @@
 #include "../SDL_sysjoystick.h"
 #include "SDL3/SDL_events.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_LG4FF
 
@@ -570,7 +571,7 @@ static bool HIDAPI_DriverLg4ff_HandleState(SDL_HIDAPI_Device *device,
     Uint8 last_hat = 0;
     int num_buttons = HIDAPI_DriverLg4ff_GetNumberOfButtons(device->product_id);
     int bit_offset = 0;
-	Uint64 timestamp = SDL_GetTicksNS();
+	Uint64 timestamp = SDL_GetEventTicksNS();
 
     bool state_changed = false;
 
@@ -818,7 +819,7 @@ static bool HIDAPI_DriverLg4ff_UpdateDevice(SDL_HIDAPI_Device *device)
     }
 
     do {
-        r = SDL_hid_read(device->dev, report_buf, report_size);
+        r = SDL_HIDAPI_ReadDevice(device, report_buf, report_size, 0);
         if (r < 0) {
             /* Failed to read from controller */
             HIDAPI_JoystickDisconnected(device, device->joysticks[0]);
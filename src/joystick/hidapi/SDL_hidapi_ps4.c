@@ -28,6 +28,7 @@
 #include "../../SDL_hints_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_PS4
@@ -318,7 +319,7 @@ static bool HIDAPI_DriverPS4_InitDevice(SDL_HIDAPI_Device *device)
     } else if (device->vendor_id == USB_VENDOR_SONY) {
         if (device->is_bluetooth) {
             // Read a report to see if we're in enhanced mode
-            size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 16);
+            size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 16);
 #ifdef DEBUG_PS4_PROTOCOL
             if (size > 0) {
                 HIDAPI_DumpPacket("PS4 first packet: size = %d", data, size);
@@ -1008,7 +1009,7 @@ static void HIDAPI_DriverPS4_HandleStatePacket(SDL_Joystick *joystick, SDL_hid_d
     Sint16 axis;
     bool touchpad_down;
     int touchpad_x, touchpad_y;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (size > 9 && ctx->report_touchpad && ctx->enhanced_reports) {
         touchpad_down = ((packet->ucTouchpadCounter1 & 0x80) == 0);
@@ -1255,7 +1256,7 @@ static bool HIDAPI_DriverPS4_UpdateDevice(SDL_HIDAPI_Device *device)
         joystick = SDL_GetJoystickFromID(device->joysticks[0]);
     }
 
-    while ((size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 0)) > 0) {
+    while ((size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0)) > 0) {
 #ifdef DEBUG_PS4_PROTOCOL
         HIDAPI_DumpPacket("PS4 packet: size = %d", data, size);
 #endif
@@ -25,6 +25,7 @@
 #include "../../SDL_hints_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_PS5
@@ -397,7 +398,7 @@ static bool HIDAPI_DriverPS5_InitDevice(SDL_HIDAPI_Device *device)
     }
 
     // Read a report to see what mode we're in
-    size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 16);
+    size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 16);
 #ifdef DEBUG_PS5_PROTOCOL
     if (size > 0) {
         HIDAPI_DumpPacket("PS5 first packet: size = %d", data, size);
@@ -1487,8 +1488,8 @@ static bool HIDAPI_DriverPS5_UpdateDevice(SDL_HIDAPI_Device *device)
         joystick = SDL_GetJoystickFromID(device->joysticks[0]);
     }
 
-    while ((size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 0)) > 0) {
-        Uint64 timestamp = SDL_GetTicksNS();
+    while ((size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0)) > 0) {
+        Uint64 timestamp = SDL_GetEventTicksNS();
 
 #ifdef DEBUG_PS5_PROTOCOL
         HIDAPI_DumpPacket("PS5 packet: size = %d", data, size);
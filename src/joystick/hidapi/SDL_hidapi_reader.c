@@ -0,0 +1,489 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifdef SDL_JOYSTICK_HIDAPI
+
+// Read input reports for all devices on a single thread so driver updates don't have to wait on the device
+
+#include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
+#include "../../hidapi/SDL_hidapi_c.h"
+
+#ifdef HAVE_HIDAPI_READ_WAIT
+
+#ifdef SDL_PLATFORM_LINUX
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#else
+#include "../../core/windows/SDL_windows.h"
+#endif
+
+#define SDL_HIDAPI_MAX_READ_DEVICES 32
+#define SDL_HIDAPI_INPUT_QUEUE_SIZE 64 // must be a power of two
+#define SDL_HIDAPI_MAX_REPORT_SIZE  256
+
+typedef struct SDL_HIDAPI_InputReport
+{
+    int size;
+    Uint8 data[SDL_HIDAPI_MAX_REPORT_SIZE];
+} SDL_HIDAPI_InputReport;
+
+/* A single producer, single consumer ring of input reports. The reader
+   thread only fills it while holding the device lock, so once the driver
+   holds the lock itself, anything it reads directly from the device is newer
+   than what's queued.
+ */
+struct SDL_HIDAPI_InputQueue
+{
+    SDL_HIDAPI_Device *device;
+#ifdef SDL_PLATFORM_LINUX
+    int fd;
+#else
+    HANDLE event;
+#endif
+    SDL_AtomicInt head;    // Next slot the reader thread fills
+    SDL_AtomicInt tail;    // Next slot the driver reads
+    SDL_AtomicInt pending; // The reader thread couldn't lock the device, so the driver reads it directly
+    SDL_AtomicInt failed;  // The device returned a read error
+    SDL_HIDAPI_InputReport reports[SDL_HIDAPI_INPUT_QUEUE_SIZE];
+};
+
+typedef struct SDL_HIDAPI_ReaderContext
+{
+    SDL_AtomicInt running;
+    SDL_Thread *thread;
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+    SDL_HIDAPI_InputQueue *queues[SDL_HIDAPI_MAX_READ_DEVICES];
+    int num_queues;
+    Uint32 generation;        // Changes whenever a queue is added or removed
+    Uint32 thread_generation; // The generation the reader thread is waiting on
+#ifdef SDL_PLATFORM_LINUX
+    int wake_fds[2];
+#else
+    HANDLE wake_event;
+#endif
+} SDL_HIDAPI_ReaderContext;
+
+static SDL_HIDAPI_ReaderContext reader_context = {
+#ifdef SDL_PLATFORM_LINUX
+    .wake_fds = { -1, -1 },
+#endif
+    .num_queues = 0
+};
+
+static void SDL_HIDAPI_WakeReader(SDL_HIDAPI_ReaderContext *ctx)
+{
+#ifdef SDL_PLATFORM_LINUX
+    if (ctx->wake_fds[1] >= 0) {
+        const Uint8 value = 1;
+        if (write(ctx->wake_fds[1], &value, sizeof(value)) < 0) {
+            // The pipe is full, the thread is going to wake up anyway
+        }
+    }
+#else
+    if (ctx->wake_event) {
+        SetEvent(ctx->wake_event);
+    }
+#endif
+}
+
+static void SDL_HIDAPI_FillQueue(SDL_HIDAPI_InputQueue *queue)
+{
+    SDL_HIDAPI_Device *device = queue->device;
+
+    if (SDL_GetAtomicInt(&queue->pending) || SDL_GetAtomicInt(&queue->failed)) {
+        return;
+    }
+
+    if (!SDL_TryLockMutex(device->dev_lock)) {
+        // The driver is busy with the device, it will read the reports itself
+        SDL_SetAtomicInt(&queue->pending, true);
+        return;
+    }
+
+    for (;;) {
+        const int head = SDL_GetAtomicInt(&queue->head);
+        const int next = (head + 1) & (SDL_HIDAPI_INPUT_QUEUE_SIZE - 1);
+        SDL_HIDAPI_InputReport *report = &queue->reports[head];
+        int size;
+
+        // The slot at head is never visible to the driver, so it's safe to read into
+        size = SDL_HIDAPI_ReadDevice(device, report->data, sizeof(report->data), 0);
+        if (size <= 0) {
+            if (size < 0) {
+                SDL_SetAtomicInt(&queue->failed, true);
+            }
+            break;
+        }
+
+        if (next == SDL_GetAtomicInt(&queue->tail)) {
+            // The queue is full, drop the newest report, the same way the kernel does
+            continue;
+        }
+        report->size = size;
+        SDL_SetAtomicInt(&queue->head, next);
+    }
+
+    SDL_UnlockMutex(device->dev_lock);
+}
+
+static int SDLCALL SDL_HIDAPI_ReaderThread(void *data)
+{
+    SDL_HIDAPI_ReaderContext *ctx = (SDL_HIDAPI_ReaderContext *)data;
+    SDL_HIDAPI_InputQueue *queues[SDL_HIDAPI_MAX_READ_DEVICES];
+    bool ready[SDL_HIDAPI_MAX_READ_DEVICES];
+    int i, num_queues = 0;
+#ifdef SDL_PLATFORM_LINUX
+    struct pollfd fds[1 + SDL_HIDAPI_MAX_READ_DEVICES];
+#else
+    HANDLE handles[1 + SDL_HIDAPI_MAX_READ_DEVICES];
+    DWORD num_handles, result;
+#endif
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    SDL_LockMutex(ctx->lock);
+    while (SDL_GetAtomicInt(&ctx->running)) {
+        if (ctx->thread_generation != ctx->generation) {
+            // Pick up the new set of devices and let SDL_HIDAPI_StopReading() know we're done with removed ones
+            num_queues = ctx->num_queues;
+            SDL_memcpy(queues, ctx->queues, num_queues * sizeof(*queues));
+            for (i = 0; i < num_queues; ++i) {
+                ready[i] = true;
+            }
+            ctx->thread_generation = ctx->generation;
+            SDL_BroadcastCondition(ctx->cond);
+        }
+
+        for (i = 0; i < num_queues; ++i) {
+            if (ready[i]) {
+                SDL_HIDAPI_FillQueue(queues[i]);
+                ready[i] = false;
+            }
+        }
+        SDL_UnlockMutex(ctx->lock);
+
+        // Wait for input on any device that we're reading, or for the device list to change
+#ifdef SDL_PLATFORM_LINUX
+        fds[0].fd = ctx->wake_fds[0];
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        for (i = 0; i < num_queues; ++i) {
+            SDL_HIDAPI_InputQueue *queue = queues[i];
+            struct pollfd *fd = &fds[1 + i];
+
+            if (SDL_GetAtomicInt(&queue->pending) || SDL_GetAtomicInt(&queue->failed)) {
+                fd->fd = -1; // ignored by poll()
+            } else {
+                fd->fd = queue->fd;
+            }
+            fd->events = POLLIN;
+            fd->revents = 0;
+        }
+        if (poll(fds, 1 + num_queues, -1) > 0) {
+            if (fds[0].revents) {
+                Uint8 buffer[32];
+                while (read(ctx->wake_fds[0], buffer, sizeof(buffer)) > 0) {
+                    // Drain the wake pipe
+                }
+            }
+            for (i = 0; i < num_queues; ++i) {
+                if (fds[1 + i].revents) {
+                    ready[i] = true;
+                }
+            }
+        }
+#else
+        handles[0] = ctx->wake_event;
+        num_handles = 1;
+        for (i = 0; i < num_queues; ++i) {
+            SDL_HIDAPI_InputQueue *queue = queues[i];
+
+            if (!SDL_GetAtomicInt(&queue->pending) && !SDL_GetAtomicInt(&queue->failed)) {
+                handles[num_handles++] = queue->event;
+            }
+        }
+        result = WaitForMultipleObjects(num_handles, handles, FALSE, INFINITE);
+        if (result > WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + num_handles) {
+            /* The read events are auto-reset, so hand the signal back for
+               SDL_hid_read_timeout() to pick up the completed read. */
+            SetEvent(handles[result - WAIT_OBJECT_0]);
+        } else if (result == WAIT_FAILED) {
+            SDL_Delay(1);
+        }
+        for (i = 0; i < num_queues; ++i) {
+            ready[i] = true;
+        }
+#endif
+
+        SDL_LockMutex(ctx->lock);
+    }
+    SDL_UnlockMutex(ctx->lock);
+
+    return 0;
+}
+
+static void SDL_HIDAPI_StopReaderThread(SDL_HIDAPI_ReaderContext *ctx)
+{
+    SDL_SetAtomicInt(&ctx->running, false);
+
+    if (ctx->thread) {
+        SDL_HIDAPI_WakeReader(ctx);
+        SDL_WaitThread(ctx->thread, NULL);
+        ctx->thread = NULL;
+    }
+
+#ifdef SDL_PLATFORM_LINUX
+    for (int i = 0; i < SDL_arraysize(ctx->wake_fds); ++i) {
+        if (ctx->wake_fds[i] >= 0) {
+            close(ctx->wake_fds[i]);
+            ctx->wake_fds[i] = -1;
+        }
+    }
+#else
+    if (ctx->wake_event) {
+        CloseHandle(ctx->wake_event);
+        ctx->wake_event = NULL;
+    }
+#endif
+
+    if (ctx->cond) {
+        SDL_DestroyCondition(ctx->cond);
+        ctx->cond = NULL;
+    }
+
+    if (ctx->lock) {
+        SDL_DestroyMutex(ctx->lock);
+        ctx->lock = NULL;
+    }
+}
+
+static bool SDL_HIDAPI_StartReaderThread(SDL_HIDAPI_ReaderContext *ctx)
+{
+    ctx->lock = SDL_CreateMutex();
+    if (!ctx->lock) {
+        SDL_HIDAPI_StopReaderThread(ctx);
+        return false;
+    }
+
+    ctx->cond = SDL_CreateCondition();
+    if (!ctx->cond) {
+        SDL_HIDAPI_StopReaderThread(ctx);
+        return false;
+    }
+
+#ifdef SDL_PLATFORM_LINUX
+    if (pipe(ctx->wake_fds) < 0) {
+        ctx->wake_fds[0] = ctx->wake_fds[1] = -1;
+        SDL_HIDAPI_StopReaderThread(ctx);
+        return SDL_SetError("Couldn't create wake pipe");
+    }
+    for (int i = 0; i < SDL_arraysize(ctx->wake_fds); ++i) {
+        fcntl(ctx->wake_fds[i], F_SETFL, fcntl(ctx->wake_fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(ctx->wake_fds[i], F_SETFD, FD_CLOEXEC);
+    }
+#else
+    ctx->wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (!ctx->wake_event) {
+        SDL_HIDAPI_StopReaderThread(ctx);
+        return WIN_SetError("CreateEvent");
+    }
+#endif
+
+    SDL_SetAtomicInt(&ctx->running, true);
+    ctx->thread = SDL_CreateThread(SDL_HIDAPI_ReaderThread, "HIDAPI Input", ctx);
+    if (!ctx->thread) {
+        SDL_HIDAPI_StopReaderThread(ctx);
+        return false;
+    }
+    return true;
+}
+
+bool SDL_HIDAPI_StartReading(SDL_HIDAPI_Device *device)
+{
+    SDL_HIDAPI_ReaderContext *ctx = &reader_context;
+    SDL_HIDAPI_InputQueue *queue;
+
+    if (!device->dev || device->input_queue) {
+        return false;
+    }
+
+    if (!SDL_GetHintBoolean(SDL_HINT_JOYSTICK_HIDAPI_INPUT_THREAD, true)) {
+        return false;
+    }
+
+    queue = (SDL_HIDAPI_InputQueue *)SDL_calloc(1, sizeof(*queue));
+    if (!queue) {
+        return false;
+    }
+    queue->device = device;
+#ifdef SDL_PLATFORM_LINUX
+    queue->fd = SDL_hid_get_read_fd(device->dev);
+    if (queue->fd < 0) {
+        SDL_free(queue);
+        return false;
+    }
+#else
+    queue->event = (HANDLE)SDL_hid_get_read_event(device->dev);
+    if (!queue->event) {
+        SDL_free(queue);
+        return false;
+    }
+#endif
+
+    if (!SDL_GetAtomicInt(&ctx->running) && !SDL_HIDAPI_StartReaderThread(ctx)) {
+        SDL_free(queue);
+        return false;
+    }
+
+    SDL_LockMutex(ctx->lock);
+    if (ctx->num_queues == SDL_arraysize(ctx->queues)) {
+        SDL_UnlockMutex(ctx->lock);
+        SDL_free(queue);
+        return false;
+    }
+    device->input_queue = queue;
+    ctx->queues[ctx->num_queues++] = queue;
+    ++ctx->generation;
+    SDL_UnlockMutex(ctx->lock);
+
+    SDL_HIDAPI_WakeReader(ctx);
+    return true;
+}
+
+static bool SDL_HIDAPI_PopReport(SDL_HIDAPI_InputQueue *queue, Uint8 *data, size_t size, int *result)
+{
+    const int tail = SDL_GetAtomicInt(&queue->tail);
+    const SDL_HIDAPI_InputReport *report;
+
+    if (tail == SDL_GetAtomicInt(&queue->head)) {
+        return false;
+    }
+
+    report = &queue->reports[tail];
+    *result = (int)SDL_min((size_t)report->size, size);
+    SDL_memcpy(data, report->data, *result);
+    SDL_SetAtomicInt(&queue->tail, (tail + 1) & (SDL_HIDAPI_INPUT_QUEUE_SIZE - 1));
+    return true;
+}
+
+int SDL_HIDAPI_ReadDevice(SDL_HIDAPI_Device *device, Uint8 *data, size_t size, int timeout)
+{
+    SDL_HIDAPI_InputQueue *queue = device->input_queue;
+    int result = 0;
+
+    if (!queue) {
+        return SDL_HIDAPI_ReadDevice(device, data, size, timeout);
+    }
+
+    if (SDL_HIDAPI_PopReport(queue, data, size, &result)) {
+        return result;
+    }
+
+    if (timeout == 0 && !SDL_GetAtomicInt(&queue->pending)) {
+        // Nothing new yet, the reader thread will queue anything that arrives
+        return SDL_GetAtomicInt(&queue->failed) ? -1 : 0;
+    }
+
+    // Read directly from the device, holding the lock keeps the reader thread from queuing anything newer meanwhile
+    SDL_LockMutex(device->dev_lock);
+    if (!SDL_HIDAPI_PopReport(queue, data, size, &result)) {
+        result = SDL_HIDAPI_ReadDevice(device, data, size, timeout);
+        if (result < 0) {
+            SDL_SetAtomicInt(&queue->failed, true);
+        }
+        if (result <= 0 && SDL_GetAtomicInt(&queue->pending)) {
+            // We've read everything that was available, hand the device back to the reader thread
+            SDL_SetAtomicInt(&queue->pending, false);
+            SDL_HIDAPI_WakeReader(&reader_context);
+        }
+    }
+    SDL_UnlockMutex(device->dev_lock);
+
+    return result;
+}
+
+void SDL_HIDAPI_StopReading(SDL_HIDAPI_Device *device)
+{
+    SDL_HIDAPI_ReaderContext *ctx = &reader_context;
+    SDL_HIDAPI_InputQueue *queue = device->input_queue;
+    int i;
+
+    if (!queue) {
+        return;
+    }
+
+    SDL_LockMutex(ctx->lock);
+    for (i = 0; i < ctx->num_queues; ++i) {
+        if (ctx->queues[i] == queue) {
+            --ctx->num_queues;
+            SDL_memmove(&ctx->queues[i], &ctx->queues[i + 1], (ctx->num_queues - i) * sizeof(*ctx->queues));
+            break;
+        }
+    }
+    ++ctx->generation;
+
+    // Wait for the reader thread to stop using the device
+    SDL_HIDAPI_WakeReader(ctx);
+    while (SDL_GetAtomicInt(&ctx->running) && ctx->thread_generation != ctx->generation) {
+        SDL_WaitCondition(ctx->cond, ctx->lock);
+    }
+    SDL_UnlockMutex(ctx->lock);
+
+    device->input_queue = NULL;
+    SDL_free(queue);
+}
+
+void SDL_HIDAPI_QuitReader(void)
+{
+    SDL_HIDAPI_ReaderContext *ctx = &reader_context;
+
+    if (SDL_GetAtomicInt(&ctx->running)) {
+        SDL_HIDAPI_StopReaderThread(ctx);
+    }
+}
+
+#else
+
+bool SDL_HIDAPI_StartReading(SDL_HIDAPI_Device *device)
+{
+    return false;
+}
+
+int SDL_HIDAPI_ReadDevice(SDL_HIDAPI_Device *device, Uint8 *data, size_t size, int timeout)
+{
+    return SDL_HIDAPI_ReadDevice(device, data, size, timeout);
+}
+
+void SDL_HIDAPI_StopReading(SDL_HIDAPI_Device *device)
+{
+}
+
+void SDL_HIDAPI_QuitReader(void)
+{
+}
+
+#endif // HAVE_HIDAPI_READ_WAIT
+
+#endif // SDL_JOYSTICK_HIDAPI
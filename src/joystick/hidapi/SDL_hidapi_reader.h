@@ -0,0 +1,38 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifdef SDL_JOYSTICK_HIDAPI
+
+// Read input reports for all devices on a single thread so driver updates don't have to wait on the device
+
+// Start queuing input reports for a device, returns false if it will be read directly instead
+bool SDL_HIDAPI_StartReading(SDL_HIDAPI_Device *device);
+
+// Read the next input report, this is a drop-in replacement for SDL_hid_read_timeout() on device->dev
+int SDL_HIDAPI_ReadDevice(SDL_HIDAPI_Device *device, Uint8 *data, size_t size, int timeout);
+
+// Stop queuing input reports, this must be called before the device is closed
+void SDL_HIDAPI_StopReading(SDL_HIDAPI_Device *device);
+
+void SDL_HIDAPI_QuitReader(void);
+
+#endif // SDL_JOYSTICK_HIDAPI
@@ -55,6 +55,43 @@ static
 SDL_Mutex *SDL_HIDAPI_rumble_lock;
 static SDL_HIDAPI_RumbleContext rumble_context SDL_GUARDED_BY(SDL_HIDAPI_rumble_lock);
 
+// The minimum time between output reports to a device, so rumble and LED updates don't saturate the link
+#define SDL_HIDAPI_RUMBLE_INTERVAL_USB       SDL_MS_TO_NS(4)
+#define SDL_HIDAPI_RUMBLE_INTERVAL_BLUETOOTH SDL_MS_TO_NS(10)
+
+static SDL_HIDAPI_RumbleRequest *SDL_HIDAPI_GetNextRumbleRequest(SDL_HIDAPI_RumbleContext *ctx, Sint64 *timeoutNS) SDL_REQUIRES(SDL_HIDAPI_rumble_lock)
+{
+    const Uint64 now = SDL_GetTicksNS();
+    SDL_HIDAPI_RumbleRequest *request, *older = NULL;
+
+    *timeoutNS = -1;
+
+    /* Send the oldest request for a device that's ready for another report.
+       Requests for a device that isn't ready stay in order behind it, while
+       other devices are serviced in the meantime.
+     */
+    for (request = ctx->requests_tail; request; older = request, request = request->prev) {
+        const Uint64 next_send_ns = request->device->rumble_next_send_ns;
+
+        if (next_send_ns <= now) {
+            if (request == ctx->requests_tail) {
+                ctx->requests_tail = request->prev;
+            } else {
+                older->prev = request->prev;
+            }
+            if (request == ctx->requests_head) {
+                ctx->requests_head = older;
+            }
+            return request;
+        }
+
+        if (*timeoutNS < 0 || (Sint64)(next_send_ns - now) < *timeoutNS) {
+            *timeoutNS = (Sint64)(next_send_ns - now);
+        }
+    }
+    return NULL;
+}
+
 static int SDLCALL SDL_HIDAPI_RumbleThread(void *data)
 {
     SDL_HIDAPI_RumbleContext *ctx = (SDL_HIDAPI_RumbleContext *)data;
@@ -63,36 +100,35 @@ static int SDLCALL SDL_HIDAPI_RumbleThread(void *data)
 
     while (SDL_GetAtomicInt(&ctx->running)) {
         SDL_HIDAPI_RumbleRequest *request = NULL;
-
-        SDL_WaitSemaphore(ctx->request_sem);
+        Sint64 timeoutNS;
 
         SDL_LockMutex(SDL_HIDAPI_rumble_lock);
-        request = ctx->requests_tail;
-        if (request) {
-            if (request == ctx->requests_head) {
-                ctx->requests_head = NULL;
-            }
-            ctx->requests_tail = request->prev;
-        }
+        request = SDL_HIDAPI_GetNextRumbleRequest(ctx, &timeoutNS);
         SDL_UnlockMutex(SDL_HIDAPI_rumble_lock);
 
         if (request) {
-            SDL_LockMutex(request->device->dev_lock);
-            if (request->device->dev) {
+            SDL_HIDAPI_Device *device = request->device;
+
+            SDL_LockMutex(device->dev_lock);
+            if (device->dev) {
 #ifdef DEBUG_RUMBLE
                 HIDAPI_DumpPacket("Rumble packet: size = %d", request->data, request->size);
 #endif
-                SDL_hid_write(request->device->dev, request->data, request->size);
+                SDL_hid_write(device->dev, request->data, request->size);
             }
-            SDL_UnlockMutex(request->device->dev_lock);
+            SDL_UnlockMutex(device->dev_lock);
+
+            device->rumble_next_send_ns = SDL_GetTicksNS() +
+                (device->is_bluetooth ? SDL_HIDAPI_RUMBLE_INTERVAL_BLUETOOTH : SDL_HIDAPI_RUMBLE_INTERVAL_USB);
+
             if (request->callback) {
                 request->callback(request->userdata);
             }
-            (void)SDL_AtomicDecRef(&request->device->rumble_pending);
+            (void)SDL_AtomicDecRef(&device->rumble_pending);
             SDL_free(request);
-
-            // Make sure we're not starving report reads when there's lots of rumble
-            SDL_Delay(10);
+        } else {
+            // Wait for a new request, or for a device to be ready for the next queued one
+            SDL_WaitSemaphoreTimeoutNS(ctx->request_sem, timeoutNS);
         }
     }
     return 0;
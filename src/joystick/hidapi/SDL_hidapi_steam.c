@@ -25,6 +25,7 @@
 #include "../../SDL_hints_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_STEAM
 
@@ -621,11 +622,11 @@ static bool ResetSteamController(SDL_HIDAPI_Device *dev, bool bSuppressErrorSpew
 //---------------------------------------------------------------------------
 // Read from a Steam Controller
 //---------------------------------------------------------------------------
-static int ReadSteamController(SDL_hid_device *dev, uint8_t *pData, int nDataSize)
+static int ReadSteamController(SDL_HIDAPI_Device *device, uint8_t *pData, int nDataSize)
 {
     SDL_memset(pData, 0, nDataSize);
     pData[0] = BLE_REPORT_NUMBER; // hid_read will also overwrite this with the same value, 0x03
-    return SDL_hid_read(dev, pData, nDataSize);
+    return SDL_HIDAPI_ReadDevice(device, pData, nDataSize, 0);
 }
 
 //---------------------------------------------------------------------------
@@ -1143,7 +1144,7 @@ static bool HIDAPI_DriverSteam_InitDevice(SDL_HIDAPI_Device *device)
         for (int attempt = 0; attempt < 5; ++attempt) {
             uint8_t data[128];
 
-            res = ReadSteamController(device->dev, data, sizeof(data));
+            res = ReadSteamController(device, data, sizeof(data));
             if (res == 0) {
                 SDL_Delay(1);
                 continue;
@@ -1367,7 +1368,7 @@ static bool HIDAPI_DriverSteam_UpdateDevice(SDL_HIDAPI_Device *device)
         int r, nPacketLength;
         const Uint8 *pPacket;
 
-        r = ReadSteamController(device->dev, data, sizeof(data));
+        r = ReadSteamController(device, data, sizeof(data));
         if (r == 0) {
             break;
         }
@@ -1385,7 +1386,7 @@ static bool HIDAPI_DriverSteam_UpdateDevice(SDL_HIDAPI_Device *device)
         pPacket = ctx->m_assembler.uBuffer;
 
         if (nPacketLength > 0 && UpdateSteamControllerState(pPacket, nPacketLength, &ctx->m_state)) {
-            Uint64 timestamp = SDL_GetTicksNS();
+            Uint64 timestamp = SDL_GetEventTicksNS();
 
             if (!ctx->connected) {
                 // Maybe we missed a wireless status packet?
@@ -24,6 +24,7 @@
 
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 #include "../SDL_joystick_c.h"
 
@@ -191,7 +192,7 @@ static float RemapValClamped(float val, float A, float B, float C, float D)
 static void HIDAPI_DriverSteamHori_HandleStatePacket(SDL_Joystick *joystick, SDL_DriverSteamHori_Context *ctx, Uint8 *data, int size)
 {
     Sint16 axis;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     // Make sure it's gamepad state and not OTA FW update info
     if (data[0] != REPORT_HEADER_USB && data[0] != REPORT_HEADER_BT) {
@@ -362,7 +363,7 @@ static bool HIDAPI_DriverSteamHori_UpdateDevice(SDL_HIDAPI_Device *device)
         return false;
     }
 
-    while ((size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 0)) > 0) {
+    while ((size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0)) > 0) {
 #ifdef DEBUG_HORI_PROTOCOL
         HIDAPI_DumpPacket("Google Hori packet: size = %d", data, size);
 #endif
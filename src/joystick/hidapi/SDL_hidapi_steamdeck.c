@@ -24,6 +24,7 @@
 
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 
 #ifdef SDL_JOYSTICK_HIDAPI_STEAMDECK
 
@@ -149,7 +150,7 @@ static void HIDAPI_DriverSteamDeck_HandleState(SDL_HIDAPI_Device *device,
 {
     float values[3];
     SDL_DriverSteamDeck_Context *ctx = (SDL_DriverSteamDeck_Context *)device->context;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (pInReport->payload.deckState.ulButtons != ctx->last_button_state) {
         Uint8 hat = 0;
@@ -299,7 +300,7 @@ static bool HIDAPI_DriverSteamDeck_InitDevice(SDL_HIDAPI_Device *device)
     // Read a report to see if this is the correct endpoint.
     // Mouse, Keyboard and Controller have the same VID/PID but
     // only the controller hidraw device receives hid reports.
-    size = SDL_hid_read_timeout(device->dev, data, sizeof(data), 16);
+    size = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 16);
     if (size == 0)
         return false;
 
@@ -346,7 +347,7 @@ static bool HIDAPI_DriverSteamDeck_UpdateDevice(SDL_HIDAPI_Device *device)
     SDL_memset(data, 0, sizeof(data));
 
     do {
-        r = SDL_hid_read(device->dev, data, sizeof(data));
+        r = SDL_HIDAPI_ReadDevice(device, data, sizeof(data), 0);
 
         if (r < 0) {
             // Failed to read from controller
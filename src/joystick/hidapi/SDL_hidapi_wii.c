@@ -25,6 +25,7 @@
 #include "../../SDL_hints_c.h"
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 #include "SDL_hidapi_nintendo.h"
 
@@ -198,7 +199,7 @@ static int ReadInput(SDL_DriverWii_Context *ctx)
         return 0;
     }
 
-    size = SDL_hid_read_timeout(ctx->device->dev, ctx->m_rgucReadBuffer, sizeof(ctx->m_rgucReadBuffer), 0);
+    size = SDL_HIDAPI_ReadDevice(ctx->device, ctx->m_rgucReadBuffer, sizeof(ctx->m_rgucReadBuffer), 0);
 #ifdef DEBUG_WII_PROTOCOL
     if (size > 0) {
         HIDAPI_DumpPacket("Wii packet: size = %d", ctx->m_rgucReadBuffer, size);
@@ -1496,7 +1497,7 @@ static void HandleInput(SDL_DriverWii_Context *ctx, SDL_Joystick *joystick)
     EWiiInputReportIDs type = (EWiiInputReportIDs)ctx->m_rgucReadBuffer[0];
 
     // Set up for handling input
-    ctx->timestamp = SDL_GetTicksNS();
+    ctx->timestamp = SDL_GetEventTicksNS();
 
     if (type == k_eWiiInputReportIDs_Status) {
         HandleStatus(ctx, joystick);
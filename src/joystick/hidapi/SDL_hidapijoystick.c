@@ -24,6 +24,7 @@
 
 #include "../SDL_sysjoystick.h"
 #include "SDL_hidapijoystick_c.h"
+#include "SDL_hidapi_reader.h"
 #include "SDL_hidapi_rumble.h"
 #include "../../SDL_hints_c.h"
 
@@ -424,6 +425,8 @@ static void HIDAPI_CleanupDeviceDriver(SDL_HIDAPI_Device *device)
     device->driver->FreeDevice(device);
     device->driver = NULL;
 
+    SDL_HIDAPI_StopReading(device);
+
     SDL_LockMutex(device->dev_lock);
     {
         if (device->dev) {
@@ -496,6 +499,10 @@ static void HIDAPI_SetupDeviceDriver(SDL_HIDAPI_Device *device, bool *removed) S
             HIDAPI_CleanupDeviceDriver(device);
         }
 
+        if (device->driver && device->dev) {
+            SDL_HIDAPI_StartReading(device);
+        }
+
         if (!device->driver && device->dev) {
             // No driver claimed this device, go ahead and close it
             SDL_hid_close(device->dev);
@@ -1700,6 +1707,8 @@ static void HIDAPI_JoystickQuit(void)
         }
     }
 
+    SDL_HIDAPI_QuitReader();
+
     // Make sure the drivers cleaned up properly
     SDL_assert(SDL_HIDAPI_numjoysticks == 0);
 
@@ -68,6 +68,7 @@
 
 // Forward declaration
 struct SDL_HIDAPI_DeviceDriver;
+typedef struct SDL_HIDAPI_InputQueue SDL_HIDAPI_InputQueue;
 
 typedef struct SDL_HIDAPI_Device
 {
@@ -96,6 +97,8 @@ typedef struct SDL_HIDAPI_Device
     SDL_Mutex *dev_lock;
     SDL_hid_device *dev;
     SDL_AtomicInt rumble_pending;
+    Uint64 rumble_next_send_ns; // Used by the rumble thread to pace output reports
+    SDL_HIDAPI_InputQueue *input_queue; // Input reports read on the HIDAPI input thread
     int num_joysticks;
     SDL_JoystickID *joysticks;
 
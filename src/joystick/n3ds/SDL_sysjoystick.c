@@ -103,7 +103,7 @@ static bool N3DS_JoystickSetSensorsEnabled(SDL_Joystick *joystick, bool enabled)
 
 static void N3DS_JoystickUpdate(SDL_Joystick *joystick)
 {
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     UpdateN3DSPressedButtons(timestamp, joystick);
     UpdateN3DSReleasedButtons(timestamp, joystick);
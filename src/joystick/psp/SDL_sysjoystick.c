@@ -202,7 +202,7 @@ static void PSP_JoystickUpdate(SDL_Joystick *joystick)
     unsigned char x, y;
     static enum PspCtrlButtons old_buttons = 0;
     static unsigned char old_x = 0, old_y = 0;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (sceCtrlPeekBufferPositive(&pad, 1) <= 0) {
         return;
@@ -1627,7 +1627,7 @@ static void RAWINPUT_HandleStatePacket(SDL_Joystick *joystick, Uint8 *data, int
     int naxes = joystick->naxes - (ctx->trigger_hack * 2);
     int nhats = joystick->nhats;
     Uint32 button_mask = 0;
-    Uint64 timestamp = SDL_GetTicksNS();
+    Uint64 timestamp = SDL_GetEventTicksNS();
 
     if (SDL_HidP_GetData(HidP_Input, ctx->data, &data_length, ctx->preparsed_data, (PCHAR)data, size) != HIDP_STATUS_SUCCESS) {
         return;
@@ -1959,7 +1959,7 @@ static void RAWINPUT_UpdateOtherAPIs(SDL_Joystick *joystick)
             Uint64 timestamp;
 
             if (ctx->guide_hack || ctx->trigger_hack) {
-                timestamp = SDL_GetTicksNS();
+                timestamp = SDL_GetEventTicksNS();
             } else {
                 // timestamp won't be used
                 timestamp = 0;
@@ -2017,7 +2017,7 @@ static void RAWINPUT_UpdateOtherAPIs(SDL_Joystick *joystick)
             Uint64 timestamp;
 
             if (ctx->guide_hack || ctx->trigger_hack) {
-                timestamp = SDL_GetTicksNS();
+                timestamp = SDL_GetEventTicksNS();
             } else {
                 // timestamp won't be used
                 timestamp = 0;
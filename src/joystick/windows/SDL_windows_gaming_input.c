@@ -41,6 +41,10 @@
 #define __FIReference_1_int_Release   __FIReference_1_INT32_Release
 #endif
 
+// The minimum time between vibration updates, so rumble every frame doesn't saturate the link
+#define WGI_VIBRATION_INTERVAL_WIRED    SDL_MS_TO_NS(4)
+#define WGI_VIBRATION_INTERVAL_WIRELESS SDL_MS_TO_NS(10)
+
 struct joystick_hwdata
 {
     __x_ABI_CWindows_CGaming_CInput_CIRawGameController *controller;
@@ -48,7 +52,11 @@ struct joystick_hwdata
     __x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo *battery;
     __x_ABI_CWindows_CGaming_CInput_CIGamepad *gamepad;
     __x_ABI_CWindows_CGaming_CInput_CGamepadVibration vibration;
+    bool vibration_pending;
+    Uint64 vibration_next_send_ns;
     UINT64 timestamp;
+    SDL_Joystick *joystick;
+    struct joystick_hwdata *next; // next open joystick, for the polling thread
 };
 
 typedef struct WindowsGamingInputControllerState
@@ -59,6 +67,15 @@ typedef struct WindowsGamingInputControllerState
     SDL_GUID guid;
     SDL_JoystickType type;
     int steam_virtual_gamepad_slot;
+
+    // Resolved when the controller is added, so opening it doesn't need any COM calls
+    __x_ABI_CWindows_CGaming_CInput_CIGameController *game_controller;
+    __x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo *battery;
+    __x_ABI_CWindows_CGaming_CInput_CIGamepad *gamepad;
+    boolean wireless;
+    INT32 nbuttons;
+    INT32 naxes;
+    INT32 nhats;
 } WindowsGamingInputControllerState;
 
 typedef HRESULT(WINAPI *CoIncrementMTAUsage_t)(CO_MTA_USAGE_COOKIE *pCookie);
@@ -86,6 +103,13 @@ static struct
     EventRegistrationToken controller_removed_token;
     int controller_count;
     WindowsGamingInputControllerState *controllers;
+    int pending_adds;  // controllers being prepared outside the joystick lock
+    int removed_while_pending_count;
+    __x_ABI_CWindows_CGaming_CInput_CIRawGameController **removed_while_pending;
+    struct joystick_hwdata *open_joysticks;
+    SDL_Thread *polling_thread;
+    SDL_AtomicInt polling_thread_quit;
+    Uint64 polling_interval_ns;
 } wgi;
 
 // WinRT headers in official Windows SDK contain only declarations, and we have to define these GUIDs ourselves.
@@ -294,11 +318,7 @@ static SDL_JoystickType GetGameControllerType(__x_ABI_CWindows_CGaming_CInput_CI
     __x_ABI_CWindows_CGaming_CInput_CIGamepad *gamepad = NULL;
     __x_ABI_CWindows_CGaming_CInput_CIRacingWheel *racing_wheel = NULL;
 
-    /* Wait to initialize these interfaces until we need them.
-     * Initializing the gamepad interface will switch Bluetooth PS4 controllers into enhanced mode, breaking DirectInput
-     */
-    WGI_LoadOtherControllerStatics();
-
+    // The statics were loaded by WGI_LoadOtherControllerStatics() with the joystick lock held
     if (wgi.gamepad_statics2 && SUCCEEDED(__x_ABI_CWindows_CGaming_CInput_CIGamepadStatics2_FromGameController(wgi.gamepad_statics2, game_controller, &gamepad)) && gamepad) {
         __x_ABI_CWindows_CGaming_CInput_CIGamepad_Release(gamepad);
         return SDL_JOYSTICK_TYPE_GAMEPAD;
@@ -390,10 +410,63 @@ static int GetSteamVirtualGamepadSlot(__x_ABI_CWindows_CGaming_CInput_CIRawGameC
     return slot;
 }
 
+static void WGI_FreeControllerState(WindowsGamingInputControllerState *state)
+{
+    if (state->gamepad) {
+        __x_ABI_CWindows_CGaming_CInput_CIGamepad_Release(state->gamepad);
+    }
+    if (state->battery) {
+        __x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo_Release(state->battery);
+    }
+    if (state->game_controller) {
+        __x_ABI_CWindows_CGaming_CInput_CIGameController_Release(state->game_controller);
+    }
+    if (state->controller) {
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(state->controller);
+    }
+    SDL_free(state->name);
+}
+
+// Returns true if the controller was removed while it was being prepared, and forgets about the removal
+static bool WGI_TakePendingRemoval(__x_ABI_CWindows_CGaming_CInput_CIRawGameController *controller)
+{
+    bool removed = false;
+
+    SDL_AssertJoysticksLocked();
+
+    for (int i = 0; i < wgi.removed_while_pending_count; ++i) {
+        if (wgi.removed_while_pending[i] == controller) {
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(controller);
+            wgi.removed_while_pending[i] = wgi.removed_while_pending[--wgi.removed_while_pending_count];
+            removed = true;
+            break;
+        }
+    }
+
+    if (wgi.pending_adds == 0) {
+        while (wgi.removed_while_pending_count > 0) {
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(wgi.removed_while_pending[--wgi.removed_while_pending_count]);
+        }
+        SDL_free(wgi.removed_while_pending);
+        wgi.removed_while_pending = NULL;
+    }
+    return removed;
+}
+
+/* WGI raises this on one of its own threads, which can happen any time during
+   the game. All the COM calls are made without the joystick lock, so the game
+   loop never waits on them in SDL_UpdateJoysticks(), and the controller is
+   only published to the joystick list once it's ready to be opened. */
 static HRESULT STDMETHODCALLTYPE IEventHandler_CRawGameControllerVtbl_InvokeAdded(__FIEventHandler_1_Windows__CGaming__CInput__CRawGameController *This, IInspectable *sender, __x_ABI_CWindows_CGaming_CInput_CIRawGameController *e)
 {
     HRESULT hr;
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController *controller = NULL;
+    WindowsGamingInputControllerState state;
+    __x_ABI_CWindows_CGaming_CInput_CIRawGameController2 *controller2 = NULL;
+    Uint16 bus = SDL_HARDWARE_BUS_USB;
+    Uint16 vendor = 0;
+    Uint16 product = 0;
+    Uint16 version = 0;
+    bool ignore_joystick = false;
 
     SDL_LockJoysticks();
 
@@ -402,27 +475,20 @@ static HRESULT STDMETHODCALLTYPE IEventHandler_CRawGameControllerVtbl_InvokeAdde
         SDL_UnlockJoysticks();
         return S_OK;
     }
+    ++wgi.pending_adds;
 
-    hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(e, &IID___x_ABI_CWindows_CGaming_CInput_CIRawGameController, (void **)&controller);
-    if (SUCCEEDED(hr)) {
-        char *name = NULL;
-        Uint16 bus = SDL_HARDWARE_BUS_USB;
-        Uint16 vendor = 0;
-        Uint16 product = 0;
-        Uint16 version = 0;
-        SDL_JoystickType type = SDL_JOYSTICK_TYPE_UNKNOWN;
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameController2 *controller2 = NULL;
-        __x_ABI_CWindows_CGaming_CInput_CIGameController *game_controller = NULL;
-        bool ignore_joystick = false;
+    SDL_UnlockJoysticks();
 
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_HardwareVendorId(controller, &vendor);
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_HardwareProductId(controller, &product);
+    SDL_zero(state);
+    hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(e, &IID___x_ABI_CWindows_CGaming_CInput_CIRawGameController, (void **)&state.controller);
+    if (SUCCEEDED(hr)) {
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_HardwareVendorId(state.controller, &vendor);
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_HardwareProductId(state.controller, &product);
 
-        hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(controller, &IID___x_ABI_CWindows_CGaming_CInput_CIGameController, (void **)&game_controller);
+        hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(state.controller, &IID___x_ABI_CWindows_CGaming_CInput_CIGameController, (void **)&state.game_controller);
         if (SUCCEEDED(hr)) {
-            boolean wireless = 0;
-            hr = __x_ABI_CWindows_CGaming_CInput_CIGameController_get_IsWireless(game_controller, &wireless);
-            if (SUCCEEDED(hr) && wireless) {
+            hr = __x_ABI_CWindows_CGaming_CInput_CIGameController_get_IsWireless(state.game_controller, &state.wireless);
+            if (SUCCEEDED(hr) && state.wireless) {
                 bus = SDL_HARDWARE_BUS_BLUETOOTH;
 
                 // Fixup for Wireless Xbox 360 Controller
@@ -431,77 +497,107 @@ static HRESULT STDMETHODCALLTYPE IEventHandler_CRawGameControllerVtbl_InvokeAdde
                     product = USB_PRODUCT_XBOX360_XUSB_CONTROLLER;
                 }
             }
-
-            __x_ABI_CWindows_CGaming_CInput_CIGameController_Release(game_controller);
+        } else {
+            state.game_controller = NULL;
         }
 
-        hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(controller, &IID___x_ABI_CWindows_CGaming_CInput_CIRawGameController2, (void **)&controller2);
+        hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(state.controller, &IID___x_ABI_CWindows_CGaming_CInput_CIRawGameController2, (void **)&controller2);
         if (SUCCEEDED(hr)) {
             HSTRING hString;
             hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController2_get_DisplayName(controller2, &hString);
             if (SUCCEEDED(hr)) {
                 PCWSTR string = wgi.WindowsGetStringRawBuffer(hString, NULL);
                 if (string) {
-                    name = WIN_StringToUTF8W(string);
+                    state.name = WIN_StringToUTF8W(string);
                 }
                 wgi.WindowsDeleteString(hString);
             }
             __x_ABI_CWindows_CGaming_CInput_CIRawGameController2_Release(controller2);
         }
-        if (!name) {
-            name = SDL_strdup("");
-        }
-
-        if (!ignore_joystick && SDL_ShouldIgnoreJoystick(vendor, product, version, name)) {
-            ignore_joystick = true;
+        if (!state.name) {
+            state.name = SDL_strdup("");
         }
+        state.steam_virtual_gamepad_slot = GetSteamVirtualGamepadSlot(state.controller, vendor, product);
+    } else {
+        state.controller = NULL;
+        ignore_joystick = true;
+    }
 
-        if (!ignore_joystick && SDL_JoystickHandledByAnotherDriver(&SDL_WGI_JoystickDriver, vendor, product, version, name)) {
-            ignore_joystick = true;
-        }
+    SDL_LockJoysticks();
 
-        if (!ignore_joystick && SDL_IsXInputDevice(vendor, product, name)) {
-            // This hasn't been detected by the RAWINPUT driver yet, but it will be picked up later.
-            ignore_joystick = true;
-        }
+    if (SDL_JoysticksQuitting() || !SDL_JoysticksInitialized()) {
+        ignore_joystick = true;
+    }
 
-        if (!ignore_joystick) {
-            // New device, add it
-            WindowsGamingInputControllerState *controllers = SDL_realloc(wgi.controllers, sizeof(wgi.controllers[0]) * (wgi.controller_count + 1));
-            if (controllers) {
-                WindowsGamingInputControllerState *state = &controllers[wgi.controller_count];
-                SDL_JoystickID joystickID = SDL_GetNextObjectID();
+    if (!ignore_joystick && SDL_ShouldIgnoreJoystick(vendor, product, version, state.name)) {
+        ignore_joystick = true;
+    }
 
-                if (game_controller) {
-                    type = GetGameControllerType(game_controller);
-                }
+    if (!ignore_joystick && SDL_JoystickHandledByAnotherDriver(&SDL_WGI_JoystickDriver, vendor, product, version, state.name)) {
+        ignore_joystick = true;
+    }
 
-                SDL_zerop(state);
-                state->instance_id = joystickID;
-                state->controller = controller;
-                state->name = name;
-                state->guid = SDL_CreateJoystickGUID(bus, vendor, product, version, NULL, name, 'w', (Uint8)type);
-                state->type = type;
-                state->steam_virtual_gamepad_slot = GetSteamVirtualGamepadSlot(controller, vendor, product);
+    if (!ignore_joystick && SDL_IsXInputDevice(vendor, product, state.name)) {
+        // This hasn't been detected by the RAWINPUT driver yet, but it will be picked up later.
+        ignore_joystick = true;
+    }
 
-                __x_ABI_CWindows_CGaming_CInput_CIRawGameController_AddRef(controller);
+    if (!ignore_joystick) {
+        /* Wait to initialize these interfaces until we need them.
+         * Initializing the gamepad interface will switch Bluetooth PS4 controllers into enhanced mode, breaking DirectInput
+         */
+        WGI_LoadOtherControllerStatics();
+    }
 
-                ++wgi.controller_count;
-                wgi.controllers = controllers;
+    SDL_UnlockJoysticks();
 
-                SDL_PrivateJoystickAdded(joystickID);
-            } else {
-                SDL_free(name);
+    if (!ignore_joystick) {
+        // Everything WGI_JoystickOpen() needs
+        if (state.game_controller) {
+            state.type = GetGameControllerType(state.game_controller);
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(state.controller, &IID___x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo, (void **)&state.battery);
+            if (wgi.gamepad_statics2) {
+                __x_ABI_CWindows_CGaming_CInput_CIGamepadStatics2_FromGameController(wgi.gamepad_statics2, state.game_controller, &state.gamepad);
             }
-        } else {
-            SDL_free(name);
         }
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_ButtonCount(state.controller, &state.nbuttons);
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_AxisCount(state.controller, &state.naxes);
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_SwitchCount(state.controller, &state.nhats);
+
+        state.guid = SDL_CreateJoystickGUID(bus, vendor, product, version, NULL, state.name, 'w', (Uint8)state.type);
+    }
+
+    SDL_LockJoysticks();
+
+    if (SDL_JoysticksQuitting() || !SDL_JoysticksInitialized()) {
+        // WGI_JoystickQuit() already cleaned up the pending state
+        ignore_joystick = true;
+    } else {
+        --wgi.pending_adds;
+        if (state.controller && WGI_TakePendingRemoval(state.controller)) {
+            ignore_joystick = true;
+        }
+    }
+
+    if (!ignore_joystick) {
+        // New device, add it
+        WindowsGamingInputControllerState *controllers = SDL_realloc(wgi.controllers, sizeof(wgi.controllers[0]) * (wgi.controller_count + 1));
+        if (controllers) {
+            state.instance_id = SDL_GetNextObjectID();
+            controllers[wgi.controller_count] = state;
+            SDL_zero(state);
 
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(controller);
+            ++wgi.controller_count;
+            wgi.controllers = controllers;
+
+            SDL_PrivateJoystickAdded(controllers[wgi.controller_count - 1].instance_id);
+        }
     }
 
     SDL_UnlockJoysticks();
 
+    WGI_FreeControllerState(&state);
+
     return S_OK;
 }
 
@@ -520,28 +616,38 @@ static HRESULT STDMETHODCALLTYPE IEventHandler_CRawGameControllerVtbl_InvokeRemo
 
     hr = __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(e, &IID___x_ABI_CWindows_CGaming_CInput_CIRawGameController, (void **)&controller);
     if (SUCCEEDED(hr)) {
+        bool found = false;
         int i;
 
         for (i = 0; i < wgi.controller_count; i++) {
             if (wgi.controllers[i].controller == controller) {
-                WindowsGamingInputControllerState *state = &wgi.controllers[i];
-                SDL_JoystickID joystickID = state->instance_id;
-
-                __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(state->controller);
-
-                SDL_free(state->name);
+                WindowsGamingInputControllerState state = wgi.controllers[i];
 
                 --wgi.controller_count;
                 if (i < wgi.controller_count) {
                     SDL_memmove(&wgi.controllers[i], &wgi.controllers[i + 1], (wgi.controller_count - i) * sizeof(wgi.controllers[i]));
                 }
 
-                SDL_PrivateJoystickRemoved(joystickID);
+                SDL_PrivateJoystickRemoved(state.instance_id);
+                WGI_FreeControllerState(&state);
+                found = true;
                 break;
             }
         }
 
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(controller);
+        if (!found && wgi.pending_adds > 0) {
+            // It's still being prepared, so make sure it doesn't get added after this
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController **removed = SDL_realloc(wgi.removed_while_pending, sizeof(*removed) * (wgi.removed_while_pending_count + 1));
+            if (removed) {
+                removed[wgi.removed_while_pending_count++] = controller;
+                wgi.removed_while_pending = removed;
+                controller = NULL;
+            }
+        }
+
+        if (controller) {
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(controller);
+        }
     }
 
     SDL_UnlockJoysticks();
@@ -581,6 +687,8 @@ static RawGameControllerDelegate controller_removed = {
 #pragma warning(pop)
 #endif
 
+static bool WGI_StartPollingThread(void);
+
 static bool WGI_JoystickInit(void)
 {
     HRESULT hr;
@@ -660,6 +768,10 @@ static bool WGI_JoystickInit(void)
 
             __FIVectorView_1_Windows__CGaming__CInput__CRawGameController_Release(controllers);
         }
+
+        if (!WGI_StartPollingThread()) {
+            return false;
+        }
     }
 
     return true;
@@ -718,7 +830,6 @@ static bool WGI_JoystickOpen(SDL_Joystick *joystick, int device_index)
 {
     WindowsGamingInputControllerState *state = &wgi.controllers[device_index];
     struct joystick_hwdata *hwdata;
-    boolean wireless = false;
 
     hwdata = (struct joystick_hwdata *)SDL_calloc(1, sizeof(*hwdata));
     if (!hwdata) {
@@ -726,53 +837,76 @@ static bool WGI_JoystickOpen(SDL_Joystick *joystick, int device_index)
     }
     joystick->hwdata = hwdata;
 
+    hwdata->joystick = joystick;
+
+    // The interfaces were all resolved when the controller was added
     hwdata->controller = state->controller;
     __x_ABI_CWindows_CGaming_CInput_CIRawGameController_AddRef(hwdata->controller);
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(hwdata->controller, &IID___x_ABI_CWindows_CGaming_CInput_CIGameController, (void **)&hwdata->game_controller);
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController_QueryInterface(hwdata->controller, &IID___x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo, (void **)&hwdata->battery);
-
-    if (wgi.gamepad_statics2) {
-        __x_ABI_CWindows_CGaming_CInput_CIGamepadStatics2_FromGameController(wgi.gamepad_statics2, hwdata->game_controller, &hwdata->gamepad);
-    }
-
+    hwdata->game_controller = state->game_controller;
     if (hwdata->game_controller) {
-        __x_ABI_CWindows_CGaming_CInput_CIGameController_get_IsWireless(hwdata->game_controller, &wireless);
+        __x_ABI_CWindows_CGaming_CInput_CIGameController_AddRef(hwdata->game_controller);
+    }
+    hwdata->battery = state->battery;
+    if (hwdata->battery) {
+        __x_ABI_CWindows_CGaming_CInput_CIGameControllerBatteryInfo_AddRef(hwdata->battery);
+    }
+    hwdata->gamepad = state->gamepad;
+    if (hwdata->gamepad) {
+        __x_ABI_CWindows_CGaming_CInput_CIGamepad_AddRef(hwdata->gamepad);
     }
 
     // Initialize the joystick capabilities
-    if (wireless) {
+    if (state->wireless) {
         joystick->connection_state = SDL_JOYSTICK_CONNECTION_WIRELESS;
     } else {
         joystick->connection_state = SDL_JOYSTICK_CONNECTION_WIRED;
     }
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_ButtonCount(hwdata->controller, &joystick->nbuttons);
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_AxisCount(hwdata->controller, &joystick->naxes);
-    __x_ABI_CWindows_CGaming_CInput_CIRawGameController_get_SwitchCount(hwdata->controller, &joystick->nhats);
+    joystick->nbuttons = state->nbuttons;
+    joystick->naxes = state->naxes;
+    joystick->nhats = state->nhats;
 
     if (hwdata->gamepad) {
         // FIXME: Can WGI even tell us if trigger rumble is supported?
         SDL_SetBooleanProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN, true);
         SDL_SetBooleanProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN, true);
     }
+
+    hwdata->next = wgi.open_joysticks;
+    wgi.open_joysticks = hwdata;
     return true;
 }
 
+static void WGI_JoystickSendVibration(SDL_Joystick *joystick, bool force)
+{
+    struct joystick_hwdata *hwdata = joystick->hwdata;
+    const Uint64 now = SDL_GetTicksNS();
+
+    if (!hwdata->vibration_pending || (!force && now < hwdata->vibration_next_send_ns)) {
+        return;
+    }
+
+    __x_ABI_CWindows_CGaming_CInput_CIGamepad_put_Vibration(hwdata->gamepad, hwdata->vibration);
+    hwdata->vibration_pending = false;
+    if (joystick->connection_state == SDL_JOYSTICK_CONNECTION_WIRELESS) {
+        hwdata->vibration_next_send_ns = now + WGI_VIBRATION_INTERVAL_WIRELESS;
+    } else {
+        hwdata->vibration_next_send_ns = now + WGI_VIBRATION_INTERVAL_WIRED;
+    }
+}
+
 static bool WGI_JoystickRumble(SDL_Joystick *joystick, Uint16 low_frequency_rumble, Uint16 high_frequency_rumble)
 {
     struct joystick_hwdata *hwdata = joystick->hwdata;
 
     if (hwdata->gamepad) {
-        HRESULT hr;
-
         // Note: reusing partially filled vibration data struct
         hwdata->vibration.LeftMotor = (DOUBLE)low_frequency_rumble / SDL_MAX_UINT16;
         hwdata->vibration.RightMotor = (DOUBLE)high_frequency_rumble / SDL_MAX_UINT16;
-        hr = __x_ABI_CWindows_CGaming_CInput_CIGamepad_put_Vibration(hwdata->gamepad, hwdata->vibration);
-        if (SUCCEEDED(hr)) {
-            return true;
-        } else {
-            return WIN_SetErrorFromHRESULT("Windows.Gaming.Input.IGamepad.put_Vibration failed", hr);
-        }
+
+        // The latest values are sent on the next update, replacing anything not sent yet
+        hwdata->vibration_pending = true;
+        WGI_JoystickSendVibration(joystick, false);
+        return true;
     } else {
         return SDL_Unsupported();
     }
@@ -783,17 +917,14 @@ static bool WGI_JoystickRumbleTriggers(SDL_Joystick *joystick, Uint16 left_rumbl
     struct joystick_hwdata *hwdata = joystick->hwdata;
 
     if (hwdata->gamepad) {
-        HRESULT hr;
-
         // Note: reusing partially filled vibration data struct
         hwdata->vibration.LeftTrigger = (DOUBLE)left_rumble / SDL_MAX_UINT16;
         hwdata->vibration.RightTrigger = (DOUBLE)right_rumble / SDL_MAX_UINT16;
-        hr = __x_ABI_CWindows_CGaming_CInput_CIGamepad_put_Vibration(hwdata->gamepad, hwdata->vibration);
-        if (SUCCEEDED(hr)) {
-            return true;
-        } else {
-            return WIN_SetErrorFromHRESULT("Windows.Gaming.Input.IGamepad.put_Vibration failed", hr);
-        }
+
+        // The latest values are sent on the next update, replacing anything not sent yet
+        hwdata->vibration_pending = true;
+        WGI_JoystickSendVibration(joystick, false);
+        return true;
     } else {
         return SDL_Unsupported();
     }
@@ -838,7 +969,27 @@ static Uint8 ConvertHatValue(__x_ABI_CWindows_CGaming_CInput_CGameControllerSwit
     }
 }
 
-static void WGI_JoystickUpdate(SDL_Joystick *joystick)
+static Uint64 WGI_ConvertTimestamp(UINT64 timestamp)
+{
+    /* Readings are stamped with the performance counter value of when the
+     * controller state was retrieved. Convert that to SDL's timebase from how
+     * long ago it was, and fall back to the current time for anything that
+     * doesn't look like a recent counter value.
+     */
+    const Uint64 now_ns = SDL_GetTicksNS();
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    if (timestamp && timestamp <= now && (now - timestamp) < frequency) {
+        const Uint64 age_ns = ((now - timestamp) * SDL_NS_PER_SECOND) / frequency;
+        if (age_ns < now_ns) {
+            return now_ns - age_ns;
+        }
+    }
+    return now_ns;
+}
+
+static void WGI_JoystickUpdateReading(SDL_Joystick *joystick)
 {
     struct joystick_hwdata *hwdata = joystick->hwdata;
     HRESULT hr;
@@ -880,8 +1031,7 @@ static void WGI_JoystickUpdate(SDL_Joystick *joystick)
         if (all_zero) {
             SDL_PrivateJoystickForceRecentering(joystick);
         } else {
-            // FIXME: What units are the timestamp we get from GetCurrentReading()?
-            timestamp = SDL_GetTicksNS();
+            timestamp = WGI_ConvertTimestamp(timestamp);
             for (i = 0; i < nbuttons; ++i) {
                 SDL_SendJoystickButton(timestamp, joystick, (Uint8)i, buttons[i]);
             }
@@ -897,6 +1047,86 @@ static void WGI_JoystickUpdate(SDL_Joystick *joystick)
     SDL_stack_free(buttons);
     SDL_stack_free(hats);
     SDL_stack_free(axes);
+}
+
+static int SDLCALL WGI_PollingThread(void *data)
+{
+    const bool ro_initialized = SUCCEEDED(WIN_RoInitialize());
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!SDL_GetAtomicInt(&wgi.polling_thread_quit)) {
+        const Uint64 start = SDL_GetTicksNS();
+        Uint64 elapsed;
+        struct joystick_hwdata *hwdata;
+
+        /* The SDL_SendJoystick*() functions drop values that haven't changed,
+         * so only state changes end up in the event queue.
+         */
+        SDL_LockJoysticks();
+        for (hwdata = wgi.open_joysticks; hwdata; hwdata = hwdata->next) {
+            WGI_JoystickUpdateReading(hwdata->joystick);
+            WGI_JoystickSendVibration(hwdata->joystick, false);
+        }
+        SDL_UnlockJoysticks();
+
+        elapsed = SDL_GetTicksNS() - start;
+        if (elapsed < wgi.polling_interval_ns) {
+            SDL_DelayPrecise(wgi.polling_interval_ns - elapsed);
+        }
+    }
+
+    if (ro_initialized) {
+        WIN_RoUninitialize();
+    }
+    return 0;
+}
+
+static bool WGI_StartPollingThread(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_JOYSTICK_WGI_POLLING_RATE);
+    int rate = hint ? SDL_atoi(hint) : 0;
+
+    if (rate <= 0) {
+        return true;
+    }
+    rate = SDL_min(rate, 8000);
+
+    wgi.polling_interval_ns = SDL_NS_PER_SECOND / rate;
+    SDL_SetAtomicInt(&wgi.polling_thread_quit, 0);
+    wgi.polling_thread = SDL_CreateThread(WGI_PollingThread, "SDL_wgi_poll", NULL);
+    if (!wgi.polling_thread) {
+        return false;
+    }
+    return true;
+}
+
+static void WGI_StopPollingThread(void)
+{
+    if (!wgi.polling_thread) {
+        return;
+    }
+
+    SDL_SetAtomicInt(&wgi.polling_thread_quit, 1);
+
+    // Unlock joysticks while the polling thread finishes its last pass
+    SDL_AssertJoysticksLocked();
+    SDL_UnlockJoysticks();
+    SDL_WaitThread(wgi.polling_thread, NULL);
+    SDL_LockJoysticks();
+
+    wgi.polling_thread = NULL;
+}
+
+static void WGI_JoystickUpdate(SDL_Joystick *joystick)
+{
+    struct joystick_hwdata *hwdata = joystick->hwdata;
+    HRESULT hr;
+
+    if (!wgi.polling_thread) {
+        WGI_JoystickUpdateReading(joystick);
+        WGI_JoystickSendVibration(joystick, false);
+    }
 
     if (hwdata->battery) {
         __x_ABI_CWindows_CDevices_CPower_CIBatteryReport *report = NULL;
@@ -958,6 +1188,18 @@ static void WGI_JoystickClose(SDL_Joystick *joystick)
     struct joystick_hwdata *hwdata = joystick->hwdata;
 
     if (hwdata) {
+        struct joystick_hwdata **link;
+
+        // Make sure the last rumble update, usually turning it off, reaches the controller
+        WGI_JoystickSendVibration(joystick, true);
+
+        for (link = &wgi.open_joysticks; *link; link = &(*link)->next) {
+            if (*link == hwdata) {
+                *link = hwdata->next;
+                break;
+            }
+        }
+
         if (hwdata->controller) {
             __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(hwdata->controller);
         }
@@ -977,13 +1219,23 @@ static void WGI_JoystickClose(SDL_Joystick *joystick)
 
 static void WGI_JoystickQuit(void)
 {
+    WGI_StopPollingThread();
+
     if (wgi.controller_statics) {
+        // Stop hotplug notifications before tearing down what they use
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameControllerStatics_remove_RawGameControllerAdded(wgi.controller_statics, wgi.controller_added_token);
+        __x_ABI_CWindows_CGaming_CInput_CIRawGameControllerStatics_remove_RawGameControllerRemoved(wgi.controller_statics, wgi.controller_removed_token);
+
         while (wgi.controller_count > 0) {
             IEventHandler_CRawGameControllerVtbl_InvokeRemoved(&controller_removed.iface, NULL, wgi.controllers[wgi.controller_count - 1].controller);
         }
         if (wgi.controllers) {
             SDL_free(wgi.controllers);
         }
+        while (wgi.removed_while_pending_count > 0) {
+            __x_ABI_CWindows_CGaming_CInput_CIRawGameController_Release(wgi.removed_while_pending[--wgi.removed_while_pending_count]);
+        }
+        SDL_free(wgi.removed_while_pending);
 
         if (wgi.arcade_stick_statics) {
             __x_ABI_CWindows_CGaming_CInput_CIArcadeStickStatics_Release(wgi.arcade_stick_statics);
@@ -1007,8 +1259,6 @@ static void WGI_JoystickQuit(void)
             __x_ABI_CWindows_CGaming_CInput_CIRacingWheelStatics2_Release(wgi.racing_wheel_statics2);
         }
 
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameControllerStatics_remove_RawGameControllerAdded(wgi.controller_statics, wgi.controller_added_token);
-        __x_ABI_CWindows_CGaming_CInput_CIRawGameControllerStatics_remove_RawGameControllerRemoved(wgi.controller_statics, wgi.controller_removed_token);
         __x_ABI_CWindows_CGaming_CInput_CIRawGameControllerStatics_Release(wgi.controller_statics);
     }
 
@@ -23,15 +23,21 @@
 #include "../SDL_main_callbacks.h"
 #include "../../video/SDL_sysvideo.h"
 
+#ifdef SDL_PLATFORM_WINRT
+#include "../../core/winrt/SDL_winrtapp_common.h"
+#endif
+
 #ifndef SDL_PLATFORM_IOS
 
 static Uint64 callback_rate_increment = 0;
 static bool iterate_after_waitevent = false;
+static bool iterate_on_vblank = false;
 
 static void SDLCALL MainCallbackRateHintChanged(void *userdata, const char *name, const char *oldValue, const char *newValue)
 {
     iterate_after_waitevent = newValue && (SDL_strcmp(newValue, "waitevent") == 0);
-    if (iterate_after_waitevent) {
+    iterate_on_vblank = newValue && (SDL_strcmp(newValue, "vblank") == 0);
+    if (iterate_after_waitevent || iterate_on_vblank) {
         callback_rate_increment = 0;
     } else {
         const double callback_rate = newValue ? SDL_atof(newValue) : 0.0;
@@ -43,6 +49,16 @@ static void SDLCALL MainCallbackRateHintChanged(void *userdata, const char *name
     }
 }
 
+// Returns false if there's no vblank source, in which case we run unpaced.
+static bool WaitForVBlank(void)
+{
+#ifdef SDL_PLATFORM_WINRT
+    return WINRT_WaitForVBlank();
+#else
+    return false;
+#endif
+}
+
 static SDL_AppResult GenericIterateMainCallbacks(void)
 {
     if (iterate_after_waitevent) {
@@ -73,7 +89,9 @@ int SDL_EnterAppMainCallbacks(int argc, char *argv[], SDL_AppInit_func appinit,
             //  vsync in common cases, and won't be restrained to vsync if the
             //  app is doing a benchmark or doesn't want to be, based on how
             // they've set up that window.
-            if (callback_rate_increment == 0) {
+            if (iterate_on_vblank && WaitForVBlank()) {
+                next_iteration = 0; // the display is doing the pacing for us.
+            } else if (callback_rate_increment == 0) {
                 next_iteration = 0; // just clear the timer and run at the pace the video subsystem allows.
             } else {
                 const Uint64 now = SDL_GetTicksNS();
@@ -87,6 +105,9 @@ int SDL_EnterAppMainCallbacks(int argc, char *argv[], SDL_AppInit_func appinit,
         }
 
         SDL_RemoveHintCallback(SDL_HINT_MAIN_CALLBACK_RATE, MainCallbackRateHintChanged, NULL);
+#ifdef SDL_PLATFORM_WINRT
+        WINRT_QuitVBlank();
+#endif
     }
     SDL_QuitMainCallbacks(rc);
 
@@ -20,16 +20,112 @@
 #ifndef SDL_POWER_DISABLED
 #if SDL_POWER_WINRT
 
+extern "C" {
+#include "../../events/SDL_events_c.h"
+}
+
+using namespace Windows::Devices::Power;
+using namespace Windows::Foundation;
+
+/* The latest aggregate battery report, updated from ReportUpdated so that
+   SDL_GetPowerInfo() is a single atomic read. Packed as:
+     bits 0-20: seconds + 1
+     bits 21-27: percent + 1
+     bits 28-30: state + 1
+   Zero means no report is available. */
+#define WINRT_POWER_SECONDS_MASK 0x1FFFFF
+#define WINRT_POWER_PERCENT_SHIFT 21
+#define WINRT_POWER_STATE_SHIFT 28
+
+static SDL_InitState WINRT_PowerInit;
+static SDL_AtomicInt WINRT_PowerInfo;
+
+static int WINRT_PackPowerInfo(BatteryReport ^ report)
+{
+    SDL_PowerState state;
+    int seconds = -1;
+    int percent = -1;
+
+    switch (report->Status) {
+    case BatteryStatus::NotPresent:
+        state = SDL_POWERSTATE_NO_BATTERY;
+        break;
+    case BatteryStatus::Discharging:
+        state = SDL_POWERSTATE_ON_BATTERY;
+        break;
+    case BatteryStatus::Idle: // on AC, not charging.
+        state = SDL_POWERSTATE_CHARGED;
+        break;
+    case BatteryStatus::Charging:
+        state = SDL_POWERSTATE_CHARGING;
+        break;
+    default:
+        state = SDL_POWERSTATE_UNKNOWN;
+        break;
+    }
+
+    if (state != SDL_POWERSTATE_NO_BATTERY && state != SDL_POWERSTATE_UNKNOWN) {
+        IReference<int> ^ remaining = report->RemainingCapacityInMilliwattHours;
+        IReference<int> ^ full = report->FullChargeCapacityInMilliwattHours;
+        IReference<int> ^ rate = report->ChargeRateInMilliwatts;
+
+        if (remaining && full && full->Value > 0) {
+            percent = (int)SDL_clamp(((Sint64)remaining->Value * 100) / full->Value, 0, 100);
+        }
+        if (state == SDL_POWERSTATE_ON_BATTERY && remaining && rate && rate->Value < 0) {
+            seconds = (int)SDL_min(((Sint64)remaining->Value * 3600) / -rate->Value, WINRT_POWER_SECONDS_MASK - 1);
+        }
+    }
+
+    return ((state + 1) << WINRT_POWER_STATE_SHIFT) | ((percent + 1) << WINRT_POWER_PERCENT_SHIFT) | (seconds + 1);
+}
+
+static void WINRT_UpdatePowerInfo(BatteryReport ^ report)
+{
+    const int info = WINRT_PackPowerInfo(report);
+    const int previous = SDL_SetAtomicInt(&WINRT_PowerInfo, info);
+
+    // The remaining time estimate changes constantly, only report state and percentage changes
+    if (previous && (previous & ~WINRT_POWER_SECONDS_MASK) != (info & ~WINRT_POWER_SECONDS_MASK)) {
+        SDL_SendPowerStateChangedEvent();
+    }
+}
+
+static void WINRT_InitPowerInfo()
+{
+    if (!SDL_ShouldInit(&WINRT_PowerInit)) {
+        return;
+    }
+
+    try {
+        Battery ^ battery = Battery::AggregateBattery;
+        battery->ReportUpdated += ref new TypedEventHandler<Battery ^, Platform::Object ^>(
+            [](Battery ^ sender, Platform::Object ^ args) {
+                WINRT_UpdatePowerInfo(sender->GetReport());
+            });
+        WINRT_UpdatePowerInfo(battery->GetReport());
+    } catch (Platform::Exception ^) {
+        // Leave the power info unavailable, we'll fall through to the next implementation.
+    }
+
+    // The subscription lives for the rest of the process, so this is never uninitialized.
+    SDL_SetInitialized(&WINRT_PowerInit, true);
+}
+
 extern "C" bool
 SDL_GetPowerInfo_WinRT(SDL_PowerState *state, int *seconds, int *percent)
 {
-    // TODO, WinRT: Battery info is available on at least one WinRT platform (Windows Phone 8).  Implement SDL_GetPowerInfo_WinRT as appropriate.
-    /* Notes:
-         - the Win32 function, GetSystemPowerStatus, is not available for use on WinRT
-         - Windows Phone 8 has a 'Battery' class, which is documented as available for C++
-             - More info on WP8's Battery class can be found at http://msdn.microsoft.com/library/windowsphone/develop/jj207231
-    */
-    return false;
+    WINRT_InitPowerInfo();
+
+    const int info = SDL_GetAtomicInt(&WINRT_PowerInfo);
+    if (!info) {
+        return false;
+    }
+
+    *state = (SDL_PowerState)((info >> WINRT_POWER_STATE_SHIFT) - 1);
+    *percent = ((info >> WINRT_POWER_PERCENT_SHIFT) & 0x7F) - 1;
+    *seconds = (info & WINRT_POWER_SECONDS_MASK) - 1;
+    return true;
 }
 
 #endif // SDL_POWER_WINRT
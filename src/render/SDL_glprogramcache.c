@@ -0,0 +1,325 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#if defined(SDL_VIDEO_RENDER_OGL) || defined(SDL_VIDEO_RENDER_OGL_ES2)
+
+#include "SDL_glprogramcache.h"
+
+/* Linking shader programs can take tens of milliseconds on some drivers, so
+ * the renderers save the linked binaries to their program cache storage when
+ * they're destroyed and load them instead of compiling the next time. The
+ * file is only used by the same build of SDL with the same GL driver.
+ */
+#define GL_PROGRAM_CACHE_MAGIC   0x504C4753 // "SGLP"
+#define GL_PROGRAM_CACHE_VERSION 1
+
+typedef struct GL_ProgramCacheFileHeader
+{
+    Uint32 magic;
+    Uint32 version;
+    Uint32 driver_hash;
+    Uint32 num_entries;
+} GL_ProgramCacheFileHeader;
+
+// Each entry is followed by its binary
+typedef struct GL_ProgramCacheFileEntry
+{
+    Uint32 key_low;
+    Uint32 key_high;
+    Uint32 format;
+    Uint32 length;
+} GL_ProgramCacheFileEntry;
+
+typedef struct GL_ProgramBinary
+{
+    Uint64 key;
+    Uint32 format;
+    int length;
+    void *binary;
+} GL_ProgramBinary;
+
+struct SDL_GLProgramCache
+{
+    SDL_Storage *storage;
+    char *filename;
+    Uint32 driver_hash;
+    GL_ProgramBinary *programs;
+    int num_programs;
+    int max_programs;
+    bool dirty;
+};
+
+static Uint32 HashProgramCacheString(const char *string, Uint32 seed)
+{
+    if (!string) {
+        string = "";
+    }
+    return SDL_murmur3_32(string, SDL_strlen(string) + 1, seed);
+}
+
+Uint64 SDL_HashGLProgramSources(const char *const *sources, int num_sources)
+{
+    Uint32 low = 0, high = 0x9E3779B9;
+    int i;
+
+    for (i = 0; i < num_sources; ++i) {
+        low = HashProgramCacheString(sources[i], low);
+        high = HashProgramCacheString(sources[i], high);
+    }
+    return ((Uint64)high << 32) | low;
+}
+
+static GL_ProgramBinary *FindProgramBinary(SDL_GLProgramCache *cache, Uint64 key)
+{
+    int i;
+
+    for (i = 0; i < cache->num_programs; ++i) {
+        if (cache->programs[i].key == key) {
+            return &cache->programs[i];
+        }
+    }
+    return NULL;
+}
+
+static bool InsertProgramBinary(SDL_GLProgramCache *cache, Uint64 key, Uint32 format, const void *binary, int length)
+{
+    GL_ProgramBinary *program;
+
+    if (cache->num_programs == cache->max_programs) {
+        int max_programs = cache->max_programs ? cache->max_programs * 2 : 16;
+        GL_ProgramBinary *programs = (GL_ProgramBinary *)SDL_realloc(cache->programs, max_programs * sizeof(*programs));
+        if (!programs) {
+            return false;
+        }
+        cache->programs = programs;
+        cache->max_programs = max_programs;
+    }
+
+    program = &cache->programs[cache->num_programs];
+    program->binary = SDL_malloc(length);
+    if (!program->binary) {
+        return false;
+    }
+    SDL_memcpy(program->binary, binary, length);
+    program->key = key;
+    program->format = format;
+    program->length = length;
+    ++cache->num_programs;
+    return true;
+}
+
+static void LoadProgramCache(SDL_GLProgramCache *cache)
+{
+    GL_ProgramCacheFileHeader header;
+    Uint64 length = 0;
+    Uint8 *data;
+    size_t offset;
+    Uint32 i;
+
+    if (!SDL_StorageReady(cache->storage) ||
+        !SDL_GetStorageFileSize(cache->storage, cache->filename, &length) ||
+        length < sizeof(header) || length > SDL_MAX_SINT32) {
+        return;
+    }
+
+    data = (Uint8 *)SDL_malloc((size_t)length);
+    if (!data) {
+        return;
+    }
+    if (!SDL_ReadStorageFile(cache->storage, cache->filename, data, length)) {
+        SDL_free(data);
+        return;
+    }
+
+    SDL_memcpy(&header, data, sizeof(header));
+    header.magic = SDL_Swap32LE(header.magic);
+    header.version = SDL_Swap32LE(header.version);
+    header.driver_hash = SDL_Swap32LE(header.driver_hash);
+    header.num_entries = SDL_Swap32LE(header.num_entries);
+    if (header.magic != GL_PROGRAM_CACHE_MAGIC ||
+        header.version != GL_PROGRAM_CACHE_VERSION ||
+        header.driver_hash != cache->driver_hash) {
+        // Written by another version of SDL, or for another driver, it'll be replaced on exit.
+        SDL_free(data);
+        cache->dirty = true;
+        return;
+    }
+
+    offset = sizeof(header);
+    for (i = 0; i < header.num_entries; ++i) {
+        GL_ProgramCacheFileEntry entry;
+
+        if (length - offset < sizeof(entry)) {
+            break;
+        }
+        SDL_memcpy(&entry, data + offset, sizeof(entry));
+        offset += sizeof(entry);
+
+        entry.length = SDL_Swap32LE(entry.length);
+        if (entry.length == 0 || entry.length > length - offset) {
+            break;
+        }
+        if (!InsertProgramBinary(cache,
+                                 ((Uint64)SDL_Swap32LE(entry.key_high) << 32) | SDL_Swap32LE(entry.key_low),
+                                 SDL_Swap32LE(entry.format), data + offset, (int)entry.length)) {
+            break;
+        }
+        offset += entry.length;
+    }
+    SDL_free(data);
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Loaded %d GL program binaries from the program cache", cache->num_programs);
+}
+
+static void SaveProgramCache(SDL_GLProgramCache *cache)
+{
+    GL_ProgramCacheFileHeader header;
+    size_t length = sizeof(header);
+    size_t offset;
+    Uint8 *data;
+    int i;
+
+    if (!SDL_StorageReady(cache->storage)) {
+        return;
+    }
+
+    for (i = 0; i < cache->num_programs; ++i) {
+        length += sizeof(GL_ProgramCacheFileEntry) + cache->programs[i].length;
+    }
+    data = (Uint8 *)SDL_malloc(length);
+    if (!data) {
+        return;
+    }
+
+    header.magic = SDL_Swap32LE(GL_PROGRAM_CACHE_MAGIC);
+    header.version = SDL_Swap32LE(GL_PROGRAM_CACHE_VERSION);
+    header.driver_hash = SDL_Swap32LE(cache->driver_hash);
+    header.num_entries = SDL_Swap32LE((Uint32)cache->num_programs);
+    SDL_memcpy(data, &header, sizeof(header));
+
+    offset = sizeof(header);
+    for (i = 0; i < cache->num_programs; ++i) {
+        const GL_ProgramBinary *program = &cache->programs[i];
+        GL_ProgramCacheFileEntry entry;
+
+        entry.key_low = SDL_Swap32LE((Uint32)program->key);
+        entry.key_high = SDL_Swap32LE((Uint32)(program->key >> 32));
+        entry.format = SDL_Swap32LE(program->format);
+        entry.length = SDL_Swap32LE((Uint32)program->length);
+        SDL_memcpy(data + offset, &entry, sizeof(entry));
+        offset += sizeof(entry);
+        SDL_memcpy(data + offset, program->binary, program->length);
+        offset += program->length;
+    }
+
+    if (!SDL_WriteStorageFile(cache->storage, cache->filename, data, length)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "Couldn't save GL program cache: %s", SDL_GetError());
+    }
+    SDL_free(data);
+}
+
+SDL_GLProgramCache *SDL_CreateGLProgramCache(SDL_Storage *storage, const char *filename, const char *vendor, const char *renderer, const char *version)
+{
+    SDL_GLProgramCache *cache = (SDL_GLProgramCache *)SDL_calloc(1, sizeof(*cache));
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->storage = storage;
+    cache->filename = SDL_strdup(filename);
+    if (!cache->filename) {
+        SDL_free(cache);
+        return NULL;
+    }
+
+    cache->driver_hash = HashProgramCacheString(SDL_GetRevision(), 0);
+    cache->driver_hash = HashProgramCacheString(vendor, cache->driver_hash);
+    cache->driver_hash = HashProgramCacheString(renderer, cache->driver_hash);
+    cache->driver_hash = HashProgramCacheString(version, cache->driver_hash);
+
+    LoadProgramCache(cache);
+
+    return cache;
+}
+
+bool SDL_HasGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key)
+{
+    return FindProgramBinary(cache, key) != NULL;
+}
+
+bool SDL_FindGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key, Uint32 *format, const void **binary, int *length)
+{
+    const GL_ProgramBinary *program = FindProgramBinary(cache, key);
+    if (!program) {
+        return false;
+    }
+
+    *format = program->format;
+    *binary = program->binary;
+    *length = program->length;
+    return true;
+}
+
+void SDL_AddGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key, Uint32 format, const void *binary, int length)
+{
+    if (length <= 0 || FindProgramBinary(cache, key)) {
+        return;
+    }
+
+    if (InsertProgramBinary(cache, key, format, binary, length)) {
+        cache->dirty = true;
+    }
+}
+
+void SDL_RemoveGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key)
+{
+    GL_ProgramBinary *program = FindProgramBinary(cache, key);
+    if (!program) {
+        return;
+    }
+
+    SDL_free(program->binary);
+    *program = cache->programs[--cache->num_programs];
+    cache->dirty = true;
+}
+
+void SDL_DestroyGLProgramCache(SDL_GLProgramCache *cache)
+{
+    int i;
+
+    if (!cache) {
+        return;
+    }
+
+    if (cache->dirty) {
+        SaveProgramCache(cache);
+    }
+
+    for (i = 0; i < cache->num_programs; ++i) {
+        SDL_free(cache->programs[i].binary);
+    }
+    SDL_free(cache->programs);
+    SDL_free(cache->filename);
+    SDL_free(cache);
+}
+
+#endif // SDL_VIDEO_RENDER_OGL || SDL_VIDEO_RENDER_OGL_ES2
@@ -0,0 +1,39 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_glprogramcache_h_
+#define SDL_glprogramcache_h_
+
+#include "SDL_internal.h"
+
+// Linked program binaries saved for the OpenGL and OpenGL ES 2 renderers
+
+typedef struct SDL_GLProgramCache SDL_GLProgramCache;
+
+extern SDL_GLProgramCache *SDL_CreateGLProgramCache(SDL_Storage *storage, const char *filename, const char *vendor, const char *renderer, const char *version);
+extern Uint64 SDL_HashGLProgramSources(const char *const *sources, int num_sources);
+extern bool SDL_HasGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key);
+extern bool SDL_FindGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key, Uint32 *format, const void **binary, int *length);
+extern void SDL_AddGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key, Uint32 format, const void *binary, int length);
+extern void SDL_RemoveGLProgramBinary(SDL_GLProgramCache *cache, Uint64 key);
+extern void SDL_DestroyGLProgramCache(SDL_GLProgramCache *cache);
+
+#endif // SDL_glprogramcache_h_
@@ -301,39 +301,385 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
                     cmd->data.draw.color.b, cmd->data.draw.color.a,
                     (int)cmd->data.draw.blend, cmd->data.draw.color_scale, cmd->data.draw.texture);
             break;
+
+        case SDL_RENDERCMD_TEXTURE_BATCH:
+            SDL_Log(" %u. texture batch (first=%u, count=%u, r=%.2f, g=%.2f, b=%.2f, a=%.2f, blend=%d, color_scale=%g, tex=%p)", i++,
+                    (unsigned int)cmd->data.draw.first,
+                    (unsigned int)cmd->data.draw.count,
+                    cmd->data.draw.color.r, cmd->data.draw.color.g,
+                    cmd->data.draw.color.b, cmd->data.draw.color.a,
+                    (int)cmd->data.draw.blend, cmd->data.draw.color_scale, cmd->data.draw.texture);
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH:
+            SDL_Log(" %u. line batch (first=%u, count=%u, r=%.2f, g=%.2f, b=%.2f, a=%.2f, blend=%d, color_scale=%g)", i++,
+                    (unsigned int)cmd->data.draw.first,
+                    (unsigned int)cmd->data.draw.count,
+                    cmd->data.draw.color.r, cmd->data.draw.color.g,
+                    cmd->data.draw.color.b, cmd->data.draw.color.a,
+                    (int)cmd->data.draw.blend, cmd->data.draw.color_scale);
+            break;
         }
         cmd = cmd->next;
     }
 #endif
 }
 
+// How far back a draw may be moved to join an earlier draw with the same state
+#define SDL_REORDER_DRAWS_WINDOW 64
+
+static bool SameDrawState(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    if (a->data.draw.texture != b->data.draw.texture ||
+        a->data.draw.blend != b->data.draw.blend ||
+        a->data.draw.color_scale != b->data.draw.color_scale ||
+        a->data.draw.texture_address_mode_u != b->data.draw.texture_address_mode_u ||
+        a->data.draw.texture_address_mode_v != b->data.draw.texture_address_mode_v ||
+        a->data.draw.gpu_render_state != b->data.draw.gpu_render_state ||
+        SDL_memcmp(&a->data.draw.color, &b->data.draw.color, sizeof(a->data.draw.color)) != 0) {
+        return false;
+    }
+    if (a->data.draw.texture && a->data.draw.texture_scale_mode != b->data.draw.texture_scale_mode) {
+        return false;
+    }
+    return true;
+}
+
+static bool DrawBoundsOverlap(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    // Touching edges count as overlapping, rasterization may share those pixels
+    const SDL_FRect *ra = &a->data.draw.bounds;
+    const SDL_FRect *rb = &b->data.draw.bounds;
+    return (ra->x <= rb->x + rb->w && rb->x <= ra->x + ra->w &&
+            ra->y <= rb->y + rb->h && rb->y <= ra->y + ra->h);
+}
+
+static void ReorderDrawRun(SDL_Renderer *renderer, SDL_RenderCommand **cmds, SDL_RenderCommand **order, int count)
+{
+    Uint8 *vertices = (Uint8 *)renderer->vertex_data;
+    const size_t start = cmds[0]->data.draw.first;
+    size_t size = 0;
+    void *scratch;
+    bool moved = false;
+    int num_ordered = 0;
+    int i, j;
+
+    /* Move each draw up behind the most recent earlier draw with the same state,
+     * as long as it doesn't overlap any of the draws it would move past. */
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCommand *cmd = cmds[i];
+        const int limit = SDL_max(0, num_ordered - SDL_REORDER_DRAWS_WINDOW);
+        int insert_at = num_ordered;
+
+        size += cmd->data.draw.vertex_size;
+
+        for (j = num_ordered - 1; j >= limit; --j) {
+            if (SameDrawState(order[j], cmd)) {
+                insert_at = j + 1;
+                break;
+            }
+            if (DrawBoundsOverlap(order[j], cmd)) {
+                break;
+            }
+        }
+        if (insert_at < num_ordered) {
+            SDL_memmove(&order[insert_at + 1], &order[insert_at], (num_ordered - insert_at) * sizeof(*order));
+            moved = true;
+        }
+        order[insert_at] = cmd;
+        ++num_ordered;
+    }
+
+    if (!moved) {
+        return;
+    }
+
+    // Lay the vertex data out in the new order so merged draws stay contiguous
+    scratch = SDL_AllocateArenaMemory(renderer->render_commands_arena, size, 0);
+    if (!scratch) {
+        return;
+    }
+    SDL_memcpy(scratch, vertices + start, size);
+
+    size = 0;
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCommand *cmd = order[i];
+        const size_t offset = cmd->data.draw.first - start;
+        SDL_memcpy(vertices + start + size, (const Uint8 *)scratch + offset, cmd->data.draw.vertex_size);
+        cmd->data.draw.first = start + size;
+        size += cmd->data.draw.vertex_size;
+    }
+
+    // Relink the run in its new order
+    for (i = 0; i < count; ++i) {
+        cmds[i] = order[i];
+    }
+}
+
+static void ReorderRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *prev = NULL;
+    SDL_RenderCommand *cmd = renderer->render_commands;
+
+    while (cmd) {
+        SDL_RenderCommand *after = cmd;
+        SDL_RenderCommand **cmds;
+        SDL_ArenaMark mark;
+        int count = 0;
+        int i;
+
+        /* Find a run of geometry draws whose vertex data is contiguous. The
+         * last draw of a chain is left out, since without a following draw we
+         * can't tell whether its size is padded to the backend's alignment. */
+        while (after->command == SDL_RENDERCMD_GEOMETRY && after->next &&
+               after->next->command == SDL_RENDERCMD_GEOMETRY &&
+               after->next->data.draw.first == after->data.draw.first + after->data.draw.vertex_size) {
+            after = after->next;
+            ++count;
+        }
+
+        if (count < 3) {
+            if (count == 0) {
+                after = cmd->next;
+            }
+            prev = cmd;
+            while (prev->next != after) {
+                prev = prev->next;
+            }
+            cmd = after;
+            continue;
+        }
+
+        // The scratch space for this run is released as soon as it's done
+        mark = SDL_GetArenaMark(renderer->render_commands_arena);
+        cmds = (SDL_RenderCommand **)SDL_AllocateArenaMemory(renderer->render_commands_arena, count * 2 * sizeof(*cmds), 0);
+        if (!cmds) {
+            return;
+        }
+
+        for (i = 0; i < count; ++i) {
+            cmds[i] = cmd;
+            cmd = cmd->next;
+        }
+        SDL_assert(cmd == after);
+
+        ReorderDrawRun(renderer, cmds, cmds + count, count);
+
+        if (prev) {
+            prev->next = cmds[0];
+        } else {
+            renderer->render_commands = cmds[0];
+        }
+        for (i = 0; i < count - 1; ++i) {
+            cmds[i]->next = cmds[i + 1];
+        }
+        cmds[count - 1]->next = after;
+        prev = cmds[count - 1];
+        cmd = after;
+
+        SDL_ResetArenaToMark(renderer->render_commands_arena, mark);
+    }
+}
+
+static void ApplyPendingTextureUpdates(SDL_Renderer *renderer)
+{
+    SDL_PendingTextureUpdate *update, *next;
+
+    if (renderer->applying_texture_updates) {
+        return;
+    }
+
+    SDL_LockMutex(renderer->texture_updates_lock);
+    update = renderer->texture_updates;
+    renderer->texture_updates = NULL;
+    renderer->texture_updates_tail = NULL;
+    SDL_UnlockMutex(renderer->texture_updates_lock);
+
+    renderer->applying_texture_updates = true;
+    for (; update; update = next) {
+        const bool result = SDL_UpdateTexture(update->texture, update->full_texture ? NULL : &update->rect, update->pixels, update->pitch);
+        next = update->next;
+        if (update->callback) {
+            update->callback(update->userdata, update->texture, update->pixels, result);
+        }
+        SDL_free(update);
+    }
+    renderer->applying_texture_updates = false;
+}
+
+static void CancelPendingTextureUpdates(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    SDL_PendingTextureUpdate *update, *prev = NULL, *next;
+    SDL_PendingTextureUpdate *cancelled = NULL, *cancelled_tail = NULL;
+
+    SDL_LockMutex(renderer->texture_updates_lock);
+    for (update = renderer->texture_updates; update; update = next) {
+        next = update->next;
+        if (update->texture != texture) {
+            prev = update;
+            continue;
+        }
+        if (prev) {
+            prev->next = next;
+        } else {
+            renderer->texture_updates = next;
+        }
+        if (renderer->texture_updates_tail == update) {
+            renderer->texture_updates_tail = prev;
+        }
+        update->next = NULL;
+        if (cancelled_tail) {
+            cancelled_tail->next = update;
+        } else {
+            cancelled = update;
+        }
+        cancelled_tail = update;
+    }
+    SDL_UnlockMutex(renderer->texture_updates_lock);
+
+    for (update = cancelled; update; update = next) {
+        next = update->next;
+        if (update->callback) {
+            update->callback(update->userdata, texture, update->pixels, false);
+        }
+        SDL_free(update);
+    }
+}
+
+// Recorded vertex data is copied at this alignment, so offsets the backends aligned stay aligned
+#define SDL_RENDER_LIST_VERTEX_ALIGNMENT 256
+
+static void ResetRenderCommands(SDL_Renderer *renderer)
+{
+    // Release the whole render command queue at once, the arena keeps the memory for next time.
+    renderer->render_commands_tail = NULL;
+    renderer->render_commands = NULL;
+    SDL_ResetArena(renderer->render_commands_arena);
+    renderer->vertex_data_used = 0;
+    renderer->render_command_generation++;
+    renderer->color_queued = false;
+    renderer->viewport_queued = false;
+    renderer->cliprect_queued = false;
+}
+
+// Move the vertex data a command refers to, and the viewport it draws in
+static void RebaseRenderCommand(SDL_RenderCommand *cmd, size_t offset, int dx, int dy)
+{
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETVIEWPORT:
+        cmd->data.viewport.first += offset;
+        cmd->data.viewport.rect.x += dx;
+        cmd->data.viewport.rect.y += dy;
+        break;
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+    case SDL_RENDERCMD_CLEAR:
+        cmd->data.color.first += offset;
+        break;
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    case SDL_RENDERCMD_FILL_RECTS:
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_COPY_EX:
+    case SDL_RENDERCMD_GEOMETRY:
+    case SDL_RENDERCMD_TEXTURE_BATCH:
+    case SDL_RENDERCMD_LINE_BATCH:
+        cmd->data.draw.first += offset;
+        break;
+    default:
+        break;
+    }
+}
+
+// Append the queued commands to the render list being recorded instead of running them
+static bool CaptureRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderList *list = renderer->recording_list;
+    SDL_RenderCommand *cmd;
+    size_t offset = 0;
+    bool result = true;
+
+    if (renderer->vertex_data_used > 0) {
+        offset = (list->vertex_size + (SDL_RENDER_LIST_VERTEX_ALIGNMENT - 1)) & ~(size_t)(SDL_RENDER_LIST_VERTEX_ALIGNMENT - 1);
+        if (list->vertex_allocation < offset + renderer->vertex_data_used) {
+            size_t allocation = SDL_max(list->vertex_allocation * 2, offset + renderer->vertex_data_used);
+            Uint8 *vertices = (Uint8 *)SDL_realloc(list->vertices, allocation);
+            if (!vertices) {
+                result = false;
+                goto done;
+            }
+            list->vertices = vertices;
+            list->vertex_allocation = allocation;
+        }
+        SDL_memcpy(list->vertices + offset, renderer->vertex_data, renderer->vertex_data_used);
+        list->vertex_size = offset + renderer->vertex_data_used;
+    }
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        if (cmd->command == SDL_RENDERCMD_NO_OP) {
+            continue;
+        }
+        if (list->num_commands == list->max_commands) {
+            int max_commands = list->max_commands ? list->max_commands * 2 : 64;
+            SDL_RenderCommand *commands = (SDL_RenderCommand *)SDL_realloc(list->commands, max_commands * sizeof(*commands));
+            if (!commands) {
+                result = false;
+                goto done;
+            }
+            list->commands = commands;
+            list->max_commands = max_commands;
+        }
+        SDL_copyp(&list->commands[list->num_commands], cmd);
+        list->commands[list->num_commands].next = NULL;
+        RebaseRenderCommand(&list->commands[list->num_commands], offset, 0, 0);
+        ++list->num_commands;
+    }
+
+done:
+    ResetRenderCommands(renderer);
+    ApplyPendingTextureUpdates(renderer);
+    return result;
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
+    Uint64 start = 0;
     bool result;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
 
+    if (renderer->recording_list) {
+        return CaptureRenderCommands(renderer);
+    }
+
     if (!renderer->render_commands) { // nothing to do!
         SDL_assert(renderer->vertex_data_used == 0);
+        ApplyPendingTextureUpdates(renderer);
         return true;
     }
 
+    if (renderer->reorder_draws) {
+        ReorderRenderCommands(renderer);
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
 
+    if (renderer->gpu_timing) {
+        start = SDL_GetTicksNS();
+    }
+
+    SDL_TRACE_ZONE_BEGIN(zone, "RunCommandQueue");
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_ZONE_END(zone);
 
-    // Move the whole render command queue to the unused pool so we can reuse them next time.
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        renderer->render_commands_pool = renderer->render_commands;
-        renderer->render_commands_tail = NULL;
-        renderer->render_commands = NULL;
+    if (renderer->gpu_timing) {
+        renderer->stats.cpu_time_ns += SDL_GetTicksNS() - start;
     }
-    renderer->vertex_data_used = 0;
-    renderer->render_command_generation++;
-    renderer->color_queued = false;
-    renderer->viewport_queued = false;
-    renderer->cliprect_queued = false;
+
+    ResetRenderCommands(renderer);
+
+    // Scheduled texture updates go after the drawing that was queued before them
+    ApplyPendingTextureUpdates(renderer);
     return result;
 }
 
@@ -387,6 +733,10 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
         if (!ptr) {
             return NULL;
         }
+        if (renderer->vertex_data) {
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_RENDER, renderer->vertex_data_allocation);
+        }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_RENDER, newsize);
         renderer->vertex_data = ptr;
         renderer->vertex_data_allocation = newsize;
     }
@@ -396,24 +746,41 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     }
 
     renderer->vertex_data_used += aligner + numbytes;
+    renderer->stats.vertex_bytes += numbytes;
 
     return ((Uint8 *)renderer->vertex_data) + aligned;
 }
 
+bool SDL_CountRenderStateChange(SDL_Renderer *renderer, bool changed)
+{
+    if (changed) {
+        ++renderer->stats.state_changes;
+    } else {
+        ++renderer->stats.state_changes_skipped;
+    }
+    return changed;
+}
+
+// Enough for a couple hundred commands, most frames never need a second chunk
+#define SDL_RENDER_COMMANDS_ARENA_CHUNK_SIZE (32 * 1024)
+
 static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 {
     SDL_RenderCommand *result = NULL;
 
-    result = renderer->render_commands_pool;
-    if (result) {
-        renderer->render_commands_pool = result->next;
-        result->next = NULL;
-    } else {
-        result = (SDL_RenderCommand *)SDL_calloc(1, sizeof(*result));
-        if (!result) {
+    if (!renderer->render_commands_arena) {
+        renderer->render_commands_arena = SDL_CreateArena(SDL_RENDER_COMMANDS_ARENA_CHUNK_SIZE, false);
+        if (!renderer->render_commands_arena) {
             return NULL;
         }
+        SDL_SetArenaMemoryTag(renderer->render_commands_arena, SDL_MEMORY_TAG_RENDER);
+    }
+
+    result = (SDL_RenderCommand *)SDL_AllocateArenaMemory(renderer->render_commands_arena, sizeof(*result), 0);
+    if (!result) {
+        return NULL;
     }
+    result->next = NULL;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
     if (renderer->render_commands_tail) {
@@ -422,6 +789,7 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    ++renderer->stats.commands;
 
     return result;
 }
@@ -546,6 +914,31 @@ static bool QueueCmdClear(SDL_Renderer *renderer)
     return true;
 }
 
+static bool RestoreEvictedTexture(SDL_Texture *texture);
+
+static bool AddRenderListTexture(SDL_RenderList *list, SDL_Texture *texture)
+{
+    int i;
+
+    for (i = list->num_textures - 1; i >= 0; --i) {
+        if (list->textures[i] == texture) {
+            return true;
+        }
+    }
+
+    if (list->num_textures == list->max_textures) {
+        int max_textures = list->max_textures ? list->max_textures * 2 : 8;
+        SDL_Texture **textures = (SDL_Texture **)SDL_realloc(list->textures, max_textures * sizeof(*textures));
+        if (!textures) {
+            return false;
+        }
+        list->textures = textures;
+        list->max_textures = max_textures;
+    }
+    list->textures[list->num_textures++] = texture;
+    return true;
+}
+
 static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtype, SDL_Texture *texture)
 {
     SDL_RenderCommand *cmd = NULL;
@@ -553,6 +946,13 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
     SDL_FColor *color;
     SDL_BlendMode blendMode;
 
+    if (texture && texture->evicted && !RestoreEvictedTexture(texture)) {
+        return NULL;
+    }
+    if (texture && renderer->recording_list && !AddRenderListTexture(renderer->recording_list, texture)) {
+        return NULL;
+    }
+
     if (texture) {
         color = &texture->color;
         blendMode = texture->blendMode;
@@ -561,7 +961,7 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
         blendMode = renderer->blendMode;
     }
 
-    if (cmdtype != SDL_RENDERCMD_GEOMETRY) {
+    if (cmdtype != SDL_RENDERCMD_GEOMETRY && cmdtype != SDL_RENDERCMD_TEXTURE_BATCH) {
         result = QueueCmdSetDrawColor(renderer, color);
     }
 
@@ -586,6 +986,11 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.texture = texture;
             if (texture) {
                 cmd->data.draw.texture_scale_mode = texture->scaleMode;
+                if (texture->atlas_page) {
+                    // The backend draws from the page, with the state of the texture packed into it
+                    cmd->data.draw.texture = texture->atlas_page->texture;
+                    cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+                }
             }
             cmd->data.draw.texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
@@ -725,6 +1130,31 @@ static bool QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
     return result;
 }
 
+static void GetGeometryBounds(const float *xy, int xy_stride, int num_vertices, float scale_x, float scale_y, SDL_FRect *bounds)
+{
+    float minx = 0.0f, miny = 0.0f, maxx = 0.0f, maxy = 0.0f;
+    int i;
+
+    for (i = 0; i < num_vertices; ++i) {
+        const float *pt = (const float *)((const Uint8 *)xy + i * xy_stride);
+        const float x = pt[0] * scale_x;
+        const float y = pt[1] * scale_y;
+        if (i == 0) {
+            minx = maxx = x;
+            miny = maxy = y;
+        } else {
+            minx = SDL_min(minx, x);
+            maxx = SDL_max(maxx, x);
+            miny = SDL_min(miny, y);
+            maxy = SDL_max(maxy, y);
+        }
+    }
+    bounds->x = minx;
+    bounds->y = miny;
+    bounds->w = maxx - minx;
+    bounds->h = maxy - miny;
+}
+
 static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                              const float *xy, int xy_stride,
                              const SDL_FColor *color, int color_stride,
@@ -736,15 +1166,107 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
 {
     SDL_RenderCommand *cmd;
     bool result = false;
+    float *atlas_uv = NULL;
+    bool isstack = false;
+
+    if (texture && texture->atlas_page) {
+        // Move the texture coordinates into the atlas page, clamped to the packed texture
+        const SDL_Texture *page = texture->atlas_page->texture;
+        const float offset_u = (float)texture->atlas_rect.x / page->w;
+        const float offset_v = (float)texture->atlas_rect.y / page->h;
+        const float scale_u = (float)texture->atlas_rect.w / page->w;
+        const float scale_v = (float)texture->atlas_rect.h / page->h;
+        int i;
+
+        atlas_uv = SDL_small_alloc(float, num_vertices * 2, &isstack);
+        if (!atlas_uv) {
+            return false;
+        }
+        for (i = 0; i < num_vertices; ++i) {
+            const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
+            atlas_uv[i * 2 + 0] = offset_u + SDL_clamp(uv_[0], 0.0f, 1.0f) * scale_u;
+            atlas_uv[i * 2 + 1] = offset_v + SDL_clamp(uv_[1], 0.0f, 1.0f) * scale_v;
+        }
+        uv = atlas_uv;
+        uv_stride = 2 * sizeof(float);
+        texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
+        texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
+    }
+
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
         cmd->data.draw.texture_address_mode_u = texture_address_mode_u;
         cmd->data.draw.texture_address_mode_v = texture_address_mode_v;
-        result = renderer->QueueGeometry(renderer, cmd, texture,
+        result = renderer->QueueGeometry(renderer, cmd, cmd->data.draw.texture,
                                          xy, xy_stride,
                                          color, color_stride, uv, uv_stride,
                                          num_vertices, indices, num_indices, size_indices,
                                          scale_x, scale_y);
+        if (!result) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws) {
+            cmd->data.draw.vertex_size = renderer->vertex_data_used - cmd->data.draw.first;
+            GetGeometryBounds(xy, xy_stride, num_vertices, scale_x, scale_y, &cmd->data.draw.bounds);
+        }
+    }
+    if (atlas_uv) {
+        SDL_small_free(atlas_uv, isstack);
+    }
+    return result;
+}
+
+static bool QueueCmdTextureBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                                 const SDL_TextureBatchInstance *instances, int count,
+                                 float scale_x, float scale_y)
+{
+    SDL_RenderCommand *cmd;
+    SDL_TextureBatchInstance *atlas_instances = NULL;
+    bool result = false;
+    bool isstack = false;
+
+    if (texture->atlas_page) {
+        // Move the texture coordinates into the atlas page
+        const SDL_Texture *page = texture->atlas_page->texture;
+        const float offset_u = (float)texture->atlas_rect.x / page->w;
+        const float offset_v = (float)texture->atlas_rect.y / page->h;
+        const float scale_u = (float)texture->atlas_rect.w / page->w;
+        const float scale_v = (float)texture->atlas_rect.h / page->h;
+        int i;
+
+        atlas_instances = SDL_small_alloc(SDL_TextureBatchInstance, count, &isstack);
+        if (!atlas_instances) {
+            return false;
+        }
+        for (i = 0; i < count; ++i) {
+            atlas_instances[i] = instances[i];
+            atlas_instances[i].minu = offset_u + instances[i].minu * scale_u;
+            atlas_instances[i].minv = offset_v + instances[i].minv * scale_v;
+            atlas_instances[i].maxu = offset_u + instances[i].maxu * scale_u;
+            atlas_instances[i].maxv = offset_v + instances[i].maxv * scale_v;
+        }
+        instances = atlas_instances;
+    }
+
+    cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_TEXTURE_BATCH, texture);
+    if (cmd) {
+        result = renderer->QueueTextureBatch(renderer, cmd, cmd->data.draw.texture, instances, count, scale_x, scale_y);
+        if (!result) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        }
+    }
+    if (atlas_instances) {
+        SDL_small_free(atlas_instances, isstack);
+    }
+    return result;
+}
+
+static bool QueueCmdLineBatch(SDL_Renderer *renderer, const SDL_LineBatchInstance *instances, int count,
+                              float scale_x, float scale_y)
+{
+    SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_LINE_BATCH, NULL);
+    bool result = false;
+    if (cmd) {
+        result = renderer->QueueLineBatch(renderer, cmd, instances, count, scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
@@ -752,6 +1274,22 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
     return result;
 }
 
+static bool IsDrawingDynamicResolutionScene(SDL_Renderer *renderer)
+{
+    return renderer->dynamic_target && !renderer->dynamic_upscaled;
+}
+
+// The output size, scaled down while drawing a dynamic resolution scene
+static void GetMainViewOutputSize(SDL_Renderer *renderer, int *w, int *h)
+{
+    SDL_GetRenderOutputSize(renderer, w, h);
+
+    if (IsDrawingDynamicResolutionScene(renderer)) {
+        *w = SDL_clamp((int)SDL_ceilf(*w * renderer->dynamic_scale), 1, renderer->dynamic_target->w);
+        *h = SDL_clamp((int)SDL_ceilf(*h * renderer->dynamic_scale), 1, renderer->dynamic_target->h);
+    }
+}
+
 static void UpdateMainViewDimensions(SDL_Renderer *renderer)
 {
     int window_w = 0, window_h = 0;
@@ -760,7 +1298,7 @@ static void UpdateMainViewDimensions(SDL_Renderer *renderer)
         SDL_GetWindowSize(renderer->window, &window_w, &window_h);
     }
 
-    SDL_GetRenderOutputSize(renderer, &renderer->main_view.pixel_w, &renderer->main_view.pixel_h);
+    GetMainViewOutputSize(renderer, &renderer->main_view.pixel_w, &renderer->main_view.pixel_h);
 
     if (window_w > 0 && window_h > 0) {
         renderer->dpi_scale.x = (float)renderer->main_view.pixel_w / window_w;
@@ -870,6 +1408,10 @@ static bool SDL_RendererEventWatch(void *userdata, SDL_Event *event)
         }
     } else if (event->type == SDL_EVENT_WINDOW_MINIMIZED) {
         renderer->hidden = true;
+    } else if (event->type == SDL_EVENT_WINDOW_OCCLUDED) {
+        renderer->occluded = true;
+    } else if (event->type == SDL_EVENT_WINDOW_EXPOSED) {
+        renderer->occluded = false;
     } else if (event->type == SDL_EVENT_WINDOW_RESTORED ||
                event->type == SDL_EVENT_WINDOW_MAXIMIZED) {
         if (!(SDL_GetWindowFlags(window) & SDL_WINDOW_HIDDEN)) {
@@ -1075,6 +1617,7 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
 
     renderer->window = window;
     renderer->target_mutex = SDL_CreateMutex();
+    renderer->texture_updates_lock = SDL_CreateMutex();
     if (surface) {
         renderer->main_view.pixel_w = surface->w;
         renderer->main_view.pixel_h = surface->h;
@@ -1119,6 +1662,9 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         if (SDL_GetWindowFlags(window) & (SDL_WINDOW_HIDDEN | SDL_WINDOW_MINIMIZED)) {
             renderer->hidden = true;
         }
+        if (SDL_GetWindowFlags(window) & SDL_WINDOW_OCCLUDED) {
+            renderer->occluded = true;
+        }
     }
 
     new_props = SDL_GetRendererProperties(renderer);
@@ -1143,6 +1689,10 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         SDL_AddWindowEventWatch(SDL_WINDOW_EVENT_WATCH_NORMAL, SDL_RendererEventWatch, renderer);
     }
 
+    renderer->reorder_draws = SDL_GetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN, false);
+    renderer->gpu_timing = SDL_GetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN, false);
+    renderer->throttle_occluded = window && SDL_GetHintBoolean(SDL_HINT_RENDER_THROTTLE_OCCLUDED, false);
+
     int vsync = (int)SDL_GetNumberProperty(props, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, 0);
     SDL_SetRenderVSync(renderer, vsync);
     SDL_CalculateSimulatedVSyncInterval(renderer, window);
@@ -1310,6 +1860,35 @@ bool SDL_GetCurrentRenderOutputSize(SDL_Renderer *renderer, int *w, int *h)
     return true;
 }
 
+// The output size changed, update the main view as we would for a window resize
+static void UpdateMainViewForOutputSize(SDL_Renderer *renderer)
+{
+    SDL_RenderViewState *view = renderer->view;
+    renderer->view = &renderer->main_view;
+    UpdateLogicalPresentation(renderer);
+    renderer->view = view;
+}
+
+bool SDL_SetRenderOutputSourceSize(SDL_Renderer *renderer, int w, int h)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (w < 0 || h < 0) {
+        return SDL_InvalidParamError(w < 0 ? "w" : "h");
+    }
+
+    if (!renderer->SetOutputSourceSize) {
+        return SDL_Unsupported();
+    }
+
+    if (!renderer->SetOutputSourceSize(renderer, w, h)) {
+        return false;
+    }
+
+    UpdateMainViewForOutputSize(renderer);
+    return true;
+}
+
 static bool IsSupportedBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode)
 {
     switch (blendMode) {
@@ -1390,15 +1969,309 @@ static SDL_PixelFormat GetClosestSupportedFormat(SDL_Renderer *renderer, SDL_Pix
     return renderer->texture_formats[0];
 }
 
-SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_PropertiesID props)
+static Uint64 GetTextureMemorySize(SDL_Texture *texture)
 {
-    SDL_Texture *texture;
+    const Uint64 w = (Uint64)texture->w;
+    const Uint64 h = (Uint64)texture->h;
+    const int block_bytes = SDL_GetCompressedBlockBytes(texture->format);
+
+    if (block_bytes) {
+        return (w / SDL_COMPRESSED_BLOCK_SIZE) * (h / SDL_COMPRESSED_BLOCK_SIZE) * block_bytes;
+    }
+
+    switch (texture->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        // Full resolution luma and half resolution chroma
+        return w * h + 2 * ((w + 1) / 2) * ((h + 1) / 2);
+    case SDL_PIXELFORMAT_P010:
+        return 2 * (w * h + 2 * ((w + 1) / 2) * ((h + 1) / 2));
+    default:
+        return w * h * SDL_BYTESPERPIXEL(texture->format);
+    }
+}
+
+/* Evict the least recently drawn evictable textures until the textures use at most target bytes.
+ * Textures used by queued commands are never evicted. Returns true if any texture was evicted.
+ */
+static bool EvictTextures(SDL_Renderer *renderer, Uint64 target, SDL_Texture *exclude)
+{
+    bool evicted = false;
+
+    while (renderer->texture_memory > target) {
+        SDL_Texture *lru = NULL;
+
+        for (SDL_Texture *texture = renderer->textures; texture; texture = texture->next) {
+            if (!texture->evictable || texture->evicted || texture == exclude ||
+                texture->last_command_generation == renderer->render_command_generation) {
+                continue;
+            }
+            if (!lru || (Sint32)(texture->last_command_generation - lru->last_command_generation) < 0) {
+                lru = texture;
+            }
+        }
+        if (!lru) {
+            break;
+        }
+
+        renderer->DestroyTexture(renderer, lru);
+        lru->internal = NULL;
+        lru->evicted = true;
+        renderer->texture_memory -= lru->memory_size;
+        ++renderer->stats.textures_evicted;
+        evicted = true;
+    }
+
+    if (evicted) {
+        // The backend may have cached state for the textures that were freed
+        renderer->InvalidateCachedState(renderer);
+    }
+    return evicted;
+}
+
+// Create the renderer's copy of a texture, making room for it if the renderer runs out of memory
+static bool CreateRendererTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_PropertiesID props)
+{
+    if (renderer->CreateTexture(renderer, texture, props)) {
+        return true;
+    }
+
+    if (!renderer->texture_memory_budget || !EvictTextures(renderer, 0, texture)) {
+        return false;
+    }
+    renderer->DestroyTexture(renderer, texture);
+    texture->internal = NULL;
+    return renderer->CreateTexture(renderer, texture, props);
+}
+
+static bool UploadTextureBackingSurface(SDL_Texture *texture)
+{
+    SDL_Surface *surface = texture->backing_surface;
+    SDL_Surface *temp = NULL;
+    bool result;
+
+    if (surface->format != texture->format ||
+        SDL_GetSurfaceColorspace(surface) != texture->colorspace ||
+        SDL_MUSTLOCK(surface)) {
+        temp = SDL_ConvertSurfaceAndColorspace(surface, texture->format, NULL, texture->colorspace, SDL_GetSurfaceProperties(surface));
+        if (!temp) {
+            return false;
+        }
+        surface = temp;
+    }
+    result = SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
+    SDL_DestroySurface(temp);
+
+    return result;
+}
+
+static bool RestoreEvictedTexture(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    const Uint32 last_command_generation = texture->last_command_generation;
+    SDL_PropertiesID props;
+    bool result;
+
+    // Make room for the texture before recreating it
+    if (renderer->texture_memory_budget) {
+        Uint64 target = 0;
+        if (renderer->texture_memory_budget > texture->memory_size) {
+            target = renderer->texture_memory_budget - texture->memory_size;
+        }
+        EvictTextures(renderer, target, texture);
+    }
+
+    props = SDL_CreateProperties();
+    if (!props) {
+        return false;
+    }
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, texture->format);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, texture->access);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, texture->w);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, texture->h);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, texture->colorspace);
+    SDL_SetFloatProperty(props, SDL_PROP_TEXTURE_CREATE_SDR_WHITE_POINT_FLOAT, texture->SDR_white_point);
+    SDL_SetFloatProperty(props, SDL_PROP_TEXTURE_CREATE_HDR_HEADROOM_FLOAT, texture->HDR_headroom);
+    result = CreateRendererTexture(renderer, texture, props);
+    SDL_DestroyProperties(props);
+    if (!result) {
+        renderer->DestroyTexture(renderer, texture);
+        texture->internal = NULL;
+        return false;
+    }
+
+    texture->evicted = false;
+    renderer->texture_memory += texture->memory_size;
+    ++renderer->stats.textures_restored;
+
+    /* The draw being queued may have marked the texture as used already, but none
+     * of the queued commands use it yet, so refilling it doesn't need a flush. */
+    texture->last_command_generation = renderer->render_command_generation - 1;
+    if (texture->backing_surface) {
+        result = UploadTextureBackingSurface(texture);
+    } else {
+        result = texture->restore_callback(texture->restore_userdata, texture);
+    }
+    texture->last_command_generation = last_command_generation;
+
+    return result;
+}
+
+// Small static textures can share larger atlas pages, packed in shelves
+#define SDL_TEXTURE_ATLAS_PAGE_SIZE 1024
+#define SDL_TEXTURE_ATLAS_MAX_SIZE  256
+#define SDL_TEXTURE_ATLAS_GUTTER    1 // edge pixels are repeated into this border to avoid bleeding when filtering
+
+static void SDL_DestroyTextureInternal(SDL_Texture *texture, bool is_destroying);
+
+static bool CanUseTextureAtlas(SDL_Renderer *renderer, SDL_PixelFormat format, SDL_TextureAccess access, SDL_Colorspace colorspace, int w, int h)
+{
+    // Renderers with their own copy path don't benefit from sharing textures
+    if (!renderer->QueueGeometry || renderer->QueueCopy || renderer->QueueCopyEx) {
+        return false;
+    }
+    if (access != SDL_TEXTUREACCESS_STATIC || colorspace != SDL_COLORSPACE_SRGB) {
+        return false;
+    }
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_ISPIXELFORMAT_INDEXED(format) || !IsSupportedFormat(renderer, format)) {
+        return false;
+    }
+    if (w > SDL_TEXTURE_ATLAS_MAX_SIZE || h > SDL_TEXTURE_ATLAS_MAX_SIZE) {
+        return false;
+    }
+    return true;
+}
+
+static bool PackTextureAtlasPage(SDL_TextureAtlasPage *page, int w, int h, SDL_Rect *rect)
+{
+    SDL_TextureAtlasShelf *shelf = NULL;
+    int i;
+
+    // Use the shelf that wastes the least height
+    for (i = 0; i < page->num_shelves; ++i) {
+        SDL_TextureAtlasShelf *candidate = &page->shelves[i];
+        if (candidate->h >= h && page->texture->w - candidate->used_w >= w) {
+            if (!shelf || candidate->h < shelf->h) {
+                shelf = candidate;
+            }
+        }
+    }
+
+    if (!shelf) {
+        SDL_TextureAtlasShelf *shelves;
+
+        if (page->texture->h - page->used_h < h) {
+            return false;
+        }
+        shelves = (SDL_TextureAtlasShelf *)SDL_realloc(page->shelves, (page->num_shelves + 1) * sizeof(*shelves));
+        if (!shelves) {
+            return false;
+        }
+        page->shelves = shelves;
+        shelf = &page->shelves[page->num_shelves++];
+        shelf->y = page->used_h;
+        shelf->h = h;
+        shelf->used_w = 0;
+        page->used_h += h;
+    }
+
+    rect->x = shelf->used_w;
+    rect->y = shelf->y;
+    rect->w = w;
+    rect->h = h;
+    shelf->used_w += w;
+    return true;
+}
+
+static SDL_TextureAtlasPage *AllocateTextureAtlasRect(SDL_Renderer *renderer, SDL_PixelFormat format, int w, int h, SDL_Rect *rect)
+{
+    SDL_TextureAtlasPage *page;
+    SDL_PropertiesID props;
+    int size = SDL_TEXTURE_ATLAS_PAGE_SIZE;
+    int max_texture_size;
+
+    for (page = renderer->atlas_pages; page; page = page->next) {
+        if (page->texture->format == format && PackTextureAtlasPage(page, w, h, rect)) {
+            ++page->num_textures;
+            return page;
+        }
+    }
+
+    max_texture_size = (int)SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+    if (max_texture_size && max_texture_size < size) {
+        size = max_texture_size;
+    }
+    if (w > size || h > size) {
+        return NULL;
+    }
+
+    page = (SDL_TextureAtlasPage *)SDL_calloc(1, sizeof(*page));
+    if (!page) {
+        return NULL;
+    }
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, SDL_COLORSPACE_SRGB);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, format);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, size);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, size);
+    page->texture = SDL_CreateTextureWithProperties(renderer, props);
+    SDL_DestroyProperties(props);
+    if (!page->texture || !PackTextureAtlasPage(page, w, h, rect)) {
+        if (page->texture) {
+            SDL_DestroyTexture(page->texture);
+        }
+        SDL_free(page->shelves);
+        SDL_free(page);
+        return NULL;
+    }
+
+    page->num_textures = 1;
+    page->next = renderer->atlas_pages;
+    renderer->atlas_pages = page;
+    return page;
+}
+
+static void ReleaseTextureAtlasPage(SDL_Renderer *renderer, SDL_TextureAtlasPage *page, bool is_destroying)
+{
+    SDL_TextureAtlasPage *prev = NULL, *curr;
+
+    if (--page->num_textures > 0) {
+        // The space isn't reused until the whole page is empty
+        return;
+    }
+
+    for (curr = renderer->atlas_pages; curr; prev = curr, curr = curr->next) {
+        if (curr == page) {
+            if (prev) {
+                prev->next = page->next;
+            } else {
+                renderer->atlas_pages = page->next;
+            }
+            break;
+        }
+    }
+    SDL_DestroyTextureInternal(page->texture, is_destroying);
+    SDL_free(page->shelves);
+    SDL_free(page);
+}
+
+SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_PropertiesID props)
+{
+    SDL_Texture *texture;
     SDL_PixelFormat format = (SDL_PixelFormat)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, SDL_PIXELFORMAT_UNKNOWN);
     SDL_TextureAccess access = (SDL_TextureAccess)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
-    int w = (int)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, 0);
-    int h = (int)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, 0);
+    SDL_Surface *backing_surface = (SDL_Surface *)SDL_GetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER, NULL);
+    SDL_TextureRestoreCallback restore_callback = (SDL_TextureRestoreCallback)SDL_GetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_RESTORE_CALLBACK_POINTER, NULL);
+    int w = (int)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, backing_surface ? backing_surface->w : 0);
+    int h = (int)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, backing_surface ? backing_surface->h : 0);
     SDL_Colorspace default_colorspace;
     bool texture_is_fourcc_and_target;
+    SDL_TextureAtlasPage *atlas_page = NULL;
+    SDL_Rect atlas_rect;
 
     CHECK_RENDERER_MAGIC(renderer, NULL);
 
@@ -1419,6 +2292,31 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
         SDL_SetError("Texture dimensions can't be 0");
         return NULL;
     }
+    if (backing_surface) {
+        if (!SDL_SurfaceValid(backing_surface)) {
+            SDL_InvalidParamError("SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER");
+            return NULL;
+        }
+        if (backing_surface->w != w || backing_surface->h != h) {
+            SDL_SetError("The backing surface must be the same size as the texture");
+            return NULL;
+        }
+    }
+    if (SDL_GetCompressedBlockBytes(format)) {
+        // There's no decoder for compressed formats, so the renderer has to sample them directly
+        if (!IsSupportedFormat(renderer, format)) {
+            SDL_SetError("Texture format %s not supported by this renderer", SDL_GetPixelFormatName(format));
+            return NULL;
+        }
+        if (access != SDL_TEXTUREACCESS_STATIC) {
+            SDL_SetError("Compressed textures must be created with SDL_TEXTUREACCESS_STATIC");
+            return NULL;
+        }
+        if ((w % SDL_COMPRESSED_BLOCK_SIZE) != 0 || (h % SDL_COMPRESSED_BLOCK_SIZE) != 0) {
+            SDL_SetError("Compressed texture dimensions must be a multiple of %d", SDL_COMPRESSED_BLOCK_SIZE);
+            return NULL;
+        }
+    }
     int max_texture_size = (int)SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
     if (max_texture_size && (w > max_texture_size || h > max_texture_size)) {
         SDL_SetError("Texture dimensions are limited to %dx%d", max_texture_size, max_texture_size);
@@ -1427,8 +2325,18 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
 
     default_colorspace = SDL_GetDefaultColorspaceForFormat(format);
 
+    /* The atlas page is allocated before the texture so it follows the texture
+     * in the renderer's texture list and is destroyed after it. */
+    if (SDL_GetBooleanProperty(props, SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN, false) &&
+        CanUseTextureAtlas(renderer, format, access, (SDL_Colorspace)SDL_GetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, default_colorspace), w, h)) {
+        atlas_page = AllocateTextureAtlasRect(renderer, format, w + 2 * SDL_TEXTURE_ATLAS_GUTTER, h + 2 * SDL_TEXTURE_ATLAS_GUTTER, &atlas_rect);
+    }
+
     texture = (SDL_Texture *)SDL_calloc(1, sizeof(*texture));
     if (!texture) {
+        if (atlas_page) {
+            ReleaseTextureAtlasPage(renderer, atlas_page, false);
+        }
         return NULL;
     }
     texture->refcount = 1;
@@ -1442,7 +2350,7 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
     texture->color.g = 1.0f;
     texture->color.b = 1.0f;
     texture->color.a = 1.0f;
-    texture->blendMode = SDL_ISPIXELFORMAT_ALPHA(format) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE;
+    texture->blendMode = (SDL_ISPIXELFORMAT_ALPHA(format) || SDL_GetCompressedBlockBytes(format)) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE;
     texture->scaleMode = renderer->scale_mode;
     texture->view.pixel_w = w;
     texture->view.pixel_h = h;
@@ -1470,11 +2378,25 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
     // FOURCC format cannot be used directly by renderer back-ends for target texture
     texture_is_fourcc_and_target = (access == SDL_TEXTUREACCESS_TARGET && SDL_ISPIXELFORMAT_FOURCC(format));
 
-    if (!texture_is_fourcc_and_target && IsSupportedFormat(renderer, format)) {
-        if (!renderer->CreateTexture(renderer, texture, props)) {
+    if (atlas_page) {
+        texture->atlas_page = atlas_page;
+        texture->atlas_rect.x = atlas_rect.x + SDL_TEXTURE_ATLAS_GUTTER;
+        texture->atlas_rect.y = atlas_rect.y + SDL_TEXTURE_ATLAS_GUTTER;
+        texture->atlas_rect.w = w;
+        texture->atlas_rect.h = h;
+    } else if (!texture_is_fourcc_and_target && IsSupportedFormat(renderer, format)) {
+        if (!CreateRendererTexture(renderer, texture, props)) {
             SDL_DestroyTexture(texture);
             return NULL;
         }
+        texture->memory_size = GetTextureMemorySize(texture);
+        renderer->texture_memory += texture->memory_size;
+
+        if ((backing_surface || restore_callback) && access == SDL_TEXTUREACCESS_STATIC) {
+            texture->evictable = true;
+            texture->restore_callback = restore_callback;
+            texture->restore_userdata = SDL_GetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_RESTORE_USERDATA_POINTER, NULL);
+        }
     } else {
         SDL_PixelFormat closest_format;
         SDL_PropertiesID native_props = SDL_CreateProperties();
@@ -1545,6 +2467,19 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
         }
     }
 
+    if (backing_surface) {
+        texture->backing_surface = backing_surface;
+        ++backing_surface->refcount;
+        if (!UploadTextureBackingSurface(texture)) {
+            SDL_DestroyTexture(texture);
+            return NULL;
+        }
+    }
+
+    if (renderer->texture_memory_budget) {
+        EvictTextures(renderer, renderer->texture_memory_budget, texture);
+    }
+
     // Now set the properties for the new texture
     props = SDL_GetTextureProperties(texture);
     SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_COLORSPACE_NUMBER, texture->colorspace);
@@ -2134,6 +3069,74 @@ static bool SDL_UpdateTextureNative(SDL_Texture *texture, const SDL_Rect *rect,
     return true;
 }
 
+static bool SDL_UpdateTextureAtlas(SDL_Texture *texture, const SDL_Rect *rect,
+                                   const void *pixels, int pitch)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    SDL_Texture *page = texture->atlas_page->texture;
+    const int bpp = SDL_BYTESPERPIXEL(texture->format);
+    const int pad_left = (rect->x == 0) ? SDL_TEXTURE_ATLAS_GUTTER : 0;
+    const int pad_top = (rect->y == 0) ? SDL_TEXTURE_ATLAS_GUTTER : 0;
+    const int pad_right = (rect->x + rect->w == texture->w) ? SDL_TEXTURE_ATLAS_GUTTER : 0;
+    const int pad_bottom = (rect->y + rect->h == texture->h) ? SDL_TEXTURE_ATLAS_GUTTER : 0;
+    SDL_Rect page_rect;
+    int temp_pitch;
+    Uint8 *temp_pixels;
+    bool result;
+    int x, y;
+
+    // Edge pixels are repeated into the gutter so filtering never samples a neighbor
+    page_rect.x = texture->atlas_rect.x + rect->x - pad_left;
+    page_rect.y = texture->atlas_rect.y + rect->y - pad_top;
+    page_rect.w = pad_left + rect->w + pad_right;
+    page_rect.h = pad_top + rect->h + pad_bottom;
+    temp_pitch = page_rect.w * bpp;
+    temp_pixels = (Uint8 *)SDL_malloc((size_t)page_rect.h * temp_pitch);
+    if (!temp_pixels) {
+        return false;
+    }
+    for (y = 0; y < page_rect.h; ++y) {
+        const int src_y = SDL_clamp(y - pad_top, 0, rect->h - 1);
+        const Uint8 *src = (const Uint8 *)pixels + src_y * pitch;
+        Uint8 *dst = temp_pixels + y * temp_pitch;
+
+        for (x = 0; x < pad_left; ++x) {
+            SDL_memcpy(dst + x * bpp, src, bpp);
+        }
+        SDL_memcpy(dst + pad_left * bpp, src, (size_t)rect->w * bpp);
+        for (x = 0; x < pad_right; ++x) {
+            SDL_memcpy(dst + (pad_left + rect->w + x) * bpp, src + (rect->w - 1) * bpp, bpp);
+        }
+    }
+
+    renderer->stats.texture_upload_bytes += (Uint64)page_rect.h * temp_pitch;
+    result = FlushRenderCommandsIfTextureNeeded(page) &&
+             renderer->UpdateTexture(renderer, page, &page_rect, temp_pixels, temp_pitch);
+    SDL_free(temp_pixels);
+    return result;
+}
+
+static bool SDL_UpdateTextureCompressed(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    const int block_bytes = SDL_GetCompressedBlockBytes(texture->format);
+
+    // The texture size is a multiple of the block size, so only partial blocks in the middle are rejected
+    if ((rect->x % SDL_COMPRESSED_BLOCK_SIZE) != 0 || (rect->y % SDL_COMPRESSED_BLOCK_SIZE) != 0 ||
+        (rect->w % SDL_COMPRESSED_BLOCK_SIZE) != 0 || (rect->h % SDL_COMPRESSED_BLOCK_SIZE) != 0) {
+        return SDL_SetError("Compressed texture updates must be aligned to %dx%d blocks", SDL_COMPRESSED_BLOCK_SIZE, SDL_COMPRESSED_BLOCK_SIZE);
+    }
+    if (pitch < (rect->w / SDL_COMPRESSED_BLOCK_SIZE) * block_bytes) {
+        return SDL_InvalidParamError("pitch");
+    }
+
+    if (!FlushRenderCommandsIfTextureNeeded(texture)) {
+        return false;
+    }
+    renderer->stats.texture_upload_bytes += (Uint64)(rect->h / SDL_COMPRESSED_BLOCK_SIZE) * (rect->w / SDL_COMPRESSED_BLOCK_SIZE) * block_bytes;
+    return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
+}
+
 bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
 {
     SDL_Rect real_rect;
@@ -2147,6 +3150,10 @@ bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *p
         return SDL_InvalidParamError("pitch");
     }
 
+    if (texture->evicted && !RestoreEvictedTexture(texture)) {
+        return false;
+    }
+
     real_rect.x = 0;
     real_rect.y = 0;
     real_rect.w = texture->w;
@@ -2165,15 +3172,62 @@ bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *p
 #endif
     } else if (texture->native) {
         return SDL_UpdateTextureNative(texture, &real_rect, pixels, pitch);
+    } else if (texture->atlas_page) {
+        return SDL_UpdateTextureAtlas(texture, &real_rect, pixels, pitch);
+    } else if (SDL_GetCompressedBlockBytes(texture->format)) {
+        return SDL_UpdateTextureCompressed(texture, &real_rect, pixels, pitch);
     } else {
         SDL_Renderer *renderer = texture->renderer;
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
             return false;
         }
+        renderer->stats.texture_upload_bytes += (Uint64)real_rect.h * real_rect.w * SDL_BYTESPERPIXEL(texture->format);
         return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
     }
 }
 
+bool SDL_UpdateTextureAsync(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch, SDL_TextureUpdateCompleteCallback callback, void *userdata)
+{
+    SDL_Renderer *renderer;
+    SDL_PendingTextureUpdate *update;
+
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    if (!pixels) {
+        return SDL_InvalidParamError("pixels");
+    }
+    if (!pitch) {
+        return SDL_InvalidParamError("pitch");
+    }
+
+    update = (SDL_PendingTextureUpdate *)SDL_calloc(1, sizeof(*update));
+    if (!update) {
+        return false;
+    }
+    update->texture = texture;
+    if (rect) {
+        update->rect = *rect;
+    } else {
+        update->full_texture = true;
+    }
+    update->pixels = pixels;
+    update->pitch = pitch;
+    update->callback = callback;
+    update->userdata = userdata;
+
+    renderer = texture->renderer;
+    SDL_LockMutex(renderer->texture_updates_lock);
+    if (renderer->texture_updates_tail) {
+        renderer->texture_updates_tail->next = update;
+    } else {
+        renderer->texture_updates = update;
+    }
+    renderer->texture_updates_tail = update;
+    SDL_UnlockMutex(renderer->texture_updates_lock);
+
+    return true;
+}
+
 #ifdef SDL_HAVE_YUV
 static bool SDL_UpdateTextureYUVPlanar(SDL_Texture *texture, const SDL_Rect *rect,
                                        const Uint8 *Yplane, int Ypitch,
@@ -2313,6 +3367,10 @@ bool SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
         return SDL_SetError("Texture format must by YV12 or IYUV");
     }
 
+    if (texture->evicted && !RestoreEvictedTexture(texture)) {
+        return false;
+    }
+
     real_rect.x = 0;
     real_rect.y = 0;
     real_rect.w = texture->w;
@@ -2335,6 +3393,7 @@ bool SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            renderer->stats.texture_upload_bytes += (Uint64)real_rect.h * real_rect.w + 2 * ((Uint64)((real_rect.h + 1) / 2) * ((real_rect.w + 1) / 2));
             return renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -2373,6 +3432,10 @@ bool SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
         return SDL_SetError("Texture format must by NV12 or NV21");
     }
 
+    if (texture->evicted && !RestoreEvictedTexture(texture)) {
+        return false;
+    }
+
     real_rect.x = 0;
     real_rect.y = 0;
     real_rect.w = texture->w;
@@ -2395,6 +3458,7 @@ bool SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            renderer->stats.texture_upload_bytes += (Uint64)real_rect.h * real_rect.w + 2 * ((Uint64)((real_rect.h + 1) / 2) * ((real_rect.w + 1) / 2));
             return renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch);
         } else {
             return SDL_Unsupported();
@@ -2458,6 +3522,7 @@ bool SDL_LockTexture(SDL_Texture *texture, const SDL_Rect *rect, void **pixels,
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
             return false;
         }
+        texture->locked_rect = *rect;
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -2552,6 +3617,7 @@ void SDL_UnlockTexture(SDL_Texture *texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        renderer->stats.texture_upload_bytes += (Uint64)texture->locked_rect.h * texture->locked_rect.w * SDL_BYTESPERPIXEL(texture->format);
         renderer->UnlockTexture(renderer, texture);
     }
 
@@ -2559,23 +3625,8 @@ void SDL_UnlockTexture(SDL_Texture *texture)
     texture->locked_surface = NULL;
 }
 
-bool SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
+static bool SetRenderTargetInternal(SDL_Renderer *renderer, SDL_Texture *texture, SDL_RenderViewState *view)
 {
-    // texture == NULL is valid and means reset the target to the window
-    if (texture) {
-        CHECK_TEXTURE_MAGIC(texture, false);
-        if (renderer != texture->renderer) {
-            return SDL_SetError("Texture was not created with this renderer");
-        }
-        if (texture->access != SDL_TEXTUREACCESS_TARGET) {
-            return SDL_SetError("Texture not created with SDL_TEXTUREACCESS_TARGET");
-        }
-        if (texture->native) {
-            // Always render to the native texture
-            texture = texture->native;
-        }
-    }
-
     if (texture == renderer->target) {
         // Nothing to do!
         return true;
@@ -2586,11 +3637,7 @@ bool SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
     SDL_LockMutex(renderer->target_mutex);
 
     renderer->target = texture;
-    if (texture) {
-        renderer->view = &texture->view;
-    } else {
-        renderer->view = &renderer->main_view;
-    }
+    renderer->view = view;
     UpdateColorScale(renderer);
 
     if (!renderer->SetRenderTarget(renderer, texture)) {
@@ -2611,13 +3658,252 @@ bool SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
     return true;
 }
 
-SDL_Texture *SDL_GetRenderTarget(SDL_Renderer *renderer)
+bool SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
 {
-    CHECK_RENDERER_MAGIC(renderer, NULL);
-    if (!renderer->target) {
-        return NULL;
+    // texture == NULL is valid and means reset the target to the window
+    if (texture) {
+        CHECK_TEXTURE_MAGIC(texture, false);
+        if (renderer != texture->renderer) {
+            return SDL_SetError("Texture was not created with this renderer");
+        }
+        if (texture->access != SDL_TEXTUREACCESS_TARGET) {
+            return SDL_SetError("Texture not created with SDL_TEXTUREACCESS_TARGET");
+        }
+        if (texture->native) {
+            // Always render to the native texture
+            texture = texture->native;
+        }
+        return SetRenderTargetInternal(renderer, texture, &texture->view);
     }
-    return (SDL_Texture *)SDL_GetPointerProperty(SDL_GetTextureProperties(renderer->target), SDL_PROP_TEXTURE_PARENT_POINTER, renderer->target);
+
+    if (IsDrawingDynamicResolutionScene(renderer)) {
+        // The window target is the dynamic resolution scene until it's upscaled
+        texture = renderer->dynamic_target;
+    }
+    return SetRenderTargetInternal(renderer, texture, &renderer->main_view);
+}
+
+/* The scene target is allocated in buckets, so it survives resizes within a bucket, like
+   dragging a window edge, and the scene only uses the part of it the output size needs. */
+#define DYNAMIC_RESOLUTION_TARGET_BUCKET 256
+
+static int GetDynamicResolutionTargetSize(SDL_Renderer *renderer, int size)
+{
+    const int max_texture_size = (int)SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+
+    size = (size + DYNAMIC_RESOLUTION_TARGET_BUCKET - 1) & ~(DYNAMIC_RESOLUTION_TARGET_BUCKET - 1);
+    if (max_texture_size && size > max_texture_size) {
+        size = max_texture_size;
+    }
+    return size;
+}
+
+static bool BeginDynamicResolutionScene(SDL_Renderer *renderer)
+{
+    int w, h;
+
+    if (!SDL_GetRenderOutputSize(renderer, &w, &h)) {
+        return false;
+    }
+
+    if (!renderer->dynamic_target ||
+        renderer->dynamic_target->w != GetDynamicResolutionTargetSize(renderer, w) ||
+        renderer->dynamic_target->h != GetDynamicResolutionTargetSize(renderer, h)) {
+        SDL_Texture *texture = renderer->dynamic_target;
+        if (texture) {
+            renderer->dynamic_target = NULL;
+            if (renderer->target == texture) {
+                SetRenderTargetInternal(renderer, NULL, &renderer->main_view);
+            }
+            SDL_DestroyTexture(texture);
+        }
+
+        SDL_PropertiesID props = SDL_CreateProperties();
+        if (renderer->output_colorspace != SDL_COLORSPACE_SRGB) {
+            SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, SDL_PIXELFORMAT_RGBA64_FLOAT);
+            SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, SDL_COLORSPACE_SRGB_LINEAR);
+        }
+        SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_TARGET);
+        SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, GetDynamicResolutionTargetSize(renderer, w));
+        SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, GetDynamicResolutionTargetSize(renderer, h));
+        texture = SDL_CreateTextureWithProperties(renderer, props);
+        SDL_DestroyProperties(props);
+        if (!texture) {
+            return false;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+        renderer->dynamic_target = texture;
+    }
+
+    renderer->dynamic_upscaled = false;
+    if (!renderer->target) {
+        if (!SetRenderTargetInternal(renderer, renderer->dynamic_target, &renderer->main_view)) {
+            return false;
+        }
+        UpdateLogicalPresentation(renderer);
+    }
+    return true;
+}
+
+static void EndDynamicResolution(SDL_Renderer *renderer)
+{
+    SDL_Texture *texture = renderer->dynamic_target;
+
+    if (!texture) {
+        return;
+    }
+
+    renderer->dynamic_target = NULL;
+    renderer->dynamic_upscaled = false;
+    if (renderer->target == texture) {
+        SetRenderTargetInternal(renderer, NULL, &renderer->main_view);
+        UpdateLogicalPresentation(renderer);
+    }
+    SDL_DestroyTexture(texture);
+}
+
+static void SDL_RenderLogicalPresentation(SDL_Renderer *renderer);
+
+static bool UpscaleDynamicResolutionScene(SDL_Renderer *renderer)
+{
+    SDL_RenderViewState *view = &renderer->main_view;
+    SDL_FRect src;
+    int scene_w, scene_h;
+
+    if (!IsDrawingDynamicResolutionScene(renderer)) {
+        return true;
+    }
+
+    GetMainViewOutputSize(renderer, &scene_w, &scene_h);
+    src.x = 0.0f;
+    src.y = 0.0f;
+    src.w = (float)scene_w;
+    src.h = (float)scene_h;
+
+    // The logical letterbox borders are part of the scene
+    SDL_RenderLogicalPresentation(renderer);
+
+    renderer->dynamic_upscaled = true;
+    if (!SetRenderTargetInternal(renderer, NULL, view)) {
+        return false;
+    }
+
+    // save off some state we're going to trample.
+    const int logical_w = view->logical_w;
+    const int logical_h = view->logical_h;
+    const SDL_RendererLogicalPresentation mode = view->logical_presentation_mode;
+    const float scale_x = view->scale.x;
+    const float scale_y = view->scale.y;
+    const bool clipping_enabled = view->clipping_enabled;
+    SDL_Rect orig_viewport, orig_cliprect;
+
+    SDL_copyp(&orig_viewport, &view->viewport);
+    if (clipping_enabled) {
+        SDL_copyp(&orig_cliprect, &view->clip_rect);
+    }
+
+    // trample some state.
+    SDL_SetRenderLogicalPresentation(renderer, logical_w, logical_h, SDL_LOGICAL_PRESENTATION_DISABLED);
+    SDL_SetRenderViewport(renderer, NULL);
+    if (clipping_enabled) {
+        SDL_SetRenderClipRect(renderer, NULL);
+    }
+    SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+
+    // stretch the scene over the full resolution output.
+    const bool result = SDL_RenderTexture(renderer, renderer->dynamic_target, &src, NULL);
+
+    // now set everything back, at the full output size.
+    view->logical_presentation_mode = mode;
+    SDL_SetRenderViewport(renderer, &orig_viewport);
+    if (clipping_enabled) {
+        SDL_SetRenderClipRect(renderer, &orig_cliprect);
+    }
+    SDL_SetRenderScale(renderer, scale_x, scale_y);
+
+    SDL_SetRenderLogicalPresentation(renderer, logical_w, logical_h, mode);
+
+    return result;
+}
+
+// Move the scale toward the GPU time budget, as measured by the renderer's GPU timing
+static void UpdateDynamicResolutionScale(SDL_Renderer *renderer)
+{
+    const Uint64 gpu_time_ns = renderer->gpu_time_ns;
+
+    if (!renderer->dynamic_budget_ns || !gpu_time_ns || gpu_time_ns == renderer->dynamic_last_gpu_time_ns) {
+        // Wait for a new measurement
+        return;
+    }
+    renderer->dynamic_last_gpu_time_ns = gpu_time_ns;
+
+    // GPU time is roughly proportional to the number of pixels, so scale each axis by the square root
+    const float wanted_scale = renderer->dynamic_scale * SDL_sqrtf((float)renderer->dynamic_budget_ns / gpu_time_ns);
+
+    // Measurements lag by a few frames, so only move part of the way there to avoid oscillating
+    renderer->dynamic_scale += (wanted_scale - renderer->dynamic_scale) * 0.25f;
+    renderer->dynamic_scale = SDL_clamp(renderer->dynamic_scale, renderer->dynamic_min_scale, 1.0f);
+}
+
+bool SDL_SetRenderDynamicResolution(SDL_Renderer *renderer, float min_scale, Uint64 gpu_budget_ns)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (!(min_scale > 0.0f && min_scale <= 1.0f)) {
+        return SDL_InvalidParamError("min_scale");
+    }
+
+    if (min_scale == 1.0f) {
+        renderer->dynamic_min_scale = 1.0f;
+        renderer->dynamic_budget_ns = 0;
+        EndDynamicResolution(renderer);
+        return true;
+    }
+
+    if (!renderer->window) {
+        return SDL_SetError("Dynamic resolution requires a window renderer");
+    }
+    if (gpu_budget_ns && !renderer->gpu_timing) {
+        return SDL_SetError("A GPU time budget requires a renderer created with SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN");
+    }
+
+    renderer->dynamic_min_scale = min_scale;
+    renderer->dynamic_budget_ns = gpu_budget_ns;
+    renderer->dynamic_last_gpu_time_ns = renderer->gpu_time_ns;
+    if (!gpu_budget_ns || !renderer->dynamic_target) {
+        // Start at the lowest scale and let the budget raise it
+        renderer->dynamic_scale = min_scale;
+    } else {
+        renderer->dynamic_scale = SDL_clamp(renderer->dynamic_scale, min_scale, 1.0f);
+    }
+
+    if (IsDrawingDynamicResolutionScene(renderer)) {
+        if (renderer->target == renderer->dynamic_target) {
+            UpdateLogicalPresentation(renderer);
+        }
+        return true;
+    }
+    return BeginDynamicResolutionScene(renderer);
+}
+
+bool SDL_RenderDynamicResolutionUpscale(SDL_Renderer *renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (renderer->target && renderer->target != renderer->dynamic_target) {
+        return SDL_SetError("You can't upscale while a render target is set");
+    }
+    return UpscaleDynamicResolutionScene(renderer);
+}
+
+SDL_Texture *SDL_GetRenderTarget(SDL_Renderer *renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+    if (!renderer->target || renderer->target == renderer->dynamic_target) {
+        return NULL;
+    }
+    return (SDL_Texture *)SDL_GetPointerProperty(SDL_GetTextureProperties(renderer->target), SDL_PROP_TEXTURE_PARENT_POINTER, renderer->target);
 }
 
 static void UpdateLogicalPresentation(SDL_Renderer *renderer)
@@ -2629,7 +3915,7 @@ static void UpdateLogicalPresentation(SDL_Renderer *renderer)
     int iwidth, iheight;
 
     if (is_main_view) {
-        SDL_GetRenderOutputSize(renderer, &iwidth, &iheight);
+        GetMainViewOutputSize(renderer, &iwidth, &iheight);
     } else {
         SDL_assert(renderer->target != NULL);
         iwidth = (int)renderer->target->w;
@@ -3119,7 +4405,7 @@ bool SDL_GetRenderSafeArea(SDL_Renderer *renderer, SDL_Rect *rect)
 
     CHECK_RENDERER_MAGIC(renderer, false);
 
-    if (renderer->target || !renderer->window) {
+    if ((renderer->target && renderer->target != renderer->dynamic_target) || !renderer->window) {
         // The entire viewport is safe for rendering
         return SDL_GetRenderViewport(renderer, rect);
     }
@@ -3439,6 +4725,32 @@ static bool RenderPointsWithRects(SDL_Renderer *renderer, const SDL_FPoint *fpoi
     return result;
 }
 
+static bool RenderPointsWithLineBatch(SDL_Renderer *renderer, const SDL_FPoint *fpoints, const int count)
+{
+    const SDL_RenderViewState *view = renderer->view;
+    SDL_LineBatchInstance *instances;
+    bool result;
+    bool isstack;
+    int i;
+
+    instances = SDL_small_alloc(SDL_LineBatchInstance, count, &isstack);
+    if (!instances) {
+        return false;
+    }
+
+    for (i = 0; i < count; ++i) {
+        instances[i].start = fpoints[i];
+        instances[i].end = fpoints[i];
+        instances[i].include_start = 1.0f;
+    }
+
+    result = QueueCmdLineBatch(renderer, instances, count, view->current_scale.x, view->current_scale.y);
+
+    SDL_small_free(instances, isstack);
+
+    return result;
+}
+
 bool SDL_RenderPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
 {
     bool result;
@@ -3461,7 +4773,11 @@ bool SDL_RenderPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int coun
 
     const SDL_RenderViewState *view = renderer->view;
     if ((view->current_scale.x != 1.0f) || (view->current_scale.y != 1.0f)) {
-        result = RenderPointsWithRects(renderer, points, count);
+        if (renderer->QueueLineBatch) {
+            result = RenderPointsWithLineBatch(renderer, points, count);
+        } else {
+            result = RenderPointsWithRects(renderer, points, count);
+        }
     } else {
         result = QueueCmdDrawPoints(renderer, points, count);
     }
@@ -3564,7 +4880,11 @@ static bool RenderLineBresenham(SDL_Renderer *renderer, int x1, int y1, int x2,
     }
 
     if ((view->current_scale.x != 1.0f) || (view->current_scale.y != 1.0f)) {
-        result = RenderPointsWithRects(renderer, points, numpixels);
+        if (renderer->QueueLineBatch) {
+            result = RenderPointsWithLineBatch(renderer, points, numpixels);
+        } else {
+            result = RenderPointsWithRects(renderer, points, numpixels);
+        }
     } else {
         result = QueueCmdDrawPoints(renderer, points, numpixels);
     }
@@ -3645,6 +4965,44 @@ static bool RenderLinesWithRectsF(SDL_Renderer *renderer, const SDL_FPoint *poin
     return result;
 }
 
+static bool RenderLinesWithLineBatch(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
+{
+    const SDL_RenderViewState *view = renderer->view;
+    bool is_looping = (points[0].x == points[count - 1].x && points[0].y == points[count - 1].y);
+    SDL_LineBatchInstance *instances;
+    bool result;
+    bool isstack;
+    int i;
+
+    if (is_looping) {
+        // A closed polyline draws its first point at the end, unless it never goes anywhere
+        is_looping = false;
+        for (i = 1; i < count - 1; ++i) {
+            if (points[i].x != points[0].x || points[i].y != points[0].y) {
+                is_looping = true;
+                break;
+            }
+        }
+    }
+
+    instances = SDL_small_alloc(SDL_LineBatchInstance, count - 1, &isstack);
+    if (!instances) {
+        return false;
+    }
+
+    for (i = 0; i < count - 1; ++i) {
+        instances[i].start = points[i];
+        instances[i].end = points[i + 1];
+        instances[i].include_start = (i == 0 && !is_looping) ? 1.0f : 0.0f;
+    }
+
+    result = QueueCmdLineBatch(renderer, instances, count - 1, view->current_scale.x, view->current_scale.y);
+
+    SDL_small_free(instances, isstack);
+
+    return result;
+}
+
 bool SDL_RenderLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
 {
     bool result = true;
@@ -3668,7 +5026,10 @@ bool SDL_RenderLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count
     SDL_RenderViewState *view = renderer->view;
     const bool islogical = (view->logical_presentation_mode != SDL_LOGICAL_PRESENTATION_DISABLED);
 
-    if (islogical || (renderer->line_method == SDL_RENDERLINEMETHOD_GEOMETRY)) {
+    if ((islogical || (renderer->line_method == SDL_RENDERLINEMETHOD_GEOMETRY)) && renderer->QueueLineBatch) {
+        // The backend expands each segment on the GPU
+        result = RenderLinesWithLineBatch(renderer, points, count);
+    } else if (islogical || (renderer->line_method == SDL_RENDERLINEMETHOD_GEOMETRY)) {
         const float scale_x = view->current_scale.x;
         const float scale_y = view->current_scale.y;
         bool isstack1;
@@ -4129,6 +5490,215 @@ bool SDL_RenderTextureAffine(SDL_Renderer *renderer, SDL_Texture *texture,
     return result;
 }
 
+static void *GetTextureBatchData(SDL_Renderer *renderer, size_t size)
+{
+    if (renderer->batch_data_allocation < size) {
+        void *ptr = SDL_realloc(renderer->batch_data, size);
+        if (!ptr) {
+            return NULL;
+        }
+        if (renderer->batch_data) {
+            SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_RENDER, renderer->batch_data_allocation);
+        }
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_RENDER, size);
+        renderer->batch_data = ptr;
+        renderer->batch_data_allocation = size;
+    }
+    return renderer->batch_data;
+}
+
+static bool QueueTextureBatchGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
+                                      const SDL_TextureBatchInstance *instances, int count,
+                                      float scale_x, float scale_y)
+{
+    const size_t vertices_size = (size_t)count * 4 * sizeof(SDL_Vertex);
+    const size_t indices_size = (size_t)count * 6 * sizeof(int);
+    SDL_Vertex *vertices;
+    int *indices;
+    int i;
+
+    // The instances live at the start of the scratch buffer, keep them intact
+    Uint8 *data = (Uint8 *)GetTextureBatchData(renderer, count * sizeof(*instances) + vertices_size + indices_size);
+    if (!data) {
+        return false;
+    }
+    instances = (const SDL_TextureBatchInstance *)data;
+    vertices = (SDL_Vertex *)(data + count * sizeof(*instances));
+    indices = (int *)(data + count * sizeof(*instances) + vertices_size);
+
+    for (i = 0; i < count; ++i) {
+        const SDL_TextureBatchInstance *instance = &instances[i];
+        SDL_Vertex *v = &vertices[i * 4];
+        int *index = &indices[i * 6];
+        int j;
+
+        v[0].position = instance->origin;
+        v[1].position.x = instance->origin.x + instance->axis_x.x;
+        v[1].position.y = instance->origin.y + instance->axis_x.y;
+        v[2].position.x = v[1].position.x + instance->axis_y.x;
+        v[2].position.y = v[1].position.y + instance->axis_y.y;
+        v[3].position.x = instance->origin.x + instance->axis_y.x;
+        v[3].position.y = instance->origin.y + instance->axis_y.y;
+        v[0].tex_coord.x = instance->minu;
+        v[0].tex_coord.y = instance->minv;
+        v[1].tex_coord.x = instance->maxu;
+        v[1].tex_coord.y = instance->minv;
+        v[2].tex_coord.x = instance->maxu;
+        v[2].tex_coord.y = instance->maxv;
+        v[3].tex_coord.x = instance->minu;
+        v[3].tex_coord.y = instance->maxv;
+        for (j = 0; j < 4; ++j) {
+            v[j].color = instance->color;
+        }
+        for (j = 0; j < 6; ++j) {
+            index[j] = i * 4 + rect_index_order[j];
+        }
+    }
+
+    return QueueCmdGeometry(renderer, texture,
+                            &vertices->position.x, sizeof(*vertices),
+                            &vertices->color, sizeof(*vertices),
+                            &vertices->tex_coord.x, sizeof(*vertices),
+                            count * 4, indices, count * 6, sizeof(*indices),
+                            scale_x, scale_y, SDL_TEXTURE_ADDRESS_CLAMP, SDL_TEXTURE_ADDRESS_CLAMP);
+}
+
+static bool RenderTextureBatchRotated(SDL_Renderer *renderer, SDL_Texture *texture,
+                                      const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                                      const double *angles, const SDL_FColor *colors, int count)
+{
+    // The per-sprite colors are applied as color modulation of the texture that's actually drawn
+    SDL_Texture *drawn = texture->native ? texture->native : texture;
+    const SDL_FColor color = drawn->color;
+    bool result = true;
+    int i;
+
+    for (i = 0; i < count && result; ++i) {
+        if (colors) {
+            drawn->color.r = color.r * colors[i].r;
+            drawn->color.g = color.g * colors[i].g;
+            drawn->color.b = color.b * colors[i].b;
+            drawn->color.a = color.a * colors[i].a;
+        }
+        result = SDL_RenderTextureRotated(renderer, texture, srcrects ? &srcrects[i] : NULL, &dstrects[i],
+                                          angles ? angles[i] : 0.0, NULL, SDL_FLIP_NONE);
+    }
+    drawn->color = color;
+    return result;
+}
+
+bool SDL_RenderTextureBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                            const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                            const double *angles, const SDL_FColor *colors, int count)
+{
+    SDL_TextureBatchInstance *instances;
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, false);
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!dstrects) {
+        return SDL_InvalidParamError("dstrects");
+    }
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    if (count == 0) {
+        return true;
+    }
+
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (renderer->hidden) {
+        return true;
+    }
+#endif
+
+    /* Renderers with their own copy implementation (e.g. software) draw sprites
+       one at a time, so the batch looks exactly like individual draws there. */
+    if (!renderer->QueueTextureBatch && (renderer->QueueCopyEx || !renderer->QueueGeometry)) {
+        return RenderTextureBatchRotated(renderer, texture, srcrects, dstrects, angles, colors, count);
+    }
+
+    const SDL_FColor texture_color = texture->color;
+    const float texture_w = (float)texture->w;
+    const float texture_h = (float)texture->h;
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    texture->last_command_generation = renderer->render_command_generation;
+
+    const SDL_RenderViewState *view = renderer->view;
+    const float scale_x = view->current_scale.x;
+    const float scale_y = view->current_scale.y;
+
+    instances = (SDL_TextureBatchInstance *)GetTextureBatchData(renderer, count * sizeof(*instances));
+    if (!instances) {
+        return false;
+    }
+
+    for (i = 0; i < count; ++i) {
+        SDL_TextureBatchInstance *instance = &instances[i];
+        const SDL_FRect *dstrect = &dstrects[i];
+
+        if (srcrects) {
+            const SDL_FRect *srcrect = &srcrects[i];
+            instance->minu = srcrect->x / texture_w;
+            instance->minv = srcrect->y / texture_h;
+            instance->maxu = (srcrect->x + srcrect->w) / texture_w;
+            instance->maxv = (srcrect->y + srcrect->h) / texture_h;
+        } else {
+            instance->minu = 0.0f;
+            instance->minv = 0.0f;
+            instance->maxu = 1.0f;
+            instance->maxv = 1.0f;
+        }
+
+        if (angles && (int)(angles[i] / 360) != angles[i] / 360) {
+            /* rotate the edges around the center with the 2x2 matrix ( c -s )
+             *                                                        ( s  c ) */
+            const float radian_angle = (float)((SDL_PI_D * angles[i]) / 180.0);
+            const float s = SDL_sinf(radian_angle);
+            const float c = SDL_cosf(radian_angle);
+            const float half_w = dstrect->w / 2.0f;
+            const float half_h = dstrect->h / 2.0f;
+
+            instance->axis_x.x = c * dstrect->w;
+            instance->axis_x.y = s * dstrect->w;
+            instance->axis_y.x = -s * dstrect->h;
+            instance->axis_y.y = c * dstrect->h;
+            instance->origin.x = dstrect->x + half_w - c * half_w + s * half_h;
+            instance->origin.y = dstrect->y + half_h - s * half_w - c * half_h;
+        } else {
+            instance->origin.x = dstrect->x;
+            instance->origin.y = dstrect->y;
+            instance->axis_x.x = dstrect->w;
+            instance->axis_x.y = 0.0f;
+            instance->axis_y.x = 0.0f;
+            instance->axis_y.y = dstrect->h;
+        }
+
+        if (colors) {
+            instance->color.r = texture_color.r * colors[i].r;
+            instance->color.g = texture_color.g * colors[i].g;
+            instance->color.b = texture_color.b * colors[i].b;
+            instance->color.a = texture_color.a * colors[i].a;
+        } else {
+            instance->color = texture_color;
+        }
+    }
+
+    if (renderer->QueueTextureBatch) {
+        return QueueCmdTextureBatch(renderer, texture, instances, count, scale_x, scale_y);
+    }
+    return QueueTextureBatchGeometry(renderer, texture, instances, count, scale_x, scale_y);
+}
+
 bool SDL_RenderTextureRotated(SDL_Renderer *renderer, SDL_Texture *texture,
                               const SDL_FRect *srcrect, const SDL_FRect *dstrect,
                               const double angle, const SDL_FPoint *center, const SDL_FlipMode flip)
@@ -4433,7 +6003,7 @@ bool SDL_RenderTextureTiled(SDL_Renderer *renderer, SDL_Texture *texture, const
     texture->last_command_generation = renderer->render_command_generation;
 
     // See if we can use geometry with repeating texture coordinates
-    if (!renderer->software &&
+    if (!renderer->software && !texture->atlas_page &&
         (!srcrect ||
          (real_srcrect.x == 0.0f && real_srcrect.y == 0.0f &&
           real_srcrect.w == (float)texture->w && real_srcrect.h == (float)texture->h))) {
@@ -5207,6 +6777,10 @@ bool SDL_RenderGeometryRaw(SDL_Renderer *renderer,
             texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
         }
     }
+    if (texture && texture->atlas_page &&
+        (texture_address_mode_u == SDL_TEXTURE_ADDRESS_WRAP || texture_address_mode_v == SDL_TEXTURE_ADDRESS_WRAP)) {
+        return SDL_SetError("Textures in an atlas can't use SDL_TEXTURE_ADDRESS_WRAP");
+    }
 
     if (indices) {
         for (i = 0; i < num_indices; ++i) {
@@ -5276,8 +6850,58 @@ bool SDL_GetRenderTextureAddressMode(SDL_Renderer *renderer, SDL_TextureAddressM
     return true;
 }
 
+static bool GetReadPixelsRect(SDL_Renderer *renderer, const SDL_Rect *rect, SDL_Rect *real_rect)
+{
+    *real_rect = renderer->view->pixel_viewport;
+
+    if (rect) {
+        if (!SDL_GetRectIntersection(rect, real_rect, real_rect)) {
+            return SDL_SetError("Can't read outside the current viewport");
+        }
+    }
+    return true;
+}
+
+// Get the state of the current render target that read pixels are tagged with
+static void GetReadPixelsTargetState(SDL_Renderer *renderer, SDL_PixelFormat *expected_format, float *SDR_white_point, float *HDR_headroom)
+{
+    if (renderer->target) {
+        SDL_Texture *target = renderer->target;
+        SDL_Texture *parent = SDL_GetPointerProperty(SDL_GetTextureProperties(target), SDL_PROP_TEXTURE_PARENT_POINTER, NULL);
+
+        *expected_format = (parent ? parent->format : target->format);
+        *SDR_white_point = target->SDR_white_point;
+        *HDR_headroom = target->HDR_headroom;
+    } else {
+        *expected_format = SDL_PIXELFORMAT_UNKNOWN;
+        *SDR_white_point = renderer->SDR_white_point;
+        *HDR_headroom = renderer->HDR_headroom;
+    }
+}
+
+static void SetReadPixelsSurfaceState(SDL_Surface *surface, SDL_PixelFormat expected_format, float SDR_white_point, float HDR_headroom)
+{
+    SDL_PropertiesID props = SDL_GetSurfaceProperties(surface);
+
+    SDL_SetFloatProperty(props, SDL_PROP_SURFACE_SDR_WHITE_POINT_FLOAT, SDR_white_point);
+    SDL_SetFloatProperty(props, SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT, HDR_headroom);
+
+    // Set the expected surface format
+    if ((surface->format == SDL_PIXELFORMAT_ARGB8888 && expected_format == SDL_PIXELFORMAT_XRGB8888) ||
+        (surface->format == SDL_PIXELFORMAT_RGBA8888 && expected_format == SDL_PIXELFORMAT_RGBX8888) ||
+        (surface->format == SDL_PIXELFORMAT_ABGR8888 && expected_format == SDL_PIXELFORMAT_XBGR8888) ||
+        (surface->format == SDL_PIXELFORMAT_BGRA8888 && expected_format == SDL_PIXELFORMAT_BGRX8888)) {
+        surface->format = expected_format;
+        surface->fmt = SDL_GetPixelFormatDetails(expected_format);
+    }
+}
+
 SDL_Surface *SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
 {
+    SDL_PixelFormat expected_format;
+    float SDR_white_point, HDR_headroom;
+    SDL_Rect real_rect;
+
     CHECK_RENDERER_MAGIC(renderer, NULL);
 
     if (!renderer->RenderReadPixels) {
@@ -5287,41 +6911,350 @@ SDL_Surface *SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
 
     FlushRenderCommands(renderer); // we need to render before we read the results.
 
-    SDL_Rect real_rect = renderer->view->pixel_viewport;
+    if (!GetReadPixelsRect(renderer, rect, &real_rect)) {
+        return NULL;
+    }
 
-    if (rect) {
-        if (!SDL_GetRectIntersection(rect, &real_rect, &real_rect)) {
-            SDL_SetError("Can't read outside the current viewport");
-            return NULL;
+    SDL_Surface *surface = renderer->RenderReadPixels(renderer, &real_rect);
+    if (surface) {
+        GetReadPixelsTargetState(renderer, &expected_format, &SDR_white_point, &HDR_headroom);
+        SetReadPixelsSurfaceState(surface, expected_format, SDR_white_point, HDR_headroom);
+    }
+    return surface;
+}
+
+SDL_RenderReadback *SDL_RenderReadPixelsAsync(SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    SDL_RenderReadback *readback;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!renderer->RenderReadPixels) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    FlushRenderCommands(renderer); // we need to render before we read the results.
+
+    readback = (SDL_RenderReadback *)SDL_calloc(1, sizeof(*readback));
+    if (!readback) {
+        return NULL;
+    }
+
+    if (!GetReadPixelsRect(renderer, rect, &readback->rect)) {
+        SDL_free(readback);
+        return NULL;
+    }
+    GetReadPixelsTargetState(renderer, &readback->expected_format, &readback->SDR_white_point, &readback->HDR_headroom);
+
+    if (renderer->QueueReadPixels) {
+        if (!renderer->QueueReadPixels(renderer, readback)) {
+            SDL_free(readback);
+            return NULL;
+        }
+    } else {
+        // Fall back to reading the pixels right away
+        readback->surface = renderer->RenderReadPixels(renderer, &readback->rect);
+        if (!readback->surface) {
+            SDL_free(readback);
+            return NULL;
         }
     }
 
-    SDL_Surface *surface = renderer->RenderReadPixels(renderer, &real_rect);
+    readback->renderer = renderer;
+    readback->next = renderer->readbacks;
+    if (renderer->readbacks) {
+        renderer->readbacks->prev = readback;
+    }
+    renderer->readbacks = readback;
+
+    return readback;
+}
+
+bool SDL_IsRenderReadbackReady(SDL_RenderReadback *readback)
+{
+    SDL_Renderer *renderer;
+
+    if (!readback) {
+        return SDL_InvalidParamError("readback");
+    }
+
+    renderer = readback->renderer;
+    if (readback->surface || !renderer) {
+        // Collecting it won't wait, even if it fails
+        return true;
+    }
+    return renderer->IsReadPixelsReady(renderer, readback);
+}
+
+static void FreeRenderReadback(SDL_RenderReadback *readback)
+{
+    SDL_Renderer *renderer = readback->renderer;
+
+    if (renderer) {
+        if (readback->internal) {
+            renderer->DestroyReadPixels(renderer, readback);
+        }
+        if (readback->prev) {
+            readback->prev->next = readback->next;
+        } else {
+            renderer->readbacks = readback->next;
+        }
+        if (readback->next) {
+            readback->next->prev = readback->prev;
+        }
+    }
+    SDL_DestroySurface(readback->surface);
+    SDL_free(readback);
+}
+
+SDL_Surface *SDL_CollectRenderReadback(SDL_RenderReadback *readback)
+{
+    SDL_Renderer *renderer;
+    SDL_Surface *surface;
+
+    if (!readback) {
+        SDL_InvalidParamError("readback");
+        return NULL;
+    }
+
+    renderer = readback->renderer;
+    if (!renderer) {
+        SDL_SetError("The renderer was destroyed before the pixels were collected");
+        FreeRenderReadback(readback);
+        return NULL;
+    }
+
+    if (readback->surface) {
+        surface = readback->surface;
+        readback->surface = NULL;
+    } else {
+        surface = renderer->CollectReadPixels(renderer, readback);
+    }
     if (surface) {
-        SDL_PropertiesID props = SDL_GetSurfaceProperties(surface);
-
-        if (renderer->target) {
-            SDL_Texture *target = renderer->target;
-            SDL_Texture *parent = SDL_GetPointerProperty(SDL_GetTextureProperties(target), SDL_PROP_TEXTURE_PARENT_POINTER, NULL);
-            SDL_PixelFormat expected_format = (parent ? parent->format : target->format);
-
-            SDL_SetFloatProperty(props, SDL_PROP_SURFACE_SDR_WHITE_POINT_FLOAT, target->SDR_white_point);
-            SDL_SetFloatProperty(props, SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT, target->HDR_headroom);
-
-            // Set the expected surface format
-            if ((surface->format == SDL_PIXELFORMAT_ARGB8888 && expected_format == SDL_PIXELFORMAT_XRGB8888) ||
-                (surface->format == SDL_PIXELFORMAT_RGBA8888 && expected_format == SDL_PIXELFORMAT_RGBX8888) ||
-                (surface->format == SDL_PIXELFORMAT_ABGR8888 && expected_format == SDL_PIXELFORMAT_XBGR8888) ||
-                (surface->format == SDL_PIXELFORMAT_BGRA8888 && expected_format == SDL_PIXELFORMAT_BGRX8888)) {
-                surface->format = expected_format;
-                surface->fmt = SDL_GetPixelFormatDetails(expected_format);
+        SetReadPixelsSurfaceState(surface, readback->expected_format, readback->SDR_white_point, readback->HDR_headroom);
+    }
+    FreeRenderReadback(readback);
+
+    return surface;
+}
+
+void SDL_CancelRenderReadback(SDL_RenderReadback *readback)
+{
+    if (readback) {
+        FreeRenderReadback(readback);
+    }
+}
+
+SDL_RenderList *SDL_CreateRenderList(SDL_Renderer *renderer)
+{
+    SDL_RenderList *list;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    list = (SDL_RenderList *)SDL_calloc(1, sizeof(*list));
+    if (!list) {
+        return NULL;
+    }
+    list->renderer = renderer;
+    list->next = renderer->render_lists;
+    if (renderer->render_lists) {
+        renderer->render_lists->prev = list;
+    }
+    renderer->render_lists = list;
+    return list;
+}
+
+static void ClearRenderList(SDL_RenderList *list)
+{
+    list->num_commands = 0;
+    list->vertex_size = 0;
+    list->num_textures = 0;
+}
+
+// Empty the render lists that draw from a texture that is going away
+static void ForgetRenderListTexture(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    SDL_RenderList *list;
+    int i;
+
+    for (list = renderer->render_lists; list; list = list->next) {
+        for (i = 0; i < list->num_textures; ++i) {
+            if (list->textures[i] == texture) {
+                ClearRenderList(list);
+                break;
+            }
+        }
+    }
+}
+
+static void ForgetRenderListGPURenderState(SDL_Renderer *renderer, SDL_GPURenderState *state)
+{
+    SDL_RenderList *list;
+    int i;
+
+    for (list = renderer->render_lists; list; list = list->next) {
+        for (i = 0; i < list->num_commands; ++i) {
+            const SDL_RenderCommandType command = list->commands[i].command;
+            if (command >= SDL_RENDERCMD_DRAW_POINTS && list->commands[i].data.draw.gpu_render_state == state) {
+                ClearRenderList(list);
+                break;
+            }
+        }
+    }
+}
+
+static SDL_Renderer *GetRenderListRenderer(SDL_RenderList *list)
+{
+    SDL_Renderer *renderer;
+
+    if (!list) {
+        SDL_InvalidParamError("list");
+        return NULL;
+    }
+
+    renderer = list->renderer;
+    if (!renderer) {
+        SDL_SetError("The renderer for this list has been destroyed");
+        return NULL;
+    }
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+    return renderer;
+}
+
+bool SDL_BeginRenderList(SDL_RenderList *list)
+{
+    SDL_Renderer *renderer = GetRenderListRenderer(list);
+    if (!renderer) {
+        return false;
+    }
+
+    if (renderer->recording_list) {
+        return SDL_SetError("A render list is already being recorded");
+    }
+
+    // Anything queued so far is drawn now, and the list starts with its own state
+    if (!FlushRenderCommands(renderer)) {
+        return false;
+    }
+
+    ClearRenderList(list);
+    renderer->recording_list = list;
+    return true;
+}
+
+bool SDL_EndRenderList(SDL_RenderList *list)
+{
+    SDL_Renderer *renderer = GetRenderListRenderer(list);
+    bool result;
+
+    if (!renderer) {
+        return false;
+    }
+
+    if (renderer->recording_list != list) {
+        return SDL_SetError("This render list isn't being recorded");
+    }
+
+    result = CaptureRenderCommands(renderer);
+    renderer->recording_list = NULL;
+    if (!result) {
+        ClearRenderList(list);
+    }
+    return result;
+}
+
+bool SDL_ReplayRenderList(SDL_RenderList *list, float x, float y)
+{
+    SDL_Renderer *renderer = GetRenderListRenderer(list);
+    size_t offset = 0;
+    int dx, dy;
+    int i;
+
+    if (!renderer) {
+        return false;
+    }
+
+    if (renderer->recording_list == list) {
+        return SDL_SetError("Can't replay a render list while it's being recorded");
+    }
+
+    if (list->num_commands == 0) {
+        return true;
+    }
+
+    for (i = 0; i < list->num_textures; ++i) {
+        SDL_Texture *texture = list->textures[i];
+        if (texture->evicted && !RestoreEvictedTexture(texture)) {
+            return false;
+        }
+        texture->last_command_generation = renderer->render_command_generation;
+    }
+
+    if (list->vertex_size > 0) {
+        void *vertices = SDL_AllocateRenderVertices(renderer, list->vertex_size, SDL_RENDER_LIST_VERTEX_ALIGNMENT, &offset);
+        if (!vertices) {
+            return false;
+        }
+        SDL_memcpy(vertices, list->vertices, list->vertex_size);
+    }
+
+    dx = (int)SDL_roundf(x * renderer->view->current_scale.x);
+    dy = (int)SDL_roundf(y * renderer->view->current_scale.y);
+
+    for (i = 0; i < list->num_commands; ++i) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (!cmd) {
+            return false;
+        }
+        SDL_copyp(cmd, &list->commands[i]);
+        RebaseRenderCommand(cmd, offset, dx, dy);
+
+        if (cmd->command >= SDL_RENDERCMD_DRAW_POINTS) {
+            if (cmd->data.draw.texture) {
+                cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+            }
+            if (cmd->data.draw.gpu_render_state) {
+                cmd->data.draw.gpu_render_state->last_command_generation = renderer->render_command_generation;
             }
+        }
+    }
+
+    // The list changed the backend state, so the next draw has to set its own
+    renderer->color_queued = false;
+    renderer->viewport_queued = false;
+    renderer->cliprect_queued = false;
+    return true;
+}
+
+void SDL_DestroyRenderList(SDL_RenderList *list)
+{
+    SDL_Renderer *renderer;
+
+    if (!list) {
+        return;
+    }
+
+    renderer = list->renderer;
+    if (renderer) {
+        if (renderer->recording_list == list) {
+            ResetRenderCommands(renderer);
+            renderer->recording_list = NULL;
+        }
+        if (list->prev) {
+            list->prev->next = list->next;
         } else {
-            SDL_SetFloatProperty(props, SDL_PROP_SURFACE_SDR_WHITE_POINT_FLOAT, renderer->SDR_white_point);
-            SDL_SetFloatProperty(props, SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT, renderer->HDR_headroom);
+            renderer->render_lists = list->next;
+        }
+        if (list->next) {
+            list->next->prev = list->prev;
         }
     }
-    return surface;
+
+    SDL_free(list->commands);
+    SDL_free(list->vertices);
+    SDL_free(list->textures);
+    SDL_free(list);
 }
 
 static void SDL_RenderApplyWindowShape(SDL_Renderer *renderer)
@@ -5377,17 +7310,50 @@ static void SDL_SimulateRenderVSync(SDL_Renderer *renderer)
     }
 }
 
+bool SDL_SetRenderTextureMemoryBudget(SDL_Renderer *renderer, Uint64 bytes)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    renderer->texture_memory_budget = bytes;
+    if (bytes) {
+        EvictTextures(renderer, bytes, NULL);
+    }
+    return true;
+}
+
+bool SDL_GetRenderStats(SDL_Renderer *renderer, SDL_RenderStats *stats)
+{
+    if (stats) {
+        SDL_zerop(stats);
+    }
+
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_copyp(stats, &renderer->last_stats);
+    return true;
+}
+
 bool SDL_RenderPresent(SDL_Renderer *renderer)
 {
     bool presented = true;
+    bool throttled = false;
+    Uint64 start = 0;
 
     CHECK_RENDERER_MAGIC(renderer, false);
 
-    if (renderer->target) {
+    if (renderer->target && renderer->target != renderer->dynamic_target) {
         return SDL_SetError("You can't present on a render target");
     }
 
-    SDL_RenderLogicalPresentation(renderer);
+    if (IsDrawingDynamicResolutionScene(renderer)) {
+        UpscaleDynamicResolutionScene(renderer);
+    } else {
+        SDL_RenderLogicalPresentation(renderer);
+    }
 
     if (renderer->transparent_window) {
         SDL_RenderApplyWindowShape(renderer);
@@ -5395,29 +7361,114 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
 
+    if (renderer->gpu_timing) {
+        start = SDL_GetTicksNS();
+    }
+
+    SDL_TRACE_ZONE_BEGIN(zone, "RenderPresent");
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
     if (renderer->hidden) {
         presented = false;
     } else
 #endif
-        if (!renderer->RenderPresent(renderer)) {
+    if (renderer->throttle_occluded && (renderer->hidden || renderer->occluded)) {
         presented = false;
+        throttled = true;
+    } else if (!renderer->RenderPresent(renderer)) {
+        presented = false;
+    } else if (renderer->present_occluded) {
+        // The backend skipped the present because the swap chain is occluded
+        presented = false;
+        throttled = true;
+    }
+    SDL_TRACE_ZONE_END(zone);
+
+    if (renderer->output_resized) {
+        // The backend resized its output after the present, the next frame is drawn at the new size
+        renderer->output_resized = false;
+        UpdateMainViewForOutputSize(renderer);
+    }
+
+    if (renderer->gpu_timing) {
+        renderer->stats.cpu_time_ns += SDL_GetTicksNS() - start;
+    }
+
+    // The present regions only apply to a single frame
+    renderer->num_dirty_rects = 0;
+    renderer->scroll_rect_enabled = false;
+
+    renderer->stats.gpu_time_ns = renderer->gpu_time_ns;
+    renderer->stats.throttled = throttled;
+    renderer->stats.resolution_scale = renderer->dynamic_target ? renderer->dynamic_scale : 1.0f;
+    renderer->stats.texture_memory = renderer->texture_memory;
+    renderer->last_stats = renderer->stats;
+    SDL_zero(renderer->stats);
+
+    if (renderer->dynamic_target) {
+        UpdateDynamicResolutionScale(renderer);
+        BeginDynamicResolutionScene(renderer);
     }
 
     if (renderer->simulate_vsync ||
-        (!presented && renderer->wanted_vsync)) {
+        (!presented && (renderer->wanted_vsync || throttled))) {
         SDL_SimulateRenderVSync(renderer);
     }
     return true;
 }
 
+bool SDL_SetRenderDirtyRects(SDL_Renderer *renderer, const SDL_Rect *rects, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    if (count > 0 && !rects) {
+        return SDL_InvalidParamError("rects");
+    }
+
+    if (count > renderer->max_dirty_rects) {
+        SDL_Rect *dirty_rects = (SDL_Rect *)SDL_realloc(renderer->dirty_rects, count * sizeof(*dirty_rects));
+        if (!dirty_rects) {
+            return false;
+        }
+        renderer->dirty_rects = dirty_rects;
+        renderer->max_dirty_rects = count;
+    }
+    if (count > 0) {
+        SDL_memcpy(renderer->dirty_rects, rects, count * sizeof(*rects));
+    }
+    renderer->num_dirty_rects = count;
+    return true;
+}
+
+bool SDL_SetRenderScrollRect(SDL_Renderer *renderer, const SDL_Rect *rect, const SDL_Point *offset)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (!rect) {
+        renderer->scroll_rect_enabled = false;
+        return true;
+    }
+    if (!offset) {
+        return SDL_InvalidParamError("offset");
+    }
+
+    renderer->scroll_rect = *rect;
+    renderer->scroll_offset = *offset;
+    renderer->scroll_rect_enabled = true;
+    return true;
+}
+
 static void SDL_DestroyTextureInternal(SDL_Texture *texture, bool is_destroying)
 {
     SDL_Renderer *renderer;
 
     SDL_DestroyProperties(texture->props);
 
+    CancelPendingTextureUpdates(texture);
+
     renderer = texture->renderer;
     if (is_destroying) {
         // Renderer get destroyed, avoid to queue more commands
@@ -5428,6 +7479,7 @@ static void SDL_DestroyTextureInternal(SDL_Texture *texture, bool is_destroying)
             FlushRenderCommandsIfTextureNeeded(texture);
         }
     }
+    ForgetRenderListTexture(renderer, texture);
 
     SDL_SetObjectValid(texture, SDL_OBJECT_TYPE_TEXTURE, false);
 
@@ -5450,8 +7502,15 @@ static void SDL_DestroyTextureInternal(SDL_Texture *texture, bool is_destroying)
 #endif
     SDL_free(texture->pixels);
 
-    renderer->DestroyTexture(renderer, texture);
+    if (texture->atlas_page) {
+        ReleaseTextureAtlasPage(renderer, texture->atlas_page, is_destroying);
+        texture->atlas_page = NULL;
+    } else if (!texture->evicted) {
+        renderer->texture_memory -= texture->memory_size;
+        renderer->DestroyTexture(renderer, texture);
+    }
 
+    SDL_DestroySurface(texture->backing_surface);
     SDL_DestroySurface(texture->locked_surface);
     texture->locked_surface = NULL;
 
@@ -5471,25 +7530,12 @@ void SDL_DestroyTexture(SDL_Texture *texture)
 
 static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *cmd;
-
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        cmd = renderer->render_commands;
-    } else {
-        cmd = renderer->render_commands_pool;
-    }
-
-    renderer->render_commands_pool = NULL;
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
     renderer->vertex_data_used = 0;
 
-    while (cmd) {
-        SDL_RenderCommand *next = cmd->next;
-        SDL_free(cmd);
-        cmd = next;
-    }
+    SDL_DestroyArena(renderer->render_commands_arena);
+    renderer->render_commands_arena = NULL;
 }
 
 void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
@@ -5515,11 +7561,40 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
     }
     SDL_DiscardAllCommands(renderer);
 
+    // Render lists stay valid, but can't be replayed anymore
+    renderer->recording_list = NULL;
+    while (renderer->render_lists) {
+        SDL_RenderList *list = renderer->render_lists;
+        ClearRenderList(list);
+        list->renderer = NULL;
+        list->prev = NULL;
+        renderer->render_lists = list->next;
+        list->next = NULL;
+    }
+
+    // Destroyed with the other textures below
+    renderer->dynamic_target = NULL;
+
     if (renderer->debug_char_texture_atlas) {
         SDL_DestroyTexture(renderer->debug_char_texture_atlas);
         renderer->debug_char_texture_atlas = NULL;
     }
 
+    // Outstanding readbacks stay valid, but can't be collected anymore
+    while (renderer->readbacks) {
+        SDL_RenderReadback *readback = renderer->readbacks;
+        if (readback->internal) {
+            renderer->DestroyReadPixels(renderer, readback);
+            readback->internal = NULL;
+        }
+        SDL_DestroySurface(readback->surface);
+        readback->surface = NULL;
+        readback->renderer = NULL;
+        readback->prev = NULL;
+        renderer->readbacks = readback->next;
+        readback->next = NULL;
+    }
+
     // Free existing textures for this renderer
     while (renderer->textures) {
         SDL_Texture *tex = renderer->textures;
@@ -5536,9 +7611,27 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_DestroyMutex(renderer->target_mutex);
         renderer->target_mutex = NULL;
     }
+    if (renderer->texture_updates_lock) {
+        SDL_DestroyMutex(renderer->texture_updates_lock);
+        renderer->texture_updates_lock = NULL;
+    }
     if (renderer->vertex_data) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_RENDER, renderer->vertex_data_allocation);
         SDL_free(renderer->vertex_data);
         renderer->vertex_data = NULL;
+        renderer->vertex_data_allocation = 0;
+    }
+    if (renderer->batch_data) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_RENDER, renderer->batch_data_allocation);
+        SDL_free(renderer->batch_data);
+        renderer->batch_data = NULL;
+        renderer->batch_data_allocation = 0;
+    }
+    if (renderer->dirty_rects) {
+        SDL_free(renderer->dirty_rects);
+        renderer->dirty_rects = NULL;
+        renderer->num_dirty_rects = 0;
+        renderer->max_dirty_rects = 0;
     }
     if (renderer->texture_formats) {
         SDL_free(renderer->texture_formats);
@@ -5613,6 +7706,97 @@ bool SDL_AddVulkanRenderSemaphores(SDL_Renderer *renderer, Uint32 wait_stage_mas
     return renderer->AddVulkanRenderSemaphores(renderer, wait_stage_mask, wait_semaphore, signal_semaphore);
 }
 
+bool SDL_ShareTextureWithGL(SDL_Texture *texture, Uint32 *gl_texture)
+{
+    SDL_Renderer *renderer;
+
+    if (gl_texture) {
+        *gl_texture = 0;
+    }
+
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    if (!gl_texture) {
+        return SDL_InvalidParamError("gl_texture");
+    }
+
+    if (texture->atlas_page) {
+        return SDL_SetError("Textures in an atlas can't be shared with OpenGL");
+    }
+    if (texture->native) {
+        texture = texture->native;
+    }
+    renderer = texture->renderer;
+    if (!renderer->ShareTextureWithGL) {
+        return SDL_Unsupported();
+    }
+
+    // OpenGL keeps using the texture, so it can't be evicted anymore
+    if (texture->evicted && !RestoreEvictedTexture(texture)) {
+        return false;
+    }
+    texture->evictable = false;
+
+    return renderer->ShareTextureWithGL(renderer, texture, gl_texture);
+}
+
+bool SDL_AcquireTextureForGL(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer;
+
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    if (texture->atlas_page) {
+        return SDL_SetError("Textures in an atlas can't be shared with OpenGL");
+    }
+    if (texture->native) {
+        texture = texture->native;
+    }
+    renderer = texture->renderer;
+    if (!renderer->AcquireTextureForGL) {
+        return SDL_Unsupported();
+    }
+    FlushRenderCommandsIfTextureNeeded(texture);
+    return renderer->AcquireTextureForGL(renderer, texture);
+}
+
+bool SDL_ReleaseTextureForGL(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer;
+
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    if (texture->atlas_page) {
+        return SDL_SetError("Textures in an atlas can't be shared with OpenGL");
+    }
+    if (texture->native) {
+        texture = texture->native;
+    }
+    renderer = texture->renderer;
+    if (!renderer->ReleaseTextureForGL) {
+        return SDL_Unsupported();
+    }
+    return renderer->ReleaseTextureForGL(renderer, texture);
+}
+
+void SDL_UnshareTextureWithGL(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer;
+
+    CHECK_TEXTURE_MAGIC(texture, );
+
+    if (texture->atlas_page) {
+        return;
+    }
+    if (texture->native) {
+        texture = texture->native;
+    }
+    renderer = texture->renderer;
+    if (renderer->UnshareTextureWithGL) {
+        renderer->UnshareTextureWithGL(renderer, texture);
+    }
+}
+
 static SDL_BlendMode SDL_GetShortBlendMode(SDL_BlendMode blendMode)
 {
     if (blendMode == SDL_BLENDMODE_NONE_FULL) {
@@ -5765,6 +7949,17 @@ bool SDL_GetRenderVSync(SDL_Renderer *renderer, int *vsync)
     return true;
 }
 
+bool SDL_WaitForRenderPresent(SDL_Renderer *renderer, Sint32 timeoutMS)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (!renderer->WaitPresent) {
+        // This renderer throttles inside SDL_RenderPresent(), nothing to wait for
+        return true;
+    }
+    return renderer->WaitPresent(renderer, timeoutMS);
+}
+
 #define SDL_DEBUG_FONT_GLYPHS_PER_ROW 14
 
 static bool CreateDebugTextAtlas(SDL_Renderer *renderer)
@@ -6059,6 +8254,9 @@ void SDL_DestroyGPURenderState(SDL_GPURenderState *state)
     }
 
     FlushRenderCommandsIfGPURenderStateNeeded(state);
+    if (state->renderer) {
+        ForgetRenderListGPURenderState(state->renderer, state);
+    }
 
     if (state->num_uniform_buffers > 0) {
         for (int i = 0; i < state->num_uniform_buffers; i++) {
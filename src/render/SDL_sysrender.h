@@ -70,6 +70,56 @@ typedef struct SDL_RenderViewState
     SDL_FPoint current_scale; // this is just `scale * logical_scale`, precalculated, since we use it a lot.
 } SDL_RenderViewState;
 
+// A texture update scheduled with SDL_UpdateTextureAsync()
+typedef struct SDL_PendingTextureUpdate
+{
+    SDL_Texture *texture;
+    SDL_Rect rect;
+    bool full_texture;
+    const void *pixels;
+    int pitch;
+    SDL_TextureUpdateCompleteCallback callback;
+    void *userdata;
+    struct SDL_PendingTextureUpdate *next;
+} SDL_PendingTextureUpdate;
+
+// A pixel readback started with SDL_RenderReadPixelsAsync()
+struct SDL_RenderReadback
+{
+    SDL_Renderer *renderer; // NULL once the renderer has been destroyed
+    SDL_Rect rect;
+
+    // The state of the render target when the pixels were requested
+    SDL_PixelFormat expected_format;
+    float SDR_white_point;
+    float HDR_headroom;
+
+    SDL_Surface *surface; // The pixels, if they were read synchronously
+    void *internal;
+
+    struct SDL_RenderReadback *prev;
+    struct SDL_RenderReadback *next;
+};
+
+// A horizontal strip of an atlas page that textures of similar height are packed into
+typedef struct SDL_TextureAtlasShelf
+{
+    int y;
+    int h;
+    int used_w;
+} SDL_TextureAtlasShelf;
+
+// A shared texture that small static textures are packed into
+typedef struct SDL_TextureAtlasPage
+{
+    SDL_Texture *texture;
+    SDL_TextureAtlasShelf *shelves;
+    int num_shelves;
+    int used_h;
+    int num_textures;
+    struct SDL_TextureAtlasPage *next;
+} SDL_TextureAtlasPage;
+
 // Define the SDL texture structure
 struct SDL_Texture
 {
@@ -100,8 +150,20 @@ struct SDL_Texture
     SDL_Rect locked_rect;
     SDL_Surface *locked_surface; // Locked region exposed as a SDL surface
 
+    // Support for textures packed into a shared atlas page
+    SDL_TextureAtlasPage *atlas_page;
+    SDL_Rect atlas_rect;
+
     Uint32 last_command_generation; // last command queue generation this texture was in.
 
+    // Support for evicting textures when the renderer is over its texture memory budget
+    Uint64 memory_size; // The estimated size of the renderer's copy of the texture
+    bool evictable;
+    bool evicted;
+    SDL_Surface *backing_surface;
+    SDL_TextureRestoreCallback restore_callback;
+    void *restore_userdata;
+
     SDL_PropertiesID props;
 
     void *internal; // Driver specific texture representation
@@ -152,7 +214,9 @@ typedef enum
     SDL_RENDERCMD_FILL_RECTS,
     SDL_RENDERCMD_COPY,
     SDL_RENDERCMD_COPY_EX,
-    SDL_RENDERCMD_GEOMETRY
+    SDL_RENDERCMD_GEOMETRY,
+    SDL_RENDERCMD_TEXTURE_BATCH,
+    SDL_RENDERCMD_LINE_BATCH
 } SDL_RenderCommandType;
 
 typedef struct SDL_RenderCommand
@@ -182,6 +246,8 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            size_t vertex_size;
+            SDL_FRect bounds;
         } draw;
         struct
         {
@@ -193,6 +259,50 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+// Draws recorded with SDL_BeginRenderList(), in the form the backend queued them
+struct SDL_RenderList
+{
+    SDL_Renderer *renderer; // NULL once the renderer has been destroyed
+
+    SDL_RenderCommand *commands;
+    int num_commands;
+    int max_commands;
+    Uint8 *vertices;
+    size_t vertex_size;
+    size_t vertex_allocation;
+
+    // Every texture the commands draw from, including the ones packed into atlas pages
+    SDL_Texture **textures;
+    int num_textures;
+    int max_textures;
+
+    struct SDL_RenderList *prev;
+    struct SDL_RenderList *next;
+};
+
+/* One sprite of an SDL_RenderTextureBatch() call, as an affine basis in render
+ * coordinates: corner (x, y) in [0, 1] maps to origin + x * axis_x + y * axis_y,
+ * and to texture coordinates (minu, minv) - (maxu, maxv). */
+typedef struct SDL_TextureBatchInstance
+{
+    SDL_FPoint origin;
+    SDL_FPoint axis_x;
+    SDL_FPoint axis_y;
+    float minu, minv, maxu, maxv;
+    SDL_FColor color;
+} SDL_TextureBatchInstance;
+
+/* One segment of a line batch, in render coordinates. The segment covers the
+ * convex hull of the one pixel squares at both ends, minus the square at the
+ * start unless include_start is nonzero, so the joints of a polyline are only
+ * drawn once. A point is a segment of zero length that includes its start. */
+typedef struct SDL_LineBatchInstance
+{
+    SDL_FPoint start;
+    SDL_FPoint end;
+    float include_start;
+} SDL_LineBatchInstance;
+
 typedef struct SDL_VertexSolid
 {
     SDL_FPoint position;
@@ -211,6 +321,7 @@ struct SDL_Renderer
 {
     void (*WindowEvent)(SDL_Renderer *renderer, const SDL_WindowEvent *event);
     bool (*GetOutputSize)(SDL_Renderer *renderer, int *w, int *h);
+    bool (*SetOutputSourceSize)(SDL_Renderer *renderer, int w, int h);
     bool (*SupportsBlendMode)(SDL_Renderer *renderer, SDL_BlendMode blendMode);
     bool (*CreateTexture)(SDL_Renderer *renderer, SDL_Texture *texture, SDL_PropertiesID create_props);
     bool (*QueueSetViewport)(SDL_Renderer *renderer, SDL_RenderCommand *cmd);
@@ -230,6 +341,12 @@ struct SDL_Renderer
                           const float *xy, int xy_stride, const SDL_FColor *color, int color_stride, const float *uv, int uv_stride,
                           int num_vertices, const void *indices, int num_indices, int size_indices,
                           float scale_x, float scale_y);
+    bool (*QueueTextureBatch)(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL_Texture *texture,
+                              const SDL_TextureBatchInstance *instances, int count,
+                              float scale_x, float scale_y);
+    bool (*QueueLineBatch)(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                           const SDL_LineBatchInstance *instances, int count,
+                           float scale_x, float scale_y);
 
     void (*InvalidateCachedState)(SDL_Renderer *renderer);
     bool (*RunCommandQueue)(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize);
@@ -252,6 +369,10 @@ struct SDL_Renderer
     void (*UnlockTexture)(SDL_Renderer *renderer, SDL_Texture *texture);
     bool (*SetRenderTarget)(SDL_Renderer *renderer, SDL_Texture *texture);
     SDL_Surface *(*RenderReadPixels)(SDL_Renderer *renderer, const SDL_Rect *rect);
+    bool (*QueueReadPixels)(SDL_Renderer *renderer, SDL_RenderReadback *readback);
+    bool (*IsReadPixelsReady)(SDL_Renderer *renderer, SDL_RenderReadback *readback);
+    SDL_Surface *(*CollectReadPixels)(SDL_Renderer *renderer, SDL_RenderReadback *readback);
+    void (*DestroyReadPixels)(SDL_Renderer *renderer, SDL_RenderReadback *readback);
     bool (*RenderPresent)(SDL_Renderer *renderer);
     void (*DestroyTexture)(SDL_Renderer *renderer, SDL_Texture *texture);
 
@@ -259,11 +380,18 @@ struct SDL_Renderer
 
     bool (*SetVSync)(SDL_Renderer *renderer, int vsync);
 
+    bool (*WaitPresent)(SDL_Renderer *renderer, Sint32 timeoutMS);
+
     void *(*GetMetalLayer)(SDL_Renderer *renderer);
     void *(*GetMetalCommandEncoder)(SDL_Renderer *renderer);
 
     bool (*AddVulkanRenderSemaphores)(SDL_Renderer *renderer, Uint32 wait_stage_mask, Sint64 wait_semaphore, Sint64 signal_semaphore);
 
+    bool (*ShareTextureWithGL)(SDL_Renderer *renderer, SDL_Texture *texture, Uint32 *gl_texture);
+    bool (*AcquireTextureForGL)(SDL_Renderer *renderer, SDL_Texture *texture);
+    bool (*ReleaseTextureForGL)(SDL_Renderer *renderer, SDL_Texture *texture);
+    void (*UnshareTextureWithGL)(SDL_Renderer *renderer, SDL_Texture *texture);
+
     // The current renderer info
     const char *name;
     SDL_PixelFormat *texture_formats;
@@ -273,6 +401,24 @@ struct SDL_Renderer
     // The window associated with the renderer
     SDL_Window *window;
     bool hidden;
+    bool occluded;
+
+    /* Dynamic resolution: while the scene is being drawn, the window target is redirected to
+       dynamic_target and the main view is dynamic_scale times the output size. The scene is
+       upscaled to the output before overlays are drawn or at present. */
+    SDL_Texture *dynamic_target;
+    float dynamic_scale;
+    float dynamic_min_scale;
+    Uint64 dynamic_budget_ns;
+    Uint64 dynamic_last_gpu_time_ns;
+    bool dynamic_upscaled;
+
+    // Whether to skip presents while the window can't be seen, and whether the backend found the swap chain occluded
+    bool throttle_occluded;
+    bool present_occluded;
+
+    // Set by the backend when its output size changed without a window event, e.g. after a deferred swap chain resize
+    bool output_resized;
 
     // Whether we should simulate vsync
     bool wanted_vsync;
@@ -311,7 +457,7 @@ struct SDL_Renderer
 
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
-    SDL_RenderCommand *render_commands_pool;
+    SDL_Arena *render_commands_arena; // render commands and scratch memory, reset when the queue is flushed
     Uint32 render_command_generation;
     SDL_FColor last_queued_color;
     float last_queued_color_scale;
@@ -326,6 +472,49 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    // Reordering of non-overlapping geometry draws before the queue is run
+    bool reorder_draws;
+
+    // Scratch space for SDL_RenderTextureBatch()
+    void *batch_data;
+    size_t batch_data_allocation;
+
+    // Atlas pages shared by textures created with SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN
+    SDL_TextureAtlasPage *atlas_pages;
+
+    // Statistics for the frame being built and the last presented frame
+    SDL_RenderStats stats;
+    SDL_RenderStats last_stats;
+
+    // CPU and GPU frame timing, the backend sets gpu_time_ns whenever it reads back timing results
+    bool gpu_timing;
+    Uint64 gpu_time_ns;
+
+    // Texture updates scheduled from any thread, applied when the command queue is flushed
+    SDL_Mutex *texture_updates_lock;
+    SDL_PendingTextureUpdate *texture_updates;
+    SDL_PendingTextureUpdate *texture_updates_tail;
+
+    // Pixel readbacks that haven't been collected yet
+    SDL_RenderReadback *readbacks;
+
+    // Render lists created for this renderer, and the one draws are being recorded into
+    SDL_RenderList *render_lists;
+    SDL_RenderList *recording_list;
+
+    // The estimated memory used by textures, and the limit set with SDL_SetRenderTextureMemoryBudget()
+    Uint64 texture_memory;
+    Uint64 texture_memory_budget;
+    bool applying_texture_updates;
+
+    // Regions of the backbuffer changed for the next present
+    SDL_Rect *dirty_rects;
+    int num_dirty_rects;
+    int max_dirty_rects;
+    bool scroll_rect_enabled;
+    SDL_Rect scroll_rect;
+    SDL_Point scroll_offset;
+
     // Shaped window support
     bool transparent_window;
     SDL_Surface *shape_surface;
@@ -398,6 +587,12 @@ extern SDL_BlendOperation SDL_GetBlendModeAlphaOperation(SDL_BlendMode blendMode
    the next call, because it might be in an array that gets realloc()'d. */
 extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t alignment, size_t *offset);
 
+/* drivers call this during RunCommandQueue() for each piece of cached state (blend mode, shader,
+   texture) they check, to fill in the statistics returned by SDL_GetRenderStats(). It returns
+   `changed`, so it can wrap the comparison against the cached state. Drivers count draw calls
+   by incrementing renderer->stats.draw_calls directly. */
+extern bool SDL_CountRenderStateChange(SDL_Renderer *renderer, bool changed);
+
 // Let the video subsystem destroy a renderer without making its pointer invalid.
 extern void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer);
 
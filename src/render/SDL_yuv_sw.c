@@ -26,8 +26,12 @@
 
 #include "SDL_yuv_sw_c.h"
 #include "../video/SDL_surface_c.h"
+#include "../video/SDL_surface_threads_c.h"
 #include "../video/SDL_yuv_c.h"
 
+// Scales smaller than this per band aren't worth splitting up
+#define SDL_SW_YUV_MIN_BAND_PIXELS (64 * 1024)
+
 SDL_SW_YUVTexture *SDL_SW_CreateYUVTexture(SDL_PixelFormat format, SDL_Colorspace colorspace, int w, int h)
 {
     SDL_SW_YUVTexture *swdata;
@@ -115,6 +119,8 @@ bool SDL_SW_QueryYUVTexturePixels(SDL_SW_YUVTexture *swdata, void **pixels,
 bool SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
                             const void *pixels, int pitch)
 {
+    swdata->stretch_valid = false;
+
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
@@ -230,6 +236,8 @@ bool SDL_SW_UpdateYUVTexturePlanar(SDL_SW_YUVTexture *swdata, const SDL_Rect *re
     int row;
     size_t length;
 
+    swdata->stretch_valid = false;
+
     // Copy the Y plane
     src = Yplane;
     dst = swdata->pixels + rect->y * swdata->w + rect->x;
@@ -283,6 +291,8 @@ bool SDL_SW_UpdateNVTexturePlanar(SDL_SW_YUVTexture *swdata, const SDL_Rect *rec
     int row;
     size_t length;
 
+    swdata->stretch_valid = false;
+
     // Copy the Y plane
     src = Yplane;
     dst = swdata->pixels + rect->y * swdata->w + rect->x;
@@ -311,6 +321,8 @@ bool SDL_SW_UpdateNVTexturePlanar(SDL_SW_YUVTexture *swdata, const SDL_Rect *rec
 bool SDL_SW_LockYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
                           void **pixels, int *pitch)
 {
+    swdata->stretch_valid = false;
+
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
@@ -337,14 +349,220 @@ void SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture *swdata)
 {
 }
 
+// Gets the plane pointers for the pixel at x, y, which has to be the first pixel sharing its chroma sample
+static void SDL_SW_GetYUVPlanes(const SDL_SW_YUVTexture *swdata, int x, int y,
+                                const Uint8 **Yplane, const Uint8 **Uplane, const Uint8 **Vplane,
+                                Uint32 *Ypitch, Uint32 *UVpitch)
+{
+    switch (swdata->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    {
+        const int u = (swdata->format == SDL_PIXELFORMAT_IYUV) ? 1 : 2;
+        const int v = (swdata->format == SDL_PIXELFORMAT_IYUV) ? 2 : 1;
+        *Yplane = swdata->planes[0] + y * swdata->pitches[0] + x;
+        *Uplane = swdata->planes[u] + (y / 2) * swdata->pitches[u] + x / 2;
+        *Vplane = swdata->planes[v] + (y / 2) * swdata->pitches[v] + x / 2;
+        *Ypitch = swdata->pitches[0];
+        *UVpitch = swdata->pitches[1];
+        break;
+    }
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+    {
+        const Uint8 *p = swdata->planes[0] + y * swdata->pitches[0] + x * 2;
+        if (swdata->format == SDL_PIXELFORMAT_YUY2) {
+            *Yplane = p;
+            *Uplane = p + 1;
+            *Vplane = p + 3;
+        } else if (swdata->format == SDL_PIXELFORMAT_UYVY) {
+            *Yplane = p + 1;
+            *Uplane = p;
+            *Vplane = p + 2;
+        } else {
+            *Yplane = p;
+            *Uplane = p + 3;
+            *Vplane = p + 1;
+        }
+        *Ypitch = swdata->pitches[0];
+        *UVpitch = swdata->pitches[0];
+        break;
+    }
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+    {
+        const Uint8 *uv = swdata->planes[1] + (y / 2) * swdata->pitches[1] + x;
+        *Yplane = swdata->planes[0] + y * swdata->pitches[0] + x;
+        *Uplane = (swdata->format == SDL_PIXELFORMAT_NV12) ? uv : uv + 1;
+        *Vplane = (swdata->format == SDL_PIXELFORMAT_NV12) ? uv + 1 : uv;
+        *Ypitch = swdata->pitches[0];
+        *UVpitch = swdata->pitches[1];
+        break;
+    }
+    default:
+        SDL_assert(!"We should never get here (caught in SDL_SW_CreateYUVTexture)");
+        break;
+    }
+}
+
+/* Converts and nearest-neighbor scales the source rectangle into the destination a pair of source rows at a time,
+   so the frame never goes through an intermediate surface. The mapping matches SDL_StretchSurface().
+ */
+typedef struct SDL_SW_YUVScale
+{
+    const SDL_SW_YUVTexture *swdata;
+    SDL_Rect srcrect;
+    SDL_PixelFormat target_format;
+    int bpp;
+    int w, h;
+    Uint8 *pixels;
+    int pitch;
+    int band_height;
+    Uint8 *rows;      // Two converted rows for each band
+    int rows_x;       // The first column that's converted, on a chroma sample
+    int rows_w;
+    int rows_pitch;
+} SDL_SW_YUVScale;
+
+static void SDLCALL SDL_SW_ScaleYUVBand(void *userdata, int band)
+{
+    const SDL_SW_YUVScale *scale = (const SDL_SW_YUVScale *)userdata;
+    const SDL_SW_YUVTexture *swdata = scale->swdata;
+    const int bpp = scale->bpp;
+    const int dst_y0 = band * scale->band_height;
+    const int dst_y1 = SDL_min(dst_y0 + scale->band_height, scale->h);
+    const Uint64 incy = ((Uint64)scale->srcrect.h << 16) / scale->h;
+    const Uint64 incx = ((Uint64)scale->srcrect.w << 16) / scale->w;
+    Uint8 *rows = scale->rows + (size_t)band * 2 * scale->rows_pitch;
+    Uint8 *dst = scale->pixels + (size_t)dst_y0 * scale->pitch;
+    Uint64 posy = incy / 2 + incy * dst_y0;
+    int first_row = -2; // The first of the two converted rows, none yet
+    int i;
+
+    for (i = dst_y0; i < dst_y1; ++i, dst += scale->pitch) {
+        const int srcy = scale->srcrect.y + (int)(posy >> 16);
+        const Uint8 *src;
+
+        posy += incy;
+
+        if (srcy < first_row || srcy > first_row + 1) {
+            const Uint8 *Yplane, *Uplane, *Vplane;
+            Uint32 Ypitch, UVpitch;
+
+            first_row = srcy & ~1;
+            SDL_SW_GetYUVPlanes(swdata, scale->rows_x, first_row, &Yplane, &Uplane, &Vplane, &Ypitch, &UVpitch);
+            SDL_ConvertYUVPlanesToRGB(scale->rows_w, SDL_min(2, swdata->h - first_row), swdata->format, swdata->colorspace,
+                                      Yplane, Uplane, Vplane, Ypitch, UVpitch,
+                                      scale->target_format, SDL_COLORSPACE_SRGB, rows, scale->rows_pitch);
+        }
+        src = rows + (srcy - first_row) * scale->rows_pitch + (scale->srcrect.x - scale->rows_x) * bpp;
+
+        if (scale->srcrect.w == scale->w) {
+            SDL_memcpy(dst, src, (size_t)scale->w * bpp);
+        } else {
+            Uint64 posx = incx / 2;
+            Uint8 *d = dst;
+            int n = scale->w;
+
+            switch (bpp) {
+            case 4:
+                while (n--) {
+                    *(Uint32 *)d = *(const Uint32 *)(src + (posx >> 16) * 4);
+                    posx += incx;
+                    d += 4;
+                }
+                break;
+            case 2:
+                while (n--) {
+                    *(Uint16 *)d = *(const Uint16 *)(src + (posx >> 16) * 2);
+                    posx += incx;
+                    d += 2;
+                }
+                break;
+            default:
+                while (n--) {
+                    SDL_memcpy(d, src + (posx >> 16) * bpp, bpp);
+                    posx += incx;
+                    d += bpp;
+                }
+                break;
+            }
+        }
+    }
+}
+
+static bool SDL_SW_ScaleYUVToRGB(SDL_SW_YUVTexture *swdata, const SDL_Rect *srcrect, SDL_PixelFormat target_format, int w, int h, void *pixels, int pitch)
+{
+    SDL_SW_YUVScale scale;
+    int num_bands;
+
+    if (srcrect->w > SDL_MAX_UINT16 || srcrect->h > SDL_MAX_UINT16 || w > SDL_MAX_UINT16 || h > SDL_MAX_UINT16) {
+        return SDL_SetError("Size too large for scaling");
+    }
+
+    scale.swdata = swdata;
+    scale.srcrect = *srcrect;
+    scale.target_format = target_format;
+    scale.bpp = SDL_BYTESPERPIXEL(target_format);
+    scale.w = w;
+    scale.h = h;
+    scale.pixels = (Uint8 *)pixels;
+    scale.pitch = pitch;
+    scale.rows_x = srcrect->x & ~1;
+    scale.rows_w = srcrect->x + srcrect->w - scale.rows_x;
+    scale.rows_pitch = ((scale.rows_w * scale.bpp) + 15) & ~15;
+
+    num_bands = SDL_GetSurfaceBands(SDL_HINT_VIDEO_YUV_CONVERSION_THREADS, SDL_SW_YUV_MIN_BAND_PIXELS, w, h, 1, &scale.band_height);
+    scale.rows = (Uint8 *)SDL_malloc((size_t)num_bands * 2 * scale.rows_pitch);
+    if (!scale.rows) {
+        return false;
+    }
+
+    if (num_bands <= 1) {
+        SDL_SW_ScaleYUVBand(&scale, 0);
+    } else {
+        SDL_RunSurfaceBands(SDL_SW_ScaleYUVBand, &scale, num_bands);
+    }
+    SDL_free(scale.rows);
+    return true;
+}
+
 bool SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture *swdata, const SDL_Rect *srcrect, SDL_PixelFormat target_format, int w, int h, void *pixels, int pitch)
 {
     int stretch;
 
+    if (w <= 0 || h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return true;
+    }
+
+    // Convert straight into the destination whenever there's a direct conversion for the target format
+    if (SDL_CanConvertYUVPlanesToRGB(swdata->format, swdata->colorspace, target_format, SDL_COLORSPACE_SRGB)) {
+        const bool subsampled_y = (swdata->format == SDL_PIXELFORMAT_YV12 || swdata->format == SDL_PIXELFORMAT_IYUV ||
+                                   swdata->format == SDL_PIXELFORMAT_NV12 || swdata->format == SDL_PIXELFORMAT_NV21);
+
+        if (srcrect->w == w && srcrect->h == h && (srcrect->x & 1) == 0 && (!subsampled_y || (srcrect->y & 1) == 0)) {
+            const Uint8 *Yplane, *Uplane, *Vplane;
+            Uint32 Ypitch, UVpitch;
+
+            SDL_SW_GetYUVPlanes(swdata, srcrect->x, srcrect->y, &Yplane, &Uplane, &Vplane, &Ypitch, &UVpitch);
+            return SDL_ConvertYUVPlanesToRGB(w, h, swdata->format, swdata->colorspace, Yplane, Uplane, Vplane, Ypitch, UVpitch,
+                                             target_format, SDL_COLORSPACE_SRGB, pixels, pitch);
+        }
+        return SDL_SW_ScaleYUVToRGB(swdata, srcrect, target_format, w, h, pixels, pitch);
+    }
+
     // Make sure we're set up to display in the desired format
-    if (target_format != swdata->target_format && swdata->display) {
-        SDL_DestroySurface(swdata->display);
-        swdata->display = NULL;
+    if (target_format != swdata->target_format) {
+        if (swdata->display) {
+            SDL_DestroySurface(swdata->display);
+            swdata->display = NULL;
+        }
+        if (swdata->stretch) {
+            SDL_DestroySurface(swdata->stretch);
+            swdata->stretch = NULL;
+        }
+        swdata->target_format = target_format;
     }
 
     stretch = 0;
@@ -369,26 +587,29 @@ bool SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture *swdata, const SDL_Rect *srcrect, SDL
             if (!swdata->display) {
                 return false;
             }
-            swdata->target_format = target_format;
         }
         if (!swdata->stretch) {
             swdata->stretch = SDL_CreateSurface(swdata->w, swdata->h, target_format);
             if (!swdata->stretch) {
                 return false;
             }
+            swdata->stretch_valid = false;
+        }
+
+        // The converted frame is kept until the YUV data changes
+        if (!swdata->stretch_valid) {
+            if (!SDL_ConvertPixelsAndColorspace(swdata->w, swdata->h, swdata->format, swdata->colorspace, 0, swdata->planes[0], swdata->pitches[0], target_format, SDL_COLORSPACE_SRGB, 0, swdata->stretch->pixels, swdata->stretch->pitch)) {
+                return false;
+            }
+            swdata->stretch_valid = true;
+        }
+
+        {
+            SDL_Rect rect = *srcrect;
+            return SDL_StretchSurface(swdata->stretch, &rect, swdata->display, NULL, SDL_SCALEMODE_NEAREST);
         }
-        pixels = swdata->stretch->pixels;
-        pitch = swdata->stretch->pitch;
-    }
-    if (!SDL_ConvertPixelsAndColorspace(swdata->w, swdata->h, swdata->format, swdata->colorspace, 0, swdata->planes[0], swdata->pitches[0], target_format, SDL_COLORSPACE_SRGB, 0, pixels, pitch)) {
-        return false;
-    }
-    if (stretch) {
-        SDL_Rect rect = *srcrect;
-        return SDL_StretchSurface(swdata->stretch, &rect, swdata->display, NULL, SDL_SCALEMODE_NEAREST);
-    } else {
-        return true;
     }
+    return SDL_ConvertPixelsAndColorspace(swdata->w, swdata->h, swdata->format, swdata->colorspace, 0, swdata->planes[0], swdata->pitches[0], target_format, SDL_COLORSPACE_SRGB, 0, pixels, pitch);
 }
 
 void SDL_SW_DestroyYUVTexture(SDL_SW_YUVTexture *swdata)
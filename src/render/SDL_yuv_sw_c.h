@@ -41,6 +41,9 @@ struct SDL_SW_YUVTexture
     // This is a temporary surface in case we have to stretch copy
     SDL_Surface *stretch;
     SDL_Surface *display;
+
+    // Whether stretch holds the current frame, cleared whenever the YUV data changes
+    bool stretch_valid;
 };
 
 typedef struct SDL_SW_YUVTexture SDL_SW_YUVTexture;
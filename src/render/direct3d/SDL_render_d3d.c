@@ -474,7 +474,7 @@ static bool D3D_UpdateTextureRep(IDirect3DDevice9 *device, D3D_TextureRep *textu
     D3DLOCKED_RECT locked;
     const Uint8 *src;
     Uint8 *dst;
-    int row, length;
+    int length;
     HRESULT result;
 
     if (!D3D_CreateStagingTexture(device, texture)) {
@@ -494,21 +494,13 @@ static bool D3D_UpdateTextureRep(IDirect3DDevice9 *device, D3D_TextureRep *textu
     src = (const Uint8 *)pixels;
     dst = (Uint8 *)locked.pBits;
     length = w * SDL_BYTESPERPIXEL(texture->format);
-    if (length == pitch && length == locked.Pitch) {
-        SDL_memcpy(dst, src, (size_t)length * h);
-    } else {
-        if (length > pitch) {
-            length = pitch;
-        }
-        if (length > locked.Pitch) {
-            length = locked.Pitch;
-        }
-        for (row = 0; row < h; ++row) {
-            SDL_memcpy(dst, src, length);
-            src += pitch;
-            dst += locked.Pitch;
-        }
+    if (length > pitch) {
+        length = pitch;
+    }
+    if (length > locked.Pitch) {
+        length = locked.Pitch;
     }
+    SDL_memcpy_rows(dst, locked.Pitch, src, pitch, length, h);
     result = IDirect3DTexture9_UnlockRect(texture->staging, 0);
     if (FAILED(result)) {
         return D3D_SetError("UnlockRect()", result);
@@ -993,12 +985,12 @@ static bool SetupTextureState(D3D_RenderData *data, SDL_Texture *texture, D3D9_S
     return true;
 }
 
-static bool SetDrawState(D3D_RenderData *data, const SDL_RenderCommand *cmd)
+static bool SetDrawState(SDL_Renderer *renderer, D3D_RenderData *data, const SDL_RenderCommand *cmd)
 {
     SDL_Texture *texture = cmd->data.draw.texture;
     const SDL_BlendMode blend = cmd->data.draw.blend;
 
-    if (texture != data->drawstate.texture) {
+    if (SDL_CountRenderStateChange(renderer, texture != data->drawstate.texture)) {
 #ifdef SDL_HAVE_YUV
         D3D_TextureData *oldtexturedata = data->drawstate.texture ? (D3D_TextureData *)data->drawstate.texture->internal : NULL;
         D3D_TextureData *newtexturedata = texture ? (D3D_TextureData *)texture->internal : NULL;
@@ -1021,7 +1013,7 @@ static bool SetDrawState(D3D_RenderData *data, const SDL_RenderCommand *cmd)
         }
 
 #ifdef SDL_HAVE_YUV
-        if (shader != data->drawstate.shader) {
+        if (SDL_CountRenderStateChange(renderer, shader != data->drawstate.shader)) {
             const HRESULT result = IDirect3DDevice9_SetPixelShader(data->device, data->shaders[shader]);
             if (FAILED(result)) {
                 return D3D_SetError("IDirect3DDevice9_SetPixelShader()", result);
@@ -1070,7 +1062,7 @@ static bool SetDrawState(D3D_RenderData *data, const SDL_RenderCommand *cmd)
 #endif // SDL_HAVE_YUV
     }
 
-    if (blend != data->drawstate.blend) {
+    if (SDL_CountRenderStateChange(renderer, blend != data->drawstate.blend)) {
         if (blend == SDL_BLENDMODE_NONE) {
             IDirect3DDevice9_SetRenderState(data->device, D3DRS_ALPHABLENDENABLE, FALSE);
         } else {
@@ -1282,12 +1274,14 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
         {
             const size_t count = cmd->data.draw.count;
             const size_t first = cmd->data.draw.first;
-            SetDrawState(data, cmd);
+            SetDrawState(renderer, data, cmd);
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_POINTLIST, (UINT)(first / sizeof(Vertex)), (UINT)count);
+                ++renderer->stats.draw_calls;
             } else {
                 const Vertex *verts = (Vertex *)(((Uint8 *)vertices) + first);
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_POINTLIST, (UINT)count, verts, sizeof(Vertex));
+                ++renderer->stats.draw_calls;
             }
             break;
         }
@@ -1303,17 +1297,21 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                NOLINTNEXTLINE(clang-analyzer-core.NullDereference): FIXME: Can verts truly not be NULL ? */
             const bool close_endpoint = ((count == 2) || (verts[0].x != verts[count - 1].x) || (verts[0].y != verts[count - 1].y));
 
-            SetDrawState(data, cmd);
+            SetDrawState(renderer, data, cmd);
 
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_LINESTRIP, (UINT)(first / sizeof(Vertex)), (UINT)(count - 1));
+                ++renderer->stats.draw_calls;
                 if (close_endpoint) {
                     IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_POINTLIST, (UINT)((first / sizeof(Vertex)) + (count - 1)), 1);
+                    ++renderer->stats.draw_calls;
                 }
             } else {
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_LINESTRIP, (UINT)(count - 1), verts, sizeof(Vertex));
+                ++renderer->stats.draw_calls;
                 if (close_endpoint) {
                     IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_POINTLIST, 1, &verts[count - 1], sizeof(Vertex));
+                    ++renderer->stats.draw_calls;
                 }
             }
             break;
@@ -1332,16 +1330,24 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
         {
             const size_t count = cmd->data.draw.count;
             const size_t first = cmd->data.draw.first;
-            SetDrawState(data, cmd);
+            SetDrawState(renderer, data, cmd);
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_TRIANGLELIST, (UINT)(first / sizeof(Vertex)), (UINT)count / 3);
+                ++renderer->stats.draw_calls;
             } else {
                 const Vertex *verts = (Vertex *)(((Uint8 *)vertices) + first);
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_TRIANGLELIST, (UINT)count / 3, verts, sizeof(Vertex));
+                ++renderer->stats.draw_calls;
             }
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
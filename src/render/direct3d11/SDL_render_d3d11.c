@@ -32,7 +32,7 @@
 #include "../SDL_sysrender.h"
 
 #include <d3d11_1.h>
-#include <dxgi1_4.h>
+#include <dxgi1_5.h>
 #include <dxgidebug.h>
 
 #include "SDL_shaders_d3d11.h"
@@ -44,12 +44,7 @@
 #endif
 
 #include "SDL_render_winrt.h"
-
-#if WINAPI_FAMILY == WINAPI_FAMILY_APP
-#include <windows.ui.xaml.media.dxinterop.h>
-// TODO, WinRT, XAML: get the ISwapChainBackgroundPanelNative from something other than a global var
-extern ISwapChainBackgroundPanelNative *WINRT_GlobalSwapChainBackgroundPanelNative;
-#endif // WINAPI_FAMILY == WINAPI_FAMILY_APP
+#include "../../core/winrt/SDL_winrtapp_common.h"
 
 #endif // SDL_PLATFORM_WINRT
 
@@ -65,6 +60,35 @@ extern ISwapChainBackgroundPanelNative *WINRT_GlobalSwapChainBackgroundPanelNati
         X = NULL;                                         \
     }
 
+/* The vertex ring buffer starts at this size and grows by doubling. It
+ * shrinks when the largest upload over D3D11_VERTEX_BUFFER_SHRINK_UPLOADS
+ * uploads used less than a quarter of it.
+ */
+#define D3D11_VERTEX_BUFFER_MIN_SIZE       (64 * 1024)
+#define D3D11_VERTEX_BUFFER_SHRINK_UPLOADS 600
+
+/* Staging textures used for texture updates are kept in a pool, with their
+ * sizes rounded up to a power of two of at least D3D11_STAGING_MIN_SIZE so
+ * slightly different update rects share them. An event query issued after
+ * the copy out of a staging texture tells when it can be mapped again
+ * without stalling.
+ */
+#define D3D11_STAGING_POOL_SIZE 8
+#define D3D11_STAGING_MIN_SIZE  64
+
+/* Asynchronous pixel readbacks copy into staging textures from a separate
+ * pool, which hold on to them until the pixels are collected. An app that
+ * reads the same rect every frame cycles through the same few textures.
+ */
+#define D3D11_READBACK_POOL_SIZE 4
+
+/* When GPU timing is enabled, each frame's command queues and present are
+ * bracketed by timestamp queries inside a disjoint query. The results are
+ * read back up to D3D11_TIMING_FRAMES frames later, so checking them never
+ * waits on the GPU.
+ */
+#define D3D11_TIMING_FRAMES 4
+
 /* !!! FIXME: vertex buffer bandwidth could be lower; only use UV coords when
    !!! FIXME:  textures are needed. */
 
@@ -134,8 +158,11 @@ typedef struct
     ID3D11ShaderResourceView *mainTextureResourceView;
     ID3D11RenderTargetView *mainTextureRenderTargetView;
     ID3D11Texture2D *stagingTexture;
+    struct D3D11_StagingTexture *stagingEntry; // the pool entry that owns stagingTexture, if any
     int lockedTexturePositionX;
     int lockedTexturePositionY;
+    int lockedWidth;
+    int lockedHeight;
     D3D11_Shader shader;
     const float *YCbCr_matrix;
 #ifdef SDL_HAVE_YUV
@@ -154,8 +181,46 @@ typedef struct
     int pitch;
     SDL_Rect locked_rect;
 #endif
+
+    // Restorable texture support
+    Uint8 *shadowPixels;
+    int shadowPitch;
+    SDL_Rect shadowLockedRect;
+    bool shadowLocked;
+    bool needsRestore;
+    D3D11_TEXTURE2D_DESC restoreDesc;
+    D3D11_SHADER_RESOURCE_VIEW_DESC restoreResourceViewDesc;
+
+#ifdef SDL_VIDEO_OPENGL_WGL
+    // OpenGL interop support
+    HANDLE glInteropObject;
+    unsigned int glInteropTexture;
+    bool glInteropAcquired;
+#endif
 } D3D11_TextureData;
 
+// Pooled staging texture
+typedef struct D3D11_StagingTexture
+{
+    ID3D11Texture2D *texture;
+    ID3D11Query *query;
+    DXGI_FORMAT format;
+    UINT width;
+    UINT height;
+    bool locked;
+    bool pending;
+} D3D11_StagingTexture;
+
+// An asynchronous pixel readback
+typedef struct
+{
+    ID3D11Texture2D *stagingTexture;
+    ID3D11Query *query;
+    D3D11_StagingTexture *entry; // the pool entry that owns stagingTexture, if any
+    SDL_PixelFormat format;
+    SDL_Colorspace colorspace;
+} D3D11_ReadbackData;
+
 // Blend mode data
 typedef struct
 {
@@ -163,7 +228,37 @@ typedef struct
     ID3D11BlendState *blendState;
 } D3D11_BlendMode;
 
+#ifdef SDL_VIDEO_OPENGL_WGL
+#define WGL_ACCESS_READ_WRITE_NV 0x0001
+#define D3D11_GL_TEXTURE_2D     0x0DE1
+
+// WGL_NV_DX_interop2 support
+typedef struct
+{
+    HANDLE device;
+    HANDLE(WINAPI *wglDXOpenDeviceNV)(void *dxDevice);
+    BOOL(WINAPI *wglDXCloseDeviceNV)(HANDLE hDevice);
+    HANDLE(WINAPI *wglDXRegisterObjectNV)(HANDLE hDevice, void *dxObject, unsigned int name, unsigned int type, unsigned int access);
+    BOOL(WINAPI *wglDXUnregisterObjectNV)(HANDLE hDevice, HANDLE hObject);
+    BOOL(WINAPI *wglDXLockObjectsNV)(HANDLE hDevice, int count, HANDLE *hObjects);
+    BOOL(WINAPI *wglDXUnlockObjectsNV)(HANDLE hDevice, int count, HANDLE *hObjects);
+    void(APIENTRY *glGenTextures)(int n, unsigned int *textures);
+    void(APIENTRY *glDeleteTextures)(int n, const unsigned int *textures);
+} D3D11_GLInterop;
+#endif
+
 // Private renderer data
+// Timestamp queries for one frame when GPU timing is enabled
+typedef struct
+{
+    ID3D11Query *disjoint;
+    ID3D11Query **timestamps; // pairs of range start and end
+    int numTimestamps;
+    int maxTimestamps;
+    bool active;
+    bool pending;
+} D3D11_TimingFrame;
+
 typedef struct
 {
     SDL_SharedObject *hDXGIMod;
@@ -175,13 +270,43 @@ typedef struct
     ID3D11DeviceContext1 *d3dContext;
     IDXGISwapChain1 *swapChain;
     DXGI_SWAP_EFFECT swapEffect;
+    DXGI_SCALING swapChainScaling;
+    UINT swapChainFlags;
+    int backBufferWidth;
+    int backBufferHeight;
+    int sourceWidth; // 0 to present the whole back buffer
+    int sourceHeight;
+    bool frameLatencyWaitable;
+    UINT maximumFrameLatency;
+    HANDLE frameLatencyWaitableObject;
+    RECT *presentDirtyRects;
+    int presentDirtyRectsAllocated;
+    BOOL supportsTearing;
+    bool adaptiveVSync;
+    int texturesPendingRestore;
+    Uint64 textureRestoreNS;
+#ifdef SDL_VIDEO_OPENGL_WGL
+    D3D11_GLInterop glInterop;
+#endif
+    Uint64 lastPresentNS;
     UINT syncInterval;
     UINT presentFlags;
     ID3D11RenderTargetView *mainRenderTargetView;
     ID3D11RenderTargetView *currentOffscreenRenderTargetView;
     ID3D11InputLayout *inputLayout;
-    ID3D11Buffer *vertexBuffers[8];
-    size_t vertexBufferSizes[8];
+    ID3D11Buffer *vertexBuffer;
+    size_t vertexBufferSize;
+    size_t vertexBufferOffset;
+    size_t vertexBufferPeakUpload;
+    int vertexBufferUploads;
+    size_t vertexBytesUploaded;
+    D3D11_StagingTexture stagingPool[D3D11_STAGING_POOL_SIZE];
+    Uint64 stagingPoolHits;
+    Uint64 stagingPoolMisses;
+    D3D11_StagingTexture readbackPool[D3D11_READBACK_POOL_SIZE];
+    D3D11_TimingFrame timingFrames[D3D11_TIMING_FRAMES];
+    int timingFrame;
+    bool timingRangeOpen;
     ID3D11VertexShader *vertexShader;
     ID3D11PixelShader *pixelShaders[NUM_SHADERS];
     int blendModesCount;
@@ -189,6 +314,10 @@ typedef struct
     ID3D11SamplerState *samplers[RENDER_SAMPLER_COUNT];
     D3D_FEATURE_LEVEL featureLevel;
     bool pixelSizeChanged;
+    bool liveResize;
+    Uint64 pixelSizeChangedNS;
+    int outputWidth; // The window size the back buffer was last sized for
+    int outputHeight;
 
     // Rasterizers
     ID3D11RasterizerState *mainRasterizer;
@@ -214,7 +343,6 @@ typedef struct
     int currentViewportRotation;
     bool viewportDirty;
     Float4X4 identity;
-    int currentVertexBuffer;
 } D3D11_RenderData;
 
 // Define D3D GUIDs here so we don't have to include uuid.lib.
@@ -225,6 +353,7 @@ typedef struct
 #endif
 
 static const GUID SDL_IID_IDXGIFactory2 = { 0x50c83a1c, 0xe072, 0x4c48, { 0x87, 0xb0, 0x36, 0x30, 0xfa, 0x36, 0xa6, 0xd0 } };
+static const GUID SDL_IID_IDXGIFactory5 = { 0x7632e1f5, 0xee65, 0x4dca, { 0x87, 0xfd, 0x84, 0xcd, 0x75, 0xf8, 0x83, 0x8d } };
 static const GUID SDL_IID_IDXGIDevice1 = { 0x77db970f, 0x6276, 0x48ba, { 0xba, 0x28, 0x07, 0x01, 0x43, 0xb4, 0x39, 0x2c } };
 #if defined(SDL_PLATFORM_WINRT) && NTDDI_VERSION > NTDDI_WIN8
 static const GUID SDL_IID_IDXGIDevice3 = { 0x6007896c, 0x3244, 0x4afd, { 0xbf, 0x18, 0xa6, 0xd3, 0xbe, 0xda, 0x50, 0x23 } };
@@ -232,7 +361,8 @@ static const GUID SDL_IID_IDXGIDevice3 = { 0x6007896c, 0x3244, 0x4afd, { 0xbf, 0
 static const GUID SDL_IID_ID3D11Texture2D = { 0x6f15aaf2, 0xd208, 0x4e89, { 0x9a, 0xb4, 0x48, 0x95, 0x35, 0xd3, 0x4f, 0x9c } };
 static const GUID SDL_IID_ID3D11Device1 = { 0xa04bfb29, 0x08ef, 0x43d6, { 0xa4, 0x9c, 0xa9, 0xbd, 0xbd, 0xcb, 0xe6, 0x86 } };
 static const GUID SDL_IID_ID3D11DeviceContext1 = { 0xbb2c6faa, 0xb5fb, 0x4082, { 0x8e, 0x6b, 0x38, 0x8b, 0x8c, 0xfa, 0x90, 0xe1 } };
-static const GUID SDL_IID_IDXGISwapChain2 = { 0x94d99bdb, 0xf1f8, 0x4ab0, { 0xb2, 0x36, 0x7d, 0xa0, 0x17, 0x0e, 0xda, 0xb1 } };
+static const GUID SDL_IID_IDXGISwapChain2 = { 0xa8be2ac4, 0x199f, 0x4946, { 0xb3, 0x31, 0x79, 0x59, 0x9f, 0xb9, 0x8d, 0xe7 } };
+static const GUID SDL_IID_IDXGISwapChain3 = { 0x94d99bdb, 0xf1f8, 0x4ab0, { 0xb2, 0x36, 0x7d, 0xa0, 0x17, 0x0e, 0xda, 0xb1 } };
 static const GUID SDL_IID_IDXGIDebug1 = { 0xc5a05f0c, 0x16f2, 0x4adf, { 0x9f, 0x4d, 0xa8, 0xc4, 0xd5, 0x8a, 0xc5, 0x50 } };
 static const GUID SDL_IID_IDXGIInfoQueue = { 0xD67441C7, 0x672A, 0x476f, { 0x9E, 0x82, 0xCD, 0x55, 0xB4, 0x49, 0x49, 0xCE } };
 static const GUID SDL_DXGI_DEBUG_ALL = { 0xe48ae283, 0xda80, 0x490b, { 0x87, 0xe6, 0x43, 0xe9, 0xa9, 0xcf, 0xda, 0x8 } };
@@ -292,6 +422,26 @@ static DXGI_FORMAT SDLPixelFormatToDXGITextureFormat(Uint32 format, Uint32 outpu
         return DXGI_FORMAT_NV12;
     case SDL_PIXELFORMAT_P010:
         return DXGI_FORMAT_P010;
+    case SDL_PIXELFORMAT_BC1:
+        if (output_colorspace == SDL_COLORSPACE_SRGB_LINEAR) {
+            return DXGI_FORMAT_BC1_UNORM_SRGB;
+        }
+        return DXGI_FORMAT_BC1_UNORM;
+    case SDL_PIXELFORMAT_BC2:
+        if (output_colorspace == SDL_COLORSPACE_SRGB_LINEAR) {
+            return DXGI_FORMAT_BC2_UNORM_SRGB;
+        }
+        return DXGI_FORMAT_BC2_UNORM;
+    case SDL_PIXELFORMAT_BC3:
+        if (output_colorspace == SDL_COLORSPACE_SRGB_LINEAR) {
+            return DXGI_FORMAT_BC3_UNORM_SRGB;
+        }
+        return DXGI_FORMAT_BC3_UNORM;
+    case SDL_PIXELFORMAT_BC7:
+        if (output_colorspace == SDL_COLORSPACE_SRGB_LINEAR) {
+            return DXGI_FORMAT_BC7_UNORM_SRGB;
+        }
+        return DXGI_FORMAT_BC7_UNORM;
     default:
         return DXGI_FORMAT_UNKNOWN;
     }
@@ -326,19 +476,84 @@ static DXGI_FORMAT SDLPixelFormatToDXGIMainResourceViewFormat(Uint32 format, Uin
         return DXGI_FORMAT_R8_UNORM;
     case SDL_PIXELFORMAT_P010: // For the Y texture
         return DXGI_FORMAT_R16_UNORM;
+    case SDL_PIXELFORMAT_BC1:
+    case SDL_PIXELFORMAT_BC2:
+    case SDL_PIXELFORMAT_BC3:
+    case SDL_PIXELFORMAT_BC7:
+        return SDLPixelFormatToDXGITextureFormat(format, colorspace);
     default:
         return DXGI_FORMAT_UNKNOWN;
     }
 }
 
+static bool D3D11_IsBlockCompressedFormat(DXGI_FORMAT format)
+{
+    switch (format) {
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC1_UNORM_SRGB:
+    case DXGI_FORMAT_BC2_UNORM:
+    case DXGI_FORMAT_BC2_UNORM_SRGB:
+    case DXGI_FORMAT_BC3_UNORM:
+    case DXGI_FORMAT_BC3_UNORM_SRGB:
+    case DXGI_FORMAT_BC7_UNORM:
+    case DXGI_FORMAT_BC7_UNORM_SRGB:
+        return true;
+    default:
+        return false;
+    }
+}
+
 static void D3D11_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture);
+static void D3D11_ReleaseTextureResources(D3D11_TextureData *data);
+#ifdef SDL_VIDEO_OPENGL_WGL
+static void D3D11_UnshareTextureWithGL(SDL_Renderer *renderer, SDL_Texture *texture);
+#endif
+
+static void D3D11_ReleaseStagingEntry(D3D11_StagingTexture *entry)
+{
+    SAFE_RELEASE(entry->texture);
+    SAFE_RELEASE(entry->query);
+    entry->locked = false;
+    entry->pending = false;
+}
+
+static void D3D11_ReleaseTimingFrame(D3D11_TimingFrame *frame)
+{
+    int i;
+
+    SAFE_RELEASE(frame->disjoint);
+    for (i = 0; i < frame->maxTimestamps; ++i) {
+        SAFE_RELEASE(frame->timestamps[i]);
+    }
+    SDL_free(frame->timestamps);
+    frame->timestamps = NULL;
+    frame->numTimestamps = 0;
+    frame->maxTimestamps = 0;
+    frame->active = false;
+    frame->pending = false;
+}
 
 static void D3D11_ReleaseAll(SDL_Renderer *renderer)
 {
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
 
-    // Release all textures
+#ifdef SDL_VIDEO_OPENGL_WGL
+    // The OpenGL interop objects belong to the device that's going away
+    if (data && data->glInterop.device) {
+        for (SDL_Texture *texture = renderer->textures; texture; texture = texture->next) {
+            D3D11_UnshareTextureWithGL(renderer, texture);
+        }
+        data->glInterop.wglDXCloseDeviceNV(data->glInterop.device);
+        data->glInterop.device = NULL;
+    }
+#endif
+
+    // Release all textures, except those that will be restored from their shadow copy
     for (SDL_Texture *texture = renderer->textures; texture; texture = texture->next) {
+        D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+        if (textureData && textureData->needsRestore) {
+            continue;
+        }
         D3D11_DestroyTexture(renderer, texture);
     }
 
@@ -374,11 +589,26 @@ static void D3D11_ReleaseAll(SDL_Renderer *renderer)
             SAFE_RELEASE(data->currentShaderState[i].constants);
         }
         SAFE_RELEASE(data->vertexShader);
-        for (i = 0; i < SDL_arraysize(data->vertexBuffers); ++i) {
-            SAFE_RELEASE(data->vertexBuffers[i]);
+        SAFE_RELEASE(data->vertexBuffer);
+        data->vertexBufferSize = 0;
+        data->vertexBufferOffset = 0;
+        for (i = 0; i < SDL_arraysize(data->stagingPool); ++i) {
+            D3D11_ReleaseStagingEntry(&data->stagingPool[i]);
+        }
+        for (i = 0; i < SDL_arraysize(data->readbackPool); ++i) {
+            D3D11_ReleaseStagingEntry(&data->readbackPool[i]);
         }
+        for (i = 0; i < SDL_arraysize(data->timingFrames); ++i) {
+            D3D11_ReleaseTimingFrame(&data->timingFrames[i]);
+        }
+        data->timingFrame = 0;
+        data->timingRangeOpen = false;
         SAFE_RELEASE(data->inputLayout);
         SAFE_RELEASE(data->mainRenderTargetView);
+        if (data->frameLatencyWaitableObject) {
+            CloseHandle(data->frameLatencyWaitableObject);
+            data->frameLatencyWaitableObject = NULL;
+        }
         SAFE_RELEASE(data->swapChain);
 
         SAFE_RELEASE(data->d3dContext);
@@ -387,6 +617,7 @@ static void D3D11_ReleaseAll(SDL_Renderer *renderer)
         SAFE_RELEASE(data->dxgiFactory);
 
         data->swapEffect = (DXGI_SWAP_EFFECT)0;
+        data->swapChainFlags = 0;
         data->rotation = DXGI_MODE_ROTATION_UNSPECIFIED;
         data->currentOffscreenRenderTargetView = NULL;
         data->currentRenderTargetView = NULL;
@@ -398,6 +629,10 @@ static void D3D11_ReleaseAll(SDL_Renderer *renderer)
         data->currentSampler = NULL;
 
         // Check for any leaks if in debug mode
+        SDL_free(data->presentDirtyRects);
+        data->presentDirtyRects = NULL;
+        data->presentDirtyRectsAllocated = 0;
+
         if (data->dxgiDebug) {
             DXGI_DEBUG_RLO_FLAGS rloFlags = (DXGI_DEBUG_RLO_FLAGS)(DXGI_DEBUG_RLO_DETAIL | DXGI_DEBUG_RLO_IGNORE_INTERNAL);
             IDXGIDebug_ReportLiveObjects(data->dxgiDebug, SDL_DXGI_DEBUG_ALL, rloFlags);
@@ -627,6 +862,18 @@ static HRESULT D3D11_CreateDeviceResources(SDL_Renderer *renderer)
         goto done;
     }
 
+    // Check for explicit tearing support, needed for variable refresh rate displays
+    data->supportsTearing = FALSE;
+    {
+        IDXGIFactory5 *dxgiFactory5 = NULL;
+        if (SUCCEEDED(IDXGIFactory2_QueryInterface(data->dxgiFactory, &SDL_IID_IDXGIFactory5, (void **)&dxgiFactory5))) {
+            if (FAILED(IDXGIFactory5_CheckFeatureSupport(dxgiFactory5, DXGI_FEATURE_PRESENT_ALLOW_TEARING, &data->supportsTearing, sizeof(data->supportsTearing)))) {
+                data->supportsTearing = FALSE;
+            }
+            SAFE_RELEASE(dxgiFactory5);
+        }
+    }
+
     // FIXME: Should we use the default adapter?
     result = IDXGIFactory2_EnumAdapters(data->dxgiFactory, 0, &data->dxgiAdapter);
     if (FAILED(result)) {
@@ -688,7 +935,7 @@ static HRESULT D3D11_CreateDeviceResources(SDL_Renderer *renderer)
     /* Ensure that DXGI does not queue more than one frame at a time. This both reduces latency and
      * ensures that the application will only render after each VSync, minimizing power consumption.
      */
-    result = IDXGIDevice1_SetMaximumFrameLatency(dxgiDevice, 1);
+    result = IDXGIDevice1_SetMaximumFrameLatency(dxgiDevice, data->maximumFrameLatency);
     if (FAILED(result)) {
         WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGIDevice1::SetMaximumFrameLatency"), result);
         goto done;
@@ -913,6 +1160,14 @@ static HRESULT D3D11_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
     }
 #endif // SDL_WINAPI_FAMILY_PHONE
     swapChainDesc.Flags = 0;
+    if (data->frameLatencyWaitable && swapChainDesc.SwapEffect != DXGI_SWAP_EFFECT_DISCARD) {
+        // The waitable object is only available with flip model swap chains
+        swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    }
+    if (data->supportsTearing && swapChainDesc.SwapEffect != DXGI_SWAP_EFFECT_DISCARD) {
+        // Tearing is only available with flip model swap chains
+        swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+    }
 
     if (coreWindow) {
         result = IDXGIFactory2_CreateSwapChainForCoreWindow(data->dxgiFactory,
@@ -937,9 +1192,9 @@ static HRESULT D3D11_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
         }
 
 #if WINAPI_FAMILY == WINAPI_FAMILY_APP
-        result = ISwapChainBackgroundPanelNative_SetSwapChain(WINRT_GlobalSwapChainBackgroundPanelNative, (IDXGISwapChain *)data->swapChain);
+        result = D3D11_SetXAMLSwapChain(data->swapChain);
         if (FAILED(result)) {
-            WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ISwapChainBackgroundPanelNative::SetSwapChain"), result);
+            WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ISwapChainPanelNative::SetSwapChain"), result);
             goto done;
         }
 #else
@@ -975,8 +1230,32 @@ static HRESULT D3D11_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
 #endif // defined(SDL_PLATFORM_WIN32) || defined(SDL_PLATFORM_WINGDK) / else
     }
     data->swapEffect = swapChainDesc.SwapEffect;
+    data->swapChainScaling = swapChainDesc.Scaling;
+    data->swapChainFlags = swapChainDesc.Flags;
+
+    if (data->swapChainFlags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) {
+        IDXGISwapChain2 *swapChain2 = NULL;
+
+        /* With a waitable swap chain, the device frame latency is ignored and
+         * the swap chain controls how many frames can be queued.
+         */
+        result = IDXGISwapChain1_QueryInterface(data->swapChain, &SDL_IID_IDXGISwapChain2, (void **)&swapChain2);
+        if (FAILED(result)) {
+            WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain1 to IDXGISwapChain2"), result);
+            goto done;
+        }
+        result = IDXGISwapChain2_SetMaximumFrameLatency(swapChain2, data->maximumFrameLatency);
+        if (FAILED(result)) {
+            WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain2::SetMaximumFrameLatency"), result);
+            SAFE_RELEASE(swapChain2);
+            goto done;
+        }
+        data->frameLatencyWaitableObject = IDXGISwapChain2_GetFrameLatencyWaitableObject(swapChain2);
+        SAFE_RELEASE(swapChain2);
+    }
+    SDL_SetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_D3D11_FRAME_LATENCY_WAITABLE_OBJECT_POINTER, data->frameLatencyWaitableObject);
 
-    if (SUCCEEDED(IDXGISwapChain1_QueryInterface(data->swapChain, &SDL_IID_IDXGISwapChain2, (void **)&swapChain3))) {
+    if (SUCCEEDED(IDXGISwapChain1_QueryInterface(data->swapChain, &SDL_IID_IDXGISwapChain3, (void **)&swapChain3))) {
         UINT colorspace_support = 0;
         DXGI_COLOR_SPACE_TYPE colorspace;
         switch (renderer->output_colorspace) {
@@ -1013,6 +1292,38 @@ done:
     return result;
 }
 
+// Present only the requested region of the back buffer and let the compositor stretch it to fit
+static HRESULT D3D11_UpdateSourceSize(SDL_Renderer *renderer)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    IDXGISwapChain2 *swapChain2 = NULL;
+    HRESULT result;
+    int w = data->backBufferWidth;
+    int h = data->backBufferHeight;
+
+    if (data->sourceWidth > 0 && data->sourceHeight > 0) {
+        if (D3D11_IsDisplayRotated90Degrees(data->rotation)) {
+            w = SDL_min(data->sourceHeight, w);
+            h = SDL_min(data->sourceWidth, h);
+        } else {
+            w = SDL_min(data->sourceWidth, w);
+            h = SDL_min(data->sourceHeight, h);
+        }
+    }
+
+    result = IDXGISwapChain1_QueryInterface(data->swapChain, &SDL_IID_IDXGISwapChain2, (void **)&swapChain2);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain1 to IDXGISwapChain2"), result);
+        return result;
+    }
+    result = IDXGISwapChain2_SetSourceSize(swapChain2, w, h);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain2::SetSourceSize"), result);
+    }
+    SAFE_RELEASE(swapChain2);
+    return result;
+}
+
 static void D3D11_ReleaseMainRenderTargetView(SDL_Renderer *renderer)
 {
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
@@ -1028,9 +1339,6 @@ static HRESULT D3D11_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
     HRESULT result = S_OK;
     int w, h;
 
-    // Release the previous render target view
-    D3D11_ReleaseMainRenderTargetView(renderer);
-
     /* The width and height of the swap chain must be based on the display's
      * non-rotated size.
      */
@@ -1039,6 +1347,19 @@ static HRESULT D3D11_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
 #else
     SDL_GetWindowSizeInPixels(renderer->window, &w, &h);
 #endif
+
+    // Several size events can arrive for a single resize, skip the ones that don't change anything
+    if (data->swapChain && data->mainRenderTargetView &&
+        w == data->outputWidth && h == data->outputHeight &&
+        data->rotation == D3D11_GetCurrentRotation()) {
+        return S_OK;
+    }
+
+    // Release the previous render target view
+    D3D11_ReleaseMainRenderTargetView(renderer);
+
+    data->outputWidth = w;
+    data->outputHeight = h;
     data->rotation = D3D11_GetCurrentRotation();
     // SDL_Log("%s: windowSize={%d,%d}, orientation=%d", __FUNCTION__, w, h, (int)data->rotation);
     if (D3D11_IsDisplayRotated90Degrees(data->rotation)) {
@@ -1055,7 +1376,7 @@ static HRESULT D3D11_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
                                               0,
                                               w, h,
                                               DXGI_FORMAT_UNKNOWN,
-                                              0);
+                                              data->swapChainFlags);
         if (FAILED(result)) {
             WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain::ResizeBuffers"), result);
             goto done;
@@ -1096,6 +1417,16 @@ static HRESULT D3D11_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
     }
 #endif
 
+    data->backBufferWidth = w;
+    data->backBufferHeight = h;
+    if (data->sourceWidth > 0 && data->sourceHeight > 0) {
+        // Resizing the buffers resets the source size
+        result = D3D11_UpdateSourceSize(renderer);
+        if (FAILED(result)) {
+            goto done;
+        }
+    }
+
     result = IDXGISwapChain_GetBuffer(data->swapChain,
                                       0,
                                       &SDL_IID_ID3D11Texture2D,
@@ -1133,7 +1464,25 @@ done:
 
 static bool D3D11_HandleDeviceLost(SDL_Renderer *renderer)
 {
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
     bool recovered = false;
+    Uint64 started = SDL_GetTicksNS();
+    int restorable = 0;
+
+    // Restorable textures keep their shadow copy and get recreated on first use
+    for (SDL_Texture *texture = renderer->textures; texture; texture = texture->next) {
+        D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+        if (textureData && textureData->shadowPixels) {
+            D3D11_ReleaseTextureResources(textureData);
+            SDL_SetPointerProperty(SDL_GetTextureProperties(texture), SDL_PROP_TEXTURE_D3D11_TEXTURE_POINTER, NULL);
+            if (!textureData->needsRestore) {
+                textureData->needsRestore = true;
+                ++restorable;
+            }
+        }
+    }
+    data->texturesPendingRestore += restorable;
+    data->textureRestoreNS = 0;
 
     D3D11_ReleaseAll(renderer);
 
@@ -1144,6 +1493,8 @@ static bool D3D11_HandleDeviceLost(SDL_Renderer *renderer)
         SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Renderer couldn't recover from device lost: %s", SDL_GetError());
         D3D11_ReleaseAll(renderer);
     }
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Device reset took %" SDL_PRIu64 " ms, %d textures will be restored on first use",
+                 (SDL_GetTicksNS() - started) / SDL_NS_PER_MS, data->texturesPendingRestore);
 
     // Let the application know that the device has been reset or lost
     SDL_Event event;
@@ -1168,6 +1519,7 @@ void D3D11_Trim(SDL_Renderer *renderer)
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
     HRESULT result = S_OK;
     IDXGIDevice3 *dxgiDevice = NULL;
+    Uint64 started;
 
     result = ID3D11Device_QueryInterface(data->d3dDevice, &SDL_IID_IDXGIDevice3, &dxgiDevice);
     if (FAILED(result)) {
@@ -1175,19 +1527,86 @@ void D3D11_Trim(SDL_Renderer *renderer)
         return;
     }
 
+    started = SDL_GetTicksNS();
     IDXGIDevice3_Trim(dxgiDevice);
     SAFE_RELEASE(dxgiDevice);
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Trim took %" SDL_PRIu64 " us", (SDL_GetTicksNS() - started) / SDL_NS_PER_US);
 #endif
 #endif
 }
 
+// How long the window size has to stay the same before a deferred resize is applied
+#define D3D11_LIVE_RESIZE_SETTLE_NS (100 * SDL_NS_PER_MS)
+
+/* Whether a pending resize is left to D3D11_RenderPresent, which keeps the compositor
+ * stretching the current back buffer over the window until the size settles.
+ */
+static bool D3D11_CanDeferResize(SDL_Renderer *renderer)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+
+    return data->pixelSizeChanged && data->liveResize &&
+           data->mainRenderTargetView &&
+           data->swapEffect == DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL &&
+           data->swapChainScaling == DXGI_SCALING_STRETCH;
+}
+
 static void D3D11_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
 {
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
 
     if (event->type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
+        // The resize is done once, before the next frame is drawn
         data->pixelSizeChanged = true;
+        data->pixelSizeChangedNS = SDL_GetTicksNS();
+    }
+}
+
+static bool D3D11_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    int window_w, window_h;
+
+    if (D3D11_CanDeferResize(renderer)) {
+        // Keep drawing at the size of the back buffer until the resize is applied
+        window_w = data->outputWidth;
+        window_h = data->outputHeight;
+    } else if (!SDL_GetWindowSizeInPixels(renderer->window, &window_w, &window_h)) {
+        return false;
+    }
+    if (data->sourceWidth > 0 && data->sourceHeight > 0) {
+        window_w = SDL_min(data->sourceWidth, window_w);
+        window_h = SDL_min(data->sourceHeight, window_h);
+    }
+    if (w) {
+        *w = window_w;
+    }
+    if (h) {
+        *h = window_h;
+    }
+    return true;
+}
+
+static bool D3D11_SetOutputSourceSize(SDL_Renderer *renderer, int w, int h)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+
+    if (!data->swapChain ||
+        data->swapEffect != DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL ||
+        data->swapChainScaling != DXGI_SCALING_STRETCH) {
+        // Only flip model swap chains can present a region, and it's only scaled with stretch scaling
+        return SDL_Unsupported();
+    }
+
+    if (w == 0 || h == 0) {
+        w = h = 0;
+    }
+    data->sourceWidth = w;
+    data->sourceHeight = h;
+    if (FAILED(D3D11_UpdateSourceSize(renderer))) {
+        return false;
     }
+    return true;
 }
 
 static bool D3D11_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode)
@@ -1228,6 +1647,7 @@ static bool D3D11_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SD
     DXGI_FORMAT textureFormat = SDLPixelFormatToDXGITextureFormat(texture->format, renderer->output_colorspace);
     D3D11_TEXTURE2D_DESC textureDesc;
     D3D11_SHADER_RESOURCE_VIEW_DESC resourceViewDesc;
+    bool restorable = SDL_GetBooleanProperty(create_props, SDL_PROP_TEXTURE_CREATE_D3D11_RESTORABLE_BOOLEAN, false);
 
     if (!rendererData->d3dDevice) {
         return SDL_SetError("Device lost and couldn't be recovered");
@@ -1280,6 +1700,8 @@ static bool D3D11_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SD
 
     if (texture->access == SDL_TEXTUREACCESS_TARGET) {
         textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+        // The contents of render targets only exist on the GPU
+        restorable = false;
     } else {
         textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
     }
@@ -1287,7 +1709,10 @@ static bool D3D11_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SD
     if (!GetTextureProperty(create_props, SDL_PROP_TEXTURE_CREATE_D3D11_TEXTURE_POINTER, &textureData->mainTexture)) {
         return false;
     }
-    if (!textureData->mainTexture) {
+    if (textureData->mainTexture) {
+        // We don't own the contents of external textures, so they can't be restored
+        restorable = false;
+    } else {
         result = ID3D11Device_CreateTexture2D(rendererData->d3dDevice,
                                               &textureDesc,
                                               NULL,
@@ -1406,8 +1831,29 @@ static bool D3D11_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SD
             return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateShaderResourceView"), result);
         }
     }
+
+    if (textureData->yuv || textureData->nv12) {
+        restorable = false;
+    }
 #endif // SDL_HAVE_YUV
 
+    if (restorable) {
+        int shadowRows = textureData->h;
+        if (SDL_GetCompressedBlockBytes(texture->format)) {
+            // The shadow copy holds rows of compressed blocks
+            textureData->shadowPitch = (textureData->w / SDL_COMPRESSED_BLOCK_SIZE) * SDL_GetCompressedBlockBytes(texture->format);
+            shadowRows = textureData->h / SDL_COMPRESSED_BLOCK_SIZE;
+        } else {
+            textureData->shadowPitch = textureData->w * SDL_BYTESPERPIXEL(texture->format);
+        }
+        textureData->shadowPixels = (Uint8 *)SDL_calloc(shadowRows, textureData->shadowPitch);
+        if (!textureData->shadowPixels) {
+            return false;
+        }
+        textureData->restoreDesc = textureDesc;
+        textureData->restoreResourceViewDesc = resourceViewDesc;
+    }
+
     if (texture->access & SDL_TEXTUREACCESS_TARGET) {
         D3D11_RENDER_TARGET_VIEW_DESC renderTargetViewDesc;
         SDL_zero(renderTargetViewDesc);
@@ -1427,130 +1873,476 @@ static bool D3D11_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SD
     return true;
 }
 
-static void D3D11_DestroyTexture(SDL_Renderer *renderer,
-                                 SDL_Texture *texture)
+static void D3D11_ReleaseTextureResources(D3D11_TextureData *data)
 {
-    D3D11_TextureData *data = (D3D11_TextureData *)texture->internal;
-
-    if (!data) {
-        return;
-    }
-
     SAFE_RELEASE(data->mainTexture);
     SAFE_RELEASE(data->mainTextureResourceView);
     SAFE_RELEASE(data->mainTextureRenderTargetView);
-    SAFE_RELEASE(data->stagingTexture);
+    if (data->stagingEntry) {
+        // The texture is still mapped, so the pool can't hand it out again
+        D3D11_ReleaseStagingEntry(data->stagingEntry);
+        data->stagingEntry = NULL;
+        data->stagingTexture = NULL;
+    } else {
+        SAFE_RELEASE(data->stagingTexture);
+    }
 #ifdef SDL_HAVE_YUV
     SAFE_RELEASE(data->mainTextureU);
     SAFE_RELEASE(data->mainTextureResourceViewU);
     SAFE_RELEASE(data->mainTextureV);
     SAFE_RELEASE(data->mainTextureResourceViewV);
     SAFE_RELEASE(data->mainTextureResourceViewNV);
+#endif
+}
+
+static void D3D11_DestroyTexture(SDL_Renderer *renderer,
+                                 SDL_Texture *texture)
+{
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *data = (D3D11_TextureData *)texture->internal;
+
+    if (!data) {
+        return;
+    }
+
+    if (data->needsRestore) {
+        --rendererData->texturesPendingRestore;
+    }
+#ifdef SDL_VIDEO_OPENGL_WGL
+    D3D11_UnshareTextureWithGL(renderer, texture);
+#endif
+    D3D11_ReleaseTextureResources(data);
+#ifdef SDL_HAVE_YUV
     SDL_free(data->pixels);
 #endif
+    SDL_free(data->shadowPixels);
     SDL_free(data);
     texture->internal = NULL;
 }
 
-static bool D3D11_UpdateTextureInternal(D3D11_RenderData *rendererData, ID3D11Texture2D *texture, int bpp, int x, int y, int w, int h, const void *pixels, int pitch)
+static bool D3D11_RestoreTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
-    ID3D11Texture2D *stagingTexture;
-    const Uint8 *src;
-    Uint8 *dst;
-    int row;
-    UINT length;
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+    D3D11_SUBRESOURCE_DATA initialData;
     HRESULT result;
-    D3D11_TEXTURE2D_DESC stagingTextureDesc;
-    D3D11_MAPPED_SUBRESOURCE textureMemory;
+    Uint64 started;
 
-    // Create a 'staging' texture, which will be used to write to a portion of the main texture.
-    ID3D11Texture2D_GetDesc(texture, &stagingTextureDesc);
-    stagingTextureDesc.Width = w;
-    stagingTextureDesc.Height = h;
-    stagingTextureDesc.BindFlags = 0;
-    stagingTextureDesc.MiscFlags = 0;
-    stagingTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    stagingTextureDesc.Usage = D3D11_USAGE_STAGING;
-    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
-        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
-        stagingTextureDesc.Width = (stagingTextureDesc.Width + 1) & ~1;
-        stagingTextureDesc.Height = (stagingTextureDesc.Height + 1) & ~1;
+    if (!rendererData->d3dDevice) {
+        return SDL_SetError("Device lost and couldn't be recovered");
     }
+
+    started = SDL_GetTicksNS();
+
+    SDL_zero(initialData);
+    initialData.pSysMem = textureData->shadowPixels;
+    initialData.SysMemPitch = textureData->shadowPitch;
     result = ID3D11Device_CreateTexture2D(rendererData->d3dDevice,
-                                          &stagingTextureDesc,
-                                          NULL,
-                                          &stagingTexture);
+                                          &textureData->restoreDesc,
+                                          &initialData,
+                                          &textureData->mainTexture);
     if (FAILED(result)) {
-        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
+        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [restore texture]"), result);
     }
 
-    // Get a write-only pointer to data in the staging texture:
-    result = ID3D11DeviceContext_Map(rendererData->d3dContext,
-                                     (ID3D11Resource *)stagingTexture,
-                                     0,
-                                     D3D11_MAP_WRITE,
-                                     0,
-                                     &textureMemory);
+    result = ID3D11Device_CreateShaderResourceView(rendererData->d3dDevice,
+                                                   (ID3D11Resource *)textureData->mainTexture,
+                                                   &textureData->restoreResourceViewDesc,
+                                                   &textureData->mainTextureResourceView);
     if (FAILED(result)) {
-        SAFE_RELEASE(stagingTexture);
-        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [map staging texture]"), result);
+        SAFE_RELEASE(textureData->mainTexture);
+        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateShaderResourceView [restore texture]"), result);
     }
+    SDL_SetPointerProperty(SDL_GetTextureProperties(texture), SDL_PROP_TEXTURE_D3D11_TEXTURE_POINTER, textureData->mainTexture);
 
-    src = (const Uint8 *)pixels;
-    dst = (Uint8 *)textureMemory.pData;
-    length = w * bpp;
-    if (length == (UINT)pitch && length == textureMemory.RowPitch) {
-        SDL_memcpy(dst, src, (size_t)length * h);
-    } else {
-        if (length > (UINT)pitch) {
-            length = pitch;
-        }
-        if (length > textureMemory.RowPitch) {
-            length = textureMemory.RowPitch;
-        }
-        for (row = 0; row < h; ++row) {
-            SDL_memcpy(dst, src, length);
-            src += pitch;
-            dst += textureMemory.RowPitch;
-        }
+    textureData->needsRestore = false;
+    rendererData->textureRestoreNS += (SDL_GetTicksNS() - started);
+    if (--rendererData->texturesPendingRestore == 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Restoring textures took %" SDL_PRIu64 " ms",
+                     rendererData->textureRestoreNS / SDL_NS_PER_MS);
     }
+    return true;
+}
 
-    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
-        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
-        // Copy the UV plane as well
-        h = (h + 1) / 2;
-        if (stagingTextureDesc.Format == DXGI_FORMAT_P010) {
-            length = (length + 3) & ~3;
-            pitch = (pitch + 3) & ~3;
-        } else {
-            length = (length + 1) & ~1;
-            pitch = (pitch + 1) & ~1;
-        }
-        dst = (Uint8 *)textureMemory.pData + stagingTextureDesc.Height * textureMemory.RowPitch;
-        for (row = 0; row < h; ++row) {
-            SDL_memcpy(dst, src, length);
-            src += pitch;
-            dst += textureMemory.RowPitch;
-        }
+static void D3D11_UpdateTextureShadow(D3D11_TextureData *textureData, int bpp, const SDL_Rect *rect, const Uint8 *pixels, int pitch)
+{
+    Uint8 *dst = textureData->shadowPixels + rect->y * textureData->shadowPitch + rect->x * bpp;
+    const size_t length = (size_t)rect->w * bpp;
+    int row;
+
+    for (row = 0; row < rect->h; ++row) {
+        SDL_memcpy(dst, pixels, length);
+        pixels += pitch;
+        dst += textureData->shadowPitch;
     }
+}
 
-    // Commit the pixel buffer's changes back to the staging texture:
-    ID3D11DeviceContext_Unmap(rendererData->d3dContext,
-                              (ID3D11Resource *)stagingTexture,
-                              0);
+#ifdef SDL_VIDEO_OPENGL_WGL
+static bool D3D11_InitGLInterop(D3D11_RenderData *rendererData)
+{
+    D3D11_GLInterop *interop = &rendererData->glInterop;
 
-    // Copy the staging texture's contents back to the texture:
-    ID3D11DeviceContext_CopySubresourceRegion(rendererData->d3dContext,
-                                              (ID3D11Resource *)texture,
-                                              0,
-                                              x,
-                                              y,
-                                              0,
-                                              (ID3D11Resource *)stagingTexture,
-                                              0,
-                                              NULL);
+    if (interop->device) {
+        return true;
+    }
 
-    SAFE_RELEASE(stagingTexture);
+    if (!rendererData->d3dDevice) {
+        return SDL_SetError("Device lost and couldn't be recovered");
+    }
+    if (!SDL_GL_GetCurrentContext()) {
+        return SDL_SetError("No OpenGL context is current");
+    }
+
+    interop->wglDXOpenDeviceNV = (HANDLE(WINAPI *)(void *))SDL_GL_GetProcAddress("wglDXOpenDeviceNV");
+    interop->wglDXCloseDeviceNV = (BOOL(WINAPI *)(HANDLE))SDL_GL_GetProcAddress("wglDXCloseDeviceNV");
+    interop->wglDXRegisterObjectNV = (HANDLE(WINAPI *)(HANDLE, void *, unsigned int, unsigned int, unsigned int))SDL_GL_GetProcAddress("wglDXRegisterObjectNV");
+    interop->wglDXUnregisterObjectNV = (BOOL(WINAPI *)(HANDLE, HANDLE))SDL_GL_GetProcAddress("wglDXUnregisterObjectNV");
+    interop->wglDXLockObjectsNV = (BOOL(WINAPI *)(HANDLE, int, HANDLE *))SDL_GL_GetProcAddress("wglDXLockObjectsNV");
+    interop->wglDXUnlockObjectsNV = (BOOL(WINAPI *)(HANDLE, int, HANDLE *))SDL_GL_GetProcAddress("wglDXUnlockObjectsNV");
+    interop->glGenTextures = (void(APIENTRY *)(int, unsigned int *))SDL_GL_GetProcAddress("glGenTextures");
+    interop->glDeleteTextures = (void(APIENTRY *)(int, const unsigned int *))SDL_GL_GetProcAddress("glDeleteTextures");
+    if (!interop->wglDXOpenDeviceNV || !interop->wglDXCloseDeviceNV ||
+        !interop->wglDXRegisterObjectNV || !interop->wglDXUnregisterObjectNV ||
+        !interop->wglDXLockObjectsNV || !interop->wglDXUnlockObjectsNV ||
+        !interop->glGenTextures || !interop->glDeleteTextures) {
+        return SDL_SetError("OpenGL driver doesn't support WGL_NV_DX_interop2");
+    }
+
+    interop->device = interop->wglDXOpenDeviceNV(rendererData->d3dDevice);
+    if (!interop->device) {
+        return WIN_SetError("wglDXOpenDeviceNV()");
+    }
+    return true;
+}
+
+static bool D3D11_ShareTextureWithGL(SDL_Renderer *renderer, SDL_Texture *texture, Uint32 *gl_texture)
+{
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+    D3D11_GLInterop *interop = &rendererData->glInterop;
+    unsigned int name = 0;
+
+    if (!textureData) {
+        return SDL_SetError("Texture is not currently available");
+    }
+#ifdef SDL_HAVE_YUV
+    if (textureData->yuv || textureData->nv12) {
+        return SDL_SetError("YUV textures can't be shared with OpenGL");
+    }
+#endif
+    if (textureData->glInteropObject) {
+        *gl_texture = textureData->glInteropTexture;
+        return true;
+    }
+    if (textureData->needsRestore && !D3D11_RestoreTexture(renderer, texture)) {
+        return false;
+    }
+    if (!D3D11_InitGLInterop(rendererData)) {
+        return false;
+    }
+
+    interop->glGenTextures(1, &name);
+    textureData->glInteropObject = interop->wglDXRegisterObjectNV(interop->device, textureData->mainTexture, name, D3D11_GL_TEXTURE_2D, WGL_ACCESS_READ_WRITE_NV);
+    if (!textureData->glInteropObject) {
+        interop->glDeleteTextures(1, &name);
+        return WIN_SetError("wglDXRegisterObjectNV()");
+    }
+    textureData->glInteropTexture = name;
+
+    *gl_texture = name;
+    return true;
+}
+
+static bool D3D11_AcquireTextureForGL(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+
+    if (!textureData || !textureData->glInteropObject) {
+        return SDL_SetError("Texture isn't shared with OpenGL");
+    }
+    if (textureData->glInteropAcquired) {
+        return SDL_SetError("Texture is already acquired by OpenGL");
+    }
+
+    // Make sure Direct3D is done submitting work that touches the texture
+    ID3D11DeviceContext_Flush(rendererData->d3dContext);
+
+    if (!rendererData->glInterop.wglDXLockObjectsNV(rendererData->glInterop.device, 1, &textureData->glInteropObject)) {
+        return WIN_SetError("wglDXLockObjectsNV()");
+    }
+    textureData->glInteropAcquired = true;
+    return true;
+}
+
+static bool D3D11_ReleaseTextureForGL(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+
+    if (!textureData || !textureData->glInteropAcquired) {
+        return SDL_SetError("Texture isn't acquired by OpenGL");
+    }
+
+    if (!rendererData->glInterop.wglDXUnlockObjectsNV(rendererData->glInterop.device, 1, &textureData->glInteropObject)) {
+        return WIN_SetError("wglDXUnlockObjectsNV()");
+    }
+    textureData->glInteropAcquired = false;
+    return true;
+}
+
+static void D3D11_UnshareTextureWithGL(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
+    D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
+    D3D11_GLInterop *interop = &rendererData->glInterop;
+
+    if (!textureData || !textureData->glInteropObject) {
+        return;
+    }
+
+    if (textureData->glInteropAcquired) {
+        interop->wglDXUnlockObjectsNV(interop->device, 1, &textureData->glInteropObject);
+        textureData->glInteropAcquired = false;
+    }
+    interop->wglDXUnregisterObjectNV(interop->device, textureData->glInteropObject);
+    textureData->glInteropObject = NULL;
+    interop->glDeleteTextures(1, &textureData->glInteropTexture);
+    textureData->glInteropTexture = 0;
+}
+#endif // SDL_VIDEO_OPENGL_WGL
+
+static UINT D3D11_GetStagingBucketSize(UINT size)
+{
+    UINT bucket = D3D11_STAGING_MIN_SIZE;
+    while (bucket < size) {
+        bucket *= 2;
+    }
+    return bucket;
+}
+
+static bool D3D11_IsStagingEntryIdle(D3D11_RenderData *rendererData, D3D11_StagingTexture *entry)
+{
+    if (entry->locked) {
+        return false;
+    }
+    if (entry->pending) {
+        if (entry->query &&
+            ID3D11DeviceContext_GetData(rendererData->d3dContext, (ID3D11Asynchronous *)entry->query, NULL, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) {
+            return false;
+        }
+        entry->pending = false;
+    }
+    return true;
+}
+
+/* Get a staging texture for writing a w x h region of a texture with the given description.
+ * The returned texture may be larger than requested, and must be handed back with
+ * D3D11_CopyFromStagingTexture().
+ */
+static ID3D11Texture2D *D3D11_AcquireStagingTexture(D3D11_RenderData *rendererData, const D3D11_TEXTURE2D_DESC *textureDesc, UINT w, UINT h, D3D11_StagingTexture **entry)
+{
+    D3D11_TEXTURE2D_DESC stagingTextureDesc;
+    D3D11_StagingTexture *slot = NULL;
+    ID3D11Texture2D *stagingTexture = NULL;
+    HRESULT result;
+    int i;
+
+    stagingTextureDesc = *textureDesc;
+    stagingTextureDesc.BindFlags = 0;
+    stagingTextureDesc.MiscFlags = 0;
+    stagingTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    stagingTextureDesc.Usage = D3D11_USAGE_STAGING;
+    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
+        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
+        // The chroma plane is located by the texture height, so planar textures need an exact fit
+        stagingTextureDesc.Width = (w + 1) & ~1;
+        stagingTextureDesc.Height = (h + 1) & ~1;
+    } else {
+        stagingTextureDesc.Width = D3D11_GetStagingBucketSize(w);
+        stagingTextureDesc.Height = D3D11_GetStagingBucketSize(h);
+    }
+
+    for (i = 0; i < SDL_arraysize(rendererData->stagingPool); ++i) {
+        D3D11_StagingTexture *candidate = &rendererData->stagingPool[i];
+        if (candidate->texture &&
+            candidate->format == stagingTextureDesc.Format &&
+            candidate->width == stagingTextureDesc.Width &&
+            candidate->height == stagingTextureDesc.Height &&
+            D3D11_IsStagingEntryIdle(rendererData, candidate)) {
+            ++rendererData->stagingPoolHits;
+            candidate->locked = true;
+            *entry = candidate;
+            return candidate->texture;
+        }
+    }
+
+    ++rendererData->stagingPoolMisses;
+
+    // Use an empty slot, or replace an idle staging texture of another size
+    for (i = 0; i < SDL_arraysize(rendererData->stagingPool); ++i) {
+        if (!rendererData->stagingPool[i].texture) {
+            slot = &rendererData->stagingPool[i];
+            break;
+        }
+    }
+    if (!slot) {
+        for (i = 0; i < SDL_arraysize(rendererData->stagingPool); ++i) {
+            if (D3D11_IsStagingEntryIdle(rendererData, &rendererData->stagingPool[i])) {
+                slot = &rendererData->stagingPool[i];
+                D3D11_ReleaseStagingEntry(slot);
+                break;
+            }
+        }
+    }
+
+    result = ID3D11Device_CreateTexture2D(rendererData->d3dDevice,
+                                          &stagingTextureDesc,
+                                          NULL,
+                                          &stagingTexture);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
+        return NULL;
+    }
+
+    if (slot) {
+        D3D11_QUERY_DESC queryDesc;
+
+        SDL_zero(queryDesc);
+        queryDesc.Query = D3D11_QUERY_EVENT;
+        if (FAILED(ID3D11Device_CreateQuery(rendererData->d3dDevice, &queryDesc, &slot->query))) {
+            // Without a query the texture is treated as idle, the driver will wait if it isn't
+            slot->query = NULL;
+        }
+        slot->texture = stagingTexture;
+        slot->format = stagingTextureDesc.Format;
+        slot->width = stagingTextureDesc.Width;
+        slot->height = stagingTextureDesc.Height;
+        slot->locked = true;
+        slot->pending = false;
+    }
+    // else every pooled texture is in flight, use a one-off staging texture
+
+    *entry = slot;
+    return stagingTexture;
+}
+
+// Copy a w x h region from a staging texture into a texture, and hand the staging texture back
+static void D3D11_CopyFromStagingTexture(D3D11_RenderData *rendererData, ID3D11Texture2D *texture, int x, int y, int w, int h, ID3D11Texture2D *stagingTexture, D3D11_StagingTexture *entry)
+{
+    D3D11_TEXTURE2D_DESC stagingTextureDesc;
+    D3D11_BOX box;
+
+    box.left = 0;
+    box.top = 0;
+    box.front = 0;
+    box.right = w;
+    box.bottom = h;
+    box.back = 1;
+    ID3D11Texture2D_GetDesc(stagingTexture, &stagingTextureDesc);
+    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
+        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
+        // Planar staging textures are an exact fit
+        ID3D11DeviceContext_CopySubresourceRegion(rendererData->d3dContext,
+                                                  (ID3D11Resource *)texture,
+                                                  0, x, y, 0,
+                                                  (ID3D11Resource *)stagingTexture,
+                                                  0, NULL);
+    } else {
+        ID3D11DeviceContext_CopySubresourceRegion(rendererData->d3dContext,
+                                                  (ID3D11Resource *)texture,
+                                                  0, x, y, 0,
+                                                  (ID3D11Resource *)stagingTexture,
+                                                  0, &box);
+    }
+
+    if (entry) {
+        if (entry->query) {
+            ID3D11DeviceContext_End(rendererData->d3dContext, (ID3D11Asynchronous *)entry->query);
+            entry->pending = true;
+        }
+        entry->locked = false;
+    } else {
+        SAFE_RELEASE(stagingTexture);
+    }
+}
+
+static bool D3D11_UpdateTextureInternal(D3D11_RenderData *rendererData, ID3D11Texture2D *texture, int bpp, int x, int y, int w, int h, const void *pixels, int pitch)
+{
+    ID3D11Texture2D *stagingTexture;
+    D3D11_StagingTexture *stagingEntry;
+    const Uint8 *src;
+    Uint8 *dst;
+    UINT length;
+    HRESULT result;
+    D3D11_TEXTURE2D_DESC stagingTextureDesc;
+    D3D11_MAPPED_SUBRESOURCE textureMemory;
+    const int copy_w = w;
+    const int copy_h = h;
+
+    // Get a 'staging' texture, which will be used to write to a portion of the main texture.
+    ID3D11Texture2D_GetDesc(texture, &stagingTextureDesc);
+    stagingTexture = D3D11_AcquireStagingTexture(rendererData, &stagingTextureDesc, w, h, &stagingEntry);
+    if (!stagingTexture) {
+        return false;
+    }
+    ID3D11Texture2D_GetDesc(stagingTexture, &stagingTextureDesc);
+
+    // Get a write-only pointer to data in the staging texture:
+    result = ID3D11DeviceContext_Map(rendererData->d3dContext,
+                                     (ID3D11Resource *)stagingTexture,
+                                     0,
+                                     D3D11_MAP_WRITE,
+                                     0,
+                                     &textureMemory);
+    if (FAILED(result)) {
+        if (stagingEntry) {
+            stagingEntry->locked = false;
+        } else {
+            SAFE_RELEASE(stagingTexture);
+        }
+        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [map staging texture]"), result);
+    }
+
+    src = (const Uint8 *)pixels;
+    dst = (Uint8 *)textureMemory.pData;
+    if (D3D11_IsBlockCompressedFormat(stagingTextureDesc.Format)) {
+        // Copy rows of 4x4 blocks, bpp is the size of a block
+        w /= SDL_COMPRESSED_BLOCK_SIZE;
+        h /= SDL_COMPRESSED_BLOCK_SIZE;
+    }
+    length = w * bpp;
+    if (length > (UINT)pitch) {
+        length = pitch;
+    }
+    if (length > textureMemory.RowPitch) {
+        length = textureMemory.RowPitch;
+    }
+    SDL_memcpy_rows(dst, textureMemory.RowPitch, src, pitch, length, h);
+    src += (size_t)pitch * h;
+
+    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
+        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
+        // Copy the UV plane as well
+        h = (h + 1) / 2;
+        if (stagingTextureDesc.Format == DXGI_FORMAT_P010) {
+            length = (length + 3) & ~3;
+            pitch = (pitch + 3) & ~3;
+        } else {
+            length = (length + 1) & ~1;
+            pitch = (pitch + 1) & ~1;
+        }
+        dst = (Uint8 *)textureMemory.pData + stagingTextureDesc.Height * textureMemory.RowPitch;
+        SDL_memcpy_rows(dst, textureMemory.RowPitch, src, pitch, length, h);
+    }
+
+    // Commit the pixel buffer's changes back to the staging texture:
+    ID3D11DeviceContext_Unmap(rendererData->d3dContext,
+                              (ID3D11Resource *)stagingTexture,
+                              0);
+
+    // Copy the staging texture's contents back to the texture:
+    D3D11_CopyFromStagingTexture(rendererData, texture, x, y, copy_w, copy_h, stagingTexture, stagingEntry);
 
     return true;
 }
@@ -1601,9 +2393,33 @@ static bool D3D11_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
     }
 #endif
 
+    if (textureData->needsRestore && !D3D11_RestoreTexture(renderer, texture)) {
+        return false;
+    }
+
+    if (SDL_GetCompressedBlockBytes(texture->format)) {
+        const int blockBytes = SDL_GetCompressedBlockBytes(texture->format);
+
+        if (!D3D11_UpdateTextureInternal(rendererData, textureData->mainTexture, blockBytes, rect->x, rect->y, rect->w, rect->h, srcPixels, srcPitch)) {
+            return false;
+        }
+        if (textureData->shadowPixels) {
+            SDL_Rect blockRect;
+            blockRect.x = rect->x / SDL_COMPRESSED_BLOCK_SIZE;
+            blockRect.y = rect->y / SDL_COMPRESSED_BLOCK_SIZE;
+            blockRect.w = rect->w / SDL_COMPRESSED_BLOCK_SIZE;
+            blockRect.h = rect->h / SDL_COMPRESSED_BLOCK_SIZE;
+            D3D11_UpdateTextureShadow(textureData, blockBytes, &blockRect, (const Uint8 *)srcPixels, srcPitch);
+        }
+        return true;
+    }
+
     if (!D3D11_UpdateTextureInternal(rendererData, textureData->mainTexture, SDL_BYTESPERPIXEL(texture->format), rect->x, rect->y, rect->w, rect->h, srcPixels, srcPitch)) {
         return false;
     }
+    if (textureData->shadowPixels) {
+        D3D11_UpdateTextureShadow(textureData, SDL_BYTESPERPIXEL(texture->format), rect, (const Uint8 *)srcPixels, srcPitch);
+    }
     return true;
 }
 
@@ -1641,9 +2457,10 @@ static bool D3D11_UpdateTextureNV(SDL_Renderer *renderer, SDL_Texture *texture,
     D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
     D3D11_TextureData *textureData = (D3D11_TextureData *)texture->internal;
     ID3D11Texture2D *stagingTexture;
+    D3D11_StagingTexture *stagingEntry;
     const Uint8 *src;
     Uint8 *dst;
-    int w, h, row;
+    int w, h;
     UINT length;
     HRESULT result;
     D3D11_TEXTURE2D_DESC stagingTextureDesc;
@@ -1656,26 +2473,13 @@ static bool D3D11_UpdateTextureNV(SDL_Renderer *renderer, SDL_Texture *texture,
     w = rect->w;
     h = rect->h;
 
-    // Create a 'staging' texture, which will be used to write to a portion of the main texture.
+    // Get a 'staging' texture, which will be used to write to a portion of the main texture.
     ID3D11Texture2D_GetDesc(textureData->mainTexture, &stagingTextureDesc);
-    stagingTextureDesc.Width = w;
-    stagingTextureDesc.Height = h;
-    stagingTextureDesc.BindFlags = 0;
-    stagingTextureDesc.MiscFlags = 0;
-    stagingTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    stagingTextureDesc.Usage = D3D11_USAGE_STAGING;
-    if (stagingTextureDesc.Format == DXGI_FORMAT_NV12 ||
-        stagingTextureDesc.Format == DXGI_FORMAT_P010) {
-        stagingTextureDesc.Width = (stagingTextureDesc.Width + 1) & ~1;
-        stagingTextureDesc.Height = (stagingTextureDesc.Height + 1) & ~1;
-    }
-    result = ID3D11Device_CreateTexture2D(rendererData->d3dDevice,
-                                          &stagingTextureDesc,
-                                          NULL,
-                                          &stagingTexture);
-    if (FAILED(result)) {
-        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
+    stagingTexture = D3D11_AcquireStagingTexture(rendererData, &stagingTextureDesc, w, h, &stagingEntry);
+    if (!stagingTexture) {
+        return false;
     }
+    ID3D11Texture2D_GetDesc(stagingTexture, &stagingTextureDesc);
 
     // Get a write-only pointer to data in the staging texture:
     result = ID3D11DeviceContext_Map(rendererData->d3dContext,
@@ -1685,28 +2489,24 @@ static bool D3D11_UpdateTextureNV(SDL_Renderer *renderer, SDL_Texture *texture,
                                      0,
                                      &textureMemory);
     if (FAILED(result)) {
-        SAFE_RELEASE(stagingTexture);
+        if (stagingEntry) {
+            stagingEntry->locked = false;
+        } else {
+            SAFE_RELEASE(stagingTexture);
+        }
         return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [map staging texture]"), result);
     }
 
     src = Yplane;
     dst = (Uint8 *)textureMemory.pData;
     length = w;
-    if (length == (UINT)Ypitch && length == textureMemory.RowPitch) {
-        SDL_memcpy(dst, src, (size_t)length * h);
-    } else {
-        if (length > (UINT)Ypitch) {
-            length = Ypitch;
-        }
-        if (length > textureMemory.RowPitch) {
-            length = textureMemory.RowPitch;
-        }
-        for (row = 0; row < h; ++row) {
-            SDL_memcpy(dst, src, length);
-            src += Ypitch;
-            dst += textureMemory.RowPitch;
-        }
+    if (length > (UINT)Ypitch) {
+        length = Ypitch;
+    }
+    if (length > textureMemory.RowPitch) {
+        length = textureMemory.RowPitch;
     }
+    SDL_memcpy_rows(dst, textureMemory.RowPitch, src, Ypitch, length, h);
 
     src = UVplane;
     length = w;
@@ -1719,11 +2519,7 @@ static bool D3D11_UpdateTextureNV(SDL_Renderer *renderer, SDL_Texture *texture,
         UVpitch = (UVpitch + 1) & ~1;
     }
     dst = (Uint8 *)textureMemory.pData + stagingTextureDesc.Height * textureMemory.RowPitch;
-    for (row = 0; row < h; ++row) {
-        SDL_memcpy(dst, src, length);
-        src += UVpitch;
-        dst += textureMemory.RowPitch;
-    }
+    SDL_memcpy_rows(dst, textureMemory.RowPitch, src, UVpitch, length, h);
 
     // Commit the pixel buffer's changes back to the staging texture:
     ID3D11DeviceContext_Unmap(rendererData->d3dContext,
@@ -1731,17 +2527,7 @@ static bool D3D11_UpdateTextureNV(SDL_Renderer *renderer, SDL_Texture *texture,
                               0);
 
     // Copy the staging texture's contents back to the texture:
-    ID3D11DeviceContext_CopySubresourceRegion(rendererData->d3dContext,
-                                              (ID3D11Resource *)textureData->mainTexture,
-                                              0,
-                                              rect->x,
-                                              rect->y,
-                                              0,
-                                              (ID3D11Resource *)stagingTexture,
-                                              0,
-                                              NULL);
-
-    SAFE_RELEASE(stagingTexture);
+    D3D11_CopyFromStagingTexture(rendererData, textureData->mainTexture, rect->x, rect->y, rect->w, rect->h, stagingTexture, stagingEntry);
 
     return true;
 }
@@ -1777,9 +2563,18 @@ static bool D3D11_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
         return true;
     }
 #endif
-    if (textureData->stagingTexture) {
+    if (textureData->stagingTexture || textureData->shadowLocked) {
         return SDL_SetError("texture is already locked");
     }
+    if (textureData->shadowPixels) {
+        // Write straight into the shadow copy, it gets uploaded on unlock
+        textureData->shadowLocked = true;
+        textureData->shadowLockedRect = *rect;
+        *pixels = textureData->shadowPixels + rect->y * textureData->shadowPitch +
+                  rect->x * SDL_BYTESPERPIXEL(texture->format);
+        *pitch = textureData->shadowPitch;
+        return true;
+    }
 
     /* Create a 'staging' texture, which will be used to write to a portion
      * of the main texture.  This is necessary, as Direct3D 11.1 does not
@@ -1790,18 +2585,9 @@ static bool D3D11_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
      * TODO, WinRT: consider avoiding the use of a staging texture in D3D11_LockTexture if/when the entire texture is being updated
      */
     ID3D11Texture2D_GetDesc(textureData->mainTexture, &stagingTextureDesc);
-    stagingTextureDesc.Width = rect->w;
-    stagingTextureDesc.Height = rect->h;
-    stagingTextureDesc.BindFlags = 0;
-    stagingTextureDesc.MiscFlags = 0;
-    stagingTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    stagingTextureDesc.Usage = D3D11_USAGE_STAGING;
-    result = ID3D11Device_CreateTexture2D(rendererData->d3dDevice,
-                                          &stagingTextureDesc,
-                                          NULL,
-                                          &textureData->stagingTexture);
-    if (FAILED(result)) {
-        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
+    textureData->stagingTexture = D3D11_AcquireStagingTexture(rendererData, &stagingTextureDesc, rect->w, rect->h, &textureData->stagingEntry);
+    if (!textureData->stagingTexture) {
+        return false;
     }
 
     // Get a write-only pointer to data in the staging texture:
@@ -1812,7 +2598,13 @@ static bool D3D11_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
                                      0,
                                      &textureMemory);
     if (FAILED(result)) {
-        SAFE_RELEASE(textureData->stagingTexture);
+        if (textureData->stagingEntry) {
+            textureData->stagingEntry->locked = false;
+            textureData->stagingEntry = NULL;
+            textureData->stagingTexture = NULL;
+        } else {
+            SAFE_RELEASE(textureData->stagingTexture);
+        }
         return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [map staging texture]"), result);
     }
 
@@ -1821,6 +2613,8 @@ static bool D3D11_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
      */
     textureData->lockedTexturePositionX = rect->x;
     textureData->lockedTexturePositionY = rect->y;
+    textureData->lockedWidth = rect->w;
+    textureData->lockedHeight = rect->h;
 
     /* Make sure the caller has information on the texture's pixel buffer,
      * then return:
@@ -1848,23 +2642,33 @@ static void D3D11_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
         return;
     }
 #endif
+    if (textureData->shadowLocked) {
+        const SDL_Rect *rect = &textureData->shadowLockedRect;
+        const Uint8 *pixels = textureData->shadowPixels + rect->y * textureData->shadowPitch +
+                              rect->x * SDL_BYTESPERPIXEL(texture->format);
+
+        textureData->shadowLocked = false;
+        if (textureData->needsRestore) {
+            // The restored texture will pick up these changes
+            D3D11_RestoreTexture(renderer, texture);
+        } else {
+            D3D11_UpdateTextureInternal(rendererData, textureData->mainTexture, SDL_BYTESPERPIXEL(texture->format), rect->x, rect->y, rect->w, rect->h, pixels, textureData->shadowPitch);
+        }
+        return;
+    }
+
     // Commit the pixel buffer's changes back to the staging texture:
     ID3D11DeviceContext_Unmap(rendererData->d3dContext,
                               (ID3D11Resource *)textureData->stagingTexture,
                               0);
 
     // Copy the staging texture's contents back to the main texture:
-    ID3D11DeviceContext_CopySubresourceRegion(rendererData->d3dContext,
-                                              (ID3D11Resource *)textureData->mainTexture,
-                                              0,
-                                              textureData->lockedTexturePositionX,
-                                              textureData->lockedTexturePositionY,
-                                              0,
-                                              (ID3D11Resource *)textureData->stagingTexture,
-                                              0,
-                                              NULL);
-
-    SAFE_RELEASE(textureData->stagingTexture);
+    D3D11_CopyFromStagingTexture(rendererData, textureData->mainTexture,
+                                 textureData->lockedTexturePositionX, textureData->lockedTexturePositionY,
+                                 textureData->lockedWidth, textureData->lockedHeight,
+                                 textureData->stagingTexture, textureData->stagingEntry);
+    textureData->stagingTexture = NULL;
+    textureData->stagingEntry = NULL;
 }
 
 static bool D3D11_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -1879,6 +2683,12 @@ static bool D3D11_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
 
     textureData = (D3D11_TextureData *)texture->internal;
 
+#ifdef SDL_VIDEO_OPENGL_WGL
+    if (textureData->glInteropAcquired) {
+        return SDL_SetError("Texture is acquired by OpenGL");
+    }
+#endif
+
     if (!textureData->mainTextureRenderTargetView) {
         return SDL_SetError("specified texture is not a render target");
     }
@@ -1983,66 +2793,85 @@ static bool D3D11_UpdateVertexBuffer(SDL_Renderer *renderer,
 {
     D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
     HRESULT result = S_OK;
-    const int vbidx = rendererData->currentVertexBuffer;
     const UINT stride = sizeof(D3D11_VertexPositionColor);
-    const UINT offset = 0;
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    UINT offset;
 
     if (dataSizeInBytes == 0) {
         return true; // nothing to do.
     }
 
-    if (rendererData->vertexBuffers[vbidx] && rendererData->vertexBufferSizes[vbidx] >= dataSizeInBytes) {
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        result = ID3D11DeviceContext_Map(rendererData->d3dContext,
-                                         (ID3D11Resource *)rendererData->vertexBuffers[vbidx],
-                                         0,
-                                         D3D11_MAP_WRITE_DISCARD,
-                                         0,
-                                         &mappedResource);
-        if (FAILED(result)) {
-            return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [vertex buffer]"), result);
+    // Shrink the buffer if it has been much larger than needed for a while
+    rendererData->vertexBufferPeakUpload = SDL_max(rendererData->vertexBufferPeakUpload, dataSizeInBytes);
+    if (++rendererData->vertexBufferUploads >= D3D11_VERTEX_BUFFER_SHRINK_UPLOADS) {
+        if (rendererData->vertexBufferSize > D3D11_VERTEX_BUFFER_MIN_SIZE &&
+            rendererData->vertexBufferPeakUpload < rendererData->vertexBufferSize / 4) {
+            SAFE_RELEASE(rendererData->vertexBuffer);
         }
-        SDL_memcpy(mappedResource.pData, vertexData, dataSizeInBytes);
-        ID3D11DeviceContext_Unmap(rendererData->d3dContext, (ID3D11Resource *)rendererData->vertexBuffers[vbidx], 0);
-    } else {
+        rendererData->vertexBufferPeakUpload = 0;
+        rendererData->vertexBufferUploads = 0;
+    }
+
+    if (!rendererData->vertexBuffer || dataSizeInBytes > rendererData->vertexBufferSize) {
         D3D11_BUFFER_DESC vertexBufferDesc;
-        D3D11_SUBRESOURCE_DATA vertexBufferData;
+        size_t size = D3D11_VERTEX_BUFFER_MIN_SIZE;
 
-        SAFE_RELEASE(rendererData->vertexBuffers[vbidx]);
+        while (size < 2 * SDL_max(dataSizeInBytes, rendererData->vertexBufferPeakUpload)) {
+            size *= 2;
+        }
+
+        SAFE_RELEASE(rendererData->vertexBuffer);
 
         SDL_zero(vertexBufferDesc);
-        vertexBufferDesc.ByteWidth = (UINT)dataSizeInBytes;
+        vertexBufferDesc.ByteWidth = (UINT)size;
         vertexBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
         vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
         vertexBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-        SDL_zero(vertexBufferData);
-        vertexBufferData.pSysMem = vertexData;
-        vertexBufferData.SysMemPitch = 0;
-        vertexBufferData.SysMemSlicePitch = 0;
-
         result = ID3D11Device_CreateBuffer(rendererData->d3dDevice,
                                            &vertexBufferDesc,
-                                           &vertexBufferData,
-                                           &rendererData->vertexBuffers[vbidx]);
+                                           NULL,
+                                           &rendererData->vertexBuffer);
         if (FAILED(result)) {
+            rendererData->vertexBufferSize = 0;
             return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateBuffer [vertex buffer]"), result);
         }
+        SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Vertex buffer resized from %" SDL_PRIu64 " to %" SDL_PRIu64 " bytes",
+                     (Uint64)rendererData->vertexBufferSize, (Uint64)size);
 
-        rendererData->vertexBufferSizes[vbidx] = dataSizeInBytes;
+        rendererData->vertexBufferSize = size;
+        rendererData->vertexBufferOffset = 0;
+        mapType = D3D11_MAP_WRITE_DISCARD;
+    } else if (rendererData->vertexBufferOffset + dataSizeInBytes > rendererData->vertexBufferSize) {
+        // Wrap around, the GPU may still be reading the rest of the buffer
+        rendererData->vertexBufferOffset = 0;
+        mapType = D3D11_MAP_WRITE_DISCARD;
     }
 
+    result = ID3D11DeviceContext_Map(rendererData->d3dContext,
+                                     (ID3D11Resource *)rendererData->vertexBuffer,
+                                     0,
+                                     mapType,
+                                     0,
+                                     &mappedResource);
+    if (FAILED(result)) {
+        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [vertex buffer]"), result);
+    }
+    offset = (UINT)rendererData->vertexBufferOffset;
+    SDL_memcpy((Uint8 *)mappedResource.pData + offset, vertexData, dataSizeInBytes);
+    ID3D11DeviceContext_Unmap(rendererData->d3dContext, (ID3D11Resource *)rendererData->vertexBuffer, 0);
+
     ID3D11DeviceContext_IASetVertexBuffers(rendererData->d3dContext,
                                            0,
                                            1,
-                                           &rendererData->vertexBuffers[vbidx],
+                                           &rendererData->vertexBuffer,
                                            &stride,
                                            &offset);
 
-    rendererData->currentVertexBuffer++;
-    if (rendererData->currentVertexBuffer >= SDL_arraysize(rendererData->vertexBuffers)) {
-        rendererData->currentVertexBuffer = 0;
-    }
+    // Keep the next upload aligned to the vertex size
+    rendererData->vertexBufferOffset += ((dataSizeInBytes + stride - 1) / stride) * stride;
+    rendererData->vertexBytesUploaded += dataSizeInBytes;
 
     return true;
 }
@@ -2304,7 +3133,7 @@ static bool D3D11_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand *
             }
         }
     }
-    if (blendState != rendererData->currentBlendState) {
+    if (SDL_CountRenderStateChange(renderer, blendState != rendererData->currentBlendState)) {
         ID3D11DeviceContext_OMSetBlendState(rendererData->d3dContext, blendState, 0, 0xFFFFFFFF);
         rendererData->currentBlendState = blendState;
     }
@@ -2338,7 +3167,7 @@ static bool D3D11_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand *
         // Force the shader parameters to be re-set
         rendererData->currentShader = SHADER_NONE;
     }
-    if (shader != rendererData->currentShader) {
+    if (SDL_CountRenderStateChange(renderer, shader != rendererData->currentShader)) {
         if (!rendererData->pixelShaders[shader]) {
             if (!D3D11_CreatePixelShader(rendererData->d3dDevice, shader, &rendererData->pixelShaders[shader])) {
                 return false;
@@ -2350,7 +3179,7 @@ static bool D3D11_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand *
         }
         rendererData->currentShader = shader;
     }
-    if (shaderResource != rendererData->currentShaderResource) {
+    if (SDL_CountRenderStateChange(renderer, shaderResource != rendererData->currentShaderResource)) {
         ID3D11DeviceContext_PSSetShaderResources(rendererData->d3dContext, 0, numShaderResources, shaderResources);
         rendererData->currentShaderResource = shaderResource;
     }
@@ -2442,6 +3271,14 @@ static bool D3D11_SetCopyState(SDL_Renderer *renderer, const SDL_RenderCommand *
     if (!textureData) {
         return SDL_SetError("Texture is not currently available");
     }
+    if (textureData->needsRestore && !D3D11_RestoreTexture(renderer, texture)) {
+        return false;
+    }
+#ifdef SDL_VIDEO_OPENGL_WGL
+    if (textureData->glInteropAcquired) {
+        return SDL_SetError("Texture is acquired by OpenGL");
+    }
+#endif
 
     D3D11_SetupShaderConstants(renderer, cmd, texture, &constants);
 
@@ -2480,6 +3317,7 @@ static void D3D11_DrawPrimitives(SDL_Renderer *renderer, D3D11_PRIMITIVE_TOPOLOG
     D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
     ID3D11DeviceContext_IASetPrimitiveTopology(rendererData->d3dContext, primitiveTopology);
     ID3D11DeviceContext_Draw(rendererData->d3dContext, (UINT)vertexCount, (UINT)vertexStart);
+    ++renderer->stats.draw_calls;
 }
 
 static void D3D11_InvalidateCachedState(SDL_Renderer *renderer)
@@ -2495,6 +3333,130 @@ static void D3D11_InvalidateCachedState(SDL_Renderer *renderer)
     data->viewportDirty = true;
 }
 
+static bool D3D11_CreateTimingQuery(D3D11_RenderData *data, D3D11_QUERY type, ID3D11Query **query)
+{
+    D3D11_QUERY_DESC desc;
+    HRESULT result;
+
+    if (*query) {
+        return true;
+    }
+
+    SDL_zero(desc);
+    desc.Query = type;
+    result = ID3D11Device_CreateQuery(data->d3dDevice, &desc, query);
+    if (FAILED(result)) {
+        return WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateQuery [timing]"), result);
+    }
+    return true;
+}
+
+static void D3D11_BeginTimingRange(SDL_Renderer *renderer)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_TimingFrame *frame = &data->timingFrames[data->timingFrame];
+
+    if (!renderer->gpu_timing || data->timingRangeOpen) {
+        return;
+    }
+
+    if (!frame->active) {
+        if (!D3D11_CreateTimingQuery(data, D3D11_QUERY_TIMESTAMP_DISJOINT, &frame->disjoint)) {
+            return;
+        }
+        // Any results of the frame that used these queries before haven't been read in time, drop them.
+        frame->numTimestamps = 0;
+        frame->pending = false;
+        ID3D11DeviceContext_Begin(data->d3dContext, (ID3D11Asynchronous *)frame->disjoint);
+        frame->active = true;
+    }
+
+    if (frame->numTimestamps + 2 > frame->maxTimestamps) {
+        const int maxTimestamps = frame->maxTimestamps ? (frame->maxTimestamps * 2) : 8;
+        ID3D11Query **timestamps = (ID3D11Query **)SDL_realloc(frame->timestamps, maxTimestamps * sizeof(*timestamps));
+        if (!timestamps) {
+            return;
+        }
+        SDL_memset(&timestamps[frame->maxTimestamps], 0, (maxTimestamps - frame->maxTimestamps) * sizeof(*timestamps));
+        frame->timestamps = timestamps;
+        frame->maxTimestamps = maxTimestamps;
+    }
+    if (!D3D11_CreateTimingQuery(data, D3D11_QUERY_TIMESTAMP, &frame->timestamps[frame->numTimestamps]) ||
+        !D3D11_CreateTimingQuery(data, D3D11_QUERY_TIMESTAMP, &frame->timestamps[frame->numTimestamps + 1])) {
+        return;
+    }
+
+    ID3D11DeviceContext_End(data->d3dContext, (ID3D11Asynchronous *)frame->timestamps[frame->numTimestamps]);
+    frame->numTimestamps += 2;
+    data->timingRangeOpen = true;
+}
+
+static void D3D11_EndTimingRange(SDL_Renderer *renderer)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_TimingFrame *frame = &data->timingFrames[data->timingFrame];
+
+    if (!data->timingRangeOpen) {
+        return;
+    }
+
+    ID3D11DeviceContext_End(data->d3dContext, (ID3D11Asynchronous *)frame->timestamps[frame->numTimestamps - 1]);
+    data->timingRangeOpen = false;
+}
+
+static bool D3D11_ReadTimingFrame(SDL_Renderer *renderer, D3D11_TimingFrame *frame)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+    UINT64 start, end, ticks = 0;
+    int i;
+
+    if (ID3D11DeviceContext_GetData(data->d3dContext, (ID3D11Asynchronous *)frame->disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) {
+        return false;
+    }
+    for (i = 0; i + 1 < frame->numTimestamps; i += 2) {
+        if (ID3D11DeviceContext_GetData(data->d3dContext, (ID3D11Asynchronous *)frame->timestamps[i], &start, sizeof(start), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+            ID3D11DeviceContext_GetData(data->d3dContext, (ID3D11Asynchronous *)frame->timestamps[i + 1], &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) {
+            return false;
+        }
+        if (end > start) {
+            ticks += end - start;
+        }
+    }
+    frame->pending = false;
+
+    // The timestamps aren't reliable if the GPU clock changed during the frame
+    if (!disjoint.Disjoint && disjoint.Frequency > 0) {
+        renderer->gpu_time_ns = (Uint64)((ticks * SDL_NS_PER_SECOND) / disjoint.Frequency);
+    }
+    return true;
+}
+
+static void D3D11_EndTimingFrame(SDL_Renderer *renderer)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_TimingFrame *frame = &data->timingFrames[data->timingFrame];
+    int i;
+
+    if (!frame->active) {
+        return;
+    }
+
+    D3D11_EndTimingRange(renderer);
+    ID3D11DeviceContext_End(data->d3dContext, (ID3D11Asynchronous *)frame->disjoint);
+    frame->active = false;
+    frame->pending = true;
+    data->timingFrame = (data->timingFrame + 1) % D3D11_TIMING_FRAMES;
+
+    // Read back whatever finished, oldest first, without waiting on the GPU
+    for (i = 0; i < D3D11_TIMING_FRAMES; ++i) {
+        frame = &data->timingFrames[(data->timingFrame + i) % D3D11_TIMING_FRAMES];
+        if (frame->pending && !D3D11_ReadTimingFrame(renderer, frame)) {
+            break;
+        }
+    }
+}
+
 static bool D3D11_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
     D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
@@ -2504,11 +3466,13 @@ static bool D3D11_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
         return SDL_SetError("Device lost and couldn't be recovered");
     }
 
-    if (rendererData->pixelSizeChanged) {
+    if (rendererData->pixelSizeChanged && !D3D11_CanDeferResize(renderer)) {
         D3D11_UpdateForWindowSizeChange(renderer);
         rendererData->pixelSizeChanged = false;
     }
 
+    D3D11_BeginTimingRange(renderer);
+
     if (rendererData->currentViewportRotation != viewportRotation) {
         rendererData->currentViewportRotation = viewportRotation;
         rendererData->viewportDirty = true;
@@ -2614,6 +3578,12 @@ static bool D3D11_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -2621,10 +3591,16 @@ static bool D3D11_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
         cmd = cmd->next;
     }
 
+    D3D11_EndTimingRange(renderer);
+
     return true;
 }
 
-static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
+/* Copy a rect of the current render target into a staging texture. If entry isn't NULL,
+ * the staging texture comes from the readback pool when possible, and the pool entry is
+ * locked until the readback is destroyed.
+ */
+static ID3D11Texture2D *D3D11_CopyToReadbackTexture(SDL_Renderer *renderer, const SDL_Rect *rect, D3D11_StagingTexture **entry)
 {
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
     ID3D11RenderTargetView *renderTargetView = NULL;
@@ -2634,8 +3610,11 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
     D3D11_TEXTURE2D_DESC stagingTextureDesc;
     D3D11_RECT srcRect = { 0, 0, 0, 0 };
     D3D11_BOX srcBox;
-    D3D11_MAPPED_SUBRESOURCE textureMemory;
-    SDL_Surface *output = NULL;
+    int i;
+
+    if (entry) {
+        *entry = NULL;
+    }
 
     renderTargetView = D3D11_GetCurrentRenderTargetView(renderer);
     if (!renderTargetView) {
@@ -2649,7 +3628,11 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
         goto done;
     }
 
-    // Create a staging texture to copy the screen's data to:
+    if (!D3D11_GetViewportAlignedD3DRect(renderer, rect, &srcRect, FALSE)) {
+        // D3D11_GetViewportAlignedD3DRect will have set the SDL error
+        goto done;
+    }
+
     ID3D11Texture2D_GetDesc(backBuffer, &stagingTextureDesc);
     stagingTextureDesc.Width = rect->w;
     stagingTextureDesc.Height = rect->h;
@@ -2657,21 +3640,66 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
     stagingTextureDesc.MiscFlags = 0;
     stagingTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
     stagingTextureDesc.Usage = D3D11_USAGE_STAGING;
-    result = ID3D11Device_CreateTexture2D(data->d3dDevice,
-                                          &stagingTextureDesc,
-                                          NULL,
-                                          &stagingTexture);
-    if (FAILED(result)) {
-        WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
-        goto done;
+
+    if (entry) {
+        for (i = 0; i < SDL_arraysize(data->readbackPool); ++i) {
+            D3D11_StagingTexture *candidate = &data->readbackPool[i];
+            if (candidate->texture && !candidate->locked &&
+                candidate->format == stagingTextureDesc.Format &&
+                candidate->width == stagingTextureDesc.Width &&
+                candidate->height == stagingTextureDesc.Height) {
+                candidate->locked = true;
+                stagingTexture = candidate->texture;
+                ID3D11Texture2D_AddRef(stagingTexture);
+                *entry = candidate;
+                break;
+            }
+        }
     }
 
-    // Copy the desired portion of the back buffer to the staging texture:
-    if (!D3D11_GetViewportAlignedD3DRect(renderer, rect, &srcRect, FALSE)) {
-        // D3D11_GetViewportAlignedD3DRect will have set the SDL error
-        goto done;
+    if (!stagingTexture) {
+        // Create a staging texture to copy the screen's data to:
+        result = ID3D11Device_CreateTexture2D(data->d3dDevice,
+                                              &stagingTextureDesc,
+                                              NULL,
+                                              &stagingTexture);
+        if (FAILED(result)) {
+            WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11Device1::CreateTexture2D [create staging texture]"), result);
+            goto done;
+        }
+
+        if (entry) {
+            // Use an empty slot, or replace an unused staging texture of another size
+            D3D11_StagingTexture *slot = NULL;
+            for (i = 0; i < SDL_arraysize(data->readbackPool); ++i) {
+                if (!data->readbackPool[i].texture) {
+                    slot = &data->readbackPool[i];
+                    break;
+                }
+            }
+            if (!slot) {
+                for (i = 0; i < SDL_arraysize(data->readbackPool); ++i) {
+                    if (!data->readbackPool[i].locked) {
+                        slot = &data->readbackPool[i];
+                        D3D11_ReleaseStagingEntry(slot);
+                        break;
+                    }
+                }
+            }
+            if (slot) {
+                slot->texture = stagingTexture;
+                ID3D11Texture2D_AddRef(stagingTexture);
+                slot->format = stagingTextureDesc.Format;
+                slot->width = stagingTextureDesc.Width;
+                slot->height = stagingTextureDesc.Height;
+                slot->locked = true;
+                *entry = slot;
+            }
+            // else every pooled texture is waiting to be collected, use a one-off staging texture
+        }
     }
 
+    // Copy the desired portion of the back buffer to the staging texture:
     srcBox.left = srcRect.left;
     srcBox.right = srcRect.right;
     srcBox.top = srcRect.top;
@@ -2686,6 +3714,22 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
                                               0,
                                               &srcBox);
 
+done:
+    SAFE_RELEASE(backBuffer);
+    return stagingTexture;
+}
+
+// Map a staging texture and copy its pixels into a new surface, waiting for the GPU if needed
+static SDL_Surface *D3D11_ReadStagingTexture(SDL_Renderer *renderer, ID3D11Texture2D *stagingTexture, int w, int h, SDL_Colorspace colorspace)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_TEXTURE2D_DESC stagingTextureDesc;
+    D3D11_MAPPED_SUBRESOURCE textureMemory;
+    SDL_Surface *output;
+    HRESULT result;
+
+    ID3D11Texture2D_GetDesc(stagingTexture, &stagingTextureDesc);
+
     // Map the staging texture's data to CPU-accessible memory:
     result = ID3D11DeviceContext_Map(data->d3dContext,
                                      (ID3D11Resource *)stagingTexture,
@@ -2695,13 +3739,13 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
                                      &textureMemory);
     if (FAILED(result)) {
         WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("ID3D11DeviceContext1::Map [map staging texture]"), result);
-        goto done;
+        return NULL;
     }
 
     output = SDL_DuplicatePixels(
-        rect->w, rect->h,
+        w, h,
         D3D11_DXGIFormatToSDLPixelFormat(stagingTextureDesc.Format),
-        renderer->target ? renderer->target->colorspace : renderer->output_colorspace,
+        colorspace,
         textureMemory.pData,
         textureMemory.RowPitch);
 
@@ -2710,39 +3754,231 @@ static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rec
                               (ID3D11Resource *)stagingTexture,
                               0);
 
-done:
-    SAFE_RELEASE(backBuffer);
+    return output;
+}
+
+static SDL_Surface *D3D11_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    ID3D11Texture2D *stagingTexture;
+    SDL_Surface *output;
+
+    stagingTexture = D3D11_CopyToReadbackTexture(renderer, rect, NULL);
+    if (!stagingTexture) {
+        return NULL;
+    }
+
+    output = D3D11_ReadStagingTexture(renderer, stagingTexture, rect->w, rect->h,
+                                      renderer->target ? renderer->target->colorspace : renderer->output_colorspace);
+
     SAFE_RELEASE(stagingTexture);
     return output;
 }
 
+static void D3D11_DestroyReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    D3D11_ReadbackData *readbackData = (D3D11_ReadbackData *)readback->internal;
+
+    // The pool entry may have been released and reused if the device was reset
+    if (readbackData->entry && readbackData->entry->texture == readbackData->stagingTexture) {
+        readbackData->entry->locked = false;
+    }
+    SAFE_RELEASE(readbackData->query);
+    SAFE_RELEASE(readbackData->stagingTexture);
+    SDL_free(readbackData);
+    readback->internal = NULL;
+}
+
+static bool D3D11_QueueReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_ReadbackData *readbackData;
+    D3D11_QUERY_DESC queryDesc;
+
+    readbackData = (D3D11_ReadbackData *)SDL_calloc(1, sizeof(*readbackData));
+    if (!readbackData) {
+        return false;
+    }
+    readback->internal = readbackData;
+
+    readbackData->stagingTexture = D3D11_CopyToReadbackTexture(renderer, &readback->rect, &readbackData->entry);
+    if (!readbackData->stagingTexture) {
+        D3D11_DestroyReadPixels(renderer, readback);
+        return false;
+    }
+    readbackData->colorspace = renderer->target ? renderer->target->colorspace : renderer->output_colorspace;
+
+    // The event query tells when the copy is done, so the pixels can be mapped without stalling
+    SDL_zero(queryDesc);
+    queryDesc.Query = D3D11_QUERY_EVENT;
+    if (SUCCEEDED(ID3D11Device_CreateQuery(data->d3dDevice, &queryDesc, &readbackData->query))) {
+        ID3D11DeviceContext_End(data->d3dContext, (ID3D11Asynchronous *)readbackData->query);
+    } else {
+        // Without a query the readback is treated as ready, mapping it will wait if it isn't
+        readbackData->query = NULL;
+    }
+    return true;
+}
+
+static bool D3D11_IsReadPixelsReady(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    D3D11_ReadbackData *readbackData = (D3D11_ReadbackData *)readback->internal;
+
+    if (!readbackData->query) {
+        return true;
+    }
+    return ID3D11DeviceContext_GetData(data->d3dContext, (ID3D11Asynchronous *)readbackData->query, NULL, 0, 0) == S_OK;
+}
+
+static SDL_Surface *D3D11_CollectReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    D3D11_ReadbackData *readbackData = (D3D11_ReadbackData *)readback->internal;
+
+    return D3D11_ReadStagingTexture(renderer, readbackData->stagingTexture, readback->rect.w, readback->rect.h, readbackData->colorspace);
+}
+
+#if !SDL_WINAPI_FAMILY_PHONE
+static bool D3D11_ClipPresentRect(const SDL_Rect *sdlRect, int w, int h, RECT *outRect)
+{
+    SDL_Rect bounds, clipped;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = w;
+    bounds.h = h;
+    if (!SDL_GetRectIntersection(sdlRect, &bounds, &clipped)) {
+        return false;
+    }
+    outRect->left = clipped.x;
+    outRect->top = clipped.y;
+    outRect->right = (LONG)clipped.x + clipped.w;
+    outRect->bottom = (LONG)clipped.y + clipped.h;
+    return true;
+}
+
+// Returns true if the present only updates part of the back buffer
+static bool D3D11_SetupPresentParameters(SDL_Renderer *renderer, DXGI_PRESENT_PARAMETERS *parameters, RECT *scrollRect, POINT *scrollOffset)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
+    int i;
+
+    if (renderer->num_dirty_rects == 0 && !renderer->scroll_rect_enabled) {
+        return false;
+    }
+
+    // Partial presentation is only supported with the flip model, and we don't rotate the rects
+    if (data->swapEffect != DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL ||
+        data->rotation != DXGI_MODE_ROTATION_IDENTITY) {
+        return false;
+    }
+
+    if (FAILED(IDXGISwapChain1_GetDesc1(data->swapChain, &swapChainDesc))) {
+        return false;
+    }
+
+    if (renderer->num_dirty_rects > data->presentDirtyRectsAllocated) {
+        RECT *rects = (RECT *)SDL_realloc(data->presentDirtyRects, renderer->num_dirty_rects * sizeof(*rects));
+        if (!rects) {
+            return false;
+        }
+        data->presentDirtyRects = rects;
+        data->presentDirtyRectsAllocated = renderer->num_dirty_rects;
+    }
+
+    for (i = 0; i < renderer->num_dirty_rects; ++i) {
+        if (D3D11_ClipPresentRect(&renderer->dirty_rects[i], swapChainDesc.Width, swapChainDesc.Height, &data->presentDirtyRects[parameters->DirtyRectsCount])) {
+            ++parameters->DirtyRectsCount;
+        }
+    }
+    if (parameters->DirtyRectsCount > 0) {
+        parameters->pDirtyRects = data->presentDirtyRects;
+    }
+
+    if (renderer->scroll_rect_enabled &&
+        D3D11_ClipPresentRect(&renderer->scroll_rect, swapChainDesc.Width, swapChainDesc.Height, scrollRect)) {
+        scrollOffset->x = renderer->scroll_offset.x;
+        scrollOffset->y = renderer->scroll_offset.y;
+        parameters->pScrollRect = scrollRect;
+        parameters->pScrollOffset = scrollOffset;
+    }
+
+    if (parameters->DirtyRectsCount == 0 && !parameters->pScrollRect) {
+        // Everything was clipped away, just present the whole back buffer
+        SDL_zerop(parameters);
+        return false;
+    }
+    return true;
+}
+#endif // !SDL_WINAPI_FAMILY_PHONE
+
 static bool D3D11_RenderPresent(SDL_Renderer *renderer)
 {
     D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
     HRESULT result;
     DXGI_PRESENT_PARAMETERS parameters;
+    UINT syncInterval, presentFlags;
+#if !SDL_WINAPI_FAMILY_PHONE
+    RECT scrollRect;
+    POINT scrollOffset;
+#endif
+    bool partial = false;
 
     if (!data->d3dDevice) {
         return SDL_SetError("Device lost and couldn't be recovered");
     }
 
+    SDL_LogVerbose(SDL_LOG_CATEGORY_RENDER, "Uploaded %" SDL_PRIu64 " bytes of vertex data this frame", (Uint64)data->vertexBytesUploaded);
+    data->vertexBytesUploaded = 0;
+    SDL_LogVerbose(SDL_LOG_CATEGORY_RENDER, "Staging texture pool: %" SDL_PRIu64 " hits, %" SDL_PRIu64 " misses", data->stagingPoolHits, data->stagingPoolMisses);
+
     SDL_zero(parameters);
 
+    syncInterval = data->syncInterval;
+    presentFlags = data->presentFlags;
+    if (data->adaptiveVSync) {
+        /* If we missed the refresh we were aiming for, present immediately and
+         * let it tear instead of waiting for the next one.
+         */
+        const Uint64 now = SDL_GetTicksNS();
+        const SDL_DisplayMode *mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(renderer->window));
+        if (mode && mode->refresh_rate > 0.0f && data->lastPresentNS &&
+            (now - data->lastPresentNS) > (Uint64)(SDL_NS_PER_SECOND / mode->refresh_rate)) {
+            syncInterval = 0;
+            presentFlags = DXGI_PRESENT_ALLOW_TEARING;
+        }
+        data->lastPresentNS = now;
+    }
+
+    D3D11_BeginTimingRange(renderer);
+
+    if (renderer->present_occluded &&
+        IDXGISwapChain_Present(data->swapChain, 0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED) {
+        // Still occluded, don't spend time presenting until the window can be seen again
+        result = DXGI_STATUS_OCCLUDED;
+    } else {
 #if SDL_WINAPI_FAMILY_PHONE
-    result = IDXGISwapChain_Present(data->swapChain, data->syncInterval, data->presentFlags);
+        result = IDXGISwapChain_Present(data->swapChain, syncInterval, presentFlags);
 #else
-    /* The application may optionally specify "dirty" or "scroll"
-     * rects to improve efficiency in certain scenarios.
-     * This option is not available on Windows Phone 8, to note.
-     */
-    result = IDXGISwapChain1_Present1(data->swapChain, data->syncInterval, data->presentFlags, &parameters);
+        /* The application may optionally specify "dirty" or "scroll"
+         * rects to improve efficiency in certain scenarios.
+         * This option is not available on Windows Phone 8, to note.
+         */
+        partial = D3D11_SetupPresentParameters(renderer, &parameters, &scrollRect, &scrollOffset);
+        result = IDXGISwapChain1_Present1(data->swapChain, syncInterval, presentFlags, &parameters);
 #endif
+    }
+    renderer->present_occluded = (result == DXGI_STATUS_OCCLUDED && renderer->throttle_occluded);
+
+    D3D11_EndTimingFrame(renderer);
 
     /* Discard the contents of the render target.
      * This is a valid operation only when the existing contents will be entirely
-     * overwritten. If dirty or scroll rects are used, this call should be removed.
+     * overwritten, so skip it when dirty or scroll rects are used.
      */
-    ID3D11DeviceContext1_DiscardView(data->d3dContext, (ID3D11View *)data->mainRenderTargetView);
+    if (!partial) {
+        ID3D11DeviceContext1_DiscardView(data->d3dContext, (ID3D11View *)data->mainRenderTargetView);
+    }
 
     // When the present flips, it unbinds the current view, so bind it again on the next draw call
     data->currentRenderTargetView = NULL;
@@ -2760,7 +3996,8 @@ static bool D3D11_RenderPresent(SDL_Renderer *renderer)
                 // Recovering from device lost failed, error is already set
             }
         } else if (result == DXGI_ERROR_INVALID_CALL) {
-            // We probably went through a fullscreen <-> windowed transition
+            // We probably went through a fullscreen <-> windowed transition, resize the buffers even if the size is unchanged
+            D3D11_ReleaseMainRenderTargetView(renderer);
             D3D11_CreateWindowSizeDependentResources(renderer);
             WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGISwapChain::Present"), result);
         } else {
@@ -2768,6 +4005,17 @@ static bool D3D11_RenderPresent(SDL_Renderer *renderer)
         }
         return false;
     }
+
+    if (D3D11_CanDeferResize(renderer) &&
+        (SDL_GetTicksNS() - data->pixelSizeChangedNS) >= D3D11_LIVE_RESIZE_SETTLE_NS) {
+        // The window size settled, resize the buffers now so the next frame is drawn at the new size
+        D3D11_UpdateForWindowSizeChange(renderer);
+        data->pixelSizeChanged = false;
+        renderer->output_resized = true;
+    }
+#ifdef SDL_PLATFORM_WINRT
+    WINRT_RecordStartupStage(WINRT_STARTUP_FIRST_PRESENT);
+#endif
     return true;
 }
 
@@ -2792,13 +4040,27 @@ static bool D3D11_SetVSync(SDL_Renderer *renderer, const int vsync)
     }
 #endif
 
-    if (vsync < 0) {
+    // Tearing needs a flip model swap chain created with DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING
+    const bool allowTearing = (data->swapChainFlags & DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING) != 0;
+
+    if (vsync < 0 && (vsync != SDL_RENDERER_VSYNC_ADAPTIVE || !allowTearing)) {
         return SDL_Unsupported();
     }
 
-    if (vsync > 0) {
+    data->adaptiveVSync = false;
+    data->lastPresentNS = 0;
+    if (vsync == SDL_RENDERER_VSYNC_ADAPTIVE) {
+        // Wait for vsync when we're on time, tear when we're late
+        data->adaptiveVSync = true;
+        data->syncInterval = 1;
+        data->presentFlags = 0;
+    } else if (vsync > 0) {
         data->syncInterval = vsync;
         data->presentFlags = 0;
+    } else if (allowTearing) {
+        // Present as soon as the frame is ready, which lets variable refresh rate displays follow the application
+        data->syncInterval = 0;
+        data->presentFlags = DXGI_PRESENT_ALLOW_TEARING;
     } else {
         data->syncInterval = 0;
         data->presentFlags = DXGI_PRESENT_DO_NOT_WAIT;
@@ -2806,6 +4068,49 @@ static bool D3D11_SetVSync(SDL_Renderer *renderer, const int vsync)
     return true;
 }
 
+static bool D3D11_WaitPresent(SDL_Renderer *renderer, Sint32 timeoutMS)
+{
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    DWORD result;
+
+    if (!data->frameLatencyWaitableObject) {
+        // Presentation is throttled by DXGI, nothing to wait for here
+        return true;
+    }
+
+    result = WaitForSingleObjectEx(data->frameLatencyWaitableObject, (timeoutMS < 0) ? INFINITE : (DWORD)timeoutMS, TRUE);
+    if (result == WAIT_TIMEOUT) {
+        return false;
+    } else if (result != WAIT_OBJECT_0) {
+        return WIN_SetError("WaitForSingleObjectEx");
+    }
+    return true;
+}
+
+// Block compressed formats depend on the feature level, BC7 needs 11_0
+static void D3D11_AddCompressedTextureFormats(SDL_Renderer *renderer)
+{
+    static const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_BC1,
+        SDL_PIXELFORMAT_BC2,
+        SDL_PIXELFORMAT_BC3,
+        SDL_PIXELFORMAT_BC7
+    };
+    D3D11_RenderData *data = (D3D11_RenderData *)renderer->internal;
+    const UINT required = D3D11_FORMAT_SUPPORT_TEXTURE2D | D3D11_FORMAT_SUPPORT_SHADER_SAMPLE;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        DXGI_FORMAT format = SDLPixelFormatToDXGITextureFormat(formats[i], renderer->output_colorspace);
+        UINT support = 0;
+
+        if (SUCCEEDED(ID3D11Device_CheckFormatSupport(data->d3dDevice, format, &support)) &&
+            (support & required) == required) {
+            SDL_AddSupportedTextureFormat(renderer, formats[i]);
+        }
+    }
+}
+
 static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_PropertiesID create_props)
 {
     D3D11_RenderData *data;
@@ -2831,6 +4136,8 @@ static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     data->identity = MatrixIdentity();
 
     renderer->WindowEvent = D3D11_WindowEvent;
+    renderer->GetOutputSize = D3D11_GetOutputSize;
+    renderer->SetOutputSourceSize = D3D11_SetOutputSourceSize;
     renderer->SupportsBlendMode = D3D11_SupportsBlendMode;
     renderer->CreateTexture = D3D11_CreateTexture;
     renderer->UpdateTexture = D3D11_UpdateTexture;
@@ -2849,10 +4156,21 @@ static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     renderer->InvalidateCachedState = D3D11_InvalidateCachedState;
     renderer->RunCommandQueue = D3D11_RunCommandQueue;
     renderer->RenderReadPixels = D3D11_RenderReadPixels;
+    renderer->QueueReadPixels = D3D11_QueueReadPixels;
+    renderer->IsReadPixelsReady = D3D11_IsReadPixelsReady;
+    renderer->CollectReadPixels = D3D11_CollectReadPixels;
+    renderer->DestroyReadPixels = D3D11_DestroyReadPixels;
     renderer->RenderPresent = D3D11_RenderPresent;
     renderer->DestroyTexture = D3D11_DestroyTexture;
     renderer->DestroyRenderer = D3D11_DestroyRenderer;
     renderer->SetVSync = D3D11_SetVSync;
+    renderer->WaitPresent = D3D11_WaitPresent;
+#ifdef SDL_VIDEO_OPENGL_WGL
+    renderer->ShareTextureWithGL = D3D11_ShareTextureWithGL;
+    renderer->AcquireTextureForGL = D3D11_AcquireTextureForGL;
+    renderer->ReleaseTextureForGL = D3D11_ReleaseTextureForGL;
+    renderer->UnshareTextureWithGL = D3D11_UnshareTextureWithGL;
+#endif
     renderer->internal = data;
     D3D11_InvalidateCachedState(renderer);
 
@@ -2871,6 +4189,10 @@ static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     data->syncInterval = 0;
     data->presentFlags = DXGI_PRESENT_DO_NOT_WAIT;
 
+    data->frameLatencyWaitable = SDL_GetBooleanProperty(create_props, SDL_PROP_RENDERER_CREATE_D3D11_FRAME_LATENCY_WAITABLE_BOOLEAN, false);
+    data->maximumFrameLatency = (UINT)SDL_clamp(SDL_GetNumberProperty(create_props, SDL_PROP_RENDERER_CREATE_D3D11_MAXIMUM_FRAME_LATENCY_NUMBER, 1), 1, DXGI_MAX_SWAP_CHAIN_BUFFERS);
+    data->liveResize = SDL_GetHintBoolean(SDL_HINT_RENDER_DIRECT3D11_LIVE_RESIZE, false);
+
     /* HACK: make sure the SDL_Renderer references the SDL_Window data now, in
      * order to give init functions access to the underlying window handle:
      */
@@ -2883,6 +4205,10 @@ static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     if (FAILED(D3D11_CreateWindowSizeDependentResources(renderer))) {
         return false;
     }
+    D3D11_AddCompressedTextureFormats(renderer);
+#ifdef SDL_PLATFORM_WINRT
+    WINRT_RecordStartupStage(WINRT_STARTUP_DEVICE_CREATED);
+#endif
 
     return true;
 }
@@ -28,7 +28,9 @@ extern "C" {
 #include <windows.graphics.display.h>
 
 #if WINAPI_FAMILY == WINAPI_FAMILY_APP
+#include <dxgi1_2.h>
 #include <windows.ui.xaml.media.dxinterop.h>
+#include "../../core/winrt/SDL_winrtapp_xaml.h"
 #endif
 
 using namespace Windows::UI::Core;
@@ -54,6 +56,14 @@ D3D11_GetCoreWindowFromSDLRenderer(SDL_Renderer *renderer)
     return coreWindowAsIUnknown;
 }
 
+#if WINAPI_FAMILY == WINAPI_FAMILY_APP
+extern "C" HRESULT
+D3D11_SetXAMLSwapChain(IDXGISwapChain1 *swapChain)
+{
+    return WINRT_SetXAMLSwapChain(swapChain);
+}
+#endif
+
 extern "C" DXGI_MODE_ROTATION
 D3D11_GetCurrentRotation()
 {
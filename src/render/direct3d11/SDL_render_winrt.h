@@ -24,6 +24,9 @@ extern "C" {
 #endif
 
 void *D3D11_GetCoreWindowFromSDLRenderer(SDL_Renderer *renderer);
+#if WINAPI_FAMILY == WINAPI_FAMILY_APP
+HRESULT D3D11_SetXAMLSwapChain(IDXGISwapChain1 *swapChain);
+#endif
 DXGI_MODE_ROTATION D3D11_GetCurrentRotation();
 
 #ifdef __cplusplus
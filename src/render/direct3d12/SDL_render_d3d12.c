@@ -29,11 +29,13 @@
 
 #include "../../core/windows/SDL_windows.h"
 #include "../../video/directx/SDL_d3d12.h"
+#ifndef SDL_PLATFORM_WINRT
 #include "../../video/windows/SDL_windowswindow.h"
+#endif
 #include "../SDL_d3dmath.h"
 #include "../SDL_sysrender.h"
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
 #include "SDL_render_d3d12_xbox.h"
 #endif
 
@@ -176,7 +178,7 @@ typedef struct
 {
     SDL_SharedObject *hDXGIMod;
     SDL_SharedObject *hD3D12Mod;
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
     UINT64 frameToken;
 #else
     IDXGIFactory6 *dxgiFactory;
@@ -397,7 +399,7 @@ static void D3D12_ReleaseAll(SDL_Renderer *renderer)
     if (data) {
         int i;
 
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
         D3D_SAFE_RELEASE(data->dxgiFactory);
         D3D_SAFE_RELEASE(data->dxgiAdapter);
         D3D_SAFE_RELEASE(data->swapChain);
@@ -441,7 +443,7 @@ static void D3D12_ReleaseAll(SDL_Renderer *renderer)
         data->currentRenderTargetView.ptr = 0;
         data->currentSampler.ptr = 0;
 
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
         // Check for any leaks if in debug mode
         if (data->dxgiDebug) {
             DXGI_DEBUG_RLO_FLAGS rloFlags = (DXGI_DEBUG_RLO_FLAGS)(DXGI_DEBUG_RLO_DETAIL | DXGI_DEBUG_RLO_IGNORE_INTERNAL);
@@ -771,7 +773,7 @@ static HRESULT D3D12_CreateVertexBuffer(D3D12_RenderData *data, size_t vbidx, si
 // Create resources that depend on the device.
 static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
 {
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
     typedef HRESULT(WINAPI * PFN_CREATE_DXGI_FACTORY)(UINT flags, REFIID riid, void **ppFactory);
     PFN_CREATE_DXGI_FACTORY CreateDXGIFactoryFunc;
     PFN_D3D12_CREATE_DEVICE D3D12CreateDeviceFunc;
@@ -793,7 +795,7 @@ static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
     // See if we need debug interfaces
     createDebug = SDL_GetHintBoolean(SDL_HINT_RENDER_DIRECT3D11_DEBUG, false);
 
-#ifdef SDL_PLATFORM_GDK
+#if defined(SDL_PLATFORM_GDK) || defined(SDL_PLATFORM_WINRT)
     CreateEventExFunc = CreateEventExW;
 #else
     // CreateEventEx() arrived in Vista, so we need to load it with GetProcAddress for XP.
@@ -810,7 +812,18 @@ static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
         goto done;
     }
 
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
+#ifdef SDL_PLATFORM_WINRT
+    // UWP apps can't load system DLLs at runtime, DXGI and D3D12 are linked directly
+    CreateDXGIFactoryFunc = CreateDXGIFactory2;
+    D3D12CreateDeviceFunc = D3D12CreateDevice;
+
+    if (createDebug) {
+        if (SUCCEEDED(D3D12GetDebugInterface(D3D_GUID(SDL_IID_ID3D12Debug), (void **)&data->debugInterface))) {
+            ID3D12Debug_EnableDebugLayer(data->debugInterface);
+        }
+    }
+#else
     data->hDXGIMod = SDL_LoadObject("dxgi.dll");
     if (!data->hDXGIMod) {
         result = E_FAIL;
@@ -847,9 +860,10 @@ static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
             ID3D12Debug_EnableDebugLayer(data->debugInterface);
         }
     }
-#endif // !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#endif // SDL_PLATFORM_WINRT
+#endif // !SDL_D3D12_XBOX
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
     result = D3D12_XBOX_CreateDevice(&d3dDevice, createDebug);
     if (FAILED(result)) {
         // SDL Error is set by D3D12_XBOX_CreateDevice
@@ -862,7 +876,11 @@ static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
         PFN_CREATE_DXGI_FACTORY DXGIGetDebugInterfaceFunc;
 
         // If the debug hint is set, also create the DXGI factory in debug mode
+#ifdef SDL_PLATFORM_WINRT
+        DXGIGetDebugInterfaceFunc = DXGIGetDebugInterface1;
+#else
         DXGIGetDebugInterfaceFunc = (PFN_CREATE_DXGI_FACTORY)SDL_LoadFunction(data->hDXGIMod, "DXGIGetDebugInterface1");
+#endif
         if (!DXGIGetDebugInterfaceFunc) {
             result = E_FAIL;
             goto done;
@@ -935,7 +953,7 @@ static HRESULT D3D12_CreateDeviceResources(SDL_Renderer *renderer)
 
         D3D_SAFE_RELEASE(infoQueue);
     }
-#endif // !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#endif // !SDL_D3D12_XBOX
 
     result = ID3D12Device_QueryInterface(d3dDevice, D3D_GUID(SDL_IID_ID3D12Device1), (void **)&data->d3dDevice);
     if (FAILED(result)) {
@@ -1198,7 +1216,7 @@ static bool D3D12_GetViewportAlignedD3DRect(SDL_Renderer *renderer, const SDL_Re
     return true;
 }
 
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
 static HRESULT D3D12_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
 {
     D3D12_RenderData *data = (D3D12_RenderData *)renderer->internal;
@@ -1238,6 +1256,26 @@ static HRESULT D3D12_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
     swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT | // To support SetMaximumFrameLatency
                           DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;                  // To support presenting with allow tearing on
 
+#ifdef SDL_PLATFORM_WINRT
+    // DXGI queries the ICoreWindow interface from this itself
+    IUnknown *coreWindow = (IUnknown *)SDL_GetPointerProperty(SDL_GetWindowProperties(renderer->window), SDL_PROP_WINDOW_WINRT_WINDOW_POINTER, NULL);
+    if (!coreWindow) {
+        SDL_SetError("Couldn't get CoreWindow");
+        result = E_FAIL;
+        goto done;
+    }
+
+    result = IDXGIFactory2_CreateSwapChainForCoreWindow(data->dxgiFactory,
+                                                        (IUnknown *)data->commandQueue,
+                                                        coreWindow,
+                                                        &swapChainDesc,
+                                                        NULL, // Allow on all displays.
+                                                        &swapChain);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("IDXGIFactory2::CreateSwapChainForCoreWindow"), result);
+        goto done;
+    }
+#else
     HWND hwnd = (HWND)SDL_GetPointerProperty(SDL_GetWindowProperties(renderer->window), SDL_PROP_WINDOW_WIN32_HWND_POINTER, NULL);
     if (!hwnd) {
         SDL_SetError("Couldn't get window handle");
@@ -1258,6 +1296,7 @@ static HRESULT D3D12_CreateSwapChain(SDL_Renderer *renderer, int w, int h)
     }
 
     IDXGIFactory6_MakeWindowAssociation(data->dxgiFactory, hwnd, DXGI_MWA_NO_WINDOW_CHANGES);
+#endif // SDL_PLATFORM_WINRT
 
     result = IDXGISwapChain1_QueryInterface(swapChain, D3D_GUID(SDL_IID_IDXGISwapChain4), (void **)&data->swapChain);
     if (FAILED(result)) {
@@ -1342,7 +1381,7 @@ static HRESULT D3D12_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
         h = tmp;
     }
 
-#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#ifndef SDL_D3D12_XBOX
     if (data->swapChain) {
         // If the swap chain already exists, resize it.
         result = IDXGISwapChain_ResizeBuffers(data->swapChain,
@@ -1371,11 +1410,11 @@ static HRESULT D3D12_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
             }
         }
     }
-#endif // !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#endif // !SDL_D3D12_XBOX
 
     // Get each back buffer render target and create render target views
     for (i = 0; i < SDL_D3D12_NUM_BUFFERS; ++i) {
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
         result = D3D12_XBOX_CreateBackBufferTarget(data->d3dDevice, renderer->window->w, renderer->window->h, (void **)&data->renderTargets[i]);
         if (FAILED(result)) {
             WIN_SetErrorFromHRESULT(SDL_COMPOSE_ERROR("D3D12_XBOX_CreateBackBufferTarget"), result);
@@ -1403,7 +1442,7 @@ static HRESULT D3D12_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
     }
 
     // Set back buffer index to current buffer
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
     data->currentBackBufferIndex = 0;
 #else
     data->currentBackBufferIndex = IDXGISwapChain4_GetCurrentBackBufferIndex(data->swapChain);
@@ -1422,7 +1461,7 @@ static HRESULT D3D12_CreateWindowSizeDependentResources(SDL_Renderer *renderer)
 
     data->viewportDirty = true;
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
     D3D12_XBOX_StartFrame(data->d3dDevice, &data->frameToken);
 #endif
 
@@ -1514,7 +1553,7 @@ static bool GetTextureProperty(SDL_PropertiesID props, const char *name, ID3D12R
 {
     IUnknown *unknown = (IUnknown *)SDL_GetPointerProperty(props, name, NULL);
     if (unknown) {
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
         HRESULT result = unknown->QueryInterface(D3D_GUID(SDL_IID_ID3D12Resource), (void **)texture);
 #else
         HRESULT result = IUnknown_QueryInterface(unknown, D3D_GUID(SDL_IID_ID3D12Resource), (void **)texture);
@@ -1797,7 +1836,7 @@ static bool D3D12_UpdateTextureInternal(D3D12_RenderData *rendererData, ID3D12Re
     D3D12_TEXTURE_COPY_LOCATION dstLocation;
     BYTE *textureMemory;
     ID3D12Resource *uploadBuffer;
-    UINT row, NumRows, RowPitch;
+    UINT NumRows, RowPitch;
     UINT64 RowLength;
 
     // Create an upload buffer, which will be used to write to the main texture.
@@ -1867,21 +1906,13 @@ static bool D3D12_UpdateTextureInternal(D3D12_RenderData *rendererData, ID3D12Re
     src = (const Uint8 *)pixels;
     dst = textureMemory;
     length = (UINT)RowLength;
-    if (length == (UINT)pitch && length == RowPitch) {
-        SDL_memcpy(dst, src, (size_t)length * NumRows);
-    } else {
-        if (length > (UINT)pitch) {
-            length = pitch;
-        }
-        if (length > RowPitch) {
-            length = RowPitch;
-        }
-        for (row = NumRows; row--;) {
-            SDL_memcpy(dst, src, length);
-            src += pitch;
-            dst += RowPitch;
-        }
+    if (length > (UINT)pitch) {
+        length = pitch;
     }
+    if (length > RowPitch) {
+        length = RowPitch;
+    }
+    SDL_memcpy_rows(dst, RowPitch, src, pitch, length, NumRows);
 
     // Commit the changes back to the upload buffer:
     ID3D12Resource_Unmap(uploadBuffer, 0, NULL);
@@ -2585,11 +2616,11 @@ static bool D3D12_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand *
     }
 
     // See if we need to change the pipeline state
-    if (!currentPipelineState ||
-        currentPipelineState->shader != shader ||
-        currentPipelineState->blendMode != blendMode ||
-        currentPipelineState->topology != topology ||
-        currentPipelineState->rtvFormat != rtvFormat) {
+    if (SDL_CountRenderStateChange(renderer, !currentPipelineState ||
+                                                 currentPipelineState->shader != shader ||
+                                                 currentPipelineState->blendMode != blendMode ||
+                                                 currentPipelineState->topology != topology ||
+                                                 currentPipelineState->rtvFormat != rtvFormat)) {
 
         /* Find the matching pipeline.
            NOTE: Although it may seem inefficient to linearly search through ~450 pipelines
@@ -2656,7 +2687,7 @@ static bool D3D12_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand *
     } else {
         firstShaderResource.ptr = 0;
     }
-    if (firstShaderResource.ptr != rendererData->currentShaderResource.ptr) {
+    if (SDL_CountRenderStateChange(renderer, firstShaderResource.ptr != rendererData->currentShaderResource.ptr)) {
         for (i = 0; i < numShaderResources; ++i) {
             D3D12_GPU_DESCRIPTOR_HANDLE GPUHandle = D3D12_CPUtoGPUHandle(rendererData->srvDescriptorHeap, shaderResources[i]);
             ID3D12GraphicsCommandList2_SetGraphicsRootDescriptorTable(rendererData->commandList, i + 2, GPUHandle);
@@ -2825,6 +2856,7 @@ static void D3D12_DrawPrimitives(SDL_Renderer *renderer, D3D12_PRIMITIVE_TOPOLOG
     D3D12_RenderData *rendererData = (D3D12_RenderData *)renderer->internal;
     ID3D12GraphicsCommandList2_IASetPrimitiveTopology(rendererData->commandList, primitiveTopology);
     ID3D12GraphicsCommandList2_DrawInstanced(rendererData->commandList, (UINT)vertexCount, 1, (UINT)vertexStart, 0);
+    ++renderer->stats.draw_calls;
 }
 
 static void D3D12_InvalidateCachedState(SDL_Renderer *renderer)
@@ -2967,6 +2999,12 @@ static bool D3D12_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -3143,13 +3181,20 @@ static bool D3D12_RenderPresent(SDL_Renderer *renderer)
     result = ID3D12GraphicsCommandList2_Close(data->commandList);
     ID3D12CommandQueue_ExecuteCommandLists(data->commandQueue, 1, (ID3D12CommandList *const *)&data->commandList);
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
     result = D3D12_XBOX_PresentFrame(data->commandQueue, data->frameToken, data->renderTargets[data->currentBackBufferIndex]);
 #else
-    /* The application may optionally specify "dirty" or "scroll"
-     * rects to improve efficiency in certain scenarios.
-     */
-    result = IDXGISwapChain_Present(data->swapChain, data->syncInterval, data->presentFlags);
+    if (renderer->present_occluded &&
+        IDXGISwapChain_Present(data->swapChain, 0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED) {
+        // Still occluded, the command list still runs but we don't spend time presenting
+        result = DXGI_STATUS_OCCLUDED;
+    } else {
+        /* The application may optionally specify "dirty" or "scroll"
+         * rects to improve efficiency in certain scenarios.
+         */
+        result = IDXGISwapChain_Present(data->swapChain, data->syncInterval, data->presentFlags);
+    }
+    renderer->present_occluded = (result == DXGI_STATUS_OCCLUDED && renderer->throttle_occluded);
 #endif
 
     if (FAILED(result) && result != DXGI_ERROR_WAS_STILL_DRAWING) {
@@ -3182,7 +3227,7 @@ static bool D3D12_RenderPresent(SDL_Renderer *renderer)
         }
 
         data->fenceValue++;
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
         data->currentBackBufferIndex++;
         data->currentBackBufferIndex %= SDL_D3D12_NUM_BUFFERS;
 #else
@@ -3196,7 +3241,7 @@ static bool D3D12_RenderPresent(SDL_Renderer *renderer)
                                  D3D12_RESOURCE_STATE_PRESENT,
                                  D3D12_RESOURCE_STATE_RENDER_TARGET);
 
-#if defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)
+#ifdef SDL_D3D12_XBOX
         D3D12_XBOX_StartFrame(data->d3dDevice, &data->frameToken);
 #endif
         return true;
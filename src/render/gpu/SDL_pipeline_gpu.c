@@ -27,6 +27,38 @@
 
 #include "../SDL_sysrender.h"
 
+/* The pipelines a renderer has needed are saved to its pipeline cache storage
+ * when it's destroyed, and created up front the next time it starts, so new
+ * blend modes and shaders don't hitch the first frame they're used in. The
+ * file is only used by the same build of SDL on the same device and driver.
+ */
+#define GPU_PIPELINE_CACHE_FILE    "SDL_gpu_render_pipelines.bin"
+#define GPU_PIPELINE_CACHE_MAGIC   0x43504753 // "SGPC"
+#define GPU_PIPELINE_CACHE_VERSION 1
+
+typedef struct GPU_PipelineCacheFileHeader
+{
+    Uint32 magic;
+    Uint32 version;
+    Uint32 device_hash;
+    Uint32 num_entries;
+} GPU_PipelineCacheFileHeader;
+
+typedef struct GPU_PipelineCacheFileEntry
+{
+    Uint32 blend_mode;
+    Uint32 frag_shader;
+    Uint32 vert_shader;
+    Uint32 attachment_format;
+    Uint32 primitive_type;
+} GPU_PipelineCacheFileEntry;
+
+typedef struct GPU_PipelineCacheWriter
+{
+    GPU_PipelineCacheFileEntry *entries;
+    Uint32 num_entries;
+} GPU_PipelineCacheWriter;
+
 static Uint32 SDLCALL HashPipelineCacheKey(void *userdata, const void *key)
 {
     const GPU_PipelineParameters *params = (const GPU_PipelineParameters *) key;
@@ -52,8 +84,92 @@ bool GPU_InitPipelineCache(GPU_PipelineCache *cache, SDL_GPUDevice *device)
     return (cache->table != NULL);
 }
 
+static Uint32 HashPipelineCacheString(const char *string, Uint32 seed)
+{
+    if (!string) {
+        string = "";
+    }
+    return SDL_murmur3_32(string, SDL_strlen(string) + 1, seed);
+}
+
+static Uint32 GetPipelineCacheDeviceHash(SDL_GPUDevice *device)
+{
+    SDL_PropertiesID props = SDL_GetGPUDeviceProperties(device);
+    Uint32 hash = HashPipelineCacheString(SDL_GetRevision(), 0);
+    hash = HashPipelineCacheString(SDL_GetGPUDeviceDriver(device), hash);
+    hash = HashPipelineCacheString(SDL_GetStringProperty(props, SDL_PROP_GPU_DEVICE_NAME_STRING, NULL), hash);
+    hash = HashPipelineCacheString(SDL_GetStringProperty(props, SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING, NULL), hash);
+    hash = HashPipelineCacheString(SDL_GetStringProperty(props, SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING, NULL), hash);
+    return hash;
+}
+
+static bool SDLCALL CountPipelineCacheEntry(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    ++*(Uint32 *)userdata;
+    return true;
+}
+
+static bool SDLCALL CollectPipelineCacheEntry(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    GPU_PipelineCacheWriter *writer = (GPU_PipelineCacheWriter *)userdata;
+    const GPU_PipelineParameters *params = (const GPU_PipelineParameters *)key;
+    GPU_PipelineCacheFileEntry *entry;
+
+    // Pipelines with app shaders can't be recreated without them
+    if (params->custom_frag_shader || params->frag_shader == FRAG_SHADER_TEXTURE_CUSTOM) {
+        return true;
+    }
+
+    entry = &writer->entries[writer->num_entries++];
+    entry->blend_mode = SDL_Swap32LE((Uint32)params->blend_mode);
+    entry->frag_shader = SDL_Swap32LE((Uint32)params->frag_shader);
+    entry->vert_shader = SDL_Swap32LE((Uint32)params->vert_shader);
+    entry->attachment_format = SDL_Swap32LE((Uint32)params->attachment_format);
+    entry->primitive_type = SDL_Swap32LE((Uint32)params->primitive_type);
+    return true;
+}
+
+static void SavePipelineCache(GPU_PipelineCache *cache)
+{
+    GPU_PipelineCacheWriter writer;
+    GPU_PipelineCacheFileHeader *header;
+    Uint32 capacity = 0;
+    Uint8 *data;
+    size_t length;
+
+    if (!SDL_StorageReady(cache->storage)) {
+        return;
+    }
+
+    SDL_IterateHashTable(cache->table, CountPipelineCacheEntry, &capacity);
+    length = sizeof(*header) + capacity * sizeof(*writer.entries);
+    data = (Uint8 *)SDL_malloc(length);
+    if (!data) {
+        return;
+    }
+
+    writer.entries = (GPU_PipelineCacheFileEntry *)(data + sizeof(*header));
+    writer.num_entries = 0;
+    SDL_IterateHashTable(cache->table, CollectPipelineCacheEntry, &writer);
+
+    header = (GPU_PipelineCacheFileHeader *)data;
+    header->magic = SDL_Swap32LE(GPU_PIPELINE_CACHE_MAGIC);
+    header->version = SDL_Swap32LE(GPU_PIPELINE_CACHE_VERSION);
+    header->device_hash = SDL_Swap32LE(cache->device_hash);
+    header->num_entries = SDL_Swap32LE(writer.num_entries);
+
+    length = sizeof(*header) + writer.num_entries * sizeof(*writer.entries);
+    if (!SDL_WriteStorageFile(cache->storage, GPU_PIPELINE_CACHE_FILE, data, length)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "Couldn't save GPU pipeline cache: %s", SDL_GetError());
+    }
+    SDL_free(data);
+}
+
 void GPU_DestroyPipelineCache(GPU_PipelineCache *cache)
 {
+    if (cache->storage && cache->dirty) {
+        SavePipelineCache(cache);
+    }
     SDL_DestroyHashTable(cache->table);
 }
 
@@ -157,6 +273,10 @@ SDL_GPUGraphicsPipeline *GPU_GetPipeline(GPU_PipelineCache *cache, GPU_Shaders *
             }
         }
 
+        if (inserted) {
+            cache->dirty = true;
+        }
+
         if (!inserted) {
             SDL_free(paramscpy);
             if (pipeline) {
@@ -169,4 +289,71 @@ SDL_GPUGraphicsPipeline *GPU_GetPipeline(GPU_PipelineCache *cache, GPU_Shaders *
     return pipeline;
 }
 
+void GPU_LoadPipelineCache(GPU_PipelineCache *cache, GPU_Shaders *shaders, SDL_GPUDevice *device, SDL_Storage *storage)
+{
+    GPU_PipelineCacheFileHeader header;
+    const GPU_PipelineCacheFileEntry *entries;
+    Uint64 length = 0;
+    Uint8 *data;
+    Uint32 i, num_created = 0;
+
+    cache->storage = storage;
+    cache->device_hash = GetPipelineCacheDeviceHash(device);
+
+    if (!SDL_StorageReady(storage) ||
+        !SDL_GetStorageFileSize(storage, GPU_PIPELINE_CACHE_FILE, &length) ||
+        length < sizeof(header) || length > SDL_MAX_SINT32) {
+        return;
+    }
+
+    data = (Uint8 *)SDL_malloc((size_t)length);
+    if (!data) {
+        return;
+    }
+    if (!SDL_ReadStorageFile(storage, GPU_PIPELINE_CACHE_FILE, data, length)) {
+        SDL_free(data);
+        return;
+    }
+
+    SDL_memcpy(&header, data, sizeof(header));
+    header.magic = SDL_Swap32LE(header.magic);
+    header.version = SDL_Swap32LE(header.version);
+    header.device_hash = SDL_Swap32LE(header.device_hash);
+    header.num_entries = SDL_Swap32LE(header.num_entries);
+    if (header.magic != GPU_PIPELINE_CACHE_MAGIC ||
+        header.version != GPU_PIPELINE_CACHE_VERSION ||
+        header.device_hash != cache->device_hash ||
+        header.num_entries > (length - sizeof(header)) / sizeof(*entries)) {
+        // Written by another version of SDL, or for another device or driver, it'll be replaced on exit.
+        SDL_free(data);
+        cache->dirty = true;
+        return;
+    }
+
+    entries = (const GPU_PipelineCacheFileEntry *)(data + sizeof(header));
+    for (i = 0; i < header.num_entries; ++i) {
+        GPU_PipelineParameters params;
+        SDL_zero(params);
+        params.blend_mode = (SDL_BlendMode)SDL_Swap32LE(entries[i].blend_mode);
+        params.frag_shader = (GPU_FragmentShaderID)SDL_Swap32LE(entries[i].frag_shader);
+        params.vert_shader = (GPU_VertexShaderID)SDL_Swap32LE(entries[i].vert_shader);
+        params.attachment_format = (SDL_GPUTextureFormat)SDL_Swap32LE(entries[i].attachment_format);
+        params.primitive_type = (SDL_GPUPrimitiveType)SDL_Swap32LE(entries[i].primitive_type);
+
+        if ((int)params.frag_shader < 0 || params.frag_shader >= FRAG_SHADER_TEXTURE_CUSTOM ||
+            (int)params.vert_shader < 0 || params.vert_shader >= NUM_VERT_SHADERS) {
+            continue;
+        }
+        if (GPU_GetPipeline(cache, shaders, device, &params)) {
+            ++num_created;
+        }
+    }
+    SDL_free(data);
+
+    // Only save again once a pipeline that wasn't in the file is needed
+    cache->dirty = false;
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Created %" SDL_PRIu32 " GPU pipelines from the pipeline cache", num_created);
+}
+
 #endif // SDL_VIDEO_RENDER_GPU
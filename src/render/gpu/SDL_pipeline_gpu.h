@@ -39,9 +39,15 @@ typedef struct GPU_PipelineParameters
 typedef struct GPU_PipelineCache
 {
     SDL_HashTable *table;
+
+    // Where the set of pipelines is saved between runs, if anywhere
+    SDL_Storage *storage;
+    Uint32 device_hash;
+    bool dirty;
 } GPU_PipelineCache;
 
 extern bool GPU_InitPipelineCache(GPU_PipelineCache *cache, SDL_GPUDevice *device);
+extern void GPU_LoadPipelineCache(GPU_PipelineCache *cache, GPU_Shaders *shaders, SDL_GPUDevice *device, SDL_Storage *storage);
 extern void GPU_DestroyPipelineCache(GPU_PipelineCache *cache);
 extern SDL_GPUGraphicsPipeline *GPU_GetPipeline(GPU_PipelineCache *cache, GPU_Shaders *shaders, SDL_GPUDevice *device, const GPU_PipelineParameters *params);
 
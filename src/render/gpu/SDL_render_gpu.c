@@ -43,6 +43,26 @@ typedef struct GPU_FragmentShaderUniformData
     float texture_height;
 } GPU_FragmentShaderUniformData;
 
+// Number of frames of texture uploads that may be in flight at once
+#define GPU_UPLOAD_FRAMES 3
+
+// Texture data is placed on 512 byte boundaries, which D3D12 requires and covers every texel size
+#define GPU_UPLOAD_ALIGNMENT 512
+
+// A slot of the upload ring, holding one frame of texture uploads
+typedef struct GPU_UploadFrame
+{
+    SDL_GPUTransferBuffer *transfer_buf;
+    Uint32 size;
+    SDL_GPUFence *fence; // signaled once the GPU has finished reading the slot
+} GPU_UploadFrame;
+
+typedef struct GPU_PendingUpload
+{
+    SDL_GPUTextureTransferInfo source;
+    SDL_GPUTextureRegion destination;
+} GPU_PendingUpload;
+
 typedef struct GPU_RenderData
 {
     SDL_GPUDevice *device;
@@ -70,6 +90,23 @@ typedef struct GPU_RenderData
         Uint32 buffer_size;
     } vertices;
 
+    struct
+    {
+        GPU_UploadFrame frames[GPU_UPLOAD_FRAMES];
+        int current;   // the slot this frame's uploads are written to
+        Uint8 *mapped; // non-NULL while the current slot is mapped
+        Uint32 offset; // write cursor within the current slot
+        Uint32 used;   // bytes uploaded so far this frame
+        Uint32 peak;   // the most bytes uploaded in a single frame
+        int num_locked; // streaming textures writing directly into the mapped slot
+        GPU_PendingUpload *pending;
+        int num_pending;
+        int pending_capacity;
+        SDL_GPUTransferBuffer **retired; // outgrown buffers that locked textures may still be writing to
+        int num_retired;
+        int retired_capacity;
+    } uploads;
+
     struct
     {
         SDL_GPURenderPass *render_pass;
@@ -91,9 +128,9 @@ typedef struct GPU_TextureData
     SDL_GPUTexture *texture;
     SDL_GPUTextureFormat format;
     GPU_FragmentShaderID shader;
-    void *pixels;
-    int pitch;
     SDL_Rect locked_rect;
+    SDL_GPUTransferBuffer *locked_buf;
+    Uint32 locked_offset;
 } GPU_TextureData;
 
 static bool GPU_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode)
@@ -126,6 +163,14 @@ static SDL_GPUTextureFormat PixFormatToTexFormat(SDL_PixelFormat pixel_format)
     case SDL_PIXELFORMAT_RGBA32:
     case SDL_PIXELFORMAT_RGBX32:
         return SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    case SDL_PIXELFORMAT_BC1:
+        return SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM;
+    case SDL_PIXELFORMAT_BC2:
+        return SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM;
+    case SDL_PIXELFORMAT_BC3:
+        return SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM;
+    case SDL_PIXELFORMAT_BC7:
+        return SDL_GPU_TEXTUREFORMAT_BC7_RGBA_UNORM;
 
     // YUV TODO
     case SDL_PIXELFORMAT_YV12:
@@ -193,29 +238,6 @@ static bool GPU_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_
         return false;
     }
 
-    if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
-        size_t size;
-        data->pitch = texture->w * SDL_BYTESPERPIXEL(texture->format);
-        size = (size_t)texture->h * data->pitch;
-        if (texture->format == SDL_PIXELFORMAT_YV12 ||
-            texture->format == SDL_PIXELFORMAT_IYUV) {
-            // Need to add size for the U and V planes
-            size += 2 * ((texture->h + 1) / 2) * ((data->pitch + 1) / 2);
-        }
-        if (texture->format == SDL_PIXELFORMAT_NV12 ||
-            texture->format == SDL_PIXELFORMAT_NV21) {
-            // Need to add size for the U/V plane
-            size += 2 * ((texture->h + 1) / 2) * ((data->pitch + 1) / 2);
-        }
-        data->pixels = SDL_calloc(1, size);
-        if (!data->pixels) {
-            SDL_free(data);
-            return false;
-        }
-
-        // TODO allocate a persistent transfer buffer
-    }
-
     if (texture->access == SDL_TEXTUREACCESS_TARGET) {
         usage |= SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
     }
@@ -238,7 +260,8 @@ static bool GPU_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_
         return false;
     }
 
-    if (texture->format == SDL_PIXELFORMAT_RGBA32 || texture->format == SDL_PIXELFORMAT_BGRA32) {
+    if (texture->format == SDL_PIXELFORMAT_RGBA32 || texture->format == SDL_PIXELFORMAT_BGRA32 ||
+        SDL_GetCompressedBlockBytes(texture->format)) {
         data->shader = FRAG_SHADER_TEXTURE_RGBA;
     } else {
         data->shader = FRAG_SHADER_TEXTURE_RGB;
@@ -247,33 +270,239 @@ static bool GPU_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_
     return true;
 }
 
+static void ReleaseRetiredUploads(GPU_RenderData *data)
+{
+    for (int i = 0; i < data->uploads.num_retired; ++i) {
+        SDL_UnmapGPUTransferBuffer(data->device, data->uploads.retired[i]);
+        SDL_ReleaseGPUTransferBuffer(data->device, data->uploads.retired[i]);
+    }
+    data->uploads.num_retired = 0;
+}
+
+// Record the pending uploads, they have to land before anything that might sample the textures
+static void FlushUploads(GPU_RenderData *data)
+{
+    if (data->uploads.num_pending == 0) {
+        return;
+    }
+
+    // The copies may only read the ring once it's unmapped, which has to wait while textures are locked
+    if (data->uploads.num_locked == 0) {
+        if (data->uploads.mapped) {
+            SDL_UnmapGPUTransferBuffer(data->device, data->uploads.frames[data->uploads.current].transfer_buf);
+            data->uploads.mapped = NULL;
+        }
+    }
+
+    SDL_GPUCopyPass *pass = SDL_BeginGPUCopyPass(data->state.command_buffer);
+    for (int i = 0; i < data->uploads.num_pending; ++i) {
+        SDL_UploadToGPUTexture(pass, &data->uploads.pending[i].source, &data->uploads.pending[i].destination, false);
+    }
+    SDL_EndGPUCopyPass(pass);
+    data->uploads.num_pending = 0;
+
+    // The recorded copies keep outgrown buffers alive until the GPU is done with them
+    if (data->uploads.num_locked == 0) {
+        ReleaseRetiredUploads(data);
+    }
+}
+
+static bool RetireUploadBuffer(GPU_RenderData *data, SDL_GPUTransferBuffer *tbuf)
+{
+    if (data->uploads.num_retired == data->uploads.retired_capacity) {
+        int new_capacity = data->uploads.retired_capacity ? data->uploads.retired_capacity * 2 : 4;
+        SDL_GPUTransferBuffer **new_retired = (SDL_GPUTransferBuffer **)SDL_realloc(data->uploads.retired, new_capacity * sizeof(*new_retired));
+        if (!new_retired) {
+            return false;
+        }
+        data->uploads.retired = new_retired;
+        data->uploads.retired_capacity = new_capacity;
+    }
+    data->uploads.retired[data->uploads.num_retired++] = tbuf;
+    return true;
+}
+
+// Reserve space for an upload in the current slot of the upload ring, returning a pointer to write it to
+static Uint8 *AllocateUpload(GPU_RenderData *data, Uint32 size, SDL_GPUTransferBuffer **tbuf, Uint32 *offset)
+{
+    GPU_UploadFrame *frame = &data->uploads.frames[data->uploads.current];
+    Uint32 start = (data->uploads.offset + GPU_UPLOAD_ALIGNMENT - 1) & ~(GPU_UPLOAD_ALIGNMENT - 1);
+
+    if (!data->uploads.mapped && frame->fence) {
+        // The slot was last used GPU_UPLOAD_FRAMES frames ago, so this rarely has to wait
+        SDL_WaitForGPUFences(data->device, true, &frame->fence, 1);
+        SDL_ReleaseGPUFence(data->device, frame->fence);
+        frame->fence = NULL;
+    }
+
+    if (frame->transfer_buf && (start < data->uploads.offset || start > frame->size || size > frame->size - start)) {
+        // This frame outgrew its slot, replace the buffer with a larger one
+        if (data->uploads.mapped) {
+            if (!RetireUploadBuffer(data, frame->transfer_buf)) {
+                return NULL;
+            }
+            data->uploads.mapped = NULL;
+        } else {
+            SDL_ReleaseGPUTransferBuffer(data->device, frame->transfer_buf);
+        }
+        frame->transfer_buf = NULL;
+    }
+
+    if (!frame->transfer_buf) {
+        SDL_GPUTransferBufferCreateInfo tbci;
+        SDL_zero(tbci);
+        tbci.size = SDL_max(SDL_max(data->uploads.peak, data->uploads.used + size), frame->size * 2);
+        tbci.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+
+        frame->transfer_buf = SDL_CreateGPUTransferBuffer(data->device, &tbci);
+        if (!frame->transfer_buf) {
+            frame->size = 0;
+            return NULL;
+        }
+        frame->size = tbci.size;
+        data->uploads.offset = 0;
+        start = 0;
+    }
+
+    if (!data->uploads.mapped) {
+        data->uploads.mapped = (Uint8 *)SDL_MapGPUTransferBuffer(data->device, frame->transfer_buf, false);
+        if (!data->uploads.mapped) {
+            return NULL;
+        }
+    }
+
+    data->uploads.used += (start - data->uploads.offset) + size;
+    data->uploads.offset = start + size;
+
+    *tbuf = frame->transfer_buf;
+    *offset = start;
+    return data->uploads.mapped + start;
+}
+
+static bool QueueUpload(GPU_RenderData *data, GPU_TextureData *texdata, const SDL_Rect *rect, SDL_GPUTransferBuffer *tbuf, Uint32 offset)
+{
+    if (data->uploads.num_pending == data->uploads.pending_capacity) {
+        int new_capacity = data->uploads.pending_capacity ? data->uploads.pending_capacity * 2 : 16;
+        GPU_PendingUpload *new_pending = (GPU_PendingUpload *)SDL_realloc(data->uploads.pending, new_capacity * sizeof(*new_pending));
+        if (!new_pending) {
+            return false;
+        }
+        data->uploads.pending = new_pending;
+        data->uploads.pending_capacity = new_capacity;
+    }
+
+    GPU_PendingUpload *pending = &data->uploads.pending[data->uploads.num_pending++];
+    SDL_zerop(pending);
+    pending->source.transfer_buffer = tbuf;
+    pending->source.offset = offset;
+    pending->source.rows_per_layer = rect->h;
+    pending->source.pixels_per_row = rect->w;
+    pending->destination.texture = texdata->texture;
+    pending->destination.x = rect->x;
+    pending->destination.y = rect->y;
+    pending->destination.w = rect->w;
+    pending->destination.h = rect->h;
+    pending->destination.d = 1;
+    return true;
+}
+
+// Submit the frame's command buffer and move the upload ring on to the next slot
+static void SubmitFrame(GPU_RenderData *data)
+{
+    GPU_UploadFrame *frame = &data->uploads.frames[data->uploads.current];
+
+    if (data->uploads.used == 0) {
+        SDL_SubmitGPUCommandBuffer(data->state.command_buffer);
+        return;
+    }
+
+    if (frame->fence) {
+        SDL_ReleaseGPUFence(data->device, frame->fence);
+    }
+    frame->fence = SDL_SubmitGPUCommandBufferAndAcquireFence(data->state.command_buffer);
+
+    data->uploads.peak = SDL_max(data->uploads.peak, data->uploads.used);
+    data->uploads.used = 0;
+
+    // A locked texture is still writing to this slot, so keep filling it next frame
+    if (data->uploads.num_locked == 0) {
+        if (data->uploads.mapped) {
+            SDL_UnmapGPUTransferBuffer(data->device, frame->transfer_buf);
+            data->uploads.mapped = NULL;
+        }
+        data->uploads.current = (data->uploads.current + 1) % GPU_UPLOAD_FRAMES;
+        data->uploads.offset = 0;
+
+        // Slots are sized for the busiest frame seen so far
+        frame = &data->uploads.frames[data->uploads.current];
+        if (frame->transfer_buf && frame->size < data->uploads.peak) {
+            // The release is deferred until the GPU is done reading the buffer
+            if (frame->fence) {
+                SDL_ReleaseGPUFence(data->device, frame->fence);
+                frame->fence = NULL;
+            }
+            SDL_ReleaseGPUTransferBuffer(data->device, frame->transfer_buf);
+            frame->transfer_buf = NULL;
+            frame->size = 0;
+        }
+    }
+}
+
+static void ReleaseUploadRing(GPU_RenderData *data)
+{
+    if (data->uploads.mapped) {
+        SDL_UnmapGPUTransferBuffer(data->device, data->uploads.frames[data->uploads.current].transfer_buf);
+        data->uploads.mapped = NULL;
+    }
+    ReleaseRetiredUploads(data);
+
+    for (int i = 0; i < GPU_UPLOAD_FRAMES; ++i) {
+        GPU_UploadFrame *frame = &data->uploads.frames[i];
+        if (frame->fence) {
+            SDL_ReleaseGPUFence(data->device, frame->fence);
+        }
+        if (frame->transfer_buf) {
+            SDL_ReleaseGPUTransferBuffer(data->device, frame->transfer_buf);
+        }
+    }
+
+    SDL_free(data->uploads.pending);
+    SDL_free(data->uploads.retired);
+}
+
 static bool GPU_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
                               const SDL_Rect *rect, const void *pixels, int pitch)
 {
     GPU_RenderData *renderdata = (GPU_RenderData *)renderer->internal;
     GPU_TextureData *data = (GPU_TextureData *)texture->internal;
-    const Uint32 texturebpp = SDL_BYTESPERPIXEL(texture->format);
+    const Uint32 blockbytes = (Uint32)SDL_GetCompressedBlockBytes(texture->format);
+    Uint32 texturebpp = SDL_BYTESPERPIXEL(texture->format);
+    int rows = rect->h;
+    int row_w = rect->w;
 
     size_t row_size, data_size;
 
-    if (!SDL_size_mul_check_overflow(rect->w, texturebpp, &row_size) ||
-        !SDL_size_mul_check_overflow(rect->h, row_size, &data_size)) {
-        return SDL_SetError("update size overflow");
+    if (blockbytes) {
+        // Compressed data is copied a row of 4x4 blocks at a time
+        texturebpp = blockbytes;
+        row_w = rect->w / SDL_COMPRESSED_BLOCK_SIZE;
+        rows = rect->h / SDL_COMPRESSED_BLOCK_SIZE;
     }
 
-    SDL_GPUTransferBufferCreateInfo tbci;
-    SDL_zero(tbci);
-    tbci.size = (Uint32)data_size;
-    tbci.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    if (!SDL_size_mul_check_overflow(row_w, texturebpp, &row_size) ||
+        !SDL_size_mul_check_overflow(rows, row_size, &data_size) ||
+        data_size > SDL_MAX_UINT32) {
+        return SDL_SetError("update size overflow");
+    }
 
-    SDL_GPUTransferBuffer *tbuf = SDL_CreateGPUTransferBuffer(renderdata->device, &tbci);
+    SDL_GPUTransferBuffer *tbuf;
+    Uint32 offset;
+    Uint8 *output = AllocateUpload(renderdata, (Uint32)data_size, &tbuf, &offset);
 
-    if (tbuf == NULL) {
+    if (!output) {
         return false;
     }
 
-    Uint8 *output = SDL_MapGPUTransferBuffer(renderdata->device, tbuf, false);
-
     if ((size_t)pitch == row_size) {
         SDL_memcpy(output, pixels, data_size);
     } else {
@@ -281,64 +510,43 @@ static bool GPU_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
         // If not, maybe use SDL_GPUTextureTransferInfo::pixels_per_row instead of this
         const Uint8 *input = pixels;
 
-        for (int i = 0; i < rect->h; ++i) {
+        for (int i = 0; i < rows; ++i) {
             SDL_memcpy(output, input, row_size);
             output += row_size;
             input += pitch;
         }
     }
 
-    SDL_UnmapGPUTransferBuffer(renderdata->device, tbuf);
-
-    SDL_GPUCommandBuffer *cbuf = renderdata->state.command_buffer;
-    SDL_GPUCopyPass *cpass = SDL_BeginGPUCopyPass(cbuf);
-
-    SDL_GPUTextureTransferInfo tex_src;
-    SDL_zero(tex_src);
-    tex_src.transfer_buffer = tbuf;
-    tex_src.rows_per_layer = rect->h;
-    tex_src.pixels_per_row = rect->w;
-
-    SDL_GPUTextureRegion tex_dst;
-    SDL_zero(tex_dst);
-    tex_dst.texture = data->texture;
-    tex_dst.x = rect->x;
-    tex_dst.y = rect->y;
-    tex_dst.w = rect->w;
-    tex_dst.h = rect->h;
-    tex_dst.d = 1;
-
-    SDL_UploadToGPUTexture(cpass, &tex_src, &tex_dst, false);
-    SDL_EndGPUCopyPass(cpass);
-    SDL_ReleaseGPUTransferBuffer(renderdata->device, tbuf);
-
-    return true;
+    return QueueUpload(renderdata, data, rect, tbuf, offset);
 }
 
+// Streaming textures are written straight into the upload ring
 static bool GPU_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
                             const SDL_Rect *rect, void **pixels, int *pitch)
 {
+    GPU_RenderData *renderdata = (GPU_RenderData *)renderer->internal;
     GPU_TextureData *data = (GPU_TextureData *)texture->internal;
+    const Uint32 row_size = (Uint32)rect->w * SDL_BYTESPERPIXEL(texture->format);
+    Uint8 *output = AllocateUpload(renderdata, row_size * rect->h, &data->locked_buf, &data->locked_offset);
+
+    if (!output) {
+        return false;
+    }
 
+    ++renderdata->uploads.num_locked;
     data->locked_rect = *rect;
-    *pixels =
-        (void *)((Uint8 *)data->pixels + rect->y * data->pitch +
-                 rect->x * SDL_BYTESPERPIXEL(texture->format));
-    *pitch = data->pitch;
+    *pixels = output;
+    *pitch = (int)row_size;
     return true;
 }
 
 static void GPU_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
+    GPU_RenderData *renderdata = (GPU_RenderData *)renderer->internal;
     GPU_TextureData *data = (GPU_TextureData *)texture->internal;
-    const SDL_Rect *rect;
-    void *pixels;
-
-    rect = &data->locked_rect;
-    pixels =
-        (void *)((Uint8 *)data->pixels + rect->y * data->pitch +
-                 rect->x * SDL_BYTESPERPIXEL(texture->format));
-    GPU_UpdateTexture(renderer, texture, rect, pixels, data->pitch);
+
+    --renderdata->uploads.num_locked;
+    QueueUpload(renderdata, data, &data->locked_rect, data->locked_buf, data->locked_offset);
 }
 
 static bool GPU_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -774,6 +982,8 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
 {
     GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
 
+    FlushUploads(data);
+
     if (!UploadVertices(data, vertices, vertsize)) {
         return false;
     }
@@ -844,6 +1054,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             if (count > 2) {
                 // joined lines cannot be grouped
                 Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINESTRIP);
+                ++renderer->stats.draw_calls;
             } else {
                 // let's group non joined lines
                 SDL_RenderCommand *finalcmd = cmd;
@@ -866,6 +1077,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                 }
 
                 Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINELIST);
+                ++renderer->stats.draw_calls;
                 cmd = finalcmd; // skip any copy commands we just combined in here.
             }
             break;
@@ -911,11 +1123,18 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             }
 
             Draw(data, cmd, count, offset, prim);
+            ++renderer->stats.draw_calls;
 
             cmd = finalcmd; // skip any copy commands we just combined in here.
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -935,7 +1154,16 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
     return true;
 }
 
-static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
+// A pixel readback into a transfer buffer
+typedef struct GPU_ReadbackData
+{
+    SDL_GPUTransferBuffer *transfer_buffer;
+    SDL_GPUFence *fence;
+    SDL_PixelFormat format;
+} GPU_ReadbackData;
+
+// Download a rect of the current render target and submit the command buffer, returning its fence
+static SDL_GPUTransferBuffer *GPU_DownloadRenderTarget(SDL_Renderer *renderer, const SDL_Rect *rect, SDL_PixelFormat *format, SDL_GPUFence **fence)
 {
     GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
     SDL_GPUTexture *gpu_tex;
@@ -965,12 +1193,6 @@ static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect
         return NULL;
     }
 
-    SDL_Surface *surface = SDL_CreateSurface(rect->w, rect->h, pixfmt);
-
-    if (!surface) {
-        return NULL;
-    }
-
     SDL_GPUTransferBufferCreateInfo tbci;
     SDL_zero(tbci);
     tbci.size = (Uint32)image_size;
@@ -982,6 +1204,8 @@ static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect
         return NULL;
     }
 
+    FlushUploads(data);
+
     SDL_GPUCopyPass *pass = SDL_BeginGPUCopyPass(data->state.command_buffer);
 
     SDL_GPUTextureRegion src;
@@ -1002,20 +1226,37 @@ static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect
     SDL_DownloadFromGPUTexture(pass, &src, &dst);
     SDL_EndGPUCopyPass(pass);
 
-    SDL_GPUFence *fence = SDL_SubmitGPUCommandBufferAndAcquireFence(data->state.command_buffer);
-    SDL_WaitForGPUFences(data->device, true, &fence, 1);
-    SDL_ReleaseGPUFence(data->device, fence);
+    *fence = SDL_SubmitGPUCommandBufferAndAcquireFence(data->state.command_buffer);
     data->state.command_buffer = SDL_AcquireGPUCommandBuffer(data->device);
 
+    *format = pixfmt;
+    return tbuf;
+}
+
+// Copy the pixels out of a downloaded transfer buffer, the download must have finished
+static SDL_Surface *GPU_ReadTransferBuffer(GPU_RenderData *data, SDL_GPUTransferBuffer *tbuf, int w, int h, SDL_PixelFormat pixfmt)
+{
+    const size_t row_size = (size_t)w * SDL_BYTESPERPIXEL(pixfmt);
+    SDL_Surface *surface = SDL_CreateSurface(w, h, pixfmt);
+
+    if (!surface) {
+        return NULL;
+    }
+
     void *mapped_tbuf = SDL_MapGPUTransferBuffer(data->device, tbuf, false);
 
+    if (!mapped_tbuf) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+
     if ((size_t)surface->pitch == row_size) {
-        SDL_memcpy(surface->pixels, mapped_tbuf, image_size);
+        SDL_memcpy(surface->pixels, mapped_tbuf, row_size * h);
     } else {
         Uint8 *input = mapped_tbuf;
         Uint8 *output = surface->pixels;
 
-        for (int row = 0; row < rect->h; ++row) {
+        for (int row = 0; row < h; ++row) {
             SDL_memcpy(output, input, row_size);
             output += surface->pitch;
             input += row_size;
@@ -1023,11 +1264,86 @@ static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect
     }
 
     SDL_UnmapGPUTransferBuffer(data->device, tbuf);
+
+    return surface;
+}
+
+static SDL_Surface *GPU_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+    SDL_GPUFence *fence = NULL;
+    SDL_PixelFormat pixfmt;
+    SDL_Surface *surface = NULL;
+
+    SDL_GPUTransferBuffer *tbuf = GPU_DownloadRenderTarget(renderer, rect, &pixfmt, &fence);
+
+    if (!tbuf) {
+        return NULL;
+    }
+
+    if (fence) {
+        SDL_WaitForGPUFences(data->device, true, &fence, 1);
+        SDL_ReleaseGPUFence(data->device, fence);
+        surface = GPU_ReadTransferBuffer(data, tbuf, rect->w, rect->h, pixfmt);
+    }
     SDL_ReleaseGPUTransferBuffer(data->device, tbuf);
 
     return surface;
 }
 
+static void GPU_DestroyReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+    GPU_ReadbackData *readbackdata = (GPU_ReadbackData *)readback->internal;
+
+    if (readbackdata->fence) {
+        SDL_ReleaseGPUFence(data->device, readbackdata->fence);
+    }
+    SDL_ReleaseGPUTransferBuffer(data->device, readbackdata->transfer_buffer);
+    SDL_free(readbackdata);
+    readback->internal = NULL;
+}
+
+static bool GPU_QueueReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GPU_ReadbackData *readbackdata = (GPU_ReadbackData *)SDL_calloc(1, sizeof(*readbackdata));
+
+    if (!readbackdata) {
+        return false;
+    }
+
+    readbackdata->transfer_buffer = GPU_DownloadRenderTarget(renderer, &readback->rect, &readbackdata->format, &readbackdata->fence);
+    if (!readbackdata->transfer_buffer) {
+        SDL_free(readbackdata);
+        return false;
+    }
+    readback->internal = readbackdata;
+
+    if (!readbackdata->fence) {
+        GPU_DestroyReadPixels(renderer, readback);
+        return false;
+    }
+    return true;
+}
+
+static bool GPU_IsReadPixelsReady(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+    GPU_ReadbackData *readbackdata = (GPU_ReadbackData *)readback->internal;
+
+    return SDL_QueryGPUFence(data->device, readbackdata->fence);
+}
+
+static SDL_Surface *GPU_CollectReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+    GPU_ReadbackData *readbackdata = (GPU_ReadbackData *)readback->internal;
+
+    SDL_WaitForGPUFences(data->device, true, &readbackdata->fence, 1);
+
+    return GPU_ReadTransferBuffer(data, readbackdata->transfer_buffer, readback->rect.w, readback->rect.h, readbackdata->format);
+}
+
 static bool CreateBackbuffer(GPU_RenderData *data, Uint32 w, Uint32 h, SDL_GPUTextureFormat fmt)
 {
     SDL_GPUTextureCreateInfo tci;
@@ -1056,6 +1372,8 @@ static bool GPU_RenderPresent(SDL_Renderer *renderer)
 {
     GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
 
+    FlushUploads(data);
+
     SDL_GPUTexture *swapchain;
     Uint32 swapchain_texture_width, swapchain_texture_height;
     bool result = SDL_WaitAndAcquireGPUSwapchainTexture(data->state.command_buffer, renderer->window, &swapchain, &swapchain_texture_width, &swapchain_texture_height);
@@ -1079,14 +1397,14 @@ static bool GPU_RenderPresent(SDL_Renderer *renderer)
 
         SDL_BlitGPUTexture(data->state.command_buffer, &blit_info);
 
-        SDL_SubmitGPUCommandBuffer(data->state.command_buffer);
+        SubmitFrame(data);
 
         if (swapchain_texture_width != data->backbuffer.width || swapchain_texture_height != data->backbuffer.height) {
             SDL_ReleaseGPUTexture(data->device, data->backbuffer.texture);
             CreateBackbuffer(data, swapchain_texture_width, swapchain_texture_height, SDL_GetGPUSwapchainTextureFormat(data->device, renderer->window));
         }
     } else {
-        SDL_SubmitGPUCommandBuffer(data->state.command_buffer);
+        SubmitFrame(data);
     }
 
     data->state.command_buffer = SDL_AcquireGPUCommandBuffer(data->device);
@@ -1107,8 +1425,10 @@ static void GPU_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
         return;
     }
 
+    // Pending uploads still refer to the texture
+    FlushUploads(renderdata);
+
     SDL_ReleaseGPUTexture(renderdata->device, data->texture);
-    SDL_free(data->pixels);
     SDL_free(data);
     texture->internal = NULL;
 }
@@ -1141,6 +1461,7 @@ static void GPU_DestroyRenderer(SDL_Renderer *renderer)
     }
 
     ReleaseVertexBuffer(data);
+    ReleaseUploadRing(data);
     GPU_DestroyPipelineCache(&data->pipeline_cache);
 
     if (data->device) {
@@ -1234,6 +1555,10 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     renderer->InvalidateCachedState = GPU_InvalidateCachedState;
     renderer->RunCommandQueue = GPU_RunCommandQueue;
     renderer->RenderReadPixels = GPU_RenderReadPixels;
+    renderer->QueueReadPixels = GPU_QueueReadPixels;
+    renderer->IsReadPixelsReady = GPU_IsReadPixelsReady;
+    renderer->CollectReadPixels = GPU_CollectReadPixels;
+    renderer->DestroyReadPixels = GPU_DestroyReadPixels;
     renderer->RenderPresent = GPU_RenderPresent;
     renderer->DestroyTexture = GPU_DestroyTexture;
     renderer->DestroyRenderer = GPU_DestroyRenderer;
@@ -1267,6 +1592,11 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
         return false;
     }
 
+    SDL_Storage *pipeline_storage = (SDL_Storage *)SDL_GetPointerProperty(create_props, SDL_PROP_RENDERER_CREATE_GPU_PIPELINE_CACHE_STORAGE_POINTER, NULL);
+    if (pipeline_storage) {
+        GPU_LoadPipelineCache(&data->pipeline_cache, &data->shaders, data->device, pipeline_storage);
+    }
+
     // XXX what's a good initial size?
     if (!InitVertexBuffer(data, 1 << 16)) {
         return false;
@@ -1290,6 +1620,17 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_RGBA32);
     SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_BGRX32);
     SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_RGBX32);
+    {
+        const SDL_PixelFormat compressed_formats[] = {
+            SDL_PIXELFORMAT_BC1, SDL_PIXELFORMAT_BC2, SDL_PIXELFORMAT_BC3, SDL_PIXELFORMAT_BC7
+        };
+        for (int i = 0; i < SDL_arraysize(compressed_formats); ++i) {
+            if (SDL_GPUTextureSupportsFormat(data->device, PixFormatToTexFormat(compressed_formats[i]),
+                                             SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
+                SDL_AddSupportedTextureFormat(renderer, compressed_formats[i]);
+            }
+        }
+    }
 
     SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 16384);
 
@@ -368,6 +368,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_DrawPoints(verts, count);
+            ++renderer->stats.draw_calls;
             break;
         }
         case SDL_RENDERCMD_DRAW_LINES:
@@ -384,6 +385,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_DrawLines(verts, count);
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -401,6 +403,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_FillRects(verts, count);
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -418,6 +421,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_Copy(renderer, texture, srcrect, dstrect);
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -433,6 +437,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_CopyEx(renderer, texture, copydata);
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -440,6 +445,16 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
         {
             break;
         }
+
+        case SDL_RENDERCMD_TEXTURE_BATCH:
+        {
+            break;
+        }
+
+        case SDL_RENDERCMD_LINE_BATCH:
+        {
+            break;
+        }
         }
         cmd = cmd->next;
     }
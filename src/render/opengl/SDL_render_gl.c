@@ -43,6 +43,14 @@
 #define RENDERER_CONTEXT_MAJOR 2
 #define RENDERER_CONTEXT_MINOR 1
 
+// The number of pixel buffers cycled through by each streaming texture
+#define GL_PIXEL_BUFFER_COUNT 3
+
+/* When GPU timing is enabled, each frame's command queues and present are
+   bracketed by GL_TIME_ELAPSED queries. The results are read back up to
+   GL_TIMING_FRAMES frames later, so checking them never waits on the GPU. */
+#define GL_TIMING_FRAMES 4
+
 // OpenGL renderer implementation
 
 /* Details on optimizing the texture path on macOS:
@@ -68,6 +76,7 @@ typedef struct
     int drawableh;
     SDL_BlendMode blend;
     GL_Shader shader;
+    bool shader_instanced;
     float texel_size[4];
     const float *shader_params;
     bool cliprect_enabled_dirty;
@@ -83,8 +92,40 @@ typedef struct
     SDL_FColor color;
     bool clear_color_dirty;
     SDL_FColor clear_color;
+
+    // The state last sent to GL, so calls that wouldn't change anything can be skipped
+    SDL_Rect gl_viewport;
+    bool gl_viewport_target;
+    SDL_Rect gl_scissor;
+    bool scissor_test;
+    bool scissor_test_dirty;
+    bool blend_enabled;
+    bool blend_enabled_dirty;
+    GLenum gl_blend_func[4];
+    GLenum gl_blend_equation;
+    bool instance_arrays;
 } GL_DrawStateCache;
 
+// Elapsed time queries for one frame when GPU timing is enabled
+typedef struct
+{
+    GLuint *queries;
+    int num_queries;
+    int max_queries;
+    bool active;
+    bool pending;
+} GL_TimingFrame;
+
+// A pixel readback into a pixel buffer object
+typedef struct
+{
+    GLuint buffer;
+    GLsync fence;
+    SDL_PixelFormat format;
+    int pitch;
+    bool flip;
+} GL_ReadbackData;
+
 typedef struct
 {
     SDL_GLContext context;
@@ -119,6 +160,47 @@ typedef struct
     PFNGLBINDFRAMEBUFFEREXTPROC glBindFramebufferEXT;
     PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
 
+    // Vertex buffer support, vertices are streamed into a buffer that's orphaned each frame
+    bool GL_ARB_vertex_buffer_object_supported;
+    PFNGLGENBUFFERSARBPROC glGenBuffersARB;
+    PFNGLDELETEBUFFERSARBPROC glDeleteBuffersARB;
+    PFNGLBINDBUFFERARBPROC glBindBufferARB;
+    PFNGLBUFFERDATAARBPROC glBufferDataARB;
+    PFNGLMAPBUFFERARBPROC glMapBufferARB;
+    PFNGLUNMAPBUFFERARBPROC glUnmapBufferARB;
+    GLuint vertex_buffer;
+
+    // Streaming textures upload from pixel buffers when this is available
+    bool GL_ARB_pixel_buffer_object_supported;
+
+    // Asynchronous pixel readbacks are fenced when this is available
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+
+    // Texture batches are drawn as instanced quads when this is available
+    bool GL_ARB_instanced_arrays_supported;
+    PFNGLVERTEXATTRIBPOINTERARBPROC glVertexAttribPointerARB;
+    PFNGLENABLEVERTEXATTRIBARRAYARBPROC glEnableVertexAttribArrayARB;
+    PFNGLDISABLEVERTEXATTRIBARRAYARBPROC glDisableVertexAttribArrayARB;
+    PFNGLVERTEXATTRIBDIVISORARBPROC glVertexAttribDivisorARB;
+    PFNGLDRAWARRAYSINSTANCEDARBPROC glDrawArraysInstancedARB;
+
+    // GPU timing, used when SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN is set
+    bool GL_ARB_timer_query_supported;
+    PFNGLGENQUERIESPROC glGenQueries;
+    PFNGLDELETEQUERIESPROC glDeleteQueries;
+    PFNGLBEGINQUERYPROC glBeginQuery;
+    PFNGLENDQUERYPROC glEndQuery;
+    PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+    GL_TimingFrame timing_frames[GL_TIMING_FRAMES];
+    int timing_frame;
+    bool timing_range_open;
+
+    // Block compressed textures, used when S3TC or BPTC is available
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC glCompressedTexSubImage2DARB;
+
     // Shader support
     GL_ShaderContext *shaders;
 
@@ -139,6 +221,9 @@ typedef struct
     void *pixels;
     int pitch;
     SDL_Rect locked_rect;
+    GLuint pixel_buffers[GL_PIXEL_BUFFER_COUNT];
+    int current_pixel_buffer;
+    size_t pixel_buffer_size;
 #ifdef SDL_HAVE_YUV
     // YUV texture support
     bool yuv;
@@ -436,6 +521,26 @@ static bool convert_format(Uint32 pixel_format, GLint *internalFormat, GLenum *f
         *type = GL_UNSIGNED_SHORT_8_8_APPLE;
         break;
 #endif
+    case SDL_PIXELFORMAT_BC1:
+        *internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        *format = GL_RGBA;
+        *type = GL_UNSIGNED_BYTE;
+        break;
+    case SDL_PIXELFORMAT_BC2:
+        *internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        *format = GL_RGBA;
+        *type = GL_UNSIGNED_BYTE;
+        break;
+    case SDL_PIXELFORMAT_BC3:
+        *internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        *format = GL_RGBA;
+        *type = GL_UNSIGNED_BYTE;
+        break;
+    case SDL_PIXELFORMAT_BC7:
+        *internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+        *format = GL_RGBA;
+        *type = GL_UNSIGNED_BYTE;
+        break;
     default:
         return false;
     }
@@ -485,10 +590,23 @@ static bool GL_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_P
             // Need to add size for the U/V plane
             size += 2 * ((texture->h + 1) / 2) * ((data->pitch + 1) / 2);
         }
-        data->pixels = SDL_calloc(1, size);
-        if (!data->pixels) {
-            SDL_free(data);
-            return false;
+        bool use_pixel_buffers = renderdata->GL_ARB_pixel_buffer_object_supported;
+#ifdef SDL_PLATFORM_MACOS
+        if (texture->format == SDL_PIXELFORMAT_ARGB8888 && (texture->w % 8) == 0) {
+            use_pixel_buffers = false; // the texture uses the pixels as client storage
+        }
+#endif
+        if (use_pixel_buffers) {
+            /* Locking hands out a mapped pixel buffer and unlocking uploads
+               from it, so the copy happens asynchronously in the GL. */
+            renderdata->glGenBuffersARB(GL_PIXEL_BUFFER_COUNT, data->pixel_buffers);
+            data->pixel_buffer_size = size;
+        } else {
+            data->pixels = SDL_calloc(1, size);
+            if (!data->pixels) {
+                SDL_free(data);
+                return false;
+            }
         }
     }
 
@@ -625,7 +743,8 @@ static bool GL_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_P
     }
 #endif
 
-    if (texture->format == SDL_PIXELFORMAT_ABGR8888 || texture->format == SDL_PIXELFORMAT_ARGB8888) {
+    if (texture->format == SDL_PIXELFORMAT_ABGR8888 || texture->format == SDL_PIXELFORMAT_ARGB8888 ||
+        SDL_GetCompressedBlockBytes(texture->format)) {
         data->shader = SHADER_RGBA;
     } else {
         data->shader = SHADER_RGB;
@@ -663,6 +782,42 @@ static bool GL_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture, SDL_P
     return GL_CheckError("", renderer);
 }
 
+static bool GL_UpdateTextureCompressed(SDL_Renderer *renderer, SDL_Texture *texture,
+                                       const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    GL_RenderData *renderdata = (GL_RenderData *)renderer->internal;
+    const GLenum textype = renderdata->textype;
+    GL_TextureData *data = (GL_TextureData *)texture->internal;
+    const int length = (rect->w / SDL_COMPRESSED_BLOCK_SIZE) * SDL_GetCompressedBlockBytes(texture->format);
+    const int rows = rect->h / SDL_COMPRESSED_BLOCK_SIZE;
+    GLint internalFormat;
+    GLenum format, type;
+    void *temp_pixels = NULL;
+
+    convert_format(texture->format, &internalFormat, &format, &type);
+
+    // Compressed uploads don't use the unpack row length, so the blocks need to be tightly packed
+    if (pitch != length) {
+        temp_pixels = SDL_malloc((size_t)rows * length);
+        if (!temp_pixels) {
+            return false;
+        }
+        SDL_memcpy_rows(temp_pixels, length, pixels, pitch, length, rows);
+        pixels = temp_pixels;
+    }
+
+    GL_ActivateRenderer(renderer);
+
+    renderdata->drawstate.texture = NULL; // we trash this state.
+
+    renderdata->glBindTexture(textype, data->texture);
+    renderdata->glCompressedTexSubImage2DARB(textype, 0, rect->x, rect->y, rect->w, rect->h,
+                                             internalFormat, rows * length, pixels);
+    SDL_free(temp_pixels);
+
+    return GL_CheckError("glCompressedTexSubImage2D()", renderer);
+}
+
 static bool GL_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
                              const SDL_Rect *rect, const void *pixels, int pitch)
 {
@@ -671,6 +826,10 @@ static bool GL_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
     GL_TextureData *data = (GL_TextureData *)texture->internal;
     const int texturebpp = SDL_BYTESPERPIXEL(texture->format);
 
+    if (SDL_GetCompressedBlockBytes(texture->format)) {
+        return GL_UpdateTextureCompressed(renderer, texture, rect, pixels, pitch);
+    }
+
     SDL_assert_release(texturebpp != 0); // otherwise, division by zero later.
 
     GL_ActivateRenderer(renderer);
@@ -795,10 +954,29 @@ static bool GL_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
                            const SDL_Rect *rect, void **pixels, int *pitch)
 {
     GL_TextureData *data = (GL_TextureData *)texture->internal;
+    Uint8 *base = (Uint8 *)data->pixels;
+
+    if (data->pixel_buffer_size) {
+        GL_RenderData *renderdata = (GL_RenderData *)renderer->internal;
+
+        GL_ActivateRenderer(renderer);
+
+        /* Cycle through the buffers, and orphan the storage before mapping it,
+           so we never wait on an upload the GL hasn't finished yet. */
+        data->current_pixel_buffer = (data->current_pixel_buffer + 1) % GL_PIXEL_BUFFER_COUNT;
+        renderdata->glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, data->pixel_buffers[data->current_pixel_buffer]);
+        renderdata->glBufferDataARB(GL_PIXEL_UNPACK_BUFFER_ARB, (GLsizeiptrARB)data->pixel_buffer_size, NULL, GL_STREAM_DRAW_ARB);
+        base = (Uint8 *)renderdata->glMapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY_ARB);
+        renderdata->glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+        if (!base) {
+            GL_CheckError("glMapBufferARB()", renderer);
+            return SDL_SetError("Couldn't map pixel buffer");
+        }
+    }
 
     data->locked_rect = *rect;
     *pixels =
-        (void *)((Uint8 *)data->pixels + rect->y * data->pitch +
+        (void *)(base + rect->y * data->pitch +
                  rect->x * SDL_BYTESPERPIXEL(texture->format));
     *pitch = data->pitch;
     return true;
@@ -811,6 +989,20 @@ static void GL_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
     void *pixels;
 
     rect = &data->locked_rect;
+    if (data->pixel_buffer_size) {
+        GL_RenderData *renderdata = (GL_RenderData *)renderer->internal;
+
+        GL_ActivateRenderer(renderer);
+
+        // Upload from the pixel buffer, the "pixels" are offsets into it
+        renderdata->glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, data->pixel_buffers[data->current_pixel_buffer]);
+        renderdata->glUnmapBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB);
+        pixels = (void *)(uintptr_t)(rect->y * data->pitch + rect->x * SDL_BYTESPERPIXEL(texture->format));
+        GL_UpdateTexture(renderer, texture, rect, pixels, data->pitch);
+        renderdata->glBindBufferARB(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+        return;
+    }
+
     pixels =
         (void *)((Uint8 *)data->pixels + rect->y * data->pitch +
                  rect->x * SDL_BYTESPERPIXEL(texture->format));
@@ -848,23 +1040,6 @@ static bool GL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
     return true;
 }
 
-static bool SetTextureScaleMode(GL_RenderData *data, GLenum textype, SDL_ScaleMode scaleMode)
-{
-    switch (scaleMode) {
-    case SDL_SCALEMODE_NEAREST:
-        data->glTexParameteri(textype, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        data->glTexParameteri(textype, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        break;
-    case SDL_SCALEMODE_LINEAR:
-        data->glTexParameteri(textype, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        data->glTexParameteri(textype, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        break;
-    default:
-        return SDL_SetError("Unknown texture scale mode: %d", scaleMode);
-    }
-    return true;
-}
-
 /* !!! FIXME: all these Queue* calls set up the vertex buffer the way the immediate mode
    !!! FIXME:  renderer wants it, but this might want to operate differently if we move to
    !!! FIXME:  VBOs at some point. */
@@ -989,9 +1164,86 @@ static bool GL_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL
     return true;
 }
 
-static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, const GL_Shader shader, const float *shader_params)
+static bool GL_QueueTextureBatch(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL_Texture *texture,
+                                 const SDL_TextureBatchInstance *instances, int count,
+                                 float scale_x, float scale_y)
+{
+    static const GLfloat corners[8] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+    GL_TextureData *texturedata = (GL_TextureData *)texture->internal;
+    const float color_scale = cmd->data.draw.color_scale;
+    SDL_TextureBatchInstance *dst;
+    GLfloat *verts;
+    int i;
+
+    // The quad corners shared by all instances come first, then one record per sprite
+    verts = (GLfloat *)SDL_AllocateRenderVertices(renderer, sizeof(corners) + count * sizeof(*instances), 0, &cmd->data.draw.first);
+    if (!verts) {
+        return false;
+    }
+
+    cmd->data.draw.count = count;
+
+    SDL_memcpy(verts, corners, sizeof(corners));
+    dst = (SDL_TextureBatchInstance *)(verts + SDL_arraysize(corners));
+    for (i = 0; i < count; ++i, ++dst) {
+        const SDL_TextureBatchInstance *src = &instances[i];
+        dst->origin.x = src->origin.x * scale_x;
+        dst->origin.y = src->origin.y * scale_y;
+        dst->axis_x.x = src->axis_x.x * scale_x;
+        dst->axis_x.y = src->axis_x.y * scale_y;
+        dst->axis_y.x = src->axis_y.x * scale_x;
+        dst->axis_y.y = src->axis_y.y * scale_y;
+        dst->minu = src->minu * texturedata->texw;
+        dst->minv = src->minv * texturedata->texh;
+        dst->maxu = src->maxu * texturedata->texw;
+        dst->maxv = src->maxv * texturedata->texh;
+        dst->color.r = src->color.r * color_scale;
+        dst->color.g = src->color.g * color_scale;
+        dst->color.b = src->color.b * color_scale;
+        dst->color.a = src->color.a;
+    }
+    return true;
+}
+
+static void SetScissorTest(SDL_Renderer *renderer, GL_RenderData *data, bool enabled)
+{
+    if (SDL_CountRenderStateChange(renderer, data->drawstate.scissor_test_dirty || enabled != data->drawstate.scissor_test)) {
+        if (enabled) {
+            data->glEnable(GL_SCISSOR_TEST);
+        } else {
+            data->glDisable(GL_SCISSOR_TEST);
+        }
+        data->drawstate.scissor_test = enabled;
+        data->drawstate.scissor_test_dirty = false;
+    }
+}
+
+// Consecutive texture batches leave the instance attributes enabled
+static void SetInstanceArrays(GL_RenderData *data, bool enabled)
+{
+    GLuint i;
+
+    for (i = 0; i < NUM_GL_INSTANCE_ATTRIBS; ++i) {
+        if (enabled) {
+            data->glEnableVertexAttribArrayARB(i);
+            if (i != GL_INSTANCE_ATTRIB_CORNER) {
+                data->glVertexAttribDivisorARB(i, 1);
+            }
+        } else {
+            // Leave the generic attributes the way we found them
+            if (i != GL_INSTANCE_ATTRIB_CORNER) {
+                data->glVertexAttribDivisorARB(i, 0);
+            }
+            data->glDisableVertexAttribArrayARB(i);
+        }
+    }
+    data->drawstate.instance_arrays = enabled;
+}
+
+static bool SetDrawState(SDL_Renderer *renderer, GL_RenderData *data, const SDL_RenderCommand *cmd, const GL_Shader shader, const float *shader_params)
 {
     const SDL_BlendMode blend = cmd->data.draw.blend;
+    const bool instanced = cmd->command == SDL_RENDERCMD_TEXTURE_BATCH;
     bool vertex_array;
     bool color_array;
     bool texture_array;
@@ -999,58 +1251,94 @@ static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, cons
     if (data->drawstate.viewport_dirty) {
         const bool istarget = data->drawstate.target != NULL;
         const SDL_Rect *viewport = &data->drawstate.viewport;
-        data->glMatrixMode(GL_PROJECTION);
-        data->glLoadIdentity();
-        data->glViewport(viewport->x,
-                         istarget ? viewport->y : (data->drawstate.drawableh - viewport->y - viewport->h),
-                         viewport->w, viewport->h);
-        if (viewport->w && viewport->h) {
-            data->glOrtho((GLdouble)0, (GLdouble)viewport->w,
-                          (GLdouble)(istarget ? 0 : viewport->h),
-                          (GLdouble)(istarget ? viewport->h : 0),
-                          0.0, 1.0);
-        }
-        data->glMatrixMode(GL_MODELVIEW);
+        SDL_Rect glviewport;
+
+        glviewport.x = viewport->x;
+        glviewport.y = istarget ? viewport->y : (data->drawstate.drawableh - viewport->y - viewport->h);
+        glviewport.w = viewport->w;
+        glviewport.h = viewport->h;
+        if (SDL_CountRenderStateChange(renderer, !SDL_RectsEqual(&glviewport, &data->drawstate.gl_viewport) ||
+                                                     istarget != data->drawstate.gl_viewport_target)) {
+            data->glMatrixMode(GL_PROJECTION);
+            data->glLoadIdentity();
+            data->glViewport(glviewport.x, glviewport.y, glviewport.w, glviewport.h);
+            if (viewport->w && viewport->h) {
+                data->glOrtho((GLdouble)0, (GLdouble)viewport->w,
+                              (GLdouble)(istarget ? 0 : viewport->h),
+                              (GLdouble)(istarget ? viewport->h : 0),
+                              0.0, 1.0);
+            }
+            data->glMatrixMode(GL_MODELVIEW);
+            data->drawstate.gl_viewport = glviewport;
+            data->drawstate.gl_viewport_target = istarget;
+        }
         data->drawstate.viewport_dirty = false;
     }
 
     if (data->drawstate.cliprect_enabled_dirty) {
-        if (!data->drawstate.cliprect_enabled) {
-            data->glDisable(GL_SCISSOR_TEST);
-        } else {
-            data->glEnable(GL_SCISSOR_TEST);
-        }
+        SetScissorTest(renderer, data, data->drawstate.cliprect_enabled);
         data->drawstate.cliprect_enabled_dirty = false;
     }
 
     if (data->drawstate.cliprect_enabled && data->drawstate.cliprect_dirty) {
         const SDL_Rect *viewport = &data->drawstate.viewport;
         const SDL_Rect *rect = &data->drawstate.cliprect;
-        data->glScissor(viewport->x + rect->x,
-                        data->drawstate.target ? viewport->y + rect->y : data->drawstate.drawableh - viewport->y - rect->y - rect->h,
-                        rect->w, rect->h);
+        SDL_Rect scissor;
+
+        scissor.x = viewport->x + rect->x;
+        scissor.y = data->drawstate.target ? viewport->y + rect->y : data->drawstate.drawableh - viewport->y - rect->y - rect->h;
+        scissor.w = rect->w;
+        scissor.h = rect->h;
+        if (SDL_CountRenderStateChange(renderer, !SDL_RectsEqual(&scissor, &data->drawstate.gl_scissor))) {
+            data->glScissor(scissor.x, scissor.y, scissor.w, scissor.h);
+            data->drawstate.gl_scissor = scissor;
+        }
         data->drawstate.cliprect_dirty = false;
     }
 
     if (blend != data->drawstate.blend) {
-        if (blend == SDL_BLENDMODE_NONE) {
-            data->glDisable(GL_BLEND);
-        } else {
-            data->glEnable(GL_BLEND);
-            data->glBlendFuncSeparate(GetBlendFunc(SDL_GetBlendModeSrcColorFactor(blend)),
-                                      GetBlendFunc(SDL_GetBlendModeDstColorFactor(blend)),
-                                      GetBlendFunc(SDL_GetBlendModeSrcAlphaFactor(blend)),
-                                      GetBlendFunc(SDL_GetBlendModeDstAlphaFactor(blend)));
-            data->glBlendEquation(GetBlendEquation(SDL_GetBlendModeColorOperation(blend)));
+        const bool blend_enabled = (blend != SDL_BLENDMODE_NONE);
+
+        // Only the parts of the blend state that differ from the last mode are sent
+        if (SDL_CountRenderStateChange(renderer, data->drawstate.blend_enabled_dirty || blend_enabled != data->drawstate.blend_enabled)) {
+            if (blend_enabled) {
+                data->glEnable(GL_BLEND);
+            } else {
+                data->glDisable(GL_BLEND);
+            }
+            data->drawstate.blend_enabled = blend_enabled;
+            data->drawstate.blend_enabled_dirty = false;
+        }
+
+        if (blend_enabled) {
+            GLenum blend_func[4];
+            GLenum blend_equation;
+
+            blend_func[0] = GetBlendFunc(SDL_GetBlendModeSrcColorFactor(blend));
+            blend_func[1] = GetBlendFunc(SDL_GetBlendModeDstColorFactor(blend));
+            blend_func[2] = GetBlendFunc(SDL_GetBlendModeSrcAlphaFactor(blend));
+            blend_func[3] = GetBlendFunc(SDL_GetBlendModeDstAlphaFactor(blend));
+            if (SDL_CountRenderStateChange(renderer, SDL_memcmp(blend_func, data->drawstate.gl_blend_func, sizeof(blend_func)) != 0)) {
+                data->glBlendFuncSeparate(blend_func[0], blend_func[1], blend_func[2], blend_func[3]);
+                SDL_memcpy(data->drawstate.gl_blend_func, blend_func, sizeof(blend_func));
+            }
+
+            blend_equation = GetBlendEquation(SDL_GetBlendModeColorOperation(blend));
+            if (SDL_CountRenderStateChange(renderer, blend_equation != data->drawstate.gl_blend_equation)) {
+                data->glBlendEquation(blend_equation);
+                data->drawstate.gl_blend_equation = blend_equation;
+            }
         }
         data->drawstate.blend = blend;
     }
 
     if (data->shaders &&
-        (shader != data->drawstate.shader || shader_params != data->drawstate.shader_params)) {
-        GL_SelectShader(data->shaders, shader, shader_params);
+        SDL_CountRenderStateChange(renderer, shader != data->drawstate.shader || shader_params != data->drawstate.shader_params ||
+                                                 instanced != data->drawstate.shader_instanced)) {
+        GL_SelectShader(data->shaders, shader, shader_params, instanced);
         data->drawstate.shader = shader;
         data->drawstate.shader_params = shader_params;
+        data->drawstate.shader_instanced = instanced;
     }
 
     if (data->drawstate.texturing_dirty || ((cmd->data.draw.texture != NULL) != data->drawstate.texturing)) {
@@ -1066,9 +1354,9 @@ static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, cons
 
     vertex_array = cmd->command == SDL_RENDERCMD_DRAW_POINTS || cmd->command == SDL_RENDERCMD_DRAW_LINES || cmd->command == SDL_RENDERCMD_GEOMETRY;
     color_array = cmd->command == SDL_RENDERCMD_GEOMETRY;
-    texture_array = cmd->data.draw.texture != NULL;
+    texture_array = cmd->data.draw.texture != NULL && !instanced;
 
-    if (vertex_array != data->drawstate.vertex_array) {
+    if (SDL_CountRenderStateChange(renderer, vertex_array != data->drawstate.vertex_array)) {
         if (vertex_array) {
             data->glEnableClientState(GL_VERTEX_ARRAY);
         } else {
@@ -1077,7 +1365,7 @@ static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, cons
         data->drawstate.vertex_array = vertex_array;
     }
 
-    if (color_array != data->drawstate.color_array) {
+    if (SDL_CountRenderStateChange(renderer, color_array != data->drawstate.color_array)) {
         if (color_array) {
             data->glEnableClientState(GL_COLOR_ARRAY);
         } else {
@@ -1088,7 +1376,7 @@ static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, cons
 
     /* This is a little awkward but should avoid texcoord arrays getting into
        a bad state if the application is manually binding textures */
-    if (texture_array != data->drawstate.texture_array) {
+    if (SDL_CountRenderStateChange(renderer, texture_array != data->drawstate.texture_array)) {
         if (texture_array) {
             data->glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         } else {
@@ -1097,6 +1385,11 @@ static bool SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, cons
         data->drawstate.texture_array = texture_array;
     }
 
+    if (data->GL_ARB_instanced_arrays_supported &&
+        SDL_CountRenderStateChange(renderer, instanced != data->drawstate.instance_arrays)) {
+        SetInstanceArrays(data, instanced);
+    }
+
     return true;
 }
 
@@ -1137,7 +1430,7 @@ static void SetTextureAddressMode(GL_RenderData *data, GLenum textype, SDL_Textu
     data->glTexParameteri(textype, GL_TEXTURE_WRAP_T, TranslateAddressMode(addressModeV));
 }
 
-static bool SetCopyState(GL_RenderData *data, const SDL_RenderCommand *cmd)
+static bool SetCopyState(SDL_Renderer *renderer, GL_RenderData *data, const SDL_RenderCommand *cmd)
 {
     SDL_Texture *texture = cmd->data.draw.texture;
     GL_TextureData *texturedata = (GL_TextureData *)texture->internal;
@@ -1159,9 +1452,9 @@ static bool SetCopyState(GL_RenderData *data, const SDL_RenderCommand *cmd)
             break;
         }
     }
-    SetDrawState(data, cmd, shader, shader_params);
+    SetDrawState(renderer, data, cmd, shader, shader_params);
 
-    if (texture != data->drawstate.texture) {
+    if (SDL_CountRenderStateChange(renderer, texture != data->drawstate.texture)) {
 #ifdef SDL_HAVE_YUV
         if (texturedata->yuv) {
             data->glActiveTextureARB(GL_TEXTURE2_ARB);
@@ -1177,729 +1470,1108 @@ static bool SetCopyState(GL_RenderData *data, const SDL_RenderCommand *cmd)
 #endif
         if (data->GL_ARB_multitexture_supported) {
             data->glActiveTextureARB(GL_TEXTURE0_ARB);
-        } else if (texturedata->nv12) {
-            data->glActiveTextureARB(GL_TEXTURE1);
-            if (!SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode)) {
-                return false;
-            }
-
-            data->drawstate.texture = texture;
         }
+        data->glBindTexture(textype, texturedata->texture);
 
-        if (cmd->data.draw.texture_scale_mode != texturedata->texture_scale_mode) {
-#ifdef SDL_HAVE_YUV
-            if (texturedata->yuv) {
-                data->glActiveTextureARB(GL_TEXTURE2);
-                if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
-                    return false;
-                }
-
-                data->glActiveTextureARB(GL_TEXTURE1);
-                if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
-                    return false;
-                }
+        data->drawstate.texture = texture;
+    }
 
-                data->glActiveTextureARB(GL_TEXTURE0);
-            } else if (texturedata->nv12) {
-                data->glActiveTextureARB(GL_TEXTURE1);
-                if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
-                    return false;
-                }
+    if (cmd->data.draw.texture_scale_mode != texturedata->texture_scale_mode) {
+#ifdef SDL_HAVE_YUV
+        if (texturedata->yuv) {
+            data->glActiveTextureARB(GL_TEXTURE2);
+            if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
+                return false;
+            }
 
-                data->glActiveTextureARB(GL_TEXTURE0);
+            data->glActiveTextureARB(GL_TEXTURE1);
+            if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
+                return false;
             }
-#endif
+
+            data->glActiveTextureARB(GL_TEXTURE0);
+        } else if (texturedata->nv12) {
+            data->glActiveTextureARB(GL_TEXTURE1);
             if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
                 return false;
             }
 
-            texturedata->texture_scale_mode = cmd->data.draw.texture_scale_mode;
+            data->glActiveTextureARB(GL_TEXTURE0);
+        }
+#endif
+        if (!SetTextureScaleMode(data, textype, cmd->data.draw.texture_scale_mode)) {
+            return false;
         }
 
-        if (cmd->data.draw.texture_address_mode_u != texturedata->texture_address_mode_u ||
-            cmd->data.draw.texture_address_mode_v != texturedata->texture_address_mode_v) {
-#ifdef SDL_HAVE_YUV
-            if (texturedata->yuv) {
-                data->glActiveTextureARB(GL_TEXTURE2);
-                SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
+        texturedata->texture_scale_mode = cmd->data.draw.texture_scale_mode;
+    }
 
-                data->glActiveTextureARB(GL_TEXTURE1);
-                SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
+    if (cmd->data.draw.texture_address_mode_u != texturedata->texture_address_mode_u ||
+        cmd->data.draw.texture_address_mode_v != texturedata->texture_address_mode_v) {
+#ifdef SDL_HAVE_YUV
+        if (texturedata->yuv) {
+            data->glActiveTextureARB(GL_TEXTURE2);
+            SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
 
-                data->glActiveTextureARB(GL_TEXTURE0_ARB);
-            } else if (texturedata->nv12) {
-                data->glActiveTextureARB(GL_TEXTURE1);
-                SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
+            data->glActiveTextureARB(GL_TEXTURE1);
+            SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
 
-                data->glActiveTextureARB(GL_TEXTURE0);
-            }
-#endif
+            data->glActiveTextureARB(GL_TEXTURE0_ARB);
+        } else if (texturedata->nv12) {
+            data->glActiveTextureARB(GL_TEXTURE1);
             SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
 
-            texturedata->texture_address_mode_u = cmd->data.draw.texture_address_mode_u;
-            texturedata->texture_address_mode_v = cmd->data.draw.texture_address_mode_v;
+            data->glActiveTextureARB(GL_TEXTURE0);
         }
+#endif
+        SetTextureAddressMode(data, textype, cmd->data.draw.texture_address_mode_u, cmd->data.draw.texture_address_mode_v);
 
-        return true;
+        texturedata->texture_address_mode_u = cmd->data.draw.texture_address_mode_u;
+        texturedata->texture_address_mode_v = cmd->data.draw.texture_address_mode_v;
     }
 
-    static void GL_InvalidateCachedState(SDL_Renderer * renderer)
-    {
-        GL_DrawStateCache *cache = &((GL_RenderData *)renderer->internal)->drawstate;
-        cache->viewport_dirty = true;
-        cache->texture = NULL;
-        cache->drawablew = 0;
-        cache->drawableh = 0;
-        cache->blend = SDL_BLENDMODE_INVALID;
-        cache->shader = SHADER_INVALID;
-        cache->cliprect_enabled_dirty = true;
-        cache->cliprect_dirty = true;
-        cache->texturing_dirty = true;
-        cache->vertex_array = false;  // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
-        cache->color_array = false;   // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
-        cache->texture_array = false; // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
-        cache->color_dirty = true;
-        cache->clear_color_dirty = true;
-    }
-
-    static bool GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand * cmd, void *vertices, size_t vertsize)
-    {
-        // !!! FIXME: it'd be nice to use a vertex buffer instead of immediate mode...
-        GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    return true;
+}
 
-        if (!GL_ActivateRenderer(renderer)) {
-            return false;
-        }
+static void GL_InvalidateCachedState(SDL_Renderer *renderer)
+{
+    GL_DrawStateCache *cache = &((GL_RenderData *)renderer->internal)->drawstate;
+    cache->viewport_dirty = true;
+    cache->texture = NULL;
+    cache->drawablew = 0;
+    cache->drawableh = 0;
+    cache->blend = SDL_BLENDMODE_INVALID;
+    cache->shader = SHADER_INVALID;
+    cache->cliprect_enabled_dirty = true;
+    cache->cliprect_dirty = true;
+    cache->texturing_dirty = true;
+    cache->vertex_array = false;  // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
+    cache->color_array = false;   // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
+    cache->texture_array = false; // !!! FIXME: this resets to false at the end of GL_RunCommandQueue, but we could cache this more aggressively.
+    cache->color_dirty = true;
+    cache->clear_color_dirty = true;
+    cache->gl_viewport.w = -1;
+    cache->gl_scissor.w = -1;
+    cache->scissor_test_dirty = true;
+    cache->blend_enabled_dirty = true;
+    cache->gl_blend_func[0] = GL_INVALID_ENUM;
+    cache->gl_blend_equation = GL_INVALID_ENUM;
+
+    if (((GL_RenderData *)renderer->internal)->shaders) {
+        GL_InvalidateShaderState(((GL_RenderData *)renderer->internal)->shaders);
+    }
+}
 
-        data->drawstate.target = renderer->target;
-        if (!data->drawstate.target) {
-            int w, h;
-            SDL_GetWindowSizeInPixels(renderer->window, &w, &h);
-            if ((w != data->drawstate.drawablew) || (h != data->drawstate.drawableh)) {
-                data->drawstate.viewport_dirty = true; // if the window dimensions changed, invalidate the current viewport, etc.
-                data->drawstate.cliprect_dirty = true;
-                data->drawstate.drawablew = w;
-                data->drawstate.drawableh = h;
-            }
-        }
+static void GL_BeginTimingRange(SDL_Renderer *renderer)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GL_TimingFrame *frame = &data->timing_frames[data->timing_frame];
 
-#ifdef SDL_PLATFORM_MACOS
-        // On macOS on older systems, the OpenGL view change and resize events aren't
-        // necessarily synchronized, so just always reset it.
-        // Workaround for: https://discourse.libsdl.org/t/sdl-2-0-22-prerelease/35306/6
-        data->drawstate.viewport_dirty = true;
-#endif
+    if (!renderer->gpu_timing || !data->GL_ARB_timer_query_supported || data->timing_range_open) {
+        return;
+    }
 
-        while (cmd) {
-            switch (cmd->command) {
-            case SDL_RENDERCMD_SETDRAWCOLOR:
-            {
-                const float r = cmd->data.color.color.r * cmd->data.color.color_scale;
-                const float g = cmd->data.color.color.g * cmd->data.color.color_scale;
-                const float b = cmd->data.color.color.b * cmd->data.color.color_scale;
-                const float a = cmd->data.color.color.a;
-                if (data->drawstate.color_dirty ||
-                    (r != data->drawstate.color.r) ||
-                    (g != data->drawstate.color.g) ||
-                    (b != data->drawstate.color.b) ||
-                    (a != data->drawstate.color.a)) {
-                    data->glColor4f(r, g, b, a);
-                    data->drawstate.color.r = r;
-                    data->drawstate.color.g = g;
-                    data->drawstate.color.b = b;
-                    data->drawstate.color.a = a;
-                    data->drawstate.color_dirty = false;
-                }
-                break;
-            }
+    if (!frame->active) {
+        // Any results of the frame that used these queries before haven't been read in time, drop them.
+        frame->num_queries = 0;
+        frame->pending = false;
+        frame->active = true;
+    }
 
-            case SDL_RENDERCMD_SETVIEWPORT:
-            {
-                SDL_Rect *viewport = &data->drawstate.viewport;
-                if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof(cmd->data.viewport.rect)) != 0) {
-                    SDL_copyp(viewport, &cmd->data.viewport.rect);
-                    data->drawstate.viewport_dirty = true;
-                    data->drawstate.cliprect_dirty = true;
-                }
-                break;
-            }
+    if (frame->num_queries == frame->max_queries) {
+        const int max_queries = frame->max_queries ? (frame->max_queries * 2) : 8;
+        GLuint *queries = (GLuint *)SDL_realloc(frame->queries, max_queries * sizeof(*queries));
+        if (!queries) {
+            return;
+        }
+        data->glGenQueries(max_queries - frame->max_queries, &queries[frame->max_queries]);
+        frame->queries = queries;
+        frame->max_queries = max_queries;
+    }
 
-            case SDL_RENDERCMD_SETCLIPRECT:
-            {
-                const SDL_Rect *rect = &cmd->data.cliprect.rect;
-                if (data->drawstate.cliprect_enabled != cmd->data.cliprect.enabled) {
-                    data->drawstate.cliprect_enabled = cmd->data.cliprect.enabled;
-                    data->drawstate.cliprect_enabled_dirty = true;
-                }
+    data->glBeginQuery(GL_TIME_ELAPSED, frame->queries[frame->num_queries++]);
+    data->timing_range_open = true;
+}
 
-                if (SDL_memcmp(&data->drawstate.cliprect, rect, sizeof(*rect)) != 0) {
-                    SDL_copyp(&data->drawstate.cliprect, rect);
-                    data->drawstate.cliprect_dirty = true;
-                }
-                break;
-            }
+static void GL_EndTimingRange(SDL_Renderer *renderer)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
 
-            case SDL_RENDERCMD_CLEAR:
-            {
-                const float r = cmd->data.color.color.r * cmd->data.color.color_scale;
-                const float g = cmd->data.color.color.g * cmd->data.color.color_scale;
-                const float b = cmd->data.color.color.b * cmd->data.color.color_scale;
-                const float a = cmd->data.color.color.a;
-                if (data->drawstate.clear_color_dirty ||
-                    (r != data->drawstate.clear_color.r) ||
-                    (g != data->drawstate.clear_color.g) ||
-                    (b != data->drawstate.clear_color.b) ||
-                    (a != data->drawstate.clear_color.a)) {
-                    data->glClearColor(r, g, b, a);
-                    data->drawstate.clear_color.r = r;
-                    data->drawstate.clear_color.g = g;
-                    data->drawstate.clear_color.b = b;
-                    data->drawstate.clear_color.a = a;
-                    data->drawstate.clear_color_dirty = false;
-                }
+    if (!data->timing_range_open) {
+        return;
+    }
 
-                if (data->drawstate.cliprect_enabled || data->drawstate.cliprect_enabled_dirty) {
-                    data->glDisable(GL_SCISSOR_TEST);
-                    data->drawstate.cliprect_enabled_dirty = data->drawstate.cliprect_enabled;
-                }
+    data->glEndQuery(GL_TIME_ELAPSED);
+    data->timing_range_open = false;
+}
 
-                data->glClear(GL_COLOR_BUFFER_BIT);
-                break;
-            }
+static bool GL_ReadTimingFrame(SDL_Renderer *renderer, GL_TimingFrame *frame)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GLint available = 0;
+    GLuint64 elapsed, total = 0;
+    int i;
 
-            case SDL_RENDERCMD_FILL_RECTS: // unused
-                break;
+    // Queries finish in order, so the frame is done when its last query is
+    if (frame->num_queries > 0) {
+        data->glGetQueryObjectiv(frame->queries[frame->num_queries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+    }
+    for (i = 0; i < frame->num_queries; ++i) {
+        elapsed = 0;
+        data->glGetQueryObjectui64v(frame->queries[i], GL_QUERY_RESULT, &elapsed);
+        total += elapsed;
+    }
+    frame->pending = false;
 
-            case SDL_RENDERCMD_COPY: // unused
-                break;
+    renderer->gpu_time_ns = (Uint64)total;
+    return true;
+}
 
-            case SDL_RENDERCMD_COPY_EX: // unused
-                break;
+static void GL_EndTimingFrame(SDL_Renderer *renderer)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GL_TimingFrame *frame = &data->timing_frames[data->timing_frame];
+    int i;
 
-            case SDL_RENDERCMD_DRAW_LINES:
-            {
-                if (SetDrawState(data, cmd, SHADER_SOLID, NULL)) {
-                    size_t count = cmd->data.draw.count;
-                    const GLfloat *verts = (GLfloat *)(((Uint8 *)vertices) + cmd->data.draw.first);
+    if (!frame->active) {
+        return;
+    }
 
-                    // SetDrawState handles glEnableClientState.
-                    data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 2, verts);
+    GL_EndTimingRange(renderer);
+    frame->active = false;
+    frame->pending = true;
+    data->timing_frame = (data->timing_frame + 1) % GL_TIMING_FRAMES;
 
-                    if (count > 2) {
-                        // joined lines cannot be grouped
-                        data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
-                    } else {
-                        // let's group non joined lines
-                        SDL_RenderCommand *finalcmd = cmd;
-                        SDL_RenderCommand *nextcmd = cmd->next;
-                        SDL_BlendMode thisblend = cmd->data.draw.blend;
-
-                        while (nextcmd) {
-                            const SDL_RenderCommandType nextcmdtype = nextcmd->command;
-                            if (nextcmdtype != SDL_RENDERCMD_DRAW_LINES) {
-                                break; // can't go any further on this draw call, different render command up next.
-                            } else if (nextcmd->data.draw.count != 2) {
-                                break; // can't go any further on this draw call, those are joined lines
-                            } else if (nextcmd->data.draw.blend != thisblend) {
-                                break; // can't go any further on this draw call, different blendmode copy up next.
-                            } else {
-                                finalcmd = nextcmd; // we can combine copy operations here. Mark this one as the furthest okay command.
-                                count += nextcmd->data.draw.count;
-                            }
-                            nextcmd = nextcmd->next;
-                        }
+    // Read back whatever finished, oldest first, without waiting on the GPU
+    for (i = 0; i < GL_TIMING_FRAMES; ++i) {
+        frame = &data->timing_frames[(data->timing_frame + i) % GL_TIMING_FRAMES];
+        if (frame->pending && !GL_ReadTimingFrame(renderer, frame)) {
+            break;
+        }
+    }
+}
 
-                        data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
-                        cmd = finalcmd; // skip any copy commands we just combined in here.
-                    }
-                }
-                break;
-            }
+static bool GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    bool using_vertex_buffer = false;
 
-            case SDL_RENDERCMD_DRAW_POINTS:
-            case SDL_RENDERCMD_GEOMETRY:
-            {
-                /* as long as we have the same copy command in a row, with the
-                   same texture, we can combine them all into a single draw call. */
-                SDL_Texture *thistexture = cmd->data.draw.texture;
-                SDL_BlendMode thisblend = cmd->data.draw.blend;
-                SDL_ScaleMode thisscalemode = cmd->data.draw.texture_scale_mode;
-                SDL_TextureAddressMode thisaddressmode_u = cmd->data.draw.texture_address_mode_u;
-                SDL_TextureAddressMode thisaddressmode_v = cmd->data.draw.texture_address_mode_v;
-                const SDL_RenderCommandType thiscmdtype = cmd->command;
-                SDL_RenderCommand *finalcmd = cmd;
-                SDL_RenderCommand *nextcmd = cmd->next;
-                size_t count = cmd->data.draw.count;
-                int ret;
-                while (nextcmd) {
-                    const SDL_RenderCommandType nextcmdtype = nextcmd->command;
-                    if (nextcmdtype != thiscmdtype) {
-                        break; // can't go any further on this draw call, different render command up next.
-                    } else if (nextcmd->data.draw.texture != thistexture ||
-                               nextcmd->data.draw.texture_scale_mode != thisscalemode ||
-                               nextcmd->data.draw.texture_address_mode_u != thisaddressmode_u ||
-                               nextcmd->data.draw.texture_address_mode_v != thisaddressmode_v ||
-                               nextcmd->data.draw.blend != thisblend) {
-                        break; // can't go any further on this draw call, different texture/blendmode copy up next.
-                    } else {
-                        finalcmd = nextcmd; // we can combine copy operations here. Mark this one as the furthest okay command.
-                        count += nextcmd->data.draw.count;
-                    }
-                    nextcmd = nextcmd->next;
-                }
+    if (!GL_ActivateRenderer(renderer)) {
+        return false;
+    }
 
-                if (thistexture) {
-                    ret = SetCopyState(data, cmd);
-                } else {
-                    ret = SetDrawState(data, cmd, SHADER_SOLID, NULL);
-                }
+    GL_BeginTimingRange(renderer);
 
-                if (ret) {
-                    const GLfloat *verts = (GLfloat *)(((Uint8 *)vertices) + cmd->data.draw.first);
-                    int op = GL_TRIANGLES; // SDL_RENDERCMD_GEOMETRY
-                    if (thiscmdtype == SDL_RENDERCMD_DRAW_POINTS) {
-                        op = GL_POINTS;
-                    }
+    data->drawstate.target = renderer->target;
+    if (!data->drawstate.target) {
+        int w, h;
+        SDL_GetWindowSizeInPixels(renderer->window, &w, &h);
+        if ((w != data->drawstate.drawablew) || (h != data->drawstate.drawableh)) {
+            data->drawstate.viewport_dirty = true; // if the window dimensions changed, invalidate the current viewport, etc.
+            data->drawstate.cliprect_dirty = true;
+            data->drawstate.drawablew = w;
+            data->drawstate.drawableh = h;
+        }
+    }
 
-                    if (thiscmdtype == SDL_RENDERCMD_DRAW_POINTS) {
-                        // SetDrawState handles glEnableClientState.
-                        data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 2, verts);
-                    } else {
-                        // SetDrawState handles glEnableClientState.
-                        if (thistexture) {
-                            data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 8, verts + 0);
-                            data->glColorPointer(4, GL_FLOAT, sizeof(float) * 8, verts + 2);
-                            data->glTexCoordPointer(2, GL_FLOAT, sizeof(float) * 8, verts + 6);
+#ifdef SDL_PLATFORM_MACOS
+    // On macOS on older systems, the OpenGL view change and resize events aren't
+    // necessarily synchronized, so just always reset it.
+    // Workaround for: https://discourse.libsdl.org/t/sdl-2-0-22-prerelease/35306/6
+    data->drawstate.viewport_dirty = true;
+    data->drawstate.gl_viewport.w = -1;
+#endif
+
+    if (data->vertex_buffer && vertsize > 0) {
+        /* Upload this set of commands' vertices in one go. Respecifying the
+           whole buffer orphans the previous storage, so the GL doesn't have
+           to wait for draws still using it, and doesn't have to copy client
+           arrays at every draw call. */
+        data->glBindBufferARB(GL_ARRAY_BUFFER_ARB, data->vertex_buffer);
+        data->glBufferDataARB(GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)vertsize, vertices, GL_STREAM_DRAW_ARB);
+        using_vertex_buffer = true;
+
+        // vertex pointers will be offsets into the vertex buffer.
+        vertices = (void *)(uintptr_t)0; // must be the exact value 0, not NULL (the representation of NULL is not guaranteed to be 0).
+    }
+
+    while (cmd) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        {
+            const float r = cmd->data.color.color.r * cmd->data.color.color_scale;
+            const float g = cmd->data.color.color.g * cmd->data.color.color_scale;
+            const float b = cmd->data.color.color.b * cmd->data.color.color_scale;
+            const float a = cmd->data.color.color.a;
+            if (data->drawstate.color_dirty ||
+                (r != data->drawstate.color.r) ||
+                (g != data->drawstate.color.g) ||
+                (b != data->drawstate.color.b) ||
+                (a != data->drawstate.color.a)) {
+                data->glColor4f(r, g, b, a);
+                data->drawstate.color.r = r;
+                data->drawstate.color.g = g;
+                data->drawstate.color.b = b;
+                data->drawstate.color.a = a;
+                data->drawstate.color_dirty = false;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_SETVIEWPORT:
+        {
+            SDL_Rect *viewport = &data->drawstate.viewport;
+            if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof(cmd->data.viewport.rect)) != 0) {
+                SDL_copyp(viewport, &cmd->data.viewport.rect);
+                data->drawstate.viewport_dirty = true;
+                data->drawstate.cliprect_dirty = true;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+        {
+            const SDL_Rect *rect = &cmd->data.cliprect.rect;
+            if (data->drawstate.cliprect_enabled != cmd->data.cliprect.enabled) {
+                data->drawstate.cliprect_enabled = cmd->data.cliprect.enabled;
+                data->drawstate.cliprect_enabled_dirty = true;
+            }
+
+            if (SDL_memcmp(&data->drawstate.cliprect, rect, sizeof(*rect)) != 0) {
+                SDL_copyp(&data->drawstate.cliprect, rect);
+                data->drawstate.cliprect_dirty = true;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_CLEAR:
+        {
+            const float r = cmd->data.color.color.r * cmd->data.color.color_scale;
+            const float g = cmd->data.color.color.g * cmd->data.color.color_scale;
+            const float b = cmd->data.color.color.b * cmd->data.color.color_scale;
+            const float a = cmd->data.color.color.a;
+            if (data->drawstate.clear_color_dirty ||
+                (r != data->drawstate.clear_color.r) ||
+                (g != data->drawstate.clear_color.g) ||
+                (b != data->drawstate.clear_color.b) ||
+                (a != data->drawstate.clear_color.a)) {
+                data->glClearColor(r, g, b, a);
+                data->drawstate.clear_color.r = r;
+                data->drawstate.clear_color.g = g;
+                data->drawstate.clear_color.b = b;
+                data->drawstate.clear_color.a = a;
+                data->drawstate.clear_color_dirty = false;
+            }
+
+            if (data->drawstate.cliprect_enabled || data->drawstate.cliprect_enabled_dirty) {
+                SetScissorTest(renderer, data, false);
+                data->drawstate.cliprect_enabled_dirty = data->drawstate.cliprect_enabled;
+            }
+
+            data->glClear(GL_COLOR_BUFFER_BIT);
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: // unused
+            break;
+
+        case SDL_RENDERCMD_COPY: // unused
+            break;
+
+        case SDL_RENDERCMD_COPY_EX: // unused
+            break;
+
+        case SDL_RENDERCMD_DRAW_LINES:
+        {
+            if (SetDrawState(renderer, data, cmd, SHADER_SOLID, NULL)) {
+                size_t count = cmd->data.draw.count;
+                const GLfloat *verts = (GLfloat *)(((Uint8 *)vertices) + cmd->data.draw.first);
+
+                // SetDrawState handles glEnableClientState.
+                data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 2, verts);
+
+                if (count > 2) {
+                    // joined lines cannot be grouped
+                    data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    ++renderer->stats.draw_calls;
+                } else {
+                    // let's group non joined lines
+                    SDL_RenderCommand *finalcmd = cmd;
+                    SDL_RenderCommand *nextcmd = cmd->next;
+                    SDL_BlendMode thisblend = cmd->data.draw.blend;
+
+                    while (nextcmd) {
+                        const SDL_RenderCommandType nextcmdtype = nextcmd->command;
+                        if (nextcmdtype != SDL_RENDERCMD_DRAW_LINES) {
+                            break; // can't go any further on this draw call, different render command up next.
+                        } else if (nextcmd->data.draw.count != 2) {
+                            break; // can't go any further on this draw call, those are joined lines
+                        } else if (nextcmd->data.draw.blend != thisblend) {
+                            break; // can't go any further on this draw call, different blendmode copy up next.
                         } else {
-                            data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 6, verts + 0);
-                            data->glColorPointer(4, GL_FLOAT, sizeof(float) * 6, verts + 2);
+                            finalcmd = nextcmd; // we can combine copy operations here. Mark this one as the furthest okay command.
+                            count += nextcmd->data.draw.count;
                         }
+                        nextcmd = nextcmd->next;
                     }
 
-                    data->glDrawArrays(op, 0, (GLsizei)count);
+                    data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    ++renderer->stats.draw_calls;
+                    cmd = finalcmd; // skip any copy commands we just combined in here.
+                }
+            }
+            break;
+        }
 
-                    // Restore previously set color when we're done.
-                    if (thiscmdtype != SDL_RENDERCMD_DRAW_POINTS) {
-                        const float r = data->drawstate.color.r;
-                        const float g = data->drawstate.color.g;
-                        const float b = data->drawstate.color.b;
-                        const float a = data->drawstate.color.a;
-                        data->glColor4f(r, g, b, a);
-                    }
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_GEOMETRY:
+        {
+            /* as long as we have the same copy command in a row, with the
+               same texture, we can combine them all into a single draw call. */
+            SDL_Texture *thistexture = cmd->data.draw.texture;
+            SDL_BlendMode thisblend = cmd->data.draw.blend;
+            SDL_ScaleMode thisscalemode = cmd->data.draw.texture_scale_mode;
+            SDL_TextureAddressMode thisaddressmode_u = cmd->data.draw.texture_address_mode_u;
+            SDL_TextureAddressMode thisaddressmode_v = cmd->data.draw.texture_address_mode_v;
+            const SDL_RenderCommandType thiscmdtype = cmd->command;
+            SDL_RenderCommand *finalcmd = cmd;
+            SDL_RenderCommand *nextcmd = cmd->next;
+            size_t count = cmd->data.draw.count;
+            int ret;
+            while (nextcmd) {
+                const SDL_RenderCommandType nextcmdtype = nextcmd->command;
+                if (nextcmdtype != thiscmdtype) {
+                    break; // can't go any further on this draw call, different render command up next.
+                } else if (nextcmd->data.draw.texture != thistexture ||
+                           nextcmd->data.draw.texture_scale_mode != thisscalemode ||
+                           nextcmd->data.draw.texture_address_mode_u != thisaddressmode_u ||
+                           nextcmd->data.draw.texture_address_mode_v != thisaddressmode_v ||
+                           nextcmd->data.draw.blend != thisblend) {
+                    break; // can't go any further on this draw call, different texture/blendmode copy up next.
+                } else {
+                    finalcmd = nextcmd; // we can combine copy operations here. Mark this one as the furthest okay command.
+                    count += nextcmd->data.draw.count;
                 }
+                nextcmd = nextcmd->next;
+            }
 
-                cmd = finalcmd; // skip any copy commands we just combined in here.
-                break;
+            if (thistexture) {
+                ret = SetCopyState(renderer, data, cmd);
+            } else {
+                ret = SetDrawState(renderer, data, cmd, SHADER_SOLID, NULL);
             }
 
-            case SDL_RENDERCMD_NO_OP:
-                break;
+            if (ret) {
+                const GLfloat *verts = (GLfloat *)(((Uint8 *)vertices) + cmd->data.draw.first);
+                int op = GL_TRIANGLES; // SDL_RENDERCMD_GEOMETRY
+                if (thiscmdtype == SDL_RENDERCMD_DRAW_POINTS) {
+                    op = GL_POINTS;
+                }
+
+                if (thiscmdtype == SDL_RENDERCMD_DRAW_POINTS) {
+                    // SetDrawState handles glEnableClientState.
+                    data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 2, verts);
+                } else {
+                    // SetDrawState handles glEnableClientState.
+                    if (thistexture) {
+                        data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 8, verts + 0);
+                        data->glColorPointer(4, GL_FLOAT, sizeof(float) * 8, verts + 2);
+                        data->glTexCoordPointer(2, GL_FLOAT, sizeof(float) * 8, verts + 6);
+                    } else {
+                        data->glVertexPointer(2, GL_FLOAT, sizeof(float) * 6, verts + 0);
+                        data->glColorPointer(4, GL_FLOAT, sizeof(float) * 6, verts + 2);
+                    }
+                }
+
+                data->glDrawArrays(op, 0, (GLsizei)count);
+                ++renderer->stats.draw_calls;
+
+                // Restore previously set color when we're done.
+                if (thiscmdtype != SDL_RENDERCMD_DRAW_POINTS) {
+                    const float r = data->drawstate.color.r;
+                    const float g = data->drawstate.color.g;
+                    const float b = data->drawstate.color.b;
+                    const float a = data->drawstate.color.a;
+                    data->glColor4f(r, g, b, a);
+                }
             }
 
-            cmd = cmd->next;
+            cmd = finalcmd; // skip any copy commands we just combined in here.
+            break;
         }
 
-        /* Turn off vertex array state when we're done, in case external code
-           relies on it being off. */
-        if (data->drawstate.vertex_array) {
-            data->glDisableClientState(GL_VERTEX_ARRAY);
-            data->drawstate.vertex_array = false;
-        }
-        if (data->drawstate.color_array) {
-            data->glDisableClientState(GL_COLOR_ARRAY);
-            data->drawstate.color_array = false;
+        case SDL_RENDERCMD_TEXTURE_BATCH:
+        {
+            if (SetCopyState(renderer, data, cmd)) {
+                const GLfloat *verts = (GLfloat *)(((Uint8 *)vertices) + cmd->data.draw.first);
+                const GLfloat *instances = verts + 8;
+                const GLsizei stride = sizeof(SDL_TextureBatchInstance);
+
+                data->glVertexAttribPointerARB(GL_INSTANCE_ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE, 0, verts);
+                data->glVertexAttribPointerARB(GL_INSTANCE_ATTRIB_ORIGIN, 2, GL_FLOAT, GL_FALSE, stride, instances + 0);
+                data->glVertexAttribPointerARB(GL_INSTANCE_ATTRIB_AXES, 4, GL_FLOAT, GL_FALSE, stride, instances + 2);
+                data->glVertexAttribPointerARB(GL_INSTANCE_ATTRIB_TEXRECT, 4, GL_FLOAT, GL_FALSE, stride, instances + 6);
+                data->glVertexAttribPointerARB(GL_INSTANCE_ATTRIB_COLOR, 4, GL_FLOAT, GL_FALSE, stride, instances + 10);
+
+                // SetDrawState enables the instance attributes.
+                data->glDrawArraysInstancedARB(GL_TRIANGLE_FAN, 0, 4, (GLsizei)cmd->data.draw.count);
+                ++renderer->stats.draw_calls;
+            }
+            break;
         }
-        if (data->drawstate.texture_array) {
-            data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-            data->drawstate.texture_array = false;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
         }
 
-        return GL_CheckError("", renderer);
+        cmd = cmd->next;
     }
 
-    static SDL_Surface *GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect *rect)
-    {
-        GL_RenderData *data = (GL_RenderData *)renderer->internal;
-        SDL_PixelFormat format = renderer->target ? renderer->target->format : SDL_PIXELFORMAT_ARGB8888;
-        GLint internalFormat;
-        GLenum targetFormat, type;
-        SDL_Surface *surface;
+    /* Turn off vertex array state when we're done, in case external code
+       relies on it being off. */
+    if (data->drawstate.vertex_array) {
+        data->glDisableClientState(GL_VERTEX_ARRAY);
+        data->drawstate.vertex_array = false;
+    }
+    if (data->drawstate.color_array) {
+        data->glDisableClientState(GL_COLOR_ARRAY);
+        data->drawstate.color_array = false;
+    }
+    if (data->drawstate.texture_array) {
+        data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        data->drawstate.texture_array = false;
+    }
+    if (data->drawstate.instance_arrays) {
+        SetInstanceArrays(data, false);
+    }
+    if (using_vertex_buffer) {
+        data->glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+    }
 
-        GL_ActivateRenderer(renderer);
+    GL_EndTimingRange(renderer);
 
-        if (!convert_format(format, &internalFormat, &targetFormat, &type)) {
-            SDL_SetError("Texture format %s not supported by OpenGL", SDL_GetPixelFormatName(format));
-            return NULL;
-        }
+    return GL_CheckError("", renderer);
+}
 
-        surface = SDL_CreateSurface(rect->w, rect->h, format);
-        if (!surface) {
-            return NULL;
-        }
+static SDL_Surface *GL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    SDL_PixelFormat format = renderer->target ? renderer->target->format : SDL_PIXELFORMAT_ARGB8888;
+    GLint internalFormat;
+    GLenum targetFormat, type;
+    SDL_Surface *surface;
 
-        int y = rect->y;
-        if (!renderer->target) {
-            int w, h;
-            SDL_GetRenderOutputSize(renderer, &w, &h);
-            y = (h - y) - rect->h;
-        }
+    GL_ActivateRenderer(renderer);
 
-        data->glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        data->glPixelStorei(GL_PACK_ROW_LENGTH, (surface->pitch / SDL_BYTESPERPIXEL(format)));
-        data->glReadPixels(rect->x, y, rect->w, rect->h, targetFormat, type, surface->pixels);
+    if (!convert_format(format, &internalFormat, &targetFormat, &type)) {
+        SDL_SetError("Texture format %s not supported by OpenGL", SDL_GetPixelFormatName(format));
+        return NULL;
+    }
 
-        if (!GL_CheckError("glReadPixels()", renderer)) {
-            SDL_DestroySurface(surface);
-            return NULL;
-        }
+    surface = SDL_CreateSurface(rect->w, rect->h, format);
+    if (!surface) {
+        return NULL;
+    }
 
-        // Flip the rows to be top-down if necessary
-        if (!renderer->target) {
-            SDL_FlipSurface(surface, SDL_FLIP_VERTICAL);
-        }
-        return surface;
+    int y = rect->y;
+    if (!renderer->target) {
+        int w, h;
+        SDL_GetRenderOutputSize(renderer, &w, &h);
+        y = (h - y) - rect->h;
     }
 
-    static bool GL_RenderPresent(SDL_Renderer * renderer)
-    {
-        GL_ActivateRenderer(renderer);
+    data->glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    data->glPixelStorei(GL_PACK_ROW_LENGTH, (surface->pitch / SDL_BYTESPERPIXEL(format)));
+    data->glReadPixels(rect->x, y, rect->w, rect->h, targetFormat, type, surface->pixels);
 
-        return SDL_GL_SwapWindow(renderer->window);
+    if (!GL_CheckError("glReadPixels()", renderer)) {
+        SDL_DestroySurface(surface);
+        return NULL;
     }
 
-    static void GL_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
-    {
-        GL_RenderData *renderdata = (GL_RenderData *)renderer->internal;
-        GL_TextureData *data = (GL_TextureData *)texture->internal;
+    // Flip the rows to be top-down if necessary
+    if (!renderer->target) {
+        SDL_FlipSurface(surface, SDL_FLIP_VERTICAL);
+    }
+    return surface;
+}
 
-        GL_ActivateRenderer(renderer);
+static void GL_DestroyReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GL_ReadbackData *readbackdata = (GL_ReadbackData *)readback->internal;
 
-        if (renderdata->drawstate.texture == texture) {
-            renderdata->drawstate.texture = NULL;
-        }
-        if (renderdata->drawstate.target == texture) {
-            renderdata->drawstate.target = NULL;
-        }
+    GL_ActivateRenderer(renderer);
 
-        if (!data) {
-            return;
-        }
-        if (data->texture && !data->texture_external) {
-            renderdata->glDeleteTextures(1, &data->texture);
-        }
+    if (readbackdata->fence) {
+        data->glDeleteSync(readbackdata->fence);
+    }
+    if (readbackdata->buffer) {
+        data->glDeleteBuffersARB(1, &readbackdata->buffer);
+    }
+    SDL_free(readbackdata);
+    readback->internal = NULL;
+}
+
+static bool GL_QueueReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    SDL_PixelFormat format = renderer->target ? renderer->target->format : SDL_PIXELFORMAT_ARGB8888;
+    const SDL_Rect *rect = &readback->rect;
+    GL_ReadbackData *readbackdata;
+    GLint internalFormat;
+    GLenum targetFormat, type;
+
+    GL_ActivateRenderer(renderer);
+
+    if (!convert_format(format, &internalFormat, &targetFormat, &type)) {
+        return SDL_SetError("Texture format %s not supported by OpenGL", SDL_GetPixelFormatName(format));
+    }
+
+    readbackdata = (GL_ReadbackData *)SDL_calloc(1, sizeof(*readbackdata));
+    if (!readbackdata) {
+        return false;
+    }
+    readbackdata->format = format;
+    readbackdata->pitch = rect->w * SDL_BYTESPERPIXEL(format);
+    readbackdata->flip = !renderer->target;
+    readback->internal = readbackdata;
+
+    int y = rect->y;
+    if (!renderer->target) {
+        int w, h;
+        SDL_GetRenderOutputSize(renderer, &w, &h);
+        y = (h - y) - rect->h;
+    }
+
+    // The pixels are copied into the buffer on the GPU, and only mapped when they're collected
+    data->glGenBuffersARB(1, &readbackdata->buffer);
+    data->glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, readbackdata->buffer);
+    data->glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, (GLsizeiptrARB)rect->h * readbackdata->pitch, NULL, GL_STREAM_READ_ARB);
+    data->glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    data->glPixelStorei(GL_PACK_ROW_LENGTH, rect->w);
+    data->glReadPixels(rect->x, y, rect->w, rect->h, targetFormat, type, NULL);
+    data->glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+    if (data->glFenceSync) {
+        readbackdata->fence = data->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    if (!GL_CheckError("glReadPixels()", renderer)) {
+        GL_DestroyReadPixels(renderer, readback);
+        return false;
+    }
+    return true;
+}
+
+static bool GL_IsReadPixelsReady(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GL_ReadbackData *readbackdata = (GL_ReadbackData *)readback->internal;
+    GLenum status;
+
+    if (!readbackdata->fence) {
+        // Without fences there's no way to tell, mapping the buffer will wait if needed
+        return true;
+    }
+
+    GL_ActivateRenderer(renderer);
+
+    status = data->glClientWaitSync(readbackdata->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    return (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+}
+
+static SDL_Surface *GL_CollectReadPixels(SDL_Renderer *renderer, SDL_RenderReadback *readback)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
+    GL_ReadbackData *readbackdata = (GL_ReadbackData *)readback->internal;
+    SDL_Surface *surface;
+    const void *pixels;
+
+    GL_ActivateRenderer(renderer);
+
+    surface = SDL_CreateSurface(readback->rect.w, readback->rect.h, readbackdata->format);
+    if (!surface) {
+        return NULL;
+    }
+
+    data->glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, readbackdata->buffer);
+    pixels = data->glMapBufferARB(GL_PIXEL_PACK_BUFFER_ARB, GL_READ_ONLY_ARB);
+    if (pixels) {
+        SDL_memcpy_rows(surface->pixels, surface->pitch, pixels, readbackdata->pitch, readbackdata->pitch, surface->h);
+        data->glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+    }
+    data->glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+    if (!pixels) {
+        GL_CheckError("glMapBufferARB()", renderer);
+        SDL_SetError("Couldn't map pixel buffer");
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+
+    // Flip the rows to be top-down if necessary
+    if (readbackdata->flip) {
+        SDL_FlipSurface(surface, SDL_FLIP_VERTICAL);
+    }
+    return surface;
+}
+
+static bool GL_RenderPresent(SDL_Renderer *renderer)
+{
+    bool result;
+
+    GL_ActivateRenderer(renderer);
+
+    GL_BeginTimingRange(renderer);
+    result = SDL_GL_SwapWindow(renderer->window);
+    GL_EndTimingFrame(renderer);
+
+    return result;
+}
+
+static void GL_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    GL_RenderData *renderdata = (GL_RenderData *)renderer->internal;
+    GL_TextureData *data = (GL_TextureData *)texture->internal;
+
+    GL_ActivateRenderer(renderer);
+
+    if (renderdata->drawstate.texture == texture) {
+        renderdata->drawstate.texture = NULL;
+    }
+    if (renderdata->drawstate.target == texture) {
+        renderdata->drawstate.target = NULL;
+    }
+
+    if (!data) {
+        return;
+    }
+    if (data->texture && !data->texture_external) {
+        renderdata->glDeleteTextures(1, &data->texture);
+    }
 #ifdef SDL_HAVE_YUV
-        if (data->yuv) {
-            if (!data->utexture_external) {
-                renderdata->glDeleteTextures(1, &data->utexture);
-            }
-            if (!data->vtexture_external) {
-                renderdata->glDeleteTextures(1, &data->vtexture);
-            }
+    if (data->yuv) {
+        if (!data->utexture_external) {
+            renderdata->glDeleteTextures(1, &data->utexture);
         }
-        if (data->nv12) {
-            if (!data->utexture_external) {
-                renderdata->glDeleteTextures(1, &data->utexture);
-            }
+        if (!data->vtexture_external) {
+            renderdata->glDeleteTextures(1, &data->vtexture);
         }
+    }
+    if (data->nv12) {
+        if (!data->utexture_external) {
+            renderdata->glDeleteTextures(1, &data->utexture);
+        }
+    }
 #endif
-        SDL_free(data->pixels);
-        SDL_free(data);
-        texture->internal = NULL;
+    if (data->pixel_buffer_size) {
+        renderdata->glDeleteBuffersARB(GL_PIXEL_BUFFER_COUNT, data->pixel_buffers);
     }
+    SDL_free(data->pixels);
+    SDL_free(data);
+    texture->internal = NULL;
+}
 
-    static void GL_DestroyRenderer(SDL_Renderer * renderer)
-    {
-        GL_RenderData *data = (GL_RenderData *)renderer->internal;
+static void GL_DestroyRenderer(SDL_Renderer *renderer)
+{
+    GL_RenderData *data = (GL_RenderData *)renderer->internal;
 
-        if (data) {
-            if (data->context) {
-                // make sure we delete the right resources!
-                GL_ActivateRenderer(renderer);
-            }
+    if (data) {
+        int i;
 
-            GL_ClearErrors(renderer);
-            if (data->GL_ARB_debug_output_supported) {
-                PFNGLDEBUGMESSAGECALLBACKARBPROC glDebugMessageCallbackARBFunc = (PFNGLDEBUGMESSAGECALLBACKARBPROC)SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
+        if (data->context) {
+            // make sure we delete the right resources!
+            GL_ActivateRenderer(renderer);
+        }
 
-                // Uh oh, we don't have a safe way of removing ourselves from the callback chain, if it changed after we set our callback.
-                // For now, just always replace the callback with the original one
-                glDebugMessageCallbackARBFunc(data->next_error_callback, data->next_error_userparam);
-            }
-            if (data->shaders) {
-                GL_DestroyShaderContext(data->shaders);
+        GL_ClearErrors(renderer);
+        if (data->GL_ARB_debug_output_supported) {
+            PFNGLDEBUGMESSAGECALLBACKARBPROC glDebugMessageCallbackARBFunc = (PFNGLDEBUGMESSAGECALLBACKARBPROC)SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
+
+            // Uh oh, we don't have a safe way of removing ourselves from the callback chain, if it changed after we set our callback.
+            // For now, just always replace the callback with the original one
+            glDebugMessageCallbackARBFunc(data->next_error_callback, data->next_error_userparam);
+        }
+        if (data->shaders) {
+            GL_DestroyShaderContext(data->shaders);
+        }
+        if (data->context) {
+            if (data->vertex_buffer) {
+                data->glDeleteBuffersARB(1, &data->vertex_buffer);
             }
-            if (data->context) {
-                while (data->framebuffers) {
-                    GL_FBOList *nextnode = data->framebuffers->next;
-                    // delete the framebuffer object
-                    data->glDeleteFramebuffersEXT(1, &data->framebuffers->FBO);
-                    GL_CheckError("", renderer);
-                    SDL_free(data->framebuffers);
-                    data->framebuffers = nextnode;
+            for (i = 0; i < GL_TIMING_FRAMES; ++i) {
+                if (data->timing_frames[i].max_queries) {
+                    data->glDeleteQueries(data->timing_frames[i].max_queries, data->timing_frames[i].queries);
                 }
-                SDL_GL_DestroyContext(data->context);
             }
-            SDL_free(data);
+            while (data->framebuffers) {
+                GL_FBOList *nextnode = data->framebuffers->next;
+                // delete the framebuffer object
+                data->glDeleteFramebuffersEXT(1, &data->framebuffers->FBO);
+                GL_CheckError("", renderer);
+                SDL_free(data->framebuffers);
+                data->framebuffers = nextnode;
+            }
+            SDL_GL_DestroyContext(data->context);
+        }
+        for (i = 0; i < GL_TIMING_FRAMES; ++i) {
+            SDL_free(data->timing_frames[i].queries);
         }
+        SDL_free(data);
     }
+}
 
-    static bool GL_SetVSync(SDL_Renderer * renderer, const int vsync)
-    {
-        int interval = 0;
+static bool GL_SetVSync(SDL_Renderer *renderer, const int vsync)
+{
+    int interval = 0;
 
-        if (!SDL_GL_SetSwapInterval(vsync)) {
-            return false;
-        }
+    if (!SDL_GL_SetSwapInterval(vsync)) {
+        return false;
+    }
 
-        if (!SDL_GL_GetSwapInterval(&interval)) {
-            return false;
-        }
+    if (!SDL_GL_GetSwapInterval(&interval)) {
+        return false;
+    }
 
-        if (interval != vsync) {
-            return SDL_Unsupported();
-        }
-        return true;
+    if (interval != vsync) {
+        return SDL_Unsupported();
     }
+    return true;
+}
 
-    static bool GL_CreateRenderer(SDL_Renderer * renderer, SDL_Window * window, SDL_PropertiesID create_props)
-    {
-        GL_RenderData *data = NULL;
-        GLint value;
+static bool GL_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_PropertiesID create_props)
+{
+    GL_RenderData *data = NULL;
+    GLint value;
 #if !defined SDL_VIDEO_VITA_PVR_OGL && !defined SDL_PLATFORM_WINRT
-        SDL_WindowFlags window_flags;
+    SDL_WindowFlags window_flags;
 #endif
-        int profile_mask = 0, major = 0, minor = 0;
-        bool changed_window = false;
-        const char *hint;
-        bool non_power_of_two_supported = false;
+    int profile_mask = 0, major = 0, minor = 0;
+    bool changed_window = false;
+    const char *hint;
+    bool non_power_of_two_supported = false;
 
-        SDL_GL_GetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, &profile_mask);
-        SDL_GL_GetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, &major);
-        SDL_GL_GetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, &minor);
+    SDL_GL_GetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, &profile_mask);
+    SDL_GL_GetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, &major);
+    SDL_GL_GetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, &minor);
 
 #if !defined SDL_VIDEO_VITA_PVR_OGL && !defined SDL_PLATFORM_WINRT
-        SDL_SyncWindow(window);
-        window_flags = SDL_GetWindowFlags(window);
-        if (!(window_flags & SDL_WINDOW_OPENGL) ||
-            profile_mask == SDL_GL_CONTEXT_PROFILE_ES || major != RENDERER_CONTEXT_MAJOR || minor != RENDERER_CONTEXT_MINOR) {
-
-            changed_window = true;
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, 0);
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, RENDERER_CONTEXT_MAJOR);
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, RENDERER_CONTEXT_MINOR);
-
-            if (!SDL_RecreateWindow(window, (window_flags & ~(SDL_WINDOW_VULKAN | SDL_WINDOW_METAL)) | SDL_WINDOW_OPENGL)) {
-                goto error;
-            }
-        }
-#endif
+    SDL_SyncWindow(window);
+    window_flags = SDL_GetWindowFlags(window);
+    if (!(window_flags & SDL_WINDOW_OPENGL) ||
+        profile_mask == SDL_GL_CONTEXT_PROFILE_ES || major != RENDERER_CONTEXT_MAJOR || minor != RENDERER_CONTEXT_MINOR) {
 
-        SDL_SetupRendererColorspace(renderer, create_props);
+        changed_window = true;
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, 0);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, RENDERER_CONTEXT_MAJOR);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, RENDERER_CONTEXT_MINOR);
 
-        if (renderer->output_colorspace != SDL_COLORSPACE_SRGB) {
-            SDL_SetError("Unsupported output colorspace");
+        if (!SDL_RecreateWindow(window, (window_flags & ~(SDL_WINDOW_VULKAN | SDL_WINDOW_METAL)) | SDL_WINDOW_OPENGL)) {
             goto error;
         }
+    }
+#endif
 
-        data = (GL_RenderData *)SDL_calloc(1, sizeof(*data));
-        if (!data) {
-            goto error;
-        }
+    SDL_SetupRendererColorspace(renderer, create_props);
+
+    if (renderer->output_colorspace != SDL_COLORSPACE_SRGB) {
+        SDL_SetError("Unsupported output colorspace");
+        goto error;
+    }
+
+    data = (GL_RenderData *)SDL_calloc(1, sizeof(*data));
+    if (!data) {
+        goto error;
+    }
 
-        renderer->WindowEvent = GL_WindowEvent;
-        renderer->SupportsBlendMode = GL_SupportsBlendMode;
-        renderer->CreateTexture = GL_CreateTexture;
-        renderer->UpdateTexture = GL_UpdateTexture;
+    renderer->WindowEvent = GL_WindowEvent;
+    renderer->SupportsBlendMode = GL_SupportsBlendMode;
+    renderer->CreateTexture = GL_CreateTexture;
+    renderer->UpdateTexture = GL_UpdateTexture;
 #ifdef SDL_HAVE_YUV
-        renderer->UpdateTextureYUV = GL_UpdateTextureYUV;
-        renderer->UpdateTextureNV = GL_UpdateTextureNV;
+    renderer->UpdateTextureYUV = GL_UpdateTextureYUV;
+    renderer->UpdateTextureNV = GL_UpdateTextureNV;
 #endif
-        renderer->LockTexture = GL_LockTexture;
-        renderer->UnlockTexture = GL_UnlockTexture;
-        renderer->SetRenderTarget = GL_SetRenderTarget;
-        renderer->QueueSetViewport = GL_QueueNoOp;
-        renderer->QueueSetDrawColor = GL_QueueNoOp;
-        renderer->QueueDrawPoints = GL_QueueDrawPoints;
-        renderer->QueueDrawLines = GL_QueueDrawLines;
-        renderer->QueueGeometry = GL_QueueGeometry;
-        renderer->InvalidateCachedState = GL_InvalidateCachedState;
-        renderer->RunCommandQueue = GL_RunCommandQueue;
-        renderer->RenderReadPixels = GL_RenderReadPixels;
-        renderer->RenderPresent = GL_RenderPresent;
-        renderer->DestroyTexture = GL_DestroyTexture;
-        renderer->DestroyRenderer = GL_DestroyRenderer;
-        renderer->SetVSync = GL_SetVSync;
-        renderer->internal = data;
-        GL_InvalidateCachedState(renderer);
-        renderer->window = window;
-
-        renderer->name = GL_RenderDriver.name;
-        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_ARGB8888);
-        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_ABGR8888);
-        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_XRGB8888);
-        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_XBGR8888);
-
-        data->context = SDL_GL_CreateContext(window);
-        if (!data->context) {
-            goto error;
-        }
-        if (!SDL_GL_MakeCurrent(window, data->context)) {
-            goto error;
-        }
-
-        if (!GL_LoadFunctions(data)) {
-            goto error;
-        }
+    renderer->LockTexture = GL_LockTexture;
+    renderer->UnlockTexture = GL_UnlockTexture;
+    renderer->SetRenderTarget = GL_SetRenderTarget;
+    renderer->QueueSetViewport = GL_QueueNoOp;
+    renderer->QueueSetDrawColor = GL_QueueNoOp;
+    renderer->QueueDrawPoints = GL_QueueDrawPoints;
+    renderer->QueueDrawLines = GL_QueueDrawLines;
+    renderer->QueueGeometry = GL_QueueGeometry;
+    renderer->InvalidateCachedState = GL_InvalidateCachedState;
+    renderer->RunCommandQueue = GL_RunCommandQueue;
+    renderer->RenderReadPixels = GL_RenderReadPixels;
+    renderer->RenderPresent = GL_RenderPresent;
+    renderer->DestroyTexture = GL_DestroyTexture;
+    renderer->DestroyRenderer = GL_DestroyRenderer;
+    renderer->SetVSync = GL_SetVSync;
+    renderer->internal = data;
+    GL_InvalidateCachedState(renderer);
+    renderer->window = window;
+
+    renderer->name = GL_RenderDriver.name;
+    SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_ARGB8888);
+    SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_ABGR8888);
+    SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_XRGB8888);
+    SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_XBGR8888);
+
+    data->context = SDL_GL_CreateContext(window);
+    if (!data->context) {
+        goto error;
+    }
+    if (!SDL_GL_MakeCurrent(window, data->context)) {
+        goto error;
+    }
+
+    if (!GL_LoadFunctions(data)) {
+        goto error;
+    }
 
 #ifdef SDL_PLATFORM_MACOS
-        // Enable multi-threaded rendering
-        /* Disabled until Ryan finishes his VBO/PBO code...
-           CGLEnable(CGLGetCurrentContext(), kCGLCEMPEngine);
-         */
+    // Enable multi-threaded rendering
+    /* Disabled until Ryan finishes his VBO/PBO code...
+       CGLEnable(CGLGetCurrentContext(), kCGLCEMPEngine);
+     */
 #endif
 
-        // Check for debug output support
-        if (SDL_GL_GetAttribute(SDL_GL_CONTEXT_FLAGS, &value) &&
-            (value & SDL_GL_CONTEXT_DEBUG_FLAG)) {
-            data->debug_enabled = true;
-        }
-        if (data->debug_enabled && SDL_GL_ExtensionSupported("GL_ARB_debug_output")) {
-            PFNGLDEBUGMESSAGECALLBACKARBPROC glDebugMessageCallbackARBFunc = (PFNGLDEBUGMESSAGECALLBACKARBPROC)SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
-
-            data->GL_ARB_debug_output_supported = true;
-            data->glGetPointerv(GL_DEBUG_CALLBACK_FUNCTION_ARB, (GLvoid **)(char *)&data->next_error_callback);
-            data->glGetPointerv(GL_DEBUG_CALLBACK_USER_PARAM_ARB, &data->next_error_userparam);
-            glDebugMessageCallbackARBFunc(GL_HandleDebugMessage, renderer);
-
-            // Make sure our callback is called when errors actually happen
-            data->glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
-        }
-
-        hint = SDL_GetHint("GL_ARB_texture_non_power_of_two");
-        if (!hint || *hint != '0') {
-            bool isGL2 = false;
-            const char *verstr = (const char *)data->glGetString(GL_VERSION);
-            if (verstr) {
-                char verbuf[16];
-                char *ptr;
-                SDL_strlcpy(verbuf, verstr, sizeof(verbuf));
-                ptr = SDL_strchr(verbuf, '.');
-                if (ptr) {
-                    *ptr = '\0';
-                    if (SDL_atoi(verbuf) >= 2) {
-                        isGL2 = true;
-                    }
+    // Check for debug output support
+    if (SDL_GL_GetAttribute(SDL_GL_CONTEXT_FLAGS, &value) &&
+        (value & SDL_GL_CONTEXT_DEBUG_FLAG)) {
+        data->debug_enabled = true;
+    }
+    if (data->debug_enabled && SDL_GL_ExtensionSupported("GL_ARB_debug_output")) {
+        PFNGLDEBUGMESSAGECALLBACKARBPROC glDebugMessageCallbackARBFunc = (PFNGLDEBUGMESSAGECALLBACKARBPROC)SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
+
+        data->GL_ARB_debug_output_supported = true;
+        data->glGetPointerv(GL_DEBUG_CALLBACK_FUNCTION_ARB, (GLvoid **)(char *)&data->next_error_callback);
+        data->glGetPointerv(GL_DEBUG_CALLBACK_USER_PARAM_ARB, &data->next_error_userparam);
+        glDebugMessageCallbackARBFunc(GL_HandleDebugMessage, renderer);
+
+        // Make sure our callback is called when errors actually happen
+        data->glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+    }
+
+    hint = SDL_GetHint("GL_ARB_texture_non_power_of_two");
+    if (!hint || *hint != '0') {
+        bool isGL2 = false;
+        const char *verstr = (const char *)data->glGetString(GL_VERSION);
+        if (verstr) {
+            char verbuf[16];
+            char *ptr;
+            SDL_strlcpy(verbuf, verstr, sizeof(verbuf));
+            ptr = SDL_strchr(verbuf, '.');
+            if (ptr) {
+                *ptr = '\0';
+                if (SDL_atoi(verbuf) >= 2) {
+                    isGL2 = true;
                 }
             }
-            if (isGL2 || SDL_GL_ExtensionSupported("GL_ARB_texture_non_power_of_two")) {
-                non_power_of_two_supported = true;
+        }
+        if (isGL2 || SDL_GL_ExtensionSupported("GL_ARB_texture_non_power_of_two")) {
+            non_power_of_two_supported = true;
+        }
+    }
+
+    data->textype = GL_TEXTURE_2D;
+    if (non_power_of_two_supported) {
+        data->GL_ARB_texture_non_power_of_two_supported = true;
+        data->glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
+        SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
+    } else if (SDL_GL_ExtensionSupported("GL_ARB_texture_rectangle") ||
+               SDL_GL_ExtensionSupported("GL_EXT_texture_rectangle")) {
+        data->GL_ARB_texture_rectangle_supported = true;
+        data->textype = GL_TEXTURE_RECTANGLE_ARB;
+        data->glGetIntegerv(GL_MAX_RECTANGLE_TEXTURE_SIZE_ARB, &value);
+        SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
+    } else {
+        data->glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
+        SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
+    }
+
+    // Check for multitexture support
+    if (SDL_GL_ExtensionSupported("GL_ARB_multitexture")) {
+        data->glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC)SDL_GL_GetProcAddress("glActiveTextureARB");
+        if (data->glActiveTextureARB) {
+            data->GL_ARB_multitexture_supported = true;
+            data->glGetIntegerv(GL_MAX_TEXTURE_UNITS_ARB, &data->num_texture_units);
+        }
+    }
+
+    // Check for vertex buffer support
+    hint = SDL_GetHint("GL_ARB_vertex_buffer_object");
+    if ((!hint || *hint != '0') && SDL_GL_ExtensionSupported("GL_ARB_vertex_buffer_object")) {
+        data->glGenBuffersARB = (PFNGLGENBUFFERSARBPROC)SDL_GL_GetProcAddress("glGenBuffersARB");
+        data->glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)SDL_GL_GetProcAddress("glDeleteBuffersARB");
+        data->glBindBufferARB = (PFNGLBINDBUFFERARBPROC)SDL_GL_GetProcAddress("glBindBufferARB");
+        data->glBufferDataARB = (PFNGLBUFFERDATAARBPROC)SDL_GL_GetProcAddress("glBufferDataARB");
+        data->glMapBufferARB = (PFNGLMAPBUFFERARBPROC)SDL_GL_GetProcAddress("glMapBufferARB");
+        data->glUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)SDL_GL_GetProcAddress("glUnmapBufferARB");
+        if (data->glGenBuffersARB && data->glDeleteBuffersARB && data->glBindBufferARB && data->glBufferDataARB) {
+            data->GL_ARB_vertex_buffer_object_supported = true;
+            data->glGenBuffersARB(1, &data->vertex_buffer);
+        }
+    }
+
+    // Check for pixel buffer support, used for streaming textures
+    hint = SDL_GetHint("GL_ARB_pixel_buffer_object");
+    if ((!hint || *hint != '0') && data->GL_ARB_vertex_buffer_object_supported &&
+        data->glMapBufferARB && data->glUnmapBufferARB &&
+        (SDL_GL_ExtensionSupported("GL_ARB_pixel_buffer_object") || SDL_GL_ExtensionSupported("GL_EXT_pixel_buffer_object"))) {
+        data->GL_ARB_pixel_buffer_object_supported = true;
+
+        renderer->QueueReadPixels = GL_QueueReadPixels;
+        renderer->IsReadPixelsReady = GL_IsReadPixelsReady;
+        renderer->CollectReadPixels = GL_CollectReadPixels;
+        renderer->DestroyReadPixels = GL_DestroyReadPixels;
+
+        if (SDL_GL_ExtensionSupported("GL_ARB_sync")) {
+            data->glFenceSync = (PFNGLFENCESYNCPROC)SDL_GL_GetProcAddress("glFenceSync");
+            data->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)SDL_GL_GetProcAddress("glClientWaitSync");
+            data->glDeleteSync = (PFNGLDELETESYNCPROC)SDL_GL_GetProcAddress("glDeleteSync");
+            if (!data->glFenceSync || !data->glClientWaitSync || !data->glDeleteSync) {
+                data->glFenceSync = NULL;
             }
         }
+    }
 
-        data->textype = GL_TEXTURE_2D;
-        if (non_power_of_two_supported) {
-            data->GL_ARB_texture_non_power_of_two_supported = true;
-            data->glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
-            SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
-        } else if (SDL_GL_ExtensionSupported("GL_ARB_texture_rectangle") ||
-                   SDL_GL_ExtensionSupported("GL_EXT_texture_rectangle")) {
-            data->GL_ARB_texture_rectangle_supported = true;
-            data->textype = GL_TEXTURE_RECTANGLE_ARB;
-            data->glGetIntegerv(GL_MAX_RECTANGLE_TEXTURE_SIZE_ARB, &value);
-            SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
-        } else {
-            data->glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
-            SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, value);
+    // Check for shader support
+    data->shaders = GL_CreateShaderContext((SDL_Storage *)SDL_GetPointerProperty(create_props, SDL_PROP_RENDERER_CREATE_OPENGL_PROGRAM_CACHE_STORAGE_POINTER, NULL));
+    SDL_LogInfo(SDL_LOG_CATEGORY_RENDER, "OpenGL shaders: %s",
+                data->shaders ? "ENABLED" : "DISABLED");
+
+    // Check for instancing support, used for texture batches
+    if (data->shaders && GL_ShadersSupportInstancing(data->shaders)) {
+        data->glVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)SDL_GL_GetProcAddress("glVertexAttribPointerARB");
+        data->glEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)SDL_GL_GetProcAddress("glEnableVertexAttribArrayARB");
+        data->glDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)SDL_GL_GetProcAddress("glDisableVertexAttribArrayARB");
+        data->glVertexAttribDivisorARB = (PFNGLVERTEXATTRIBDIVISORARBPROC)SDL_GL_GetProcAddress("glVertexAttribDivisorARB");
+        data->glDrawArraysInstancedARB = (PFNGLDRAWARRAYSINSTANCEDARBPROC)SDL_GL_GetProcAddress("glDrawArraysInstancedARB");
+        if (data->glVertexAttribPointerARB && data->glEnableVertexAttribArrayARB && data->glDisableVertexAttribArrayARB &&
+            data->glVertexAttribDivisorARB && data->glDrawArraysInstancedARB) {
+            data->GL_ARB_instanced_arrays_supported = true;
+            renderer->QueueTextureBatch = GL_QueueTextureBatch;
         }
+    }
+
+    // Check for timer query support, used for GPU timing
+    if (SDL_GL_ExtensionSupported("GL_ARB_timer_query") || SDL_GL_ExtensionSupported("GL_EXT_timer_query")) {
+        data->glGenQueries = (PFNGLGENQUERIESPROC)SDL_GL_GetProcAddress("glGenQueries");
+        data->glDeleteQueries = (PFNGLDELETEQUERIESPROC)SDL_GL_GetProcAddress("glDeleteQueries");
+        data->glBeginQuery = (PFNGLBEGINQUERYPROC)SDL_GL_GetProcAddress("glBeginQuery");
+        data->glEndQuery = (PFNGLENDQUERYPROC)SDL_GL_GetProcAddress("glEndQuery");
+        data->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)SDL_GL_GetProcAddress("glGetQueryObjectiv");
+        data->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)SDL_GL_GetProcAddress("glGetQueryObjectui64v");
+        if (!data->glGetQueryObjectui64v) {
+            data->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)SDL_GL_GetProcAddress("glGetQueryObjectui64vEXT");
+        }
+        if (data->glGenQueries && data->glDeleteQueries && data->glBeginQuery && data->glEndQuery &&
+            data->glGetQueryObjectiv && data->glGetQueryObjectui64v) {
+            data->GL_ARB_timer_query_supported = true;
+        }
+    }
 
-        // Check for multitexture support
-        if (SDL_GL_ExtensionSupported("GL_ARB_multitexture")) {
-            data->glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC)SDL_GL_GetProcAddress("glActiveTextureARB");
-            if (data->glActiveTextureARB) {
-                data->GL_ARB_multitexture_supported = true;
-                data->glGetIntegerv(GL_MAX_TEXTURE_UNITS_ARB, &data->num_texture_units);
+    // Check for compressed texture support, which isn't available for rectangle textures
+    if (data->textype == GL_TEXTURE_2D) {
+        data->glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)SDL_GL_GetProcAddress("glCompressedTexSubImage2DARB");
+        if (!data->glCompressedTexSubImage2DARB) {
+            data->glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)SDL_GL_GetProcAddress("glCompressedTexSubImage2D");
+        }
+        if (data->glCompressedTexSubImage2DARB) {
+            if (SDL_GL_ExtensionSupported("GL_EXT_texture_compression_s3tc")) {
+                SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_BC1);
+                SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_BC2);
+                SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_BC3);
+            }
+            if (SDL_GL_ExtensionSupported("GL_ARB_texture_compression_bptc")) {
+                SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_BC7);
             }
         }
+    }
 
-        // Check for shader support
-        data->shaders = GL_CreateShaderContext();
-        SDL_LogInfo(SDL_LOG_CATEGORY_RENDER, "OpenGL shaders: %s",
-                    data->shaders ? "ENABLED" : "DISABLED");
 #ifdef SDL_HAVE_YUV
-        // We support YV12 textures using 3 textures and a shader
-        if (data->shaders && data->num_texture_units >= 3) {
-            SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_YV12);
-            SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_IYUV);
-        }
+    // We support YV12 textures using 3 textures and a shader
+    if (data->shaders && data->num_texture_units >= 3) {
+        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_YV12);
+        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_IYUV);
+    }
 
-        // We support NV12 textures using 2 textures and a shader
-        if (data->shaders && data->num_texture_units >= 2) {
-            SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_NV12);
-            SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_NV21);
-        }
+    // We support NV12 textures using 2 textures and a shader
+    if (data->shaders && data->num_texture_units >= 2) {
+        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_NV12);
+        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_NV21);
+    }
 #endif
 #ifdef SDL_PLATFORM_MACOS
-        SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_UYVY);
+    SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_UYVY);
 #endif
 
-        if (SDL_GL_ExtensionSupported("GL_EXT_framebuffer_object")) {
-            data->GL_EXT_framebuffer_object_supported = true;
-            data->glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)
-                SDL_GL_GetProcAddress("glGenFramebuffersEXT");
-            data->glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC)
-                SDL_GL_GetProcAddress("glDeleteFramebuffersEXT");
-            data->glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)
-                SDL_GL_GetProcAddress("glFramebufferTexture2DEXT");
-            data->glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)
-                SDL_GL_GetProcAddress("glBindFramebufferEXT");
-            data->glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)
-                SDL_GL_GetProcAddress("glCheckFramebufferStatusEXT");
-        } else {
-            SDL_SetError("Can't create render targets, GL_EXT_framebuffer_object not available");
-            goto error;
-        }
-
-        // Set up parameters for rendering
-        data->glMatrixMode(GL_MODELVIEW);
-        data->glLoadIdentity();
-        data->glDisable(GL_DEPTH_TEST);
-        data->glDisable(GL_CULL_FACE);
-        data->glDisable(GL_SCISSOR_TEST);
-        data->glDisable(data->textype);
-        data->glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
-        data->glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-        // This ended up causing video discrepancies between OpenGL and Direct3D
-        // data->glEnable(GL_LINE_SMOOTH);
-
-        data->drawstate.color.r = 1.0f;
-        data->drawstate.color.g = 1.0f;
-        data->drawstate.color.b = 1.0f;
-        data->drawstate.color.a = 1.0f;
-        data->drawstate.clear_color.r = 1.0f;
-        data->drawstate.clear_color.g = 1.0f;
-        data->drawstate.clear_color.b = 1.0f;
-        data->drawstate.clear_color.a = 1.0f;
+    if (SDL_GL_ExtensionSupported("GL_EXT_framebuffer_object")) {
+        data->GL_EXT_framebuffer_object_supported = true;
+        data->glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)
+            SDL_GL_GetProcAddress("glGenFramebuffersEXT");
+        data->glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC)
+            SDL_GL_GetProcAddress("glDeleteFramebuffersEXT");
+        data->glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)
+            SDL_GL_GetProcAddress("glFramebufferTexture2DEXT");
+        data->glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)
+            SDL_GL_GetProcAddress("glBindFramebufferEXT");
+        data->glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)
+            SDL_GL_GetProcAddress("glCheckFramebufferStatusEXT");
+    } else {
+        SDL_SetError("Can't create render targets, GL_EXT_framebuffer_object not available");
+        goto error;
+    }
+
+    // Set up parameters for rendering
+    data->glMatrixMode(GL_MODELVIEW);
+    data->glLoadIdentity();
+    data->glDisable(GL_DEPTH_TEST);
+    data->glDisable(GL_CULL_FACE);
+    data->glDisable(GL_SCISSOR_TEST);
+    data->glDisable(data->textype);
+    data->glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    data->glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    // This ended up causing video discrepancies between OpenGL and Direct3D
+    // data->glEnable(GL_LINE_SMOOTH);
+
+    data->drawstate.color.r = 1.0f;
+    data->drawstate.color.g = 1.0f;
+    data->drawstate.color.b = 1.0f;
+    data->drawstate.color.a = 1.0f;
+    data->drawstate.clear_color.r = 1.0f;
+    data->drawstate.clear_color.g = 1.0f;
+    data->drawstate.clear_color.b = 1.0f;
+    data->drawstate.clear_color.a = 1.0f;
 
-        return true;
+    return true;
 
-    error:
-        if (changed_window) {
-            // Uh oh, better try to put it back...
-            char *error = SDL_strdup(SDL_GetError());
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, profile_mask);
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, major);
-            SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, minor);
+error:
+    if (changed_window) {
+        // Uh oh, better try to put it back...
+        char *error = SDL_strdup(SDL_GetError());
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, profile_mask);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, major);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, minor);
 #ifndef SDL_PLATFORM_WINRT
-            SDL_RecreateWindow(window, window_flags);
+        SDL_RecreateWindow(window, window_flags);
 #endif
-            SDL_SetError("%s", error);
-            SDL_free(error);
-        }
-        return false;
+        SDL_SetError("%s", error);
+        SDL_free(error);
     }
+    return false;
+}
 
-    SDL_RenderDriver GL_RenderDriver = {
-        GL_CreateRenderer, "opengl"
-    };
+SDL_RenderDriver GL_RenderDriver = {
+    GL_CreateRenderer, "opengl"
+};
 
 #endif // SDL_VIDEO_RENDER_OGL
@@ -24,11 +24,17 @@
 
 #include <SDL3/SDL_opengl.h>
 #include "SDL_shaders_gl.h"
+#include "../SDL_glprogramcache.h"
 
 // OpenGL shader implementation
 
 // #define DEBUG_SHADERS
 
+#define GL_PROGRAM_CACHE_FILE "SDL_gl_render_programs.bin"
+
+// Program binaries use the name of the program object, which GLhandleARB is a pointer to on Apple platforms
+#define GL_PROGRAM_NAME(handle) ((GLuint)(uintptr_t)(handle))
+
 typedef struct
 {
     GLhandleARB program;
@@ -55,11 +61,26 @@ struct GL_ShaderContext
     PFNGLUNIFORM3FARBPROC glUniform3fARB;
     PFNGLUNIFORM4FARBPROC glUniform4fARB;
     PFNGLUSEPROGRAMOBJECTARBPROC glUseProgramObjectARB;
+    PFNGLBINDATTRIBLOCATIONARBPROC glBindAttribLocationARB;
+    PFNGLGETPROGRAMIVPROC glGetProgramiv;
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+
+    SDL_GLProgramCache *program_cache;
 
     bool GL_ARB_texture_rectangle_supported;
+    bool GL_ARB_instanced_arrays_supported;
 
     GL_ShaderData shaders[NUM_SHADERS];
     const float *shader_params[NUM_SHADERS];
+
+    // Variants of the texture shaders that read one sprite per instance
+    GL_ShaderData instanced_shaders[NUM_SHADERS];
+    const float *instanced_shader_params[NUM_SHADERS];
+
+    // The program currently in use, or 0 if unknown
+    GLhandleARB current_program;
 };
 
 /* *INDENT-OFF* */ // clang-format off
@@ -84,6 +105,23 @@ struct GL_ShaderContext
 "    v_texCoord = vec2(gl_MultiTexCoord0);\n"                   \
 "}"                                                             \
 
+#define INSTANCED_TEXTURE_VERTEX_SHADER                         \
+"attribute vec2 a_corner;\n"                                    \
+"attribute vec2 a_origin;\n"                                    \
+"attribute vec4 a_axes;\n"                                      \
+"attribute vec4 a_texrect;\n"                                   \
+"attribute vec4 a_color;\n"                                     \
+"varying vec4 v_color;\n"                                       \
+"varying vec2 v_texCoord;\n"                                    \
+"\n"                                                            \
+"void main()\n"                                                 \
+"{\n"                                                           \
+"    vec2 position = a_origin + a_corner.x * a_axes.xy + a_corner.y * a_axes.zw;\n" \
+"    gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);\n" \
+"    v_color = a_color;\n"                                      \
+"    v_texCoord = mix(a_texrect.xy, a_texrect.zw, a_corner);\n" \
+"}"                                                             \
+
 #define YUV_SHADER_PROLOGUE                                     \
 "varying vec4 v_color;\n"                                       \
 "varying vec2 v_texCoord;\n"                                    \
@@ -433,12 +471,67 @@ static bool CompileShader(GL_ShaderContext *ctx, GLhandleARB shader, const char
     }
 }
 
-static bool CompileShaderProgram(GL_ShaderContext *ctx, int index, GL_ShaderData *data)
+static bool LoadProgramBinary(GL_ShaderContext *ctx, GL_ShaderData *data, Uint64 key)
 {
+    Uint32 format;
+    const void *binary;
+    int length;
+    GLint status = 0;
+
+    if (!ctx->program_cache || !SDL_FindGLProgramBinary(ctx->program_cache, key, &format, &binary, &length)) {
+        return false;
+    }
+
+    data->program = ctx->glCreateProgramObjectARB();
+    ctx->glProgramBinary(GL_PROGRAM_NAME(data->program), (GLenum)format, binary, length);
+    ctx->glGetProgramiv(GL_PROGRAM_NAME(data->program), GL_LINK_STATUS, &status);
+    if (!status) {
+        // Drivers reject binaries from before an update, link it from source instead
+        ctx->glGetError();
+        ctx->glDeleteObjectARB(data->program);
+        data->program = 0;
+        SDL_RemoveGLProgramBinary(ctx->program_cache, key);
+        return false;
+    }
+    return true;
+}
+
+static void SaveProgramBinary(GL_ShaderContext *ctx, GL_ShaderData *data, Uint64 key)
+{
+    GLint length = 0;
+    GLenum format = 0;
+    void *binary;
+
+    ctx->glGetProgramiv(GL_PROGRAM_NAME(data->program), GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    binary = SDL_malloc(length);
+    if (!binary) {
+        return;
+    }
+    ctx->glGetProgramBinary(GL_PROGRAM_NAME(data->program), length, &length, &format, binary);
+    SDL_AddGLProgramBinary(ctx->program_cache, key, format, binary, length);
+    SDL_free(binary);
+}
+
+static bool CompileShaderProgram(GL_ShaderContext *ctx, int index, GL_ShaderData *data, bool instanced)
+{
+    static const char *instance_attribs[NUM_GL_INSTANCE_ATTRIBS] = {
+        "a_corner",
+        "a_origin",
+        "a_axes",
+        "a_texrect",
+        "a_color"
+    };
+    const char *vertex_shader = instanced ? INSTANCED_TEXTURE_VERTEX_SHADER : shader_source[index].vertex_shader;
     const int num_tmus_bound = 4;
     const char *vert_defines = "";
     const char *frag_defines = "";
     const char *frag_version = "";
+    const char *sources[6];
+    Uint64 key = 0;
     int i;
     GLint location;
 
@@ -462,27 +555,50 @@ static bool CompileShaderProgram(GL_ShaderContext *ctx, int index, GL_ShaderData
         frag_version = shader_source[index].fragment_version;
     }
 
-    // Create one program object to rule them all
-    data->program = ctx->glCreateProgramObjectARB();
-
-    // Create the vertex shader
-    data->vert_shader = ctx->glCreateShaderObjectARB(GL_VERTEX_SHADER_ARB);
-    if (!CompileShader(ctx, data->vert_shader, "", vert_defines, shader_source[index].vertex_shader)) {
-        return false;
+    if (ctx->program_cache) {
+        sources[0] = vert_defines;
+        sources[1] = vertex_shader;
+        sources[2] = frag_version;
+        sources[3] = frag_defines;
+        sources[4] = shader_source[index].fragment_shader;
+        sources[5] = instanced ? "instanced" : "";
+        key = SDL_HashGLProgramSources(sources, SDL_arraysize(sources));
     }
 
-    // Create the fragment shader
-    data->frag_shader = ctx->glCreateShaderObjectARB(GL_FRAGMENT_SHADER_ARB);
-    if (!CompileShader(ctx, data->frag_shader, frag_version, frag_defines, shader_source[index].fragment_shader)) {
-        return false;
-    }
+    if (!LoadProgramBinary(ctx, data, key)) {
+        // Create one program object to rule them all
+        data->program = ctx->glCreateProgramObjectARB();
 
-    // ... and in the darkness bind them
-    ctx->glAttachObjectARB(data->program, data->vert_shader);
-    ctx->glAttachObjectARB(data->program, data->frag_shader);
-    ctx->glLinkProgramARB(data->program);
+        // Create the vertex shader
+        data->vert_shader = ctx->glCreateShaderObjectARB(GL_VERTEX_SHADER_ARB);
+        if (!CompileShader(ctx, data->vert_shader, "", vert_defines, vertex_shader)) {
+            return false;
+        }
 
-    // Set up some uniform variables
+        // Create the fragment shader
+        data->frag_shader = ctx->glCreateShaderObjectARB(GL_FRAGMENT_SHADER_ARB);
+        if (!CompileShader(ctx, data->frag_shader, frag_version, frag_defines, shader_source[index].fragment_shader)) {
+            return false;
+        }
+
+        // ... and in the darkness bind them
+        ctx->glAttachObjectARB(data->program, data->vert_shader);
+        ctx->glAttachObjectARB(data->program, data->frag_shader);
+        if (instanced) {
+            for (i = 0; i < NUM_GL_INSTANCE_ATTRIBS; ++i) {
+                ctx->glBindAttribLocationARB(data->program, i, instance_attribs[i]);
+            }
+        }
+        if (ctx->program_cache) {
+            ctx->glProgramParameteri(GL_PROGRAM_NAME(data->program), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        ctx->glLinkProgramARB(data->program);
+        if (ctx->program_cache) {
+            SaveProgramBinary(ctx, data, key);
+        }
+    }
+
+    // Set up some uniform variables, they aren't part of a program binary
     ctx->glUseProgramObjectARB(data->program);
     for (i = 0; i < num_tmus_bound; ++i) {
         char tex_name[10];
@@ -504,7 +620,38 @@ static void DestroyShaderProgram(GL_ShaderContext *ctx, GL_ShaderData *data)
     ctx->glDeleteObjectARB(data->program);
 }
 
-GL_ShaderContext *GL_CreateShaderContext(void)
+static void CreateProgramCache(GL_ShaderContext *ctx, SDL_Storage *storage)
+{
+    const GLubyte *(APIENTRY *glGetStringFunc)(GLenum) = (const GLubyte *(APIENTRY *)(GLenum))SDL_GL_GetProcAddress("glGetString");
+    void (APIENTRY *glGetIntegervFunc)(GLenum, GLint *) = (void (APIENTRY *)(GLenum, GLint *))SDL_GL_GetProcAddress("glGetIntegerv");
+    GLint num_formats = 0;
+
+    if (!storage || !glGetStringFunc || !glGetIntegervFunc ||
+        !SDL_GL_ExtensionSupported("GL_ARB_get_program_binary")) {
+        return;
+    }
+
+    ctx->glGetProgramiv = (PFNGLGETPROGRAMIVPROC)SDL_GL_GetProcAddress("glGetProgramiv");
+    ctx->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glGetProgramBinary");
+    ctx->glProgramBinary = (PFNGLPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glProgramBinary");
+    ctx->glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)SDL_GL_GetProcAddress("glProgramParameteri");
+    if (!ctx->glGetProgramiv || !ctx->glGetProgramBinary || !ctx->glProgramBinary || !ctx->glProgramParameteri) {
+        return;
+    }
+
+    // Some drivers support the extension without being able to save any programs
+    glGetIntegervFunc(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    if (num_formats <= 0) {
+        return;
+    }
+
+    ctx->program_cache = SDL_CreateGLProgramCache(storage, GL_PROGRAM_CACHE_FILE,
+                                                  (const char *)glGetStringFunc(GL_VENDOR),
+                                                  (const char *)glGetStringFunc(GL_RENDERER),
+                                                  (const char *)glGetStringFunc(GL_VERSION));
+}
+
+GL_ShaderContext *GL_CreateShaderContext(SDL_Storage *program_cache_storage)
 {
     GL_ShaderContext *ctx;
     bool shaders_supported;
@@ -543,6 +690,7 @@ GL_ShaderContext *GL_CreateShaderContext(void)
         ctx->glUniform3fARB = (PFNGLUNIFORM3FARBPROC)SDL_GL_GetProcAddress("glUniform3fARB");
         ctx->glUniform4fARB = (PFNGLUNIFORM4FARBPROC)SDL_GL_GetProcAddress("glUniform4fARB");
         ctx->glUseProgramObjectARB = (PFNGLUSEPROGRAMOBJECTARBPROC)SDL_GL_GetProcAddress("glUseProgramObjectARB");
+        ctx->glBindAttribLocationARB = (PFNGLBINDATTRIBLOCATIONARBPROC)SDL_GL_GetProcAddress("glBindAttribLocationARB");
         if (ctx->glGetError &&
             ctx->glAttachObjectARB &&
             ctx->glCompileShaderARB &&
@@ -567,26 +715,57 @@ GL_ShaderContext *GL_CreateShaderContext(void)
         return NULL;
     }
 
+    CreateProgramCache(ctx, program_cache_storage);
+
     // Compile all the shaders
     for (i = 0; i < NUM_SHADERS; ++i) {
-        if (!CompileShaderProgram(ctx, i, &ctx->shaders[i])) {
+        if (!CompileShaderProgram(ctx, i, &ctx->shaders[i], false)) {
             GL_DestroyShaderContext(ctx);
             return NULL;
         }
     }
 
+    // Compile the instanced texture shaders, if we can draw instances
+    if (SDL_GL_ExtensionSupported("GL_ARB_instanced_arrays") && ctx->glBindAttribLocationARB) {
+        ctx->GL_ARB_instanced_arrays_supported = true;
+        for (i = SHADER_RGB; i < NUM_SHADERS; ++i) {
+            if (!CompileShaderProgram(ctx, i, &ctx->instanced_shaders[i], true)) {
+                ctx->GL_ARB_instanced_arrays_supported = false;
+                break;
+            }
+        }
+    }
+
     // We're done!
     return ctx;
 }
 
-void GL_SelectShader(GL_ShaderContext *ctx, GL_Shader shader, const float *shader_params)
+bool GL_ShadersSupportInstancing(GL_ShaderContext *ctx)
+{
+    return ctx->GL_ARB_instanced_arrays_supported;
+}
+
+void GL_SelectShader(GL_ShaderContext *ctx, GL_Shader shader, const float *shader_params, bool instanced)
 {
     GLint location;
-    GLhandleARB program = ctx->shaders[shader].program;
+    GLhandleARB program;
+    const float **current_params;
+
+    if (instanced) {
+        SDL_assert(ctx->GL_ARB_instanced_arrays_supported && shader >= SHADER_RGB);
+        program = ctx->instanced_shaders[shader].program;
+        current_params = &ctx->instanced_shader_params[shader];
+    } else {
+        program = ctx->shaders[shader].program;
+        current_params = &ctx->shader_params[shader];
+    }
 
-    ctx->glUseProgramObjectARB(program);
+    if (program != ctx->current_program) {
+        ctx->glUseProgramObjectARB(program);
+        ctx->current_program = program;
+    }
 
-    if (shader_params && shader_params != ctx->shader_params[shader]) {
+    if (shader_params && shader_params != *current_params) {
         if (shader == SHADER_RGB_PIXELART ||
             shader == SHADER_RGBA_PIXELART) {
             location = ctx->glGetUniformLocationARB(program, "texel_size");
@@ -617,17 +796,24 @@ void GL_SelectShader(GL_ShaderContext *ctx, GL_Shader shader, const float *shade
         }
 #endif // SDL_HAVE_YUV
 
-        ctx->shader_params[shader] = shader_params;
+        *current_params = shader_params;
     }
 }
 
+void GL_InvalidateShaderState(GL_ShaderContext *ctx)
+{
+    ctx->current_program = 0;
+}
+
 void GL_DestroyShaderContext(GL_ShaderContext *ctx)
 {
     int i;
 
     for (i = 0; i < NUM_SHADERS; ++i) {
         DestroyShaderProgram(ctx, &ctx->shaders[i]);
+        DestroyShaderProgram(ctx, &ctx->instanced_shaders[i]);
     }
+    SDL_DestroyGLProgramCache(ctx->program_cache);
     SDL_free(ctx);
 }
 
@@ -45,10 +45,23 @@ typedef enum
     NUM_SHADERS
 } GL_Shader;
 
+// Vertex attribute locations used by the instanced texture shaders
+typedef enum
+{
+    GL_INSTANCE_ATTRIB_CORNER,
+    GL_INSTANCE_ATTRIB_ORIGIN,
+    GL_INSTANCE_ATTRIB_AXES,
+    GL_INSTANCE_ATTRIB_TEXRECT,
+    GL_INSTANCE_ATTRIB_COLOR,
+    NUM_GL_INSTANCE_ATTRIBS
+} GL_InstanceAttrib;
+
 typedef struct GL_ShaderContext GL_ShaderContext;
 
-extern GL_ShaderContext *GL_CreateShaderContext(void);
-extern void GL_SelectShader(GL_ShaderContext *ctx, GL_Shader shader, const float *shader_params);
+extern GL_ShaderContext *GL_CreateShaderContext(SDL_Storage *program_cache_storage);
+extern bool GL_ShadersSupportInstancing(GL_ShaderContext *ctx);
+extern void GL_SelectShader(GL_ShaderContext *ctx, GL_Shader shader, const float *shader_params, bool instanced);
+extern void GL_InvalidateShaderState(GL_ShaderContext *ctx);
 extern void GL_DestroyShaderContext(GL_ShaderContext *ctx);
 
 #endif // SDL_shaders_gl_h_
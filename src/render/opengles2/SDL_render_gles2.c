@@ -26,6 +26,7 @@
 #include "../../video/SDL_pixels_c.h"
 #include "../../video/SDL_sysvideo.h" // For SDL_RecreateWindow
 #include "../SDL_sysrender.h"
+#include "../SDL_glprogramcache.h"
 #include "SDL_shaders_gles2.h"
 #include <SDL3/SDL_opengles2.h>
 
@@ -46,6 +47,8 @@
 #define RENDERER_CONTEXT_MAJOR 2
 #define RENDERER_CONTEXT_MINOR 0
 
+#define GLES2_PROGRAM_CACHE_FILE "SDL_gles2_render_programs.bin"
+
 /*************************************************************************************************
  * Context structures                                                                            *
  *************************************************************************************************/
@@ -89,8 +92,19 @@ typedef enum
     GLES2_ATTRIBUTE_POSITION = 0,
     GLES2_ATTRIBUTE_COLOR = 1,
     GLES2_ATTRIBUTE_TEXCOORD = 2,
+    GLES2_ATTRIBUTE_SEGMENT = 3,
+    GLES2_ATTRIBUTE_INCLUDE_START = 4,
 } GLES2_Attribute;
 
+// The corners of the fan each line batch segment is drawn as
+#define GLES2_LINE_BATCH_CORNERS 6
+
+typedef struct GLES2_LineBatchVertex
+{
+    GLfloat corner[4];
+    SDL_FColor color;
+} GLES2_LineBatchVertex;
+
 typedef enum
 {
     GLES2_UNIFORM_PROJECTION,
@@ -117,8 +131,8 @@ SDL_COMPILE_TIME_ASSERT(GLES2_UniformNames, SDL_arraysize(GLES2_UniformNames) ==
 typedef struct GLES2_ProgramCacheEntry
 {
     GLuint id;
-    GLuint vertex_shader;
-    GLuint fragment_shader;
+    GLES2_ShaderType vertex_type;
+    GLES2_ShaderType fragment_type;
     GLuint uniform_locations[NUM_GLES2_UNIFORMS];
     GLfloat projection[4][4];
     const float *shader_params;
@@ -160,6 +174,8 @@ typedef struct
     SDL_Rect cliprect;
     bool texturing;
     bool texturing_dirty;
+    bool line_batch;
+    bool line_batch_dirty;
     SDL_FColor clear_color;
     bool clear_color_dirty;
     int drawablew;
@@ -178,6 +194,13 @@ typedef struct GLES2_RenderData
     bool GL_OES_EGL_image_external_supported;
     bool GL_EXT_blend_minmax_supported;
 
+    PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstancedEXT;
+    PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisorEXT;
+
+    PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinaryOES;
+    PFNGLPROGRAMBINARYOESPROC glProgramBinaryOES;
+    SDL_GLProgramCache *program_binaries;
+
 #define SDL_PROC(ret, func, params) ret(APIENTRY *func) params;
 #include "SDL_gles2funcs.h"
 #undef SDL_PROC
@@ -199,7 +222,8 @@ typedef struct GLES2_RenderData
     GLES2_ShaderIncludeType texcoord_precision_hint;
 } GLES2_RenderData;
 
-#define GLES2_MAX_CACHED_PROGRAMS 8
+// Every program is kept once they can be loaded up front from saved binaries
+#define GLES2_MAX_CACHED_PROGRAMS(data) ((data)->program_binaries ? GLES2_SHADER_COUNT : 8)
 
 static const char *GL_TranslateError(GLenum error)
 {
@@ -410,16 +434,100 @@ static bool GLES2_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendM
     return true;
 }
 
-static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLuint vertex, GLuint fragment)
+static bool GLES2_CacheShader(GLES2_RenderData *data, GLES2_ShaderType type, GLenum shader_type);
+
+static Uint64 GLES2_GetProgramKey(GLES2_RenderData *data, GLES2_ShaderType vtype, GLES2_ShaderType ftype)
+{
+    const char *sources[5];
+
+    sources[0] = GLES2_GetShaderPrologue(vtype);
+    sources[1] = GLES2_GetShader(vtype);
+    sources[2] = GLES2_GetShaderPrologue(ftype);
+    sources[3] = GLES2_GetShaderInclude(data->texcoord_precision_hint);
+    sources[4] = GLES2_GetShader(ftype);
+    return SDL_HashGLProgramSources(sources, SDL_arraysize(sources));
+}
+
+static bool GLES2_LoadProgramBinary(GLES2_RenderData *data, GLuint program, Uint64 key)
+{
+    Uint32 format;
+    const void *binary;
+    int length;
+    GLint linkSuccessful = GL_FALSE;
+
+    if (!data->program_binaries || !SDL_FindGLProgramBinary(data->program_binaries, key, &format, &binary, &length)) {
+        return false;
+    }
+
+    data->glProgramBinaryOES(program, (GLenum)format, binary, length);
+    data->glGetProgramiv(program, GL_LINK_STATUS, &linkSuccessful);
+    if (!linkSuccessful) {
+        // Drivers reject binaries from before an update, link it from source instead
+        data->glGetError();
+        SDL_RemoveGLProgramBinary(data->program_binaries, key);
+        return false;
+    }
+    return true;
+}
+
+static void GLES2_SaveProgramBinary(GLES2_RenderData *data, GLuint program, Uint64 key)
+{
+    GLint length = 0;
+    GLenum format = 0;
+    void *binary;
+
+    data->glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    binary = SDL_malloc(length);
+    if (!binary) {
+        return;
+    }
+    data->glGetProgramBinaryOES(program, length, &length, &format, binary);
+    SDL_AddGLProgramBinary(data->program_binaries, key, format, binary, length);
+    SDL_free(binary);
+}
+
+static bool GLES2_LinkProgram(GLES2_RenderData *data, GLuint program, GLES2_ShaderType vtype, GLES2_ShaderType ftype)
 {
-    GLES2_ProgramCacheEntry *entry;
     GLint linkSuccessful;
+
+    // Shaders are compiled the first time a program without a saved binary needs them
+    if (!data->shader_id_cache[(Uint32)vtype] && !GLES2_CacheShader(data, vtype, GL_VERTEX_SHADER)) {
+        return false;
+    }
+    if (!data->shader_id_cache[(Uint32)ftype] && !GLES2_CacheShader(data, ftype, GL_FRAGMENT_SHADER)) {
+        return false;
+    }
+
+    data->glAttachShader(program, data->shader_id_cache[(Uint32)vtype]);
+    data->glAttachShader(program, data->shader_id_cache[(Uint32)ftype]);
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_POSITION, "a_position");
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_COLOR, "a_color");
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_TEXCOORD, "a_texCoord");
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_POSITION, "a_corner");
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_SEGMENT, "a_segment");
+    data->glBindAttribLocation(program, GLES2_ATTRIBUTE_INCLUDE_START, "a_includeStart");
+    data->glLinkProgram(program);
+    data->glGetProgramiv(program, GL_LINK_STATUS, &linkSuccessful);
+    if (!linkSuccessful) {
+        return SDL_SetError("Failed to link shader program");
+    }
+    return true;
+}
+
+static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLES2_ShaderType vtype, GLES2_ShaderType ftype)
+{
+    GLES2_ProgramCacheEntry *entry;
+    Uint64 key = 0;
     int i;
 
     // Check if we've already cached this program
     entry = data->program_cache.head;
     while (entry) {
-        if (entry->vertex_shader == vertex && entry->fragment_shader == fragment) {
+        if (entry->vertex_type == vtype && entry->fragment_type == ftype) {
             break;
         }
         entry = entry->next;
@@ -445,23 +553,23 @@ static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLuin
     if (!entry) {
         return NULL;
     }
-    entry->vertex_shader = vertex;
-    entry->fragment_shader = fragment;
+    entry->vertex_type = vtype;
+    entry->fragment_type = ftype;
 
-    // Create the program and link it
+    // Create the program from its saved binary, or link it
     entry->id = data->glCreateProgram();
-    data->glAttachShader(entry->id, vertex);
-    data->glAttachShader(entry->id, fragment);
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_POSITION, "a_position");
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_COLOR, "a_color");
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_TEXCOORD, "a_texCoord");
-    data->glLinkProgram(entry->id);
-    data->glGetProgramiv(entry->id, GL_LINK_STATUS, &linkSuccessful);
-    if (!linkSuccessful) {
-        data->glDeleteProgram(entry->id);
-        SDL_free(entry);
-        SDL_SetError("Failed to link shader program");
-        return NULL;
+    if (data->program_binaries) {
+        key = GLES2_GetProgramKey(data, vtype, ftype);
+    }
+    if (!GLES2_LoadProgramBinary(data, entry->id, key)) {
+        if (!GLES2_LinkProgram(data, entry->id, vtype, ftype)) {
+            data->glDeleteProgram(entry->id);
+            SDL_free(entry);
+            return NULL;
+        }
+        if (data->program_binaries) {
+            GLES2_SaveProgramBinary(data, entry->id, key);
+        }
     }
 
     // Predetermine locations of uniform variables
@@ -494,7 +602,7 @@ static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLuin
     ++data->program_cache.count;
 
     // Evict the last entry from the cache if we exceed the limit
-    if (data->program_cache.count > GLES2_MAX_CACHED_PROGRAMS) {
+    if (data->program_cache.count > GLES2_MAX_CACHED_PROGRAMS(data)) {
         data->glDeleteProgram(data->program_cache.tail->id);
         data->program_cache.tail = data->program_cache.tail->prev;
         if (data->program_cache.tail) {
@@ -586,6 +694,57 @@ static bool GLES2_CacheShader(GLES2_RenderData *data, GLES2_ShaderType type, GLe
     return true;
 }
 
+static void GLES2_LoadInstancingFunctions(GLES2_RenderData *data)
+{
+    // OpenGL ES 3.0 made instanced arrays core
+    const char *version = (const char *)data->glGetString(GL_VERSION);
+    if (version && SDL_strncmp(version, "OpenGL ES ", 10) == 0 && SDL_atoi(version + 10) >= 3) {
+        data->glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawArraysInstanced");
+        data->glVertexAttribDivisorEXT = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisor");
+    } else if (SDL_GL_ExtensionSupported("GL_EXT_instanced_arrays")) {
+        data->glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawArraysInstancedEXT");
+        data->glVertexAttribDivisorEXT = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisorEXT");
+    } else if (SDL_GL_ExtensionSupported("GL_ANGLE_instanced_arrays")) {
+        data->glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)SDL_GL_GetProcAddress("glDrawArraysInstancedANGLE");
+        data->glVertexAttribDivisorEXT = (PFNGLVERTEXATTRIBDIVISOREXTPROC)SDL_GL_GetProcAddress("glVertexAttribDivisorANGLE");
+    }
+}
+
+static void GLES2_CreateProgramBinaryCache(GLES2_RenderData *data, SDL_Storage *storage)
+{
+    GLint num_formats = 0;
+
+    if (!storage) {
+        return;
+    }
+
+    if (SDL_GL_ExtensionSupported("GL_OES_get_program_binary")) {
+        data->glGetProgramBinaryOES = (PFNGLGETPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glGetProgramBinaryOES");
+        data->glProgramBinaryOES = (PFNGLPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glProgramBinaryOES");
+    } else {
+        // OpenGL ES 3.0 made program binaries core
+        const char *version = (const char *)data->glGetString(GL_VERSION);
+        if (version && SDL_strncmp(version, "OpenGL ES ", 10) == 0 && SDL_atoi(version + 10) >= 3) {
+            data->glGetProgramBinaryOES = (PFNGLGETPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glGetProgramBinary");
+            data->glProgramBinaryOES = (PFNGLPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glProgramBinary");
+        }
+    }
+    if (!data->glGetProgramBinaryOES || !data->glProgramBinaryOES) {
+        return;
+    }
+
+    // Some drivers support the extension without being able to save any programs
+    data->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &num_formats);
+    if (num_formats <= 0) {
+        return;
+    }
+
+    data->program_binaries = SDL_CreateGLProgramCache(storage, GLES2_PROGRAM_CACHE_FILE,
+                                                      (const char *)data->glGetString(GL_VENDOR),
+                                                      (const char *)data->glGetString(GL_RENDERER),
+                                                      (const char *)data->glGetString(GL_VERSION));
+}
+
 static bool GLES2_CacheShaders(GLES2_RenderData *data)
 {
     int shader;
@@ -596,10 +755,24 @@ static bool GLES2_CacheShaders(GLES2_RenderData *data)
         GLenum shader_type;
 
         if (shader == GLES2_SHADER_VERTEX_DEFAULT) {
+            // The vertex shader is compiled if a program without a saved binary needs it
+            if (data->program_binaries) {
+                continue;
+            }
             shader_type = GL_VERTEX_SHADER;
         } else {
             shader_type = GL_FRAGMENT_SHADER;
         }
+
+        // Load every program with a saved binary now, instead of compiling its shaders
+        if (data->program_binaries &&
+            SDL_HasGLProgramBinary(data->program_binaries, GLES2_GetProgramKey(data, GLES2_SHADER_VERTEX_DEFAULT, (GLES2_ShaderType)shader))) {
+            if (!GLES2_CacheProgram(data, GLES2_SHADER_VERTEX_DEFAULT, (GLES2_ShaderType)shader)) {
+                return false;
+            }
+            continue;
+        }
+
         if (!GLES2_CacheShader(data, (GLES2_ShaderType)shader, shader_type)) {
             return false;
         }
@@ -607,17 +780,14 @@ static bool GLES2_CacheShaders(GLES2_RenderData *data)
     return true;
 }
 
-static bool GLES2_SelectProgram(GLES2_RenderData *data, SDL_Texture *texture, GLES2_ImageSource source, SDL_ScaleMode scale_mode, SDL_Colorspace colorspace)
+static bool GLES2_SelectProgram(GLES2_RenderData *data, GLES2_ShaderType vtype, SDL_Texture *texture, GLES2_ImageSource source, SDL_ScaleMode scale_mode, SDL_Colorspace colorspace)
 {
-    GLuint vertex;
-    GLuint fragment;
-    GLES2_ShaderType vtype, ftype;
+    GLES2_ShaderType ftype;
     GLES2_ProgramCacheEntry *program;
     GLES2_TextureData *tdata = texture ? (GLES2_TextureData *)texture->internal : NULL;
     const float *shader_params = NULL;
 
     // Select an appropriate shader pair for the specified modes
-    vtype = GLES2_SHADER_VERTEX_DEFAULT;
     switch (source) {
     case GLES2_IMAGESOURCE_SOLID:
         ftype = GLES2_SHADER_FRAGMENT_SOLID;
@@ -695,33 +865,16 @@ static bool GLES2_SelectProgram(GLES2_RenderData *data, SDL_Texture *texture, GL
         goto fault;
     }
 
-    // Load the requested shaders
-    vertex = data->shader_id_cache[(Uint32)vtype];
-    if (!vertex) {
-        vertex = GLES2_CacheShader(data, vtype, GL_VERTEX_SHADER);
-        if (!vertex) {
-            goto fault;
-        }
-    }
-
-    fragment = data->shader_id_cache[(Uint32)ftype];
-    if (!fragment) {
-        fragment = GLES2_CacheShader(data, ftype, GL_FRAGMENT_SHADER);
-        if (!fragment) {
-            goto fault;
-        }
-    }
-
     // Check if we need to change programs at all
     if (data->drawstate.program &&
-        data->drawstate.program->vertex_shader == vertex &&
-        data->drawstate.program->fragment_shader == fragment &&
+        data->drawstate.program->vertex_type == vtype &&
+        data->drawstate.program->fragment_type == ftype &&
         data->drawstate.program->shader_params == shader_params) {
         return true;
     }
 
     // Generate a matching program
-    program = GLES2_CacheProgram(data, vertex, fragment);
+    program = GLES2_CacheProgram(data, vtype, ftype);
     if (!program) {
         goto fault;
     }
@@ -965,11 +1118,65 @@ static bool GLES2_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
     return true;
 }
 
-static bool SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_ImageSource imgsrc, void *vertices)
+static bool GLES2_QueueLineBatch(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                                 const SDL_LineBatchInstance *instances, int count,
+                                 float scale_x, float scale_y)
+{
+    // Brush corner, counted from the one leading along the segment, and 0 for the start or 1 for the end
+    static const GLfloat fan[GLES2_LINE_BATCH_CORNERS][2] = {
+        { 0.0f, 1.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 3.0f, 0.0f }, { 3.0f, 1.0f }
+    };
+    const bool colorswap = (renderer->target && (renderer->target->format == SDL_PIXELFORMAT_BGRA32 || renderer->target->format == SDL_PIXELFORMAT_BGRX32));
+    SDL_FColor color = cmd->data.draw.color;
+    const float color_scale = cmd->data.draw.color_scale;
+    GLES2_LineBatchVertex *verts;
+    SDL_LineBatchInstance *dst;
+    int i;
+
+    // The fan shared by all instances comes first, then one record per segment
+    verts = (GLES2_LineBatchVertex *)SDL_AllocateRenderVertices(renderer, GLES2_LINE_BATCH_CORNERS * sizeof(*verts) + count * sizeof(*instances), 0, &cmd->data.draw.first);
+    if (!verts) {
+        return false;
+    }
+
+    color.r *= color_scale;
+    color.g *= color_scale;
+    color.b *= color_scale;
+
+    if (colorswap) {
+        float r = color.r;
+        color.r = color.b;
+        color.b = r;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < GLES2_LINE_BATCH_CORNERS; ++i) {
+        verts[i].corner[0] = fan[i][0];
+        verts[i].corner[1] = fan[i][1];
+        verts[i].corner[2] = scale_x;
+        verts[i].corner[3] = scale_y;
+        verts[i].color = color;
+    }
+
+    dst = (SDL_LineBatchInstance *)(verts + GLES2_LINE_BATCH_CORNERS);
+    for (i = 0; i < count; ++i, ++dst) {
+        const SDL_LineBatchInstance *src = &instances[i];
+        dst->start.x = src->start.x * scale_x;
+        dst->start.y = src->start.y * scale_y;
+        dst->end.x = src->end.x * scale_x;
+        dst->end.y = src->end.y * scale_y;
+        dst->include_start = src->include_start;
+    }
+    return true;
+}
+
+static bool SetDrawState(SDL_Renderer *renderer, GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_ImageSource imgsrc, void *vertices)
 {
     SDL_Texture *texture = cmd->data.draw.texture;
     const SDL_BlendMode blend = cmd->data.draw.blend;
-    GLES2_ProgramCacheEntry *program;
+    const bool line_batch = (cmd->command == SDL_RENDERCMD_LINE_BATCH);
+    GLES2_ProgramCacheEntry *program = data->drawstate.program;
     int stride;
 
     SDL_assert((texture != NULL) == (imgsrc != GLES2_IMAGESOURCE_SOLID));
@@ -1016,6 +1223,20 @@ static bool SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, c
         data->drawstate.texturing_dirty = false;
     }
 
+    if (data->drawstate.line_batch_dirty || line_batch != data->drawstate.line_batch) {
+        if (line_batch) {
+            data->glEnableVertexAttribArray((GLenum)GLES2_ATTRIBUTE_SEGMENT);
+            data->glEnableVertexAttribArray((GLenum)GLES2_ATTRIBUTE_INCLUDE_START);
+            data->glVertexAttribDivisorEXT(GLES2_ATTRIBUTE_SEGMENT, 1);
+            data->glVertexAttribDivisorEXT(GLES2_ATTRIBUTE_INCLUDE_START, 1);
+        } else {
+            data->glDisableVertexAttribArray((GLenum)GLES2_ATTRIBUTE_SEGMENT);
+            data->glDisableVertexAttribArray((GLenum)GLES2_ATTRIBUTE_INCLUDE_START);
+        }
+        data->drawstate.line_batch = line_batch;
+        data->drawstate.line_batch_dirty = false;
+    }
+
     if (texture) {
         stride = sizeof(SDL_Vertex);
     } else {
@@ -1028,10 +1249,12 @@ static bool SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, c
     }
 
     SDL_Colorspace colorspace = texture ? texture->colorspace : SDL_COLORSPACE_SRGB;
-    if (!GLES2_SelectProgram(data, texture, imgsrc, cmd->data.draw.texture_scale_mode, colorspace)) {
+    if (!GLES2_SelectProgram(data, line_batch ? GLES2_SHADER_VERTEX_LINE_BATCH : GLES2_SHADER_VERTEX_DEFAULT,
+                             texture, imgsrc, cmd->data.draw.texture_scale_mode, colorspace)) {
         return false;
     }
 
+    SDL_CountRenderStateChange(renderer, program != data->drawstate.program);
     program = data->drawstate.program;
 
     if (program->uniform_locations[GLES2_UNIFORM_PROJECTION] != -1) {
@@ -1041,7 +1264,7 @@ static bool SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, c
         }
     }
 
-    if (blend != data->drawstate.blend) {
+    if (SDL_CountRenderStateChange(renderer, blend != data->drawstate.blend)) {
         if (blend == SDL_BLENDMODE_NONE) {
             data->glDisable(GL_BLEND);
         } else {
@@ -1056,8 +1279,15 @@ static bool SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, c
         data->drawstate.blend = blend;
     }
 
-    // all drawing commands use this
-    {
+    if (line_batch) {
+        uintptr_t base = (uintptr_t)vertices + cmd->data.draw.first; // address of first vertex, or base offset when using VBOs.
+        uintptr_t segments = base + GLES2_LINE_BATCH_CORNERS * sizeof(GLES2_LineBatchVertex);
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_POSITION, 4, GL_FLOAT, GL_FALSE, sizeof(GLES2_LineBatchVertex), (const GLvoid *)(base + offsetof(GLES2_LineBatchVertex, corner)));
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_COLOR, 4, GL_FLOAT, GL_TRUE /* Normalized */, sizeof(GLES2_LineBatchVertex), (const GLvoid *)(base + offsetof(GLES2_LineBatchVertex, color)));
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_SEGMENT, 4, GL_FLOAT, GL_FALSE, sizeof(SDL_LineBatchInstance), (const GLvoid *)(segments + offsetof(SDL_LineBatchInstance, start)));
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_INCLUDE_START, 1, GL_FLOAT, GL_FALSE, sizeof(SDL_LineBatchInstance), (const GLvoid *)(segments + offsetof(SDL_LineBatchInstance, include_start)));
+    } else {
+        // all other drawing commands use this
         uintptr_t base = (uintptr_t)vertices + cmd->data.draw.first; // address of first vertex, or base offset when using VBOs.
         data->glVertexAttribPointer(GLES2_ATTRIBUTE_POSITION, 2, GL_FLOAT, GL_FALSE, stride, (const GLvoid *)(base + offsetof(SDL_VertexSolid, position)));
         data->glVertexAttribPointer(GLES2_ATTRIBUTE_COLOR, 4, GL_FLOAT, GL_TRUE /* Normalized */, stride, (const GLvoid *)(base + offsetof(SDL_VertexSolid, color)));
@@ -1235,9 +1465,9 @@ static bool SetCopyState(SDL_Renderer *renderer, const SDL_RenderCommand *cmd, v
         }
     }
 
-    ret = SetDrawState(data, cmd, sourceType, vertices);
+    ret = SetDrawState(renderer, data, cmd, sourceType, vertices);
 
-    if (texture != data->drawstate.texture) {
+    if (SDL_CountRenderStateChange(renderer, texture != data->drawstate.texture)) {
 #ifdef SDL_HAVE_YUV
         if (tdata->yuv) {
             data->glActiveTexture(GL_TEXTURE2);
@@ -1325,6 +1555,7 @@ static void GLES2_InvalidateCachedState(SDL_Renderer *renderer)
     cache->cliprect_enabled_dirty = true;
     cache->cliprect_dirty = true;
     cache->texturing_dirty = true;
+    cache->line_batch_dirty = true;
     cache->clear_color_dirty = true;
     cache->drawablew = 0;
     cache->drawableh = 0;
@@ -1448,11 +1679,12 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
 
         case SDL_RENDERCMD_DRAW_LINES:
         {
-            if (SetDrawState(data, cmd, GLES2_IMAGESOURCE_SOLID, vertices)) {
+            if (SetDrawState(renderer, data, cmd, GLES2_IMAGESOURCE_SOLID, vertices)) {
                 size_t count = cmd->data.draw.count;
                 if (count > 2) {
                     // joined lines cannot be grouped
                     data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    ++renderer->stats.draw_calls;
                 } else {
                     // let's group non joined lines
                     SDL_RenderCommand *finalcmd = cmd;
@@ -1475,6 +1707,7 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
                     }
 
                     data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    ++renderer->stats.draw_calls;
                     cmd = finalcmd; // skip any copy commands we just combined in here.
                 }
             }
@@ -1516,7 +1749,7 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             if (thistexture) {
                 ret = SetCopyState(renderer, cmd, vertices);
             } else {
-                ret = SetDrawState(data, cmd, GLES2_IMAGESOURCE_SOLID, vertices);
+                ret = SetDrawState(renderer, data, cmd, GLES2_IMAGESOURCE_SOLID, vertices);
             }
 
             if (ret) {
@@ -1525,12 +1758,25 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
                     op = GL_POINTS;
                 }
                 data->glDrawArrays(op, 0, (GLsizei)count);
+                ++renderer->stats.draw_calls;
             }
 
             cmd = finalcmd; // skip any copy commands we just combined in here.
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH:
+        {
+            if (SetDrawState(renderer, data, cmd, GLES2_IMAGESOURCE_SOLID, vertices)) {
+                data->glDrawArraysInstancedEXT(GL_TRIANGLE_FAN, 0, GLES2_LINE_BATCH_CORNERS, (GLsizei)cmd->data.draw.count);
+                ++renderer->stats.draw_calls;
+            }
+            break;
+        }
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -1569,6 +1815,7 @@ static void GLES2_DestroyRenderer(SDL_Renderer *renderer)
                 entry = next;
             }
         }
+        SDL_DestroyGLProgramCache(data->program_binaries);
 
         if (data->context) {
             while (data->framebuffers) {
@@ -2198,6 +2445,8 @@ static bool GLES2_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
         goto error;
     }
 
+    GLES2_CreateProgramBinaryCache(data, (SDL_Storage *)SDL_GetPointerProperty(create_props, SDL_PROP_RENDERER_CREATE_OPENGL_PROGRAM_CACHE_STORAGE_POINTER, NULL));
+
     if (!GLES2_CacheShaders(data)) {
         goto error;
     }
@@ -2265,6 +2514,12 @@ static bool GLES2_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
         data->GL_EXT_blend_minmax_supported = true;
     }
 
+    // Line batches are drawn as instanced segments, if we can draw instances
+    GLES2_LoadInstancingFunctions(data);
+    if (data->glDrawArraysInstancedEXT && data->glVertexAttribDivisorEXT) {
+        renderer->QueueLineBatch = GLES2_QueueLineBatch;
+    }
+
     // Set up parameters for rendering
     data->glDisable(GL_DEPTH_TEST);
     data->glDisable(GL_CULL_FACE);
@@ -79,6 +79,31 @@ static const char GLES2_Vertex_Default[] =
 "}\n"
 ;
 
+/* Line batches draw one instance per segment, as a fan of six corners of the
+ * one pixel squares at its ends. a_corner is the brush corner, counted from
+ * the one leading in the direction of the segment, whether it belongs to the
+ * start or the end, and the brush size. Corner -1 is the start corner, which
+ * is left out unless the instance includes the start square. */
+static const char GLES2_Vertex_LineBatch[] =
+"uniform mat4 u_projection;\n"
+"attribute vec4 a_corner;\n"
+"attribute vec4 a_color;\n"
+"attribute vec4 a_segment;\n"
+"attribute float a_includeStart;\n"
+"varying vec4 v_color;\n"
+"\n"
+"void main()\n"
+"{\n"
+"    vec2 delta = a_segment.zw - a_segment.xy;\n"
+"    float lead = delta.x >= 0.0 ? (delta.y >= 0.0 ? 2.0 : 1.0) : (delta.y >= 0.0 ? 3.0 : 0.0);\n"
+"    float corner = mod(lead + (a_corner.x < 0.0 ? 2.0 * a_includeStart : a_corner.x), 4.0);\n"
+"    vec2 offset = vec2(step(0.5, corner) * step(corner, 2.5), step(1.5, corner));\n"
+"    vec2 position = mix(a_segment.xy, a_segment.zw, a_corner.y) + offset * a_corner.zw;\n"
+"    gl_Position = u_projection * vec4(position, 0.0, 1.0);\n"
+"    v_color = a_color;\n"
+"}\n"
+;
+
 static const char GLES2_Fragment_Solid[] =
 "varying mediump vec4 v_color;\n"
 "\n"
@@ -457,6 +482,8 @@ const char *GLES2_GetShader(GLES2_ShaderType type)
 #endif
     case GLES2_SHADER_FRAGMENT_TEXTURE_EXTERNAL_OES:
         return GLES2_Fragment_TextureExternalOES;
+    case GLES2_SHADER_VERTEX_LINE_BATCH:
+        return GLES2_Vertex_LineBatch;
     default:
         return NULL;
     }
@@ -56,6 +56,7 @@ typedef enum
 #endif
     // Shaders beyond this point are optional and not cached at render creation
     GLES2_SHADER_FRAGMENT_TEXTURE_EXTERNAL_OES,
+    GLES2_SHADER_VERTEX_LINE_BATCH,
     GLES2_SHADER_COUNT
 } GLES2_ShaderType;
 
@@ -460,6 +460,7 @@ static bool PS2_RenderGeometry(SDL_Renderer *renderer, void *vertices, SDL_Rende
         const GSPRIMPOINT *verts = (GSPRIMPOINT *)(vertices + cmd->data.draw.first);
         gsKit_prim_list_triangle_gouraud_3d(data->gsGlobal, count, verts);
     }
+    ++renderer->stats.draw_calls;
 
     return true;
 }
@@ -472,6 +473,7 @@ static bool PS2_RenderLines(SDL_Renderer *renderer, void *vertices, SDL_RenderCo
 
     PS2_SetBlendMode(data, cmd->data.draw.blend);
     gsKit_prim_list_line_goraud_3d(data->gsGlobal, count, verts);
+    ++renderer->stats.draw_calls;
 
     // We're done!
     return true;
@@ -485,6 +487,7 @@ static bool PS2_RenderPoints(SDL_Renderer *renderer, void *vertices, SDL_RenderC
 
     PS2_SetBlendMode(data, cmd->data.draw.blend);
     gsKit_prim_list_points(data->gsGlobal, count, verts);
+    ++renderer->stats.draw_calls;
 
     // We're done!
     return true;
@@ -541,6 +544,11 @@ static bool PS2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             PS2_RenderGeometry(renderer, vertices, cmd);
             break;
         }
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
         case SDL_RENDERCMD_NO_OP:
             break;
         }
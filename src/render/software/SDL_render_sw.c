@@ -26,6 +26,7 @@
 #include "SDL_render_sw_c.h"
 
 #include "../../video/SDL_pixels_c.h"
+#include "../../video/SDL_RLEaccel_c.h"
 #include "SDL_blendfillrect.h"
 #include "SDL_blendline.h"
 #include "SDL_blendpoint.h"
@@ -45,10 +46,54 @@ typedef struct
     SDL_Color color;
 } SW_DrawStateCache;
 
+// Commands are binned into tiles of this size when SDL_HINT_RENDER_SOFTWARE_TILES is set
+#define SW_TILE_SIZE 64
+
+// Texture views each tile keeps around while it runs
+#define SW_TILE_TEXTURES 4
+
+typedef struct SW_TileCommand
+{
+    const SDL_RenderCommand *cmd;
+    void *verts;
+    SDL_Surface *texture;
+    SDL_Rect clip;
+    SDL_Color color;
+} SW_TileCommand;
+
+typedef struct SW_TileEntry
+{
+    int command;
+    int next;
+} SW_TileEntry;
+
+typedef struct SW_Tile
+{
+    int first;
+    int last;
+} SW_Tile;
+
+typedef struct SW_TileBatch
+{
+    SDL_Surface *surface;
+    int tiles_x;
+    int tiles_y;
+    SW_Tile *tiles;
+    int max_tiles;
+    SW_TileCommand *commands;
+    int num_commands;
+    int max_commands;
+    SW_TileEntry *entries;
+    int num_entries;
+    int max_entries;
+} SW_TileBatch;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    bool tiled;
+    SW_TileBatch tiles;
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -81,12 +126,13 @@ static bool SW_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->internal;
 
-    if (data->surface) {
+    // The output is the window surface, even while a texture is the render target
+    if (data->window) {
         if (w) {
-            *w = data->surface->w;
+            *w = data->window->w;
         }
         if (h) {
-            *h = data->surface->h;
+            *h = data->window->h;
         }
         return true;
     }
@@ -390,7 +436,7 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
     if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateSurface(final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888);
+        mask = SDL_CreatePooledSurface(final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888);
         if (!mask) {
             result = false;
         } else {
@@ -403,7 +449,7 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
      */
     if (result && (blitRequired || applyModulation)) {
         SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateSurface(final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888);
+        src_scaled = SDL_CreatePooledSurface(final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888);
         if (!src_scaled) {
             result = false;
         } else {
@@ -526,6 +572,39 @@ typedef struct GeometryCopyData
     SDL_Color color;
 } GeometryCopyData;
 
+static bool SW_IsUniformQuad(const GeometryFillData *ptr, SDL_Rect *rect)
+{
+    int i;
+
+    for (i = 1; i < 6; i++) {
+        if (SDL_memcmp(&ptr[i].color, &ptr[0].color, sizeof(ptr[0].color)) != 0) {
+            return false;
+        }
+    }
+    return SDL_SW_GetQuadRect(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &ptr[3].dst, &ptr[4].dst, &ptr[5].dst, rect);
+}
+
+static void SW_FillGeometry(SDL_Surface *surface, const GeometryFillData *ptr, int count, SDL_BlendMode blend)
+{
+    int i;
+
+    for (i = 0; i < count; i += 3, ptr += 3) {
+        SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+        SDL_Rect rect;
+
+        /* Blended rectangles drawn as two triangles are filled in one go, rather
+         * than blending the bounding rect of each triangle through a temporary surface.
+         */
+        if (blend != SDL_BLENDMODE_NONE && i + 6 <= count && SW_IsUniformQuad(ptr, &rect)) {
+            SDL_SW_FillQuad(surface, &rect, blend, ptr[0].color);
+            i += 3;
+            ptr += 3;
+            continue;
+        }
+        SDL_SW_FillTriangle(surface, &d0, &d1, &d2, blend, ptr[0].color, ptr[1].color, ptr[2].color);
+    }
+}
+
 static bool SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL_Texture *texture,
                              const float *xy, int xy_stride, const SDL_FColor *color, int color_stride, const float *uv, int uv_stride,
                              int num_vertices, const void *indices, int num_indices, int size_indices,
@@ -639,25 +718,372 @@ static void PrepTextureForCopy(const SDL_RenderCommand *cmd, SW_DrawStateCache *
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+static void GetDrawClipRect(SDL_Surface *surface, const SW_DrawStateCache *drawstate, SDL_Rect *clip_rect)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_Rect full_rect;
+    SDL_assert_release(viewport != NULL); // the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT
+
+    if (cliprect && viewport) {
+        clip_rect->x = cliprect->x + viewport->x;
+        clip_rect->y = cliprect->y + viewport->y;
+        clip_rect->w = cliprect->w;
+        clip_rect->h = cliprect->h;
+        SDL_GetRectIntersection(viewport, clip_rect, clip_rect);
+    } else {
+        *clip_rect = *viewport;
+    }
+
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+    SDL_GetRectIntersection(clip_rect, &full_rect, clip_rect);
+}
+
 static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     if (drawstate->surface_cliprect_dirty) {
-        const SDL_Rect *viewport = drawstate->viewport;
-        const SDL_Rect *cliprect = drawstate->cliprect;
-        SDL_assert_release(viewport != NULL); // the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT
-
-        if (cliprect && viewport) {
-            SDL_Rect clip_rect;
-            clip_rect.x = cliprect->x + viewport->x;
-            clip_rect.y = cliprect->y + viewport->y;
-            clip_rect.w = cliprect->w;
-            clip_rect.h = cliprect->h;
-            SDL_GetRectIntersection(viewport, &clip_rect, &clip_rect);
-            SDL_SetSurfaceClipRect(surface, &clip_rect);
+        SDL_Rect clip_rect;
+        GetDrawClipRect(surface, drawstate, &clip_rect);
+        SDL_SetSurfaceClipRect(surface, &clip_rect);
+        drawstate->surface_cliprect_dirty = false;
+    }
+}
+
+/* Tiled rendering: runs of commands that clip exactly are binned into tiles,
+ * then the tiles are drawn in parallel, each through its own views of the
+ * target and the textures. Commands keep their order within each tile, and
+ * anything that can't be split by clipping (lines, scaled and rotated copies)
+ * flushes the pending tiles and draws on the calling thread.
+ */
+static void SW_ResetTiles(SW_TileBatch *batch)
+{
+    int i;
+    const int num_tiles = batch->tiles_x * batch->tiles_y;
+
+    for (i = 0; i < num_tiles; ++i) {
+        batch->tiles[i].first = -1;
+        batch->tiles[i].last = -1;
+    }
+    batch->num_commands = 0;
+    batch->num_entries = 0;
+}
+
+static SW_TileBatch *SW_BeginTiles(SW_RenderData *data, SDL_Surface *surface)
+{
+    SW_TileBatch *batch = &data->tiles;
+    int tiles_x, tiles_y;
+
+    if (!data->tiled || SDL_ISPIXELFORMAT_INDEXED(surface->format) || SDL_MUSTLOCK(surface)) {
+        return NULL;
+    }
+
+    tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    if ((tiles_x * tiles_y) <= 1 || SDL_GetNumJobThreads() == 0) {
+        return NULL;
+    }
+
+    if ((tiles_x * tiles_y) > batch->max_tiles) {
+        SW_Tile *tiles = (SW_Tile *)SDL_realloc(batch->tiles, tiles_x * tiles_y * sizeof(*tiles));
+        if (!tiles) {
+            return NULL;
+        }
+        batch->tiles = tiles;
+        batch->max_tiles = tiles_x * tiles_y;
+    }
+
+    batch->surface = surface;
+    batch->tiles_x = tiles_x;
+    batch->tiles_y = tiles_y;
+    SW_ResetTiles(batch);
+    return batch;
+}
+
+static SDL_Surface *SW_GetTileTexture(SDL_Texture *texture)
+{
+    SDL_Surface *surface = (SDL_Surface *)texture->internal;
+
+    if (SDL_ISPIXELFORMAT_INDEXED(surface->format)) {
+        return NULL;
+    }
+
+    // The tiles read the texture pixels directly, so keep them decoded
+    SDL_SetSurfaceRLE(surface, false);
+    if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
+        SDL_UnRLESurface(surface, true);
+        if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
+            return NULL;
+        }
+    }
+    return surface;
+}
+
+static void SW_GetPointsBounds(const SDL_Point *points, int count, SDL_Rect *bounds)
+{
+    if (!SDL_GetRectEnclosingPoints(points, count, NULL, bounds)) {
+        SDL_zerop(bounds);
+    }
+}
+
+static void SW_GetRectsBounds(const SDL_Rect *rects, int count, SDL_Rect *bounds)
+{
+    int i;
+
+    SDL_zerop(bounds);
+    for (i = 0; i < count; ++i) {
+        SDL_GetRectUnion(bounds, &rects[i], bounds);
+    }
+}
+
+static void SW_GetGeometryBounds(const SDL_Point *first, int count, size_t stride, SDL_Rect *bounds)
+{
+    int i;
+    int min_x = SDL_MAX_SINT32, min_y = SDL_MAX_SINT32;
+    int max_x = SDL_MIN_SINT32, max_y = SDL_MIN_SINT32;
+
+    if (count <= 0) {
+        SDL_zerop(bounds);
+        return;
+    }
+
+    // The vertices are in fixed point, see trianglepoint_2_fixedpoint()
+    for (i = 0; i < count; ++i) {
+        const SDL_Point *dst = (const SDL_Point *)((const Uint8 *)first + i * stride);
+        min_x = SDL_min(min_x, dst->x);
+        min_y = SDL_min(min_y, dst->y);
+        max_x = SDL_max(max_x, dst->x);
+        max_y = SDL_max(max_y, dst->y);
+    }
+    bounds->x = min_x / 2 - 1;
+    bounds->y = min_y / 2 - 1;
+    bounds->w = max_x / 2 - bounds->x + 2;
+    bounds->h = max_y / 2 - bounds->y + 2;
+}
+
+static bool SW_AddTileCommand(SW_TileBatch *batch, const SDL_RenderCommand *cmd, void *verts, SDL_Surface *texture,
+                              const SDL_Rect *clip, SDL_Color color, const SDL_Rect *bounds)
+{
+    SDL_Rect rect;
+    int x, y, x0, y0, x1, y1, command, needed;
+
+    if (!SDL_GetRectIntersection(bounds, clip, &rect)) {
+        return true; // nothing to draw
+    }
+
+    x0 = rect.x / SW_TILE_SIZE;
+    y0 = rect.y / SW_TILE_SIZE;
+    x1 = (rect.x + rect.w - 1) / SW_TILE_SIZE;
+    y1 = (rect.y + rect.h - 1) / SW_TILE_SIZE;
+
+    if (batch->num_commands == batch->max_commands) {
+        const int max_commands = batch->max_commands ? (batch->max_commands * 2) : 64;
+        SW_TileCommand *commands = (SW_TileCommand *)SDL_realloc(batch->commands, max_commands * sizeof(*commands));
+        if (!commands) {
+            return false;
+        }
+        batch->commands = commands;
+        batch->max_commands = max_commands;
+    }
+
+    needed = batch->num_entries + (x1 - x0 + 1) * (y1 - y0 + 1);
+    if (needed > batch->max_entries) {
+        int max_entries = batch->max_entries ? batch->max_entries : 256;
+        SW_TileEntry *entries;
+        while (max_entries < needed) {
+            max_entries *= 2;
+        }
+        entries = (SW_TileEntry *)SDL_realloc(batch->entries, max_entries * sizeof(*entries));
+        if (!entries) {
+            return false;
+        }
+        batch->entries = entries;
+        batch->max_entries = max_entries;
+    }
+
+    command = batch->num_commands++;
+    batch->commands[command].cmd = cmd;
+    batch->commands[command].verts = verts;
+    batch->commands[command].texture = texture;
+    batch->commands[command].clip = rect;
+    batch->commands[command].color = color;
+
+    for (y = y0; y <= y1; ++y) {
+        for (x = x0; x <= x1; ++x) {
+            SW_Tile *tile = &batch->tiles[y * batch->tiles_x + x];
+            const int entry = batch->num_entries++;
+
+            batch->entries[entry].command = command;
+            batch->entries[entry].next = -1;
+            if (tile->last >= 0) {
+                batch->entries[tile->last].next = entry;
+            } else {
+                tile->first = entry;
+            }
+            tile->last = entry;
+        }
+    }
+    return true;
+}
+
+typedef struct SW_TileTexture
+{
+    SDL_Surface *texture;
+    SDL_Surface view;
+} SW_TileTexture;
+
+static SDL_Surface *SW_GetTileTextureView(SW_TileTexture *textures, int *num_textures, int *next_texture, SDL_Surface *texture)
+{
+    SW_TileTexture *slot;
+    int i;
+
+    for (i = 0; i < *num_textures; ++i) {
+        if (textures[i].texture == texture) {
+            return &textures[i].view;
+        }
+    }
+
+    if (*num_textures < SW_TILE_TEXTURES) {
+        slot = &textures[(*num_textures)++];
+    } else {
+        slot = &textures[*next_texture];
+        *next_texture = (*next_texture + 1) % SW_TILE_TEXTURES;
+        if (slot->texture) {
+            SDL_DestroySurface(&slot->view);
+        }
+    }
+
+    if (!SDL_InitializeSurfaceView(&slot->view, texture)) {
+        slot->texture = NULL;
+        return NULL;
+    }
+    slot->texture = texture;
+    return &slot->view;
+}
+
+static void SW_DrawTileCommand(SDL_Surface *surface, SDL_Surface *src, const SW_TileCommand *tile_cmd)
+{
+    const SDL_RenderCommand *cmd = tile_cmd->cmd;
+    const Uint8 r = tile_cmd->color.r;
+    const Uint8 g = tile_cmd->color.g;
+    const Uint8 b = tile_cmd->color.b;
+    const Uint8 a = tile_cmd->color.a;
+    const int count = (int)cmd->data.draw.count;
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+    int i;
+
+    if (src) {
+        SDL_SetSurfaceColorMod(src, r, g, b);
+        SDL_SetSurfaceAlphaMod(src, a);
+        SDL_SetSurfaceBlendMode(src, blend);
+    }
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        break;
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(surface, (const SDL_Point *)tile_cmd->verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
         } else {
-            SDL_SetSurfaceClipRect(surface, drawstate->viewport);
+            SDL_BlendPoints(surface, (const SDL_Point *)tile_cmd->verts, count, blend, r, g, b, a);
         }
-        drawstate->surface_cliprect_dirty = false;
+        break;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_FillSurfaceRects(surface, (const SDL_Rect *)tile_cmd->verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendFillRects(surface, (const SDL_Rect *)tile_cmd->verts, count, blend, r, g, b, a);
+        }
+        break;
+
+    case SDL_RENDERCMD_COPY:
+    {
+        const SDL_Rect *verts = (const SDL_Rect *)tile_cmd->verts;
+        SDL_BlitSurface(src, &verts[0], surface, &verts[1]);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+        if (src) {
+            const GeometryCopyData *ptr = (const GeometryCopyData *)tile_cmd->verts;
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                // The blitter adjusts the texture coordinates, so give it a copy for each tile
+                SDL_Point s0 = ptr[0].src, s1 = ptr[1].src, s2 = ptr[2].src;
+                SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+                SDL_SW_BlitTriangle(src, &s0, &s1, &s2, surface, &d0, &d1, &d2,
+                                    ptr[0].color, ptr[1].color, ptr[2].color,
+                                    cmd->data.draw.texture_address_mode_u,
+                                    cmd->data.draw.texture_address_mode_v);
+            }
+        } else {
+            SW_FillGeometry(surface, (const GeometryFillData *)tile_cmd->verts, count, blend);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void SDLCALL SW_RunTile(void *userdata, int index)
+{
+    SW_TileBatch *batch = (SW_TileBatch *)userdata;
+    const SW_Tile *tile = &batch->tiles[index];
+    SW_TileTexture textures[SW_TILE_TEXTURES];
+    int num_textures = 0, next_texture = 0;
+    SDL_Surface surface;
+    SDL_Rect tile_rect;
+    int i;
+
+    if (tile->first < 0) {
+        return;
+    }
+
+    if (!SDL_InitializeSurfaceView(&surface, batch->surface)) {
+        return;
+    }
+
+    tile_rect.x = (index % batch->tiles_x) * SW_TILE_SIZE;
+    tile_rect.y = (index / batch->tiles_x) * SW_TILE_SIZE;
+    tile_rect.w = SW_TILE_SIZE;
+    tile_rect.h = SW_TILE_SIZE;
+
+    for (i = tile->first; i >= 0; i = batch->entries[i].next) {
+        const SW_TileCommand *tile_cmd = &batch->commands[batch->entries[i].command];
+        SDL_Surface *src = NULL;
+        SDL_Rect clip_rect;
+
+        if (!SDL_GetRectIntersection(&tile_cmd->clip, &tile_rect, &clip_rect)) {
+            continue;
+        }
+        if (tile_cmd->texture) {
+            src = SW_GetTileTextureView(textures, &num_textures, &next_texture, tile_cmd->texture);
+            if (!src) {
+                continue;
+            }
+        }
+        SDL_SetSurfaceClipRect(&surface, &clip_rect);
+        SW_DrawTileCommand(&surface, src, tile_cmd);
+    }
+
+    for (i = 0; i < num_textures; ++i) {
+        if (textures[i].texture) {
+            SDL_DestroySurface(&textures[i].view);
+        }
+    }
+    SDL_DestroySurface(&surface);
+}
+
+static void SW_FlushTiles(SW_TileBatch *batch)
+{
+    if (batch && batch->num_commands > 0) {
+        SDL_RunJobs(SW_RunTile, batch, batch->tiles_x * batch->tiles_y);
+        SW_ResetTiles(batch);
     }
 }
 
@@ -668,13 +1094,17 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
 
 static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
+    SW_TileBatch *tiles;
 
     if (!SDL_SurfaceValid(surface)) {
         return false;
     }
 
+    tiles = SW_BeginTiles(data, surface);
+
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = true;
@@ -714,6 +1144,25 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
             const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
             const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+            if (tiles) {
+                SDL_Rect rect;
+                SDL_Color color;
+
+                // Everything binned so far is about to be covered
+                SW_ResetTiles(tiles);
+
+                rect.x = 0;
+                rect.y = 0;
+                rect.w = surface->w;
+                rect.h = surface->h;
+                color.r = r;
+                color.g = g;
+                color.b = b;
+                color.a = a;
+                if (SW_AddTileCommand(tiles, cmd, NULL, NULL, &rect, color, &rect)) {
+                    break;
+                }
+            }
             // By definition the clear ignores the clip rect
             SDL_SetSurfaceClipRect(surface, NULL);
             SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
@@ -741,11 +1190,23 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
+            if (tiles) {
+                SDL_Rect clip_rect, bounds;
+                GetDrawClipRect(surface, &drawstate, &clip_rect);
+                SW_GetPointsBounds(verts, count, &bounds);
+                if (SW_AddTileCommand(tiles, cmd, verts, NULL, &clip_rect, drawstate.color, &bounds)) {
+                    ++renderer->stats.draw_calls;
+                    break;
+                }
+                SW_FlushTiles(tiles);
+            }
+
             if (blend == SDL_BLENDMODE_NONE) {
                 SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
             } else {
                 SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
             }
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -769,11 +1230,14 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
+            SW_FlushTiles(tiles);
+
             if (blend == SDL_BLENDMODE_NONE) {
                 SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
             } else {
                 SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
             }
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -797,11 +1261,23 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
+            if (tiles) {
+                SDL_Rect clip_rect, bounds;
+                GetDrawClipRect(surface, &drawstate, &clip_rect);
+                SW_GetRectsBounds(verts, count, &bounds);
+                if (SW_AddTileCommand(tiles, cmd, verts, NULL, &clip_rect, drawstate.color, &bounds)) {
+                    ++renderer->stats.draw_calls;
+                    break;
+                }
+                SW_FlushTiles(tiles);
+            }
+
             if (blend == SDL_BLENDMODE_NONE) {
                 SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
             } else {
                 SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
             }
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -813,16 +1289,32 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SDL_Texture *texture = cmd->data.draw.texture;
             SDL_Surface *src = (SDL_Surface *)texture->internal;
 
-            SetDrawState(surface, &drawstate);
-
-            PrepTextureForCopy(cmd, &drawstate);
-
             // Apply viewport
             if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
                 dstrect->x += drawstate.viewport->x;
                 dstrect->y += drawstate.viewport->y;
             }
 
+            if (tiles) {
+                SDL_Surface *tile_src = NULL;
+                if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+                    tile_src = SW_GetTileTexture(texture);
+                }
+                if (tile_src) {
+                    SDL_Rect clip_rect;
+                    GetDrawClipRect(surface, &drawstate, &clip_rect);
+                    if (SW_AddTileCommand(tiles, cmd, verts, tile_src, &clip_rect, drawstate.color, dstrect)) {
+                        ++renderer->stats.draw_calls;
+                        break;
+                    }
+                }
+                SW_FlushTiles(tiles);
+            }
+
+            SetDrawState(surface, &drawstate);
+
+            PrepTextureForCopy(cmd, &drawstate);
+
             if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
                 SDL_BlitSurface(src, srcrect, surface, dstrect);
             } else {
@@ -833,7 +1325,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
 
                 // Prevent to do scaling + clipping on viewport boundaries as it may lose proportion
                 if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
-                    SDL_Surface *tmp = SDL_CreateSurface(dstrect->w, dstrect->h, src->format);
+                    SDL_Surface *tmp = SDL_CreatePooledSurface(dstrect->w, dstrect->h, src->format);
                     // Scale to an intermediate surface, then blit
                     if (tmp) {
                         SDL_Rect r;
@@ -867,12 +1359,14 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
                 }
             }
+            ++renderer->stats.draw_calls;
             break;
         }
 
         case SDL_RENDERCMD_COPY_EX:
         {
             CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            SW_FlushTiles(tiles);
             SetDrawState(surface, &drawstate);
             PrepTextureForCopy(cmd, &drawstate);
 
@@ -885,6 +1379,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
                             &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
                             copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+            ++renderer->stats.draw_calls;
             break;
         }
 
@@ -896,6 +1391,45 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SDL_Texture *texture = cmd->data.draw.texture;
             const SDL_BlendMode blend = cmd->data.draw.blend;
 
+            // Apply viewport
+            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
+                SDL_Point vp;
+                vp.x = drawstate.viewport->x;
+                vp.y = drawstate.viewport->y;
+                trianglepoint_2_fixedpoint(&vp);
+                if (texture) {
+                    GeometryCopyData *ptr = (GeometryCopyData *)verts;
+                    for (i = 0; i < count; i++) {
+                        ptr[i].dst.x += vp.x;
+                        ptr[i].dst.y += vp.y;
+                    }
+                } else {
+                    GeometryFillData *ptr = (GeometryFillData *)verts;
+                    for (i = 0; i < count; i++) {
+                        ptr[i].dst.x += vp.x;
+                        ptr[i].dst.y += vp.y;
+                    }
+                }
+            }
+
+            if (tiles) {
+                SDL_Surface *tile_src = texture ? SW_GetTileTexture(texture) : NULL;
+                if (!texture || tile_src) {
+                    SDL_Rect clip_rect, bounds;
+                    GetDrawClipRect(surface, &drawstate, &clip_rect);
+                    if (texture) {
+                        SW_GetGeometryBounds(&((GeometryCopyData *)verts)->dst, count, sizeof(GeometryCopyData), &bounds);
+                    } else {
+                        SW_GetGeometryBounds(&((GeometryFillData *)verts)->dst, count, sizeof(GeometryFillData), &bounds);
+                    }
+                    if (SW_AddTileCommand(tiles, cmd, verts, tile_src, &clip_rect, drawstate.color, &bounds)) {
+                        ++renderer->stats.draw_calls;
+                        break;
+                    }
+                }
+                SW_FlushTiles(tiles);
+            }
+
             SetDrawState(surface, &drawstate);
 
             if (texture) {
@@ -905,18 +1439,6 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
 
                 PrepTextureForCopy(cmd, &drawstate);
 
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
-                    }
-                }
-
                 for (i = 0; i < count; i += 3, ptr += 3) {
                     SDL_SW_BlitTriangle(
                         src,
@@ -928,27 +1450,18 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                         cmd->data.draw.texture_address_mode_v);
                 }
             } else {
-                GeometryFillData *ptr = (GeometryFillData *)verts;
-
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
-                    }
-                }
-
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
-                }
+                SW_FillGeometry(surface, (const GeometryFillData *)verts, count, blend);
             }
+            ++renderer->stats.draw_calls;
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -956,6 +1469,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         cmd = cmd->next;
     }
 
+    SW_FlushTiles(tiles);
+
     return true;
 }
 
@@ -1010,6 +1525,9 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    SDL_free(data->tiles.tiles);
+    SDL_free(data->tiles.commands);
+    SDL_free(data->tiles.entries);
     SDL_free(data);
 }
 
@@ -1124,6 +1642,7 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     }
     data->surface = surface;
     data->window = surface;
+    data->tiled = SDL_GetHintBoolean(SDL_HINT_RENDER_SOFTWARE_TILES, false);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -212,6 +212,10 @@ static void computeSourceIncrements90(SDL_Surface *src, int bpp, int angle, int
     }
 }
 
+/* Size of the blocks that 90 and 270 degree rotations are copied in, so the
+   source columns being read stay in the cache until the block is done. */
+#define BLOCK_SIZE_90 32
+
 // Performs a relatively fast rotation/flip when the angle is a multiple of 90 degrees.
 #define TRANSFORM_SURFACE_90(pixelType)                                                                     \
     int dy, dincy = dst->pitch - dst->w * sizeof(pixelType), sincx, sincy, signx, signy;                    \
@@ -223,6 +227,26 @@ static void computeSourceIncrements90(SDL_Surface *src, int bpp, int angle, int
     if (signy < 0)                                                                                          \
         sp += (src->h - 1) * src->pitch;                                                                    \
                                                                                                             \
+    if (angle & 1) { /* each destination row walks down a source column, so copy in blocks */              \
+        const int srowinc = sincy + dst->w * sincx;                                                         \
+        int bx, by;                                                                                         \
+        for (by = 0; by < dst->h; by += BLOCK_SIZE_90) {                                                    \
+            const int bh = SDL_min(BLOCK_SIZE_90, dst->h - by);                                             \
+            for (bx = 0; bx < dst->w; bx += BLOCK_SIZE_90) {                                                \
+                const int bw = SDL_min(BLOCK_SIZE_90, dst->w - bx);                                         \
+                for (dy = by; dy < by + bh; dy++) {                                                         \
+                    const Uint8 *s = sp + (ptrdiff_t)dy * srowinc + (ptrdiff_t)bx * sincx;                  \
+                    pixelType *d = (pixelType *)((Uint8 *)dst->pixels + (ptrdiff_t)dy * dst->pitch) + bx;   \
+                    pixelType *e = d + bw;                                                                  \
+                    for (; d != e; s += sincx, d++) {                                                       \
+                        *d = *(const pixelType *)s;                                                         \
+                    }                                                                                       \
+                }                                                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+        return;                                                                                             \
+    }                                                                                                       \
+                                                                                                            \
     for (dy = 0; dy < dst->h; sp += sincy, dp += dincy, dy++) {                                             \
         if (sincx == sizeof(pixelType)) { /* if advancing src and dest equally, use SDL_memcpy */           \
             SDL_memcpy(dp, sp, dst->w * sizeof(pixelType));                                                 \
@@ -247,6 +271,91 @@ static void transformSurfaceY90(SDL_Surface *src, SDL_Surface *dst, int angle, i
 
 #undef TRANSFORM_SURFACE_90
 
+static Sint64 floorDiv(Sint64 a, Sint64 b)
+{
+    Sint64 q = a / b;
+    if ((a % b) != 0 && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return q;
+}
+
+/**
+Narrows the destination span [*x0, *x1) of a row to the pixels whose 16.16 source
+coordinate 'v + x * step' lies within [lo, hi], so the copy loops need no per-pixel
+bounds checks.
+*/
+static void clipSpan(int v, int step, Sint64 lo, Sint64 hi, int *x0, int *x1)
+{
+    Sint64 first, last;
+
+    if (step == 0) {
+        if (v < lo || v > hi) {
+            *x1 = *x0;
+        }
+        return;
+    }
+    if (step > 0) {
+        first = -floorDiv(v - lo, step);
+        last = floorDiv(hi - v, step);
+    } else {
+        first = -floorDiv(hi - v, -step);
+        last = floorDiv(v - lo, -step);
+    }
+    if (first > *x0) {
+        *x0 = (int)SDL_min(first, (Sint64)*x1);
+    }
+    if (last + 1 < *x1) {
+        *x1 = (int)SDL_max(last + 1, (Sint64)*x0);
+    }
+}
+
+/* Mirroring an integer part is the same as mirroring the whole 16.16 value:
+   sw - (v >> 16) == ((sw << 16) + 0xffff - v) >> 16 */
+#define TRANSFORM_SPAN(pixelType, srcPitch)                                            \
+    const Uint8 *pixels = (const Uint8 *)src->pixels;                                  \
+    const int pitch = srcPitch;                                                        \
+    pixelType *end4 = pc + (count & ~3), *end = pc + count;                            \
+    if (flipx) {                                                                       \
+        sdx = (((src->w - 1) << 16) | 0xffff) - sdx;                                   \
+        icos = -icos;                                                                  \
+    }                                                                                  \
+    if (flipy) {                                                                       \
+        sdy = (((src->h - 1) << 16) | 0xffff) - sdy;                                   \
+        isin = -isin;                                                                  \
+    }                                                                                  \
+    while (pc != end4) {                                                               \
+        const pixelType *s0 = (const pixelType *)(pixels + pitch * (sdy >> 16)) + (sdx >> 16); \
+        const pixelType *s1 = (const pixelType *)(pixels + pitch * ((sdy + isin) >> 16)) + ((sdx + icos) >> 16); \
+        const pixelType *s2 = (const pixelType *)(pixels + pitch * ((sdy + 2 * isin) >> 16)) + ((sdx + 2 * icos) >> 16); \
+        const pixelType *s3 = (const pixelType *)(pixels + pitch * ((sdy + 3 * isin) >> 16)) + ((sdx + 3 * icos) >> 16); \
+        pc[0] = *s0;                                                                   \
+        pc[1] = *s1;                                                                   \
+        pc[2] = *s2;                                                                   \
+        pc[3] = *s3;                                                                   \
+        sdx += 4 * icos;                                                               \
+        sdy += 4 * isin;                                                               \
+        pc += 4;                                                                       \
+    }                                                                                  \
+    while (pc != end) {                                                                \
+        *pc++ = *((const pixelType *)(pixels + pitch * (sdy >> 16)) + (sdx >> 16));    \
+        sdx += icos;                                                                   \
+        sdy += isin;                                                                   \
+    }
+
+// Copies 'count' nearest-neighbour pixels whose source coordinates are known to be in bounds.
+static void transformSpanRGBA(SDL_Surface *src, tColorRGBA *pc, int count, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    TRANSFORM_SPAN(tColorRGBA, src->pitch);
+}
+
+static void transformSpanY(SDL_Surface *src, tColorY *pc, int count, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    TRANSFORM_SPAN(tColorY, src->pitch);
+}
+
+#undef TRANSFORM_SPAN
+
 /**
 Internal 32 bit rotozoomer with optional anti-aliasing.
 
@@ -275,7 +384,6 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
     int cx, cy;
     tColorRGBA c00, c01, c10, c11, cswap;
     tColorRGBA *pc, *sp;
-    int gap;
     const int fp_half = (1 << 15);
 
     /*
@@ -283,8 +391,6 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
      */
     sw = src->w - 1;
     sh = src->h - 1;
-    pc = (tColorRGBA *)dst->pixels;
-    gap = dst->pitch - dst->w * 4;
     cx = (int)(center->x * 65536.0);
     cy = (int)(center->y * 65536.0);
 
@@ -292,14 +398,25 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
      * Switch between interpolating and non-interpolating code
      */
     if (smooth) {
+        /* The 2x2 neighbourhood must lie inside the source; flipping moves the
+           valid range of unflipped coordinates over by one pixel. */
+        const Sint64 xlo = flipx ? 0x10000 : 0;
+        const Sint64 xhi = ((Sint64)sw << 16) - 1 + xlo;
+        const Sint64 ylo = flipy ? 0x10000 : 0;
+        const Sint64 yhi = ((Sint64)sh << 16) - 1 + ylo;
         int y;
         for (y = 0; y < dst->h; y++) {
-            int x;
+            int x, x0 = 0, x1 = dst->w;
             double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
             double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
             int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
             int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
+            clipSpan(sdx, icos, xlo, xhi, &x0, &x1);
+            clipSpan(sdy, isin, ylo, yhi, &x0, &x1);
+            sdx += x0 * icos;
+            sdy += x0 * isin;
+            pc = (tColorRGBA *)((Uint8 *)dst->pixels + (ptrdiff_t)y * dst->pitch) + x0;
+            for (x = x0; x < x1; x++) {
                 int dx = (sdx >> 16);
                 int dy = (sdy >> 16);
                 if (flipx) {
@@ -308,82 +425,72 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
                 if (flipy) {
                     dy = sh - dy;
                 }
-                if ((dx > -1) && (dy > -1) && (dx < (src->w - 1)) && (dy < (src->h - 1))) {
-                    int ex, ey;
-                    int t1, t2;
-                    sp = (tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx;
-                    c00 = *sp;
-                    sp += 1;
-                    c01 = *sp;
-                    sp += (src->pitch / 4);
-                    c11 = *sp;
-                    sp -= 1;
-                    c10 = *sp;
-                    if (flipx) {
-                        cswap = c00;
-                        c00 = c01;
-                        c01 = cswap;
-                        cswap = c10;
-                        c10 = c11;
-                        c11 = cswap;
-                    }
-                    if (flipy) {
-                        cswap = c00;
-                        c00 = c10;
-                        c10 = cswap;
-                        cswap = c01;
-                        c01 = c11;
-                        c11 = cswap;
-                    }
-                    /*
-                     * Interpolate colors
-                     */
-                    ex = (sdx & 0xffff);
-                    ey = (sdy & 0xffff);
-                    t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
-                    t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
-                    pc->r = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
-                    t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
-                    pc->g = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
-                    t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
-                    pc->b = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
-                    t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
-                    pc->a = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
+                int ex, ey;
+                int t1, t2;
+                sp = (tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx;
+                c00 = *sp;
+                sp += 1;
+                c01 = *sp;
+                sp += (src->pitch / 4);
+                c11 = *sp;
+                sp -= 1;
+                c10 = *sp;
+                if (flipx) {
+                    cswap = c00;
+                    c00 = c01;
+                    c01 = cswap;
+                    cswap = c10;
+                    c10 = c11;
+                    c11 = cswap;
+                }
+                if (flipy) {
+                    cswap = c00;
+                    c00 = c10;
+                    c10 = cswap;
+                    cswap = c01;
+                    c01 = c11;
+                    c11 = cswap;
                 }
+                /*
+                 * Interpolate colors
+                 */
+                ex = (sdx & 0xffff);
+                ey = (sdy & 0xffff);
+                t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
+                t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
+                pc->r = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
+                t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
+                t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
+                pc->g = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
+                t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
+                t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
+                pc->b = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
+                t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
+                t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
+                pc->a = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
                 sdx += icos;
                 sdy += isin;
                 pc++;
             }
-            pc = (tColorRGBA *)((Uint8 *)pc + gap);
         }
     } else {
+        const Sint64 xhi = ((Sint64)src->w << 16) - 1;
+        const Sint64 yhi = ((Sint64)src->h << 16) - 1;
         int y;
         for (y = 0; y < dst->h; y++) {
-            int x;
+            int x0 = 0, x1 = dst->w;
             double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
             double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
             int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
             int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
-                int dx = (sdx >> 16);
-                int dy = (sdy >> 16);
-                if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                    if (flipx) {
-                        dx = sw - dx;
-                    }
-                    if (flipy) {
-                        dy = sh - dy;
-                    }
-                    *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
-                }
-                sdx += icos;
-                sdy += isin;
-                pc++;
+            clipSpan(sdx, icos, 0, xhi, &x0, &x1);
+            clipSpan(sdy, isin, 0, yhi, &x0, &x1);
+            if (x0 < x1) {
+                sdx += x0 * icos;
+                sdy += x0 * isin;
+                transformSpanRGBA(src, (tColorRGBA *)((Uint8 *)dst->pixels + (ptrdiff_t)y * dst->pitch) + x0,
+                                  x1 - x0, sdx, sdy, icos, isin, flipx, flipy);
             }
-            pc = (tColorRGBA *)((Uint8 *)pc + gap);
         }
     }
 }
@@ -410,20 +517,18 @@ static void transformSurfaceY(SDL_Surface *src, SDL_Surface *dst, int isin, int
                               const SDL_Rect *rect_dest,
                               const SDL_FPoint *center)
 {
-    int sw, sh;
+    Sint64 xhi, yhi;
     int cx, cy;
     tColorY *pc;
-    int gap;
     const int fp_half = (1 << 15);
     int y;
 
     /*
      * Variable setup
      */
-    sw = src->w - 1;
-    sh = src->h - 1;
+    xhi = ((Sint64)src->w << 16) - 1;
+    yhi = ((Sint64)src->h << 16) - 1;
     pc = (tColorY *)dst->pixels;
-    gap = dst->pitch - dst->w;
     cx = (int)(center->x * 65536.0);
     cy = (int)(center->y * 65536.0);
 
@@ -435,28 +540,18 @@ static void transformSurfaceY(SDL_Surface *src, SDL_Surface *dst, int isin, int
      * Iterate through destination surface
      */
     for (y = 0; y < dst->h; y++) {
-        int x;
+        int x0 = 0, x1 = dst->w;
         double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
         double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
         int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
         int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-        for (x = 0; x < dst->w; x++) {
-            int dx = (sdx >> 16);
-            int dy = (sdy >> 16);
-            if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                if (flipx) {
-                    dx = sw - dx;
-                }
-                if (flipy) {
-                    dy = sh - dy;
-                }
-                *pc = *((tColorY *)src->pixels + src->pitch * dy + dx);
-            }
-            sdx += icos;
-            sdy += isin;
-            pc++;
+        clipSpan(sdx, icos, 0, xhi, &x0, &x1);
+        clipSpan(sdy, isin, 0, yhi, &x0, &x1);
+        if (x0 < x1) {
+            sdx += x0 * icos;
+            sdy += x0 * isin;
+            transformSpanY(src, pc + (ptrdiff_t)y * dst->pitch + x0, x1 - x0, sdx, sdy, icos, isin, flipx, flipy);
         }
-        pc += gap;
     }
 }
 
@@ -519,13 +614,13 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     rz_dst = NULL;
     if (is8bit) {
         // Target surface is 8 bit
-        rz_dst = SDL_CreateSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
+        rz_dst = SDL_CreatePooledSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
         if (rz_dst) {
             SDL_SetSurfacePalette(rz_dst, src->palette);
         }
     } else {
         // Target surface is 32 bit with source RGBA ordering
-        rz_dst = SDL_CreateSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
+        rz_dst = SDL_CreatePooledSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
     }
 
     // Check target
@@ -164,60 +164,188 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
 
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
- * The cross product isn't computed from scratch at each iteration,
- * but optimized using constant step increments
+ * The edge functions are linear along a row, so each row solves them once
+ * for the span of pixels inside the triangle instead of testing every pixel
+ * of the bounding rect.
  *
+ * Colors and texture coordinates are stepped across the span as a quotient
+ * and remainder of the division by the area, giving the same results as
+ * dividing at each pixel.
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
+// Narrow [x_start, x_end) to the pixels where w + x * step + bias >= 0
+static SDL_INLINE void triangle_span(Sint64 w, int step, int bias, int *x_start, int *x_end)
+{
+    const Sint64 needed = -(Sint64)bias - w; // x * step must reach this
+
+    if (step > 0) {
+        if (needed > 0) {
+            const Sint64 first = (needed + step - 1) / step;
+            if (first > *x_start) {
+                *x_start = (int)SDL_min(first, (Sint64)*x_end);
+            }
+        }
+    } else if (step < 0) {
+        if (needed > 0) {
+            *x_end = *x_start;
+        } else {
+            const Sint64 last = needed / step;
+            if (last < *x_end - 1) {
+                *x_end = (int)last + 1;
+            }
+        }
+    } else if (needed > 0) {
+        *x_end = *x_start;
+    }
+}
+
+typedef struct TriangleInterp
+{
+    Sint64 quotient;
+    Sint64 remainder;
+    Sint64 step_quotient;
+    Sint64 step_remainder;
+} TriangleInterp;
+
+static SDL_INLINE void triangle_interp_init(TriangleInterp *interp, Sint64 numerator, Sint64 step, Sint64 area)
+{
+    // Floor division, so the remainder stays in [0, area)
+    interp->quotient = numerator / area;
+    interp->remainder = numerator % area;
+    if (interp->remainder < 0) {
+        interp->quotient -= 1;
+        interp->remainder += area;
+    }
+    interp->step_quotient = step / area;
+    interp->step_remainder = step % area;
+    if (interp->step_remainder < 0) {
+        interp->step_quotient -= 1;
+        interp->step_remainder += area;
+    }
+}
+
+// numerator / area, truncated toward zero
+static SDL_INLINE int triangle_interp_value(const TriangleInterp *interp)
+{
+    return (int)(interp->quotient + (interp->quotient < 0 && interp->remainder != 0));
+}
+
+static SDL_INLINE void triangle_interp_step(TriangleInterp *interp, Sint64 area)
+{
+    interp->quotient += interp->step_quotient;
+    interp->remainder += interp->step_remainder;
+    if (interp->remainder >= area) {
+        interp->remainder -= area;
+        interp->quotient += 1;
+    }
+}
+
+// Walks the span of each row, 'dptr' is the start of the span and 'span' its width
+#define TRIANGLE_BEGIN_SPANS                                            \
+    {                                                                   \
+        int y;                                                          \
+        for (y = 0; y < dstrect.h; y++) {                               \
+            int x_start = 0, x_end = dstrect.w;                         \
+            triangle_span(w0_row, d2d1_y, bias_w0, &x_start, &x_end);   \
+            triangle_span(w1_row, d0d2_y, bias_w1, &x_start, &x_end);   \
+            triangle_span(w2_row, d1d0_y, bias_w2, &x_start, &x_end);   \
+            if (x_start < x_end) {                                      \
+                Uint8 *dptr = (Uint8 *)dst_ptr + x_start * dstbpp;      \
+                const int span = x_end - x_start;
+
+#define TRIANGLE_END_SPANS \
+    }                      \
+    /* y += 1 */           \
+    w0_row += d1d2_x;      \
+    w1_row += d2d0_x;      \
+    w2_row += d0d1_x;      \
+    dst_ptr += dst_pitch;  \
+    }                      \
+    }
+
+/* Walks each pixel inside the triangle. SETUP runs at the start of each span,
+ * with the barycentric coordinates (w0, w1, w2) of its first pixel, and STEP
+ * moves the interpolated values one pixel to the right.
+ */
+#define TRIANGLE_BEGIN_LOOP(SETUP, STEP)                                                 \
+    {                                                                                    \
+        int x, y;                                                                        \
+        for (y = 0; y < dstrect.h; y++) {                                                \
+            int x_start = 0, x_end = dstrect.w;                                          \
+            triangle_span(w0_row, d2d1_y, bias_w0, &x_start, &x_end);                    \
+            triangle_span(w1_row, d0d2_y, bias_w1, &x_start, &x_end);                    \
+            triangle_span(w2_row, d1d0_y, bias_w2, &x_start, &x_end);                    \
+            if (x_start < x_end) {                                                       \
+                const Sint64 w0 = w0_row + (Sint64)x_start * d2d1_y;                     \
+                const Sint64 w1 = w1_row + (Sint64)x_start * d0d2_y;                     \
+                const Sint64 w2 = w2_row + (Sint64)x_start * d1d0_y;                     \
+                (void)w0;                                                                \
+                (void)w1;                                                                \
+                (void)w2;                                                                \
+                SETUP                                                                    \
+                for (x = x_start; x < x_end; x++, STEP) {                                \
                     Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
-// Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles
-#define TRIANGLE_GET_TEXTCOORD                                                          \
-    int srcx = (int)(((Sint64)w0 * s2s0_x + (Sint64)w1 * s2s1_x + s2_x_area.x) / area); \
-    int srcy = (int)(((Sint64)w0 * s2s0_y + (Sint64)w1 * s2s1_y + s2_x_area.y) / area); \
-    if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_WRAP) {                           \
-        srcx %= src_surface->w;                                                         \
-        if (srcx < 0) {                                                                 \
-            srcx += (src_surface->w - 1);                                               \
-        }                                                                               \
-    }                                                                                   \
-    if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_WRAP) {                           \
-        srcy %= src_surface->h;                                                         \
-        if (srcy < 0) {                                                                 \
-            srcy += (src_surface->h - 1);                                               \
-        }                                                                               \
-    }
-
-#define TRIANGLE_GET_MAPPED_COLOR                                                      \
-    Uint8 r = (Uint8)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    Uint8 g = (Uint8)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    Uint8 b = (Uint8)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    Uint8 a = (Uint8)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area); \
-    Uint32 color = SDL_MapRGBA(format, palette, r, g, b, a);
-
-#define TRIANGLE_GET_COLOR                                                             \
-    int r = (int)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    int g = (int)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    int b = (int)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    int a = (int)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area);
+#define TRIANGLE_SETUP_TEXTCOORD                                                                                      \
+    triangle_interp_init(&tex_x, w0 * s2s0_x + w1 * s2s1_x + s2_x_area.x, (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, area); \
+    triangle_interp_init(&tex_y, w0 * s2s0_y + w1 * s2s1_y + s2_x_area.y, (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, area);
+
+#define TRIANGLE_STEP_TEXTCOORD \
+    triangle_interp_step(&tex_x, area), triangle_interp_step(&tex_y, area)
+
+#define TRIANGLE_SETUP_COLOR                                                                                                              \
+    triangle_interp_init(&col_r, w0 * c0.r + w1 * c1.r + w2 * c2.r, (Sint64)d2d1_y * c0.r + (Sint64)d0d2_y * c1.r + (Sint64)d1d0_y * c2.r, area); \
+    triangle_interp_init(&col_g, w0 * c0.g + w1 * c1.g + w2 * c2.g, (Sint64)d2d1_y * c0.g + (Sint64)d0d2_y * c1.g + (Sint64)d1d0_y * c2.g, area); \
+    triangle_interp_init(&col_b, w0 * c0.b + w1 * c1.b + w2 * c2.b, (Sint64)d2d1_y * c0.b + (Sint64)d0d2_y * c1.b + (Sint64)d1d0_y * c2.b, area); \
+    triangle_interp_init(&col_a, w0 * c0.a + w1 * c1.a + w2 * c2.a, (Sint64)d2d1_y * c0.a + (Sint64)d0d2_y * c1.a + (Sint64)d1d0_y * c2.a, area);
+
+#define TRIANGLE_STEP_COLOR                                                                   \
+    triangle_interp_step(&col_r, area), triangle_interp_step(&col_g, area),                   \
+    triangle_interp_step(&col_b, area), triangle_interp_step(&col_a, area)
+
+#define TRIANGLE_SETUP_TEXTCOORD_COLOR \
+    TRIANGLE_SETUP_TEXTCOORD           \
+    TRIANGLE_SETUP_COLOR
+
+#define TRIANGLE_STEP_TEXTCOORD_COLOR \
+    TRIANGLE_STEP_TEXTCOORD, TRIANGLE_STEP_COLOR
+
+#define TRIANGLE_GET_TEXTCOORD                          \
+    int srcx = triangle_interp_value(&tex_x);           \
+    int srcy = triangle_interp_value(&tex_y);           \
+    if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_WRAP) { \
+        srcx %= src_surface->w;                         \
+        if (srcx < 0) {                                 \
+            srcx += (src_surface->w - 1);               \
+        }                                               \
+    }                                                   \
+    if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_WRAP) { \
+        srcy %= src_surface->h;                         \
+        if (srcy < 0) {                                 \
+            srcy += (src_surface->h - 1);               \
+        }                                               \
+    }
+
+#define TRIANGLE_GET_MAPPED_COLOR                         \
+    Uint8 r = (Uint8)triangle_interp_value(&col_r);       \
+    Uint8 g = (Uint8)triangle_interp_value(&col_g);       \
+    Uint8 b = (Uint8)triangle_interp_value(&col_b);       \
+    Uint8 a = (Uint8)triangle_interp_value(&col_a);       \
+    Uint32 color = direct_map ?                           \
+        (((Uint32)(r >> (8 - format->Rbits)) << format->Rshift) | \
+         ((Uint32)(g >> (8 - format->Gbits)) << format->Gshift) | \
+         ((Uint32)(b >> (8 - format->Bbits)) << format->Bshift) | \
+         (((Uint32)(a >> (8 - format->Abits)) << format->Ashift) & format->Amask)) : \
+        SDL_MapRGBA(format, palette, r, g, b, a);
+
+#define TRIANGLE_GET_COLOR                        \
+    int r = triangle_interp_value(&col_r);        \
+    int g = triangle_interp_value(&col_g);        \
+    int b = triangle_interp_value(&col_b);        \
+    int a = triangle_interp_value(&col_a);
 
 #define TRIANGLE_END_LOOP \
     }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
     }                     \
     /* y += 1 */          \
     w0_row += d1d2_x;     \
@@ -300,7 +428,7 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
         }
 
         // Use an intermediate surface
-        tmp = SDL_CreateSurface(dstrect.w, dstrect.h, format);
+        tmp = SDL_CreatePooledSurface(dstrect.w, dstrect.h, format);
         if (!tmp) {
             result = false;
             goto end;
@@ -379,36 +507,45 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
         }
 
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPANS
             {
-                *(Uint32 *)dptr = color;
+                SDL_memset4(dptr, color, span);
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPANS
         } else if (dstbpp == 3) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPANS
             {
                 Uint8 *s = (Uint8 *)&color;
-                dptr[0] = s[0];
-                dptr[1] = s[1];
-                dptr[2] = s[2];
+                int x;
+                for (x = 0; x < span; x++, dptr += 3) {
+                    dptr[0] = s[0];
+                    dptr[1] = s[1];
+                    dptr[2] = s[2];
+                }
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPANS
         } else if (dstbpp == 2) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPANS
             {
-                *(Uint16 *)dptr = (Uint16)color;
+                Uint16 *p = (Uint16 *)dptr;
+                int x;
+                for (x = 0; x < span; x++) {
+                    p[x] = (Uint16)color;
+                }
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPANS
         } else if (dstbpp == 1) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPANS
             {
-                *dptr = (Uint8)color;
+                SDL_memset(dptr, (Uint8)color, span);
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPANS
         }
     } else {
         const SDL_PixelFormatDetails *format;
         SDL_Palette *palette;
+        TriangleInterp col_r, col_g, col_b, col_a;
+        bool direct_map;
         if (tmp) {
             format = tmp->fmt;
             palette = tmp->palette;
@@ -416,15 +553,17 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             format = dst->fmt;
             palette = dst->palette;
         }
+        // Pack the color here unless SDL_MapRGBA() needs a palette lookup or 10-bit expansion
+        direct_map = !SDL_ISPIXELFORMAT_INDEXED(format->format) && !SDL_ISPIXELFORMAT_10BIT(format->format);
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_COLOR, TRIANGLE_STEP_COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint32 *)dptr = color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 3) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_COLOR, TRIANGLE_STEP_COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 Uint8 *s = (Uint8 *)&color;
@@ -434,14 +573,14 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 2) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_COLOR, TRIANGLE_STEP_COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint16 *)dptr = (Uint16)color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 1) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_COLOR, TRIANGLE_STEP_COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *dptr = (Uint8)color;
@@ -463,6 +602,110 @@ end:
     return result;
 }
 
+bool SDL_SW_GetQuadRect(const SDL_Point *a0, const SDL_Point *a1, const SDL_Point *a2,
+                        const SDL_Point *b0, const SDL_Point *b1, const SDL_Point *b2, SDL_Rect *rect)
+{
+    const SDL_Point *points[6];
+    int min_x, max_x, min_y, max_y;
+    int corners_a = 0, corners_b = 0;
+    int missing_a, missing_b;
+    int i;
+
+    points[0] = a0;
+    points[1] = a1;
+    points[2] = a2;
+    points[3] = b0;
+    points[4] = b1;
+    points[5] = b2;
+
+    min_x = max_x = a0->x;
+    min_y = max_y = a0->y;
+    for (i = 1; i < 6; i++) {
+        min_x = SDL_min(min_x, points[i]->x);
+        max_x = SDL_max(max_x, points[i]->x);
+        min_y = SDL_min(min_y, points[i]->y);
+        max_y = SDL_max(max_y, points[i]->y);
+    }
+
+    // The edges must lie between pixel centers for the quad to cover whole pixels
+    if (min_x == max_x || min_y == max_y ||
+        ((min_x | max_x | min_y | max_y) & ((1 << FP_BITS) - 1))) {
+        return false;
+    }
+
+    for (i = 0; i < 6; i++) {
+        const SDL_Point *p = points[i];
+        int corner;
+
+        if ((p->x != min_x && p->x != max_x) || (p->y != min_y && p->y != max_y)) {
+            return false;
+        }
+        corner = (p->x == max_x ? 1 : 0) | (p->y == max_y ? 2 : 0);
+        if (i < 3) {
+            corners_a |= (1 << corner);
+        } else {
+            corners_b |= (1 << corner);
+        }
+    }
+
+    // Each triangle leaves out one corner, and they leave out opposite corners, splitting the quad along a diagonal
+    missing_a = ~corners_a & 0xF;
+    missing_b = ~corners_b & 0xF;
+    if (!((missing_a == 0x1 && missing_b == 0x8) || (missing_a == 0x8 && missing_b == 0x1) ||
+          (missing_a == 0x2 && missing_b == 0x4) || (missing_a == 0x4 && missing_b == 0x2))) {
+        return false;
+    }
+
+    rect->x = min_x >> FP_BITS;
+    rect->y = min_y >> FP_BITS;
+    rect->w = (max_x - min_x) >> FP_BITS;
+    rect->h = (max_y - min_y) >> FP_BITS;
+    return true;
+}
+
+bool SDL_SW_FillQuad(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blend, SDL_Color color)
+{
+    bool result = true;
+    SDL_Rect dstrect, cliprect;
+
+    if (!SDL_SurfaceValid(dst)) {
+        return false;
+    }
+
+    // Clip the same way as SDL_SW_FillTriangle()
+    cliprect.x = 0;
+    cliprect.y = 0;
+    cliprect.w = dst->w;
+    cliprect.h = dst->h;
+    SDL_GetRectIntersection(rect, &cliprect, &dstrect);
+    SDL_GetSurfaceClipRect(dst, &cliprect);
+    if (!SDL_GetRectIntersection(&dstrect, &cliprect, &dstrect)) {
+        return true;
+    }
+
+    if (blend == SDL_BLENDMODE_NONE) {
+        result = SDL_FillSurfaceRect(dst, &dstrect, SDL_MapSurfaceRGBA(dst, color.r, color.g, color.b, color.a));
+    } else {
+        SDL_PixelFormat format = dst->format;
+        SDL_Surface *tmp;
+
+        // need an alpha format
+        if (!SDL_ISPIXELFORMAT_ALPHA(format)) {
+            format = SDL_PIXELFORMAT_ARGB8888;
+        }
+
+        tmp = SDL_CreatePooledSurface(dstrect.w, dstrect.h, format);
+        if (!tmp) {
+            return false;
+        }
+        SDL_FillSurfaceRect(tmp, NULL, SDL_MapSurfaceRGBA(tmp, color.r, color.g, color.b, color.a));
+        SDL_SetSurfaceBlendMode(tmp, blend);
+        result = SDL_BlitSurface(tmp, NULL, dst, &dstrect);
+        SDL_DestroySurface(tmp);
+    }
+    return result;
+}
+
 bool SDL_SW_BlitTriangle(
     SDL_Surface *src,
     SDL_Point *s0, SDL_Point *s1, SDL_Point *s2,
@@ -503,6 +746,8 @@ bool SDL_SW_BlitTriangle(
 
     bool has_modulation;
 
+    TriangleInterp tex_x, tex_y;
+
     if (!SDL_SurfaceValid(src)) {
         return SDL_InvalidParamError("src");
     }
@@ -731,7 +976,7 @@ bool SDL_SW_BlitTriangle(
     }
 
     if (dstbpp == 4) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_TEXTCOORD, TRIANGLE_STEP_TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint32 *sptr = (Uint32 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -739,7 +984,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 3) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_TEXTCOORD, TRIANGLE_STEP_TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -749,7 +994,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 2) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_TEXTCOORD, TRIANGLE_STEP_TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint16 *sptr = (Uint16 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -757,7 +1002,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 1) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_TEXTCOORD, TRIANGLE_STEP_TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -823,10 +1068,13 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     Uint8 *dst_ptr = info->dst;
     int dst_pitch = info->dst_pitch;
 
+    TriangleInterp tex_x, tex_y;
+    TriangleInterp col_r, col_g, col_b, col_a;
+
     srcfmt_val = detect_format(src_fmt);
     dstfmt_val = detect_format(dst_fmt);
 
-    TRIANGLE_BEGIN_LOOP
+    TRIANGLE_BEGIN_LOOP(TRIANGLE_SETUP_TEXTCOORD_COLOR, TRIANGLE_STEP_TEXTCOORD_COLOR)
     {
         Uint8 *src;
         Uint8 *dst = dptr;
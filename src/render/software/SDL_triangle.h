@@ -36,6 +36,13 @@ extern bool SDL_SW_BlitTriangle(SDL_Surface *src,
                                 SDL_TextureAddressMode texture_address_mode_u,
                                 SDL_TextureAddressMode texture_address_mode_v);
 
+// Checks whether two triangles exactly cover an axis aligned rect, returned in pixels
+extern bool SDL_SW_GetQuadRect(const SDL_Point *a0, const SDL_Point *a1, const SDL_Point *a2,
+                               const SDL_Point *b0, const SDL_Point *b1, const SDL_Point *b2, SDL_Rect *rect);
+
+// Draws the same pixels as filling the two triangles of the quad with a uniform color
+extern bool SDL_SW_FillQuad(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blend, SDL_Color color);
+
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
 
 #endif // SDL_triangle_h_
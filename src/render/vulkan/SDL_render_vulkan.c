@@ -2772,18 +2772,10 @@ static bool VULKAN_UpdateTextureInternal(VULKAN_RenderData *rendererData, VkImag
 
     src = (const Uint8 *)pixels;
     dst = (Uint8 *)uploadBuffer->mappedBufferPtr;
-    if (length == (VkDeviceSize)pitch) {
-        SDL_memcpy(dst, src, (size_t)length * h);
-    } else {
-        if (length > (VkDeviceSize)pitch) {
-            length = pitch;
-        }
-        for (VkDeviceSize row = h; row--;) {
-            SDL_memcpy(dst, src, (size_t)length);
-            src += pitch;
-            dst += length;
-        }
+    if (length > (VkDeviceSize)pitch) {
+        length = pitch;
     }
+    SDL_memcpy_rows(dst, (size_t)length, src, pitch, (size_t)length, h);
 
     // Make sure the destination is in the correct resource state
     VULKAN_RecordPipelineImageBarrier(rendererData,
@@ -3562,13 +3554,13 @@ static bool VULKAN_SetDrawState(SDL_Renderer *renderer, const SDL_RenderCommand
     }
 
     // See if we need to change the pipeline state
-    if (!rendererData->currentPipelineState ||
-        rendererData->currentPipelineState->shader != shader ||
-        rendererData->currentPipelineState->blendMode != blendMode ||
-        rendererData->currentPipelineState->topology != topology ||
-        rendererData->currentPipelineState->format != format ||
-        rendererData->currentPipelineState->pipelineLayout != pipelineLayout ||
-        rendererData->currentPipelineState->descriptorSetLayout != descriptorSetLayout) {
+    if (SDL_CountRenderStateChange(renderer, !rendererData->currentPipelineState ||
+                                                 rendererData->currentPipelineState->shader != shader ||
+                                                 rendererData->currentPipelineState->blendMode != blendMode ||
+                                                 rendererData->currentPipelineState->topology != topology ||
+                                                 rendererData->currentPipelineState->format != format ||
+                                                 rendererData->currentPipelineState->pipelineLayout != pipelineLayout ||
+                                                 rendererData->currentPipelineState->descriptorSetLayout != descriptorSetLayout)) {
 
         rendererData->currentPipelineState = NULL;
         for (i = 0; i < rendererData->pipelineStateCount; ++i) {
@@ -3770,6 +3762,7 @@ static void VULKAN_DrawPrimitives(SDL_Renderer *renderer, VkPrimitiveTopology pr
 {
     VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
     vkCmdDraw(rendererData->currentCommandBuffer, (uint32_t)vertexCount, 1, (uint32_t)vertexStart, 0);
+    ++renderer->stats.draw_calls;
 }
 
 static void VULKAN_InvalidateCachedState(SDL_Renderer *renderer)
@@ -3910,6 +3903,12 @@ static bool VULKAN_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cm
             break;
         }
 
+        case SDL_RENDERCMD_TEXTURE_BATCH: // unused
+            break;
+
+        case SDL_RENDERCMD_LINE_BATCH: // unused
+            break;
+
         case SDL_RENDERCMD_NO_OP:
             break;
         }
@@ -57,6 +57,16 @@ static int SDL_sensors_locked;
 static bool SDL_sensors_initialized;
 static SDL_Sensor *SDL_sensors SDL_GUARDED_BY(SDL_sensor_lock) = NULL;
 
+// Enough for more than 100 ms of readings from a 2 kHz sensor
+#define SDL_SENSOR_SAMPLE_RING_SIZE 256
+
+struct SDL_SensorSampleRing
+{
+    int head;  // The next slot to fill
+    int count; // The number of readings waiting to be retrieved
+    SDL_SensorSample samples[SDL_SENSOR_SAMPLE_RING_SIZE];
+};
+
 #define CHECK_SENSOR_MAGIC(sensor, result)                  \
     if (!SDL_ObjectValid(sensor, SDL_OBJECT_TYPE_SENSOR)) { \
         SDL_InvalidParamError("sensor");                    \
@@ -486,6 +496,26 @@ bool SDL_GetSensorData(SDL_Sensor *sensor, float *data, int num_values)
     return true;
 }
 
+int SDL_GetSensorSamples(SDL_Sensor *sensor, SDL_SensorSample *samples, int num_samples)
+{
+    int result;
+
+    if (!samples && num_samples > 0) {
+        SDL_InvalidParamError("samples");
+        return -1;
+    }
+
+    SDL_LockSensors();
+    {
+        CHECK_SENSOR_MAGIC(sensor, -1);
+
+        result = SDL_PopSensorSamples(&sensor->samples, samples, num_samples);
+    }
+    SDL_UnlockSensors();
+
+    return result;
+}
+
 /*
  * Close a sensor previously opened with SDL_OpenSensor()
  */
@@ -528,6 +558,7 @@ void SDL_CloseSensor(SDL_Sensor *sensor)
 
         // Free the data associated with this sensor
         SDL_free(sensor->name);
+        SDL_free(sensor->samples);
         SDL_free(sensor);
     }
     SDL_UnlockSensors();
@@ -559,6 +590,53 @@ void SDL_QuitSensors(void)
 
 // These are global for SDL_syssensor.c and SDL_events.c
 
+void SDL_PushSensorSample(SDL_SensorSampleRing *ring, Uint64 timestamp, Uint64 sensor_timestamp, const float *data, int num_values)
+{
+    SDL_SensorSample *sample;
+
+    if (!ring) {
+        return;
+    }
+
+    // When the ring is full, the oldest reading is overwritten
+    sample = &ring->samples[ring->head];
+    sample->timestamp = timestamp;
+    sample->sensor_timestamp = sensor_timestamp;
+    num_values = SDL_min(num_values, SDL_arraysize(sample->data));
+    SDL_memset(sample->data, 0, sizeof(sample->data));
+    SDL_memcpy(sample->data, data, num_values * sizeof(*data));
+    ring->head = (ring->head + 1) % SDL_SENSOR_SAMPLE_RING_SIZE;
+    if (ring->count < SDL_SENSOR_SAMPLE_RING_SIZE) {
+        ++ring->count;
+    }
+}
+
+int SDL_PopSensorSamples(SDL_SensorSampleRing **ring, SDL_SensorSample *samples, int num_samples)
+{
+    SDL_SensorSampleRing *r = *ring;
+    int tail, count;
+
+    if (!r) {
+        r = (SDL_SensorSampleRing *)SDL_calloc(1, sizeof(*r));
+        if (!r) {
+            return -1;
+        }
+        *ring = r;
+        return 0;
+    }
+
+    count = SDL_min(num_samples, r->count);
+    tail = (r->head - r->count + SDL_SENSOR_SAMPLE_RING_SIZE) % SDL_SENSOR_SAMPLE_RING_SIZE;
+    if (count > 0) {
+        // Copy in at most two pieces, split where the ring wraps around
+        const int first = SDL_min(count, SDL_SENSOR_SAMPLE_RING_SIZE - tail);
+        SDL_memcpy(samples, &r->samples[tail], first * sizeof(*samples));
+        SDL_memcpy(samples + first, r->samples, (count - first) * sizeof(*samples));
+        r->count -= count;
+    }
+    return count;
+}
+
 void SDL_SendSensorUpdate(Uint64 timestamp, SDL_Sensor *sensor, Uint64 sensor_timestamp, float *data, int num_values)
 {
     SDL_AssertSensorsLocked();
@@ -569,6 +647,8 @@ void SDL_SendSensorUpdate(Uint64 timestamp, SDL_Sensor *sensor, Uint64 sensor_ti
     num_values = SDL_min(num_values, SDL_arraysize(sensor->data));
     SDL_memcpy(sensor->data, data, num_values * sizeof(*data));
 
+    SDL_PushSensorSample(sensor->samples, timestamp, sensor_timestamp, data, num_values);
+
     // Post the event, if desired
     if (SDL_EventEnabled(SDL_EVENT_SENSOR_UPDATE)) {
         SDL_Event event;
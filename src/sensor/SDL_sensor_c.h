@@ -56,4 +56,13 @@ extern void SDL_UpdateSensor(SDL_Sensor *sensor);
 // Internal event queueing functions
 extern void SDL_SendSensorUpdate(Uint64 timestamp, SDL_Sensor *sensor, Uint64 sensor_timestamp, float *data, int num_values);
 
+// A ring of recent readings, allocated the first time the application asks for them
+typedef struct SDL_SensorSampleRing SDL_SensorSampleRing;
+
+// Add a reading to the ring, if the application has asked for readings
+extern void SDL_PushSensorSample(SDL_SensorSampleRing *ring, Uint64 timestamp, Uint64 sensor_timestamp, const float *data, int num_values);
+
+// Remove the oldest readings from the ring, creating it if needed
+extern int SDL_PopSensorSamples(SDL_SensorSampleRing **ring, SDL_SensorSample *samples, int num_samples);
+
 #endif // SDL_sensor_c_h_
@@ -38,6 +38,7 @@ struct SDL_Sensor
     int non_portable_type _guarded;      // Platform dependent type of the sensor
 
     float data[16] _guarded;             // The current state of the sensor
+    SDL_SensorSampleRing *samples _guarded; // Readings since the last SDL_GetSensorSamples()
 
     struct SDL_SensorDriver *driver _guarded;
 
@@ -0,0 +1,228 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#define SDL_ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define SDL_ARENA_DEFAULT_ALIGNMENT  16
+#define SDL_ARENA_CHUNK_HEADER       ((sizeof(SDL_ArenaChunk) + (SDL_ARENA_DEFAULT_ALIGNMENT - 1)) & ~(size_t)(SDL_ARENA_DEFAULT_ALIGNMENT - 1))
+
+/* Every byte handed out has a position, counting up from the start of the
+   arena. A chunk starts at the position where the previous chunk stopped
+   being used, so a position is enough to find the chunk and offset it was
+   in, which is all a mark needs. */
+typedef struct SDL_ArenaChunk
+{
+    struct SDL_ArenaChunk *next;  // the previous chunk in use, or the next spare chunk
+    size_t size;
+    size_t used;
+    SDL_ArenaMark base;
+} SDL_ArenaChunk;
+
+struct SDL_Arena
+{
+    SDL_Mutex *lock;          // NULL if the arena isn't thread-safe
+    size_t chunk_size;
+    SDL_ArenaChunk *current;  // the chunk being allocated from, linked to the ones before it
+    SDL_ArenaChunk *spare;    // chunks released by a reset, kept for reuse
+#ifdef SDL_MEMORY_STATS
+    int tag;                  // the SDL_MemoryTag chunks are counted under, or -1
+#endif
+};
+
+static void *AllocateFromChunk(SDL_ArenaChunk *chunk, size_t size, size_t alignment)
+{
+    Uint8 *data = (Uint8 *)chunk + SDL_ARENA_CHUNK_HEADER;
+    const size_t padding = (size_t)(0 - (uintptr_t)(data + chunk->used)) & (alignment - 1);
+    const size_t available = chunk->size - chunk->used;
+    void *result;
+
+    if (available < padding || available - padding < size) {
+        return NULL;
+    }
+    result = data + chunk->used + padding;
+    chunk->used += padding + size;
+    return result;
+}
+
+static SDL_ArenaChunk *GetArenaChunk(SDL_Arena *arena, size_t needed)
+{
+    SDL_ArenaChunk **prev, *chunk;
+
+    // Reuse a spare chunk if one is big enough
+    for (prev = &arena->spare; *prev; prev = &(*prev)->next) {
+        if ((*prev)->size >= needed) {
+            chunk = *prev;
+            *prev = chunk->next;
+            return chunk;
+        }
+    }
+
+    needed = SDL_max(needed, arena->chunk_size);
+    if (needed > SDL_SIZE_MAX - SDL_ARENA_CHUNK_HEADER) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    chunk = (SDL_ArenaChunk *)SDL_malloc(SDL_ARENA_CHUNK_HEADER + needed);
+    if (!chunk) {
+        return NULL;
+    }
+    chunk->size = needed;
+#ifdef SDL_MEMORY_STATS
+    if (arena->tag >= 0) {
+        SDL_AddTaggedMemory((SDL_MemoryTag)arena->tag, SDL_ARENA_CHUNK_HEADER + needed);
+    }
+#endif
+    return chunk;
+}
+
+static void FreeArenaChunks(SDL_Arena *arena, SDL_ArenaChunk *chunk)
+{
+    while (chunk) {
+        SDL_ArenaChunk *next = chunk->next;
+#ifdef SDL_MEMORY_STATS
+        if (arena->tag >= 0) {
+            SDL_RemoveTaggedMemory((SDL_MemoryTag)arena->tag, SDL_ARENA_CHUNK_HEADER + chunk->size);
+        }
+#endif
+        SDL_free(chunk);
+        chunk = next;
+    }
+}
+
+SDL_Arena *SDL_CreateArena(size_t chunk_size, bool threadsafe)
+{
+    SDL_Arena *arena = (SDL_Arena *)SDL_calloc(1, sizeof(*arena));
+    if (!arena) {
+        return NULL;
+    }
+
+    if (threadsafe) {
+        arena->lock = SDL_CreateMutex();
+        if (!arena->lock) {
+            SDL_free(arena);
+            return NULL;
+        }
+    }
+    arena->chunk_size = chunk_size ? chunk_size : SDL_ARENA_DEFAULT_CHUNK_SIZE;
+#ifdef SDL_MEMORY_STATS
+    arena->tag = -1;
+#endif
+    return arena;
+}
+
+#ifdef SDL_MEMORY_STATS
+void SDL_SetArenaMemoryTag(SDL_Arena *arena, SDL_MemoryTag tag)
+{
+    // Chunks allocated before this wouldn't be counted, so tag the arena first
+    SDL_assert(!arena->current && !arena->spare);
+    arena->tag = (int)tag;
+}
+#endif
+
+void *SDL_AllocateArenaMemory(SDL_Arena *arena, size_t size, size_t alignment)
+{
+    SDL_ArenaChunk *chunk;
+    void *result = NULL;
+
+    if (!arena) {
+        SDL_InvalidParamError("arena");
+        return NULL;
+    }
+    if (alignment == 0) {
+        alignment = SDL_ARENA_DEFAULT_ALIGNMENT;
+    } else if ((alignment & (alignment - 1)) != 0) {
+        SDL_InvalidParamError("alignment");
+        return NULL;
+    }
+
+    SDL_LockMutex(arena->lock);
+    if (arena->current) {
+        result = AllocateFromChunk(arena->current, size, alignment);
+    }
+    if (!result) {
+        if (size > SDL_SIZE_MAX - (alignment - 1)) {
+            SDL_OutOfMemory();
+        } else {
+            chunk = GetArenaChunk(arena, size + (alignment - 1));
+            if (chunk) {
+                chunk->used = 0;
+                chunk->base = arena->current ? (arena->current->base + arena->current->used) : 0;
+                chunk->next = arena->current;
+                arena->current = chunk;
+                result = AllocateFromChunk(chunk, size, alignment);
+            }
+        }
+    }
+    SDL_UnlockMutex(arena->lock);
+
+    return result;
+}
+
+SDL_ArenaMark SDL_GetArenaMark(SDL_Arena *arena)
+{
+    SDL_ArenaMark mark = 0;
+
+    if (arena) {
+        SDL_LockMutex(arena->lock);
+        if (arena->current) {
+            mark = arena->current->base + arena->current->used;
+        }
+        SDL_UnlockMutex(arena->lock);
+    }
+    return mark;
+}
+
+void SDL_ResetArenaToMark(SDL_Arena *arena, SDL_ArenaMark mark)
+{
+    SDL_ArenaChunk *chunk;
+
+    if (!arena) {
+        return;
+    }
+
+    SDL_LockMutex(arena->lock);
+    while (arena->current && arena->current->base > mark) {
+        chunk = arena->current;
+        arena->current = chunk->next;
+        chunk->next = arena->spare;
+        arena->spare = chunk;
+    }
+    chunk = arena->current;
+    if (chunk && mark - chunk->base < chunk->used) {
+        chunk->used = (size_t)(mark - chunk->base);
+    }
+    SDL_UnlockMutex(arena->lock);
+}
+
+void SDL_ResetArena(SDL_Arena *arena)
+{
+    SDL_ResetArenaToMark(arena, 0);
+}
+
+void SDL_DestroyArena(SDL_Arena *arena)
+{
+    if (arena) {
+        FreeArenaChunks(arena, arena->current);
+        FreeArenaChunks(arena, arena->spare);
+        SDL_DestroyMutex(arena->lock);
+        SDL_free(arena);
+    }
+}
@@ -30,6 +30,9 @@
    There is code that relies on this in the joystick code
 */
 
+static Uint16 crc16_table[256];
+static SDL_InitState crc16_init;
+
 static Uint16 crc16_for_byte(Uint8 r)
 {
     Uint16 crc = 0;
@@ -43,10 +46,18 @@ static Uint16 crc16_for_byte(Uint8 r)
 
 Uint16 SDL_crc16(Uint16 crc, const void *data, size_t len)
 {
-    // As an optimization we can precalculate a 256 entry table for each byte
+    const Uint8 *bytes = (const Uint8 *)data;
     size_t i;
+
+    if (SDL_ShouldInit(&crc16_init)) {
+        for (i = 0; i < SDL_arraysize(crc16_table); ++i) {
+            crc16_table[i] = crc16_for_byte((Uint8)i);
+        }
+        SDL_SetInitialized(&crc16_init, true);
+    }
+
     for (i = 0; i < len; ++i) {
-        crc = crc16_for_byte((Uint8)crc ^ ((const Uint8 *)data)[i]) ^ crc >> 8;
+        crc = crc16_table[(Uint8)crc ^ bytes[i]] ^ crc >> 8;
     }
     return crc;
 }
@@ -20,31 +20,240 @@
 */
 #include "SDL_internal.h"
 
-/* Public domain CRC implementation adapted from:
-   http://home.thep.lu.se/~bjorn/crc/crc32_simple.c
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
-   This algorithm is compatible with the 32-bit CRC described here:
+/* This is the standard reflected CRC-32 (polynomial 0xEDB88320), as used by
+   zlib and described here:
    https://www.lammertbies.nl/comm/info/crc-calculation
+
+   NOTE: DO NOT CHANGE THE RESULTS OF THIS FUNCTION
+   There is code that relies on this in the joystick code. The fast paths
+   below all have to give exactly the same answer as the byte at a time
+   version did.
 */
-/* NOTE: DO NOT CHANGE THIS ALGORITHM
-   There is code that relies on this in the joystick code
-*/
 
-static Uint32 crc32_for_byte(Uint32 r)
+#define CRC32_POLY 0xEDB88320
+
+/* Slice-by-8 tables: crc32_table[0] is the usual byte table, and
+   crc32_table[n][i] is the CRC of byte i followed by n zero bytes, so eight
+   bytes can be folded in with eight independent lookups. */
+static Uint32 crc32_table[8][256];
+static SDL_InitState crc32_init;
+
+static void CRC32_InitTables(void)
 {
-    int i;
-    for (i = 0; i < 8; ++i) {
-        r = (r & 1 ? 0 : (Uint32)0xEDB88320L) ^ r >> 1;
+    Uint32 i, j, r;
+
+    for (i = 0; i < 256; ++i) {
+        r = i;
+        for (j = 0; j < 8; ++j) {
+            r = (r & 1) ? ((r >> 1) ^ CRC32_POLY) : (r >> 1);
+        }
+        crc32_table[0][i] = r;
+    }
+    for (i = 0; i < 256; ++i) {
+        r = crc32_table[0][i];
+        for (j = 1; j < 8; ++j) {
+            r = crc32_table[0][r & 0xFF] ^ (r >> 8);
+            crc32_table[j][i] = r;
+        }
     }
-    return r ^ (Uint32)0xFF000000L;
 }
 
-Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+// These work on the inverted CRC, which is what the CRC registers hold between bytes
+static Uint32 CRC32_Bytes(Uint32 crc, const Uint8 *data, size_t len)
+{
+    while (len--) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static Uint32 CRC32_SliceBy8(Uint32 crc, const Uint8 *data, size_t len)
+{
+    // Get to a 4-byte boundary, so the 32-bit loads below are aligned
+    while (len && ((uintptr_t)data & 3)) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        --len;
+    }
+
+    while (len >= 8) {
+        const Uint32 a = SDL_Swap32LE(*(const Uint32 *)data) ^ crc;
+        const Uint32 b = SDL_Swap32LE(*(const Uint32 *)(data + 4));
+        crc = crc32_table[7][a & 0xFF] ^
+              crc32_table[6][(a >> 8) & 0xFF] ^
+              crc32_table[5][(a >> 16) & 0xFF] ^
+              crc32_table[4][a >> 24] ^
+              crc32_table[3][b & 0xFF] ^
+              crc32_table[2][(b >> 8) & 0xFF] ^
+              crc32_table[1][(b >> 16) & 0xFF] ^
+              crc32_table[0][b >> 24];
+        data += 8;
+        len -= 8;
+    }
+
+    return CRC32_Bytes(crc, data, len);
+}
+
+#if defined(SDL_SSE4_1_INTRINSICS) && (defined(_MSC_VER) || defined(__PCLMUL__) || defined(SDL_HAS_TARGET_ATTRIBS)) && !defined(_M_ARM64EC)
+#define SDL_CRC32_CLMUL
+#ifndef _MSC_VER
+#include <wmmintrin.h>
+#endif
+
+/* Carry-less multiplication folding, from "Fast CRC Computation for Generic
+   Polynomials Using PCLMULQDQ Instruction" by Gopal, Ozturk, Guilford, et al.
+   The data is folded 64 bytes at a time into four 128-bit lanes, which are
+   folded together and Barrett reduced to 32 bits at the end. The constants
+   are the ones from the paper for the reflected CRC-32 polynomial.
+
+   This needs at least 64 bytes and handles a multiple of 16 bytes. */
+static Uint32 SDL_TARGETING("pclmul,sse4.1") CRC32_CLMUL(Uint32 crc, const Uint8 *data, size_t len)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    data += 64;
+    len -= 64;
+
+    // Fold 64 bytes at a time
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(data + 0x30)));
+        data += 64;
+        len -= 64;
+    }
+
+    // Fold the four lanes into one
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold in what's left, 16 bytes at a time
+    while (len >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)data)), x5);
+        data += 16;
+        len -= 16;
+    }
+
+    // Fold 128 bits down to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduce to 32 bits
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (Uint32)_mm_extract_epi32(x1, 1);
+}
+#endif // SDL_CRC32_CLMUL
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define SDL_CRC32_ARM
+#include <arm_acle.h>
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+// The intrinsics are always available, SDL_HasARMCRC32() checks the CPU
+#define SDL_CRC32_ARM
+#endif
+
+#ifdef SDL_CRC32_ARM
+static Uint32 CRC32_ARM(Uint32 crc, const Uint8 *data, size_t len)
 {
-    // As an optimization we can precalculate a 256 entry table for each byte
-    size_t i;
-    for (i = 0; i < len; ++i) {
-        crc = crc32_for_byte((Uint8)crc ^ ((const Uint8 *)data)[i]) ^ crc >> 8;
+    while (len && ((uintptr_t)data & 7)) {
+        crc = __crc32b(crc, *data++);
+        --len;
+    }
+    while (len >= 32) {
+        crc = __crc32d(crc, *(const Uint64 *)(data + 0));
+        crc = __crc32d(crc, *(const Uint64 *)(data + 8));
+        crc = __crc32d(crc, *(const Uint64 *)(data + 16));
+        crc = __crc32d(crc, *(const Uint64 *)(data + 24));
+        data += 32;
+        len -= 32;
+    }
+    while (len >= 8) {
+        crc = __crc32d(crc, *(const Uint64 *)data);
+        data += 8;
+        len -= 8;
+    }
+    while (len--) {
+        crc = __crc32b(crc, *data++);
     }
     return crc;
 }
+#endif // SDL_CRC32_ARM
+
+typedef Uint32 (*SDL_CRC32Func)(Uint32 crc, const Uint8 *data, size_t len);
+
+static SDL_CRC32Func crc32_func;
+static bool crc32_clmul;
+
+static void CRC32_Init(void)
+{
+    if (SDL_ShouldInit(&crc32_init)) {
+        CRC32_InitTables();
+        crc32_func = CRC32_SliceBy8;
+#ifdef SDL_CRC32_CLMUL
+        crc32_clmul = SDL_HasCLMUL();
+#endif
+#ifdef SDL_CRC32_ARM
+        if (SDL_HasARMCRC32()) {
+            crc32_func = CRC32_ARM;
+        }
+#endif
+        SDL_SetInitialized(&crc32_init, true);
+    }
+}
+
+Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+{
+    const Uint8 *bytes = (const Uint8 *)data;
+
+    CRC32_Init();
+
+    crc = ~crc;
+#ifdef SDL_CRC32_CLMUL
+    if (crc32_clmul && len >= 64) {
+        const size_t chunk = len & ~(size_t)15;
+        crc = CRC32_CLMUL(crc, bytes, chunk);
+        bytes += chunk;
+        len -= chunk;
+    }
+#endif
+    crc = crc32_func(crc, bytes, len);
+    return ~crc;
+}
@@ -22,6 +22,305 @@
 
 // This file contains portable iconv functions for SDL
 
+#include "SDL_iconv_c.h"
+
+/* Every string that crosses the Windows API is converted between UTF-8 and
+   UTF-16LE, so those get their own converters. Runs of ASCII are converted a
+   vector at a time and everything else a character at a time. They stop at
+   anything that isn't valid, which is left to the general converter so the
+   results are the same either way. */
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ICONV_SSE2
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define ICONV_NEON
+#endif
+#endif
+
+#if defined(ICONV_SSE2) || defined(ICONV_NEON)
+// Converts 16 ASCII characters from UTF-8 to UTF-16LE, returns false if any of them aren't ASCII
+static SDL_INLINE bool WidenASCII(const Uint8 *src, Uint8 *dst)
+{
+#ifdef ICONV_SSE2
+    const __m128i chars = _mm_loadu_si128((const __m128i *)src);
+    if (_mm_movemask_epi8(chars) != 0) {
+        return false;
+    }
+    _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(chars, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(chars, _mm_setzero_si128()));
+#else
+    const uint8x16_t chars = vld1q_u8(src);
+    if (vmaxvq_u8(chars) >= 0x80) {
+        return false;
+    }
+    vst1q_u8(dst, vreinterpretq_u8_u16(vmovl_u8(vget_low_u8(chars))));
+    vst1q_u8(dst + 16, vreinterpretq_u8_u16(vmovl_u8(vget_high_u8(chars))));
+#endif
+    return true;
+}
+
+// Converts 8 ASCII characters from UTF-16LE to UTF-8, returns false if any of them aren't ASCII
+static SDL_INLINE bool NarrowASCII(const Uint8 *src, Uint8 *dst)
+{
+#ifdef ICONV_SSE2
+    const __m128i chars = _mm_loadu_si128((const __m128i *)src);
+    const __m128i high = _mm_and_si128(chars, _mm_set1_epi16((short)0xFF80));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF) {
+        return false;
+    }
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(chars, chars));
+#else
+    const uint16x8_t chars = vreinterpretq_u16_u8(vld1q_u8(src));
+    if (vmaxvq_u16(chars) >= 0x80) {
+        return false;
+    }
+    vst1_u8(dst, vmovn_u16(chars));
+#endif
+    return true;
+}
+#endif // ICONV_SSE2 || ICONV_NEON
+
+// Returns the length of the UTF-8 character at src, or 0 if it's invalid or incomplete
+static SDL_INLINE size_t DecodeUTF8(const Uint8 *src, size_t srclen, Uint32 *ch)
+{
+    size_t len;
+    Uint32 min;
+
+    if (src[0] < 0x80) {
+        *ch = src[0];
+        return 1;
+    } else if ((src[0] & 0xE0) == 0xC0) {
+        *ch = src[0] & 0x1F;
+        len = 2;
+        min = 0x80;
+    } else if ((src[0] & 0xF0) == 0xE0) {
+        *ch = src[0] & 0x0F;
+        len = 3;
+        min = 0x800;
+    } else if ((src[0] & 0xF8) == 0xF0) {
+        *ch = src[0] & 0x07;
+        len = 4;
+        min = 0x10000;
+    } else {
+        return 0;
+    }
+
+    if (srclen < len) {
+        return 0;
+    }
+    for (size_t i = 1; i < len; ++i) {
+        if ((src[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        *ch = (*ch << 6) | (src[i] & 0x3F);
+    }
+    if (*ch < min || *ch > 0x10FFFF || (*ch >= 0xD800 && *ch <= 0xDFFF)) {
+        return 0;
+    }
+    return len;
+}
+
+/* Converts UTF-8 to UTF-16LE until the input or output runs out, or an invalid
+   or incomplete character is found. Returns the number of characters converted. */
+static size_t ConvertUTF8ToUTF16LE(const Uint8 **srcp, size_t *srclenp, Uint8 **dstp, size_t *dstlenp)
+{
+    const Uint8 *src = *srcp;
+    size_t srclen = *srclenp;
+    Uint8 *dst = *dstp;
+    size_t dstlen = *dstlenp;
+    size_t total = 0;
+
+    while (srclen > 0) {
+#if defined(ICONV_SSE2) || defined(ICONV_NEON)
+        if (srclen >= 16 && dstlen >= 32 && WidenASCII(src, dst)) {
+            src += 16;
+            srclen -= 16;
+            dst += 32;
+            dstlen -= 32;
+            total += 16;
+            continue;
+        }
+#endif
+        Uint32 ch;
+        const size_t len = DecodeUTF8(src, srclen, &ch);
+        if (len == 0) {
+            break;
+        }
+        if (ch >= 0x10000) {
+            if (dstlen < 4) {
+                break;
+            }
+            ch -= 0x10000;
+            dst[0] = (Uint8)(ch >> 10);
+            dst[1] = (Uint8)(0xD8 | ((ch >> 18) & 0x03));
+            dst[2] = (Uint8)ch;
+            dst[3] = (Uint8)(0xDC | ((ch >> 8) & 0x03));
+            dst += 4;
+            dstlen -= 4;
+        } else {
+            if (dstlen < 2) {
+                break;
+            }
+            dst[0] = (Uint8)ch;
+            dst[1] = (Uint8)(ch >> 8);
+            dst += 2;
+            dstlen -= 2;
+        }
+        src += len;
+        srclen -= len;
+        ++total;
+    }
+
+    *srcp = src;
+    *srclenp = srclen;
+    *dstp = dst;
+    *dstlenp = dstlen;
+    return total;
+}
+
+/* Converts UTF-16LE to UTF-8 until the input or output runs out, or an invalid
+   or incomplete character is found. Returns the number of characters converted. */
+static size_t ConvertUTF16LEToUTF8(const Uint8 **srcp, size_t *srclenp, Uint8 **dstp, size_t *dstlenp)
+{
+    const Uint8 *src = *srcp;
+    size_t srclen = *srclenp;
+    Uint8 *dst = *dstp;
+    size_t dstlen = *dstlenp;
+    size_t total = 0;
+
+    while (srclen >= 2) {
+#if defined(ICONV_SSE2) || defined(ICONV_NEON)
+        if (srclen >= 16 && dstlen >= 8 && NarrowASCII(src, dst)) {
+            src += 16;
+            srclen -= 16;
+            dst += 8;
+            dstlen -= 8;
+            total += 8;
+            continue;
+        }
+#endif
+        Uint32 ch = ((Uint32)src[1] << 8) | src[0];
+        size_t len = 2;
+        if (ch >= 0xD800 && ch <= 0xDFFF) {
+            if (ch > 0xDBFF || srclen < 4) {
+                break;
+            }
+            const Uint32 W2 = ((Uint32)src[3] << 8) | src[2];
+            if (W2 < 0xDC00 || W2 > 0xDFFF) {
+                break;
+            }
+            ch = (((ch & 0x3FF) << 10) | (W2 & 0x3FF)) + 0x10000;
+            len = 4;
+        }
+
+        if (ch < 0x80) {
+            if (dstlen < 1) {
+                break;
+            }
+            dst[0] = (Uint8)ch;
+            dst += 1;
+            dstlen -= 1;
+        } else if (ch < 0x800) {
+            if (dstlen < 2) {
+                break;
+            }
+            dst[0] = (Uint8)(0xC0 | (ch >> 6));
+            dst[1] = (Uint8)(0x80 | (ch & 0x3F));
+            dst += 2;
+            dstlen -= 2;
+        } else if (ch < 0x10000) {
+            if (dstlen < 3) {
+                break;
+            }
+            dst[0] = (Uint8)(0xE0 | (ch >> 12));
+            dst[1] = (Uint8)(0x80 | ((ch >> 6) & 0x3F));
+            dst[2] = (Uint8)(0x80 | (ch & 0x3F));
+            dst += 3;
+            dstlen -= 3;
+        } else {
+            if (dstlen < 4) {
+                break;
+            }
+            dst[0] = (Uint8)(0xF0 | (ch >> 18));
+            dst[1] = (Uint8)(0x80 | ((ch >> 12) & 0x3F));
+            dst[2] = (Uint8)(0x80 | ((ch >> 6) & 0x3F));
+            dst[3] = (Uint8)(0x80 | (ch & 0x3F));
+            dst += 4;
+            dstlen -= 4;
+        }
+        src += len;
+        srclen -= len;
+        ++total;
+    }
+
+    *srcp = src;
+    *srclenp = srclen;
+    *dstp = dst;
+    *dstlenp = dstlen;
+    return total;
+}
+
+static char *IconvString(const char *tocode, const char *fromcode, const char *inbuf, size_t inbytesleft);
+
+/* Converts a whole string into a buffer sized for the worst case, which is
+   2 bytes out per byte in for UTF-8 to UTF-16LE, and 3 bytes out per 2 bytes
+   in the other way. Falls back to the general converter if the string isn't
+   valid, so the result is always the same as SDL_iconv_string(). */
+char *SDL_ConvertUTF8ToUTF16LE(const char *src, size_t srclen)
+{
+    size_t maxlen;
+    if (!SDL_size_mul_check_overflow(srclen, 2, &maxlen) ||
+        !SDL_size_add_check_overflow(maxlen, sizeof(Uint32), &maxlen)) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    char *string = (char *)SDL_malloc(maxlen);
+    if (!string) {
+        return NULL;
+    }
+
+    const Uint8 *in = (const Uint8 *)src;
+    size_t inlen = srclen;
+    Uint8 *out = (Uint8 *)string;
+    size_t outlen = maxlen - sizeof(Uint32);
+    ConvertUTF8ToUTF16LE(&in, &inlen, &out, &outlen);
+    if (inlen > 0) {
+        SDL_free(string);
+        return IconvString("UTF-16LE", "UTF-8", src, srclen);
+    }
+    SDL_memset(out, 0, sizeof(Uint32));
+    return string;
+}
+
+char *SDL_ConvertUTF16LEToUTF8(const char *src, size_t srclen)
+{
+    size_t maxlen;
+    if (!SDL_size_mul_check_overflow(srclen / 2 + 1, 3, &maxlen) ||
+        !SDL_size_add_check_overflow(maxlen, sizeof(Uint32), &maxlen)) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    char *string = (char *)SDL_malloc(maxlen);
+    if (!string) {
+        return NULL;
+    }
+
+    const Uint8 *in = (const Uint8 *)src;
+    size_t inlen = srclen;
+    Uint8 *out = (Uint8 *)string;
+    size_t outlen = maxlen - sizeof(Uint32);
+    ConvertUTF16LEToUTF8(&in, &inlen, &out, &outlen);
+    if (inlen > 0) {
+        SDL_free(string);
+        return IconvString("UTF-8", "UTF-16LE", src, srclen);
+    }
+    SDL_memset(out, 0, sizeof(Uint32));
+    return string;
+}
+
 #if defined(HAVE_ICONV) && defined(HAVE_ICONV_H)
 #ifndef SDL_USE_LIBICONV
 // Define LIBICONV_PLUG to use iconv from the base instead of ports and avoid linker errors.
@@ -330,6 +629,20 @@ size_t SDL_iconv(SDL_iconv_t cd,
     }
 
     total = 0;
+    if (srclen > 0 && ((cd->src_fmt == ENCODING_UTF8 && cd->dst_fmt == ENCODING_UTF16LE) ||
+                       (cd->src_fmt == ENCODING_UTF16LE && cd->dst_fmt == ENCODING_UTF8))) {
+        // Take the fast path as far as it goes, the rest is handled below
+        if (cd->src_fmt == ENCODING_UTF8) {
+            total = ConvertUTF8ToUTF16LE((const Uint8 **)&src, &srclen, (Uint8 **)&dst, &dstlen);
+        } else {
+            total = ConvertUTF16LEToUTF8((const Uint8 **)&src, &srclen, (Uint8 **)&dst, &dstlen);
+        }
+        *inbuf = src;
+        *inbytesleft = srclen;
+        *outbuf = dst;
+        *outbytesleft = dstlen;
+    }
+
     while (srclen > 0) {
         // Decode a character
         switch (cd->src_fmt) {
@@ -787,7 +1100,29 @@ int SDL_iconv_close(SDL_iconv_t cd)
 
 #endif // !HAVE_ICONV
 
+static bool IsUTF8Encoding(const char *code)
+{
+    return (!code || !*code || SDL_strcasecmp(code, "UTF-8") == 0 || SDL_strcasecmp(code, "UTF8") == 0);
+}
+
+static bool IsUTF16LEEncoding(const char *code)
+{
+    return (code && (SDL_strcasecmp(code, "UTF-16LE") == 0 || SDL_strcasecmp(code, "UTF16LE") == 0));
+}
+
 char *SDL_iconv_string(const char *tocode, const char *fromcode, const char *inbuf, size_t inbytesleft)
+{
+    if (inbuf) {
+        if (IsUTF16LEEncoding(tocode) && IsUTF8Encoding(fromcode)) {
+            return SDL_ConvertUTF8ToUTF16LE(inbuf, inbytesleft);
+        } else if (IsUTF8Encoding(tocode) && IsUTF16LEEncoding(fromcode)) {
+            return SDL_ConvertUTF16LEToUTF8(inbuf, inbytesleft);
+        }
+    }
+    return IconvString(tocode, fromcode, inbuf, inbytesleft);
+}
+
+static char *IconvString(const char *tocode, const char *fromcode, const char *inbuf, size_t inbytesleft)
 {
     SDL_iconv_t cd;
     char *string;
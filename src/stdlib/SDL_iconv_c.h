@@ -0,0 +1,30 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_iconv_c_h_
+#define SDL_iconv_c_h_
+
+// These are the same as SDL_iconv_string() between UTF-8 and UTF-16LE, but faster
+extern char *SDL_ConvertUTF8ToUTF16LE(const char *src, size_t srclen);
+extern char *SDL_ConvertUTF16LEToUTF8(const char *src, size_t srclen);
+
+#endif // SDL_iconv_c_h_
@@ -6328,11 +6328,231 @@ static void * SDLCALL real_malloc(size_t s) { return malloc(s); }
 static void * SDLCALL real_calloc(size_t n, size_t s) { return calloc(n, s); }
 static void * SDLCALL real_realloc(void *p, size_t s) { return realloc(p,s); }
 static void   SDLCALL real_free(void *p) { free(p); }
+#else
+/* Small allocations are served from a per-thread cache of free blocks, so
+   most of them never take the dlmalloc lock. Blocks are sorted into a few
+   size classes, taken from the global heap in batches, and handed back in
+   batches when a thread collects too many of them. The blocks are ordinary
+   dlmalloc chunks, so realloc and freeing from another thread just work. */
+#if defined(SDL_PLATFORM_WINDOWS) || defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID) || defined(SDL_PLATFORM_APPLE)
+#if defined(_MSC_VER)
+#define SDL_MALLOC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SDL_MALLOC_THREAD_LOCAL __thread
+#endif
+#endif
+#if defined(SDL_MALLOC_THREAD_LOCAL) && !defined(SDL_THREADS_DISABLED)
+#define SDL_MALLOC_CACHE
+#endif
+
+#ifdef SDL_MALLOC_CACHE
+
+#define SDL_MALLOC_CACHE_CLASSES 10
+#define SDL_MALLOC_CACHE_BATCH   16  // blocks taken from or returned to the global heap at a time
+#define SDL_MALLOC_CACHE_LIMIT   64  // blocks a thread can hold in one size class
+
+/* The last entry is an upper bound, blocks at least that big are too large
+   to keep in the last class. */
+static const size_t malloc_cache_sizes[SDL_MALLOC_CACHE_CLASSES + 1] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 640
+};
+
+typedef struct SDL_MallocCacheBlock
+{
+    struct SDL_MallocCacheBlock *next;
+} SDL_MallocCacheBlock;
+
+typedef struct SDL_MallocCache
+{
+    SDL_MallocCacheBlock *bins[SDL_MALLOC_CACHE_CLASSES];
+    int counts[SDL_MALLOC_CACHE_CLASSES];
+
+    // Counted locally and added to the totals when the thread touches the global heap
+    Uint64 hits;
+    Uint64 large;
+} SDL_MallocCache;
+
+static SDL_MALLOC_THREAD_LOCAL SDL_MallocCache malloc_cache;
+
+static SDL_SpinLock malloc_cache_stats_lock;
+static SDL_MemoryCacheStats malloc_cache_stats;
+
+static void PublishMallocCacheStats(SDL_MallocCache *cache, Uint64 refills, Uint64 flushes)
+{
+    SDL_LockSpinlock(&malloc_cache_stats_lock);
+    malloc_cache_stats.hits += cache->hits;
+    malloc_cache_stats.large += cache->large;
+    malloc_cache_stats.refills += refills;
+    malloc_cache_stats.flushes += flushes;
+    SDL_UnlockSpinlock(&malloc_cache_stats_lock);
+
+    cache->hits = 0;
+    cache->large = 0;
+}
+
+// Returns the smallest class that fits size, or -1 if it's too big
+static int GetMallocCacheClass(size_t size)
+{
+    int i;
+
+    for (i = 0; i < SDL_MALLOC_CACHE_CLASSES; ++i) {
+        if (size <= malloc_cache_sizes[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Returns the largest class a block can be reused for, or -1 if it shouldn't be cached
+static int GetMallocCacheClassForBlock(size_t usable)
+{
+    int i;
+
+    if (usable < malloc_cache_sizes[0] || usable >= malloc_cache_sizes[SDL_MALLOC_CACHE_CLASSES]) {
+        return -1;
+    }
+    for (i = SDL_MALLOC_CACHE_CLASSES - 1; usable < malloc_cache_sizes[i]; --i) {
+    }
+    return i;
+}
+
+static bool RefillMallocCache(SDL_MallocCache *cache, int index)
+{
+    size_t sizes[SDL_MALLOC_CACHE_BATCH];
+    void *blocks[SDL_MALLOC_CACHE_BATCH];
+    int i;
+
+    for (i = 0; i < SDL_MALLOC_CACHE_BATCH; ++i) {
+        sizes[i] = malloc_cache_sizes[index];
+    }
+
+    // This carves the whole batch out of one chunk, with a single trip through the heap lock
+    if (!dlindependent_comalloc(SDL_MALLOC_CACHE_BATCH, sizes, blocks)) {
+        return false;
+    }
+    for (i = 0; i < SDL_MALLOC_CACHE_BATCH; ++i) {
+        SDL_MallocCacheBlock *block = (SDL_MallocCacheBlock *)blocks[i];
+        block->next = cache->bins[index];
+        cache->bins[index] = block;
+    }
+    cache->counts[index] += SDL_MALLOC_CACHE_BATCH;
+
+    PublishMallocCacheStats(cache, 1, 0);
+    return true;
+}
+
+static void FlushMallocCacheClass(SDL_MallocCache *cache, int index, int count)
+{
+    void *blocks[SDL_MALLOC_CACHE_LIMIT];
+    int i;
+
+    for (i = 0; i < count && cache->bins[index]; ++i) {
+        SDL_MallocCacheBlock *block = cache->bins[index];
+        cache->bins[index] = block->next;
+        blocks[i] = block;
+    }
+    cache->counts[index] -= i;
+
+    if (i > 0) {
+        dlbulk_free(blocks, i);
+    }
+}
+
+static void * SDLCALL real_malloc(size_t s)
+{
+    SDL_MallocCache *cache = &malloc_cache;
+    const int index = GetMallocCacheClass(s);
+    SDL_MallocCacheBlock *block;
+
+    if (index < 0) {
+        ++cache->large;
+        return dlmalloc(s);
+    }
+
+    block = cache->bins[index];
+    if (block) {
+        ++cache->hits;
+    } else {
+        if (!RefillMallocCache(cache, index)) {
+            return dlmalloc(s);
+        }
+        block = cache->bins[index];
+    }
+    cache->bins[index] = block->next;
+    --cache->counts[index];
+    return block;
+}
+
+static void * SDLCALL real_calloc(size_t n, size_t s)
+{
+    size_t size;
+    void *mem;
+
+    if (SDL_size_mul_check_overflow(n, s, &size) && GetMallocCacheClass(size) >= 0) {
+        mem = real_malloc(size);
+        if (mem) {
+            SDL_memset(mem, 0, size);
+        }
+        return mem;
+    }
+    return dlcalloc(n, s);
+}
+
+static void SDLCALL real_free(void *p)
+{
+    SDL_MallocCache *cache = &malloc_cache;
+    SDL_MallocCacheBlock *block;
+    int index;
+
+    if (!p) {
+        return;
+    }
+
+    index = GetMallocCacheClassForBlock(dlmalloc_usable_size(p));
+    if (index < 0) {
+        dlfree(p);
+        return;
+    }
+
+    block = (SDL_MallocCacheBlock *)p;
+    block->next = cache->bins[index];
+    cache->bins[index] = block;
+    if (++cache->counts[index] > SDL_MALLOC_CACHE_LIMIT) {
+        // Keep some blocks around, so a thread that frees and allocates in turn doesn't bounce on the limit
+        FlushMallocCacheClass(cache, index, SDL_MALLOC_CACHE_LIMIT - SDL_MALLOC_CACHE_BATCH);
+        PublishMallocCacheStats(cache, 0, 1);
+    }
+}
+
+#define real_realloc dlrealloc
+
+void SDL_FlushMemoryCache(void)
+{
+    SDL_MallocCache *cache = &malloc_cache;
+    bool flushed = false;
+    int i;
+
+    for (i = 0; i < SDL_MALLOC_CACHE_CLASSES; ++i) {
+        while (cache->bins[i]) {
+            FlushMallocCacheClass(cache, i, SDL_MALLOC_CACHE_LIMIT);
+            flushed = true;
+        }
+    }
+    PublishMallocCacheStats(cache, 0, flushed ? 1 : 0);
+}
+
 #else
 #define real_malloc dlmalloc
 #define real_calloc dlcalloc
 #define real_realloc dlrealloc
 #define real_free dlfree
+#endif // SDL_MALLOC_CACHE
+#endif // HAVE_MALLOC
+
+#ifndef SDL_MALLOC_CACHE
+void SDL_FlushMemoryCache(void)
+{
+}
 #endif
 
 // mark the allocator entry points as KEEPALIVE so we can call these from JavaScript.
@@ -6441,6 +6661,116 @@ int SDL_GetNumAllocations(void)
 #endif
 }
 
+bool SDL_GetMemoryCacheStats(SDL_MemoryCacheStats *stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+#ifdef SDL_MALLOC_CACHE
+    // Include what this thread has counted since it last touched the global heap
+    PublishMallocCacheStats(&malloc_cache, 0, 0);
+
+    SDL_LockSpinlock(&malloc_cache_stats_lock);
+    SDL_copyp(stats, &malloc_cache_stats);
+    SDL_UnlockSpinlock(&malloc_cache_stats_lock);
+    return true;
+#else
+    SDL_zerop(stats);
+    return SDL_Unsupported();
+#endif
+}
+
+#ifdef SDL_MEMORY_STATS
+static SDL_SpinLock memory_tag_stats_lock;
+static SDL_MemoryTagStats memory_tag_stats[SDL_MEMORY_TAG_COUNT];
+
+void SDL_AddTaggedMemory(SDL_MemoryTag tag, size_t size)
+{
+    SDL_MemoryTagStats *stats = &memory_tag_stats[tag];
+
+    SDL_assert((int)tag >= 0 && tag < SDL_MEMORY_TAG_COUNT);
+
+    SDL_LockSpinlock(&memory_tag_stats_lock);
+    stats->bytes += size;
+    if (stats->bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->bytes;
+    }
+    ++stats->allocations;
+    ++stats->total_allocations;
+    SDL_UnlockSpinlock(&memory_tag_stats_lock);
+}
+
+void SDL_RemoveTaggedMemory(SDL_MemoryTag tag, size_t size)
+{
+    SDL_MemoryTagStats *stats = &memory_tag_stats[tag];
+
+    SDL_assert((int)tag >= 0 && tag < SDL_MEMORY_TAG_COUNT);
+
+    SDL_LockSpinlock(&memory_tag_stats_lock);
+    SDL_assert(stats->bytes >= size && stats->allocations > 0);
+    stats->bytes -= size;
+    --stats->allocations;
+    SDL_UnlockSpinlock(&memory_tag_stats_lock);
+}
+
+// Count a block under another tag, without counting it as a new allocation
+void SDL_MoveTaggedMemory(SDL_MemoryTag from, SDL_MemoryTag to, size_t size)
+{
+    SDL_MemoryTagStats *src = &memory_tag_stats[from];
+    SDL_MemoryTagStats *dst = &memory_tag_stats[to];
+
+    SDL_assert((int)from >= 0 && from < SDL_MEMORY_TAG_COUNT);
+    SDL_assert((int)to >= 0 && to < SDL_MEMORY_TAG_COUNT);
+
+    SDL_LockSpinlock(&memory_tag_stats_lock);
+    SDL_assert(src->bytes >= size && src->allocations > 0);
+    src->bytes -= size;
+    --src->allocations;
+    dst->bytes += size;
+    if (dst->bytes > dst->peak_bytes) {
+        dst->peak_bytes = dst->bytes;
+    }
+    ++dst->allocations;
+    SDL_UnlockSpinlock(&memory_tag_stats_lock);
+}
+#endif // SDL_MEMORY_STATS
+
+bool SDL_GetMemoryTagStats(SDL_MemoryTag tag, SDL_MemoryTagStats *stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    SDL_zerop(stats);
+
+    if ((int)tag < 0 || tag >= SDL_MEMORY_TAG_COUNT) {
+        return SDL_InvalidParamError("tag");
+    }
+
+#ifdef SDL_MEMORY_STATS
+    SDL_LockSpinlock(&memory_tag_stats_lock);
+    SDL_copyp(stats, &memory_tag_stats[tag]);
+    SDL_UnlockSpinlock(&memory_tag_stats_lock);
+    return true;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
+void SDL_ResetMemoryTagStats(void)
+{
+#ifdef SDL_MEMORY_STATS
+    int i;
+
+    SDL_LockSpinlock(&memory_tag_stats_lock);
+    for (i = 0; i < SDL_MEMORY_TAG_COUNT; ++i) {
+        memory_tag_stats[i].peak_bytes = memory_tag_stats[i].bytes;
+        memory_tag_stats[i].total_allocations = 0;
+    }
+    SDL_UnlockSpinlock(&memory_tag_stats_lock);
+#endif
+}
+
 void *SDL_malloc(size_t size)
 {
     void *mem;
@@ -20,6 +20,8 @@
 */
 #include "SDL_internal.h"
 
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+
 
 #ifdef SDL_memcpy
 #undef SDL_memcpy
@@ -39,6 +41,17 @@ void *SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void
 #elif defined(HAVE_BCOPY)
     bcopy(src, dst, len);
     return dst;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+    // This is fast on CPUs with enhanced rep movsb (ERMS), which is nearly all of them now
+    void *result = dst;
+    __asm__ __volatile__("rep movsb"
+                         : "+D"(dst), "+S"(src), "+c"(len)
+                         :
+                         : "memory");
+    return result;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    __movsb((unsigned char *)dst, (const unsigned char *)src, len);
+    return dst;
 #else
     /* GCC 4.9.0 with -O3 will generate movaps instructions with the loop
        using Uint32* pointers, so we need to make sure the pointers are
@@ -81,6 +94,163 @@ void *SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void
 #endif // HAVE_MEMCPY
 }
 
+/* Large copies are done with non-temporal stores, which write around the
+   cache instead of filling it with data that won't be read again soon, like
+   pixels on their way to a texture. This only pays off once a copy is too big
+   to fit in the cache anyway, smaller copies are faster with SDL_memcpy(). */
+#if defined(SDL_SSE2_INTRINSICS) || defined(SDL_AVX_INTRINSICS)
+#define SDL_MEMCPY_STREAMING
+#endif
+
+#ifdef SDL_MEMCPY_STREAMING
+
+typedef void (*SDL_StreamCopyFunc)(Uint8 *dst, const Uint8 *src, size_t len);
+
+#ifdef SDL_AVX_INTRINSICS
+// This assumes 32-byte aligned dst and a multiple of 128 bytes
+static void SDL_TARGETING("avx") SDL_StreamCopy_AVX(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    for (; len; len -= 128, src += 128, dst += 128) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(src + 0));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(src + 32));
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(src + 64));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(src + 96));
+        _mm256_stream_si256((__m256i *)(dst + 0), a);
+        _mm256_stream_si256((__m256i *)(dst + 32), b);
+        _mm256_stream_si256((__m256i *)(dst + 64), c);
+        _mm256_stream_si256((__m256i *)(dst + 96), d);
+    }
+}
+#endif
+
+#ifdef SDL_SSE2_INTRINSICS
+// This assumes 16-byte aligned dst and a multiple of 64 bytes
+static void SDL_TARGETING("sse2") SDL_StreamCopy_SSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    for (; len; len -= 64, src += 64, dst += 64) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + 0));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + 16));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + 32));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(src + 48));
+        _mm_stream_si128((__m128i *)(dst + 0), a);
+        _mm_stream_si128((__m128i *)(dst + 16), b);
+        _mm_stream_si128((__m128i *)(dst + 32), c);
+        _mm_stream_si128((__m128i *)(dst + 48), d);
+    }
+}
+#endif
+
+static SDL_StreamCopyFunc stream_copy;
+static size_t stream_threshold;
+
+static SDL_StreamCopyFunc GetStreamCopy(size_t total)
+{
+    if (!stream_threshold) {
+        SDL_StreamCopyFunc func = NULL;
+
+#ifdef SDL_AVX_INTRINSICS
+        if (!func && SDL_HasAVX()) {
+            func = SDL_StreamCopy_AVX;
+        }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+        if (!func && SDL_HasSSE2()) {
+            func = SDL_StreamCopy_SSE2;
+        }
+#endif
+        stream_copy = func;
+        // Leave the other half of the cache to whatever else is running
+        stream_threshold = (size_t)SDL_GetCPUCacheSize() / 2;
+    }
+    return (total >= stream_threshold) ? stream_copy : NULL;
+}
+
+static void StreamCopy(SDL_StreamCopyFunc func, Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t head, body;
+
+    head = (size_t)(0 - (uintptr_t)dst) & 31;
+    if (head > len) {
+        head = len;
+    }
+    if (head) {
+        SDL_memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        len -= head;
+    }
+
+    body = len & ~(size_t)127;
+    if (body) {
+        func(dst, src, body);
+        dst += body;
+        src += body;
+        len -= body;
+    }
+
+    if (len) {
+        SDL_memcpy(dst, src, len);
+    }
+}
+
+static void SDL_TARGETING("sse") FinishStreamCopy(void)
+{
+    // Non-temporal stores aren't ordered with other stores, make sure they're done
+    _mm_sfence();
+}
+
+#endif // SDL_MEMCPY_STREAMING
+
+void *SDL_memcpy_large(void *dst, const void *src, size_t len)
+{
+#ifdef SDL_MEMCPY_STREAMING
+    SDL_StreamCopyFunc func = GetStreamCopy(len);
+    if (func) {
+        StreamCopy(func, (Uint8 *)dst, (const Uint8 *)src, len);
+        FinishStreamCopy();
+        return dst;
+    }
+#endif
+    return SDL_memcpy(dst, src, len);
+}
+
+void SDL_memcpy_rows(void *dst, size_t dst_pitch, const void *src, size_t src_pitch, size_t len, size_t rows)
+{
+    Uint8 *dstp = (Uint8 *)dst;
+    const Uint8 *srcp = (const Uint8 *)src;
+#ifdef SDL_MEMCPY_STREAMING
+    SDL_StreamCopyFunc func;
+#endif
+
+    if (!len || !rows) {
+        return;
+    }
+
+    if (len == dst_pitch && len == src_pitch) {
+        SDL_memcpy_large(dst, src, len * rows);
+        return;
+    }
+
+#ifdef SDL_MEMCPY_STREAMING
+    func = GetStreamCopy(len * rows);
+    if (func) {
+        while (rows--) {
+            StreamCopy(func, dstp, srcp, len);
+            dstp += dst_pitch;
+            srcp += src_pitch;
+        }
+        FinishStreamCopy();
+        return;
+    }
+#endif
+
+    while (rows--) {
+        SDL_memcpy(dstp, srcp, len);
+        dstp += dst_pitch;
+        srcp += src_pitch;
+    }
+}
+
 /* The optimizer on Visual Studio 2005 and later generates memcpy() and memset() calls.
    We will provide our own implementation if we're not building with a C runtime. */
 #ifndef HAVE_LIBC
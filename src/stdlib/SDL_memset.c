@@ -33,6 +33,17 @@ void *SDL_memset(SDL_OUT_BYTECAP(len) void *dst, int c, size_t len)
     return __builtin_memset(dst, c, len);
 #elif defined(HAVE_MEMSET)
     return memset(dst, c, len);
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+    // This is fast on CPUs with enhanced rep stosb (ERMS), which is nearly all of them now
+    void *result = dst;
+    __asm__ __volatile__("rep stosb"
+                         : "+D"(dst), "+c"(len)
+                         : "a"(c)
+                         : "memory");
+    return result;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    __stosb((unsigned char *)dst, (unsigned char)c, len);
+    return dst;
 #else
     size_t left;
     Uint32 *dstp4;
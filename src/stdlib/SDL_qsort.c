@@ -25,506 +25,386 @@
 // tapdance to support the various qsort_r interfaces, or bridge from
 // the C runtime's non-SDLCALL compare functions.
 
-#ifdef assert
-#undef assert
-#endif
-#define assert SDL_assert
-#ifdef malloc
-#undef malloc
-#endif
-#define malloc SDL_malloc
-#ifdef free
-#undef free
-#endif
-#define free SDL_free
-#ifdef memcpy
-#undef memcpy
-#endif
-#define memcpy SDL_memcpy
-#ifdef memmove
-#undef memmove
-#endif
-#define memmove SDL_memmove
+/* This is a pattern-defeating quicksort, after Orson Peters' pdqsort:
+ *
+ *   - Median of 3 pivots, or the pseudomedian of 9 for larger ranges.
+ *   - Partitioning is done in blocks, recording which elements are on the
+ *     wrong side before swapping any of them (from "BlockQuicksort" by
+ *     Edelkamp and Weiss), so the outcome of a comparison is never branched on.
+ *   - Ranges that turn out to be already partitioned are finished off with an
+ *     insertion sort that gives up if it has to move too much, which makes
+ *     sorted and nearly sorted input linear.
+ *   - Runs of elements equal to a previous pivot are put in their place in one
+ *     partition, so arrays with few distinct values sort quickly.
+ *   - Badly unbalanced partitions swap a few elements around to break up
+ *     whatever pattern caused them, and too many of them switch to heapsort,
+ *     so the worst case is O(n log n).
+ *
+ * Everything is done with swaps, so no temporary storage is needed.
+ */
 
-/*
-This code came from Gareth McCaughan, under the zlib license.
-Specifically this: https://www.mccaughan.org.uk/software/qsort.c-1.16
+#define SORT_INSERTION_THRESHOLD 24
+#define SORT_NINTHER_THRESHOLD 128
+#define SORT_PARTIAL_INSERTION_LIMIT 8
+#define SORT_BLOCK_SIZE 64
 
-Everything below this comment until the HAVE_QSORT #endif was from Gareth
-(any minor changes will be noted inline).
+typedef enum SDL_SortSwapType
+{
+    SORT_SWAP_BYTES,
+    SORT_SWAP_UINT32,
+    SORT_SWAP_UINT64
+} SDL_SortSwapType;
 
-Thank you to Gareth for relicensing this code under the zlib license for our
-benefit!
+typedef struct SDL_SortContext
+{
+    size_t size;
+    SDL_SortSwapType swap_type;
+    SDL_CompareCallback_r compare;
+    void *userdata;
+} SDL_SortContext;
 
-Update for SDL3: we have modified this from a qsort function to qsort_r.
+#define SORT_LESS(ctx, a, b) ((ctx)->compare((ctx)->userdata, (a), (b)) < 0)
 
---ryan.
-*/
+static SDL_INLINE void SortSwap(const SDL_SortContext *ctx, char *a, char *b)
+{
+    size_t i;
+
+    switch (ctx->swap_type) {
+    case SORT_SWAP_UINT64:
+        for (i = 0; i < ctx->size; i += sizeof(Uint64)) {
+            const Uint64 tmp = *(Uint64 *)(a + i);
+            *(Uint64 *)(a + i) = *(Uint64 *)(b + i);
+            *(Uint64 *)(b + i) = tmp;
+        }
+        break;
+    case SORT_SWAP_UINT32:
+        for (i = 0; i < ctx->size; i += sizeof(Uint32)) {
+            const Uint32 tmp = *(Uint32 *)(a + i);
+            *(Uint32 *)(a + i) = *(Uint32 *)(b + i);
+            *(Uint32 *)(b + i) = tmp;
+        }
+        break;
+    default:
+        for (i = 0; i < ctx->size; ++i) {
+            const char tmp = a[i];
+            a[i] = b[i];
+            b[i] = tmp;
+        }
+        break;
+    }
+}
 
-/* This is a drop-in replacement for the C library's |qsort()| routine.
- *
- * It is intended for use where you know or suspect that your
- * platform's qsort is bad. If that isn't the case, then you
- * should probably use the qsort your system gives you in preference
- * to mine -- it will likely have been tested and tuned better.
- *
- * Features:
- *   - Median-of-three pivoting (and more)
- *   - Truncation and final polishing by a single insertion sort
- *   - Early truncation when no swaps needed in pivoting step
- *   - Explicit recursion, guaranteed not to overflow
- *   - A few little wrinkles stolen from the GNU |qsort()|.
- *     (For the avoidance of doubt, no code was stolen, only
- *     broad ideas.)
- *   - separate code for non-aligned / aligned / word-size objects
- *
- * Earlier releases of this code used an idiosyncratic licence
- * I wrote myself, because I'm an idiot. The code is now released
- * under the "zlib/libpng licence"; you will find the actual
- * terms in the next comment. I request (but do not require)
- * that if you make any changes beyond the name of the exported
- * routine and reasonable tweaks to the TRUNC_* and
- * PIVOT_THRESHOLD values, you modify the _ID string so as
- * to make it clear that you have changed the code.
- *
- * If you find problems with this code, or find ways of
- * making it significantly faster, please let me know!
- * My e-mail address, valid as of early 2016 and for the
- * foreseeable future, is
- *    gareth.mccaughan@pobox.com
- * Thanks!
- *
- * Gareth McCaughan
- */
+static SDL_INLINE void SortSwapIfLess(const SDL_SortContext *ctx, char *a, char *b)
+{
+    if (SORT_LESS(ctx, b, a)) {
+        SortSwap(ctx, a, b);
+    }
+}
 
-/* Copyright (c) 1998-2021 Gareth McCaughan
- *
- * This software is provided 'as-is', without any express or implied
- * warranty. In no event will the authors be held liable for any
- * damages arising from the use of this software.
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented;
- *    you must not claim that you wrote the original software.
- *    If you use this software in a product, an acknowledgment
- *    in the product documentation would be appreciated but
- *    is not required.
- *
- * 2. Altered source versions must be plainly marked as such,
- *    and must not be misrepresented as being the original software.
- *
- * 3. This notice may not be removed or altered from any source
- *    distribution.
- */
+static void Sort3(const SDL_SortContext *ctx, char *a, char *b, char *c)
+{
+    SortSwapIfLess(ctx, a, b);
+    SortSwapIfLess(ctx, b, c);
+    SortSwapIfLess(ctx, a, b);
+}
 
-/* Revision history since release:
- *   1998-03-19 v1.12 First release I have any records of.
- *   2007-09-02 v1.13 Fix bug kindly reported by Dan Bodoh
- *                    (premature termination of recursion).
- *                    Add a few clarifying comments.
- *                    Minor improvements to debug output.
- *   2016-02-21 v1.14 Replace licence with 2-clause BSD,
- *                    and clarify a couple of things in
- *                    comments. No code changes.
- *   2016-03-10 v1.15 Fix bug kindly reported by Ryan Gordon
- *                    (pre-insertion-sort messed up).
- *                    Disable DEBUG_QSORT by default.
- *                    Tweak comments very slightly.
- *   2021-02-20 v1.16 Fix bug kindly reported by Ray Gardner
- *                    (error in recursion leading to possible
- *                    stack overflow).
- *                    When checking alignment, avoid casting
- *                    pointer to possibly-smaller integer.
- */
+static void InsertionSort(const SDL_SortContext *ctx, char *begin, char *end)
+{
+    const size_t size = ctx->size;
 
-/* BEGIN SDL CHANGE ... commented this out with an #if 0 block. --ryan. */
-#if 0
-#include <assert.h>
-#include <stdint.h>
-#include <stdlib.h>
-#include <string.h>
+    for (char *cur = begin + size; cur < end; cur += size) {
+        for (char *sift = cur; sift > begin && SORT_LESS(ctx, sift, sift - size); sift -= size) {
+            SortSwap(ctx, sift, sift - size);
+        }
+    }
+}
 
-#undef DEBUG_QSORT
+// Returns false if more than a few elements had to be moved, leaving the range partially sorted
+static bool PartialInsertionSort(const SDL_SortContext *ctx, char *begin, char *end)
+{
+    const size_t size = ctx->size;
+    size_t moves = 0;
 
-static char _ID[]="<qsort.c gjm WITH CHANGES FOR SDL3 1.16 2021-02-20>";
-#endif
-/* END SDL CHANGE ... commented this out with an #if 0 block. --ryan. */
+    for (char *cur = begin + size; cur < end; cur += size) {
+        char *sift = cur;
+        for (; sift > begin && SORT_LESS(ctx, sift, sift - size); sift -= size) {
+            SortSwap(ctx, sift, sift - size);
+        }
+        moves += (size_t)(cur - sift) / size;
+        if (moves > SORT_PARTIAL_INSERTION_LIMIT) {
+            return false;
+        }
+    }
+    return true;
+}
 
-/* How many bytes are there per word? (Must be a power of 2,
- * and must in fact equal sizeof(int).)
- */
-#define WORD_BYTES sizeof(int)
+static void SiftDown(const SDL_SortContext *ctx, char *base, size_t root, size_t count)
+{
+    const size_t size = ctx->size;
 
-/* How big does our stack need to be? Answer: one entry per
- * bit in a |size_t|. (Actually, a bit less because we don't
- * recurse all the way down to size-1 subarrays.)
- */
-#define STACK_SIZE (8*sizeof(size_t))
-
-/* Different situations have slightly different requirements,
- * and we make life epsilon easier by using different truncation
- * points for the three different cases.
- * So far, I have tuned TRUNC_words and guessed that the same
- * value might work well for the other two cases. Of course
- * what works well on my machine might work badly on yours.
- */
-#define TRUNC_nonaligned	12
-#define TRUNC_aligned		12
-#define TRUNC_words		12*WORD_BYTES	/* nb different meaning */
+    while (root * 2 + 1 < count) {
+        size_t child = root * 2 + 1;
+        if (child + 1 < count && SORT_LESS(ctx, base + child * size, base + (child + 1) * size)) {
+            ++child;
+        }
+        if (!SORT_LESS(ctx, base + root * size, base + child * size)) {
+            break;
+        }
+        SortSwap(ctx, base + root * size, base + child * size);
+        root = child;
+    }
+}
 
-/* We use a simple pivoting algorithm for shortish sub-arrays
- * and a more complicated one for larger ones. The threshold
- * is PIVOT_THRESHOLD.
- */
-#define PIVOT_THRESHOLD 40
-
-typedef struct { char * first; char * last; } stack_entry;
-#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop++].last=last;}
-#define pushRight {stack[stacktop].first=first;stack[stacktop++].last=llast;}
-#define doLeft {first=ffirst;llast=last;continue;}
-#define doRight {ffirst=first;last=llast;continue;}
-#define pop {if (--stacktop<0) break;\
-  first=ffirst=stack[stacktop].first;\
-  last=llast=stack[stacktop].last;\
-  continue;}
-
-/* Some comments on the implementation.
- * 1. When we finish partitioning the array into "low"
- *    and "high", we forget entirely about short subarrays,
- *    because they'll be done later by insertion sort.
- *    Doing lots of little insertion sorts might be a win
- *    on large datasets for locality-of-reference reasons,
- *    but it makes the code much nastier and increases
- *    bookkeeping overhead.
- * 2. We always save the longer and get to work on the
- *    shorter. This guarantees that whenever we push
- *    a k'th entry onto the stack we are about to get
- *    working on something of size <= N/2^k where N is
- *    the original array size; so the stack can't need
- *    more than log_2(max-array-size) entries.
- * 3. We choose a pivot by looking at the first, last
- *    and middle elements. We arrange them into order
- *    because it's easy to do that in conjunction with
- *    choosing the pivot, and it makes things a little
- *    easier in the partitioning step. Anyway, the pivot
- *    is the middle of these three. It's still possible
- *    to construct datasets where the algorithm takes
- *    time of order n^2, but it simply never happens in
- *    practice.
- * 3' Newsflash: On further investigation I find that
- *    it's easy to construct datasets where median-of-3
- *    simply isn't good enough. So on large-ish subarrays
- *    we do a more sophisticated pivoting: we take three
- *    sets of 3 elements, find their medians, and then
- *    take the median of those.
- * 4. We copy the pivot element to a separate place
- *    because that way we can always do our comparisons
- *    directly against a pointer to that separate place,
- *    and don't have to wonder "did we move the pivot
- *    element?". This makes the inner loop better.
- * 5. It's possible to make the pivoting even more
- *    reliable by looking at more candidates when n
- *    is larger. (Taking this to its logical conclusion
- *    results in a variant of quicksort that doesn't
- *    have that n^2 worst case.) However, the overhead
- *    from the extra bookkeeping means that it's just
- *    not worth while.
- * 6. This is pretty clean and portable code. Here are
- *    all the potential portability pitfalls and problems
- *    I know of:
- *      - In one place (the insertion sort) I construct
- *        a pointer that points just past the end of the
- *        supplied array, and assume that (a) it won't
- *        compare equal to any pointer within the array,
- *        and (b) it will compare equal to a pointer
- *        obtained by stepping off the end of the array.
- *        These might fail on some segmented architectures.
- *      - I assume that there are 8 bits in a |char| when
- *        computing the size of stack needed. This would
- *        fail on machines with 9-bit or 16-bit bytes.
- *      - I assume that if |((int)base&(sizeof(int)-1))==0|
- *        and |(size&(sizeof(int)-1))==0| then it's safe to
- *        get at array elements via |int*|s, and that if
- *        actually |size==sizeof(int)| as well then it's
- *        safe to treat the elements as |int|s. This might
- *        fail on systems that convert pointers to integers
- *        in non-standard ways.
- *      - I assume that |8*sizeof(size_t)<=INT_MAX|. This
- *        would be false on a machine with 8-bit |char|s,
- *        16-bit |int|s and 4096-bit |size_t|s. :-)
- */
+static void HeapSort(const SDL_SortContext *ctx, char *begin, char *end)
+{
+    const size_t size = ctx->size;
+    const size_t count = (size_t)(end - begin) / size;
 
-/* The recursion logic is the same in each case.
- * We keep chopping up until we reach subarrays of size
- * strictly less than Trunc; we leave these unsorted. */
-#define Recurse(Trunc)				\
-      { size_t l=last-ffirst,r=llast-first;	\
-        if (l<Trunc) {				\
-          if (r>=Trunc) doRight			\
-          else pop				\
-        }					\
-        else if (l<=r) { pushRight; doLeft }	\
-        else if (r>=Trunc) { pushLeft; doRight }\
-        else doLeft				\
-      }
-
-/* and so is the pivoting logic (note: last is inclusive): */
-#define Pivot(swapper,sz)			\
-  if ((size_t)(last-first)>PIVOT_THRESHOLD*sz) mid=pivot_big(first,mid,last,sz,compare,userdata);\
-  else {	\
-    if (compare(userdata,first,mid)<0) {			\
-      if (compare(userdata,mid,last)>0) {		\
-        swapper(mid,last);			\
-        if (compare(userdata,first,mid)>0) swapper(first,mid);\
-      }						\
-    }						\
-    else {					\
-      if (compare(userdata,mid,last)>0) swapper(first,last)\
-      else {					\
-        swapper(first,mid);			\
-        if (compare(userdata,mid,last)>0) swapper(mid,last);\
-      }						\
-    }						\
-    first+=sz; last-=sz;			\
-  }
-
-#ifdef DEBUG_QSORT
-#include <stdio.h>
-#endif
-
-/* and so is the partitioning logic: */
-#define Partition(swapper,sz) {			\
-  do {						\
-    while (compare(userdata,first,pivot)<0) first+=sz;	\
-    while (compare(userdata,pivot,last)<0) last-=sz;	\
-    if (first<last) {				\
-      swapper(first,last);			\
-      first+=sz; last-=sz; }			\
-    else if (first==last) { first+=sz; last-=sz; break; }\
-  } while (first<=last);			\
+    for (size_t i = count / 2; i > 0; --i) {
+        SiftDown(ctx, begin, i - 1, count);
+    }
+    for (size_t i = count - 1; i > 0; --i) {
+        SortSwap(ctx, begin, begin + i * size);
+        SiftDown(ctx, begin, 0, i);
+    }
 }
 
-/* and so is the pre-insertion-sort operation of putting
- * the smallest element into place as a sentinel.
- * Doing this makes the inner loop nicer. I got this
- * idea from the GNU implementation of qsort().
- * We find the smallest element from the first |nmemb|,
- * or the first |limit|, whichever is smaller;
- * therefore we must have ensured that the globally smallest
- * element is in the first |limit| (because our
- * quicksort recursion bottoms out only once we
- * reach subarrays smaller than |limit|).
- */
-#define PreInsertion(swapper,limit,sz)		\
-  first=base;					\
-  last=first + ((nmemb>limit ? limit : nmemb)-1)*sz;\
-  while (last!=base) {				\
-    if (compare(userdata,first,last)>0) first=last;	\
-    last-=sz; }					\
-  if (first!=base) swapper(first,(char*)base);
-
-/* and so is the insertion sort, in the first two cases: */
-#define Insertion(swapper)			\
-  last=((char*)base)+nmemb*size;		\
-  for (first=((char*)base)+size;first!=last;first+=size) {	\
-    char *test;					\
-    /* Find the right place for |first|.	\
-     * My apologies for var reuse. */		\
-    for (test=first-size;compare(userdata,test,first)>0;test-=size) ;	\
-    test+=size;					\
-    if (test!=first) {				\
-      /* Shift everything in [test,first)	\
-       * up by one, and place |first|		\
-       * where |test| is. */			\
-      memcpy(pivot,first,size);			\
-      memmove(test+size,test,first-test);	\
-      memcpy(test,pivot,size);			\
-    }						\
-  }
-
-#define SWAP_nonaligned(a,b) { \
-  register char *aa=(a),*bb=(b); \
-  register size_t sz=size; \
-  do { register char t=*aa; *aa++=*bb; *bb++=t; } while (--sz); }
-
-#define SWAP_aligned(a,b) { \
-  register int *aa=(int*)(a),*bb=(int*)(b); \
-  register size_t sz=size; \
-  do { register int t=*aa;*aa++=*bb; *bb++=t; } while (sz-=WORD_BYTES); }
-
-#define SWAP_words(a,b) { \
-  register int t=*((int*)a); *((int*)a)=*((int*)b); *((int*)b)=t; }
-
-/* ---------------------------------------------------------------------- */
-
-static char * pivot_big(char *first, char *mid, char *last, size_t size,
-                        int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
-  size_t d=(((last-first)/size)>>3)*size;
-#ifdef DEBUG_QSORT
-fprintf(stderr, "pivot_big: first=%p last=%p size=%lu n=%lu\n", first, (unsigned long)last, size, (unsigned long)((last-first+1)/size));
-#endif
-  char *m1,*m2,*m3;
-  { char *a=first, *b=first+d, *c=first+2*d;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"< %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m1 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-  { char *a=mid-d, *b=mid, *c=mid+d;
-#ifdef DEBUG_QSORT
-fprintf(stderr,". %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m2 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-  { char *a=last-2*d, *b=last-d, *c=last;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"> %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m3 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-#ifdef DEBUG_QSORT
-fprintf(stderr,"-> %d %d %d @ %p %p %p\n",*(int*)m1,*(int*)m2,*(int*)m3, m1,m2,m3);
-#endif
-  return compare(userdata,m1,m2)<0 ?
-           (compare(userdata,m2,m3)<0 ? m2 : (compare(userdata,m1,m3)<0 ? m3 : m1))
-         : (compare(userdata,m1,m3)<0 ? m1 : (compare(userdata,m2,m3)<0 ? m3 : m2));
+/* Partitions [begin, end) around the pivot at begin, with elements equal to
+   the pivot going to the right, and returns the pivot's final position. */
+static char *PartitionRight(const SDL_SortContext *ctx, char *begin, char *end, bool *already_partitioned)
+{
+    const size_t size = ctx->size;
+    const char *pivot = begin;
+    char *first = begin;
+    char *last = end;
+
+    /* Find the first element not less than the pivot, and the last element
+       less than it. The median of 3 means these scans would stop without
+       the bounds checks, but a compare function that isn't consistent could
+       otherwise run them off the end of the array. */
+    do {
+        first += size;
+    } while (first < end - size && SORT_LESS(ctx, first, pivot));
+
+    do {
+        last -= size;
+    } while (first < last && !SORT_LESS(ctx, last, pivot));
+
+    *already_partitioned = (first >= last);
+    if (!*already_partitioned) {
+        Uint8 offsets_l[SORT_BLOCK_SIZE];
+        Uint8 offsets_r[SORT_BLOCK_SIZE];
+        char *offsets_l_base;
+        char *offsets_r_base;
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        SortSwap(ctx, first, last);
+        first += size;
+
+        offsets_l_base = first;
+        offsets_r_base = last;
+
+        while (first < last) {
+            // Record which elements are on the wrong side, a block at a time from each end
+            const size_t num_unknown = (size_t)(last - first) / size;
+            const size_t left_split = (num_l == 0) ? ((num_r == 0) ? num_unknown / 2 : num_unknown) : 0;
+            const size_t right_split = (num_r == 0) ? (num_unknown - left_split) : 0;
+            const size_t left_count = SDL_min(left_split, SORT_BLOCK_SIZE);
+            const size_t right_count = SDL_min(right_split, SORT_BLOCK_SIZE);
+            size_t i, num;
+
+            for (i = 0; i < left_count; ++i) {
+                offsets_l[num_l] = (Uint8)i;
+                num_l += !SORT_LESS(ctx, first, pivot);
+                first += size;
+            }
+            for (i = 0; i < right_count; ++i) {
+                last -= size;
+                offsets_r[num_r] = (Uint8)(i + 1);
+                num_r += SORT_LESS(ctx, last, pivot);
+            }
+
+            // Swap as many pairs as we found
+            num = SDL_min(num_l, num_r);
+            for (i = 0; i < num; ++i) {
+                SortSwap(ctx, offsets_l_base + offsets_l[start_l + i] * size, offsets_r_base - offsets_r[start_r + i] * size);
+            }
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // Whatever is left on one side goes to the boundary
+        if (num_l) {
+            while (num_l--) {
+                last -= size;
+                SortSwap(ctx, offsets_l_base + offsets_l[start_l + num_l] * size, last);
+            }
+            first = last;
+        }
+        if (num_r) {
+            while (num_r--) {
+                SortSwap(ctx, offsets_r_base - offsets_r[start_r + num_r] * size, first);
+                first += size;
+            }
+        }
+    }
+
+    // Put the pivot in its place
+    char *pivot_pos = first - size;
+    if (pivot_pos != begin) {
+        SortSwap(ctx, begin, pivot_pos);
+    }
+    return pivot_pos;
 }
 
-/* ---------------------------------------------------------------------- */
-
-static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
-           int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(size);
-  size_t trunc=TRUNC_nonaligned*size;
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*size;
-
-  if ((size_t)(last-first)>=trunc) {
-    char *ffirst=first, *llast=last;
-    while (1) {
-      /* Select pivot */
-      { char * mid=first+size*((last-first)/size >> 1);
-        Pivot(SWAP_nonaligned,size);
-        memcpy(pivot,mid,size);
-      }
-      /* Partition. */
-      Partition(SWAP_nonaligned,size);
-      /* Prepare to recurse/iterate. */
-      Recurse(trunc)
+/* Partitions [begin, end) around the pivot at begin, with elements equal to
+   the pivot going to the left, and returns the pivot's final position. This
+   is used when the pivot is equal to the element before begin, in which case
+   nothing in the range is less than it and the left side is all equal. */
+static char *PartitionLeft(const SDL_SortContext *ctx, char *begin, char *end)
+{
+    const size_t size = ctx->size;
+    const char *pivot = begin;
+    char *first = begin;
+    char *last = end;
+
+    do {
+        last -= size;
+    } while (last > begin && SORT_LESS(ctx, pivot, last));
+
+    do {
+        first += size;
+    } while (first < last && !SORT_LESS(ctx, pivot, first));
+
+    while (first < last) {
+        SortSwap(ctx, first, last);
+        do {
+            last -= size;
+        } while (last > begin && SORT_LESS(ctx, pivot, last));
+        do {
+            first += size;
+        } while (first < last && !SORT_LESS(ctx, pivot, first));
+    }
+
+    if (last != begin) {
+        SortSwap(ctx, begin, last);
     }
-  }
-  PreInsertion(SWAP_nonaligned,TRUNC_nonaligned,size);
-  Insertion(SWAP_nonaligned);
-  free(pivot);
+    return last;
 }
 
-static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
-           int (SDLCALL *compare)(void *,const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(size);
-  size_t trunc=TRUNC_aligned*size;
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*size;
-
-  if ((size_t)(last-first)>=trunc) {
-    char *ffirst=first,*llast=last;
-    while (1) {
-      /* Select pivot */
-      { char * mid=first+size*((last-first)/size >> 1);
-        Pivot(SWAP_aligned,size);
-        memcpy(pivot,mid,size);
-      }
-      /* Partition. */
-      Partition(SWAP_aligned,size);
-      /* Prepare to recurse/iterate. */
-      Recurse(trunc)
+static void PatternDefeatingSort(const SDL_SortContext *ctx, char *begin, char *end, int bad_allowed, bool leftmost)
+{
+    const size_t size = ctx->size;
+
+    while (true) {
+        const size_t count = (size_t)(end - begin) / size;
+        const size_t half = count / 2;
+
+        if (count < SORT_INSERTION_THRESHOLD) {
+            InsertionSort(ctx, begin, end);
+            return;
+        }
+
+        // Move the pivot to begin
+        if (count > SORT_NINTHER_THRESHOLD) {
+            Sort3(ctx, begin, begin + half * size, end - size);
+            Sort3(ctx, begin + size, begin + (half - 1) * size, end - 2 * size);
+            Sort3(ctx, begin + 2 * size, begin + (half + 1) * size, end - 3 * size);
+            Sort3(ctx, begin + (half - 1) * size, begin + half * size, begin + (half + 1) * size);
+            SortSwap(ctx, begin, begin + half * size);
+        } else {
+            Sort3(ctx, begin + half * size, begin, end - size);
+        }
+
+        // If the pivot is equal to the element before the range, nothing in the range is less than it
+        if (!leftmost && !SORT_LESS(ctx, begin - size, begin)) {
+            begin = PartitionLeft(ctx, begin, end) + size;
+            continue;
+        }
+
+        bool already_partitioned;
+        char *pivot_pos = PartitionRight(ctx, begin, end, &already_partitioned);
+        const size_t l_count = (size_t)(pivot_pos - begin) / size;
+        const size_t r_count = (size_t)(end - (pivot_pos + size)) / size;
+
+        if (l_count < count / 8 || r_count < count / 8) {
+            // Too many bad partitions, fall back to something with a guaranteed worst case
+            if (--bad_allowed == 0) {
+                HeapSort(ctx, begin, end);
+                return;
+            }
+
+            // Shuffle some elements around to break up whatever pattern caused this
+            if (l_count >= SORT_INSERTION_THRESHOLD) {
+                SortSwap(ctx, begin, begin + (l_count / 4) * size);
+                SortSwap(ctx, pivot_pos - size, pivot_pos - (l_count / 4) * size);
+                if (l_count > SORT_NINTHER_THRESHOLD) {
+                    SortSwap(ctx, begin + size, begin + (l_count / 4 + 1) * size);
+                    SortSwap(ctx, begin + 2 * size, begin + (l_count / 4 + 2) * size);
+                    SortSwap(ctx, pivot_pos - 2 * size, pivot_pos - (l_count / 4 + 1) * size);
+                    SortSwap(ctx, pivot_pos - 3 * size, pivot_pos - (l_count / 4 + 2) * size);
+                }
+            }
+            if (r_count >= SORT_INSERTION_THRESHOLD) {
+                SortSwap(ctx, pivot_pos + size, pivot_pos + (1 + r_count / 4) * size);
+                SortSwap(ctx, end - size, end - (r_count / 4) * size);
+                if (r_count > SORT_NINTHER_THRESHOLD) {
+                    SortSwap(ctx, pivot_pos + 2 * size, pivot_pos + (2 + r_count / 4) * size);
+                    SortSwap(ctx, pivot_pos + 3 * size, pivot_pos + (3 + r_count / 4) * size);
+                    SortSwap(ctx, end - 2 * size, end - (1 + r_count / 4) * size);
+                    SortSwap(ctx, end - 3 * size, end - (2 + r_count / 4) * size);
+                }
+            }
+        } else if (already_partitioned &&
+                   PartialInsertionSort(ctx, begin, pivot_pos) &&
+                   PartialInsertionSort(ctx, pivot_pos + size, end)) {
+            // The range was (nearly) sorted already
+            return;
+        }
+
+        // Recurse into the left side and loop on the right
+        PatternDefeatingSort(ctx, begin, pivot_pos, bad_allowed, leftmost);
+        begin = pivot_pos + size;
+        leftmost = false;
     }
-  }
-  PreInsertion(SWAP_aligned,TRUNC_aligned,size);
-  Insertion(SWAP_aligned);
-  free(pivot);
 }
 
-static void qsort_r_words(void *base, size_t nmemb,
-           int (SDLCALL *compare)(void *,const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(WORD_BYTES);
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*WORD_BYTES;
-
-  if (last-first>=TRUNC_words) {
-    char *ffirst=first, *llast=last;
-    while (1) {
-#ifdef DEBUG_QSORT
-fprintf(stderr,"Doing %d:%d: ",
-        (first-(char*)base)/WORD_BYTES,
-        (last-(char*)base)/WORD_BYTES);
-#endif
-      /* Select pivot */
-      { char * mid=first+WORD_BYTES*((last-first) / (2*WORD_BYTES));
-        Pivot(SWAP_words,WORD_BYTES);
-        *(int*)pivot=*(int*)mid;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"pivot = %p = #%lu = %d\n", mid, (unsigned long)(((int*)mid)-((int*)base)), *(int*)mid);
-#endif
-      }
-      /* Partition. */
-      Partition(SWAP_words,WORD_BYTES);
-#ifdef DEBUG_QSORT
-fprintf(stderr, "after partitioning first=#%lu last=#%lu\n", (first-(char*)base)/4lu, (last-(char*)base)/4lu);
-#endif
-      /* Prepare to recurse/iterate. */
-      Recurse(TRUNC_words)
+static void InitSortContext(SDL_SortContext *ctx, void *base, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    ctx->size = size;
+    if ((((uintptr_t)base | size) & (sizeof(Uint64) - 1)) == 0) {
+        ctx->swap_type = SORT_SWAP_UINT64;
+    } else if ((((uintptr_t)base | size) & (sizeof(Uint32) - 1)) == 0) {
+        ctx->swap_type = SORT_SWAP_UINT32;
+    } else {
+        ctx->swap_type = SORT_SWAP_BYTES;
     }
-  }
-  PreInsertion(SWAP_words,TRUNC_words/WORD_BYTES,WORD_BYTES);
-  /* Now do insertion sort. */
-  last=((char*)base)+nmemb*WORD_BYTES;
-  for (first=((char*)base)+WORD_BYTES;first!=last;first+=WORD_BYTES) {
-    /* Find the right place for |first|. My apologies for var reuse */
-    int *pl=(int*)(first-WORD_BYTES),*pr=(int*)first;
-    *(int*)pivot=*(int*)first;
-    for (;compare(userdata,pl,pivot)>0;pr=pl,--pl) {
-      *pr=*pl; }
-    if (pr!=(int*)first) *pr=*(int*)pivot;
-  }
-  free(pivot);
+    ctx->compare = compare;
+    ctx->userdata = userdata;
 }
 
-/* ---------------------------------------------------------------------- */
+void SDL_qsort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    SDL_SortContext ctx;
+
+    if (nmemb <= 1 || size == 0) {
+        return;
+    }
 
-void SDL_qsort_r(void *base, size_t nmemb, size_t size,
-           SDL_CompareCallback_r compare, void *userdata) {
+    InitSortContext(&ctx, base, size, compare, userdata);
 
-  if (nmemb<=1) return;
-  if (((uintptr_t)base|size)&(WORD_BYTES-1))
-    qsort_r_nonaligned(base,nmemb,size,compare,userdata);
-  else if (size!=WORD_BYTES)
-    qsort_r_aligned(base,nmemb,size,compare,userdata);
-  else
-    qsort_r_words(base,nmemb,compare,userdata);
+    PatternDefeatingSort(&ctx, (char *)base, (char *)base + nmemb * size, SDL_MostSignificantBitIndex32((Uint32)SDL_min(nmemb, SDL_MAX_UINT32)) + 1, true);
 }
 
 static int SDLCALL qsort_non_r_bridge(void *userdata, const void *a, const void *b)
@@ -538,6 +418,145 @@ void SDL_qsort(void *base, size_t nmemb, size_t size, SDL_CompareCallback compar
     SDL_qsort_r(base, nmemb, size, qsort_non_r_bridge, compare);
 }
 
+// Below this many elements, SDL_SortByKey() uses an insertion sort instead of a radix sort
+#define SORT_RADIX_THRESHOLD 64
+
+static int GetSortKeySize(SDL_SortKeyType key_type)
+{
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+    case SDL_SORTKEY_SINT32:
+    case SDL_SORTKEY_FLOAT:
+        return 4;
+    case SDL_SORTKEY_UINT64:
+    case SDL_SORTKEY_SINT64:
+    case SDL_SORTKEY_DOUBLE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+// Returns the key in a form where unsigned comparison gives the right order
+static SDL_INLINE Uint64 GetSortKey(const char *key, SDL_SortKeyType key_type)
+{
+    Uint32 value32;
+    Uint64 value64;
+
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+        SDL_memcpy(&value32, key, sizeof(value32));
+        return value32;
+    case SDL_SORTKEY_SINT32:
+        SDL_memcpy(&value32, key, sizeof(value32));
+        return value32 ^ 0x80000000u;
+    case SDL_SORTKEY_FLOAT:
+        SDL_memcpy(&value32, key, sizeof(value32));
+        return (value32 & 0x80000000u) ? ~value32 : (value32 | 0x80000000u);
+    case SDL_SORTKEY_UINT64:
+        SDL_memcpy(&value64, key, sizeof(value64));
+        return value64;
+    case SDL_SORTKEY_SINT64:
+        SDL_memcpy(&value64, key, sizeof(value64));
+        return value64 ^ SDL_UINT64_C(0x8000000000000000);
+    case SDL_SORTKEY_DOUBLE:
+        SDL_memcpy(&value64, key, sizeof(value64));
+        return (value64 & SDL_UINT64_C(0x8000000000000000)) ? ~value64 : (value64 | SDL_UINT64_C(0x8000000000000000));
+    default:
+        return 0;
+    }
+}
+
+bool SDL_SortByKey(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type)
+{
+    const int key_size = GetSortKeySize(key_type);
+    size_t (*counts)[256];
+    char *src, *dst, *scratch;
+    size_t total_size;
+
+    if (key_size == 0) {
+        return SDL_InvalidParamError("key_type");
+    }
+    if (key_offset > size || size - key_offset < (size_t)key_size) {
+        return SDL_InvalidParamError("key_offset");
+    }
+    if (nmemb <= 1) {
+        return true;
+    }
+    if (!base) {
+        return SDL_InvalidParamError("base");
+    }
+
+    if (nmemb < SORT_RADIX_THRESHOLD) {
+        // This is stable, since only elements with strictly smaller keys move past each other
+        SDL_SortContext ctx;
+        char *begin = (char *)base;
+        char *end = begin + nmemb * size;
+
+        InitSortContext(&ctx, base, size, NULL, NULL);
+        for (char *cur = begin + size; cur < end; cur += size) {
+            for (char *sift = cur; sift > begin && GetSortKey(sift + key_offset, key_type) < GetSortKey(sift - size + key_offset, key_type); sift -= size) {
+                SortSwap(&ctx, sift, sift - size);
+            }
+        }
+        return true;
+    }
+
+    // Each pass sorts on 8 bits of the key, moving the elements between the array and a scratch buffer
+    if (!SDL_size_mul_check_overflow(nmemb, size, &total_size) ||
+        !SDL_size_add_check_overflow(total_size, key_size * sizeof(*counts), &total_size)) {
+        return SDL_OutOfMemory();
+    }
+    counts = (size_t (*)[256])SDL_malloc(total_size);
+    if (!counts) {
+        return false;
+    }
+    SDL_memset(counts, 0, key_size * sizeof(*counts));
+    scratch = (char *)(counts + key_size);
+
+    src = (char *)base;
+    for (size_t i = 0; i < nmemb; ++i) {
+        const Uint64 key = GetSortKey(src + i * size + key_offset, key_type);
+        for (int digit = 0; digit < key_size; ++digit) {
+            ++counts[digit][(key >> (digit * 8)) & 0xFF];
+        }
+    }
+
+    dst = scratch;
+    for (int digit = 0; digit < key_size; ++digit) {
+        const int shift = digit * 8;
+        size_t *offsets = counts[digit];
+        size_t offset = 0;
+
+        // If every key has the same value here, this pass wouldn't change anything
+        if (offsets[(GetSortKey(src + key_offset, key_type) >> shift) & 0xFF] == nmemb) {
+            continue;
+        }
+
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            const size_t count = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < nmemb; ++i) {
+            const char *element = src + i * size;
+            const size_t bucket = (size_t)((GetSortKey(element + key_offset, key_type) >> shift) & 0xFF);
+            SDL_memcpy(dst + offsets[bucket]++ * size, element, size);
+        }
+
+        char *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != (char *)base) {
+        SDL_memcpy(base, src, nmemb * size);
+    }
+    SDL_free(counts);
+    return true;
+}
+
 // Don't use the C runtime for such a simple function, since we want to allow SDLCALL callbacks and userdata.
 // SDL's replacement: Taken from the Public Domain C Library (PDCLib):
 // Permission is granted to use, modify, and / or redistribute at will.
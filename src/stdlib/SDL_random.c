@@ -113,3 +113,224 @@ float SDL_randf_r(Uint64 *state)
     return (SDL_rand_bits_r(state) >> (32 - 24)) * 0x1p-24f;
 }
 
+
+/* The bulk functions use Philox4x32-10, from "Parallel Random Numbers: As
+   Easy as 1, 2, 3" by Salmon, Moraes, Dror and Shaw. Each block of four
+   values is the encryption of its index with the state as the key, so
+   blocks are independent and several can be computed side by side. */
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PHILOX_SSE2
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define PHILOX_NEON
+#endif
+
+static void Philox4x32(Uint64 counter, Uint64 key, Uint32 out[4])
+{
+    Uint32 x0 = (Uint32)counter;
+    Uint32 x1 = (Uint32)(counter >> 32);
+    Uint32 x2 = 0;
+    Uint32 x3 = 0;
+    Uint32 k0 = (Uint32)key;
+    Uint32 k1 = (Uint32)(key >> 32);
+
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        const Uint64 p0 = (Uint64)PHILOX_M0 * x0;
+        const Uint64 p1 = (Uint64)PHILOX_M1 * x2;
+        x0 = (Uint32)(p1 >> 32) ^ x1 ^ k0;
+        x2 = (Uint32)(p0 >> 32) ^ x3 ^ k1;
+        x1 = (Uint32)p1;
+        x3 = (Uint32)p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    out[0] = x0;
+    out[1] = x1;
+    out[2] = x2;
+    out[3] = x3;
+}
+
+#ifdef PHILOX_SSE2
+// Returns the low and high 32 bits of the products of each lane with m
+static SDL_INLINE void Philox_MulHiLo(__m128i x, __m128i m, __m128i *lo, __m128i *hi)
+{
+    const __m128i p02 = _mm_shuffle_epi32(_mm_mul_epu32(x, m), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i p13 = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(x, 32), m), _MM_SHUFFLE(3, 1, 2, 0));
+    *lo = _mm_unpacklo_epi32(p02, p13);
+    *hi = _mm_unpackhi_epi32(p02, p13);
+}
+
+static SDL_INLINE __m128i Philox_Counter(Uint64 counter, int shift)
+{
+    return _mm_set_epi32((int)(Uint32)((counter + 3) >> shift), (int)(Uint32)((counter + 2) >> shift), (int)(Uint32)((counter + 1) >> shift), (int)(Uint32)(counter >> shift));
+}
+
+static SDL_INLINE void Philox_Store(__m128i x0, __m128i x1, __m128i x2, __m128i x3, Uint32 *values)
+{
+    // Transpose so each block's values are together
+    const __m128i t0 = _mm_unpacklo_epi32(x0, x1);
+    const __m128i t1 = _mm_unpacklo_epi32(x2, x3);
+    const __m128i t2 = _mm_unpackhi_epi32(x0, x1);
+    const __m128i t3 = _mm_unpackhi_epi32(x2, x3);
+    _mm_storeu_si128((__m128i *)values, _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(values + 4), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(values + 8), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *)(values + 12), _mm_unpackhi_epi64(t2, t3));
+}
+
+// Generates 8 blocks, 32 values, as two independent sets of 4 to keep the multipliers busy
+static void Philox4x32x8(Uint64 counter, Uint64 key, Uint32 *values)
+{
+    __m128i a0 = Philox_Counter(counter, 0);
+    __m128i a1 = Philox_Counter(counter, 32);
+    __m128i b0 = Philox_Counter(counter + 4, 0);
+    __m128i b1 = Philox_Counter(counter + 4, 32);
+    __m128i a2 = _mm_setzero_si128(), a3 = _mm_setzero_si128();
+    __m128i b2 = _mm_setzero_si128(), b3 = _mm_setzero_si128();
+    __m128i k0 = _mm_set1_epi32((int)(Uint32)key);
+    __m128i k1 = _mm_set1_epi32((int)(Uint32)(key >> 32));
+    const __m128i m0 = _mm_set1_epi32((int)PHILOX_M0);
+    const __m128i m1 = _mm_set1_epi32((int)PHILOX_M1);
+    const __m128i w0 = _mm_set1_epi32((int)PHILOX_W0);
+    const __m128i w1 = _mm_set1_epi32((int)PHILOX_W1);
+
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        __m128i alo0, ahi0, alo1, ahi1, blo0, bhi0, blo1, bhi1;
+        Philox_MulHiLo(a0, m0, &alo0, &ahi0);
+        Philox_MulHiLo(a2, m1, &alo1, &ahi1);
+        Philox_MulHiLo(b0, m0, &blo0, &bhi0);
+        Philox_MulHiLo(b2, m1, &blo1, &bhi1);
+        a0 = _mm_xor_si128(_mm_xor_si128(ahi1, a1), k0);
+        a2 = _mm_xor_si128(_mm_xor_si128(ahi0, a3), k1);
+        a1 = alo1;
+        a3 = alo0;
+        b0 = _mm_xor_si128(_mm_xor_si128(bhi1, b1), k0);
+        b2 = _mm_xor_si128(_mm_xor_si128(bhi0, b3), k1);
+        b1 = blo1;
+        b3 = blo0;
+        k0 = _mm_add_epi32(k0, w0);
+        k1 = _mm_add_epi32(k1, w1);
+    }
+
+    Philox_Store(a0, a1, a2, a3, values);
+    Philox_Store(b0, b1, b2, b3, values + 16);
+}
+#elif defined(PHILOX_NEON)
+// Returns the low and high 32 bits of the products of each lane with m
+static SDL_INLINE void Philox_MulHiLo(uint32x4_t x, uint32x4_t m, uint32x4_t *lo, uint32x4_t *hi)
+{
+    const uint32x4_t p01 = vreinterpretq_u32_u64(vmull_u32(vget_low_u32(x), vget_low_u32(m)));
+    const uint32x4_t p23 = vreinterpretq_u32_u64(vmull_high_u32(x, m));
+    *lo = vuzp1q_u32(p01, p23);
+    *hi = vuzp2q_u32(p01, p23);
+}
+
+static SDL_INLINE void Philox_Init(uint32x4x4_t *x, Uint64 counter)
+{
+    const Uint32 c0[4] = { (Uint32)counter, (Uint32)(counter + 1), (Uint32)(counter + 2), (Uint32)(counter + 3) };
+    const Uint32 c1[4] = { (Uint32)(counter >> 32), (Uint32)((counter + 1) >> 32), (Uint32)((counter + 2) >> 32), (Uint32)((counter + 3) >> 32) };
+
+    x->val[0] = vld1q_u32(c0);
+    x->val[1] = vld1q_u32(c1);
+    x->val[2] = vdupq_n_u32(0);
+    x->val[3] = vdupq_n_u32(0);
+}
+
+static SDL_INLINE void Philox_Round(uint32x4x4_t *x, uint32x4_t k0, uint32x4_t k1)
+{
+    uint32x4_t lo0, hi0, lo1, hi1;
+
+    Philox_MulHiLo(x->val[0], vdupq_n_u32(PHILOX_M0), &lo0, &hi0);
+    Philox_MulHiLo(x->val[2], vdupq_n_u32(PHILOX_M1), &lo1, &hi1);
+    x->val[0] = veorq_u32(veorq_u32(hi1, x->val[1]), k0);
+    x->val[2] = veorq_u32(veorq_u32(hi0, x->val[3]), k1);
+    x->val[1] = lo1;
+    x->val[3] = lo0;
+}
+
+// Generates 8 blocks, 32 values, as two independent sets of 4 to keep the multipliers busy
+static void Philox4x32x8(Uint64 counter, Uint64 key, Uint32 *values)
+{
+    uint32x4x4_t a, b;
+    uint32x4_t k0 = vdupq_n_u32((Uint32)key);
+    uint32x4_t k1 = vdupq_n_u32((Uint32)(key >> 32));
+
+    Philox_Init(&a, counter);
+    Philox_Init(&b, counter + 4);
+
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        Philox_Round(&a, k0, k1);
+        Philox_Round(&b, k0, k1);
+        k0 = vaddq_u32(k0, vdupq_n_u32(PHILOX_W0));
+        k1 = vaddq_u32(k1, vdupq_n_u32(PHILOX_W1));
+    }
+
+    // These interleave the lanes, so each block's values are together
+    vst4q_u32(values, a);
+    vst4q_u32(values + 16, b);
+}
+#endif
+
+// Fills values with the blocks starting at counter
+static void PhiloxFill(Uint64 key, Uint64 counter, Uint32 *values, size_t count)
+{
+#if defined(PHILOX_SSE2) || defined(PHILOX_NEON)
+    for (; count >= 32; count -= 32) {
+        Philox4x32x8(counter, key, values);
+        counter += 8;
+        values += 32;
+    }
+#endif
+    for (; count >= 4; count -= 4) {
+        Philox4x32(counter, key, values);
+        ++counter;
+        values += 4;
+    }
+    if (count > 0) {
+        Uint32 block[4];
+        Philox4x32(counter, key, block);
+        SDL_memcpy(values, block, count * sizeof(*values));
+    }
+}
+
+void SDL_rand_fill_r(Uint64 *state, Uint32 *values, size_t count)
+{
+    if (!state || !values) {
+        return;
+    }
+
+    PhiloxFill(*state, 0, values, count);
+
+    // Step the state the same way SDL_rand_bits_r() does, so the next call uses a different key
+    (void)SDL_rand_bits_r(state);
+}
+
+void SDL_randf_fill_r(Uint64 *state, float *values, size_t count)
+{
+    Uint32 bits[64];  // must be a multiple of 4 values, so chunks start on a block
+    Uint64 counter = 0;
+
+    if (!state || !values) {
+        return;
+    }
+
+    while (count > 0) {
+        const size_t chunk = SDL_min(count, SDL_arraysize(bits));
+
+        PhiloxFill(*state, counter, bits, chunk);
+        for (size_t i = 0; i < chunk; ++i) {
+            values[i] = (bits[i] >> (32 - 24)) * 0x1p-24f;
+        }
+        counter += chunk / 4;
+        values += chunk;
+        count -= chunk;
+    }
+
+    (void)SDL_rand_bits_r(state);
+}
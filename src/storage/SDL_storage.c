@@ -23,9 +23,11 @@
 
 #include "SDL_sysstorage.h"
 #include "../filesystem/SDL_sysfilesystem.h"
+#include "../SDL_hashtable.h"
 
 // Available title storage drivers
 static TitleStorageBootStrap *titlebootstrap[] = {
+    &PACK_titlebootstrap,
     &GENERIC_titlebootstrap,
     NULL
 };
@@ -42,10 +44,29 @@ static UserStorageBootStrap *userbootstrap[] = {
     NULL
 };
 
+// A directory listing kept for globbing, sorted by name.
+typedef struct StorageCacheEntry
+{
+    char *name;
+    SDL_PathType type;  // SDL_PATHTYPE_NONE until someone asks
+} StorageCacheEntry;
+
+typedef struct StorageCacheDirectory
+{
+    char *path;     // the hash key, "" for the root
+    char *dirname;  // what enumeration callbacks get: the path with a '/' on the end
+    int num_entries;
+    int max_entries;
+    StorageCacheEntry *entries;
+} StorageCacheDirectory;
+
 struct SDL_Storage
 {
     SDL_StorageInterface iface;
     void *userdata;
+    char *watch_path;              // where the storage lives in the filesystem, if it does
+    SDL_HashTable *dircache;       // path -> StorageCacheDirectory, NULL unless caching is enabled
+    SDL_DirectoryWatch *dirwatch;  // NULL if we can't watch for outside changes
 };
 
 #define CHECK_STORAGE_MAGIC()                             \
@@ -175,6 +196,15 @@ SDL_Storage *SDL_OpenFileStorage(const char *path)
     return GENERIC_OpenFileStorage(path);
 }
 
+SDL_Storage *SDL_OpenPackStorage(const char *file)
+{
+    if (!file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+    return PACK_OpenStorage(file);
+}
+
 SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
 {
     SDL_Storage *storage;
@@ -197,19 +227,34 @@ SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
     return storage;
 }
 
+void SDL_SetStorageWatchPath(SDL_Storage *storage, const char *path)
+{
+    SDL_free(storage->watch_path);
+    storage->watch_path = path ? SDL_strdup(path) : NULL;
+}
+
 bool SDL_CloseStorage(SDL_Storage *storage)
 {
     bool result = true;
 
     CHECK_STORAGE_MAGIC()
 
+    SDL_SetStorageDirectoryCaching(storage, false);
     if (storage->iface.close) {
         result = storage->iface.close(storage->userdata);
     }
+    SDL_free(storage->watch_path);
     SDL_free(storage);
     return result;
 }
 
+static void InvalidateStorageDirectoryCache(SDL_Storage *storage)
+{
+    if (storage->dircache) {
+        SDL_ClearHashTable(storage->dircache);
+    }
+}
+
 bool SDL_StorageReady(SDL_Storage *storage)
 {
     CHECK_STORAGE_MAGIC_RET(false)
@@ -264,7 +309,9 @@ bool SDL_WriteStorageFile(SDL_Storage *storage, const char *path, const void *so
         return SDL_Unsupported();
     }
 
-    return storage->iface.write_file(storage->userdata, path, source, length);
+    const bool result = storage->iface.write_file(storage->userdata, path, source, length);
+    InvalidateStorageDirectoryCache(storage);
+    return result;
 }
 
 bool SDL_CreateStorageDirectory(SDL_Storage *storage, const char *path)
@@ -279,7 +326,9 @@ bool SDL_CreateStorageDirectory(SDL_Storage *storage, const char *path)
         return SDL_Unsupported();
     }
 
-    return storage->iface.mkdir(storage->userdata, path);
+    const bool result = storage->iface.mkdir(storage->userdata, path);
+    InvalidateStorageDirectoryCache(storage);
+    return result;
 }
 
 bool SDL_EnumerateStorageDirectory(SDL_Storage *storage, const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata)
@@ -311,7 +360,9 @@ bool SDL_RemoveStoragePath(SDL_Storage *storage, const char *path)
         return SDL_Unsupported();
     }
 
-    return storage->iface.remove(storage->userdata, path);
+    const bool result = storage->iface.remove(storage->userdata, path);
+    InvalidateStorageDirectoryCache(storage);
+    return result;
 }
 
 bool SDL_RenameStoragePath(SDL_Storage *storage, const char *oldpath, const char *newpath)
@@ -330,7 +381,32 @@ bool SDL_RenameStoragePath(SDL_Storage *storage, const char *oldpath, const char
         return SDL_Unsupported();
     }
 
-    return storage->iface.rename(storage->userdata, oldpath, newpath);
+    const bool result = storage->iface.rename(storage->userdata, oldpath, newpath);
+    InvalidateStorageDirectoryCache(storage);
+    return result;
+}
+
+// For backends that can't copy on their own. The interface only reads and writes whole files, so this needs memory for all of it.
+static bool CopyStorageFileThroughMemory(SDL_Storage *storage, const char *oldpath, const char *newpath)
+{
+    Uint64 length;
+
+    if (!storage->iface.read_file || !storage->iface.write_file || !storage->iface.info) {
+        return SDL_Unsupported();
+    } else if (!SDL_GetStorageFileSize(storage, oldpath, &length)) {
+        return false;
+    } else if (length > SDL_SIZE_MAX) {
+        return SDL_SetError("File too large to copy");
+    }
+
+    void *data = SDL_malloc((size_t)length);
+    if (!data) {
+        return false;
+    }
+    const bool result = SDL_ReadStorageFile(storage, oldpath, data, length) &&
+                        SDL_WriteStorageFile(storage, newpath, data, length);
+    SDL_free(data);
+    return result;
 }
 
 bool SDL_CopyStorageFile(SDL_Storage *storage, const char *oldpath, const char *newpath)
@@ -346,10 +422,12 @@ bool SDL_CopyStorageFile(SDL_Storage *storage, const char *oldpath, const char *
     } else if (!ValidateStoragePath(newpath)) {
         return false;
     } else if (!storage->iface.copy) {
-        return SDL_Unsupported();
+        return CopyStorageFileThroughMemory(storage, oldpath, newpath);
     }
 
-    return storage->iface.copy(storage->userdata, oldpath, newpath);
+    const bool result = storage->iface.copy(storage->userdata, oldpath, newpath);
+    InvalidateStorageDirectoryCache(storage);
+    return result;
 }
 
 bool SDL_GetStoragePathInfo(SDL_Storage *storage, const char *path, SDL_PathInfo *info)
@@ -396,6 +474,146 @@ static bool GlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirect
     return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, cb, cbuserdata);
 }
 
+static void SDLCALL DestroyStorageCacheDirectory(void *userdata, const void *key, const void *value)
+{
+    StorageCacheDirectory *dir = (StorageCacheDirectory *)value;
+    int i;
+
+    for (i = 0; i < dir->num_entries; i++) {
+        SDL_free(dir->entries[i].name);
+    }
+    SDL_free(dir->entries);
+    SDL_free(dir->dirname);
+    SDL_free(dir->path);
+    SDL_free(dir);
+}
+
+static SDL_EnumerationResult SDLCALL CollectStorageCacheEntry(void *userdata, const char *dirname, const char *fname)
+{
+    StorageCacheDirectory *dir = (StorageCacheDirectory *)userdata;
+
+    if (dir->num_entries == dir->max_entries) {
+        const int max_entries = dir->max_entries ? (dir->max_entries * 2) : 16;
+        StorageCacheEntry *entries = (StorageCacheEntry *)SDL_realloc(dir->entries, max_entries * sizeof(*entries));
+        if (!entries) {
+            return SDL_ENUM_FAILURE;
+        }
+        dir->entries = entries;
+        dir->max_entries = max_entries;
+    }
+
+    StorageCacheEntry *entry = &dir->entries[dir->num_entries];
+    entry->name = SDL_strdup(fname);
+    if (!entry->name) {
+        return SDL_ENUM_FAILURE;
+    }
+    entry->type = SDL_PATHTYPE_NONE;
+    dir->num_entries++;
+    return SDL_ENUM_CONTINUE;
+}
+
+static int SDLCALL CompareStorageCacheEntries(const void *a, const void *b)
+{
+    return SDL_strcmp(((const StorageCacheEntry *)a)->name, ((const StorageCacheEntry *)b)->name);
+}
+
+static StorageCacheDirectory *GetStorageCacheDirectory(SDL_Storage *storage, const char *path, bool *owned)
+{
+    StorageCacheDirectory *dir = NULL;
+
+    *owned = false;
+    if (SDL_FindInHashTable(storage->dircache, path, (const void **)&dir)) {
+        return dir;
+    }
+
+    dir = (StorageCacheDirectory *)SDL_calloc(1, sizeof(*dir));
+    if (!dir) {
+        return NULL;
+    }
+    dir->path = SDL_strdup(path);
+    if (!dir->path || SDL_asprintf(&dir->dirname, "%s%s", path, *path ? "/" : "") < 0 ||
+        !SDL_EnumerateStorageDirectory(storage, path, CollectStorageCacheEntry, dir)) {
+        DestroyStorageCacheDirectory(NULL, NULL, dir);
+        return NULL;
+    }
+    SDL_qsort(dir->entries, dir->num_entries, sizeof(*dir->entries), CompareStorageCacheEntries);
+
+    // Only keep the listing if we'll hear about changes to it. Without a watch, only our own changes are seen.
+    bool watched = true;
+    if (storage->dirwatch && *path) {
+        char *fullpath = NULL;
+        if (SDL_asprintf(&fullpath, "%s%s", storage->watch_path, path) < 0) {
+            watched = false;
+        } else {
+            watched = SDL_SYS_AddDirectoryWatch(storage->dirwatch, fullpath);
+            SDL_free(fullpath);
+        }
+    }
+    if (!watched || !SDL_InsertIntoHashTable(storage->dircache, dir->path, dir, false)) {
+        *owned = true;  // the caller frees it when done.
+    }
+    return dir;
+}
+
+static bool CachedGlobStorageDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void *userdata)
+{
+    SDL_Storage *storage = (SDL_Storage *)userdata;
+    StorageCacheDirectory *dir = NULL;
+    const char *name = SDL_strrchr(path, '/');
+    char *parent;
+
+    // The glob only ever asks about things it just enumerated, so the parent should be cached.
+    if (name) {
+        parent = SDL_strndup(path, name - path);
+        ++name;
+    } else {
+        parent = SDL_strdup("");
+        name = path;
+    }
+    if (parent) {
+        SDL_FindInHashTable(storage->dircache, parent, (const void **)&dir);
+        SDL_free(parent);
+    }
+
+    StorageCacheEntry key;
+    key.name = (char *)name;
+    StorageCacheEntry *entry = dir ? (StorageCacheEntry *)SDL_bsearch(&key, dir->entries, dir->num_entries, sizeof(*dir->entries), CompareStorageCacheEntries) : NULL;
+    if (!entry) {
+        return SDL_GetStoragePathInfo(storage, path, info);
+    }
+
+    if (entry->type == SDL_PATHTYPE_NONE) {
+        if (!SDL_GetStoragePathInfo(storage, path, info)) {
+            return false;
+        }
+        entry->type = info->type;
+    } else {
+        SDL_zerop(info);
+        info->type = entry->type;
+    }
+    return true;
+}
+
+static bool CachedGlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+{
+    SDL_Storage *storage = (SDL_Storage *)userdata;
+    SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
+    bool owned;
+    int i;
+
+    StorageCacheDirectory *dir = GetStorageCacheDirectory(storage, path, &owned);
+    if (!dir) {
+        return false;
+    }
+    for (i = 0; (i < dir->num_entries) && (result == SDL_ENUM_CONTINUE); i++) {
+        result = cb(cbuserdata, dir->dirname, dir->entries[i].name);
+    }
+    if (owned) {
+        DestroyStorageCacheDirectory(NULL, NULL, dir);
+    }
+    return (result != SDL_ENUM_FAILURE);
+}
+
 char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
 {
     CHECK_STORAGE_MAGIC_RET(NULL)
@@ -408,6 +626,41 @@ char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const ch
         return NULL;
     }
 
+    if (storage->dircache) {
+        if (storage->dirwatch && SDL_SYS_DirectoryWatchChanged(storage->dirwatch)) {
+            InvalidateStorageDirectoryCache(storage);
+        }
+        return SDL_InternalGlobDirectory(path, pattern, flags, count, CachedGlobStorageDirectoryEnumerator, CachedGlobStorageDirectoryGetPathInfo, storage);
+    }
+
     return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobStorageDirectoryEnumerator, GlobStorageDirectoryGetPathInfo, storage);
 }
 
+bool SDL_SetStorageDirectoryCaching(SDL_Storage *storage, bool enabled)
+{
+    CHECK_STORAGE_MAGIC()
+
+    if (!enabled) {
+        SDL_SYS_DestroyDirectoryWatch(storage->dirwatch);
+        storage->dirwatch = NULL;
+        SDL_DestroyHashTable(storage->dircache);
+        storage->dircache = NULL;
+        return true;
+    }
+
+    if (storage->dircache) {
+        return true;  // already enabled.
+    }
+
+    storage->dircache = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, DestroyStorageCacheDirectory, NULL);
+    if (!storage->dircache) {
+        return false;
+    }
+
+    if (storage->watch_path) {
+        // If this fails, caching still works, it just won't notice changes made behind our back.
+        storage->dirwatch = SDL_SYS_CreateDirectoryWatch(storage->watch_path);
+    }
+    return true;
+}
+
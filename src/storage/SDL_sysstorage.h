@@ -40,6 +40,7 @@ typedef struct UserStorageBootStrap
 
 // Not all of these are available in a given build. Use #ifdefs, etc.
 
+extern TitleStorageBootStrap PACK_titlebootstrap;
 extern TitleStorageBootStrap GENERIC_titlebootstrap;
 // Steam does not have title storage APIs
 
@@ -48,5 +49,9 @@ extern UserStorageBootStrap PRIVATE_userbootstrap;
 extern UserStorageBootStrap STEAM_userbootstrap;
 
 extern SDL_Storage *GENERIC_OpenFileStorage(const char *path);
+extern SDL_Storage *PACK_OpenStorage(const char *file);
+
+// Lets the directory cache watch the filesystem for changes under `path`.
+extern void SDL_SetStorageWatchPath(SDL_Storage *storage, const char *path);
 
 #endif // SDL_sysstorage_h_
@@ -254,6 +254,8 @@ static SDL_Storage *GENERIC_Title_Create(const char *override, SDL_PropertiesID
         result = SDL_OpenStorage(&GENERIC_title_iface, basepath);
         if (result == NULL) {
             SDL_free(basepath);  // otherwise CloseStorage will free it.
+        } else {
+            SDL_SetStorageWatchPath(result, basepath);
         }
     }
 
@@ -292,6 +294,8 @@ static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_Pr
     result = SDL_OpenStorage(&GENERIC_user_iface, prefpath);
     if (result == NULL) {
         SDL_free(prefpath);  // otherwise CloseStorage will free it.
+    } else {
+        SDL_SetStorageWatchPath(result, prefpath);
     }
     return result;
 }
@@ -346,6 +350,8 @@ SDL_Storage *GENERIC_OpenFileStorage(const char *path)
     result = SDL_OpenStorage(&GENERIC_file_iface, basepath);
     if (result == NULL) {
         SDL_free(basepath);
+    } else if (basepath) {
+        SDL_SetStorageWatchPath(result, basepath);
     }
     return result;
 }
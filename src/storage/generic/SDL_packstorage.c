@@ -0,0 +1,506 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+
+#include "SDL_internal.h"
+
+#include "../SDL_sysstorage.h"
+
+// A pack is a read-only archive with a sorted index of the files in it. The
+// index is loaded up front, so looking up, enumerating and globbing paths
+// never touch the filesystem. See SDL_OpenPackStorage() for the layout.
+
+#define PACK_MAGIC       "SDL_PACK"
+#define PACK_VERSION     1
+#define PACK_HEADER_SIZE 32
+#define PACK_ENTRY_SIZE  32
+
+#define PACK_COMPRESSION_NONE 0
+#define PACK_COMPRESSION_LZ4  1
+
+typedef struct PackEntry
+{
+    const char *name;
+    Uint64 offset;
+    Uint64 stored_size;
+    Uint64 size;
+    Uint32 compression;
+} PackEntry;
+
+typedef struct PackStorage
+{
+    SDL_IOStream *io;
+    const Uint8 *data;  // the whole pack if it's mapped, otherwise NULL and reads go through io.
+    SDL_Mutex *lock;    // serializes seeking and reading io when the pack isn't mapped.
+    char *names;
+    PackEntry *entries;
+    Uint32 num_entries;
+} PackStorage;
+
+// Decompress a single LZ4 block, which must fill dst exactly.
+static bool PACK_DecompressLZ4(const Uint8 *src, size_t srclen, Uint8 *dst, size_t dstlen)
+{
+    const Uint8 *ip = src;
+    const Uint8 *iend = src + srclen;
+    Uint8 *op = dst;
+    Uint8 *oend = dst + dstlen;
+
+    while (ip < iend) {
+        const Uint8 token = *ip++;
+        size_t len = token >> 4;
+        Uint8 b;
+
+        if (len == 15) {
+            do {
+                if (ip == iend) {
+                    return false;
+                }
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > (size_t)(iend - ip) || len > (size_t)(oend - op)) {
+            return false;
+        }
+        SDL_memcpy(op, ip, len);
+        ip += len;
+        op += len;
+
+        if (ip == iend) {
+            break;  // the last sequence is only literals.
+        }
+
+        if ((iend - ip) < 2) {
+            return false;
+        }
+        const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) {
+            return false;
+        }
+
+        len = token & 15;
+        if (len == 15) {
+            do {
+                if (ip == iend) {
+                    return false;
+                }
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (size_t)(oend - op)) {
+            return false;
+        }
+
+        const Uint8 *match = op - offset;
+        if (offset >= len) {
+            SDL_memcpy(op, match, len);
+            op += len;
+        } else {
+            while (len--) {  // overlapping copies repeat the last `offset` bytes.
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return (op == oend);
+}
+
+static const PackEntry *PACK_FindFile(const PackStorage *pack, const char *path)
+{
+    Uint32 lo = 0, hi = pack->num_entries;
+
+    while (lo < hi) {
+        const Uint32 mid = lo + (hi - lo) / 2;
+        const int cmp = SDL_strcmp(pack->entries[mid].name, path);
+        if (cmp == 0) {
+            return &pack->entries[mid];
+        } else if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+// Find the range of entries inside a directory. Since the index is sorted, these are all next to each other.
+static Uint32 PACK_FindDirectory(const PackStorage *pack, const char *path, Uint32 *end)
+{
+    const size_t pathlen = SDL_strlen(path);
+    Uint32 lo = 0, hi = pack->num_entries;
+
+    if (pathlen == 0) {  // the root holds everything.
+        *end = pack->num_entries;
+        return 0;
+    }
+
+    // find the first entry that sorts at or after "path/"
+    while (lo < hi) {
+        const Uint32 mid = lo + (hi - lo) / 2;
+        const char *name = pack->entries[mid].name;
+        int cmp = SDL_strncmp(name, path, pathlen);
+        if (cmp == 0) {
+            cmp = (int)(Uint8)name[pathlen] - '/';
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    *end = lo;
+    while (*end < pack->num_entries) {
+        const char *name = pack->entries[*end].name;
+        if (SDL_strncmp(name, path, pathlen) != 0 || name[pathlen] != '/') {
+            break;
+        }
+        ++*end;
+    }
+    return lo;
+}
+
+static bool PACK_CloseStorage(void *userdata)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    const bool result = SDL_CloseIO(pack->io);
+
+    SDL_DestroyMutex(pack->lock);
+    SDL_free(pack->entries);
+    SDL_free(pack->names);
+    SDL_free(pack);
+    return result;
+}
+
+static bool PACK_EnumerateStorageDirectory(void *userdata, const char *path, SDL_EnumerateDirectoryCallback callback, void *callback_userdata)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+    const size_t pathlen = SDL_strlen(path);
+    const char *prev = NULL;
+    size_t prevlen = 0;
+    char *dirname = NULL;
+    bool result = true;
+    Uint32 i, end;
+
+    i = PACK_FindDirectory(pack, path, &end);
+    if (pathlen > 0) {
+        if (i == end) {
+            return SDL_SetError("No such directory");
+        }
+        if (SDL_asprintf(&dirname, "%s/", path) < 0) {
+            return false;
+        }
+    }
+
+    for (; i < end; ++i) {
+        const char *child = pack->entries[i].name + (pathlen ? pathlen + 1 : 0);
+        const char *slash = SDL_strchr(child, '/');
+        const size_t childlen = slash ? (size_t)(slash - child) : SDL_strlen(child);
+        SDL_EnumerationResult rc;
+
+        // everything in a subdirectory is next to each other, so only report it once.
+        if (prev && childlen == prevlen && SDL_strncmp(child, prev, childlen) == 0) {
+            continue;
+        }
+        prev = child;
+        prevlen = childlen;
+
+        if (slash) {
+            char *subdir = SDL_strndup(child, childlen);
+            if (!subdir) {
+                result = false;
+                break;
+            }
+            rc = callback(callback_userdata, dirname ? dirname : "", subdir);
+            SDL_free(subdir);
+        } else {
+            rc = callback(callback_userdata, dirname ? dirname : "", child);
+        }
+
+        if (rc == SDL_ENUM_SUCCESS) {
+            break;
+        } else if (rc == SDL_ENUM_FAILURE) {
+            result = false;
+            break;
+        }
+    }
+
+    SDL_free(dirname);
+    return result;
+}
+
+static bool PACK_GetStoragePathInfo(void *userdata, const char *path, SDL_PathInfo *info)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+    const PackEntry *entry = PACK_FindFile(pack, path);
+    Uint32 end;
+
+    SDL_zerop(info);
+    if (entry) {
+        info->type = SDL_PATHTYPE_FILE;
+        info->size = entry->size;
+    } else if (PACK_FindDirectory(pack, path, &end) < end || !*path) {
+        info->type = SDL_PATHTYPE_DIRECTORY;
+    } else {
+        return SDL_SetError("No such file or directory");
+    }
+    return true;
+}
+
+static bool PACK_ReadStorageFile(void *userdata, const char *path, void *destination, Uint64 length)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    const PackEntry *entry = PACK_FindFile(pack, path);
+    const Uint8 *src;
+    Uint8 *buffer = NULL;
+    bool result = true;
+
+    if (!entry) {
+        return SDL_SetError("No such file");
+    } else if (length > entry->size) {
+        return SDL_SetError("File length did not exactly match the destination length");
+    } else if (entry->stored_size > SDL_SIZE_MAX || entry->size > SDL_SIZE_MAX) {
+        return SDL_SetError("Read size exceeds SDL_SIZE_MAX");
+    }
+
+    const bool compressed = (entry->compression != PACK_COMPRESSION_NONE);
+
+    if (pack->data) {
+        src = pack->data + entry->offset;
+        if (!compressed) {
+            SDL_memcpy(destination, src, (size_t)length);
+            return true;
+        }
+    } else {
+        const size_t readlen = compressed ? (size_t)entry->stored_size : (size_t)length;
+        Uint8 *dst = (Uint8 *)destination;
+        if (compressed) {
+            dst = buffer = (Uint8 *)SDL_malloc(readlen ? readlen : 1);
+            if (!buffer) {
+                return false;
+            }
+        }
+        SDL_LockMutex(pack->lock);
+        if (SDL_SeekIO(pack->io, (Sint64)entry->offset, SDL_IO_SEEK_SET) < 0 ||
+            SDL_ReadIO(pack->io, dst, readlen) != readlen) {
+            result = false;
+        }
+        SDL_UnlockMutex(pack->lock);
+        if (!result || !compressed) {
+            SDL_free(buffer);
+            return result;
+        }
+        src = buffer;
+    }
+
+    // A partial read still has to decompress from the start of the file.
+    if (length == entry->size) {
+        if (!PACK_DecompressLZ4(src, (size_t)entry->stored_size, (Uint8 *)destination, (size_t)length)) {
+            result = SDL_SetError("Corrupt compressed data in pack");
+        }
+    } else {
+        Uint8 *whole = (Uint8 *)SDL_malloc((size_t)entry->size);
+        if (!whole) {
+            result = false;
+        } else {
+            if (PACK_DecompressLZ4(src, (size_t)entry->stored_size, whole, (size_t)entry->size)) {
+                SDL_memcpy(destination, whole, (size_t)length);
+            } else {
+                result = SDL_SetError("Corrupt compressed data in pack");
+            }
+            SDL_free(whole);
+        }
+    }
+    SDL_free(buffer);
+    return result;
+}
+
+static const SDL_StorageInterface PACK_iface = {
+    sizeof(SDL_StorageInterface),
+    PACK_CloseStorage,
+    NULL,   // ready
+    PACK_EnumerateStorageDirectory,
+    PACK_GetStoragePathInfo,
+    PACK_ReadStorageFile,
+    NULL,   // write_file
+    NULL,   // mkdir
+    NULL,   // remove
+    NULL,   // rename
+    NULL,   // copy
+    NULL    // space_remaining
+};
+
+static bool PACK_ValidateName(const char *name)
+{
+    const char *ptr;
+
+    if (!*name || *name == '/') {
+        return false;
+    }
+    for (ptr = name; *ptr; ++ptr) {
+        if (*ptr == '\\' || (*ptr == '/' && (ptr[1] == '/' || ptr[1] == '\0'))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Uint32 PACK_Read32(const Uint8 *ptr)
+{
+    Uint32 value;
+    SDL_memcpy(&value, ptr, sizeof(value));
+    return SDL_Swap32LE(value);
+}
+
+static Uint64 PACK_Read64(const Uint8 *ptr)
+{
+    Uint64 value;
+    SDL_memcpy(&value, ptr, sizeof(value));
+    return SDL_Swap64LE(value);
+}
+
+static bool PACK_LoadIndex(PackStorage *pack, Sint64 filesize)
+{
+    Uint8 header[PACK_HEADER_SIZE];
+    Uint8 *index = NULL;
+    bool result = false;
+
+    if (SDL_ReadIO(pack->io, header, sizeof(header)) != sizeof(header) ||
+        SDL_memcmp(header, PACK_MAGIC, 8) != 0) {
+        return SDL_SetError("Not a pack file");
+    }
+
+    const Uint32 version = PACK_Read32(&header[8]);
+    const Uint32 count = PACK_Read32(&header[12]);
+    const Uint64 index_offset = PACK_Read64(&header[16]);
+    const Uint64 names_size = PACK_Read64(&header[24]);
+
+    if (version != PACK_VERSION) {
+        return SDL_SetError("Unsupported pack version %" SDL_PRIu32, version);
+    }
+
+    const Uint64 index_size = (Uint64)count * PACK_ENTRY_SIZE;
+    if (index_offset > (Uint64)filesize || index_size > (Uint64)filesize - index_offset ||
+        names_size > (Uint64)filesize - index_offset - index_size || names_size > SDL_MAX_UINT32 ||
+        (count > 0 && names_size == 0)) {
+        return SDL_SetError("Corrupt pack index");
+    }
+
+    index = (Uint8 *)SDL_malloc((size_t)index_size + 1);
+    pack->names = (char *)SDL_malloc((size_t)names_size + 1);
+    pack->entries = (PackEntry *)SDL_calloc(count ? count : 1, sizeof(*pack->entries));
+    if (!index || !pack->names || !pack->entries) {
+        goto done;
+    }
+
+    if (SDL_SeekIO(pack->io, (Sint64)index_offset, SDL_IO_SEEK_SET) < 0 ||
+        SDL_ReadIO(pack->io, index, (size_t)index_size) != (size_t)index_size ||
+        SDL_ReadIO(pack->io, pack->names, (size_t)names_size) != (size_t)names_size) {
+        goto done;
+    }
+    pack->names[names_size] = '\0';  // so a bad name offset can't run off the end.
+
+    for (Uint32 i = 0; i < count; ++i) {
+        const Uint8 *raw = index + (size_t)i * PACK_ENTRY_SIZE;
+        PackEntry *entry = &pack->entries[i];
+        const Uint32 name_offset = PACK_Read32(&raw[24]);
+
+        entry->offset = PACK_Read64(&raw[0]);
+        entry->stored_size = PACK_Read64(&raw[8]);
+        entry->size = PACK_Read64(&raw[16]);
+        entry->compression = PACK_Read32(&raw[28]);
+
+        if (name_offset >= names_size) {
+            SDL_SetError("Corrupt pack index");
+            goto done;
+        }
+        entry->name = pack->names + name_offset;
+
+        if (!PACK_ValidateName(entry->name) ||
+            (i > 0 && SDL_strcmp(pack->entries[i - 1].name, entry->name) >= 0) ||
+            entry->offset > (Uint64)filesize || entry->stored_size > (Uint64)filesize - entry->offset ||
+            (entry->compression == PACK_COMPRESSION_NONE && entry->stored_size != entry->size) ||
+            entry->compression > PACK_COMPRESSION_LZ4) {
+            SDL_SetError("Corrupt pack index");
+            goto done;
+        }
+    }
+    pack->num_entries = count;
+    result = true;
+
+done:
+    SDL_free(index);
+    return result;
+}
+
+SDL_Storage *PACK_OpenStorage(const char *file)
+{
+    SDL_Storage *result = NULL;
+    PackStorage *pack = (PackStorage *)SDL_calloc(1, sizeof(*pack));
+    if (!pack) {
+        return NULL;
+    }
+
+    pack->io = SDL_IOFromMappedFile(file);
+    if (pack->io) {
+        pack->data = (const Uint8 *)SDL_GetIOPointer(pack->io, 0, 0);
+    } else {
+        // couldn't map it (too big for the address space, maybe?), so read it the old-fashioned way.
+        pack->io = SDL_IOFromFile(file, "rb");
+        pack->lock = SDL_CreateMutex();
+    }
+
+    if (pack->io && (pack->data || pack->lock)) {
+        const Sint64 filesize = SDL_GetIOSize(pack->io);
+        if (filesize >= 0 && PACK_LoadIndex(pack, filesize)) {
+            result = SDL_OpenStorage(&PACK_iface, pack);
+        }
+    }
+
+    if (!result) {
+        SDL_CloseIO(pack->io);
+        SDL_DestroyMutex(pack->lock);
+        SDL_free(pack->entries);
+        SDL_free(pack->names);
+        SDL_free(pack);
+    }
+    return result;
+}
+
+static SDL_Storage *PACK_Title_Create(const char *override, SDL_PropertiesID props)
+{
+    SDL_PathInfo info;
+
+    // only take over if we were pointed at a file, otherwise the override is a directory for the generic driver.
+    if (!override || !SDL_GetPathInfo(override, &info) || info.type != SDL_PATHTYPE_FILE) {
+        return NULL;
+    }
+    return PACK_OpenStorage(override);
+}
+
+TitleStorageBootStrap PACK_titlebootstrap = {
+    "pack",
+    "SDL pack file title storage driver",
+    PACK_Title_Create
+};
@@ -1545,6 +1545,24 @@ static const char *SystemThemeName(void)
     }
 }
 
+static const char *PowerStateName(SDL_PowerState state)
+{
+    switch (state) {
+#define CASE(X)             \
+    case SDL_POWERSTATE_##X: \
+        return #X
+        CASE(ERROR);
+        CASE(UNKNOWN);
+        CASE(ON_BATTERY);
+        CASE(NO_BATTERY);
+        CASE(CHARGING);
+        CASE(CHARGED);
+#undef CASE
+    default:
+        return "???";
+    }
+}
+
 static const char *DisplayOrientationName(int orientation)
 {
     switch (orientation) {
@@ -1615,6 +1633,13 @@ void SDLTest_PrintEvent(const SDL_Event *event)
     case SDL_EVENT_SYSTEM_THEME_CHANGED:
         SDL_Log("SDL EVENT: System theme changed to %s", SystemThemeName());
         break;
+    case SDL_EVENT_POWER_STATE_CHANGED:
+        {
+            int percent;
+            SDL_PowerState state = SDL_GetPowerInfo(NULL, &percent);
+            SDL_Log("SDL EVENT: Power state changed to %s, %d%%", PowerStateName(state), percent);
+        }
+        break;
     case SDL_EVENT_DISPLAY_ADDED:
         SDL_Log("SDL EVENT: Display %" SDL_PRIu32 " attached",
                 event->display.displayID);
@@ -0,0 +1,235 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_thread_c.h"
+
+// Sleeping on the address of an atomic variable, like a futex.
+
+#ifndef SDL_THREADS_DISABLED
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#define SDL_ATOMIC_WAIT_FUTEX
+#elif defined(SDL_PLATFORM_WINDOWS) && !SDL_WINAPI_FAMILY_PHONE
+#include "../core/windows/SDL_windows.h"
+#define SDL_ATOMIC_WAIT_WAITONADDRESS
+#endif
+#endif // !SDL_THREADS_DISABLED
+
+#ifdef SDL_ATOMIC_WAIT_WAITONADDRESS
+#ifdef SDL_PLATFORM_WINRT
+// Functions are guaranteed to be available
+#define pWaitOnAddress       WaitOnAddress
+#define pWakeByAddressSingle WakeByAddressSingle
+#define pWakeByAddressAll    WakeByAddressAll
+#else
+typedef BOOL(WINAPI *pfnWaitOnAddress)(volatile VOID *, PVOID, SIZE_T, DWORD);
+typedef VOID(WINAPI *pfnWakeByAddress)(PVOID);
+
+static pfnWaitOnAddress pWaitOnAddress = NULL;
+static pfnWakeByAddress pWakeByAddressSingle = NULL;
+static pfnWakeByAddress pWakeByAddressAll = NULL;
+#endif
+#endif // SDL_ATOMIC_WAIT_WAITONADDRESS
+
+/* Without a native way to wait on an address, waiters sleep on a condition
+   picked by hashing the address. Variables that share a bucket wake each
+   other up, which is fine since waiters have to check the value anyway. */
+#define SDL_ATOMIC_WAIT_BUCKETS 64
+
+typedef struct SDL_AtomicWaitBucket
+{
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+} SDL_AtomicWaitBucket;
+
+static SDL_InitState atomic_wait_init;
+static bool atomic_wait_native = false;
+static SDL_AtomicWaitBucket atomic_wait_buckets[SDL_ATOMIC_WAIT_BUCKETS];
+
+static void FreeAtomicWaitBuckets(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_ATOMIC_WAIT_BUCKETS; ++i) {
+        SDL_DestroyCondition(atomic_wait_buckets[i].cond);
+        SDL_DestroyMutex(atomic_wait_buckets[i].lock);
+    }
+    SDL_zeroa(atomic_wait_buckets);
+}
+
+static bool PrepareAtomicWait(void)
+{
+    bool okay = true;
+
+    if (SDL_ShouldInit(&atomic_wait_init)) {
+#ifdef SDL_ATOMIC_WAIT_FUTEX
+        atomic_wait_native = true;
+#elif defined(SDL_ATOMIC_WAIT_WAITONADDRESS)
+#ifdef SDL_PLATFORM_WINRT
+        atomic_wait_native = true;
+#else
+        HMODULE synch120 = GetModuleHandle(TEXT("api-ms-win-core-synch-l1-2-0.dll"));
+        if (synch120) {
+            // Try to load required functions provided by Win 8 or newer
+            pWaitOnAddress = (pfnWaitOnAddress)GetProcAddress(synch120, "WaitOnAddress");
+            pWakeByAddressSingle = (pfnWakeByAddress)GetProcAddress(synch120, "WakeByAddressSingle");
+            pWakeByAddressAll = (pfnWakeByAddress)GetProcAddress(synch120, "WakeByAddressAll");
+            atomic_wait_native = (pWaitOnAddress && pWakeByAddressSingle && pWakeByAddressAll);
+        }
+#endif
+#endif
+
+#ifndef SDL_THREADS_DISABLED
+        if (!atomic_wait_native) {
+            int i;
+
+            for (i = 0; okay && i < SDL_ATOMIC_WAIT_BUCKETS; ++i) {
+                okay = (okay && ((atomic_wait_buckets[i].lock = SDL_CreateMutex()) != NULL));
+                okay = (okay && ((atomic_wait_buckets[i].cond = SDL_CreateCondition()) != NULL));
+            }
+            if (!okay) {
+                FreeAtomicWaitBuckets();
+            }
+        }
+#endif
+        SDL_SetInitialized(&atomic_wait_init, okay);
+    }
+    return okay;
+}
+
+static SDL_AtomicWaitBucket *GetAtomicWaitBucket(SDL_AtomicInt *a)
+{
+    const uintptr_t addr = (uintptr_t)a;
+    return &atomic_wait_buckets[((addr >> 2) ^ (addr >> 8)) % SDL_ATOMIC_WAIT_BUCKETS];
+}
+
+bool SDL_WaitAtomicInt(SDL_AtomicInt *a, int expected, Sint64 timeoutNS)
+{
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+
+    if (SDL_GetAtomicInt(a) != expected) {
+        return true;
+    }
+    if (timeoutNS == 0) {
+        return false;
+    }
+
+#ifdef SDL_THREADS_DISABLED
+    // Nobody else can change the value, so there's nothing to wait for
+    if (timeoutNS > 0) {
+        SDL_DelayNS(timeoutNS);
+        return false;
+    }
+    return true;
+#else
+    if (!PrepareAtomicWait()) {
+        // Poll, this is allowed to return early
+        SDL_DelayNS((timeoutNS > 0) ? SDL_min(timeoutNS, SDL_MS_TO_NS(1)) : SDL_MS_TO_NS(1));
+        return true;
+    }
+
+    if (atomic_wait_native) {
+#ifdef SDL_ATOMIC_WAIT_FUTEX
+        struct timespec timeout;
+
+        if (timeoutNS > 0) {
+            timeout.tv_sec = (time_t)(timeoutNS / SDL_NS_PER_SECOND);
+            timeout.tv_nsec = (long)(timeoutNS % SDL_NS_PER_SECOND);
+        }
+        if (syscall(SYS_futex, &a->value, FUTEX_WAIT_PRIVATE, expected, (timeoutNS > 0) ? &timeout : NULL, NULL, 0) < 0) {
+            return (errno != ETIMEDOUT);
+        }
+        return true;
+#elif defined(SDL_ATOMIC_WAIT_WAITONADDRESS)
+        DWORD timeout = INFINITE;
+
+        if (timeoutNS > 0) {
+            // Round up, so short timeouts still wait
+            timeout = (DWORD)SDL_min(SDL_NS_TO_MS(timeoutNS + SDL_NS_PER_MS - 1), (Sint64)INFINITE - 1);
+        }
+        if (!pWaitOnAddress(&a->value, &expected, sizeof(a->value), timeout)) {
+            return (GetLastError() != ERROR_TIMEOUT);
+        }
+        return true;
+#endif
+    }
+
+    {
+        SDL_AtomicWaitBucket *bucket = GetAtomicWaitBucket(a);
+        bool result = true;
+
+        SDL_LockMutex(bucket->lock);
+        if (SDL_GetAtomicInt(a) == expected) {
+            result = SDL_WaitConditionTimeoutNS(bucket->cond, bucket->lock, timeoutNS);
+        }
+        SDL_UnlockMutex(bucket->lock);
+        return result;
+    }
+#endif // SDL_THREADS_DISABLED
+}
+
+void SDL_WakeAtomicInt(SDL_AtomicInt *a, bool wake_all)
+{
+#ifndef SDL_THREADS_DISABLED
+    if (!a || !PrepareAtomicWait()) {
+        return;
+    }
+
+    if (atomic_wait_native) {
+#ifdef SDL_ATOMIC_WAIT_FUTEX
+        syscall(SYS_futex, &a->value, FUTEX_WAKE_PRIVATE, wake_all ? SDL_MAX_SINT32 : 1, NULL, NULL, 0);
+        return;
+#elif defined(SDL_ATOMIC_WAIT_WAITONADDRESS)
+        if (wake_all) {
+            pWakeByAddressAll(&a->value);
+        } else {
+            pWakeByAddressSingle(&a->value);
+        }
+        return;
+#endif
+    }
+
+    {
+        SDL_AtomicWaitBucket *bucket = GetAtomicWaitBucket(a);
+
+        // Other variables may share the bucket, so everyone has to wake up and check
+        SDL_LockMutex(bucket->lock);
+        SDL_BroadcastCondition(bucket->cond);
+        SDL_UnlockMutex(bucket->lock);
+    }
+#endif // !SDL_THREADS_DISABLED
+}
+
+void SDL_QuitAtomicWait(void)
+{
+    if (SDL_ShouldQuit(&atomic_wait_init)) {
+        FreeAtomicWaitBuckets();
+        atomic_wait_native = false;
+        SDL_SetInitialized(&atomic_wait_init, false);
+    }
+}
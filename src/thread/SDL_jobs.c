@@ -0,0 +1,490 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_thread_c.h"
+
+// The job pool: a fixed set of worker threads, each with its own queue of jobs.
+//
+// A worker pushes the jobs it submits onto the tail of its own queue and takes
+// its next job from the tail too, so related work stays on the same thread.
+// When its queue is empty, it steals from the head of the queue for jobs that
+// were submitted from outside the pool, and then from the other workers.
+// Threads that run out of work sleep on job_wakeups until more is queued.
+
+// The most worker threads we'll start, however many cores there are
+#define SDL_MAX_JOB_THREADS 64
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction func;
+    void *userdata;
+    SDL_JobCounter *counter;
+    struct SDL_Job *next;   // in the list of jobs waiting for a counter to reach zero
+} SDL_Job;
+
+struct SDL_JobCounter
+{
+    SDL_AtomicInt value;
+    SDL_SpinLock lock;      // protects dependents, and is held while value drops to zero
+    SDL_Job *dependents;
+};
+
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_Job **jobs;
+    int capacity;   // always a power of two
+    int head;
+    int tail;
+} SDL_JobQueue;
+
+typedef struct SDL_JobWorker
+{
+    SDL_Thread *thread;
+    SDL_JobQueue queue;
+    int index;
+} SDL_JobWorker;
+
+static SDL_InitState jobs_init;
+static SDL_JobWorker *job_workers = NULL;
+static int num_job_workers = 0;
+static SDL_JobQueue submitted_jobs;     // jobs submitted from threads outside the pool
+static SDL_TLSID job_worker_tls;
+static SDL_AtomicInt queued_jobs;
+static SDL_AtomicInt job_wakeups;       // bumped whenever sleeping threads should look for work
+static SDL_AtomicInt sleeping_job_threads;
+static SDL_AtomicInt waiting_job_threads;  // sleeping threads that are waiting on a counter
+static SDL_AtomicInt stop_jobs;
+
+static bool PushJob(SDL_JobQueue *queue, SDL_Job *job)
+{
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->tail - queue->head == queue->capacity) {
+        const int capacity = queue->capacity ? (queue->capacity * 2) : 64;
+        SDL_Job **jobs = (SDL_Job **)SDL_malloc(capacity * sizeof(*jobs));
+        int i;
+
+        if (!jobs) {
+            SDL_UnlockSpinlock(&queue->lock);
+            return false;
+        }
+        for (i = queue->head; i != queue->tail; ++i) {
+            jobs[i & (capacity - 1)] = queue->jobs[i & (queue->capacity - 1)];
+        }
+        SDL_free(queue->jobs);
+        queue->jobs = jobs;
+        queue->capacity = capacity;
+    }
+    queue->jobs[queue->tail & (queue->capacity - 1)] = job;
+    ++queue->tail;
+    SDL_UnlockSpinlock(&queue->lock);
+    return true;
+}
+
+static SDL_Job *PopJob(SDL_JobQueue *queue, bool steal)
+{
+    SDL_Job *job = NULL;
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->head != queue->tail) {
+        if (steal) {
+            job = queue->jobs[queue->head & (queue->capacity - 1)];
+            ++queue->head;
+        } else {
+            --queue->tail;
+            job = queue->jobs[queue->tail & (queue->capacity - 1)];
+        }
+        if (queue->head == queue->tail) {
+            queue->head = queue->tail = 0;
+        }
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+    return job;
+}
+
+static SDL_Job *FindJob(SDL_JobWorker *self)
+{
+    SDL_Job *job = NULL;
+    int i;
+
+    if (SDL_GetAtomicInt(&queued_jobs) <= 0) {
+        return NULL;
+    }
+
+    if (self) {
+        job = PopJob(&self->queue, false);
+    }
+    if (!job) {
+        job = PopJob(&submitted_jobs, true);
+    }
+    for (i = 0; !job && i < num_job_workers; ++i) {
+        SDL_JobWorker *victim = &job_workers[((self ? self->index + 1 : 0) + i) % num_job_workers];
+        if (victim != self) {
+            job = PopJob(&victim->queue, true);
+        }
+    }
+    if (job) {
+        SDL_AddAtomicInt(&queued_jobs, -1);
+    }
+    return job;
+}
+
+// Sleeps until a job is queued, the counter reaches zero, or the pool is stopping
+static void WaitForJobs(SDL_JobCounter *counter)
+{
+    // Anything that happens after this read changes job_wakeups, so the wait can't miss it
+    const int wakeups = SDL_GetAtomicInt(&job_wakeups);
+
+    SDL_AddAtomicInt(&sleeping_job_threads, 1);
+    if (counter) {
+        SDL_AddAtomicInt(&waiting_job_threads, 1);
+    }
+    if (SDL_GetAtomicInt(&queued_jobs) <= 0 && !SDL_GetAtomicInt(&stop_jobs) &&
+        (!counter || SDL_GetAtomicInt(&counter->value) > 0)) {
+        SDL_WaitAtomicInt(&job_wakeups, wakeups, -1);
+    }
+    if (counter) {
+        SDL_AddAtomicInt(&waiting_job_threads, -1);
+    }
+    SDL_AddAtomicInt(&sleeping_job_threads, -1);
+}
+
+static void RunJob(SDL_Job *job);
+
+static void QueueJob(SDL_Job *job)
+{
+    SDL_JobWorker *self = (SDL_JobWorker *)SDL_GetTLS(&job_worker_tls);
+
+    if (num_job_workers == 0) {
+        RunJob(job);
+        return;
+    }
+
+    // Count the job before it's visible, so sleeping threads never miss it
+    SDL_AddAtomicInt(&queued_jobs, 1);
+    if (!PushJob(self ? &self->queue : &submitted_jobs, job)) {
+        SDL_AddAtomicInt(&queued_jobs, -1);
+        RunJob(job);  // out of memory, just run it here.
+        return;
+    }
+
+    SDL_AddAtomicInt(&job_wakeups, 1);
+    if (SDL_GetAtomicInt(&sleeping_job_threads) > 0) {
+        SDL_WakeAtomicInt(&job_wakeups, false);
+    }
+}
+
+static void FinishJob(SDL_JobCounter *counter)
+{
+    SDL_Job *dependents = NULL;
+    bool done = false;
+
+    SDL_LockSpinlock(&counter->lock);
+    if (SDL_AddAtomicInt(&counter->value, -1) == 1) {
+        dependents = counter->dependents;
+        counter->dependents = NULL;
+        done = true;
+    }
+    SDL_UnlockSpinlock(&counter->lock);
+
+    // The counter may be gone now, if another thread was waiting for it
+    while (dependents) {
+        SDL_Job *next = dependents->next;
+        QueueJob(dependents);
+        dependents = next;
+    }
+    if (done) {
+        SDL_AddAtomicInt(&job_wakeups, 1);
+        if (SDL_GetAtomicInt(&waiting_job_threads) > 0) {
+            SDL_WakeAtomicInt(&job_wakeups, true);
+        }
+    }
+}
+
+static void RunJob(SDL_Job *job)
+{
+    SDL_JobCounter *counter = job->counter;
+
+    job->func(job->userdata);
+    SDL_free(job);
+
+    if (counter) {
+        FinishJob(counter);
+    }
+}
+
+static int SDLCALL JobWorkerThread(void *data)
+{
+    SDL_JobWorker *self = (SDL_JobWorker *)data;
+
+    SDL_SetTLS(&job_worker_tls, self, NULL);
+
+    for ( ; ; ) {
+        SDL_Job *job = FindJob(self);
+        if (job) {
+            RunJob(job);
+        } else if (SDL_GetAtomicInt(&stop_jobs)) {
+            break;
+        } else {
+            WaitForJobs(NULL);
+        }
+    }
+    return 0;
+}
+
+static int GetDefaultJobThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_JOB_THREADS);
+    int num_threads;
+
+    if (hint && *hint) {
+        num_threads = SDL_atoi(hint);
+    } else {
+        // The thread waiting for the jobs runs them too, so leave a core for it
+        num_threads = SDL_max(SDL_GetNumLogicalCPUCores() - 1, 1);
+    }
+    return SDL_clamp(num_threads, 0, SDL_MAX_JOB_THREADS);
+}
+
+static bool PrepareJobs(void)
+{
+    bool okay = true;
+    if (SDL_ShouldInit(&jobs_init)) {
+        const int num_threads = GetDefaultJobThreads();
+        if (num_threads > 0) {
+            job_workers = (SDL_JobWorker *)SDL_calloc(num_threads, sizeof(*job_workers));
+            okay = (job_workers != NULL);
+        }
+        if (okay) {
+            int i;
+
+            // Workers can steal from every queue, even if starting some of the threads fails
+            num_job_workers = num_threads;
+            for (i = 0; i < num_threads; ++i) {
+                char threadname[32];
+
+                job_workers[i].index = i;
+                SDL_snprintf(threadname, sizeof(threadname), "SDLjob%d", i);
+                job_workers[i].thread = SDL_CreateThread(JobWorkerThread, threadname, &job_workers[i]);
+                if (!job_workers[i].thread) {
+                    if (i == 0) {
+                        num_job_workers = 0;  // no threads at all, run jobs as they're submitted.
+                    }
+                    break;
+                }
+            }
+        }
+
+        SDL_SetInitialized(&jobs_init, okay);
+    }
+    return okay;
+}
+
+SDL_JobCounter *SDL_CreateJobCounter(void)
+{
+    return (SDL_JobCounter *)SDL_calloc(1, sizeof(SDL_JobCounter));
+}
+
+void SDL_DestroyJobCounter(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        return;
+    }
+
+    // Make sure the thread that finished the last job is done with the counter
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+
+    SDL_free(counter);
+}
+
+int SDL_GetJobCounterValue(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        return 0;
+    }
+    return SDL_GetAtomicInt(&counter->value);
+}
+
+bool SDL_SubmitJob(SDL_JobFunction func, void *userdata, SDL_JobCounter *counter)
+{
+    return SDL_SubmitJobAfter(NULL, func, userdata, counter);
+}
+
+bool SDL_SubmitJobAfter(SDL_JobCounter *dependency, SDL_JobFunction func, void *userdata, SDL_JobCounter *counter)
+{
+    SDL_Job *job;
+
+    if (!func) {
+        return SDL_InvalidParamError("func");
+    }
+    if (dependency && dependency == counter) {
+        return SDL_InvalidParamError("dependency");
+    }
+    if (!PrepareJobs()) {
+        return false;
+    }
+
+    job = (SDL_Job *)SDL_malloc(sizeof(*job));
+    if (!job) {
+        return false;
+    }
+    job->func = func;
+    job->userdata = userdata;
+    job->counter = counter;
+    job->next = NULL;
+
+    if (counter) {
+        SDL_AddAtomicInt(&counter->value, 1);
+    }
+
+    if (dependency) {
+        SDL_LockSpinlock(&dependency->lock);
+        if (SDL_GetAtomicInt(&dependency->value) > 0) {
+            job->next = dependency->dependents;
+            dependency->dependents = job;
+            job = NULL;
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    if (job) {
+        QueueJob(job);
+    }
+    return true;
+}
+
+void SDL_WaitJobCounter(SDL_JobCounter *counter)
+{
+    SDL_JobWorker *self;
+
+    if (!counter) {
+        return;
+    }
+
+    self = (SDL_JobWorker *)SDL_GetTLS(&job_worker_tls);
+    while (SDL_GetAtomicInt(&counter->value) > 0) {
+        SDL_Job *job = FindJob(self);
+        if (job) {
+            RunJob(job);
+        } else {
+            WaitForJobs(counter);
+        }
+    }
+
+    // Make sure the thread that finished the last job is done with the counter
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+}
+
+typedef struct SDL_JobRange
+{
+    SDL_JobRangeFunction func;
+    void *userdata;
+    int count;
+    SDL_AtomicInt next;
+} SDL_JobRange;
+
+static void SDLCALL RunJobRange(void *userdata)
+{
+    SDL_JobRange *range = (SDL_JobRange *)userdata;
+
+    for ( ; ; ) {
+        const int index = SDL_AddAtomicInt(&range->next, 1);
+        if (index >= range->count) {
+            break;
+        }
+        range->func(range->userdata, index);
+    }
+}
+
+void SDL_RunJobs(SDL_JobRangeFunction func, void *userdata, int count)
+{
+    int i;
+
+    if (!func || count <= 0) {
+        return;
+    }
+
+    if (count > 1 && PrepareJobs() && num_job_workers > 0) {
+        SDL_JobCounter counter;
+        SDL_JobRange range;
+        const int num_helpers = SDL_min(count - 1, num_job_workers);
+
+        SDL_zero(counter);
+        range.func = func;
+        range.userdata = userdata;
+        range.count = count;
+        SDL_SetAtomicInt(&range.next, 0);
+
+        // Each helper takes indices until they run out, it's fine if some never get to run
+        for (i = 0; i < num_helpers; ++i) {
+            if (!SDL_SubmitJob(RunJobRange, &range, &counter)) {
+                break;
+            }
+        }
+        RunJobRange(&range);
+        SDL_WaitJobCounter(&counter);
+        return;
+    }
+
+    for (i = 0; i < count; ++i) {
+        func(userdata, i);
+    }
+}
+
+int SDL_GetNumJobThreads(void)
+{
+    if (!PrepareJobs()) {
+        return 0;
+    }
+    return num_job_workers;
+}
+
+void SDL_QuitJobs(void)
+{
+    if (SDL_ShouldQuit(&jobs_init)) {
+        int i;
+
+        // The workers run whatever is still queued before they exit
+        SDL_SetAtomicInt(&stop_jobs, 1);
+        SDL_AddAtomicInt(&job_wakeups, 1);
+        SDL_WakeAtomicInt(&job_wakeups, true);
+
+        for (i = 0; i < num_job_workers; ++i) {
+            if (job_workers[i].thread) {
+                SDL_WaitThread(job_workers[i].thread, NULL);
+            }
+            SDL_free(job_workers[i].queue.jobs);
+        }
+        SDL_free(job_workers);
+        job_workers = NULL;
+        num_job_workers = 0;
+
+        SDL_free(submitted_jobs.jobs);
+        SDL_zero(submitted_jobs);
+
+        SDL_SetAtomicInt(&queued_jobs, 0);
+        SDL_SetAtomicInt(&stop_jobs, 0);
+        SDL_SetInitialized(&jobs_init, false);
+    }
+}
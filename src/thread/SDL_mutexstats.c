@@ -0,0 +1,320 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_thread_c.h"
+
+// Lock contention statistics, only recorded in builds with SDL_MUTEX_STATS
+
+#ifdef SDL_MUTEX_STATS
+
+/* This is called from inside SDL_LockMutex(), so it can't use anything that
+   might lock a mutex itself, like hints or SDL_GetTicksNS(). Wait times are
+   kept in performance counter ticks and converted when they're read. */
+typedef struct SDL_MutexRecord
+{
+    char *name;
+    bool destroyed;
+    Uint64 acquires;
+    Uint64 contended;
+    Uint64 wait_ticks;
+    Uint64 max_wait_ticks;
+    struct SDL_MutexRecord *next;
+} SDL_MutexRecord;
+
+static SDL_SpinLock mutex_stats_lock;
+static SDL_HashTable *mutex_records;        // SDL_Mutex * -> SDL_MutexRecord *, for live mutexes
+static SDL_MutexRecord *destroyed_records;  // one per name, totals for mutexes that are gone
+
+static SDL_MutexRecord *GetMutexRecord(SDL_Mutex *mutex)
+{
+    SDL_MutexRecord *record = NULL;
+
+    if (!mutex_records) {
+        mutex_records = SDL_CreateHashTable(0, false, SDL_HashPointer, SDL_KeyMatchPointer, NULL, NULL);
+        if (!mutex_records) {
+            return NULL;
+        }
+    }
+
+    if (!SDL_FindInHashTable(mutex_records, mutex, (const void **)&record)) {
+        record = (SDL_MutexRecord *)SDL_calloc(1, sizeof(*record));
+        if (record && !SDL_InsertIntoHashTable(mutex_records, mutex, record, false)) {
+            SDL_free(record);
+            record = NULL;
+        }
+    }
+    return record;
+}
+
+static bool NamesMatch(const char *a, const char *b)
+{
+    if (!a || !b) {
+        return (a == b);
+    }
+    return (SDL_strcmp(a, b) == 0);
+}
+
+void SDL_RecordMutexLock(SDL_Mutex *mutex, Uint64 wait_start)
+{
+    const Uint64 wait = wait_start ? (SDL_GetPerformanceCounter() - wait_start) : 0;
+    SDL_MutexRecord *record;
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    record = GetMutexRecord(mutex);
+    if (record) {
+        ++record->acquires;
+        if (wait_start) {
+            ++record->contended;
+            record->wait_ticks += wait;
+            record->max_wait_ticks = SDL_max(record->max_wait_ticks, wait);
+        }
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+}
+
+void SDL_ForgetMutexStats(SDL_Mutex *mutex)
+{
+    SDL_MutexRecord *record = NULL;
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    if (mutex_records && SDL_FindInHashTable(mutex_records, mutex, (const void **)&record)) {
+        SDL_MutexRecord *total;
+
+        SDL_RemoveFromHashTable(mutex_records, mutex);
+
+        // Fold the numbers into the totals for this name, so they aren't lost
+        for (total = destroyed_records; total; total = total->next) {
+            if (NamesMatch(total->name, record->name)) {
+                break;
+            }
+        }
+        if (total) {
+            total->acquires += record->acquires;
+            total->contended += record->contended;
+            total->wait_ticks += record->wait_ticks;
+            total->max_wait_ticks = SDL_max(total->max_wait_ticks, record->max_wait_ticks);
+            SDL_free(record->name);
+            SDL_free(record);
+        } else {
+            record->destroyed = true;
+            record->next = destroyed_records;
+            destroyed_records = record;
+        }
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+}
+
+typedef struct SDL_MutexStatsSnapshot
+{
+    SDL_MutexStats *stats;
+    char *names;
+    int count;
+    size_t name_bytes;
+} SDL_MutexStatsSnapshot;
+
+static void AddToSnapshot(SDL_MutexStatsSnapshot *snapshot, const SDL_MutexRecord *record)
+{
+    if (record->acquires == 0) {
+        return;
+    }
+
+    if (snapshot->stats) {
+        const Uint64 frequency = SDL_GetPerformanceFrequency();
+        SDL_MutexStats *stats = &snapshot->stats[snapshot->count];
+
+        stats->name = NULL;
+        if (record->name) {
+            const size_t len = SDL_strlen(record->name) + 1;
+            SDL_memcpy(snapshot->names, record->name, len);
+            stats->name = snapshot->names;
+            snapshot->names += len;
+        }
+        stats->destroyed = record->destroyed;
+        stats->acquires = record->acquires;
+        stats->contended = record->contended;
+        stats->wait_ns = (Uint64)(((double)record->wait_ticks * SDL_NS_PER_SECOND) / frequency);
+        stats->max_wait_ns = (Uint64)(((double)record->max_wait_ticks * SDL_NS_PER_SECOND) / frequency);
+    } else if (record->name) {
+        snapshot->name_bytes += SDL_strlen(record->name) + 1;
+    }
+    ++snapshot->count;
+}
+
+static bool SDLCALL AddToSnapshotCallback(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    AddToSnapshot((SDL_MutexStatsSnapshot *)userdata, (const SDL_MutexRecord *)value);
+    return true;  // keep iterating
+}
+
+static void CollectMutexStats(SDL_MutexStatsSnapshot *snapshot)
+{
+    const SDL_MutexRecord *record;
+
+    if (mutex_records) {
+        SDL_IterateHashTable(mutex_records, AddToSnapshotCallback, snapshot);
+    }
+    for (record = destroyed_records; record; record = record->next) {
+        AddToSnapshot(snapshot, record);
+    }
+}
+
+SDL_MutexStats *SDL_GetMutexStats(int *count)
+{
+    SDL_MutexStatsSnapshot snapshot;
+    SDL_MutexStats *result;
+
+    if (count) {
+        *count = 0;
+    }
+
+    SDL_zero(snapshot);
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    CollectMutexStats(&snapshot);
+
+    // Everything goes in one allocation: the entries, the terminating entry, then the names
+    result = (SDL_MutexStats *)SDL_calloc(1, (snapshot.count + 1) * sizeof(*result) + snapshot.name_bytes);
+    if (result) {
+        snapshot.stats = result;
+        snapshot.names = (char *)&result[snapshot.count + 1];
+        snapshot.count = 0;
+        CollectMutexStats(&snapshot);
+        if (count) {
+            *count = snapshot.count;
+        }
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+
+    return result;
+}
+
+static bool SDLCALL ResetMutexRecordCallback(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    SDL_MutexRecord *record = (SDL_MutexRecord *)value;
+
+    record->acquires = 0;
+    record->contended = 0;
+    record->wait_ticks = 0;
+    record->max_wait_ticks = 0;
+    return true;  // keep iterating
+}
+
+void SDL_ResetMutexStats(void)
+{
+    SDL_MutexRecord *record;
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    if (mutex_records) {
+        SDL_IterateHashTable(mutex_records, ResetMutexRecordCallback, NULL);
+    }
+    while (destroyed_records) {
+        record = destroyed_records;
+        destroyed_records = record->next;
+        SDL_free(record->name);
+        SDL_free(record);
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+}
+
+bool SDL_SetMutexName(SDL_Mutex *mutex, const char *name)
+{
+    SDL_MutexRecord *record;
+    char *copy = NULL;
+
+    if (!mutex) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    if (name) {
+        copy = SDL_strdup(name);
+        if (!copy) {
+            return false;
+        }
+    }
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    record = GetMutexRecord(mutex);
+    if (record) {
+        SDL_free(record->name);
+        record->name = copy;
+        copy = NULL;
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+
+    if (copy) {
+        SDL_free(copy);
+        return SDL_OutOfMemory();
+    }
+    return true;
+}
+
+static bool SDLCALL FreeMutexRecordCallback(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    SDL_MutexRecord *record = (SDL_MutexRecord *)value;
+
+    SDL_free(record->name);
+    SDL_free(record);
+    return true;  // keep iterating
+}
+
+void SDL_QuitMutexStats(void)
+{
+    SDL_ResetMutexStats();
+
+    SDL_LockSpinlock(&mutex_stats_lock);
+    if (mutex_records) {
+        SDL_IterateHashTable(mutex_records, FreeMutexRecordCallback, NULL);
+        SDL_DestroyHashTable(mutex_records);
+        mutex_records = NULL;
+    }
+    SDL_UnlockSpinlock(&mutex_stats_lock);
+}
+
+#else
+
+bool SDL_SetMutexName(SDL_Mutex *mutex, const char *name)
+{
+    // Names are only used for statistics
+    if (!mutex) {
+        return SDL_InvalidParamError("mutex");
+    }
+    return true;
+}
+
+SDL_MutexStats *SDL_GetMutexStats(int *count)
+{
+    if (count) {
+        *count = 0;
+    }
+    SDL_Unsupported();
+    return NULL;
+}
+
+void SDL_ResetMutexStats(void)
+{
+}
+
+void SDL_QuitMutexStats(void)
+{
+}
+
+#endif // SDL_MUTEX_STATS
@@ -46,6 +46,12 @@ extern void SDL_SYS_SetupThread(const char *name);
 // This function sets the current thread priority
 extern bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority);
 
+// This function restricts the current thread to a set of logical CPUs, 0 for any CPU
+extern bool SDL_SYS_SetThreadAffinity(Uint64 mask);
+
+// This function sets the kind of core the current thread prefers
+extern bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class);
+
 /* This function waits for the thread to finish and frees any data
    allocated by SDL_SYS_CreateThread()
  */
@@ -129,6 +129,7 @@ void SDL_CleanupTLS(void)
         SDL_free(storage);
         (void)SDL_AtomicDecRef(&SDL_tls_allocated);
     }
+    SDL_FlushMemoryCache();
 }
 
 void SDL_QuitTLSData(void)
@@ -321,6 +322,14 @@ void SDL_RunThread(SDL_Thread *thread)
     // Perform any system-dependent setup - this function may not fail
     SDL_SYS_SetupThread(thread->name);
 
+    // Apply the requested placement, the thread runs anyway if this isn't possible
+    if (thread->affinity) {
+        SDL_SYS_SetThreadAffinity(thread->affinity);
+    }
+    if (thread->core_class != SDL_THREAD_CORE_CLASS_ANY) {
+        SDL_SYS_SetThreadCoreClass(thread->core_class);
+    }
+
     // Get the thread id
     thread->threadid = SDL_GetCurrentThreadID();
 
@@ -338,6 +347,9 @@ void SDL_RunThread(SDL_Thread *thread)
             SDL_free(thread);
         }
     }
+
+    // Don't strand the blocks freed above in the cache of a thread that's going away
+    SDL_FlushMemoryCache();
 }
 
 SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
@@ -356,6 +368,8 @@ SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
     const char *name = SDL_GetStringProperty(props, SDL_PROP_THREAD_CREATE_NAME_STRING, NULL);
     const size_t stacksize = (size_t) SDL_GetNumberProperty(props, SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER, 0);
     void *userdata = SDL_GetPointerProperty(props, SDL_PROP_THREAD_CREATE_USERDATA_POINTER, NULL);
+    const Uint64 affinity = (Uint64) SDL_GetNumberProperty(props, SDL_PROP_THREAD_CREATE_AFFINITY_NUMBER, 0);
+    const SDL_ThreadCoreClass core_class = (SDL_ThreadCoreClass) SDL_GetNumberProperty(props, SDL_PROP_THREAD_CREATE_CORE_CLASS_NUMBER, SDL_THREAD_CORE_CLASS_ANY);
 
     if (!fn) {
         SDL_SetError("Thread entry function is NULL");
@@ -383,6 +397,8 @@ SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
     thread->userfunc = fn;
     thread->userdata = userdata;
     thread->stacksize = stacksize;
+    thread->affinity = affinity;
+    thread->core_class = core_class;
 
     SDL_SetObjectValid(thread, SDL_OBJECT_TYPE_THREAD, true);
 
@@ -454,6 +470,23 @@ bool SDL_SetCurrentThreadPriority(SDL_ThreadPriority priority)
     return SDL_SYS_SetThreadPriority(priority);
 }
 
+bool SDL_SetCurrentThreadAffinity(Uint64 mask)
+{
+    return SDL_SYS_SetThreadAffinity(mask);
+}
+
+bool SDL_SetCurrentThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+    switch (core_class) {
+    case SDL_THREAD_CORE_CLASS_ANY:
+    case SDL_THREAD_CORE_CLASS_PERFORMANCE:
+    case SDL_THREAD_CORE_CLASS_EFFICIENCY:
+        return SDL_SYS_SetThreadCoreClass(core_class);
+    default:
+        return SDL_InvalidParamError("core_class");
+    }
+}
+
 void SDL_WaitThread(SDL_Thread *thread, int *status)
 {
     if (!ThreadValid(thread)) {
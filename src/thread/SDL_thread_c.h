@@ -56,6 +56,8 @@ struct SDL_Thread
     SDL_error errbuf;
     char *name;
     size_t stacksize; // 0 for default, >0 for user-specified stack size.
+    Uint64 affinity;  // 0 for any CPU
+    SDL_ThreadCoreClass core_class;
     int(SDLCALL *userfunc)(void *);
     void *userdata;
     void *data;
@@ -65,6 +67,21 @@ struct SDL_Thread
 // This is the function called to run a thread
 extern void SDL_RunThread(SDL_Thread *thread);
 
+// Stops the job pool workers, after they run any jobs that are still queued
+extern void SDL_QuitJobs(void);
+
+// Frees the state used to emulate SDL_WaitAtomicInt() on systems without a native way
+extern void SDL_QuitAtomicWait(void);
+
+#ifdef SDL_MUTEX_STATS
+// Called by the mutex backends; wait_start is the performance counter when a contended lock started waiting, or 0
+extern void SDL_RecordMutexLock(SDL_Mutex *mutex, Uint64 wait_start);
+extern void SDL_ForgetMutexStats(SDL_Mutex *mutex);
+#endif
+
+// Frees the recorded lock statistics
+extern void SDL_QuitMutexStats(void);
+
 // This is the system-independent thread local storage structure
 typedef struct
 {
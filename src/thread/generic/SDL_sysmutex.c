@@ -24,6 +24,10 @@
 
 #include "SDL_systhread_c.h"
 
+#ifdef SDL_MUTEX_STATS
+#include "../SDL_thread_c.h"
+#endif
+
 struct SDL_Mutex
 {
     int recursive;
@@ -54,6 +58,9 @@ SDL_Mutex *SDL_CreateMutex(void)
 void SDL_DestroyMutex(SDL_Mutex *mutex)
 {
     if (mutex) {
+#ifdef SDL_MUTEX_STATS
+        SDL_ForgetMutexStats(mutex);
+#endif
         if (mutex->sem) {
             SDL_DestroySemaphore(mutex->sem);
         }
@@ -73,7 +80,16 @@ void SDL_LockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS  // clang doe
                We set the locking thread id after we obtain the lock
                so unlocks from other threads will fail.
              */
+#ifdef SDL_MUTEX_STATS
+            Uint64 wait_start = 0;
+            if (!SDL_TryWaitSemaphore(mutex->sem)) {
+                wait_start = SDL_GetPerformanceCounter();
+                SDL_WaitSemaphore(mutex->sem);
+            }
+            SDL_RecordMutexLock(mutex, wait_start);
+#else
             SDL_WaitSemaphore(mutex->sem);
+#endif
             mutex->owner = this_thread;
             mutex->recursive = 0;
         }
@@ -46,6 +46,16 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    return SDL_Unsupported();
+}
+
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+    return true;
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     return;
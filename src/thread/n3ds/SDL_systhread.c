@@ -118,6 +118,17 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority sdl_priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    // The core a thread runs on is chosen when it's created
+    return SDL_Unsupported();
+}
+
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+    return true;
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     Result res = threadJoin(thread->handle, U64_MAX);
@@ -25,6 +25,10 @@
 
 #include "SDL_sysmutex_c.h"
 
+#ifdef SDL_MUTEX_STATS
+#include "../SDL_thread_c.h"
+#endif
+
 SDL_Mutex *SDL_CreateMutex(void)
 {
     SDL_Mutex *mutex;
@@ -53,6 +57,9 @@ SDL_Mutex *SDL_CreateMutex(void)
 void SDL_DestroyMutex(SDL_Mutex *mutex)
 {
     if (mutex) {
+#ifdef SDL_MUTEX_STATS
+        SDL_ForgetMutexStats(mutex);
+#endif
         pthread_mutex_destroy(&mutex->id);
         SDL_free(mutex);
     }
@@ -75,6 +82,15 @@ void SDL_LockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS // clang does
             mutex->owner = this_thread;
             mutex->recursive = 0;
         }
+#elif defined(SDL_MUTEX_STATS)
+        Uint64 wait_start = 0;
+        int rc = pthread_mutex_trylock(&mutex->id);
+        if (rc == EBUSY) {
+            wait_start = SDL_GetPerformanceCounter();
+            rc = pthread_mutex_lock(&mutex->id);
+        }
+        SDL_assert(rc == 0);  // assume we're in a lot of trouble if this assert fails.
+        SDL_RecordMutexLock(mutex, wait_start);
 #else
         const int rc = pthread_mutex_lock(&mutex->id);
         SDL_assert(rc == 0);  // assume we're in a lot of trouble if this assert fails.
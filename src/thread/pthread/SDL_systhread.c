@@ -40,6 +40,16 @@
 #include "../../core/linux/SDL_dbus.h"
 #endif // SDL_PLATFORM_LINUX
 
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef SDL_PLATFORM_APPLE
+#include <pthread/qos.h>
+#endif
+
 #if (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID) || defined(SDL_PLATFORM_MACOS) || defined(SDL_PLATFORM_IOS)) && defined(HAVE_DLOPEN)
 #include <dlfcn.h>
 #ifndef RTLD_DEFAULT
@@ -282,6 +292,178 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif // #if SDL_PLATFORM_RISCOS
 }
 
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+static bool ReadCPUInfoFile(const char *path, char *buf, size_t buflen)
+{
+    ssize_t len;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    len = read(fd, buf, buflen - 1);
+    close(fd);
+    if (len <= 0) {
+        return false;
+    }
+    buf[len] = '\0';
+    return true;
+}
+
+// Parses a kernel CPU list, like "0-3,8,10-11"
+static void ParseCPUList(const char *list, cpu_set_t *set)
+{
+    while (*list) {
+        char *end;
+        long first = SDL_strtol(list, &end, 10);
+        long last = first;
+        if (end == list) {
+            break;
+        }
+        if (*end == '-') {
+            list = end + 1;
+            last = SDL_strtol(list, &end, 10);
+        }
+        for (; first <= last && first < CPU_SETSIZE; ++first) {
+            CPU_SET((int)first, set);
+        }
+        list = end;
+        if (*list == ',') {
+            ++list;
+        } else {
+            break;
+        }
+    }
+}
+
+// Returns false if all the cores are the same kind, or we can't tell them apart
+static bool GetCoreClassCPUs(SDL_ThreadCoreClass core_class, cpu_set_t *set)
+{
+    char buf[256];
+    int capacity[CPU_SETSIZE];
+    int min_capacity = -1, max_capacity = -1;
+    int i, num_cpus;
+
+    CPU_ZERO(set);
+
+    // Intel hybrid CPUs list each kind of core as a separate PMU
+    if (ReadCPUInfoFile("/sys/devices/cpu_core/cpus", buf, sizeof(buf))) {
+        if (core_class == SDL_THREAD_CORE_CLASS_PERFORMANCE) {
+            ParseCPUList(buf, set);
+        } else if (ReadCPUInfoFile("/sys/devices/cpu_atom/cpus", buf, sizeof(buf))) {
+            ParseCPUList(buf, set);
+        }
+        return CPU_COUNT(set) > 0;
+    }
+
+    // ARM systems report a relative capacity for each core
+    num_cpus = (int)SDL_min(sysconf(_SC_NPROCESSORS_CONF), CPU_SETSIZE);
+    for (i = 0; i < num_cpus; ++i) {
+        char path[64];
+
+        capacity[i] = -1;
+        SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", i);
+        if (ReadCPUInfoFile(path, buf, sizeof(buf))) {
+            capacity[i] = SDL_atoi(buf);
+            if (min_capacity < 0 || capacity[i] < min_capacity) {
+                min_capacity = capacity[i];
+            }
+            if (capacity[i] > max_capacity) {
+                max_capacity = capacity[i];
+            }
+        }
+    }
+    if (min_capacity == max_capacity) {
+        return false;
+    }
+
+    // Everything faster than the slowest cores counts as a performance core
+    for (i = 0; i < num_cpus; ++i) {
+        if (capacity[i] < 0) {
+            continue;
+        }
+        if ((core_class == SDL_THREAD_CORE_CLASS_PERFORMANCE) == (capacity[i] > min_capacity)) {
+            CPU_SET(i, set);
+        }
+    }
+    return CPU_COUNT(set) > 0;
+}
+
+static bool SetThreadCPUs(const cpu_set_t *set)
+{
+    // 0 is the calling thread
+    if (sched_setaffinity(0, sizeof(*set), set) < 0) {
+        return SDL_SetError("sched_setaffinity() failed");
+    }
+    return true;
+}
+#endif // SDL_PLATFORM_LINUX || SDL_PLATFORM_ANDROID
+
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+    cpu_set_t set;
+    int i;
+
+    if (mask) {
+        CPU_ZERO(&set);
+        for (i = 0; i < 64; ++i) {
+            if (mask & ((Uint64)1 << i)) {
+                CPU_SET(i, &set);
+            }
+        }
+    } else {
+        // The kernel ignores CPUs that don't exist or that we aren't allowed to use
+        SDL_memset(&set, 0xFF, sizeof(set));
+    }
+    return SetThreadCPUs(&set);
+#else
+    if (!mask) {
+        return true;
+    }
+    return SDL_Unsupported();
+#endif
+}
+
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+    cpu_set_t set;
+
+    if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+        SDL_memset(&set, 0xFF, sizeof(set));
+        return SetThreadCPUs(&set);
+    }
+    if (!GetCoreClassCPUs(core_class, &set)) {
+        return true;
+    }
+    return SetThreadCPUs(&set);
+#elif defined(SDL_PLATFORM_APPLE)
+    qos_class_t qos_class;
+
+    // The scheduler keeps high QoS threads on performance cores when it can
+    switch (core_class) {
+    case SDL_THREAD_CORE_CLASS_PERFORMANCE:
+        qos_class = QOS_CLASS_USER_INTERACTIVE;
+        break;
+    case SDL_THREAD_CORE_CLASS_EFFICIENCY:
+        qos_class = QOS_CLASS_UTILITY;
+        break;
+    default:
+        qos_class = QOS_CLASS_DEFAULT;
+        break;
+    }
+    if (pthread_set_qos_class_self_np(qos_class, 0) != 0) {
+        return SDL_SetError("pthread_set_qos_class_self_np() failed");
+    }
+    return true;
+#else
+    if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+        return true;
+    }
+    return SDL_Unsupported();
+#endif
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     pthread_join(thread->handle, 0);
@@ -22,6 +22,9 @@
 
 extern "C" {
 #include "SDL_systhread_c.h"
+#ifdef SDL_MUTEX_STATS
+#include "../SDL_thread_c.h"
+#endif
 }
 
 #include <system_error>
@@ -48,6 +51,9 @@ extern "C"
 void SDL_DestroyMutex(SDL_Mutex *mutex)
 {
     if (mutex) {
+#ifdef SDL_MUTEX_STATS
+        SDL_ForgetMutexStats(mutex);
+#endif
         delete mutex;
     }
 }
@@ -57,7 +63,16 @@ void SDL_LockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS  // clang doe
 {
     if (mutex) {
         try {
+#ifdef SDL_MUTEX_STATS
+            Uint64 wait_start = 0;
+            if (!mutex->cpp_mutex.try_lock()) {
+                wait_start = SDL_GetPerformanceCounter();
+                mutex->cpp_mutex.lock();
+            }
+            SDL_RecordMutexLock(mutex, wait_start);
+#else
             mutex->cpp_mutex.lock();
+#endif
         } catch (std::system_error &/*ex*/) {
             SDL_assert(!"Error trying to lock mutex");  // assume we're in a lot of trouble if this assert fails.
         }
@@ -97,6 +97,21 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif
 }
 
+extern "C"
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    return SDL_Unsupported();
+}
+
+extern "C"
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+    if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+        return true;
+    }
+    return SDL_Unsupported();
+}
+
 extern "C"
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
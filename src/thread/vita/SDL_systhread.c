@@ -136,4 +136,33 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+    // Applications can use the three user cores
+    int cpumask = 0;
+
+    if (mask & 0x1) {
+        cpumask |= SCE_KERNEL_CPU_MASK_USER_0;
+    }
+    if (mask & 0x2) {
+        cpumask |= SCE_KERNEL_CPU_MASK_USER_1;
+    }
+    if (mask & 0x4) {
+        cpumask |= SCE_KERNEL_CPU_MASK_USER_2;
+    }
+    if (mask && !cpumask) {
+        return SDL_SetError("No usable CPUs in affinity mask");
+    }
+
+    if (sceKernelChangeThreadCpuAffinityMask(0, cpumask) < 0) {
+        return SDL_SetError("sceKernelChangeThreadCpuAffinityMask() failed");
+    }
+    return true;
+}
+
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+    return true;
+}
+
 #endif // SDL_THREAD_VITA
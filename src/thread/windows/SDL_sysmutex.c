@@ -32,6 +32,10 @@
 
 #include "SDL_sysmutex_c.h"
 
+#ifdef SDL_MUTEX_STATS
+#include "../SDL_thread_c.h"
+#endif
+
 // Implementation will be chosen at runtime based on available Kernel features
 SDL_mutex_impl_t SDL_mutex_impl_active = { 0 };
 
@@ -224,6 +228,9 @@ SDL_Mutex *SDL_CreateMutex(void)
 void SDL_DestroyMutex(SDL_Mutex *mutex)
 {
     if (mutex) {
+#ifdef SDL_MUTEX_STATS
+        SDL_ForgetMutexStats(mutex);
+#endif
         SDL_mutex_impl_active.Destroy(mutex);
     }
 }
@@ -231,7 +238,16 @@ void SDL_DestroyMutex(SDL_Mutex *mutex)
 void SDL_LockMutex(SDL_Mutex *mutex)
 {
     if (mutex) {
+#ifdef SDL_MUTEX_STATS
+        Uint64 wait_start = 0;
+        if (!SDL_mutex_impl_active.TryLock(mutex)) {
+            wait_start = SDL_GetPerformanceCounter();
+            SDL_mutex_impl_active.Lock(mutex);
+        }
+        SDL_RecordMutexLock(mutex, wait_start);
+#else
         SDL_mutex_impl_active.Lock(mutex);
+#endif
     }
 }
 
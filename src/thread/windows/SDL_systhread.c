@@ -185,6 +185,162 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(Uint64 mask)
+{
+#ifdef SDL_PLATFORM_WINRT
+    return SDL_Unsupported();
+#else
+    DWORD_PTR thread_mask = (DWORD_PTR)mask;
+
+    if (!mask) {
+        DWORD_PTR system_mask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &thread_mask, &system_mask)) {
+            return WIN_SetError("GetProcessAffinityMask()");
+        }
+    } else if (!thread_mask) {
+        return SDL_SetError("No usable CPUs in affinity mask");
+    }
+    if (!SetThreadAffinityMask(GetCurrentThread(), thread_mask)) {
+        return WIN_SetError("SetThreadAffinityMask()");
+    }
+    return true;
+#endif
+}
+
+#ifndef SDL_PLATFORM_WINRT
+// These match SYSTEM_CPU_SET_INFORMATION, which older SDKs don't have
+typedef struct SDL_CPUSetInformation
+{
+    DWORD Size;
+    DWORD Type;
+    DWORD Id;
+    WORD Group;
+    BYTE LogicalProcessorIndex;
+    BYTE CoreIndex;
+    BYTE LastLevelCacheIndex;
+    BYTE NumaNodeIndex;
+    BYTE EfficiencyClass;
+    BYTE AllFlags;
+    DWORD Reserved;
+    DWORD64 AllocationTag;
+} SDL_CPUSetInformation;
+
+#define SDL_CPU_SET_INFORMATION_TYPE    0
+#define SDL_CPU_SET_ALLOCATED           0x02
+#define SDL_CPU_SET_ALLOCATED_TO_TARGET 0x04
+
+typedef BOOL(WINAPI *pfnGetSystemCpuSetInformation)(void *, ULONG, PULONG, HANDLE, ULONG);
+typedef BOOL(WINAPI *pfnSetThreadSelectedCpuSets)(HANDLE, const ULONG *, ULONG);
+#endif
+
+bool SDL_SYS_SetThreadCoreClass(SDL_ThreadCoreClass core_class)
+{
+#ifdef SDL_PLATFORM_WINRT
+    if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+        return true;
+    }
+    return SDL_Unsupported();
+#else
+    // CPU sets are Windows 10 and newer, they steer the scheduler without hard pinning
+    static pfnGetSystemCpuSetInformation pGetSystemCpuSetInformation = NULL;
+    static pfnSetThreadSelectedCpuSets pSetThreadSelectedCpuSets = NULL;
+    static bool checked_cpusets = false;
+    ULONG length = 0;
+    Uint8 *info = NULL;
+    ULONG *ids = NULL;
+    ULONG num_ids = 0;
+    ULONG offset;
+    int min_class = -1, max_class = -1;
+    bool result;
+
+    if (!checked_cpusets) {
+        HMODULE kernel32 = GetModuleHandle(TEXT("kernel32.dll"));
+        if (kernel32) {
+            pGetSystemCpuSetInformation = (pfnGetSystemCpuSetInformation)GetProcAddress(kernel32, "GetSystemCpuSetInformation");
+            pSetThreadSelectedCpuSets = (pfnSetThreadSelectedCpuSets)GetProcAddress(kernel32, "SetThreadSelectedCpuSets");
+        }
+        checked_cpusets = true;
+    }
+    if (!pGetSystemCpuSetInformation || !pSetThreadSelectedCpuSets) {
+        if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+            return true;
+        }
+        return SDL_Unsupported();
+    }
+
+    if (core_class == SDL_THREAD_CORE_CLASS_ANY) {
+        if (!pSetThreadSelectedCpuSets(GetCurrentThread(), NULL, 0)) {
+            return WIN_SetError("SetThreadSelectedCpuSets()");
+        }
+        return true;
+    }
+
+    pGetSystemCpuSetInformation(NULL, 0, &length, GetCurrentProcess(), 0);
+    if (length == 0) {
+        return WIN_SetError("GetSystemCpuSetInformation()");
+    }
+    info = (Uint8 *)SDL_malloc(length);
+    ids = (ULONG *)SDL_malloc(length);  // there are fewer IDs than bytes of information
+    if (!info || !ids) {
+        SDL_free(info);
+        SDL_free(ids);
+        return false;
+    }
+    if (!pGetSystemCpuSetInformation(info, length, &length, GetCurrentProcess(), 0)) {
+        SDL_free(info);
+        SDL_free(ids);
+        return WIN_SetError("GetSystemCpuSetInformation()");
+    }
+
+    /* A higher efficiency class means a faster, less efficient core.
+       Skip the cores that are reserved for other processes, like the system on Xbox. */
+    for (offset = 0; offset < length; offset += ((SDL_CPUSetInformation *)(info + offset))->Size) {
+        const SDL_CPUSetInformation *cpuset = (const SDL_CPUSetInformation *)(info + offset);
+        if (cpuset->Size == 0) {
+            break;
+        }
+        if (cpuset->Type != SDL_CPU_SET_INFORMATION_TYPE ||
+            ((cpuset->AllFlags & SDL_CPU_SET_ALLOCATED) && !(cpuset->AllFlags & SDL_CPU_SET_ALLOCATED_TO_TARGET))) {
+            continue;
+        }
+        if (min_class < 0 || cpuset->EfficiencyClass < min_class) {
+            min_class = cpuset->EfficiencyClass;
+        }
+        if (cpuset->EfficiencyClass > max_class) {
+            max_class = cpuset->EfficiencyClass;
+        }
+    }
+    if (min_class == max_class) {
+        // All the cores are the same kind
+        SDL_free(info);
+        SDL_free(ids);
+        return true;
+    }
+
+    for (offset = 0; offset < length; offset += ((SDL_CPUSetInformation *)(info + offset))->Size) {
+        const SDL_CPUSetInformation *cpuset = (const SDL_CPUSetInformation *)(info + offset);
+        if (cpuset->Size == 0) {
+            break;
+        }
+        if (cpuset->Type != SDL_CPU_SET_INFORMATION_TYPE ||
+            ((cpuset->AllFlags & SDL_CPU_SET_ALLOCATED) && !(cpuset->AllFlags & SDL_CPU_SET_ALLOCATED_TO_TARGET))) {
+            continue;
+        }
+        if ((core_class == SDL_THREAD_CORE_CLASS_PERFORMANCE) == (cpuset->EfficiencyClass > min_class)) {
+            ids[num_ids++] = cpuset->Id;
+        }
+    }
+
+    result = true;
+    if (!pSetThreadSelectedCpuSets(GetCurrentThread(), ids, num_ids)) {
+        result = WIN_SetError("SetThreadSelectedCpuSets()");
+    }
+    SDL_free(info);
+    SDL_free(ids);
+    return result;
+#endif
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     WaitForSingleObjectEx(thread->handle, INFINITE, FALSE);
@@ -0,0 +1,259 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_timer_c.h"
+
+/* How early to stop sleeping and start spinning. This adapts to how much the
+   system oversleeps, which is well under a millisecond with high resolution
+   timers, like the waitable timers used on Windows 10 and newer. */
+#define MIN_SPIN_NS     SDL_US_TO_NS(100)
+#define MAX_SPIN_NS     SDL_MS_TO_NS(2)
+#define INITIAL_SPIN_NS SDL_MS_TO_NS(1)
+
+struct SDL_FramePacer
+{
+    // The rate is numerator / denominator frames per second
+    Uint64 numerator;
+    Uint64 denominator;
+    SDL_DisplayID displayID;
+
+    /* Deadlines are calculated from the start of the timeline, so rounding
+       errors don't build up. The origin moves forward by whole seconds'
+       worth of frames to keep the math from overflowing. */
+    bool started;
+    Uint64 origin;
+    Uint64 frame;
+
+    Uint64 oversleep_ns;  // running average of how much sleeps overshoot
+    SDL_FramePacerStats stats;
+};
+
+static Uint64 GCD(Uint64 a, Uint64 b)
+{
+    while (b) {
+        const Uint64 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+// The time from the origin to the start of a frame, where frame < numerator
+static Uint64 GetFrameOffset(const SDL_FramePacer *pacer, Uint64 frame)
+{
+    const Uint64 ticks = frame * pacer->denominator;
+    return (ticks / pacer->numerator) * SDL_NS_PER_SECOND +
+           ((ticks % pacer->numerator) * SDL_NS_PER_SECOND) / pacer->numerator;
+}
+
+static Uint64 GetDeadline(const SDL_FramePacer *pacer)
+{
+    return pacer->origin + GetFrameOffset(pacer, pacer->frame);
+}
+
+static void AdvanceFrames(SDL_FramePacer *pacer, Uint64 frames)
+{
+    pacer->frame += frames;
+    if (pacer->frame >= pacer->numerator) {
+        // numerator frames take exactly denominator seconds
+        const Uint64 seconds = pacer->frame / pacer->numerator;
+        pacer->origin += seconds * pacer->denominator * SDL_NS_PER_SECOND;
+        pacer->frame %= pacer->numerator;
+    }
+}
+
+static bool SetFramePacerRate(SDL_FramePacer *pacer, int rate_numerator, int rate_denominator)
+{
+    Uint64 numerator, denominator, gcd;
+
+    if (rate_numerator <= 0) {
+        return SDL_InvalidParamError("rate_numerator");
+    }
+    if (rate_denominator <= 0) {
+        return SDL_InvalidParamError("rate_denominator");
+    }
+
+    gcd = GCD((Uint64)rate_numerator, (Uint64)rate_denominator);
+    numerator = (Uint64)rate_numerator / gcd;
+    denominator = (Uint64)rate_denominator / gcd;
+    if (numerator == pacer->numerator && denominator == pacer->denominator) {
+        return true;
+    }
+
+    if (pacer->started) {
+        // Start a new timeline at the frame we're waiting for
+        pacer->origin = GetDeadline(pacer);
+        pacer->frame = 0;
+    }
+    pacer->numerator = numerator;
+    pacer->denominator = denominator;
+    pacer->stats.period_ns = ((denominator * SDL_NS_PER_SECOND) + (numerator / 2)) / numerator;
+    return true;
+}
+
+static void FollowDisplay(SDL_FramePacer *pacer)
+{
+    const SDL_DisplayMode *mode = SDL_GetCurrentDisplayMode(pacer->displayID);
+
+    if (mode) {
+        if (mode->refresh_rate_numerator > 0 && mode->refresh_rate_denominator > 0) {
+            SetFramePacerRate(pacer, mode->refresh_rate_numerator, mode->refresh_rate_denominator);
+        } else if (mode->refresh_rate > 0.0f) {
+            SetFramePacerRate(pacer, (int)SDL_roundf(mode->refresh_rate * 1000.0f), 1000);
+        }
+    }
+}
+
+SDL_FramePacer *SDL_CreateFramePacer(int rate_numerator, int rate_denominator)
+{
+    SDL_FramePacer *pacer = (SDL_FramePacer *)SDL_calloc(1, sizeof(*pacer));
+    if (!pacer) {
+        return NULL;
+    }
+
+    if (!SetFramePacerRate(pacer, rate_numerator, rate_denominator)) {
+        SDL_free(pacer);
+        return NULL;
+    }
+    pacer->oversleep_ns = INITIAL_SPIN_NS;
+    return pacer;
+}
+
+bool SDL_SetFramePacerRate(SDL_FramePacer *pacer, int rate_numerator, int rate_denominator)
+{
+    if (!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+
+    if (!SetFramePacerRate(pacer, rate_numerator, rate_denominator)) {
+        return false;
+    }
+    pacer->displayID = 0;
+    return true;
+}
+
+bool SDL_SetFramePacerDisplay(SDL_FramePacer *pacer, SDL_DisplayID displayID)
+{
+    if (!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+
+    if (displayID && !SDL_GetCurrentDisplayMode(displayID)) {
+        return false;
+    }
+    pacer->displayID = displayID;
+    if (displayID) {
+        FollowDisplay(pacer);
+    }
+    return true;
+}
+
+Uint64 SDL_WaitFramePacer(SDL_FramePacer *pacer)
+{
+    Uint64 now, deadline;
+
+    if (!pacer) {
+        SDL_InvalidParamError("pacer");
+        return 0;
+    }
+
+    if (pacer->displayID) {
+        FollowDisplay(pacer);
+    }
+
+    now = SDL_GetTicksNS();
+    if (!pacer->started) {
+        pacer->origin = now;
+        pacer->frame = 0;
+        pacer->started = true;
+    }
+    AdvanceFrames(pacer, 1);
+    deadline = GetDeadline(pacer);
+    ++pacer->stats.frames;
+
+    if (now > deadline) {
+        ++pacer->stats.missed;
+
+        // If we're more than a frame behind, drop the frames in between instead of rushing through them
+        if ((now - deadline) >= pacer->stats.period_ns) {
+            const Uint64 behind = (Uint64)(((double)(now - deadline) * pacer->numerator) / ((double)pacer->denominator * SDL_NS_PER_SECOND));
+            if (behind > 0) {
+                AdvanceFrames(pacer, behind);
+                pacer->stats.dropped += behind;
+                deadline = GetDeadline(pacer);
+            }
+        }
+    } else {
+        // Sleep for most of the time, then spin for the rest
+        const Uint64 spin_ns = SDL_clamp(pacer->oversleep_ns + pacer->oversleep_ns / 2, MIN_SPIN_NS, MAX_SPIN_NS);
+        if ((deadline - now) > spin_ns) {
+            const Uint64 wakeup = deadline - spin_ns;
+            Uint64 oversleep;
+
+            SDL_SYS_DelayNS(wakeup - now);
+            now = SDL_GetTicksNS();
+
+            oversleep = (now > wakeup) ? (now - wakeup) : 0;
+            pacer->oversleep_ns = (pacer->oversleep_ns * 7 + oversleep) / 8;
+        }
+        while (now < deadline) {
+            SDL_CPUPauseInstruction();
+            now = SDL_GetTicksNS();
+        }
+    }
+
+    if (now > deadline) {
+        const Uint64 late = now - deadline;
+        pacer->stats.late_ns += late;
+        pacer->stats.max_late_ns = SDL_max(pacer->stats.max_late_ns, late);
+    }
+    return deadline;
+}
+
+void SDL_ResetFramePacer(SDL_FramePacer *pacer)
+{
+    if (pacer) {
+        const Uint64 period_ns = pacer->stats.period_ns;
+
+        pacer->started = false;
+        SDL_zero(pacer->stats);
+        pacer->stats.period_ns = period_ns;
+    }
+}
+
+bool SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats)
+{
+    if (!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_copyp(stats, &pacer->stats);
+    return true;
+}
+
+void SDL_DestroyFramePacer(SDL_FramePacer *pacer)
+{
+    SDL_free(pacer);
+}
@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_timer_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 #include "../thread/SDL_systhread.h"
 
 // #define DEBUG_TIMERS
@@ -36,23 +37,18 @@ typedef struct SDL_Timer
     Uint64 interval;
     Uint64 scheduled;
     SDL_AtomicInt canceled;
-    struct SDL_Timer *next;
+    struct SDL_Timer *next;     // pending list and freelist
+    struct SDL_Timer *child;    // first child in the timer heap
+    struct SDL_Timer *sibling;  // next child of the same parent in the timer heap
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
-
-// The timers are kept in a sorted list
+// The timers are kept in a heap, ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;  // SDL_TimerID -> SDL_Timer *
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -63,9 +59,10 @@ typedef struct
     SDL_Semaphore *sem;
     SDL_Timer *pending;
     SDL_Timer *freelist;
+    Uint64 wakeup;  // when the timer thread will wake up on its own, 0 if it's awake
     SDL_AtomicInt active;
 
-    // List of timers - this is only touched by the timer thread
+    // Heap of timers - this is only touched by the timer thread
     SDL_Timer *timers;
 } SDL_TimerData;
 
@@ -74,27 +71,74 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
+ * The queue is a pairing heap, which links the timers together without
+ * any extra allocations, and adds a timer in constant time, so scheduling
+ * thousands of short timers stays cheap.
+ *
  * Timers are removed by simply setting a canceled flag
  */
 
+static SDL_Timer *SDL_MeldTimers(SDL_Timer *a, SDL_Timer *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (b->scheduled < a->scheduled) {
+        SDL_Timer *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->sibling = a->child;
+    a->child = b;
+    return a;
+}
+
 static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    timer->child = NULL;
+    timer->sibling = NULL;
+    data->timers = SDL_MeldTimers(data->timers, timer);
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
-            break;
+static SDL_Timer *SDL_RemoveNextTimer(SDL_TimerData *data)
+{
+    SDL_Timer *timer = data->timers;
+    SDL_Timer *pairs = NULL;
+    SDL_Timer *child;
+
+    if (!timer) {
+        return NULL;
+    }
+
+    // Meld the children in pairs from left to right, then meld those together from right to left
+    child = timer->child;
+    while (child) {
+        SDL_Timer *a = child;
+        SDL_Timer *b = child->sibling;
+
+        child = b ? b->sibling : NULL;
+        a->sibling = NULL;
+        if (b) {
+            b->sibling = NULL;
         }
+        a = SDL_MeldTimers(a, b);
+        a->sibling = pairs;
+        pairs = a;
     }
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+    data->timers = NULL;
+    while (pairs) {
+        SDL_Timer *next = pairs->sibling;
+        pairs->sibling = NULL;
+        data->timers = SDL_MeldTimers(data->timers, pairs);
+        pairs = next;
     }
-    timer->next = curr;
+
+    timer->child = NULL;
+    return timer;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
@@ -102,14 +146,15 @@ static int SDLCALL SDL_TimerThread(void *_data)
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
     SDL_Timer *current;
+    SDL_Timer *expired;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
-     *  2. Handle any timers that should dispatch this cycle
-     *  3. Wait until next dispatch time or new timer arrives
+     *  2. Handle all the timers that should dispatch this cycle
+     *  3. Wait until next dispatch time or an earlier timer arrives
      */
     for (;;) {
         // Pending and freelist maintenance
@@ -124,10 +169,13 @@ static int SDLCALL SDL_TimerThread(void *_data)
                 freelist_tail->next = data->freelist;
                 data->freelist = freelist_head;
             }
+
+            // We're awake, new timers will be picked up before we sleep again
+            data->wakeup = 0;
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        // Add the pending timers to the heap
         while (pending) {
             current = pending;
             pending = pending->next;
@@ -141,23 +189,27 @@ static int SDLCALL SDL_TimerThread(void *_data)
             break;
         }
 
-        // Initial delay if there are no timers
-        delay = (Uint64)-1;
-
         tick = SDL_GetTicksNS();
 
-        // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
-
-            if (tick < current->scheduled) {
-                // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
-                break;
-            }
+        // Take all the timers that are due for this tick, in order
+        expired = NULL;
+        while (data->timers && data->timers->scheduled <= tick) {
+            current = SDL_RemoveNextTimer(data);
+            current->next = expired;
+            expired = current;
+        }
+        pending = NULL;
+        while (expired) {
+            current = expired;
+            expired = expired->next;
+            current->next = pending;
+            pending = current;
+        }
 
-            // We're going to do something with this timer
-            data->timers = current->next;
+        // Process them as a batch
+        while (pending) {
+            current = pending;
+            pending = pending->next;
 
             if (SDL_GetAtomicInt(&current->canceled)) {
                 interval = 0;
@@ -175,6 +227,7 @@ static int SDLCALL SDL_TimerThread(void *_data)
                 current->scheduled = tick + interval;
                 SDL_AddTimerInternal(data, current);
             } else {
+                current->next = NULL;
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -189,19 +242,38 @@ static int SDLCALL SDL_TimerThread(void *_data)
 
         // Adjust the delay based on processing time
         now = SDL_GetTicksNS();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
+        if (!data->timers) {
+            // Initial delay if there are no timers
+            delay = (Uint64)-1;
+        } else if (data->timers->scheduled > now) {
+            delay = (data->timers->scheduled - now);
         } else {
-            delay -= interval;
+            delay = 0;
         }
 
-        /* Note that each time a timer is added, this will return
-           immediately, but we process the timers added all at once.
-           That's okay, it just means we run through the loop a few
-           extra times.
-         */
-        SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
+        if (delay > 0) {
+            /* Let other threads know when we'll wake up, so they only signal
+               us for timers that are due before that. If timers were added
+               while we were busy, go around again to pick them up instead. */
+            bool sleep = false;
+
+            SDL_LockSpinlock(&data->lock);
+            if (freelist_head) {
+                freelist_tail->next = data->freelist;
+                data->freelist = freelist_head;
+                freelist_head = NULL;
+                freelist_tail = NULL;
+            }
+            if (!data->pending && SDL_GetAtomicInt(&data->active)) {
+                data->wakeup = (delay == (Uint64)-1) ? (Uint64)-1 : (now + delay);
+                sleep = true;
+            }
+            SDL_UnlockSpinlock(&data->lock);
+
+            if (sleep) {
+                SDL_WaitSemaphoreTimeoutNS(data->sem, (delay > (Uint64)SDL_MAX_SINT64) ? -1 : (Sint64)delay);
+            }
+        }
     }
     return 0;
 }
@@ -219,6 +291,11 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
@@ -245,7 +322,6 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -266,9 +342,12 @@ void SDL_QuitTimers(void)
     }
 
     // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
+    while ((timer = SDL_RemoveNextTimer(data)) != NULL) {
+        SDL_free(timer);
+    }
+    while (data->pending) {
+        timer = data->pending;
+        data->pending = timer->next;
         SDL_free(timer);
     }
     while (data->freelist) {
@@ -276,10 +355,11 @@ void SDL_QuitTimers(void)
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+    data->wakeup = 0;
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +379,8 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    SDL_TimerID timerID;
+    bool added, signal;
 
     if (!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -318,7 +399,10 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     SDL_UnlockSpinlock(&data->lock);
 
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        // Forget the finished timer that used this structure
+        SDL_LockMutex(data->timermap_lock);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+        SDL_UnlockMutex(data->timermap_lock);
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
@@ -332,30 +416,32 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->interval = interval;
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
+    timerID = timer->timerID;
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    SDL_LockMutex(data->timermap_lock);
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timerID, timer, false);
+    SDL_UnlockMutex(data->timermap_lock);
+    if (!added) {
         SDL_free(timer);
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
 
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
     timer->next = data->pending;
     data->pending = timer;
+    signal = (timer->scheduled < data->wakeup);
+    if (signal) {
+        data->wakeup = timer->scheduled;
+    }
     SDL_UnlockSpinlock(&data->lock);
 
-    // Wake up the timer thread if necessary
-    SDL_SignalSemaphore(data->sem);
+    // Wake up the timer thread if it would otherwise sleep past this timer
+    if (signal) {
+        SDL_SignalSemaphore(data->sem);
+    }
 
-    return entry->timerID;
+    return timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +457,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer = NULL;
     bool canceled = false;
 
     if (!id) {
@@ -380,26 +466,16 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
-    SDL_UnlockMutex(data->timermap_lock);
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+        if (!SDL_GetAtomicInt(&timer->canceled)) {
+            SDL_SetAtomicInt(&timer->canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
+    SDL_UnlockMutex(data->timermap_lock);
+
     if (canceled) {
         return true;
     } else {
@@ -541,6 +617,41 @@ static Uint32 tick_denominator_ns;
 static Uint32 tick_numerator_ms;
 static Uint32 tick_denominator_ms;
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#define SDL_HAVE_RDTSC
+#define SDL_ReadTSC() __rdtsc()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#define SDL_HAVE_RDTSC
+#define SDL_ReadTSC() __builtin_ia32_rdtsc()
+#endif
+
+typedef enum SDL_EventClockMode
+{
+    SDL_EVENT_CLOCK_PRECISE,
+    SDL_EVENT_CLOCK_TSC,
+    SDL_EVENT_CLOCK_COARSE
+} SDL_EventClockMode;
+
+/* The clock used for event timestamps, see SDL_HINT_EVENT_TIMESTAMPS.
+   The anchor is published with a sequence lock, so any thread can read it
+   without taking a lock while the thread pumping events moves it forward. */
+typedef struct SDL_EventClock
+{
+    SDL_AtomicInt mode;
+    SDL_SpinLock lock;          // serializes writers
+    SDL_AtomicInt sequence;     // odd while the anchor is being written
+    Uint64 base_tsc;            // first calibration point
+    Uint64 base_ns;
+    Uint64 anchor_tsc;          // latest calibration point
+    Uint64 anchor_ns;
+    double ns_per_tsc;          // 0 until the TSC has been calibrated
+} SDL_EventClock;
+
+static SDL_EventClock event_clock;
+
+// Don't trust the TSC rate until it has been measured against the tick counter for this long
+#define SDL_EVENT_CLOCK_CALIBRATION_NS SDL_MS_TO_NS(10)
+
 #if defined(SDL_TIMER_WINDOWS) && !defined(SDL_PLATFORM_WINRT) && !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
 #include <mmsystem.h>
 #define HAVE_TIME_BEGIN_PERIOD
@@ -580,6 +691,64 @@ static void SDLCALL SDL_TimerResolutionChanged(void *userdata, const char *name,
     }
 }
 
+static void SDL_WriteEventClock(Uint64 base_tsc, Uint64 base_ns, Uint64 anchor_tsc, Uint64 anchor_ns, double ns_per_tsc)
+{
+    SDL_AddAtomicInt(&event_clock.sequence, 1);
+    SDL_MemoryBarrierRelease();
+    event_clock.base_tsc = base_tsc;
+    event_clock.base_ns = base_ns;
+    event_clock.anchor_tsc = anchor_tsc;
+    event_clock.anchor_ns = anchor_ns;
+    event_clock.ns_per_tsc = ns_per_tsc;
+    SDL_MemoryBarrierRelease();
+    SDL_AddAtomicInt(&event_clock.sequence, 1);
+}
+
+static void SDL_ReadEventClock(Uint64 *anchor_tsc, Uint64 *anchor_ns, double *ns_per_tsc)
+{
+    int sequence;
+
+    for (;;) {
+        sequence = SDL_GetAtomicInt(&event_clock.sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        SDL_MemoryBarrierAcquire();
+        *anchor_tsc = event_clock.anchor_tsc;
+        *anchor_ns = event_clock.anchor_ns;
+        *ns_per_tsc = event_clock.ns_per_tsc;
+        SDL_MemoryBarrierAcquire();
+        if (SDL_GetAtomicInt(&event_clock.sequence) == sequence) {
+            break;
+        }
+    }
+}
+
+static void SDLCALL SDL_EventTimestampsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_EventClockMode mode = SDL_EVENT_CLOCK_PRECISE;
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "tsc") == 0) {
+#ifdef SDL_HAVE_RDTSC
+            if (SDL_HasInvariantTSC()) {
+                mode = SDL_EVENT_CLOCK_TSC;
+            }
+#endif
+        } else if (SDL_strcasecmp(hint, "coarse") == 0) {
+            mode = SDL_EVENT_CLOCK_COARSE;
+        }
+    }
+
+    // Start over, the anchor is filled in again by the next SDL_UpdateEventTicks()
+    SDL_LockSpinlock(&event_clock.lock);
+    SDL_SetAtomicInt(&event_clock.mode, SDL_EVENT_CLOCK_PRECISE);
+    SDL_WriteEventClock(0, 0, 0, 0, 0.0);
+    SDL_SetAtomicInt(&event_clock.mode, mode);
+    SDL_UnlockSpinlock(&event_clock.lock);
+}
+
 void SDL_InitTicks(void)
 {
     Uint64 tick_freq;
@@ -609,12 +778,18 @@ void SDL_InitTicks(void)
     if (!tick_start) {
         --tick_start;
     }
+
+    SDL_AddHintCallback(SDL_HINT_EVENT_TIMESTAMPS,
+                        SDL_EventTimestampsChanged, NULL);
 }
 
 void SDL_QuitTicks(void)
 {
     SDL_RemoveHintCallback(SDL_HINT_TIMER_RESOLUTION,
                         SDL_TimerResolutionChanged, NULL);
+    SDL_RemoveHintCallback(SDL_HINT_EVENT_TIMESTAMPS,
+                        SDL_EventTimestampsChanged, NULL);
+    SDL_SetAtomicInt(&event_clock.mode, SDL_EVENT_CLOCK_PRECISE);
 
     SDL_SetSystemTimerResolutionMS(0); // always release our timer resolution request.
 
@@ -651,6 +826,73 @@ Uint64 SDL_GetTicks(void)
     return value;
 }
 
+Uint64 SDL_GetEventTicksNS(void)
+{
+    Uint64 anchor_tsc, anchor_ns;
+    double ns_per_tsc;
+
+    switch (SDL_GetAtomicInt(&event_clock.mode)) {
+#ifdef SDL_HAVE_RDTSC
+    case SDL_EVENT_CLOCK_TSC:
+    {
+        Uint64 tsc = SDL_ReadTSC();
+
+        SDL_ReadEventClock(&anchor_tsc, &anchor_ns, &ns_per_tsc);
+        if (ns_per_tsc > 0.0) {
+            if (tsc <= anchor_tsc) {
+                return anchor_ns;
+            }
+            return anchor_ns + (Uint64)((double)(tsc - anchor_tsc) * ns_per_tsc);
+        }
+        break;
+    }
+#endif
+    case SDL_EVENT_CLOCK_COARSE:
+        SDL_ReadEventClock(&anchor_tsc, &anchor_ns, &ns_per_tsc);
+        if (anchor_ns) {
+            return anchor_ns;
+        }
+        break;
+    default:
+        break;
+    }
+    return SDL_GetTicksNS();
+}
+
+void SDL_UpdateEventTicks(void)
+{
+    SDL_EventClockMode mode = (SDL_EventClockMode)SDL_GetAtomicInt(&event_clock.mode);
+
+    if (mode == SDL_EVENT_CLOCK_PRECISE) {
+        return;
+    }
+
+    SDL_LockSpinlock(&event_clock.lock);
+    mode = (SDL_EventClockMode)SDL_GetAtomicInt(&event_clock.mode);
+    if (mode == SDL_EVENT_CLOCK_COARSE) {
+        SDL_WriteEventClock(0, 0, 0, SDL_GetTicksNS(), 0.0);
+#ifdef SDL_HAVE_RDTSC
+    } else if (mode == SDL_EVENT_CLOCK_TSC) {
+        // Measure the TSC rate over everything seen so far and re-anchor it to the tick counter, so the two don't drift apart
+        Uint64 tsc = SDL_ReadTSC();
+        Uint64 ns = SDL_GetTicksNS();
+        Uint64 base_tsc = event_clock.base_tsc;
+        Uint64 base_ns = event_clock.base_ns;
+        double ns_per_tsc = event_clock.ns_per_tsc;
+
+        if (!base_tsc || tsc <= base_tsc || ns < base_ns) {
+            base_tsc = tsc;
+            base_ns = ns;
+            ns_per_tsc = 0.0;
+        } else if ((ns - base_ns) >= SDL_EVENT_CLOCK_CALIBRATION_NS) {
+            ns_per_tsc = (double)(ns - base_ns) / (double)(tsc - base_tsc);
+        }
+        SDL_WriteEventClock(base_tsc, base_ns, tsc, ns, ns_per_tsc);
+#endif
+    }
+    SDL_UnlockSpinlock(&event_clock.lock);
+}
+
 void SDL_Delay(Uint32 ms)
 {
     SDL_SYS_DelayNS(SDL_MS_TO_NS(ms));
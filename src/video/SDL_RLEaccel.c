@@ -90,6 +90,8 @@
 #include "SDL_sysvideo.h"
 #include "SDL_surface_c.h"
 #include "SDL_RLEaccel_c.h"
+#include "SDL_pixels_c.h"
+#include "SDL_surface_threads_c.h"
 
 #define PIXEL_COPY(to, from, len, bpp) \
     SDL_memcpy(to, from, (size_t)(len) * (bpp))
@@ -604,17 +606,183 @@ done:
         dst = (Uint16)(d | d >> 16);       \
     } while (0)
 
+// Returns whether the vectorized run scanning and blending can be used
+static bool RLEHasSIMD(void)
+{
+#if defined(SDL_SSE2_INTRINSICS)
+    return SDL_HasSSE2();
+#elif defined(SDL_NEON_INTRINSICS)
+    return SDL_HasNEON();
+#else
+    return false;
+#endif
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+// The low 32 bits of a * b in each lane, SSE2 doesn't have _mm_mullo_epi32()
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RLEMulLo32SSE2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/*
+ * These do the same packed arithmetic as BLIT_TRANSL_888 and BLIT_TRANSL_565/555
+ * on 4 pixels at a time, so the results are identical to the scalar code.
+ */
+static int SDL_TARGETING("sse2") BlitTranslRun888SSE2(Uint32 *dst, const Uint32 *src, int n)
+{
+    const __m128i rbmask = _mm_set1_epi32(0xff00ff);
+    const __m128i gmask = _mm_set1_epi32(0xff00);
+    const __m128i amask = _mm_set1_epi32((int)0xff000000);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i alpha = _mm_srli_epi32(s, 24);
+        __m128i s1 = _mm_and_si128(s, rbmask);
+        __m128i d1 = _mm_and_si128(d, rbmask);
+        d1 = _mm_add_epi32(d1, _mm_srli_epi32(RLEMulLo32SSE2(_mm_sub_epi32(s1, d1), alpha), 8));
+        d1 = _mm_and_si128(d1, rbmask);
+        s = _mm_and_si128(s, gmask);
+        d = _mm_and_si128(d, gmask);
+        d = _mm_add_epi32(d, _mm_srli_epi32(RLEMulLo32SSE2(_mm_sub_epi32(s, d), alpha), 8));
+        d = _mm_and_si128(d, gmask);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_or_si128(d1, d), amask));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") BlitTranslRun16SSE2(Uint16 *dst, const Uint32 *src, int n, Uint32 mask)
+{
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    const __m128i amask = _mm_set1_epi32(0x3e0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(dst + i)), _mm_setzero_si128());
+        __m128i alpha = _mm_srli_epi32(_mm_and_si128(s, amask), 5);
+        s = _mm_and_si128(s, vmask);
+        d = _mm_and_si128(_mm_or_si128(d, _mm_slli_epi32(d, 16)), vmask);
+        d = _mm_add_epi32(d, _mm_srli_epi32(RLEMulLo32SSE2(_mm_sub_epi32(s, d), alpha), 5));
+        d = _mm_and_si128(d, vmask);
+        d = _mm_or_si128(d, _mm_srli_epi32(d, 16));
+        // Sign extend the low 16 bits so the saturating pack keeps them as they are
+        d = _mm_srai_epi32(_mm_slli_epi32(d, 16), 16);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packs_epi32(d, d));
+    }
+    return i;
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+static int BlitTranslRun888NEON(Uint32 *dst, const Uint32 *src, int n)
+{
+    const uint32x4_t rbmask = vdupq_n_u32(0xff00ff);
+    const uint32x4_t gmask = vdupq_n_u32(0xff00);
+    const uint32x4_t amask = vdupq_n_u32(0xff000000);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        uint32x4_t s = vld1q_u32(src + i);
+        uint32x4_t d = vld1q_u32(dst + i);
+        uint32x4_t alpha = vshrq_n_u32(s, 24);
+        uint32x4_t s1 = vandq_u32(s, rbmask);
+        uint32x4_t d1 = vandq_u32(d, rbmask);
+        d1 = vandq_u32(vaddq_u32(d1, vshrq_n_u32(vmulq_u32(vsubq_u32(s1, d1), alpha), 8)), rbmask);
+        s = vandq_u32(s, gmask);
+        d = vandq_u32(d, gmask);
+        d = vandq_u32(vaddq_u32(d, vshrq_n_u32(vmulq_u32(vsubq_u32(s, d), alpha), 8)), gmask);
+        vst1q_u32(dst + i, vorrq_u32(vorrq_u32(d1, d), amask));
+    }
+    return i;
+}
+
+static int BlitTranslRun16NEON(Uint16 *dst, const Uint32 *src, int n, Uint32 mask)
+{
+    const uint32x4_t vmask = vdupq_n_u32(mask);
+    const uint32x4_t amask = vdupq_n_u32(0x3e0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        uint32x4_t s = vld1q_u32(src + i);
+        uint32x4_t d = vmovl_u16(vld1_u16(dst + i));
+        uint32x4_t alpha = vshrq_n_u32(vandq_u32(s, amask), 5);
+        s = vandq_u32(s, vmask);
+        d = vandq_u32(vorrq_u32(d, vshlq_n_u32(d, 16)), vmask);
+        d = vandq_u32(vaddq_u32(d, vshrq_n_u32(vmulq_u32(vsubq_u32(s, d), alpha), 5)), vmask);
+        d = vorrq_u32(d, vshrq_n_u32(d, 16));
+        vst1_u16(dst + i, vmovn_u32(d));
+    }
+    return i;
+}
+#endif // SDL_NEON_INTRINSICS
+
+// blend a run of translucent pixels, using SIMD for the bulk of the run if available
+static void BlitTranslRun888(Uint32 *dst, const Uint32 *src, int n, bool simd)
+{
+    int i = 0;
+
+    if (simd) {
+#if defined(SDL_SSE2_INTRINSICS)
+        i = BlitTranslRun888SSE2(dst, src, n);
+#elif defined(SDL_NEON_INTRINSICS)
+        i = BlitTranslRun888NEON(dst, src, n);
+#endif
+    }
+    for (; i < n; i++) {
+        BLIT_TRANSL_888(src[i], dst[i]);
+    }
+}
+
+static void BlitTranslRun565(Uint16 *dst, const Uint32 *src, int n, bool simd)
+{
+    int i = 0;
+
+    if (simd) {
+#if defined(SDL_SSE2_INTRINSICS)
+        i = BlitTranslRun16SSE2(dst, src, n, 0x07e0f81f);
+#elif defined(SDL_NEON_INTRINSICS)
+        i = BlitTranslRun16NEON(dst, src, n, 0x07e0f81f);
+#endif
+    }
+    for (; i < n; i++) {
+        BLIT_TRANSL_565(src[i], dst[i]);
+    }
+}
+
+static void BlitTranslRun555(Uint16 *dst, const Uint32 *src, int n, bool simd)
+{
+    int i = 0;
+
+    if (simd) {
+#if defined(SDL_SSE2_INTRINSICS)
+        i = BlitTranslRun16SSE2(dst, src, n, 0x03e07c1f);
+#elif defined(SDL_NEON_INTRINSICS)
+        i = BlitTranslRun16NEON(dst, src, n, 0x03e07c1f);
+#endif
+    }
+    for (; i < n; i++) {
+        BLIT_TRANSL_555(src[i], dst[i]);
+    }
+}
+
 // blit a pixel-alpha RLE surface clipped at the right and/or left edges
 static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
                              Uint8 *dstbuf, const SDL_Rect *srcrect)
 {
     const SDL_PixelFormatDetails *df = surf_dst->fmt;
+    const bool simd = RLEHasSIMD();
     /*
      * clipped blitter: Ptype is the destination pixel type,
-     * Ctype the translucent count type, and do_blend the macro
-     * to blend one pixel.
+     * Ctype the translucent count type, and do_blend_run the function
+     * to blend a run of pixels.
      */
-#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend)                          \
+#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend_run)                          \
     do {                                                                  \
         int linecount = srcrect->h;                                       \
         int left = srcrect->x;                                            \
@@ -667,13 +835,10 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
                     }                                                     \
                     if (crun > right - cofs)                              \
                         crun = right - cofs;                              \
-                    if (crun > 0) {                                       \
-                        Ptype *dst = (Ptype *)dstbuf + cofs;              \
-                        Uint32 *src = (Uint32 *)srcbuf + (cofs - ofs);    \
-                        int i;                                            \
-                        for (i = 0; i < crun; i++)                        \
-                            do_blend(src[i], dst[i]);                     \
-                    }                                                     \
+                    if (crun > 0)                                         \
+                        do_blend_run((Ptype *)dstbuf + cofs,              \
+                                     (Uint32 *)srcbuf + (cofs - ofs),     \
+                                     crun, simd);                         \
                     srcbuf += run * 4;                                    \
                     ofs += run;                                           \
                 }                                                         \
@@ -685,13 +850,13 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
     switch (df->bytes_per_pixel) {
     case 2:
         if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BlitTranslRun565);
         } else {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BlitTranslRun555);
         }
         break;
     case 4:
-        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888);
+        RLEALPHACLIPBLIT(Uint32, Uint16, BlitTranslRun888);
         break;
     }
 }
@@ -779,13 +944,14 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
     if (srcrect->x || srcrect->w != surf_src->w) {
         RLEAlphaClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect);
     } else {
+        const bool simd = RLEHasSIMD();
 
         /*
          * non-clipped blitter. Ptype is the destination pixel type,
-         * Ctype the translucent count type, and do_blend the
-         * macro to blend one pixel.
+         * Ctype the translucent count type, and do_blend_run the
+         * function to blend a run of pixels.
          */
-#define RLEALPHABLIT(Ptype, Ctype, do_blend)                         \
+#define RLEALPHABLIT(Ptype, Ctype, do_blend_run)                         \
     do {                                                             \
         int linecount = srcrect->h;                                  \
         do {                                                         \
@@ -815,14 +981,9 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
                 run = ((Uint16 *)srcbuf)[1];                         \
                 srcbuf += 4;                                         \
                 if (run) {                                           \
-                    Ptype *dst = (Ptype *)dstbuf + ofs;              \
-                    unsigned i;                                      \
-                    for (i = 0; i < run; i++) {                      \
-                        Uint32 src = *(Uint32 *)srcbuf;              \
-                        do_blend(src, *dst);                         \
-                        srcbuf += 4;                                 \
-                        dst++;                                       \
-                    }                                                \
+                    do_blend_run((Ptype *)dstbuf + ofs,              \
+                                 (Uint32 *)srcbuf, (int)run, simd);  \
+                    srcbuf += run * 4;                               \
                     ofs += run;                                      \
                 }                                                    \
             } while (ofs < w);                                       \
@@ -833,13 +994,13 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
         switch (df->bytes_per_pixel) {
         case 2:
             if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565);
+                RLEALPHABLIT(Uint16, Uint8, BlitTranslRun565);
             } else {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555);
+                RLEALPHABLIT(Uint16, Uint8, BlitTranslRun555);
             }
             break;
         case 4:
-            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888);
+            RLEALPHABLIT(Uint32, Uint16, BlitTranslRun888);
             break;
         }
     }
@@ -987,32 +1148,219 @@ static int uncopy_32(Uint32 *dst, const void *src, int n,
 #define ISTRANSL(pixel, fmt) \
     ((unsigned)((((pixel)&fmt->Amask) >> fmt->Ashift) - 1U) < 254U)
 
-// convert surface to be quickly alpha-blittable onto dest, if possible
-static bool RLEAlphaSurface(SDL_Surface *surface)
+typedef int (*SDL_RLECopyFunc)(void *, const Uint32 *, int,
+                               const SDL_PixelFormatDetails *, const SDL_PixelFormatDetails *);
+
+// The source pixels and target format of an encoding, so it can be done without the surface
+typedef struct SDL_RLEEncoding
 {
-    SDL_Surface *dest;
+    const SDL_PixelFormatDetails *sf;
     const SDL_PixelFormatDetails *df;
-    int maxsize = 0;
-    int max_opaque_run;
-    int max_transl_run = 65535;
-    unsigned masksum;
-    Uint8 *rlebuf, *dst;
-    int (*copy_opaque)(void *, const Uint32 *, int,
-                       const SDL_PixelFormatDetails *, const SDL_PixelFormatDetails *);
-    int (*copy_transl)(void *, const Uint32 *, int,
-                       const SDL_PixelFormatDetails *, const SDL_PixelFormatDetails *);
+    const Uint8 *pixels;
+    int w, h;
+    int pitch;
+    Uint32 colorkey;
+    bool simd;
+} SDL_RLEEncoding;
 
-    dest = surface->map.info.dst_surface;
-    if (!dest) {
-        return false;
+/*
+ * Run detection:
+ * These skip whole blocks of pixels that continue the current run, where a
+ * pixel belongs to the run if its test result equals match, and return the
+ * position of the first block that doesn't. The scalar loops in the encoder
+ * then find the exact end of the run.
+ */
+#ifdef SDL_SSE2_INTRINSICS
+#define SKIP_KEY_RUN_SSE2(set1, cmpeq, type)                                        \
+    do {                                                                            \
+        const __m128i vmask = set1((type)mask);                                     \
+        const __m128i vkey = set1((type)key);                                       \
+        const int n = 16 / bpp;                                                     \
+        while (x + n <= w) {                                                        \
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + x * bpp));          \
+            if (_mm_movemask_epi8(cmpeq(_mm_and_si128(v, vmask), vkey)) != expect) { \
+                break;                                                              \
+            }                                                                       \
+            x += n;                                                                 \
+        }                                                                           \
+    } while (0)
+
+static int SDL_TARGETING("sse2") SkipKeyRunSSE2(const Uint8 *src, int x, int w, int bpp, Uint32 mask, Uint32 key, bool match)
+{
+    const int expect = match ? 0xFFFF : 0;
+
+    switch (bpp) {
+    case 1:
+        SKIP_KEY_RUN_SSE2(_mm_set1_epi8, _mm_cmpeq_epi8, char);
+        break;
+    case 2:
+        SKIP_KEY_RUN_SSE2(_mm_set1_epi16, _mm_cmpeq_epi16, short);
+        break;
+    case 4:
+        SKIP_KEY_RUN_SSE2(_mm_set1_epi32, _mm_cmpeq_epi32, int);
+        break;
+    }
+    return x;
+}
+
+#undef SKIP_KEY_RUN_SSE2
+
+static int SDL_TARGETING("sse2") SkipTranslRunSSE2(const Uint32 *src, int x, int w, Uint32 amask, bool match)
+{
+    const __m128i vmask = _mm_set1_epi32((int)amask);
+    const __m128i zero = _mm_setzero_si128();
+    // the bytes of pixels that are fully transparent or fully opaque
+    const int expect = match ? 0 : 0xFFFF;
+
+    while (x + 4 <= w) {
+        __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + x)), vmask);
+        __m128i solid = _mm_or_si128(_mm_cmpeq_epi32(a, zero), _mm_cmpeq_epi32(a, vmask));
+        if (_mm_movemask_epi8(solid) != expect) {
+            break;
+        }
+        x += 4;
+    }
+    return x;
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+// Returns whether all the lanes of a comparison are set (if match is true) or clear
+static SDL_INLINE bool RLELanesEqualNEON(uint32x4_t v, bool match)
+{
+    if (match) {
+        uint32x2_t all = vand_u32(vget_low_u32(v), vget_high_u32(v));
+        return (vget_lane_u32(all, 0) & vget_lane_u32(all, 1)) == 0xFFFFFFFF;
+    } else {
+        uint32x2_t any = vorr_u32(vget_low_u32(v), vget_high_u32(v));
+        return (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) == 0;
+    }
+}
+
+static int SkipKeyRunNEON(const Uint8 *src, int x, int w, int bpp, Uint32 mask, Uint32 key, bool match)
+{
+    switch (bpp) {
+    case 1:
+    {
+        const uint8x16_t vmask = vdupq_n_u8((Uint8)mask);
+        const uint8x16_t vkey = vdupq_n_u8((Uint8)key);
+        while (x + 16 <= w) {
+            uint8x16_t eq = vceqq_u8(vandq_u8(vld1q_u8(src + x), vmask), vkey);
+            if (!RLELanesEqualNEON(vreinterpretq_u32_u8(eq), match)) {
+                break;
+            }
+            x += 16;
+        }
+        break;
+    }
+    case 2:
+    {
+        const uint16x8_t vmask = vdupq_n_u16((Uint16)mask);
+        const uint16x8_t vkey = vdupq_n_u16((Uint16)key);
+        while (x + 8 <= w) {
+            uint16x8_t eq = vceqq_u16(vandq_u16(vld1q_u16((const Uint16 *)src + x), vmask), vkey);
+            if (!RLELanesEqualNEON(vreinterpretq_u32_u16(eq), match)) {
+                break;
+            }
+            x += 8;
+        }
+        break;
+    }
+    case 4:
+    {
+        const uint32x4_t vmask = vdupq_n_u32(mask);
+        const uint32x4_t vkey = vdupq_n_u32(key);
+        while (x + 4 <= w) {
+            uint32x4_t eq = vceqq_u32(vandq_u32(vld1q_u32((const Uint32 *)src + x), vmask), vkey);
+            if (!RLELanesEqualNEON(eq, match)) {
+                break;
+            }
+            x += 4;
+        }
+        break;
+    }
+    }
+    return x;
+}
+
+static int SkipTranslRunNEON(const Uint32 *src, int x, int w, Uint32 amask, bool match)
+{
+    const uint32x4_t vmask = vdupq_n_u32(amask);
+    const uint32x4_t zero = vdupq_n_u32(0);
+
+    while (x + 4 <= w) {
+        uint32x4_t a = vandq_u32(vld1q_u32(src + x), vmask);
+        uint32x4_t solid = vorrq_u32(vceqq_u32(a, zero), vceqq_u32(a, vmask));
+        if (!RLELanesEqualNEON(solid, !match)) {
+            break;
+        }
+        x += 4;
+    }
+    return x;
+}
+#endif // SDL_NEON_INTRINSICS
+
+static int SkipKeyRun(const Uint8 *src, int x, int w, int bpp, Uint32 mask, Uint32 key, bool match)
+{
+#if defined(SDL_SSE2_INTRINSICS)
+    return SkipKeyRunSSE2(src, x, w, bpp, mask, key, match);
+#elif defined(SDL_NEON_INTRINSICS)
+    return SkipKeyRunNEON(src, x, w, bpp, mask, key, match);
+#else
+    return x;
+#endif
+}
+
+static int SkipTranslRun(const Uint32 *src, int x, int w, Uint32 amask, bool match)
+{
+#if defined(SDL_SSE2_INTRINSICS)
+    return SkipTranslRunSSE2(src, x, w, amask, match);
+#elif defined(SDL_NEON_INTRINSICS)
+    return SkipTranslRunNEON(src, x, w, amask, match);
+#else
+    return x;
+#endif
+}
+
+// find the end of a run of opaque (or not opaque) pixels
+static int FindOpaqueRunEnd(const SDL_RLEEncoding *enc, const Uint32 *src, int x, bool match)
+{
+    const SDL_PixelFormatDetails *sf = enc->sf;
+
+    if (enc->simd && sf->Abits == 8) {
+        x = SkipKeyRun((const Uint8 *)src, x, enc->w, 4, sf->Amask, sf->Amask, match);
     }
-    df = dest->fmt;
-    if (surface->fmt->bits_per_pixel != 32) {
+    while (x < enc->w && (bool)ISOPAQUE(src[x], sf) == match) {
+        x++;
+    }
+    return x;
+}
+
+// find the end of a run of translucent (or not translucent) pixels
+static int FindTranslRunEnd(const SDL_RLEEncoding *enc, const Uint32 *src, int x, bool match)
+{
+    const SDL_PixelFormatDetails *sf = enc->sf;
+
+    if (enc->simd && sf->Abits == 8) {
+        x = SkipTranslRun(src, x, enc->w, sf->Amask, match);
+    }
+    while (x < enc->w && (bool)ISTRANSL(src[x], sf) == match) {
+        x++;
+    }
+    return x;
+}
+
+// Returns the encoding functions for a target format, or false if it isn't supported
+static bool GetRLEAlphaCopyFuncs(const SDL_PixelFormatDetails *sf, const SDL_PixelFormatDetails *df,
+                                 SDL_RLECopyFunc *copy_opaque, SDL_RLECopyFunc *copy_transl)
+{
+    unsigned masksum;
+
+    if (sf->bits_per_pixel != 32) {
         return false; // only 32bpp source supported
     }
 
-    /* find out whether the destination is one we support,
-       and determine the max size of the encoded result */
+    // find out whether the destination is one we support
     masksum = df->Rmask | df->Gmask | df->Bmask;
     switch (df->bytes_per_pixel) {
     case 2:
@@ -1020,16 +1368,16 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
         switch (masksum) {
         case 0xffff:
             if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                copy_opaque = copy_opaque_16;
-                copy_transl = copy_transl_565;
+                *copy_opaque = copy_opaque_16;
+                *copy_transl = copy_transl_565;
             } else {
                 return false;
             }
             break;
         case 0x7fff:
             if (df->Gmask == 0x03e0 || df->Rmask == 0x03e0 || df->Bmask == 0x03e0) {
-                copy_opaque = copy_opaque_16;
-                copy_transl = copy_transl_555;
+                *copy_opaque = copy_opaque_16;
+                *copy_transl = copy_transl_555;
             } else {
                 return false;
             }
@@ -1037,42 +1385,64 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
         default:
             return false;
         }
-        max_opaque_run = 255; // runs stored as bytes
-
-        /* worst case is alternating opaque and translucent pixels,
-           with room for alignment padding between lines */
-        maxsize = surface->h * (2 + (4 + 2) * (surface->w + 1)) + 2;
         break;
     case 4:
         if (masksum != 0x00ffffff) {
             return false; // requires unused high byte
         }
-        copy_opaque = copy_32;
-        copy_transl = copy_32;
-        max_opaque_run = 255; // runs stored as short ints
-
-        // worst case is alternating opaque and translucent pixels
-        maxsize = surface->h * 2 * 4 * (surface->w + 1) + 4;
+        *copy_opaque = copy_32;
+        *copy_transl = copy_32;
         break;
     default:
         return false; // anything else unsupported right now
     }
+    return true;
+}
+
+// encode pixels to be quickly alpha-blittable onto the target format, if possible
+static Uint8 *RLEAlphaEncode(const SDL_RLEEncoding *enc)
+{
+    const SDL_PixelFormatDetails *df = enc->df;
+    int maxsize = 0;
+    int max_opaque_run;
+    int max_transl_run = 65535;
+    Uint8 *rlebuf, *dst;
+    SDL_RLECopyFunc copy_opaque;
+    SDL_RLECopyFunc copy_transl;
+
+    if (!GetRLEAlphaCopyFuncs(enc->sf, df, &copy_opaque, &copy_transl)) {
+        return NULL;
+    }
+
+    // determine the max size of the encoded result
+    if (df->bytes_per_pixel == 2) {
+        max_opaque_run = 255; // runs stored as bytes
+
+        /* worst case is alternating opaque and translucent pixels,
+           with room for alignment padding between lines */
+        maxsize = enc->h * (2 + (4 + 2) * (enc->w + 1)) + 2;
+    } else {
+        max_opaque_run = 255; // runs stored as short ints
+
+        // worst case is alternating opaque and translucent pixels
+        maxsize = enc->h * 2 * 4 * (enc->w + 1) + 4;
+    }
 
     maxsize += sizeof(SDL_PixelFormat);
     rlebuf = (Uint8 *)SDL_malloc(maxsize);
     if (!rlebuf) {
-        return false;
+        return NULL;
     }
     // save the destination format so we can undo the encoding later
-    *(SDL_PixelFormat *)rlebuf = dest->format;
+    *(SDL_PixelFormat *)rlebuf = df->format;
     dst = rlebuf + sizeof(SDL_PixelFormat);
 
     // Do the actual encoding
     {
         int x, y;
-        int h = surface->h, w = surface->w;
-        const SDL_PixelFormatDetails *sf = surface->fmt;
-        Uint32 *src = (Uint32 *)surface->pixels;
+        int h = enc->h, w = enc->w;
+        const SDL_PixelFormatDetails *sf = enc->sf;
+        const Uint32 *src = (const Uint32 *)enc->pixels;
         Uint8 *lastline = dst; // end of last non-blank line
 
         // opaque counts are 8 or 16 bits, depending on target depth
@@ -1099,13 +1469,9 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
             do {
                 int run, skip, len;
                 skipstart = x;
-                while (x < w && !ISOPAQUE(src[x], sf)) {
-                    x++;
-                }
+                x = FindOpaqueRunEnd(enc, src, x, false);
                 runstart = x;
-                while (x < w && ISOPAQUE(src[x], sf)) {
-                    x++;
-                }
+                x = FindOpaqueRunEnd(enc, src, x, true);
                 skip = runstart - skipstart;
                 if (skip == w) {
                     blankline = 1;
@@ -1137,13 +1503,9 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
             do {
                 int run, skip, len;
                 skipstart = x;
-                while (x < w && !ISTRANSL(src[x], sf)) {
-                    x++;
-                }
+                x = FindTranslRunEnd(enc, src, x, false);
                 runstart = x;
-                while (x < w && ISTRANSL(src[x], sf)) {
-                    x++;
-                }
+                x = FindTranslRunEnd(enc, src, x, true);
                 skip = runstart - skipstart;
                 blankline &= (skip == w);
                 run = x - runstart;
@@ -1168,7 +1530,7 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
                 }
             } while (x < w);
 
-            src += surface->pitch >> 2;
+            src += enc->pitch >> 2;
         }
         dst = lastline; // back up past trailing blank lines
         ADD_OPAQUE_COUNTS(0, 0);
@@ -1177,27 +1539,14 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
 #undef ADD_OPAQUE_COUNTS
 #undef ADD_TRANSL_COUNTS
 
-    // Now that we have it encoded, release the original pixels
-    if (!(surface->flags & SDL_SURFACE_PREALLOCATED)) {
-        if (surface->flags & SDL_SURFACE_SIMD_ALIGNED) {
-            SDL_aligned_free(surface->pixels);
-            surface->flags &= ~SDL_SURFACE_SIMD_ALIGNED;
-        } else {
-            SDL_free(surface->pixels);
-        }
-        surface->pixels = NULL;
-    }
-
     // reallocate the buffer to release unused memory
     {
         Uint8 *p = (Uint8 *)SDL_realloc(rlebuf, dst - rlebuf);
         if (!p) {
             p = rlebuf;
         }
-        surface->map.data = p;
+        return p;
     }
-
-    return true;
 }
 
 static Uint32 getpix_8(const Uint8 *srcbuf)
@@ -1230,63 +1579,74 @@ static const getpix_func getpixes[4] = {
     getpix_8, getpix_16, getpix_24, getpix_32
 };
 
-static bool RLEColorkeySurface(SDL_Surface *surface)
+// find the end of a run of pixels that are (or aren't) the colorkey
+static int FindKeyRunEnd(const SDL_RLEEncoding *enc, getpix_func getpix, const Uint8 *srcbuf, int x,
+                         Uint32 rgbmask, Uint32 ckey, bool match)
+{
+    const int bpp = enc->sf->bytes_per_pixel;
+
+    if (enc->simd && bpp != 3 && (bpp == 4 || ckey < (1u << (bpp * 8)))) {
+        x = SkipKeyRun(srcbuf, x, enc->w, bpp, rgbmask, ckey, match);
+    }
+    while (x < enc->w && ((getpix(srcbuf + x * bpp) & rgbmask) == ckey) == match) {
+        x++;
+    }
+    return x;
+}
+
+// encode colorkeyed pixels, which must already be in the target format
+static Uint8 *RLEColorkeyEncode(const SDL_RLEEncoding *enc)
 {
-    SDL_Surface *dest;
     Uint8 *rlebuf, *dst;
     int maxn;
     int y;
-    Uint8 *srcbuf, *lastline;
+    const Uint8 *srcbuf;
+    Uint8 *lastline;
     int maxsize = 0;
-    const int bpp = surface->fmt->bytes_per_pixel;
+    const int bpp = enc->sf->bytes_per_pixel;
     getpix_func getpix;
     Uint32 ckey, rgbmask;
     int w, h;
 
-    dest = surface->map.info.dst_surface;
-    if (!dest) {
-        return false;
-    }
-
     // calculate the worst case size for the compressed surface
     switch (bpp) {
     case 1:
         /* worst case is alternating opaque and transparent pixels,
            starting with an opaque pixel */
-        maxsize = surface->h * 3 * (surface->w / 2 + 1) + 2;
+        maxsize = enc->h * 3 * (enc->w / 2 + 1) + 2;
         break;
     case 2:
     case 3:
         // worst case is solid runs, at most 255 pixels wide
-        maxsize = surface->h * (2 * (surface->w / 255 + 1) + surface->w * bpp) + 2;
+        maxsize = enc->h * (2 * (enc->w / 255 + 1) + enc->w * bpp) + 2;
         break;
     case 4:
         // worst case is solid runs, at most 65535 pixels wide
-        maxsize = surface->h * (4 * (surface->w / 65535 + 1) + surface->w * 4) + 4;
+        maxsize = enc->h * (4 * (enc->w / 65535 + 1) + enc->w * 4) + 4;
         break;
 
     default:
-        return false;
+        return NULL;
     }
 
     maxsize += sizeof(SDL_PixelFormat);
     rlebuf = (Uint8 *)SDL_malloc(maxsize);
     if (!rlebuf) {
-        return false;
+        return NULL;
     }
     // save the destination format so we can undo the encoding later
-    *(SDL_PixelFormat *)rlebuf = dest->format;
+    *(SDL_PixelFormat *)rlebuf = enc->df->format;
 
     // Set up the conversion
-    srcbuf = (Uint8 *)surface->pixels;
+    srcbuf = enc->pixels;
     maxn = bpp == 4 ? 65535 : 255;
     dst = rlebuf + sizeof(SDL_PixelFormat);
-    rgbmask = ~surface->fmt->Amask;
-    ckey = surface->map.info.colorkey & rgbmask;
+    rgbmask = ~enc->sf->Amask;
+    ckey = enc->colorkey & rgbmask;
     lastline = dst;
     getpix = getpixes[bpp - 1];
-    w = surface->w;
-    h = surface->h;
+    w = enc->w;
+    h = enc->h;
 
 #define ADD_COUNTS(n, m)                \
     if (bpp == 4) {                     \
@@ -1309,13 +1669,9 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
             int skipstart = x;
 
             // find run of transparent, then opaque pixels
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey) {
-                x++;
-            }
+            x = FindKeyRunEnd(enc, getpix, srcbuf, x, rgbmask, ckey, true);
             runstart = x;
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey) {
-                x++;
-            }
+            x = FindKeyRunEnd(enc, getpix, srcbuf, x, rgbmask, ckey, false);
             skip = runstart - skipstart;
             if (skip == w) {
                 blankline = 1;
@@ -1346,24 +1702,13 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
             }
         } while (x < w);
 
-        srcbuf += surface->pitch;
+        srcbuf += enc->pitch;
     }
     dst = lastline; // back up bast trailing blank lines
     ADD_COUNTS(0, 0);
 
 #undef ADD_COUNTS
 
-    // Now that we have it encoded, release the original pixels
-    if (!(surface->flags & SDL_SURFACE_PREALLOCATED)) {
-        if (surface->flags & SDL_SURFACE_SIMD_ALIGNED) {
-            SDL_aligned_free(surface->pixels);
-            surface->flags &= ~SDL_SURFACE_SIMD_ALIGNED;
-        } else {
-            SDL_free(surface->pixels);
-        }
-        surface->pixels = NULL;
-    }
-
     // reallocate the buffer to release unused memory
     {
         // If SDL_realloc returns NULL, the original block is left intact
@@ -1371,14 +1716,131 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
         if (!p) {
             p = rlebuf;
         }
-        surface->map.data = p;
+        return p;
+    }
+}
+
+// switch a surface over to its encoded pixels
+static void RLEInstallEncoding(SDL_Surface *surface, Uint8 *data, bool alpha)
+{
+    // Now that we have it encoded, release the original pixels
+    if (!(surface->flags & SDL_SURFACE_PREALLOCATED)) {
+        SDL_FreeSurfacePixels(surface);
+    }
+
+    surface->map.data = data;
+    if (alpha) {
+        surface->map.blit = SDL_RLEAlphaBlit;
+        surface->map.info.flags |= SDL_COPY_RLE_ALPHAKEY;
+    } else {
+        surface->map.blit = SDL_RLEBlit;
+        surface->map.info.flags |= SDL_COPY_RLE_COLORKEY;
+    }
+
+    // The surface is now accelerated
+    surface->internal_flags |= SDL_INTERNAL_SURFACE_RLEACCEL;
+}
+
+/*
+ * Background encoding:
+ * With SDL_HINT_SURFACE_THREADS, large surfaces are encoded on the job pool
+ * the first time they're blit, and use the regular blitters until the
+ * encoding is done. Locking the surface cancels the encoding, since the
+ * pixels may change, and it starts over at the next blit.
+ */
+
+// Surfaces with at least two bands of this many pixels are encoded in the background
+#define SDL_RLE_MIN_BAND_PIXELS (64 * 1024)
+
+struct SDL_RLEJob
+{
+    SDL_RLEEncoding enc;
+    bool alpha;
+    int flags;      // the copy flags the encoding was made for
+    Uint8 *data;    // the encoded pixels, or NULL if the encoding failed
+    SDL_JobCounter *counter;
+};
+
+static void SDLCALL SDL_RLEEncodeJob(void *userdata)
+{
+    SDL_RLEJob *job = (SDL_RLEJob *)userdata;
+
+    if (job->alpha) {
+        job->data = RLEAlphaEncode(&job->enc);
+    } else {
+        job->data = RLEColorkeyEncode(&job->enc);
+    }
+}
+
+static void DestroyRLEJob(SDL_RLEJob *job)
+{
+    SDL_WaitJobCounter(job->counter);
+    SDL_DestroyJobCounter(job->counter);
+    SDL_free(job->data);
+    SDL_free(job);
+}
+
+// Returns whether an encoding still matches the pixels and blit mapping of the surface
+static bool IsRLEJobCurrent(SDL_Surface *surface, const SDL_RLEJob *job)
+{
+    if (job->enc.pixels != surface->pixels ||
+        job->enc.df != surface->map.info.dst_fmt ||
+        job->enc.colorkey != surface->map.info.colorkey ||
+        job->flags != surface->map.info.flags ||
+        surface->locked) {
+        return false;
+    }
+    return true;
+}
+
+// Start encoding in the background, returns false if the surface should be encoded right away
+static bool StartRLEJob(SDL_Surface *surface, const SDL_RLEEncoding *enc, bool alpha)
+{
+    SDL_RLEJob *job;
+    int band_height;
+
+    if (SDL_GetSurfaceBands(SDL_HINT_SURFACE_THREADS, SDL_RLE_MIN_BAND_PIXELS, enc->w, enc->h, 1, &band_height) <= 1) {
+        return false;
     }
 
+    job = (SDL_RLEJob *)SDL_calloc(1, sizeof(*job));
+    if (!job) {
+        return false;
+    }
+    job->enc = *enc;
+    job->alpha = alpha;
+    job->flags = surface->map.info.flags;
+    job->counter = SDL_CreateJobCounter();
+    if (!job->counter || !SDL_SubmitJob(SDL_RLEEncodeJob, job, job->counter)) {
+        SDL_DestroyJobCounter(job->counter);
+        SDL_free(job);
+        return false;
+    }
+    surface->rle_job = job;
     return true;
 }
 
+// Switch to a finished background encoding, returns false if there isn't one
+static bool FinishRLEJob(SDL_Surface *surface)
+{
+    SDL_RLEJob *job = surface->rle_job;
+    bool result = false;
+
+    surface->rle_job = NULL;
+    if (job->data) {
+        RLEInstallEncoding(surface, job->data, job->alpha);
+        job->data = NULL;
+        result = true;
+    }
+    DestroyRLEJob(job);
+    return result;
+}
+
 bool SDL_RLESurface(SDL_Surface *surface)
 {
+    SDL_RLEEncoding enc;
+    Uint8 *data;
+    bool alpha;
     int flags;
 
     // Clear any previous RLE conversion
@@ -1414,30 +1876,94 @@ bool SDL_RLESurface(SDL_Surface *surface)
         return false;
     }
 
-    // Encode and set up the blit
-    if (!SDL_ISPIXELFORMAT_ALPHA(surface->format) || !(flags & SDL_COPY_BLEND)) {
-        if (!surface->map.identity) {
-            return false;
-        }
-        if (!RLEColorkeySurface(surface)) {
+    if (!surface->map.info.dst_fmt) {
+        return false;
+    }
+
+    alpha = (SDL_ISPIXELFORMAT_ALPHA(surface->format) && (flags & SDL_COPY_BLEND));
+    if (alpha) {
+        SDL_RLECopyFunc copy_opaque, copy_transl;
+        if (!GetRLEAlphaCopyFuncs(surface->fmt, surface->map.info.dst_fmt, &copy_opaque, &copy_transl)) {
             return false;
         }
-        surface->map.blit = SDL_RLEBlit;
-        surface->map.info.flags |= SDL_COPY_RLE_COLORKEY;
-    } else {
-        if (!RLEAlphaSurface(surface)) {
-            return false;
+    } else if (!surface->map.identity) {
+        return false;
+    }
+
+    // Use a background encoding for this mapping if there is one
+    if (surface->rle_job) {
+        SDL_RLEJob *job = surface->rle_job;
+        if (job->alpha == alpha && IsRLEJobCurrent(surface, job)) {
+            if (SDL_GetJobCounterValue(job->counter) > 0) {
+                // Keep using the regular blitters until it's done
+                return false;
+            }
+            return FinishRLEJob(surface);
         }
-        surface->map.blit = SDL_RLEAlphaBlit;
-        surface->map.info.flags |= SDL_COPY_RLE_ALPHAKEY;
+        surface->rle_job = NULL;
+        DestroyRLEJob(job);
     }
 
-    // The surface is now accelerated
-    surface->internal_flags |= SDL_INTERNAL_SURFACE_RLEACCEL;
+    enc.sf = surface->fmt;
+    enc.df = surface->map.info.dst_fmt;
+    enc.pixels = (const Uint8 *)surface->pixels;
+    enc.w = surface->w;
+    enc.h = surface->h;
+    enc.pitch = surface->pitch;
+    enc.colorkey = surface->map.info.colorkey;
+    enc.simd = RLEHasSIMD();
+
+    if (StartRLEJob(surface, &enc, alpha)) {
+        return false;
+    }
+
+    // Encode and set up the blit
+    if (alpha) {
+        data = RLEAlphaEncode(&enc);
+    } else {
+        data = RLEColorkeyEncode(&enc);
+    }
+    if (!data) {
+        return false;
+    }
+    RLEInstallEncoding(surface, data, alpha);
 
     return true;
 }
 
+void SDL_FinishRLESurface(SDL_Surface *surface)
+{
+    SDL_RLEJob *job = surface->rle_job;
+
+    if (!job || SDL_GetJobCounterValue(job->counter) > 0) {
+        return;
+    }
+
+    if (!(surface->map.info.flags & SDL_COPY_RLE_DESIRED)) {
+        // RLE acceleration was turned off while it was encoding
+        surface->rle_job = NULL;
+        DestroyRLEJob(job);
+        return;
+    }
+
+    if (IsRLEJobCurrent(surface, job)) {
+        FinishRLEJob(surface);
+    }
+}
+
+void SDL_CancelRLESurface(SDL_Surface *surface)
+{
+    SDL_RLEJob *job = surface->rle_job;
+
+    if (job) {
+        surface->rle_job = NULL;
+        DestroyRLEJob(job);
+
+        // Encode the pixels again the next time the surface is blit
+        SDL_InvalidateMap(&surface->map);
+    }
+}
+
 /*
  * Un-RLE a surface with pixel alpha
  * This may not give back exactly the image before RLE-encoding; all
@@ -1474,6 +2000,7 @@ static bool UnRLEAlpha(SDL_Surface *surface)
         return false;
     }
     surface->flags |= SDL_SURFACE_SIMD_ALIGNED;
+    SDL_TagSurfacePixels(surface, size);
     // fill background with transparent pixels
     SDL_memset(surface->pixels, 0, (size_t)surface->h * surface->pitch);
 
@@ -1548,6 +2075,7 @@ void SDL_UnRLESurface(SDL_Surface *surface, bool recode)
                     return;
                 }
                 surface->flags |= SDL_SURFACE_SIMD_ALIGNED;
+                SDL_TagSurfacePixels(surface, size);
 
                 // fill it with the background color
                 SDL_FillSurfaceRect(surface, NULL, surface->map.info.colorkey);
@@ -28,5 +28,9 @@
 
 extern bool SDL_RLESurface(SDL_Surface *surface);
 extern void SDL_UnRLESurface(SDL_Surface *surface, bool recode);
+// Switch to the background encoding of a surface if it's done and still valid
+extern void SDL_FinishRLESurface(SDL_Surface *surface);
+// Stop and discard the background encoding of a surface, if any
+extern void SDL_CancelRLESurface(SDL_Surface *surface);
 
 #endif // SDL_RLEaccel_c_h_
@@ -27,6 +27,60 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_surface_threads_c.h"
+
+// Blits smaller than this per band aren't worth splitting up
+#define SDL_BLIT_MIN_BAND_PIXELS (128 * 1024)
+
+typedef struct SDL_BlitBands
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+    int band_height;
+} SDL_BlitBands;
+
+static void SDLCALL SDL_SoftBlitBand(void *userdata, int band)
+{
+    const SDL_BlitBands *bands = (const SDL_BlitBands *)userdata;
+    const int start = band * bands->band_height;
+    SDL_BlitInfo info = *bands->info;
+
+    info.src += start * info.src_pitch;
+    info.dst += start * info.dst_pitch;
+    info.src_h = info.dst_h = SDL_min(bands->band_height, bands->info->dst_h - start);
+    bands->blit(&info);
+}
+
+// Returns how many bands of rows a blit can be split into for SDL_HINT_SURFACE_THREADS
+static int SDL_GetSoftBlitBands(SDL_Surface *src, SDL_Surface *dst, SDL_BlitFunc blit, const SDL_BlitInfo *info, int *band_height)
+{
+    const Uint8 *src_end = info->src + (info->src_h - 1) * info->src_pitch + info->src_w * info->src_fmt->bytes_per_pixel;
+    const Uint8 *dst_end = info->dst + (info->dst_h - 1) * info->dst_pitch + info->dst_w * info->dst_fmt->bytes_per_pixel;
+    int num_bands;
+
+    // Scaled blits step through the source based on the whole height
+    if (info->src_w != info->dst_w || info->src_h != info->dst_h) {
+        return 1;
+    }
+
+    // Overlapping blits depend on the order the rows are copied in
+    if (info->src < dst_end && info->dst < src_end) {
+        return 1;
+    }
+
+    // The palette map used to find the closest color isn't thread-safe
+    if (info->palette_map) {
+        return 1;
+    }
+
+    num_bands = SDL_GetSurfaceBands(SDL_HINT_SURFACE_THREADS, SDL_BLIT_MIN_BAND_PIXELS, info->dst_w, info->dst_h, 1, band_height);
+    if (num_bands > 1 && blit == SDL_Blit_Slow_Float) {
+        // This looks up the surface properties, create them now rather than racing to do it in each band
+        SDL_GetSurfaceProperties(src);
+        SDL_GetSurfaceProperties(dst);
+    }
+    return num_bands;
+}
 
 // The general purpose software blit routine
 static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -48,9 +102,10 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
             dst_locked = 1;
         }
     }
-    // Lock the source if it's in hardware
+    // Lock the source if it's in hardware, the source is only read so it
+    // doesn't need to cancel an RLE encoding in progress
     src_locked = 0;
-    if (SDL_MUSTLOCK(src)) {
+    if (SDL_MUSTLOCK(src) && !src->rle_job) {
         if (!SDL_LockSurface(src)) {
             okay = false;
         } else {
@@ -62,6 +117,8 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
     if (okay) {
         SDL_BlitFunc RunBlit;
         SDL_BlitInfo *info = &src->map.info;
+        SDL_BlitBands bands;
+        int num_bands;
 
         // Set up the blit information
         info->src = (Uint8 *)src->pixels +
@@ -82,8 +139,15 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->bytes_per_pixel;
         RunBlit = (SDL_BlitFunc)src->map.data;
 
-        // Run the actual software blit
-        RunBlit(info);
+        // Run the actual software blit, split into bands across threads if it's large enough
+        num_bands = SDL_GetSoftBlitBands(src, dst, RunBlit, info, &bands.band_height);
+        if (num_bands > 1) {
+            bands.blit = RunBlit;
+            bands.info = info;
+            SDL_RunSurfaceBands(SDL_SoftBlitBand, &bands, num_bands);
+        } else {
+            RunBlit(info);
+        }
     }
 
     // We need to unlock the surfaces if they're locked
@@ -140,6 +204,12 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -203,6 +273,8 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
     map->info.dst_surface = dst;
     map->info.dst_fmt = dst->fmt;
     map->info.dst_pal = dst->palette;
+    map->src_colorspace = src_colorspace;
+    map->dst_colorspace = dst_colorspace;
 
 #ifdef SDL_HAVE_RLE
     // See if we can do RLE acceleration
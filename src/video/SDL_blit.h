@@ -52,6 +52,11 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_AVX2               0x00000020
+#define SDL_CPU_NEON               0x00000040
+
+// Closest palette color cache, see SDL_LookupRGBAColor()
+typedef struct SDL_PaletteLUT SDL_PaletteLUT;
 
 typedef struct
 {
@@ -70,7 +75,7 @@ typedef struct
     const SDL_PixelFormatDetails *dst_fmt;
     const SDL_Palette *dst_pal;
     Uint8 *table;
-    SDL_HashTable *palette_map;
+    SDL_PaletteLUT *palette_map;
     int flags;
     Uint32 colorkey;
     Uint8 r, g, b, a;
@@ -101,6 +106,10 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    // the colorspaces the blit function was chosen for
+    SDL_Colorspace src_colorspace;
+    SDL_Colorspace dst_colorspace;
 } SDL_BlitMap;
 
 // Functions found in SDL_blit.c
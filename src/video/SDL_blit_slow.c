@@ -69,7 +69,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteLUT *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -802,6 +802,858 @@ static void ApplyTonemap(SDL_TonemapContext *ctx, float *r, float *g, float *b)
     }
 }
 
+/* Planar row conversion
+ *
+ * Straight copies between surfaces of the same size are converted a chunk of
+ * pixels at a time: the source is unpacked into planar float buffers, the
+ * tonemap and color primaries conversion run over the buffers, and the
+ * transfer functions for the destination are evaluated with SIMD instead of
+ * calling SDL_powf() per channel. 8-bit and 10-bit sources are decoded through
+ * a lookup table, so they are exact.
+ */
+#define FLOAT_ROW_CHUNK 256
+
+// Round to nearest without a call to SDL_roundf(), the value is never negative
+#define FLOAT_TO_UNORM(v, max) ((Uint32)(SDL_clamp((v), 0.0f, 1.0f) * (max) + 0.5f))
+
+typedef struct
+{
+    SlowBlitPixelAccess access;
+    const SDL_PixelFormatDetails *fmt;
+    SDL_TransferCharacteristics transfer;
+    float SDR_white_point;
+    int channel[4];    // Array index of R, G, B, A for large formats, or -1
+    int shift[4];      // Bit position of R, G, B, A for packed formats
+    float max;         // Maximum value of the packed color channels
+    float alpha_max;   // Maximum value of the packed alpha channel, or 0
+    Uint32 alpha_fill; // Alpha bits for packed formats without alpha
+    const float *lut;  // Decoding table for packed formats
+} FloatRowFormat;
+
+#ifdef SDL_SSE2_INTRINSICS
+// Cephes based logf() and expf(), accurate to a few ULP over the range we need
+static __m128 SDL_TARGETING("sse2") SDL_log_SSE2(__m128 x)
+{
+    __m128i emm0;
+    __m128 e, mask, tmp, y, z;
+
+    x = _mm_max_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x00800000)));
+    emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+    x = _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(~0x7f800000))), _mm_set1_ps(0.5f));
+    e = _mm_add_ps(_mm_cvtepi32_ps(_mm_sub_epi32(emm0, _mm_set1_epi32(0x7f))), _mm_set1_ps(1.0f));
+
+    mask = _mm_cmplt_ps(x, _mm_set1_ps(0.707106781186547524f));
+    tmp = _mm_and_ps(x, mask);
+    x = _mm_sub_ps(x, _mm_set1_ps(1.0f));
+    e = _mm_sub_ps(e, _mm_and_ps(_mm_set1_ps(1.0f), mask));
+    x = _mm_add_ps(x, tmp);
+
+    z = _mm_mul_ps(x, x);
+    y = _mm_set1_ps(7.0376836292E-2f);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.1514610310E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.1676998740E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.2420140846E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.4249322787E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.6668057665E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(2.0000714765E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-2.4999993993E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(3.3333331174E-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, x), z);
+    y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+    y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    x = _mm_add_ps(x, y);
+    return _mm_add_ps(x, _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+}
+
+static __m128 SDL_TARGETING("sse2") SDL_exp_SSE2(__m128 x)
+{
+    __m128i emm0;
+    __m128 fx, tmp, y, z;
+
+    x = _mm_min_ps(x, _mm_set1_ps(88.3762626647949f));
+    x = _mm_max_ps(x, _mm_set1_ps(-88.3762626647949f));
+
+    // fx = floor(x * log2(e) + 0.5)
+    fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f));
+    tmp = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+    fx = _mm_sub_ps(tmp, _mm_and_ps(_mm_cmpgt_ps(tmp, fx), _mm_set1_ps(1.0f)));
+
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+    z = _mm_mul_ps(x, x);
+    y = _mm_set1_ps(1.9875691500E-4f);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.3981999507E-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(8.3334519073E-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(4.1665795894E-2f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.6666665459E-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(5.0000001201E-1f));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), x), _mm_set1_ps(1.0f));
+
+    emm0 = _mm_add_epi32(_mm_cvttps_epi32(fx), _mm_set1_epi32(0x7f));
+    emm0 = _mm_slli_epi32(emm0, 23);
+    return _mm_mul_ps(y, _mm_castsi128_ps(emm0));
+}
+
+static int SDL_TARGETING("sse2") SDL_sRGBfromLinear_SSE2(float *values, int count)
+{
+    const __m128 threshold = _mm_set1_ps(0.0031308f);
+    const __m128 linear_scale = _mm_set1_ps(12.92f);
+    const __m128 exponent = _mm_set1_ps(1.0f / 2.4f);
+    const __m128 scale = _mm_set1_ps(1.055f);
+    const __m128 offset = _mm_set1_ps(0.055f);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(&values[i]);
+        __m128 lo = _mm_mul_ps(v, linear_scale);
+        __m128 hi = _mm_sub_ps(_mm_mul_ps(SDL_exp_SSE2(_mm_mul_ps(SDL_log_SSE2(v), exponent)), scale), offset);
+        __m128 mask = _mm_cmple_ps(v, threshold);
+        _mm_storeu_ps(&values[i], _mm_or_ps(_mm_and_ps(mask, lo), _mm_andnot_ps(mask, hi)));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") SDL_PQfromNits_SSE2(float *values, int count, float SDR_white_point)
+{
+    const __m128 scale = _mm_set1_ps(SDR_white_point / 10000.0f);
+    const __m128 c1 = _mm_set1_ps(0.8359375f);
+    const __m128 c2 = _mm_set1_ps(18.8515625f);
+    const __m128 c3 = _mm_set1_ps(18.6875f);
+    const __m128 m1 = _mm_set1_ps(0.1593017578125f);
+    const __m128 m2 = _mm_set1_ps(78.84375f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128 y = _mm_mul_ps(_mm_loadu_ps(&values[i]), scale);
+        __m128 ym1, num, den;
+
+        y = _mm_min_ps(_mm_max_ps(y, _mm_setzero_ps()), one);
+        ym1 = SDL_exp_SSE2(_mm_mul_ps(SDL_log_SSE2(y), m1));
+        num = _mm_add_ps(c1, _mm_mul_ps(c2, ym1));
+        den = _mm_add_ps(one, _mm_mul_ps(c3, ym1));
+        _mm_storeu_ps(&values[i], SDL_exp_SSE2(_mm_mul_ps(SDL_log_SSE2(_mm_div_ps(num, den)), m2)));
+    }
+    return i;
+}
+
+/* Vectorized float_to_half(), based on float_to_half_fast3_rtne() from the same
+ * public domain gist as half_to_float(). NaN payloads are not preserved.
+ */
+static __m128i SDL_TARGETING("sse2") SDL_FloatToHalf_SSE2(__m128 f)
+{
+    const __m128i c_subnorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    __m128 justsign = _mm_and_ps(f, _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000)));
+    __m128 absf = _mm_xor_ps(f, justsign);
+    __m128i absf_int = _mm_castps_si128(absf);
+    __m128i is_regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), absf_int);
+    __m128i is_nan = _mm_castps_si128(_mm_cmpunord_ps(absf, absf));
+    __m128i inf_or_nan = _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+    __m128i is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), absf_int);
+    __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absf, _mm_castsi128_ps(c_subnorm_magic))), c_subnorm_magic);
+    __m128i mant_odd = _mm_srai_epi32(_mm_slli_epi32(absf_int, 31 - 13), 31);
+    __m128i normal = _mm_add_epi32(absf_int, _mm_set1_epi32(0xfff - ((127 - 15) << 23)));
+    __m128i result;
+    normal = _mm_srli_epi32(_mm_sub_epi32(normal, mant_odd), 13);
+    result = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+    result = _mm_or_si128(_mm_and_si128(is_regular, result), _mm_andnot_si128(is_regular, inf_or_nan));
+    return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(justsign), 16));
+}
+
+static int SDL_TARGETING("sse2") SDL_PackUNORMRow_SSE2(Uint32 *dst, int count, const FloatRowFormat *row, const float *R, const float *G, const float *B, const float *A)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 max = _mm_set1_ps(row->max);
+    const __m128 alpha_max = _mm_set1_ps(row->alpha_max);
+    const __m128i alpha_fill = _mm_set1_epi32((int)row->alpha_fill);
+    int i;
+
+#define FLOAT_TO_UNORM_SSE2(v, max, shift) \
+    _mm_sll_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, zero), one), max), half)), _mm_cvtsi32_si128(shift))
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i pixels = alpha_fill;
+        pixels = _mm_or_si128(pixels, FLOAT_TO_UNORM_SSE2(_mm_loadu_ps(&R[i]), max, row->shift[0]));
+        pixels = _mm_or_si128(pixels, FLOAT_TO_UNORM_SSE2(_mm_loadu_ps(&G[i]), max, row->shift[1]));
+        pixels = _mm_or_si128(pixels, FLOAT_TO_UNORM_SSE2(_mm_loadu_ps(&B[i]), max, row->shift[2]));
+        pixels = _mm_or_si128(pixels, FLOAT_TO_UNORM_SSE2(_mm_loadu_ps(&A[i]), alpha_max, row->shift[3]));
+        _mm_storeu_si128((__m128i *)&dst[i], pixels);
+    }
+#undef FLOAT_TO_UNORM_SSE2
+    return i;
+}
+
+static int SDL_TARGETING("sse2") SDL_FloatToHalfRow_SSE2(const float *src, Uint16 *dst, int count)
+{
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m128i lo = SDL_FloatToHalf_SSE2(_mm_loadu_ps(&src[i]));
+        __m128i hi = SDL_FloatToHalf_SSE2(_mm_loadu_ps(&src[i + 4]));
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_packs_epi32(lo, hi));
+    }
+    return i;
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+static __m256 SDL_TARGETING("avx2") SDL_log_AVX2(__m256 x)
+{
+    __m256i emm0;
+    __m256 e, mask, tmp, y, z;
+
+    x = _mm256_max_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000)));
+    emm0 = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+    x = _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(~0x7f800000))), _mm256_set1_ps(0.5f));
+    e = _mm256_add_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(emm0, _mm256_set1_epi32(0x7f))), _mm256_set1_ps(1.0f));
+
+    mask = _mm256_cmp_ps(x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    tmp = _mm256_and_ps(x, mask);
+    x = _mm256_sub_ps(x, _mm256_set1_ps(1.0f));
+    e = _mm256_sub_ps(e, _mm256_and_ps(_mm256_set1_ps(1.0f), mask));
+    x = _mm256_add_ps(x, tmp);
+
+    z = _mm256_mul_ps(x, x);
+    y = _mm256_set1_ps(7.0376836292E-2f);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(-1.1514610310E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.1676998740E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(-1.2420140846E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.4249322787E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(-1.6668057665E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(2.0000714765E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(-2.4999993993E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(3.3333331174E-1f));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, x), z);
+    y = _mm256_add_ps(y, _mm256_mul_ps(e, _mm256_set1_ps(-2.12194440e-4f)));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    x = _mm256_add_ps(x, y);
+    return _mm256_add_ps(x, _mm256_mul_ps(e, _mm256_set1_ps(0.693359375f)));
+}
+
+static __m256 SDL_TARGETING("avx2") SDL_exp_AVX2(__m256 x)
+{
+    __m256i emm0;
+    __m256 fx, tmp, y, z;
+
+    x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+    x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+    // fx = floor(x * log2(e) + 0.5)
+    fx = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)), _mm256_set1_ps(0.5f));
+    tmp = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(fx));
+    fx = _mm256_sub_ps(tmp, _mm256_and_ps(_mm256_cmp_ps(tmp, fx, _CMP_GT_OQ), _mm256_set1_ps(1.0f)));
+
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f)));
+    z = _mm256_mul_ps(x, x);
+    y = _mm256_set1_ps(1.9875691500E-4f);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.3981999507E-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(8.3334519073E-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(4.1665795894E-2f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.6666665459E-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(5.0000001201E-1f));
+    y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(y, z), x), _mm256_set1_ps(1.0f));
+
+    emm0 = _mm256_add_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(0x7f));
+    emm0 = _mm256_slli_epi32(emm0, 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(emm0));
+}
+
+static int SDL_TARGETING("avx2") SDL_sRGBfromLinear_AVX2(float *values, int count)
+{
+    const __m256 threshold = _mm256_set1_ps(0.0031308f);
+    const __m256 linear_scale = _mm256_set1_ps(12.92f);
+    const __m256 exponent = _mm256_set1_ps(1.0f / 2.4f);
+    const __m256 scale = _mm256_set1_ps(1.055f);
+    const __m256 offset = _mm256_set1_ps(0.055f);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(&values[i]);
+        __m256 lo = _mm256_mul_ps(v, linear_scale);
+        __m256 hi = _mm256_sub_ps(_mm256_mul_ps(SDL_exp_AVX2(_mm256_mul_ps(SDL_log_AVX2(v), exponent)), scale), offset);
+        __m256 mask = _mm256_cmp_ps(v, threshold, _CMP_LE_OQ);
+        _mm256_storeu_ps(&values[i], _mm256_or_ps(_mm256_and_ps(mask, lo), _mm256_andnot_ps(mask, hi)));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") SDL_PQfromNits_AVX2(float *values, int count, float SDR_white_point)
+{
+    const __m256 scale = _mm256_set1_ps(SDR_white_point / 10000.0f);
+    const __m256 c1 = _mm256_set1_ps(0.8359375f);
+    const __m256 c2 = _mm256_set1_ps(18.8515625f);
+    const __m256 c3 = _mm256_set1_ps(18.6875f);
+    const __m256 m1 = _mm256_set1_ps(0.1593017578125f);
+    const __m256 m2 = _mm256_set1_ps(78.84375f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256 y = _mm256_mul_ps(_mm256_loadu_ps(&values[i]), scale);
+        __m256 ym1, num, den;
+
+        y = _mm256_min_ps(_mm256_max_ps(y, _mm256_setzero_ps()), one);
+        ym1 = SDL_exp_AVX2(_mm256_mul_ps(SDL_log_AVX2(y), m1));
+        num = _mm256_add_ps(c1, _mm256_mul_ps(c2, ym1));
+        den = _mm256_add_ps(one, _mm256_mul_ps(c3, ym1));
+        _mm256_storeu_ps(&values[i], SDL_exp_AVX2(_mm256_mul_ps(SDL_log_AVX2(_mm256_div_ps(num, den)), m2)));
+    }
+    return i;
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+static float32x4_t SDL_log_NEON(float32x4_t x)
+{
+    int32x4_t emm0;
+    float32x4_t e, tmp, y, z;
+    uint32x4_t mask;
+    const float32x4_t one = vdupq_n_f32(1.0f);
+
+    x = vmaxq_f32(x, vreinterpretq_f32_s32(vdupq_n_s32(0x00800000)));
+    emm0 = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(x), 23));
+    x = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(~0x7f800000u)), vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+    e = vaddq_f32(vcvtq_f32_s32(vsubq_s32(emm0, vdupq_n_s32(0x7f))), one);
+
+    mask = vcltq_f32(x, vdupq_n_f32(0.707106781186547524f));
+    tmp = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(x), mask));
+    x = vsubq_f32(x, one);
+    e = vsubq_f32(e, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(one), mask)));
+    x = vaddq_f32(x, tmp);
+
+    z = vmulq_f32(x, x);
+    y = vdupq_n_f32(7.0376836292E-2f);
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(-1.1514610310E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(1.1676998740E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(-1.2420140846E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(1.4249322787E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(-1.6668057665E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(2.0000714765E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(-2.4999993993E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(3.3333331174E-1f));
+    y = vmulq_f32(vmulq_f32(y, x), z);
+    y = vaddq_f32(y, vmulq_f32(e, vdupq_n_f32(-2.12194440e-4f)));
+    y = vsubq_f32(y, vmulq_f32(z, vdupq_n_f32(0.5f)));
+    x = vaddq_f32(x, y);
+    return vaddq_f32(x, vmulq_f32(e, vdupq_n_f32(0.693359375f)));
+}
+
+static float32x4_t SDL_exp_NEON(float32x4_t x)
+{
+    int32x4_t emm0;
+    float32x4_t fx, tmp, y, z;
+    const float32x4_t one = vdupq_n_f32(1.0f);
+
+    x = vminq_f32(x, vdupq_n_f32(88.3762626647949f));
+    x = vmaxq_f32(x, vdupq_n_f32(-88.3762626647949f));
+
+    // fx = floor(x * log2(e) + 0.5)
+    fx = vaddq_f32(vmulq_f32(x, vdupq_n_f32(1.44269504088896341f)), vdupq_n_f32(0.5f));
+    tmp = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+    fx = vsubq_f32(tmp, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(tmp, fx), vreinterpretq_u32_f32(one))));
+
+    x = vsubq_f32(x, vmulq_f32(fx, vdupq_n_f32(0.693359375f)));
+    x = vsubq_f32(x, vmulq_f32(fx, vdupq_n_f32(-2.12194440e-4f)));
+    z = vmulq_f32(x, x);
+    y = vdupq_n_f32(1.9875691500E-4f);
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(1.3981999507E-3f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(8.3334519073E-3f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(4.1665795894E-2f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(1.6666665459E-1f));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(5.0000001201E-1f));
+    y = vaddq_f32(vaddq_f32(vmulq_f32(y, z), x), one);
+
+    emm0 = vaddq_s32(vcvtq_s32_f32(fx), vdupq_n_s32(0x7f));
+    emm0 = vshlq_n_s32(emm0, 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(emm0));
+}
+
+static int SDL_sRGBfromLinear_NEON(float *values, int count)
+{
+    const float32x4_t threshold = vdupq_n_f32(0.0031308f);
+    const float32x4_t linear_scale = vdupq_n_f32(12.92f);
+    const float32x4_t exponent = vdupq_n_f32(1.0f / 2.4f);
+    const float32x4_t scale = vdupq_n_f32(1.055f);
+    const float32x4_t offset = vdupq_n_f32(0.055f);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        float32x4_t v = vld1q_f32(&values[i]);
+        float32x4_t lo = vmulq_f32(v, linear_scale);
+        float32x4_t hi = vsubq_f32(vmulq_f32(SDL_exp_NEON(vmulq_f32(SDL_log_NEON(v), exponent)), scale), offset);
+        vst1q_f32(&values[i], vbslq_f32(vcleq_f32(v, threshold), lo, hi));
+    }
+    return i;
+}
+
+static int SDL_PQfromNits_NEON(float *values, int count, float SDR_white_point)
+{
+    const float32x4_t scale = vdupq_n_f32(SDR_white_point / 10000.0f);
+    const float32x4_t c1 = vdupq_n_f32(0.8359375f);
+    const float32x4_t c2 = vdupq_n_f32(18.8515625f);
+    const float32x4_t c3 = vdupq_n_f32(18.6875f);
+    const float32x4_t m1 = vdupq_n_f32(0.1593017578125f);
+    const float32x4_t m2 = vdupq_n_f32(78.84375f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        float32x4_t y = vmulq_f32(vld1q_f32(&values[i]), scale);
+        float32x4_t ym1, num, den, rcp;
+
+        y = vminq_f32(vmaxq_f32(y, vdupq_n_f32(0.0f)), one);
+        ym1 = SDL_exp_NEON(vmulq_f32(SDL_log_NEON(y), m1));
+        num = vaddq_f32(c1, vmulq_f32(c2, ym1));
+        den = vaddq_f32(one, vmulq_f32(c3, ym1));
+        // 32-bit ARM has no vector divide, refine the reciprocal estimate instead
+        rcp = vrecpeq_f32(den);
+        rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+        rcp = vmulq_f32(vrecpsq_f32(den, rcp), rcp);
+        vst1q_f32(&values[i], SDL_exp_NEON(vmulq_f32(SDL_log_NEON(vmulq_f32(num, rcp)), m2)));
+    }
+    return i;
+}
+#endif // SDL_NEON_INTRINSICS
+
+static void SDL_sRGBfromLinear_Row(float *values, int count)
+{
+    int i = 0;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        i = SDL_sRGBfromLinear_AVX2(values, count);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i += SDL_sRGBfromLinear_SSE2(values + i, count - i);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        i = SDL_sRGBfromLinear_NEON(values, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        values[i] = SDL_sRGBfromLinear(values[i]);
+    }
+}
+
+static void SDL_PQfromNits_Row(float *values, int count, float SDR_white_point)
+{
+    int i = 0;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        i = SDL_PQfromNits_AVX2(values, count, SDR_white_point);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i += SDL_PQfromNits_SSE2(values + i, count - i, SDR_white_point);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        i = SDL_PQfromNits_NEON(values, count, SDR_white_point);
+    }
+#endif
+    for (; i < count; ++i) {
+        values[i] = SDL_PQfromNits(values[i] * SDR_white_point);
+    }
+}
+
+static void PackUNORMRow(Uint32 *dst, int count, const FloatRowFormat *row, const float *R, const float *G, const float *B, const float *A)
+{
+    int i = 0;
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SDL_PackUNORMRow_SSE2(dst, count, row, R, G, B, A);
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = (FLOAT_TO_UNORM(R[i], row->max) << row->shift[0]) |
+                 (FLOAT_TO_UNORM(G[i], row->max) << row->shift[1]) |
+                 (FLOAT_TO_UNORM(B[i], row->max) << row->shift[2]) |
+                 (FLOAT_TO_UNORM(A[i], row->alpha_max) << row->shift[3]) |
+                 row->alpha_fill;
+    }
+}
+
+static void FloatToHalfRow(const float *src, Uint16 *dst, int count)
+{
+    int i = 0;
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SDL_FloatToHalfRow_SSE2(src, dst, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = float_to_half(src[i]);
+    }
+}
+
+static float ToLinear(float v, SDL_TransferCharacteristics transfer, float SDR_white_point)
+{
+    switch (transfer) {
+    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
+        return SDL_sRGBtoLinear(v);
+    case SDL_TRANSFER_CHARACTERISTICS_PQ:
+        return SDL_PQtoNits(v) / SDR_white_point;
+    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
+        return v / SDR_white_point;
+    default:
+        // Unknown, leave it alone
+        return v;
+    }
+}
+
+static void FromLinear(float *values, int count, SDL_TransferCharacteristics transfer, float SDR_white_point)
+{
+    int i;
+
+    switch (transfer) {
+    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
+        SDL_sRGBfromLinear_Row(values, count);
+        break;
+    case SDL_TRANSFER_CHARACTERISTICS_PQ:
+        SDL_PQfromNits_Row(values, count, SDR_white_point);
+        break;
+    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
+        if (SDR_white_point != 1.0f) {
+            for (i = 0; i < count; ++i) {
+                values[i] *= SDR_white_point;
+            }
+        }
+        break;
+    default:
+        // Unknown, leave it alone
+        break;
+    }
+}
+
+static bool InitFloatRowFormat(FloatRowFormat *row, const SDL_PixelFormatDetails *fmt, SDL_Colorspace colorspace, float SDR_white_point)
+{
+    // Array index of R, G, B, A for each SDL_ArrayOrder
+    static const int array_channels[][4] = {
+        { -1, -1, -1, -1 }, // SDL_ARRAYORDER_NONE
+        { 0, 1, 2, -1 },    // SDL_ARRAYORDER_RGB
+        { 0, 1, 2, 3 },     // SDL_ARRAYORDER_RGBA
+        { 1, 2, 3, 0 },     // SDL_ARRAYORDER_ARGB
+        { 2, 1, 0, -1 },    // SDL_ARRAYORDER_BGR
+        { 2, 1, 0, 3 },     // SDL_ARRAYORDER_BGRA
+        { 3, 2, 1, 0 },     // SDL_ARRAYORDER_ABGR
+    };
+    Uint32 order;
+    int channels;
+
+    SDL_zerop(row);
+    row->access = GetPixelAccessMethod(fmt->format);
+    row->fmt = fmt;
+    row->transfer = SDL_COLORSPACETRANSFER(colorspace);
+    row->SDR_white_point = SDR_white_point;
+
+    switch (row->access) {
+    case SlowBlitPixelAccess_RGB:
+    case SlowBlitPixelAccess_RGBA:
+        // Only 8888 formats, everything else goes through the generic path
+        if (fmt->bytes_per_pixel != 4 || fmt->Rbits != 8 || fmt->Gbits != 8 || fmt->Bbits != 8) {
+            return false;
+        }
+        if (row->access == SlowBlitPixelAccess_RGBA) {
+            if (fmt->Abits != 8) {
+                return false;
+            }
+            row->shift[3] = fmt->Ashift;
+            row->alpha_max = 255.0f;
+        }
+        row->shift[0] = fmt->Rshift;
+        row->shift[1] = fmt->Gshift;
+        row->shift[2] = fmt->Bshift;
+        row->max = 255.0f;
+        return true;
+    case SlowBlitPixelAccess_10Bit:
+        switch (fmt->format) {
+        case SDL_PIXELFORMAT_XRGB2101010:
+        case SDL_PIXELFORMAT_ARGB2101010:
+            row->shift[0] = 20;
+            row->shift[2] = 0;
+            break;
+        case SDL_PIXELFORMAT_XBGR2101010:
+        case SDL_PIXELFORMAT_ABGR2101010:
+            row->shift[0] = 0;
+            row->shift[2] = 20;
+            break;
+        default:
+            return false;
+        }
+        row->shift[1] = 10;
+        row->shift[3] = 30;
+        row->max = 1023.0f;
+        if (SDL_ISPIXELFORMAT_ALPHA(fmt->format)) {
+            row->alpha_max = 3.0f;
+        } else {
+            row->alpha_fill = (3u << 30);
+        }
+        return true;
+    case SlowBlitPixelAccess_Large:
+        switch (SDL_PIXELTYPE(fmt->format)) {
+        case SDL_PIXELTYPE_ARRAYU16:
+        case SDL_PIXELTYPE_ARRAYF16:
+        case SDL_PIXELTYPE_ARRAYF32:
+            break;
+        default:
+            return false;
+        }
+        order = SDL_PIXELORDER(fmt->format);
+        if (order == SDL_ARRAYORDER_NONE || order >= SDL_arraysize(array_channels)) {
+            return false;
+        }
+        SDL_memcpy(row->channel, array_channels[order], sizeof(row->channel));
+        channels = (row->channel[3] < 0) ? 3 : 4;
+        // The pixel size may include padding, but the channels need to fit
+        if (fmt->bytes_per_pixel < channels * (SDL_PIXELTYPE(fmt->format) == SDL_PIXELTYPE_ARRAYF32 ? 4 : 2)) {
+            return false;
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void ReadFloatRow(const Uint8 *pixels, int count, const FloatRowFormat *row, float *R, float *G, float *B, float *A)
+{
+    const SDL_PixelFormatDetails *fmt = row->fmt;
+    const float *lut = row->lut;
+    int i;
+
+    switch (row->access) {
+    case SlowBlitPixelAccess_RGB:
+    case SlowBlitPixelAccess_RGBA:
+    case SlowBlitPixelAccess_10Bit:
+    {
+        const Uint32 *src = (const Uint32 *)pixels;
+        const Uint32 mask = (Uint32)row->max;
+        const Uint32 alpha_mask = (Uint32)row->alpha_max;
+        for (i = 0; i < count; ++i) {
+            Uint32 pixelvalue = src[i];
+            R[i] = lut[(pixelvalue >> row->shift[0]) & mask];
+            G[i] = lut[(pixelvalue >> row->shift[1]) & mask];
+            B[i] = lut[(pixelvalue >> row->shift[2]) & mask];
+            A[i] = alpha_mask ? (float)((pixelvalue >> row->shift[3]) & alpha_mask) / row->alpha_max : 1.0f;
+        }
+        break;
+    }
+    case SlowBlitPixelAccess_Large:
+    {
+        const int bpp = fmt->bytes_per_pixel;
+        const int r = row->channel[0], g = row->channel[1], b = row->channel[2], a = row->channel[3];
+        switch (SDL_PIXELTYPE(fmt->format)) {
+        case SDL_PIXELTYPE_ARRAYU16:
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                const Uint16 *v = (const Uint16 *)pixels;
+                R[i] = (float)v[r] / SDL_MAX_UINT16;
+                G[i] = (float)v[g] / SDL_MAX_UINT16;
+                B[i] = (float)v[b] / SDL_MAX_UINT16;
+                A[i] = (a >= 0) ? (float)v[a] / SDL_MAX_UINT16 : 1.0f;
+            }
+            break;
+        case SDL_PIXELTYPE_ARRAYF16:
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                const Uint16 *v = (const Uint16 *)pixels;
+                R[i] = half_to_float(v[r]);
+                G[i] = half_to_float(v[g]);
+                B[i] = half_to_float(v[b]);
+                A[i] = (a >= 0) ? half_to_float(v[a]) : 1.0f;
+            }
+            break;
+        case SDL_PIXELTYPE_ARRAYF32:
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                const float *v = (const float *)pixels;
+                R[i] = v[r];
+                G[i] = v[g];
+                B[i] = v[b];
+                A[i] = (a >= 0) ? v[a] : 1.0f;
+            }
+            break;
+        default:
+            break;
+        }
+        if (row->transfer == SDL_TRANSFER_CHARACTERISTICS_LINEAR) {
+            if (row->SDR_white_point == 1.0f) {
+                // scRGB, already in the right units
+                break;
+            }
+            for (i = 0; i < count; ++i) {
+                R[i] /= row->SDR_white_point;
+                G[i] /= row->SDR_white_point;
+                B[i] /= row->SDR_white_point;
+            }
+        } else {
+            for (i = 0; i < count; ++i) {
+                R[i] = ToLinear(R[i], row->transfer, row->SDR_white_point);
+                G[i] = ToLinear(G[i], row->transfer, row->SDR_white_point);
+                B[i] = ToLinear(B[i], row->transfer, row->SDR_white_point);
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static void WriteFloatRow(Uint8 *pixels, int count, const FloatRowFormat *row, float *R, float *G, float *B, float *A)
+{
+    const SDL_PixelFormatDetails *fmt = row->fmt;
+    int i;
+
+    FromLinear(R, count, row->transfer, row->SDR_white_point);
+    FromLinear(G, count, row->transfer, row->SDR_white_point);
+    FromLinear(B, count, row->transfer, row->SDR_white_point);
+
+    switch (row->access) {
+    case SlowBlitPixelAccess_RGB:
+    case SlowBlitPixelAccess_RGBA:
+    case SlowBlitPixelAccess_10Bit:
+        PackUNORMRow((Uint32 *)pixels, count, row, R, G, B, A);
+        break;
+    case SlowBlitPixelAccess_Large:
+    {
+        const int bpp = fmt->bytes_per_pixel;
+        const int r = row->channel[0], g = row->channel[1], b = row->channel[2], a = row->channel[3];
+        switch (SDL_PIXELTYPE(fmt->format)) {
+        case SDL_PIXELTYPE_ARRAYU16:
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                Uint16 *v = (Uint16 *)pixels;
+                v[r] = (Uint16)FLOAT_TO_UNORM(R[i], 65535.0f);
+                v[g] = (Uint16)FLOAT_TO_UNORM(G[i], 65535.0f);
+                v[b] = (Uint16)FLOAT_TO_UNORM(B[i], 65535.0f);
+                if (a >= 0) {
+                    v[a] = (Uint16)FLOAT_TO_UNORM(A[i], 65535.0f);
+                }
+            }
+            break;
+        case SDL_PIXELTYPE_ARRAYF16:
+        {
+            Uint16 hR[FLOAT_ROW_CHUNK], hG[FLOAT_ROW_CHUNK], hB[FLOAT_ROW_CHUNK], hA[FLOAT_ROW_CHUNK];
+            FloatToHalfRow(R, hR, count);
+            FloatToHalfRow(G, hG, count);
+            FloatToHalfRow(B, hB, count);
+            if (a >= 0) {
+                FloatToHalfRow(A, hA, count);
+            }
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                Uint16 *v = (Uint16 *)pixels;
+                v[r] = hR[i];
+                v[g] = hG[i];
+                v[b] = hB[i];
+                if (a >= 0) {
+                    v[a] = hA[i];
+                }
+            }
+            break;
+        }
+        case SDL_PIXELTYPE_ARRAYF32:
+            for (i = 0; i < count; ++i, pixels += bpp) {
+                float *v = (float *)pixels;
+                v[r] = R[i];
+                v[g] = G[i];
+                v[b] = B[i];
+                if (a >= 0) {
+                    v[a] = A[i];
+                }
+            }
+            break;
+        default:
+            break;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static bool SDL_Blit_Slow_Float_Rows(SDL_BlitInfo *info, SDL_Colorspace src_colorspace, float src_white_point, SDL_Colorspace dst_colorspace, float dst_white_point,
+                                     const SDL_TonemapContext *tonemap, const float *color_primaries_matrix)
+{
+    FloatRowFormat src_row, dst_row;
+    float lut[1024];
+    float R[FLOAT_ROW_CHUNK], G[FLOAT_ROW_CHUNK], B[FLOAT_ROW_CHUNK], A[FLOAT_ROW_CHUNK];
+    int i;
+
+    if ((info->flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK)) ||
+        info->src_w != info->dst_w || info->src_h != info->dst_h) {
+        return false;
+    }
+    if (!InitFloatRowFormat(&src_row, info->src_fmt, src_colorspace, src_white_point) ||
+        !InitFloatRowFormat(&dst_row, info->dst_fmt, dst_colorspace, dst_white_point)) {
+        return false;
+    }
+
+    if (src_row.access != SlowBlitPixelAccess_Large) {
+        for (i = 0; i <= (int)src_row.max; ++i) {
+            lut[i] = ToLinear((float)i / src_row.max, src_row.transfer, src_white_point);
+        }
+        src_row.lut = lut;
+    }
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src;
+        Uint8 *dst = info->dst;
+        int x;
+
+        for (x = 0; x < info->dst_w; x += FLOAT_ROW_CHUNK) {
+            const int count = SDL_min(info->dst_w - x, FLOAT_ROW_CHUNK);
+
+            ReadFloatRow(src + x * info->src_fmt->bytes_per_pixel, count, &src_row, R, G, B, A);
+
+            if (tonemap->op == SDL_TONEMAP_LINEAR) {
+                const float scale = tonemap->data.linear.scale;
+                for (i = 0; i < count; ++i) {
+                    R[i] *= scale;
+                    G[i] *= scale;
+                    B[i] *= scale;
+                }
+            } else if (tonemap->op == SDL_TONEMAP_CHROME) {
+                const float *matrix = tonemap->data.chrome.color_primaries_matrix;
+                const float a = tonemap->data.chrome.a;
+                const float b = tonemap->data.chrome.b;
+                for (i = 0; i < count; ++i) {
+                    float vmax;
+                    if (matrix) {
+                        SDL_ConvertColorPrimaries(&R[i], &G[i], &B[i], matrix);
+                    }
+                    vmax = SDL_max(R[i], SDL_max(G[i], B[i]));
+                    if (vmax > 0.0f) {
+                        const float scale = (1.0f + a * vmax) / (1.0f + b * vmax);
+                        R[i] *= scale;
+                        G[i] *= scale;
+                        B[i] *= scale;
+                    }
+                }
+            }
+
+            if (color_primaries_matrix) {
+                for (i = 0; i < count; ++i) {
+                    SDL_ConvertColorPrimaries(&R[i], &G[i], &B[i], color_primaries_matrix);
+                }
+            }
+
+            WriteFloatRow(dst + x * info->dst_fmt->bytes_per_pixel, count, &dst_row, R, G, B, A);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+    return true;
+}
+
 /* The SECOND TRUE BLITTER
  * This one is even slower than the first, but also handles large pixel formats and colorspace conversion
  */
@@ -821,7 +1673,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteLUT *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -886,6 +1738,10 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
         color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, dst_primaries);
     }
 
+    if (SDL_Blit_Slow_Float_Rows(info, src_colorspace, src_white_point, dst_colorspace, dst_white_point, &tonemap, color_primaries_matrix)) {
+        return;
+    }
+
     src_access = GetPixelAccessMethod(src_fmt->format);
     dst_access = GetPixelAccessMethod(dst_fmt->format);
     if (dst_access == SlowBlitPixelAccess_Index8) {
@@ -34,6 +34,7 @@
 
 #include "SDL_pixels_c.h"
 #include "SDL_surface_c.h"
+#include "../io/SDL_iostream_c.h"
 
 #define SAVE_32BIT_BMP
 
@@ -63,6 +64,74 @@
 #define LCS_GM_GRAPHICS 0x00000002
 #endif
 
+#define BMP_SOURCE_PROPERTY "SDL.internal.surface.bmp.source"
+
+static void SDLCALL CleanupBMPSource(void *userdata, void *value)
+{
+    SDL_CloseIO((SDL_IOStream *)value);
+}
+
+/* Return the pixels of the image if they can be used in place, which needs
+   an uncompressed top-down image in a memory stream, in the byte order we use.
+ */
+static Uint8 *GetInPlacePixels(SDL_IOStream *src, Sint64 fp_offset, Uint32 bfOffBits, Uint32 biCompression, Uint16 biBitCount, Uint32 biClrUsed, bool topDown, int width, int height, int *pitch)
+{
+    SDL_PropertiesID props;
+    Uint8 *mem;
+    Sint64 size, stride;
+
+    if (!SDL_GetHintBoolean(SDL_HINT_BMP_LOAD_IN_PLACE, false)) {
+        return NULL;
+    }
+    if (!topDown || (biCompression != BI_RGB && biCompression != BI_BITFIELDS)) {
+        return NULL;
+    }
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (biBitCount > 8 && biBitCount != 24) {
+        return NULL;
+    }
+#endif
+    if (biBitCount == 8 && biClrUsed != 0 && biClrUsed < 256) {
+        // The pixels have to be checked against the palette
+        return NULL;
+    }
+
+    props = SDL_GetIOProperties(src);
+    mem = (Uint8 *)SDL_GetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+    size = SDL_GetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 0);
+    if (!mem) {
+        return NULL;
+    }
+
+    // Rows are padded to 4 bytes, and the pixel data needs to be in the stream
+    stride = ((((Sint64)width * (biBitCount == 15 ? 16 : biBitCount)) + 31) / 32) * 4;
+    if (stride > SDL_MAX_SINT32 || fp_offset + bfOffBits + stride * height > size) {
+        return NULL;
+    }
+    *pitch = (int)stride;
+    return mem + fp_offset + bfOffBits;
+}
+
+static bool HasAlphaChannel(const Uint8 *pixels, int pitch, int width, int height)
+{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    const int alphaChannelOffset = 0;
+#else
+    const int alphaChannelOffset = 3;
+#endif
+    int x, y;
+
+    for (y = 0; y < height; ++y) {
+        const Uint8 *alpha = pixels + (size_t)y * pitch + alphaChannelOffset;
+        for (x = 0; x < width; ++x, alpha += 4) {
+            if (*alpha != 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
 {
     /*
@@ -189,6 +258,8 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
     Uint32 Amask = 0;
     Uint8 *bits;
     Uint8 *top, *end;
+    Uint8 *in_place_pixels = NULL;
+    int in_place_pitch = 0;
     bool topDown;
     bool haveRGBMasks = false;
     bool haveAlphaMask = false;
@@ -412,9 +483,22 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
     {
         SDL_PixelFormat format;
 
+        in_place_pixels = GetInPlacePixels(src, fp_offset, bfOffBits, biCompression, biBitCount, biClrUsed, topDown, biWidth, biHeight, &in_place_pitch);
+        if (in_place_pixels && correctAlpha) {
+            // We can't fix up the alpha channel in place, so ignore it instead
+            if (!HasAlphaChannel(in_place_pixels, in_place_pitch, biWidth, biHeight)) {
+                Amask = 0;
+            }
+            correctAlpha = false;
+        }
+
         // Get the pixel format
         format = SDL_GetPixelFormatForMasks(biBitCount, Rmask, Gmask, Bmask, Amask);
-        surface = SDL_CreateSurface(biWidth, biHeight, format);
+        if (in_place_pixels) {
+            surface = SDL_CreateSurfaceFrom(biWidth, biHeight, format, in_place_pixels, in_place_pitch);
+        } else {
+            surface = SDL_CreateSurface(biWidth, biHeight, format);
+        }
 
         if (!surface) {
             goto done;
@@ -478,6 +562,28 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
         }
     }
 
+    if (in_place_pixels) {
+        // Leave the stream after the pixels, as if we had read them
+        if (SDL_SeekIO(src, fp_offset + bfOffBits + (Sint64)in_place_pitch * surface->h, SDL_IO_SEEK_SET) < 0) {
+            SDL_SetError("Error seeking in datastream");
+            goto done;
+        }
+
+        // The surface keeps the memory alive if the stream owns it
+        if (closeio) {
+            // The stream is closed by the cleanup callback, even if this fails
+            closeio = false;
+            if (!SDL_SetPointerPropertyWithCleanup(SDL_GetSurfaceProperties(surface), BMP_SOURCE_PROPERTY, src, CleanupBMPSource, NULL)) {
+                src = NULL;
+                goto done;
+            }
+        }
+
+        // Success!
+        was_error = false;
+        goto done;
+    }
+
     // Read the surface pixels.  Note that the bmp image is upside down
     if (SDL_SeekIO(src, fp_offset + bfOffBits, SDL_IO_SEEK_SET) < 0) {
         SDL_SetError("Error seeking in datastream");
@@ -575,7 +681,14 @@ done:
 
 SDL_Surface *SDL_LoadBMP(const char *file)
 {
-    SDL_IOStream *stream = SDL_IOFromFile(file, "rb");
+    SDL_IOStream *stream = NULL;
+
+    if (SDL_GetHintBoolean(SDL_HINT_BMP_LOAD_IN_PLACE, false)) {
+        stream = SDL_IOFromMappedFile(file);
+    }
+    if (!stream) {
+        stream = SDL_IOFromFile(file, "rb");
+    }
     if (!stream) {
         return NULL;
     }
@@ -22,6 +22,13 @@
 
 #include "SDL_surface_c.h"
 
+/* Fills that touch more memory than this go around the cache with non-temporal
+ * stores, smaller fills are likely to be read back soon and use regular stores.
+ */
+#define SDL_FILL_STREAM_BYTES (256 * 1024)
+
+#define SDL_FILL_USE_STREAMING(w, h, bpp) ((size_t)(w) * (size_t)(h) * (bpp) >= SDL_FILL_STREAM_BYTES)
+
 #ifdef SDL_SSE_INTRINSICS
 /* *INDENT-OFF* */ // clang-format off
 
@@ -44,21 +51,36 @@
 #endif
 
 #define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
+    if (stream) { \
+        for (i = n / 64; i--;) { \
+            _mm_stream_ps((float *)(p+0), c128); \
+            _mm_stream_ps((float *)(p+16), c128); \
+            _mm_stream_ps((float *)(p+32), c128); \
+            _mm_stream_ps((float *)(p+48), c128); \
+            p += 64; \
+        } \
+    } else { \
+        for (i = n / 64; i--;) { \
+            _mm_store_ps((float *)(p+0), c128); \
+            _mm_store_ps((float *)(p+16), c128); \
+            _mm_store_ps((float *)(p+32), c128); \
+            _mm_store_ps((float *)(p+48), c128); \
+            p += 64; \
+        } \
     }
 
-#define SSE_END
+// Non-temporal stores are weakly ordered, make them visible before returning
+#define SSE_END \
+    if (stream) { \
+        _mm_sfence(); \
+    }
 
 #define DEFINE_SSE_FILLRECT(bpp, type) \
 static void SDL_TARGETING("sse") SDL_FillSurfaceRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
 { \
     int i, n; \
     Uint8 *p = NULL; \
+    const bool stream = SDL_FILL_USE_STREAMING(w, h, bpp); \
   \
     /* If the number of bytes per row is equal to the pitch, treat */ \
     /* all rows as one long continuous row (for better performance) */ \
@@ -102,6 +124,7 @@ static void SDL_TARGETING("sse") SDL_FillSurfaceRect##bpp##SSE(Uint8 *pixels, in
 static void SDL_TARGETING("sse") SDL_FillSurfaceRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 {
     int i, n;
+    const bool stream = SDL_FILL_USE_STREAMING(w, h, 1);
 
     SSE_BEGIN;
     while (h--) {
@@ -133,6 +156,115 @@ DEFINE_SSE_FILLRECT(4, Uint32)
 /* *INDENT-ON* */ // clang-format on
 #endif            // __SSE__
 
+#ifdef SDL_AVX2_INTRINSICS
+/* *INDENT-OFF* */ // clang-format off
+
+#define DEFINE_AVX2_FILLRECT(bpp, type) \
+static void SDL_TARGETING("avx2") SDL_FillSurfaceRect##bpp##AVX2(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+{ \
+    const __m256i c256 = _mm256_set1_epi32((int)color); \
+    const bool stream = SDL_FILL_USE_STREAMING(w, h, bpp); \
+    int n; \
+    Uint8 *p; \
+ \
+    if ((w) * (bpp) == pitch) { \
+        w = w * h; \
+        h = 1; \
+    } \
+ \
+    while (h--) { \
+        n = (w) * (bpp); \
+        p = pixels; \
+ \
+        if (n >= 128) { \
+            int adjust = (int)((32 - ((uintptr_t)p & 31)) & 31) / (bpp); \
+            n -= adjust * (bpp); \
+            while (adjust--) { \
+                *((type *)p) = (type)color; \
+                p += (bpp); \
+            } \
+            /* Streaming needs 32 byte alignment, which a pixel that isn't */ \
+            /* naturally aligned in memory will never reach */ \
+            if (stream && ((uintptr_t)p & 31) == 0) { \
+                for (; n >= 128; n -= 128, p += 128) { \
+                    _mm256_stream_si256((__m256i *)(p+0), c256); \
+                    _mm256_stream_si256((__m256i *)(p+32), c256); \
+                    _mm256_stream_si256((__m256i *)(p+64), c256); \
+                    _mm256_stream_si256((__m256i *)(p+96), c256); \
+                } \
+            } else { \
+                for (; n >= 128; n -= 128, p += 128) { \
+                    _mm256_storeu_si256((__m256i *)(p+0), c256); \
+                    _mm256_storeu_si256((__m256i *)(p+32), c256); \
+                    _mm256_storeu_si256((__m256i *)(p+64), c256); \
+                    _mm256_storeu_si256((__m256i *)(p+96), c256); \
+                } \
+            } \
+        } \
+        for (; n >= 32; n -= 32, p += 32) { \
+            _mm256_storeu_si256((__m256i *)p, c256); \
+        } \
+        for (n /= (bpp); n--; p += (bpp)) { \
+            *((type *)p) = (type)color; \
+        } \
+        pixels += pitch; \
+    } \
+ \
+    if (stream) { \
+        _mm_sfence(); \
+    } \
+}
+
+DEFINE_AVX2_FILLRECT(1, Uint8)
+DEFINE_AVX2_FILLRECT(2, Uint16)
+DEFINE_AVX2_FILLRECT(4, Uint32)
+
+/* *INDENT-ON* */ // clang-format on
+#endif            // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+/* *INDENT-OFF* */ // clang-format off
+
+// NEON has no non-temporal store intrinsic, so these always go through the cache
+#define DEFINE_NEON_FILLRECT(bpp, type) \
+static void SDL_FillSurfaceRect##bpp##NEON(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+{ \
+    const uint8x16_t c128 = vreinterpretq_u8_u32(vdupq_n_u32(color)); \
+    int n; \
+    Uint8 *p; \
+ \
+    if ((w) * (bpp) == pitch) { \
+        w = w * h; \
+        h = 1; \
+    } \
+ \
+    while (h--) { \
+        n = (w) * (bpp); \
+        p = pixels; \
+ \
+        for (; n >= 64; n -= 64, p += 64) { \
+            vst1q_u8(p+0, c128); \
+            vst1q_u8(p+16, c128); \
+            vst1q_u8(p+32, c128); \
+            vst1q_u8(p+48, c128); \
+        } \
+        for (; n >= 16; n -= 16, p += 16) { \
+            vst1q_u8(p, c128); \
+        } \
+        for (n /= (bpp); n--; p += (bpp)) { \
+            *((type *)p) = (type)color; \
+        } \
+        pixels += pitch; \
+    } \
+}
+
+DEFINE_NEON_FILLRECT(1, Uint8)
+DEFINE_NEON_FILLRECT(2, Uint16)
+DEFINE_NEON_FILLRECT(4, Uint32)
+
+/* *INDENT-ON* */ // clang-format on
+#endif            // SDL_NEON_INTRINSICS
+
 static void SDL_FillSurfaceRect1(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 {
     int n;
@@ -256,9 +388,9 @@ bool SDL_FillSurfaceRect(SDL_Surface *dst, const SDL_Rect *rect, Uint32 color)
 
 bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Uint32 color)
 {
-    SDL_Rect clipped;
     Uint8 *pixels;
-    const SDL_Rect *rect;
+    int clip_x1, clip_y1, clip_x2, clip_y2;
+    int bpp, pitch;
     void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
     int i;
 
@@ -303,6 +435,18 @@ bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Ui
         {
             color |= (color << 8);
             color |= (color << 16);
+#ifdef SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillSurfaceRect1AVX2;
+                break;
+            }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillSurfaceRect1NEON;
+                break;
+            }
+#endif
 #ifdef SDL_SSE_INTRINSICS
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillSurfaceRect1SSE;
@@ -316,6 +460,18 @@ bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Ui
         case 2:
         {
             color |= (color << 16);
+#ifdef SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillSurfaceRect2AVX2;
+                break;
+            }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillSurfaceRect2NEON;
+                break;
+            }
+#endif
 #ifdef SDL_SSE_INTRINSICS
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillSurfaceRect2SSE;
@@ -335,6 +491,18 @@ bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Ui
 
         case 4:
         {
+#ifdef SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2()) {
+                fill_function = SDL_FillSurfaceRect4AVX2;
+                break;
+            }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+            if (SDL_HasNEON()) {
+                fill_function = SDL_FillSurfaceRect4NEON;
+                break;
+            }
+#endif
 #ifdef SDL_SSE_INTRINSICS
             if (SDL_HasSSE()) {
                 fill_function = SDL_FillSurfaceRect4SSE;
@@ -350,18 +518,29 @@ bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Ui
         }
     }
 
+    /* Clip the whole batch against the clip rectangle here rather than calling
+     * SDL_GetRectIntersection() for each rect, UI code can pass thousands of them.
+     */
+    clip_x1 = dst->clip_rect.x;
+    clip_y1 = dst->clip_rect.y;
+    clip_x2 = clip_x1 + dst->clip_rect.w;
+    clip_y2 = clip_y1 + dst->clip_rect.h;
+    bpp = SDL_BYTESPERPIXEL(dst->format);
+    pitch = dst->pitch;
+
     for (i = 0; i < count; ++i) {
-        rect = &rects[i];
-        // Perform clipping
-        if (!SDL_GetRectIntersection(rect, &dst->clip_rect, &clipped)) {
+        const SDL_Rect *rect = &rects[i];
+        const int x1 = SDL_max(rect->x, clip_x1);
+        const int y1 = SDL_max(rect->y, clip_y1);
+        const int x2 = SDL_min(rect->x + rect->w, clip_x2);
+        const int y2 = SDL_min(rect->y + rect->h, clip_y2);
+
+        if (rect->w <= 0 || rect->h <= 0 || x1 >= x2 || y1 >= y2) {
             continue;
         }
-        rect = &clipped;
-
-        pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch +
-                 rect->x * SDL_BYTESPERPIXEL(dst->format);
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        pixels = (Uint8 *)dst->pixels + y1 * pitch + x1 * bpp;
+        fill_function(pixels, pitch, color, x2 - x1, y2 - y1);
     }
 
     // We're done!
@@ -156,6 +156,10 @@ const char *SDL_GetPixelFormatName(SDL_PixelFormat format)
         CASE(SDL_PIXELFORMAT_P010)
         CASE(SDL_PIXELFORMAT_EXTERNAL_OES)
         CASE(SDL_PIXELFORMAT_MJPG)
+        CASE(SDL_PIXELFORMAT_BC1)
+        CASE(SDL_PIXELFORMAT_BC2)
+        CASE(SDL_PIXELFORMAT_BC3)
+        CASE(SDL_PIXELFORMAT_BC7)
 
     default:
         return "SDL_PIXELFORMAT_UNKNOWN";
@@ -720,10 +724,24 @@ void SDL_Get8888AlphaMaskAndShift(const SDL_PixelFormatDetails *fmt, Uint32 *mas
     }
 }
 
+int SDL_GetCompressedBlockBytes(SDL_PixelFormat format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_BC1:
+        return 8;
+    case SDL_PIXELFORMAT_BC2:
+    case SDL_PIXELFORMAT_BC3:
+    case SDL_PIXELFORMAT_BC7:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
 SDL_Colorspace SDL_GetDefaultColorspaceForFormat(SDL_PixelFormat format)
 {
     if (SDL_ISPIXELFORMAT_FOURCC(format)) {
-        if (format == SDL_PIXELFORMAT_MJPG) {
+        if (format == SDL_PIXELFORMAT_MJPG || SDL_GetCompressedBlockBytes(format)) {
             return SDL_COLORSPACE_SRGB;
         } else if (format == SDL_PIXELFORMAT_P010) {
             return SDL_COLORSPACE_HDR10;
@@ -1030,6 +1048,8 @@ void SDL_ConvertColorPrimaries(float *fR, float *fG, float *fB, const float *mat
     *fB = matrix[2 * 3 + 0] * v[0] + matrix[2 * 3 + 1] * v[1] + matrix[2 * 3 + 2] * v[2];
 }
 
+static void SDL_RemovePaletteLUT(const SDL_Palette *pal);
+
 SDL_Palette *SDL_CreatePalette(int ncolors)
 {
     SDL_Palette *palette;
@@ -1091,6 +1111,7 @@ void SDL_DestroyPalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_RemovePaletteLUT(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -1153,23 +1174,224 @@ Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     return pixelvalue;
 }
 
-Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
+/*
+ * Opaque colors are looked up in a 32x32x32 RGB cube. Each cell is built
+ * the first time it's used and holds every palette entry that could be the
+ * closest match for some color in the cell, so looking up a color only has
+ * to compare it against those few entries and gives the same result as
+ * SDL_FindColor(). Other colors are cached in a hash table.
+ */
+#define PALETTE_LUT_BITS  5
+#define PALETTE_LUT_SHIFT (8 - PALETTE_LUT_BITS)
+#define PALETTE_LUT_CELLS (1 << (3 * PALETTE_LUT_BITS))
+
+struct SDL_PaletteLUT
+{
+    Uint32 version;                  // The palette version the cache was built for
+    int ncolors;
+    Uint32 cells[PALETTE_LUT_CELLS]; // Offset + 1 of each built cell in candidates, or 0
+    Uint8 *candidates;               // For each cell, the number of entries - 1 and the entries in order
+    size_t num_candidates;
+    size_t max_candidates;
+    SDL_HashTable *translucent;
+};
+
+SDL_PaletteLUT *SDL_CreatePaletteLUT(void)
+{
+    SDL_PaletteLUT *lut = (SDL_PaletteLUT *)SDL_calloc(1, sizeof(*lut));
+    if (!lut) {
+        return NULL;
+    }
+    lut->translucent = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!lut->translucent) {
+        SDL_free(lut);
+        return NULL;
+    }
+    return lut;
+}
+
+void SDL_DestroyPaletteLUT(SDL_PaletteLUT *lut)
 {
+    if (lut) {
+        SDL_DestroyHashTable(lut->translucent);
+        SDL_free(lut->candidates);
+        SDL_free(lut);
+    }
+}
+
+static Uint32 SDL_BuildPaletteLUTCell(SDL_PaletteLUT *lut, int cell, const SDL_Palette *pal)
+{
+    const int lo[3] = {
+        ((cell >> (2 * PALETTE_LUT_BITS)) & ((1 << PALETTE_LUT_BITS) - 1)) << PALETTE_LUT_SHIFT,
+        ((cell >> PALETTE_LUT_BITS) & ((1 << PALETTE_LUT_BITS) - 1)) << PALETTE_LUT_SHIFT,
+        (cell & ((1 << PALETTE_LUT_BITS) - 1)) << PALETTE_LUT_SHIFT
+    };
+    unsigned int smallest_max = ~0U;
+    Uint8 *entries;
+    int i, j, count;
+
+    if (lut->num_candidates + 1 + pal->ncolors > lut->max_candidates) {
+        size_t max_candidates = SDL_max(lut->max_candidates * 2, lut->num_candidates + 1 + pal->ncolors);
+        Uint8 *candidates = (Uint8 *)SDL_realloc(lut->candidates, max_candidates);
+        if (!candidates) {
+            return 0;
+        }
+        lut->candidates = candidates;
+        lut->max_candidates = max_candidates;
+    }
+
+    /* The closest entry to any color in the cell is at most smallest_max away,
+       so entries that can't get that close anywhere in the cell are left out */
+    for (i = 0; i < pal->ncolors; ++i) {
+        const Uint8 *c = &pal->colors[i].r;
+        const int ad = pal->colors[i].a - SDL_ALPHA_OPAQUE;
+        unsigned int max_distance = ad * ad;
+        for (j = 0; j < 3; ++j) {
+            const int d = SDL_max(SDL_abs(c[j] - lo[j]), SDL_abs(c[j] - (lo[j] + (1 << PALETTE_LUT_SHIFT) - 1)));
+            max_distance += d * d;
+        }
+        smallest_max = SDL_min(smallest_max, max_distance);
+    }
+
+    entries = lut->candidates + lut->num_candidates + 1;
+    count = 0;
+    for (i = 0; i < pal->ncolors; ++i) {
+        const Uint8 *c = &pal->colors[i].r;
+        const int ad = pal->colors[i].a - SDL_ALPHA_OPAQUE;
+        unsigned int min_distance = ad * ad;
+        for (j = 0; j < 3; ++j) {
+            int d = 0;
+            if (c[j] < lo[j]) {
+                d = lo[j] - c[j];
+            } else if (c[j] > lo[j] + (1 << PALETTE_LUT_SHIFT) - 1) {
+                d = c[j] - (lo[j] + (1 << PALETTE_LUT_SHIFT) - 1);
+            }
+            min_distance += d * d;
+        }
+        if (min_distance <= smallest_max) {
+            entries[count++] = (Uint8)i;
+        }
+    }
+    entries[-1] = (Uint8)(count - 1);
+
+    lut->cells[cell] = (Uint32)(lut->num_candidates + 1);
+    lut->num_candidates += 1 + count;
+    return lut->cells[cell];
+}
+
+Uint8 SDL_LookupRGBAColor(SDL_PaletteLUT *lut, Uint32 pixelvalue, const SDL_Palette *pal)
+{
+    Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
+    Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
+    Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
+    Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
     Uint8 color_index = 0;
     const void *value;
-    if (SDL_FindInHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, &value)) {
+
+    if (lut->version != pal->version || lut->ncolors != pal->ncolors) {
+        SDL_zeroa(lut->cells);
+        lut->num_candidates = 0;
+        SDL_ClearHashTable(lut->translucent);
+        lut->version = pal->version;
+        lut->ncolors = pal->ncolors;
+    }
+
+    if (a == SDL_ALPHA_OPAQUE) {
+        const int cell = ((r >> PALETTE_LUT_SHIFT) << (2 * PALETTE_LUT_BITS)) |
+                         ((g >> PALETTE_LUT_SHIFT) << PALETTE_LUT_BITS) |
+                         (b >> PALETTE_LUT_SHIFT);
+        Uint32 offset = lut->cells[cell];
+        const Uint8 *entries;
+        unsigned int smallest = ~0U;
+        int i, count;
+
+        if (!offset) {
+            offset = SDL_BuildPaletteLUTCell(lut, cell, pal);
+            if (!offset) {
+                return SDL_FindColor(pal, r, g, b, a);
+            }
+        }
+        entries = lut->candidates + offset;
+        count = entries[-1] + 1;
+        color_index = entries[0];
+        if (count > 1) {
+            for (i = 0; i < count; ++i) {
+                const SDL_Color *c = &pal->colors[entries[i]];
+                const int rd = c->r - r;
+                const int gd = c->g - g;
+                const int bd = c->b - b;
+                const int ad = c->a - a;
+                const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+                if (distance < smallest) {
+                    color_index = entries[i];
+                    if (distance == 0) { // Perfect match!
+                        break;
+                    }
+                    smallest = distance;
+                }
+            }
+        }
+    } else if (SDL_FindInHashTable(lut->translucent, (const void *)(uintptr_t)pixelvalue, &value)) {
         color_index = (Uint8)(uintptr_t)value;
     } else {
-        Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
-        Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
-        Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
-        Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
         color_index = SDL_FindColor(pal, r, g, b, a);
-        SDL_InsertIntoHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, (const void *)(uintptr_t)color_index, true);
+        SDL_InsertIntoHashTable(lut->translucent, (const void *)(uintptr_t)pixelvalue, (const void *)(uintptr_t)color_index, true);
     }
     return color_index;
 }
 
+static SDL_SpinLock SDL_palette_luts_lock;
+static SDL_HashTable *SDL_palette_luts;
+
+static void SDLCALL SDL_DestroyPaletteLUTValue(void *unused, const void *key, const void *value)
+{
+    SDL_DestroyPaletteLUT((SDL_PaletteLUT *)value);
+}
+
+// Find the closest color in a palette, using a cache that lives as long as the palette
+static Uint8 SDL_MapPaletteColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_PaletteLUT *lut = NULL;
+    Uint8 color_index;
+
+    SDL_LockSpinlock(&SDL_palette_luts_lock);
+    if (!SDL_palette_luts) {
+        SDL_palette_luts = SDL_CreateHashTable(0, false, SDL_HashPointer, SDL_KeyMatchPointer, SDL_DestroyPaletteLUTValue, NULL);
+    }
+    if (SDL_palette_luts && !SDL_FindInHashTable(SDL_palette_luts, pal, (const void **)&lut)) {
+        lut = SDL_CreatePaletteLUT();
+        if (lut && !SDL_InsertIntoHashTable(SDL_palette_luts, pal, lut, false)) {
+            SDL_DestroyPaletteLUT(lut);
+            lut = NULL;
+        }
+    }
+    if (lut) {
+        color_index = SDL_LookupRGBAColor(lut, ((Uint32)r << 24) | ((Uint32)g << 16) | ((Uint32)b << 8) | a, pal);
+    } else {
+        color_index = SDL_FindColor(pal, r, g, b, a);
+    }
+    SDL_UnlockSpinlock(&SDL_palette_luts_lock);
+
+    return color_index;
+}
+
+static void SDL_RemovePaletteLUT(const SDL_Palette *pal)
+{
+    SDL_LockSpinlock(&SDL_palette_luts_lock);
+    if (SDL_palette_luts) {
+        SDL_RemoveFromHashTable(SDL_palette_luts, pal);
+    }
+    SDL_UnlockSpinlock(&SDL_palette_luts_lock);
+}
+
+void SDL_QuitPaletteLUTs(void)
+{
+    SDL_LockSpinlock(&SDL_palette_luts_lock);
+    SDL_DestroyHashTable(SDL_palette_luts);
+    SDL_palette_luts = NULL;
+    SDL_UnlockSpinlock(&SDL_palette_luts_lock);
+}
+
 // Tell whether palette is opaque, and if it has an alpha_channel
 void SDL_DetectPalette(const SDL_Palette *pal, bool *is_opaque, bool *has_alpha_channel)
 {
@@ -1229,7 +1451,7 @@ Uint32 SDL_MapRGB(const SDL_PixelFormatDetails *format, const SDL_Palette *palet
             SDL_InvalidParamError("palette");
             return 0;
         }
-        return SDL_FindColor(palette, r, g, b, SDL_ALPHA_OPAQUE);
+        return SDL_MapPaletteColor(palette, r, g, b, SDL_ALPHA_OPAQUE);
     }
 
     if (SDL_ISPIXELFORMAT_10BIT(format->format)) {
@@ -1258,7 +1480,7 @@ Uint32 SDL_MapRGBA(const SDL_PixelFormatDetails *format, const SDL_Palette *pale
             SDL_InvalidParamError("palette");
             return 0;
         }
-        return SDL_FindColor(palette, r, g, b, a);
+        return SDL_MapPaletteColor(palette, r, g, b, a);
     }
 
     if (SDL_ISPIXELFORMAT_10BIT(format->format)) {
@@ -1440,16 +1662,117 @@ static Uint8 *Map1toN(const SDL_Palette *pal, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod
     return map;
 }
 
-bool SDL_ValidateMap(SDL_Surface *src, SDL_Surface *dst)
-{
-    SDL_BlitMap *map = &src->map;
+// Keep mappings for a few recent destinations so blitting to alternating targets doesn't rebuild the blitter each time
+#define SDL_MAX_RECENT_MAPS 3
 
+static bool SDL_IsMapValid(const SDL_BlitMap *map, SDL_Surface *src, SDL_Surface *dst)
+{
     if (map->info.dst_fmt != dst->fmt ||
         map->info.dst_pal != dst->palette ||
         (dst->palette &&
          map->dst_palette_version != dst->palette->version) ||
         (src->palette &&
          map->src_palette_version != src->palette->version)) {
+        return false;
+    }
+    return true;
+}
+
+static bool SDL_IsRecentMapValid(const SDL_BlitMap *map, SDL_Surface *src, SDL_Surface *dst)
+{
+    const SDL_BlitInfo *current = &src->map.info;
+
+    if (!SDL_IsMapValid(map, src, dst) ||
+        map->info.src_fmt != src->fmt ||
+        map->info.src_pal != src->palette ||
+        map->src_colorspace != src->colorspace ||
+        map->dst_colorspace != dst->colorspace) {
+        return false;
+    }
+
+    // The blitter was chosen for the copy state at the time it was mapped
+    if (map->info.flags != current->flags ||
+        map->info.colorkey != current->colorkey ||
+        map->info.r != current->r ||
+        map->info.g != current->g ||
+        map->info.b != current->b ||
+        map->info.a != current->a) {
+        return false;
+    }
+    return true;
+}
+
+static void SDL_SaveRecentMap(SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_BlitMap *map = &src->map;
+
+    if (!map->info.dst_fmt) {
+        // There's no valid mapping to save
+        return;
+    }
+
+    if (map->info.flags & SDL_COPY_RLE_MASK) {
+        // RLE data is tied to the surface, not the mapping
+        return;
+    }
+
+    if (map->info.dst_fmt == dst->fmt && map->info.dst_pal == dst->palette) {
+        // This mapping is out of date for the same destination
+        return;
+    }
+
+    if (!src->recent_maps) {
+        src->recent_maps = (SDL_BlitMap *)SDL_calloc(SDL_MAX_RECENT_MAPS, sizeof(*src->recent_maps));
+        if (!src->recent_maps) {
+            return;
+        }
+    }
+
+    if (src->num_recent_maps == SDL_MAX_RECENT_MAPS) {
+        --src->num_recent_maps;
+        SDL_InvalidateMap(&src->recent_maps[src->num_recent_maps]);
+    }
+    SDL_memmove(&src->recent_maps[1], &src->recent_maps[0], src->num_recent_maps * sizeof(*src->recent_maps));
+    src->recent_maps[0] = *map;
+    ++src->num_recent_maps;
+
+    // The saved mapping owns the lookup tables now
+    map->info.table = NULL;
+    map->info.palette_map = NULL;
+    map->info.dst_fmt = NULL;
+}
+
+static bool SDL_UseRecentMap(SDL_Surface *src, SDL_Surface *dst)
+{
+    int i;
+
+    for (i = 0; i < src->num_recent_maps; ++i) {
+        if (SDL_IsRecentMapValid(&src->recent_maps[i], src, dst)) {
+            SDL_BlitMap map = src->recent_maps[i];
+
+            --src->num_recent_maps;
+            SDL_memmove(&src->recent_maps[i], &src->recent_maps[i + 1], (src->num_recent_maps - i) * sizeof(*src->recent_maps));
+
+            SDL_SaveRecentMap(src, dst);
+            SDL_InvalidateMap(&src->map);
+            src->map = map;
+            src->map.info.dst_surface = dst;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SDL_ValidateMap(SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_BlitMap *map = &src->map;
+
+    if (!SDL_IsMapValid(map, src, dst)) {
+        if (SDL_UseRecentMap(src, dst)) {
+            return true;
+        }
+        SDL_SaveRecentMap(src, dst);
+
         if (!SDL_MapSurface(src, dst)) {
             return false;
         }
@@ -1464,6 +1787,18 @@ bool SDL_ValidateMap(SDL_Surface *src, SDL_Surface *dst)
     return true;
 }
 
+void SDL_InvalidateRecentMaps(SDL_Surface *surface)
+{
+    int i;
+
+    for (i = 0; i < surface->num_recent_maps; ++i) {
+        SDL_InvalidateMap(&surface->recent_maps[i]);
+    }
+    SDL_free(surface->recent_maps);
+    surface->recent_maps = NULL;
+    surface->num_recent_maps = 0;
+}
+
 void SDL_InvalidateMap(SDL_BlitMap *map)
 {
     map->info.dst_fmt = NULL;
@@ -1475,7 +1810,7 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
         map->info.table = NULL;
     }
     if (map->info.palette_map) {
-        SDL_DestroyHashTable(map->info.palette_map);
+        SDL_DestroyPaletteLUT(map->info.palette_map);
         map->info.palette_map = NULL;
     }
 }
@@ -1531,7 +1866,7 @@ bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             // BitField --> Palette
-            map->info.palette_map = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+            map->info.palette_map = SDL_CreatePaletteLUT();
         } else {
             // BitField --> BitField
             if (srcfmt == dstfmt) {
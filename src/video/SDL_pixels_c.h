@@ -31,6 +31,10 @@
 // Pixel format functions
 extern void SDL_Get8888AlphaMaskAndShift(const SDL_PixelFormatDetails *fmt, Uint32 *mask, Uint32 *shift);
 extern SDL_Colorspace SDL_GetDefaultColorspaceForFormat(SDL_PixelFormat pixel_format);
+
+// Block compressed formats store each SDL_COMPRESSED_BLOCK_SIZE x SDL_COMPRESSED_BLOCK_SIZE block of pixels in a fixed number of bytes
+#define SDL_COMPRESSED_BLOCK_SIZE 4
+extern int SDL_GetCompressedBlockBytes(SDL_PixelFormat format);
 extern void SDL_QuitPixelFormatDetails(void);
 
 // Colorspace conversion functions
@@ -45,12 +49,16 @@ extern void SDL_ConvertColorPrimaries(float *fR, float *fG, float *fB, const flo
 // Blit mapping functions
 extern bool SDL_ValidateMap(SDL_Surface *src, SDL_Surface *dst);
 extern void SDL_InvalidateMap(SDL_BlitMap *map);
+extern void SDL_InvalidateRecentMaps(SDL_Surface *surface);
 extern bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst);
 
 // Miscellaneous functions
 extern void SDL_DitherPalette(SDL_Palette *palette);
 extern Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
-extern Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal);
+extern SDL_PaletteLUT *SDL_CreatePaletteLUT(void);
+extern void SDL_DestroyPaletteLUT(SDL_PaletteLUT *lut);
+extern Uint8 SDL_LookupRGBAColor(SDL_PaletteLUT *lut, Uint32 pixelvalue, const SDL_Palette *pal);
+extern void SDL_QuitPaletteLUTs(void);
 extern void SDL_DetectPalette(const SDL_Palette *pal, bool *is_opaque, bool *has_alpha_channel);
 extern SDL_Surface *SDL_DuplicatePixels(int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace, void *pixels, int pitch);
 
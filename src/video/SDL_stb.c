@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_stb_c.h"
+#include "SDL_surface_threads_c.h"
 
 
 // We currently only support JPEG, but we could add other image formats if we wanted
@@ -56,6 +57,9 @@
 #define STBI_NO_ZLIB
 #define STBI_NO_STDIO
 #define STBI_ASSERT SDL_assert
+#define STBI_PARSE_ENTROPY_CODED_DATA SDL_ParseJPEGEntropyCodedData
+struct stbi__jpeg;
+static int SDL_ParseJPEGEntropyCodedData(struct stbi__jpeg *z);
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
@@ -63,18 +67,185 @@
 #endif
 
 #ifdef SDL_HAVE_STB
-static bool SDL_ConvertPixels_MJPG_to_NV12(int width, int height, const void *src, int src_pitch, void *dst, int dst_pitch)
+/* The restart intervals of a baseline scan can be decoded independently, so
+ * if the stream has them we find where each one starts and split them across
+ * the surface worker threads. Anything unusual about the scan falls back to
+ * the sequential decoder, which knows how to recover from corrupt data.
+ */
+#define JPEG_MIN_BAND_PIXELS (64 * 1024)
+
+typedef struct
+{
+    stbi__jpeg z;
+    stbi__context s;
+} SDL_JPEGScanWorker;
+
+typedef struct
+{
+    const stbi__jpeg *z;
+    SDL_JPEGScanWorker *workers;
+    stbi_uc **segments; // where each restart interval starts, plus the end of the scan
+    int num_segments;
+    int num_mcus;
+    int num_bands;
+    SDL_AtomicInt failed;
+} SDL_JPEGScanBands;
+
+static bool SDL_DecodeJPEGSegment(stbi__jpeg *z, int first_mcu, int last_mcu)
+{
+    STBI_SIMD_ALIGN(short, data[64]);
+    int mcu, k, x, y;
+
+    stbi__jpeg_reset(z);
+    for (mcu = first_mcu; mcu < last_mcu; ++mcu) {
+        const int i = mcu % z->img_mcu_x;
+        const int j = mcu / z->img_mcu_x;
+        for (k = 0; k < z->scan_n; ++k) {
+            const int n = z->order[k];
+            for (y = 0; y < z->img_comp[n].v; ++y) {
+                for (x = 0; x < z->img_comp[n].h; ++x) {
+                    const int x2 = (i * z->img_comp[n].h + x) * 8;
+                    const int y2 = (j * z->img_comp[n].v + y) * 8;
+                    const int ha = z->img_comp[n].ha;
+                    if (!stbi__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) {
+                        return false;
+                    }
+                    z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2, data);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static void SDLCALL SDL_DecodeJPEGScanBand(void *userdata, int band)
+{
+    SDL_JPEGScanBands *bands = (SDL_JPEGScanBands *)userdata;
+    SDL_JPEGScanWorker *worker = &bands->workers[band];
+    const int first = (int)(((Sint64)band * bands->num_segments) / bands->num_bands);
+    const int last = (int)(((Sint64)(band + 1) * bands->num_segments) / bands->num_bands);
+    const int restart_interval = bands->z->restart_interval;
+    int i;
+
+    worker->z = *bands->z;
+    worker->s = *bands->z->s;
+    worker->z.s = &worker->s;
+
+    for (i = first; i < last; ++i) {
+        const int first_mcu = i * restart_interval;
+        const int last_mcu = SDL_min(first_mcu + restart_interval, bands->num_mcus);
+
+        worker->s.img_buffer = bands->segments[i];
+        worker->s.img_buffer_end = bands->segments[i + 1];
+        if (!SDL_DecodeJPEGSegment(&worker->z, first_mcu, last_mcu)) {
+            SDL_SetAtomicInt(&bands->failed, 1);
+            return;
+        }
+    }
+}
+
+static int SDL_ParseJPEGEntropyCodedData(stbi__jpeg *z)
+{
+    SDL_JPEGScanBands bands;
+    stbi_uc *p, *end;
+    stbi_uc marker = STBI__MARKER_none;
+    int num_found, band_height;
+
+    if (z->progressive || z->scan_n == 1 || z->restart_interval <= 0 || z->s->read_from_callbacks) {
+        return stbi__parse_entropy_coded_data(z);
+    }
+
+    SDL_zero(bands);
+    bands.z = z;
+    bands.num_mcus = z->img_mcu_x * z->img_mcu_y;
+    bands.num_segments = (bands.num_mcus + z->restart_interval - 1) / z->restart_interval;
+    bands.num_bands = SDL_GetSurfaceBands(SDL_HINT_SURFACE_THREADS, JPEG_MIN_BAND_PIXELS, z->s->img_x, z->s->img_y, 1, &band_height);
+    bands.num_bands = SDL_min(bands.num_bands, bands.num_segments);
+    if (bands.num_bands <= 1) {
+        return stbi__parse_entropy_coded_data(z);
+    }
+
+    bands.segments = (stbi_uc **)SDL_malloc((bands.num_segments + 1) * sizeof(*bands.segments));
+    if (!bands.segments) {
+        return stbi__parse_entropy_coded_data(z);
+    }
+
+    // Find the restart markers, which have to come in order, followed by the marker after the scan
+    p = z->s->img_buffer;
+    end = z->s->img_buffer_end;
+    bands.segments[0] = p;
+    num_found = 1;
+    while (p + 1 < end) {
+        if (p[0] != 0xff || p[1] == 0x00) {
+            p += (p[0] == 0xff) ? 2 : 1;
+        } else if (p[1] == 0xff) {
+            ++p;
+        } else if (STBI__RESTART(p[1]) && num_found < bands.num_segments && p[1] == 0xd0 + ((num_found - 1) & 7)) {
+            p += 2;
+            bands.segments[num_found++] = p;
+        } else {
+            marker = p[1];
+            break;
+        }
+    }
+    if (num_found != bands.num_segments || marker == STBI__MARKER_none || STBI__RESTART(marker)) {
+        SDL_free(bands.segments);
+        return stbi__parse_entropy_coded_data(z);
+    }
+    bands.segments[bands.num_segments] = p;
+
+    bands.workers = (SDL_JPEGScanWorker *)SDL_malloc(bands.num_bands * sizeof(*bands.workers));
+    if (!bands.workers) {
+        SDL_free(bands.segments);
+        return stbi__parse_entropy_coded_data(z);
+    }
+
+    SDL_RunSurfaceBands(SDL_DecodeJPEGScanBand, &bands, bands.num_bands);
+
+    SDL_free(bands.workers);
+    SDL_free(bands.segments);
+
+    if (SDL_GetAtomicInt(&bands.failed)) {
+        return stbi__err("bad huffman code", "Corrupt JPEG");
+    }
+
+    // Pick up after the scan as if we had decoded it here
+    stbi__jpeg_reset(z);
+    z->s->img_buffer = p + 2;
+    z->marker = marker;
+    return 1;
+}
+
+static void *SDL_LoadJPEG(const void *src, int len, stbi__nv12 *nv12, void *dst, int width, int height, int dst_pitch, int *w, int *h)
 {
-    int w = 0, h = 0, format = 0;
     stbi__context s;
-    stbi__start_mem(&s, src, src_pitch);
+    stbi__jpeg *j;
+    int format = 0;
+    void *pixels;
 
-    stbi__result_info ri;
-    SDL_zero(ri);
-    ri.bits_per_channel = 8;
-    ri.channel_order = STBI_ORDER_RGB;
-    ri.num_channels = 0;
+    stbi__start_mem(&s, src, len);
 
+    j = (stbi__jpeg *)SDL_calloc(1, sizeof(*j));
+    if (!j) {
+        return NULL;
+    }
+    j->s = &s;
+    stbi__setup_jpeg(j);
+    if (dst) {
+        j->output = (stbi_uc *)dst;
+        j->output_w = width;
+        j->output_h = height;
+        j->output_pitch = dst_pitch;
+    }
+
+    pixels = load_jpeg_image(j, w, h, &format, 4, nv12);
+    SDL_free(j);
+    return pixels;
+}
+
+static bool SDL_ConvertPixels_MJPG_to_NV12(int width, int height, const void *src, int src_pitch, void *dst, int dst_pitch)
+{
+    int w = 0, h = 0;
     stbi__nv12 nv12;
     nv12.w = width;
     nv12.h = height;
@@ -82,12 +253,20 @@ static bool SDL_ConvertPixels_MJPG_to_NV12(int width, int height, const void *sr
     nv12.y = (stbi_uc *)dst;
     nv12.uv = nv12.y + (nv12.h * nv12.pitch);
 
-    void *pixels = stbi__jpeg_load(&s, &w, &h, &format, 4, &nv12, &ri);
+    void *pixels = SDL_LoadJPEG(src, src_pitch, &nv12, NULL, 0, 0, 0, &w, &h);
     if (!pixels) {
         return false;
     }
     return true;
 }
+
+// Returns true if RGBA32 pixels can be converted to this format in place
+static bool SDL_CanConvertRGBA32InPlace(SDL_PixelFormat format, SDL_Colorspace colorspace)
+{
+    return colorspace == SDL_COLORSPACE_SRGB &&
+           SDL_ISPIXELFORMAT_PACKED(format) &&
+           SDL_PIXELLAYOUT(format) == SDL_PACKEDLAYOUT_8888;
+}
 #endif // SDL_HAVE_STB
 
 bool SDL_ConvertPixels_STB(int width, int height,
@@ -100,8 +279,21 @@ bool SDL_ConvertPixels_STB(int width, int height,
     }
 
     bool result;
-    int w = 0, h = 0, format = 0;
+    int w = 0, h = 0;
     int len = (src_format == SDL_PIXELFORMAT_MJPG) ? src_pitch : (height * src_pitch);
+
+    // Decode straight into the destination if we can, and swizzle it there if needed
+    if (SDL_CanConvertRGBA32InPlace(dst_format, dst_colorspace)) {
+        if (!SDL_LoadJPEG(src, len, NULL, dst, width, height, dst_pitch, &w, &h)) {
+            return false;
+        }
+        if (dst_format == SDL_PIXELFORMAT_RGBA32 || dst_format == SDL_PIXELFORMAT_RGBX32) {
+            return true;
+        }
+        return SDL_ConvertPixelsAndColorspace(w, h, SDL_PIXELFORMAT_RGBA32, SDL_COLORSPACE_SRGB, 0, dst, dst_pitch, dst_format, dst_colorspace, dst_properties, dst, dst_pitch);
+    }
+
+    int format = 0;
     void *pixels = stbi_load_from_memory(src, len, &w, &h, &format, 4);
     if (!pixels) {
         return false;
@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_surface_c.h"
+#include "SDL_surface_threads_c.h"
 
 static bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 static bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
@@ -62,7 +63,7 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
         }
 
         SDL_Surface *src_tmp = SDL_ConvertSurface(src, SDL_PIXELFORMAT_XRGB8888);
-        SDL_Surface *dst_tmp = SDL_CreateSurface(dstrect->w, dstrect->h, SDL_PIXELFORMAT_XRGB8888);
+        SDL_Surface *dst_tmp = SDL_CreatePooledSurface(dstrect->w, dstrect->h, SDL_PIXELFORMAT_XRGB8888);
         if (src_tmp && dst_tmp) {
             result = SDL_StretchSurface(src_tmp, srcrect, dst_tmp, NULL, scaleMode);
             if (result) {
@@ -172,6 +173,56 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     return result;
 }
 
+// Scales the rows from dst_y0 up to dst_y1 of the destination
+typedef bool (*SDL_ScaleFunc)(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1);
+
+// Scales smaller than this per band aren't worth splitting up
+#define SDL_SCALE_MIN_BAND_PIXELS (64 * 1024)
+
+typedef struct SDL_ScaleBands
+{
+    SDL_ScaleFunc scale;
+    const Uint32 *src;
+    int src_w, src_h, src_pitch;
+    Uint32 *dst;
+    int dst_w, dst_h, dst_pitch;
+    int band_height;
+} SDL_ScaleBands;
+
+static void SDLCALL SDL_ScaleBand(void *userdata, int band)
+{
+    const SDL_ScaleBands *bands = (const SDL_ScaleBands *)userdata;
+    const int dst_y0 = band * bands->band_height;
+    const int dst_y1 = SDL_min(dst_y0 + bands->band_height, bands->dst_h);
+
+    bands->scale(bands->src, bands->src_w, bands->src_h, bands->src_pitch, bands->dst, bands->dst_w, bands->dst_h, bands->dst_pitch, dst_y0, dst_y1);
+}
+
+// Runs a scale function, split into bands of destination rows across threads if it's large enough
+static bool SDL_RunScaleFunc(SDL_ScaleFunc scale, int bpp, SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    SDL_ScaleBands bands;
+    int num_bands;
+
+    bands.scale = scale;
+    bands.src_w = srcrect->w;
+    bands.src_h = srcrect->h;
+    bands.src_pitch = s->pitch;
+    bands.src = (const Uint32 *)((const Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * bands.src_pitch);
+    bands.dst_w = dstrect->w;
+    bands.dst_h = dstrect->h;
+    bands.dst_pitch = d->pitch;
+    bands.dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * bands.dst_pitch);
+
+    num_bands = SDL_GetSurfaceBands(SDL_HINT_SURFACE_THREADS, SDL_SCALE_MIN_BAND_PIXELS, bands.dst_w, bands.dst_h, 1, &bands.band_height);
+    if (num_bands <= 1) {
+        return scale(bands.src, bands.src_w, bands.src_h, bands.src_pitch, bands.dst, bands.dst_w, bands.dst_h, bands.dst_pitch, 0, bands.dst_h);
+    }
+
+    SDL_RunSurfaceBands(SDL_ScaleBand, &bands, num_bands);
+    return true;
+}
+
 /* bilinear interpolation precision must be < 8
    Because with SSE: add-multiply: _mm_madd_epi16 works with signed int
    so pixels 0xb1...... are negatives and false the result
@@ -200,7 +251,9 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)dst_y0 * fp_step_h;                                           \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)dst_y0 * dst_pitch);
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -327,11 +380,11 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
     INTERPOL(tmp, tmp + 1, frac_w0, frac_w1, dst);
 }
 
-static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
 
         BILINEAR___HEIGHT
 
@@ -447,11 +500,11 @@ static SDL_INLINE void SDL_TARGETING("sse2") INTERPOL_BILINEAR_SSE(const Uint32
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -567,6 +620,126 @@ static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, in
 }
 #endif
 
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+
+static SDL_INLINE int hasAVX2(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasAVX2();
+    return val;
+}
+
+// Same arithmetic as scale_mat_SSE, so the results are identical
+static bool SDL_TARGETING("avx2") scale_mat_AVX2(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
+{
+    BILINEAR___START
+
+    for (i = dst_y0; i < dst_y1; i++) {
+        int nb_block4;
+        __m128i v_frac_h0;
+        __m128i v_frac_h1;
+        __m128i zero;
+        __m256i v256_frac_h0;
+        __m256i v256_frac_h1;
+        __m256i zero256;
+
+        BILINEAR___HEIGHT
+
+        nb_block4 = middle / 4;
+
+        v_frac_h0 = _mm_set1_epi16((short)frac_h0);
+        v_frac_h1 = _mm_set1_epi16((short)frac_h1);
+        zero = _mm_setzero_si128();
+        v256_frac_h0 = _mm256_set1_epi16((short)frac_h0);
+        v256_frac_h1 = _mm256_set1_epi16((short)frac_h1);
+        zero256 = _mm256_setzero_si256();
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (nb_block4--) {
+            int index_w[4], frac_w[4], n;
+            __m256i x0, x1, k_lo, k_hi, v_frac_w_lo, v_frac_w_hi, e;
+
+            for (n = 0; n < 4; n++) {
+                index_w[n] = 4 * SRC_INDEX(fp_sum_w);
+                frac_w[n] = FRAC(fp_sum_w);
+                fp_sum_w += fp_step_w;
+            }
+
+            /* Each 128-bit lane holds two pairs of neighbouring source pixels,
+               destination pixels 0 and 1 in the low lane, 2 and 3 in the high lane */
+            x0 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                     _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w[0])),
+                                        _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w[1])))),
+                     _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w[2])),
+                                        _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w[3]))), 1);
+            x1 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                     _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w[0])),
+                                        _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w[1])))),
+                     _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w[2])),
+                                        _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w[3]))), 1);
+
+            // Interpolation vertical, k_lo has destination pixels 0 and 2, k_hi has 1 and 3
+            k_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x0, zero256), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(x1, zero256), v256_frac_h0));
+            k_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x0, zero256), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(x1, zero256), v256_frac_h0));
+
+            // Interpolation horizontal
+            v_frac_w_lo = _mm256_setr_epi32(
+                ((FRAC_ONE - frac_w[0]) | (frac_w[0] << 16)), ((FRAC_ONE - frac_w[0]) | (frac_w[0] << 16)),
+                ((FRAC_ONE - frac_w[0]) | (frac_w[0] << 16)), ((FRAC_ONE - frac_w[0]) | (frac_w[0] << 16)),
+                ((FRAC_ONE - frac_w[2]) | (frac_w[2] << 16)), ((FRAC_ONE - frac_w[2]) | (frac_w[2] << 16)),
+                ((FRAC_ONE - frac_w[2]) | (frac_w[2] << 16)), ((FRAC_ONE - frac_w[2]) | (frac_w[2] << 16)));
+            v_frac_w_hi = _mm256_setr_epi32(
+                ((FRAC_ONE - frac_w[1]) | (frac_w[1] << 16)), ((FRAC_ONE - frac_w[1]) | (frac_w[1] << 16)),
+                ((FRAC_ONE - frac_w[1]) | (frac_w[1] << 16)), ((FRAC_ONE - frac_w[1]) | (frac_w[1] << 16)),
+                ((FRAC_ONE - frac_w[3]) | (frac_w[3] << 16)), ((FRAC_ONE - frac_w[3]) | (frac_w[3] << 16)),
+                ((FRAC_ONE - frac_w[3]) | (frac_w[3] << 16)), ((FRAC_ONE - frac_w[3]) | (frac_w[3] << 16)));
+            k_lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_lo, _mm256_srli_si256(k_lo, 8)), v_frac_w_lo);
+            k_hi = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_hi, _mm256_srli_si256(k_hi, 8)), v_frac_w_hi);
+
+            // Store 4 pixels
+            e = _mm256_packs_epi32(_mm256_srli_epi32(k_lo, PRECISION * 2), _mm256_srli_epi32(k_hi, PRECISION * 2));
+            e = _mm256_packus_epi16(e, e);
+            e = _mm256_permute4x64_epi64(e, 0x08);
+            _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(e));
+            dst += 4;
+        }
+
+        // Last points
+        middle &= 0x3;
+        while (middle--) {
+            const Uint32 *s_00_01;
+            const Uint32 *s_10_11;
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return true;
+}
+#endif
+
 #ifdef SDL_NEON_INTRINSICS
 
 static SDL_INLINE int hasNEON(void)
@@ -611,11 +784,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -829,35 +1002,150 @@ static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitc
 }
 #endif
 
+/* Area averaging, used for large downscales where bilinear interpolation
+   would skip over source pixels. Each destination pixel is the average of
+   the source pixels it covers, weighted by how much of them it covers. */
+#define AREA_PRECISION 14
+#define AREA_ONE       (1 << AREA_PRECISION)
+
+typedef struct area_weights_t
+{
+    int span;        // Maximum number of source pixels covered by a destination pixel
+    int *first;      // First source pixel covered by each destination pixel
+    int *count;      // Number of source pixels covered by each destination pixel
+    Uint16 *weights; // 'span' weights for each destination pixel, adding up to AREA_ONE
+} area_weights_t;
+
+static bool get_area_weights(int src_nb, int dst_nb, area_weights_t *area)
+{
+    Uint8 *mem;
+    int i;
+
+    area->span = src_nb / dst_nb + 2;
+    mem = (Uint8 *)SDL_calloc(dst_nb, 2 * sizeof(int) + area->span * sizeof(Uint16));
+    if (!mem) {
+        return false;
+    }
+    area->first = (int *)mem;
+    area->count = area->first + dst_nb;
+    area->weights = (Uint16 *)(area->count + dst_nb);
+
+    for (i = 0; i < dst_nb; i++) {
+        // Destination pixel i covers [start, end) in units of 1 / dst_nb source pixels
+        const Sint64 start = (Sint64)i * src_nb;
+        const Sint64 end = start + src_nb;
+        Uint16 *w = area->weights + (size_t)i * area->span;
+        int index = (int)(start / dst_nb);
+        int n = 0, largest = 0, total = 0;
+
+        area->first[i] = index;
+        for (; (Sint64)index * dst_nb < end; index++, n++) {
+            const Sint64 lo = SDL_max((Sint64)index * dst_nb, start);
+            const Sint64 hi = SDL_min((Sint64)(index + 1) * dst_nb, end);
+            w[n] = (Uint16)(((hi - lo) * AREA_ONE + src_nb / 2) / src_nb);
+            total += w[n];
+            if (w[n] > w[largest]) {
+                largest = n;
+            }
+        }
+        area->count[i] = n;
+
+        // Rounding errors go to the largest weight, so the weights add up exactly
+        w[largest] = (Uint16)(w[largest] + AREA_ONE - total);
+    }
+    return true;
+}
+
+static bool scale_mat_area(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
+{
+    area_weights_t area_w, area_h;
+    Uint32 *sum;
+    int x, y, j, k;
+
+    if (!get_area_weights(src_w, dst_w, &area_w)) {
+        return false;
+    }
+    if (!get_area_weights(src_h, dst_h, &area_h)) {
+        SDL_free(area_w.first);
+        return false;
+    }
+    sum = (Uint32 *)SDL_malloc((size_t)dst_w * 4 * sizeof(Uint32));
+    if (!sum) {
+        SDL_free(area_w.first);
+        SDL_free(area_h.first);
+        return false;
+    }
+
+    for (y = dst_y0; y < dst_y1; y++) {
+        const Uint16 *w_h = area_h.weights + (size_t)y * area_h.span;
+        Uint8 *dst_row = (Uint8 *)dst + (size_t)y * dst_pitch;
+
+        SDL_memset(sum, 0, (size_t)dst_w * 4 * sizeof(Uint32));
+
+        for (j = 0; j < area_h.count[y]; j++) {
+            const Uint8 *src_row = (const Uint8 *)src + (size_t)(area_h.first[y] + j) * src_pitch;
+
+            /* Horizontal pass, keeping 8 bits of fraction for the vertical pass.
+               The sums stay below 2^31: AREA_ONE * (255 << 8) */
+            for (x = 0; x < dst_w; x++) {
+                const Uint8 *s = src_row + 4 * area_w.first[x];
+                const Uint16 *w_w = area_w.weights + (size_t)x * area_w.span;
+                Uint32 a = 0, b = 0, c = 0, d = 0;
+
+                for (k = 0; k < area_w.count[x]; k++) {
+                    a += w_w[k] * s[0];
+                    b += w_w[k] * s[1];
+                    c += w_w[k] * s[2];
+                    d += w_w[k] * s[3];
+                    s += 4;
+                }
+                sum[4 * x + 0] += w_h[j] * ((a + (1 << (AREA_PRECISION - 9))) >> (AREA_PRECISION - 8));
+                sum[4 * x + 1] += w_h[j] * ((b + (1 << (AREA_PRECISION - 9))) >> (AREA_PRECISION - 8));
+                sum[4 * x + 2] += w_h[j] * ((c + (1 << (AREA_PRECISION - 9))) >> (AREA_PRECISION - 8));
+                sum[4 * x + 3] += w_h[j] * ((d + (1 << (AREA_PRECISION - 9))) >> (AREA_PRECISION - 8));
+            }
+        }
+
+        for (x = 0; x < 4 * dst_w; x++) {
+            dst_row[x] = (Uint8)((sum[x] + (1 << (AREA_PRECISION + 7))) >> (AREA_PRECISION + 8));
+        }
+    }
+
+    SDL_free(sum);
+    SDL_free(area_w.first);
+    SDL_free(area_h.first);
+    return true;
+}
+
 bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    bool result = false;
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
+    SDL_ScaleFunc scale = scale_mat;
 
-#ifdef SDL_NEON_INTRINSICS
-    if (!result && hasNEON()) {
-        result = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    // Bilinear interpolation only looks at 2x2 source pixels, so it aliases when shrinking by more than half
+    if (srcrect->w >= dstrect->w && srcrect->h >= dstrect->h &&
+        (srcrect->w > 2 * dstrect->w || srcrect->h > 2 * dstrect->h)) {
+        return SDL_RunScaleFunc(scale_mat_area, 4, s, srcrect, d, dstrect);
+    }
+
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if (scale == scale_mat && hasAVX2()) {
+        scale = scale_mat_AVX2;
     }
 #endif
 
-#ifdef SDL_SSE2_INTRINSICS
-    if (!result && hasSSE2()) {
-        result = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+#ifdef SDL_NEON_INTRINSICS
+    if (scale == scale_mat && hasNEON()) {
+        scale = scale_mat_NEON;
     }
 #endif
 
-    if (!result) {
-        result = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+#ifdef SDL_SSE2_INTRINSICS
+    if (scale == scale_mat && hasSSE2()) {
+        scale = scale_mat_SSE;
     }
+#endif
 
-    return result;
+    return SDL_RunScaleFunc(scale, 4, s, srcrect, d, dstrect);
 }
 
 #define SDL_SCALE_NEAREST__START          \
@@ -870,7 +1158,8 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + incy * dst_y0;      \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)dst_y0 * dst_pitch);
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -879,11 +1168,11 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     posx = incx / 2;                                                      \
     n = dst_w;
 
-static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -898,11 +1187,11 @@ static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -917,11 +1206,11 @@ static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -938,11 +1227,11 @@ static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int dst_y0, int dst_y1)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = dst_y0; i < dst_y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -959,24 +1248,15 @@ static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
 
 bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-    int bpp = SDL_BYTESPERPIXEL(d->format);
-
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
+    const int bpp = SDL_BYTESPERPIXEL(d->format);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return SDL_RunScaleFunc(scale_mat_nearest_4, bpp, s, srcrect, d, dstrect);
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return SDL_RunScaleFunc(scale_mat_nearest_3, bpp, s, srcrect, d, dstrect);
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return SDL_RunScaleFunc(scale_mat_nearest_2, bpp, s, srcrect, d, dstrect);
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return SDL_RunScaleFunc(scale_mat_nearest_1, bpp, s, srcrect, d, dstrect);
     }
 }
@@ -130,6 +130,24 @@ bool SDL_CalculateSurfaceSize(SDL_PixelFormat format, int width, int height, siz
     return true;
 }
 
+#ifdef SDL_MEMORY_STATS
+// Count pixels that the surface allocated and owns
+void SDL_TagSurfacePixels(SDL_Surface *surface, size_t size)
+{
+    SDL_assert(surface->tagged_size == 0);
+    surface->tagged_size = size;
+    SDL_AddTaggedMemory(SDL_MEMORY_TAG_SURFACE, size);
+}
+
+void SDL_UntagSurfacePixels(SDL_Surface *surface)
+{
+    if (surface->tagged_size) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_SURFACE, surface->tagged_size);
+        surface->tagged_size = 0;
+    }
+}
+#endif // SDL_MEMORY_STATS
+
 static bool SDL_InitializeSurface(SDL_Surface *surface, int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace, SDL_PropertiesID props, void *pixels, int pitch, bool onstack)
 {
     SDL_zerop(surface);
@@ -185,10 +203,140 @@ static bool SDL_InitializeSurface(SDL_Surface *surface, int width, int height, S
     return true;
 }
 
-/*
- * Create an empty surface of the appropriate depth using the given format
- */
-SDL_Surface *SDL_CreateSurface(int width, int height, SDL_PixelFormat format)
+/* Pixel buffers of destroyed surfaces, kept for new surfaces of the same size.
+   Sizes are rounded up to a class with 8 steps per power of two, so surfaces
+   that are close in size share buffers, at the cost of up to 12.5% more memory.
+   The number of bytes held is capped by SDL_HINT_SURFACE_POOL_SIZE. */
+#define SDL_SURFACE_POOL_SLOTS    32
+#define SDL_SURFACE_POOL_MIN_SIZE (64 * 1024)   // smaller buffers are cheap to get from the heap
+#define SDL_SURFACE_POOL_DEFAULT  (16 * 1024 * 1024)
+
+typedef struct SDL_PooledPixels
+{
+    void *pixels;
+    size_t size;
+    size_t alignment;
+} SDL_PooledPixels;
+
+static struct
+{
+    SDL_SpinLock lock;
+    size_t held;
+    int count;
+    SDL_PooledPixels slots[SDL_SURFACE_POOL_SLOTS];
+} SDL_surface_pool;
+
+static size_t GetSurfacePoolClassSize(size_t size)
+{
+    size_t step;
+
+    if (size < SDL_SURFACE_POOL_MIN_SIZE) {
+        return 0;
+    }
+
+    if ((Uint64)size > SDL_MAX_UINT32) {
+        return 0;
+    }
+    step = (size_t)1 << (SDL_MostSignificantBitIndex32((Uint32)size) - 3);
+    if (size > SDL_SIZE_MAX - step) {
+        return 0;
+    }
+    return (size + step - 1) & ~(step - 1);
+}
+
+static size_t GetSurfacePoolCapacity(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_POOL_SIZE);
+    if (hint) {
+        return (size_t)SDL_clamp(SDL_atoi(hint), 0, 1 << 30);
+    }
+    return SDL_SURFACE_POOL_DEFAULT;
+}
+
+static void *AcquirePooledPixels(size_t size, size_t alignment)
+{
+    void *pixels = NULL;
+
+    SDL_LockSpinlock(&SDL_surface_pool.lock);
+    for (int i = 0; i < SDL_surface_pool.count; ++i) {
+        SDL_PooledPixels *slot = &SDL_surface_pool.slots[i];
+        if (slot->size == size && slot->alignment == alignment) {
+            pixels = slot->pixels;
+            SDL_surface_pool.held -= size;
+            *slot = SDL_surface_pool.slots[--SDL_surface_pool.count];
+            break;
+        }
+    }
+    SDL_UnlockSpinlock(&SDL_surface_pool.lock);
+
+    if (pixels) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_SURFACE_POOL, size);
+        return pixels;
+    }
+    return SDL_aligned_alloc(alignment, size);
+}
+
+static void ReleasePooledPixels(void *pixels, size_t size, size_t alignment)
+{
+    const size_t capacity = GetSurfacePoolCapacity();
+    bool pooled = false;
+
+    SDL_LockSpinlock(&SDL_surface_pool.lock);
+    if (SDL_surface_pool.count < SDL_SURFACE_POOL_SLOTS && size <= capacity - SDL_min(capacity, SDL_surface_pool.held)) {
+        SDL_PooledPixels *slot = &SDL_surface_pool.slots[SDL_surface_pool.count++];
+        slot->pixels = pixels;
+        slot->size = size;
+        slot->alignment = alignment;
+        SDL_surface_pool.held += size;
+        pooled = true;
+    }
+    SDL_UnlockSpinlock(&SDL_surface_pool.lock);
+
+    if (pooled) {
+        SDL_AddTaggedMemory(SDL_MEMORY_TAG_SURFACE_POOL, size);
+    } else {
+        SDL_aligned_free(pixels);
+    }
+}
+
+void SDL_TrimSurfacePool(void)
+{
+    SDL_PooledPixels slots[SDL_SURFACE_POOL_SLOTS];
+    int count;
+
+    SDL_LockSpinlock(&SDL_surface_pool.lock);
+    count = SDL_surface_pool.count;
+    SDL_memcpy(slots, SDL_surface_pool.slots, count * sizeof(*slots));
+    SDL_surface_pool.count = 0;
+    SDL_surface_pool.held = 0;
+    SDL_UnlockSpinlock(&SDL_surface_pool.lock);
+
+    for (int i = 0; i < count; ++i) {
+        SDL_RemoveTaggedMemory(SDL_MEMORY_TAG_SURFACE_POOL, slots[i].size);
+        SDL_aligned_free(slots[i].pixels);
+    }
+}
+
+void SDL_FreeSurfacePixels(SDL_Surface *surface)
+{
+    SDL_UntagSurfacePixels(surface);
+    if (surface->flags & SDL_SURFACE_PREALLOCATED) {
+        // Don't free
+    } else if (surface->pooled_size) {
+        ReleasePooledPixels(surface->pixels, surface->pooled_size, SDL_GetSIMDAlignment());
+    } else if (surface->flags & SDL_SURFACE_SIMD_ALIGNED) {
+        // Free aligned
+        SDL_aligned_free(surface->pixels);
+    } else {
+        // Normal
+        SDL_free(surface->pixels);
+    }
+    surface->pixels = NULL;
+    surface->flags &= ~SDL_SURFACE_SIMD_ALIGNED;
+    surface->pooled_size = 0;
+}
+
+static SDL_Surface *SDL_CreateSurfaceInternal(int width, int height, SDL_PixelFormat format, bool pooled)
 {
     size_t pitch, size;
     SDL_Surface *surface;
@@ -224,13 +372,21 @@ SDL_Surface *SDL_CreateSurface(int width, int height, SDL_PixelFormat format)
     }
 
     if (surface->w && surface->h && format != SDL_PIXELFORMAT_MJPG) {
+        const size_t pooled_size = pooled ? GetSurfacePoolClassSize(size) : 0;
+
         surface->flags &= ~SDL_SURFACE_PREALLOCATED;
-        surface->pixels = SDL_aligned_alloc(SDL_GetSIMDAlignment(), size);
+        if (pooled_size) {
+            surface->pixels = AcquirePooledPixels(pooled_size, SDL_GetSIMDAlignment());
+        } else {
+            surface->pixels = SDL_aligned_alloc(SDL_GetSIMDAlignment(), size);
+        }
         if (!surface->pixels) {
             SDL_DestroySurface(surface);
             return NULL;
         }
         surface->flags |= SDL_SURFACE_SIMD_ALIGNED;
+        surface->pooled_size = pooled_size;
+        SDL_TagSurfacePixels(surface, size);
 
         // This is important for bitmaps
         SDL_memset(surface->pixels, 0, size);
@@ -238,6 +394,19 @@ SDL_Surface *SDL_CreateSurface(int width, int height, SDL_PixelFormat format)
     return surface;
 }
 
+/*
+ * Create an empty surface of the appropriate depth using the given format
+ */
+SDL_Surface *SDL_CreateSurface(int width, int height, SDL_PixelFormat format)
+{
+    return SDL_CreateSurfaceInternal(width, height, format, SDL_GetHintBoolean(SDL_HINT_SURFACE_POOL_APP_SURFACES, false));
+}
+
+SDL_Surface *SDL_CreatePooledSurface(int width, int height, SDL_PixelFormat format)
+{
+    return SDL_CreateSurfaceInternal(width, height, format, true);
+}
+
 /*
  * Create an RGB surface from an existing memory buffer using the given
  * enum SDL_PIXELFORMAT_* format
@@ -284,6 +453,26 @@ SDL_Surface *SDL_CreateSurfaceFrom(int width, int height, SDL_PixelFormat format
     return surface;
 }
 
+bool SDL_InitializeSurfaceView(SDL_Surface *view, SDL_Surface *surface)
+{
+    if (SDL_ISPIXELFORMAT_INDEXED(surface->format)) {
+        return SDL_SetError("Surface views don't support palettes");
+    }
+
+    if (!SDL_InitializeSurface(view, surface->w, surface->h, surface->format, surface->colorspace, surface->props, surface->pixels, surface->pitch, true)) {
+        return false;
+    }
+
+    view->map.info.r = surface->map.info.r;
+    view->map.info.g = surface->map.info.g;
+    view->map.info.b = surface->map.info.b;
+    view->map.info.a = surface->map.info.a;
+    view->map.info.colorkey = surface->map.info.colorkey;
+    view->map.info.flags = (surface->map.info.flags & ~SDL_COPY_RLE_MASK);
+    view->clip_rect = surface->clip_rect;
+    return true;
+}
+
 SDL_PropertiesID SDL_GetSurfaceProperties(SDL_Surface *surface)
 {
     if (!SDL_SurfaceValid(surface)) {
@@ -436,6 +625,7 @@ bool SDL_SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette)
     }
 
     SDL_InvalidateMap(&surface->map);
+    SDL_InvalidateRecentMaps(surface);
 
     return true;
 }
@@ -1009,6 +1199,11 @@ bool SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
     if (!SDL_ValidateMap(src, dst)) {
         return false;
     }
+#ifdef SDL_HAVE_RLE
+    if (src->rle_job) {
+        SDL_FinishRLESurface(src);
+    }
+#endif
     return src->map.blit(src, srcrect, dst, dstrect);
 }
 
@@ -1350,7 +1545,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
                 } else {
                     fmt = SDL_PIXELFORMAT_ARGB8888;
                 }
-                tmp1 = SDL_CreateSurface(src->w, src->h, fmt);
+                tmp1 = SDL_CreatePooledSurface(src->w, src->h, fmt);
                 SDL_BlitSurfaceUnchecked(src, srcrect, tmp1, &tmprect);
 
                 srcrect2.x = 0;
@@ -1365,7 +1560,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             // Intermediate scaling
             if (is_complex_copy_flags || src->format != dst->format) {
                 SDL_Rect tmprect;
-                SDL_Surface *tmp2 = SDL_CreateSurface(dstrect->w, dstrect->h, src->format);
+                SDL_Surface *tmp2 = SDL_CreatePooledSurface(dstrect->w, dstrect->h, src->format);
                 SDL_StretchSurface(src, &srcrect2, tmp2, NULL, SDL_SCALEMODE_LINEAR);
 
                 SDL_SetSurfaceColorMod(tmp2, r, g, b);
@@ -1755,6 +1950,9 @@ bool SDL_LockSurface(SDL_Surface *surface)
 
     if (!surface->locked) {
 #ifdef SDL_HAVE_RLE
+        // The pixels may change, so any encoding in progress is out of date
+        SDL_CancelRLESurface(surface);
+
         // Perform the lock
         if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
             SDL_UnRLESurface(surface, true);
@@ -1933,7 +2131,7 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     src_properties = surface->props;
 
     // Create a new surface with the desired format
-    convert = SDL_CreateSurface(surface->w, surface->h, format);
+    convert = SDL_CreatePooledSurface(surface->w, surface->h, format);
     if (!convert) {
         goto error;
     }
@@ -1955,6 +2153,7 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
                 goto error;
             }
             convert->flags &= ~SDL_SURFACE_PREALLOCATED;
+            SDL_TagSurfacePixels(convert, size);
             convert->pitch = surface->pitch;
             SDL_memcpy(convert->pixels, surface->pixels, size);
 
@@ -2389,8 +2588,130 @@ bool SDL_ConvertPixels(int width, int height, SDL_PixelFormat src_format, const
  * Here are some ideas for optimization:
  * https://github.com/Wizermil/premultiply_alpha/tree/master/premultiply_alpha
  * https://developer.arm.com/documentation/101964/0201/Pre-multiplied-alpha-channel-data
+ *
+ * The SIMD versions divide by 255 with (x + 1 + (x >> 8)) >> 8, which gives
+ * the same truncated result as x / 255 for every product of two bytes.
+ * They return how many pixels of the row they handled, the rest are done
+ * by the scalar code.
  */
 
+#ifdef SDL_AVX2_INTRINSICS
+static int SDL_TARGETING("avx2") SDL_PremultiplyAlpha8888_AVX2(const Uint32 *src, Uint32 *dst, int width, int alpha_byte)
+{
+    const char a = (char)alpha_byte;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)(0xFFu << (alpha_byte * 8)));
+    const __m256i alpha_lo = _mm256_setr_epi8(a, -128, a, -128, a, -128, a, -128, a + 4, -128, a + 4, -128, a + 4, -128, a + 4, -128,
+                                              a, -128, a, -128, a, -128, a, -128, a + 4, -128, a + 4, -128, a + 4, -128, a + 4, -128);
+    const __m256i alpha_hi = _mm256_add_epi8(alpha_lo, _mm256_set1_epi16(8));
+    int i;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(v, zero), _mm256_shuffle_epi8(v, alpha_lo));
+        __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(v, zero), _mm256_shuffle_epi8(v, alpha_hi));
+        lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, one), _mm256_srli_epi16(lo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, one), _mm256_srli_epi16(hi, 8)), 8);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(_mm256_packus_epi16(lo, hi), v, alpha_mask));
+    }
+    return i;
+}
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static int SDL_TARGETING("sse4.1") SDL_PremultiplyAlpha8888_SSE41(const Uint32 *src, Uint32 *dst, int width, int alpha_byte)
+{
+    const char a = (char)alpha_byte;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i alpha_mask = _mm_set1_epi32((int)(0xFFu << (alpha_byte * 8)));
+    const __m128i alpha_lo = _mm_setr_epi8(a, -128, a, -128, a, -128, a, -128, a + 4, -128, a + 4, -128, a + 4, -128, a + 4, -128);
+    const __m128i alpha_hi = _mm_add_epi8(alpha_lo, _mm_set1_epi16(8));
+    int i;
+
+    for (i = 0; i + 4 <= width; i += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), _mm_shuffle_epi8(v, alpha_lo));
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), _mm_shuffle_epi8(v, alpha_hi));
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_blendv_epi8(_mm_packus_epi16(lo, hi), v, alpha_mask));
+    }
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static SDL_INLINE uint8x16_t SDL_PremultiplyChannel_NEON(uint8x16_t c, uint8x16_t a)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t lo = vmull_u8(vget_low_u8(c), vget_low_u8(a));
+    const uint16x8_t hi = vmull_u8(vget_high_u8(c), vget_high_u8(a));
+    return vcombine_u8(vshrn_n_u16(vsraq_n_u16(vaddq_u16(lo, one), lo, 8), 8),
+                       vshrn_n_u16(vsraq_n_u16(vaddq_u16(hi, one), hi, 8), 8));
+}
+
+static int SDL_PremultiplyAlpha8888_NEON(const Uint32 *src, Uint32 *dst, int width, int alpha_byte)
+{
+    int i, j;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        uint8x16x4_t v = vld4q_u8((const Uint8 *)(src + i));
+        for (j = 0; j < 4; ++j) {
+            if (j != alpha_byte) {
+                v.val[j] = SDL_PremultiplyChannel_NEON(v.val[j], v.val[alpha_byte]);
+            }
+        }
+        vst4q_u8((Uint8 *)(dst + i), v);
+    }
+    return i;
+}
+#endif
+
+static int SDL_PremultiplyAlpha8888_SIMD(const Uint32 *src, Uint32 *dst, int width, int alpha_byte)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return SDL_PremultiplyAlpha8888_AVX2(src, dst, width, alpha_byte);
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return SDL_PremultiplyAlpha8888_SSE41(src, dst, width, alpha_byte);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return SDL_PremultiplyAlpha8888_NEON(src, dst, width, alpha_byte);
+    }
+#endif
+    return 0;
+}
+
+static int SDL_PremultiplyAlpha128_SIMD(const float *src, float *dst, int width)
+{
+    int i = 0;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        const __m128 one = _mm_set_ss(1.0f);
+        for (; i < width; ++i) {
+            const __m128 v = _mm_loadu_ps(src + i * 4);
+            _mm_storeu_ps(dst + i * 4, _mm_mul_ps(v, _mm_move_ss(_mm_shuffle_ps(v, v, 0), one)));
+        }
+    }
+#elif defined(SDL_NEON_INTRINSICS)
+    if (SDL_HasNEON()) {
+        for (; i < width; ++i) {
+            const float32x4_t v = vld1q_f32(src + i * 4);
+            vst1q_f32(dst + i * 4, vmulq_f32(v, vsetq_lane_f32(1.0f, vdupq_n_f32(vgetq_lane_f32(v, 0)), 0)));
+        }
+    }
+#endif
+    return i;
+}
+
 static void SDL_PremultiplyAlpha_AXYZ8888(int width, int height, const void *src, int src_pitch, void *dst, int dst_pitch)
 {
     int c;
@@ -2402,7 +2723,10 @@ static void SDL_PremultiplyAlpha_AXYZ8888(int width, int height, const void *src
     while (height--) {
         const Uint32 *src_px = (const Uint32 *)src;
         Uint32 *dst_px = (Uint32 *)dst;
-        for (c = width; c; --c) {
+        c = SDL_PremultiplyAlpha8888_SIMD(src_px, dst_px, width, (SDL_BYTEORDER == SDL_LIL_ENDIAN) ? 3 : 0);
+        src_px += c;
+        dst_px += c;
+        for (c = width - c; c; --c) {
             // Component bytes extraction.
             srcpixel = *src_px++;
             RGBA_FROM_ARGB8888(srcpixel, srcR, srcG, srcB, srcA);
@@ -2433,7 +2757,10 @@ static void SDL_PremultiplyAlpha_XYZA8888(int width, int height, const void *src
     while (height--) {
         const Uint32 *src_px = (const Uint32 *)src;
         Uint32 *dst_px = (Uint32 *)dst;
-        for (c = width; c; --c) {
+        c = SDL_PremultiplyAlpha8888_SIMD(src_px, dst_px, width, (SDL_BYTEORDER == SDL_LIL_ENDIAN) ? 0 : 3);
+        src_px += c;
+        dst_px += c;
+        for (c = width - c; c; --c) {
             // Component bytes extraction.
             srcpixel = *src_px++;
             RGBA_FROM_RGBA8888(srcpixel, srcR, srcG, srcB, srcA);
@@ -2461,7 +2788,10 @@ static void SDL_PremultiplyAlpha_AXYZ128(int width, int height, const void *src,
     while (height--) {
         const float *src_px = (const float *)src;
         float *dst_px = (float *)dst;
-        for (c = width; c; --c) {
+        c = SDL_PremultiplyAlpha128_SIMD(src_px, dst_px, width);
+        src_px += c * 4;
+        dst_px += c * 4;
+        for (c = width - c; c; --c) {
             flA = *src_px++;
             flR = *src_px++;
             flG = *src_px++;
@@ -3006,7 +3336,11 @@ void SDL_DestroySurface(SDL_Surface *surface)
 
     SDL_DestroyProperties(surface->props);
 
+#ifdef SDL_HAVE_RLE
+    SDL_CancelRLESurface(surface);
+#endif
     SDL_InvalidateMap(&surface->map);
+    SDL_InvalidateRecentMaps(surface);
 
     while (surface->locked > 0) {
         SDL_UnlockSurface(surface);
@@ -3018,15 +3352,7 @@ void SDL_DestroySurface(SDL_Surface *surface)
 #endif
     SDL_SetSurfacePalette(surface, NULL);
 
-    if (surface->flags & SDL_SURFACE_PREALLOCATED) {
-        // Don't free
-    } else if (surface->flags & SDL_SURFACE_SIMD_ALIGNED) {
-        // Free aligned
-        SDL_aligned_free(surface->pixels);
-    } else {
-        // Normal
-        SDL_free(surface->pixels);
-    }
+    SDL_FreeSurfacePixels(surface);
 
     surface->reserved = NULL;
 
@@ -34,6 +34,8 @@ typedef Uint32 SDL_SurfaceDataFlags;
 #define SDL_INTERNAL_SURFACE_STACK      0x00000002u /**< Surface is allocated on the stack */
 #define SDL_INTERNAL_SURFACE_RLEACCEL   0x00000004u /**< Surface is RLE encoded */
 
+typedef struct SDL_RLEJob SDL_RLEJob;
+
 // Surface internal data definition
 struct SDL_Surface
 {
@@ -78,12 +80,42 @@ struct SDL_Surface
 
     /** info for fast blit mapping to other surfaces */
     SDL_BlitMap map;
+
+    /** mappings to other recently used destinations, most recent first */
+    SDL_BlitMap *recent_maps;
+    int num_recent_maps;
+
+    /** RLE encoding in progress on the job pool */
+    SDL_RLEJob *rle_job;
+
+    /** size of the pixel buffer taken from the surface pool, or 0 if it isn't pooled */
+    size_t pooled_size;
+
+#ifdef SDL_MEMORY_STATS
+    /** bytes of pixels counted under SDL_MEMORY_TAG_SURFACE */
+    size_t tagged_size;
+#endif
 };
 
 // Surface functions
 extern bool SDL_SurfaceValid(SDL_Surface *surface);
 extern void SDL_UpdateSurfaceLockFlag(SDL_Surface *surface);
 extern bool SDL_CalculateSurfaceSize(SDL_PixelFormat format, int width, int height, size_t *size, size_t *pitch, bool minimalPitch);
+// Set up a stack surface sharing the pixels of another, with its own clip rect and blit map
+extern bool SDL_InitializeSurfaceView(SDL_Surface *view, SDL_Surface *surface);
+// Create a surface whose pixels are reused from surfaces destroyed earlier, for temporary and conversion surfaces
+extern SDL_Surface *SDL_CreatePooledSurface(int width, int height, SDL_PixelFormat format);
+// Free the pixels a surface owns, or give them back to the pool
+extern void SDL_FreeSurfacePixels(SDL_Surface *surface);
+// Free all the pixel buffers kept in the pool, when the app is suspended or SDL quits
+extern void SDL_TrimSurfacePool(void);
+#ifdef SDL_MEMORY_STATS
+extern void SDL_TagSurfacePixels(SDL_Surface *surface, size_t size);
+extern void SDL_UntagSurfacePixels(SDL_Surface *surface);
+#else
+#define SDL_TagSurfacePixels(surface, size)
+#define SDL_UntagSurfacePixels(surface)
+#endif
 extern float SDL_GetDefaultSDRWhitePoint(SDL_Colorspace colorspace);
 extern float SDL_GetSurfaceSDRWhitePoint(SDL_Surface *surface, SDL_Colorspace colorspace);
 extern float SDL_GetDefaultHDRHeadroom(SDL_Colorspace colorspace);
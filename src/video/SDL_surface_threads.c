@@ -0,0 +1,49 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_surface_threads_c.h"
+
+// The most threads, including the calling thread, that work on one operation
+#define SDL_MAX_SURFACE_THREADS 16
+
+int SDL_GetSurfaceBands(const char *hint, int min_band_pixels, int width, int height, int row_alignment, int *band_height)
+{
+    const char *value = SDL_GetHint(hint);
+    int num_bands = value ? SDL_atoi(value) : 0;
+
+    num_bands = SDL_min(num_bands, SDL_MAX_SURFACE_THREADS);
+    num_bands = SDL_min(num_bands, (int)(((Sint64)width * height) / min_band_pixels));
+    num_bands = SDL_min(num_bands, height / row_alignment);
+    if (num_bands <= 1) {
+        *band_height = height;
+        return 1;
+    }
+
+    *band_height = (height + num_bands - 1) / num_bands;
+    *band_height = ((*band_height + row_alignment - 1) / row_alignment) * row_alignment;
+    return (height + *band_height - 1) / *band_height;
+}
+
+void SDL_RunSurfaceBands(SDL_SurfaceBandFunc func, void *userdata, int num_bands)
+{
+    SDL_RunJobs(func, userdata, num_bands);
+}
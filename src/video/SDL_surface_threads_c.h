@@ -0,0 +1,37 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_surface_threads_c_h_
+#define SDL_surface_threads_c_h_
+
+// Splits large software surface operations into bands of rows, which run on the SDL job pool
+
+typedef void (SDLCALL *SDL_SurfaceBandFunc)(void *userdata, int band);
+
+// Returns how many bands to split a width x height operation into, based on the thread count in the hint.
+// Each band gets at least min_band_pixels pixels, and the band height is a multiple of row_alignment.
+extern int SDL_GetSurfaceBands(const char *hint, int min_band_pixels, int width, int height, int row_alignment, int *band_height);
+
+// Calls func for each band from 0 to num_bands - 1, on the calling thread and any idle workers, and returns once they're all done.
+extern void SDL_RunSurfaceBands(SDL_SurfaceBandFunc func, void *userdata, int num_bands);
+
+#endif // SDL_surface_threads_c_h_
@@ -3479,6 +3479,11 @@ static bool ShouldAttemptTextureFramebuffer(void)
             attempt_texture_framebuffer = false;
         }
 #endif
+#ifdef SDL_PLATFORM_WINRT // The swap chain framebuffer only uploads the updated rects, skipping the renderer's copies
+        if (_this->CreateWindowFramebuffer && (SDL_strcmp(_this->name, "winrt") == 0)) {
+            attempt_texture_framebuffer = false;
+        }
+#endif
 #ifdef SDL_PLATFORM_EMSCRIPTEN
         attempt_texture_framebuffer = false;
 #endif
@@ -4073,7 +4078,8 @@ void SDL_OnWindowDisplayChanged(SDL_Window *window)
 {
     // Don't run this if a fullscreen change was made in an event watcher callback in response to a display changed event.
     if (window->update_fullscreen_on_display_changed && (window->flags & SDL_WINDOW_FULLSCREEN)) {
-        const bool auto_mode_switch = SDL_GetHintBoolean(SDL_HINT_VIDEO_MATCH_EXCLUSIVE_MODE_ON_MOVE, true);
+        static SDL_HintCache match_mode_on_move = SDL_HINT_CACHE_INIT(SDL_HINT_VIDEO_MATCH_EXCLUSIVE_MODE_ON_MOVE);
+        const bool auto_mode_switch = SDL_GetCachedHintBoolean(&match_mode_on_move, true);
 
         if (auto_mode_switch && (window->requested_fullscreen_mode.w != 0 || window->requested_fullscreen_mode.h != 0)) {
             SDL_DisplayID displayID = SDL_GetDisplayForWindowPosition(window);
@@ -5532,7 +5538,9 @@ bool SDL_GetTextInputMultiline(SDL_PropertiesID props)
         return SDL_GetBooleanProperty(props, SDL_PROP_TEXTINPUT_MULTILINE_BOOLEAN, false);
     }
 
-    if (SDL_GetHintBoolean(SDL_HINT_RETURN_KEY_HIDES_IME, false)) {
+    static SDL_HintCache return_key_hides_ime = SDL_HINT_CACHE_INIT(SDL_HINT_RETURN_KEY_HIDES_IME);
+
+    if (SDL_GetCachedHintBoolean(&return_key_hides_ime, false)) {
         return false;
     } else {
         return true;
@@ -5862,7 +5870,9 @@ bool SDL_ShowSimpleMessageBox(SDL_MessageBoxFlags flags, const char *title, cons
 
 bool SDL_ShouldAllowTopmost(void)
 {
-    return SDL_GetHintBoolean(SDL_HINT_WINDOW_ALLOW_TOPMOST, true);
+    static SDL_HintCache allow_topmost = SDL_HINT_CACHE_INIT(SDL_HINT_WINDOW_ALLOW_TOPMOST);
+
+    return SDL_GetCachedHintBoolean(&allow_topmost, true);
 }
 
 bool SDL_ShowWindowSystemMenu(SDL_Window *window, int x, int y)
@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_pixels_c.h"
+#include "SDL_surface_threads_c.h"
 #include "SDL_yuv_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
@@ -302,6 +303,227 @@ static bool GetYUVPlanes(int width, int height, SDL_PixelFormat format, const vo
     return true;
 }
 
+#ifdef SDL_AVX2_INTRINSICS
+static bool yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasAVX2()) {
+        return false;
+    }
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P010) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_XBGR2101010:
+            yuvp010_xbgr2101010_avx2(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
+// The NEON stores write the channels in little-endian byte order
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasNEON()) {
+        return false;
+    }
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P010) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_XBGR2101010:
+            yuvp010_xbgr2101010_neon(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
 #ifdef SDL_SSE2_INTRINSICS
 static bool SDL_TARGETING("sse2") yuv_rgb_sse(
     SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
@@ -586,6 +808,166 @@ static bool yuv_rgb_std(
     return false;
 }
 
+// Returns true if yuv_rgb_std(), and so every yuv_rgb_*() function after a failed SIMD one, handles this conversion
+static bool yuv_rgb_has_fast_path(SDL_PixelFormat src_format, SDL_PixelFormat dst_format)
+{
+    switch (src_format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+        case SDL_PIXELFORMAT_RGB24:
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return true;
+        default:
+            return false;
+        }
+    case SDL_PIXELFORMAT_P010:
+        return dst_format == SDL_PIXELFORMAT_XBGR2101010;
+    default:
+        return false;
+    }
+}
+
+static bool yuv_rgb(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return true;
+    }
+
+    if (yuv_rgb_neon(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return true;
+    }
+
+    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return true;
+    }
+
+    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return true;
+    }
+
+    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return true;
+    }
+    return false;
+}
+
+// Frames smaller than this per band aren't worth splitting up
+#define YUV2RGB_MIN_BAND_PIXELS (256 * 1024)
+
+typedef struct YUV2RGBBands
+{
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+    int width;
+    int height;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    int band_height;
+} YUV2RGBBands;
+
+static void SDLCALL yuv_rgb_band(void *userdata, int band)
+{
+    const YUV2RGBBands *bands = (const YUV2RGBBands *)userdata;
+    const int start = band * bands->band_height;
+    const int height = SDL_min(bands->band_height, bands->height - start);
+    const int uv_start = IsPlanar2x2Format(bands->src_format) ? (start / 2) : start;
+
+    yuv_rgb(bands->src_format, bands->dst_format, bands->width, height,
+            bands->y + start * bands->y_stride,
+            bands->u + uv_start * bands->uv_stride,
+            bands->v + uv_start * bands->uv_stride,
+            bands->y_stride, bands->uv_stride,
+            bands->rgb + start * bands->rgb_stride, bands->rgb_stride,
+            bands->yuv_type);
+}
+
+// Runs yuv_rgb(), split into bands of rows across SDL_HINT_VIDEO_YUV_CONVERSION_THREADS threads for large frames
+static bool yuv_rgb_rows(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    int width, int height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    YUV2RGBBands bands;
+    int num_bands;
+
+    if (!yuv_rgb_has_fast_path(src_format, dst_format)) {
+        return false;
+    }
+
+    // Bands start on even rows so each one owns whole chroma rows
+    num_bands = SDL_GetSurfaceBands(SDL_HINT_VIDEO_YUV_CONVERSION_THREADS, YUV2RGB_MIN_BAND_PIXELS, width, height, 2, &bands.band_height);
+    if (num_bands <= 1) {
+        return yuv_rgb(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+    }
+
+    bands.src_format = src_format;
+    bands.dst_format = dst_format;
+    bands.width = width;
+    bands.height = height;
+    bands.y = y;
+    bands.u = u;
+    bands.v = v;
+    bands.y_stride = y_stride;
+    bands.uv_stride = uv_stride;
+    bands.rgb = rgb;
+    bands.rgb_stride = rgb_stride;
+    bands.yuv_type = yuv_type;
+    SDL_RunSurfaceBands(yuv_rgb_band, &bands, num_bands);
+    return true;
+}
+
+bool SDL_CanConvertYUVPlanesToRGB(SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace)
+{
+    YCbCrType yuv_type;
+
+    if (SDL_COLORSPACEPRIMARIES(src_colorspace) != SDL_COLORSPACEPRIMARIES(dst_colorspace) ||
+        !yuv_rgb_has_fast_path(src_format, dst_format)) {
+        return false;
+    }
+    return GetYUVConversionType(src_colorspace, &yuv_type);
+}
+
+bool SDL_ConvertYUVPlanesToRGB(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace,
+                               const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+                               SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, void *dst, int dst_pitch)
+{
+    YCbCrType yuv_type = YCBCR_601_LIMITED;
+
+    if (!SDL_CanConvertYUVPlanesToRGB(src_format, src_colorspace, dst_format, dst_colorspace)) {
+        return false;
+    }
+    GetYUVConversionType(src_colorspace, &yuv_type);
+
+    return yuv_rgb_rows(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type);
+}
+
 bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                   SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch,
                                   SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
@@ -607,15 +989,7 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
             return false;
         }
 
-        if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-            return true;
-        }
-
-        if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-            return true;
-        }
-
-        if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        if (yuv_rgb_rows(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
             return true;
         }
     }
@@ -716,16 +1090,64 @@ static struct RGB2YUVFactors RGB2YUVFactorTables[] = {
     },
 };
 
-static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+// A band of rows to convert from RGB to a 2x2 subsampled YUV format.
+// The chroma pointers may point into an interleaved plane, in which case uv_pixel_stride is 2.
+typedef struct RGB2YUVRows
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half = width / 2;
-    const int width_remainder = (width & 0x1);
-    int i, j;
+    void (*convert)(const struct RGB2YUVRows *rows);
+    const struct RGB2YUVFactors *cvt;
+    int width;
+    int height;
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *y;
+    Uint8 *u;
+    Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    int uv_pixel_stride;
+} RGB2YUVRows;
+
+// Frames smaller than this per band aren't worth splitting up
+#define RGB2YUV_MIN_BAND_PIXELS (256 * 1024)
+
+typedef struct RGB2YUVBands
+{
+    const RGB2YUVRows *rows;
+    int band_height;
+} RGB2YUVBands;
 
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+static void SDLCALL SDL_ConvertPixels_RGB_to_YUV_Band(void *userdata, int band)
+{
+    const RGB2YUVBands *bands = (const RGB2YUVBands *)userdata;
+    const RGB2YUVRows *rows = bands->rows;
+    const int start = band * bands->band_height;
+    RGB2YUVRows rect = *rows;
+
+    rect.height = SDL_min(bands->band_height, rows->height - start);
+    rect.src += start * rows->src_pitch;
+    rect.y += start * rows->y_stride;
+    rect.u += (start / 2) * rows->uv_stride;
+    rect.v += (start / 2) * rows->uv_stride;
+    rows->convert(&rect);
+}
+
+// Runs rows->convert, split into bands of rows across SDL_HINT_VIDEO_YUV_CONVERSION_THREADS threads for large frames
+static void SDL_ConvertPixels_RGB_to_YUV_Rows(const RGB2YUVRows *rows)
+{
+    RGB2YUVBands bands;
+    int num_bands;
+
+    // Bands start on even rows so each one owns whole chroma rows
+    num_bands = SDL_GetSurfaceBands(SDL_HINT_VIDEO_YUV_CONVERSION_THREADS, RGB2YUV_MIN_BAND_PIXELS, rows->width, rows->height, 2, &bands.band_height);
+    if (num_bands <= 1) {
+        rows->convert(rows);
+        return;
+    }
+
+    bands.rows = rows;
+    SDL_RunSurfaceBands(SDL_ConvertPixels_RGB_to_YUV_Band, &bands, num_bands);
+}
 
 #define MAKE_Y(r, g, b) (Uint8)SDL_clamp(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset), 0, 255)
 #define MAKE_U(r, g, b) (Uint8)SDL_clamp(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128), 0, 255)
@@ -775,140 +1197,387 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 
 #define READ_ONE_RGB_PIXEL READ_1x1_PIXEL
 
-    switch (dst_format) {
-    case SDL_PIXELFORMAT_YV12:
-    case SDL_PIXELFORMAT_IYUV:
-    case SDL_PIXELFORMAT_NV12:
-    case SDL_PIXELFORMAT_NV21:
-    {
-        const Uint8 *curr_row, *next_row;
-
-        Uint8 *plane_y;
-        Uint8 *plane_u;
-        Uint8 *plane_v;
-        Uint8 *plane_interleaved_uv;
-        Uint32 y_stride, uv_stride, y_skip, uv_skip;
-
-        if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                          (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                          &y_stride, &uv_stride)) {
-            return false;
-        }
-
-        plane_interleaved_uv = (plane_y + height * y_stride);
-        y_skip = (y_stride - width);
+static void SDL_ConvertPixels_XRGB8888_to_YUV420_std(const RGB2YUVRows *rows)
+{
+    const struct RGB2YUVFactors *cvt = rows->cvt;
+    const int width = rows->width;
+    const int width_half = width / 2;
+    const int width_remainder = (width & 0x1);
+    const int uv_pixel_stride = rows->uv_pixel_stride;
+    int i, j;
 
-        curr_row = (const Uint8 *)src;
+    for (j = 0; j < rows->height; j += 2) {
+        const Uint8 *curr_row = rows->src + j * rows->src_pitch;
+        const Uint8 *next_row = curr_row + rows->src_pitch;
+        const int num_rows = SDL_min(rows->height - j, 2);
+        Uint8 *plane_u = rows->u + (j / 2) * rows->uv_stride;
+        Uint8 *plane_v = rows->v + (j / 2) * rows->uv_stride;
+        int k;
 
         // Write Y plane
-        for (j = 0; j < height; j++) {
+        for (k = 0; k < num_rows; ++k) {
+            const Uint32 *row = (const Uint32 *)(curr_row + k * rows->src_pitch);
+            Uint8 *plane_y = rows->y + (j + k) * rows->y_stride;
             for (i = 0; i < width; i++) {
-                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+                const Uint32 p1 = row[i];
                 const Uint32 r = (p1 & 0x00ff0000) >> 16;
                 const Uint32 g = (p1 & 0x0000ff00) >> 8;
                 const Uint32 b = (p1 & 0x000000ff);
                 *plane_y++ = MAKE_Y(r, g, b);
             }
-            plane_y += y_skip;
-            curr_row += src_pitch;
         }
 
-        curr_row = (const Uint8 *)src;
-        next_row = (const Uint8 *)src;
-        next_row += src_pitch;
-
-        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - (width + 1) / 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
+        // Write UV planes
+        if (num_rows == 2) {
+            for (i = 0; i < width_half; i++) {
+                READ_2x2_PIXELS;
+                *plane_u = MAKE_U(r, g, b);
+                *plane_v = MAKE_V(r, g, b);
+                plane_u += uv_pixel_stride;
+                plane_v += uv_pixel_stride;
             }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
+            if (width_remainder) {
+                READ_2x1_PIXELS;
+                *plane_u = MAKE_U(r, g, b);
+                *plane_v = MAKE_V(r, g, b);
             }
-        } else if (dst_format == SDL_PIXELFORMAT_NV12) {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
+        } else {
+            for (i = 0; i < width_half; i++) {
+                READ_1x2_PIXELS;
+                *plane_u = MAKE_U(r, g, b);
+                *plane_v = MAKE_V(r, g, b);
+                plane_u += uv_pixel_stride;
+                plane_v += uv_pixel_stride;
             }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
+            if (width_remainder) {
+                READ_1x1_PIXEL;
+                *plane_u = MAKE_U(r, g, b);
+                *plane_v = MAKE_V(r, g, b);
             }
-        } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
+        }
+    }
+}
+
+/* The SIMD versions below convert pairs of rows in blocks of pixels, doing the same float math in the same
+   order as MAKE_Y/MAKE_U/MAKE_V, so their output matches the scalar path. Each returns the number of
+   columns it converted, and leaves the rest of the row and an odd last row to the scalar path. */
+
+// Stores the chroma samples for the NV formats, which interleave U and V in either order
+#define STORE_UV_INTERLEAVED(UV_U_FIRST, UV_V_FIRST) \
+    if (rows->u < rows->v) {                         \
+        UV_U_FIRST;                                  \
+    } else {                                         \
+        UV_V_FIRST;                                  \
+    }
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static int SDL_TARGETING("sse4.1") SDL_ConvertPixels_XRGB8888_to_YUV420_SSE41(const RGB2YUVRows *rows)
+{
+    const struct RGB2YUVFactors *cvt = rows->cvt;
+    const int width = (rows->width & ~7);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i y_offset = _mm_set1_epi32(cvt->y_offset);
+    const __m128i uv_offset = _mm_set1_epi32(128);
+    int i, j;
+
+#define RGB2YUV_SSE41_UNPACK(P, R, G, B)                   \
+    R = _mm_and_si128(_mm_srli_epi32(P, 16), mask);        \
+    G = _mm_and_si128(_mm_srli_epi32(P, 8), mask);         \
+    B = _mm_and_si128(P, mask);
+
+#define RGB2YUV_SSE41_DOT(F, R, G, B, OFFSET)                                                          \
+    _mm_add_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_add_ps(_mm_add_ps(                                  \
+        _mm_mul_ps(_mm_set1_ps(F[0]), _mm_cvtepi32_ps(R)), _mm_mul_ps(_mm_set1_ps(F[1]), _mm_cvtepi32_ps(G))), \
+        _mm_mul_ps(_mm_set1_ps(F[2]), _mm_cvtepi32_ps(B))), half)), OFFSET)
+
+    for (j = 0; j < (rows->height & ~1); j += 2) {
+        const Uint8 *curr_row = rows->src + j * rows->src_pitch;
+        const Uint8 *next_row = curr_row + rows->src_pitch;
+        Uint8 *plane_y1 = rows->y + j * rows->y_stride;
+        Uint8 *plane_y2 = plane_y1 + rows->y_stride;
+        Uint8 *plane_u = rows->u + (j / 2) * rows->uv_stride;
+        Uint8 *plane_v = rows->v + (j / 2) * rows->uv_stride;
+
+        for (i = 0; i < width; i += 8) {
+            const __m128i p1 = _mm_loadu_si128((const __m128i *)(curr_row + i * 4));
+            const __m128i p2 = _mm_loadu_si128((const __m128i *)(curr_row + i * 4 + 16));
+            const __m128i p3 = _mm_loadu_si128((const __m128i *)(next_row + i * 4));
+            const __m128i p4 = _mm_loadu_si128((const __m128i *)(next_row + i * 4 + 16));
+            __m128i r1, g1, b1, r2, g2, b2, r3, g3, b3, r4, g4, b4;
+            __m128i y1, y2, y3, y4, r, g, b, u, v, y;
+
+            RGB2YUV_SSE41_UNPACK(p1, r1, g1, b1);
+            RGB2YUV_SSE41_UNPACK(p2, r2, g2, b2);
+            RGB2YUV_SSE41_UNPACK(p3, r3, g3, b3);
+            RGB2YUV_SSE41_UNPACK(p4, r4, g4, b4);
+
+            y1 = RGB2YUV_SSE41_DOT(cvt->y, r1, g1, b1, y_offset);
+            y2 = RGB2YUV_SSE41_DOT(cvt->y, r2, g2, b2, y_offset);
+            y3 = RGB2YUV_SSE41_DOT(cvt->y, r3, g3, b3, y_offset);
+            y4 = RGB2YUV_SSE41_DOT(cvt->y, r4, g4, b4, y_offset);
+            y = _mm_packus_epi16(_mm_packs_epi32(y1, y2), _mm_packs_epi32(y3, y4));
+            _mm_storel_epi64((__m128i *)(plane_y1 + i), y);
+            _mm_storel_epi64((__m128i *)(plane_y2 + i), _mm_srli_si128(y, 8));
+
+            // Sum each 2x2 block: add the rows, then the horizontal neighbours
+            r = _mm_srli_epi32(_mm_hadd_epi32(_mm_add_epi32(r1, r3), _mm_add_epi32(r2, r4)), 2);
+            g = _mm_srli_epi32(_mm_hadd_epi32(_mm_add_epi32(g1, g3), _mm_add_epi32(g2, g4)), 2);
+            b = _mm_srli_epi32(_mm_hadd_epi32(_mm_add_epi32(b1, b3), _mm_add_epi32(b2, b4)), 2);
+            u = RGB2YUV_SSE41_DOT(cvt->u, r, g, b, uv_offset);
+            v = RGB2YUV_SSE41_DOT(cvt->v, r, g, b, uv_offset);
+            u = _mm_packus_epi16(_mm_packs_epi32(u, u), _mm_setzero_si128());
+            v = _mm_packus_epi16(_mm_packs_epi32(v, v), _mm_setzero_si128());
+            if (rows->uv_pixel_stride == 1) {
+                const int u32 = _mm_cvtsi128_si32(u);
+                const int v32 = _mm_cvtsi128_si32(v);
+                SDL_memcpy(plane_u + i / 2, &u32, sizeof(u32));
+                SDL_memcpy(plane_v + i / 2, &v32, sizeof(v32));
+            } else {
+                STORE_UV_INTERLEAVED(
+                    _mm_storel_epi64((__m128i *)(plane_u + i), _mm_unpacklo_epi8(u, v)),
+                    _mm_storel_epi64((__m128i *)(plane_v + i), _mm_unpacklo_epi8(v, u)));
             }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
+        }
+    }
+
+#undef RGB2YUV_SSE41_UNPACK
+#undef RGB2YUV_SSE41_DOT
+    return width;
+}
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+static int SDL_TARGETING("avx2") SDL_ConvertPixels_XRGB8888_to_YUV420_AVX2(const RGB2YUVRows *rows)
+{
+    const struct RGB2YUVFactors *cvt = rows->cvt;
+    const int width = (rows->width & ~15);
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256i y_offset = _mm256_set1_epi32(cvt->y_offset);
+    const __m256i uv_offset = _mm256_set1_epi32(128);
+    int i, j;
+
+#define RGB2YUV_AVX2_UNPACK(P, R, G, B)                      \
+    R = _mm256_and_si256(_mm256_srli_epi32(P, 16), mask);    \
+    G = _mm256_and_si256(_mm256_srli_epi32(P, 8), mask);     \
+    B = _mm256_and_si256(P, mask);
+
+#define RGB2YUV_AVX2_DOT(F, R, G, B, OFFSET)                                                                    \
+    _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(                             \
+        _mm256_mul_ps(_mm256_set1_ps(F[0]), _mm256_cvtepi32_ps(R)), _mm256_mul_ps(_mm256_set1_ps(F[1]), _mm256_cvtepi32_ps(G))), \
+        _mm256_mul_ps(_mm256_set1_ps(F[2]), _mm256_cvtepi32_ps(B))), half)), OFFSET)
+
+// Packs 8 int32 values from one vector into 8 bytes, saturating like SDL_clamp(x, 0, 255)
+#define RGB2YUV_AVX2_PACK8(X) \
+    _mm_packus_epi16(_mm_packs_epi32(_mm256_castsi256_si128(X), _mm256_extracti128_si256(X, 1)), _mm_setzero_si128())
+
+    for (j = 0; j < (rows->height & ~1); j += 2) {
+        const Uint8 *curr_row = rows->src + j * rows->src_pitch;
+        const Uint8 *next_row = curr_row + rows->src_pitch;
+        Uint8 *plane_y1 = rows->y + j * rows->y_stride;
+        Uint8 *plane_y2 = plane_y1 + rows->y_stride;
+        Uint8 *plane_u = rows->u + (j / 2) * rows->uv_stride;
+        Uint8 *plane_v = rows->v + (j / 2) * rows->uv_stride;
+
+        for (i = 0; i < width; i += 16) {
+            const __m256i p1 = _mm256_loadu_si256((const __m256i *)(curr_row + i * 4));
+            const __m256i p2 = _mm256_loadu_si256((const __m256i *)(curr_row + i * 4 + 32));
+            const __m256i p3 = _mm256_loadu_si256((const __m256i *)(next_row + i * 4));
+            const __m256i p4 = _mm256_loadu_si256((const __m256i *)(next_row + i * 4 + 32));
+            __m256i r1, g1, b1, r2, g2, b2, r3, g3, b3, r4, g4, b4;
+            __m256i y1, y2, y3, y4, r, g, b, u, v, y;
+
+            RGB2YUV_AVX2_UNPACK(p1, r1, g1, b1);
+            RGB2YUV_AVX2_UNPACK(p2, r2, g2, b2);
+            RGB2YUV_AVX2_UNPACK(p3, r3, g3, b3);
+            RGB2YUV_AVX2_UNPACK(p4, r4, g4, b4);
+
+            // The packs work within 128-bit lanes, so put the quadwords back in pixel order afterwards
+            y1 = RGB2YUV_AVX2_DOT(cvt->y, r1, g1, b1, y_offset);
+            y2 = RGB2YUV_AVX2_DOT(cvt->y, r2, g2, b2, y_offset);
+            y3 = RGB2YUV_AVX2_DOT(cvt->y, r3, g3, b3, y_offset);
+            y4 = RGB2YUV_AVX2_DOT(cvt->y, r4, g4, b4, y_offset);
+            y = _mm256_packus_epi16(_mm256_permute4x64_epi64(_mm256_packs_epi32(y1, y2), 0xD8),
+                                    _mm256_permute4x64_epi64(_mm256_packs_epi32(y3, y4), 0xD8));
+            y = _mm256_permute4x64_epi64(y, 0xD8);
+            _mm_storeu_si128((__m128i *)(plane_y1 + i), _mm256_castsi256_si128(y));
+            _mm_storeu_si128((__m128i *)(plane_y2 + i), _mm256_extracti128_si256(y, 1));
+
+            // Sum each 2x2 block: add the rows, then the horizontal neighbours
+            r = _mm256_permute4x64_epi64(_mm256_hadd_epi32(_mm256_add_epi32(r1, r3), _mm256_add_epi32(r2, r4)), 0xD8);
+            g = _mm256_permute4x64_epi64(_mm256_hadd_epi32(_mm256_add_epi32(g1, g3), _mm256_add_epi32(g2, g4)), 0xD8);
+            b = _mm256_permute4x64_epi64(_mm256_hadd_epi32(_mm256_add_epi32(b1, b3), _mm256_add_epi32(b2, b4)), 0xD8);
+            r = _mm256_srli_epi32(r, 2);
+            g = _mm256_srli_epi32(g, 2);
+            b = _mm256_srli_epi32(b, 2);
+            u = RGB2YUV_AVX2_DOT(cvt->u, r, g, b, uv_offset);
+            v = RGB2YUV_AVX2_DOT(cvt->v, r, g, b, uv_offset);
+            if (rows->uv_pixel_stride == 1) {
+                _mm_storel_epi64((__m128i *)(plane_u + i / 2), RGB2YUV_AVX2_PACK8(u));
+                _mm_storel_epi64((__m128i *)(plane_v + i / 2), RGB2YUV_AVX2_PACK8(v));
+            } else {
+                const __m128i u8 = RGB2YUV_AVX2_PACK8(u);
+                const __m128i v8 = RGB2YUV_AVX2_PACK8(v);
+                STORE_UV_INTERLEAVED(
+                    _mm_storeu_si128((__m128i *)(plane_u + i), _mm_unpacklo_epi8(u8, v8)),
+                    _mm_storeu_si128((__m128i *)(plane_v + i), _mm_unpacklo_epi8(v8, u8)));
             }
         }
+    }
+
+#undef RGB2YUV_AVX2_UNPACK
+#undef RGB2YUV_AVX2_DOT
+#undef RGB2YUV_AVX2_PACK8
+    return width;
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+static int SDL_ConvertPixels_XRGB8888_to_YUV420_NEON(const RGB2YUVRows *rows)
+{
+    const struct RGB2YUVFactors *cvt = rows->cvt;
+    const int width = (rows->width & ~7);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    int i, j;
+
+#define RGB2YUV_NEON_DOT(F, R, G, B, OFFSET)                                                  \
+    vaddq_s32(vcvtq_s32_f32(vaddq_f32(vaddq_f32(vaddq_f32(                                   \
+        vmulq_n_f32(vcvtq_f32_u32(R), F[0]), vmulq_n_f32(vcvtq_f32_u32(G), F[1])),           \
+        vmulq_n_f32(vcvtq_f32_u32(B), F[2])), half)), vdupq_n_s32(OFFSET))
+
+// Converts 8 pixels of one row to 8 Y values
+#define RGB2YUV_NEON_Y(R, G, B)                                                                                   \
+    vqmovun_s16(vcombine_s16(                                                                                     \
+        vqmovn_s32(RGB2YUV_NEON_DOT(cvt->y, vmovl_u16(vget_low_u16(R)), vmovl_u16(vget_low_u16(G)), vmovl_u16(vget_low_u16(B)), cvt->y_offset)), \
+        vqmovn_s32(RGB2YUV_NEON_DOT(cvt->y, vmovl_u16(vget_high_u16(R)), vmovl_u16(vget_high_u16(G)), vmovl_u16(vget_high_u16(B)), cvt->y_offset))))
+
+    for (j = 0; j < (rows->height & ~1); j += 2) {
+        const Uint8 *curr_row = rows->src + j * rows->src_pitch;
+        const Uint8 *next_row = curr_row + rows->src_pitch;
+        Uint8 *plane_y1 = rows->y + j * rows->y_stride;
+        Uint8 *plane_y2 = plane_y1 + rows->y_stride;
+        Uint8 *plane_u = rows->u + (j / 2) * rows->uv_stride;
+        Uint8 *plane_v = rows->v + (j / 2) * rows->uv_stride;
+
+        for (i = 0; i < width; i += 8) {
+            // XRGB8888 is B, G, R, X in memory
+            const uint8x8x4_t p1 = vld4_u8(curr_row + i * 4);
+            const uint8x8x4_t p2 = vld4_u8(next_row + i * 4);
+            uint32x4_t r, g, b;
+            uint8x8_t u, v;
+
+            vst1_u8(plane_y1 + i, RGB2YUV_NEON_Y(vmovl_u8(p1.val[2]), vmovl_u8(p1.val[1]), vmovl_u8(p1.val[0])));
+            vst1_u8(plane_y2 + i, RGB2YUV_NEON_Y(vmovl_u8(p2.val[2]), vmovl_u8(p2.val[1]), vmovl_u8(p2.val[0])));
+
+            // Sum each 2x2 block: add the rows, then the horizontal neighbours
+            r = vshrq_n_u32(vpaddlq_u16(vaddl_u8(p1.val[2], p2.val[2])), 2);
+            g = vshrq_n_u32(vpaddlq_u16(vaddl_u8(p1.val[1], p2.val[1])), 2);
+            b = vshrq_n_u32(vpaddlq_u16(vaddl_u8(p1.val[0], p2.val[0])), 2);
+            u = vqmovun_s16(vcombine_s16(vqmovn_s32(RGB2YUV_NEON_DOT(cvt->u, r, g, b, 128)), vdup_n_s16(0)));
+            v = vqmovun_s16(vcombine_s16(vqmovn_s32(RGB2YUV_NEON_DOT(cvt->v, r, g, b, 128)), vdup_n_s16(0)));
+            if (rows->uv_pixel_stride == 1) {
+                const Uint32 u32 = vget_lane_u32(vreinterpret_u32_u8(u), 0);
+                const Uint32 v32 = vget_lane_u32(vreinterpret_u32_u8(v), 0);
+                SDL_memcpy(plane_u + i / 2, &u32, sizeof(u32));
+                SDL_memcpy(plane_v + i / 2, &v32, sizeof(v32));
+            } else {
+                STORE_UV_INTERLEAVED(
+                    vst1_u8(plane_u + i, vzip_u8(u, v).val[0]),
+                    vst1_u8(plane_v + i, vzip_u8(v, u).val[0]));
+            }
+        }
+    }
+
+#undef RGB2YUV_NEON_DOT
+#undef RGB2YUV_NEON_Y
+    return width;
+}
+#endif // SDL_NEON_INTRINSICS
+
+#undef STORE_UV_INTERLEAVED
+
+static void SDL_ConvertPixels_XRGB8888_to_YUV420_Rows(const RGB2YUVRows *rows)
+{
+    RGB2YUVRows rest;
+    int converted = 0;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (!converted && SDL_HasAVX2()) {
+        converted = SDL_ConvertPixels_XRGB8888_to_YUV420_AVX2(rows);
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (!converted && SDL_HasSSE41()) {
+        converted = SDL_ConvertPixels_XRGB8888_to_YUV420_SSE41(rows);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (!converted && SDL_HasNEON()) {
+        converted = SDL_ConvertPixels_XRGB8888_to_YUV420_NEON(rows);
+    }
+#endif
+
+    if (converted == 0) {
+        SDL_ConvertPixels_XRGB8888_to_YUV420_std(rows);
+        return;
+    }
+
+    // Catch the right columns, if needed
+    if (converted < rows->width) {
+        rest = *rows;
+        rest.width -= converted;
+        rest.src += converted * 4;
+        rest.y += converted;
+        rest.u += (converted / 2) * rows->uv_pixel_stride;
+        rest.v += (converted / 2) * rows->uv_pixel_stride;
+        SDL_ConvertPixels_XRGB8888_to_YUV420_std(&rest);
+    }
+
+    // Catch the last line, if needed
+    if (rows->height & 0x1) {
+        const int last = rows->height - 1;
+        rest = *rows;
+        rest.width = converted;
+        rest.height = 1;
+        rest.src += last * rows->src_pitch;
+        rest.y += last * rows->y_stride;
+        rest.u += (last / 2) * rows->uv_stride;
+        rest.v += (last / 2) * rows->uv_stride;
+        SDL_ConvertPixels_XRGB8888_to_YUV420_std(&rest);
+    }
+}
+
+static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+{
+    const int width_half = width / 2;
+    const int width_remainder = (width & 0x1);
+    int i, j;
+
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+
+    switch (dst_format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+    {
+        RGB2YUVRows rows;
+
+        if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                          (const Uint8 **)&rows.y, (const Uint8 **)&rows.u, (const Uint8 **)&rows.v,
+                          &rows.y_stride, &rows.uv_stride)) {
+            return false;
+        }
+
+        rows.convert = SDL_ConvertPixels_XRGB8888_to_YUV420_Rows;
+        rows.cvt = cvt;
+        rows.width = width;
+        rows.height = height;
+        rows.src = (const Uint8 *)src;
+        rows.src_pitch = src_pitch;
+        rows.uv_pixel_stride = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
+        SDL_ConvertPixels_RGB_to_YUV_Rows(&rows);
     } break;
 
     case SDL_PIXELFORMAT_YUY2:
@@ -1007,17 +1676,14 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
     return true;
 }
 
-static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+static void SDL_ConvertPixels_XBGR2101010_to_P010_Rows(const RGB2YUVRows *rows)
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
+    const struct RGB2YUVFactors *cvt = rows->cvt;
+    const int width = rows->width;
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
 
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
-
 #define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
 #define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
 #define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
@@ -1051,71 +1717,49 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
     const Uint32 g = (p & 0x000ffc00) >> 10;            \
     const Uint32 b = (p & 0x3ff00000) >> 20;
 
-    const Uint8 *curr_row, *next_row;
-
-    Uint16 *plane_y;
-    Uint16 *plane_u;
-    Uint16 *plane_v;
-    Uint16 *plane_interleaved_uv;
-    Uint32 y_stride, uv_stride, y_skip, uv_skip;
-
-    if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                      (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                      &y_stride, &uv_stride)) {
-        return false;
-    }
-
-    y_stride /= sizeof(Uint16);
-    uv_stride /= sizeof(Uint16);
+    for (j = 0; j < rows->height; j += 2) {
+        const Uint8 *curr_row = rows->src + j * rows->src_pitch;
+        const Uint8 *next_row = curr_row + rows->src_pitch;
+        const int num_rows = SDL_min(rows->height - j, 2);
+        Uint16 *plane_interleaved_uv = (Uint16 *)(rows->u + (j / 2) * rows->uv_stride);
+        int k;
 
-    plane_interleaved_uv = (plane_y + height * y_stride);
-    y_skip = (y_stride - width);
-
-    curr_row = (const Uint8 *)src;
-
-    // Write Y plane
-    for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-            const Uint32 r = (p1 >>  0) & 0x03ff;
-            const Uint32 g = (p1 >> 10) & 0x03ff;
-            const Uint32 b = (p1 >> 20) & 0x03ff;
-            *plane_y++ = MAKE_Y(r, g, b);
+        // Write Y plane
+        for (k = 0; k < num_rows; ++k) {
+            const Uint32 *row = (const Uint32 *)(curr_row + k * rows->src_pitch);
+            Uint16 *plane_y = (Uint16 *)(rows->y + (j + k) * rows->y_stride);
+            for (i = 0; i < width; i++) {
+                const Uint32 p1 = row[i];
+                const Uint32 r = (p1 >>  0) & 0x03ff;
+                const Uint32 g = (p1 >> 10) & 0x03ff;
+                const Uint32 b = (p1 >> 20) & 0x03ff;
+                *plane_y++ = MAKE_Y(r, g, b);
+            }
         }
-        plane_y += y_skip;
-        curr_row += src_pitch;
-    }
 
-    curr_row = (const Uint8 *)src;
-    next_row = (const Uint8 *)src;
-    next_row += src_pitch;
-
-    uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-    for (j = 0; j < height_half; j++) {
-        for (i = 0; i < width_half; i++) {
-            READ_2x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_2x1_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        plane_interleaved_uv += uv_skip;
-        curr_row += src_pitch_x_2;
-        next_row += src_pitch_x_2;
-    }
-    if (height_remainder) {
-        for (i = 0; i < width_half; i++) {
-            READ_1x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_1x1_PIXEL;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
+        // Write UV plane, interleaved
+        if (num_rows == 2) {
+            for (i = 0; i < width_half; i++) {
+                READ_2x2_PIXELS;
+                *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            }
+            if (width_remainder) {
+                READ_2x1_PIXELS;
+                *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            }
+        } else {
+            for (i = 0; i < width_half; i++) {
+                READ_1x2_PIXELS;
+                *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            }
+            if (width_remainder) {
+                READ_1x1_PIXEL;
+                *plane_interleaved_uv++ = MAKE_U(r, g, b);
+                *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            }
         }
     }
 
@@ -1126,6 +1770,26 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
 #undef READ_2x1_PIXELS
 #undef READ_1x2_PIXELS
 #undef READ_1x1_PIXEL
+}
+
+static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+{
+    RGB2YUVRows rows;
+
+    if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                      (const Uint8 **)&rows.y, (const Uint8 **)&rows.u, (const Uint8 **)&rows.v,
+                      &rows.y_stride, &rows.uv_stride)) {
+        return false;
+    }
+
+    rows.convert = SDL_ConvertPixels_XBGR2101010_to_P010_Rows;
+    rows.cvt = &RGB2YUVFactorTables[yuv_type];
+    rows.width = width;
+    rows.height = height;
+    rows.src = (const Uint8 *)src;
+    rows.src_pitch = src_pitch;
+    rows.uv_pixel_stride = 2;
+    SDL_ConvertPixels_RGB_to_YUV_Rows(&rows);
     return true;
 }
 
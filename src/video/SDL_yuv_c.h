@@ -30,6 +30,10 @@ extern bool SDL_ConvertPixels_YUV_to_RGB(int width, int height, SDL_PixelFormat
 extern bool SDL_ConvertPixels_RGB_to_YUV(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch);
 extern bool SDL_ConvertPixels_YUV_to_YUV(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch);
 
+// Converts from separately addressed YUV planes, e.g. a sub-rectangle of a frame, split into bands of rows for large frames.
+// Returns false without converting anything if SDL_CanConvertYUVPlanesToRGB() would return false.
+extern bool SDL_CanConvertYUVPlanesToRGB(SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace);
+extern bool SDL_ConvertYUVPlanesToRGB(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, void *dst, int dst_pitch);
 
 extern bool SDL_CalculateYUVSize(SDL_PixelFormat format, int w, int h, size_t *size, size_t *pitch);
 
@@ -23,7 +23,14 @@
 #ifndef SDL_D3D12_H
 #define SDL_D3D12_H
 
-#if !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+/* The UWP project defines the Xbox platform macros too, but UWP apps use the
+ * desktop D3D12 API from the Windows SDK rather than the GDK one.
+ */
+#if (defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES)) && !defined(SDL_PLATFORM_WINRT)
+#define SDL_D3D12_XBOX 1
+#endif
+
+#if !defined(SDL_D3D12_XBOX)
 
 /* From the DirectX-Headers build system:
  * "MinGW has RPC headers which define old versions, and complain if D3D
@@ -55,7 +62,7 @@
  */
 #define D3D_CALL_RET(THIS, FUNC, ...) (THIS)->lpVtbl->FUNC((THIS), ##__VA_ARGS__)
 
-#else // !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#else // !defined(SDL_D3D12_XBOX)
 
 #if defined(SDL_PLATFORM_XBOXONE)
 #include <d3d12_x.h>
@@ -98,6 +105,6 @@
  */
 #define D3D_CALL_RET(THIS, FUNC, RETVAL, ...) *(RETVAL) = (THIS)->FUNC(__VA_ARGS__)
 
-#endif // !(defined(SDL_PLATFORM_XBOXONE) || defined(SDL_PLATFORM_XBOXSERIES))
+#endif // !defined(SDL_D3D12_XBOX)
 
 #endif // SDL_D3D12_H
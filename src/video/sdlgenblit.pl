@@ -639,6 +639,265 @@ __EOF__
 __EOF__
 }
 
+# The SIMD variants only cover the non-scaled 8888 modulate and blend
+# functions, and handle SDL_COPY_BLEND and SDL_COPY_BLEND_PREMULTIPLIED
+# themselves. Everything else, including the right column, goes through
+# the scalar function they are generated alongside.
+my @simd_isas = ( "AVX2", "NEON" );
+
+my %simd_guard = (
+    "AVX2" => "#ifdef SDL_AVX2_INTRINSICS",
+    "NEON" => "#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)",
+);
+
+my %simd_core = (
+    "AVX2" => <<'__EOF__',
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_MultDiv255_AVX2(__m256i a, __m256i b)
+{
+    __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(1));
+    x = _mm256_add_epi16(x, _mm256_srli_epi16(x, 8));
+    return _mm256_srli_epi16(x, 8);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blend8888_AVX2(__m256i s, __m256i d, int mode)
+{
+    const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+
+    if (mode == SDL_COPY_BLEND) {
+        s = SDL_MultDiv255_AVX2(s, _mm256_blend_epi16(a, _mm256_set1_epi16(255), 0x88));
+    }
+    return _mm256_add_epi16(SDL_MultDiv255_AVX2(d, _mm256_sub_epi16(_mm256_set1_epi16(255), a)), s);
+}
+
+/* Each byte of shuffle is the source byte for that destination byte, or
+   0x80 for none, src_alpha is or-ed in for sources without alpha and
+   dst_mask clears the X channel. The destination alpha channel is always
+   the high byte, and the results match MULT_DIV_255 exactly. */
+static void SDL_TARGETING("avx2") SDL_Blit8888_AVX2(SDL_BlitInfo *info, Uint32 shuffle, Uint32 src_alpha, Uint32 dst_mask, Uint32 modulate, bool blend, SDL_BlitFunc fallback)
+{
+    const int mode = blend ? (info->flags & SDL_COPY_BLEND_MASK) : 0;
+    const int width = info->dst_w & ~7;
+    const __m256i shuffle_mask = _mm256_add_epi32(_mm256_set1_epi32((int)shuffle),
+        _mm256_setr_epi32(0x00000000, 0x04040404, 0x08080808, 0x0C0C0C0C, 0x00000000, 0x04040404, 0x08080808, 0x0C0C0C0C));
+    const __m256i alpha_or = _mm256_set1_epi32((int)src_alpha);
+    const __m256i dst_and = _mm256_set1_epi32((int)dst_mask);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mod = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)modulate), zero);
+    int x, y;
+
+    if (blend && mode != SDL_COPY_BLEND && mode != SDL_COPY_BLEND_PREMULTIPLIED) {
+        fallback(info);
+        return;
+    }
+
+    if (width > 0) {
+        for (y = 0; y < info->dst_h; ++y) {
+            const Uint8 *src = info->src + y * info->src_pitch;
+            Uint8 *dst = info->dst + y * info->dst_pitch;
+
+            for (x = 0; x < width; x += 8) {
+                __m256i s = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)src), shuffle_mask), alpha_or);
+                __m256i s_lo = _mm256_unpacklo_epi8(s, zero);
+                __m256i s_hi = _mm256_unpackhi_epi8(s, zero);
+
+                if (modulate != 0xFFFFFFFF) {
+                    s_lo = SDL_MultDiv255_AVX2(s_lo, mod);
+                    s_hi = SDL_MultDiv255_AVX2(s_hi, mod);
+                }
+                if (blend) {
+                    const __m256i d = _mm256_loadu_si256((const __m256i *)dst);
+                    s_lo = SDL_Blend8888_AVX2(s_lo, _mm256_unpacklo_epi8(d, zero), mode);
+                    s_hi = SDL_Blend8888_AVX2(s_hi, _mm256_unpackhi_epi8(d, zero), mode);
+                }
+                _mm256_storeu_si256((__m256i *)dst, _mm256_and_si256(_mm256_packus_epi16(s_lo, s_hi), dst_and));
+                src += 32;
+                dst += 32;
+            }
+        }
+    }
+
+    if (width < info->dst_w) {
+        SDL_BlitInfo tail = *info;
+        tail.src += width * 4;
+        tail.dst += width * 4;
+        tail.src_w -= width;
+        tail.dst_w -= width;
+        fallback(&tail);
+    }
+}
+
+__EOF__
+    "NEON" => <<'__EOF__',
+static SDL_INLINE uint8x16_t SDL_MultDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b)), vdupq_n_u16(1));
+    uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(a), vget_high_u8(b)), vdupq_n_u16(1));
+    lo = vsraq_n_u16(lo, lo, 8);
+    hi = vsraq_n_u16(hi, hi, 8);
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+// Same parameters as SDL_Blit8888_AVX2(), working on 16 deinterleaved pixels at a time
+static void SDL_Blit8888_NEON(SDL_BlitInfo *info, Uint32 shuffle, Uint32 src_alpha, Uint32 dst_mask, Uint32 modulate, bool blend, SDL_BlitFunc fallback)
+{
+    const int mode = blend ? (info->flags & SDL_COPY_BLEND_MASK) : 0;
+    const int width = info->dst_w & ~15;
+    const int index0 = (int)(shuffle & 0x03);
+    const int index1 = (int)((shuffle >> 8) & 0x03);
+    const int index2 = (int)((shuffle >> 16) & 0x03);
+    const int index3 = (int)((shuffle >> 24) & 0x03);
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+    uint8x16x4_t mod;
+    int x, y, i;
+
+    if (blend && mode != SDL_COPY_BLEND && mode != SDL_COPY_BLEND_PREMULTIPLIED) {
+        fallback(info);
+        return;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        mod.val[i] = vdupq_n_u8((Uint8)(modulate >> (i * 8)));
+    }
+
+    if (width > 0) {
+        for (y = 0; y < info->dst_h; ++y) {
+            const Uint8 *src = info->src + y * info->src_pitch;
+            Uint8 *dst = info->dst + y * info->dst_pitch;
+
+            for (x = 0; x < width; x += 16) {
+                const uint8x16x4_t p = vld4q_u8(src);
+                uint8x16x4_t s;
+
+                s.val[0] = p.val[index0];
+                s.val[1] = p.val[index1];
+                s.val[2] = p.val[index2];
+                s.val[3] = src_alpha ? opaque : p.val[index3];
+
+                if (modulate != 0xFFFFFFFF) {
+                    for (i = 0; i < 4; ++i) {
+                        s.val[i] = SDL_MultDiv255_NEON(s.val[i], mod.val[i]);
+                    }
+                }
+                if (blend) {
+                    const uint8x16x4_t d = vld4q_u8(dst);
+                    const uint8x16_t a = s.val[3];
+                    const uint8x16_t inv_a = vmvnq_u8(a);
+
+                    for (i = 0; i < 4; ++i) {
+                        if (mode == SDL_COPY_BLEND && i < 3) {
+                            s.val[i] = SDL_MultDiv255_NEON(s.val[i], a);
+                        }
+                        s.val[i] = vqaddq_u8(SDL_MultDiv255_NEON(d.val[i], inv_a), s.val[i]);
+                    }
+                }
+                if (dst_mask != 0xFFFFFFFF) {
+                    s.val[3] = vdupq_n_u8(0);
+                }
+                vst4q_u8(dst, s);
+                src += 64;
+                dst += 64;
+            }
+        }
+    }
+
+    if (width < info->dst_w) {
+        SDL_BlitInfo tail = *info;
+        tail.src += width * 4;
+        tail.dst += width * 4;
+        tail.src_w -= width;
+        tail.dst_w -= width;
+        fallback(&tail);
+    }
+}
+
+__EOF__
+);
+
+# Byte offset of a channel within a little-endian 8888 pixel, or -1
+sub channel_byte
+{
+    my $format = shift;
+    my $channel = shift;
+    my $index = index(substr($format, 0, 4), $channel);
+
+    if ($index < 0) {
+        return -1;
+    }
+    return 3 - $index;
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $shuffle = 0;
+    my $src_alpha = "0x00000000";
+    my $dst_mask = "0xFFFFFFFF";
+    my @modulate_terms;
+
+    if ( channel_byte($dst, "A") != 3 && channel_byte($dst, "X") != 3 ) {
+        die "SIMD blitters need the alpha channel in the high byte of $dst";
+    }
+    for (my $k = 0; $k < 3; ++$k) {
+        my $channel = substr($dst, 3 - $k, 1);
+        $shuffle |= channel_byte($src, $channel) << ($k * 8);
+        unshift(@modulate_terms, ($k == 0) ? "modulate$channel" : "(modulate$channel << " . ($k * 8) . ")");
+    }
+    unshift(@modulate_terms, "(modulateA << 24)");
+    if ( $src =~ /A/ ) {
+        $shuffle |= channel_byte($src, "A") << 24;
+    } else {
+        $shuffle |= 0x80 << 24;
+        $src_alpha = "0xFF000000";
+    }
+    if ( $dst !~ /A/ ) {
+        $dst_mask = "0x00FFFFFF";
+    }
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, 0, 0, "_$isa(SDL_BlitInfo *info)\n");
+    print FILE "{\n";
+    if ( $modulate ) {
+        my $terms = join(" | ", @modulate_terms);
+        print FILE <<__EOF__;
+    const int flags = info->flags;
+    const Uint32 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint32 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint32 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const Uint32 modulate = $terms;
+
+__EOF__
+    }
+    my $modulate_arg = $modulate ? "modulate" : "0xFFFFFFFF";
+    my $blend_arg = $blend ? "true" : "false";
+    printf FILE "    SDL_Blit8888_$isa(info, 0x%08X, $src_alpha, $dst_mask, $modulate_arg, $blend_arg,", $shuffle;
+    output_copyfuncname("", $src, $dst, $modulate, $blend, 0, 0, ");\n");
+    print FILE "}\n\n";
+}
+
+sub output_simdfuncs
+{
+    foreach my $isa (@simd_isas) {
+        print FILE "$simd_guard{$isa}\n\n";
+        print FILE $simd_core{$isa};
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        if ( $modulate || $blend ) {
+                            output_simdfunc($isa, $src_formats[$i], $dst_formats[$j], $modulate, $blend);
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif\n\n";
+    }
+}
+
 sub output_copyfunc_h
 {
 }
@@ -673,7 +932,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -703,7 +961,15 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
+                            if ( !$scale ) {
+                                foreach my $isa (@simd_isas) {
+                                    print FILE "$simd_guard{$isa}\n";
+                                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_$isa,";
+                                    output_copyfuncname("", $src, $dst, $modulate, $blend, 0, 0, "_$isa },\n");
+                                    print FILE "#endif\n";
+                                }
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
@@ -752,5 +1018,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -2104,7 +2104,7 @@ typedef struct
    int    delta[17];   // old 'firstsymbol' - old 'firstcode'
 } stbi__huffman;
 
-typedef struct
+typedef struct stbi__jpeg /* SDL change */
 {
    stbi__context *s;
    stbi__huffman huff_dc[4];
@@ -2156,6 +2156,11 @@ typedef struct
    void (*idct_block_kernel)(stbi_uc *out, int out_stride, short data[64]);
    void (*YCbCr_to_RGB_kernel)(stbi_uc *out, const stbi_uc *y, const stbi_uc *pcb, const stbi_uc *pcr, int count, int step);
    stbi_uc *(*resample_row_hv_2_kernel)(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs);
+
+/* SDL change: let the caller provide the output buffer */
+   stbi_uc *output;
+   int output_w, output_h, output_pitch;
+/**/
 } stbi__jpeg;
 
 static int stbi__build_huffman(stbi__huffman *h, int *count)
@@ -3235,6 +3240,11 @@ static void stbi__jpeg_dequantize(short *data, stbi__uint16 *dequant)
       data[i] *= dequant[i];
 }
 
+/* SDL change: let the caller decode scans */
+#ifndef STBI_PARSE_ENTROPY_CODED_DATA
+#define STBI_PARSE_ENTROPY_CODED_DATA stbi__parse_entropy_coded_data
+#endif /**/
+
 static void stbi__jpeg_finish(stbi__jpeg *z)
 {
    if (z->progressive) {
@@ -3580,7 +3590,7 @@ static int stbi__decode_jpeg_image(stbi__jpeg *j)
    while (!stbi__EOI(m)) {
       if (stbi__SOS(m)) {
          if (!stbi__process_scan_header(j)) return 0;
-         if (!stbi__parse_entropy_coded_data(j)) return 0;
+         if (!STBI_PARSE_ENTROPY_CODED_DATA(j)) return 0; /* SDL change */
          if (j->marker == STBI__MARKER_none ) {
          j->marker = stbi__skip_jpeg_junk_at_end(j);
             // if we reach eof without hitting a marker, stbi__get_marker() below will fail and we'll eventually return 0
@@ -4111,6 +4121,16 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
 
          output = output_jpeg_nv12(z, nv12);
       } else {
+         if (z->output) { /* SDL change */
+            if (z->output_w != (int)z->s->img_x || z->output_h != (int)z->s->img_y) {
+               stbi__cleanup_jpeg(z);
+               return stbi__errpuc("badsize", "Unexpected size");
+            }
+            if (n != 4) {
+               stbi__cleanup_jpeg(z);
+               return stbi__errpuc("badoutput", "Unexpected output format");
+            }
+         } /**/
          for (k=0; k < decode_n; ++k) {
             stbi__resample *r = &res_comp[k];
 
@@ -4134,12 +4154,16 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
          }
 
          // can't error after this so, this is safe
-         output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+         if (z->output) { /* SDL change */
+            output = z->output;
+         } else {
+            output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+         }
          if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
 
          // now go ahead and resample
          for (j=0; j < z->s->img_y; ++j) {
-            stbi_uc *out = output + n * z->s->img_x * j;
+            stbi_uc *out = z->output ? output + (size_t)z->output_pitch * j : output + n * z->s->img_x * j; /* SDL change */
             for (k=0; k < decode_n; ++k) {
                stbi__resample *r = &res_comp[k];
                int y_bot = r->ystep >= (r->vs >> 1);
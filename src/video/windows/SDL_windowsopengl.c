@@ -24,6 +24,7 @@
 
 #ifdef SDL_PLATFORM_WINRT
 #include "..\winrt\SDL_winrtvideo_cpp.h"
+#include "../../core/winrt/SDL_winrtapp_common.h"
 #include "SDL_windowsopengl.h"
 
 /* Sets an error message based on GetLastError(). Always return -1. */
@@ -234,8 +235,33 @@ SDL_FunctionPointer WIN_GL_GetProcAddress(SDL_VideoDevice *_this, const char *pr
     return func;
 }
 
+#ifdef SDL_PLATFORM_WINRT
+HWND uwp_window_handle();
+
+// Returns the context left over from probing for extensions, if it's still there, the caller owns it.
+static HGLRC WIN_GL_TakeProbeContext(SDL_VideoDevice *_this)
+{
+    HGLRC hglrc = _this->gl_data->probe_context;
+    if (hglrc) {
+        ReleaseDC(uwp_window_handle(), _this->gl_data->probe_hdc);
+        _this->gl_data->probe_context = NULL;
+        _this->gl_data->probe_hdc = NULL;
+    }
+    return hglrc;
+}
+#endif
+
 void WIN_GL_UnloadLibrary(SDL_VideoDevice *_this)
 {
+#ifdef SDL_PLATFORM_WINRT
+    if (_this->gl_data) {
+        HGLRC hglrc = WIN_GL_TakeProbeContext(_this);
+        if (hglrc) {
+            _this->gl_data->wglDeleteContext(hglrc);
+        }
+    }
+#endif
+
     SDL_UnloadObject(_this->gl_config.dll_handle);
     _this->gl_config.dll_handle = NULL;
 
@@ -417,10 +443,6 @@ static bool HasExtension(const char *extension, const char *extensions)
     return false;
 }
 
-#ifdef SDL_PLATFORM_WINRT
-HWND uwp_window_handle();
-#endif
-
 void WIN_GL_InitExtensions(SDL_VideoDevice *_this)
 {
     /* *INDENT-OFF* */ // clang-format off
@@ -530,9 +552,13 @@ void WIN_GL_InitExtensions(SDL_VideoDevice *_this)
     }
 
     _this->gl_data->wglMakeCurrent(hdc, NULL);
+#ifdef SDL_PLATFORM_WINRT
+    // This is the app's window, so keep the context for WIN_GL_CreateContext()
+    _this->gl_data->probe_hdc = hdc;
+    _this->gl_data->probe_context = hglrc;
+#else
     _this->gl_data->wglDeleteContext(hglrc);
     ReleaseDC(hwnd, hdc);
-#ifndef SDL_PLATFORM_WINRT
     DestroyWindow(hwnd);
     WIN_PumpEvents(_this);
 #endif
@@ -551,6 +577,23 @@ static int WIN_GL_ChoosePixelFormatARB(SDL_VideoDevice *_this, int *iAttribs, fl
     int srgb = 0;
 
 #ifdef SDL_PLATFORM_WINRT
+    // Use the context from probing for extensions rather than making another one
+    if (_this->gl_data->probe_context) {
+        hdc = _this->gl_data->probe_hdc;
+        _this->gl_data->wglMakeCurrent(hdc, _this->gl_data->probe_context);
+        if (_this->gl_data->HAS_WGL_ARB_pixel_format) {
+            _this->gl_data->wglChoosePixelFormatARB(hdc, iAttribs, fAttribs,
+                                                    1, &pixel_format,
+                                                    &matching);
+
+            // Check whether we actually got an SRGB capable buffer
+            _this->gl_data->wglGetPixelFormatAttribivARB(hdc, pixel_format, 0, 1, &qAttrib, &srgb);
+            _this->gl_config.framebuffer_srgb_capable = srgb;
+        }
+        _this->gl_data->wglMakeCurrent(hdc, NULL);
+        return pixel_format;
+    }
+
     hwnd = uwp_window_handle();
 #else
     hwnd =
@@ -771,13 +814,25 @@ SDL_GLContext WIN_GL_CreateContext(SDL_VideoDevice *_this, SDL_Window *window)
         _this->gl_config.profile_mask == 0 &&
         _this->gl_config.flags == 0) {
         // Create legacy context
-        context = _this->gl_data->wglCreateContext(hdc);
+        context = NULL;
+#ifdef SDL_PLATFORM_WINRT
+        context = WIN_GL_TakeProbeContext(_this);
+#endif
+        if (!context) {
+            context = _this->gl_data->wglCreateContext(hdc);
+        }
         if (share_context != 0) {
             _this->gl_data->wglShareLists(share_context, context);
         }
     } else {
         PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB;
-        HGLRC temp_context = _this->gl_data->wglCreateContext(hdc);
+        HGLRC temp_context = NULL;
+#ifdef SDL_PLATFORM_WINRT
+        temp_context = WIN_GL_TakeProbeContext(_this);
+#endif
+        if (!temp_context) {
+            temp_context = _this->gl_data->wglCreateContext(hdc);
+        }
         if (!temp_context) {
             SDL_SetError("Could not create GL context");
             return NULL;
@@ -852,6 +907,10 @@ SDL_GLContext WIN_GL_CreateContext(SDL_VideoDevice *_this, SDL_Window *window)
         return NULL;
     }
 
+#ifdef SDL_PLATFORM_WINRT
+    WINRT_RecordStartupStage(WINRT_STARTUP_DEVICE_CREATED);
+#endif
+
     return (SDL_GLContext)context;
 }
 
@@ -916,6 +975,9 @@ bool WIN_GL_SwapWindow(SDL_VideoDevice *_this, SDL_Window *window)
     if (!SwapBuffers(hdc)) {
         return WIN_SetError("SwapBuffers()");
     }
+#ifdef SDL_PLATFORM_WINRT
+    WINRT_RecordStartupStage(WINRT_STARTUP_FIRST_PRESENT);
+#endif
     return true;
 }
 
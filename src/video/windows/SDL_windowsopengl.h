@@ -65,6 +65,14 @@ struct SDL_GLDriverData
     bool HAS_WGL_ARB_create_context_robustness;
     bool HAS_WGL_ARB_create_context_no_error;
 
+#ifdef SDL_PLATFORM_WINRT
+    /* The context created to probe for extensions is kept around and reused
+       as the first real context, since creating one is expensive on Xbox.
+     */
+    HDC probe_hdc;
+    HGLRC probe_context;
+#endif
+
     /* Max version of OpenGL ES context that can be created if the
        implementation supports WGL_EXT_create_context_es2_profile.
        major = minor = 0 when unsupported.
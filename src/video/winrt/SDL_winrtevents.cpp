@@ -60,6 +60,22 @@ void WINRT_PumpEvents(SDL_VideoDevice *_this)
 #endif
 }
 
+int WINRT_WaitEventTimeout(SDL_VideoDevice *_this, Sint64 timeoutNS)
+{
+    if (SDL_WinRTGlobalApp) {
+        return SDL_WinRTGlobalApp->WaitEvents(timeoutNS);
+    }
+    // XAML apps don't own the dispatcher, fall back to polling
+    return -1;
+}
+
+void WINRT_SendWakeupEvent(SDL_VideoDevice *_this, SDL_Window *window)
+{
+    if (SDL_WinRTGlobalApp) {
+        SDL_WinRTGlobalApp->SendWakeup();
+    }
+}
+
 // XAML Thread management
 
 enum SDL_XAMLAppThreadState
@@ -34,6 +34,8 @@ extern "C" {
 
 extern void WINRT_InitTouch(SDL_VideoDevice *_this);
 extern void WINRT_PumpEvents(SDL_VideoDevice *_this);
+extern int WINRT_WaitEventTimeout(SDL_VideoDevice *_this, Sint64 timeoutNS);
+extern void WINRT_SendWakeupEvent(SDL_VideoDevice *_this, SDL_Window *window);
 
 #ifdef __cplusplus
 }
@@ -56,6 +58,7 @@ extern Windows::Foundation::Point WINRT_TransformCursorPosition(SDL_Window *wind
 extern bool WINRT_GetSDLButtonForPointerPoint(Windows::UI::Input::PointerPoint ^ pt, Uint8 *button, Uint8 *pressed);
 extern void WINRT_ProcessPointerPressedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint);
 extern void WINRT_ProcessPointerMovedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint);
+extern void WINRT_ProcessPointerMovedEvents(SDL_Window *window, Windows::UI::Input::PointerPoint ^ currentPoint, Windows::Foundation::Collections::IVector<Windows::UI::Input::PointerPoint ^> ^ intermediatePoints);
 extern void WINRT_ProcessPointerReleasedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint);
 extern void WINRT_ProcessPointerEnteredEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint);
 extern void WINRT_ProcessPointerExitedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint);
@@ -0,0 +1,297 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifdef SDL_VIDEO_DRIVER_WINRT
+
+/* Window framebuffer support for SDL_GetWindowSurface().
+
+   The window surface is presented with its own CoreWindow swap chain, rather
+   than through a streaming texture in a full 2D renderer.  The surface pixels
+   are kept in system memory, and only the rectangles passed to
+   SDL_UpdateWindowSurfaceRects() are uploaded to a texture that holds the
+   whole frame, which is then copied to the back buffer on the GPU.
+ */
+
+// Windows includes
+#include <d3d11.h>
+#include <dxgi1_2.h>
+
+// SDL includes
+extern "C" {
+#include "../SDL_sysvideo.h"
+#include "../../core/windows/SDL_windows.h"
+}
+
+#include "SDL_winrtframebuffer.h"
+#include "SDL_winrtvideo_cpp.h"
+
+struct WINRT_Framebuffer
+{
+    ID3D11Device *device;
+    ID3D11DeviceContext *context;
+    IDXGISwapChain1 *swapChain;
+    ID3D11Texture2D *texture; // The whole frame, the flip model doesn't keep it in the back buffer
+    int w, h;
+    int pitch;
+    void *pixels;
+};
+
+static void WINRT_FreeFramebuffer(WINRT_Framebuffer *framebuffer)
+{
+    if (framebuffer->texture) {
+        framebuffer->texture->Release();
+    }
+    if (framebuffer->swapChain) {
+        framebuffer->swapChain->Release();
+    }
+    if (framebuffer->context) {
+        framebuffer->context->Release();
+    }
+    if (framebuffer->device) {
+        framebuffer->device->Release();
+    }
+    SDL_aligned_free(framebuffer->pixels);
+    SDL_free(framebuffer);
+}
+
+static bool WINRT_CreateFramebufferSwapChain(WINRT_Framebuffer *framebuffer, IUnknown *coreWindow)
+{
+    IDXGIDevice1 *dxgiDevice = NULL;
+    IDXGIAdapter *dxgiAdapter = NULL;
+    IDXGIFactory2 *dxgiFactory = NULL;
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
+    HRESULT result;
+
+    // Use the factory that created the device, so the swap chain is on the same adapter
+    result = framebuffer->device->QueryInterface(__uuidof(IDXGIDevice1), (void **)&dxgiDevice);
+    if (SUCCEEDED(result)) {
+        result = dxgiDevice->GetAdapter(&dxgiAdapter);
+    }
+    if (SUCCEEDED(result)) {
+        result = dxgiAdapter->GetParent(__uuidof(IDXGIFactory2), (void **)&dxgiFactory);
+    }
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT("Couldn't get the DXGI factory", result);
+        goto done;
+    }
+
+    SDL_zero(swapChainDesc);
+    swapChainDesc.Width = framebuffer->w;
+    swapChainDesc.Height = framebuffer->h;
+    swapChainDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    swapChainDesc.SampleDesc.Count = 1;
+    swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    swapChainDesc.BufferCount = 2; // The minimum for a flip model swap chain
+    swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
+    swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+    swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_IGNORE;
+    result = dxgiFactory->CreateSwapChainForCoreWindow(framebuffer->device, coreWindow, &swapChainDesc, NULL, &framebuffer->swapChain);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT("IDXGIFactory2::CreateSwapChainForCoreWindow", result);
+        goto done;
+    }
+
+    // Don't let presented frames queue up behind the application
+    dxgiDevice->SetMaximumFrameLatency(1);
+
+done:
+    if (dxgiFactory) {
+        dxgiFactory->Release();
+    }
+    if (dxgiAdapter) {
+        dxgiAdapter->Release();
+    }
+    if (dxgiDevice) {
+        dxgiDevice->Release();
+    }
+    return SUCCEEDED(result);
+}
+
+bool WINRT_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormat *format, void **pixels, int *pitch)
+{
+    SDL_WindowData *data = window->internal;
+    IUnknown *coreWindow = reinterpret_cast<IUnknown *>(data->coreWindow.Get());
+    WINRT_Framebuffer *framebuffer;
+    D3D11_TEXTURE2D_DESC textureDesc;
+    HRESULT result;
+    static const D3D_FEATURE_LEVEL featureLevels[] = {
+        D3D_FEATURE_LEVEL_11_1,
+        D3D_FEATURE_LEVEL_11_0,
+        D3D_FEATURE_LEVEL_10_1,
+        D3D_FEATURE_LEVEL_10_0,
+        D3D_FEATURE_LEVEL_9_3,
+        D3D_FEATURE_LEVEL_9_2,
+        D3D_FEATURE_LEVEL_9_1
+    };
+
+    // This is called again when the window is resized, so free the old framebuffer first
+    WINRT_DestroyWindowFramebuffer(_this, window);
+
+    if (!coreWindow) {
+        // With XAML, the window contents are in a SwapChainPanel that SDL doesn't have access to
+        return SDL_SetError("The window framebuffer requires a CoreWindow");
+    }
+
+    framebuffer = (WINRT_Framebuffer *)SDL_calloc(1, sizeof(*framebuffer));
+    if (!framebuffer) {
+        return false;
+    }
+
+    SDL_GetWindowSizeInPixels(window, &framebuffer->w, &framebuffer->h);
+    framebuffer->w = SDL_max(framebuffer->w, 1);
+    framebuffer->h = SDL_max(framebuffer->h, 1);
+    framebuffer->pitch = framebuffer->w * 4;
+    framebuffer->pixels = SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)framebuffer->pitch * framebuffer->h);
+    if (!framebuffer->pixels) {
+        goto error;
+    }
+
+    // BGRA support is needed for DXGI_FORMAT_B8G8R8A8_UNORM on feature level 9.x
+    result = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL,
+                               D3D11_CREATE_DEVICE_BGRA_SUPPORT | D3D11_CREATE_DEVICE_SINGLETHREADED,
+                               featureLevels, SDL_arraysize(featureLevels), D3D11_SDK_VERSION,
+                               &framebuffer->device, NULL, &framebuffer->context);
+    if (result == E_INVALIDARG) {
+        // Windows 8.0 doesn't know about feature level 11.1
+        result = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL,
+                                   D3D11_CREATE_DEVICE_BGRA_SUPPORT | D3D11_CREATE_DEVICE_SINGLETHREADED,
+                                   &featureLevels[1], SDL_arraysize(featureLevels) - 1, D3D11_SDK_VERSION,
+                                   &framebuffer->device, NULL, &framebuffer->context);
+    }
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT("D3D11CreateDevice", result);
+        goto error;
+    }
+
+    if (!WINRT_CreateFramebufferSwapChain(framebuffer, coreWindow)) {
+        goto error;
+    }
+
+    SDL_zero(textureDesc);
+    textureDesc.Width = framebuffer->w;
+    textureDesc.Height = framebuffer->h;
+    textureDesc.MipLevels = 1;
+    textureDesc.ArraySize = 1;
+    textureDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    textureDesc.SampleDesc.Count = 1;
+    textureDesc.Usage = D3D11_USAGE_DEFAULT;
+    result = framebuffer->device->CreateTexture2D(&textureDesc, NULL, &framebuffer->texture);
+    if (FAILED(result)) {
+        WIN_SetErrorFromHRESULT("ID3D11Device::CreateTexture2D", result);
+        goto error;
+    }
+
+    data->framebuffer = framebuffer;
+
+    *format = SDL_PIXELFORMAT_XRGB8888;
+    *pixels = framebuffer->pixels;
+    *pitch = framebuffer->pitch;
+    return true;
+
+error:
+    WINRT_FreeFramebuffer(framebuffer);
+    return false;
+}
+
+bool WINRT_SetWindowFramebufferVSync(SDL_VideoDevice *_this, SDL_Window *window, int vsync)
+{
+    SDL_WindowData *data = window->internal;
+
+    // DXGI can wait for up to 4 vertical blanks, but has no adaptive vsync for flip model swap chains
+    if (vsync < 0 || vsync > 4) {
+        return SDL_Unsupported();
+    }
+    data->framebuffer_vsync = vsync;
+    return true;
+}
+
+bool WINRT_GetWindowFramebufferVSync(SDL_VideoDevice *_this, SDL_Window *window, int *vsync)
+{
+    SDL_WindowData *data = window->internal;
+
+    if (vsync) {
+        *vsync = data->framebuffer_vsync;
+    }
+    return true;
+}
+
+bool WINRT_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, const SDL_Rect *rects, int numrects)
+{
+    SDL_WindowData *data = window->internal;
+    WINRT_Framebuffer *framebuffer = data->framebuffer;
+    const SDL_Rect bounds = { 0, 0, framebuffer ? framebuffer->w : 0, framebuffer ? framebuffer->h : 0 };
+    ID3D11Texture2D *backBuffer = NULL;
+    HRESULT result;
+    int i;
+
+    if (!framebuffer) {
+        return SDL_SetError("Missing window framebuffer");
+    }
+
+    // Only upload the parts of the frame that changed
+    for (i = 0; i < numrects; ++i) {
+        SDL_Rect rect;
+        D3D11_BOX box;
+
+        if (!SDL_GetRectIntersection(&rects[i], &bounds, &rect)) {
+            continue;
+        }
+        box.left = rect.x;
+        box.top = rect.y;
+        box.front = 0;
+        box.right = rect.x + rect.w;
+        box.bottom = rect.y + rect.h;
+        box.back = 1;
+        framebuffer->context->UpdateSubresource(framebuffer->texture, 0, &box,
+                                                (const Uint8 *)framebuffer->pixels + rect.y * framebuffer->pitch + rect.x * 4,
+                                                framebuffer->pitch, 0);
+    }
+
+    result = framebuffer->swapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void **)&backBuffer);
+    if (FAILED(result)) {
+        return WIN_SetErrorFromHRESULT("IDXGISwapChain1::GetBuffer", result);
+    }
+    framebuffer->context->CopyResource(backBuffer, framebuffer->texture);
+    backBuffer->Release();
+
+    result = framebuffer->swapChain->Present(data->framebuffer_vsync, 0);
+    if (result == DXGI_ERROR_DEVICE_REMOVED || result == DXGI_ERROR_DEVICE_RESET) {
+        // The surface will be recreated, with a new device, the next time it's requested
+        window->surface_valid = false;
+    }
+    if (FAILED(result)) {
+        return WIN_SetErrorFromHRESULT("IDXGISwapChain1::Present", result);
+    }
+    return true;
+}
+
+void WINRT_DestroyWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window)
+{
+    SDL_WindowData *data = window->internal;
+
+    if (data && data->framebuffer) {
+        WINRT_FreeFramebuffer(data->framebuffer);
+        data->framebuffer = NULL;
+    }
+}
+
+#endif // SDL_VIDEO_DRIVER_WINRT
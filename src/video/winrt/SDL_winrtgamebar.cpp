@@ -153,7 +153,7 @@ void WINRT_InitGameBar(SDL_VideoDevice *_this)
            Get a WinRT 'CoreDispatcher' that can be used to call back into the
            SDL thread.
         */
-        WINRT_MainThreadDispatcher = Windows::UI::Core::CoreWindow::GetForCurrentThread()->Dispatcher;
+        WINRT_MainThreadDispatcher = WINRT_GetCoreWindow()->Dispatcher;
         Windows::Foundation::EventHandler<Platform::Object ^> ^ handler =
             ref new Windows::Foundation::EventHandler<Platform::Object ^>(&WINRT_HandleGameBarIsInputRedirected_NonMainThread);
         __FIEventHandler_1_IInspectable *pHandler = reinterpret_cast<__FIEventHandler_1_IInspectable *>(handler);
@@ -134,7 +134,7 @@ void WINTRT_OnInputPaneHiding(Windows::UI::ViewManagement::InputPane ^ sender, W
 void WINTRT_InitialiseInputPaneEvents(SDL_VideoDevice *_this)
 {
     using namespace Windows::UI::ViewManagement;
-    InputPane ^ inputPane = InputPane::GetForCurrentView();
+    InputPane ^ inputPane = WINRT_GetInputPane();
     if (inputPane) {
         inputPane->Showing += ref new Windows::Foundation::TypedEventHandler<Windows::UI::ViewManagement::InputPane ^,
                                                                              Windows::UI::ViewManagement::InputPaneVisibilityEventArgs ^>(&WINTRT_OnInputPaneShowing);
@@ -151,7 +151,7 @@ bool WINRT_HasScreenKeyboardSupport(SDL_VideoDevice *_this)
 void WINRT_ShowScreenKeyboard(SDL_VideoDevice *_this, SDL_Window *window, SDL_PropertiesID props)
 {
     using namespace Windows::UI::ViewManagement;
-    InputPane ^ inputPane = InputPane::GetForCurrentView();
+    InputPane ^ inputPane = WINRT_GetInputPane();
     if (inputPane) {
         inputPane->TryShow();
     }
@@ -160,7 +160,7 @@ void WINRT_ShowScreenKeyboard(SDL_VideoDevice *_this, SDL_Window *window, SDL_Pr
 void WINRT_HideScreenKeyboard(SDL_VideoDevice *_this, SDL_Window *window)
 {
     using namespace Windows::UI::ViewManagement;
-    InputPane ^ inputPane = InputPane::GetForCurrentView();
+    InputPane ^ inputPane = WINRT_GetInputPane();
     if (inputPane) {
         inputPane->TryHide();
     }
@@ -169,7 +169,7 @@ void WINRT_HideScreenKeyboard(SDL_VideoDevice *_this, SDL_Window *window)
 bool WINRT_IsScreenKeyboardShown(SDL_VideoDevice *_this, SDL_Window *window)
 {
     using namespace Windows::UI::ViewManagement;
-    InputPane ^ inputPane = InputPane::GetForCurrentView();
+    InputPane ^ inputPane = WINRT_GetInputPane();
     if (inputPane) {
         switch (SDL_GetWinRTDeviceFamily()) {
         case SDL_WINRT_DEVICEFAMILY_XBOX:
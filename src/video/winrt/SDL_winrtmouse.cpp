@@ -149,11 +149,11 @@ static void WINRT_FreeCursor(SDL_Cursor *cursor)
 static bool WINRT_ShowCursor(SDL_Cursor *cursor)
 {
     // TODO, WinRT, XAML: make WINRT_ShowCursor work when XAML support is enabled.
-    if (!CoreWindow::GetForCurrentThread()) {
+    CoreWindow ^ coreWindow = WINRT_GetCoreWindow();
+    if (!coreWindow) {
         return true;
     }
 
-    CoreWindow ^ coreWindow = CoreWindow::GetForCurrentThread();
     if (cursor) {
         CoreCursor ^ *theCursor = (CoreCursor ^ *)cursor->internal;
         coreWindow->PointerCursor = *theCursor;
@@ -29,11 +29,17 @@ extern "C" {
 #include "SDL_winrtopengles.h"
 #include "../SDL_egl_c.h"
 }
+#include "../../core/winrt/SDL_winrtapp_common.h"
 
 // Windows includes
 #include <wrl/client.h>
+#include <d3d11.h>
+#include <dxgi.h>
 using namespace Windows::UI::Core;
 
+// [re]declare Windows GUIDs locally, to limit the amount of external lib(s) SDL has to link to
+static const GUID SDL_IID_IDXGIDevice1 = { 0x77db970f, 0x6276, 0x48ba, { 0xba, 0x28, 0x07, 0x01, 0x43, 0xb4, 0x39, 0x2c } };
+
 // ANGLE/WinRT constants
 static const int ANGLE_D3D_FEATURE_LEVEL_ANY = 0;
 #define EGL_PLATFORM_ANGLE_ANGLE                       0x3202
@@ -47,6 +53,84 @@ static const int ANGLE_D3D_FEATURE_LEVEL_ANY = 0;
 
 #define EGL_ANGLE_DISPLAY_ALLOW_RENDER_TO_BACK_BUFFER 0x320B
 
+// Current ANGLE constants
+#define EGL_DEVICE_EXT                           0x322C
+#define EGL_D3D11_DEVICE_ANGLE                   0x33A1
+#define EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE      0x33A4
+#define EGL_EXPERIMENTAL_PRESENT_PATH_FAST_ANGLE 0x33A9
+#define EGL_EXPERIMENTAL_PRESENT_PATH_COPY_ANGLE 0x33AA
+
+typedef EGLBoolean(EGLAPIENTRY *eglQueryDisplayAttribEXT_Function)(EGLDisplay, EGLint, EGLAttrib *);
+typedef EGLBoolean(EGLAPIENTRY *eglQueryDeviceAttribEXT_Function)(void *, EGLint, EGLAttrib *);
+
+// Gets the Direct3D 11 device ANGLE renders with, through EGL_EXT_device_query. Don't release it.
+static ID3D11Device *WINRT_GLES_GetD3D11Device(SDL_VideoDevice *_this)
+{
+    eglQueryDisplayAttribEXT_Function eglQueryDisplayAttribEXT = (eglQueryDisplayAttribEXT_Function)_this->egl_data->eglGetProcAddress("eglQueryDisplayAttribEXT");
+    eglQueryDeviceAttribEXT_Function eglQueryDeviceAttribEXT = (eglQueryDeviceAttribEXT_Function)_this->egl_data->eglGetProcAddress("eglQueryDeviceAttribEXT");
+    EGLAttrib device = 0;
+    EGLAttrib d3d11Device = 0;
+
+    if (!eglQueryDisplayAttribEXT || !eglQueryDeviceAttribEXT ||
+        !eglQueryDisplayAttribEXT(_this->egl_data->egl_display, EGL_DEVICE_EXT, &device) ||
+        !eglQueryDeviceAttribEXT((void *)device, EGL_D3D11_DEVICE_ANGLE, &d3d11Device)) {
+        return NULL;
+    }
+    return (ID3D11Device *)d3d11Device;
+}
+
+// Initializes the display with current ANGLE on Direct3D 11, which needs feature level 11_0 or better for this path.
+static bool WINRT_GLES_InitializeD3D11Display(SDL_VideoDevice *_this, eglGetPlatformDisplayEXT_Function eglGetPlatformDisplayEXT, bool invert_y)
+{
+    const EGLint displayAttributes[] = {
+        EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+        EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE,
+        EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE,
+        invert_y ? EGL_EXPERIMENTAL_PRESENT_PATH_FAST_ANGLE : EGL_EXPERIMENTAL_PRESENT_PATH_COPY_ANGLE,
+        EGL_PLATFORM_ANGLE_ENABLE_AUTOMATIC_TRIM_ANGLE,
+        EGL_TRUE,
+        EGL_NONE,
+    };
+
+    _this->egl_data->egl_display = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE, EGL_DEFAULT_DISPLAY, displayAttributes);
+    if (!_this->egl_data->egl_display) {
+        return false;
+    }
+
+    if (_this->egl_data->eglInitialize(_this->egl_data->egl_display, NULL, NULL) != EGL_TRUE) {
+        _this->egl_data->egl_display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    ID3D11Device *d3d11Device = WINRT_GLES_GetD3D11Device(_this);
+    if (!d3d11Device || d3d11Device->GetFeatureLevel() < D3D_FEATURE_LEVEL_11_0) {
+        // Either this is an older ANGLE, or older hardware, the legacy attributes cover both.
+        _this->egl_data->eglTerminate(_this->egl_data->egl_display);
+        _this->egl_data->egl_display = EGL_NO_DISPLAY;
+        return false;
+    }
+    return true;
+}
+
+static void WINRT_GLES_SetFrameLatency(SDL_VideoDevice *_this)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_WINRT_GLES_FRAME_LATENCY);
+    if (!hint || !*hint) {
+        return;
+    }
+
+    ID3D11Device *d3d11Device = WINRT_GLES_GetD3D11Device(_this);
+    if (!d3d11Device) {
+        return;
+    }
+
+    IDXGIDevice1 *dxgiDevice1 = NULL;
+    if (SUCCEEDED(d3d11Device->QueryInterface(SDL_IID_IDXGIDevice1, (void **)&dxgiDevice1))) {
+        dxgiDevice1->SetMaximumFrameLatency((UINT)SDL_clamp(SDL_atoi(hint), 1, 16));
+        dxgiDevice1->Release();
+    }
+}
+
 /*
  * SDL/EGL top-level implementation
  */
@@ -70,7 +154,7 @@ bool WINRT_GLES_LoadLibrary(SDL_VideoDevice *_this, const char *path)
 
         // Create an ANGLE/WinRT EGL-window
         // TODO, WinRT: check for XAML usage before accessing the CoreWindow, as not doing so could lead to a crash
-        CoreWindow ^ native_win = CoreWindow::GetForCurrentThread();
+        CoreWindow ^ native_win = WINRT_GetCoreWindow();
         Microsoft::WRL::ComPtr<IUnknown> cpp_win = reinterpret_cast<IUnknown *>(native_win);
         HRESULT result = CreateWinrtEglWindow(cpp_win, ANGLE_D3D_FEATURE_LEVEL_ANY, &(video_data->winrtEglWindow));
         if (FAILED(result)) {
@@ -143,6 +227,14 @@ bool WINRT_GLES_LoadLibrary(SDL_VideoDevice *_this, const char *path)
             return SDL_EGL_SetError("Could not retrieve ANGLE/WinRT display function(s)", "eglGetProcAddress");
         }
 
+        // Current ANGLE releases get the D3D11 path, older ones fall through to the MSOpenTech attributes below.
+        const bool invert_y = SDL_GetHintBoolean(SDL_HINT_WINRT_GLES_INVERT_Y, false);
+        if (WINRT_GLES_InitializeD3D11Display(_this, eglGetPlatformDisplayEXT, invert_y)) {
+            video_data->eglInvertY = invert_y && SDL_EGL_HasExtension(_this, SDL_EGL_DISPLAY_EXTENSION, "EGL_ANGLE_surface_orientation");
+            WINRT_GLES_SetFrameLatency(_this);
+            return true;
+        }
+
 #if !SDL_WINAPI_FAMILY_PHONE
         /* Try initializing EGL at D3D11 Feature Level 10_0+ (which is not
          * supported on WinPhone 8.x.
@@ -178,6 +270,8 @@ bool WINRT_GLES_LoadLibrary(SDL_VideoDevice *_this, const char *path)
                 }
             }
         }
+
+        WINRT_GLES_SetFrameLatency(_this);
     }
 
     return true;
@@ -193,15 +287,32 @@ void WINRT_GLES_UnloadLibrary(SDL_VideoDevice *_this)
         video_data->winrtEglWindow->Release();
         video_data->winrtEglWindow = nullptr;
     }
+    video_data->eglInvertY = false;
 
     // Perform the bulk of the unloading
     SDL_EGL_UnloadLibrary(_this);
 }
 
 extern "C" {
-SDL_EGL_CreateContext_impl(WINRT)
-SDL_EGL_SwapWindow_impl(WINRT)
 SDL_EGL_MakeCurrent_impl(WINRT)
 }
 
+SDL_GLContext WINRT_GLES_CreateContext(SDL_VideoDevice *_this, SDL_Window *window)
+{
+    SDL_GLContext context = SDL_EGL_CreateContext(_this, window->internal->egl_surface);
+    if (context) {
+        WINRT_RecordStartupStage(WINRT_STARTUP_DEVICE_CREATED);
+    }
+    return context;
+}
+
+bool WINRT_GLES_SwapWindow(SDL_VideoDevice *_this, SDL_Window *window)
+{
+    if (!SDL_EGL_SwapBuffers(_this, window->internal->egl_surface)) {
+        return false;
+    }
+    WINRT_RecordStartupStage(WINRT_STARTUP_FIRST_PRESENT);
+    return true;
+}
+
 #endif // SDL_VIDEO_DRIVER_WINRT && SDL_VIDEO_OPENGL_EGL
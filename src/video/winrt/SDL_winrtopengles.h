@@ -35,6 +35,10 @@
 #define WINRT_GLES_GetSwapInterval SDL_EGL_GetSwapInterval
 #define WINRT_GLES_DestroyContext   SDL_EGL_DestroyContext
 
+// EGL_ANGLE_surface_orientation
+#define EGL_SURFACE_ORIENTATION_ANGLE          0x33A8
+#define EGL_SURFACE_ORIENTATION_INVERT_Y_ANGLE 0x0002
+
 extern bool WINRT_GLES_LoadLibrary(SDL_VideoDevice *_this, const char *path);
 extern void WINRT_GLES_UnloadLibrary(SDL_VideoDevice *_this);
 extern SDL_GLContext WINRT_GLES_CreateContext(SDL_VideoDevice *_this, SDL_Window *window);
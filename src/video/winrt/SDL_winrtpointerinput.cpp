@@ -68,9 +68,9 @@ WINRT_TransformCursorPosition(SDL_Window *window,
         return rawPosition;
     }
 
-    // The CoreWindow can only be accessed on certain thread(s).
-    SDL_assert(CoreWindow::GetForCurrentThread() != nullptr);
-
+    /* The CoreWindow can only be accessed on certain thread(s), but the
+       Platform::Agile wrapper marshals calls to it as needed.
+    */
     CoreWindow ^ nativeWindow = windowData->coreWindow.Get();
     Windows::Foundation::Point outputPosition;
 
@@ -236,12 +236,8 @@ void WINRT_ProcessPointerPressedEvent(SDL_Window *window, Windows::UI::Input::Po
     }
 }
 
-void WINRT_ProcessPointerMovedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint)
+static void WINRT_ProcessPointerMovedEventAt(Uint64 timestamp, SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint)
 {
-    if (!window || WINRT_UsingRelativeMouseMode) {
-        return;
-    }
-
     Windows::Foundation::Point normalizedPoint = WINRT_TransformCursorPosition(window, pointerPoint->Position, NormalizeZeroToOne);
     Windows::Foundation::Point windowPoint = WINRT_TransformCursorPosition(window, pointerPoint->Position, TransformToSDLWindowSize);
 
@@ -249,12 +245,12 @@ void WINRT_ProcessPointerMovedEvent(SDL_Window *window, Windows::UI::Input::Poin
         // For some odd reason Moved events are used for multiple mouse buttons
         Uint8 button, pressed;
         if (WINRT_GetSDLButtonForPointerPoint(pointerPoint, &button, &pressed)) {
-            SDL_SendMouseButton(0, window, SDL_DEFAULT_MOUSE_ID, pressed, button);
+            SDL_SendMouseButton(timestamp, window, SDL_DEFAULT_MOUSE_ID, pressed, button);
         }
 
-        SDL_SendMouseMotion(0, window, SDL_DEFAULT_MOUSE_ID, false, windowPoint.X, windowPoint.Y);
+        SDL_SendMouseMotion(timestamp, window, SDL_DEFAULT_MOUSE_ID, false, windowPoint.X, windowPoint.Y);
     } else {
-        SDL_SendTouchMotion(0,
+        SDL_SendTouchMotion(timestamp,
             WINRT_TouchID,
             (SDL_FingerID)(pointerPoint->PointerId + 1),
             window,
@@ -264,6 +260,43 @@ void WINRT_ProcessPointerMovedEvent(SDL_Window *window, Windows::UI::Input::Poin
     }
 }
 
+void WINRT_ProcessPointerMovedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint)
+{
+    if (!window || WINRT_UsingRelativeMouseMode) {
+        return;
+    }
+
+    WINRT_ProcessPointerMovedEventAt(0, window, pointerPoint);
+}
+
+void WINRT_ProcessPointerMovedEvents(SDL_Window *window, Windows::UI::Input::PointerPoint ^ currentPoint, Windows::Foundation::Collections::IVector<Windows::UI::Input::PointerPoint ^> ^ intermediatePoints)
+{
+    if (!window || WINRT_UsingRelativeMouseMode) {
+        return;
+    }
+
+    if (!intermediatePoints || intermediatePoints->Size == 0) {
+        WINRT_ProcessPointerMovedEventAt(0, window, currentPoint);
+        return;
+    }
+
+    /* PointerPoint timestamps are in microseconds since boot.  Anchor the
+       current point to now, and keep the hardware spacing of the rest.
+    */
+    const Uint64 now = SDL_GetTicksNS();
+    const Uint64 currentTimestamp = currentPoint->Timestamp;
+
+    // The intermediate points are ordered newest first, and include the current point.
+    for (unsigned int i = intermediatePoints->Size; i-- > 0;) {
+        Windows::UI::Input::PointerPoint ^ pointerPoint = intermediatePoints->GetAt(i);
+        Uint64 age = 0;
+        if (pointerPoint->Timestamp < currentTimestamp) {
+            age = SDL_US_TO_NS(currentTimestamp - pointerPoint->Timestamp);
+        }
+        WINRT_ProcessPointerMovedEventAt((age < now) ? (now - age) : 0, window, pointerPoint);
+    }
+}
+
 void WINRT_ProcessPointerReleasedEvent(SDL_Window *window, Windows::UI::Input::PointerPoint ^ pointerPoint)
 {
     if (!window) {
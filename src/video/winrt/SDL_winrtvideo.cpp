@@ -60,9 +60,11 @@ extern "C" {
 #include "SDL_winrtmessagebox.h"
 }
 
+#include "../../core/winrt/SDL_winrtapp_common.h"
 #include "../../core/winrt/SDL_winrtapp_direct3d.h"
 #include "../../core/winrt/SDL_winrtapp_xaml.h"
 #include "SDL_winrtevents_c.h"
+#include "SDL_winrtframebuffer.h"
 #include "SDL_winrtgamebar_cpp.h"
 #include "SDL_winrtmouse_c.h"
 #include "SDL_winrtvideo_cpp.h"
@@ -70,6 +72,8 @@ extern "C" {
 // Initialization/Query functions
 static bool WINRT_VideoInit(SDL_VideoDevice *_this);
 static bool WINRT_InitModes(SDL_VideoDevice *_this);
+static void WINRT_RefreshDisplays(SDL_VideoDevice *_this);
+static bool WINRT_GetDisplayModes(SDL_VideoDevice *_this, SDL_VideoDisplay *display);
 static bool WINRT_SetDisplayMode(SDL_VideoDevice *_this, SDL_VideoDisplay *display, SDL_DisplayMode *mode);
 static void WINRT_VideoQuit(SDL_VideoDevice *_this);
 
@@ -101,6 +105,60 @@ static void WINRT_DeleteDevice(SDL_VideoDevice *device)
     SDL_free(device);
 }
 
+#if defined(SDL_VIDEO_OPENGL_EGL) || defined(SDL_VIDEO_OPENGL_WGL)
+static void WINRT_SetGLFunctions(SDL_VideoDevice *device, bool use_egl)
+{
+#ifdef SDL_VIDEO_OPENGL_EGL
+    if (use_egl) {
+        device->GL_LoadLibrary = WINRT_GLES_LoadLibrary;
+        device->GL_GetProcAddress = WINRT_GLES_GetProcAddress;
+        device->GL_UnloadLibrary = WINRT_GLES_UnloadLibrary;
+        device->GL_CreateContext = WINRT_GLES_CreateContext;
+        device->GL_MakeCurrent = WINRT_GLES_MakeCurrent;
+        device->GL_SetSwapInterval = WINRT_GLES_SetSwapInterval;
+        device->GL_GetSwapInterval = WINRT_GLES_GetSwapInterval;
+        device->GL_SwapWindow = WINRT_GLES_SwapWindow;
+        device->GL_DestroyContext = WINRT_GLES_DestroyContext;
+        return;
+    }
+#endif
+#ifdef SDL_VIDEO_OPENGL_WGL
+    device->GL_LoadLibrary = WIN_GL_LoadLibrary;
+    device->GL_GetProcAddress = WIN_GL_GetProcAddress;
+    device->GL_UnloadLibrary = WIN_GL_UnloadLibrary;
+    device->GL_CreateContext = WIN_GL_CreateContext;
+    device->GL_MakeCurrent = WIN_GL_MakeCurrent;
+    device->GL_SetSwapInterval = WIN_GL_SetSwapInterval;
+    device->GL_GetSwapInterval = WIN_GL_GetSwapInterval;
+    device->GL_SwapWindow = WIN_GL_SwapWindow;
+    device->GL_DestroyContext = WIN_GL_DestroyContext;
+#endif
+}
+#endif
+
+#if defined(SDL_VIDEO_OPENGL_EGL) && defined(SDL_VIDEO_OPENGL_WGL)
+/* OpenGL ES goes to ANGLE, everything else to the WGL layer.  The library is
+   loaded before the window is created, so this also decides which kind of
+   surface the window gets.
+*/
+static bool WINRT_GL_LoadLibrary(SDL_VideoDevice *_this, const char *path)
+{
+    if (_this->gl_config.profile_mask == SDL_GL_CONTEXT_PROFILE_ES || SDL_GetHintBoolean(SDL_HINT_VIDEO_FORCE_EGL, false)) {
+        WINRT_SetGLFunctions(_this, true);
+        _this->GL_LoadLibrary = WINRT_GL_LoadLibrary;
+        if (WINRT_GLES_LoadLibrary(_this, path)) {
+            return true;
+        }
+        // No usable ANGLE, the WGL layer can still create ES contexts.
+        WINRT_GLES_UnloadLibrary(_this);
+    }
+
+    WINRT_SetGLFunctions(_this, false);
+    _this->GL_LoadLibrary = WINRT_GL_LoadLibrary;
+    return WIN_GL_LoadLibrary(_this, path);
+}
+#endif
+
 static SDL_VideoDevice *WINRT_CreateDevice(void)
 {
     SDL_VideoDevice *device;
@@ -126,8 +184,20 @@ static SDL_VideoDevice *WINRT_CreateDevice(void)
     device->SetWindowSize = WINRT_SetWindowSize;
     device->SetWindowFullscreen = WINRT_SetWindowFullscreen;
     device->DestroyWindow = WINRT_DestroyWindow;
+    if (!WINRT_XAMLWasEnabled) {
+        // With XAML, SDL doesn't own the swap chain, so the window surface goes through the renderer
+        device->CreateWindowFramebuffer = WINRT_CreateWindowFramebuffer;
+        device->SetWindowFramebufferVSync = WINRT_SetWindowFramebufferVSync;
+        device->GetWindowFramebufferVSync = WINRT_GetWindowFramebufferVSync;
+        device->UpdateWindowFramebuffer = WINRT_UpdateWindowFramebuffer;
+        device->DestroyWindowFramebuffer = WINRT_DestroyWindowFramebuffer;
+    }
+    device->RefreshDisplays = WINRT_RefreshDisplays;
+    device->GetDisplayModes = WINRT_GetDisplayModes;
     device->SetDisplayMode = WINRT_SetDisplayMode;
     device->PumpEvents = WINRT_PumpEvents;
+    device->WaitEventTimeout = WINRT_WaitEventTimeout;
+    device->SendWakeupEvent = WINRT_SendWakeupEvent;
     device->SuspendScreenSaver = WINRT_SuspendScreenSaver;
 
 #if NTDDI_VERSION >= NTDDI_WIN10
@@ -139,27 +209,13 @@ static SDL_VideoDevice *WINRT_CreateDevice(void)
     WINTRT_InitialiseInputPaneEvents(device);
 #endif
 
-#ifdef SDL_VIDEO_OPENGL_EGL
-    device->GL_LoadLibrary = WINRT_GLES_LoadLibrary;
-    device->GL_GetProcAddress = WINRT_GLES_GetProcAddress;
-    device->GL_UnloadLibrary = WINRT_GLES_UnloadLibrary;
-    device->GL_CreateContext = WINRT_GLES_CreateContext;
-    device->GL_MakeCurrent = WINRT_GLES_MakeCurrent;
-    device->GL_SetSwapInterval = WINRT_GLES_SetSwapInterval;
-    device->GL_GetSwapInterval = WINRT_GLES_GetSwapInterval;
-    device->GL_SwapWindow = WINRT_GLES_SwapWindow;
-    device->GL_DestroyContext = WINRT_GLES_DestroyContext;
-#elif SDL_VIDEO_OPENGL_WGL
-    /* Use EGL based functions */
-    device->GL_LoadLibrary = WIN_GL_LoadLibrary;
-    device->GL_GetProcAddress = WIN_GL_GetProcAddress;
-    device->GL_UnloadLibrary = WIN_GL_UnloadLibrary;
-    device->GL_CreateContext = WIN_GL_CreateContext;
-    device->GL_MakeCurrent = WIN_GL_MakeCurrent;
-    device->GL_SetSwapInterval = WIN_GL_SetSwapInterval;
-    device->GL_GetSwapInterval = WIN_GL_GetSwapInterval;
-    device->GL_SwapWindow = WIN_GL_SwapWindow;
-    device->GL_DestroyContext = WIN_GL_DestroyContext;
+#if defined(SDL_VIDEO_OPENGL_EGL) && defined(SDL_VIDEO_OPENGL_WGL)
+    WINRT_SetGLFunctions(device, false);
+    device->GL_LoadLibrary = WINRT_GL_LoadLibrary;
+#elif defined(SDL_VIDEO_OPENGL_EGL)
+    WINRT_SetGLFunctions(device, true);
+#elif defined(SDL_VIDEO_OPENGL_WGL)
+    WINRT_SetGLFunctions(device, false);
 #endif
     device->free = WINRT_DeleteDevice;
 
@@ -235,6 +291,9 @@ static void SDLCALL WINRT_SetDisplayOrientationsPreference(void *userdata, const
 bool WINRT_VideoInit(SDL_VideoDevice *_this)
 {
     SDL_VideoData *internal = _this->internal;
+
+    WINRT_RecordStartupStage(WINRT_STARTUP_VIDEO_INIT);
+
     if (!WINRT_InitModes(_this)) {
         return false;
     }
@@ -284,19 +343,146 @@ static void WINRT_DXGIModeToSDLDisplayMode(const DXGI_MODE_DESC *dxgiMode, SDL_D
     sdlMode->format = D3D11_DXGIFormatToSDLPixelFormat(dxgiMode->Format);
 }
 
-static bool WINRT_AddDisplaysForOutput(SDL_VideoDevice *_this, IDXGIAdapter1 *dxgiAdapter1, int outputIndex)
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+static void WINRT_HdmiModeToSDLDisplayMode(Windows::Graphics::Display::Core::HdmiDisplayMode ^ hdmiMode, SDL_DisplayMode *sdlMode)
+{
+    SDL_zerop(sdlMode);
+    sdlMode->w = (int)hdmiMode->ResolutionWidthInRawPixels;
+    sdlMode->h = (int)hdmiMode->ResolutionHeightInRawPixels;
+    SDL_CalculateFraction((float)hdmiMode->RefreshRate, &sdlMode->refresh_rate_numerator, &sdlMode->refresh_rate_denominator);
+    sdlMode->format = D3D11_DXGIFormatToSDLPixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM);
+}
+
+static void WINRT_AddHdmiDisplayModes(SDL_VideoDisplay *display)
+{
+    Windows::Graphics::Display::Core::HdmiDisplayInformation ^ hdmiInfo = WINRT_GetHdmiDisplayInformation();
+    if (!hdmiInfo) {
+        return;
+    }
+
+    try {
+        for (Windows::Graphics::Display::Core::HdmiDisplayMode ^ hdmiMode : hdmiInfo->GetSupportedDisplayModes()) {
+            // Stereo modes can't be presented to with a regular swap chain
+            if (hdmiMode->StereoEnabled) {
+                continue;
+            }
+            SDL_DisplayMode sdlMode;
+            WINRT_HdmiModeToSDLDisplayMode(hdmiMode, &sdlMode);
+            SDL_AddFullscreenDisplayMode(display, &sdlMode);
+        }
+    } catch (Platform::Exception ^) {
+        // Not every Xbox configuration exposes the mode list, keep the DXGI modes
+    }
+}
+
+/* Finds the HDMI mode that matches an SDL mode, preferring ones that keep
+   the current bit depth and color space, so switching refresh rates doesn't
+   also toggle HDR.
+*/
+static Windows::Graphics::Display::Core::HdmiDisplayMode ^ WINRT_FindHdmiDisplayMode(Windows::Graphics::Display::Core::HdmiDisplayInformation ^ hdmiInfo, const SDL_DisplayMode *mode)
+{
+    Windows::Graphics::Display::Core::HdmiDisplayMode ^ current = hdmiInfo->GetCurrentDisplayMode();
+    Windows::Graphics::Display::Core::HdmiDisplayMode ^ match = nullptr;
+
+    for (Windows::Graphics::Display::Core::HdmiDisplayMode ^ hdmiMode : hdmiInfo->GetSupportedDisplayModes()) {
+        if (hdmiMode->StereoEnabled ||
+            (int)hdmiMode->ResolutionWidthInRawPixels != mode->w ||
+            (int)hdmiMode->ResolutionHeightInRawPixels != mode->h ||
+            SDL_fabs(hdmiMode->RefreshRate - mode->refresh_rate) > 0.05) {
+            continue;
+        }
+        if (current &&
+            hdmiMode->BitsPerPixel == current->BitsPerPixel &&
+            hdmiMode->ColorSpace == current->ColorSpace) {
+            return hdmiMode;
+        }
+        if (!match) {
+            match = hdmiMode;
+        }
+    }
+    return match;
+}
+#endif // SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+
+/* Enumerating DXGI adapters and outputs is slow, especially on multi-GPU
+   systems, so what's found is cached for the life of the process and reused
+   when video is reinitialized.  Mode lists are only read when the app first
+   asks for them.  The cache is rebuilt when the display configuration changes,
+   either on a DisplayContentsInvalidated notification, or when the DXGI
+   factory it was built from stops being current.
+*/
+typedef struct WINRT_CachedOutput
+{
+    LUID adapterLuid;
+    int outputIndex;
+    char *name;
+    SDL_DisplayMode desktop_mode;
+    bool has_mode_list;  // false for displays that DXGI can't report modes for
+    bool workaround;     // the DXGI display-detection workaround, see WINRT_CacheOutputsForAdapter()
+    SDL_DisplayMode *modes;  // NULL until the modes are first requested
+    int num_modes;
+} WINRT_CachedOutput;
+
+static IDXGIFactory2 *WINRT_displayCacheFactory = NULL;
+static WINRT_CachedOutput *WINRT_cachedOutputs = NULL;
+static int WINRT_numCachedOutputs = 0;
+static SDL_AtomicInt WINRT_displayCacheInvalidated;
+
+void WINRT_InvalidateDisplayCache(void)
+{
+    // This comes from the UI thread, the cache itself is only touched by the video thread.
+    SDL_SetAtomicInt(&WINRT_displayCacheInvalidated, 1);
+}
+
+static void WINRT_FreeDisplayCache(void)
+{
+    for (int i = 0; i < WINRT_numCachedOutputs; ++i) {
+        SDL_free(WINRT_cachedOutputs[i].name);
+        SDL_free(WINRT_cachedOutputs[i].modes);
+    }
+    SDL_free(WINRT_cachedOutputs);
+    WINRT_cachedOutputs = NULL;
+    WINRT_numCachedOutputs = 0;
+
+    if (WINRT_displayCacheFactory) {
+        WINRT_displayCacheFactory->Release();
+        WINRT_displayCacheFactory = NULL;
+    }
+}
+
+static WINRT_CachedOutput *WINRT_AddCachedOutput(void)
+{
+    WINRT_CachedOutput *outputs = (WINRT_CachedOutput *)SDL_realloc(WINRT_cachedOutputs, (WINRT_numCachedOutputs + 1) * sizeof(*outputs));
+    if (!outputs) {
+        return NULL;
+    }
+    WINRT_cachedOutputs = outputs;
+
+    WINRT_CachedOutput *output = &outputs[WINRT_numCachedOutputs++];
+    SDL_zerop(output);
+    return output;
+}
+
+static WINRT_CachedOutput *WINRT_FindCachedOutput(const SDL_DisplayData *data)
+{
+    for (int i = 0; i < WINRT_numCachedOutputs; ++i) {
+        WINRT_CachedOutput *output = &WINRT_cachedOutputs[i];
+        if (SDL_memcmp(&output->adapterLuid, &data->adapterLuid, sizeof(LUID)) == 0 && output->outputIndex == data->outputIndex) {
+            return output;
+        }
+    }
+    return NULL;
+}
+
+static bool WINRT_CacheOutput(IDXGIAdapter1 *dxgiAdapter1, const LUID *adapterLuid, int outputIndex)
 {
     HRESULT hr;
     IDXGIOutput *dxgiOutput = NULL;
     DXGI_OUTPUT_DESC dxgiOutputDesc;
-    SDL_VideoDisplay display;
-    UINT numModes;
-    DXGI_MODE_DESC *dxgiModes = NULL;
+    WINRT_CachedOutput *output;
     bool result = false;
     DXGI_MODE_DESC modeToMatch, closestMatch;
 
-    SDL_zero(display);
-
     hr = dxgiAdapter1->EnumOutputs(outputIndex, &dxgiOutput);
     if (FAILED(hr)) {
         if (hr != DXGI_ERROR_NOT_FOUND) {
@@ -316,6 +502,18 @@ static bool WINRT_AddDisplaysForOutput(SDL_VideoDevice *_this, IDXGIAdapter1 *dx
     modeToMatch.Width = (dxgiOutputDesc.DesktopCoordinates.right - dxgiOutputDesc.DesktopCoordinates.left);
     modeToMatch.Height = (dxgiOutputDesc.DesktopCoordinates.bottom - dxgiOutputDesc.DesktopCoordinates.top);
     hr = dxgiOutput->FindClosestMatchingMode(&modeToMatch, &closestMatch, NULL);
+    if (FAILED(hr) && hr != DXGI_ERROR_NOT_CURRENTLY_AVAILABLE) {
+        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::FindClosestMatchingMode failed", hr);
+        goto done;
+    }
+
+    output = WINRT_AddCachedOutput();
+    if (!output) {
+        goto done;
+    }
+    output->adapterLuid = *adapterLuid;
+    output->outputIndex = outputIndex;
+
     if (hr == DXGI_ERROR_NOT_CURRENTLY_AVAILABLE) {
         /* DXGI_ERROR_NOT_CURRENTLY_AVAILABLE gets returned by IDXGIOutput::FindClosestMatchingMode
            when running under the Windows Simulator, which uses Remote Desktop (formerly known as Terminal
@@ -325,67 +523,30 @@ static bool WINRT_AddDisplaysForOutput(SDL_VideoDevice *_this, IDXGIAdapter1 *dx
 
            In this case, just add an SDL display mode, with approximated values.
         */
-        SDL_DisplayMode mode;
-        SDL_zero(mode);
-        display.name = SDL_strdup("Windows Simulator / Terminal Services Display");
-        mode.w = (dxgiOutputDesc.DesktopCoordinates.right - dxgiOutputDesc.DesktopCoordinates.left);
-        mode.h = (dxgiOutputDesc.DesktopCoordinates.bottom - dxgiOutputDesc.DesktopCoordinates.top);
-        mode.format = D3D11_DXGIFormatToSDLPixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM);
-        display.desktop_mode = mode;
-    } else if (FAILED(hr)) {
-        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::FindClosestMatchingMode failed", hr);
-        goto done;
+        output->name = SDL_strdup("Windows Simulator / Terminal Services Display");
+        output->desktop_mode.w = (dxgiOutputDesc.DesktopCoordinates.right - dxgiOutputDesc.DesktopCoordinates.left);
+        output->desktop_mode.h = (dxgiOutputDesc.DesktopCoordinates.bottom - dxgiOutputDesc.DesktopCoordinates.top);
+        output->desktop_mode.format = D3D11_DXGIFormatToSDLPixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM);
     } else {
-        display.name = WIN_StringToUTF8W(dxgiOutputDesc.DeviceName);
-        WINRT_DXGIModeToSDLDisplayMode(&closestMatch, &display.desktop_mode);
-
-        hr = dxgiOutput->GetDisplayModeList(DXGI_FORMAT_B8G8R8A8_UNORM, 0, &numModes, NULL);
-        if (FAILED(hr)) {
-            WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::GetDisplayModeList [get mode list size] failed", hr);
-            goto done;
-        }
-
-        dxgiModes = (DXGI_MODE_DESC *)SDL_calloc(numModes, sizeof(DXGI_MODE_DESC));
-        if (!dxgiModes) {
-            goto done;
-        }
-
-        hr = dxgiOutput->GetDisplayModeList(DXGI_FORMAT_B8G8R8A8_UNORM, 0, &numModes, dxgiModes);
-        if (FAILED(hr)) {
-            WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::GetDisplayModeList [get mode contents] failed", hr);
-            goto done;
-        }
-
-        for (UINT i = 0; i < numModes; ++i) {
-            SDL_DisplayMode sdlMode;
-            WINRT_DXGIModeToSDLDisplayMode(&dxgiModes[i], &sdlMode);
-            SDL_AddFullscreenDisplayMode(&display, &sdlMode);
-        }
-    }
-
-    if (SDL_AddVideoDisplay(&display, false) == 0) {
-        goto done;
+        output->name = WIN_StringToUTF8W(dxgiOutputDesc.DeviceName);
+        WINRT_DXGIModeToSDLDisplayMode(&closestMatch, &output->desktop_mode);
+        output->has_mode_list = true;
     }
 
     result = true;
 
 done:
-    if (dxgiModes) {
-        SDL_free(dxgiModes);
-    }
     if (dxgiOutput) {
         dxgiOutput->Release();
     }
-    if (display.name) {
-        SDL_free(display.name);
-    }
     return result;
 }
 
-static bool WINRT_AddDisplaysForAdapter(SDL_VideoDevice *_this, IDXGIFactory2 *dxgiFactory2, int adapterIndex)
+static bool WINRT_CacheOutputsForAdapter(IDXGIFactory2 *dxgiFactory2, int adapterIndex)
 {
     HRESULT hr;
     IDXGIAdapter1 *dxgiAdapter1;
+    DXGI_ADAPTER_DESC1 dxgiAdapterDesc;
 
     hr = dxgiFactory2->EnumAdapters1(adapterIndex, &dxgiAdapter1);
     if (FAILED(hr)) {
@@ -395,8 +556,14 @@ static bool WINRT_AddDisplaysForAdapter(SDL_VideoDevice *_this, IDXGIFactory2 *d
         return false;
     }
 
+    hr = dxgiAdapter1->GetDesc1(&dxgiAdapterDesc);
+    if (FAILED(hr)) {
+        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIAdapter1::GetDesc1() failed", hr);
+        SDL_zero(dxgiAdapterDesc);
+    }
+
     for (int outputIndex = 0;; ++outputIndex) {
-        if (!WINRT_AddDisplaysForOutput(_this, dxgiAdapter1, outputIndex)) {
+        if (!WINRT_CacheOutput(dxgiAdapter1, &dxgiAdapterDesc.AdapterLuid, outputIndex)) {
             /* HACK: The Windows App Certification Kit 10.0 can fail, when
                running the Store Apps' test, "Direct3D Feature Test".  The
                certification kit's error is:
@@ -410,57 +577,234 @@ static bool WINRT_AddDisplaysForAdapter(SDL_VideoDevice *_this, IDXGIFactory2 *d
                the Windows App Certification Kit, or possibly in SDL/WinRT's
                display detection code.  Either way, try to detect when this
                happens, and use a hackish means to create a reasonable-as-possible
-               'display mode'.  -- DavidL
+               'display mode'.  The size is looked up when the display is added,
+               see WINRT_AddCachedDisplay().  -- DavidL
             */
             if (adapterIndex == 0 && outputIndex == 0) {
-                SDL_VideoDisplay display;
-                SDL_DisplayMode mode;
+                WINRT_CachedOutput *output = WINRT_AddCachedOutput();
+                if (!output) {
+                    dxgiAdapter1->Release();
+                    return false;
+                }
+                output->adapterLuid = dxgiAdapterDesc.AdapterLuid;
+                output->name = SDL_strdup("DXGI Display-detection Workaround");
+                output->workaround = true;
+            }
+
+            break;
+        }
+    }
+
+    dxgiAdapter1->Release();
+    return true;
+}
+
+// Makes sure the cache matches the current display configuration, returns false if DXGI isn't available.
+static bool WINRT_UpdateDisplayCache(void)
+{
+    HRESULT hr;
+
+    if (WINRT_displayCacheFactory) {
+        if (!SDL_GetAtomicInt(&WINRT_displayCacheInvalidated) && WINRT_displayCacheFactory->IsCurrent()) {
+            return true;
+        }
+        WINRT_FreeDisplayCache();
+    }
+    SDL_SetAtomicInt(&WINRT_displayCacheInvalidated, 0);
+
+    hr = CreateDXGIFactory1(SDL_IID_IDXGIFactory2, (void **)&WINRT_displayCacheFactory);
+    if (FAILED(hr)) {
+        WINRT_displayCacheFactory = NULL;
+        return WIN_SetErrorFromHRESULT(__FUNCTION__ ", CreateDXGIFactory1() failed", hr);
+    }
+
+    for (int adapterIndex = 0;; ++adapterIndex) {
+        if (!WINRT_CacheOutputsForAdapter(WINRT_displayCacheFactory, adapterIndex)) {
+            break;
+        }
+    }
+    return true;
+}
+
+static bool WINRT_AddCachedDisplay(const WINRT_CachedOutput *output)
+{
+    SDL_VideoDisplay display;
+    SDL_DisplayData *data;
+
+    data = (SDL_DisplayData *)SDL_calloc(1, sizeof(*data));
+    if (!data) {
+        return false;
+    }
+    data->adapterLuid = output->adapterLuid;
+    data->outputIndex = output->outputIndex;
+
+    SDL_zero(display);
+    display.name = output->name;
+    display.desktop_mode = output->desktop_mode;
+    display.internal = data;
+
+    if (output->workaround) {
+        SDL_DisplayMode *mode = &display.desktop_mode;
 #if SDL_WINRT_USE_APPLICATIONVIEW
-                ApplicationView ^ appView = ApplicationView::GetForCurrentView();
+        ApplicationView ^ appView = WINRT_GetApplicationView();
 #endif
-                CoreWindow ^ coreWin = CoreWindow::GetForCurrentThread();
-                SDL_zero(display);
-                SDL_zero(mode);
-                display.name = SDL_strdup("DXGI Display-detection Workaround");
-
-                /* HACK: ApplicationView's VisibleBounds property, appeared, via testing, to
-                   give a better approximation of display-size, than did CoreWindow's
-                   Bounds property, insofar that ApplicationView::VisibleBounds seems like
-                   it will, at least some of the time, give the full display size (during the
-                   failing test), whereas CoreWindow might not.  -- DavidL
-                */
+        CoreWindow ^ coreWin = WINRT_GetCoreWindow();
+
+        /* HACK: ApplicationView's VisibleBounds property, appeared, via testing, to
+           give a better approximation of display-size, than did CoreWindow's
+           Bounds property, insofar that ApplicationView::VisibleBounds seems like
+           it will, at least some of the time, give the full display size (during the
+           failing test), whereas CoreWindow might not.  -- DavidL
+        */
 
 #if (NTDDI_VERSION >= NTDDI_WIN10) || (SDL_WINRT_USE_APPLICATIONVIEW && SDL_WINAPI_FAMILY_PHONE)
-                mode.w = (int)SDL_floorf(appView->VisibleBounds.Width);
-                mode.h = (int)SDL_floorf(appView->VisibleBounds.Height);
+        mode->w = (int)SDL_floorf(appView->VisibleBounds.Width);
+        mode->h = (int)SDL_floorf(appView->VisibleBounds.Height);
 #else
-                /* On platform(s) that do not support VisibleBounds, such as Windows 8.1,
-                   fall back to CoreWindow's Bounds property.
-                */
-                mode.w = (int)SDL_floorf(coreWin->Bounds.Width);
-                mode.h = (int)SDL_floorf(coreWin->Bounds.Height);
+        /* On platform(s) that do not support VisibleBounds, such as Windows 8.1,
+           fall back to CoreWindow's Bounds property.
+        */
+        mode->w = (int)SDL_floorf(coreWin->Bounds.Width);
+        mode->h = (int)SDL_floorf(coreWin->Bounds.Height);
 #endif
-                mode.pixel_density = WINRT_DISPLAY_PROPERTY(LogicalDpi) / 96.0f;
-                mode.format = D3D11_DXGIFormatToSDLPixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM);
+        mode->pixel_density = WINRT_DISPLAY_PROPERTY(LogicalDpi) / 96.0f;
+        mode->format = D3D11_DXGIFormatToSDLPixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM);
+    }
 
-                display.desktop_mode = mode;
-                bool error = (SDL_AddVideoDisplay(&display, false) == 0);
-                if (display.name) {
-                    SDL_free(display.name);
-                }
-                if (error) {
-                    return SDL_SetError("Failed to apply DXGI Display-detection workaround");
-                }
-            }
+    if (SDL_AddVideoDisplay(&display, false) == 0) {
+        SDL_free(data);
+        if (output->workaround) {
+            return SDL_SetError("Failed to apply DXGI Display-detection workaround");
+        }
+        return false;
+    }
+    return true;
+}
+
+// Reads an output's mode list from DXGI, this is the slow part of display enumeration.
+static bool WINRT_CacheDisplayModes(WINRT_CachedOutput *output)
+{
+    HRESULT hr;
+    IDXGIAdapter1 *dxgiAdapter1 = NULL;
+    IDXGIOutput *dxgiOutput = NULL;
+    UINT numModes = 0;
+    DXGI_MODE_DESC *dxgiModes = NULL;
+    bool result = false;
 
+    for (int adapterIndex = 0;; ++adapterIndex) {
+        DXGI_ADAPTER_DESC1 dxgiAdapterDesc;
+
+        hr = WINRT_displayCacheFactory->EnumAdapters1(adapterIndex, &dxgiAdapter1);
+        if (FAILED(hr)) {
+            dxgiAdapter1 = NULL;
+            SDL_SetError("Couldn't find the display adapter");
+            goto done;
+        }
+        if (SUCCEEDED(dxgiAdapter1->GetDesc1(&dxgiAdapterDesc)) &&
+            SDL_memcmp(&dxgiAdapterDesc.AdapterLuid, &output->adapterLuid, sizeof(LUID)) == 0) {
             break;
         }
+        dxgiAdapter1->Release();
     }
 
-    dxgiAdapter1->Release();
+    hr = dxgiAdapter1->EnumOutputs(output->outputIndex, &dxgiOutput);
+    if (FAILED(hr)) {
+        dxgiOutput = NULL;
+        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIAdapter1::EnumOutputs failed", hr);
+        goto done;
+    }
+
+    hr = dxgiOutput->GetDisplayModeList(DXGI_FORMAT_B8G8R8A8_UNORM, 0, &numModes, NULL);
+    if (FAILED(hr)) {
+        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::GetDisplayModeList [get mode list size] failed", hr);
+        goto done;
+    }
+
+    dxgiModes = (DXGI_MODE_DESC *)SDL_calloc(numModes, sizeof(DXGI_MODE_DESC));
+    output->modes = (SDL_DisplayMode *)SDL_calloc(numModes + 1, sizeof(SDL_DisplayMode));
+    if (!dxgiModes || !output->modes) {
+        goto done;
+    }
+
+    hr = dxgiOutput->GetDisplayModeList(DXGI_FORMAT_B8G8R8A8_UNORM, 0, &numModes, dxgiModes);
+    if (FAILED(hr)) {
+        WIN_SetErrorFromHRESULT(__FUNCTION__ ", IDXGIOutput::GetDisplayModeList [get mode contents] failed", hr);
+        goto done;
+    }
+
+    for (UINT i = 0; i < numModes; ++i) {
+        WINRT_DXGIModeToSDLDisplayMode(&dxgiModes[i], &output->modes[i]);
+    }
+    output->num_modes = (int)numModes;
+    result = true;
+
+done:
+    if (!result) {
+        SDL_free(output->modes);
+        output->modes = NULL;
+        output->num_modes = 0;
+    }
+    SDL_free(dxgiModes);
+    if (dxgiOutput) {
+        dxgiOutput->Release();
+    }
+    if (dxgiAdapter1) {
+        dxgiAdapter1->Release();
+    }
+    return result;
+}
+
+static bool WINRT_GetDisplayModes(SDL_VideoDevice *_this, SDL_VideoDisplay *display)
+{
+    if (!display->internal || !WINRT_UpdateDisplayCache()) {
+        return false;
+    }
+
+    WINRT_CachedOutput *output = WINRT_FindCachedOutput(display->internal);
+    if (!output || !output->has_mode_list) {
+        return true;  // only the desktop mode is known.
+    }
+
+    if (!output->modes && !WINRT_CacheDisplayModes(output)) {
+        return false;
+    }
+
+    for (int i = 0; i < output->num_modes; ++i) {
+        SDL_AddFullscreenDisplayMode(display, &output->modes[i]);
+    }
+
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+    /* On Xbox, DXGI only reports the current mode, the modes the TV
+       actually supports come from HdmiDisplayInformation.
+    */
+    if (output->outputIndex == 0) {
+        WINRT_AddHdmiDisplayModes(display);
+    }
+#endif
     return true;
 }
 
+// Called before windows are created, this only does any work if the display configuration changed.
+static void WINRT_RefreshDisplays(SDL_VideoDevice *_this)
+{
+    const bool stale = !WINRT_displayCacheFactory ||
+                       SDL_GetAtomicInt(&WINRT_displayCacheInvalidated) ||
+                       !WINRT_displayCacheFactory->IsCurrent();
+    if (!stale || !WINRT_UpdateDisplayCache()) {
+        return;
+    }
+
+    // Displays are never added or removed here, but their modes may have changed.
+    for (int i = 0; i < _this->num_displays; ++i) {
+        SDL_VideoDisplay *display = _this->displays[i];
+        const WINRT_CachedOutput *output = display->internal ? WINRT_FindCachedOutput(display->internal) : NULL;
+        SDL_ResetFullscreenDisplayModes(display);
+        if (output && !output->workaround) {
+            SDL_SetDesktopDisplayMode(display, &output->desktop_mode);
+        }
+    }
+}
+
 bool WINRT_InitModes(SDL_VideoDevice *_this)
 {
     /* HACK: Initialize a single display, for whatever screen the app's
@@ -469,25 +813,80 @@ bool WINRT_InitModes(SDL_VideoDevice *_this)
          Appropriate WinRT APIs for this seem elusive, though.  -- DavidL
     */
 
-    HRESULT hr;
-    IDXGIFactory2 *dxgiFactory2 = NULL;
+    WINRT_RecordStartupStage(WINRT_STARTUP_INIT_MODES);
 
-    hr = CreateDXGIFactory1(SDL_IID_IDXGIFactory2, (void **)&dxgiFactory2);
-    if (FAILED(hr)) {
-        return WIN_SetErrorFromHRESULT(__FUNCTION__ ", CreateDXGIFactory1() failed", hr);
+    if (!WINRT_UpdateDisplayCache()) {
+        return false;
     }
 
-    for (int adapterIndex = 0;; ++adapterIndex) {
-        if (!WINRT_AddDisplaysForAdapter(_this, dxgiFactory2, adapterIndex)) {
-            break;
+    for (int i = 0; i < WINRT_numCachedOutputs; ++i) {
+        if (!WINRT_AddCachedDisplay(&WINRT_cachedOutputs[i]) && WINRT_cachedOutputs[i].workaround) {
+            return false;
         }
     }
+    WINRT_RecordStartupStage(WINRT_STARTUP_ADAPTERS_ENUMERATED);
 
     return true;
 }
 
 static bool WINRT_SetDisplayMode(SDL_VideoDevice *_this, SDL_VideoDisplay *display, SDL_DisplayMode *mode)
 {
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+    Windows::Graphics::Display::Core::HdmiDisplayInformation ^ hdmiInfo = WINRT_GetHdmiDisplayInformation();
+    if (!hdmiInfo) {
+        // Only Xbox lets apps change the display mode
+        return true;
+    }
+
+    try {
+        Windows::Graphics::Display::Core::HdmiDisplayMode ^ hdmiMode = WINRT_FindHdmiDisplayMode(hdmiInfo, mode);
+        if (!hdmiMode) {
+            return SDL_SetError("Couldn't find a matching HDMI display mode");
+        }
+
+        Windows::Graphics::Display::Core::HdmiDisplayMode ^ current = hdmiInfo->GetCurrentDisplayMode();
+        if (current && current->IsEqual(hdmiMode)) {
+            return true;
+        }
+
+        /* The request has to be made from the UI thread, and completes while
+           it processes events, so pump them here if that's us, otherwise hand
+           the request over to it and wait.
+        */
+        Windows::Foundation::IAsyncOperation<bool> ^ operation = nullptr;
+        if (CoreWindow::GetForCurrentThread()) {
+            operation = hdmiInfo->RequestSetCurrentDisplayModeAsync(hdmiMode);
+            while (operation->Status == Windows::Foundation::AsyncStatus::Started) {
+                WINRT_PumpEvents(_this);
+            }
+        } else {
+            SDL_AtomicInt done;
+            SDL_SetAtomicInt(&done, 0);
+            WINRT_GetCoreWindow()->Dispatcher->RunAsync(CoreDispatcherPriority::Normal, ref new DispatchedHandler([&]() {
+                try {
+                    operation = hdmiInfo->RequestSetCurrentDisplayModeAsync(hdmiMode);
+                } catch (Platform::Exception ^) {
+                    operation = nullptr;
+                }
+                SDL_SetAtomicInt(&done, 1);
+            }));
+            while (!SDL_GetAtomicInt(&done)) {
+                SDL_Delay(1);
+            }
+            if (operation) {
+                while (operation->Status == Windows::Foundation::AsyncStatus::Started) {
+                    SDL_Delay(1);
+                }
+            }
+        }
+
+        if (!operation || operation->Status != Windows::Foundation::AsyncStatus::Completed || !operation->GetResults()) {
+            return SDL_SetError("The display mode change was rejected");
+        }
+    } catch (Platform::Exception ^ e) {
+        return WIN_SetErrorFromHRESULT(__FUNCTION__ ", HdmiDisplayInformation::RequestSetCurrentDisplayModeAsync failed", e->HResult);
+    }
+#endif // SDL_WINRT_USE_HDMIDISPLAYINFORMATION
     return true;
 }
 
@@ -610,7 +1009,7 @@ static bool WINRT_IsCoreWindowActive(CoreWindow ^ coreWindow)
 extern "C" {
 HWND uwp_window_handle()
 {
-    CoreWindow ^ coreWindow = CoreWindow::GetForCurrentThread();
+    CoreWindow ^ coreWindow = WINRT_GetCoreWindow();
     Platform::Agile<Windows::UI::Core::CoreWindow> m_window;
     m_window = coreWindow;
     return (HWND) reinterpret_cast<IUnknown *>(m_window.Get());
@@ -632,6 +1031,8 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
     window->internal = data;
     data->sdlWindow = window;
     data->high_surrogate = L'\0';
+    data->framebuffer = NULL;
+    data->framebuffer_vsync = 0;
 
     /* To note, when XAML support is enabled, access to the CoreWindow will not
        be possible, at least not via the SDL/XAML thread.  Attempts to access it
@@ -642,9 +1043,9 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
 #ifndef __XBOXSERIES__
     if (!WINRT_XAMLWasEnabled) {
 #endif
-        data->coreWindow = CoreWindow::GetForCurrentThread();
+        data->coreWindow = WINRT_GetCoreWindow();
 #if SDL_WINRT_USE_APPLICATIONVIEW
-        data->appView = ApplicationView::GetForCurrentView();
+        data->appView = WINRT_GetApplicationView();
 #endif
 #ifndef __XBOXSERIES__
     }
@@ -656,7 +1057,7 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
 
 #ifdef SDL_VIDEO_OPENGL_EGL
     // Setup the EGL surface, but only if OpenGL ES 2 was requested.
-    if (!(window->flags & SDL_WINDOW_OPENGL)) {
+    if (!(window->flags & SDL_WINDOW_OPENGL) || !_this->egl_data) {
         // OpenGL ES 2 wasn't requested.  Don't set up an EGL surface.
         data->egl_surface = EGL_NO_SURFACE;
     } else {
@@ -690,11 +1091,16 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
              * ANGLE/WinRT:
              */
             IInspectable *coreWindowAsIInspectable = reinterpret_cast<IInspectable *>(data->coreWindow.Get());
+            const EGLint invertedSurfaceAttributes[] = {
+                EGL_SURFACE_ORIENTATION_ANGLE,
+                EGL_SURFACE_ORIENTATION_INVERT_Y_ANGLE,
+                EGL_NONE,
+            };
             data->egl_surface = _this->egl_data->eglCreateWindowSurface(
                 _this->egl_data->egl_display,
                 _this->egl_data->egl_config,
                 (NativeWindowType)coreWindowAsIInspectable,
-                NULL);
+                video_data->eglInvertY ? invertedSurfaceAttributes : NULL);
             if (data->egl_surface == NULL) {
                 return SDL_EGL_SetError("unable to create EGL native-window surface", "eglCreateWindowSurface");
             }
@@ -702,7 +1108,8 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
             return SDL_SetError("No supported means to create an EGL window surface are available");
         }
     }
-#elif SDL_VIDEO_OPENGL_WGL
+#endif
+#ifdef SDL_VIDEO_OPENGL_WGL
     data->hdc = (HDC)data->coreWindow.Get();
 #endif
 
@@ -718,7 +1125,12 @@ bool WINRT_CreateWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_Properti
 #endif
 
 #if SDL_VIDEO_OPENGL_WGL
-    window->flags |= SDL_WINDOW_OPENGL;
+#ifdef SDL_VIDEO_OPENGL_EGL
+    if (!_this->egl_data)
+#endif
+    {
+        window->flags |= SDL_WINDOW_OPENGL;
+    }
 #endif
 
 #ifndef __XBOXSERIES__
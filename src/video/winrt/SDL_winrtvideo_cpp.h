@@ -33,6 +33,10 @@
 #define SDL_WINRT_USE_APPLICATIONVIEW 1
 #endif
 
+#if NTDDI_VERSION >= NTDDI_WIN10_RS1 // HdmiDisplayInformation first appeared in Windows 10, version 1607
+#define SDL_WINRT_USE_HDMIDISPLAYINFORMATION 1
+#endif
+
 #ifdef __cplusplus_winrt
 extern "C" {
 #endif
@@ -50,6 +54,9 @@ struct SDL_VideoData
      */
     IUnknown *winrtEglWindow;
 
+    // True if EGL window surfaces should be created upside down, see SDL_HINT_WINRT_GLES_INVERT_Y
+    bool eglInvertY;
+
     /* Event token(s), for unregistering WinRT event handler(s).
        These are just a struct with a 64-bit integer inside them
     */
@@ -66,6 +73,16 @@ struct SDL_VideoData
     IUnknown *displayRequest;
 };
 
+// Identifies the DXGI output a display came from, in the driver's display cache
+struct SDL_DisplayData
+{
+    LUID adapterLuid;
+    int outputIndex;
+};
+
+// Drops the cached display details, so they're enumerated again when next needed
+extern void WINRT_InvalidateDisplayCache(void);
+
 /* The global, WinRT, SDL Window.
    For now, SDL/WinRT only supports one window (due to platform limitations of
    WinRT.
@@ -88,9 +105,25 @@ extern "C" SDL_WindowFlags WINRT_DetectWindowFlags(SDL_Window *window); // detec
 
 #ifdef __cplusplus_winrt
 
+/* Accessors for the app's per-view WinRT objects.  Unlike GetForCurrentThread()
+   and GetForCurrentView(), these also work from the game thread enabled by
+   SDL_HINT_WINRT_GAME_THREAD.
+*/
+extern Windows::UI::Core::CoreWindow ^ WINRT_GetCoreWindow();
+#if SDL_WINRT_USE_APPLICATIONVIEW
+extern Windows::UI::ViewManagement::ApplicationView ^ WINRT_GetApplicationView();
+#endif
+extern Windows::UI::ViewManagement::InputPane ^ WINRT_GetInputPane();
+#if NTDDI_VERSION > NTDDI_WIN8
+extern Windows::Graphics::Display::DisplayInformation ^ WINRT_GetDisplayInformation();
+#endif
+#if SDL_WINRT_USE_HDMIDISPLAYINFORMATION
+extern Windows::Graphics::Display::Core::HdmiDisplayInformation ^ WINRT_GetHdmiDisplayInformation(); // only available on Xbox, nullptr elsewhere
+#endif
+
 // A convenience macro to get a WinRT display property
 #if NTDDI_VERSION > NTDDI_WIN8
-#define WINRT_DISPLAY_PROPERTY(NAME) (Windows::Graphics::Display::DisplayInformation::GetForCurrentView()->NAME)
+#define WINRT_DISPLAY_PROPERTY(NAME) (WINRT_GetDisplayInformation()->NAME)
 #else
 #define WINRT_DISPLAY_PROPERTY(NAME) (Windows::Graphics::Display::DisplayProperties::NAME)
 #endif
@@ -119,4 +152,6 @@ typedef struct SDL_WindowData
 #endif
 #endif
     WCHAR high_surrogate;
+    struct WINRT_Framebuffer *framebuffer; // Used by SDL_GetWindowSurface()
+    int framebuffer_vsync;
 } SDL_WindowData;
@@ -0,0 +1,198 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "SDL_internal.h"
+
+#ifdef SDL_HAVE_YUV
+#include "yuv_rgb_internal.h"
+
+#ifdef SDL_AVX2_INTRINSICS
+
+#define AVX2_FUNCTION_NAME	yuv420_rgba_avx2
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_bgra_avx2
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_argb_avx2
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_abgr_avx2
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgba_avx2
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_bgra_avx2
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_argb_avx2
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_abgr_avx2
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgba_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_bgra_avx2
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_argb_avx2
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_abgr_avx2
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+/* P010 needs 32-bit intermediates, the scaled 10-bit values overflow 16 bits */
+#define CLAMP_10(X) \
+	_mm256_min_epi32(_mm256_max_epi32(X, _mm256_setzero_si256()), _mm256_set1_epi32(0x3FF))
+
+#define ADD_Y2RGB_10(Y,R_UV,G_UV,B_UV,RGB) \
+{ \
+	__m256i r, g, b; \
+	Y = _mm256_mullo_epi32(_mm256_srai_epi32(_mm256_sub_epi32(Y, _mm256_set1_epi32(param->y_shift)), 6), _mm256_set1_epi32(param->y_factor)); \
+	r = CLAMP_10(_mm256_srai_epi32(_mm256_add_epi32(R_UV, Y), PRECISION)); \
+	g = CLAMP_10(_mm256_srai_epi32(_mm256_add_epi32(G_UV, Y), PRECISION)); \
+	b = CLAMP_10(_mm256_srai_epi32(_mm256_add_epi32(B_UV, Y), PRECISION)); \
+	RGB = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32((int)0xC0000000), _mm256_slli_epi32(b, 20)), \
+			_mm256_or_si256(_mm256_slli_epi32(g, 10), r)); \
+}
+
+#define CONVERT_LINE_10(y_ptr, rgb_ptr) \
+{ \
+	__m256i y, y_32_1, y_32_2, rgb; \
+	y = _mm256_loadu_si256((const __m256i*)(y_ptr)); \
+	y_32_1 = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(y)); \
+	y_32_2 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(y, 1)); \
+	ADD_Y2RGB_10(y_32_1, r_uv_32_1, g_uv_32_1, b_uv_32_1, rgb) \
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), rgb); \
+	ADD_Y2RGB_10(y_32_2, r_uv_32_2, g_uv_32_2, b_uv_32_2, rgb) \
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+32), rgb); \
+}
+
+#define DUP_32(X,X1,X2) \
+{ \
+	__m256i lo = _mm256_unpacklo_epi32(X, X); \
+	__m256i hi = _mm256_unpackhi_epi32(X, X); \
+	X1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	X2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+}
+
+void SDL_TARGETING("avx2") yuvp010_xbgr2101010_avx2(uint32_t width, uint32_t height,
+	const uint16_t *Y, const uint16_t *U, const uint16_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+	/* U and V are interleaved, reading the V samples touches one value past the block */
+	const uint32_t converted = (width > 0) ? ((width - 1) & ~15) : 0;
+	const uint32_t y_stride = Y_stride / sizeof(uint16_t);
+	const uint32_t uv_stride = UV_stride / sizeof(uint16_t);
+
+	if (converted > 0) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-1); ypos+=2)
+		{
+			const uint16_t *y_ptr1=Y+ypos*y_stride,
+				*y_ptr2=Y+(ypos+1)*y_stride,
+				*u_ptr=U+(ypos/2)*uv_stride,
+				*v_ptr=V+(ypos/2)*uv_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<converted; xpos+=16)
+			{
+				__m256i u_32, v_32, r_tmp, g_tmp, b_tmp;
+				__m256i r_uv_32_1, g_uv_32_1, b_uv_32_1, r_uv_32_2, g_uv_32_2, b_uv_32_2;
+
+				u_32 = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr)), _mm256_set1_epi32(0xFFFF));
+				v_32 = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr)), _mm256_set1_epi32(0xFFFF));
+				u_32 = _mm256_sub_epi32(_mm256_srli_epi32(u_32, 6), _mm256_set1_epi32(512));
+				v_32 = _mm256_sub_epi32(_mm256_srli_epi32(v_32, 6), _mm256_set1_epi32(512));
+
+				r_tmp = _mm256_mullo_epi32(v_32, _mm256_set1_epi32(param->v_r_factor));
+				g_tmp = _mm256_add_epi32(
+					_mm256_mullo_epi32(u_32, _mm256_set1_epi32(param->u_g_factor)),
+					_mm256_mullo_epi32(v_32, _mm256_set1_epi32(param->v_g_factor)));
+				b_tmp = _mm256_mullo_epi32(u_32, _mm256_set1_epi32(param->u_b_factor));
+				DUP_32(r_tmp, r_uv_32_1, r_uv_32_2)
+				DUP_32(g_tmp, g_uv_32_1, g_uv_32_2)
+				DUP_32(b_tmp, b_uv_32_1, b_uv_32_2)
+
+				CONVERT_LINE_10(y_ptr1, rgb_ptr1)
+				CONVERT_LINE_10(y_ptr2, rgb_ptr2)
+
+				y_ptr1+=16;
+				y_ptr2+=16;
+				u_ptr+=16;
+				v_ptr+=16;
+				rgb_ptr1+=16*4;
+				rgb_ptr2+=16*4;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (ypos == (height-1))
+		{
+			const uint16_t *y_ptr=Y+ypos*y_stride,
+				*u_ptr=U+(ypos/2)*uv_stride,
+				*v_ptr=V+(ypos/2)*uv_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			yuvp010_xbgr2101010_std(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		yuvp010_xbgr2101010_std(width-converted, height, Y+converted, U+converted, V+converted, Y_stride, UV_stride, RGB+converted*4, RGB_stride, yuv_type);
+	}
+}
+
+#undef CLAMP_10
+#undef ADD_Y2RGB_10
+#undef CONVERT_LINE_10
+#undef DUP_32
+
+#endif // SDL_AVX2_INTRINSICS
+
+#endif // SDL_HAVE_YUV
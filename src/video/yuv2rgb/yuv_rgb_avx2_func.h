@@ -0,0 +1,242 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+#define LOAD_SI256 _mm256_loadu_si256
+#define SAVE_SI256 _mm256_storeu_si256
+
+/* Same 16-bit fixed point math as the SSE2 path, so both produce identical output */
+#define UV2RGB_32(U,V,R1,G1,B1,R2,G2,B2) \
+{ \
+	__m256i r_tmp, g_tmp, b_tmp, lo, hi; \
+	r_tmp = _mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_b_factor)); \
+	/* duplicate each chroma sample for the two pixels that share it */ \
+	lo = _mm256_unpacklo_epi16(r_tmp, r_tmp); \
+	hi = _mm256_unpackhi_epi16(r_tmp, r_tmp); \
+	R1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	R2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+	lo = _mm256_unpacklo_epi16(g_tmp, g_tmp); \
+	hi = _mm256_unpackhi_epi16(g_tmp, g_tmp); \
+	G1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	G2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+	lo = _mm256_unpacklo_epi16(b_tmp, b_tmp); \
+	hi = _mm256_unpackhi_epi16(b_tmp, b_tmp); \
+	B1 = _mm256_permute2x128_si256(lo, hi, 0x20); \
+	B2 = _mm256_permute2x128_si256(lo, hi, 0x31); \
+}
+
+#define CLAMP_U8(X) \
+	_mm256_min_epi16(_mm256_max_epi16(X, _mm256_setzero_si256()), _mm256_set1_epi16(0xFF))
+
+#define ADD_Y2RGB_16(Y,R_UV,G_UV,B_UV,R,G,B) \
+	Y = _mm256_mullo_epi16(_mm256_sub_epi16(Y, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	R = CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(R_UV, Y), PRECISION)); \
+	G = CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(G_UV, Y), PRECISION)); \
+	B = CLAMP_U8(_mm256_srai_epi16(_mm256_add_epi16(B_UV, Y), PRECISION)); \
+
+/* Interleave four 16-bit channel vectors (values 0-255) into 16 pixels, C0 is the lowest byte in memory */
+#define PACK_SAVE_16(rgb_ptr, C0, C1, C2, C3) \
+{ \
+	__m256i lo, hi, p1, p2; \
+	lo = _mm256_or_si256(C0, _mm256_slli_epi16(C1, 8)); \
+	hi = _mm256_or_si256(C2, _mm256_slli_epi16(C3, 8)); \
+	p1 = _mm256_unpacklo_epi16(lo, hi); \
+	p2 = _mm256_unpackhi_epi16(lo, hi); \
+	SAVE_SI256((__m256i*)(rgb_ptr), _mm256_permute2x128_si256(p1, p2, 0x20)); \
+	SAVE_SI256((__m256i*)(rgb_ptr+32), _mm256_permute2x128_si256(p1, p2, 0x31)); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_PIXEL(rgb_ptr, R, G, B)	PACK_SAVE_16(rgb_ptr, a, B, G, R)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_PIXEL(rgb_ptr, R, G, B)	PACK_SAVE_16(rgb_ptr, a, R, G, B)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_PIXEL(rgb_ptr, R, G, B)	PACK_SAVE_16(rgb_ptr, B, G, R, a)
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define PACK_PIXEL(rgb_ptr, R, G, B)	PACK_SAVE_16(rgb_ptr, R, G, B, a)
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr, Y1, Y2) \
+{ \
+	__m256i y; \
+	y = LOAD_SI256((const __m256i*)(y_ptr)); \
+	Y1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(y)); \
+	Y2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(y, 1)); \
+}
+
+#define READ_UV \
+	u_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	v_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr, Y1, Y2) \
+	Y1 = _mm256_and_si256(LOAD_SI256((const __m256i*)(y_ptr)), _mm256_set1_epi16(0xFF)); \
+	Y2 = _mm256_and_si256(LOAD_SI256((const __m256i*)(y_ptr+32)), _mm256_set1_epi16(0xFF)); \
+
+#define READ_UV \
+	u_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(LOAD_SI256((const __m256i*)(u_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(LOAD_SI256((const __m256i*)(u_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+	v_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(LOAD_SI256((const __m256i*)(v_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(LOAD_SI256((const __m256i*)(v_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr, Y1, Y2) \
+{ \
+	__m256i y; \
+	y = LOAD_SI256((const __m256i*)(y_ptr)); \
+	Y1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(y)); \
+	Y2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(y, 1)); \
+}
+
+#define READ_UV \
+	u_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	v_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define CONVERT_LINE(y_ptr, rgb_ptr) \
+{ \
+	__m256i y_16_1, y_16_2, r_16, g_16, b_16; \
+	\
+	READ_Y(y_ptr, y_16_1, y_16_2) \
+	\
+	ADD_Y2RGB_16(y_16_1, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_16, g_16, b_16) \
+	PACK_PIXEL(rgb_ptr, r_16, g_16, b_16) \
+	\
+	ADD_Y2RGB_16(y_16_2, r_uv_16_2, g_uv_16_2, b_uv_16_2, r_16, g_16, b_16) \
+	PACK_PIXEL(rgb_ptr+64, r_16, g_16, b_16) \
+}
+
+void SDL_TARGETING("avx2") AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+	const int rgb_pixel_stride = 4;
+
+#if YUV_FORMAT == YUV_FORMAT_420
+	const uint32_t converted = (width & ~31);
+#else
+	/* For interleaved formats READ_Y / READ_UV read up to 3 bytes past the last pixel
+	 * of the block, so always leave at least one pixel for the STD path.
+	 * see https://github.com/libsdl-org/SDL/issues/4841
+	 */
+	const uint32_t converted = (width > 0) ? ((width - 1) & ~31) : 0;
+#endif
+
+	if (converted > 0) {
+		const __m256i a = _mm256_set1_epi16(0xFF);
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<converted; xpos+=32)
+			{
+				__m256i u_16, v_16;
+				__m256i r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2;
+
+				READ_UV
+				u_16 = _mm256_sub_epi16(u_16, _mm256_set1_epi16(128));
+				v_16 = _mm256_sub_epi16(v_16, _mm256_set1_epi16(128));
+
+				UV2RGB_32(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2)
+
+				CONVERT_LINE(y_ptr1, rgb_ptr1)
+				if (uv_y_sample_interval > 1)
+				{
+					CONVERT_LINE(y_ptr2, rgb_ptr2)
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+			*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+			*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+		uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+		STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef LOAD_SI256
+#undef SAVE_SI256
+#undef UV2RGB_32
+#undef CLAMP_U8
+#undef ADD_Y2RGB_16
+#undef PACK_SAVE_16
+#undef PACK_PIXEL
+#undef READ_Y
+#undef READ_UV
+#undef CONVERT_LINE
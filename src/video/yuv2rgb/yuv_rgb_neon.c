@@ -0,0 +1,185 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "SDL_internal.h"
+
+#ifdef SDL_HAVE_YUV
+#include "yuv_rgb_internal.h"
+
+#ifdef SDL_NEON_INTRINSICS
+
+#define NEON_FUNCTION_NAME	yuv420_rgba_neon
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_bgra_neon
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_argb_neon
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_abgr_neon
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgba_neon
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_bgra_neon
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_argb_neon
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_abgr_neon
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgba_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_bgra_neon
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_argb_neon
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_abgr_neon
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+/* P010 needs 32-bit intermediates, the scaled 10-bit values overflow 16 bits */
+#define ADD_Y2RGB_10(Y,R_UV,G_UV,B_UV,RGB) \
+{ \
+	int32x4_t r, g, b; \
+	Y = vmulq_n_s32(vshrq_n_s32(vsubq_s32(Y, vdupq_n_s32(param->y_shift)), 6), param->y_factor); \
+	r = vminq_s32(vmaxq_s32(vshrq_n_s32(vaddq_s32(R_UV, Y), PRECISION), vdupq_n_s32(0)), vdupq_n_s32(0x3FF)); \
+	g = vminq_s32(vmaxq_s32(vshrq_n_s32(vaddq_s32(G_UV, Y), PRECISION), vdupq_n_s32(0)), vdupq_n_s32(0x3FF)); \
+	b = vminq_s32(vmaxq_s32(vshrq_n_s32(vaddq_s32(B_UV, Y), PRECISION), vdupq_n_s32(0)), vdupq_n_s32(0x3FF)); \
+	RGB = vorrq_u32(vorrq_u32(vdupq_n_u32(0xC0000000), vshlq_n_u32(vreinterpretq_u32_s32(b), 20)), \
+			vorrq_u32(vshlq_n_u32(vreinterpretq_u32_s32(g), 10), vreinterpretq_u32_s32(r))); \
+}
+
+#define CONVERT_LINE_10(y_ptr, rgb_ptr) \
+{ \
+	uint16x8_t y; \
+	int32x4_t y_32_1, y_32_2; \
+	uint32x4_t rgb; \
+	y = vld1q_u16(y_ptr); \
+	y_32_1 = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(y))); \
+	y_32_2 = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(y))); \
+	ADD_Y2RGB_10(y_32_1, r_uv_32.val[0], g_uv_32.val[0], b_uv_32.val[0], rgb) \
+	vst1q_u32((uint32_t *)(rgb_ptr), rgb); \
+	ADD_Y2RGB_10(y_32_2, r_uv_32.val[1], g_uv_32.val[1], b_uv_32.val[1], rgb) \
+	vst1q_u32((uint32_t *)(rgb_ptr+16), rgb); \
+}
+
+void yuvp010_xbgr2101010_neon(uint32_t width, uint32_t height,
+	const uint16_t *Y, const uint16_t *U, const uint16_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+	/* U and V are interleaved, reading the V samples touches one value past the block */
+	const uint32_t converted = (width > 0) ? ((width - 1) & ~7) : 0;
+	const uint32_t y_stride = Y_stride / sizeof(uint16_t);
+	const uint32_t uv_stride = UV_stride / sizeof(uint16_t);
+
+	if (converted > 0) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-1); ypos+=2)
+		{
+			const uint16_t *y_ptr1=Y+ypos*y_stride,
+				*y_ptr2=Y+(ypos+1)*y_stride,
+				*u_ptr=U+(ypos/2)*uv_stride,
+				*v_ptr=V+(ypos/2)*uv_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<converted; xpos+=8)
+			{
+				int32x4_t u_32, v_32, r_tmp, g_tmp, b_tmp;
+				int32x4x2_t r_uv_32, g_uv_32, b_uv_32;
+
+				u_32 = vreinterpretq_s32_u32(vshrq_n_u32(vmovl_u16(vld2_u16(u_ptr).val[0]), 6));
+				v_32 = vreinterpretq_s32_u32(vshrq_n_u32(vmovl_u16(vld2_u16(v_ptr).val[0]), 6));
+				u_32 = vsubq_s32(u_32, vdupq_n_s32(512));
+				v_32 = vsubq_s32(v_32, vdupq_n_s32(512));
+
+				r_tmp = vmulq_n_s32(v_32, param->v_r_factor);
+				g_tmp = vmlaq_n_s32(vmulq_n_s32(u_32, param->u_g_factor), v_32, param->v_g_factor);
+				b_tmp = vmulq_n_s32(u_32, param->u_b_factor);
+				r_uv_32 = vzipq_s32(r_tmp, r_tmp);
+				g_uv_32 = vzipq_s32(g_tmp, g_tmp);
+				b_uv_32 = vzipq_s32(b_tmp, b_tmp);
+
+				CONVERT_LINE_10(y_ptr1, rgb_ptr1)
+				CONVERT_LINE_10(y_ptr2, rgb_ptr2)
+
+				y_ptr1+=8;
+				y_ptr2+=8;
+				u_ptr+=8;
+				v_ptr+=8;
+				rgb_ptr1+=8*4;
+				rgb_ptr2+=8*4;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (ypos == (height-1))
+		{
+			const uint16_t *y_ptr=Y+ypos*y_stride,
+				*u_ptr=U+(ypos/2)*uv_stride,
+				*v_ptr=V+(ypos/2)*uv_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			yuvp010_xbgr2101010_std(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		yuvp010_xbgr2101010_std(width-converted, height, Y+converted, U+converted, V+converted, Y_stride, UV_stride, RGB+converted*4, RGB_stride, yuv_type);
+	}
+}
+
+#undef ADD_Y2RGB_10
+#undef CONVERT_LINE_10
+
+#endif // SDL_NEON_INTRINSICS
+
+#endif // SDL_HAVE_YUV
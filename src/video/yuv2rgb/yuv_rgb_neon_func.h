@@ -0,0 +1,205 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* Same 16-bit fixed point math as the SSE2 path, so both produce identical output */
+#define UV2RGB_16(U,V,R,G,B) \
+{ \
+	int16x8_t r_tmp, g_tmp, b_tmp; \
+	r_tmp = vmulq_n_s16(V, param->v_r_factor); \
+	g_tmp = vmlaq_n_s16(vmulq_n_s16(U, param->u_g_factor), V, param->v_g_factor); \
+	b_tmp = vmulq_n_s16(U, param->u_b_factor); \
+	/* duplicate each chroma sample for the two pixels that share it */ \
+	R = vzipq_s16(r_tmp, r_tmp); \
+	G = vzipq_s16(g_tmp, g_tmp); \
+	B = vzipq_s16(b_tmp, b_tmp); \
+}
+
+#define ADD_Y2RGB_8(Y,R_UV,G_UV,B_UV,R,G,B) \
+	Y = vmulq_n_s16(vsubq_s16(Y, vdupq_n_s16(param->y_shift)), param->y_factor); \
+	R = vqmovun_s16(vshrq_n_s16(vaddq_s16(R_UV, Y), PRECISION)); \
+	G = vqmovun_s16(vshrq_n_s16(vaddq_s16(G_UV, Y), PRECISION)); \
+	B = vqmovun_s16(vshrq_n_s16(vaddq_s16(B_UV, Y), PRECISION)); \
+
+/* vst4q_u8 stores val[0] at the lowest address, these match the little-endian Uint32 layout */
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_PIXEL(R, G, B) \
+	rgb.val[0] = a; rgb.val[1] = B; rgb.val[2] = G; rgb.val[3] = R;
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_PIXEL(R, G, B) \
+	rgb.val[0] = a; rgb.val[1] = R; rgb.val[2] = G; rgb.val[3] = B;
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_PIXEL(R, G, B) \
+	rgb.val[0] = B; rgb.val[1] = G; rgb.val[2] = R; rgb.val[3] = a;
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define PACK_PIXEL(R, G, B) \
+	rgb.val[0] = R; rgb.val[1] = G; rgb.val[2] = B; rgb.val[3] = a;
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#define READ_UV \
+	u = vld1_u8(u_ptr); \
+	v = vld1_u8(v_ptr); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr) \
+	y = vld2q_u8(y_ptr).val[0]; \
+
+#define READ_UV \
+	u = vld4_u8(u_ptr).val[0]; \
+	v = vld4_u8(v_ptr).val[0]; \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#define READ_UV \
+	u = vld2_u8(u_ptr).val[0]; \
+	v = vld2_u8(v_ptr).val[0]; \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define CONVERT_LINE(y_ptr, rgb_ptr) \
+{ \
+	uint8x16_t y; \
+	int16x8_t y_16_1, y_16_2; \
+	uint8x8_t r_8_1, g_8_1, b_8_1, r_8_2, g_8_2, b_8_2; \
+	uint8x16x4_t rgb; \
+	\
+	READ_Y(y_ptr) \
+	y_16_1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y))); \
+	y_16_2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y))); \
+	\
+	ADD_Y2RGB_8(y_16_1, r_uv_16.val[0], g_uv_16.val[0], b_uv_16.val[0], r_8_1, g_8_1, b_8_1) \
+	ADD_Y2RGB_8(y_16_2, r_uv_16.val[1], g_uv_16.val[1], b_uv_16.val[1], r_8_2, g_8_2, b_8_2) \
+	\
+	PACK_PIXEL(vcombine_u8(r_8_1, r_8_2), vcombine_u8(g_8_1, g_8_2), vcombine_u8(b_8_1, b_8_2)) \
+	vst4q_u8(rgb_ptr, rgb); \
+}
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+	const int rgb_pixel_stride = 4;
+
+#if YUV_FORMAT == YUV_FORMAT_420
+	const uint32_t converted = (width & ~15);
+#else
+	/* For interleaved formats READ_Y / READ_UV read up to 3 bytes past the last pixel
+	 * of the block, so always leave at least one pixel for the STD path.
+	 * see https://github.com/libsdl-org/SDL/issues/4841
+	 */
+	const uint32_t converted = (width > 0) ? ((width - 1) & ~15) : 0;
+#endif
+
+	if (converted > 0) {
+		const uint8x16_t a = vdupq_n_u8(0xFF);
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<converted; xpos+=16)
+			{
+				uint8x8_t u, v;
+				int16x8_t u_16, v_16;
+				int16x8x2_t r_uv_16, g_uv_16, b_uv_16;
+
+				READ_UV
+				u_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u)), vdupq_n_s16(128));
+				v_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v)), vdupq_n_s16(128));
+
+				UV2RGB_16(u_16, v_16, r_uv_16, g_uv_16, b_uv_16)
+
+				CONVERT_LINE(y_ptr1, rgb_ptr1)
+				if (uv_y_sample_interval > 1)
+				{
+					CONVERT_LINE(y_ptr2, rgb_ptr2)
+				}
+
+				y_ptr1+=16*y_pixel_stride;
+				y_ptr2+=16*y_pixel_stride;
+				u_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=16*rgb_pixel_stride;
+				rgb_ptr2+=16*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+			*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+			*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+		uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+		STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef UV2RGB_16
+#undef ADD_Y2RGB_8
+#undef PACK_PIXEL
+#undef READ_Y
+#undef READ_UV
+#undef CONVERT_LINE
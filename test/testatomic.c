@@ -77,6 +77,65 @@ static void RunBasicTest(void)
     value = SDL_GetAtomicInt(&v);
     tfret = (SDL_CompareAndSwapAtomicInt(&v, value, 20) == true);
     SDL_Log("AtomicCAS()          tfret=%s val=%d", tf(tfret), SDL_GetAtomicInt(&v));
+
+    tfret = (SDL_WaitAtomicInt(&v, 10, -1) == true);
+    SDL_Log("WaitAtomicInt(10)    tfret=%s val=%d", tf(tfret), SDL_GetAtomicInt(&v));
+    tfret = (SDL_WaitAtomicInt(&v, 20, SDL_MS_TO_NS(10)) == false);
+    SDL_Log("WaitAtomicInt(20)    tfret=%s val=%d", tf(tfret), SDL_GetAtomicInt(&v));
+}
+
+/**************************************************************************/
+/* Wait and wake test
+ *
+ * Two threads take turns incrementing a counter, sleeping on it in between.
+ */
+
+#define NPingPong 10000
+
+static SDL_AtomicInt pingpong;
+
+static int SDLCALL ponger(void *junk)
+{
+    int value;
+
+    for (value = 1; value < NPingPong; value += 2) {
+        while (SDL_GetAtomicInt(&pingpong) != value) {
+            SDL_WaitAtomicInt(&pingpong, value - 1, -1);
+        }
+        SDL_SetAtomicInt(&pingpong, value + 1);
+        SDL_WakeAtomicInt(&pingpong, false);
+    }
+    return 0;
+}
+
+static void RunWaitTest(void)
+{
+    SDL_Thread *thread;
+    Uint64 start, end;
+    int value;
+
+    SDL_Log("%s", "");
+    SDL_Log("wait and wake ----------------------------------");
+    SDL_Log("%s", "");
+
+    start = SDL_GetTicksNS();
+
+    SDL_SetAtomicInt(&pingpong, 0);
+    thread = SDL_CreateThread(ponger, "Ponger", NULL);
+
+    for (value = 0; value < NPingPong; value += 2) {
+        while (SDL_GetAtomicInt(&pingpong) != value) {
+            SDL_WaitAtomicInt(&pingpong, value - 1, -1);
+        }
+        SDL_SetAtomicInt(&pingpong, value + 1);
+        SDL_WakeAtomicInt(&pingpong, false);
+    }
+    SDL_WaitThread(thread, NULL);
+
+    end = SDL_GetTicksNS();
+
+    SDL_Log("Finished in %f sec", (end - start) / 1000000000.0);
+    SDL_Log("Counter %d, expected %d: %s", SDL_GetAtomicInt(&pingpong), NPingPong, tf(SDL_GetAtomicInt(&pingpong) == NPingPong));
 }
 
 /**************************************************************************/
@@ -752,6 +811,7 @@ int main(int argc, char *argv[])
 
     if (enable_threads) {
         RunEpicTest();
+        RunWaitTest();
     }
 /* This test is really slow, so don't run it by default */
 #if 0
@@ -0,0 +1,548 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for the audio resampler, sample format and channel converters,
+ * and SDL_MixAudio, reported in frames per second.
+ *
+ * SDL picks its SIMD implementations once per process, so --variants runs
+ * this program again for each instruction set the CPU has, forced with
+ * SDL_HINT_CPU_FEATURE_MASK, and merges the results.
+ */
+
+#include <stdio.h>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    char name[96];
+    char variant[32];
+    double fps;    /* frames per second */
+    double stddev; /* frames per second */
+} AudioBenchResult;
+
+typedef struct
+{
+    int frames;
+    int repeats;
+    Uint64 min_rep_ns;
+    const char *filter;
+    const char *variant;
+    AudioBenchResult *results;
+    int num_results;
+} AudioBenchState;
+
+typedef struct
+{
+    const char *label;
+    const char *mask;
+} AudioBenchVariant;
+
+static const int sample_rates[] = { 8000, 11025, 22050, 44100, 48000, 96000, 192000 };
+
+static const SDL_AudioFormat audio_formats[] = {
+    SDL_AUDIO_U8,
+    SDL_AUDIO_S8,
+    SDL_AUDIO_S16LE,
+    SDL_AUDIO_S16BE,
+    SDL_AUDIO_S32LE,
+    SDL_AUDIO_S32BE,
+    SDL_AUDIO_F32LE,
+    SDL_AUDIO_F32BE
+};
+
+static const char *AudioFormatName(SDL_AudioFormat format)
+{
+    const char *name = SDL_GetAudioFormatName(format);
+    if (SDL_strncmp(name, "SDL_AUDIO_", 10) == 0) {
+        name += 10;
+    }
+    return name;
+}
+
+/* Fills a buffer with noise; floats are kept in range, since NaNs and denormals would skew the timing */
+static void FillSamples(Uint8 *buffer, int len, SDL_AudioFormat format, float amplitude, Uint64 *seed)
+{
+    int i;
+
+    if (SDL_AUDIO_ISFLOAT(format)) {
+        for (i = 0; i < len / 4; ++i) {
+            const float sample = (SDL_randf_r(seed) * 2.0f - 1.0f) * amplitude;
+            Uint32 bits;
+
+            SDL_memcpy(&bits, &sample, sizeof(bits));
+            if (SDL_AUDIO_ISBIGENDIAN(format) != (SDL_BYTEORDER == SDL_BIG_ENDIAN)) {
+                bits = SDL_Swap32(bits);
+            }
+            SDL_memcpy(buffer + i * 4, &bits, sizeof(bits));
+        }
+    } else {
+        for (i = 0; i < len; ++i) {
+            buffer[i] = (Uint8)SDL_rand_bits_r(seed);
+        }
+    }
+}
+
+static bool AddResult(AudioBenchState *state, const AudioBenchResult *result)
+{
+    AudioBenchResult *results = (AudioBenchResult *)SDL_realloc(state->results, (state->num_results + 1) * sizeof(*results));
+    if (!results) {
+        return false;
+    }
+    state->results = results;
+    state->results[state->num_results++] = *result;
+    return true;
+}
+
+typedef struct
+{
+    SDL_AudioStream *stream;
+    SDL_AudioFormat format;
+    Uint8 *src;
+    Uint8 *dst;
+    int src_len;
+    int dst_len;
+} AudioBenchCase;
+
+typedef void (*AudioBenchFunc)(AudioBenchCase *bench);
+
+/* Pushes the source buffer through the stream and drains whatever comes out */
+static void RunStream(AudioBenchCase *bench)
+{
+    SDL_PutAudioStreamData(bench->stream, bench->src, bench->src_len);
+    while (SDL_GetAudioStreamData(bench->stream, bench->dst, bench->dst_len) > 0) {
+    }
+}
+
+static void RunMix(AudioBenchCase *bench)
+{
+    SDL_MixAudio(bench->dst, bench->src, bench->format, (Uint32)bench->src_len, 0.5f);
+}
+
+/* Times 'state->frames' frames per call, batching calls until a repetition is long enough to time */
+static void TimeCase(AudioBenchState *state, const char *name, AudioBenchFunc func, AudioBenchCase *bench)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    AudioBenchResult result;
+    double sum = 0.0, sum2 = 0.0, variance;
+    int calls = 1;
+    int i, rep;
+
+    /* This also warms up the caches and the resampler history */
+    for (;;) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 elapsed_ns;
+
+        for (i = 0; i < calls; ++i) {
+            func(bench);
+        }
+        elapsed_ns = (SDL_GetPerformanceCounter() - start) * SDL_NS_PER_SECOND / freq;
+        if (elapsed_ns >= state->min_rep_ns || calls >= (1 << 16)) {
+            break;
+        }
+        calls *= 2;
+    }
+
+    for (rep = 0; rep < state->repeats; ++rep) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        double seconds, fps;
+
+        for (i = 0; i < calls; ++i) {
+            func(bench);
+        }
+        seconds = (double)(SDL_GetPerformanceCounter() - start) / freq;
+        fps = (seconds > 0.0) ? (double)state->frames * calls / seconds : 0.0;
+        sum += fps;
+        sum2 += fps * fps;
+    }
+
+    SDL_zero(result);
+    SDL_strlcpy(result.name, name, sizeof(result.name));
+    SDL_strlcpy(result.variant, state->variant, sizeof(result.variant));
+    result.fps = sum / state->repeats;
+    variance = sum2 / state->repeats - result.fps * result.fps;
+    result.stddev = (variance > 0.0) ? SDL_sqrt(variance) : 0.0;
+    AddResult(state, &result);
+}
+
+static void TimeStream(AudioBenchState *state, const char *name, const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+{
+    const int max_ratio = (dst_spec->freq + src_spec->freq - 1) / src_spec->freq;
+    AudioBenchCase bench;
+    Uint64 seed = 0x5eed;
+
+    if (state->filter && !SDL_strstr(name, state->filter)) {
+        return;
+    }
+
+    SDL_zero(bench);
+    bench.src_len = state->frames * SDL_AUDIO_FRAMESIZE(*src_spec);
+    bench.dst_len = (state->frames * max_ratio + 256) * SDL_AUDIO_FRAMESIZE(*dst_spec);
+    bench.src = (Uint8 *)SDL_malloc(bench.src_len);
+    bench.dst = (Uint8 *)SDL_malloc(bench.dst_len);
+    bench.stream = SDL_CreateAudioStream(src_spec, dst_spec);
+    if (bench.src && bench.dst && bench.stream) {
+        FillSamples(bench.src, bench.src_len, src_spec->format, 1.0f, &seed);
+        TimeCase(state, name, RunStream, &bench);
+    } else {
+        SDL_Log("%-40s skipped: %s", name, SDL_GetError());
+    }
+    SDL_DestroyAudioStream(bench.stream);
+    SDL_free(bench.src);
+    SDL_free(bench.dst);
+}
+
+static void TimeMix(AudioBenchState *state, SDL_AudioFormat format, int channels)
+{
+    AudioBenchCase bench;
+    Uint64 seed = 0x5eed;
+    char name[96];
+
+    SDL_snprintf(name, sizeof(name), "mix/%s/%dch", AudioFormatName(format), channels);
+    if (state->filter && !SDL_strstr(name, state->filter)) {
+        return;
+    }
+
+    /* The output isn't reset between calls; with half volume it saturates, which costs the same */
+    SDL_zero(bench);
+    bench.format = format;
+    bench.src_len = bench.dst_len = state->frames * channels * SDL_AUDIO_BYTESIZE(format);
+    bench.src = (Uint8 *)SDL_malloc(bench.src_len);
+    bench.dst = (Uint8 *)SDL_malloc(bench.dst_len);
+    if (bench.src && bench.dst) {
+        FillSamples(bench.src, bench.src_len, format, 0.5f, &seed);
+        SDL_memset(bench.dst, SDL_GetSilenceValueForFormat(format), bench.dst_len);
+        TimeCase(state, name, RunMix, &bench);
+    }
+    SDL_free(bench.src);
+    SDL_free(bench.dst);
+}
+
+static void RunBenchmarks(AudioBenchState *state)
+{
+    SDL_AudioSpec src_spec, dst_spec;
+    char name[96];
+    int i, j;
+
+    /* Resampling, every rate pair */
+    for (i = 0; i < SDL_arraysize(sample_rates); ++i) {
+        for (j = 0; j < SDL_arraysize(sample_rates); ++j) {
+            if (i == j) {
+                continue;
+            }
+            src_spec.format = dst_spec.format = SDL_AUDIO_F32;
+            src_spec.channels = dst_spec.channels = 2;
+            src_spec.freq = sample_rates[i];
+            dst_spec.freq = sample_rates[j];
+            SDL_snprintf(name, sizeof(name), "resample/%d->%d/2ch", src_spec.freq, dst_spec.freq);
+            TimeStream(state, name, &src_spec, &dst_spec);
+        }
+    }
+
+    /* Resampling cost by channel count; stereo was covered above */
+    for (i = 1; i <= 8; ++i) {
+        if (i == 2) {
+            continue;
+        }
+        src_spec.format = dst_spec.format = SDL_AUDIO_F32;
+        src_spec.channels = dst_spec.channels = i;
+        src_spec.freq = 44100;
+        dst_spec.freq = 48000;
+        SDL_snprintf(name, sizeof(name), "resample/44100->48000/%dch", i);
+        TimeStream(state, name, &src_spec, &dst_spec);
+    }
+
+    /* Channel conversion, every channel count pair */
+    for (i = 1; i <= 8; ++i) {
+        for (j = 1; j <= 8; ++j) {
+            if (i == j) {
+                continue;
+            }
+            src_spec.format = dst_spec.format = SDL_AUDIO_F32;
+            src_spec.channels = i;
+            dst_spec.channels = j;
+            src_spec.freq = dst_spec.freq = 48000;
+            SDL_snprintf(name, sizeof(name), "channels/%dch->%dch", i, j);
+            TimeStream(state, name, &src_spec, &dst_spec);
+        }
+    }
+
+    /* Sample format conversion, every format pair */
+    for (i = 0; i < SDL_arraysize(audio_formats); ++i) {
+        for (j = 0; j < SDL_arraysize(audio_formats); ++j) {
+            if (i == j) {
+                continue;
+            }
+            src_spec.format = audio_formats[i];
+            dst_spec.format = audio_formats[j];
+            src_spec.channels = dst_spec.channels = 2;
+            src_spec.freq = dst_spec.freq = 48000;
+            SDL_snprintf(name, sizeof(name), "format/%s->%s/2ch", AudioFormatName(src_spec.format), AudioFormatName(dst_spec.format));
+            TimeStream(state, name, &src_spec, &dst_spec);
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(audio_formats); ++i) {
+        TimeMix(state, audio_formats[i], 2);
+    }
+}
+
+/* Parses the CSV rows a child process printed and adds them to the results */
+static void ParseResults(AudioBenchState *state, char *data)
+{
+    char *line, *saveptr = NULL;
+
+    for (line = SDL_strtok_r(data, "\r\n", &saveptr); line; line = SDL_strtok_r(NULL, "\r\n", &saveptr)) {
+        AudioBenchResult result;
+        char *fields[4];
+        char *fieldptr = NULL;
+        int i;
+
+        for (i = 0; i < SDL_arraysize(fields); ++i) {
+            fields[i] = SDL_strtok_r(i ? NULL : line, ",", &fieldptr);
+            if (!fields[i]) {
+                break;
+            }
+        }
+        if (i < SDL_arraysize(fields) || SDL_strcmp(fields[0], "name") == 0) {
+            continue;
+        }
+        SDL_zero(result);
+        SDL_strlcpy(result.name, fields[0], sizeof(result.name));
+        SDL_strlcpy(result.variant, fields[1], sizeof(result.variant));
+        result.fps = SDL_atof(fields[2]);
+        result.stddev = SDL_atof(fields[3]);
+        AddResult(state, &result);
+    }
+}
+
+/* Runs this program once per variant with the CPU features limited accordingly */
+static bool RunVariants(AudioBenchState *state, const char *exe, bool quick)
+{
+    AudioBenchVariant variants[5];
+    int num_variants = 0;
+    int i;
+
+    variants[num_variants].label = "default";
+    variants[num_variants++].mask = "all";
+    if (SDL_HasAVX2()) {
+        variants[num_variants].label = "no-avx2";
+        variants[num_variants++].mask = "-avx2";
+    }
+    if (SDL_HasSSE2()) {
+        variants[num_variants].label = "sse2";
+        variants[num_variants++].mask = "-all,+sse,+sse2";
+    }
+    if (SDL_HasNEON()) {
+        variants[num_variants].label = "neon";
+        variants[num_variants++].mask = "-all,+neon";
+    }
+    variants[num_variants].label = "scalar";
+    variants[num_variants++].mask = "-all";
+
+    for (i = 0; i < num_variants; ++i) {
+        const char *args[10];
+        SDL_Process *process;
+        char *output;
+        int exitcode = 0;
+        int n = 0;
+
+        args[n++] = exe;
+        args[n++] = "--child";
+        args[n++] = "--cpu-mask";
+        args[n++] = variants[i].mask;
+        args[n++] = "--label";
+        args[n++] = variants[i].label;
+        if (quick) {
+            args[n++] = "--quick";
+        }
+        if (state->filter) {
+            args[n++] = "--filter";
+            args[n++] = state->filter;
+        }
+        args[n] = NULL;
+
+        SDL_Log("Running the %s variant (%s)", variants[i].label, variants[i].mask);
+        process = SDL_CreateProcess(args, true);
+        if (!process) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run %s: %s", exe, SDL_GetError());
+            return false;
+        }
+        output = (char *)SDL_ReadProcess(process, NULL, &exitcode);
+        SDL_DestroyProcess(process);
+        if (!output || exitcode != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The %s variant failed", variants[i].label);
+            SDL_free(output);
+            return false;
+        }
+        ParseResults(state, output);
+        SDL_free(output);
+    }
+    return true;
+}
+
+static bool WriteResults(const AudioBenchState *state, const char *file, bool json)
+{
+    SDL_IOStream *out = SDL_IOFromFile(file, "w");
+    int i;
+
+    if (!out) {
+        return false;
+    }
+    if (json) {
+        SDL_IOprintf(out, "{\n  \"platform\": \"%s\",\n  \"results\": [", SDL_GetPlatform());
+        for (i = 0; i < state->num_results; ++i) {
+            const AudioBenchResult *result = &state->results[i];
+            SDL_IOprintf(out, "%s\n    { \"name\": \"%s\", \"variant\": \"%s\", \"frames_per_second\": %.1f, \"stddev\": %.1f }",
+                         i ? "," : "", result->name, result->variant, result->fps, result->stddev);
+        }
+        SDL_IOprintf(out, "\n  ]\n}\n");
+    } else {
+        SDL_IOprintf(out, "name,variant,frames_per_second,stddev\n");
+        for (i = 0; i < state->num_results; ++i) {
+            const AudioBenchResult *result = &state->results[i];
+            SDL_IOprintf(out, "%s,%s,%.1f,%.1f\n", result->name, result->variant, result->fps, result->stddev);
+        }
+    }
+    return SDL_CloseIO(out);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *common;
+    AudioBenchState state;
+    const char *cpu_mask = NULL;
+    const char *label = NULL;
+    const char *output = NULL;
+    bool child = false;
+    bool variants = false;
+    bool quick = false;
+    bool json = false;
+    int result = 0;
+    int i;
+
+    SDL_zero(state);
+    state.frames = 4096;
+    state.repeats = 10;
+    state.min_rep_ns = 5 * SDL_NS_PER_MS;
+
+    /* Initialize test framework */
+    common = SDLTest_CommonCreateState(argv, 0);
+    if (!common) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(common, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--quick") == 0) {
+                quick = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--variants") == 0) {
+                variants = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--child") == 0) {
+                child = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--csv") == 0) {
+                json = false;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--json") == 0) {
+                json = true;
+                consumed = 1;
+            } else if (argv[i + 1]) {
+                if (SDL_strcmp(argv[i], "--cpu-mask") == 0) {
+                    cpu_mask = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--label") == 0) {
+                    label = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--filter") == 0) {
+                    state.filter = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--output") == 0) {
+                    output = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--repeats") == 0) {
+                    state.repeats = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--quick]", "[--variants | --cpu-mask MASK]", "[--csv | --json]", "[--output FILE]",
+                "[--repeats N]", "[--filter TEXT]", NULL
+            };
+            SDLTest_CommonLogUsage(common, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (quick) {
+        state.frames = 1024;
+        state.repeats = 1;
+        state.min_rep_ns = 0;
+    }
+
+    /* This has to happen before anything asks about the CPU features */
+    if (cpu_mask) {
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, cpu_mask);
+    }
+    if (label) {
+        state.variant = label;
+    } else {
+        state.variant = cpu_mask ? cpu_mask : "default";
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (variants) {
+        if (!RunVariants(&state, argv[0], quick)) {
+            result = 1;
+        }
+    } else {
+        RunBenchmarks(&state);
+    }
+
+    if (child) {
+        for (i = 0; i < state.num_results; ++i) {
+            const AudioBenchResult *r = &state.results[i];
+            fprintf(stdout, "%s,%s,%.1f,%.1f\n", r->name, r->variant, r->fps, r->stddev);
+        }
+        fflush(stdout);
+    } else {
+        for (i = 0; i < state.num_results; ++i) {
+            const AudioBenchResult *r = &state.results[i];
+            SDL_Log("%-40s %-10s %14.0f frames/s  +/- %.0f", r->name, r->variant, r->fps, r->stddev);
+        }
+        if (output && !WriteResults(&state, output, json)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't write %s: %s", output, SDL_GetError());
+            result = 1;
+        }
+    }
+
+    SDL_free(state.results);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(common);
+    return result;
+}
@@ -29,6 +29,7 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &guidTestSuite,
     &hintsTestSuite,
     &intrinsicsTestSuite,
+    &jobsTestSuite,
     &joystickTestSuite,
     &keyboardTestSuite,
     &logTestSuite,
@@ -43,6 +44,7 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &iostrmTestSuite,
     &sdltestTestSuite,
     &stdlibTestSuite,
+    &storageTestSuite,
     &surfaceTestSuite,
     &timeTestSuite,
     &timerTestSuite,
@@ -1166,6 +1166,89 @@ static int SDLCALL audio_resampleLoss(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * Check that every resampler quality level tracks a sine wave.
+ *
+ * \sa SDL_CreateAudioStreamWithProperties
+ */
+static int SDLCALL audio_resampleQuality(void *arg)
+{
+    /* minimum signal-to-noise ratio in dB, for each SDL_AudioResampleQuality. A low pure tone flatters cubic
+       interpolation, the sinc filter's advantage is rejecting aliases of higher frequencies. */
+    const double min_snr[] = { 30, 60, 90, 80 };
+    const int channels = 2;
+    const int rate_in = 44100;
+    const int rate_out = 48000;
+    const int frames_in = rate_in;
+    const int frames_out = rate_out;
+    float *buf_in = (float *)SDL_malloc(frames_in * channels * sizeof(float));
+    float *buf_out = (float *)SDL_malloc(frames_out * channels * 2 * sizeof(float));
+    int quality, i, j;
+
+    SDLTest_AssertCheck(buf_in && buf_out, "Expected buffers to be allocated.");
+    if (!buf_in || !buf_out) {
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; ++i) {
+        for (j = 0; j < channels; ++j) {
+            buf_in[(i * channels) + j] = (float)sine_wave_sample(i, rate_in, 440, j * 0.5);
+        }
+    }
+
+    for (quality = SDL_AUDIO_RESAMPLE_NEAREST; quality <= SDL_AUDIO_RESAMPLE_SINC; ++quality) {
+        SDL_AudioSpec spec_in, spec_out;
+        SDL_PropertiesID props = SDL_CreateProperties();
+        SDL_AudioStream *stream;
+        double sum_squared_error = 0;
+        double sum_squared_value = 0;
+        double snr;
+        int len_out;
+
+        spec_in.format = SDL_AUDIO_F32;
+        spec_in.channels = channels;
+        spec_in.freq = rate_in;
+        spec_out.format = SDL_AUDIO_F32;
+        spec_out.channels = channels;
+        spec_out.freq = rate_out;
+
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_RESAMPLE_QUALITY_NUMBER, quality);
+        stream = SDL_CreateAudioStreamWithProperties(&spec_in, &spec_out, props);
+        SDL_DestroyProperties(props);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed.");
+        if (!stream) {
+            SDL_free(buf_in);
+            SDL_free(buf_out);
+            return TEST_ABORTED;
+        }
+
+        len_out = convert_audio_chunks(stream, buf_in, frames_in * channels * (int)sizeof(float), buf_out, frames_out * channels * 2 * (int)sizeof(float));
+        SDLTest_AssertCheck(len_out == frames_out * channels * (int)sizeof(float), "Verify output length for quality %d; expected: %d got: %d",
+                            quality, frames_out * channels * (int)sizeof(float), len_out);
+        SDL_DestroyAudioStream(stream);
+
+        /* skip the ends, where the longer filters see the silence before and after the input */
+        for (i = 100; i < frames_out - 100; ++i) {
+            for (j = 0; j < channels; ++j) {
+                const double target = sine_wave_sample(i, rate_out, 440, j * 0.5);
+                const double error = target - buf_out[(i * channels) + j];
+                sum_squared_error += error * error;
+                sum_squared_value += target * target;
+            }
+        }
+
+        snr = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+        SDLTest_AssertCheck(snr >= min_snr[quality], "Verify signal-to-noise ratio for quality %d; expected: >=%f got: %f", quality, min_snr[quality], snr);
+    }
+
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Check accuracy converting between audio formats.
  *
@@ -1460,6 +1543,807 @@ cleanup:
 
     return status;
 }
+/**
+ * Check device statistics on an open playback device that isn't being fed.
+ *
+ * \sa SDL_GetAudioDeviceStatistics
+ */
+static int SDLCALL audio_getAudioDeviceStatistics(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceStatistics stats;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    bool result;
+    int i;
+
+    result = SDL_GetAudioDeviceStatistics(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
+    SDLTest_AssertPass("Call to SDL_GetAudioDeviceStatistics(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL)");
+    SDLTest_AssertCheck(result == false, "Verify result value; expected: false got: %d", result);
+
+    result = SDL_GetAudioDeviceStatistics((SDL_AudioDeviceID)0x12345678, &stats);
+    SDLTest_AssertPass("Call to SDL_GetAudioDeviceStatistics(invalid device, &stats)");
+    SDLTest_AssertCheck(result == false, "Verify result value; expected: false got: %d", result);
+
+    SDL_zero(spec);
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL)");
+    if (!stream) {
+        SDLTest_Log("Can't open a playback device, skipping: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    devid = SDL_GetAudioStreamDevice(stream);
+    SDL_ResumeAudioStreamDevice(stream);
+
+    /* Nothing is queued, so every device iteration should count as an underrun. */
+    SDL_zero(stats);
+    for (i = 0; i < 200 && stats.underruns == 0; i++) {
+        SDL_Delay(10);
+        result = SDL_GetAudioDeviceStatistics(devid, &stats);
+        SDLTest_AssertCheck(result == true, "Verify result value; expected: true got: %d", result);
+    }
+    SDLTest_AssertCheck(stats.underruns > 0, "Verify underruns; expected: >0 got: %" SDL_PRIu64, stats.underruns);
+    SDLTest_AssertCheck(stats.silence_frames >= stats.underruns, "Verify silence frames; expected: >=%" SDL_PRIu64 " got: %" SDL_PRIu64, stats.underruns, stats.silence_frames);
+    SDLTest_AssertCheck(stats.last_iteration_ns > 0, "Verify last iteration time; expected: >0 got: %" SDL_PRIu64, stats.last_iteration_ns);
+
+    result = SDL_GetAudioDeviceStatistics(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &stats);
+    SDLTest_AssertPass("Call to SDL_GetAudioDeviceStatistics(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &stats)");
+    SDLTest_AssertCheck(result == true, "Verify result value; expected: true got: %d", result);
+
+    SDL_DestroyAudioStream(stream);
+    SDLTest_AssertPass("Call to SDL_DestroyAudioStream");
+
+    return TEST_COMPLETED;
+}
+
+/* Reads everything from a stream, to compare with what SDL_LoadWAV_IO gives. */
+static Uint8 *ReadWholeAudioStream(SDL_AudioStream *stream, int *len)
+{
+    Uint8 *buf = NULL;
+    int total = 0;
+    int alloc = 0;
+    while (true) {
+        int br;
+        if (alloc - total < 4096) {
+            Uint8 *ptr = (Uint8 *)SDL_realloc(buf, alloc + 65536);
+            if (!ptr) {
+                break;
+            }
+            buf = ptr;
+            alloc += 65536;
+        }
+        /* odd request sizes, so reads don't line up with the decoder's blocks */
+        br = SDL_GetAudioStreamData(stream, buf + total, 1000);
+        if (br <= 0) {
+            break;
+        }
+        total += br;
+    }
+    *len = total;
+    return buf;
+}
+
+static void CheckWAVStreamMatchesLoad(SDL_IOStream *io, const char *desc)
+{
+    SDL_AudioSpec loadspec, streamspec;
+    SDL_AudioStream *stream;
+    Uint8 *loadbuf = NULL;
+    Uint8 *streambuf;
+    Uint32 loadlen = 0;
+    int streamlen = 0;
+    bool result;
+
+    result = SDL_LoadWAV_IO(io, false, &loadspec, &loadbuf, &loadlen);
+    SDLTest_AssertCheck(result == true, "Verify SDL_LoadWAV_IO(%s) result; expected: true got: %d", desc, result);
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+    stream = SDL_OpenWAVStream_IO(io, true, &streamspec);
+    SDLTest_AssertPass("Call to SDL_OpenWAVStream_IO(%s, true, &spec)", desc);
+    SDLTest_AssertCheck(stream != NULL, "Verify stream; expected: non-NULL got: %p", (void *)stream);
+    if (!stream) {
+        SDL_free(loadbuf);
+        return;
+    }
+    SDLTest_AssertCheck(SDL_memcmp(&loadspec, &streamspec, sizeof(SDL_AudioSpec)) == 0,
+                        "Verify spec; expected: %d/%d/%d got: %d/%d/%d",
+                        loadspec.format, loadspec.channels, loadspec.freq, streamspec.format, streamspec.channels, streamspec.freq);
+
+    streambuf = ReadWholeAudioStream(stream, &streamlen);
+    SDLTest_AssertCheck(streamlen == (int)loadlen, "Verify decoded length; expected: %d got: %d", (int)loadlen, streamlen);
+    SDLTest_AssertCheck(streambuf && streamlen == (int)loadlen && SDL_memcmp(loadbuf, streambuf, loadlen) == 0, "Verify decoded data matches SDL_LoadWAV_IO");
+
+    SDL_free(streambuf);
+    SDL_free(loadbuf);
+    SDL_DestroyAudioStream(stream);
+}
+
+/**
+ * Check that streaming a WAVE file decodes the same data as loading it.
+ *
+ * \sa SDL_OpenWAVStream_IO
+ * \sa SDL_LoadWAV_IO
+ */
+static int SDLCALL audio_openWAVStream(void *arg)
+{
+    const Uint32 num_frames = 5000;
+    const Uint32 datalen = num_frames * 2 * 3;
+    Uint8 *wav;
+    Uint8 *ptr;
+    char *path = NULL;
+    SDL_IOStream *io;
+    SDL_AudioStream *stream;
+    Uint32 i;
+
+    stream = SDL_OpenWAVStream_IO(NULL, false, NULL);
+    SDLTest_AssertCheck(stream == NULL, "Verify SDL_OpenWAVStream_IO(NULL) fails");
+
+    /* A 24-bit stereo PCM file, which gets expanded to 32 bits as it's decoded. */
+    wav = (Uint8 *)SDL_malloc(44 + datalen);
+    SDLTest_AssertCheck(wav != NULL, "Verify WAVE buffer allocation");
+    if (!wav) {
+        return TEST_ABORTED;
+    }
+    ptr = wav;
+#define PUT32(v) do { Uint32 v32 = SDL_Swap32LE(v); SDL_memcpy(ptr, &v32, 4); ptr += 4; } while (0)
+#define PUT16(v) do { Uint16 v16 = SDL_Swap16LE(v); SDL_memcpy(ptr, &v16, 2); ptr += 2; } while (0)
+    PUT32(0x46464952); PUT32(36 + datalen); PUT32(0x45564157);  /* "RIFF", length, "WAVE" */
+    PUT32(0x20746D66); PUT32(16);                                /* "fmt ", length */
+    PUT16(1); PUT16(2); PUT32(48000); PUT32(48000 * 6); PUT16(6); PUT16(24);
+    PUT32(0x61746164); PUT32(datalen);                           /* "data", length */
+#undef PUT32
+#undef PUT16
+    for (i = 0; i < datalen; i++) {
+        ptr[i] = (Uint8)(i * 7 + (i >> 8));
+    }
+
+    io = SDL_IOFromConstMem(wav, 44 + datalen);
+    if (io) {
+        CheckWAVStreamMatchesLoad(io, "24-bit PCM");
+    }
+
+    /* A truncated data chunk, to check the stream ends where the loader stops. */
+    io = SDL_IOFromConstMem(wav, 44 + datalen - 1000);
+    if (io) {
+        CheckWAVStreamMatchesLoad(io, "truncated 24-bit PCM");
+    }
+    SDL_free(wav);
+
+    /* MS ADPCM, from the test resources, if they're there. */
+    if (SDL_asprintf(&path, "%ssample.wav", SDL_GetBasePath()) > 0) {
+        io = SDL_IOFromFile(path, "rb");
+        if (io) {
+            CheckWAVStreamMatchesLoad(io, "sample.wav");
+        } else {
+            SDLTest_Log("Couldn't open %s, skipping the ADPCM check", path);
+        }
+        SDL_free(path);
+    }
+
+    return TEST_COMPLETED;
+}
+
+static Sint16 ReferenceALawSample(Uint8 value)
+{
+    Uint8 exponent = (value & 0x7f) ^ 0x55;
+    Sint32 mantissa = exponent & 0xf;
+
+    exponent >>= 4;
+    if (exponent > 0) {
+        mantissa |= 0x10;
+    }
+    mantissa = (mantissa << 4) | 0x8;
+    if (exponent > 1) {
+        mantissa <<= exponent - 1;
+    }
+    return (Sint16)(value & 0x80 ? mantissa : -mantissa);
+}
+
+static Sint16 ReferenceMuLawSample(Uint8 value)
+{
+    const Uint8 nibble = ~value;
+    const Sint32 exponent = (nibble >> 4) & 0x7;
+    const Sint32 step = 4 << (exponent + 1);
+    const Sint32 mantissa = (0x80 << exponent) + step * (nibble & 0xf) + step / 2 - 132;
+
+    return (Sint16)(nibble & 0x80 ? -mantissa : mantissa);
+}
+
+/**
+ * Check that A-law and mu-law WAVE files decode every byte value exactly.
+ *
+ * \sa SDL_LoadWAV_IO
+ */
+static int SDLCALL audio_loadCompandedWAV(void *arg)
+{
+    /* Enough samples for the vectorized decoders, with a few left over for the scalar loop. */
+    const Uint32 datalen = 256 * 4 + 7;
+    const Uint16 formattags[] = { 6, 7 };
+    const char *names[] = { "A-law", "mu-law" };
+    Uint8 *wav;
+    Uint8 *ptr;
+    int t;
+    Uint32 i;
+
+    wav = (Uint8 *)SDL_malloc(44 + datalen);
+    SDLTest_AssertCheck(wav != NULL, "Verify WAVE buffer allocation");
+    if (!wav) {
+        return TEST_ABORTED;
+    }
+
+    for (t = 0; t < (int)SDL_arraysize(formattags); t++) {
+        SDL_AudioSpec spec;
+        Uint8 *buf = NULL;
+        Uint32 len = 0;
+        Uint32 mismatches = 0;
+        bool result;
+
+        ptr = wav;
+#define PUT32(v) do { Uint32 v32 = SDL_Swap32LE(v); SDL_memcpy(ptr, &v32, 4); ptr += 4; } while (0)
+#define PUT16(v) do { Uint16 v16 = SDL_Swap16LE(v); SDL_memcpy(ptr, &v16, 2); ptr += 2; } while (0)
+        PUT32(0x46464952); PUT32(36 + datalen); PUT32(0x45564157);  /* "RIFF", length, "WAVE" */
+        PUT32(0x20746D66); PUT32(16);                                /* "fmt ", length */
+        PUT16(formattags[t]); PUT16(1); PUT32(8000); PUT32(8000); PUT16(1); PUT16(8);
+        PUT32(0x61746164); PUT32(datalen);                           /* "data", length */
+#undef PUT32
+#undef PUT16
+        for (i = 0; i < datalen; i++) {
+            ptr[i] = (Uint8)(i * 151 + (i >> 8));
+        }
+
+        result = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, 44 + datalen), true, &spec, &buf, &len);
+        SDLTest_AssertCheck(result == true, "Verify loading %s WAVE; expected: true, got: %d", names[t], result);
+        if (!result) {
+            continue;
+        }
+        SDLTest_AssertCheck(spec.format == SDL_AUDIO_S16, "Verify %s decodes to SDL_AUDIO_S16; got: %s", names[t], SDL_GetAudioFormatName(spec.format));
+        SDLTest_AssertCheck(len == datalen * 2, "Verify decoded length; expected: %u, got: %u", (unsigned int)(datalen * 2), (unsigned int)len);
+
+        if (len == datalen * 2) {
+            const Sint16 *samples = (const Sint16 *)buf;
+            for (i = 0; i < datalen; i++) {
+                const Sint16 expected = formattags[t] == 6 ? ReferenceALawSample(ptr[i]) : ReferenceMuLawSample(ptr[i]);
+                if (samples[i] != expected) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify %s samples match the reference; expected 0 mismatches, got %u", names[t], (unsigned int)mismatches);
+        SDL_free(buf);
+    }
+
+    SDL_free(wav);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a playback device with mixing threads drains all of its bound streams.
+ *
+ * \sa SDL_HINT_AUDIO_DEVICE_MIX_THREADS
+ */
+static int SDLCALL audio_mixThreads(void *arg)
+{
+    const int num_streams = 4;
+    const int num_frames = 4410;
+    SDL_AudioStream *streams[4];
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceID devid;
+    float *samples;
+    bool result;
+    int init_count = 0;
+    int i, j;
+
+    /* The physical device may already be open, and the hint only applies when it opens, so restart the subsystem. */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        init_count++;
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, "2");
+    result = SDL_InitSubSystem(SDL_INIT_AUDIO);
+    SDLTest_AssertCheck(result == true, "Check result from SDL_InitSubSystem(SDL_INIT_AUDIO)");
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL)");
+    samples = (float *)SDL_malloc(num_frames * 2 * sizeof(float));
+    if (!devid || !samples) {
+        SDLTest_Log("Can't open a playback device, skipping: %s", SDL_GetError());
+        SDL_free(samples);
+        SDL_CloseAudioDevice(devid);
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+        for (i = 0; i < init_count; i++) {
+            SDL_InitSubSystem(SDL_INIT_AUDIO);
+        }
+        return TEST_SKIPPED;
+    }
+    for (i = 0; i < num_frames * 2; i++) {
+        samples[i] = 0.1f * SDL_sinf((float)i * 0.01f);
+    }
+
+    /* A non-device rate, so every stream has to be resampled. */
+    SDL_zero(spec);
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 44100;
+    for (i = 0; i < num_streams; i++) {
+        streams[i] = SDL_CreateAudioStream(&spec, NULL);
+        SDLTest_AssertCheck(streams[i] != NULL, "Verify SDL_CreateAudioStream succeeded");
+    }
+
+    /* Lock the streams so the device can't start draining any of them until they're all filled. */
+    for (i = 0; i < num_streams; i++) {
+        SDL_LockAudioStream(streams[i]);
+    }
+
+    result = SDL_BindAudioStreams(devid, streams, num_streams);
+    SDLTest_AssertPass("Call to SDL_BindAudioStreams(devid, streams, %d)", num_streams);
+    SDLTest_AssertCheck(result == true, "Verify result value; expected: true got: %d", result);
+
+    for (i = 0; i < num_streams; i++) {
+        result = SDL_PutAudioStreamData(streams[i], samples, num_frames * 2 * sizeof(float));
+        SDLTest_AssertCheck(result == true, "Verify SDL_PutAudioStreamData result; expected: true got: %d", result);
+        SDL_FlushAudioStream(streams[i]);
+    }
+    for (i = 0; i < num_streams; i++) {
+        SDL_UnlockAudioStream(streams[i]);
+    }
+
+    for (i = 0; i < 200; i++) {
+        int remaining = 0;
+        for (j = 0; j < num_streams; j++) {
+            remaining += SDL_GetAudioStreamAvailable(streams[j]);
+        }
+        if (remaining == 0) {
+            break;
+        }
+        SDL_Delay(10);
+    }
+    for (j = 0; j < num_streams; j++) {
+        const int available = SDL_GetAudioStreamAvailable(streams[j]);
+        SDLTest_AssertCheck(available == 0, "Verify stream %d was drained; expected: 0 got: %d", j, available);
+    }
+
+    SDL_CloseAudioDevice(devid);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice");
+    for (i = 0; i < num_streams; i++) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(samples);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    for (i = 0; i < init_count; i++) {
+        result = SDL_InitSubSystem(SDL_INIT_AUDIO);
+        SDLTest_AssertCheck(result == true, "Check result from SDL_InitSubSystem(SDL_INIT_AUDIO)");
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a single-producer stream keeps data in order, whether it goes through the ring buffer or not.
+ *
+ * \sa SDL_CreateAudioStreamWithProperties
+ */
+static int SDLCALL audio_singleProducerStream(void *arg)
+{
+    const int num_samples = 48000;
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    SDL_PropertiesID props;
+    Sint16 *input = (Sint16 *)SDL_malloc(num_samples * sizeof(Sint16));
+    Sint16 *output = (Sint16 *)SDL_calloc(num_samples, sizeof(Sint16));
+    int put = 0, got = 0, i, mismatches = 0;
+
+    SDLTest_AssertCheck(input && output, "Expected buffers to be allocated.");
+    if (!input || !output) {
+        SDL_free(input);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < num_samples; i++) {
+        input[i] = (Sint16)i;
+    }
+
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 2;
+    spec.freq = 48000;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BOOLEAN, true);
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SINGLE_PRODUCER_BUFFER_SIZE_NUMBER, 4096);
+    stream = SDL_CreateAudioStreamWithProperties(&spec, &spec, props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertPass("Call to SDL_CreateAudioStreamWithProperties(single producer)");
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed.");
+    if (!stream) {
+        SDL_free(input);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    /* Mix small puts (which fit in the ring) with large ones (which don't), and read in between. */
+    while (put < num_samples) {
+        const int chunk = (SDLTest_RandomIntegerInRange(0, 3) == 0) ? 4000 : 64;
+        const int samples = SDL_min(num_samples - put, chunk);
+        bool result = SDL_PutAudioStreamData(stream, &input[put], samples * (int)sizeof(Sint16));
+        SDLTest_AssertCheck(result == true, "Verify SDL_PutAudioStreamData result; expected: true got: %d", result);
+        put += samples;
+
+        if (SDLTest_RandomIntegerInRange(0, 1)) {
+            const int bytes = SDL_GetAudioStreamData(stream, &output[got], (num_samples - got) * (int)sizeof(Sint16));
+            SDLTest_AssertCheck(bytes >= 0, "Verify SDL_GetAudioStreamData result; expected: >=0 got: %d", bytes);
+            got += SDL_max(bytes, 0) / (int)sizeof(Sint16);
+        }
+    }
+
+    i = SDL_GetAudioStreamAvailable(stream);
+    SDLTest_AssertCheck(i == (num_samples - got) * (int)sizeof(Sint16),
+                        "Verify available bytes include data still in the ring; expected: %d got: %d", (num_samples - got) * (int)sizeof(Sint16), i);
+
+    SDL_FlushAudioStream(stream);
+    i = SDL_GetAudioStreamData(stream, &output[got], (num_samples - got) * (int)sizeof(Sint16));
+    got += SDL_max(i, 0) / (int)sizeof(Sint16);
+    SDLTest_AssertCheck(got == num_samples, "Verify all samples came back out; expected: %d got: %d", num_samples, got);
+
+    for (i = 0; i < num_samples; i++) {
+        if (output[i] != input[i]) {
+            mismatches++;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify samples came out in order; expected 0 mismatches, got %d", mismatches);
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(input);
+    SDL_free(output);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that resampling interleaved multichannel audio matches resampling each channel on its own.
+ *
+ * \sa SDL_CreateAudioStream
+ */
+static int SDLCALL audio_resampleChannels(void *arg)
+{
+    const int rates[][2] = { { 44100, 88200 }, { 48000, 96000 }, { 96000, 48000 }, { 44100, 48000 } };
+    const int frames_in = 4800;
+    const int max_frames_out = frames_in * 2 + 64;
+    float *mono_in = (float *)SDL_malloc(frames_in * sizeof(float));
+    float *mono_out = (float *)SDL_malloc(max_frames_out * sizeof(float) * 8);
+    float *multi_in = (float *)SDL_malloc(frames_in * sizeof(float) * 8);
+    float *multi_out = (float *)SDL_malloc(max_frames_out * sizeof(float) * 8);
+    int i, j, chans, rate_idx;
+
+    SDLTest_AssertCheck(mono_in && mono_out && multi_in && multi_out, "Expected buffers to be allocated.");
+    if (!mono_in || !mono_out || !multi_in || !multi_out) {
+        SDL_free(mono_in);
+        SDL_free(mono_out);
+        SDL_free(multi_in);
+        SDL_free(multi_out);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; i++) {
+        mono_in[i] = (float)sine_wave_sample(i, 44100, 440, 0) * 0.5f;
+    }
+
+    for (rate_idx = 0; rate_idx < (int)SDL_arraysize(rates); rate_idx++) {
+        for (chans = 1; chans <= 8; chans++) {
+            SDL_AudioSpec spec_in, spec_out;
+            SDL_AudioStream *stream;
+            int mono_frames, multi_frames;
+            float max_error = 0.0f;
+
+            spec_in.format = spec_out.format = SDL_AUDIO_F32;
+            spec_in.freq = rates[rate_idx][0];
+            spec_out.freq = rates[rate_idx][1];
+
+            /* Resample the mono reference. */
+            spec_in.channels = spec_out.channels = 1;
+            stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+            SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+            SDL_PutAudioStreamData(stream, mono_in, frames_in * sizeof(float));
+            SDL_FlushAudioStream(stream);
+            mono_frames = SDL_GetAudioStreamData(stream, mono_out, max_frames_out * sizeof(float)) / (int)sizeof(float);
+            SDL_DestroyAudioStream(stream);
+
+            /* Each channel gets its own scaled copy of the signal. */
+            for (i = 0; i < frames_in; i++) {
+                for (j = 0; j < chans; j++) {
+                    multi_in[i * chans + j] = mono_in[i] * (1.0f - j * 0.1f);
+                }
+            }
+
+            spec_in.channels = spec_out.channels = chans;
+            stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+            SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+            SDL_PutAudioStreamData(stream, multi_in, frames_in * chans * sizeof(float));
+            SDL_FlushAudioStream(stream);
+            multi_frames = SDL_GetAudioStreamData(stream, multi_out, max_frames_out * chans * sizeof(float)) / (int)(chans * sizeof(float));
+            SDL_DestroyAudioStream(stream);
+
+            SDLTest_AssertCheck(mono_frames == multi_frames, "Resampled %d channels from %d Hz to %d Hz; expected %d frames, got %d",
+                                chans, spec_in.freq, spec_out.freq, mono_frames, multi_frames);
+
+            for (i = 0; i < SDL_min(mono_frames, multi_frames); i++) {
+                for (j = 0; j < chans; j++) {
+                    const float error = SDL_fabsf(multi_out[i * chans + j] - mono_out[i] * (1.0f - j * 0.1f));
+                    max_error = SDL_max(max_error, error);
+                }
+            }
+            SDLTest_AssertCheck(max_error <= 1e-5f, "Resampled %d channels from %d Hz to %d Hz; maximum difference from mono %g should be no more than 1e-5",
+                                chans, spec_in.freq, spec_out.freq, max_error);
+        }
+    }
+
+    SDL_free(mono_in);
+    SDL_free(mono_out);
+    SDL_free(multi_in);
+    SDL_free(multi_out);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check mixing native float audio, including clamping, volume scaling, and buffer lengths that don't fill a vector.
+ *
+ * \sa SDL_MixAudio
+ */
+static int SDLCALL audio_mixAudioFloat(void *arg)
+{
+    const float volumes[] = { 1.0f, 0.5f, 0.25f };
+    float src[67];
+    float dst[SDL_arraysize(src)];
+    float expected[SDL_arraysize(src)];
+    int lengths[] = { 1, 3, 4, 7, 8, 15, 16, 17, 33, (int)SDL_arraysize(src) };
+    int i, j, k;
+
+    for (i = 0; i < (int)SDL_arraysize(volumes); i++) {
+        for (j = 0; j < (int)SDL_arraysize(lengths); j++) {
+            const int num_samples = lengths[j];
+            int mismatches = 0;
+            bool result;
+
+            for (k = 0; k < (int)SDL_arraysize(src); k++) {
+                src[k] = SDLTest_RandomUnitFloat() * 3.0f - 1.5f;
+                dst[k] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                expected[k] = dst[k];
+                if (k < num_samples) {
+                    expected[k] = (src[k] * volumes[i]) + expected[k];
+                    if (expected[k] > 1.0f) {
+                        expected[k] = 1.0f;
+                    } else if (expected[k] < -1.0f) {
+                        expected[k] = -1.0f;
+                    }
+                }
+            }
+
+            result = SDL_MixAudio((Uint8 *)dst, (const Uint8 *)src, SDL_AUDIO_F32, num_samples * sizeof(float), volumes[i]);
+            SDLTest_AssertCheck(result == true, "Verify result value; expected: true got: %d", result);
+
+            for (k = 0; k < (int)SDL_arraysize(src); k++) {
+                if (dst[k] != expected[k]) {
+                    mismatches++;
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Mixing %d samples at volume %f; expected 0 mismatched samples, got %d", num_samples, volumes[i], mismatches);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a target latency speeds up or slows down consumption of queued input.
+ *
+ * \sa SDL_SetAudioStreamTargetLatency
+ */
+static int SDLCALL audio_targetLatency(void *arg)
+{
+    const int freq = 48000;
+    const int output_frames = 4800;
+    const int input_frames = freq / 2;
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    float *input = (float *)SDL_calloc(input_frames, sizeof(float));
+    float *output = (float *)SDL_calloc(output_frames, sizeof(float));
+    int queued, consumed, i;
+    bool result;
+
+    SDLTest_AssertCheck(input && output, "Expected buffers to be allocated.");
+    if (!input || !output) {
+        SDL_free(input);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < input_frames; i++) {
+        input[i] = SDL_sinf((float)i * 0.05f) * 0.5f;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 1;
+    spec.freq = freq;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (!stream) {
+        SDL_free(input);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    result = SDL_SetAudioStreamTargetLatency(stream, -1, 0.01f);
+    SDLTest_AssertCheck(result == false, "Verify a negative target is rejected; got: %d", result);
+    result = SDL_SetAudioStreamTargetLatency(stream, 100, 0.75f);
+    SDLTest_AssertCheck(result == false, "Verify an excessive deviation is rejected; got: %d", result);
+
+    /* With no target, input is consumed at exactly the normal rate */
+    SDL_PutAudioStreamData(stream, input, input_frames * (int)sizeof(float));
+    queued = SDL_GetAudioStreamQueued(stream);
+    SDL_GetAudioStreamData(stream, output, output_frames * (int)sizeof(float));
+    consumed = (queued - SDL_GetAudioStreamQueued(stream)) / (int)sizeof(float);
+    SDLTest_AssertCheck(consumed == output_frames, "Verify normal rate without a target; expected: %d got: %d", output_frames, consumed);
+
+    /* Well above the target, the stream should play faster to drain the queue */
+    SDL_ClearAudioStream(stream);
+    result = SDL_SetAudioStreamTargetLatency(stream, 100, 0.01f);
+    SDLTest_AssertCheck(result == true, "Verify SDL_SetAudioStreamTargetLatency result; expected: true got: %d", result);
+    SDL_PutAudioStreamData(stream, input, input_frames * (int)sizeof(float));
+    queued = SDL_GetAudioStreamQueued(stream);
+    SDL_GetAudioStreamData(stream, output, output_frames * (int)sizeof(float));
+    consumed = (queued - SDL_GetAudioStreamQueued(stream)) / (int)sizeof(float);
+    SDLTest_AssertCheck(consumed > output_frames + 30 && consumed <= output_frames + 50,
+                        "Verify the queue drains faster above the target; expected about %d got: %d", output_frames + 48, consumed);
+
+    /* Below the target, it should play slower to let the queue fill up */
+    SDL_ClearAudioStream(stream);
+    result = SDL_SetAudioStreamTargetLatency(stream, 1000, 0.01f);
+    SDLTest_AssertCheck(result == true, "Verify SDL_SetAudioStreamTargetLatency result; expected: true got: %d", result);
+    SDL_PutAudioStreamData(stream, input, input_frames * (int)sizeof(float));
+    queued = SDL_GetAudioStreamQueued(stream);
+    SDL_GetAudioStreamData(stream, output, output_frames * (int)sizeof(float));
+    consumed = (queued - SDL_GetAudioStreamQueued(stream)) / (int)sizeof(float);
+    SDLTest_AssertCheck(consumed < output_frames - 15 && consumed >= output_frames - 30,
+                        "Verify the queue drains slower below the target; expected about %d got: %d", output_frames - 24, consumed);
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(input);
+    SDL_free(output);
+
+    return TEST_COMPLETED;
+}
+
+/* Device frames of the first and last non-silent samples, written by the postmix callback. */
+static Uint64 g_scheduled_first_frame;
+static Uint64 g_scheduled_last_frame;
+static Uint64 g_scheduled_stop_frame;
+static SDL_AtomicInt g_scheduled_done;
+
+static void SDLCALL audio_scheduledPostmixCallback(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const SDL_AudioDeviceID devid = *(const SDL_AudioDeviceID *)userdata;
+    const int frames = buflen / (int)(sizeof(float) * spec->channels);
+    SDL_AudioDeviceStatistics stats;
+    int i;
+
+    /* the counter is bumped after the postmix callback, so this is where the buffer starts. */
+    if (!SDL_GetAudioDeviceStatistics(devid, &stats)) {
+        return;
+    }
+
+    for (i = 0; i < frames; i++) {
+        if (buffer[i * spec->channels] != 0.0f) {
+            if (!g_scheduled_first_frame) {
+                g_scheduled_first_frame = stats.frames_mixed + i;
+            }
+            g_scheduled_last_frame = stats.frames_mixed + i;
+        }
+    }
+
+    if (g_scheduled_stop_frame && stats.frames_mixed + frames > g_scheduled_stop_frame) {
+        SDL_SetAtomicInt(&g_scheduled_done, 1);
+    }
+}
+
+/**
+ * Check that a scheduled stream starts and stops at exactly the requested device frames.
+ *
+ * \sa SDL_ScheduleAudioStream
+ * \sa SDL_GetAudioDeviceFrameTicksNS
+ */
+static int SDLCALL audio_scheduledStream(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceStatistics stats;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    Uint64 start_frame, stop_frame, ticks;
+    float *data;
+    int frames, i;
+    bool result;
+
+    result = SDL_ScheduleAudioStream(NULL, 0, 0);
+    SDLTest_AssertCheck(result == false, "Verify a NULL stream is rejected; got: %d", result);
+
+    SDL_zero(spec);
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL)");
+    if (!stream) {
+        SDLTest_Log("Can't open a playback device, skipping: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    result = SDL_ScheduleAudioStream(stream, 1000, 1000);
+    SDLTest_AssertCheck(result == false, "Verify a stop frame at the start frame is rejected; got: %d", result);
+
+    /* feed the stream in the device's format, so no resampling smears the edges. */
+    SDL_GetAudioStreamFormat(stream, NULL, &spec);
+    spec.format = SDL_AUDIO_F32;
+    SDL_SetAudioStreamFormat(stream, &spec, NULL);
+
+    devid = SDL_GetAudioStreamDevice(stream);
+    g_scheduled_first_frame = 0;
+    g_scheduled_last_frame = 0;
+    g_scheduled_stop_frame = 0;
+    SDL_SetAtomicInt(&g_scheduled_done, 0);
+    result = SDL_SetAudioPostmixCallback(devid, audio_scheduledPostmixCallback, &devid);
+    SDLTest_AssertCheck(result == true, "Verify SDL_SetAudioPostmixCallback result; expected: true got: %d", result);
+
+    SDL_ResumeAudioStreamDevice(stream);
+    SDL_Delay(50);
+
+    SDL_zero(stats);
+    result = SDL_GetAudioDeviceStatistics(devid, &stats);
+    SDLTest_AssertCheck(result == true, "Verify SDL_GetAudioDeviceStatistics result; expected: true got: %d", result);
+
+    start_frame = stats.frames_mixed + (spec.freq / 10);
+    stop_frame = start_frame + 1000;
+
+    SDL_LockAudioStream(stream);
+    frames = spec.freq / 2;
+    data = (float *)SDL_malloc(frames * spec.channels * sizeof(float));
+    SDLTest_AssertCheck(data != NULL, "Expected buffer to be allocated.");
+    if (data) {
+        for (i = 0; i < frames * spec.channels; i++) {
+            data[i] = 0.5f;
+        }
+        SDL_PutAudioStreamData(stream, data, frames * spec.channels * (int)sizeof(float));
+        SDL_free(data);
+    }
+    result = SDL_ScheduleAudioStream(stream, start_frame, stop_frame);
+    SDLTest_AssertCheck(result == true, "Verify SDL_ScheduleAudioStream result; expected: true got: %d", result);
+    g_scheduled_stop_frame = stop_frame;
+    SDL_UnlockAudioStream(stream);
+
+    ticks = SDL_GetAudioDeviceFrameTicksNS(devid, start_frame);
+    SDLTest_AssertCheck(ticks > SDL_GetTicksNS(), "Verify the start frame is in the future; got: %" SDL_PRIu64, ticks);
+
+    for (i = 0; i < 200 && !SDL_GetAtomicInt(&g_scheduled_done); i++) {
+        SDL_Delay(10);
+    }
+    SDL_PauseAudioStreamDevice(stream);  /* waits for the device thread, so the callback is done writing. */
+
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_scheduled_done) == 1, "Verify the device played past the stop frame");
+    SDLTest_AssertCheck(g_scheduled_first_frame == start_frame, "Verify first frame; expected: %" SDL_PRIu64 " got: %" SDL_PRIu64, start_frame, g_scheduled_first_frame);
+    SDLTest_AssertCheck(g_scheduled_last_frame == stop_frame - 1, "Verify last frame; expected: %" SDL_PRIu64 " got: %" SDL_PRIu64, stop_frame - 1, g_scheduled_last_frame);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) > 0, "Verify data past the stop frame is still queued");
+
+    SDL_DestroyAudioStream(stream);
+    SDLTest_AssertPass("Call to SDL_DestroyAudioStream");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1541,13 +2425,54 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_getAudioDeviceStatistics, "audio_getAudioDeviceStatistics", "Check underrun and timing statistics of an open playback device.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_mixAudioFloat, "audio_mixAudioFloat", "Check mixing native float audio with SDL_MixAudio.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_resampleChannels, "audio_resampleChannels", "Check multichannel resampling against per-channel mono resampling.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_singleProducerStream, "audio_singleProducerStream", "Check ordering of data put into a single-producer audio stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_mixThreads, "audio_mixThreads", "Check that mixing threads drain every bound stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_openWAVStream, "audio_openWAVStream", "Check that streaming a WAVE file decodes the same data as loading it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_loadCompandedWAV, "audio_loadCompandedWAV", "Check that A-law and mu-law WAVE files decode exactly.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_targetLatency, "audio_targetLatency", "Check that a target latency adjusts how fast queued input is consumed.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    audio_scheduledStream, "audio_scheduledStream", "Check that a scheduled stream starts and stops at the requested device frames.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest28 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check the accuracy of each resampler quality level.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22,
+    &audioTest23, &audioTest24, &audioTest25, &audioTest26, &audioTest27, &audioTest28, NULL
 };
 
 /* Audio test suite (global) */
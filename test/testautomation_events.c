@@ -102,6 +102,220 @@ static int SDLCALL events_pushPumpAndPollUserevent(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Checks that SDL_HasEvent and SDL_HasEvents track queued event types.
+ *
+ * \sa SDL_HasEvent
+ * \sa SDL_HasEvents
+ * \sa SDL_FlushEvent
+ */
+static int SDLCALL events_hasEvents(void *arg)
+{
+    SDL_Event event;
+
+    /* Flush all events */
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST), "Check SDL_HasEvents returns false for an empty queue");
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER + 0x101;
+    SDL_PushEvent(&event);
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_USER + 0x101), "Check SDL_HasEvent returns true for the pushed type");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 0x100), "Check SDL_HasEvent returns false for a neighboring type");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 0x1), "Check SDL_HasEvent returns false for the same type in another block");
+    SDLTest_AssertCheck(SDL_HasEvents(SDL_EVENT_USER, SDL_EVENT_LAST), "Check SDL_HasEvents returns true for a range spanning blocks");
+    SDLTest_AssertCheck(SDL_HasEvents(SDL_EVENT_USER + 0x101, SDL_EVENT_USER + 0x101), "Check SDL_HasEvents returns true for a single type range");
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_USER + 0x102, SDL_EVENT_USER + 0x1ff), "Check SDL_HasEvents returns false for the rest of the block");
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_USER + 0x101, SDL_EVENT_USER), "Check SDL_HasEvents returns false for an inverted range");
+
+    /* Removing one of the two events must leave the other one visible */
+    SDLTest_AssertCheck(SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER + 0x101, SDL_EVENT_USER + 0x101) == 1, "Check SDL_PeepEvents removes one event");
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_USER + 0x101), "Check SDL_HasEvent returns true with one event left");
+
+    SDL_FlushEvent(SDL_EVENT_USER + 0x101);
+    SDLTest_AssertPass("Call to SDL_FlushEvent()");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 0x101), "Check SDL_HasEvent returns false after flushing");
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_USER, SDL_EVENT_LAST), "Check SDL_HasEvents returns false after flushing");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Checks that events retrieved and flushed by type keep their order.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_FlushEvent
+ */
+static int SDLCALL events_peepEventsByType(void *arg)
+{
+    SDL_Event events[8];
+    SDL_Event event;
+    int i, result;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Alternate between types in two different blocks of 256 types */
+    SDL_zeroa(events);
+    for (i = 0; i < SDL_arraysize(events); ++i) {
+        events[i].type = (i & 1) ? SDL_EVENT_USER + 0x500 : SDL_EVENT_USER + 0x400;
+        events[i].user.code = i;
+    }
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result == SDL_arraysize(events), "Check result of SDL_PushEvents(), expected: %d, got: %d", (int)SDL_arraysize(events), result);
+
+    /* Take the first two events of one type */
+    result = SDL_PeepEvents(events, 2, SDL_GETEVENT, SDL_EVENT_USER + 0x400, SDL_EVENT_USER + 0x400);
+    SDLTest_AssertCheck(result == 2, "Check SDL_PeepEvents() by type, expected: 2, got: %d", result);
+    SDLTest_AssertCheck(events[0].user.code == 0 && events[1].user.code == 2, "Check events by type are in order, got: %d, %d", events[0].user.code, events[1].user.code);
+
+    /* A range spanning both blocks sees the rest in queue order */
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, SDL_EVENT_USER + 0x400, SDL_EVENT_USER + 0x5ff);
+    SDLTest_AssertCheck(result == 6, "Check SDL_PeepEvents() across blocks, expected: 6, got: %d", result);
+    if (result == 6) {
+        static const int expected[] = { 1, 3, 4, 5, 6, 7 };
+        for (i = 0; i < result; ++i) {
+            SDLTest_AssertCheck(events[i].user.code == expected[i], "Check event order, expected code: %d, got: %d", expected[i], events[i].user.code);
+        }
+    }
+
+    SDL_FlushEvent(SDL_EVENT_USER + 0x500);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 0x500), "Check SDL_FlushEvent() removed all events of the type");
+
+    i = 4;
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST) == 1) {
+        SDLTest_AssertCheck(event.type == SDL_EVENT_USER + 0x400 && event.user.code == i, "Check remaining event, expected code: %d, got: %d", i, event.user.code);
+        i += 2;
+    }
+    SDLTest_AssertCheck(i == SDL_arraysize(events), "Check that the other type was kept");
+
+    return TEST_COMPLETED;
+}
+
+/* Event filter that rejects events with an odd user code */
+static bool SDLCALL events_oddCodeEventFilter(void *userdata, SDL_Event *event)
+{
+    return (event->type != SDL_EVENT_USER + 0x300) || ((event->user.code & 1) == 0);
+}
+
+/**
+ * Pushes an array of events, some of which are rejected by the event filter.
+ *
+ * \sa SDL_PushEvents
+ * \sa SDL_SetEventFilter
+ */
+static int SDLCALL events_pushEvents(void *arg)
+{
+    SDL_Event events[6];
+    SDL_Event event;
+    int i, result, expected_code;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    SDL_zeroa(events);
+    for (i = 0; i < SDL_arraysize(events); ++i) {
+        events[i].type = SDL_EVENT_USER + 0x300;
+        events[i].user.code = i;
+    }
+
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result == SDL_arraysize(events), "Check result of SDL_PushEvents(), expected: %d, got: %d", (int)SDL_arraysize(events), result);
+    SDL_FlushEvent(SDL_EVENT_USER + 0x300);
+
+    g_eventFilterCalled = 0;
+    SDL_AddEventWatch(events_sampleNullEventFilter, NULL);
+    SDL_SetEventFilter(events_oddCodeEventFilter, NULL);
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDL_SetEventFilter(NULL, NULL);
+    SDL_RemoveEventWatch(events_sampleNullEventFilter, NULL);
+    SDLTest_AssertCheck(result == SDL_arraysize(events) / 2, "Check result of filtered SDL_PushEvents(), expected: %d, got: %d", (int)SDL_arraysize(events) / 2, result);
+    SDLTest_AssertCheck(g_eventFilterCalled == 1, "Check that the event watch was called");
+
+    expected_code = 0;
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER + 0x300, SDL_EVENT_USER + 0x300) == 1) {
+        SDLTest_AssertCheck(event.user.code == expected_code, "Check event order, expected code: %d, got: %d", expected_code, event.user.code);
+        SDLTest_AssertCheck(event.common.timestamp != 0, "Check that the event was timestamped");
+        expected_code += 2;
+    }
+    SDLTest_AssertCheck(expected_code == SDL_arraysize(events), "Check that the accepted events were queued");
+
+    result = SDL_PushEvents(NULL, 1);
+    SDLTest_AssertCheck(result == -1, "Check SDL_PushEvents(NULL) fails, got: %d", result);
+    result = SDL_PushEvents(events, 0);
+    SDLTest_AssertCheck(result == 0, "Check SDL_PushEvents() with no events, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+#define PUSH_THREAD_COUNT  4
+#define PUSH_THREAD_EVENTS 2000
+
+static int SDLCALL PushEventsThread(void *userdata)
+{
+    int thread_index = (int)(intptr_t)userdata;
+    SDL_Event event;
+    int i;
+
+    for (i = 0; i < PUSH_THREAD_EVENTS; ++i) {
+        SDL_zero(event);
+        event.type = SDL_EVENT_USER + 0x200;
+        event.user.code = thread_index;
+        event.user.data1 = (void *)(intptr_t)i;
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+/**
+ * Pushes events from several threads at once and checks that none are lost
+ * or reordered, which exercises SDL_HINT_EVENT_QUEUE_LOCKFREE when it is set.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ */
+static int SDLCALL events_pushFromThreads(void *arg)
+{
+#ifndef SDL_PLATFORM_EMSCRIPTEN
+    SDL_Thread *threads[PUSH_THREAD_COUNT];
+    int next[PUSH_THREAD_COUNT];
+    SDL_Event event;
+    int i, received = 0, out_of_order = 0;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    for (i = 0; i < PUSH_THREAD_COUNT; ++i) {
+        next[i] = 0;
+        threads[i] = SDL_CreateThread(PushEventsThread, "PushEventsThread", (void *)(intptr_t)i);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check SDL_CreateThread() #%d", i);
+    }
+    for (i = 0; i < PUSH_THREAD_COUNT; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDLTest_AssertPass("Pushed %d events from %d threads", PUSH_THREAD_COUNT * PUSH_THREAD_EVENTS, PUSH_THREAD_COUNT);
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER + 0x200, SDL_EVENT_USER + 0x200) == 1) {
+        const int thread_index = event.user.code;
+        if (thread_index < 0 || thread_index >= PUSH_THREAD_COUNT) {
+            ++out_of_order;
+            continue;
+        }
+        if ((int)(intptr_t)event.user.data1 != next[thread_index]) {
+            ++out_of_order;
+        }
+        next[thread_index] = (int)(intptr_t)event.user.data1 + 1;
+        ++received;
+    }
+    SDLTest_AssertCheck(received == PUSH_THREAD_COUNT * PUSH_THREAD_EVENTS, "Check all events were received, expected: %d, got: %d", PUSH_THREAD_COUNT * PUSH_THREAD_EVENTS, received);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events from each thread arrived in order, got %d out of order", out_of_order);
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Adds and deletes an event watch function with NULL userdata
  *
@@ -203,6 +417,57 @@ static int SDLCALL events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+static int g_removingWatchCalled = 0;
+
+static bool SDLCALL events_countingEventWatch(void *userdata, SDL_Event *event)
+{
+    *(int *)userdata += 1;
+    return true;
+}
+
+static bool SDLCALL events_removingEventWatch(void *userdata, SDL_Event *event)
+{
+    ++g_removingWatchCalled;
+    SDL_RemoveEventWatch(events_countingEventWatch, userdata);
+    SDL_RemoveEventWatch(events_removingEventWatch, userdata);
+    return true;
+}
+
+/**
+ * Removes event watch functions from inside an event watch callback
+ *
+ * \sa SDL_AddEventWatch
+ * \sa SDL_RemoveEventWatch
+ *
+ */
+static int SDLCALL events_removeEventWatchFromCallback(void *arg)
+{
+    SDL_Event event;
+    int counted = 0;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+
+    g_removingWatchCalled = 0;
+    SDL_AddEventWatch(events_removingEventWatch, &counted);
+    SDL_AddEventWatch(events_countingEventWatch, &counted);
+    SDLTest_AssertPass("Call to SDL_AddEventWatch() for two watchers");
+
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+    SDLTest_AssertCheck(g_removingWatchCalled == 1, "Check that the removing watcher was called once, called %d times", g_removingWatchCalled);
+    SDLTest_AssertCheck(counted == 0, "Check that the watcher removed during dispatch was not called, called %d times", counted);
+
+    SDL_PushEvent(&event);
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+    SDLTest_AssertCheck(g_removingWatchCalled == 1, "Check that the removing watcher was not called again");
+    SDLTest_AssertCheck(counted == 0, "Check that the removed watcher was not called");
+
+    SDL_FlushEvent(SDL_EVENT_USER);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Runs callbacks on the main thread.
  *
@@ -304,6 +569,50 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Checks that each SDL_HINT_EVENT_TIMESTAMPS clock stamps events close to SDL_GetTicksNS()
+ */
+static int SDLCALL events_timestampClocks(void *arg)
+{
+    static const char *clocks[] = { "coarse", "tsc", "precise" };
+    const Uint64 tolerance = SDL_MS_TO_NS(5);
+    int i;
+
+    for (i = 0; i < SDL_arraysize(clocks); ++i) {
+        SDL_Event event;
+        Uint64 pumped, before, after;
+
+        SDL_SetHint(SDL_HINT_EVENT_TIMESTAMPS, clocks[i]);
+        SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+        // Give the TSC clock time to calibrate
+        SDL_PumpEvents();
+        SDL_Delay(20);
+        pumped = SDL_GetTicksNS();
+        SDL_PumpEvents();
+        SDL_Delay(2);
+
+        SDL_zero(event);
+        event.type = SDL_EVENT_USER;
+        before = SDL_GetTicksNS();
+        SDL_PushEvent(&event);
+        after = SDL_GetTicksNS();
+
+        SDL_zero(event);
+        SDLTest_AssertCheck(SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER) == 1, "Check that the %s event was queued", clocks[i]);
+        if (SDL_strcmp(clocks[i], "coarse") == 0) {
+            SDLTest_AssertCheck(event.common.timestamp >= pumped && event.common.timestamp < before,
+                                "Check %s timestamp, expected: [%" SDL_PRIu64 ", %" SDL_PRIu64 "), got: %" SDL_PRIu64, clocks[i], pumped, before, event.common.timestamp);
+        } else {
+            SDLTest_AssertCheck(event.common.timestamp + tolerance >= before && event.common.timestamp <= after + tolerance,
+                                "Check %s timestamp, expected: [%" SDL_PRIu64 ", %" SDL_PRIu64 "], got: %" SDL_PRIu64, clocks[i], before, after, event.common.timestamp);
+        }
+    }
+    SDL_ResetHint(SDL_HINT_EVENT_TIMESTAMPS);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -311,6 +620,22 @@ static const SDLTest_TestCaseReference eventsTest_pushPumpAndPollUserevent = {
     events_pushPumpAndPollUserevent, "events_pushPumpAndPollUserevent", "Pushes, pumps and polls a user event", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_hasEvents = {
+    events_hasEvents, "events_hasEvents", "Checks SDL_HasEvent and SDL_HasEvents against queued event types", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_peepEventsByType = {
+    events_peepEventsByType, "events_peepEventsByType", "Retrieves and flushes events by type and checks ordering", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_pushEvents = {
+    events_pushEvents, "events_pushEvents", "Pushes an array of events through the event filter", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_pushFromThreads = {
+    events_pushFromThreads, "events_pushFromThreads", "Pushes events from several threads and checks ordering", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference eventsTest_addDelEventWatch = {
     events_addDelEventWatch, "events_addDelEventWatch", "Adds and deletes an event watch function with NULL userdata", TEST_ENABLED
 };
@@ -319,16 +644,30 @@ static const SDLTest_TestCaseReference eventsTest_addDelEventWatchWithUserdata =
     events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_removeEventWatchFromCallback = {
+    events_removeEventWatchFromCallback, "events_removeEventWatchFromCallback", "Removes event watch functions while they're being dispatched", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_timestampClocks = {
+    events_timestampClocks, "events_timestampClocks", "Check the clocks used for event timestamps", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
+    &eventsTest_hasEvents,
+    &eventsTest_peepEventsByType,
+    &eventsTest_pushEvents,
+    &eventsTest_pushFromThreads,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
+    &eventsTest_removeEventWatchFromCallback,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_timestampClocks,
     NULL
 };
 
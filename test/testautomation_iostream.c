@@ -425,6 +425,62 @@ static int SDLCALL iostrm_testFileWrite(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests reading from a memory mapped file.
+ *
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_GetIOPointer
+ * \sa SDL_CloseIO
+ */
+static int SDLCALL iostrm_testMappedFile(void *arg)
+{
+    SDL_IOStream *rw;
+    const char *ptr;
+    size_t len = SDL_strlen(IOStreamHelloWorldCompString);
+    int result;
+
+    rw = SDL_IOFromMappedFile(IOStreamReadTestFilename);
+    SDLTest_AssertPass("Call to SDL_IOFromMappedFile() succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromMappedFile does not return NULL");
+
+    /* Bail out if NULL */
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Run generic tests */
+    testGenericIOStreamValidations(rw, false);
+
+    /* Look at the data in place */
+    SDL_SeekIO(rw, 3, SDL_IO_SEEK_SET);
+    ptr = (const char *)SDL_GetIOPointer(rw, 0, len);
+    SDLTest_AssertPass("Call to SDL_GetIOPointer(rw, 0, %d) succeeded", (int)len);
+    SDLTest_AssertCheck(ptr != NULL && SDL_memcmp(ptr, IOStreamHelloWorldCompString, len) == 0, "Verify pointer to the whole file has the file contents");
+    SDLTest_AssertCheck(SDL_TellIO(rw) == 3, "Verify SDL_GetIOPointer() doesn't move the stream position");
+    ptr = (const char *)SDL_GetIOPointer(rw, 6, len - 6);
+    SDLTest_AssertCheck(ptr != NULL && SDL_memcmp(ptr, IOStreamHelloWorldCompString + 6, len - 6) == 0, "Verify pointer to the end of the file has the right contents");
+    ptr = (const char *)SDL_GetIOPointer(rw, 6, len - 5);
+    SDLTest_AssertCheck(ptr == NULL, "Verify range past the end of the file returns NULL");
+    ptr = (const char *)SDL_GetIOPointer(rw, -1, 1);
+    SDLTest_AssertCheck(ptr == NULL, "Verify negative offset returns NULL");
+
+    /* Close handle */
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    /* Streams that aren't in memory can't be looked at in place */
+    rw = SDL_IOFromFile(IOStreamReadTestFilename, "r");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromFile in read mode does not return NULL");
+    if (rw) {
+        ptr = (const char *)SDL_GetIOPointer(rw, 0, 1);
+        SDLTest_AssertCheck(ptr == NULL, "Verify SDL_GetIOPointer() on a file stream returns NULL");
+        SDL_CloseIO(rw);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Tests alloc and free RW context.
  *
@@ -686,10 +742,14 @@ static const SDLTest_TestCaseReference iostrmTest9 = {
     iostrm_testCompareRWFromMemWithRWFromFile, "iostrm_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile IOStream for read and seek", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference iostrmTest10 = {
+    iostrm_testMappedFile, "iostrm_testMappedFile", "Tests reading from a memory mapped file", TEST_ENABLED
+};
+
 /* Sequence of IOStream test cases */
 static const SDLTest_TestCaseReference *iostrmTests[] = {
     &iostrmTest1, &iostrmTest2, &iostrmTest3, &iostrmTest4, &iostrmTest5, &iostrmTest6,
-    &iostrmTest7, &iostrmTest8, &iostrmTest9, NULL
+    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, NULL
 };
 
 /* IOStream test suite (global) */
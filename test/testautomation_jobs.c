@@ -0,0 +1,231 @@
+/**
+ * Job pool test suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+/* ================= Test Case Implementation ================== */
+
+/* Helper functions */
+
+#define NUM_TEST_JOBS 100
+
+static SDL_AtomicInt job_total;
+
+static void SDLCALL AddJob(void *userdata)
+{
+    SDL_AddAtomicInt(&job_total, (int)(intptr_t)userdata);
+}
+
+typedef struct
+{
+    SDL_AtomicInt stage;
+    SDL_AtomicInt errors;
+} ChainData;
+
+static void SDLCALL FirstStageJob(void *userdata)
+{
+    ChainData *data = (ChainData *)userdata;
+
+    SDL_Delay(1);
+    SDL_AddAtomicInt(&data->stage, 1);
+}
+
+static void SDLCALL SecondStageJob(void *userdata)
+{
+    ChainData *data = (ChainData *)userdata;
+
+    if (SDL_GetAtomicInt(&data->stage) != NUM_TEST_JOBS) {
+        SDL_AddAtomicInt(&data->errors, 1);
+    }
+}
+
+static void SDLCALL NestedJob(void *userdata)
+{
+    SDL_JobCounter *counter = SDL_CreateJobCounter();
+    int i;
+
+    if (counter) {
+        for (i = 0; i < 10; ++i) {
+            SDL_SubmitJob(AddJob, (void *)(intptr_t)1, counter);
+        }
+        SDL_WaitJobCounter(counter);
+        SDL_DestroyJobCounter(counter);
+    }
+}
+
+static void SDLCALL RangeJob(void *userdata, int index)
+{
+    SDL_AtomicInt *hits = (SDL_AtomicInt *)userdata;
+
+    SDL_AddAtomicInt(&hits[index], 1);
+}
+
+/* Test case functions */
+
+/**
+ * Tests submitting jobs and waiting for them with a counter
+ */
+static int SDLCALL jobs_testSubmitAndWait(void *arg)
+{
+    SDL_JobCounter *counter;
+    int i, expected = 0;
+
+    SDL_SetAtomicInt(&job_total, 0);
+
+    counter = SDL_CreateJobCounter();
+    SDLTest_AssertPass("Call to SDL_CreateJobCounter()");
+    SDLTest_AssertCheck(counter != NULL, "Verify counter is not NULL");
+    if (!counter) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetJobCounterValue(counter) == 0, "Verify new counter is zero");
+
+    for (i = 1; i <= NUM_TEST_JOBS; ++i) {
+        SDLTest_AssertCheck(SDL_SubmitJob(AddJob, (void *)(intptr_t)i, counter), "Verify SDL_SubmitJob() succeeds");
+        expected += i;
+    }
+    SDL_WaitJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    SDLTest_AssertCheck(SDL_GetJobCounterValue(counter) == 0, "Verify counter is zero after waiting, got %d", SDL_GetJobCounterValue(counter));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&job_total) == expected, "Verify all jobs ran, expected %d, got %d", expected, SDL_GetAtomicInt(&job_total));
+
+    SDL_DestroyJobCounter(counter);
+
+    SDLTest_AssertCheck(!SDL_SubmitJob(NULL, NULL, NULL), "Verify SDL_SubmitJob() fails with a NULL function");
+    SDLTest_AssertCheck(SDL_GetNumJobThreads() >= 0, "Verify SDL_GetNumJobThreads() is not negative, got %d", SDL_GetNumJobThreads());
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that jobs submitted after a counter only run once it reaches zero
+ */
+static int SDLCALL jobs_testDependencies(void *arg)
+{
+    SDL_JobCounter *first = SDL_CreateJobCounter();
+    SDL_JobCounter *second = SDL_CreateJobCounter();
+    ChainData data;
+    int i;
+
+    if (!first || !second) {
+        SDL_DestroyJobCounter(first);
+        SDL_DestroyJobCounter(second);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetAtomicInt(&data.stage, 0);
+    SDL_SetAtomicInt(&data.errors, 0);
+
+    for (i = 0; i < NUM_TEST_JOBS; ++i) {
+        SDL_SubmitJob(FirstStageJob, &data, first);
+    }
+    for (i = 0; i < 10; ++i) {
+        SDLTest_AssertCheck(SDL_SubmitJobAfter(first, SecondStageJob, &data, second), "Verify SDL_SubmitJobAfter() succeeds");
+    }
+    SDLTest_AssertCheck(!SDL_SubmitJobAfter(first, SecondStageJob, &data, first), "Verify SDL_SubmitJobAfter() fails when depending on its own counter");
+
+    SDL_WaitJobCounter(second);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    SDLTest_AssertCheck(SDL_GetJobCounterValue(first) == 0, "Verify dependency finished, got %d", SDL_GetJobCounterValue(first));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.errors) == 0, "Verify no dependent job ran early, got %d", SDL_GetAtomicInt(&data.errors));
+
+    /* A job that depends on a finished counter is queued right away */
+    SDLTest_AssertCheck(SDL_SubmitJobAfter(first, SecondStageJob, &data, second), "Verify SDL_SubmitJobAfter() succeeds on a finished counter");
+    SDL_WaitJobCounter(second);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.errors) == 0, "Verify the job saw the finished stage");
+
+    SDL_DestroyJobCounter(first);
+    SDL_DestroyJobCounter(second);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests waiting on a counter from inside a job
+ */
+static int SDLCALL jobs_testNestedWait(void *arg)
+{
+    SDL_JobCounter *counter = SDL_CreateJobCounter();
+    int i;
+
+    if (!counter) {
+        return TEST_ABORTED;
+    }
+
+    SDL_SetAtomicInt(&job_total, 0);
+    for (i = 0; i < NUM_TEST_JOBS; ++i) {
+        SDL_SubmitJob(NestedJob, NULL, counter);
+    }
+    SDL_WaitJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&job_total) == NUM_TEST_JOBS * 10, "Verify all nested jobs ran, expected %d, got %d", NUM_TEST_JOBS * 10, SDL_GetAtomicInt(&job_total));
+
+    SDL_DestroyJobCounter(counter);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that SDL_RunJobs() handles each index exactly once
+ */
+static int SDLCALL jobs_testRunJobs(void *arg)
+{
+    const int counts[] = { 0, 1, 2, 7, 1000 };
+    SDL_AtomicInt hits[1000];
+    int i, j;
+
+    for (i = 0; i < SDL_arraysize(counts); ++i) {
+        int errors = 0;
+
+        SDL_zeroa(hits);
+        SDL_RunJobs(RangeJob, hits, counts[i]);
+        SDLTest_AssertPass("Call to SDL_RunJobs(%d)", counts[i]);
+        for (j = 0; j < SDL_arraysize(hits); ++j) {
+            if (SDL_GetAtomicInt(&hits[j]) != (j < counts[i] ? 1 : 0)) {
+                ++errors;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Verify each index ran exactly once, got %d errors", errors);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Job pool test cases */
+static const SDLTest_TestCaseReference jobsTest1 = {
+    jobs_testSubmitAndWait, "jobs_testSubmitAndWait", "Submit jobs and wait for them", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTest2 = {
+    jobs_testDependencies, "jobs_testDependencies", "Run jobs after their dependencies", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTest3 = {
+    jobs_testNestedWait, "jobs_testNestedWait", "Wait for jobs from inside a job", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTest4 = {
+    jobs_testRunJobs, "jobs_testRunJobs", "Run a function over a range of indices", TEST_ENABLED
+};
+
+/* Sequence of job pool test cases */
+static const SDLTest_TestCaseReference *jobsTests[] = {
+    &jobsTest1,
+    &jobsTest2,
+    &jobsTest3,
+    &jobsTest4,
+    NULL
+};
+
+/* Job pool test suite (global) */
+SDLTest_TestSuiteReference jobsTestSuite = {
+    "Jobs",
+    NULL,
+    jobsTests,
+    NULL
+};
@@ -94,6 +94,33 @@ static int SDLCALL TestVirtualJoystick(void *arg)
             SDL_UpdateJoysticks();
             SDLTest_AssertCheck(SDL_GetJoystickButton(joystick, SDL_GAMEPAD_BUTTON_SOUTH) == false, "SDL_GetJoystickButton(SDL_GAMEPAD_BUTTON_SOUTH) == false");
 
+            {
+                Sint16 axes[SDL_GAMEPAD_AXIS_COUNT + 1];
+                bool buttons[SDL_GAMEPAD_BUTTON_COUNT];
+                SDL_JoystickSnapshot snapshot;
+
+                SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, 1234);
+                SDL_SetJoystickVirtualButton(joystick, SDL_GAMEPAD_BUTTON_EAST, true);
+                SDL_UpdateJoysticks();
+
+                SDL_zero(snapshot);
+                snapshot.num_axes = SDL_arraysize(axes);
+                snapshot.axes = axes;
+                snapshot.num_buttons = SDL_arraysize(buttons);
+                snapshot.buttons = buttons;
+                axes[SDL_GAMEPAD_AXIS_COUNT] = 1;
+                SDLTest_AssertCheck(SDL_GetJoystickSnapshot(joystick, &snapshot), "SDL_GetJoystickSnapshot()");
+                SDLTest_AssertCheck(axes[SDL_GAMEPAD_AXIS_LEFTX] == 1234, "Snapshot axis value -> %d (expected %d)", axes[SDL_GAMEPAD_AXIS_LEFTX], 1234);
+                SDLTest_AssertCheck(axes[SDL_GAMEPAD_AXIS_COUNT] == 0, "Snapshot axis past the end -> %d (expected %d)", axes[SDL_GAMEPAD_AXIS_COUNT], 0);
+                SDLTest_AssertCheck(buttons[SDL_GAMEPAD_BUTTON_EAST] == true, "Snapshot button state == true");
+                SDLTest_AssertCheck(buttons[SDL_GAMEPAD_BUTTON_SOUTH] == false, "Snapshot button state == false");
+                SDLTest_AssertCheck(snapshot.timestamp != 0, "Snapshot timestamp != 0");
+
+                SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, 0);
+                SDL_SetJoystickVirtualButton(joystick, SDL_GAMEPAD_BUTTON_EAST, false);
+                SDL_UpdateJoysticks();
+            }
+
             gamepad = SDL_OpenGamepad(SDL_GetJoystickID(joystick));
             SDLTest_AssertCheck(gamepad != NULL, "SDL_OpenGamepad() succeeded");
             if (gamepad) {
@@ -199,6 +226,128 @@ static int SDLCALL TestVirtualJoystick(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that gamepad sensor readings are batched for SDL_GetGamepadSensorSamples()
+ *
+ * \sa SDL_GetGamepadSensorSamples
+ */
+static int SDLCALL TestGamepadSensorSamples(void *arg)
+{
+    SDL_VirtualJoystickDesc desc;
+    SDL_VirtualJoystickSensorDesc sensor_desc;
+    SDL_Gamepad *gamepad = NULL;
+    SDL_JoystickID device_id;
+    SDL_SensorSample samples[4];
+    int i, result;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMEPAD), "SDL_InitSubSystem(SDL_INIT_GAMEPAD)");
+
+    SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, "1");
+
+    SDL_zero(sensor_desc);
+    sensor_desc.type = SDL_SENSOR_GYRO;
+    sensor_desc.rate = 1000.0f;
+
+    SDL_INIT_INTERFACE(&desc);
+    desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+    desc.naxes = SDL_GAMEPAD_AXIS_COUNT;
+    desc.nbuttons = SDL_GAMEPAD_BUTTON_COUNT;
+    desc.nsensors = 1;
+    desc.sensors = &sensor_desc;
+    desc.name = "Virtual Sensor Gamepad";
+    device_id = SDL_AttachVirtualJoystick(&desc);
+    SDLTest_AssertCheck(device_id > 0, "SDL_AttachVirtualJoystick() -> %" SDL_PRIs32 " (expected > 0)", device_id);
+    if (device_id > 0) {
+        gamepad = SDL_OpenGamepad(device_id);
+        SDLTest_AssertCheck(gamepad != NULL, "SDL_OpenGamepad()");
+        if (gamepad) {
+            SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
+
+            SDLTest_AssertCheck(SDL_SetGamepadSensorEnabled(gamepad, SDL_SENSOR_GYRO, true), "SDL_SetGamepadSensorEnabled(SDL_SENSOR_GYRO, true)");
+
+            /* Readings are collected starting from the first call */
+            result = SDL_GetGamepadSensorSamples(gamepad, SDL_SENSOR_GYRO, samples, SDL_arraysize(samples));
+            SDLTest_AssertCheck(result == 0, "SDL_GetGamepadSensorSamples() -> %d (expected 0)", result);
+
+            for (i = 0; i < 3; ++i) {
+                const float data[3] = { (float)i, 1.0f, 2.0f };
+                SDL_SendJoystickVirtualSensorData(joystick, SDL_SENSOR_GYRO, 1000 + i, data, SDL_arraysize(data));
+            }
+            SDL_UpdateJoysticks();
+
+            result = SDL_GetGamepadSensorSamples(gamepad, SDL_SENSOR_GYRO, samples, 2);
+            SDLTest_AssertCheck(result == 2, "SDL_GetGamepadSensorSamples() -> %d (expected 2)", result);
+            SDLTest_AssertCheck(samples[0].sensor_timestamp == 1000 && samples[0].data[0] == 0.0f, "First sample is the oldest reading");
+            SDLTest_AssertCheck(samples[1].sensor_timestamp == 1001 && samples[1].data[0] == 1.0f, "Second sample is the next reading");
+
+            result = SDL_GetGamepadSensorSamples(gamepad, SDL_SENSOR_GYRO, samples, SDL_arraysize(samples));
+            SDLTest_AssertCheck(result == 1, "SDL_GetGamepadSensorSamples() -> %d (expected 1)", result);
+            SDLTest_AssertCheck(samples[0].sensor_timestamp == 1002 && samples[0].data[2] == 2.0f && samples[0].data[3] == 0.0f, "Remaining sample is the newest reading");
+
+            result = SDL_GetGamepadSensorSamples(gamepad, SDL_SENSOR_GYRO, samples, SDL_arraysize(samples));
+            SDLTest_AssertCheck(result == 0, "SDL_GetGamepadSensorSamples() -> %d (expected 0)", result);
+
+            result = SDL_GetGamepadSensorSamples(gamepad, SDL_SENSOR_ACCEL, samples, SDL_arraysize(samples));
+            SDLTest_AssertCheck(result == -1, "SDL_GetGamepadSensorSamples(SDL_SENSOR_ACCEL) -> %d (expected -1)", result);
+
+            SDL_CloseGamepad(gamepad);
+        }
+        SDLTest_AssertCheck(SDL_DetachVirtualJoystick(device_id), "SDL_DetachVirtualJoystick()");
+    }
+
+    SDL_ResetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS);
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that gamepad mappings are found by GUID, with and without the version and CRC
+ *
+ * \sa SDL_AddGamepadMapping
+ * \sa SDL_GetGamepadMappingForGUID
+ */
+static int SDLCALL TestGamepadMappingLookup(void *arg)
+{
+    /* USB, vendor 0x1234, product 0x5678, version 0x0102, CRC 0xbeef for the lookups */
+    const char *guid_v1 = "03000000341200007856000002010000";
+    const char *guid_v2 = "03000000341200007856000002020000";
+    const char *guid_crc = "0300efbe341200007856000002010000";
+    const char *guid_other = "03000000341200007956000002010000";
+    char *mapping;
+    int result;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMEPAD), "SDL_InitSubSystem(SDL_INIT_GAMEPAD)");
+
+    result = SDL_AddGamepadMapping("03000000341200007856000002010000,Lookup Test,a:b0,b:b1,");
+    SDLTest_AssertCheck(result == 1, "SDL_AddGamepadMapping() -> %d (expected 1)", result);
+    result = SDL_AddGamepadMapping("03000000341200007856000002010000,Lookup Test CRC,a:b1,b:b0,crc:beef,");
+    SDLTest_AssertCheck(result == 1, "SDL_AddGamepadMapping() with a CRC -> %d (expected 1)", result);
+    result = SDL_AddGamepadMapping("03000000341200007856000002010000,Lookup Test Updated,a:b0,b:b1,x:b2,");
+    SDLTest_AssertCheck(result == 0, "SDL_AddGamepadMapping() for an existing GUID -> %d (expected 0)", result);
+
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_v1));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, "Lookup Test Updated,") != NULL, "Exact GUID match -> %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_crc));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, "Lookup Test CRC,") != NULL, "GUID with matching CRC -> %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_v2));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, "Lookup Test Updated,") != NULL, "GUID with another version -> %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_other));
+    SDLTest_AssertCheck(mapping == NULL, "GUID for another product -> %s (expected NULL)", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -206,9 +355,19 @@ static const SDLTest_TestCaseReference joystickTest1 = {
     TestVirtualJoystick, "TestVirtualJoystick", "Test virtual joystick functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference joystickTest2 = {
+    TestGamepadMappingLookup, "TestGamepadMappingLookup", "Test looking up gamepad mappings by GUID", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference joystickTest3 = {
+    TestGamepadSensorSamples, "TestGamepadSensorSamples", "Test batched gamepad sensor readings", TEST_ENABLED
+};
+
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
+    &joystickTest2,
+    &joystickTest3,
     NULL
 };
 
@@ -188,6 +188,67 @@ static int SDLCALL log_testHint(void *arg)
     return TEST_COMPLETED;
 }
 
+typedef struct
+{
+    int begins;
+    int ends;
+    bool pumped;
+    Uint64 last_timestamp;
+    bool ordered;
+} TraceCounts;
+
+static void SDLCALL TestTraceCallback(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp)
+{
+    TraceCounts *counts = (TraceCounts *)userdata;
+
+    if (type == SDL_TRACE_EVENT_BEGIN) {
+        ++counts->begins;
+    } else {
+        ++counts->ends;
+    }
+    if (SDL_strcmp(name, "SDL_PumpEvents") == 0) {
+        counts->pumped = true;
+    }
+    if (timestamp < counts->last_timestamp) {
+        counts->ordered = false;
+    }
+    counts->last_timestamp = timestamp;
+}
+
+/**
+ * Check that SDL_SetTraceCallback() reports zones in SDL's hot paths
+ */
+static int SDLCALL log_testTraceCallback(void *arg)
+{
+    TraceCounts counts;
+    int begins;
+
+    SDL_zero(counts);
+    counts.ordered = true;
+
+    if (!SDL_SetTraceCallback(TestTraceCallback, &counts)) {
+        SDLTest_Log("SDL_SetTraceCallback() unsupported, SDL was built without SDL_TRACING: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("SDL_SetTraceCallback(TestTraceCallback, &counts)");
+
+    SDL_PumpEvents();
+    SDLTest_AssertPass("SDL_PumpEvents()");
+
+    SDL_SetTraceCallback(NULL, NULL);
+    SDLTest_AssertPass("SDL_SetTraceCallback(NULL, NULL)");
+
+    SDLTest_AssertCheck(counts.pumped, "Check that the SDL_PumpEvents zone was reported");
+    SDLTest_AssertCheck(counts.begins > 0 && counts.begins == counts.ends, "Check that zones begin and end in pairs, got %d begins and %d ends", counts.begins, counts.ends);
+    SDLTest_AssertCheck(counts.ordered, "Check that timestamps don't go backwards");
+
+    begins = counts.begins;
+    SDL_PumpEvents();
+    SDLTest_AssertCheck(counts.begins == begins, "Check that no zones are reported after the callback is removed");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Log test cases */
@@ -195,9 +256,13 @@ static const SDLTest_TestCaseReference logTestHint = {
     log_testHint, "log_testHint", "Check SDL_HINT_LOGGING functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference logTestTraceCallback = {
+    log_testTraceCallback, "log_testTraceCallback", "Check SDL_SetTraceCallback() zones", TEST_ENABLED
+};
+
 /* Sequence of Log test cases */
 static const SDLTest_TestCaseReference *logTests[] = {
-    &logTestHint, NULL
+    &logTestHint, &logTestTraceCallback, NULL
 };
 
 /* Timer test suite (global) */
@@ -638,6 +638,14 @@ SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_EXTERNAL_OES_ARRAY, !SDL_ISPIXELFORMAT_A
 SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_EXTERNAL_OES_10BIT, !SDL_ISPIXELFORMAT_10BIT(SDL_PIXELFORMAT_EXTERNAL_OES));
 SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_EXTERNAL_OES_FLOAT, !SDL_ISPIXELFORMAT_FLOAT(SDL_PIXELFORMAT_EXTERNAL_OES));
 SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_EXTERNAL_OES_ALPHA, !SDL_ISPIXELFORMAT_ALPHA(SDL_PIXELFORMAT_EXTERNAL_OES));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC1_FORMAT, SDL_PIXELFORMAT_BC1 == SDL_DEFINE_PIXELFOURCC('B', 'C', '1', ' '));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC1_FOURCC, SDL_ISPIXELFORMAT_FOURCC(SDL_PIXELFORMAT_BC1));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC2_FORMAT, SDL_PIXELFORMAT_BC2 == SDL_DEFINE_PIXELFOURCC('B', 'C', '2', ' '));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC2_FOURCC, SDL_ISPIXELFORMAT_FOURCC(SDL_PIXELFORMAT_BC2));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC3_FORMAT, SDL_PIXELFORMAT_BC3 == SDL_DEFINE_PIXELFOURCC('B', 'C', '3', ' '));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC3_FOURCC, SDL_ISPIXELFORMAT_FOURCC(SDL_PIXELFORMAT_BC3));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC7_FORMAT, SDL_PIXELFORMAT_BC7 == SDL_DEFINE_PIXELFOURCC('B', 'C', '7', ' '));
+SDL_COMPILE_TIME_ASSERT(SDL_PIXELFORMAT_BC7_FOURCC, SDL_ISPIXELFORMAT_FOURCC(SDL_PIXELFORMAT_BC7));
 
 
 /* Verify the colorspaces are laid out as expected */
@@ -959,6 +967,75 @@ static int SDLCALL pixels_allocFreePalette(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Call to SDL_MapRGBA with an indexed format, checking against a search of the whole palette
+ *
+ * \sa SDL_MapRGBA
+ * \sa SDL_SetPaletteColors
+ */
+static int SDLCALL pixels_mapRGBAPalette(void *arg)
+{
+    const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_INDEX8);
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    int variation;
+    int i, j;
+
+    palette = SDL_CreatePalette(SDL_arraysize(colors));
+    SDLTest_AssertPass("Call to SDL_CreatePalette(%d)", (int)SDL_arraysize(colors));
+    SDLTest_AssertCheck(palette != NULL, "Verify result is not NULL");
+    if (palette == NULL) {
+        return TEST_ABORTED;
+    }
+
+    for (variation = 1; variation <= 3; variation++) {
+        int mismatches = 0;
+
+        /* Random colors, then with some translucent, then with many duplicates */
+        for (i = 0; i < SDL_arraysize(colors); i++) {
+            colors[i].r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            colors[i].g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            colors[i].b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            colors[i].a = (variation == 2 && (i % 3) == 0) ? (Uint8)SDLTest_RandomIntegerInRange(0, 255) : SDL_ALPHA_OPAQUE;
+            if (variation == 3) {
+                colors[i].r = colors[i].g = colors[i].b = (Uint8)(i / 8);
+            }
+        }
+        SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+        SDLTest_AssertPass("Call to SDL_SetPaletteColors()");
+
+        for (i = 0; i < 10000; i++) {
+            Uint8 r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            Uint8 g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            Uint8 b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            Uint8 a = (i % 4) ? SDL_ALPHA_OPAQUE : (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            unsigned int smallest = ~0U;
+            Uint32 expected = 0;
+
+            for (j = 0; j < SDL_arraysize(colors); j++) {
+                int rd = colors[j].r - r;
+                int gd = colors[j].g - g;
+                int bd = colors[j].b - b;
+                int ad = colors[j].a - a;
+                unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+                if (distance < smallest) {
+                    expected = j;
+                    smallest = distance;
+                }
+            }
+            if (SDL_MapRGBA(details, palette, r, g, b, a) != expected) {
+                ++mismatches;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MapRGBA() finds the closest palette colors, expected: 0 mismatches, got: %d", mismatches);
+    }
+
+    SDL_DestroyPalette(palette);
+    SDLTest_AssertPass("Call to SDL_DestroyPalette()");
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Call to SDL_SaveBMP and SDL_LoadBMP
  *
@@ -1092,6 +1169,10 @@ static const SDLTest_TestCaseReference pixelsTestAllocFreePalette = {
     pixels_allocFreePalette, "pixels_allocFreePalette", "Call to SDL_CreatePalette and SDL_DestroyPalette", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference pixelsTestMapRGBAPalette = {
+    pixels_mapRGBAPalette, "pixels_mapRGBAPalette", "Call to SDL_MapRGBA with a palette", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference pixelsTestSaveLoadBMP = {
     pixels_saveLoadBMP, "pixels_saveLoadBMP", "Call to SDL_SaveBMP and SDL_LoadBMP", TEST_ENABLED
 };
@@ -1101,6 +1182,7 @@ static const SDLTest_TestCaseReference *pixelsTests[] = {
     &pixelsTestGetPixelFormatName,
     &pixelsTestGetPixelFormatDetails,
     &pixelsTestAllocFreePalette,
+    &pixelsTestMapRGBAPalette,
     &pixelsTestSaveLoadBMP,
     NULL
 };
@@ -274,6 +274,61 @@ static int SDLCALL properties_testCopy(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test property keys
+ */
+static int SDLCALL properties_testKeys(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_PropertyKey *key, *key2;
+    Sint64 num;
+    const char *string;
+    void *data;
+
+    SDLTest_AssertPass("Call to SDL_GetPropertyKey(NULL)");
+    key = SDL_GetPropertyKey(NULL);
+    SDLTest_AssertCheck(key == NULL,
+        "Checking key, got %p, expected NULL", (void *)key);
+
+    key = SDL_GetPropertyKey("num");
+    key2 = SDL_GetPropertyKey("num");
+    SDLTest_AssertCheck(key != NULL && key == key2,
+        "Checking that the same name gives the same key, got %p and %p", (void *)key, (void *)key2);
+
+    props = SDL_CreateProperties();
+
+    SDLTest_AssertPass("Call to SDL_SetNumberPropertyByKey(props, key, 1)");
+    SDL_SetNumberPropertyByKey(props, key, 1);
+    num = SDL_GetNumberProperty(props, "num", 0);
+    SDLTest_AssertCheck(num == 1,
+        "Checking number property by name, got %" SDL_PRIs64 ", expected 1", num);
+
+    SDL_SetNumberProperty(props, "num", 2);
+    num = SDL_GetNumberPropertyByKey(props, key, 0);
+    SDLTest_AssertCheck(num == 2,
+        "Checking number property by key, got %" SDL_PRIs64 ", expected 2", num);
+    string = SDL_GetStringPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(string && SDL_strcmp(string, "2") == 0,
+        "Checking number property as string, got \"%s\", expected \"2\"", string);
+
+    key = SDL_GetPropertyKey("data");
+    SDL_SetPointerPropertyByKey(props, key, &props);
+    data = SDL_GetPointerPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(data == &props,
+        "Checking pointer property by key, got %p, expected %p", data, (void *)&props);
+    SDL_SetPointerPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(!SDL_HasProperty(props, "data"),
+        "Checking that setting NULL cleared the property");
+
+    num = SDL_GetNumberPropertyByKey(props, NULL, 3);
+    SDLTest_AssertCheck(num == 3,
+        "Checking NULL key, got %" SDL_PRIs64 ", expected 3", num);
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Test cleanup functionality
  */
@@ -393,6 +448,10 @@ static const SDLTest_TestCaseReference propertiesTestCopy = {
     properties_testCopy, "properties_testCopy", "Test property copy functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference propertiesTestKeys = {
+    properties_testKeys, "properties_testKeys", "Test property key functionality", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference propertiesTestCleanup = {
     properties_testCleanup, "properties_testCleanup", "Test property cleanup functionality", TEST_ENABLED
 };
@@ -405,6 +464,7 @@ static const SDLTest_TestCaseReference propertiesTestLocking = {
 static const SDLTest_TestCaseReference *propertiesTests[] = {
     &propertiesTestBasic,
     &propertiesTestCopy,
+    &propertiesTestKeys,
     &propertiesTestCleanup,
     &propertiesTestLocking,
     NULL
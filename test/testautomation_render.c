@@ -2,10 +2,10 @@
  * Original code: automated SDL platform test written by Edgar Simo "bobbens"
  * Extended and extensively updated by aschiffler at ferzkopp dot net
  */
-#include "testautomation_images.h"
-#include "testautomation_suites.h"
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_test.h>
+#include "testautomation_images.h"
+#include "testautomation_suites.h"
 
 /* ================= Test Case Implementation ================== */
 
@@ -1322,6 +1322,198 @@ static int SDLCALL render_testRGBSurfaceNoAlpha(void *arg)
     return TEST_COMPLETED;
 }
 
+static SDL_Surface *renderTileScene(bool tiled)
+{
+    SDL_Surface *surface;
+    SDL_Renderer *software_renderer;
+    SDL_Texture *texture;
+    Uint32 pixels[32 * 32];
+    SDL_Vertex verts[3];
+    SDL_FRect rect;
+    SDL_Rect clip;
+    int i, j;
+
+    for (i = 0; i < SDL_arraysize(pixels); ++i) {
+        pixels[i] = ((Uint32)(i * 37) << 24) | (Uint32)(i * 2654435761u >> 8);
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILES, tiled ? "1" : "0");
+    surface = SDL_CreateSurface(300, 200, SDL_PIXELFORMAT_XRGB8888);
+    software_renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_TILES);
+    if (!software_renderer) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+
+    texture = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 32, 32);
+    SDL_UpdateTexture(texture, NULL, pixels, 32 * sizeof(Uint32));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    SDL_SetRenderDrawColor(software_renderer, 10, 20, 30, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+    for (i = 0; i < 40; ++i) {
+        SDL_SetRenderDrawBlendMode(software_renderer, (i % 3) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(software_renderer, (Uint8)(i * 50), (Uint8)(i * 90), (Uint8)(i * 20), (Uint8)(100 + i * 3));
+        rect.x = (float)((i * 47) % 300) - 20.0f;
+        rect.y = (float)((i * 29) % 200) - 20.0f;
+        rect.w = (float)(20 + (i * 13) % 90);
+        rect.h = (float)(20 + (i * 7) % 70);
+        SDL_RenderFillRect(software_renderer, &rect);
+        SDL_RenderPoint(software_renderer, rect.x + 3.0f, rect.y + 5.0f);
+        SDL_RenderLine(software_renderer, rect.x, rect.y, rect.x + rect.w * 2.0f, rect.y + rect.h);
+
+        SDL_SetTextureColorMod(texture, 255, (Uint8)(i * 60), 200);
+        rect.w = 32.0f;
+        rect.h = 32.0f;
+        SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+        rect.w = 45.0f;
+        SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+
+        for (j = 0; j < 3; ++j) {
+            verts[j].position.x = (float)((i * 31 + j * 97) % 340) - 20.0f;
+            verts[j].position.y = (float)((i * 17 + j * 61) % 240) - 20.0f;
+            verts[j].color.r = 1.0f;
+            verts[j].color.g = j * 0.5f;
+            verts[j].color.b = 0.25f;
+            verts[j].color.a = 0.75f;
+            verts[j].tex_coord.x = j * 0.5f;
+            verts[j].tex_coord.y = (j == 1) ? 1.0f : 0.0f;
+        }
+        SDL_RenderGeometry(software_renderer, (i % 2) ? texture : NULL, verts, 3, NULL, 0);
+
+        if (i == 20) {
+            clip.x = 50;
+            clip.y = 30;
+            clip.w = 170;
+            clip.h = 120;
+            SDL_SetRenderClipRect(software_renderer, &clip);
+        }
+    }
+    SDL_RenderPresent(software_renderer);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    return surface;
+}
+
+/**
+ * Tests that tiled software rendering draws the same pixels as untiled rendering
+ *
+ * \sa SDL_HINT_RENDER_SOFTWARE_TILES
+ */
+static int SDLCALL render_testSoftwareTiles(void *arg)
+{
+    SDL_Surface *reference;
+    SDL_Surface *tiled;
+    int y, mismatch = -1;
+
+    reference = renderTileScene(false);
+    tiled = renderTileScene(true);
+    SDLTest_AssertCheck(reference != NULL && tiled != NULL, "Verify both scenes were rendered");
+    if (reference == NULL || tiled == NULL) {
+        SDL_DestroySurface(reference);
+        SDL_DestroySurface(tiled);
+        return TEST_ABORTED;
+    }
+
+    for (y = 0; y < reference->h; ++y) {
+        if (SDL_memcmp((Uint8 *)reference->pixels + y * reference->pitch,
+                       (Uint8 *)tiled->pixels + y * tiled->pitch, reference->w * 4) != 0) {
+            mismatch = y;
+            break;
+        }
+    }
+    SDLTest_AssertCheck(mismatch < 0, "Verify tiled rendering matches, first mismatched row: %d", mismatch);
+
+    SDL_DestroySurface(reference);
+    SDL_DestroySurface(tiled);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that YUV textures on the software renderer match SDL_ConvertPixels(), with the conversion split across threads
+ *
+ * \sa SDL_HINT_VIDEO_YUV_CONVERSION_THREADS
+ */
+static int SDLCALL render_testSoftwareYUV(void *arg)
+{
+    const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_YUY2,
+    };
+    const int w = 1280, h = 722;
+    SDL_Surface *rgb, *expected, *surface;
+    int i, x, y, mismatch;
+
+    rgb = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XRGB8888);
+    expected = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XRGB8888);
+    surface = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(rgb && expected && surface, "Create surfaces");
+    if (!rgb || !expected || !surface) {
+        SDL_DestroySurface(rgb);
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)rgb->pixels + y * rgb->pitch);
+        for (x = 0; x < w; ++x) {
+            row[x] = ((Uint32)(x * 255 / w) << 16) | ((Uint32)(y * 255 / h) << 8) | (Uint32)((x * 7 + y * 13) & 0xFF);
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Renderer *software_renderer;
+        SDL_Texture *texture;
+        const int yuv_pitch = (formats[i] == SDL_PIXELFORMAT_YUY2) ? ((w + 1) / 2) * 4 : w;
+        const size_t yuv_size = (formats[i] == SDL_PIXELFORMAT_YUY2) ? (size_t)yuv_pitch * h : (size_t)w * h + 2 * (size_t)((w + 1) / 2) * ((h + 1) / 2);
+        void *yuv;
+
+        yuv = SDL_malloc(yuv_size);
+        if (!yuv) {
+            break;
+        }
+        SDL_ConvertPixels(w, h, rgb->format, rgb->pixels, rgb->pitch, formats[i], yuv, yuv_pitch);
+        SDL_ConvertPixelsAndColorspace(w, h, formats[i], SDL_COLORSPACE_YUV_DEFAULT, 0, yuv, yuv_pitch,
+                                       expected->format, SDL_COLORSPACE_SRGB, 0, expected->pixels, expected->pitch);
+
+        SDL_SetHint(SDL_HINT_VIDEO_YUV_CONVERSION_THREADS, "4");
+        software_renderer = SDL_CreateSoftwareRenderer(surface);
+        SDLTest_AssertCheck(software_renderer != NULL, "Create software renderer");
+        texture = software_renderer ? SDL_CreateTexture(software_renderer, formats[i], SDL_TEXTUREACCESS_STREAMING, w, h) : NULL;
+        SDLTest_AssertCheck(texture != NULL, "Create %s texture", SDL_GetPixelFormatName(formats[i]));
+        if (texture) {
+            SDL_UpdateTexture(texture, NULL, yuv, yuv_pitch);
+            SDL_RenderTexture(software_renderer, texture, NULL, NULL);
+            SDL_RenderPresent(software_renderer);
+
+            mismatch = -1;
+            for (y = 0; y < h && mismatch < 0; ++y) {
+                const Uint32 *a = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+                const Uint32 *b = (const Uint32 *)((const Uint8 *)expected->pixels + y * expected->pitch);
+                for (x = 0; x < w; ++x) {
+                    if ((a[x] & 0x00FFFFFF) != (b[x] & 0x00FFFFFF)) {
+                        mismatch = y;
+                        break;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatch < 0, "Verify %s texture matches SDL_ConvertPixels(), first mismatched row: %d", SDL_GetPixelFormatName(formats[i]), mismatch);
+            SDL_DestroyTexture(texture);
+        }
+        SDL_DestroyRenderer(software_renderer);
+        SDL_ResetHint(SDL_HINT_VIDEO_YUV_CONVERSION_THREADS);
+        SDL_free(yuv);
+    }
+
+    SDL_DestroySurface(rgb);
+    SDL_DestroySurface(expected);
+    SDL_DestroySurface(surface);
+    return TEST_COMPLETED;
+}
+
 /**
  * Test clip rect
  */
@@ -1572,6 +1764,120 @@ static int SDLCALL render_testGetSetTextureScaleMode(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests setting dirty and scroll regions for the next present.
+ */
+/**
+ * Tests locking a streaming texture repeatedly, including partial locks.
+ *
+ * \sa SDL_LockTexture
+ * \sa SDL_UnlockTexture
+ */
+static int SDLCALL render_testLockTexture(void *arg)
+{
+    const Uint32 colors[] = { 0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFFFF, 0xFF808080 };
+    const SDL_Rect subrect = { 8, 8, 8, 8 };
+    const SDL_FRect dst = { 0.0f, 0.0f, 16.0f, 16.0f };
+    SDL_Texture *texture;
+    SDL_Surface *surface;
+    void *pixels;
+    int pitch, i, x, y;
+    Uint8 r, g, b, a;
+    bool result;
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 16, 16);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (texture == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Lock the whole texture more times than the renderer is likely to buffer */
+    for (i = 0; i < SDL_arraysize(colors); ++i) {
+        result = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+        SDLTest_AssertCheck(result == true, "Verify SDL_LockTexture() result, got %d: %s", result, SDL_GetError());
+        if (!result) {
+            break;
+        }
+        for (y = 0; y < 16; ++y) {
+            Uint32 *row = (Uint32 *)((Uint8 *)pixels + y * pitch);
+            for (x = 0; x < 16; ++x) {
+                row[x] = colors[i];
+            }
+        }
+        SDL_UnlockTexture(texture);
+
+        SDL_RenderTexture(renderer, texture, NULL, &dst);
+        surface = SDL_RenderReadPixels(renderer, &subrect);
+        SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+        if (surface) {
+            SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+            SDLTest_AssertCheck(((Uint32)a << 24 | (Uint32)r << 16 | (Uint32)g << 8 | b) == colors[i],
+                                "Validate pixel after lock %d, expected 0x%.8" SDL_PRIx32 ", got %d,%d,%d,%d", i, colors[i], r, g, b, a);
+            SDL_DestroySurface(surface);
+        }
+    }
+
+    /* A partial lock only replaces the locked area */
+    result = SDL_LockTexture(texture, &subrect, &pixels, &pitch);
+    SDLTest_AssertCheck(result == true, "Verify partial SDL_LockTexture() result, got %d: %s", result, SDL_GetError());
+    if (result) {
+        for (y = 0; y < subrect.h; ++y) {
+            Uint32 *row = (Uint32 *)((Uint8 *)pixels + y * pitch);
+            for (x = 0; x < subrect.w; ++x) {
+                row[x] = colors[0];
+            }
+        }
+        SDL_UnlockTexture(texture);
+
+        SDL_RenderTexture(renderer, texture, NULL, &dst);
+        surface = SDL_RenderReadPixels(renderer, NULL);
+        SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+        if (surface) {
+            SDL_ReadSurfacePixel(surface, 4, 4, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0x80 && g == 0x80 && b == 0x80, "Validate pixel outside the locked area, expected 128,128,128, got %d,%d,%d", r, g, b);
+            SDL_ReadSurfacePixel(surface, 12, 12, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0xFF && g == 0 && b == 0, "Validate pixel inside the locked area, expected 255,0,0, got %d,%d,%d", r, g, b);
+            SDL_DestroySurface(surface);
+        }
+    }
+
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL render_testPresentRegions(void *arg)
+{
+    const SDL_Rect rects[] = { { 0, 0, 16, 16 }, { 20, 20, 8, 8 }, { -10, -10, 1000, 1000 } };
+    const SDL_Rect scroll = { 0, 16, 80, 44 };
+    const SDL_Point offset = { 0, -16 };
+    bool result;
+
+    SDL_ClearError();
+    result = SDL_SetRenderDirtyRects(renderer, NULL, 1);
+    SDLTest_AssertCheck(result == false, "SDL_SetRenderDirtyRects(renderer, NULL, 1) returns %d, expected %d", result, false);
+    result = SDL_SetRenderDirtyRects(renderer, rects, -1);
+    SDLTest_AssertCheck(result == false, "SDL_SetRenderDirtyRects(renderer, rects, -1) returns %d, expected %d", result, false);
+    result = SDL_SetRenderScrollRect(renderer, &scroll, NULL);
+    SDLTest_AssertCheck(result == false, "SDL_SetRenderScrollRect(renderer, &scroll, NULL) returns %d, expected %d", result, false);
+
+    result = SDL_SetRenderDirtyRects(renderer, rects, SDL_arraysize(rects));
+    SDLTest_AssertCheck(result == true, "SDL_SetRenderDirtyRects returns %d, expected %d", result, true);
+    result = SDL_SetRenderScrollRect(renderer, &scroll, &offset);
+    SDLTest_AssertCheck(result == true, "SDL_SetRenderScrollRect returns %d, expected %d", result, true);
+    result = SDL_RenderPresent(renderer);
+    SDLTest_AssertCheck(result == true, "SDL_RenderPresent with dirty rects returns %d, expected %d", result, true);
+
+    result = SDL_SetRenderDirtyRects(renderer, NULL, 0);
+    SDLTest_AssertCheck(result == true, "SDL_SetRenderDirtyRects(renderer, NULL, 0) returns %d, expected %d", result, true);
+    result = SDL_SetRenderScrollRect(renderer, NULL, NULL);
+    SDLTest_AssertCheck(result == true, "SDL_SetRenderScrollRect(renderer, NULL, NULL) returns %d, expected %d", result, true);
+    result = SDL_RenderPresent(renderer);
+    SDLTest_AssertCheck(result == true, "SDL_RenderPresent returns %d, expected %d", result, true);
+
+    return TEST_COMPLETED;
+}
+
 /* Helper functions */
 
 /**
@@ -1984,67 +2290,1217 @@ static int SDLCALL render_testTextureState(void *arg)
     return TEST_COMPLETED;
 }
 
-/* ================= Test References ================== */
+/**
+ * Renders interleaved textured triangles, some overlapping, for render_testReorderDraws()
+ */
+static SDL_Surface *renderReorderScene(bool reorder)
+{
+    const Uint32 pixels[2][4] = {
+        { 0xFFFF0000, 0x80FF0000, 0xFFFF0000, 0x80FF0000 },
+        { 0x800000FF, 0xFF0000FF, 0x800000FF, 0xFF0000FF }
+    };
+    SDL_Surface *surface;
+    SDL_Renderer *software_renderer;
+    SDL_Texture *textures[2];
+    SDL_PropertiesID props;
+    SDL_Vertex verts[3];
+    int i, j;
 
-/* Render test cases */
-static const SDLTest_TestCaseReference renderTestGetNumRenderDrivers = {
-    render_testGetNumRenderDrivers, "render_testGetNumRenderDrivers", "Tests call to SDL_GetNumRenderDrivers", TEST_ENABLED
-};
+    surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateSurface() result");
+    if (surface == NULL) {
+        return NULL;
+    }
 
-static const SDLTest_TestCaseReference renderTestPrimitives = {
-    render_testPrimitives, "render_testPrimitives", "Tests rendering primitives", TEST_ENABLED
-};
+    props = SDL_CreateProperties();
+    SDL_SetStringProperty(props, SDL_PROP_RENDERER_CREATE_NAME_STRING, SDL_SOFTWARE_RENDERER);
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_SURFACE_POINTER, surface);
+    SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN, reorder);
+    software_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(software_renderer != NULL, "Verify SDL_CreateRendererWithProperties() result");
+    if (software_renderer == NULL) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
 
-static const SDLTest_TestCaseReference renderTestPrimitivesWithViewport = {
-    render_testPrimitivesWithViewport, "render_testPrimitivesWithViewport", "Tests rendering primitives within a viewport", TEST_ENABLED
-};
+    for (i = 0; i < 2; ++i) {
+        textures[i] = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 2);
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTexture() result");
+        if (textures[i]) {
+            SDL_UpdateTexture(textures[i], NULL, pixels[i], 2 * sizeof(Uint32));
+            SDL_SetTextureBlendMode(textures[i], SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(textures[i], SDL_SCALEMODE_NEAREST);
+        }
+    }
 
-static const SDLTest_TestCaseReference renderTestBlit = {
-    render_testBlit, "render_testBlit", "Tests blitting", TEST_ENABLED
-};
+    SDL_SetRenderDrawColor(software_renderer, 0x20, 0x40, 0x60, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+
+    /* Alternate textures across a grid of triangles, every other row overlaps the previous one */
+    for (i = 0; i < 40; ++i) {
+        const float x = (float)((i % 8) * 8);
+        const float y = (float)((i / 8) * 12 - ((i / 8) % 2) * 6);
+        const float w = 10.0f;
+        const float h = 10.0f;
+        const float uv[3][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 } };
+        const float xy[3][2] = { { x, y }, { x + w, y }, { x, y + h } };
+
+        for (j = 0; j < 3; ++j) {
+            verts[j].position.x = xy[j][0];
+            verts[j].position.y = xy[j][1];
+            verts[j].color.r = 1.0f;
+            verts[j].color.g = 1.0f;
+            verts[j].color.b = 1.0f;
+            verts[j].color.a = 1.0f;
+            verts[j].tex_coord.x = uv[j][0];
+            verts[j].tex_coord.y = uv[j][1];
+        }
+        SDL_RenderGeometry(software_renderer, textures[i % 2], verts, 3, NULL, 0);
+    }
+    SDL_RenderPresent(software_renderer);
 
-static const SDLTest_TestCaseReference renderTestBlitTiled = {
-    render_testBlitTiled, "render_testBlitTiled", "Tests tiled blitting", TEST_ENABLED
-};
+    SDL_DestroyTexture(textures[0]);
+    SDL_DestroyTexture(textures[1]);
+    SDL_DestroyRenderer(software_renderer);
+    return surface;
+}
 
-static const SDLTest_TestCaseReference renderTestBlit9Grid = {
-    render_testBlit9Grid, "render_testBlit9Grid", "Tests 9-grid blitting", TEST_ENABLED
-};
+/**
+ * Tests that reordering queued draws doesn't change the rendered result
+ */
+static int SDLCALL render_testReorderDraws(void *arg)
+{
+    SDL_Surface *referenceSurface;
+    SDL_Surface *reorderedSurface;
+    int ret;
 
-static const SDLTest_TestCaseReference renderTestBlit9GridTiled = {
-    render_testBlit9GridTiled, "render_testBlit9GridTiled", "Tests tiled 9-grid blitting", TEST_ENABLED
-};
+    referenceSurface = renderReorderScene(false);
+    reorderedSurface = renderReorderScene(true);
+    if (referenceSurface == NULL || reorderedSurface == NULL) {
+        SDL_DestroySurface(referenceSurface);
+        SDL_DestroySurface(reorderedSurface);
+        return TEST_ABORTED;
+    }
 
-static const SDLTest_TestCaseReference renderTestBlitColor = {
-    render_testBlitColor, "render_testBlitColor", "Tests blitting with color", TEST_ENABLED
-};
+    ret = SDLTest_CompareSurfaces(reorderedSurface, referenceSurface, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
 
-static const SDLTest_TestCaseReference renderTestBlendModes = {
-    render_testBlendModes, "render_testBlendModes", "Tests rendering blend modes", TEST_ENABLED
-};
+    SDL_DestroySurface(referenceSurface);
+    SDL_DestroySurface(reorderedSurface);
 
-static const SDLTest_TestCaseReference renderTestViewport = {
-    render_testViewport, "render_testViewport", "Tests viewport", TEST_ENABLED
-};
+    return TEST_COMPLETED;
+}
 
-static const SDLTest_TestCaseReference renderTestClipRect = {
-    render_testClipRect, "render_testClipRect", "Tests clip rect", TEST_ENABLED
-};
+static void drawListLayer(SDL_Renderer *software_renderer, SDL_Texture *texture, float x, float y)
+{
+    const SDL_FRect frame = { x + 2.0f, y + 2.0f, 30.0f, 20.0f };
+    const SDL_FRect sprite = { x + 8.0f, y + 6.0f, 12.0f, 12.0f };
+
+    SDL_SetRenderDrawColor(software_renderer, 0x80, 0x20, 0x20, 0xC0);
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderFillRect(software_renderer, &frame);
+    SDL_RenderTexture(software_renderer, texture, NULL, &sprite);
+    SDL_SetRenderDrawColor(software_renderer, 0xFF, 0xFF, 0x00, SDL_ALPHA_OPAQUE);
+    SDL_RenderLine(software_renderer, x + 2.0f, y + 24.0f, x + 31.0f, y + 24.0f);
+}
 
-static const SDLTest_TestCaseReference renderTestLogicalSize = {
-    render_testLogicalSize, "render_testLogicalSize", "Tests logical size", TEST_ENABLED
-};
+static SDL_Surface *renderListScene(bool use_list)
+{
+    const Uint32 pixels[4] = { 0xFFFF0000, 0x8000FF00, 0x800000FF, 0xFFFFFFFF };
+    const SDL_FPoint offsets[3] = { { 0.0f, 0.0f }, { 20.0f, 10.0f }, { 30.0f, 34.0f } };
+    SDL_Surface *surface;
+    SDL_Renderer *software_renderer;
+    SDL_Texture *texture;
+    SDL_RenderList *list = NULL;
+    int i;
 
-static const SDLTest_TestCaseReference renderTestUVWrapping = {
-    render_testUVWrapping, "render_testUVWrapping", "Tests geometry UV wrapping", TEST_ENABLED
-};
+    surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateSurface() result");
+    if (surface == NULL) {
+        return NULL;
+    }
 
-static const SDLTest_TestCaseReference renderTestTextureState = {
-    render_testTextureState, "render_testTextureState", "Tests texture state changes", TEST_ENABLED
-};
+    software_renderer = SDL_CreateSoftwareRenderer(surface);
+    SDLTest_AssertCheck(software_renderer != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+    texture = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 2);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (software_renderer == NULL || texture == NULL) {
+        SDL_DestroyRenderer(software_renderer);
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+    SDL_UpdateTexture(texture, NULL, pixels, 2 * sizeof(Uint32));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
 
-static const SDLTest_TestCaseReference renderTestGetSetTextureScaleMode = {
-    render_testGetSetTextureScaleMode, "render_testGetSetTextureScaleMode", "Tests setting/getting texture scale mode", TEST_ENABLED
+    if (use_list) {
+        list = SDL_CreateRenderList(software_renderer);
+        SDLTest_AssertCheck(list != NULL, "Verify SDL_CreateRenderList() result");
+        CHECK_FUNC(SDL_BeginRenderList, (list))
+        drawListLayer(software_renderer, texture, 0.0f, 0.0f);
+        CHECK_FUNC(SDL_EndRenderList, (list))
+    }
+
+    SDL_SetRenderDrawColor(software_renderer, 0x20, 0x40, 0x60, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+    for (i = 0; i < SDL_arraysize(offsets); ++i) {
+        if (use_list) {
+            CHECK_FUNC(SDL_ReplayRenderList, (list, offsets[i].x, offsets[i].y))
+        } else {
+            drawListLayer(software_renderer, texture, offsets[i].x, offsets[i].y);
+        }
+
+        /* Drawing after the list sets its own state again */
+        SDL_SetRenderDrawColor(software_renderer, 0x00, 0xFF, 0xFF, SDL_ALPHA_OPAQUE);
+        SDL_RenderPoint(software_renderer, (float)(60 - i), 2.0f);
+    }
+    SDL_RenderPresent(software_renderer);
+
+    if (use_list) {
+        /* A list that draws from a destroyed texture is emptied */
+        SDL_DestroyTexture(texture);
+        texture = NULL;
+        SDLTest_AssertCheck(SDL_ReplayRenderList(list, 0.0f, 0.0f), "Verify replaying an emptied render list succeeds");
+
+        /* The list outlives the renderer, but can't be replayed */
+        SDL_DestroyRenderer(software_renderer);
+        software_renderer = NULL;
+        SDLTest_AssertCheck(!SDL_ReplayRenderList(list, 0.0f, 0.0f), "Verify replaying a render list fails after its renderer is destroyed");
+        SDL_DestroyRenderList(list);
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    return surface;
+}
+
+/**
+ * Tests that replaying a render list matches drawing the same layer directly
+ *
+ * \sa SDL_ReplayRenderList
+ */
+static int SDLCALL render_testRenderList(void *arg)
+{
+    SDL_Surface *referenceSurface;
+    SDL_Surface *listSurface;
+    int ret;
+
+    referenceSurface = renderListScene(false);
+    listSurface = renderListScene(true);
+    if (referenceSurface == NULL || listSurface == NULL) {
+        SDL_DestroySurface(referenceSurface);
+        SDL_DestroySurface(listSurface);
+        return TEST_ABORTED;
+    }
+
+    ret = SDLTest_CompareSurfaces(listSurface, referenceSurface, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+    SDL_DestroySurface(referenceSurface);
+    SDL_DestroySurface(listSurface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that a texture batch matches drawing the same sprites one at a time
+ */
+static int SDLCALL render_testTextureBatch(void *arg)
+{
+    SDL_FRect srcrects[16];
+    SDL_FRect dstrects[16];
+    double angles[16];
+    SDL_FColor colors[16];
+    SDL_Texture *tface;
+    SDL_Surface *surface;
+    SDL_Surface *referenceSurface;
+    SDL_Rect rect;
+    bool result;
+    int i;
+
+    /* Create face texture. */
+    tface = loadTestFace();
+    SDLTest_AssertCheck(tface != NULL, "Verify loadTestFace() result");
+    if (tface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Rotations by quarter turns keep the sprite edges on pixel boundaries */
+    for (i = 0; i < SDL_arraysize(dstrects); ++i) {
+        srcrects[i].x = (float)((i % 4) * 8);
+        srcrects[i].y = (float)((i / 4) * 8);
+        srcrects[i].w = (float)(tface->w / 2);
+        srcrects[i].h = (float)(tface->h / 2);
+        dstrects[i].x = (float)((i % 4) * 72 + 8);
+        dstrects[i].y = (float)((i / 4) * 56 + 8);
+        dstrects[i].w = 48.0f;
+        dstrects[i].h = 48.0f;
+        angles[i] = (i % 4) * 90.0;
+        colors[i].r = 1.0f;
+        colors[i].g = (i % 2) ? 0.5f : 1.0f;
+        colors[i].b = (i % 3) ? 1.0f : 0.0f;
+        colors[i].a = 1.0f;
+    }
+
+    /* Draw the sprites one at a time for reference. */
+    clearScreen();
+    for (i = 0; i < SDL_arraysize(dstrects); ++i) {
+        SDL_SetTextureColorModFloat(tface, colors[i].r, colors[i].g, colors[i].b);
+        SDL_RenderTextureRotated(renderer, tface, &srcrects[i], &dstrects[i], angles[i], NULL, SDL_FLIP_NONE);
+    }
+    SDL_SetTextureColorModFloat(tface, 1.0f, 1.0f, 1.0f);
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H;
+    surface = SDL_RenderReadPixels(renderer, &rect);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels");
+    if (surface == NULL) {
+        SDL_DestroyTexture(tface);
+        return TEST_ABORTED;
+    }
+    referenceSurface = SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT);
+    SDL_DestroySurface(surface);
+    if (referenceSurface == NULL) {
+        SDL_DestroyTexture(tface);
+        return TEST_ABORTED;
+    }
+
+    /* Draw them again as a batch. */
+    clearScreen();
+    result = SDL_RenderTextureBatch(renderer, tface, srcrects, dstrects, angles, colors, SDL_arraysize(dstrects));
+    SDLTest_AssertCheck(result == true, "Validate result from SDL_RenderTextureBatch, expected: true, got: %s", result ? "true" : "false");
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+
+    /* Invalid parameters. */
+    result = SDL_RenderTextureBatch(renderer, tface, NULL, NULL, NULL, NULL, 1);
+    SDLTest_AssertCheck(result == false, "Validate NULL dstrects, expected: false, got: %s", result ? "true" : "false");
+    result = SDL_RenderTextureBatch(renderer, tface, NULL, dstrects, NULL, NULL, 0);
+    SDLTest_AssertCheck(result == true, "Validate empty batch, expected: true, got: %s", result ? "true" : "false");
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up. */
+    SDL_DestroyTexture(tface);
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that scaled lines and points cover the same pixels as the matching
+ * rects, with the joints of a closed polyline only blended once
+ */
+static int SDLCALL render_testScaledLines(void *arg)
+{
+    static const SDL_FPoint outline[] = {
+        { 10.0f, 10.0f }, { 30.0f, 10.0f }, { 30.0f, 20.0f }, { 10.0f, 20.0f }, { 10.0f, 10.0f }
+    };
+    static const SDL_FRect outline_rects[] = {
+        { 10.0f, 10.0f, 21.0f, 1.0f }, { 30.0f, 11.0f, 1.0f, 10.0f }, { 10.0f, 20.0f, 20.0f, 1.0f }, { 10.0f, 11.0f, 1.0f, 9.0f }
+    };
+    static const SDL_FPoint points[] = {
+        { 40.0f, 40.0f }, { 42.0f, 40.0f }, { 44.0f, 41.0f }
+    };
+    SDL_FRect point_rects[SDL_arraysize(points)];
+    SDL_Surface *surface;
+    SDL_Surface *referenceSurface;
+    SDL_Rect rect;
+    int i, w, h;
+    const int factor = 4;
+
+    for (i = 0; i < SDL_arraysize(points); ++i) {
+        point_rects[i].x = points[i].x;
+        point_rects[i].y = points[i].y;
+        point_rects[i].w = 1.0f;
+        point_rects[i].h = 1.0f;
+    }
+
+    CHECK_FUNC(SDL_GetCurrentRenderOutputSize, (renderer, &w, &h))
+
+    /* Fill the rects for reference. */
+    clearScreen();
+    CHECK_FUNC(SDL_SetRenderLogicalPresentation, (renderer, w / factor, h / factor, SDL_LOGICAL_PRESENTATION_LETTERBOX))
+    CHECK_FUNC(SDL_SetRenderDrawBlendMode, (renderer, SDL_BLENDMODE_BLEND))
+    CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 255, 128, 0, 128))
+    CHECK_FUNC(SDL_RenderFillRects, (renderer, outline_rects, SDL_arraysize(outline_rects)))
+    CHECK_FUNC(SDL_RenderFillRects, (renderer, point_rects, SDL_arraysize(point_rects)))
+    CHECK_FUNC(SDL_SetRenderLogicalPresentation, (renderer, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED))
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H;
+    surface = SDL_RenderReadPixels(renderer, &rect);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels");
+    if (surface == NULL) {
+        return TEST_ABORTED;
+    }
+    referenceSurface = SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT);
+    SDL_DestroySurface(surface);
+    if (referenceSurface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Draw them again as a polyline and points. */
+    clearScreen();
+    CHECK_FUNC(SDL_SetRenderLogicalPresentation, (renderer, w / factor, h / factor, SDL_LOGICAL_PRESENTATION_LETTERBOX))
+    CHECK_FUNC(SDL_SetRenderDrawBlendMode, (renderer, SDL_BLENDMODE_BLEND))
+    CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 255, 128, 0, 128))
+    CHECK_FUNC(SDL_RenderLines, (renderer, outline, SDL_arraysize(outline)))
+    CHECK_FUNC(SDL_RenderPoints, (renderer, points, SDL_arraysize(points)))
+    CHECK_FUNC(SDL_SetRenderLogicalPresentation, (renderer, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED))
+    compare(referenceSurface, ALLOWABLE_ERROR_BLENDED);
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
+static void drawAtlasScene(SDL_Texture **textures, int count)
+{
+    SDL_FRect dst;
+    int i;
+
+    clearScreen();
+    for (i = 0; i < count; ++i) {
+        dst.x = (float)(i * 100 + 8);
+        dst.y = 8.0f;
+        dst.w = 80.0f;
+        dst.h = 60.0f;
+        SDL_RenderTexture(renderer, textures[i], NULL, &dst);
+        dst.y = 80.0f;
+        SDL_RenderTextureRotated(renderer, textures[i], NULL, &dst, 90.0, NULL, SDL_FLIP_NONE);
+        dst.y = 160.0f;
+        SDL_RenderTextureTiled(renderer, textures[i], NULL, 0.75f, &dst);
+    }
+}
+
+/**
+ * Tests that textures packed into an atlas draw like regular textures
+ *
+ * \sa SDL_CreateTextureWithProperties
+ * \sa SDL_UpdateTexture
+ */
+static int SDLCALL render_testTextureAtlas(void *arg)
+{
+    SDL_Texture *textures[3];
+    SDL_Texture *atlased[3];
+    SDL_Surface *face;
+    SDL_Surface *surface;
+    SDL_Surface *referenceSurface;
+    SDL_PropertiesID props;
+    SDL_Rect rect;
+    Uint32 patch[8 * 8];
+    bool result;
+    int i;
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+    if (face == NULL) {
+        return TEST_ABORTED;
+    }
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, face->format);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, face->w);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, face->h);
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_SetBooleanProperty(props, SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN, false);
+        textures[i] = SDL_CreateTextureWithProperties(renderer, props);
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify regular texture creation");
+        SDL_SetBooleanProperty(props, SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN, true);
+        atlased[i] = SDL_CreateTextureWithProperties(renderer, props);
+        SDLTest_AssertCheck(atlased[i] != NULL, "Verify atlas texture creation");
+        if (textures[i] == NULL || atlased[i] == NULL) {
+            SDL_DestroyProperties(props);
+            SDL_DestroySurface(face);
+            return TEST_ABORTED;
+        }
+        SDL_UpdateTexture(textures[i], NULL, face->pixels, face->pitch);
+        result = SDL_UpdateTexture(atlased[i], NULL, face->pixels, face->pitch);
+        SDLTest_AssertCheck(result == true, "Validate result from SDL_UpdateTexture, expected: true, got: %s", result ? "true" : "false");
+    }
+    SDL_DestroyProperties(props);
+
+    /* Update a corner of one texture, which also touches its atlas gutter */
+    for (i = 0; i < SDL_arraysize(patch); ++i) {
+        patch[i] = 0xFF8040C0;
+    }
+    rect.x = face->w - 8;
+    rect.y = 0;
+    rect.w = 8;
+    rect.h = 8;
+    SDL_UpdateTexture(textures[1], &rect, patch, 8 * sizeof(Uint32));
+    SDL_UpdateTexture(atlased[1], &rect, patch, 8 * sizeof(Uint32));
+    SDL_DestroySurface(face);
+
+    /* Draw the regular textures for reference. */
+    drawAtlasScene(textures, SDL_arraysize(textures));
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H;
+    surface = SDL_RenderReadPixels(renderer, &rect);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels");
+    referenceSurface = surface ? SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT) : NULL;
+    SDL_DestroySurface(surface);
+
+    /* The atlas textures should look exactly the same. */
+    if (referenceSurface) {
+        drawAtlasScene(atlased, SDL_arraysize(atlased));
+        compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+        SDL_DestroySurface(referenceSurface);
+    }
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up, releasing the atlas out of order. */
+    SDL_DestroyTexture(atlased[1]);
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_DestroyTexture(textures[i]);
+        if (i != 1) {
+            SDL_DestroyTexture(atlased[i]);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+typedef struct
+{
+    SDL_Texture *texture;
+    Uint32 *pixels;
+    int completed;
+    int succeeded;
+} AsyncUpdateData;
+
+static void SDLCALL asyncUpdateComplete(void *userdata, SDL_Texture *texture, const void *pixels, bool success)
+{
+    AsyncUpdateData *data = (AsyncUpdateData *)userdata;
+
+    SDLTest_AssertCheck(texture == data->texture, "Verify callback texture");
+    SDLTest_AssertCheck(pixels == data->pixels, "Verify callback pixels");
+    ++data->completed;
+    if (success) {
+        ++data->succeeded;
+    }
+}
+
+static int SDLCALL asyncUpdateThread(void *userdata)
+{
+    AsyncUpdateData *data = (AsyncUpdateData *)userdata;
+
+    return SDL_UpdateTextureAsync(data->texture, NULL, data->pixels, 16 * sizeof(Uint32), asyncUpdateComplete, data) ? 1 : 0;
+}
+
+/**
+ * Tests scheduling texture updates from another thread
+ *
+ * \sa SDL_UpdateTextureAsync
+ */
+static int SDLCALL render_testUpdateTextureAsync(void *arg)
+{
+    AsyncUpdateData data;
+    Uint32 pixels[16 * 16];
+    SDL_Thread *thread;
+    SDL_Surface *surface;
+    SDL_Rect rect;
+    int status = 0;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(pixels); ++i) {
+        pixels[i] = 0xFF20A0E0;
+    }
+    SDL_zero(data);
+    data.pixels = pixels;
+    data.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+    SDLTest_AssertCheck(data.texture != NULL, "Verify texture creation");
+    if (data.texture == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Schedule the update from another thread, it isn't applied until the renderer flushes */
+    thread = SDL_CreateThread(asyncUpdateThread, "asyncUpdateThread", &data);
+    SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread()");
+    SDL_WaitThread(thread, &status);
+    SDLTest_AssertCheck(status == 1, "Validate result from SDL_UpdateTextureAsync, expected: 1, got: %d", status);
+    SDLTest_AssertCheck(data.completed == 0, "Verify the update is still pending, got %d completions", data.completed);
+
+    SDL_FlushRenderer(renderer);
+    SDLTest_AssertCheck(data.completed == 1 && data.succeeded == 1, "Verify the update was applied, got %d completions", data.succeeded);
+
+    clearScreen();
+    SDL_RenderTexture(renderer, data.texture, NULL, NULL);
+    rect.x = TESTRENDER_SCREEN_W / 2;
+    rect.y = TESTRENDER_SCREEN_H / 2;
+    rect.w = 1;
+    rect.h = 1;
+    surface = SDL_RenderReadPixels(renderer, &rect);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels");
+    if (surface) {
+        Uint8 r = 0, g = 0, b = 0, a = 0;
+        SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 0x20 && g == 0xA0 && b == 0xE0, "Verify the texture contents, got %d,%d,%d", r, g, b);
+        SDL_DestroySurface(surface);
+    }
+
+    /* Destroying the texture cancels updates that haven't been applied */
+    data.completed = 0;
+    data.succeeded = 0;
+    SDL_UpdateTextureAsync(data.texture, NULL, pixels, 16 * sizeof(Uint32), asyncUpdateComplete, &data);
+    SDL_DestroyTexture(data.texture);
+    SDLTest_AssertCheck(data.completed == 1 && data.succeeded == 0, "Verify the update was cancelled, got %d completions, %d successful", data.completed, data.succeeded);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests the per-frame statistics reported by SDL_GetRenderStats()
+ *
+ * \sa SDL_GetRenderStats
+ */
+static int SDLCALL render_testRenderStats(void *arg)
+{
+    SDL_RenderStats stats;
+    SDL_Texture *texture;
+    Uint32 pixels[16 * 16];
+    SDL_FRect rect;
+    bool result;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(pixels); ++i) {
+        pixels[i] = 0xFFFF0000;
+    }
+
+    result = SDL_GetRenderStats(renderer, NULL);
+    SDLTest_AssertCheck(!result, "Validate result from SDL_GetRenderStats(renderer, NULL), expected: false, got: %s", result ? "true" : "false");
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+    SDLTest_AssertCheck(texture != NULL, "Verify texture creation");
+    if (texture == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Start from a clean frame */
+    clearScreen();
+    SDL_UpdateTexture(texture, NULL, pixels, 16 * sizeof(Uint32));
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = 16.0f;
+    rect.h = 16.0f;
+    SDL_SetRenderDrawColor(renderer, 0, 255, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderFillRect(renderer, &rect);
+    rect.x = 32.0f;
+    SDL_RenderTexture(renderer, texture, NULL, &rect);
+    SDL_RenderPresent(renderer);
+
+    SDL_zero(stats);
+    result = SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(result, "Validate result from SDL_GetRenderStats, expected: true, got: %s", result ? "true" : "false");
+    SDLTest_AssertCheck(stats.commands >= 3, "Verify commands, expected: >= 3, got: %d", stats.commands);
+    SDLTest_AssertCheck(stats.draw_calls >= 2, "Verify draw calls, expected: >= 2, got: %d", stats.draw_calls);
+    SDLTest_AssertCheck(stats.vertex_bytes > 0, "Verify vertex bytes, expected: > 0, got: %" SDL_PRIu64, stats.vertex_bytes);
+    SDLTest_AssertCheck(stats.texture_upload_bytes >= sizeof(pixels), "Verify texture upload bytes, expected: >= %d, got: %" SDL_PRIu64, (int)sizeof(pixels), stats.texture_upload_bytes);
+
+    /* A frame with nothing drawn reports no draws */
+    SDL_RenderPresent(renderer);
+    result = SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(result, "Validate result from SDL_GetRenderStats, expected: true, got: %s", result ? "true" : "false");
+    SDLTest_AssertCheck(stats.draw_calls == 0, "Verify draw calls, expected: 0, got: %d", stats.draw_calls);
+    SDLTest_AssertCheck(stats.vertex_bytes == 0, "Verify vertex bytes, expected: 0, got: %" SDL_PRIu64, stats.vertex_bytes);
+    SDLTest_AssertCheck(stats.texture_upload_bytes == 0, "Verify texture upload bytes, expected: 0, got: %" SDL_PRIu64, stats.texture_upload_bytes);
+
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests the frame timings reported when GPU timing is enabled
+ *
+ * \sa SDL_GetRenderStats
+ */
+static int SDLCALL render_testGPUTiming(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_Window *timing_window;
+    SDL_Renderer *timing_renderer;
+    SDL_RenderStats stats;
+    SDL_FRect rect;
+    int i;
+
+    /* Timing is off unless it was requested */
+    clearScreen();
+    SDL_RenderPresent(renderer);
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.cpu_time_ns == 0 && stats.gpu_time_ns == 0, "Verify timings are disabled, got cpu: %" SDL_PRIu64 ", gpu: %" SDL_PRIu64, stats.cpu_time_ns, stats.gpu_time_ns);
+
+    timing_window = SDL_CreateWindow("render_testGPUTiming", TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 0);
+    SDLTest_AssertCheck(timing_window != NULL, "Check SDL_CreateWindow result");
+    if (timing_window == NULL) {
+        return TEST_ABORTED;
+    }
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_WINDOW_POINTER, timing_window);
+    SDL_SetStringProperty(props, SDL_PROP_RENDERER_CREATE_NAME_STRING, SDL_GetRendererName(renderer));
+    SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_GPU_TIMING_BOOLEAN, true);
+    timing_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(timing_renderer != NULL, "Check SDL_CreateRendererWithProperties result: %s", timing_renderer != NULL ? "success" : SDL_GetError());
+    if (timing_renderer == NULL) {
+        SDL_DestroyWindow(timing_window);
+        return TEST_ABORTED;
+    }
+
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = (float)TESTRENDER_SCREEN_W;
+    rect.h = (float)TESTRENDER_SCREEN_H;
+    for (i = 0; i < 8; ++i) {
+        SDL_SetRenderDrawColor(timing_renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+        SDL_RenderClear(timing_renderer);
+        SDL_SetRenderDrawColor(timing_renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+        SDL_RenderFillRect(timing_renderer, &rect);
+        SDL_RenderPresent(timing_renderer);
+    }
+    SDL_GetRenderStats(timing_renderer, &stats);
+    SDLTest_AssertCheck(stats.cpu_time_ns > 0, "Verify CPU time, expected: > 0, got: %" SDL_PRIu64, stats.cpu_time_ns);
+    SDLTest_Log("GPU time reported by %s: %" SDL_PRIu64 " ns", SDL_GetRendererName(timing_renderer), stats.gpu_time_ns);
+
+    SDL_DestroyRenderer(timing_renderer);
+    SDL_DestroyWindow(timing_window);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that presents are skipped while the window is hidden when throttling is enabled
+ *
+ * \sa SDL_HINT_RENDER_THROTTLE_OCCLUDED
+ */
+static int SDLCALL render_testThrottleOccluded(void *arg)
+{
+    SDL_Window *throttle_window;
+    SDL_Renderer *throttle_renderer;
+    SDL_RenderStats stats;
+
+    SDL_SetHint(SDL_HINT_RENDER_THROTTLE_OCCLUDED, "1");
+    throttle_window = SDL_CreateWindow("render_testThrottleOccluded", TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 0);
+    SDLTest_AssertCheck(throttle_window != NULL, "Check SDL_CreateWindow result");
+    if (throttle_window == NULL) {
+        SDL_ResetHint(SDL_HINT_RENDER_THROTTLE_OCCLUDED);
+        return TEST_ABORTED;
+    }
+    throttle_renderer = SDL_CreateRenderer(throttle_window, SDL_GetRendererName(renderer));
+    SDL_ResetHint(SDL_HINT_RENDER_THROTTLE_OCCLUDED);
+    SDLTest_AssertCheck(throttle_renderer != NULL, "Check SDL_CreateRenderer result: %s", throttle_renderer != NULL ? "success" : SDL_GetError());
+    if (throttle_renderer == NULL) {
+        SDL_DestroyWindow(throttle_window);
+        return TEST_ABORTED;
+    }
+
+    SDL_RenderPresent(throttle_renderer);
+    SDL_GetRenderStats(throttle_renderer, &stats);
+    SDLTest_AssertCheck(!stats.throttled, "Verify visible frame is presented, got throttled: %s", stats.throttled ? "true" : "false");
+
+    SDL_HideWindow(throttle_window);
+    SDL_RenderPresent(throttle_renderer);
+    SDL_GetRenderStats(throttle_renderer, &stats);
+    SDLTest_AssertCheck(stats.throttled, "Verify hidden frame is throttled, got throttled: %s", stats.throttled ? "true" : "false");
+
+    SDL_ShowWindow(throttle_window);
+    SDL_RenderPresent(throttle_renderer);
+    SDL_GetRenderStats(throttle_renderer, &stats);
+    SDLTest_AssertCheck(!stats.throttled, "Verify shown frame is presented, got throttled: %s", stats.throttled ? "true" : "false");
+
+    SDL_DestroyRenderer(throttle_renderer);
+    SDL_DestroyWindow(throttle_window);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests setting the presented region of the back buffer
+ *
+ * \sa SDL_SetRenderOutputSourceSize
+ */
+static int SDLCALL render_testOutputSourceSize(void *arg)
+{
+    int w, h, source_w, source_h;
+    bool result;
+
+    result = SDL_SetRenderOutputSourceSize(renderer, -1, 0);
+    SDLTest_AssertCheck(!result, "Validate result from SDL_SetRenderOutputSourceSize(renderer, -1, 0), expected: false, got: %s", result ? "true" : "false");
+
+    SDL_GetRenderOutputSize(renderer, &w, &h);
+    result = SDL_SetRenderOutputSourceSize(renderer, w / 2, h / 2);
+    if (!result) {
+        SDLTest_Log("SDL_SetRenderOutputSourceSize not supported by %s: %s", SDL_GetRendererName(renderer), SDL_GetError());
+        SDL_GetRenderOutputSize(renderer, &source_w, &source_h);
+        SDLTest_AssertCheck(source_w == w && source_h == h, "Verify output size is unchanged, expected: %dx%d, got: %dx%d", w, h, source_w, source_h);
+        return TEST_COMPLETED;
+    }
+
+    SDL_GetRenderOutputSize(renderer, &source_w, &source_h);
+    SDLTest_AssertCheck(source_w == w / 2 && source_h == h / 2, "Verify output size, expected: %dx%d, got: %dx%d", w / 2, h / 2, source_w, source_h);
+
+    result = SDL_SetRenderOutputSourceSize(renderer, 0, 0);
+    SDLTest_AssertCheck(result, "Validate result from SDL_SetRenderOutputSourceSize(renderer, 0, 0), expected: true, got: %s", result ? "true" : "false");
+    SDL_GetRenderOutputSize(renderer, &source_w, &source_h);
+    SDLTest_AssertCheck(source_w == w && source_h == h, "Verify output size is restored, expected: %dx%d, got: %dx%d", w, h, source_w, source_h);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests drawing a scene at a reduced resolution and upscaling it
+ *
+ * \sa SDL_SetRenderDynamicResolution
+ * \sa SDL_RenderDynamicResolutionUpscale
+ */
+static int SDLCALL render_testDynamicResolution(void *arg)
+{
+    SDL_RenderStats stats;
+    SDL_Surface *surface;
+    SDL_FRect rect;
+    int w, h, scene_w, scene_h;
+    Uint8 r, g, b, a;
+    bool result;
+
+    result = SDL_SetRenderDynamicResolution(renderer, 0.0f, 0);
+    SDLTest_AssertCheck(!result, "Validate result from SDL_SetRenderDynamicResolution(renderer, 0.0f, 0), expected: false, got: %s", result ? "true" : "false");
+    result = SDL_SetRenderDynamicResolution(renderer, 0.5f, SDL_NS_PER_SECOND / 60);
+    SDLTest_AssertCheck(!result, "Validate GPU budget requires GPU timing, expected: false, got: %s", result ? "true" : "false");
+
+    SDL_GetRenderOutputSize(renderer, &w, &h);
+    result = SDL_SetRenderDynamicResolution(renderer, 0.5f, 0);
+    SDLTest_AssertCheck(result, "Validate result from SDL_SetRenderDynamicResolution(renderer, 0.5f, 0), expected: true, got: %s", result ? "true" : "false");
+    if (!result) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetRenderTarget(renderer) == NULL, "Verify the render target is still the window");
+    SDL_GetCurrentRenderOutputSize(renderer, &scene_w, &scene_h);
+    SDLTest_AssertCheck(scene_w == w / 2 && scene_h == h / 2, "Verify scene size, expected: %dx%d, got: %dx%d", w / 2, h / 2, scene_w, scene_h);
+
+    /* Draw the scene and a full resolution overlay */
+    SDL_SetRenderDrawColor(renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    result = SDL_RenderDynamicResolutionUpscale(renderer);
+    SDLTest_AssertCheck(result, "Validate result from SDL_RenderDynamicResolutionUpscale, expected: true, got: %s", result ? "true" : "false");
+    SDL_GetCurrentRenderOutputSize(renderer, &scene_w, &scene_h);
+    SDLTest_AssertCheck(scene_w == w && scene_h == h, "Verify overlay size, expected: %dx%d, got: %dx%d", w, h, scene_w, scene_h);
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = 1.0f;
+    rect.h = 1.0f;
+    SDL_SetRenderDrawColor(renderer, 0, 255, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderFillRect(renderer, &rect);
+
+    surface = SDL_RenderReadPixels(renderer, NULL);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_RenderReadPixels is not NULL");
+    if (surface) {
+        SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 0 && g == 255 && b == 0, "Verify overlay pixel, expected: 0,255,0, got: %d,%d,%d", r, g, b);
+        SDL_ReadSurfacePixel(surface, 1, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 255 && g == 0 && b == 0, "Verify upscaled scene pixel, expected: 255,0,0, got: %d,%d,%d", r, g, b);
+        SDL_ReadSurfacePixel(surface, w - 1, h - 1, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 255 && g == 0 && b == 0, "Verify upscaled scene corner, expected: 255,0,0, got: %d,%d,%d", r, g, b);
+        SDL_DestroySurface(surface);
+    }
+
+    SDL_RenderPresent(renderer);
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.resolution_scale == 0.5f, "Verify resolution scale, expected: 0.5, got: %f", stats.resolution_scale);
+    SDL_GetCurrentRenderOutputSize(renderer, &scene_w, &scene_h);
+    SDLTest_AssertCheck(scene_w == w / 2 && scene_h == h / 2, "Verify next scene size, expected: %dx%d, got: %dx%d", w / 2, h / 2, scene_w, scene_h);
+
+    result = SDL_SetRenderDynamicResolution(renderer, 1.0f, 0);
+    SDLTest_AssertCheck(result, "Validate result from SDL_SetRenderDynamicResolution(renderer, 1.0f, 0), expected: true, got: %s", result ? "true" : "false");
+    SDL_GetCurrentRenderOutputSize(renderer, &scene_w, &scene_h);
+    SDLTest_AssertCheck(scene_w == w && scene_h == h, "Verify output size is restored, expected: %dx%d, got: %dx%d", w, h, scene_w, scene_h);
+    SDL_RenderPresent(renderer);
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.resolution_scale == 1.0f, "Verify resolution scale, expected: 1.0, got: %f", stats.resolution_scale);
+
+    return TEST_COMPLETED;
+}
+
+static int restore_count;
+
+static bool SDLCALL RestoreGreenTexture(void *userdata, SDL_Texture *texture)
+{
+    SDL_Surface *surface = (SDL_Surface *)userdata;
+
+    ++restore_count;
+    return SDL_UpdateTexture(texture, NULL, surface->pixels, surface->pitch);
+}
+
+/**
+ * Tests evicting and restoring textures to stay within a memory budget
+ *
+ * \sa SDL_SetRenderTextureMemoryBudget
+ */
+static int SDLCALL render_testTextureMemoryBudget(void *arg)
+{
+    SDL_Surface *red, *green, *surface;
+    SDL_Texture *backed, *restored;
+    SDL_PropertiesID props;
+    SDL_RenderStats stats;
+    SDL_FRect rect;
+    Uint8 r, g, b, a;
+    bool result;
+
+    red = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    green = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(red && green, "Verify test surfaces were created");
+    if (!red || !green) {
+        SDL_DestroySurface(red);
+        SDL_DestroySurface(green);
+        return TEST_ABORTED;
+    }
+    SDL_FillSurfaceRect(red, NULL, SDL_MapSurfaceRGB(red, 255, 0, 0));
+    SDL_FillSurfaceRect(green, NULL, SDL_MapSurfaceRGB(green, 0, 255, 0));
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_BACKING_SURFACE_POINTER, red);
+    backed = SDL_CreateTextureWithProperties(renderer, props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(backed != NULL, "Verify texture with a backing surface was created, %s", SDL_GetError());
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, SDL_PIXELFORMAT_ARGB8888);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, 16);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, 16);
+    SDL_SetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_RESTORE_CALLBACK_POINTER, (void *)RestoreGreenTexture);
+    SDL_SetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_RESTORE_USERDATA_POINTER, green);
+    restored = SDL_CreateTextureWithProperties(renderer, props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(restored != NULL, "Verify texture with a restore callback was created, %s", SDL_GetError());
+
+    /* The surface is referenced by the texture */
+    SDL_DestroySurface(red);
+
+    if (!backed || !restored) {
+        SDL_DestroyTexture(backed);
+        SDL_DestroyTexture(restored);
+        SDL_DestroySurface(green);
+        return TEST_ABORTED;
+    }
+    SDL_UpdateTexture(restored, NULL, green->pixels, green->pitch);
+
+    /* Evict everything that can be evicted */
+    SDL_RenderPresent(renderer);
+    result = SDL_SetRenderTextureMemoryBudget(renderer, 1);
+    SDLTest_AssertCheck(result, "Validate result from SDL_SetRenderTextureMemoryBudget(renderer, 1), expected: true, got: %s", result ? "true" : "false");
+
+    restore_count = 0;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = 16.0f;
+    rect.h = 16.0f;
+    result = SDL_RenderTexture(renderer, backed, NULL, &rect);
+    SDLTest_AssertCheck(result, "Validate drawing an evicted texture with a backing surface, %s", SDL_GetError());
+    rect.x = 16.0f;
+    result = SDL_RenderTexture(renderer, restored, NULL, &rect);
+    SDLTest_AssertCheck(result, "Validate drawing an evicted texture with a restore callback, %s", SDL_GetError());
+    SDLTest_AssertCheck(restore_count == 1, "Verify restore callback was called once, got: %d", restore_count);
+
+    surface = SDL_RenderReadPixels(renderer, NULL);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+    if (surface) {
+        SDL_ReadSurfacePixel(surface, 8, 8, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 255 && g == 0 && b == 0, "Verify restored backing surface pixel, expected: 255,0,0, got: %d,%d,%d", r, g, b);
+        SDL_ReadSurfacePixel(surface, 24, 8, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 0 && g == 255 && b == 0, "Verify restored callback pixel, expected: 0,255,0, got: %d,%d,%d", r, g, b);
+        SDL_DestroySurface(surface);
+    }
+
+    SDL_RenderPresent(renderer);
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.textures_restored == 2, "Verify restored textures, expected: 2, got: %d", stats.textures_restored);
+    SDLTest_AssertCheck(stats.texture_memory > 0, "Verify texture memory is reported, got: %" SDL_PRIu64, stats.texture_memory);
+
+    SDL_SetRenderTextureMemoryBudget(renderer, 0);
+    SDL_DestroyTexture(backed);
+    SDL_DestroyTexture(restored);
+    SDL_DestroySurface(green);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests reading pixels without waiting for the GPU
+ *
+ * \sa SDL_RenderReadPixelsAsync
+ * \sa SDL_CollectRenderReadback
+ */
+static int SDLCALL render_testReadPixelsAsync(void *arg)
+{
+    SDL_RenderReadback *readback, *cancelled;
+    SDL_Surface *surface;
+    SDL_Rect rect;
+    Uint8 r, g, b, a;
+    int i;
+
+    surface = SDL_CollectRenderReadback(NULL);
+    SDLTest_AssertCheck(surface == NULL, "Validate SDL_CollectRenderReadback(NULL) fails");
+
+    SDL_SetRenderDrawColor(renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+
+    rect.x = 8;
+    rect.y = 8;
+    rect.w = 16;
+    rect.h = 16;
+    readback = SDL_RenderReadPixelsAsync(renderer, &rect);
+    SDLTest_AssertCheck(readback != NULL, "Validate result from SDL_RenderReadPixelsAsync, expected: not NULL, got: %p", (void *)readback);
+    if (!readback) {
+        return TEST_ABORTED;
+    }
+    cancelled = SDL_RenderReadPixelsAsync(renderer, NULL);
+    SDLTest_AssertCheck(cancelled != NULL, "Validate result from SDL_RenderReadPixelsAsync(renderer, NULL), expected: not NULL, got: %p", (void *)cancelled);
+
+    /* Drawing after the request doesn't change the pixels that were read */
+    SDL_SetRenderDrawColor(renderer, 0, 255, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    SDL_RenderPresent(renderer);
+
+    for (i = 0; i < 100 && !SDL_IsRenderReadbackReady(readback); ++i) {
+        SDL_Delay(1);
+    }
+    SDL_CancelRenderReadback(cancelled);
+
+    surface = SDL_CollectRenderReadback(readback);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_CollectRenderReadback, got NULL, %s", SDL_GetError());
+    if (surface) {
+        SDLTest_AssertCheck(surface->w == rect.w && surface->h == rect.h, "Verify surface size, expected: %dx%d, got: %dx%d", rect.w, rect.h, surface->w, surface->h);
+        SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 255 && g == 0 && b == 0, "Verify read pixel, expected: 255,0,0, got: %d,%d,%d", r, g, b);
+        SDL_DestroySurface(surface);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests creating and updating block compressed textures
+ *
+ * \sa SDL_CreateTexture
+ * \sa SDL_UpdateTexture
+ */
+static int SDLCALL render_testCompressedTexture(void *arg)
+{
+    /* Four solid red BC1 blocks, color0 == color1 == RGB565 red */
+    static const Uint8 block[8] = { 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+    Uint8 blocks[4 * sizeof(block)];
+    const SDL_PixelFormat *formats;
+    SDL_Texture *texture;
+    SDL_Surface *surface;
+    SDL_FRect rect;
+    Uint8 r, g, b, a;
+    bool supported = false;
+    bool result;
+    int i;
+
+    formats = (const SDL_PixelFormat *)SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, NULL);
+    for (i = 0; formats && formats[i] != SDL_PIXELFORMAT_UNKNOWN; ++i) {
+        if (formats[i] == SDL_PIXELFORMAT_BC1) {
+            supported = true;
+        }
+    }
+
+    SDLTest_AssertCheck(SDL_strcmp(SDL_GetPixelFormatName(SDL_PIXELFORMAT_BC1), "SDL_PIXELFORMAT_BC1") == 0, "Verify BC1 format name, got: %s", SDL_GetPixelFormatName(SDL_PIXELFORMAT_BC1));
+
+    if (!supported) {
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_BC1, SDL_TEXTUREACCESS_STATIC, 8, 8);
+        SDLTest_AssertCheck(texture == NULL, "Verify BC1 texture creation fails on %s", SDL_GetRendererName(renderer));
+        SDL_DestroyTexture(texture);
+        return TEST_COMPLETED;
+    }
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_BC1, SDL_TEXTUREACCESS_STREAMING, 8, 8);
+    SDLTest_AssertCheck(texture == NULL, "Verify streaming BC1 texture creation fails");
+    SDL_DestroyTexture(texture);
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_BC1, SDL_TEXTUREACCESS_STATIC, 6, 8);
+    SDLTest_AssertCheck(texture == NULL, "Verify unaligned BC1 texture creation fails");
+    SDL_DestroyTexture(texture);
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_BC1, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture(BC1), expected: not NULL, got: %p", (void *)texture);
+    if (!texture) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        SDL_memcpy(&blocks[i * sizeof(block)], block, sizeof(block));
+    }
+    result = SDL_UpdateTexture(texture, NULL, blocks, 2 * sizeof(block));
+    SDLTest_AssertCheck(result, "Validate result from SDL_UpdateTexture, expected: true, got: %s", result ? "true" : "false");
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = 8.0f;
+    rect.h = 8.0f;
+    SDL_RenderTexture(renderer, texture, NULL, &rect);
+
+    surface = SDL_RenderReadPixels(renderer, NULL);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+    if (surface) {
+        SDL_ReadSurfacePixel(surface, 4, 4, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 255 && g == 0 && b == 0, "Verify decoded pixel, expected: 255,0,0, got: %d,%d,%d", r, g, b);
+        SDL_DestroySurface(surface);
+    }
+
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Render test cases */
+static const SDLTest_TestCaseReference renderTestGetNumRenderDrivers = {
+    render_testGetNumRenderDrivers, "render_testGetNumRenderDrivers", "Tests call to SDL_GetNumRenderDrivers", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestPrimitives = {
+    render_testPrimitives, "render_testPrimitives", "Tests rendering primitives", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestPrimitivesWithViewport = {
+    render_testPrimitivesWithViewport, "render_testPrimitivesWithViewport", "Tests rendering primitives within a viewport", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlit = {
+    render_testBlit, "render_testBlit", "Tests blitting", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlitTiled = {
+    render_testBlitTiled, "render_testBlitTiled", "Tests tiled blitting", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlit9Grid = {
+    render_testBlit9Grid, "render_testBlit9Grid", "Tests 9-grid blitting", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlit9GridTiled = {
+    render_testBlit9GridTiled, "render_testBlit9GridTiled", "Tests tiled 9-grid blitting", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlitColor = {
+    render_testBlitColor, "render_testBlitColor", "Tests blitting with color", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlendModes = {
+    render_testBlendModes, "render_testBlendModes", "Tests rendering blend modes", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestViewport = {
+    render_testViewport, "render_testViewport", "Tests viewport", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestClipRect = {
+    render_testClipRect, "render_testClipRect", "Tests clip rect", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestLogicalSize = {
+    render_testLogicalSize, "render_testLogicalSize", "Tests logical size", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestUVWrapping = {
+    render_testUVWrapping, "render_testUVWrapping", "Tests geometry UV wrapping", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestTextureState = {
+    render_testTextureState, "render_testTextureState", "Tests texture state changes", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestGetSetTextureScaleMode = {
+    render_testGetSetTextureScaleMode, "render_testGetSetTextureScaleMode", "Tests setting/getting texture scale mode", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestLockTexture = {
+    render_testLockTexture, "render_testLockTexture", "Tests locking and updating streaming textures", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestReorderDraws = {
+    render_testReorderDraws, "render_testReorderDraws", "Tests reordering non-overlapping draws", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestTextureBatch = {
+    render_testTextureBatch, "render_testTextureBatch", "Tests drawing a batch of texture sprites", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestScaledLines = {
+    render_testScaledLines, "render_testScaledLines", "Tests drawing scaled lines and points", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestTextureAtlas = {
+    render_testTextureAtlas, "render_testTextureAtlas", "Tests drawing textures packed into an atlas", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestUpdateTextureAsync = {
+    render_testUpdateTextureAsync, "render_testUpdateTextureAsync", "Tests scheduling texture updates from another thread", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestRenderStats = {
+    render_testRenderStats, "render_testRenderStats", "Tests per-frame renderer statistics", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestGPUTiming = {
+    render_testGPUTiming, "render_testGPUTiming", "Tests frame timings with GPU timing enabled", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestThrottleOccluded = {
+    render_testThrottleOccluded, "render_testThrottleOccluded", "Tests throttling presents while the window is hidden", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestOutputSourceSize = {
+    render_testOutputSourceSize, "render_testOutputSourceSize", "Tests setting the presented region of the back buffer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestDynamicResolution = {
+    render_testDynamicResolution, "render_testDynamicResolution", "Tests drawing a scene at a reduced resolution and upscaling it", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestTextureMemoryBudget = {
+    render_testTextureMemoryBudget, "render_testTextureMemoryBudget", "Tests evicting and restoring textures to stay within a memory budget", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestReadPixelsAsync = {
+    render_testReadPixelsAsync, "render_testReadPixelsAsync", "Tests reading pixels without waiting for the GPU", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestCompressedTexture = {
+    render_testCompressedTexture, "render_testCompressedTexture", "Tests creating and updating block compressed textures", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestPresentRegions = {
+    render_testPresentRegions, "render_testPresentRegions", "Tests setting dirty and scroll regions for present", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareTiles = {
+    render_testSoftwareTiles, "render_testSoftwareTiles", "Tests that tiled software rendering matches untiled rendering", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareYUV = {
+    render_testSoftwareYUV, "render_testSoftwareYUV", "Tests that YUV textures on the software renderer match SDL_ConvertPixels()", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestRenderList = {
+    render_testRenderList, "render_testRenderList", "Tests that replaying a render list matches drawing directly", TEST_ENABLED
 };
 
 static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
@@ -2068,7 +3524,25 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestUVWrapping,
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
+    &renderTestLockTexture,
+    &renderTestReorderDraws,
+    &renderTestTextureBatch,
+    &renderTestScaledLines,
+    &renderTestTextureAtlas,
+    &renderTestUpdateTextureAsync,
+    &renderTestRenderStats,
+    &renderTestGPUTiming,
+    &renderTestThrottleOccluded,
+    &renderTestOutputSourceSize,
+    &renderTestDynamicResolution,
+    &renderTestTextureMemoryBudget,
+    &renderTestReadPixelsAsync,
+    &renderTestCompressedTexture,
+    &renderTestPresentRegions,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestSoftwareTiles,
+    &renderTestSoftwareYUV,
+    &renderTestRenderList,
     NULL
 };
 
@@ -961,6 +961,215 @@ static int SDLCALL stdlib_aligned_alloc(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Call to the original memory functions with small sizes, which may be served from a per-thread cache
+ */
+static int SDLCALL stdlib_small_alloc(void *arg)
+{
+    SDL_malloc_func malloc_func;
+    SDL_calloc_func calloc_func;
+    SDL_realloc_func realloc_func;
+    SDL_free_func free_func;
+    SDL_MemoryCacheStats before, after;
+    Uint8 *blocks[256];
+    bool have_stats;
+    int i, j;
+
+    /* The test harness may replace the memory functions to track allocations,
+       so go straight to the ones SDL was built with */
+    SDL_GetOriginalMemoryFunctions(&malloc_func, &calloc_func, &realloc_func, &free_func);
+
+    have_stats = SDL_GetMemoryCacheStats(&before);
+    SDLTest_AssertPass("Call to SDL_GetMemoryCacheStats(), %s", have_stats ? "supported" : "not supported");
+
+    for (i = 0; i < (int)SDL_arraysize(blocks); ++i) {
+        const size_t size = 1 + (i * 7) % 600;
+        blocks[i] = (Uint8 *)((i % 2) ? calloc_func(1, size) : malloc_func(size));
+        SDLTest_AssertCheck(blocks[i] != NULL, "Check allocation of %" SIZE_FORMAT " bytes", size);
+        if (!blocks[i]) {
+            return TEST_ABORTED;
+        }
+        if (i % 2) {
+            for (j = 0; j < (int)size && blocks[i][j] == 0; ++j) {
+            }
+            SDLTest_AssertCheck(j == (int)size, "Check calloc memory is zeroed");
+        }
+        SDL_memset(blocks[i], i, size);
+    }
+    for (i = 0; i < (int)SDL_arraysize(blocks); ++i) {
+        const size_t size = 1 + (i * 7) % 600;
+        for (j = 0; j < (int)size && blocks[i][j] == (Uint8)i; ++j) {
+        }
+        SDLTest_AssertCheck(j == (int)size, "Check block %d wasn't overwritten", i);
+    }
+
+    // Grow some blocks out of the cached sizes and back again
+    for (i = 0; i < (int)SDL_arraysize(blocks); i += 4) {
+        Uint8 *block = (Uint8 *)realloc_func(blocks[i], 4096);
+        SDLTest_AssertCheck(block != NULL, "Check realloc to 4096 bytes");
+        if (block) {
+            SDLTest_AssertCheck(block[0] == (Uint8)i, "Check realloc kept the contents");
+            block = (Uint8 *)realloc_func(block, 8);
+            SDLTest_AssertCheck(block != NULL, "Check realloc to 8 bytes");
+        }
+        if (block) {
+            blocks[i] = block;
+        }
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(blocks); ++i) {
+        free_func(blocks[i]);
+    }
+
+    if (have_stats) {
+        // Allocate and free a block of the same size, which should come back from the cache
+        for (i = 0; i < 10; ++i) {
+            free_func(malloc_func(24));
+        }
+        SDLTest_AssertCheck(SDL_GetMemoryCacheStats(&after), "Call to SDL_GetMemoryCacheStats()");
+        SDLTest_AssertCheck(after.hits > before.hits, "Check cache hits went up, before %" SDL_PRIu64 ", after %" SDL_PRIu64, before.hits, after.hits);
+        SDLTest_AssertCheck(after.refills > before.refills, "Check cache refills went up, before %" SDL_PRIu64 ", after %" SDL_PRIu64, before.refills, after.refills);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Calls to the SDL_Arena functions
+ */
+static int SDLCALL stdlib_arena(void *arg)
+{
+    SDL_Arena *arena;
+    SDL_ArenaMark mark;
+    Uint8 *first, *small, *big, *again;
+    int i;
+
+    arena = SDL_CreateArena(1024, false);
+    SDLTest_AssertCheck(arena != NULL, "Call to SDL_CreateArena(1024, false)");
+    if (!arena) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetArenaMark(arena) == 0, "Check a new arena's mark is 0");
+
+    first = (Uint8 *)SDL_AllocateArenaMemory(arena, 1, 1);
+    SDLTest_AssertCheck(first != NULL, "Call to SDL_AllocateArenaMemory(1, 1)");
+    for (i = 1; i <= 256; i *= 2) {
+        Uint8 *ptr = (Uint8 *)SDL_AllocateArenaMemory(arena, 3, i);
+        SDLTest_AssertCheck(ptr != NULL && ((uintptr_t)ptr % i) == 0, "Check allocation aligned to %d, got %p", i, ptr);
+    }
+    SDLTest_AssertCheck(SDL_AllocateArenaMemory(arena, 8, 3) == NULL, "Check a non power of two alignment fails");
+
+    mark = SDL_GetArenaMark(arena);
+    small = (Uint8 *)SDL_AllocateArenaMemory(arena, 16, 0);
+    SDLTest_AssertCheck(small != NULL && ((uintptr_t)small % 16) == 0, "Check the default alignment is 16, got %p", small);
+
+    // Bigger than a chunk, and spilling into a new chunk
+    big = (Uint8 *)SDL_AllocateArenaMemory(arena, 4000, 0);
+    SDLTest_AssertCheck(big != NULL, "Check an allocation bigger than the chunk size");
+    if (big) {
+        SDL_memset(big, 0xAA, 4000);
+    }
+    for (i = 0; i < 100; ++i) {
+        SDLTest_AssertCheck(SDL_AllocateArenaMemory(arena, 100, 0) != NULL, "Check allocation %d of 100 bytes", i);
+    }
+    SDLTest_AssertCheck(SDL_GetArenaMark(arena) > mark, "Check the mark moved forward");
+
+    SDL_ResetArenaToMark(arena, mark);
+    SDLTest_AssertCheck(SDL_GetArenaMark(arena) == mark, "Check SDL_ResetArenaToMark() went back to the mark");
+    again = (Uint8 *)SDL_AllocateArenaMemory(arena, 16, 0);
+    SDLTest_AssertCheck(again == small, "Check memory after the mark is reused, expected %p, got %p", small, again);
+
+    SDL_ResetArena(arena);
+    SDLTest_AssertCheck(SDL_GetArenaMark(arena) == 0, "Check SDL_ResetArena() went back to 0");
+    again = (Uint8 *)SDL_AllocateArenaMemory(arena, 1, 1);
+    SDLTest_AssertCheck(again == first, "Check memory is reused after a reset, expected %p, got %p", first, again);
+
+    SDL_DestroyArena(arena);
+    SDLTest_AssertPass("Call to SDL_DestroyArena()");
+
+    arena = SDL_CreateArena(0, true);
+    SDLTest_AssertCheck(arena != NULL, "Call to SDL_CreateArena(0, true)");
+    SDLTest_AssertCheck(SDL_AllocateArenaMemory(arena, 100000, 0) != NULL, "Check a large allocation from a thread-safe arena");
+    SDL_DestroyArena(arena);
+
+    SDLTest_AssertCheck(SDL_AllocateArenaMemory(NULL, 1, 0) == NULL, "Check allocating from a NULL arena fails");
+    SDL_ResetArena(NULL);
+    SDL_DestroyArena(NULL);
+    SDLTest_AssertPass("Call to SDL_ResetArena(NULL) and SDL_DestroyArena(NULL)");
+
+    return TEST_COMPLETED;
+}
+
+static Uint32 crc32_bitwise(Uint32 crc, const Uint8 *data, size_t len)
+{
+    int i;
+
+    crc = ~crc;
+    while (len--) {
+        crc ^= *data++;
+        for (i = 0; i < 8; ++i) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * Call to SDL_crc16 and SDL_crc32
+ */
+static int SDLCALL stdlib_crc(void *arg)
+{
+    const char *check = "123456789";
+    const size_t size = 100000;
+    Uint8 *data;
+    Uint32 crc, expected;
+    size_t i, offset, len;
+
+    crc = SDL_crc32(0, check, SDL_strlen(check));
+    SDLTest_AssertCheck(crc == 0xCBF43926, "Check SDL_crc32(\"%s\"), expected 0xCBF43926, got 0x%.8" SDL_PRIX32, check, crc);
+    crc = SDL_crc16(0, check, SDL_strlen(check));
+    SDLTest_AssertCheck(crc == 0xBB3D, "Check SDL_crc16(\"%s\"), expected 0xBB3D, got 0x%.4" SDL_PRIX32, check, crc);
+    crc = SDL_crc32(0x12345678, NULL, 0);
+    SDLTest_AssertCheck(crc == 0x12345678, "Check SDL_crc32() of no data returns the CRC passed in, got 0x%.8" SDL_PRIX32, crc);
+
+    data = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(data != NULL, "Call to SDL_malloc(%d)", (int)size);
+    if (!data) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < size; ++i) {
+        data[i] = (Uint8)SDLTest_RandomUint8();
+    }
+
+    // Lengths and alignments around the edges of the fast paths
+    for (offset = 0; offset < 8; ++offset) {
+        for (len = 0; len < 300; ++len) {
+            expected = crc32_bitwise(0, data + offset, len);
+            crc = SDL_crc32(0, data + offset, len);
+            if (crc != expected) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(len == 300, "Check SDL_crc32() at offset %d for lengths up to 300, stopped at %d", (int)offset, (int)len);
+    }
+
+    // A large buffer, all at once and in pieces
+    expected = crc32_bitwise(0, data, size);
+    crc = SDL_crc32(0, data, size);
+    SDLTest_AssertCheck(crc == expected, "Check SDL_crc32() of %d bytes, expected 0x%.8" SDL_PRIX32 ", got 0x%.8" SDL_PRIX32, (int)size, expected, crc);
+    crc = 0;
+    for (offset = 0; offset < size; offset += len) {
+        len = (size_t)SDLTest_RandomIntegerInRange(1, 5000);
+        len = SDL_min(len, size - offset);
+        crc = SDL_crc32(crc, data + offset, len);
+    }
+    SDLTest_AssertCheck(crc == expected, "Check SDL_crc32() of %d bytes in pieces, expected 0x%.8" SDL_PRIX32 ", got 0x%.8" SDL_PRIX32, (int)size, expected, crc);
+
+    SDL_free(data);
+
+    return TEST_COMPLETED;
+}
+
 typedef struct
 {
     size_t a;
@@ -1237,6 +1446,127 @@ stdlib_iconv(void *arg)
     return TEST_COMPLETED;
 }
 
+static int SDLCALL
+stdlib_iconv_utf16(void *arg)
+{
+    /* Long enough runs of ASCII to be converted a block at a time, with
+       2, 3 and 4 byte characters in between and at the end */
+    const char *text = "The quick brown fox jumps over \xc3\xa9 the lazy dog "
+                       "\xe2\x8c\xa8 0123456789abcdef0123456789abcdef \xf0\x9f\x92\xbb";
+    const size_t text_len = SDL_strlen(text) + 1;
+    const char *invalid = "0123456789abcdef\xff" "0123456789abcdef";
+    char *utf16;
+    char *utf8;
+    char *expected;
+    size_t utf16_len;
+
+    utf16 = SDL_iconv_string("UTF-16LE", "UTF-8", text, text_len);
+    SDLTest_AssertPass("Call to SDL_iconv_string(\"UTF-16LE\", \"UTF-8\", ...)");
+    SDLTest_AssertCheck(utf16 != NULL, "result must NOT be NULL");
+    if (!utf16) {
+        return TEST_ABORTED;
+    }
+
+    // Every character is one UTF-16 code unit except the last, which is two
+    for (utf16_len = 0; utf16[utf16_len * 2] || utf16[utf16_len * 2 + 1]; ++utf16_len) {
+    }
+    SDLTest_AssertCheck(utf16_len == 83, "Expected 83 code units, got %d", (int)utf16_len);
+    SDLTest_AssertCheck(utf16[0] == 'T' && utf16[1] == 0, "Check first character is little endian");
+    SDLTest_AssertCheck((Uint8)utf16[81 * 2 + 1] == 0xD8 && (Uint8)utf16[82 * 2 + 1] == 0xDC, "Check surrogate pair");
+
+    utf8 = SDL_iconv_string("UTF-8", "UTF-16LE", utf16, (utf16_len + 1) * 2);
+    SDLTest_AssertPass("Call to SDL_iconv_string(\"UTF-8\", \"UTF-16LE\", ...)");
+    SDLTest_AssertCheck(utf8 && SDL_strcmp(utf8, text) == 0, "Check round trip, expected \"%s\", got \"%s\"", text, utf8 ? utf8 : "NULL");
+    SDL_free(utf8);
+    SDL_free(utf16);
+
+    // Invalid input should give the same result as converting through UCS-4
+    utf16 = SDL_iconv_string("UTF-16LE", "UTF-8", invalid, SDL_strlen(invalid) + 1);
+    SDLTest_AssertPass("Call to SDL_iconv_string(\"UTF-16LE\", \"UTF-8\", invalid)");
+    expected = SDL_iconv_string("UCS-4LE", "UTF-8", invalid, SDL_strlen(invalid) + 1);
+    utf8 = expected ? SDL_iconv_string("UTF-16LE", "UCS-4LE", expected, (SDL_strlen(invalid) + 1) * 4) : NULL;
+    SDLTest_AssertCheck(utf16 && utf8 && SDL_memcmp(utf16, utf8, 34 * 2) == 0, "Check invalid input is converted like other encodings");
+    SDL_free(utf8);
+    SDL_free(expected);
+    SDL_free(utf16);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL
+stdlib_rand_fill(void *arg)
+{
+    /* Philox4x32-10 with a zero key and counter, from the Random123 known answer tests */
+    const Uint32 expected[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+    Uint32 values[101];
+    Uint32 prefix[101];
+    float floats[101];
+    Uint64 state, state2;
+    int i;
+
+    state = 0;
+    SDL_rand_fill_r(&state, values, 4);
+    SDLTest_AssertPass("Call to SDL_rand_fill_r(&state, values, 4)");
+    SDLTest_AssertCheck(SDL_memcmp(values, expected, sizeof(expected)) == 0,
+                        "Check values, expected 0x%.8" SDL_PRIx32 ", got 0x%.8" SDL_PRIx32, expected[0], values[0]);
+    state2 = 0;
+    (void)SDL_rand_bits_r(&state2);
+    SDLTest_AssertCheck(state == state2, "Check state is advanced like SDL_rand_bits_r()");
+
+    /* Shorter fills give the start of longer ones, whichever path generated them */
+    state = state2 = 0x12345678;
+    SDL_rand_fill_r(&state, values, SDL_arraysize(values));
+    SDL_rand_fill_r(&state2, prefix, 67);
+    SDLTest_AssertCheck(SDL_memcmp(values, prefix, 67 * sizeof(Uint32)) == 0, "Check shorter fill matches");
+
+    state = 0x12345678;
+    SDL_randf_fill_r(&state, floats, SDL_arraysize(floats));
+    SDLTest_AssertPass("Call to SDL_randf_fill_r(&state, floats, %d)", (int)SDL_arraysize(floats));
+    for (i = 0; i < SDL_arraysize(floats); ++i) {
+        if (floats[i] < 0.0f || floats[i] >= 1.0f || floats[i] != (values[i] >> 8) * 0x1p-24f) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == SDL_arraysize(floats), "Check floats match the bits, mismatch at %d", i);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL
+stdlib_memory_tag_stats(void *arg)
+{
+    SDL_MemoryTagStats before, during, after;
+    SDL_Surface *surface;
+    bool result;
+
+    result = SDL_GetMemoryTagStats(SDL_MEMORY_TAG_COUNT, &before);
+    SDLTest_AssertCheck(!result, "Check SDL_GetMemoryTagStats(SDL_MEMORY_TAG_COUNT) fails");
+
+    if (!SDL_GetMemoryTagStats(SDL_MEMORY_TAG_SURFACE, &before)) {
+        SDLTest_Log("Memory statistics aren't available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    surface = SDL_CreateSurface(64, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDLTest_AssertCheck(surface != NULL, "Call to SDL_CreateSurface()");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    SDL_GetMemoryTagStats(SDL_MEMORY_TAG_SURFACE, &during);
+    SDL_DestroySurface(surface);
+    SDL_GetMemoryTagStats(SDL_MEMORY_TAG_SURFACE, &after);
+
+    SDLTest_AssertCheck(during.bytes >= before.bytes + 64 * 32 * 4, "Check surface pixels are counted");
+    SDLTest_AssertCheck(during.allocations == before.allocations + 1, "Check one allocation is counted");
+    SDLTest_AssertCheck(during.peak_bytes >= during.bytes, "Check peak is at least the current count");
+    SDLTest_AssertCheck(after.bytes == before.bytes && after.allocations == before.allocations, "Check the count goes back down");
+
+    SDL_ResetMemoryTagStats();
+    SDL_GetMemoryTagStats(SDL_MEMORY_TAG_SURFACE, &after);
+    SDLTest_AssertCheck(after.peak_bytes == after.bytes && after.total_allocations == 0, "Check SDL_ResetMemoryTagStats() resets the peak and total");
+
+    return TEST_COMPLETED;
+}
 
 static int SDLCALL
 stdlib_strpbrk(void *arg)
@@ -1468,6 +1798,18 @@ static const SDLTest_TestCaseReference stdlibTest_aligned_alloc = {
     stdlib_aligned_alloc, "stdlib_aligned_alloc", "Call to SDL_aligned_alloc", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_small_alloc = {
+    stdlib_small_alloc, "stdlib_small_alloc", "Calls to the original memory functions with small sizes", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_arena = {
+    stdlib_arena, "stdlib_arena", "Calls to the SDL_Arena functions", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_crc = {
+    stdlib_crc, "stdlib_crc", "Calls to SDL_crc16 and SDL_crc32", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTestOverflow = {
     stdlib_overflow, "stdlib_overflow", "Overflow detection", TEST_ENABLED
 };
@@ -1476,6 +1818,18 @@ static const SDLTest_TestCaseReference stdlibTest_iconv = {
     stdlib_iconv, "stdlib_iconv", "Calls to SDL_iconv", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_iconv_utf16 = {
+    stdlib_iconv_utf16, "stdlib_iconv_utf16", "Calls to SDL_iconv_string between UTF-8 and UTF-16LE", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_rand_fill = {
+    stdlib_rand_fill, "stdlib_rand_fill", "Calls to SDL_rand_fill_r and SDL_randf_fill_r", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_memory_tag_stats = {
+    stdlib_memory_tag_stats, "stdlib_memory_tag_stats", "Calls to SDL_GetMemoryTagStats", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTest_strpbrk = {
     stdlib_strpbrk, "stdlib_strpbrk", "Calls to SDL_strpbrk", TEST_ENABLED
 };
@@ -1502,8 +1856,14 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_getsetenv,
     &stdlibTest_sscanf,
     &stdlibTest_aligned_alloc,
+    &stdlibTest_small_alloc,
+    &stdlibTest_arena,
+    &stdlibTest_crc,
     &stdlibTestOverflow,
     &stdlibTest_iconv,
+    &stdlibTest_iconv_utf16,
+    &stdlibTest_rand_fill,
+    &stdlibTest_memory_tag_stats,
     &stdlibTest_strpbrk,
     &stdlibTest_wcstol,
     &stdlibTest_strtox,
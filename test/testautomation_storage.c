@@ -0,0 +1,396 @@
+/**
+ * Storage test suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+/* ================= Test Case Implementation ================== */
+
+/* Helper functions */
+
+static const char *StoragePackFilename = "storage_test.pack";
+
+typedef struct
+{
+    const char *name;
+    const char *data;
+    size_t stored_size;
+    size_t size;
+    Uint32 compression;
+} PackTestEntry;
+
+/* "abcabcabcabcabcabc!" as an LZ4 block: 3 literals and a 15 byte match 3 back, then a literal '!'. */
+static const char PackLZ4Data[] = { 0x3B, 'a', 'b', 'c', 0x03, 0x00, 0x10, '!' };
+
+static const PackTestEntry PackTestEntries[] = {
+    { "a.txt", "Hello", 5, 5, 0 },
+    { "dir/b.txt", "World!", 6, 6, 0 },
+    { "dir/sub/c.bin", PackLZ4Data, sizeof(PackLZ4Data), 19, 1 },
+    { "dir/sub/d.txt", "d", 1, 1, 0 },
+    { "dir2/e.txt", "e", 1, 1, 0 }
+};
+
+static void PutLE32(Uint8 *ptr, Uint32 value)
+{
+    value = SDL_Swap32LE(value);
+    SDL_memcpy(ptr, &value, sizeof(value));
+}
+
+static void PutLE64(Uint8 *ptr, Uint64 value)
+{
+    value = SDL_Swap64LE(value);
+    SDL_memcpy(ptr, &value, sizeof(value));
+}
+
+/* Writes the test pack: header, file data, index, name table. */
+static bool WriteTestPack(const PackTestEntry *entries, int count)
+{
+    Uint8 buffer[1024];
+    size_t pos = 32, names_size = 0;
+    Uint64 index_offset;
+    int i;
+
+    SDL_memset(buffer, 0, sizeof(buffer));
+    SDL_memcpy(buffer, "SDL_PACK", 8);
+
+    for (i = 0; i < count; i++) {
+        SDL_memcpy(&buffer[pos], entries[i].data, entries[i].stored_size);
+        pos += entries[i].stored_size;
+    }
+
+    index_offset = pos;
+    for (i = 0; i < count; i++) {
+        Uint8 *raw = &buffer[index_offset + i * 32];
+        size_t data_offset = 32;
+        int j;
+        for (j = 0; j < i; j++) {
+            data_offset += entries[j].stored_size;
+        }
+        PutLE64(&raw[0], data_offset);
+        PutLE64(&raw[8], entries[i].stored_size);
+        PutLE64(&raw[16], entries[i].size);
+        PutLE32(&raw[24], (Uint32)names_size);
+        PutLE32(&raw[28], entries[i].compression);
+        names_size += SDL_strlen(entries[i].name) + 1;
+    }
+    pos += count * 32;
+
+    for (i = 0; i < count; i++) {
+        const size_t len = SDL_strlen(entries[i].name) + 1;
+        SDL_memcpy(&buffer[pos], entries[i].name, len);
+        pos += len;
+    }
+
+    PutLE32(&buffer[8], 1);
+    PutLE32(&buffer[12], (Uint32)count);
+    PutLE64(&buffer[16], index_offset);
+    PutLE64(&buffer[24], names_size);
+
+    return SDL_SaveFile(StoragePackFilename, buffer, pos);
+}
+
+static SDL_EnumerationResult SDLCALL CollectNames(void *userdata, const char *dirname, const char *fname)
+{
+    char *list = (char *)userdata;
+    SDL_strlcat(list, dirname, 256);
+    SDL_strlcat(list, fname, 256);
+    SDL_strlcat(list, ";", 256);
+    return SDL_ENUM_CONTINUE;
+}
+
+/* Test case functions */
+
+/**
+ * Tests looking up, enumerating, globbing and reading files in a pack.
+ *
+ * \sa SDL_OpenPackStorage
+ */
+static int SDLCALL storage_testPack(void *arg)
+{
+    SDL_Storage *storage;
+    SDL_PathInfo info;
+    char list[256];
+    char buffer[32];
+    char **globbed;
+    int count = 0;
+    bool result;
+
+    result = WriteTestPack(PackTestEntries, SDL_arraysize(PackTestEntries));
+    SDLTest_AssertCheck(result, "Write test pack");
+    if (!result) {
+        return TEST_ABORTED;
+    }
+
+    storage = SDL_OpenPackStorage(StoragePackFilename);
+    SDLTest_AssertCheck(storage != NULL, "SDL_OpenPackStorage() succeeded: %s", storage ? "" : SDL_GetError());
+    if (!storage) {
+        SDL_RemovePath(StoragePackFilename);
+        return TEST_ABORTED;
+    }
+
+    result = SDL_GetStoragePathInfo(storage, "dir/b.txt", &info);
+    SDLTest_AssertCheck(result && info.type == SDL_PATHTYPE_FILE && info.size == 6, "dir/b.txt is a 6 byte file");
+    result = SDL_GetStoragePathInfo(storage, "dir/sub", &info);
+    SDLTest_AssertCheck(result && info.type == SDL_PATHTYPE_DIRECTORY, "dir/sub is a directory");
+    result = SDL_GetStoragePathInfo(storage, "di", &info);
+    SDLTest_AssertCheck(!result, "di doesn't exist");
+    result = SDL_GetStoragePathInfo(storage, "dir/sub/c", &info);
+    SDLTest_AssertCheck(!result, "dir/sub/c doesn't exist");
+
+    list[0] = '\0';
+    result = SDL_EnumerateStorageDirectory(storage, NULL, CollectNames, list);
+    SDLTest_AssertCheck(result && SDL_strcmp(list, "a.txt;dir;dir2;") == 0, "Enumerate root, got '%s'", list);
+    list[0] = '\0';
+    result = SDL_EnumerateStorageDirectory(storage, "dir", CollectNames, list);
+    SDLTest_AssertCheck(result && SDL_strcmp(list, "dir/b.txt;dir/sub;") == 0, "Enumerate dir, got '%s'", list);
+    result = SDL_EnumerateStorageDirectory(storage, "missing", CollectNames, list);
+    SDLTest_AssertCheck(!result, "Enumerate a missing directory fails");
+
+    globbed = SDL_GlobStorageDirectory(storage, NULL, "dir*/*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 2, "Glob dir*/*.txt found %d files, expected 2", count);
+    SDL_free(globbed);
+    globbed = SDL_GlobStorageDirectory(storage, "dir", "*/*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 1 && SDL_strcmp(globbed[0], "sub/d.txt") == 0, "Glob */*.txt in dir found %d files, expected sub/d.txt", count);
+    SDL_free(globbed);
+
+    SDL_zeroa(buffer);
+    result = SDL_ReadStorageFile(storage, "dir/b.txt", buffer, 6);
+    SDLTest_AssertCheck(result && SDL_strcmp(buffer, "World!") == 0, "Read dir/b.txt, got '%s'", buffer);
+    SDL_zeroa(buffer);
+    result = SDL_ReadStorageFile(storage, "dir/sub/c.bin", buffer, 19);
+    SDLTest_AssertCheck(result && SDL_strcmp(buffer, "abcabcabcabcabcabc!") == 0, "Read compressed dir/sub/c.bin, got '%s'", buffer);
+    SDL_zeroa(buffer);
+    result = SDL_ReadStorageFile(storage, "dir/sub/c.bin", buffer, 4);
+    SDLTest_AssertCheck(result && SDL_strcmp(buffer, "abca") == 0, "Read the start of compressed dir/sub/c.bin, got '%s'", buffer);
+    result = SDL_ReadStorageFile(storage, "a.txt", buffer, 6);
+    SDLTest_AssertCheck(!result, "Reading past the end of a.txt fails");
+
+    result = SDL_CloseStorage(storage);
+    SDLTest_AssertCheck(result, "SDL_CloseStorage() succeeded");
+
+    /* Title storage should open a pack when pointed at one */
+    storage = SDL_OpenTitleStorage(StoragePackFilename, 0);
+    SDLTest_AssertCheck(storage != NULL, "SDL_OpenTitleStorage() on a pack file succeeded");
+    if (storage) {
+        result = SDL_GetStoragePathInfo(storage, "dir2/e.txt", &info);
+        SDLTest_AssertCheck(result && info.type == SDL_PATHTYPE_FILE, "dir2/e.txt is a file in title storage");
+        SDL_CloseStorage(storage);
+    }
+
+    SDL_RemovePath(StoragePackFilename);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that damaged packs are refused.
+ *
+ * \sa SDL_OpenPackStorage
+ */
+static int SDLCALL storage_testPackCorrupt(void *arg)
+{
+    PackTestEntry entries[2];
+    SDL_Storage *storage;
+    Uint8 *data;
+    size_t size;
+
+    /* out of order */
+    entries[0] = PackTestEntries[1];
+    entries[1] = PackTestEntries[0];
+    WriteTestPack(entries, 2);
+    storage = SDL_OpenPackStorage(StoragePackFilename);
+    SDLTest_AssertCheck(storage == NULL, "Unsorted pack is refused");
+    SDL_CloseStorage(storage);
+
+    /* data past the end of the file */
+    WriteTestPack(PackTestEntries, 1);
+    data = (Uint8 *)SDL_LoadFile(StoragePackFilename, &size);
+    if (data) {
+        data[32 + 5 + 8] = 0xFF;  /* the first entry's stored size, right after its data */
+        data[32 + 5 + 16] = 0xFF;
+        SDL_SaveFile(StoragePackFilename, data, size);
+        SDL_free(data);
+    }
+    storage = SDL_OpenPackStorage(StoragePackFilename);
+    SDLTest_AssertCheck(storage == NULL, "Pack with data past the end of the file is refused");
+    SDL_CloseStorage(storage);
+
+    SDL_RemovePath(StoragePackFilename);
+    storage = SDL_OpenPackStorage(StoragePackFilename);
+    SDLTest_AssertCheck(storage == NULL, "Missing pack is refused");
+    SDL_CloseStorage(storage);
+
+    SDL_SaveFile(StoragePackFilename, "SDL_PACX", 8);
+    storage = SDL_OpenPackStorage(StoragePackFilename);
+    SDLTest_AssertCheck(storage == NULL, "File that isn't a pack is refused");
+    SDL_CloseStorage(storage);
+
+    SDL_RemovePath(StoragePackFilename);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that cached globs see changes made through the storage container.
+ *
+ * \sa SDL_SetStorageDirectoryCaching
+ * \sa SDL_GlobStorageDirectory
+ */
+static int SDLCALL storage_testDirectoryCache(void *arg)
+{
+    SDL_Storage *storage;
+    char **globbed;
+    int count = 0;
+    bool result;
+
+    SDL_CreateDirectory("storage_cache_test/sub");
+    SDL_SaveFile("storage_cache_test/a.txt", "a", 1);
+    SDL_SaveFile("storage_cache_test/sub/b.txt", "b", 1);
+
+    storage = SDL_OpenFileStorage("storage_cache_test");
+    SDLTest_AssertCheck(storage != NULL, "SDL_OpenFileStorage() succeeded");
+    if (!storage) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_SetStorageDirectoryCaching(storage, true);
+    SDLTest_AssertCheck(result, "SDL_SetStorageDirectoryCaching(true) succeeded");
+
+    globbed = SDL_GlobStorageDirectory(storage, NULL, "*/*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 1 && SDL_strcmp(globbed[0], "sub/b.txt") == 0, "Glob */*.txt found %d files, expected sub/b.txt", count);
+    SDL_free(globbed);
+    globbed = SDL_GlobStorageDirectory(storage, NULL, "*/*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 1, "Cached glob */*.txt found %d files, expected 1", count);
+    SDL_free(globbed);
+    globbed = SDL_GlobStorageDirectory(storage, "sub", "*", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 1 && SDL_strcmp(globbed[0], "b.txt") == 0, "Cached glob * in sub found %d files, expected b.txt", count);
+    SDL_free(globbed);
+
+    result = SDL_WriteStorageFile(storage, "sub/c.txt", "c", 1);
+    SDLTest_AssertCheck(result, "SDL_WriteStorageFile() succeeded");
+    globbed = SDL_GlobStorageDirectory(storage, NULL, "*/*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 2, "Glob */*.txt after a write found %d files, expected 2", count);
+    SDL_free(globbed);
+
+    result = SDL_RemoveStoragePath(storage, "a.txt");
+    SDLTest_AssertCheck(result, "SDL_RemoveStoragePath() succeeded");
+    globbed = SDL_GlobStorageDirectory(storage, NULL, "*.txt", 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 0, "Glob *.txt after a remove found %d files, expected 0", count);
+    SDL_free(globbed);
+
+    result = SDL_SetStorageDirectoryCaching(storage, false);
+    SDLTest_AssertCheck(result, "SDL_SetStorageDirectoryCaching(false) succeeded");
+    globbed = SDL_GlobStorageDirectory(storage, NULL, NULL, 0, &count);
+    SDLTest_AssertCheck(globbed != NULL && count == 3, "Uncached glob found %d paths, expected 3", count);
+    SDL_free(globbed);
+
+    SDL_RemoveStoragePath(storage, "sub/b.txt");
+    SDL_RemoveStoragePath(storage, "sub/c.txt");
+    SDL_RemoveStoragePath(storage, "sub");
+    SDL_CloseStorage(storage);
+    SDL_RemovePath("storage_cache_test");
+    return TEST_COMPLETED;
+}
+
+static bool SDLCALL CopyProgress(void *userdata, Uint64 copied, Uint64 total)
+{
+    Uint64 *last = (Uint64 *)userdata;
+    if (copied < *last || copied > total) {
+        return false;
+    }
+    *last = copied;
+    return true;
+}
+
+static bool SDLCALL CancelCopy(void *userdata, Uint64 copied, Uint64 total)
+{
+    return false;
+}
+
+/**
+ * Tests copying files, with and without progress callbacks.
+ *
+ * \sa SDL_CopyFileWithProgress
+ * \sa SDL_CopyStorageFile
+ */
+static int SDLCALL storage_testCopy(void *arg)
+{
+    const size_t size = 3 * 1024 * 1024 + 17;
+    SDL_Storage *storage;
+    Uint8 *data, *copy;
+    Uint64 last = 0;
+    size_t copysize = 0;
+    size_t i;
+    bool result;
+
+    data = (Uint8 *)SDL_malloc(size);
+    SDLTest_AssertCheck(data != NULL, "Allocate test data");
+    if (!data) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < size; i++) {
+        data[i] = (Uint8)(i * 7);
+    }
+    SDL_SaveFile("storage_copy_test.bin", data, size);
+
+    result = SDL_CopyFileWithProgress("storage_copy_test.bin", "storage_copy_test2.bin", CopyProgress, &last);
+    SDLTest_AssertCheck(result, "SDL_CopyFileWithProgress() succeeded: %s", result ? "" : SDL_GetError());
+    SDLTest_AssertCheck(last == size, "Progress reached %d bytes, expected %d", (int)last, (int)size);
+    copy = (Uint8 *)SDL_LoadFile("storage_copy_test2.bin", &copysize);
+    SDLTest_AssertCheck(copy && copysize == size && SDL_memcmp(copy, data, size) == 0, "Copy matches the original");
+    SDL_free(copy);
+
+    result = SDL_CopyFileWithProgress("storage_copy_test.bin", "storage_copy_test2.bin", CancelCopy, NULL);
+    SDLTest_AssertCheck(!result, "SDL_CopyFileWithProgress() stops when the callback returns false");
+
+    storage = SDL_OpenFileStorage(NULL);
+    SDLTest_AssertCheck(storage != NULL, "SDL_OpenFileStorage() succeeded");
+    if (storage) {
+        result = SDL_CopyStorageFile(storage, "storage_copy_test.bin", "storage_copy_test2.bin");
+        SDLTest_AssertCheck(result, "SDL_CopyStorageFile() succeeded");
+        copy = (Uint8 *)SDL_LoadFile("storage_copy_test2.bin", &copysize);
+        SDLTest_AssertCheck(copy && copysize == size && SDL_memcmp(copy, data, size) == 0, "Storage copy matches the original");
+        SDL_free(copy);
+        SDL_CloseStorage(storage);
+    }
+
+    SDL_free(data);
+    SDL_RemovePath("storage_copy_test.bin");
+    SDL_RemovePath("storage_copy_test2.bin");
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+static const SDLTest_TestCaseReference storageTest1 = {
+    storage_testPack, "storage_testPack", "Look up, enumerate and read files in a pack", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference storageTest2 = {
+    storage_testPackCorrupt, "storage_testPackCorrupt", "Refuse damaged packs", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference storageTest3 = {
+    storage_testDirectoryCache, "storage_testDirectoryCache", "Glob from a cached directory index", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference storageTest4 = {
+    storage_testCopy, "storage_testCopy", "Copy files with progress", TEST_ENABLED
+};
+
+/* Sequence of storage test cases */
+static const SDLTest_TestCaseReference *storageTests[] = {
+    &storageTest1,
+    &storageTest2,
+    &storageTest3,
+    &storageTest4,
+    NULL
+};
+
+/* Storage test suite (global) */
+SDLTest_TestSuiteReference storageTestSuite = {
+    "Storage",
+    NULL,
+    storageTests,
+    NULL
+};
@@ -208,6 +208,43 @@ static int SDLCALL subsystems_dependRefCountWithExtraInit(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Inits subsystems on the job pool with SDL_HINT_PARALLEL_INIT and checks the reference counts still match.
+ */
+static int SDLCALL subsystems_parallelInit(void *arg)
+{
+    const SDL_InitFlags flags = SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMEPAD | SDL_INIT_SENSOR;
+    int result;
+    /* Ensure that we start with reset subsystems. */
+    SDLTest_AssertCheck(SDL_WasInit(flags | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS) == 0,
+                        "Check result from SDL_WasInit(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMEPAD | SDL_INIT_SENSOR | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS)");
+
+    SDL_SetHint(SDL_HINT_PARALLEL_INIT, "1");
+    result = SDL_InitSubSystem(flags);
+    SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMEPAD | SDL_INIT_SENSOR)");
+    SDLTest_AssertCheck(result, "Check result from SDL_InitSubSystem(), expected: true, got: %d (%s)", result, SDL_GetError());
+    SDL_ResetHint(SDL_HINT_PARALLEL_INIT);
+    if (!result) {
+        return TEST_ABORTED;
+    }
+    result = SDL_WasInit(flags | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == (flags | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS), "Check result from SDL_WasInit(), expected: 0x%x, got: 0x%x", flags | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS, result);
+
+    /* Quit the subsystems one by one, the dependencies should go away with the last one. */
+    SDL_QuitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO)");
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_GAMEPAD)");
+    result = SDL_WasInit(SDL_INIT_JOYSTICK | SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == SDL_INIT_EVENTS, "Check result from SDL_WasInit(SDL_INIT_JOYSTICK | SDL_INIT_EVENTS), expected: 0x4000, got: 0x%x", result);
+    SDL_QuitSubSystem(SDL_INIT_SENSOR);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_SENSOR)");
+    result = SDL_WasInit(SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == 0, "Check result from SDL_WasInit(SDL_INIT_EVENTS), expected: 0, got: 0x%x", result);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Subsystems test cases */
@@ -227,9 +264,13 @@ static const SDLTest_TestCaseReference subsystemsTest4 = {
     subsystems_dependRefCountWithExtraInit, "subsystems_dependRefCountWithExtraInit", "Check reference count of subsystem dependencies.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference subsystemsTest5 = {
+    subsystems_parallelInit, "subsystems_parallelInit", "Check reference counts after parallel subsystem initialization.", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *subsystemsTests[] = {
-    &subsystemsTest1, &subsystemsTest2, &subsystemsTest3, &subsystemsTest4, NULL
+    &subsystemsTest1, &subsystemsTest2, &subsystemsTest3, &subsystemsTest4, &subsystemsTest5, NULL
 };
 
 /* Events test suite (global) */
@@ -378,6 +378,68 @@ static int SDLCALL surface_testSaveLoadBitmap(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ *  Tests loading an uncompressed top-down bitmap in place.
+ */
+static int SDLCALL surface_testLoadBitmapInPlace(void *arg)
+{
+    /* 2x2 32-bit top-down BMP, BI_RGB, with an alpha channel */
+    static const Uint8 bmp[] = {
+        'B', 'M', 70, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+        40, 0, 0, 0, 2, 0, 0, 0, 0xFE, 0xFF, 0xFF, 0xFF, 1, 0, 32, 0,
+        0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x80,
+        0xFF, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x00
+    };
+    const char *sampleFilename = "testLoadBitmapInPlace.bmp";
+    SDL_Surface *surface;
+    Uint8 r, g, b, a;
+    int i;
+
+    for (i = 0; i < 2; ++i) {
+        bool in_place = (i == 1);
+
+        SDL_SetHint(SDL_HINT_BMP_LOAD_IN_PLACE, in_place ? "1" : "0");
+        surface = SDL_LoadBMP_IO(SDL_IOFromConstMem(bmp, sizeof(bmp)), true);
+        SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_LoadBMP_IO is not NULL");
+        if (surface) {
+            SDLTest_AssertCheck(((const Uint8 *)surface->pixels == &bmp[54]) == in_place, "Verify that the pixels are %s", in_place ? "used in place" : "copied");
+            SDL_ReadSurfacePixel(surface, 1, 0, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0x00 && g == 0xFF && b == 0x00 && a == 0x80, "Verify pixel (1,0), expected 00FF0080, got %.2X%.2X%.2X%.2X", r, g, b, a);
+            SDL_ReadSurfacePixel(surface, 0, 1, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0x00 && g == 0x00 && b == 0xFF && a == 0x40, "Verify pixel (0,1), expected 0000FF40, got %.2X%.2X%.2X%.2X", r, g, b, a);
+            SDL_DestroySurface(surface);
+        }
+    }
+
+    /* Map the file and make sure the surface stays valid while it's modified */
+    unlink(sampleFilename);
+    SDLTest_AssertCheck(SDL_SaveFile(sampleFilename, bmp, sizeof(bmp)), "Call to SDL_SaveFile()");
+    surface = SDL_LoadBMP(sampleFilename);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_LoadBMP is not NULL");
+    if (surface) {
+        SDLTest_AssertCheck((surface->flags & SDL_SURFACE_PREALLOCATED) != 0, "Verify that the pixels are used in place");
+        SDL_WriteSurfacePixel(surface, 0, 0, 0x12, 0x34, 0x56, 0x78);
+        SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 0x12 && g == 0x34 && b == 0x56 && a == 0x78, "Verify pixel (0,0), expected 12345678, got %.2X%.2X%.2X%.2X", r, g, b, a);
+        SDL_DestroySurface(surface);
+    }
+    SDL_ResetHint(SDL_HINT_BMP_LOAD_IN_PLACE);
+
+    /* The file itself isn't changed */
+    surface = SDL_LoadBMP(sampleFilename);
+    SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_LoadBMP is not NULL");
+    if (surface) {
+        SDL_ReadSurfacePixel(surface, 0, 0, &r, &g, &b, &a);
+        SDLTest_AssertCheck(r == 0xFF && g == 0x00 && b == 0x00 && a == 0xFF, "Verify pixel (0,0), expected FF0000FF, got %.2X%.2X%.2X%.2X", r, g, b, a);
+        SDL_DestroySurface(surface);
+    }
+    unlink(sampleFilename);
+
+    return TEST_COMPLETED;
+}
+
 /**
  *  Tests tiled blitting.
  */
@@ -690,6 +752,82 @@ static int SDLCALL surface_testBlitMultiple(void *arg)
     return TEST_COMPLETED;
 }
 
+static int SDLCALL surface_testBlitAlternating(void *arg)
+{
+    SDL_Surface *source, *indexed, *rgba, *rgb565;
+    SDL_Palette *palette;
+    SDL_Color green = { 0, 0xFF, 0, SDL_ALPHA_OPAQUE };
+    Uint8 *pixels;
+    Uint16 pixel16;
+    int i;
+
+    palette = SDL_CreatePalette(2);
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreatePalette()");
+    palette->colors[0].r = 0;
+    palette->colors[0].g = 0;
+    palette->colors[0].b = 0;
+    palette->colors[1].r = 0xFF;
+    palette->colors[1].g = 0;
+    palette->colors[1].b = 0;
+
+    source = SDL_CreateSurface(1, 1, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface()");
+    SDL_SetSurfacePalette(source, palette);
+    *(Uint8 *)source->pixels = 1;
+
+    indexed = SDL_CreateSurface(1, 1, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(indexed != NULL, "SDL_CreateSurface()");
+    SDL_SetSurfacePalette(indexed, palette);
+    rgba = SDL_CreateSurface(1, 1, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(rgba != NULL, "SDL_CreateSurface()");
+    rgb565 = SDL_CreateSurface(1, 1, SDL_PIXELFORMAT_RGB565);
+    SDLTest_AssertCheck(rgb565 != NULL, "SDL_CreateSurface()");
+
+    /* Alternate between destinations so each blit switches the mapping */
+    for (i = 0; i < 3; ++i) {
+        *(Uint8 *)indexed->pixels = 0;
+        SDL_BlitSurface(source, NULL, indexed, NULL);
+        pixels = (Uint8 *)indexed->pixels;
+        SDLTest_AssertCheck(*pixels == 1, "Expected *pixels == 1 got %u", *pixels);
+
+        SDL_memset(rgba->pixels, 0, 4);
+        SDL_BlitSurface(source, NULL, rgba, NULL);
+        pixels = (Uint8 *)rgba->pixels;
+        SDLTest_AssertCheck(pixels[0] == 0xFF && pixels[1] == 0, "Expected red, got 0x%.2X 0x%.2X", pixels[0], pixels[1]);
+
+        *(Uint16 *)rgb565->pixels = 0;
+        SDL_BlitSurface(source, NULL, rgb565, NULL);
+        pixel16 = *(Uint16 *)rgb565->pixels;
+        SDLTest_AssertCheck(pixel16 == 0xF800, "Expected pixel16 == 0xF800 got 0x%.4X", pixel16);
+    }
+
+    /* Changing the source palette should not reuse a stale mapping */
+    SDL_SetPaletteColors(palette, &green, 1, 1);
+    SDL_BlitSurface(source, NULL, rgb565, NULL);
+    pixel16 = *(Uint16 *)rgb565->pixels;
+    SDLTest_AssertCheck(pixel16 == 0x07E0, "Expected pixel16 == 0x07E0 got 0x%.4X", pixel16);
+    SDL_BlitSurface(source, NULL, rgba, NULL);
+    pixels = (Uint8 *)rgba->pixels;
+    SDLTest_AssertCheck(pixels[0] == 0 && pixels[1] == 0xFF, "Expected green, got 0x%.2X 0x%.2X", pixels[0], pixels[1]);
+
+    /* Changing the color modulation should not reuse a stale mapping */
+    SDL_SetSurfaceColorMod(source, 0, 0, 0);
+    SDL_BlitSurface(source, NULL, rgba, NULL);
+    SDL_BlitSurface(source, NULL, rgb565, NULL);
+    pixels = (Uint8 *)rgba->pixels;
+    SDLTest_AssertCheck(pixels[0] == 0 && pixels[1] == 0, "Expected black, got 0x%.2X 0x%.2X", pixels[0], pixels[1]);
+    pixel16 = *(Uint16 *)rgb565->pixels;
+    SDLTest_AssertCheck(pixel16 == 0, "Expected pixel16 == 0 got 0x%.4X", pixel16);
+
+    SDL_DestroyPalette(palette);
+    SDL_DestroySurface(source);
+    SDL_DestroySurface(indexed);
+    SDL_DestroySurface(rgba);
+    SDL_DestroySurface(rgb565);
+
+    return TEST_COMPLETED;
+}
+
 /**
  *  Tests surface conversion.
  */
@@ -1527,6 +1665,47 @@ static int SDLCALL surface_testPremultiplyAlpha(void *arg)
 }
 
 
+static int SDLCALL surface_testPremultiplyAlphaAllValues(void *arg)
+{
+    SDL_PixelFormat formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888 };
+    SDL_Surface *surface;
+    Uint8 r, g, b, a;
+    int i, x, y, ret;
+    int mismatches;
+
+    /* Every color value is premultiplied by every alpha value, across full rows */
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        surface = SDL_CreateSurface(256, 256, formats[i]);
+        SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+        if (!surface) {
+            return TEST_ABORTED;
+        }
+        for (y = 0; y < surface->h; ++y) {
+            for (x = 0; x < surface->w; ++x) {
+                SDL_WriteSurfacePixel(surface, x, y, (Uint8)x, (Uint8)(255 - x), (Uint8)x, (Uint8)y);
+            }
+        }
+        ret = SDL_PremultiplySurfaceAlpha(surface, false);
+        SDLTest_AssertCheck(ret == true, "SDL_PremultiplySurfaceAlpha()");
+
+        mismatches = 0;
+        for (y = 0; y < surface->h; ++y) {
+            for (x = 0; x < surface->w; ++x) {
+                SDL_ReadSurfacePixel(surface, x, y, &r, &g, &b, &a);
+                if (r != (x * y) / 255 || g != ((255 - x) * y) / 255 || b != (x * y) / 255 || a != y) {
+                    ++mismatches;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Checking %s alpha premultiply results, expected 0 mismatches, got %d",
+                            SDL_GetPixelFormatName(formats[i]), mismatches);
+
+        SDL_DestroySurface(surface);
+    }
+
+    return TEST_COMPLETED;
+}
+
 static int SDLCALL surface_testScale(void *arg)
 {
     SDL_PixelFormat formats[] = {
@@ -1586,6 +1765,597 @@ static int SDLCALL surface_testScale(void *arg)
     return TEST_COMPLETED;
 }
 
+static int SDLCALL surface_testScaleDown(void *arg)
+{
+    SDL_Surface *surface, *result;
+    Uint32 pixel = 0;
+    int x, y;
+    bool matched = true;
+
+    /* Every eighth column is white, so bilinear filtering would miss them
+       entirely when shrinking by 8, while averaging gives 1/8 of white */
+    surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            row[x] = (x % 8) == 0 ? 0xFFFFFFFF : 0xFF000000;
+        }
+    }
+
+    result = SDL_ScaleSurface(surface, 8, 8, SDL_SCALEMODE_LINEAR);
+    SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface()");
+    if (!result) {
+        SDL_DestroySurface(surface);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < result->h && matched; ++y) {
+        for (x = 0; x < result->w && matched; ++x) {
+            pixel = *(Uint32 *)((Uint8 *)result->pixels + y * result->pitch + x * 4) & 0x00FFFFFF;
+            matched = (pixel == 0x00202020);
+        }
+    }
+    SDLTest_AssertCheck(matched, "Check that downscaled pixels are averaged, expected 0x00202020, got 0x%.8" SDL_PRIX32, pixel);
+
+    SDL_DestroySurface(surface);
+    SDL_DestroySurface(result);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL surface_testHDR10RoundTrip(void *arg)
+{
+    SDL_Surface *surface, *linear, *result;
+    Uint32 pixel = 0, expected = 0;
+    int x;
+    bool matched = true;
+
+    /* A gray ramp through every 10-bit PQ value should survive conversion to scRGB and back */
+    surface = SDL_CreateSurface(1024, 1, SDL_PIXELFORMAT_XBGR2101010);
+    SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceColorspace(surface, SDL_COLORSPACE_HDR10);
+    for (x = 0; x < surface->w; ++x) {
+        ((Uint32 *)surface->pixels)[x] = (3u << 30) | ((Uint32)x << 20) | ((Uint32)x << 10) | (Uint32)x;
+    }
+
+    linear = SDL_ConvertSurfaceAndColorspace(surface, SDL_PIXELFORMAT_RGBA64_FLOAT, NULL, SDL_COLORSPACE_SRGB_LINEAR, 0);
+    SDLTest_AssertCheck(linear != NULL, "SDL_ConvertSurfaceAndColorspace(SDL_COLORSPACE_SRGB_LINEAR)");
+    result = linear ? SDL_ConvertSurfaceAndColorspace(linear, SDL_PIXELFORMAT_XBGR2101010, NULL, SDL_COLORSPACE_HDR10, 0) : NULL;
+    SDLTest_AssertCheck(result != NULL, "SDL_ConvertSurfaceAndColorspace(SDL_COLORSPACE_HDR10)");
+    if (result) {
+        for (x = 0; x < result->w && matched; ++x) {
+            int i;
+            expected = ((Uint32 *)surface->pixels)[x];
+            pixel = ((Uint32 *)result->pixels)[x];
+            for (i = 0; i < 30; i += 10) {
+                if (SDL_abs((int)((pixel >> i) & 0x3FF) - (int)((expected >> i) & 0x3FF)) > 1) {
+                    matched = false;
+                }
+            }
+        }
+        SDLTest_AssertCheck(matched, "Check that HDR10 values round trip through scRGB, expected 0x%.8" SDL_PRIX32 ", got 0x%.8" SDL_PRIX32, expected, pixel);
+    }
+
+    SDL_DestroySurface(surface);
+    SDL_DestroySurface(linear);
+    SDL_DestroySurface(result);
+
+    return TEST_COMPLETED;
+}
+
+static SDL_Surface *CreateRandomSurface(int w, int h, SDL_PixelFormat format)
+{
+    SDL_Surface *surface = SDL_CreateSurface(w, h, format);
+    if (surface) {
+        Uint8 *pixels = (Uint8 *)surface->pixels;
+        int i;
+        for (i = 0; i < surface->pitch * surface->h; ++i) {
+            pixels[i] = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        }
+    }
+    return surface;
+}
+
+static int SDLCALL surface_testThreadedOperations(void *arg)
+{
+    const char *threads[] = { "0", "4" };
+    SDL_Surface *src, *results[SDL_arraysize(threads)][3];
+    SDL_Rect rect = { 3, 5, 1233, 715 };
+    bool identical;
+    int i, j, ret;
+
+    src = CreateRandomSurface(643, 361, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "SDL_CreateSurface()");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(threads); ++i) {
+        SDL_SetHint(SDL_HINT_SURFACE_THREADS, threads[i]);
+        SDLTest_AssertPass("SDL_SetHint(SDL_HINT_SURFACE_THREADS, \"%s\")", threads[i]);
+        for (j = 0; j < SDL_arraysize(results[i]); ++j) {
+            results[i][j] = SDL_CreateSurface(1240, 720, SDL_PIXELFORMAT_XBGR8888);
+            SDLTest_AssertCheck(results[i][j] != NULL, "SDL_CreateSurface()");
+            if (!results[i][j]) {
+                return TEST_ABORTED;
+            }
+            SDL_memset(results[i][j]->pixels, 0x55, results[i][j]->pitch * results[i][j]->h);
+        }
+
+        ret = SDL_BlitSurfaceScaled(src, NULL, results[i][0], &rect, SDL_SCALEMODE_LINEAR);
+        SDLTest_AssertCheck(ret == true, "SDL_BlitSurfaceScaled(SDL_SCALEMODE_LINEAR)");
+        ret = SDL_BlitSurfaceScaled(src, NULL, results[i][1], &rect, SDL_SCALEMODE_NEAREST);
+        SDLTest_AssertCheck(ret == true, "SDL_BlitSurfaceScaled(SDL_SCALEMODE_NEAREST)");
+        ret = SDL_BlitSurface(results[i][0], NULL, results[i][2], &rect);
+        SDLTest_AssertCheck(ret == true, "SDL_BlitSurface()");
+    }
+    SDL_ResetHint(SDL_HINT_SURFACE_THREADS);
+
+    for (j = 0; j < SDL_arraysize(results[0]); ++j) {
+        identical = (SDL_memcmp(results[0][j]->pixels, results[1][j]->pixels, results[0][j]->pitch * results[0][j]->h) == 0);
+        SDLTest_AssertCheck(identical, "Check that operation %d gives the same result with and without threads", j);
+    }
+
+    for (i = 0; i < SDL_arraysize(threads); ++i) {
+        for (j = 0; j < SDL_arraysize(results[i]); ++j) {
+            SDL_DestroySurface(results[i][j]);
+        }
+    }
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+
+/* Fills a surface with runs of transparent, opaque and translucent (or colorkeyed) pixels */
+static SDL_Surface *CreateRunSurface(int w, int h, SDL_PixelFormat format, bool alpha)
+{
+    SDL_Surface *surface = SDL_CreateSurface(w, h, format);
+    int x, y, run = 0, kind = 0;
+
+    if (!surface) {
+        return NULL;
+    }
+    if (SDL_ISPIXELFORMAT_INDEXED(format)) {
+        SDL_Palette *palette = SDL_CreateSurfacePalette(surface);
+        SDL_Color colors[256];
+        int i;
+
+        for (i = 0; i < SDL_arraysize(colors); ++i) {
+            colors[i].r = (Uint8)i;
+            colors[i].g = (Uint8)(i * 7);
+            colors[i].b = (Uint8)(i * 13);
+            colors[i].a = SDL_ALPHA_OPAQUE;
+        }
+        SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+    }
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            Uint8 r = 0xFF, g = 0, b = 0xFF, a;
+
+            if (--run <= 0) {
+                run = SDLTest_RandomIntegerInRange(1, 40);
+                kind = SDLTest_RandomIntegerInRange(0, 2);
+            }
+            if (kind == 0) {
+                a = SDL_ALPHA_TRANSPARENT;
+            } else if (kind == 1) {
+                a = SDL_ALPHA_OPAQUE;
+            } else {
+                a = (Uint8)SDLTest_RandomIntegerInRange(1, 254);
+            }
+            if (alpha || kind != 0) {
+                r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+                g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+                b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            }
+            SDL_WriteSurfacePixel(surface, x, y, r, g, b, alpha ? a : SDL_ALPHA_OPAQUE);
+        }
+    }
+    if (!alpha) {
+        SDL_SetSurfaceColorKey(surface, true, SDL_MapSurfaceRGB(surface, 0xFF, 0, 0xFF));
+    }
+    return surface;
+}
+
+/* Blits with and without RLE acceleration, returns the largest difference between them */
+static int CompareRLEBlits(SDL_Surface *src, SDL_Surface *rle, SDL_PixelFormat dst_format)
+{
+    const SDL_Rect rects[] = { { 0, 0, 0, 0 }, { -13, 7, 0, 0 } };
+    SDL_Surface *expected, *actual;
+    int i, x, y, diff = 0;
+
+    expected = SDL_CreateSurface(src->w, src->h, dst_format);
+    actual = SDL_CreateSurface(src->w, src->h, dst_format);
+    if (!expected || !actual) {
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(actual);
+        return 255;
+    }
+    if (SDL_ISPIXELFORMAT_INDEXED(dst_format)) {
+        SDL_SetSurfacePalette(expected, SDL_GetSurfacePalette(src));
+        SDL_SetSurfacePalette(actual, SDL_GetSurfacePalette(src));
+    }
+
+    for (i = 0; i < SDL_arraysize(rects); ++i) {
+        SDL_Rect rect = rects[i];
+
+        SDL_FillSurfaceRect(expected, NULL, SDL_MapSurfaceRGB(expected, 0x20, 0x80, 0x40));
+        SDL_FillSurfaceRect(actual, NULL, SDL_MapSurfaceRGB(actual, 0x20, 0x80, 0x40));
+        SDL_BlitSurface(src, NULL, expected, &rect);
+        rect = rects[i];
+        SDL_BlitSurface(rle, NULL, actual, &rect);
+
+        for (y = 0; y < expected->h; ++y) {
+            for (x = 0; x < expected->w; ++x) {
+                Uint8 r1, g1, b1, r2, g2, b2;
+                SDL_ReadSurfacePixel(expected, x, y, &r1, &g1, &b1, NULL);
+                SDL_ReadSurfacePixel(actual, x, y, &r2, &g2, &b2, NULL);
+                diff = SDL_max(diff, SDL_abs(r1 - r2));
+                diff = SDL_max(diff, SDL_abs(g1 - g2));
+                diff = SDL_max(diff, SDL_abs(b1 - b2));
+            }
+        }
+    }
+    SDL_DestroySurface(expected);
+    SDL_DestroySurface(actual);
+    return diff;
+}
+
+static int SDLCALL surface_testBlitRLE(void *arg)
+{
+    const SDL_PixelFormat colorkey_formats[] = {
+        SDL_PIXELFORMAT_INDEX8,
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_XRGB8888
+    };
+    const SDL_PixelFormat alpha_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_XRGB1555,
+        SDL_PIXELFORMAT_XRGB8888
+    };
+    SDL_Surface *src, *rle;
+    int i, diff, tolerance;
+
+    for (i = 0; i < SDL_arraysize(colorkey_formats); ++i) {
+        const char *name = SDL_GetPixelFormatName(colorkey_formats[i]);
+
+        src = CreateRunSurface(301, 67, colorkey_formats[i], false);
+        SDLTest_AssertCheck(src != NULL, "CreateRunSurface(%s)", name);
+        if (!src) {
+            return TEST_ABORTED;
+        }
+        rle = SDL_DuplicateSurface(src);
+        SDLTest_AssertCheck(rle != NULL, "SDL_DuplicateSurface(): %s", rle ? "" : SDL_GetError());
+        if (!rle) {
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceRLE(rle, true);
+
+        diff = CompareRLEBlits(src, rle, colorkey_formats[i]);
+        SDLTest_AssertCheck(diff == 0, "Check that colorkey RLE blits of %s match, expected 0, got %d", name, diff);
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(rle);
+    }
+
+    for (i = 0; i < SDL_arraysize(alpha_formats); ++i) {
+        const char *name = SDL_GetPixelFormatName(alpha_formats[i]);
+
+        src = CreateRunSurface(301, 67, SDL_PIXELFORMAT_ARGB8888, true);
+        SDLTest_AssertCheck(src != NULL, "CreateRunSurface(ARGB8888)");
+        if (!src) {
+            return TEST_ABORTED;
+        }
+        rle = SDL_DuplicateSurface(src);
+        SDLTest_AssertCheck(rle != NULL, "SDL_DuplicateSurface(): %s", rle ? "" : SDL_GetError());
+        if (!rle) {
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceRLE(rle, true);
+
+        /* 16-bit targets keep 5 bits of alpha in the encoding */
+        tolerance = (SDL_BYTESPERPIXEL(alpha_formats[i]) == 2) ? 16 : 1;
+        diff = CompareRLEBlits(src, rle, alpha_formats[i]);
+        SDLTest_AssertCheck(diff <= tolerance, "Check that alpha RLE blits to %s match, expected <= %d, got %d", name, tolerance, diff);
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(rle);
+    }
+
+    /* Large surfaces are encoded in the background with SDL_HINT_SURFACE_THREADS */
+    SDL_SetHint(SDL_HINT_SURFACE_THREADS, "4");
+    SDLTest_AssertPass("SDL_SetHint(SDL_HINT_SURFACE_THREADS, \"4\")");
+    src = CreateRunSurface(1024, 512, SDL_PIXELFORMAT_XRGB8888, false);
+    SDLTest_AssertCheck(src != NULL, "CreateRunSurface(XRGB8888)");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+    rle = SDL_DuplicateSurface(src);
+    SDLTest_AssertCheck(rle != NULL, "SDL_DuplicateSurface(): %s", rle ? "" : SDL_GetError());
+    if (!rle) {
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceRLE(rle, true);
+
+    /* The blits are the same before and after the encoding is done */
+    for (i = 0; i < 100 && rle->pixels; ++i) {
+        diff = CompareRLEBlits(src, rle, SDL_PIXELFORMAT_XRGB8888);
+        SDLTest_AssertCheck(diff == 0, "Check that background RLE blits match, expected 0, got %d", diff);
+        SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(rle->pixels == NULL, "Check that the surface was encoded in the background");
+
+    /* Locking the surface decodes it, and it's encoded again at the next blit */
+    SDL_LockSurface(rle);
+    SDLTest_AssertCheck(rle->pixels != NULL, "Check that locking the surface restores the pixels");
+    SDL_UnlockSurface(rle);
+    diff = CompareRLEBlits(src, rle, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(diff == 0, "Check that RLE blits match after locking, expected 0, got %d", diff);
+
+    SDL_ResetHint(SDL_HINT_SURFACE_THREADS);
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(rle);
+
+    return TEST_COMPLETED;
+}
+
+static void FillReferenceRect(SDL_Surface *surface, const SDL_Rect *clip, const SDL_Rect *rect, Uint32 color)
+{
+    const int bpp = SDL_BYTESPERPIXEL(surface->format);
+    SDL_Rect clipped;
+    int x, y;
+
+    if (!SDL_GetRectIntersection(rect, clip, &clipped)) {
+        return;
+    }
+    for (y = clipped.y; y < clipped.y + clipped.h; ++y) {
+        Uint8 *p = (Uint8 *)surface->pixels + y * surface->pitch + clipped.x * bpp;
+        for (x = 0; x < clipped.w; ++x, p += bpp) {
+            switch (bpp) {
+            case 1:
+                *p = (Uint8)color;
+                break;
+            case 2:
+            {
+                const Uint16 color16 = (Uint16)color;
+                SDL_memcpy(p, &color16, 2);
+                break;
+            }
+            case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                p[0] = (Uint8)color;
+                p[1] = (Uint8)(color >> 8);
+                p[2] = (Uint8)(color >> 16);
+#else
+                p[0] = (Uint8)(color >> 16);
+                p[1] = (Uint8)(color >> 8);
+                p[2] = (Uint8)color;
+#endif
+                break;
+            default:
+                SDL_memcpy(p, &color, 4);
+                break;
+            }
+        }
+    }
+}
+
+static int SDLCALL surface_testFillRects(void *arg)
+{
+    const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_INDEX8,
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_XRGB8888,
+    };
+    /* Small UI sized rects, rects straddling the clip edges, empty and inverted rects, and one large enough to use streaming stores */
+    const SDL_Rect rects[] = {
+        { 0, 0, 1, 1 }, { 3, 5, 7, 2 }, { 17, 9, 33, 4 }, { 61, 30, 129, 3 },
+        { -20, -20, 50, 50 }, { 1000, 550, 500, 500 }, { -5, 100, 2000, 1 },
+        { 40, 40, 0, 10 }, { 40, 40, 10, -10 }, { 5000, 5000, 10, 10 },
+        { 10, 200, 1060, 390 }, { 7, 301, 255, 17 },
+    };
+    const int w = 1100, h = 600;
+    const SDL_Rect clip = { 2, 3, 1090, 590 };
+    int i, j, offset;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        /* Use a misaligned pixel pointer as well, applications can hand us one */
+        for (offset = 0; offset <= 1; ++offset) {
+            const int bpp = SDL_BYTESPERPIXEL(formats[i]);
+            const int pitch = w * bpp + 64;
+            const Uint32 color = 0x5A3C96 & (bpp == 4 ? 0xFFFFFFFF : ((1u << (bpp * 8)) - 1));
+            Uint8 *memory = (Uint8 *)SDL_calloc(2, (size_t)pitch * h + 1);
+            SDL_Surface *actual, *expected;
+            int result;
+
+            if (!memory) {
+                return TEST_ABORTED;
+            }
+            actual = SDL_CreateSurfaceFrom(w, h, formats[i], memory + offset, pitch);
+            expected = SDL_CreateSurfaceFrom(w, h, formats[i], memory + (size_t)pitch * h + 1, pitch);
+            SDLTest_AssertCheck(actual && expected, "Create surfaces with format %s", SDL_GetPixelFormatName(formats[i]));
+            if (!actual || !expected) {
+                SDL_DestroySurface(actual);
+                SDL_DestroySurface(expected);
+                SDL_free(memory);
+                continue;
+            }
+            SDL_SetSurfaceClipRect(actual, &clip);
+
+            result = SDL_FillSurfaceRects(actual, rects, SDL_arraysize(rects), color);
+            SDLTest_AssertCheck(result, "Call to SDL_FillSurfaceRects(), expected true, got %d", result);
+            for (j = 0; j < SDL_arraysize(rects); ++j) {
+                FillReferenceRect(expected, &clip, &rects[j], color);
+            }
+
+            result = SDL_memcmp(actual->pixels, expected->pixels, (size_t)pitch * h);
+            SDLTest_AssertCheck(result == 0, "Check batched fill matches the reference for %s at offset %d", SDL_GetPixelFormatName(formats[i]), offset);
+
+            SDL_DestroySurface(actual);
+            SDL_DestroySurface(expected);
+            SDL_free(memory);
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+
+/* A 32x16 baseline JPEG with a restart marker after each MCU, left half RGB(200,60,120) and right half RGB(40,60,220) */
+static const Uint8 mjpg_32x16[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10,
+    0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18, 0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23,
+    0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40, 0x48, 0x5c, 0x4e, 0x40,
+    0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+    0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x11, 0x12,
+    0x12, 0x18, 0x15, 0x18, 0x2f, 0x1a, 0x1a, 0x2f, 0x63, 0x42, 0x38, 0x42, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x10, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3f, 0x00, 0xab, 0x45, 0x14, 0x55, 0x9e, 0xf9, 0xff, 0xd0, 0xc3, 0xa2, 0x8a,
+    0x2b, 0xe9, 0xce, 0x43, 0xff, 0xd9,
+};
+
+static int SDLCALL surface_testConvertMJPG(void *arg)
+{
+    const int w = 32, h = 16, pitch = 32 * 4 + 16;
+    Uint8 rgba[(32 * 4 + 16) * 16];
+    Uint8 argb[(32 * 4 + 16) * 16];
+    Uint8 nv12[32 * 16 * 3 / 2];
+    bool result, matched = true, padded = true;
+    int x, y;
+
+    /* RGBA32 is decoded straight into the destination, the row padding must be left alone */
+    SDL_memset(rgba, 0xAA, sizeof(rgba));
+    result = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_MJPG, mjpg_32x16, sizeof(mjpg_32x16), SDL_PIXELFORMAT_RGBA32, rgba, pitch);
+    SDLTest_AssertCheck(result, "SDL_ConvertPixels(SDL_PIXELFORMAT_MJPG -> SDL_PIXELFORMAT_RGBA32), expected: true, got: %s", result ? "true" : "false");
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            const Uint8 *p = &rgba[y * pitch + x * 4];
+            const int r = (x < 16) ? 200 : 40, b = (x < 16) ? 120 : 220;
+            if (x == 15 || x == 16) {
+                continue; /* the chroma upsampling blends the two halves here */
+            }
+            if (SDL_abs(p[0] - r) > 8 || SDL_abs(p[1] - 60) > 8 || SDL_abs(p[2] - b) > 8 || p[3] != 255) {
+                matched = false;
+            }
+        }
+        for (x = w * 4; x < pitch; ++x) {
+            if (rgba[y * pitch + x] != 0xAA) {
+                padded = false;
+            }
+        }
+    }
+    SDLTest_AssertCheck(matched, "Check decoded MJPG colors");
+    SDLTest_AssertCheck(padded, "Check that the row padding wasn't written");
+
+    /* ARGB8888 is decoded in place and swizzled, which has to match converting the RGBA32 result */
+    result = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_MJPG, mjpg_32x16, sizeof(mjpg_32x16), SDL_PIXELFORMAT_ARGB8888, argb, pitch);
+    SDLTest_AssertCheck(result, "SDL_ConvertPixels(SDL_PIXELFORMAT_MJPG -> SDL_PIXELFORMAT_ARGB8888), expected: true, got: %s", result ? "true" : "false");
+    result = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_RGBA32, rgba, pitch, SDL_PIXELFORMAT_ARGB8888, rgba, pitch);
+    SDLTest_AssertCheck(result, "SDL_ConvertPixels(SDL_PIXELFORMAT_RGBA32 -> SDL_PIXELFORMAT_ARGB8888), expected: true, got: %s", result ? "true" : "false");
+    matched = true;
+    for (y = 0; y < h; ++y) {
+        if (SDL_memcmp(&argb[y * pitch], &rgba[y * pitch], w * 4) != 0) {
+            matched = false;
+        }
+    }
+    SDLTest_AssertCheck(matched, "Check that MJPG decoded to ARGB8888 matches the converted RGBA32 pixels");
+
+    /* NV12 is written directly from the decoded YCbCr planes */
+    result = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_MJPG, mjpg_32x16, sizeof(mjpg_32x16), SDL_PIXELFORMAT_NV12, nv12, w);
+    SDLTest_AssertCheck(result, "SDL_ConvertPixels(SDL_PIXELFORMAT_MJPG -> SDL_PIXELFORMAT_NV12), expected: true, got: %s", result ? "true" : "false");
+
+    /* The wrong size is an error, and doesn't write past the destination */
+    result = SDL_ConvertPixels(w, h - 1, SDL_PIXELFORMAT_MJPG, mjpg_32x16, sizeof(mjpg_32x16), SDL_PIXELFORMAT_RGBA32, rgba, pitch);
+    SDLTest_AssertCheck(!result, "SDL_ConvertPixels() with the wrong height, expected: false, got: %s", result ? "true" : "false");
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL surface_testPooledSurfaces(void *arg)
+{
+    SDL_Surface *surface;
+    bool cleared;
+    int x, y;
+
+    SDL_SetHint(SDL_HINT_SURFACE_POOL_APP_SURFACES, "1");
+
+    /* Destroying a surface puts its pixels in the pool, and a new one of the same size picks them up */
+    surface = SDL_CreateSurface(320, 240, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+    if (surface) {
+        SDL_FillSurfaceRect(surface, NULL, 0xFFFFFFFF);
+        SDL_DestroySurface(surface);
+    }
+
+    /* A slightly smaller surface shares the same size class */
+    surface = SDL_CreateSurface(318, 240, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+    if (surface) {
+        cleared = true;
+        for (y = 0; y < surface->h; ++y) {
+            const Uint32 *row = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+            for (x = 0; x < surface->w; ++x) {
+                if (row[x] != 0) {
+                    cleared = false;
+                }
+            }
+        }
+        SDLTest_AssertCheck(cleared, "Check that reused pixels are cleared");
+        SDLTest_AssertCheck((surface->flags & SDL_SURFACE_SIMD_ALIGNED) != 0, "Check that pooled pixels are SIMD aligned");
+        SDL_DestroySurface(surface);
+    }
+
+    /* With no room in the pool, pixels are freed as usual */
+    SDL_SetHint(SDL_HINT_SURFACE_POOL_SIZE, "0");
+    surface = SDL_CreateSurface(320, 240, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "SDL_CreateSurface()");
+    SDL_DestroySurface(surface);
+
+    SDL_ResetHint(SDL_HINT_SURFACE_POOL_SIZE);
+    SDL_ResetHint(SDL_HINT_SURFACE_POOL_APP_SURFACES);
+
+    return TEST_COMPLETED;
+}
 
 /* ================= Test References ================== */
 
@@ -1598,6 +2368,10 @@ static const SDLTest_TestCaseReference surfaceTestSaveLoadBitmap = {
     surface_testSaveLoadBitmap, "surface_testSaveLoadBitmap", "Tests sprite saving and loading.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestLoadBitmapInPlace = {
+    surface_testLoadBitmapInPlace, "surface_testLoadBitmapInPlace", "Tests loading an uncompressed top-down bitmap in place.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestBlitZeroSource = {
     surface_testBlitZeroSource, "surface_testBlitZeroSource", "Tests blitting from a zero sized source rectangle", TEST_ENABLED
 };
@@ -1618,6 +2392,18 @@ static const SDLTest_TestCaseReference surfaceTestBlitMultiple = {
     surface_testBlitMultiple, "surface_testBlitMultiple", "Tests blitting between multiple surfaces of the same format.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestBlitAlternating = {
+    surface_testBlitAlternating, "surface_testBlitAlternating", "Tests blitting from one surface to alternating destinations.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitRLE = {
+    surface_testBlitRLE, "surface_testBlitRLE", "Tests RLE accelerated blitting.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestFillRects = {
+    surface_testFillRects, "surface_testFillRects", "Tests batched rectangle fills against a per pixel reference.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestLoadFailure = {
     surface_testLoadFailure, "surface_testLoadFailure", "Tests sprite loading. A failure case.", TEST_ENABLED
 };
@@ -1690,19 +2476,44 @@ static const SDLTest_TestCaseReference surfaceTestPremultiplyAlpha = {
     surface_testPremultiplyAlpha, "surface_testPremultiplyAlpha", "Test alpha premultiply operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestPremultiplyAlphaAllValues = {
+    surface_testPremultiplyAlphaAllValues, "surface_testPremultiplyAlphaAllValues", "Test alpha premultiply with every color and alpha value.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestScale = {
     surface_testScale, "surface_testScale", "Test scaling operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestScaleDown = {
+    surface_testScaleDown, "surface_testScaleDown", "Test that large downscales average the source pixels.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestHDR10RoundTrip = {
+    surface_testHDR10RoundTrip, "surface_testHDR10RoundTrip", "Test that HDR10 pixels round trip through scRGB.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference surfaceTestConvertMJPG = {
+    surface_testConvertMJPG, "surface_testConvertMJPG", "Test decoding MJPG frames into RGB and YUV formats.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference surfaceTestThreadedOperations = {
+    surface_testThreadedOperations, "surface_testThreadedOperations", "Test that surface operations split across threads match the single threaded results.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference surfaceTestPooledSurfaces = {
+    surface_testPooledSurfaces, "surface_testPooledSurfaces", "Test that surfaces reusing pooled pixels start out cleared.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestInvalidFormat,
     &surfaceTestSaveLoadBitmap,
+    &surfaceTestLoadBitmapInPlace,
     &surfaceTestBlitZeroSource,
     &surfaceTestBlit,
     &surfaceTestBlitTiled,
     &surfaceTestBlit9Grid,
     &surfaceTestBlitMultiple,
+    &surfaceTestBlitAlternating,
+    &surfaceTestBlitRLE,
+    &surfaceTestFillRects,
     &surfaceTestLoadFailure,
     &surfaceTestSurfaceConversion,
     &surfaceTestCompleteSurfaceConversion,
@@ -1721,7 +2532,13 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestPalettization,
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
+    &surfaceTestPremultiplyAlphaAllValues,
     &surfaceTestScale,
+    &surfaceTestScaleDown,
+    &surfaceTestHDR10RoundTrip,
+    &surfaceTestConvertMJPG,
+    &surfaceTestThreadedOperations,
+    &surfaceTestPooledSurfaces,
     NULL
 };
 
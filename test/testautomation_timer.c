@@ -114,6 +114,32 @@ static Uint32 SDLCALL timerTestCallback(void *param, SDL_TimerID timerID, Uint32
     return 0;
 }
 
+#define NUM_MANY_TIMERS 1000
+
+/* Number of times each of the many timers has fired */
+static SDL_AtomicInt g_manyTimerCalls[NUM_MANY_TIMERS];
+
+/* Set if a timer fires before it is due */
+static SDL_AtomicInt g_manyTimerEarly;
+
+typedef struct
+{
+    int index;
+    Uint64 due;
+} ManyTimerData;
+
+static Uint64 SDLCALL manyTimerCallback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    ManyTimerData *data = (ManyTimerData *)param;
+
+    if (SDL_GetTicksNS() < data->due) {
+        SDL_SetAtomicInt(&g_manyTimerEarly, 1);
+    }
+    SDL_AddAtomicInt(&g_manyTimerCalls[data->index], 1);
+
+    return 0;
+}
+
 #endif
 
 /**
@@ -174,6 +200,135 @@ static int SDLCALL timer_addRemoveTimer(void *arg)
 #endif
 }
 
+/**
+ * Add and remove many timers at once
+ */
+static int SDLCALL timer_manyTimers(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    ManyTimerData *data;
+    SDL_TimerID *ids;
+    int i, missing = 0, extra = 0, failed = 0;
+
+    data = (ManyTimerData *)SDL_calloc(NUM_MANY_TIMERS, sizeof(*data));
+    ids = (SDL_TimerID *)SDL_calloc(NUM_MANY_TIMERS, sizeof(*ids));
+    if (!data || !ids) {
+        SDL_free(data);
+        SDL_free(ids);
+        return TEST_ABORTED;
+    }
+
+    SDL_zeroa(g_manyTimerCalls);
+    SDL_SetAtomicInt(&g_manyTimerEarly, 0);
+
+    /* Schedule timers in random order, so they are added out of order */
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        const Uint64 interval = SDL_MS_TO_NS(SDLTest_RandomIntegerInRange(1, 50));
+
+        data[i].index = i;
+        data[i].due = SDL_GetTicksNS() + interval;
+        ids[i] = SDL_AddTimerNS(interval, manyTimerCallback, &data[i]);
+        if (!ids[i]) {
+            ++failed;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_AddTimerNS() %d times", NUM_MANY_TIMERS);
+    SDLTest_AssertCheck(failed == 0, "Check all timers were added, %d failed", failed);
+
+    /* Remove every other timer before it can fire */
+    for (i = 0; i < NUM_MANY_TIMERS; i += 2) {
+        if (ids[i] && SDL_GetAtomicInt(&g_manyTimerCalls[i]) == 0) {
+            SDL_RemoveTimer(ids[i]);
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_RemoveTimer() on every other timer");
+
+    SDL_Delay(200);
+    SDLTest_AssertPass("Call to SDL_Delay(200)");
+
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        const int calls = SDL_GetAtomicInt(&g_manyTimerCalls[i]);
+        if (calls > 1) {
+            ++extra;
+        } else if (calls == 0 && (i % 2) != 0) {
+            ++missing;
+        }
+    }
+    SDLTest_AssertCheck(missing == 0, "Check all remaining timers fired, %d didn't", missing);
+    SDLTest_AssertCheck(extra == 0, "Check no timer fired more than once, %d did", extra);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_manyTimerEarly) == 0, "Check no timer fired early");
+
+    SDL_free(data);
+    SDL_free(ids);
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Call to SDL_CreateFramePacer and SDL_WaitFramePacer
+ */
+static int SDLCALL timer_framePacer(void *arg)
+{
+    SDL_FramePacer *pacer;
+    SDL_FramePacerStats stats;
+    Uint64 start, elapsed, deadline, last_deadline = 0;
+    int i, out_of_order = 0;
+
+    pacer = SDL_CreateFramePacer(0, 1);
+    SDLTest_AssertPass("Call to SDL_CreateFramePacer(0, 1)");
+    SDLTest_AssertCheck(pacer == NULL, "Check result value, expected: NULL, got: %p", (void *)pacer);
+
+    /* 59.94 Hz keeps its fractional period */
+    pacer = SDL_CreateFramePacer(60000, 1001);
+    SDLTest_AssertPass("Call to SDL_CreateFramePacer(60000, 1001)");
+    SDLTest_AssertCheck(pacer != NULL, "Check result value, expected: non-NULL, got: %p", (void *)pacer);
+    if (!pacer) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetFramePacerStats(pacer, &stats), "Call to SDL_GetFramePacerStats()");
+    SDLTest_AssertCheck(stats.period_ns == 16683333, "Check period, expected: 16683333, got: %" SDL_PRIu64, stats.period_ns);
+
+    /* 100 frames at 500 Hz should take 200 ms */
+    SDLTest_AssertCheck(SDL_SetFramePacerRate(pacer, 500, 1), "Call to SDL_SetFramePacerRate(500, 1)");
+    start = SDL_GetTicksNS();
+    for (i = 0; i < 100; ++i) {
+        deadline = SDL_WaitFramePacer(pacer);
+        if (deadline <= last_deadline) {
+            ++out_of_order;
+        }
+        last_deadline = deadline;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDLTest_AssertPass("Call to SDL_WaitFramePacer() 100 times");
+    SDLTest_AssertCheck(out_of_order == 0, "Check deadlines always move forward, %d didn't", out_of_order);
+    SDLTest_AssertCheck(elapsed >= SDL_MS_TO_NS(199), "Check elapsed time, expected: >= 199 ms, got: %" SDL_PRIu64 " ns", elapsed);
+
+    SDLTest_AssertCheck(SDL_GetFramePacerStats(pacer, &stats), "Call to SDL_GetFramePacerStats()");
+    SDLTest_AssertCheck(stats.frames == 100, "Check frames, expected: 100, got: %" SDL_PRIu64, stats.frames);
+    SDLTest_AssertCheck(stats.period_ns == 2000000, "Check period, expected: 2000000, got: %" SDL_PRIu64, stats.period_ns);
+
+    /* A long stall drops frames instead of rushing through them */
+    SDL_ResetFramePacer(pacer);
+    SDL_WaitFramePacer(pacer);
+    SDL_Delay(50);
+    SDL_WaitFramePacer(pacer);
+    SDLTest_AssertCheck(SDL_GetFramePacerStats(pacer, &stats), "Call to SDL_GetFramePacerStats()");
+    SDLTest_AssertCheck(stats.frames == 2, "Check frames, expected: 2, got: %" SDL_PRIu64, stats.frames);
+    SDLTest_AssertCheck(stats.missed == 1, "Check missed, expected: 1, got: %" SDL_PRIu64, stats.missed);
+    SDLTest_AssertCheck(stats.dropped >= 20, "Check dropped, expected: >= 20, got: %" SDL_PRIu64, stats.dropped);
+    deadline = SDL_WaitFramePacer(pacer);
+    SDLTest_AssertCheck(deadline <= SDL_GetTicksNS() + SDL_MS_TO_NS(2), "Check the next deadline is within one frame");
+
+    SDL_DestroyFramePacer(pacer);
+    SDLTest_AssertPass("Call to SDL_DestroyFramePacer()");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -193,9 +348,17 @@ static const SDLTest_TestCaseReference timerTest4 = {
     timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    timer_manyTimers, "timer_manyTimers", "Add and remove many timers at once", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest6 = {
+    timer_framePacer, "timer_framePacer", "Call to SDL_CreateFramePacer and SDL_WaitFramePacer", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, NULL
 };
 
 /* Timer test suite (global) */
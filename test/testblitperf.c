@@ -0,0 +1,535 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for the surface blitters, scalers and pixel format converters.
+ *
+ * Every case is warmed up and then timed over a number of repetitions; the
+ * result is reported as nanoseconds per destination pixel with its standard
+ * deviation. Save a run with --output baseline.csv (CSV unless --json is
+ * given) and check later builds against it with --baseline baseline.csv;
+ * the exit code is nonzero if any case got slower than --threshold percent.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef enum
+{
+    OP_BLIT,
+    OP_SCALE,
+    OP_CONVERT
+} BenchOp;
+
+typedef struct
+{
+    char name[128];
+    double mean;   /* ns per pixel */
+    double stddev; /* ns per pixel */
+    double min;    /* ns per pixel */
+} BenchResult;
+
+typedef struct
+{
+    int warmup;
+    int repeats;
+    Uint64 min_rep_ns;
+    const char *filter;
+    bool json;
+    SDL_IOStream *out;
+    BenchResult *baseline;
+    int num_baseline;
+    double threshold;
+    int num_results;
+    int num_regressions;
+} BenchState;
+
+static const SDL_PixelFormat blit_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_INDEX8
+};
+
+static const SDL_PixelFormat blit_dst_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_RGB565
+};
+
+static const SDL_BlendMode blend_modes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_ADD,
+    SDL_BLENDMODE_MOD
+};
+
+static const SDL_ScaleMode scale_modes[] = {
+    SDL_SCALEMODE_NEAREST,
+    SDL_SCALEMODE_LINEAR
+};
+
+static const struct
+{
+    SDL_PixelFormat src;
+    SDL_PixelFormat dst;
+} convert_pairs[] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 },
+    { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_XRGB8888 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_RGB565 },
+    { SDL_PIXELFORMAT_ARGB2101010, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_YV12 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_NV12 },
+    { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_YV12 }
+};
+
+static const int full_sizes[] = { 64, 256, 1024 };
+static const int quick_sizes[] = { 64 };
+
+static const char *FormatName(SDL_PixelFormat format)
+{
+    const char *name = SDL_GetPixelFormatName(format);
+    if (SDL_strncmp(name, "SDL_PIXELFORMAT_", 16) == 0) {
+        name += 16;
+    }
+    return name;
+}
+
+static const char *BlendModeName(SDL_BlendMode mode)
+{
+    switch (mode) {
+    case SDL_BLENDMODE_NONE:
+        return "none";
+    case SDL_BLENDMODE_BLEND:
+        return "blend";
+    case SDL_BLENDMODE_ADD:
+        return "add";
+    case SDL_BLENDMODE_MOD:
+        return "mod";
+    default:
+        return "custom";
+    }
+}
+
+static const char *ScaleModeName(SDL_ScaleMode mode)
+{
+    return (mode == SDL_SCALEMODE_LINEAR) ? "linear" : "nearest";
+}
+
+static void FillRandom(void *pixels, size_t size, Uint64 *seed)
+{
+    Uint8 *p = (Uint8 *)pixels;
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        p[i] = (Uint8)SDL_rand_bits_r(seed);
+    }
+}
+
+static SDL_Surface *CreateRandomSurface(int w, int h, SDL_PixelFormat format, Uint64 *seed)
+{
+    SDL_Surface *surface = SDL_CreateSurface(w, h, format);
+
+    if (!surface) {
+        return NULL;
+    }
+    if (SDL_ISPIXELFORMAT_INDEXED(format)) {
+        SDL_Palette *palette = SDL_CreateSurfacePalette(surface);
+        int i;
+
+        if (palette) {
+            for (i = 0; i < palette->ncolors; ++i) {
+                palette->colors[i].r = (Uint8)SDL_rand_bits_r(seed);
+                palette->colors[i].g = (Uint8)SDL_rand_bits_r(seed);
+                palette->colors[i].b = (Uint8)SDL_rand_bits_r(seed);
+                palette->colors[i].a = (Uint8)SDL_rand_bits_r(seed);
+            }
+        }
+    }
+    FillRandom(surface->pixels, (size_t)surface->pitch * surface->h, seed);
+    return surface;
+}
+
+static const BenchResult *FindBaseline(const BenchState *state, const char *name)
+{
+    int i;
+
+    for (i = 0; i < state->num_baseline; ++i) {
+        if (SDL_strcmp(state->baseline[i].name, name) == 0) {
+            return &state->baseline[i];
+        }
+    }
+    return NULL;
+}
+
+static void ReportResult(BenchState *state, const BenchResult *result)
+{
+    const BenchResult *base = FindBaseline(state, result->name);
+
+    if (!state->out) {
+        /* Only the log is wanted */
+    } else if (state->json) {
+        SDL_IOprintf(state->out, "%s\n    { \"name\": \"%s\", \"mean_ns_per_pixel\": %.6f, \"stddev\": %.6f, \"min\": %.6f }",
+                     state->num_results ? "," : "", result->name, result->mean, result->stddev, result->min);
+    } else {
+        SDL_IOprintf(state->out, "%s,%.6f,%.6f,%.6f\n", result->name, result->mean, result->stddev, result->min);
+    }
+    ++state->num_results;
+
+    if (base && base->mean > 0.0) {
+        const double ratio = result->mean / base->mean;
+        const bool regressed = (ratio > 1.0 + state->threshold);
+
+        if (regressed) {
+            ++state->num_regressions;
+        }
+        SDL_Log("%-56s %8.3f ns/px  baseline %8.3f  %+6.1f%%%s", result->name, result->mean, base->mean,
+                (ratio - 1.0) * 100.0, regressed ? "  REGRESSION" : "");
+    } else {
+        SDL_Log("%-56s %8.3f ns/px  +/- %.3f", result->name, result->mean, result->stddev);
+    }
+}
+
+static bool RunOnce(BenchOp op, SDL_Surface *src, SDL_Surface *dst, SDL_ScaleMode scale_mode)
+{
+    switch (op) {
+    case OP_BLIT:
+        return SDL_BlitSurface(src, NULL, dst, NULL);
+    case OP_SCALE:
+        return SDL_BlitSurfaceScaled(src, NULL, dst, NULL, scale_mode);
+    case OP_CONVERT:
+        return SDL_ConvertPixels(src->w, src->h, src->format, src->pixels, src->pitch,
+                                 dst->format, dst->pixels, dst->pitch);
+    }
+    return false;
+}
+
+/* Times one case and reports it; returns false if the operation isn't supported */
+static bool TimeCase(BenchState *state, const char *name, BenchOp op, SDL_Surface *src, SDL_Surface *dst, SDL_ScaleMode scale_mode)
+{
+    const double pixels = (double)dst->w * dst->h;
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    BenchResult result;
+    double sum = 0.0, sum2 = 0.0, variance;
+    int calls = 1;
+    int i, j;
+
+    if (state->filter && !SDL_strstr(name, state->filter)) {
+        return true;
+    }
+
+    for (i = 0; i < state->warmup; ++i) {
+        if (!RunOnce(op, src, dst, scale_mode)) {
+            SDL_Log("%-56s skipped: %s", name, SDL_GetError());
+            return false;
+        }
+    }
+
+    /* Batch enough calls into each repetition that timer resolution doesn't matter */
+    for (;;) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 elapsed_ns;
+
+        for (j = 0; j < calls; ++j) {
+            RunOnce(op, src, dst, scale_mode);
+        }
+        elapsed_ns = (SDL_GetPerformanceCounter() - start) * SDL_NS_PER_SECOND / freq;
+        if (elapsed_ns >= state->min_rep_ns || calls >= (1 << 20)) {
+            break;
+        }
+        calls *= 2;
+    }
+
+    SDL_zero(result);
+    SDL_strlcpy(result.name, name, sizeof(result.name));
+    result.min = SDL_MAX_SINT32;
+    for (i = 0; i < state->repeats; ++i) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        double ns;
+
+        for (j = 0; j < calls; ++j) {
+            RunOnce(op, src, dst, scale_mode);
+        }
+        ns = (double)(SDL_GetPerformanceCounter() - start) * SDL_NS_PER_SECOND / freq / calls / pixels;
+        sum += ns;
+        sum2 += ns * ns;
+        if (ns < result.min) {
+            result.min = ns;
+        }
+    }
+    result.mean = sum / state->repeats;
+    variance = sum2 / state->repeats - result.mean * result.mean;
+    result.stddev = (variance > 0.0) ? SDL_sqrt(variance) : 0.0;
+
+    ReportResult(state, &result);
+    return true;
+}
+
+static void RunBlits(BenchState *state, const int *sizes, int num_sizes, Uint64 *seed)
+{
+    char name[128];
+    int s, f, d, b;
+
+    for (s = 0; s < num_sizes; ++s) {
+        const int size = sizes[s];
+
+        for (f = 0; f < SDL_arraysize(blit_formats); ++f) {
+            SDL_Surface *src = CreateRandomSurface(size, size, blit_formats[f], seed);
+
+            for (d = 0; src && d < SDL_arraysize(blit_dst_formats); ++d) {
+                SDL_Surface *dst = CreateRandomSurface(size, size, blit_dst_formats[d], seed);
+
+                for (b = 0; dst && b < SDL_arraysize(blend_modes); ++b) {
+                    SDL_SetSurfaceBlendMode(src, blend_modes[b]);
+                    SDL_snprintf(name, sizeof(name), "blit/%s->%s/%s/%dx%d",
+                                 FormatName(src->format), FormatName(dst->format),
+                                 BlendModeName(blend_modes[b]), size, size);
+                    TimeCase(state, name, OP_BLIT, src, dst, SDL_SCALEMODE_NEAREST);
+                }
+                SDL_DestroySurface(dst);
+            }
+            SDL_DestroySurface(src);
+        }
+    }
+}
+
+static void RunScales(BenchState *state, const int *sizes, int num_sizes, Uint64 *seed)
+{
+    char name[128];
+    int s, f, m, dir;
+
+    for (s = 0; s < num_sizes; ++s) {
+        const int size = sizes[s];
+
+        for (f = 0; f < SDL_arraysize(blit_dst_formats); ++f) {
+            const SDL_PixelFormat format = blit_dst_formats[f];
+
+            /* Upscale by 2x and downscale by 2x */
+            for (dir = 0; dir < 2; ++dir) {
+                const int src_size = dir ? size * 2 : size / 2;
+                SDL_Surface *src = CreateRandomSurface(src_size, src_size, format, seed);
+                SDL_Surface *dst = CreateRandomSurface(size, size, format, seed);
+
+                for (m = 0; src && dst && m < SDL_arraysize(scale_modes); ++m) {
+                    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                    SDL_snprintf(name, sizeof(name), "scale/%s/%s/%dx%d->%dx%d",
+                                 FormatName(format), ScaleModeName(scale_modes[m]),
+                                 src_size, src_size, size, size);
+                    TimeCase(state, name, OP_SCALE, src, dst, scale_modes[m]);
+                }
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+            }
+        }
+    }
+}
+
+static void RunConversions(BenchState *state, const int *sizes, int num_sizes, Uint64 *seed)
+{
+    char name[128];
+    int s, p;
+
+    for (s = 0; s < num_sizes; ++s) {
+        const int size = sizes[s];
+
+        for (p = 0; p < SDL_arraysize(convert_pairs); ++p) {
+            SDL_Surface *src = CreateRandomSurface(size, size, convert_pairs[p].src, seed);
+            SDL_Surface *dst = CreateRandomSurface(size, size, convert_pairs[p].dst, seed);
+
+            if (src && dst) {
+                SDL_snprintf(name, sizeof(name), "convert/%s->%s/%dx%d",
+                             FormatName(src->format), FormatName(dst->format), size, size);
+                TimeCase(state, name, OP_CONVERT, src, dst, SDL_SCALEMODE_NEAREST);
+            }
+            SDL_DestroySurface(src);
+            SDL_DestroySurface(dst);
+        }
+    }
+}
+
+/* Loads the CSV output of a previous run */
+static bool LoadBaseline(BenchState *state, const char *file)
+{
+    char *data = (char *)SDL_LoadFile(file, NULL);
+    char *line, *saveptr = NULL;
+
+    if (!data) {
+        return false;
+    }
+    for (line = SDL_strtok_r(data, "\r\n", &saveptr); line; line = SDL_strtok_r(NULL, "\r\n", &saveptr)) {
+        BenchResult result;
+        char *field, *fieldptr = NULL;
+        BenchResult *baseline;
+
+        field = SDL_strtok_r(line, ",", &fieldptr);
+        if (!field || SDL_strcmp(field, "name") == 0) {
+            continue;
+        }
+        SDL_zero(result);
+        SDL_strlcpy(result.name, field, sizeof(result.name));
+        field = SDL_strtok_r(NULL, ",", &fieldptr);
+        result.mean = field ? SDL_atof(field) : 0.0;
+        field = SDL_strtok_r(NULL, ",", &fieldptr);
+        result.stddev = field ? SDL_atof(field) : 0.0;
+        field = SDL_strtok_r(NULL, ",", &fieldptr);
+        result.min = field ? SDL_atof(field) : 0.0;
+
+        baseline = (BenchResult *)SDL_realloc(state->baseline, (state->num_baseline + 1) * sizeof(*baseline));
+        if (!baseline) {
+            SDL_free(data);
+            return false;
+        }
+        state->baseline = baseline;
+        state->baseline[state->num_baseline++] = result;
+    }
+    SDL_free(data);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *common;
+    BenchState state;
+    const char *output = NULL;
+    const char *baseline = NULL;
+    const int *sizes = full_sizes;
+    int num_sizes = SDL_arraysize(full_sizes);
+    Uint64 seed = 0x5eed;
+    int result = 0;
+    int i;
+
+    SDL_zero(state);
+    state.warmup = 3;
+    state.repeats = 10;
+    state.min_rep_ns = 2 * SDL_NS_PER_MS;
+    state.threshold = 0.10;
+
+    /* Initialize test framework */
+    common = SDLTest_CommonCreateState(argv, 0);
+    if (!common) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(common, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--quick") == 0) {
+                sizes = quick_sizes;
+                num_sizes = SDL_arraysize(quick_sizes);
+                state.warmup = 1;
+                state.repeats = 2;
+                state.min_rep_ns = 0;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--csv") == 0) {
+                state.json = false;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--json") == 0) {
+                state.json = true;
+                consumed = 1;
+            } else if (argv[i + 1]) {
+                if (SDL_strcmp(argv[i], "--repeats") == 0) {
+                    state.repeats = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--warmup") == 0) {
+                    state.warmup = SDL_max(SDL_atoi(argv[i + 1]), 0);
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--filter") == 0) {
+                    state.filter = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--output") == 0) {
+                    output = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--baseline") == 0) {
+                    baseline = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--threshold") == 0) {
+                    state.threshold = SDL_atof(argv[i + 1]) / 100.0;
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--quick]", "[--csv | --json]", "[--output FILE]", "[--baseline FILE]",
+                "[--threshold PERCENT]", "[--repeats N]", "[--warmup N]", "[--filter TEXT]", NULL
+            };
+            SDLTest_CommonLogUsage(common, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (baseline && !LoadBaseline(&state, baseline)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load baseline %s: %s", baseline, SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    if (output) {
+        state.out = SDL_IOFromFile(output, "w");
+        if (!state.out) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s", output, SDL_GetError());
+            result = 1;
+            goto done;
+        }
+    }
+
+    if (!state.out) {
+        /* Results are only logged */
+    } else if (state.json) {
+        SDL_IOprintf(state.out, "{\n  \"platform\": \"%s\",\n  \"cpu_count\": %d,\n  \"results\": [",
+                     SDL_GetPlatform(), SDL_GetNumLogicalCPUCores());
+    } else {
+        SDL_IOprintf(state.out, "name,mean_ns_per_pixel,stddev,min\n");
+    }
+
+    RunBlits(&state, sizes, num_sizes, &seed);
+    RunScales(&state, sizes, num_sizes, &seed);
+    RunConversions(&state, sizes, num_sizes, &seed);
+
+    if (state.out) {
+        if (state.json) {
+            SDL_IOprintf(state.out, "\n  ]\n}\n");
+        }
+        SDL_CloseIO(state.out);
+    }
+
+    if (state.num_baseline > 0) {
+        SDL_Log("%d of %d cases slower than the baseline by more than %.0f%%",
+                state.num_regressions, state.num_results, state.threshold * 100.0);
+        if (state.num_regressions > 0) {
+            result = 1;
+        }
+    }
+
+done:
+    SDL_free(state.baseline);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(common);
+    return result;
+}
@@ -0,0 +1,291 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for the event queue under contention: producer threads push
+ * timestamped user events while the main thread polls them, and the
+ * throughput, the push-to-poll latency and the time spent waiting on the
+ * event queue lock are reported. The lock statistics are only available when
+ * SDL is built with the SDL_MUTEX_STATS CMake option.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    int id;
+    int count;
+    int batch;
+    Uint32 type;
+    Uint64 full_retries;
+} Producer;
+
+static SDL_AtomicInt start_flag;
+static SDL_AtomicInt stop_flag;
+static SDL_AtomicInt finished_producers;
+
+static int SDLCALL ProducerThread(void *data)
+{
+    Producer *producer = (Producer *)data;
+    SDL_Event events[64];
+    int sent = 0;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+
+    while (sent < producer->count && !SDL_GetAtomicInt(&stop_flag)) {
+        const int n = SDL_min(producer->batch, producer->count - sent);
+        const Uint64 now = SDL_GetTicksNS();
+        int i, added;
+
+        for (i = 0; i < n; ++i) {
+            SDL_zero(events[i]);
+            events[i].type = producer->type;
+            events[i].user.timestamp = now;
+            events[i].user.code = producer->id;
+        }
+        if (n == 1) {
+            added = SDL_PushEvent(&events[0]) ? 1 : 0;
+        } else {
+            added = SDL_PushEvents(events, n);
+        }
+        if (added < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't push events: %s", SDL_GetError());
+            break;
+        }
+        sent += added;
+        if (added < n) {
+            /* The queue is full, give the consumer a chance to catch up */
+            ++producer->full_retries;
+            SDL_Delay(0);
+        }
+    }
+    SDL_AddAtomicInt(&finished_producers, 1);
+    return 0;
+}
+
+static int SDLCALL CompareLatencies(const void *a, const void *b)
+{
+    const Uint64 A = *(const Uint64 *)a;
+    const Uint64 B = *(const Uint64 *)b;
+    return (A < B) ? -1 : (A > B);
+}
+
+static double Percentile(const Uint64 *sorted, int count, int percent)
+{
+    return (double)sorted[(Sint64)(count - 1) * percent / 100] / SDL_NS_PER_US;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Producer *producers = NULL;
+    SDL_Thread **threads = NULL;
+    Uint64 *latencies = NULL;
+    SDL_Event events[64];
+    const char *output = NULL;
+    int num_producers = 4;
+    int num_events = 100000;
+    int batch = 1;
+    int peep = 1;
+    int total, received = 0;
+    Uint64 start, elapsed, full_retries = 0;
+    Uint32 type;
+    SDL_MutexStats *lock_stats = NULL, *queue_lock = NULL;
+    double events_per_second;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--quick") == 0) {
+                num_events = 2000;
+                consumed = 1;
+            } else if (argv[i + 1]) {
+                if (SDL_strcmp(argv[i], "--producers") == 0) {
+                    num_producers = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--events") == 0) {
+                    num_events = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--batch") == 0) {
+                    batch = SDL_clamp(SDL_atoi(argv[i + 1]), 1, (int)SDL_arraysize(events));
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--peep") == 0) {
+                    peep = SDL_clamp(SDL_atoi(argv[i + 1]), 1, (int)SDL_arraysize(events));
+                    consumed = 2;
+                } else if (SDL_strcmp(argv[i], "--output") == 0) {
+                    output = argv[i + 1];
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--quick]", "[--producers N]", "[--events N_PER_PRODUCER]", "[--batch N]",
+                "[--peep N]", "[--output file.json]", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    type = SDL_RegisterEvents(1);
+    total = num_producers * num_events;
+    producers = (Producer *)SDL_calloc(num_producers, sizeof(*producers));
+    threads = (SDL_Thread **)SDL_calloc(num_producers, sizeof(*threads));
+    latencies = (Uint64 *)SDL_malloc(total * sizeof(*latencies));
+    if (!type || !producers || !threads || !latencies) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the benchmark: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    for (i = 0; i < num_producers; ++i) {
+        producers[i].id = i;
+        producers[i].count = num_events;
+        producers[i].batch = batch;
+        producers[i].type = type;
+        threads[i] = SDL_CreateThread(ProducerThread, "Producer", &producers[i]);
+        if (!threads[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            SDL_SetAtomicInt(&start_flag, 1);
+            result = 1;
+            goto done;
+        }
+    }
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_ResetMutexStats();
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+
+    while (received < total) {
+        /* Checked before polling, so nothing pushed before a producer finished is missed */
+        const bool producers_done = (SDL_GetAtomicInt(&finished_producers) == num_producers);
+        int n;
+
+        if (peep == 1) {
+            n = SDL_PollEvent(&events[0]) ? 1 : 0;
+        } else {
+            SDL_PumpEvents();
+            n = SDL_PeepEvents(events, peep, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+        }
+        if (n <= 0) {
+            /* SDL_PollEvent() also returns false at the end of each poll cycle, so make sure the queue is empty */
+            if (producers_done && SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, type, type) == 0) {
+                break;
+            }
+            continue;
+        }
+        for (i = 0; i < n; ++i) {
+            if (events[i].type == type) {
+                latencies[received++] = SDL_GetTicksNS() - events[i].user.timestamp;
+            }
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    lock_stats = SDL_GetMutexStats(NULL);
+    for (i = 0; lock_stats && lock_stats[i].acquires; ++i) {
+        if (lock_stats[i].name && SDL_strcmp(lock_stats[i].name, "SDL_EventQ.lock") == 0 && !lock_stats[i].destroyed) {
+            queue_lock = &lock_stats[i];
+            break;
+        }
+    }
+
+    for (i = 0; i < num_producers; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+        threads[i] = NULL;
+        full_retries += producers[i].full_retries;
+    }
+
+    if (received < total) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d events arrived", received, total);
+        result = 1;
+        goto done;
+    }
+
+    SDL_qsort(latencies, total, sizeof(*latencies), CompareLatencies);
+    events_per_second = elapsed ? (double)total * SDL_NS_PER_SECOND / elapsed : 0.0;
+
+    SDL_Log("%d producers, %d events each, push batch %d, poll batch %d", num_producers, num_events, batch, peep);
+    SDL_Log("%.0f events/second, %" SDL_PRIu64 " pushes retried on a full queue", events_per_second, full_retries);
+    SDL_Log("latency p50 %.1f us, p90 %.1f us, p99 %.1f us, max %.1f us",
+            Percentile(latencies, total, 50), Percentile(latencies, total, 90),
+            Percentile(latencies, total, 99), Percentile(latencies, total, 100));
+    if (queue_lock) {
+        SDL_Log("event queue lock: %" SDL_PRIu64 " acquires, %" SDL_PRIu64 " contended, %.3f ms waiting, longest wait %.1f us",
+                queue_lock->acquires, queue_lock->contended, (double)queue_lock->wait_ns / SDL_NS_PER_MS,
+                (double)queue_lock->max_wait_ns / SDL_NS_PER_US);
+    } else {
+        SDL_Log("event queue lock statistics unavailable, build SDL with SDL_MUTEX_STATS to get them");
+    }
+
+    if (output) {
+        SDL_IOStream *out = SDL_IOFromFile(output, "w");
+        if (!out) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s", output, SDL_GetError());
+            result = 1;
+            goto done;
+        }
+        SDL_IOprintf(out, "{\n  \"producers\": %d,\n  \"events_per_producer\": %d,\n  \"push_batch\": %d,\n  \"poll_batch\": %d,\n",
+                     num_producers, num_events, batch, peep);
+        SDL_IOprintf(out, "  \"events_per_second\": %.1f,\n  \"full_queue_retries\": %" SDL_PRIu64 ",\n", events_per_second, full_retries);
+        SDL_IOprintf(out, "  \"latency_us\": { \"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f },\n",
+                     Percentile(latencies, total, 50), Percentile(latencies, total, 90),
+                     Percentile(latencies, total, 99), Percentile(latencies, total, 100));
+        if (queue_lock) {
+            SDL_IOprintf(out, "  \"queue_lock\": { \"acquires\": %" SDL_PRIu64 ", \"contended\": %" SDL_PRIu64 ", \"wait_ns\": %" SDL_PRIu64 ", \"max_wait_ns\": %" SDL_PRIu64 " }\n}\n",
+                         queue_lock->acquires, queue_lock->contended, queue_lock->wait_ns, queue_lock->max_wait_ns);
+        } else {
+            SDL_IOprintf(out, "  \"queue_lock\": null\n}\n");
+        }
+        if (!SDL_CloseIO(out)) {
+            result = 1;
+        }
+    }
+
+done:
+    SDL_SetAtomicInt(&stop_flag, 1);
+    if (threads) {
+        for (i = 0; i < num_producers; ++i) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+    }
+    SDL_free(lock_stats);
+    SDL_free(latencies);
+    SDL_free(threads);
+    SDL_free(producers);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
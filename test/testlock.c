@@ -51,6 +51,23 @@ static void terminate(int sig)
     SDL_SetAtomicInt(&doterminate, 1);
 }
 
+static void printstats(void)
+{
+    int i, count = 0;
+    SDL_MutexStats *stats = SDL_GetMutexStats(&count);
+
+    if (!stats) {
+        SDL_Log("No lock statistics: %s", SDL_GetError());
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        SDL_Log("Lock %s%s: %" SDL_PRIu64 " acquires, %" SDL_PRIu64 " contended, %" SDL_PRIu64 " ns waiting, %" SDL_PRIu64 " ns longest wait",
+                stats[i].name ? stats[i].name : "(unnamed)", stats[i].destroyed ? " (destroyed)" : "",
+                stats[i].acquires, stats[i].contended, stats[i].wait_ns, stats[i].max_wait_ns);
+    }
+    SDL_free(stats);
+}
+
 static void closemutex(int sig)
 {
     SDL_ThreadID id = SDL_GetCurrentThreadID();
@@ -64,6 +81,7 @@ static void closemutex(int sig)
         SDL_free(threads);
         threads = NULL;
     }
+    printstats();
     SDL_DestroyMutex(mutex);
     /* Let 'main()' return normally */
     if (sig != 0) {
@@ -186,6 +204,7 @@ int main(int argc, char *argv[])
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create mutex: %s", SDL_GetError());
         exit(1);
     }
+    SDL_SetMutexName(mutex, "testlock");
 
     mainthread = SDL_GetCurrentThreadID();
     SDL_Log("Main thread: %" SDL_PRIu64, mainthread);
@@ -10,11 +10,21 @@
   freely.
 */
 
+#include <stddef.h> /* offsetof */
+
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_test.h>
 
 static int a_global_var = 77;
+static bool sort_failed = false;
+
+typedef struct
+{
+    Uint8 padding;
+    int key;
+    int index;
+} keyed_item;
 
 static int SDLCALL
 num_compare(const void *_a, const void *_b)
@@ -37,6 +47,7 @@ static void
 test_sort(const char *desc, int *nums, const int arraylen)
 {
     static int nums_copy[1024 * 100];
+    static keyed_item items[1024 * 100];
     int i;
     int prev;
 
@@ -46,15 +57,31 @@ test_sort(const char *desc, int *nums, const int arraylen)
 
     SDL_memcpy(nums_copy, nums, arraylen * sizeof (*nums));
 
+    for (i = 0; i < arraylen; i++) {
+        items[i].key = nums[i];
+        items[i].index = i;
+    }
+
     SDL_qsort(nums, arraylen, sizeof(nums[0]), num_compare);
     SDL_qsort_r(nums_copy, arraylen, sizeof(nums[0]), num_compare_r, &a_global_var);
+    if (!SDL_SortByKey(items, arraylen, sizeof(items[0]), offsetof(keyed_item, key), SDL_SORTKEY_SINT32)) {
+        SDL_Log("SDL_SortByKey failed: %s", SDL_GetError());
+        sort_failed = true;
+        return;
+    }
 
     prev = nums[0];
     for (i = 1; i < arraylen; i++) {
         const int val = nums[i];
         const int val2 = nums_copy[i];
-        if ((val < prev) || (val != val2)) {
+        if ((val < prev) || (val != val2) || (val != items[i].key)) {
             SDL_Log("sort is broken!");
+            sort_failed = true;
+            return;
+        }
+        if (items[i].key == items[i - 1].key && items[i].index < items[i - 1].index) {
+            SDL_Log("sort by key isn't stable!");
+            sort_failed = true;
             return;
         }
         prev = val;
@@ -133,10 +160,20 @@ int main(int argc, char *argv[])
             nums[i] = SDL_rand_r(&seed, 1000000);
         }
         test_sort("random sorted", nums, arraylen);
+
+        for (i = 0; i < arraylen; i++) {
+            nums[i] = SDL_rand_r(&seed, 10) - 5;
+        }
+        test_sort("few unique values", nums, arraylen);
+
+        for (i = 0; i < arraylen; i++) {
+            nums[i] = (i < arraylen / 2) ? i : (arraylen - i);
+        }
+        test_sort("organ pipe", nums, arraylen);
     }
 
     SDL_Quit();
     SDLTest_CommonDestroyState(state);
 
-    return 0;
+    return sort_failed ? 1 : 0;
 }
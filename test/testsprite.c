@@ -43,11 +43,44 @@ static bool suspend_when_occluded;
 /* -1: infinite random moves (default); >=0: enables N deterministic moves */
 static int iterations = -1;
 
+/* Benchmark mode: render a fixed number of frames for each sprite count and report frame times */
+#define BENCHMARK_WARMUP_FRAMES 10
+
+typedef struct
+{
+    int num_sprites;
+    double fps;
+    double mean_ms;
+    double p50_ms;
+    double p99_ms;
+    double max_ms;
+    double draw_calls;
+    double state_changes;
+    double vertex_bytes;
+    double texture_upload_bytes;
+    double gpu_ms;
+} BenchmarkResult;
+
+static bool benchmark;
+static int benchmark_frames = 500;
+static int *benchmark_counts;
+static int benchmark_num_counts;
+static int benchmark_index;
+static int benchmark_frame;
+static Uint64 *benchmark_times;
+static Uint64 benchmark_start;
+static SDL_RenderStats benchmark_totals;
+static BenchmarkResult *benchmark_results;
+static const char *benchmark_output;
+
 void SDL_AppQuit(void *appstate, SDL_AppResult result)
 {
     SDL_free(sprites);
     SDL_free(positions);
     SDL_free(velocities);
+    SDL_free(benchmark_counts);
+    SDL_free(benchmark_times);
+    SDL_free(benchmark_results);
     SDLTest_CommonQuit(state);
 }
 
@@ -79,6 +112,46 @@ static int LoadSprite(const char *file)
     return 0;
 }
 
+/* Allocates 'count' sprites and scatters them over the screen with random velocities */
+static bool InitSprites(int count, Uint64 seed)
+{
+    SDL_Rect safe_area;
+    SDL_FRect *new_positions, *new_velocities;
+    int i;
+
+    new_positions = (SDL_FRect *)SDL_realloc(positions, count * sizeof(*positions));
+    if (new_positions) {
+        positions = new_positions;
+    }
+    new_velocities = (SDL_FRect *)SDL_realloc(velocities, count * sizeof(*velocities));
+    if (new_velocities) {
+        velocities = new_velocities;
+    }
+    if (!new_positions || !new_velocities) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!");
+        return false;
+    }
+    num_sprites = count;
+
+    /* Position sprites and set their velocities using the fuzzer */
+    /* Really we should be using per-window safe area, but this is fine for a simple test */
+    SDL_GetRenderSafeArea(state->renderers[0], &safe_area);
+    SDLTest_FuzzerInit(seed);
+    for (i = 0; i < num_sprites; ++i) {
+        positions[i].x = (float)SDLTest_RandomIntegerInRange(0, (int)(safe_area.w - sprite_w));
+        positions[i].y = (float)SDLTest_RandomIntegerInRange(0, (int)(safe_area.h - sprite_h));
+        positions[i].w = sprite_w;
+        positions[i].h = sprite_h;
+        velocities[i].x = 0;
+        velocities[i].y = 0;
+        while (velocities[i].x == 0.f && velocities[i].y == 0.f) {
+            velocities[i].x = (float)SDLTest_RandomIntegerInRange(-MAX_SPEED, MAX_SPEED);
+            velocities[i].y = (float)SDLTest_RandomIntegerInRange(-MAX_SPEED, MAX_SPEED);
+        }
+    }
+    return true;
+}
+
 static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
 {
     int i;
@@ -391,9 +464,115 @@ static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
     SDL_RenderPresent(renderer);
 }
 
+static int SDLCALL CompareFrameTimes(const void *a, const void *b)
+{
+    const Uint64 A = *(const Uint64 *)a;
+    const Uint64 B = *(const Uint64 *)b;
+    return (A < B) ? -1 : (A > B);
+}
+
+static void FinishBenchmarkRun(Uint64 elapsed)
+{
+    BenchmarkResult *result = &benchmark_results[benchmark_index];
+    const int n = benchmark_frames;
+    Uint64 sum = 0;
+    int i;
+
+    SDL_qsort(benchmark_times, n, sizeof(*benchmark_times), CompareFrameTimes);
+    for (i = 0; i < n; ++i) {
+        sum += benchmark_times[i];
+    }
+    result->num_sprites = num_sprites;
+    result->fps = elapsed ? (double)n * SDL_NS_PER_SECOND / elapsed : 0.0;
+    result->mean_ms = (double)sum / n / SDL_NS_PER_MS;
+    result->p50_ms = (double)benchmark_times[(n - 1) * 50 / 100] / SDL_NS_PER_MS;
+    result->p99_ms = (double)benchmark_times[(n - 1) * 99 / 100] / SDL_NS_PER_MS;
+    result->max_ms = (double)benchmark_times[n - 1] / SDL_NS_PER_MS;
+    result->draw_calls = (double)benchmark_totals.draw_calls / n;
+    result->state_changes = (double)benchmark_totals.state_changes / n;
+    result->vertex_bytes = (double)benchmark_totals.vertex_bytes / n;
+    result->texture_upload_bytes = (double)benchmark_totals.texture_upload_bytes / n;
+    result->gpu_ms = (double)benchmark_totals.gpu_time_ns / n / SDL_NS_PER_MS;
+
+    SDL_Log("%d sprites: %.2f fps, frame time p50 %.3f ms, p99 %.3f ms, max %.3f ms, %.1f draw calls per frame",
+            result->num_sprites, result->fps, result->p50_ms, result->p99_ms, result->max_ms, result->draw_calls);
+}
+
+static bool WriteBenchmarkResults(void)
+{
+    SDL_IOStream *out;
+    int w = 0, h = 0;
+    int i;
+
+    if (!benchmark_output) {
+        return true;
+    }
+    out = SDL_IOFromFile(benchmark_output, "w");
+    if (!out) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s", benchmark_output, SDL_GetError());
+        return false;
+    }
+    SDL_GetRenderOutputSize(state->renderers[0], &w, &h);
+    SDL_IOprintf(out, "{\n  \"renderer\": \"%s\",\n  \"video_driver\": \"%s\",\n  \"platform\": \"%s\",\n",
+                 SDL_GetRendererName(state->renderers[0]), SDL_GetCurrentVideoDriver(), SDL_GetPlatform());
+    SDL_IOprintf(out, "  \"output_size\": [%d, %d],\n  \"frames\": %d,\n  \"results\": [", w, h, benchmark_frames);
+    for (i = 0; i < benchmark_num_counts; ++i) {
+        const BenchmarkResult *result = &benchmark_results[i];
+        SDL_IOprintf(out, "%s\n    { \"sprites\": %d, \"fps\": %.2f, "
+                     "\"frame_time_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f }, "
+                     "\"per_frame\": { \"draw_calls\": %.1f, \"state_changes\": %.1f, \"vertex_bytes\": %.0f, \"texture_upload_bytes\": %.0f, \"gpu_time_ms\": %.4f } }",
+                     i ? "," : "", result->num_sprites, result->fps,
+                     result->mean_ms, result->p50_ms, result->p99_ms, result->max_ms,
+                     result->draw_calls, result->state_changes, result->vertex_bytes, result->texture_upload_bytes, result->gpu_ms);
+    }
+    SDL_IOprintf(out, "\n  ]\n}\n");
+    return SDL_CloseIO(out);
+}
+
+static SDL_AppResult BenchmarkIterate(void)
+{
+    const Uint64 start = SDL_GetTicksNS();
+    int i;
+
+    if (benchmark_frame == 0) {
+        benchmark_start = start;
+    }
+    for (i = 0; i < state->num_windows; ++i) {
+        if (state->windows[i]) {
+            MoveSprites(state->renderers[i], sprites[i]);
+        }
+    }
+
+    /* The first few frames of each run only warm up the caches and the renderer */
+    if (benchmark_frame >= 0) {
+        SDL_RenderStats stats;
+
+        benchmark_times[benchmark_frame] = SDL_GetTicksNS() - start;
+        if (SDL_GetRenderStats(state->renderers[0], &stats)) {
+            benchmark_totals.draw_calls += stats.draw_calls;
+            benchmark_totals.state_changes += stats.state_changes;
+            benchmark_totals.vertex_bytes += stats.vertex_bytes;
+            benchmark_totals.texture_upload_bytes += stats.texture_upload_bytes;
+            benchmark_totals.gpu_time_ns += stats.gpu_time_ns;
+        }
+    }
+
+    if (++benchmark_frame == benchmark_frames) {
+        FinishBenchmarkRun(SDL_GetTicksNS() - benchmark_start);
+        if (++benchmark_index == benchmark_num_counts) {
+            return WriteBenchmarkResults() ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+        }
+        if (!InitSprites(benchmark_counts[benchmark_index], 0)) {
+            return SDL_APP_FAILURE;
+        }
+        benchmark_frame = -BENCHMARK_WARMUP_FRAMES;
+        SDL_zero(benchmark_totals);
+    }
+    return SDL_APP_CONTINUE;
+}
+
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
 {
-    SDL_Rect safe_area;
     int i;
     Uint64 seed;
 
@@ -454,6 +633,36 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
             } else if (SDL_strcasecmp(argv[i], "--cyclealpha") == 0) {
                 cycle_alpha = true;
                 consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--benchmark-frames") == 0) {
+                if (argv[i + 1]) {
+                    benchmark_frames = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--benchmark-sweep") == 0) {
+                if (argv[i + 1] && !benchmark_counts) {
+                    const char *spot = argv[i + 1];
+                    int count = 1;
+                    while ((spot = SDL_strchr(spot, ',')) != NULL) {
+                        ++count;
+                        ++spot;
+                    }
+                    benchmark_counts = (int *)SDL_malloc(count * sizeof(*benchmark_counts));
+                    if (!benchmark_counts) {
+                        return SDL_APP_FAILURE;
+                    }
+                    for (spot = argv[i + 1]; spot; spot = SDL_strchr(spot, ',') ? SDL_strchr(spot, ',') + 1 : NULL) {
+                        benchmark_counts[benchmark_num_counts++] = SDL_max(SDL_atoi(spot), 1);
+                    }
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--benchmark-output") == 0) {
+                if (argv[i + 1]) {
+                    benchmark_output = argv[i + 1];
+                    consumed = 2;
+                }
             } else if (SDL_strcasecmp(argv[i], "--suspend-when-occluded") == 0) {
                 suspend_when_occluded = true;
                 consumed = 1;
@@ -487,6 +696,10 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
                 "[--suspend-when-occluded]",
                 "[--iterations N]",
                 "[--use-rendergeometry mode1|mode2]",
+                "[--benchmark]",
+                "[--benchmark-frames N]",
+                "[--benchmark-sweep N,N,...]",
+                "[--benchmark-output file.json]",
                 "[num_sprites]",
                 "[icon.bmp]",
                 NULL
@@ -516,36 +729,34 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
         return SDL_APP_FAILURE;
     }
 
-    /* Allocate memory for the sprite info */
-    positions = (SDL_FRect *)SDL_malloc(num_sprites * sizeof(*positions));
-    velocities = (SDL_FRect *)SDL_malloc(num_sprites * sizeof(*velocities));
-    if (!positions || !velocities) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!");
-        return SDL_APP_FAILURE;
-    }
-
-    /* Position sprites and set their velocities using the fuzzer */
-    /* Really we should be using per-window safe area, but this is fine for a simple test */
-    SDL_GetRenderSafeArea(state->renderers[0], &safe_area);
-    if (iterations >= 0) {
+    if (benchmark) {
+        /* Every run of the benchmark draws the same scene */
+        if (!benchmark_counts) {
+            benchmark_counts = (int *)SDL_malloc(sizeof(*benchmark_counts));
+            if (!benchmark_counts) {
+                return SDL_APP_FAILURE;
+            }
+            benchmark_counts[0] = num_sprites;
+            benchmark_num_counts = 1;
+        }
+        benchmark_times = (Uint64 *)SDL_calloc(benchmark_frames, sizeof(*benchmark_times));
+        benchmark_results = (BenchmarkResult *)SDL_calloc(benchmark_num_counts, sizeof(*benchmark_results));
+        if (!benchmark_times || !benchmark_results) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!");
+            return SDL_APP_FAILURE;
+        }
+        num_sprites = benchmark_counts[0];
+        benchmark_frame = -BENCHMARK_WARMUP_FRAMES;
+        seed = 0;
+    } else if (iterations >= 0) {
         /* Deterministic seed - used for visual tests */
         seed = (Uint64)iterations;
     } else {
         /* Pseudo-random seed generated from the time */
         seed = SDL_GetPerformanceCounter();
     }
-    SDLTest_FuzzerInit(seed);
-    for (i = 0; i < num_sprites; ++i) {
-        positions[i].x = (float)SDLTest_RandomIntegerInRange(0, (int)(safe_area.w - sprite_w));
-        positions[i].y = (float)SDLTest_RandomIntegerInRange(0, (int)(safe_area.h - sprite_h));
-        positions[i].w = sprite_w;
-        positions[i].h = sprite_h;
-        velocities[i].x = 0;
-        velocities[i].y = 0;
-        while (velocities[i].x == 0.f && velocities[i].y == 0.f) {
-            velocities[i].x = (float)SDLTest_RandomIntegerInRange(-MAX_SPEED, MAX_SPEED);
-            velocities[i].y = (float)SDLTest_RandomIntegerInRange(-MAX_SPEED, MAX_SPEED);
-        }
+    if (!InitSprites(num_sprites, seed)) {
+        return SDL_APP_FAILURE;
     }
 
     /* Main render loop in SDL_AppIterate will begin when this function returns. */
@@ -570,6 +781,10 @@ SDL_AppResult SDL_AppIterate(void *appstate)
     int i;
     int active_windows = 0;
 
+    if (benchmark) {
+        return BenchmarkIterate();
+    }
+
     for (i = 0; i < state->num_windows; ++i) {
         if (state->windows[i] == NULL ||
             (suspend_when_occluded && (SDL_GetWindowFlags(state->windows[i]) & SDL_WINDOW_OCCLUDED))) {